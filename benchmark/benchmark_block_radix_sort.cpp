@@ -51,7 +51,8 @@ const size_t DEFAULT_BYTES = 1024 * 1024 * 128 * 4;
 enum class benchmark_kinds
 {
     sort_keys,
-    sort_pairs
+    sort_pairs,
+    sort_keys_to_ranks
 };
 
 namespace rp = rocprim;
@@ -122,6 +123,40 @@ __global__ __launch_bounds__(BlockSize) void sort_pairs_kernel(const T* input, T
     rp::block_store_direct_striped<BlockSize>(lid, output + block_offset, keys);
 }
 
+// Stores the sorted keys by scattering them to their ranks, instead of exchanging them to the
+// blocked arrangement first
+template<class T,
+         unsigned int BlockSize,
+         unsigned int RadixBitsPerPass,
+         unsigned int ItemsPerThread,
+         unsigned int Trials>
+__global__ __launch_bounds__(BlockSize) void sort_keys_to_ranks_kernel(const T* input, T* output)
+{
+    const unsigned int lid = threadIdx.x;
+    const unsigned int block_offset = blockIdx.x * ItemsPerThread * BlockSize;
+
+    using block_sort_type = rp::block_radix_sort<T,
+                                                 BlockSize,
+                                                 ItemsPerThread,
+                                                 rocprim::empty_type,
+                                                 1,
+                                                 1,
+                                                 RadixBitsPerPass>;
+
+    T keys[ItemsPerThread];
+    rp::block_load_direct_striped<BlockSize>(lid, input + block_offset, keys);
+
+    unsigned int ranks[ItemsPerThread];
+    ROCPRIM_NO_UNROLL
+    for(unsigned int trial = 0; trial < Trials; trial++)
+    {
+        block_sort_type sort;
+        sort.sort_to_ranks(keys, ranks, 0, sizeof(T) * 8, select_decomposer_t<T>{});
+    }
+
+    block_sort_type::scatter_by_rank(keys, ranks, output + block_offset);
+}
+
 template<class T,
          unsigned int BlockSize,
          unsigned int RadixBitsPerPass,
@@ -191,6 +226,21 @@ void run_benchmark(benchmark::State&   state,
                 d_input,
                 d_output);
         }
+        else if(benchmark_kind == benchmark_kinds::sort_keys_to_ranks)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(sort_keys_to_ranks_kernel<T,
+                                                          BlockSize,
+                                                          RadixBitsPerPass,
+                                                          ItemsPerThread,
+                                                          Trials>),
+                dim3(size / items_per_block),
+                dim3(BlockSize),
+                0,
+                stream,
+                d_input,
+                d_output);
+        }
         HIP_CHECK(hipGetLastError());
 
         // Record stop event and wait until it completes
@@ -335,6 +385,12 @@ int main(int argc, char *argv[])
     std::vector<benchmark::internal::Benchmark*> benchmarks;
     add_benchmarks(benchmark_kinds::sort_keys, "keys", benchmarks, bytes, seed, stream);
     add_benchmarks(benchmark_kinds::sort_pairs, "pairs", benchmarks, bytes, seed, stream);
+    add_benchmarks(benchmark_kinds::sort_keys_to_ranks,
+                   "keys_to_ranks",
+                   benchmarks,
+                   bytes,
+                   seed,
+                   stream);
 
     // Use manual timing
     for(auto& b : benchmarks)
@@ -203,6 +203,9 @@ void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
         BENCHMARK_TYPE(uint8_t, 64),
         BENCHMARK_TYPE(rocprim::half, 64),
 
+        BENCHMARK_TYPE(int, 128),
+        BENCHMARK_TYPE(float, 128),
+
         BENCHMARK_TYPE(int, 256),
         BENCHMARK_TYPE(float, 256),
         BENCHMARK_TYPE(double, 256),
@@ -196,8 +196,9 @@ void run_benchmark(benchmark::State&   state,
         CREATE_BENCHMARK(T, K, SORTED, lower_bound_subalgorithm), \
         CREATE_BENCHMARK(T, K, SORTED, upper_bound_subalgorithm)
 
-#define BENCHMARK_TYPE(type) \
-    BENCHMARK_ALGORITHMS(type, 10, true), BENCHMARK_ALGORITHMS(type, 10, false)
+#define BENCHMARK_TYPE(type)                                                      \
+    BENCHMARK_ALGORITHMS(type, 10, true), BENCHMARK_ALGORITHMS(type, 10, false),  \
+        CREATE_BENCHMARK(type, 10, true, lower_bound_sorted_needles_subalgorithm)
 
 int main(int argc, char *argv[])
 {
@@ -61,6 +61,15 @@ struct upper_bound_subalgorithm
     }
 };
 
+// Merges the needles with the haystack, the needles must be sorted
+struct lower_bound_sorted_needles_subalgorithm
+{
+    std::string name() const
+    {
+        return "lower_bound_sorted_needles";
+    }
+};
+
 template<class Config = rocprim::default_config>
 struct dispatch_binary_search_helper
 {
@@ -84,6 +93,13 @@ struct dispatch_binary_search_helper
         using config = rocprim::lower_bound_config<Config::block_size, Config::items_per_thread>;
         return rocprim::lower_bound<config>(std::forward<Args>(args)...);
     }
+
+    template<class... Args>
+    hipError_t dispatch_binary_search(lower_bound_sorted_needles_subalgorithm, Args&&... args)
+    {
+        using config = rocprim::merge_config<Config::block_size, Config::items_per_thread>;
+        return rocprim::lower_bound_sorted_needles<config>(std::forward<Args>(args)...);
+    }
 };
 
 template<>
@@ -106,6 +122,13 @@ struct dispatch_binary_search_helper<rocprim::default_config>
     {
         return rocprim::lower_bound<rocprim::default_config>(std::forward<Args>(args)...);
     }
+
+    template<class... Args>
+    hipError_t dispatch_binary_search(lower_bound_sorted_needles_subalgorithm, Args&&... args)
+    {
+        return rocprim::lower_bound_sorted_needles<rocprim::default_config>(
+            std::forward<Args>(args)...);
+    }
 };
 
 template<class SubAlgorithm, class T, class OutputType, class Config>
@@ -0,0 +1,294 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Streams a buffer through rocprim::transform with the default caching behaviour and with
+// nontemporal loads and stores, alone and next to a kernel on another stream that keeps
+// re-reading an L2-sized buffer. The nontemporal accesses of the transform should leave more of
+// the L2 cache to the co-running kernel.
+
+#include "benchmark_utils.hpp"
+// CmdParser
+#include "cmdparser.hpp"
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/iterator/cache_modified_input_iterator.hpp>
+#include <rocprim/iterator/cache_modified_output_iterator.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+#ifndef DEFAULT_BYTES
+const size_t DEFAULT_BYTES = 1024 * 1024 * 128 * 4;
+#endif
+
+namespace
+{
+
+// Passes of the co-running kernel over its buffer in each iteration of the benchmark.
+constexpr unsigned int reuse_passes = 64;
+
+__global__ __launch_bounds__(256) void l2_reuse_kernel(const unsigned int* data,
+                                                       const size_t        size,
+                                                       const unsigned int  passes,
+                                                       unsigned int*       result)
+{
+    unsigned int sum = 0;
+    for(unsigned int pass = 0; pass < passes; ++pass)
+    {
+        for(size_t i = blockIdx.x * blockDim.x + threadIdx.x; i < size;
+            i += gridDim.x * blockDim.x)
+        {
+            sum += data[i];
+        }
+    }
+    // The sum is almost never this value, it keeps the loads from being optimized away
+    if(sum == 0xFFFFFFFFu)
+    {
+        *result = sum;
+    }
+}
+
+template<class T>
+struct plus_one
+{
+    ROCPRIM_HOST_DEVICE
+    T operator()(const T& value) const
+    {
+        return value + T(1);
+    }
+};
+
+template<class T, bool NonTemporal, bool CoRunning>
+struct device_cache_policy_benchmark : public config_autotune_interface
+{
+    std::string name() const override
+    {
+        return bench_naming::format_name(
+            "{lvl:device,algo:cache_policy,subalgo:transform,value_type:"
+            + std::string(Traits<T>::name()) + ",policy:"
+            + (NonTemporal ? "nontemporal" : "default") + ",corun:"
+            + (CoRunning ? "l2_reuse" : "none") + ",cfg:default_config}");
+    }
+
+    template<class InputIterator, class OutputIterator>
+    static void run_transform(InputIterator  input,
+                              OutputIterator output,
+                              const size_t   size,
+                              hipStream_t    stream)
+    {
+        HIP_CHECK(rocprim::transform(input, output, size, plus_one<T>(), stream));
+    }
+
+    void run(benchmark::State&   state,
+             size_t              bytes,
+             const managed_seed& seed,
+             hipStream_t         stream) const override
+    {
+        const size_t         size  = bytes / sizeof(T);
+        const std::vector<T> input = get_random_data<T>(size, T(0), T(100), seed.get_0());
+
+        T* d_input;
+        T* d_output;
+        HIP_CHECK(hipMalloc(&d_input, size * sizeof(*d_input)));
+        HIP_CHECK(hipMalloc(&d_output, size * sizeof(*d_output)));
+        HIP_CHECK(
+            hipMemcpy(d_input, input.data(), size * sizeof(*d_input), hipMemcpyHostToDevice));
+
+        // The co-running kernel reads a buffer of the size of the L2 cache on its own stream
+        int             device_id;
+        hipDeviceProp_t props;
+        HIP_CHECK(hipGetDevice(&device_id));
+        HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+        const size_t reuse_size = static_cast<size_t>(props.l2CacheSize) / sizeof(unsigned int);
+
+        unsigned int* d_reuse;
+        unsigned int* d_reuse_result;
+        HIP_CHECK(hipMalloc(&d_reuse, reuse_size * sizeof(*d_reuse)));
+        HIP_CHECK(hipMalloc(&d_reuse_result, sizeof(*d_reuse_result)));
+        HIP_CHECK(hipMemset(d_reuse, 1, reuse_size * sizeof(*d_reuse)));
+
+        hipStream_t reuse_stream;
+        hipEvent_t  reuse_start;
+        hipEvent_t  reuse_stop;
+        HIP_CHECK(hipStreamCreateWithFlags(&reuse_stream, hipStreamNonBlocking));
+        HIP_CHECK(hipEventCreate(&reuse_start));
+        HIP_CHECK(hipEventCreate(&reuse_stop));
+
+        const auto transform = [&]
+        {
+            if(NonTemporal)
+            {
+                run_transform(rocprim::make_cache_modified_input_iterator<rocprim::load_cs>(
+                                  static_cast<const T*>(d_input)),
+                              rocprim::make_cache_modified_output_iterator<rocprim::store_cs>(
+                                  d_output),
+                              size,
+                              stream);
+            }
+            else
+            {
+                run_transform(d_input, d_output, size, stream);
+            }
+        };
+        const auto co_run = [&]
+        {
+            HIP_CHECK(hipEventRecord(reuse_start, reuse_stream));
+            l2_reuse_kernel<<<props.multiProcessorCount * 4, 256, 0, reuse_stream>>>(
+                d_reuse,
+                reuse_size,
+                reuse_passes,
+                d_reuse_result);
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipEventRecord(reuse_stop, reuse_stream));
+        };
+
+        // Warm-up
+        for(unsigned int i = 0; i < 5; ++i)
+        {
+            transform();
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        double reuse_ms = 0;
+        for(auto _ : state)
+        {
+            if(CoRunning)
+            {
+                co_run();
+            }
+            const auto start = std::chrono::high_resolution_clock::now();
+            transform();
+            HIP_CHECK(hipStreamSynchronize(stream));
+            const auto end = std::chrono::high_resolution_clock::now();
+            state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+
+            if(CoRunning)
+            {
+                HIP_CHECK(hipEventSynchronize(reuse_stop));
+                float elapsed;
+                HIP_CHECK(hipEventElapsedTime(&elapsed, reuse_start, reuse_stop));
+                reuse_ms += elapsed;
+            }
+        }
+
+        state.SetBytesProcessed(state.iterations() * size * 2 * sizeof(T));
+        state.SetItemsProcessed(state.iterations() * size);
+        if(CoRunning)
+        {
+            // Time and bandwidth of the co-running kernel, which are the larger the more of its
+            // buffer the transform evicts from the L2 cache
+            const double reuse_bytes
+                = static_cast<double>(reuse_passes) * reuse_size * sizeof(unsigned int);
+            state.counters["corun_ms"] = reuse_ms / state.iterations();
+            state.counters["corun_bytes_per_second"]
+                = benchmark::Counter(reuse_bytes * state.iterations() / (reuse_ms / 1000));
+        }
+
+        HIP_CHECK(hipEventDestroy(reuse_start));
+        HIP_CHECK(hipEventDestroy(reuse_stop));
+        HIP_CHECK(hipStreamDestroy(reuse_stream));
+        HIP_CHECK(hipFree(d_reuse));
+        HIP_CHECK(hipFree(d_reuse_result));
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+    }
+};
+
+} // namespace
+
+#define CREATE_BENCHMARK(T, NON_TEMPORAL, CO_RUNNING)                                \
+    {                                                                                \
+        const device_cache_policy_benchmark<T, NON_TEMPORAL, CO_RUNNING> instance;   \
+        REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance);               \
+    }
+
+#define CREATE_BENCHMARKS(T)            \
+    CREATE_BENCHMARK(T, false, false)   \
+    CREATE_BENCHMARK(T, true, false)    \
+    CREATE_BENCHMARK(T, false, true)    \
+    CREATE_BENCHMARK(T, true, true)
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_BYTES, "number of bytes");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.set_optional<std::string>("name_format",
+                                     "name_format",
+                                     "human",
+                                     "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t bytes  = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+    bench_naming::set_format(parser.get<std::string>("name_format"));
+    const std::string  seed_type = parser.get<std::string>("seed");
+    const managed_seed seed(seed_type);
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("bytes", std::to_string(bytes));
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks{};
+    CREATE_BENCHMARKS(int)
+    CREATE_BENCHMARKS(long long)
+    CREATE_BENCHMARKS(float)
+    CREATE_BENCHMARKS(double)
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
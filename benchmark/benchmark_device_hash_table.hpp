@@ -0,0 +1,174 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+
+#ifndef ROCPRIM_BENCHMARK_DEVICE_HASH_TABLE_HPP_
+#define ROCPRIM_BENCHMARK_DEVICE_HASH_TABLE_HPP_
+
+#include "benchmark_utils.hpp"
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/device/device_hash_table.hpp>
+
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+template<typename Key    = int,
+         typename Value  = float,
+         typename Config = rocprim::default_config>
+struct device_hash_reduce_by_key_benchmark : public config_autotune_interface
+{
+    size_t unique_keys;
+
+    device_hash_reduce_by_key_benchmark(size_t UniqueKeys) : unique_keys(UniqueKeys) {}
+
+    std::string name() const override
+    {
+        using namespace std::string_literals;
+        return bench_naming::format_name(
+            "{lvl:device,algo:hash_reduce_by_key,unique_keys:" + std::to_string(unique_keys)
+            + ",key_type:" + std::string(Traits<Key>::name())
+            + ",value_type:" + std::string(Traits<Value>::name()) + ",cfg:default_config}");
+    }
+
+    static constexpr unsigned int batch_size  = 10;
+    static constexpr unsigned int warmup_size = 5;
+
+    void run(benchmark::State&   state,
+             size_t              bytes,
+             const managed_seed& seed,
+             hipStream_t         stream) const override
+    {
+        using key_type   = Key;
+        using value_type = Value;
+
+        // Calculate the number of elements
+        const size_t size = bytes / sizeof(key_type);
+
+        // Generate data
+        const std::vector<key_type> keys_input
+            = get_random_data<key_type>(size,
+                                        key_type(0),
+                                        static_cast<key_type>(unique_keys - 1),
+                                        seed.get_0());
+        const std::vector<value_type> values_input
+            = get_random_data<value_type>(size, value_type(0), value_type(100), seed.get_1());
+
+        key_type*   d_keys_input;
+        value_type* d_values_input;
+        key_type*   d_unique_output;
+        value_type* d_aggregates_output;
+        size_t*     d_unique_count_output;
+        HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(*d_keys_input)));
+        HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(*d_values_input)));
+        HIP_CHECK(hipMalloc(&d_unique_output, unique_keys * sizeof(*d_unique_output)));
+        HIP_CHECK(hipMalloc(&d_aggregates_output, unique_keys * sizeof(*d_aggregates_output)));
+        HIP_CHECK(hipMalloc(&d_unique_count_output, sizeof(*d_unique_count_output)));
+
+        HIP_CHECK(hipMemcpy(d_keys_input,
+                            keys_input.data(),
+                            size * sizeof(*d_keys_input),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_values_input,
+                            values_input.data(),
+                            size * sizeof(*d_values_input),
+                            hipMemcpyHostToDevice));
+
+        const key_type empty_key = static_cast<key_type>(-1);
+
+        auto dispatch = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+        {
+            HIP_CHECK(rocprim::hash_reduce_by_key<Config>(d_temporary_storage,
+                                                          temporary_storage_bytes,
+                                                          d_keys_input,
+                                                          d_values_input,
+                                                          size,
+                                                          d_unique_output,
+                                                          d_aggregates_output,
+                                                          d_unique_count_output,
+                                                          unique_keys,
+                                                          empty_key,
+                                                          value_type(0),
+                                                          rocprim::plus<value_type>(),
+                                                          stream,
+                                                          false));
+        };
+
+        void*  d_temporary_storage     = nullptr;
+        size_t temporary_storage_bytes = 0;
+        dispatch(d_temporary_storage, temporary_storage_bytes);
+        HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+        // Warm-up
+        for(size_t i = 0; i < warmup_size; i++)
+        {
+            dispatch(d_temporary_storage, temporary_storage_bytes);
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // HIP events creation
+        hipEvent_t start, stop;
+        HIP_CHECK(hipEventCreate(&start));
+        HIP_CHECK(hipEventCreate(&stop));
+
+        for(auto _ : state)
+        {
+            // Record start event
+            HIP_CHECK(hipEventRecord(start, stream));
+
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                dispatch(d_temporary_storage, temporary_storage_bytes);
+            }
+
+            // Record stop event and wait until it completes
+            HIP_CHECK(hipEventRecord(stop, stream));
+            HIP_CHECK(hipEventSynchronize(stop));
+
+            float elapsed_mseconds;
+            HIP_CHECK(hipEventElapsedTime(&elapsed_mseconds, start, stop));
+            state.SetIterationTime(elapsed_mseconds / 1000);
+        }
+
+        // Destroy HIP events
+        HIP_CHECK(hipEventDestroy(start));
+        HIP_CHECK(hipEventDestroy(stop));
+
+        state.SetBytesProcessed(state.iterations() * batch_size * size
+                                * (sizeof(key_type) + sizeof(value_type)));
+        state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+        HIP_CHECK(hipFree(d_temporary_storage));
+        HIP_CHECK(hipFree(d_keys_input));
+        HIP_CHECK(hipFree(d_values_input));
+        HIP_CHECK(hipFree(d_unique_output));
+        HIP_CHECK(hipFree(d_aggregates_output));
+        HIP_CHECK(hipFree(d_unique_count_output));
+    }
+};
+
+#endif // ROCPRIM_BENCHMARK_DEVICE_HASH_TABLE_HPP_
@@ -291,8 +291,12 @@ void run_multi_even_benchmark(benchmark::State& state,
 }
 
 template<class T>
-void run_range_benchmark(
-    benchmark::State& state, size_t bytes, const managed_seed& seed, hipStream_t stream, size_t bins)
+void run_range_benchmark(benchmark::State&   state,
+                         size_t              bytes,
+                         const managed_seed& seed,
+                         hipStream_t         stream,
+                         size_t              bins,
+                         bool                irregular = false)
 {
     // Calculate the number of elements
     size_t size = bytes / sizeof(T);
@@ -301,15 +305,16 @@ void run_range_benchmark(
     using level_type =
         typename std::conditional_t<std::is_integral<T>::value && sizeof(T) < sizeof(int), int, T>;
 
-    // Generate data
-    const auto     random_range = limit_random_range<T>(0, bins);
+    // Irregular levels get wider towards the upper level, up to 2 * bins
+    const size_t   max_level    = irregular ? 2 * bins : bins;
+    const auto     random_range = limit_random_range<T>(0, max_level);
     std::vector<T> input
         = get_random_data<T>(size, random_range.first, random_range.second, seed.get_0());
 
     std::vector<level_type> levels(bins + 1);
     for(size_t i = 0; i < levels.size(); i++)
     {
-        levels[i] = static_cast<level_type>(i);
+        levels[i] = static_cast<level_type>(irregular ? i + i * i / bins : i);
     }
 
     T*            d_input;
@@ -618,6 +623,15 @@ void add_multi_even_benchmarks(std::vector<benchmark::internal::Benchmark*>& ben
     CREATE_RANGE_BENCHMARK(T, 10000)
 // clang-format on
 
+#define CREATE_IRREGULAR_RANGE_BENCHMARK(T, BINS)                                            \
+    benchmark::RegisterBenchmark(                                                              \
+        bench_naming::format_name("{lvl:device,algo:histogram_range,value_type:" #T            \
+                                  ",levels:irregular,bins:"                                    \
+                                  + std::to_string(BINS) + ",cfg:default_config}")             \
+            .c_str(),                                                                          \
+        [=](benchmark::State& state)                                                           \
+        { run_range_benchmark<T>(state, bytes, seed, stream, BINS, true); })
+
 void add_range_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
                           size_t                                        bytes,
                           const managed_seed&                           seed,
@@ -632,6 +646,11 @@ void add_range_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmar
         BENCHMARK_RANGE_TYPE(double),
         BENCHMARK_RANGE_TYPE(float),
         BENCHMARK_RANGE_TYPE(rocprim::half),
+        CREATE_IRREGULAR_RANGE_BENCHMARK(int, 1000),
+        CREATE_IRREGULAR_RANGE_BENCHMARK(int, 10000),
+        CREATE_IRREGULAR_RANGE_BENCHMARK(float, 1000),
+        CREATE_IRREGULAR_RANGE_BENCHMARK(float, 10000),
+        CREATE_IRREGULAR_RANGE_BENCHMARK(double, 10000),
     };
     benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
 }
@@ -685,6 +704,10 @@ int main(int argc, char* argv[])
                                      "human",
                                      "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.set_optional<std::string>("distribution",
+                                     "distribution",
+                                     "uniform",
+                                     get_distribution_message());
 #ifdef BENCHMARK_CONFIG_TUNING
     // optionally run an evenly split subset of benchmarks, when making multiple program invocations
     parser.set_optional<int>("parallel_instance",
@@ -705,6 +728,7 @@ int main(int argc, char* argv[])
     bench_naming::set_format(parser.get<std::string>("name_format"));
     const std::string  seed_type = parser.get<std::string>("seed");
     const managed_seed seed(seed_type);
+    bench_distribution::set(parser.get<std::string>("distribution"));
 
     // HIP
     hipStream_t stream = 0; // default
@@ -713,6 +737,7 @@ int main(int argc, char* argv[])
     add_common_benchmark_info();
     benchmark::AddCustomContext("bytes", std::to_string(bytes));
     benchmark::AddCustomContext("seed", seed_type);
+    benchmark::AddCustomContext("distribution", bench_distribution::get().name());
 
     // Add benchmarks
     std::vector<benchmark::internal::Benchmark*> benchmarks;
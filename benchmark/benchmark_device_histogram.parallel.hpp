@@ -53,6 +53,15 @@ std::vector<T> generate(size_t size, int entropy_reduction, int lower_level, int
     const size_t max_random_size = 1024 * 1024 + 4321;
 
     const unsigned int         seed = 123;
+    if(bench_distribution::get().type != bench_distribution::uniform)
+    {
+        // The selected distribution replaces the entropy reduction of the samples
+        return get_distributed_data<T>(size,
+                                       static_cast<T>(lower_level),
+                                       static_cast<T>(upper_level - 1),
+                                       seed,
+                                       max_random_size);
+    }
     engine_type                gen(seed);
     std::vector<T>             data(size);
     std::generate(data.begin(),
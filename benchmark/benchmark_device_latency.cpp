@@ -0,0 +1,364 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Latency of single calls of device algorithms for sizes from 1 to 1M items, where the time is
+// dominated by the launches of the kernels rather than by memory bandwidth. Every algorithm is
+// called directly and as a launch of a hipGraph, see run_latency_benchmark().
+
+#include "benchmark_utils.hpp"
+// CmdParser
+#include "cmdparser.hpp"
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/device/device_histogram.hpp>
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/device_select.hpp>
+#include <rocprim/device/device_transform.hpp>
+
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+
+// Input and output of an algorithm, allocated once so that the calls only launch the algorithm
+template<class Input, class Output>
+class latency_buffers
+{
+public:
+    latency_buffers(const size_t        size,
+                    const size_t        output_size,
+                    const Input         max,
+                    const managed_seed& seed)
+        : size_(size)
+    {
+        const std::vector<Input> input = get_random_data<Input>(size, Input(0), max, seed.get_0());
+        HIP_CHECK(hipMalloc(&d_input_, size * sizeof(Input)));
+        HIP_CHECK(hipMalloc(&d_output_, output_size * sizeof(Output)));
+        HIP_CHECK(hipMemcpy(d_input_, input.data(), size * sizeof(Input), hipMemcpyHostToDevice));
+    }
+
+    ~latency_buffers()
+    {
+        HIP_CHECK(hipFree(d_input_));
+        HIP_CHECK(hipFree(d_output_));
+    }
+
+    latency_buffers(const latency_buffers&)            = delete;
+    latency_buffers& operator=(const latency_buffers&) = delete;
+
+protected:
+    size_t  size_;
+    Input*  d_input_;
+    Output* d_output_;
+};
+
+struct reduce_latency : latency_buffers<int, int>
+{
+    static const char* name()
+    {
+        return "reduce";
+    }
+
+    reduce_latency(const size_t size, const managed_seed& seed)
+        : latency_buffers(size, 1, 100, seed)
+    {}
+
+    hipError_t operator()(void* storage, size_t& bytes, const hipStream_t stream) const
+    {
+        return rocprim::reduce(storage,
+                               bytes,
+                               d_input_,
+                               d_output_,
+                               0,
+                               size_,
+                               rocprim::plus<int>(),
+                               stream);
+    }
+};
+
+struct exclusive_scan_latency : latency_buffers<int, int>
+{
+    static const char* name()
+    {
+        return "exclusive_scan";
+    }
+
+    exclusive_scan_latency(const size_t size, const managed_seed& seed)
+        : latency_buffers(size, size, 100, seed)
+    {}
+
+    hipError_t operator()(void* storage, size_t& bytes, const hipStream_t stream) const
+    {
+        return rocprim::exclusive_scan(storage,
+                                       bytes,
+                                       d_input_,
+                                       d_output_,
+                                       0,
+                                       size_,
+                                       rocprim::plus<int>(),
+                                       stream);
+    }
+};
+
+struct radix_sort_keys_latency : latency_buffers<unsigned int, unsigned int>
+{
+    static const char* name()
+    {
+        return "radix_sort_keys";
+    }
+
+    radix_sort_keys_latency(const size_t size, const managed_seed& seed)
+        : latency_buffers(size, size, generate_limits<unsigned int>::max(), seed)
+    {}
+
+    hipError_t operator()(void* storage, size_t& bytes, const hipStream_t stream) const
+    {
+        return rocprim::radix_sort_keys(storage,
+                                        bytes,
+                                        d_input_,
+                                        d_output_,
+                                        size_,
+                                        0,
+                                        sizeof(unsigned int) * 8,
+                                        stream);
+    }
+};
+
+struct histogram_even_latency : latency_buffers<unsigned int, unsigned int>
+{
+    static constexpr unsigned int bins = 256;
+
+    static const char* name()
+    {
+        return "histogram_even";
+    }
+
+    histogram_even_latency(const size_t size, const managed_seed& seed)
+        : latency_buffers(size, bins, bins - 1, seed)
+    {}
+
+    hipError_t operator()(void* storage, size_t& bytes, const hipStream_t stream) const
+    {
+        return rocprim::histogram_even(storage,
+                                       bytes,
+                                       d_input_,
+                                       static_cast<unsigned int>(size_),
+                                       d_output_,
+                                       bins + 1,
+                                       0u,
+                                       bins,
+                                       stream);
+    }
+};
+
+struct less_than_50
+{
+    ROCPRIM_HOST_DEVICE
+    bool operator()(const int value) const
+    {
+        return value < 50;
+    }
+};
+
+struct select_latency : latency_buffers<int, int>
+{
+    static const char* name()
+    {
+        return "select";
+    }
+
+    select_latency(const size_t size, const managed_seed& seed)
+        : latency_buffers(size, size, 100, seed)
+    {
+        HIP_CHECK(hipMalloc(&d_selected_count_, sizeof(*d_selected_count_)));
+    }
+
+    ~select_latency()
+    {
+        HIP_CHECK(hipFree(d_selected_count_));
+    }
+
+    hipError_t operator()(void* storage, size_t& bytes, const hipStream_t stream) const
+    {
+        return rocprim::select(storage,
+                               bytes,
+                               d_input_,
+                               d_output_,
+                               d_selected_count_,
+                               size_,
+                               less_than_50(),
+                               stream);
+    }
+
+private:
+    unsigned int* d_selected_count_;
+};
+
+struct plus_one
+{
+    ROCPRIM_HOST_DEVICE
+    int operator()(const int value) const
+    {
+        return value + 1;
+    }
+};
+
+struct transform_latency : latency_buffers<int, int>
+{
+    static const char* name()
+    {
+        return "transform";
+    }
+
+    transform_latency(const size_t size, const managed_seed& seed)
+        : latency_buffers(size, size, 100, seed)
+    {}
+
+    hipError_t operator()(void* /*storage*/, size_t& bytes, const hipStream_t stream) const
+    {
+        // transform needs no temporary storage
+        bytes = 0;
+        return rocprim::transform(d_input_, d_output_, size_, plus_one(), stream);
+    }
+};
+
+template<class Algorithm, bool UseGraph>
+struct device_latency_benchmark : public config_autotune_interface
+{
+    size_t size;
+
+    explicit device_latency_benchmark(const size_t size) : size(size) {}
+
+    std::string name() const override
+    {
+        return bench_naming::format_name("{lvl:device,algo:latency,subalgo:"
+                                         + std::string(Algorithm::name())
+                                         + ",size:" + std::to_string(size) + ",graph:"
+                                         + (UseGraph ? "true" : "false") + ",cfg:default_config}");
+    }
+
+    void run(benchmark::State& state,
+             size_t /*bytes*/,
+             const managed_seed& seed,
+             hipStream_t         stream) const override
+    {
+        const Algorithm algorithm(size, seed);
+
+        size_t temporary_storage_bytes = 0;
+        HIP_CHECK(algorithm(nullptr, temporary_storage_bytes, stream));
+        void* d_temporary_storage;
+        HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+        run_latency_benchmark(
+            state,
+            [&](const hipStream_t call_stream)
+            {
+                size_t bytes = temporary_storage_bytes;
+                HIP_CHECK(algorithm(d_temporary_storage, bytes, call_stream));
+            },
+            UseGraph);
+
+        HIP_CHECK(hipFree(d_temporary_storage));
+    }
+};
+
+} // namespace
+
+#define CREATE_BENCHMARK(ALGORITHM, USE_GRAPH)                                 \
+    {                                                                          \
+        const device_latency_benchmark<ALGORITHM, USE_GRAPH> instance(size);   \
+        REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance);         \
+    }
+
+#define CREATE_BENCHMARKS(ALGORITHM)        \
+    CREATE_BENCHMARK(ALGORITHM, false)      \
+    CREATE_BENCHMARK(ALGORITHM, true)
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.set_optional<std::string>("name_format",
+                                     "name_format",
+                                     "human",
+                                     "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const int trials = parser.get<int>("trials");
+    bench_naming::set_format(parser.get<std::string>("name_format"));
+    const std::string  seed_type = parser.get<std::string>("seed");
+    const managed_seed seed(seed_type);
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmarks, the sizes are in items
+    const size_t                                 bytes = 0;
+    std::vector<benchmark::internal::Benchmark*> benchmarks{};
+    for(const size_t size : get_latency_sizes())
+    {
+        CREATE_BENCHMARKS(reduce_latency)
+        CREATE_BENCHMARKS(exclusive_scan_latency)
+        CREATE_BENCHMARKS(radix_sort_keys_latency)
+        CREATE_BENCHMARKS(histogram_even_latency)
+        CREATE_BENCHMARKS(select_latency)
+        CREATE_BENCHMARKS(transform_latency)
+    }
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMicrosecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
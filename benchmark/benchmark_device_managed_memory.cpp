@@ -0,0 +1,281 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Runs rocprim::radix_sort_keys and rocprim::inclusive_scan on inputs in device memory and in
+// managed memory. Before every iteration the host rewrites the managed input, which moves its
+// pages back to the host, like a pipeline that produces the input on the host. The managed
+// memory is used either as it is, so the kernels fault its pages in, or after
+// rocprim::advise_managed_memory, whose time is included in the measurement.
+
+#include "benchmark_utils.hpp"
+// CmdParser
+#include "cmdparser.hpp"
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/managed_memory.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+#ifndef DEFAULT_BYTES
+const size_t DEFAULT_BYTES = 1024 * 1024 * 128 * 4;
+#endif
+
+namespace
+{
+
+enum class memory_kind
+{
+    device,
+    managed,
+    managed_advised
+};
+
+inline const char* memory_kind_name(const memory_kind kind)
+{
+    switch(kind)
+    {
+        case memory_kind::device: return "device";
+        case memory_kind::managed: return "managed";
+        case memory_kind::managed_advised: return "managed_advised";
+    }
+    return "unknown";
+}
+
+template<class T>
+T* allocate(const size_t size, const memory_kind kind)
+{
+    T* ptr;
+    if(kind == memory_kind::device)
+    {
+        HIP_CHECK(hipMalloc(&ptr, size * sizeof(T)));
+    }
+    else
+    {
+        HIP_CHECK(hipMallocManaged(&ptr, size * sizeof(T)));
+    }
+    return ptr;
+}
+
+template<class T, bool Sort, memory_kind Kind>
+struct device_managed_memory_benchmark : public config_autotune_interface
+{
+    std::string name() const override
+    {
+        return bench_naming::format_name(
+            "{lvl:device,algo:managed_memory,subalgo:" + std::string(Sort ? "radix_sort" : "scan")
+            + ",value_type:" + std::string(Traits<T>::name()) + ",memory:"
+            + memory_kind_name(Kind) + ",cfg:default_config}");
+    }
+
+    static hipError_t run_algorithm(void*       temporary_storage,
+                                    size_t&     storage_size,
+                                    T*          input,
+                                    T*          output,
+                                    size_t      size,
+                                    hipStream_t stream)
+    {
+        if(Sort)
+        {
+            return rocprim::radix_sort_keys(temporary_storage,
+                                            storage_size,
+                                            input,
+                                            output,
+                                            size,
+                                            0,
+                                            8 * sizeof(T),
+                                            stream);
+        }
+        return rocprim::inclusive_scan(temporary_storage,
+                                       storage_size,
+                                       input,
+                                       output,
+                                       size,
+                                       rocprim::plus<T>(),
+                                       stream);
+    }
+
+    void run(benchmark::State&   state,
+             size_t              bytes,
+             const managed_seed& seed,
+             hipStream_t         stream) const override
+    {
+        const size_t         size  = bytes / sizeof(T);
+        const std::vector<T> input = get_random_data<T>(size,
+                                                        generate_limits<T>::min(),
+                                                        generate_limits<T>::max(),
+                                                        seed.get_0());
+
+        T* d_input  = allocate<T>(size, Kind);
+        T* d_output = allocate<T>(size, Kind);
+        HIP_CHECK(
+            hipMemcpy(d_input, input.data(), size * sizeof(*d_input), hipMemcpyHostToDevice));
+
+        size_t storage_size = 0;
+        HIP_CHECK(run_algorithm(nullptr, storage_size, d_input, d_output, size, stream));
+        char* d_temporary_storage = allocate<char>(storage_size, Kind);
+
+        const rocprim::managed_memory_range ranges[]
+            = {rocprim::make_managed_read_range(d_input, size),
+               rocprim::make_managed_read_write_range(d_output, size),
+               rocprim::make_managed_read_write_range(d_temporary_storage, storage_size)};
+
+        const auto run_once = [&]
+        {
+            if(Kind == memory_kind::managed_advised)
+            {
+                HIP_CHECK(rocprim::invoke_with_managed_memory_advice(
+                    ranges,
+                    3,
+                    stream,
+                    [&]
+                    {
+                        return run_algorithm(d_temporary_storage,
+                                             storage_size,
+                                             d_input,
+                                             d_output,
+                                             size,
+                                             stream);
+                    }));
+            }
+            else
+            {
+                HIP_CHECK(run_algorithm(d_temporary_storage,
+                                        storage_size,
+                                        d_input,
+                                        d_output,
+                                        size,
+                                        stream));
+            }
+        };
+
+        // Warm-up
+        for(unsigned int i = 0; i < 5; ++i)
+        {
+            run_once();
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        for(auto _ : state)
+        {
+            if(Kind != memory_kind::device)
+            {
+                // The host produces the next input in the managed buffer
+                std::copy(input.begin(), input.end(), d_input);
+            }
+
+            const auto start = std::chrono::high_resolution_clock::now();
+            run_once();
+            HIP_CHECK(hipStreamSynchronize(stream));
+            const auto end = std::chrono::high_resolution_clock::now();
+            state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+        }
+
+        state.SetBytesProcessed(state.iterations() * size * sizeof(T));
+        state.SetItemsProcessed(state.iterations() * size);
+
+        HIP_CHECK(hipFree(d_temporary_storage));
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+    }
+};
+
+} // namespace
+
+#define CREATE_BENCHMARK(T, SORT, KIND)                                     \
+    {                                                                       \
+        const device_managed_memory_benchmark<T, SORT, KIND> instance;      \
+        REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance);      \
+    }
+
+#define CREATE_BENCHMARKS(T, SORT)                                \
+    CREATE_BENCHMARK(T, SORT, memory_kind::device)                \
+    CREATE_BENCHMARK(T, SORT, memory_kind::managed)               \
+    CREATE_BENCHMARK(T, SORT, memory_kind::managed_advised)
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_BYTES, "number of bytes");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.set_optional<std::string>("name_format",
+                                     "name_format",
+                                     "human",
+                                     "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t bytes  = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+    bench_naming::set_format(parser.get<std::string>("name_format"));
+    const std::string  seed_type = parser.get<std::string>("seed");
+    const managed_seed seed(seed_type);
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("bytes", std::to_string(bytes));
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks{};
+    CREATE_BENCHMARKS(unsigned int, true)
+    CREATE_BENCHMARKS(unsigned long long, true)
+    CREATE_BENCHMARKS(int, false)
+    CREATE_BENCHMARKS(double, false)
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
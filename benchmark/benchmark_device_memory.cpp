@@ -402,6 +402,7 @@ void run_benchmark(benchmark::State&   state,
 
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    set_memory_traffic(state, 2.0 * state.iterations() * batch_size * size * sizeof(T));
 
     HIP_CHECK(hipFree(d_input));
     HIP_CHECK(hipFree(d_output));
@@ -459,6 +460,7 @@ void run_benchmark_memcpy(benchmark::State& state,
 
     state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
     state.SetItemsProcessed(state.iterations() * batch_size * size);
+    set_memory_traffic(state, 2.0 * state.iterations() * batch_size * size * sizeof(T));
 
     HIP_CHECK(hipFree(d_input));
     HIP_CHECK(hipFree(d_output));
@@ -55,6 +55,10 @@ int main(int argc, char *argv[])
                                      "human",
                                      "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.set_optional<std::string>("distribution",
+                                     "distribution",
+                                     "uniform",
+                                     get_distribution_message());
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -64,6 +68,7 @@ int main(int argc, char *argv[])
     bench_naming::set_format(parser.get<std::string>("name_format"));
     const std::string  seed_type = parser.get<std::string>("seed");
     const managed_seed seed(seed_type);
+    bench_distribution::set(parser.get<std::string>("distribution"));
 
     // HIP
     hipStream_t stream = 0; // default
@@ -72,6 +77,7 @@ int main(int argc, char *argv[])
     add_common_benchmark_info();
     benchmark::AddCustomContext("bytes", std::to_string(bytes));
     benchmark::AddCustomContext("seed", seed_type);
+    benchmark::AddCustomContext("distribution", bench_distribution::get().name());
 
     // Add benchmarks
     std::vector<benchmark::internal::Benchmark*> benchmarks = {};
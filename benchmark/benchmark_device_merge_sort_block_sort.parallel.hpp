@@ -100,10 +100,10 @@ struct device_merge_sort_block_sort_benchmark : public config_autotune_interface
         size_t size = bytes / sizeof(key_type);
         // Generate data
         std::vector<key_type> keys_input
-            = get_random_data<key_type>(size,
-                                        generate_limits<key_type>::min(),
-                                        generate_limits<key_type>::max(),
-                                        seed.get_0());
+            = get_distributed_data<key_type>(size,
+                                             generate_limits<key_type>::min(),
+                                             generate_limits<key_type>::max(),
+                                             seed.get_0());
 
         key_type* d_keys_input;
         key_type* d_keys_output;
@@ -190,10 +190,10 @@ struct device_merge_sort_block_sort_benchmark : public config_autotune_interface
         size_t size = bytes / sizeof(key_type);
         // Generate data
         std::vector<key_type> keys_input
-            = get_random_data<key_type>(size,
-                                        generate_limits<key_type>::min(),
-                                        generate_limits<key_type>::max(),
-                                        seed.get_0());
+            = get_distributed_data<key_type>(size,
+                                             generate_limits<key_type>::min(),
+                                             generate_limits<key_type>::max(),
+                                             seed.get_0());
 
         std::vector<value_type> values_input(size);
         std::iota(values_input.begin(), values_input.end(), 0);
@@ -78,10 +78,10 @@ struct device_partial_sort_benchmark : public config_autotune_interface
 
         // Generate data
         std::vector<key_type> keys_input
-            = get_random_data<key_type>(size,
-                                        generate_limits<key_type>::min(),
-                                        generate_limits<key_type>::max(),
-                                        seed.get_0());
+            = get_distributed_data<key_type>(size,
+                                             generate_limits<key_type>::min(),
+                                             generate_limits<key_type>::max(),
+                                             seed.get_0());
 
         key_type* d_keys_input;
         key_type* d_keys_new_data;
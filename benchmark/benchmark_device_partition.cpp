@@ -119,6 +119,10 @@ int main(int argc, char* argv[])
                                      "human",
                                      "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.set_optional<std::string>("distribution",
+                                     "distribution",
+                                     "uniform",
+                                     get_distribution_message());
 #ifdef BENCHMARK_CONFIG_TUNING
     // optionally run an evenly split subset of benchmarks, when making multiple program invocations
     parser.set_optional<int>("parallel_instance",
@@ -139,6 +143,7 @@ int main(int argc, char* argv[])
     bench_naming::set_format(parser.get<std::string>("name_format"));
     const std::string  seed_type = parser.get<std::string>("seed");
     const managed_seed seed(seed_type);
+    bench_distribution::set(parser.get<std::string>("distribution"));
 
     // HIP
     hipStream_t stream = 0; // default
@@ -147,6 +152,7 @@ int main(int argc, char* argv[])
     add_common_benchmark_info();
     benchmark::AddCustomContext("bytes", std::to_string(bytes));
     benchmark::AddCustomContext("seed", seed_type);
+    benchmark::AddCustomContext("distribution", bench_distribution::get().name());
 
     // Add benchmarks
     std::vector<benchmark::internal::Benchmark*> benchmarks = {};
@@ -138,10 +138,11 @@ struct device_partition_flag_benchmark : public config_autotune_interface
         // Calculate the number of elements 
         size_t size = bytes / sizeof(DataType);
 
-        std::vector<DataType> input = get_random_data<DataType>(size,
-                                                                generate_limits<DataType>::min(),
-                                                                generate_limits<DataType>::max(),
-                                                                seed.get_0());
+        std::vector<DataType> input
+            = get_distributed_data<DataType>(size,
+                                             generate_limits<DataType>::min(),
+                                             generate_limits<DataType>::max(),
+                                             seed.get_0());
 
         std::vector<FlagType> flags_0;
         std::vector<FlagType> flags_1;
@@ -285,10 +286,11 @@ struct device_partition_predicate_benchmark : public config_autotune_interface
         size_t size = bytes / sizeof(DataType);
 
         // all data types can represent [0, 127], -1 so a predicate can select all
-        std::vector<DataType> input = get_random_data<DataType>(size,
-                                                                static_cast<DataType>(0),
-                                                                static_cast<DataType>(126),
-                                                                seed.get_0());
+        std::vector<DataType> input
+            = get_distributed_data<DataType>(size,
+                                             static_cast<DataType>(0),
+                                             static_cast<DataType>(126),
+                                             seed.get_0());
 
         DataType* d_input{};
         HIP_CHECK(hipMalloc(&d_input, size * sizeof(*d_input)));
@@ -399,10 +401,11 @@ struct device_partition_two_way_flag_benchmark : public config_autotune_interfac
         // Calculate the number of elements 
         size_t size = bytes / sizeof(DataType);
         
-        std::vector<DataType> input = get_random_data<DataType>(size,
-                                                                generate_limits<DataType>::min(),
-                                                                generate_limits<DataType>::max(),
-                                                                seed.get_0());
+        std::vector<DataType> input
+            = get_distributed_data<DataType>(size,
+                                             generate_limits<DataType>::min(),
+                                             generate_limits<DataType>::max(),
+                                             seed.get_0());
 
         std::vector<FlagType> flags_0;
         std::vector<FlagType> flags_1;
@@ -551,10 +554,11 @@ struct device_partition_two_way_predicate_benchmark : public config_autotune_int
         size_t size = bytes / sizeof(DataType);
 
         // all data types can represent [0, 127], -1 so a predicate can select all
-        std::vector<DataType> input = get_random_data<DataType>(size,
-                                                                static_cast<DataType>(0),
-                                                                static_cast<DataType>(126),
-                                                                seed.get_0());
+        std::vector<DataType> input
+            = get_distributed_data<DataType>(size,
+                                             static_cast<DataType>(0),
+                                             static_cast<DataType>(126),
+                                             seed.get_0());
 
         DataType* d_input;
         HIP_CHECK(hipMalloc(&d_input, size * sizeof(*d_input)));
@@ -668,10 +672,11 @@ struct device_partition_three_way_benchmark : public config_autotune_interface
         size_t size = bytes / sizeof(DataType);
 
         // all data types can represent [0, 127], -1 so a predicate can select all
-        std::vector<DataType> input = get_random_data<DataType>(size,
-                                                                static_cast<DataType>(0),
-                                                                static_cast<DataType>(126),
-                                                                seed.get_0());
+        std::vector<DataType> input
+            = get_distributed_data<DataType>(size,
+                                             static_cast<DataType>(0),
+                                             static_cast<DataType>(126),
+                                             seed.get_0());
 
         DataType* d_input{};
         HIP_CHECK(hipMalloc(&d_input, size * sizeof(*d_input)));
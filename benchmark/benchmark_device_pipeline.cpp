@@ -0,0 +1,623 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Runs composed pipelines of device algorithms end to end, as an application would, instead of
+// one algorithm at a time:
+//  - filter_sort_aggregate: select -> radix_sort_pairs -> reduce_by_key -> exclusive_scan,
+//  - histogram_scatter: histogram_even -> exclusive_scan -> scatter of the items to their bins.
+// The number of selected items and of unique keys is copied to the host between the stages that
+// need it. Each pipeline is timed on the host in four modes:
+//  - preallocated: the stages share temporary storage allocated once,
+//  - allocating: every stage sizes and allocates its temporary storage when it runs,
+//  - cold_l2: like preallocated, but the L2 cache is flushed before every run,
+//  - graph: the stages are captured in a hipGraph once, with the counts of a previous run, and
+//    the graph is launched.
+
+#include "benchmark_utils.hpp"
+// CmdParser
+#include "cmdparser.hpp"
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/device/device_histogram.hpp>
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce_by_key.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/device_select.hpp>
+#include <rocprim/iterator/zip_iterator.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+#ifndef DEFAULT_BYTES
+const size_t DEFAULT_BYTES = 1024 * 1024 * 32 * 4;
+#endif
+
+namespace
+{
+
+enum class pipeline_mode
+{
+    preallocated,
+    allocating,
+    cold_l2,
+    graph
+};
+
+inline const char* pipeline_mode_name(const pipeline_mode mode)
+{
+    switch(mode)
+    {
+        case pipeline_mode::preallocated: return "preallocated";
+        case pipeline_mode::allocating: return "allocating";
+        case pipeline_mode::cold_l2: return "cold_l2";
+        case pipeline_mode::graph: return "graph";
+    }
+    return "";
+}
+
+// Runs the stages of a pipeline. A stage is called with the temporary storage and its size, like
+// the device algorithms. The runner sizes the temporary storage that all stages share, runs them
+// on it, or sizes and allocates the temporary storage of each stage when it runs.
+class stage_runner
+{
+public:
+    enum class mode
+    {
+        size,
+        shared,
+        allocate
+    };
+
+    mode   current                 = mode::size;
+    void*  temporary_storage       = nullptr;
+    size_t temporary_storage_bytes = 0;
+
+    bool sizing() const
+    {
+        return current == mode::size;
+    }
+
+    template<class Stage>
+    void operator()(Stage stage)
+    {
+        size_t bytes = 0;
+        switch(current)
+        {
+            case mode::size:
+                HIP_CHECK(stage(nullptr, bytes));
+                temporary_storage_bytes = std::max(temporary_storage_bytes, bytes);
+                break;
+            case mode::shared:
+                bytes = temporary_storage_bytes;
+                HIP_CHECK(stage(temporary_storage, bytes));
+                break;
+            case mode::allocate:
+            {
+                void* storage;
+                HIP_CHECK(stage(nullptr, bytes));
+                HIP_CHECK(hipMalloc(&storage, bytes));
+                HIP_CHECK(stage(storage, bytes));
+                HIP_CHECK(hipFree(storage));
+                break;
+            }
+        }
+    }
+};
+
+// Device-side counts of a pipeline that the host needs to launch the following stages. When the
+// stages are sized the counts are not known, and their upper bound is used instead. When a graph
+// is captured, the counts of the previous run are used.
+class pipeline_counts
+{
+public:
+    explicit pipeline_counts(const size_t count)
+    {
+        HIP_CHECK(hipMalloc(&d_counts_, count * sizeof(*d_counts_)));
+        HIP_CHECK(hipHostMalloc(&h_counts_, count * sizeof(*h_counts_)));
+    }
+
+    ~pipeline_counts()
+    {
+        HIP_CHECK(hipFree(d_counts_));
+        HIP_CHECK(hipHostFree(h_counts_));
+    }
+
+    pipeline_counts(const pipeline_counts&)            = delete;
+    pipeline_counts& operator=(const pipeline_counts&) = delete;
+
+    unsigned int* device(const size_t index) const
+    {
+        return d_counts_ + index;
+    }
+
+    size_t read(const size_t        index,
+                const size_t        upper_bound,
+                const stage_runner& run,
+                const bool          read_counts,
+                const hipStream_t   stream)
+    {
+        if(run.sizing())
+        {
+            return upper_bound;
+        }
+        if(read_counts)
+        {
+            HIP_CHECK(hipMemcpyAsync(h_counts_ + index,
+                                     d_counts_ + index,
+                                     sizeof(*h_counts_),
+                                     hipMemcpyDeviceToHost,
+                                     stream));
+            HIP_CHECK(hipStreamSynchronize(stream));
+        }
+        return h_counts_[index];
+    }
+
+private:
+    unsigned int* d_counts_;
+    unsigned int* h_counts_;
+};
+
+template<class Key>
+struct select_below
+{
+    Key limit;
+
+    template<class Item>
+    ROCPRIM_HOST_DEVICE
+    bool operator()(const Item& item) const
+    {
+        return rocprim::get<0>(item) < limit;
+    }
+};
+
+// select -> radix_sort_pairs -> reduce_by_key -> exclusive_scan: keeps the items whose key is in
+// the lower half of the key range, sums the values of each key and computes the offsets of the
+// sums.
+class filter_sort_aggregate_pipeline
+{
+public:
+    using key_type   = unsigned int;
+    using value_type = float;
+
+    static const char* name()
+    {
+        return "filter_sort_aggregate";
+    }
+
+    static size_t item_bytes()
+    {
+        return sizeof(key_type) + sizeof(value_type);
+    }
+
+    filter_sort_aggregate_pipeline(const size_t size, const managed_seed& seed)
+        : size_(size), key_range_(std::max<size_t>(size / 16, 1)), counts_(2)
+    {
+        const std::vector<key_type> keys
+            = get_random_data<key_type>(size, 0, key_range_ - 1, seed.get_0());
+        const std::vector<value_type> values
+            = get_random_data<value_type>(size, 0.0f, 1.0f, seed.get_1());
+
+        for(key_type** buffer : {&d_keys_, &d_selected_keys_, &d_sorted_keys_, &d_unique_})
+        {
+            HIP_CHECK(hipMalloc(buffer, size * sizeof(key_type)));
+        }
+        for(value_type** buffer :
+            {&d_values_, &d_selected_values_, &d_sorted_values_, &d_aggregates_, &d_offsets_})
+        {
+            HIP_CHECK(hipMalloc(buffer, size * sizeof(value_type)));
+        }
+        HIP_CHECK(hipMemcpy(d_keys_, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+        HIP_CHECK(
+            hipMemcpy(d_values_, values.data(), size * sizeof(value_type), hipMemcpyHostToDevice));
+    }
+
+    ~filter_sort_aggregate_pipeline()
+    {
+        for(key_type* buffer : {d_keys_, d_selected_keys_, d_sorted_keys_, d_unique_})
+        {
+            HIP_CHECK(hipFree(buffer));
+        }
+        for(value_type* buffer :
+            {d_values_, d_selected_values_, d_sorted_values_, d_aggregates_, d_offsets_})
+        {
+            HIP_CHECK(hipFree(buffer));
+        }
+    }
+
+    void enqueue(stage_runner& run, const bool read_counts, const hipStream_t stream)
+    {
+        const select_below<key_type> predicate{static_cast<key_type>(key_range_ / 2)};
+        run(
+            [&](void* storage, size_t& bytes)
+            {
+                return rocprim::select(
+                    storage,
+                    bytes,
+                    rocprim::make_zip_iterator(rocprim::make_tuple(d_keys_, d_values_)),
+                    rocprim::make_zip_iterator(
+                        rocprim::make_tuple(d_selected_keys_, d_selected_values_)),
+                    counts_.device(0),
+                    size_,
+                    predicate,
+                    stream);
+            });
+        const size_t selected = counts_.read(0, size_, run, read_counts, stream);
+
+        run(
+            [&](void* storage, size_t& bytes)
+            {
+                return rocprim::radix_sort_pairs(storage,
+                                                 bytes,
+                                                 d_selected_keys_,
+                                                 d_sorted_keys_,
+                                                 d_selected_values_,
+                                                 d_sorted_values_,
+                                                 selected,
+                                                 0,
+                                                 sizeof(key_type) * 8,
+                                                 stream);
+            });
+
+        run(
+            [&](void* storage, size_t& bytes)
+            {
+                return rocprim::reduce_by_key(storage,
+                                              bytes,
+                                              d_sorted_keys_,
+                                              d_sorted_values_,
+                                              selected,
+                                              d_unique_,
+                                              d_aggregates_,
+                                              counts_.device(1),
+                                              rocprim::plus<value_type>(),
+                                              rocprim::equal_to<key_type>(),
+                                              stream);
+            });
+        const size_t unique = counts_.read(1, selected, run, read_counts, stream);
+
+        run(
+            [&](void* storage, size_t& bytes)
+            {
+                return rocprim::exclusive_scan(storage,
+                                               bytes,
+                                               d_aggregates_,
+                                               d_offsets_,
+                                               value_type(0),
+                                               unique,
+                                               rocprim::plus<value_type>(),
+                                               stream);
+            });
+    }
+
+private:
+    size_t          size_;
+    size_t          key_range_;
+    pipeline_counts counts_;
+    key_type*       d_keys_;
+    key_type*       d_selected_keys_;
+    key_type*       d_sorted_keys_;
+    key_type*       d_unique_;
+    value_type*     d_values_;
+    value_type*     d_selected_values_;
+    value_type*     d_sorted_values_;
+    value_type*     d_aggregates_;
+    value_type*     d_offsets_;
+};
+
+template<class Key, class Value>
+__global__ __launch_bounds__(256) void scatter_to_bins_kernel(const Key*    keys,
+                                                              const Value*  values,
+                                                              const size_t  size,
+                                                              unsigned int* bin_cursors,
+                                                              Key*          keys_output,
+                                                              Value*        values_output)
+{
+    const size_t i = blockIdx.x * static_cast<size_t>(blockDim.x) + threadIdx.x;
+    if(i < size)
+    {
+        const unsigned int position = atomicAdd(&bin_cursors[keys[i]], 1u);
+        keys_output[position]       = keys[i];
+        values_output[position]     = values[i];
+    }
+}
+
+// histogram_even -> exclusive_scan -> scatter: counts the items of each bin, computes the offsets
+// of the bins and moves the items to their bins, in the order the atomics give them.
+class histogram_scatter_pipeline
+{
+public:
+    using key_type   = unsigned int;
+    using value_type = float;
+
+    static constexpr unsigned int bins = 1024;
+
+    static const char* name()
+    {
+        return "histogram_scatter";
+    }
+
+    static size_t item_bytes()
+    {
+        return sizeof(key_type) + sizeof(value_type);
+    }
+
+    histogram_scatter_pipeline(const size_t size, const managed_seed& seed) : size_(size)
+    {
+        const std::vector<key_type> keys
+            = get_random_data<key_type>(size, 0, bins - 1, seed.get_0());
+        const std::vector<value_type> values
+            = get_random_data<value_type>(size, 0.0f, 1.0f, seed.get_1());
+
+        HIP_CHECK(hipMalloc(&d_keys_, size * sizeof(key_type)));
+        HIP_CHECK(hipMalloc(&d_keys_output_, size * sizeof(key_type)));
+        HIP_CHECK(hipMalloc(&d_values_, size * sizeof(value_type)));
+        HIP_CHECK(hipMalloc(&d_values_output_, size * sizeof(value_type)));
+        HIP_CHECK(hipMalloc(&d_histogram_, bins * sizeof(unsigned int)));
+        HIP_CHECK(hipMalloc(&d_bin_cursors_, bins * sizeof(unsigned int)));
+        HIP_CHECK(hipMemcpy(d_keys_, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+        HIP_CHECK(
+            hipMemcpy(d_values_, values.data(), size * sizeof(value_type), hipMemcpyHostToDevice));
+    }
+
+    ~histogram_scatter_pipeline()
+    {
+        HIP_CHECK(hipFree(d_keys_));
+        HIP_CHECK(hipFree(d_keys_output_));
+        HIP_CHECK(hipFree(d_values_));
+        HIP_CHECK(hipFree(d_values_output_));
+        HIP_CHECK(hipFree(d_histogram_));
+        HIP_CHECK(hipFree(d_bin_cursors_));
+    }
+
+    void enqueue(stage_runner& run, const bool /*read_counts*/, const hipStream_t stream)
+    {
+        run(
+            [&](void* storage, size_t& bytes)
+            {
+                return rocprim::histogram_even(storage,
+                                               bytes,
+                                               d_keys_,
+                                               static_cast<unsigned int>(size_),
+                                               d_histogram_,
+                                               bins + 1,
+                                               0u,
+                                               bins,
+                                               stream);
+            });
+
+        run(
+            [&](void* storage, size_t& bytes)
+            {
+                return rocprim::exclusive_scan(storage,
+                                               bytes,
+                                               d_histogram_,
+                                               d_bin_cursors_,
+                                               0u,
+                                               bins,
+                                               rocprim::plus<unsigned int>(),
+                                               stream);
+            });
+
+        if(!run.sizing())
+        {
+            const auto grid_size
+                = static_cast<unsigned int>(rocprim::detail::ceiling_div(size_, 256));
+            scatter_to_bins_kernel<<<grid_size, 256, 0, stream>>>(d_keys_,
+                                                                  d_values_,
+                                                                  size_,
+                                                                  d_bin_cursors_,
+                                                                  d_keys_output_,
+                                                                  d_values_output_);
+            HIP_CHECK(hipGetLastError());
+        }
+    }
+
+private:
+    size_t        size_;
+    key_type*     d_keys_;
+    key_type*     d_keys_output_;
+    value_type*   d_values_;
+    value_type*   d_values_output_;
+    unsigned int* d_histogram_;
+    unsigned int* d_bin_cursors_;
+};
+
+template<class Pipeline, pipeline_mode Mode>
+struct device_pipeline_benchmark : public config_autotune_interface
+{
+    std::string name() const override
+    {
+        return bench_naming::format_name("{lvl:device,algo:pipeline,subalgo:"
+                                         + std::string(Pipeline::name())
+                                         + ",mode:" + pipeline_mode_name(Mode)
+                                         + ",cfg:default_config}");
+    }
+
+    static constexpr unsigned int warmup_size = 5;
+
+    void run(benchmark::State&   state,
+             size_t              bytes,
+             const managed_seed& seed,
+             hipStream_t /*stream*/) const override
+    {
+        const size_t size = bytes / Pipeline::item_bytes();
+
+        // Default stream does not support hipGraph stream capture, so create one
+        hipStream_t stream;
+        HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+        Pipeline     pipeline(size, seed);
+        stage_runner run;
+        pipeline.enqueue(run, true, stream);
+        if(Mode == pipeline_mode::allocating)
+        {
+            run.current = stage_runner::mode::allocate;
+        }
+        else
+        {
+            HIP_CHECK(hipMalloc(&run.temporary_storage, run.temporary_storage_bytes));
+            run.current = stage_runner::mode::shared;
+        }
+
+        // Warm-up, which also reads the counts that the graph is captured with
+        for(unsigned int i = 0; i < warmup_size; ++i)
+        {
+            pipeline.enqueue(run, true, stream);
+        }
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        hipGraph_t     graph          = nullptr;
+        hipGraphExec_t graph_instance = nullptr;
+        if(Mode == pipeline_mode::graph)
+        {
+            HIP_CHECK(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+            pipeline.enqueue(run, false, stream);
+            HIP_CHECK(hipStreamEndCapture(stream, &graph));
+            HIP_CHECK(hipGraphInstantiate(&graph_instance, graph, nullptr, nullptr, 0));
+        }
+
+        // Writing a buffer of twice the size of the L2 cache evicts the data of the previous run
+        void*  d_flush     = nullptr;
+        size_t flush_bytes = 0;
+        if(Mode == pipeline_mode::cold_l2)
+        {
+            int             device_id;
+            hipDeviceProp_t props;
+            HIP_CHECK(hipGetDevice(&device_id));
+            HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+            flush_bytes = 2 * static_cast<size_t>(props.l2CacheSize);
+            HIP_CHECK(hipMalloc(&d_flush, flush_bytes));
+        }
+
+        for(auto _ : state)
+        {
+            if(Mode == pipeline_mode::cold_l2)
+            {
+                HIP_CHECK(hipMemsetAsync(d_flush, state.iterations() & 0xFF, flush_bytes, stream));
+                HIP_CHECK(hipStreamSynchronize(stream));
+            }
+
+            const auto start = std::chrono::high_resolution_clock::now();
+            if(Mode == pipeline_mode::graph)
+            {
+                HIP_CHECK(hipGraphLaunch(graph_instance, stream));
+            }
+            else
+            {
+                pipeline.enqueue(run, true, stream);
+            }
+            HIP_CHECK(hipStreamSynchronize(stream));
+            const auto end = std::chrono::high_resolution_clock::now();
+            state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+        }
+
+        state.SetBytesProcessed(state.iterations() * size * Pipeline::item_bytes());
+        state.SetItemsProcessed(state.iterations() * size);
+
+        if(Mode == pipeline_mode::graph)
+        {
+            HIP_CHECK(hipGraphExecDestroy(graph_instance));
+            HIP_CHECK(hipGraphDestroy(graph));
+        }
+        HIP_CHECK(hipFree(d_flush));
+        HIP_CHECK(hipFree(run.temporary_storage));
+        HIP_CHECK(hipStreamDestroy(stream));
+    }
+};
+
+} // namespace
+
+#define CREATE_BENCHMARK(PIPELINE, MODE)                                            \
+    {                                                                               \
+        const device_pipeline_benchmark<PIPELINE, pipeline_mode::MODE> instance;    \
+        REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance);              \
+    }
+
+#define CREATE_BENCHMARKS(PIPELINE)             \
+    CREATE_BENCHMARK(PIPELINE, preallocated)    \
+    CREATE_BENCHMARK(PIPELINE, allocating)      \
+    CREATE_BENCHMARK(PIPELINE, cold_l2)         \
+    CREATE_BENCHMARK(PIPELINE, graph)
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_BYTES, "number of bytes");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.set_optional<std::string>("name_format",
+                                     "name_format",
+                                     "human",
+                                     "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t bytes  = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+    bench_naming::set_format(parser.get<std::string>("name_format"));
+    const std::string  seed_type = parser.get<std::string>("seed");
+    const managed_seed seed(seed_type);
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("bytes", std::to_string(bytes));
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks{};
+    CREATE_BENCHMARKS(filter_sort_aggregate_pipeline)
+    CREATE_BENCHMARKS(histogram_scatter_pipeline)
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -71,10 +71,10 @@ struct device_radix_sort_benchmark : public config_autotune_interface
         size_t size = bytes / sizeof(key_type);
 
         std::vector<key_type> keys_input
-            = get_random_data<key_type>(size,
-                                        generate_limits<key_type>::min(),
-                                        generate_limits<key_type>::max(),
-                                        seed.get_0());
+            = get_distributed_data<key_type>(size,
+                                             generate_limits<key_type>::min(),
+                                             generate_limits<key_type>::max(),
+                                             seed.get_0());
 
         key_type* d_keys_input;
         key_type* d_keys_output;
@@ -151,6 +151,7 @@ struct device_radix_sort_benchmark : public config_autotune_interface
 
         state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        set_temporary_storage(state, temporary_storage_bytes, size * sizeof(key_type));
 
         HIP_CHECK(hipFree(d_temporary_storage));
         HIP_CHECK(hipFree(d_keys_input));
@@ -172,10 +173,10 @@ struct device_radix_sort_benchmark : public config_autotune_interface
         size_t size = bytes / sizeof(key_type);
 
         std::vector<key_type> keys_input
-            = get_random_data<key_type>(size,
-                                        generate_limits<key_type>::min(),
-                                        generate_limits<key_type>::max(),
-                                        seed.get_0());
+            = get_distributed_data<key_type>(size,
+                                             generate_limits<key_type>::min(),
+                                             generate_limits<key_type>::max(),
+                                             seed.get_0());
 
         std::vector<value_type> values_input(size);
         for(size_t i = 0; i < size; i++)
@@ -267,6 +268,9 @@ struct device_radix_sort_benchmark : public config_autotune_interface
         state.SetBytesProcessed(state.iterations() * batch_size * size
                                 * (sizeof(key_type) + sizeof(value_type)));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        set_temporary_storage(state,
+                              temporary_storage_bytes,
+                              size * (sizeof(key_type) + sizeof(value_type)));
 
         HIP_CHECK(hipFree(d_temporary_storage));
         HIP_CHECK(hipFree(d_keys_input));
@@ -72,6 +72,34 @@ inline std::string config_name<rocprim::default_config>()
     return "default_config";
 }
 
+// Global memory traffic of one sort: the histograms read the keys once, and every pass reads and
+// writes the keys and values, and has each tile publish its digit counts and read those of the
+// preceding tile in the look-back.
+template<typename Config, typename Key, typename Value>
+inline double onesweep_memory_traffic(const size_t size)
+{
+    using wrapped_config = rp::detail::wrapped_radix_sort_onesweep_config<Config, Key, Value>;
+
+    rp::detail::target_arch target_arch;
+    HIP_CHECK(rp::detail::host_target_arch(hipStream_t(0), target_arch));
+    const rp::detail::radix_sort_onesweep_config_params params
+        = rp::detail::dispatch_target_arch<wrapped_config>(target_arch);
+
+    const size_t places = rp::detail::ceiling_div(sizeof(Key) * 8, params.radix_bits_per_place);
+    const size_t tiles
+        = rp::detail::ceiling_div(size, params.sort.block_size * params.sort.items_per_thread);
+    const size_t item_bytes
+        = sizeof(Key) + (std::is_same<Value, rp::empty_type>::value ? 0 : sizeof(Value));
+    // Inputs that fit a single batch of fewer than 2^24 items use the compact lookback states
+    const size_t state_bytes    = rp::detail::onesweep_compact_lookback(size)
+                                      ? sizeof(rp::detail::onesweep_compact_lookback_state)
+                                      : sizeof(rp::detail::onesweep_lookback_state);
+    const size_t lookback_bytes = 2 * tiles * (size_t(1) << params.radix_bits_per_place)
+                                  * state_bytes;
+    return static_cast<double>(size * sizeof(Key)
+                               + places * (2 * size * item_bytes + lookback_bytes));
+}
+
 template<typename Key    = int,
          typename Value  = rocprim::empty_type,
          typename Config = rocprim::default_config>
@@ -102,10 +130,10 @@ struct device_radix_sort_onesweep_benchmark : public config_autotune_interface
         size_t size = bytes / sizeof(key_type);
 
         std::vector<key_type> keys_input
-            = get_random_data<key_type>(size,
-                                        generate_limits<key_type>::min(),
-                                        generate_limits<key_type>::max(),
-                                        seed.get_0());
+            = get_distributed_data<key_type>(size,
+                                             generate_limits<key_type>::min(),
+                                             generate_limits<key_type>::max(),
+                                             seed.get_0());
 
         key_type* d_keys_input;
         key_type* d_keys_output;
@@ -208,6 +236,9 @@ struct device_radix_sort_onesweep_benchmark : public config_autotune_interface
 
         state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        set_memory_traffic(state,
+                           state.iterations() * batch_size
+                               * onesweep_memory_traffic<Config, Key, Value>(size));
 
         HIP_CHECK(hipFree(d_temporary_storage));
         HIP_CHECK(hipFree(d_keys_input));
@@ -229,10 +260,10 @@ struct device_radix_sort_onesweep_benchmark : public config_autotune_interface
         size_t size = bytes / sizeof(key_type);
 
         std::vector<key_type> keys_input
-            = get_random_data<key_type>(size,
-                                        generate_limits<key_type>::min(),
-                                        generate_limits<key_type>::max(),
-                                        seed.get_0());
+            = get_distributed_data<key_type>(size,
+                                             generate_limits<key_type>::min(),
+                                             generate_limits<key_type>::max(),
+                                             seed.get_0());
 
         std::vector<value_type> values_input(size);
         for(size_t i = 0; i < size; i++)
@@ -349,6 +380,9 @@ struct device_radix_sort_onesweep_benchmark : public config_autotune_interface
         state.SetBytesProcessed(state.iterations() * batch_size * size
                                 * (sizeof(key_type) + sizeof(value_type)));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        set_memory_traffic(state,
+                           state.iterations() * batch_size
+                               * onesweep_memory_traffic<Config, Key, Value>(size));
 
         HIP_CHECK(hipFree(d_temporary_storage));
         HIP_CHECK(hipFree(d_keys_input));
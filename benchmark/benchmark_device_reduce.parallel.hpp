@@ -174,6 +174,7 @@ struct device_reduce_benchmark : public config_autotune_interface
 
         state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        set_memory_traffic(state, double(state.iterations() * batch_size * size * sizeof(T)));
 
         HIP_CHECK(hipFree(d_input));
         HIP_CHECK(hipFree(d_output));
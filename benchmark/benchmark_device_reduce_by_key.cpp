@@ -49,6 +49,24 @@ constexpr size_t DEFAULT_BYTES = size_t{2} << 30; // 2 GiB
     CREATE_BENCHMARK(KEY, VALUE, 10);     \
     CREATE_BENCHMARK(KEY, VALUE, 1000)
 
+// few unique keys, with the default config and the long-runs mode
+#define CREATE_LONG_RUNS_BENCHMARK(KEY, VALUE)                                                   \
+    {                                                                                            \
+        using long_runs_config                                                                   \
+            = rocprim::reduce_by_key_config<256,                                                 \
+                                            8,                                                   \
+                                            rocprim::block_load_method::block_load_transpose,    \
+                                            rocprim::block_load_method::block_load_transpose,    \
+                                            rocprim::block_scan_algorithm::using_warp_scan,      \
+                                            1,                                                   \
+                                            ROCPRIM_GRID_SIZE_LIMIT,                             \
+                                            true>;                                               \
+        CREATE_BENCHMARK(KEY, VALUE, 1000000);                                                   \
+        const device_reduce_by_key_benchmark<KEY, VALUE, 1000000, false, long_runs_config>       \
+            instance;                                                                            \
+        REGISTER_BENCHMARK(benchmarks, size, seed, stream, instance);                            \
+    }
+
 // some of the tuned types
 #define CREATE_BENCHMARK_TYPES(KEY)            \
     CREATE_BENCHMARK_TYPE(KEY, int8_t);        \
@@ -136,6 +154,10 @@ int main(int argc, char* argv[])
 
     CREATE_BENCHMARK_TYPE(long long, custom_float2);
     CREATE_BENCHMARK_TYPE(long long, custom_double2);
+
+    CREATE_LONG_RUNS_BENCHMARK(int, int);
+    CREATE_LONG_RUNS_BENCHMARK(int, double);
+    CREATE_LONG_RUNS_BENCHMARK(long long, float);
 #endif
 
     // Use manual timing
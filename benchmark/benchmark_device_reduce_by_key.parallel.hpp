@@ -45,7 +45,8 @@ std::string config_name()
     const rocprim::detail::reduce_by_key_config_params params = Config();
     return "{bs:" + std::to_string(params.kernel_config.block_size)
            + ",ipt:" + std::to_string(params.kernel_config.items_per_thread)
-           + ",tpb:" + std::to_string(params.tiles_per_block) + "}";
+           + ",tpb:" + std::to_string(params.tiles_per_block)
+           + (params.long_runs ? ",long_runs:1}" : "}");
 }
 
 template<>
@@ -207,6 +208,7 @@ struct device_reduce_by_key_benchmark : public config_autotune_interface
 
         state.SetBytesProcessed(state.iterations() * batch_size * size * item_size);
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        set_temporary_storage(state, temp_storage_size_bytes, size * item_size);
 
         HIP_CHECK(hipFree(d_temp_storage));
         for(int i = 0; i < num_input_arrays; ++i)
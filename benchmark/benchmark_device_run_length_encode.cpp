@@ -63,7 +63,10 @@ void run_encode_benchmark(benchmark::State&   state,
     unsigned int runs_count = 0;
     const auto          random_range = limit_random_range<size_t>(1, max_length);
     std::vector<size_t> key_counts
-        = get_random_data<size_t>(100000, random_range.first, random_range.second, seed.get_0());
+        = get_distributed_data<size_t>(100000,
+                                       random_range.first,
+                                       random_range.second,
+                                       seed.get_0());
     size_t offset = 0;
     while(offset < size)
     {
@@ -190,7 +193,10 @@ void run_non_trivial_runs_benchmark(benchmark::State&   state,
     unsigned int runs_count = 0;
     const auto          random_range = limit_random_range<size_t>(1, max_length);
     std::vector<size_t> key_counts
-        = get_random_data<size_t>(100000, random_range.first, random_range.second, seed.get_0());
+        = get_distributed_data<size_t>(100000,
+                                       random_range.first,
+                                       random_range.second,
+                                       seed.get_0());
     size_t offset = 0;
     while(offset < size)
     {
@@ -384,6 +390,10 @@ int main(int argc, char *argv[])
                                      "human",
                                      "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.set_optional<std::string>("distribution",
+                                     "distribution",
+                                     "uniform",
+                                     get_distribution_message());
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -393,6 +403,7 @@ int main(int argc, char *argv[])
     bench_naming::set_format(parser.get<std::string>("name_format"));
     const std::string  seed_type = parser.get<std::string>("seed");
     const managed_seed seed(seed_type);
+    bench_distribution::set(parser.get<std::string>("distribution"));
 
     // HIP
     hipStream_t stream = 0; // default
@@ -401,6 +412,7 @@ int main(int argc, char *argv[])
     add_common_benchmark_info();
     benchmark::AddCustomContext("size", std::to_string(size));
     benchmark::AddCustomContext("seed", seed_type);
+    benchmark::AddCustomContext("distribution", bench_distribution::get().name());
 
     // Add benchmarks
     std::vector<benchmark::internal::Benchmark*> benchmarks;
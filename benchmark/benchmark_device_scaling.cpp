@@ -0,0 +1,483 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Scaling of concurrent instances of device algorithms. Every instance has its own input, output
+// and temporary storage and runs on its own stream, either all streams on the current device, or
+// one stream on each of several devices (e.g. the GCDs of an MI-series GPU). The streams of one
+// device share all compute units, have a block budget (see rocprim::set_stream_block_budget), or
+// run on disjoint compute units (see rocprim::create_stream_with_compute_units).
+//
+// The bytes per second are the aggregate throughput of all instances. "speedup" is the aggregate
+// throughput over the one of a single instance running alone, and "slowdown" is the average time
+// of the calls of an instance over the time of the same calls alone. The radix sort and the scan
+// wait for the preceding blocks in their look-backs, so when their blocks interleave with those of
+// other streams they slow down more than the reduce, which does not.
+
+#include "benchmark_utils.hpp"
+// CmdParser
+#include "cmdparser.hpp"
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/execution_budget.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+#ifndef DEFAULT_BYTES
+const size_t DEFAULT_BYTES = 1024 * 1024 * 32;
+#endif
+
+namespace
+{
+
+// Input, output and temporary storage of one instance, allocated on the current device
+template<class Input, class Output>
+class scaling_buffers
+{
+public:
+    using value_type = Input;
+
+    scaling_buffers(const size_t        size,
+                    const size_t        output_size,
+                    const Input         max,
+                    const managed_seed& seed)
+        : size_(size)
+    {
+        const std::vector<Input> input = get_random_data<Input>(size, Input(0), max, seed.get_0());
+        HIP_CHECK(hipMalloc(&d_input_, size * sizeof(Input)));
+        HIP_CHECK(hipMalloc(&d_output_, output_size * sizeof(Output)));
+        HIP_CHECK(hipMemcpy(d_input_, input.data(), size * sizeof(Input), hipMemcpyHostToDevice));
+    }
+
+    ~scaling_buffers()
+    {
+        HIP_CHECK(hipFree(d_temporary_storage_));
+        HIP_CHECK(hipFree(d_input_));
+        HIP_CHECK(hipFree(d_output_));
+    }
+
+    scaling_buffers(const scaling_buffers&)            = delete;
+    scaling_buffers& operator=(const scaling_buffers&) = delete;
+
+protected:
+    size_t  size_;
+    Input*  d_input_;
+    Output* d_output_;
+    void*   d_temporary_storage_     = nullptr;
+    size_t  temporary_storage_bytes_ = 0;
+};
+
+struct reduce_scaling : scaling_buffers<int, int>
+{
+    static const char* name()
+    {
+        return "reduce";
+    }
+
+    reduce_scaling(const size_t size, const managed_seed& seed, const hipStream_t stream)
+        : scaling_buffers(size, 1, 100, seed)
+    {
+        HIP_CHECK(call(nullptr, temporary_storage_bytes_, stream));
+        HIP_CHECK(hipMalloc(&d_temporary_storage_, temporary_storage_bytes_));
+    }
+
+    void operator()(const hipStream_t stream)
+    {
+        HIP_CHECK(call(d_temporary_storage_, temporary_storage_bytes_, stream));
+    }
+
+private:
+    hipError_t call(void* storage, size_t& bytes, const hipStream_t stream) const
+    {
+        return rocprim::reduce(storage,
+                               bytes,
+                               d_input_,
+                               d_output_,
+                               0,
+                               size_,
+                               rocprim::plus<int>(),
+                               stream);
+    }
+};
+
+struct exclusive_scan_scaling : scaling_buffers<int, int>
+{
+    static const char* name()
+    {
+        return "exclusive_scan";
+    }
+
+    exclusive_scan_scaling(const size_t size, const managed_seed& seed, const hipStream_t stream)
+        : scaling_buffers(size, size, 100, seed)
+    {
+        HIP_CHECK(call(nullptr, temporary_storage_bytes_, stream));
+        HIP_CHECK(hipMalloc(&d_temporary_storage_, temporary_storage_bytes_));
+    }
+
+    void operator()(const hipStream_t stream)
+    {
+        HIP_CHECK(call(d_temporary_storage_, temporary_storage_bytes_, stream));
+    }
+
+private:
+    hipError_t call(void* storage, size_t& bytes, const hipStream_t stream) const
+    {
+        return rocprim::exclusive_scan(storage,
+                                       bytes,
+                                       d_input_,
+                                       d_output_,
+                                       0,
+                                       size_,
+                                       rocprim::plus<int>(),
+                                       stream);
+    }
+};
+
+struct radix_sort_keys_scaling : scaling_buffers<unsigned int, unsigned int>
+{
+    static const char* name()
+    {
+        return "radix_sort_keys";
+    }
+
+    radix_sort_keys_scaling(const size_t size, const managed_seed& seed, const hipStream_t stream)
+        : scaling_buffers(size, size, generate_limits<unsigned int>::max(), seed)
+    {
+        HIP_CHECK(call(nullptr, temporary_storage_bytes_, stream));
+        HIP_CHECK(hipMalloc(&d_temporary_storage_, temporary_storage_bytes_));
+    }
+
+    void operator()(const hipStream_t stream)
+    {
+        HIP_CHECK(call(d_temporary_storage_, temporary_storage_bytes_, stream));
+    }
+
+private:
+    hipError_t call(void* storage, size_t& bytes, const hipStream_t stream) const
+    {
+        return rocprim::radix_sort_keys(storage,
+                                        bytes,
+                                        d_input_,
+                                        d_output_,
+                                        size_,
+                                        0,
+                                        sizeof(unsigned int) * 8,
+                                        stream);
+    }
+};
+
+enum class scaling_mode
+{
+    // All streams on the current device, sharing all compute units
+    shared,
+    // All streams on the current device, each with a budget of its share of the resident blocks
+    budget,
+    // All streams on the current device, each on its share of the compute units
+    compute_units,
+    // One stream on each device
+    devices,
+};
+
+inline const char* get_scaling_mode_name(const scaling_mode mode)
+{
+    switch(mode)
+    {
+        case scaling_mode::shared: return "shared";
+        case scaling_mode::budget: return "budget";
+        case scaling_mode::compute_units: return "compute_units";
+        case scaling_mode::devices: return "devices";
+    }
+    return "unknown";
+}
+
+// The device and the stream of an instance
+struct scaling_stream
+{
+    int         device;
+    hipStream_t stream;
+};
+
+inline std::vector<scaling_stream> create_scaling_streams(const scaling_mode mode,
+                                                          const unsigned int instances)
+{
+    int current_device;
+    HIP_CHECK(hipGetDevice(&current_device));
+    hipDeviceProp_t devProp;
+    HIP_CHECK(hipGetDeviceProperties(&devProp, current_device));
+    const unsigned int compute_units = devProp.multiProcessorCount;
+    // The resident blocks of 256 threads
+    const unsigned int resident_blocks
+        = compute_units * std::max(devProp.maxThreadsPerMultiProcessor / 256, 1);
+
+    std::vector<scaling_stream> streams(instances);
+    for(unsigned int i = 0; i < instances; ++i)
+    {
+        scaling_stream& current = streams[i];
+        current.device          = mode == scaling_mode::devices ? int(i) : current_device;
+        HIP_CHECK(hipSetDevice(current.device));
+        if(mode == scaling_mode::compute_units)
+        {
+#ifdef __HIP_PLATFORM_AMD__
+            const unsigned int share = std::max(compute_units / instances, 1u);
+            HIP_CHECK(rocprim::create_stream_with_compute_units(&current.stream,
+                                                                (i * share) % compute_units,
+                                                                share));
+#endif
+        }
+        else
+        {
+            HIP_CHECK(hipStreamCreateWithFlags(&current.stream, hipStreamNonBlocking));
+        }
+        if(mode == scaling_mode::budget)
+        {
+            HIP_CHECK(rocprim::set_stream_block_budget(current.stream,
+                                                       std::max(resident_blocks / instances, 1u)));
+        }
+    }
+    HIP_CHECK(hipSetDevice(current_device));
+    return streams;
+}
+
+template<class Algorithm>
+struct device_scaling_benchmark : public config_autotune_interface
+{
+    scaling_mode mode;
+    unsigned int instances;
+
+    device_scaling_benchmark(const scaling_mode mode, const unsigned int instances)
+        : mode(mode), instances(instances)
+    {}
+
+    std::string name() const override
+    {
+        return bench_naming::format_name("{lvl:device,algo:scaling,subalgo:"
+                                         + std::string(Algorithm::name())
+                                         + ",mode:" + get_scaling_mode_name(mode)
+                                         + ",instances:" + std::to_string(instances)
+                                         + ",cfg:default_config}");
+    }
+
+    static constexpr unsigned int batch_size  = 10;
+    static constexpr unsigned int warmup_size = 5;
+
+    void run(benchmark::State&   state,
+             size_t              bytes,
+             const managed_seed& seed,
+             hipStream_t /*stream*/) const override
+    {
+        using value_type = typename Algorithm::value_type;
+        const size_t size = bytes / sizeof(value_type);
+
+        int current_device;
+        HIP_CHECK(hipGetDevice(&current_device));
+
+        const std::vector<scaling_stream> streams = create_scaling_streams(mode, instances);
+        std::vector<std::unique_ptr<Algorithm>> algorithms;
+        std::vector<hipEvent_t>                 starts(instances);
+        std::vector<hipEvent_t>                 stops(instances);
+        for(unsigned int i = 0; i < instances; ++i)
+        {
+            HIP_CHECK(hipSetDevice(streams[i].device));
+            algorithms.emplace_back(std::make_unique<Algorithm>(size, seed, streams[i].stream));
+            HIP_CHECK(hipEventCreate(&starts[i]));
+            HIP_CHECK(hipEventCreate(&stops[i]));
+        }
+
+        // Enqueues the calls of an iteration on the streams of the instances [0, count)
+        const auto launch = [&](const unsigned int count)
+        {
+            for(unsigned int i = 0; i < count; ++i)
+            {
+                HIP_CHECK(hipSetDevice(streams[i].device));
+                HIP_CHECK(hipEventRecord(starts[i], streams[i].stream));
+                for(unsigned int j = 0; j < batch_size; ++j)
+                {
+                    (*algorithms[i])(streams[i].stream);
+                }
+                HIP_CHECK(hipEventRecord(stops[i], streams[i].stream));
+            }
+        };
+        const auto elapsed_seconds = [&](const unsigned int i)
+        {
+            HIP_CHECK(hipEventSynchronize(stops[i]));
+            float elapsed_mseconds;
+            HIP_CHECK(hipEventElapsedTime(&elapsed_mseconds, starts[i], stops[i]));
+            return elapsed_mseconds / 1000.0;
+        };
+
+        // Warm-up
+        for(unsigned int i = 0; i < warmup_size; ++i)
+        {
+            launch(instances);
+        }
+        for(unsigned int i = 0; i < instances; ++i)
+        {
+            HIP_CHECK(hipStreamSynchronize(streams[i].stream));
+        }
+
+        // The time of the first instance alone
+        launch(1);
+        const double alone_seconds = elapsed_seconds(0);
+
+        double instance_seconds = 0;
+        for(auto _ : state)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            launch(instances);
+            for(unsigned int i = 0; i < instances; ++i)
+            {
+                instance_seconds += elapsed_seconds(i);
+            }
+            const auto end = std::chrono::steady_clock::now();
+            state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+        }
+
+        const double iterations = static_cast<double>(state.iterations());
+        const double average_instance_seconds = instance_seconds / (iterations * instances);
+        state.counters["instances"] = instances;
+        state.counters["slowdown"]  = average_instance_seconds / alone_seconds;
+        state.counters["speedup"]   = benchmark::Counter(iterations * instances * alone_seconds,
+                                                       benchmark::Counter::kIsRate);
+
+        state.SetBytesProcessed(state.iterations() * batch_size * instances * size
+                                * sizeof(value_type));
+        state.SetItemsProcessed(state.iterations() * batch_size * instances * size);
+
+        for(unsigned int i = 0; i < instances; ++i)
+        {
+            HIP_CHECK(hipSetDevice(streams[i].device));
+            HIP_CHECK(hipEventDestroy(starts[i]));
+            HIP_CHECK(hipEventDestroy(stops[i]));
+            algorithms[i].reset();
+            HIP_CHECK(rocprim::set_stream_block_budget(streams[i].stream, 0));
+            HIP_CHECK(hipStreamDestroy(streams[i].stream));
+        }
+        HIP_CHECK(hipSetDevice(current_device));
+    }
+};
+
+} // namespace
+
+#define CREATE_BENCHMARK(ALGORITHM, MODE, INSTANCES)                                 \
+    {                                                                                \
+        const device_scaling_benchmark<ALGORITHM> instance(MODE, INSTANCES);         \
+        REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance);               \
+    }
+
+#define CREATE_BENCHMARKS(MODE, INSTANCES)                          \
+    CREATE_BENCHMARK(reduce_scaling, MODE, INSTANCES)               \
+    CREATE_BENCHMARK(exclusive_scan_scaling, MODE, INSTANCES)       \
+    CREATE_BENCHMARK(radix_sort_keys_scaling, MODE, INSTANCES)
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_BYTES, "number of bytes per instance");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.set_optional<int>("max_instances",
+                             "max_instances",
+                             8,
+                             "largest number of instances on one device");
+    parser.set_optional<std::string>("name_format",
+                                     "name_format",
+                                     "human",
+                                     "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t bytes         = parser.get<size_t>("size");
+    const int    trials        = parser.get<int>("trials");
+    const int    max_instances = parser.get<int>("max_instances");
+    bench_naming::set_format(parser.get<std::string>("name_format"));
+    const std::string  seed_type = parser.get<std::string>("seed");
+    const managed_seed seed(seed_type);
+
+    // HIP, every instance creates its own stream
+    hipStream_t stream = 0;
+
+    int device_count;
+    HIP_CHECK(hipGetDeviceCount(&device_count));
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("bytes", std::to_string(bytes));
+    benchmark::AddCustomContext("seed", seed_type);
+    benchmark::AddCustomContext("device_count", std::to_string(device_count));
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks{};
+    for(unsigned int instances = 1; instances <= unsigned(max_instances); instances *= 2)
+    {
+        CREATE_BENCHMARKS(scaling_mode::shared, instances)
+        if(instances > 1)
+        {
+            CREATE_BENCHMARKS(scaling_mode::budget, instances)
+#ifdef __HIP_PLATFORM_AMD__
+            CREATE_BENCHMARKS(scaling_mode::compute_units, instances)
+#endif
+        }
+    }
+    for(unsigned int instances = 2; instances <= unsigned(device_count); instances *= 2)
+    {
+        CREATE_BENCHMARKS(scaling_mode::devices, instances)
+    }
+    if(device_count > 1 && (device_count & (device_count - 1)) != 0)
+    {
+        CREATE_BENCHMARKS(scaling_mode::devices, unsigned(device_count))
+    }
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
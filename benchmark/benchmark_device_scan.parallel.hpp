@@ -199,9 +199,16 @@ struct device_scan_benchmark : public config_autotune_interface
         HIP_CHECK(hipEventCreate(&start));
         HIP_CHECK(hipEventCreate(&stop));
 
+        const l2_flush       flush;
+        iteration_statistics statistics;
+        energy_sampler       energy;
+
         const unsigned int batch_size = 10;
+        energy.start();
         for(auto _ : state)
         {
+            flush(stream);
+
             // Record start event
             HIP_CHECK(hipEventRecord(start, stream));
 
@@ -224,7 +231,10 @@ struct device_scan_benchmark : public config_autotune_interface
             float elapsed_mseconds;
             HIP_CHECK(hipEventElapsedTime(&elapsed_mseconds, start, stop));
             state.SetIterationTime(elapsed_mseconds / 1000);
+            statistics.add(elapsed_mseconds / 1000);
         }
+        statistics.report(state);
+        energy.stop(state, double(state.iterations()) * batch_size * size);
 
         // Destroy HIP events
         HIP_CHECK(hipEventDestroy(start));
@@ -232,6 +242,7 @@ struct device_scan_benchmark : public config_autotune_interface
 
         state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        set_memory_traffic(state, 2.0 * state.iterations() * batch_size * size * sizeof(T));
 
         HIP_CHECK(hipFree(d_input));
         HIP_CHECK(hipFree(d_output));
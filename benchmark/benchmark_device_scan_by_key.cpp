@@ -32,6 +32,7 @@
 #include <hip/hip_runtime.h>
 
 #include <string>
+#include <vector>
 
 #include <cstddef>
 
@@ -39,6 +40,140 @@
 const size_t DEFAULT_BYTES = 1024 * 1024 * 32 * 4;
 #endif
 
+namespace
+{
+
+std::string lookback_layout_name(const rocprim::detail::lookback_scan_state_layout layout)
+{
+    switch(layout)
+    {
+        case rocprim::detail::lookback_scan_state_layout::packed: return "packed";
+        case rocprim::detail::lookback_scan_state_layout::tagged: return "tagged";
+        case rocprim::detail::lookback_scan_state_layout::separate: return "separate";
+    }
+    return "unknown";
+}
+
+// Compares the layouts of the look-back scan state for values that do not fit into 64 bits
+// together with the flag.
+template<class Value, rocprim::detail::lookback_scan_state_layout Layout>
+struct device_scan_by_key_lookback_layout_benchmark : public config_autotune_interface
+{
+    using key_type = int;
+
+    std::string name() const override
+    {
+        return bench_naming::format_name(
+            "{lvl:device,algo:scan_by_key,subalgo:lookback_layout,key_type:"
+            + std::string(Traits<key_type>::name())
+            + ",value_type:" + std::string(Traits<Value>::name())
+            + ",layout:" + lookback_layout_name(Layout) + ",cfg:default_config}");
+    }
+
+    hipError_t scan(void*           temporary_storage,
+                    size_t&         storage_size,
+                    const key_type* keys,
+                    const Value*    input,
+                    Value*          output,
+                    const size_t    size,
+                    hipStream_t     stream) const
+    {
+        return rocprim::detail::scan_by_key_config_impl<
+            rocprim::detail::lookback_scan_determinism::default_determinism,
+            false,
+            rocprim::default_config,
+            const key_type*,
+            const Value*,
+            Value*,
+            Value,
+            rocprim::plus<Value>,
+            rocprim::equal_to<key_type>,
+            Value,
+            Layout>(temporary_storage,
+                    storage_size,
+                    keys,
+                    input,
+                    output,
+                    Value(),
+                    size,
+                    rocprim::plus<Value>(),
+                    rocprim::equal_to<key_type>(),
+                    stream,
+                    false);
+    }
+
+    void run(benchmark::State&   state,
+             size_t              bytes,
+             const managed_seed& seed,
+             hipStream_t         stream) const override
+    {
+        const size_t size = bytes / sizeof(Value);
+
+        const std::vector<key_type> keys
+            = get_random_segments<key_type>(size, 1024, seed.get_0());
+        const auto               random_range = limit_random_range<Value>(0, 1000);
+        const std::vector<Value> input
+            = get_random_data<Value>(size, random_range.first, random_range.second, seed.get_1());
+
+        key_type* d_keys;
+        Value*    d_input;
+        Value*    d_output;
+        HIP_CHECK(hipMalloc(&d_keys, size * sizeof(*d_keys)));
+        HIP_CHECK(hipMalloc(&d_input, size * sizeof(*d_input)));
+        HIP_CHECK(hipMalloc(&d_output, size * sizeof(*d_output)));
+        HIP_CHECK(hipMemcpy(d_keys, keys.data(), size * sizeof(*d_keys), hipMemcpyHostToDevice));
+        HIP_CHECK(
+            hipMemcpy(d_input, input.data(), size * sizeof(*d_input), hipMemcpyHostToDevice));
+
+        size_t storage_bytes;
+        HIP_CHECK(scan(nullptr, storage_bytes, d_keys, d_input, d_output, size, stream));
+        void* d_storage;
+        HIP_CHECK(hipMalloc(&d_storage, storage_bytes));
+
+        // Warm-up
+        for(size_t i = 0; i < 5; i++)
+        {
+            HIP_CHECK(scan(d_storage, storage_bytes, d_keys, d_input, d_output, size, stream));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        hipEvent_t start, stop;
+        HIP_CHECK(hipEventCreate(&start));
+        HIP_CHECK(hipEventCreate(&stop));
+
+        const unsigned int batch_size = 10;
+        for(auto _ : state)
+        {
+            HIP_CHECK(hipEventRecord(start, stream));
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                HIP_CHECK(
+                    scan(d_storage, storage_bytes, d_keys, d_input, d_output, size, stream));
+            }
+            HIP_CHECK(hipEventRecord(stop, stream));
+            HIP_CHECK(hipEventSynchronize(stop));
+
+            float elapsed_mseconds;
+            HIP_CHECK(hipEventElapsedTime(&elapsed_mseconds, start, stop));
+            state.SetIterationTime(elapsed_mseconds / 1000);
+        }
+
+        HIP_CHECK(hipEventDestroy(start));
+        HIP_CHECK(hipEventDestroy(stop));
+
+        state.SetBytesProcessed(state.iterations() * batch_size * size
+                                * (sizeof(key_type) + sizeof(Value)));
+        state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+        HIP_CHECK(hipFree(d_storage));
+        HIP_CHECK(hipFree(d_keys));
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+    }
+};
+
+} // namespace
+
 #define CREATE_BY_KEY_BENCHMARK(EXCL, T, SCAN_OP, MAX_SEGMENT_LENGTH) \
     {                                                                 \
         const device_scan_by_key_benchmark<EXCL,                      \
@@ -58,6 +193,15 @@ const size_t DEFAULT_BYTES = 1024 * 1024 * 32 * 4;
     CREATE_BY_KEY_BENCHMARK(EXCL, T, SCAN_OP, 4096)  \
     CREATE_BY_KEY_BENCHMARK(EXCL, T, SCAN_OP, 65536)
 
+#define CREATE_LOOKBACK_LAYOUT_BENCHMARK(T, LAYOUT)                    \
+    {                                                                  \
+        const device_scan_by_key_lookback_layout_benchmark<            \
+            T,                                                         \
+            rocprim::detail::lookback_scan_state_layout::LAYOUT>       \
+            instance;                                                  \
+        REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance); \
+    }
+
 #define CREATE_BENCHMARK(T, SCAN_OP)              \
     CREATE_EXCL_INCL_BENCHMARK(false, T, SCAN_OP) \
     CREATE_EXCL_INCL_BENCHMARK(true, T, SCAN_OP)
@@ -127,6 +271,12 @@ int main(int argc, char* argv[])
     CREATE_BENCHMARK(int8_t, rocprim::plus<int8_t>)
     CREATE_BENCHMARK(uint8_t, rocprim::plus<uint8_t>)
     CREATE_BENCHMARK(rocprim::half, rocprim::plus<rocprim::half>)
+
+    using custom_long_double = custom_type<long, double>;
+    CREATE_LOOKBACK_LAYOUT_BENCHMARK(double2, tagged)
+    CREATE_LOOKBACK_LAYOUT_BENCHMARK(double2, separate)
+    CREATE_LOOKBACK_LAYOUT_BENCHMARK(custom_long_double, tagged)
+    CREATE_LOOKBACK_LAYOUT_BENCHMARK(custom_long_double, separate)
 #endif
 
     // Use manual timing
@@ -59,12 +59,13 @@ constexpr std::array<size_t, 4> segment_lengths{30, 256, 3000, 300000};
 // This happens partially, because of the algorithm has 4 kernels, and decides at runtime which one to call.
 
 template<class Key, class Value>
-void run_sort_pairs_benchmark(benchmark::State&   state,
-                              size_t              num_segments,
-                              size_t              mean_segment_length,
-                              size_t              target_bytes,
-                              const managed_seed& seed,
-                              hipStream_t         stream)
+void run_sort_pairs_benchmark(benchmark::State&                 state,
+                              const bench_segment_distribution& distribution,
+                              size_t                            num_segments,
+                              size_t                            mean_segment_length,
+                              size_t                            target_bytes,
+                              const managed_seed&               seed,
+                              hipStream_t                       stream)
 {
     using offset_type = int;
     using key_type    = Key;
@@ -74,38 +75,20 @@ void run_sort_pairs_benchmark(benchmark::State&   state,
     size_t target_size = target_bytes / sizeof(key_type);
 
     // Generate data
-    std::vector<offset_type> offsets;
-    offsets.push_back(0);
-
-    static constexpr int iseed = 716;
-    engine_type          gen(iseed);
-
-    std::normal_distribution<double> segment_length_dis(static_cast<double>(mean_segment_length),
-                                                        0.1 * mean_segment_length);
-
-    size_t offset = 0;
-    for(size_t segment_index = 0; segment_index < num_segments;)
-    {
-        const double segment_length_candidate = std::round(segment_length_dis(gen));
-        if(segment_length_candidate < 0)
-        {
-            continue;
-        }
-        const offset_type segment_length = static_cast<offset_type>(segment_length_candidate);
-        offset += segment_length;
-        offsets.push_back(offset);
-        ++segment_index;
-    }
-    const size_t size           = offset;
+    static constexpr int           iseed = 716;
+    const std::vector<offset_type> offsets
+        = get_segment_offsets<offset_type>(distribution, num_segments, mean_segment_length, iseed);
+    const size_t size           = offsets.back();
     const size_t segments_count = offsets.size() - 1;
 
-    std::vector<key_type> keys_input = get_random_data<key_type>(size,
-                                                                 generate_limits<key_type>::min(),
-                                                                 generate_limits<key_type>::max(),
-                                                                 seed.get_0());
+    std::vector<key_type> keys_input
+        = get_distributed_data<key_type>(size,
+                                         generate_limits<key_type>::min(),
+                                         generate_limits<key_type>::max(),
+                                         seed.get_0());
 
     size_t batch_size = 1;
-    if(size < target_size)
+    if(size > 0 && size < target_size)
     {
         batch_size = (target_size + size - 1) / size;
     }
@@ -242,30 +225,36 @@ void add_sort_pairs_benchmarks(std::vector<benchmark::internal::Benchmark*>& ben
 
     std::string key_name   = Traits<KeyT>::name();
     std::string value_name = Traits<ValueT>::name();
-    for(const auto segment_count : segment_counts)
+    for(const auto& distribution : bench_segment_distribution::get())
     {
-        for(const auto segment_length : segment_lengths)
+        for(const auto segment_count : segment_counts)
         {
-            const auto number_of_elements = segment_count * segment_length;
-            if(number_of_elements > max_size || number_of_elements < min_size)
+            for(const auto segment_length : segment_lengths)
             {
-                continue;
-            }
-            benchmarks.push_back(benchmark::RegisterBenchmark(
-                bench_naming::format_name(
-                    "{lvl:device,algo:radix_sort_segmented,key_type:" + key_name + ",value_type:"
-                    + value_name + ",segment_count:" + std::to_string(segment_count)
-                    + ",segment_length:" + std::to_string(segment_length) + ",cfg:default_config}")
-                    .c_str(),
-                [=](benchmark::State& state)
+                const auto number_of_elements = segment_count * segment_length;
+                if(number_of_elements > max_size || number_of_elements < min_size)
                 {
-                    run_sort_pairs_benchmark<KeyT, ValueT>(state,
-                                                           segment_count,
-                                                           segment_length,
-                                                           target_size,
-                                                           seed,
-                                                           stream);
-                }));
+                    continue;
+                }
+                benchmarks.push_back(benchmark::RegisterBenchmark(
+                    bench_naming::format_name(
+                        "{lvl:device,algo:radix_sort_segmented,key_type:" + key_name
+                        + ",value_type:" + value_name
+                        + ",segment_count:" + std::to_string(segment_count)
+                        + ",segment_length:" + std::to_string(segment_length)
+                        + ",segment_distribution:" + distribution.name() + ",cfg:default_config}")
+                        .c_str(),
+                    [=](benchmark::State& state)
+                    {
+                        run_sort_pairs_benchmark<KeyT, ValueT>(state,
+                                                               distribution,
+                                                               segment_count,
+                                                               segment_length,
+                                                               target_size,
+                                                               seed,
+                                                               stream);
+                    }));
+            }
         }
     }
 }
@@ -280,6 +269,14 @@ int main(int argc, char* argv[])
                                      "human",
                                      "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.set_optional<std::string>("distribution",
+                                     "distribution",
+                                     "uniform",
+                                     get_distribution_message());
+    parser.set_optional<std::string>("segment_distribution",
+                                     "segment_distribution",
+                                     "normal",
+                                     get_segment_distribution_message());
 #ifdef BENCHMARK_CONFIG_TUNING
     // optionally run an evenly split subset of benchmarks, when making multiple program invocations
     parser.set_optional<int>("parallel_instance",
@@ -301,6 +298,8 @@ int main(int argc, char* argv[])
     bench_naming::set_format(parser.get<std::string>("name_format"));
     const std::string  seed_type = parser.get<std::string>("seed");
     const managed_seed seed(seed_type);
+    bench_distribution::set(parser.get<std::string>("distribution"));
+    bench_segment_distribution::set(parser.get<std::string>("segment_distribution"));
 
     // HIP
     hipStream_t stream = 0; // default
@@ -309,6 +308,9 @@ int main(int argc, char* argv[])
     add_common_benchmark_info();
     benchmark::AddCustomContext("bytes", std::to_string(bytes));
     benchmark::AddCustomContext("seed", seed_type);
+    benchmark::AddCustomContext("distribution", bench_distribution::get().name());
+    benchmark::AddCustomContext("segment_distribution",
+                                parser.get<std::string>("segment_distribution"));
 
     // Add benchmarks
     std::vector<benchmark::internal::Benchmark*> benchmarks;
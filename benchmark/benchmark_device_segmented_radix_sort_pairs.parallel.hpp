@@ -35,6 +35,8 @@
 #include <rocprim/device/detail/device_config_helper.hpp>
 #include <rocprim/device/device_segmented_radix_sort.hpp>
 
+#include <algorithm>
+#include <array>
 #include <string>
 #include <vector>
 
@@ -84,126 +86,183 @@ struct device_segmented_radix_sort_benchmark : public config_autotune_interface
                                          + ",cfg:" + config_name<Config>() + "}");
     }
 
-    static constexpr unsigned int batch_size  = 10;
     static constexpr unsigned int warmup_size = 5;
 
-    void run_benchmark(benchmark::State&   state,
-                       size_t              num_segments,
-                       size_t              mean_segment_length,
-                       size_t              target_size,
-                       const managed_seed& seed,
-                       hipStream_t         stream) const
+    // One shape of segments, with lengths of one of the segment distributions
+    struct segments_case
+    {
+        std::vector<int> offsets;
+        size_t           batch_size;
+    };
+
+    static std::vector<segments_case> make_cases(const size_t target_size)
+    {
+        constexpr std::array<size_t, 8>
+            segment_counts{10, 100, 1000, 2500, 5000, 7500, 10000, 100000};
+        constexpr std::array<size_t, 4> segment_lengths{30, 256, 3000, 300000};
+
+        static constexpr int       iseed = 716;
+        std::vector<segments_case> cases;
+        for(const auto& distribution : bench_segment_distribution::get())
+        {
+            for(const auto segment_count : segment_counts)
+            {
+                for(const auto segment_length : segment_lengths)
+                {
+                    const auto number_of_elements = segment_count * segment_length;
+                    if(number_of_elements > 33554432 || number_of_elements < 300000)
+                    {
+                        continue;
+                    }
+
+                    segments_case current;
+                    current.offsets = get_segment_offsets<int>(distribution,
+                                                               segment_count,
+                                                               segment_length,
+                                                               iseed);
+                    // Every case sorts at least target_size items per iteration, so all of them
+                    // weigh about the same in the throughput
+                    const size_t size  = current.offsets.back();
+                    current.batch_size = size > 0 && size < target_size
+                                             ? (target_size + size - 1) / size
+                                             : 1;
+                    cases.push_back(std::move(current));
+                }
+            }
+        }
+        return cases;
+    }
+
+    static hipError_t sort(void*                d_temporary_storage,
+                           size_t&              temporary_storage_bytes,
+                           const Key*           d_keys_input,
+                           Key*                 d_keys_output,
+                           const Value*         d_values_input,
+                           Value*               d_values_output,
+                           const segments_case& current,
+                           const int*           d_offsets,
+                           const hipStream_t    stream)
+    {
+        return rocprim::segmented_radix_sort_pairs<Config>(d_temporary_storage,
+                                                           temporary_storage_bytes,
+                                                           d_keys_input,
+                                                           d_keys_output,
+                                                           d_values_input,
+                                                           d_values_output,
+                                                           current.offsets.back(),
+                                                           current.offsets.size() - 1,
+                                                           d_offsets,
+                                                           d_offsets + 1,
+                                                           0,
+                                                           sizeof(Key) * 8,
+                                                           stream,
+                                                           false);
+    }
+
+    // All shapes and segment distributions are sorted in each iteration, so the throughput of
+    // a config aggregates over all of them instead of favoring one shape.
+    void run(benchmark::State&   state,
+             size_t              bytes,
+             const managed_seed& seed,
+             hipStream_t         stream) const override
     {
         using offset_type = int;
         using key_type    = Key;
         using value_type  = Value;
 
-        std::vector<offset_type> offsets;
-        offsets.push_back(0);
+        // Calculate the number of elements
+        const size_t target_size = bytes / sizeof(key_type);
 
-        static constexpr int iseed = 716;
-        engine_type          gen(iseed);
+        const std::vector<segments_case> cases = make_cases(target_size);
 
-        std::normal_distribution<double> segment_length_dis(
-            static_cast<double>(mean_segment_length),
-            0.1 * mean_segment_length);
-
-        size_t offset = 0;
-        for(size_t segment_index = 0; segment_index < num_segments;)
+        size_t max_size     = 0;
+        size_t max_offsets  = 0;
+        size_t total_sorted = 0;
+        for(const auto& current : cases)
         {
-            const double segment_length_candidate = std::round(segment_length_dis(gen));
-            if(segment_length_candidate < 0)
-            {
-                continue;
-            }
-            const offset_type segment_length = static_cast<offset_type>(segment_length_candidate);
-            offset += segment_length;
-            offsets.push_back(offset);
-            ++segment_index;
+            max_size    = std::max<size_t>(max_size, current.offsets.back());
+            max_offsets = std::max(max_offsets, current.offsets.size());
+            total_sorted += current.batch_size * current.offsets.back();
         }
-        const size_t size           = offset;
-        const size_t segments_count = offsets.size() - 1;
 
+        // The cases sort prefixes of the same keys
         std::vector<key_type> keys_input
-            = get_random_data<key_type>(size,
-                                        generate_limits<key_type>::min(),
-                                        generate_limits<key_type>::max(),
-                                        seed.get_0());
+            = get_distributed_data<key_type>(max_size,
+                                             generate_limits<key_type>::min(),
+                                             generate_limits<key_type>::max(),
+                                             seed.get_0());
 
         std::vector<value_type> values_input
-            = get_random_data<value_type>(size,
+            = get_random_data<value_type>(max_size,
                                           generate_limits<value_type>::min(),
                                           generate_limits<value_type>::max(),
                                           seed.get_0());
 
-        size_t batch_size = 1;
-        if(size < target_size)
-        {
-            batch_size = (target_size + size - 1) / size;
-        }
-
         offset_type* d_offsets;
-        HIP_CHECK(hipMalloc(&d_offsets, offsets.size() * sizeof(offset_type)));
-        HIP_CHECK(hipMemcpy(d_offsets,
-                            offsets.data(),
-                            offsets.size() * sizeof(offset_type),
-                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMalloc(&d_offsets, max_offsets * sizeof(offset_type)));
 
         key_type* d_keys_input;
         key_type* d_keys_output;
-        HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
-        HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(key_type)));
+        HIP_CHECK(hipMalloc(&d_keys_input, max_size * sizeof(key_type)));
+        HIP_CHECK(hipMalloc(&d_keys_output, max_size * sizeof(key_type)));
         HIP_CHECK(hipMemcpy(d_keys_input,
                             keys_input.data(),
-                            size * sizeof(key_type),
+                            max_size * sizeof(key_type),
                             hipMemcpyHostToDevice));
 
         value_type* d_values_input;
         value_type* d_values_output;
-        HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(value_type)));
-        HIP_CHECK(hipMalloc(&d_values_output, size * sizeof(value_type)));
+        HIP_CHECK(hipMalloc(&d_values_input, max_size * sizeof(value_type)));
+        HIP_CHECK(hipMalloc(&d_values_output, max_size * sizeof(value_type)));
         HIP_CHECK(hipMemcpy(d_values_input,
                             values_input.data(),
-                            size * sizeof(value_type),
+                            max_size * sizeof(value_type),
                             hipMemcpyHostToDevice));
 
-        void*  d_temporary_storage     = nullptr;
         size_t temporary_storage_bytes = 0;
-        HIP_CHECK(rocprim::segmented_radix_sort_pairs<Config>(d_temporary_storage,
-                                                              temporary_storage_bytes,
-                                                              d_keys_input,
-                                                              d_keys_output,
-                                                              d_values_input,
-                                                              d_values_output,
-                                                              size,
-                                                              segments_count,
-                                                              d_offsets,
-                                                              d_offsets + 1,
-                                                              0,
-                                                              sizeof(key_type) * 8,
-                                                              stream,
-                                                              false));
+        for(const auto& current : cases)
+        {
+            size_t case_bytes = 0;
+            HIP_CHECK(sort(nullptr,
+                           case_bytes,
+                           d_keys_input,
+                           d_keys_output,
+                           d_values_input,
+                           d_values_output,
+                           current,
+                           d_offsets,
+                           stream));
+            temporary_storage_bytes = std::max(temporary_storage_bytes, case_bytes);
+        }
 
+        void* d_temporary_storage;
         HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
-        HIP_CHECK(hipDeviceSynchronize());
+
+        const auto upload_offsets = [&](const segments_case& current)
+        {
+            HIP_CHECK(hipMemcpyAsync(d_offsets,
+                                     current.offsets.data(),
+                                     current.offsets.size() * sizeof(offset_type),
+                                     hipMemcpyHostToDevice,
+                                     stream));
+        };
 
         // Warm-up
-        for(size_t i = 0; i < warmup_size; i++)
+        for(const auto& current : cases)
         {
-            HIP_CHECK(rocprim::segmented_radix_sort_pairs<Config>(d_temporary_storage,
-                                                                  temporary_storage_bytes,
-                                                                  d_keys_input,
-                                                                  d_keys_output,
-                                                                  d_values_input,
-                                                                  d_values_output,
-                                                                  size,
-                                                                  segments_count,
-                                                                  d_offsets,
-                                                                  d_offsets + 1,
-                                                                  0,
-                                                                  sizeof(key_type) * 8,
-                                                                  stream,
-                                                                  false));
+            upload_offsets(current);
+            for(size_t i = 0; i < warmup_size; i++)
+            {
+                HIP_CHECK(sort(d_temporary_storage,
+                               temporary_storage_bytes,
+                               d_keys_input,
+                               d_keys_output,
+                               d_values_input,
+                               d_values_output,
+                               current,
+                               d_offsets,
+                               stream));
+            }
         }
         HIP_CHECK(hipDeviceSynchronize());
 
@@ -212,44 +271,58 @@ struct device_segmented_radix_sort_benchmark : public config_autotune_interface
         HIP_CHECK(hipEventCreate(&start));
         HIP_CHECK(hipEventCreate(&stop));
 
+        const l2_flush       flush;
+        iteration_statistics statistics;
+        energy_sampler       energy;
+
+        energy.start();
         for(auto _ : state)
         {
-            // Record start event
-            HIP_CHECK(hipEventRecord(start, stream));
-
-            for(size_t i = 0; i < batch_size; i++)
+            float elapsed_mseconds = 0;
+            for(const auto& current : cases)
             {
-                HIP_CHECK(rocprim::segmented_radix_sort_pairs<Config>(d_temporary_storage,
-                                                                      temporary_storage_bytes,
-                                                                      d_keys_input,
-                                                                      d_keys_output,
-                                                                      d_values_input,
-                                                                      d_values_output,
-                                                                      size,
-                                                                      segments_count,
-                                                                      d_offsets,
-                                                                      d_offsets + 1,
-                                                                      0,
-                                                                      sizeof(key_type) * 8,
-                                                                      stream,
-                                                                      false));
-            }
+                // The upload of the offsets is not timed
+                upload_offsets(current);
+
+                flush(stream);
 
-            // Record stop event and wait until it completes
-            HIP_CHECK(hipEventRecord(stop, stream));
-            HIP_CHECK(hipEventSynchronize(stop));
+                // Record start event
+                HIP_CHECK(hipEventRecord(start, stream));
 
-            float elapsed_mseconds;
-            HIP_CHECK(hipEventElapsedTime(&elapsed_mseconds, start, stop));
+                for(size_t i = 0; i < current.batch_size; i++)
+                {
+                    HIP_CHECK(sort(d_temporary_storage,
+                                   temporary_storage_bytes,
+                                   d_keys_input,
+                                   d_keys_output,
+                                   d_values_input,
+                                   d_values_output,
+                                   current,
+                                   d_offsets,
+                                   stream));
+                }
+
+                // Record stop event and wait until it completes
+                HIP_CHECK(hipEventRecord(stop, stream));
+                HIP_CHECK(hipEventSynchronize(stop));
+
+                float case_mseconds;
+                HIP_CHECK(hipEventElapsedTime(&case_mseconds, start, stop));
+                elapsed_mseconds += case_mseconds;
+            }
             state.SetIterationTime(elapsed_mseconds / 1000);
+            statistics.add(elapsed_mseconds / 1000);
         }
+        statistics.report(state);
+        energy.stop(state, double(state.iterations()) * total_sorted);
 
         // Destroy HIP events
         HIP_CHECK(hipEventDestroy(start));
         HIP_CHECK(hipEventDestroy(stop));
 
-        state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
-        state.SetItemsProcessed(state.iterations() * batch_size * size);
+        state.SetBytesProcessed(state.iterations() * total_sorted
+                                * (sizeof(key_type) + sizeof(value_type)));
+        state.SetItemsProcessed(state.iterations() * total_sorted);
 
         HIP_CHECK(hipFree(d_temporary_storage));
         HIP_CHECK(hipFree(d_offsets));
@@ -258,33 +331,6 @@ struct device_segmented_radix_sort_benchmark : public config_autotune_interface
         HIP_CHECK(hipFree(d_values_input));
         HIP_CHECK(hipFree(d_values_output));
     }
-
-    void run(benchmark::State&   state,
-             size_t              bytes,
-             const managed_seed& seed,
-             hipStream_t         stream) const override
-    {
-        // Calculate the number of elements 
-        size_t size = bytes / sizeof(Key);
-        
-        constexpr std::array<size_t, 8>
-            segment_counts{10, 100, 1000, 2500, 5000, 7500, 10000, 100000};
-        constexpr std::array<size_t, 4> segment_lengths{30, 256, 3000, 300000};
-
-        for(const auto segment_count : segment_counts)
-        {
-            for(const auto segment_length : segment_lengths)
-            {
-                const auto number_of_elements = segment_count * segment_length;
-                if(number_of_elements > 33554432 || number_of_elements < 300000)
-                {
-                    continue;
-                }
-
-                run_benchmark(state, segment_count, segment_length, size, seed, stream);
-            }
-        }
-    }
 };
 
 template<typename Tp, template<Tp> class T, bool enable, Tp... Idx>
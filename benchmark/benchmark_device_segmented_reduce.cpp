@@ -49,11 +49,12 @@ const unsigned int batch_size = 10;
 const unsigned int warmup_size = 5;
 
 template<class T>
-void run_benchmark(benchmark::State&   state,
-                   size_t              desired_segments,
-                   size_t              bytes,
-                   const managed_seed& seed,
-                   hipStream_t         stream)
+void run_benchmark(benchmark::State&                 state,
+                   const bench_segment_distribution& distribution,
+                   size_t                            desired_segments,
+                   size_t                            bytes,
+                   const managed_seed&               seed,
+                   hipStream_t                       stream)
 {
     using offset_type = int;
     using value_type = T;
@@ -65,14 +66,14 @@ void run_benchmark(benchmark::State&   state,
     engine_type gen(seed.get_0());
 
     const double avg_segment_length = static_cast<double>(size) / desired_segments;
-    std::uniform_real_distribution<double> segment_length_dis(0, avg_segment_length * 2);
+    segment_length_generator segment_length_dis(distribution, avg_segment_length);
 
     std::vector<offset_type> offsets;
     unsigned int segments_count = 0;
     size_t offset = 0;
     while(offset < size)
     {
-        const size_t segment_length = std::round(segment_length_dis(gen));
+        const size_t segment_length = segment_length_dis(gen);
         offsets.push_back(offset);
         segments_count++;
         offset += segment_length;
@@ -191,9 +192,11 @@ void run_benchmark(benchmark::State&   state,
     benchmark::RegisterBenchmark(                                                      \
         bench_naming::format_name("{lvl:device,algo:reduce_segmented,key_type:" #T     \
                                   ",segment_count:"                                    \
-                                  + std::to_string(SEGMENTS) + ",cfg:default_config}") \
+                                  + std::to_string(SEGMENTS) + ",segment_distribution:"  \
+                                  + distribution.name() + ",cfg:default_config}")      \
             .c_str(),                                                                  \
         run_benchmark<T>,                                                              \
+        distribution,                                                                  \
         SEGMENTS,                                                                      \
         bytes,                                                                          \
         seed,                                                                          \
@@ -214,19 +217,21 @@ void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
     using custom_float2 = custom_type<float, float>;
     using custom_double2 = custom_type<double, double>;
 
-    std::vector<benchmark::internal::Benchmark*> bs =
+    for(const auto& distribution : bench_segment_distribution::get())
     {
-        BENCHMARK_TYPE(float),
-        BENCHMARK_TYPE(double),
-        BENCHMARK_TYPE(int8_t),
-        BENCHMARK_TYPE(uint8_t),
-        BENCHMARK_TYPE(rocprim::half),
-        BENCHMARK_TYPE(int),
-        BENCHMARK_TYPE(custom_float2),
-        BENCHMARK_TYPE(custom_double2),
-    };
-
-    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+        std::vector<benchmark::internal::Benchmark*> bs = {
+            BENCHMARK_TYPE(float),
+            BENCHMARK_TYPE(double),
+            BENCHMARK_TYPE(int8_t),
+            BENCHMARK_TYPE(uint8_t),
+            BENCHMARK_TYPE(rocprim::half),
+            BENCHMARK_TYPE(int),
+            BENCHMARK_TYPE(custom_float2),
+            BENCHMARK_TYPE(custom_double2),
+        };
+
+        benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+    }
 }
 
 int main(int argc, char *argv[])
@@ -240,6 +245,10 @@ int main(int argc, char *argv[])
                                      "either: json,human,txt");
     // fixed seed as a random seed adds a lot of variance
     parser.set_optional<std::string>("seed", "seed", "321", get_seed_message());
+    parser.set_optional<std::string>("segment_distribution",
+                                     "segment_distribution",
+                                     "uniform",
+                                     get_segment_distribution_message());
     parser.run_and_exit_if_error();
 
     // Parse argv
@@ -249,6 +258,7 @@ int main(int argc, char *argv[])
     bench_naming::set_format(parser.get<std::string>("name_format"));
     const std::string  seed_type = parser.get<std::string>("seed");
     const managed_seed seed(seed_type);
+    bench_segment_distribution::set(parser.get<std::string>("segment_distribution"));
 
     // HIP
     hipStream_t stream = 0; // default
@@ -257,6 +267,8 @@ int main(int argc, char *argv[])
     add_common_benchmark_info();
     benchmark::AddCustomContext("bytes", std::to_string(bytes));
     benchmark::AddCustomContext("seed", seed_type);
+    benchmark::AddCustomContext("segment_distribution",
+                                parser.get<std::string>("segment_distribution"));
 
     // Add benchmarks
     std::vector<benchmark::internal::Benchmark*> benchmarks;
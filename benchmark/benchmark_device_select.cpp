@@ -71,6 +71,18 @@ const size_t DEFAULT_BYTES = 1024 * 1024 * 32 * 4;
         REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance);                 \
     }
 
+#define CREATE_SELECT_PREDICATE_UNORDERED_BENCHMARK(T, p)                                       \
+    {                                                                                          \
+        const device_select_predicate_benchmark<T, rocprim::default_config, p, true> instance; \
+        REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance);                          \
+    }
+
+#define CREATE_UNIQUE_UNORDERED_BENCHMARK(T, p)                                             \
+    {                                                                                       \
+        const device_select_unique_benchmark<T, rocprim::default_config, p, true> instance; \
+        REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance);                       \
+    }
+
 #define CREATE_UNIQUE_BY_KEY_BENCHMARK(K, V, p)                                                 \
     {                                                                                           \
         const device_select_unique_by_key_benchmark<K, V, rocprim::default_config, p> instance; \
@@ -101,6 +113,18 @@ const size_t DEFAULT_BYTES = 1024 * 1024 * 32 * 4;
     CREATE_UNIQUE_BENCHMARK(type, select_probability::p050); \
     CREATE_UNIQUE_BENCHMARK(type, select_probability::p075)
 
+#define BENCHMARK_SELECT_PREDICATE_UNORDERED_TYPE(type)                          \
+    CREATE_SELECT_PREDICATE_UNORDERED_BENCHMARK(type, select_probability::p005); \
+    CREATE_SELECT_PREDICATE_UNORDERED_BENCHMARK(type, select_probability::p025); \
+    CREATE_SELECT_PREDICATE_UNORDERED_BENCHMARK(type, select_probability::p050); \
+    CREATE_SELECT_PREDICATE_UNORDERED_BENCHMARK(type, select_probability::p075)
+
+#define BENCHMARK_UNIQUE_UNORDERED_TYPE(type)                          \
+    CREATE_UNIQUE_UNORDERED_BENCHMARK(type, select_probability::p005); \
+    CREATE_UNIQUE_UNORDERED_BENCHMARK(type, select_probability::p025); \
+    CREATE_UNIQUE_UNORDERED_BENCHMARK(type, select_probability::p050); \
+    CREATE_UNIQUE_UNORDERED_BENCHMARK(type, select_probability::p075)
+
 #define BENCHMARK_UNIQUE_BY_KEY_TYPE(K, V)                          \
     CREATE_UNIQUE_BY_KEY_BENCHMARK(K, V, select_probability::p005); \
     CREATE_UNIQUE_BY_KEY_BENCHMARK(K, V, select_probability::p025); \
@@ -117,6 +141,10 @@ int main(int argc, char* argv[])
                                      "human",
                                      "either: json,human,txt");
     parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.set_optional<std::string>("distribution",
+                                     "distribution",
+                                     "uniform",
+                                     get_distribution_message());
 #ifdef BENCHMARK_CONFIG_TUNING
     // optionally run an evenly split subset of benchmarks, when making multiple program invocations
     parser.set_optional<int>("parallel_instance",
@@ -137,6 +165,7 @@ int main(int argc, char* argv[])
     bench_naming::set_format(parser.get<std::string>("name_format"));
     const std::string  seed_type = parser.get<std::string>("seed");
     const managed_seed seed(seed_type);
+    bench_distribution::set(parser.get<std::string>("distribution"));
 
     // HIP
     hipStream_t stream = 0; // default
@@ -145,6 +174,7 @@ int main(int argc, char* argv[])
     add_common_benchmark_info();
     benchmark::AddCustomContext("bytes", std::to_string(bytes));
     benchmark::AddCustomContext("seed", seed_type);
+    benchmark::AddCustomContext("distribution", bench_distribution::get().name());
 
     // Add benchmarks
     std::vector<benchmark::internal::Benchmark*> benchmarks = {};
@@ -177,6 +207,11 @@ int main(int argc, char* argv[])
     BENCHMARK_SELECT_PREDICATE_TYPE(rocprim::half);
     BENCHMARK_SELECT_PREDICATE_TYPE(custom_int_double);
 
+    // Unordered selections, compared with the stable ones of the same types
+    BENCHMARK_SELECT_PREDICATE_UNORDERED_TYPE(int);
+    BENCHMARK_SELECT_PREDICATE_UNORDERED_TYPE(double);
+    BENCHMARK_SELECT_PREDICATE_UNORDERED_TYPE(int8_t);
+
     BENCHMARK_SELECT_PREDICATED_FLAG_TYPE(int, unsigned char);
     BENCHMARK_SELECT_PREDICATED_FLAG_TYPE(float, unsigned char);
     BENCHMARK_SELECT_PREDICATED_FLAG_TYPE(double, unsigned char);
@@ -193,6 +228,10 @@ int main(int argc, char* argv[])
     BENCHMARK_UNIQUE_TYPE(rocprim::half);
     BENCHMARK_UNIQUE_TYPE(custom_int_double);
 
+    BENCHMARK_UNIQUE_UNORDERED_TYPE(int);
+    BENCHMARK_UNIQUE_UNORDERED_TYPE(double);
+    BENCHMARK_UNIQUE_UNORDERED_TYPE(int8_t);
+
     BENCHMARK_UNIQUE_BY_KEY_TYPE(int, int);
     BENCHMARK_UNIQUE_BY_KEY_TYPE(float, double);
     BENCHMARK_UNIQUE_BY_KEY_TYPE(double, custom_double2);
@@ -101,10 +101,11 @@ struct device_select_flag_benchmark : public config_autotune_interface
         // Calculate the number of elements 
         size_t size = bytes / sizeof(DataType);
 
-        std::vector<DataType> input = get_random_data<DataType>(size,
-                                                                generate_limits<DataType>::min(),
-                                                                generate_limits<DataType>::max(),
-                                                                seed.get_0());
+        std::vector<DataType> input
+            = get_distributed_data<DataType>(size,
+                                             generate_limits<DataType>::min(),
+                                             generate_limits<DataType>::max(),
+                                             seed.get_0());
 
         std::vector<FlagType> flags_0;
         std::vector<FlagType> flags_1;
@@ -225,16 +226,20 @@ struct device_select_flag_benchmark : public config_autotune_interface
     static constexpr bool is_tuning = Probability == select_probability::tuning;
 };
 
+// With Unordered, select_unordered is benchmarked instead of the stable select.
 template<class DataType,
          class Config                   = rocprim::default_config,
-         select_probability Probability = select_probability::tuning>
+         select_probability Probability = select_probability::tuning,
+         bool Unordered                 = false>
 struct device_select_predicate_benchmark : public config_autotune_interface
 {
     std::string name() const override
     {
         using namespace std::string_literals;
-        return bench_naming::format_name("{lvl:device,algo:select,subalgo:predicate,data_type:"
-                                         + std::string(Traits<DataType>::name())
+        return bench_naming::format_name("{lvl:device,algo:select,subalgo:"
+                                         + std::string(Unordered ? "predicate_unordered"
+                                                                 : "predicate")
+                                         + ",data_type:" + std::string(Traits<DataType>::name())
                                          + ",probability:" + get_probability_name(Probability)
                                          + ",cfg:" + partition_config_name<Config>() + "}");
     }
@@ -248,10 +253,11 @@ struct device_select_predicate_benchmark : public config_autotune_interface
         size_t size = bytes / sizeof(DataType);
 
         // all data types can represent [0, 127], -1 so a predicate can select all
-        std::vector<DataType> input = get_random_data<DataType>(size,
-                                                                static_cast<DataType>(0),
-                                                                static_cast<DataType>(126),
-                                                                seed.get_0());
+        std::vector<DataType> input
+            = get_distributed_data<DataType>(size,
+                                             static_cast<DataType>(0),
+                                             static_cast<DataType>(126),
+                                             seed.get_0());
 
         DataType* d_input;
         HIP_CHECK(hipMalloc(&d_input, size * sizeof(*d_input)));
@@ -269,14 +275,28 @@ struct device_select_predicate_benchmark : public config_autotune_interface
             {
                 auto predicate = [probability](const DataType& value) -> bool
                 { return value < static_cast<DataType>(127 * probability); };
-                HIP_CHECK(rocprim::select<Config>(d_temp_storage,
-                                                  temp_storage_size_bytes,
-                                                  d_input,
-                                                  d_output,
-                                                  d_selected_count_output,
-                                                  size,
-                                                  predicate,
-                                                  stream));
+                if ROCPRIM_IF_CONSTEXPR(Unordered)
+                {
+                    HIP_CHECK(rocprim::select_unordered<Config>(d_temp_storage,
+                                                                temp_storage_size_bytes,
+                                                                d_input,
+                                                                d_output,
+                                                                d_selected_count_output,
+                                                                size,
+                                                                predicate,
+                                                                stream));
+                }
+                else
+                {
+                    HIP_CHECK(rocprim::select<Config>(d_temp_storage,
+                                                      temp_storage_size_bytes,
+                                                      d_input,
+                                                      d_output,
+                                                      d_selected_count_output,
+                                                      size,
+                                                      predicate,
+                                                      stream));
+                }
             };
 
             if(is_tuning)
@@ -360,10 +380,11 @@ struct device_select_predicated_flag_benchmark : public config_autotune_interfac
         // Calculate the number of elements
         size_t size = bytes / sizeof(DataType);
 
-        std::vector<DataType> input = get_random_data<DataType>(size,
-                                                                generate_limits<DataType>::min(),
-                                                                generate_limits<DataType>::max(),
-                                                                seed.get_0());
+        std::vector<DataType> input
+            = get_distributed_data<DataType>(size,
+                                             generate_limits<DataType>::min(),
+                                             generate_limits<DataType>::max(),
+                                             seed.get_0());
 
         std::vector<FlagType> flags_0;
         std::vector<FlagType> flags_1;
@@ -505,16 +526,19 @@ inline std::vector<DataType> get_unique_input(size_t size, float probability, un
     return input;
 }
 
+// With Unordered, unique_unordered is benchmarked instead of the stable unique.
 template<class DataType,
          class Config                   = rocprim::default_config,
-         select_probability Probability = select_probability::tuning>
+         select_probability Probability = select_probability::tuning,
+         bool Unordered                 = false>
 struct device_select_unique_benchmark : public config_autotune_interface
 {
     std::string name() const override
     {
         using namespace std::string_literals;
-        return bench_naming::format_name("{lvl:device,algo:select,subalgo:unique,data_type:"
-                                         + std::string(Traits<DataType>::name())
+        return bench_naming::format_name("{lvl:device,algo:select,subalgo:"
+                                         + std::string(Unordered ? "unique_unordered" : "unique")
+                                         + ",data_type:" + std::string(Traits<DataType>::name())
                                          + ",probability:" + get_probability_name(Probability)
                                          + ",cfg:" + partition_config_name<Config>() + "}");
     }
@@ -572,14 +596,28 @@ struct device_select_unique_benchmark : public config_autotune_interface
         {
             const auto dispatch_flags = [&](DataType* d_input)
             {
-                HIP_CHECK(rocprim::unique<Config>(d_temp_storage,
-                                                  temp_storage_size_bytes,
-                                                  d_input,
-                                                  d_output,
-                                                  d_selected_count_output,
-                                                  size,
-                                                  rocprim::equal_to<DataType>(),
-                                                  stream));
+                if ROCPRIM_IF_CONSTEXPR(Unordered)
+                {
+                    HIP_CHECK(rocprim::unique_unordered<Config>(d_temp_storage,
+                                                                temp_storage_size_bytes,
+                                                                d_input,
+                                                                d_output,
+                                                                d_selected_count_output,
+                                                                size,
+                                                                rocprim::equal_to<DataType>(),
+                                                                stream));
+                }
+                else
+                {
+                    HIP_CHECK(rocprim::unique<Config>(d_temp_storage,
+                                                      temp_storage_size_bytes,
+                                                      d_input,
+                                                      d_output,
+                                                      d_selected_count_output,
+                                                      size,
+                                                      rocprim::equal_to<DataType>(),
+                                                      stream));
+                }
             };
 
             dispatch_flags(d_input_0);
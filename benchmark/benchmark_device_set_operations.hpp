@@ -0,0 +1,259 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef ROCPRIM_BENCHMARK_DEVICE_SET_OPERATIONS_HPP_
+#define ROCPRIM_BENCHMARK_DEVICE_SET_OPERATIONS_HPP_
+
+#include "benchmark_utils.hpp"
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/device/device_set_operations.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+enum class set_operation_kind
+{
+    set_union,
+    set_intersection,
+    set_difference,
+    set_symmetric_difference
+};
+
+inline const char* set_operation_name(const set_operation_kind operation)
+{
+    switch(operation)
+    {
+        case set_operation_kind::set_union: return "set_union";
+        case set_operation_kind::set_intersection: return "set_intersection";
+        case set_operation_kind::set_difference: return "set_difference";
+        default: return "set_symmetric_difference";
+    }
+}
+
+template<typename Key = int, typename Config = rocprim::default_config>
+struct device_set_operations_benchmark : public config_autotune_interface
+{
+    set_operation_kind operation;
+
+    device_set_operations_benchmark(set_operation_kind Operation) : operation(Operation) {}
+
+    std::string name() const override
+    {
+        using namespace std::string_literals;
+        return bench_naming::format_name(
+            "{lvl:device,algo:" + std::string(set_operation_name(operation))
+            + ",key_type:" + std::string(Traits<Key>::name()) + ",cfg:default_config}");
+    }
+
+    static constexpr unsigned int batch_size  = 10;
+    static constexpr unsigned int warmup_size = 5;
+
+    hipError_t run_operation(void*       d_temporary_storage,
+                             size_t&     temporary_storage_bytes,
+                             const Key*  d_keys_input1,
+                             const Key*  d_keys_input2,
+                             Key*        d_keys_output,
+                             size_t*     d_count,
+                             size_t      size1,
+                             size_t      size2,
+                             hipStream_t stream) const
+    {
+        switch(operation)
+        {
+            case set_operation_kind::set_union:
+                return rocprim::set_union<Config>(d_temporary_storage,
+                                                  temporary_storage_bytes,
+                                                  d_keys_input1,
+                                                  d_keys_input2,
+                                                  d_keys_output,
+                                                  d_count,
+                                                  size1,
+                                                  size2,
+                                                  rocprim::less<Key>(),
+                                                  stream);
+            case set_operation_kind::set_intersection:
+                return rocprim::set_intersection<Config>(d_temporary_storage,
+                                                         temporary_storage_bytes,
+                                                         d_keys_input1,
+                                                         d_keys_input2,
+                                                         d_keys_output,
+                                                         d_count,
+                                                         size1,
+                                                         size2,
+                                                         rocprim::less<Key>(),
+                                                         stream);
+            case set_operation_kind::set_difference:
+                return rocprim::set_difference<Config>(d_temporary_storage,
+                                                       temporary_storage_bytes,
+                                                       d_keys_input1,
+                                                       d_keys_input2,
+                                                       d_keys_output,
+                                                       d_count,
+                                                       size1,
+                                                       size2,
+                                                       rocprim::less<Key>(),
+                                                       stream);
+            default:
+                return rocprim::set_symmetric_difference<Config>(d_temporary_storage,
+                                                                 temporary_storage_bytes,
+                                                                 d_keys_input1,
+                                                                 d_keys_input2,
+                                                                 d_keys_output,
+                                                                 d_count,
+                                                                 size1,
+                                                                 size2,
+                                                                 rocprim::less<Key>(),
+                                                                 stream);
+        }
+    }
+
+    void run(benchmark::State&   state,
+             size_t              bytes,
+             const managed_seed& seed,
+             hipStream_t         stream) const override
+    {
+        using key_type = Key;
+
+        // Calculate the number of elements, split between the two inputs
+        const size_t size  = bytes / sizeof(key_type);
+        const size_t size1 = size / 2;
+        const size_t size2 = size - size1;
+
+        // Generate data, both inputs are drawn from the same range so that they overlap
+        std::vector<key_type> keys_input1
+            = get_random_data<key_type>(size1,
+                                        generate_limits<key_type>::min(),
+                                        generate_limits<key_type>::max(),
+                                        seed.get_0());
+        std::vector<key_type> keys_input2
+            = get_random_data<key_type>(size2,
+                                        generate_limits<key_type>::min(),
+                                        generate_limits<key_type>::max(),
+                                        seed.get_1());
+        std::sort(keys_input1.begin(), keys_input1.end());
+        std::sort(keys_input2.begin(), keys_input2.end());
+
+        key_type* d_keys_input1;
+        key_type* d_keys_input2;
+        key_type* d_keys_output;
+        size_t*   d_count;
+        HIP_CHECK(hipMalloc(&d_keys_input1, size1 * sizeof(*d_keys_input1)));
+        HIP_CHECK(hipMalloc(&d_keys_input2, size2 * sizeof(*d_keys_input2)));
+        HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(*d_keys_output)));
+        HIP_CHECK(hipMalloc(&d_count, sizeof(*d_count)));
+
+        HIP_CHECK(hipMemcpy(d_keys_input1,
+                            keys_input1.data(),
+                            size1 * sizeof(*d_keys_input1),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_keys_input2,
+                            keys_input2.data(),
+                            size2 * sizeof(*d_keys_input2),
+                            hipMemcpyHostToDevice));
+
+        void*  d_temporary_storage     = nullptr;
+        size_t temporary_storage_bytes = 0;
+        HIP_CHECK(run_operation(d_temporary_storage,
+                                temporary_storage_bytes,
+                                d_keys_input1,
+                                d_keys_input2,
+                                d_keys_output,
+                                d_count,
+                                size1,
+                                size2,
+                                stream));
+
+        HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+
+        // Warm-up
+        for(size_t i = 0; i < warmup_size; i++)
+        {
+            HIP_CHECK(run_operation(d_temporary_storage,
+                                    temporary_storage_bytes,
+                                    d_keys_input1,
+                                    d_keys_input2,
+                                    d_keys_output,
+                                    d_count,
+                                    size1,
+                                    size2,
+                                    stream));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // HIP events creation
+        hipEvent_t start, stop;
+        HIP_CHECK(hipEventCreate(&start));
+        HIP_CHECK(hipEventCreate(&stop));
+
+        for(auto _ : state)
+        {
+            // Record start event
+            HIP_CHECK(hipEventRecord(start, stream));
+
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                HIP_CHECK(run_operation(d_temporary_storage,
+                                        temporary_storage_bytes,
+                                        d_keys_input1,
+                                        d_keys_input2,
+                                        d_keys_output,
+                                        d_count,
+                                        size1,
+                                        size2,
+                                        stream));
+            }
+
+            // Record stop event and wait until it completes
+            HIP_CHECK(hipEventRecord(stop, stream));
+            HIP_CHECK(hipEventSynchronize(stop));
+
+            float elapsed_mseconds;
+            HIP_CHECK(hipEventElapsedTime(&elapsed_mseconds, start, stop));
+            state.SetIterationTime(elapsed_mseconds / 1000);
+        }
+
+        // Destroy HIP events
+        HIP_CHECK(hipEventDestroy(start));
+        HIP_CHECK(hipEventDestroy(stop));
+
+        state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
+        state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+        HIP_CHECK(hipFree(d_temporary_storage));
+        HIP_CHECK(hipFree(d_keys_input1));
+        HIP_CHECK(hipFree(d_keys_input2));
+        HIP_CHECK(hipFree(d_keys_output));
+        HIP_CHECK(hipFree(d_count));
+    }
+};
+
+#endif // ROCPRIM_BENCHMARK_DEVICE_SET_OPERATIONS_HPP_
@@ -0,0 +1,253 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Throughput of rocprim::string_sort for realistic distributions of strings: short words,
+// URLs that share a long prefix, and log lines whose timestamps tie for many bytes.
+
+#include "benchmark_utils.hpp"
+// CmdParser
+#include "cmdparser.hpp"
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/device/device_string_sort.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+#ifndef DEFAULT_BYTES
+const size_t DEFAULT_BYTES = 1024 * 1024 * 32;
+#endif
+
+namespace
+{
+
+struct string_distribution
+{
+    const char*  name;
+    // Every string is the prefix, a number of random digits and a random number of lowercase
+    // letters.
+    const char*  prefix;
+    unsigned int digits;
+    unsigned int min_letters;
+    unsigned int max_letters;
+};
+
+struct device_string_sort_benchmark : public config_autotune_interface
+{
+    string_distribution distribution;
+
+    explicit device_string_sort_benchmark(const string_distribution distribution)
+        : distribution(distribution)
+    {}
+
+    std::string name() const override
+    {
+        return bench_naming::format_name("{lvl:device,algo:string_sort,strings:"
+                                         + std::string(distribution.name)
+                                         + ",cfg:default_config}");
+    }
+
+    static constexpr unsigned int batch_size  = 10;
+    static constexpr unsigned int warmup_size = 5;
+
+    void run(benchmark::State&   state,
+             size_t              bytes,
+             const managed_seed& seed,
+             hipStream_t         stream) const override
+    {
+        // The bytes are those of the characters
+        std::default_random_engine                  gen(seed.get_0());
+        std::uniform_int_distribution<unsigned int> digit_dis('0', '9');
+        std::uniform_int_distribution<unsigned int> letter_dis('a', 'z');
+        std::uniform_int_distribution<unsigned int> letters_dis(distribution.min_letters,
+                                                                distribution.max_letters);
+
+        const std::string   prefix(distribution.prefix);
+        std::vector<char>   chars;
+        std::vector<size_t> string_offsets(1, 0);
+        while(chars.size() < bytes)
+        {
+            chars.insert(chars.end(), prefix.begin(), prefix.end());
+            for(unsigned int i = 0; i < distribution.digits; i++)
+            {
+                chars.push_back(static_cast<char>(digit_dis(gen)));
+            }
+            for(unsigned int i = letters_dis(gen); i > 0; i--)
+            {
+                chars.push_back(static_cast<char>(letter_dis(gen)));
+            }
+            string_offsets.push_back(chars.size());
+        }
+        const size_t size = string_offsets.size() - 1;
+
+        char*         d_chars;
+        size_t*       d_string_offsets;
+        unsigned int* d_permutation;
+        HIP_CHECK(hipMalloc(&d_chars, chars.size()));
+        HIP_CHECK(hipMalloc(&d_string_offsets, string_offsets.size() * sizeof(size_t)));
+        HIP_CHECK(hipMalloc(&d_permutation, size * sizeof(unsigned int)));
+        HIP_CHECK(hipMemcpy(d_chars, chars.data(), chars.size(), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_string_offsets,
+                            string_offsets.data(),
+                            string_offsets.size() * sizeof(size_t),
+                            hipMemcpyHostToDevice));
+
+        size_t temp_storage_size_bytes;
+        HIP_CHECK(rocprim::string_sort(nullptr,
+                                       temp_storage_size_bytes,
+                                       d_chars,
+                                       d_string_offsets,
+                                       d_permutation,
+                                       size,
+                                       stream));
+        void* d_temp_storage;
+        HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_size_bytes));
+
+        auto dispatch = [&]()
+        {
+            HIP_CHECK(rocprim::string_sort(d_temp_storage,
+                                           temp_storage_size_bytes,
+                                           d_chars,
+                                           d_string_offsets,
+                                           d_permutation,
+                                           size,
+                                           stream));
+        };
+
+        // Warm-up
+        for(size_t i = 0; i < warmup_size; i++)
+        {
+            dispatch();
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // HIP events creation
+        hipEvent_t start, stop;
+        HIP_CHECK(hipEventCreate(&start));
+        HIP_CHECK(hipEventCreate(&stop));
+
+        for(auto _ : state)
+        {
+            // Record start event
+            HIP_CHECK(hipEventRecord(start, stream));
+
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                dispatch();
+            }
+
+            // Record stop event and wait until it completes
+            HIP_CHECK(hipEventRecord(stop, stream));
+            HIP_CHECK(hipEventSynchronize(stop));
+
+            float elapsed_mseconds;
+            HIP_CHECK(hipEventElapsedTime(&elapsed_mseconds, start, stop));
+            state.SetIterationTime(elapsed_mseconds / 1000);
+        }
+
+        // Destroy HIP events
+        HIP_CHECK(hipEventDestroy(start));
+        HIP_CHECK(hipEventDestroy(stop));
+
+        state.SetBytesProcessed(state.iterations() * batch_size * chars.size());
+        state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+        HIP_CHECK(hipFree(d_chars));
+        HIP_CHECK(hipFree(d_string_offsets));
+        HIP_CHECK(hipFree(d_permutation));
+        HIP_CHECK(hipFree(d_temp_storage));
+    }
+};
+
+} // namespace
+
+#define CREATE_BENCHMARK(NAME, PREFIX, DIGITS, MIN_LETTERS, MAX_LETTERS)          \
+    {                                                                             \
+        const device_string_sort_benchmark instance(                              \
+            string_distribution{NAME, PREFIX, DIGITS, MIN_LETTERS, MAX_LETTERS}); \
+        REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance);            \
+    }
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_BYTES, "number of bytes");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.set_optional<std::string>("name_format",
+                                     "name_format",
+                                     "human",
+                                     "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t bytes  = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+    bench_naming::set_format(parser.get<std::string>("name_format"));
+    const std::string  seed_type = parser.get<std::string>("seed");
+    const managed_seed seed(seed_type);
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("bytes", std::to_string(bytes));
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks{};
+    CREATE_BENCHMARK("words", "", 0, 2, 12)
+    CREATE_BENCHMARK("urls", "https://www.example.com/", 0, 8, 64)
+    CREATE_BENCHMARK("log_lines", "2026-10-14T12:", 6, 16, 96)
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -53,6 +53,15 @@ const size_t DEFAULT_BYTES = 1024 * 1024 * 128 * 4;
         REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance); \
     }
 
+#define CREATE_PREFETCH_BENCHMARK(T, BS, IPT, PREFETCH)                                       \
+    {                                                                                         \
+        const device_transform_benchmark<                                                     \
+            T,                                                                                \
+            rocprim::transform_config<BS, IPT, ROCPRIM_GRID_SIZE_LIMIT, PREFETCH>>            \
+            instance{};                                                                       \
+        REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance);                        \
+    }
+
 int main(int argc, char *argv[])
 {
     cli::Parser parser(argc, argv);
@@ -118,6 +127,13 @@ int main(int argc, char *argv[])
 
     CREATE_BENCHMARK(custom_float2)
     CREATE_BENCHMARK(custom_double2)
+
+    // Low occupancy configs, without and with the prefetch pipeline
+    CREATE_PREFETCH_BENCHMARK(int, 256, 32, 0)
+    CREATE_PREFETCH_BENCHMARK(int, 256, 32, 1)
+    CREATE_PREFETCH_BENCHMARK(int, 256, 32, 2)
+    CREATE_PREFETCH_BENCHMARK(double, 256, 16, 0)
+    CREATE_PREFETCH_BENCHMARK(double, 256, 16, 1)
 #endif // BENCHMARK_CONFIG_TUNING
 
     // Use manual timing
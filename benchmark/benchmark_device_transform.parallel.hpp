@@ -42,9 +42,11 @@
 template<typename Config>
 std::string transform_config_name()
 {
-    auto config = Config();
+    auto               config = Config();
+    const unsigned int prefetch_tiles = config.kernel_config.prefetch_tiles;
     return "{bs:" + std::to_string(config.block_size)
-           + ",ipt:" + std::to_string(config.items_per_thread) + "}";
+           + ",ipt:" + std::to_string(config.items_per_thread)
+           + (prefetch_tiles != 0 ? ",prefetch:" + std::to_string(prefetch_tiles) : "") + "}";
 }
 
 template<>
@@ -145,6 +147,7 @@ struct device_transform_benchmark : public config_autotune_interface
 
         state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
         state.SetItemsProcessed(state.iterations() * batch_size * size);
+        set_memory_traffic(state, 2.0 * state.iterations() * batch_size * size * sizeof(T));
 
         HIP_CHECK(hipFree(d_input));
         HIP_CHECK(hipFree(d_output));
@@ -0,0 +1,246 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Throughput of rocprim::work_queue draining irregular work: every item is the depth of a binary
+// tree, whose root pushes the two subtrees of a depth less. The depths of the trees are random,
+// so the work of the initial items differs by up to 2^max_depth.
+
+#include "benchmark_utils.hpp"
+// CmdParser
+#include "cmdparser.hpp"
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/device/tile_scheduler.hpp>
+#include <rocprim/device/work_queue.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+#ifndef DEFAULT_BYTES
+const size_t DEFAULT_BYTES = 1024 * 1024 * 4;
+#endif
+
+namespace
+{
+
+constexpr unsigned int queue_block_size = 256;
+
+__global__ __launch_bounds__(queue_block_size) void expand_trees_kernel(
+    rocprim::work_queue<unsigned int> queue)
+{
+    unsigned int               depth;
+    rocprim::work_queue_status status;
+    while((status = queue.pop(depth)) != rocprim::work_queue_status::drained)
+    {
+        if(status == rocprim::work_queue_status::success)
+        {
+            const bool split = depth > 0;
+            queue.push(depth - 1, split);
+            queue.push(depth - 1, split);
+            queue.complete();
+        }
+    }
+}
+
+struct device_work_queue_benchmark : public config_autotune_interface
+{
+    unsigned int max_depth;
+
+    explicit device_work_queue_benchmark(const unsigned int max_depth) : max_depth(max_depth) {}
+
+    std::string name() const override
+    {
+        return bench_naming::format_name("{lvl:device,algo:work_queue,subalgo:expand_trees"
+                                         ",max_depth:"
+                                         + std::to_string(max_depth) + ",cfg:default_config}");
+    }
+
+    static constexpr unsigned int batch_size  = 10;
+    static constexpr unsigned int warmup_size = 5;
+
+    void run(benchmark::State&   state,
+             size_t              bytes,
+             const managed_seed& seed,
+             hipStream_t         stream) const override
+    {
+        // The bytes are those of the items processed, the number of roots follows from the
+        // average size of the trees
+        const std::vector<unsigned int> depths
+            = get_random_data<unsigned int>(1024, 0, max_depth, seed.get_0());
+        size_t sampled_items = 0;
+        for(const unsigned int depth : depths)
+        {
+            sampled_items += (size_t(2) << depth) - 1;
+        }
+        const size_t roots
+            = std::max<size_t>(1, bytes / sizeof(unsigned int) * depths.size() / sampled_items);
+
+        const std::vector<unsigned int> input
+            = get_random_data<unsigned int>(roots, 0, max_depth, seed.get_0());
+        size_t items = 0;
+        for(const unsigned int depth : input)
+        {
+            items += (size_t(2) << depth) - 1;
+        }
+        const unsigned int capacity = static_cast<unsigned int>(items);
+
+        unsigned int* d_input;
+        HIP_CHECK(hipMalloc(&d_input, roots * sizeof(*d_input)));
+        HIP_CHECK(
+            hipMemcpy(d_input, input.data(), roots * sizeof(*d_input), hipMemcpyHostToDevice));
+
+        using queue_type = rocprim::work_queue<unsigned int>;
+        size_t storage_size;
+        HIP_CHECK(queue_type::get_temp_storage_size(capacity, storage_size));
+        void* d_storage;
+        HIP_CHECK(hipMalloc(&d_storage, storage_size));
+        queue_type queue;
+        HIP_CHECK(queue_type::create(queue, d_storage, storage_size, capacity));
+
+        unsigned int grid_size;
+        HIP_CHECK(rocprim::get_persistent_grid_size(expand_trees_kernel,
+                                                    queue_block_size,
+                                                    stream,
+                                                    grid_size));
+
+        auto dispatch = [&]()
+        {
+            HIP_CHECK(queue.initialize(d_input, static_cast<unsigned int>(roots), stream));
+            expand_trees_kernel<<<grid_size, queue_block_size, 0, stream>>>(queue);
+            HIP_CHECK(hipGetLastError());
+        };
+
+        // Warm-up
+        for(size_t i = 0; i < warmup_size; i++)
+        {
+            dispatch();
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // HIP events creation
+        hipEvent_t start, stop;
+        HIP_CHECK(hipEventCreate(&start));
+        HIP_CHECK(hipEventCreate(&stop));
+
+        for(auto _ : state)
+        {
+            // Record start event
+            HIP_CHECK(hipEventRecord(start, stream));
+
+            for(size_t i = 0; i < batch_size; i++)
+            {
+                dispatch();
+            }
+
+            // Record stop event and wait until it completes
+            HIP_CHECK(hipEventRecord(stop, stream));
+            HIP_CHECK(hipEventSynchronize(stop));
+
+            float elapsed_mseconds;
+            HIP_CHECK(hipEventElapsedTime(&elapsed_mseconds, start, stop));
+            state.SetIterationTime(elapsed_mseconds / 1000);
+        }
+
+        // Destroy HIP events
+        HIP_CHECK(hipEventDestroy(start));
+        HIP_CHECK(hipEventDestroy(stop));
+
+        state.SetBytesProcessed(state.iterations() * batch_size * items * sizeof(unsigned int));
+        state.SetItemsProcessed(state.iterations() * batch_size * items);
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_storage));
+    }
+};
+
+} // namespace
+
+#define CREATE_BENCHMARK(MAX_DEPTH)                                    \
+    {                                                                  \
+        const device_work_queue_benchmark instance(MAX_DEPTH);         \
+        REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance); \
+    }
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_BYTES, "number of bytes");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.set_optional<std::string>("name_format",
+                                     "name_format",
+                                     "human",
+                                     "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t bytes  = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+    bench_naming::set_format(parser.get<std::string>("name_format"));
+    const std::string  seed_type = parser.get<std::string>("seed");
+    const managed_seed seed(seed_type);
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("bytes", std::to_string(bytes));
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks{};
+    CREATE_BENCHMARK(0)
+    CREATE_BENCHMARK(4)
+    CREATE_BENCHMARK(12)
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -0,0 +1,534 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Cost of the fancy iterators of rocPRIM compared with raw pointers as the input of device
+// algorithms. Fancy iterators are not loaded with vectorized loads, and transform, zip and
+// arg_index iterators also add the work of their functor. The input iterators give the items of the
+// same input array (in reverse for the reverse iterator), so the throughputs of an algorithm are
+// directly comparable. The counting iterator does not load from memory at all, its throughput is
+// the bound of an algorithm without input traffic.
+
+#include "benchmark_utils.hpp"
+// CmdParser
+#include "cmdparser.hpp"
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/iterator/arg_index_iterator.hpp>
+#include <rocprim/iterator/counting_iterator.hpp>
+#include <rocprim/iterator/reverse_iterator.hpp>
+#include <rocprim/iterator/texture_cache_iterator.hpp>
+#include <rocprim/iterator/transform_iterator.hpp>
+#include <rocprim/iterator/zip_iterator.hpp>
+#include <rocprim/types/tuple.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+#ifndef DEFAULT_BYTES
+const size_t DEFAULT_BYTES = 1024 * 1024 * 128;
+#endif
+
+namespace
+{
+
+const unsigned int batch_size  = 10;
+const unsigned int warmup_size = 5;
+
+template<class T>
+struct identity_op
+{
+    ROCPRIM_HOST_DEVICE
+    T operator()(const T value) const
+    {
+        return value;
+    }
+};
+
+template<class T>
+struct first_element_op
+{
+    ROCPRIM_HOST_DEVICE
+    T operator()(const rocprim::tuple<T>& value) const
+    {
+        return rocprim::get<0>(value);
+    }
+};
+
+template<class T>
+struct arg_index_value_op
+{
+    ROCPRIM_HOST_DEVICE
+    T operator()(const rocprim::key_value_pair<std::ptrdiff_t, T>& value) const
+    {
+        return value.value;
+    }
+};
+
+// The input iterators. Each one is created from the input array before the timed runs and gives
+// its items, or the items 0, 1, 2, ... of the counting iterator.
+
+template<class T>
+struct pointer_input
+{
+    static const char* name()
+    {
+        return "pointer";
+    }
+
+    pointer_input(T* d_input, size_t /*size*/) : d_input(d_input) {}
+
+    bool valid() const
+    {
+        return true;
+    }
+
+    T* get() const
+    {
+        return d_input;
+    }
+
+    T* d_input;
+};
+
+template<class T>
+struct transform_input : pointer_input<T>
+{
+    static const char* name()
+    {
+        return "transform_iterator";
+    }
+
+    using pointer_input<T>::pointer_input;
+
+    auto get() const
+    {
+        return rocprim::make_transform_iterator(this->d_input, identity_op<T>());
+    }
+};
+
+template<class T>
+struct zip_input : pointer_input<T>
+{
+    static const char* name()
+    {
+        return "zip_iterator";
+    }
+
+    using pointer_input<T>::pointer_input;
+
+    auto get() const
+    {
+        return rocprim::make_transform_iterator(
+            rocprim::make_zip_iterator(rocprim::make_tuple(this->d_input)),
+            first_element_op<T>());
+    }
+};
+
+template<class T>
+struct counting_input : pointer_input<T>
+{
+    static const char* name()
+    {
+        return "counting_iterator";
+    }
+
+    using pointer_input<T>::pointer_input;
+
+    auto get() const
+    {
+        return rocprim::make_counting_iterator(T(0));
+    }
+};
+
+template<class T>
+struct reverse_input
+{
+    static const char* name()
+    {
+        return "reverse_iterator";
+    }
+
+    reverse_input(T* d_input, size_t size) : d_input(d_input), size(size) {}
+
+    bool valid() const
+    {
+        return true;
+    }
+
+    auto get() const
+    {
+        return rocprim::make_reverse_iterator(d_input + size);
+    }
+
+    T*     d_input;
+    size_t size;
+};
+
+template<class T>
+struct arg_index_input : pointer_input<T>
+{
+    static const char* name()
+    {
+        return "arg_index_iterator";
+    }
+
+    using pointer_input<T>::pointer_input;
+
+    auto get() const
+    {
+        return rocprim::make_transform_iterator(rocprim::make_arg_index_iterator(this->d_input),
+                                                arg_index_value_op<T>());
+    }
+};
+
+// Textures are not supported on all devices (e.g. gfx94x), the benchmark is skipped there
+template<class T>
+struct texture_cache_input
+{
+    static const char* name()
+    {
+        return "texture_cache_iterator";
+    }
+
+    texture_cache_input(T* d_input, size_t size)
+    {
+        bound = iterator.bind_texture(d_input, size * sizeof(T)) == hipSuccess;
+    }
+
+    ~texture_cache_input()
+    {
+        if(bound)
+        {
+            HIP_CHECK(iterator.unbind_texture());
+        }
+    }
+
+    texture_cache_input(const texture_cache_input&)            = delete;
+    texture_cache_input& operator=(const texture_cache_input&) = delete;
+
+    bool valid() const
+    {
+        return bound;
+    }
+
+    rocprim::texture_cache_iterator<T> get() const
+    {
+        return iterator;
+    }
+
+    rocprim::texture_cache_iterator<T> iterator;
+    bool                               bound = false;
+};
+
+// The algorithms, called with any input iterator
+
+struct reduce_algorithm
+{
+    static const char* name()
+    {
+        return "reduce";
+    }
+
+    template<class Iterator, class T>
+    static hipError_t run(void*             storage,
+                          size_t&           bytes,
+                          Iterator          input,
+                          T*                output,
+                          const size_t      size,
+                          const hipStream_t stream)
+    {
+        return rocprim::reduce(storage,
+                               bytes,
+                               input,
+                               output,
+                               T(0),
+                               size,
+                               rocprim::plus<T>(),
+                               stream);
+    }
+};
+
+struct inclusive_scan_algorithm
+{
+    static const char* name()
+    {
+        return "inclusive_scan";
+    }
+
+    template<class Iterator, class T>
+    static hipError_t run(void*             storage,
+                          size_t&           bytes,
+                          Iterator          input,
+                          T*                output,
+                          const size_t      size,
+                          const hipStream_t stream)
+    {
+        return rocprim::inclusive_scan(storage,
+                                       bytes,
+                                       input,
+                                       output,
+                                       size,
+                                       rocprim::plus<T>(),
+                                       stream);
+    }
+};
+
+struct transform_algorithm
+{
+    static const char* name()
+    {
+        return "transform";
+    }
+
+    template<class Iterator, class T>
+    static hipError_t run(void*             storage,
+                          size_t&           bytes,
+                          Iterator          input,
+                          T*                output,
+                          const size_t      size,
+                          const hipStream_t stream)
+    {
+        // transform needs no temporary storage
+        if(storage == nullptr)
+        {
+            bytes = 0;
+            return hipSuccess;
+        }
+        return rocprim::transform(input, output, size, identity_op<T>(), stream);
+    }
+};
+
+struct radix_sort_keys_algorithm
+{
+    static const char* name()
+    {
+        return "radix_sort_keys";
+    }
+
+    template<class Iterator, class T>
+    static hipError_t run(void*             storage,
+                          size_t&           bytes,
+                          Iterator          input,
+                          T*                output,
+                          const size_t      size,
+                          const hipStream_t stream)
+    {
+        return rocprim::radix_sort_keys(storage,
+                                        bytes,
+                                        input,
+                                        output,
+                                        size,
+                                        0,
+                                        8 * sizeof(T),
+                                        stream);
+    }
+};
+
+template<class Algorithm, template<class> class Input, class T>
+struct device_iterator_benchmark : public config_autotune_interface
+{
+    std::string name() const override
+    {
+        return bench_naming::format_name("{lvl:device,algo:iterator,subalgo:"
+                                         + std::string(Algorithm::name())
+                                         + ",iterator:" + Input<T>::name()
+                                         + ",value_type:" + Traits<T>::name()
+                                         + ",cfg:default_config}");
+    }
+
+    void run(benchmark::State&   state,
+             size_t              bytes,
+             const managed_seed& seed,
+             hipStream_t         stream) const override
+    {
+        const size_t size = bytes / sizeof(T);
+
+        const auto           random_range = limit_random_range<T>(0, 1000);
+        const std::vector<T> input
+            = get_random_data<T>(size, random_range.first, random_range.second, seed.get_0());
+        T* d_input;
+        T* d_output;
+        HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+        HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        {
+            const Input<T> input_iterator(d_input, size);
+            if(!input_iterator.valid())
+            {
+                state.SkipWithError("the iterator is not supported on this device");
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_output));
+                return;
+            }
+
+            const auto call = [&](void* storage, size_t& storage_bytes)
+            {
+                HIP_CHECK(Algorithm::run(storage,
+                                         storage_bytes,
+                                         input_iterator.get(),
+                                         d_output,
+                                         size,
+                                         stream));
+            };
+
+            size_t temporary_storage_bytes = 0;
+            call(nullptr, temporary_storage_bytes);
+            void* d_temporary_storage;
+            HIP_CHECK(
+                hipMalloc(&d_temporary_storage, std::max<size_t>(temporary_storage_bytes, 1)));
+
+            // Warm-up
+            for(size_t i = 0; i < warmup_size; i++)
+            {
+                call(d_temporary_storage, temporary_storage_bytes);
+            }
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // HIP events creation
+            hipEvent_t start, stop;
+            HIP_CHECK(hipEventCreate(&start));
+            HIP_CHECK(hipEventCreate(&stop));
+
+            for(auto _ : state)
+            {
+                // Record start event
+                HIP_CHECK(hipEventRecord(start, stream));
+
+                for(size_t i = 0; i < batch_size; i++)
+                {
+                    call(d_temporary_storage, temporary_storage_bytes);
+                }
+
+                // Record stop event and wait until it completes
+                HIP_CHECK(hipEventRecord(stop, stream));
+                HIP_CHECK(hipEventSynchronize(stop));
+
+                float elapsed_mseconds;
+                HIP_CHECK(hipEventElapsedTime(&elapsed_mseconds, start, stop));
+                state.SetIterationTime(elapsed_mseconds / 1000);
+            }
+
+            // Destroy HIP events
+            HIP_CHECK(hipEventDestroy(start));
+            HIP_CHECK(hipEventDestroy(stop));
+
+            state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+            state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+        }
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+    }
+};
+
+} // namespace
+
+#define CREATE_BENCHMARK(ALGORITHM, INPUT, T)                                   \
+    {                                                                           \
+        const device_iterator_benchmark<ALGORITHM, INPUT, T> instance;          \
+        REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance);          \
+    }
+
+#define CREATE_ITERATOR_BENCHMARKS(ALGORITHM, T)               \
+    CREATE_BENCHMARK(ALGORITHM, pointer_input, T)              \
+    CREATE_BENCHMARK(ALGORITHM, transform_input, T)            \
+    CREATE_BENCHMARK(ALGORITHM, zip_input, T)                  \
+    CREATE_BENCHMARK(ALGORITHM, counting_input, T)             \
+    CREATE_BENCHMARK(ALGORITHM, reverse_input, T)              \
+    CREATE_BENCHMARK(ALGORITHM, arg_index_input, T)            \
+    CREATE_BENCHMARK(ALGORITHM, texture_cache_input, T)
+
+#define CREATE_TYPED_BENCHMARKS(T)                                  \
+    CREATE_ITERATOR_BENCHMARKS(reduce_algorithm, T)                 \
+    CREATE_ITERATOR_BENCHMARKS(inclusive_scan_algorithm, T)         \
+    CREATE_ITERATOR_BENCHMARKS(transform_algorithm, T)              \
+    CREATE_ITERATOR_BENCHMARKS(radix_sort_keys_algorithm, T)
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_BYTES, "number of bytes");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.set_optional<std::string>("name_format",
+                                     "name_format",
+                                     "human",
+                                     "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t bytes  = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+    bench_naming::set_format(parser.get<std::string>("name_format"));
+    const std::string  seed_type = parser.get<std::string>("seed");
+    const managed_seed seed(seed_type);
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("bytes", std::to_string(bytes));
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks{};
+    CREATE_TYPED_BENCHMARKS(int)
+    CREATE_TYPED_BENCHMARKS(int64_t)
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
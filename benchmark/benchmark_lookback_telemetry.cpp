@@ -0,0 +1,325 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Reports how long the tiles of the look-back scans of inclusive_scan and the onesweep radix sort
+// wait for their predecessors, next to the time of the algorithms.
+#define ROCPRIM_DETAIL_LOOKBACK_TELEMETRY 1
+
+#include "benchmark_utils.hpp"
+// CmdParser
+#include "cmdparser.hpp"
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// HIP API
+#include <hip/hip_runtime.h>
+
+// rocPRIM
+#include <rocprim/device/detail/lookback_telemetry.hpp>
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_scan.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+#ifndef DEFAULT_BYTES
+const size_t DEFAULT_BYTES = 1024 * 1024 * 32 * 4;
+#endif
+
+namespace
+{
+
+// Items per tile of the smallest configs, an upper bound of the number of tiles.
+constexpr size_t min_items_per_tile = 128;
+
+using telemetry_record = rocprim::detail::lookback_telemetry_record;
+
+// Runs the algorithm once more with telemetry enabled and adds the statistics of the tiles
+// to the counters of the benchmark.
+template<class Run>
+void report_lookback_telemetry(benchmark::State& state,
+                               const size_t      size,
+                               hipStream_t       stream,
+                               Run               run)
+{
+    const unsigned int capacity = static_cast<unsigned int>(size / min_items_per_tile + 1);
+
+    telemetry_record* d_records;
+    HIP_CHECK(hipMalloc(&d_records, capacity * sizeof(*d_records)));
+    HIP_CHECK(hipMemsetAsync(d_records, 0, capacity * sizeof(*d_records), stream));
+
+    rocprim::detail::set_lookback_telemetry_buffer(d_records, capacity);
+    run();
+    rocprim::detail::set_lookback_telemetry_buffer(nullptr, 0);
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    std::vector<telemetry_record> records(capacity);
+    HIP_CHECK(hipMemcpy(records.data(),
+                        d_records,
+                        capacity * sizeof(*d_records),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(d_records));
+
+    // Every tile but the first looks back over at least one tile
+    size_t tiles = 1;
+    for(size_t i = 0; i < records.size(); ++i)
+    {
+        if(records[i].lookback_distance != 0)
+        {
+            tiles = i + 1;
+        }
+    }
+
+    double       spins_sum    = 0;
+    double       distance_sum = 0;
+    unsigned int spins_max    = 0;
+    unsigned int distance_max = 0;
+    for(size_t i = 0; i < tiles; ++i)
+    {
+        spins_sum += records[i].wait_spins;
+        distance_sum += records[i].lookback_distance;
+        spins_max    = std::max(spins_max, records[i].wait_spins);
+        distance_max = std::max(distance_max, records[i].lookback_distance);
+    }
+
+    state.counters["tiles"]              = static_cast<double>(tiles);
+    state.counters["wait_spins_mean"]    = spins_sum / tiles;
+    state.counters["wait_spins_max"]     = spins_max;
+    state.counters["lookback_dist_mean"] = distance_sum / tiles;
+    state.counters["lookback_dist_max"]  = distance_max;
+}
+
+template<class Run>
+void time_benchmark(benchmark::State& state, hipStream_t stream, Run run)
+{
+    constexpr unsigned int warmup_size = 5;
+    for(unsigned int i = 0; i < warmup_size; ++i)
+    {
+        run();
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        run();
+        HIP_CHECK(hipStreamSynchronize(stream));
+        const auto end = std::chrono::high_resolution_clock::now();
+        state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+}
+
+template<class T>
+struct lookback_telemetry_scan_benchmark : public config_autotune_interface
+{
+    std::string name() const override
+    {
+        return bench_naming::format_name("{lvl:device,algo:lookback_telemetry,subalgo:scan,"
+                                         "value_type:"
+                                         + std::string(Traits<T>::name())
+                                         + ",cfg:default_config}");
+    }
+
+    void run(benchmark::State&   state,
+             size_t              bytes,
+             const managed_seed& seed,
+             hipStream_t         stream) const override
+    {
+        const size_t         size  = bytes / sizeof(T);
+        const std::vector<T> input = get_random_data<T>(size, T(0), T(100), seed.get_0());
+
+        T* d_input;
+        T* d_output;
+        HIP_CHECK(hipMalloc(&d_input, size * sizeof(*d_input)));
+        HIP_CHECK(hipMalloc(&d_output, size * sizeof(*d_output)));
+        HIP_CHECK(
+            hipMemcpy(d_input, input.data(), size * sizeof(*d_input), hipMemcpyHostToDevice));
+
+        size_t storage_bytes;
+        HIP_CHECK(rocprim::inclusive_scan(nullptr,
+                                          storage_bytes,
+                                          d_input,
+                                          d_output,
+                                          size,
+                                          rocprim::plus<T>(),
+                                          stream));
+        void* d_storage;
+        HIP_CHECK(hipMalloc(&d_storage, storage_bytes));
+
+        const auto scan = [&]
+        {
+            HIP_CHECK(rocprim::inclusive_scan(d_storage,
+                                              storage_bytes,
+                                              d_input,
+                                              d_output,
+                                              size,
+                                              rocprim::plus<T>(),
+                                              stream));
+        };
+        time_benchmark(state, stream, scan);
+        report_lookback_telemetry(state, size, stream, scan);
+
+        state.SetBytesProcessed(state.iterations() * size * sizeof(T));
+        state.SetItemsProcessed(state.iterations() * size);
+
+        HIP_CHECK(hipFree(d_storage));
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+    }
+};
+
+template<class Key>
+struct lookback_telemetry_radix_sort_benchmark : public config_autotune_interface
+{
+    std::string name() const override
+    {
+        return bench_naming::format_name("{lvl:device,algo:lookback_telemetry,subalgo:radix_sort,"
+                                         "key_type:"
+                                         + std::string(Traits<Key>::name())
+                                         + ",cfg:default_config}");
+    }
+
+    void run(benchmark::State&   state,
+             size_t              bytes,
+             const managed_seed& seed,
+             hipStream_t         stream) const override
+    {
+        const size_t           size = bytes / sizeof(Key);
+        const std::vector<Key> keys_input
+            = get_random_data<Key>(size,
+                                   generate_limits<Key>::min(),
+                                   generate_limits<Key>::max(),
+                                   seed.get_0());
+
+        Key* d_keys_input;
+        Key* d_keys_output;
+        HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(*d_keys_input)));
+        HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(*d_keys_output)));
+        HIP_CHECK(hipMemcpy(d_keys_input,
+                            keys_input.data(),
+                            size * sizeof(*d_keys_input),
+                            hipMemcpyHostToDevice));
+
+        size_t storage_bytes;
+        HIP_CHECK(rocprim::radix_sort_keys(nullptr,
+                                           storage_bytes,
+                                           d_keys_input,
+                                           d_keys_output,
+                                           size,
+                                           0,
+                                           sizeof(Key) * 8,
+                                           stream));
+        void* d_storage;
+        HIP_CHECK(hipMalloc(&d_storage, storage_bytes));
+
+        const auto sort = [&]
+        {
+            HIP_CHECK(rocprim::radix_sort_keys(d_storage,
+                                               storage_bytes,
+                                               d_keys_input,
+                                               d_keys_output,
+                                               size,
+                                               0,
+                                               sizeof(Key) * 8,
+                                               stream));
+        };
+        time_benchmark(state, stream, sort);
+        // The records accumulate over the passes of all digit places
+        report_lookback_telemetry(state, size, stream, sort);
+
+        state.SetBytesProcessed(state.iterations() * size * sizeof(Key));
+        state.SetItemsProcessed(state.iterations() * size);
+
+        HIP_CHECK(hipFree(d_storage));
+        HIP_CHECK(hipFree(d_keys_input));
+        HIP_CHECK(hipFree(d_keys_output));
+    }
+};
+
+} // namespace
+
+#define CREATE_BENCHMARK(BENCHMARK, T)                                 \
+    {                                                                  \
+        const BENCHMARK<T> instance;                                   \
+        REGISTER_BENCHMARK(benchmarks, bytes, seed, stream, instance); \
+    }
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_BYTES, "number of bytes");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.set_optional<std::string>("name_format",
+                                     "name_format",
+                                     "human",
+                                     "either: json,human,txt");
+    parser.set_optional<std::string>("seed", "seed", "random", get_seed_message());
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t bytes  = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+    bench_naming::set_format(parser.get<std::string>("name_format"));
+    const std::string  seed_type = parser.get<std::string>("seed");
+    const managed_seed seed(seed_type);
+
+    // HIP
+    hipStream_t stream = 0; // default
+
+    // Benchmark info
+    add_common_benchmark_info();
+    benchmark::AddCustomContext("bytes", std::to_string(bytes));
+    benchmark::AddCustomContext("seed", seed_type);
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks{};
+    CREATE_BENCHMARK(lookback_telemetry_scan_benchmark, int)
+    CREATE_BENCHMARK(lookback_telemetry_scan_benchmark, double)
+    CREATE_BENCHMARK(lookback_telemetry_radix_sort_benchmark, int)
+    CREATE_BENCHMARK(lookback_telemetry_radix_sort_benchmark, long long)
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
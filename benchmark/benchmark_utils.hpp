@@ -27,9 +27,13 @@
 #include <rocprim/block/block_scan.hpp>
 #include <rocprim/device/config_types.hpp>
 #include <rocprim/device/detail/device_config_helper.hpp> // partition_config_params
+#include <rocprim/device/execution_budget.hpp>
 #include <rocprim/types.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
 #include <iostream>
 #include <iterator>
 #include <memory>
@@ -42,6 +46,13 @@
 #include <utility>
 #include <vector>
 
+#ifdef ROCPRIM_BENCHMARK_ENERGY
+    #include <rocm_smi/rocm_smi.h>
+
+    #include <atomic>
+    #include <thread>
+#endif
+
 #define HIP_CHECK(condition)                                                                \
     {                                                                                       \
         hipError_t error = condition;                                                       \
@@ -435,6 +446,558 @@ inline std::vector<T> get_random_data(
     return data;
 }
 
+inline const char* get_distribution_message()
+{
+    return "distribution of the input keys, one of: uniform, zipf[:s] (exponent s, default 1), "
+           "sorted[:k] (k% of the items swapped, default 0), reverse, few_unique[:n] (n distinct "
+           "values, default 1024), entropy[:n] (AND of n random values, default 2)";
+}
+
+/// \brief Distribution of the keys generated by get_distributed_data().
+///
+/// It is selected with the "distribution" option of sort, select, histogram and run-length
+/// encode benchmarks. Like the name format it is set once in main().
+struct bench_distribution
+{
+    enum kind
+    {
+        uniform,
+        zipf,
+        sorted,
+        reverse,
+        few_unique,
+        entropy
+    };
+
+    kind type = uniform;
+    // Exponent of zipf
+    double zipf_s = 1.0;
+    // Percentage of the items of sorted that are swapped with random items
+    double perturbation = 0.0;
+    // Number of distinct values of few_unique
+    size_t unique = 1024;
+    // Number of random values ANDed together by entropy
+    unsigned int and_count = 2;
+
+    static bench_distribution& get()
+    {
+        static bench_distribution storage;
+        return storage;
+    }
+
+    static void set(const std::string& argument)
+    {
+        const size_t       colon     = argument.find(':');
+        const std::string  name      = argument.substr(0, colon);
+        const bool         has_param = colon != std::string::npos;
+        const std::string  param     = has_param ? argument.substr(colon + 1) : "";
+        bench_distribution result;
+        if(name == "uniform")
+        {
+            result.type = uniform;
+        }
+        else if(name == "zipf")
+        {
+            result.type   = zipf;
+            result.zipf_s = has_param ? std::stod(param) : result.zipf_s;
+        }
+        else if(name == "sorted")
+        {
+            result.type         = sorted;
+            result.perturbation = has_param ? std::stod(param) : result.perturbation;
+        }
+        else if(name == "reverse")
+        {
+            result.type = reverse;
+        }
+        else if(name == "few_unique")
+        {
+            result.type   = few_unique;
+            result.unique = has_param ? std::stoul(param) : result.unique;
+        }
+        else if(name == "entropy")
+        {
+            result.type      = entropy;
+            result.and_count = has_param ? std::stoul(param) : result.and_count;
+        }
+        else
+        {
+            std::cout << "Unknown distribution: " << argument << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        get() = result;
+    }
+
+    std::string name() const
+    {
+        switch(type)
+        {
+            case zipf: return "zipf:" + std::to_string(zipf_s);
+            case sorted: return "sorted:" + std::to_string(perturbation);
+            case reverse: return "reverse";
+            case few_unique: return "few_unique:" + std::to_string(unique);
+            case entropy: return "entropy:" + std::to_string(and_count);
+            default: return "uniform";
+        }
+    }
+};
+
+namespace detail
+{
+
+// The distributions other than uniform are generated for integral types of up to 64 bits and
+// for float and double, computing in the offsets from min in an unsigned type.
+template<class T>
+using distribution_offset_t
+    = std::conditional_t<std::is_floating_point<T>::value, double, unsigned long long>;
+
+template<class T>
+using is_distribution_supported
+    = std::integral_constant<bool,
+                             (rocprim::is_integral<T>::value && sizeof(T) <= 8)
+                                 || std::is_same<T, float>::value
+                                 || std::is_same<T, double>::value>;
+
+template<class T>
+inline distribution_offset_t<T> distribution_range(const T min, const T max)
+{
+    return static_cast<distribution_offset_t<T>>(max) - static_cast<distribution_offset_t<T>>(min);
+}
+
+template<class T>
+inline T distribution_value(const T min, const distribution_offset_t<T> offset)
+{
+    return static_cast<T>(static_cast<distribution_offset_t<T>>(min) + offset);
+}
+
+// Zipf ranks over a power-of-two number of values spread evenly over [min, max]. The ranks are
+// scattered by an odd multiplier, so the most frequent values are not all the smallest ones.
+template<class T>
+inline void generate_zipf_data(std::vector<T>& data,
+                               const T         min,
+                               const T         max,
+                               const double    s,
+                               engine_type&    gen,
+                               const size_t    max_random_size)
+{
+    const auto   range  = distribution_range(min, max);
+    unsigned int values = 1u << 20;
+    while(values > 1 && std::is_integral<decltype(range)>::value && range < values - 1)
+    {
+        values >>= 1;
+    }
+    std::discrete_distribution<unsigned int> ranks(values,
+                                                   0.5,
+                                                   values + 0.5,
+                                                   [s](double x) { return std::pow(x, -s); });
+    const auto step = range / (values > 1 ? values - 1 : 1);
+    std::generate_n(data.begin(),
+                    std::min(data.size(), max_random_size),
+                    [&]()
+                    {
+                        const unsigned int value = (ranks(gen) * 0x9E3779B1u) & (values - 1);
+                        return distribution_value(
+                            min,
+                            static_cast<distribution_offset_t<T>>(value) * step);
+                    });
+}
+
+// Reduces the entropy of the bits by ANDing random values
+// ("An Improved Supercomputer Sorting Benchmark", 1992, Kurt Thearling & Stephen Smith).
+template<class T>
+inline auto generate_entropy_data(std::vector<T>&    data,
+                                  const T            min,
+                                  const T            max,
+                                  const unsigned int and_count,
+                                  engine_type&       gen,
+                                  const size_t       max_random_size)
+    -> std::enable_if_t<rocprim::is_integral<T>::value>
+{
+    const unsigned long long range = distribution_range(min, max);
+    std::uniform_int_distribution<unsigned long long> bits;
+    std::generate_n(data.begin(),
+                    std::min(data.size(), max_random_size),
+                    [&]()
+                    {
+                        unsigned long long v = bits(gen);
+                        for(unsigned int i = 1; i < and_count; i++)
+                        {
+                            v &= bits(gen);
+                        }
+                        return distribution_value(min, range == ~0ull ? v : v % (range + 1));
+                    });
+}
+
+template<class T>
+inline auto generate_entropy_data(std::vector<T>&    data,
+                                  const T            min,
+                                  const T            max,
+                                  const unsigned int and_count,
+                                  engine_type&       gen,
+                                  const size_t       max_random_size)
+    -> std::enable_if_t<!rocprim::is_integral<T>::value>
+{
+    // The bits of floating-point values are not reduced, the offsets from min are
+    std::uniform_real_distribution<double> offsets(0.0, 1.0);
+    const double                           range = distribution_range(min, max);
+    std::generate_n(data.begin(),
+                    std::min(data.size(), max_random_size),
+                    [&]()
+                    {
+                        double v = offsets(gen);
+                        for(unsigned int i = 1; i < and_count; i++)
+                        {
+                            v *= offsets(gen);
+                        }
+                        return distribution_value(min, v * range);
+                    });
+}
+
+template<class T, class U, class V>
+inline auto get_distributed_data(const bench_distribution& distribution,
+                                 size_t                    size,
+                                 U                         min,
+                                 V                         max,
+                                 unsigned int              seed,
+                                 size_t                    max_random_size)
+    -> std::enable_if_t<is_distribution_supported<T>::value, std::vector<T>>
+{
+    engine_type gen(seed);
+    switch(distribution.type)
+    {
+        case bench_distribution::sorted:
+        case bench_distribution::reverse:
+        {
+            // All items are generated, so that the whole input is sorted
+            std::vector<T> data = get_random_data<T>(size, min, max, seed, size);
+            std::sort(data.begin(), data.end());
+            if(distribution.type == bench_distribution::reverse)
+            {
+                std::reverse(data.begin(), data.end());
+            }
+            else if(size > 0)
+            {
+                const size_t swaps = static_cast<size_t>(size * distribution.perturbation / 100);
+                std::uniform_int_distribution<size_t> index(0, size - 1);
+                for(size_t i = 0; i < swaps; i++)
+                {
+                    std::swap(data[index(gen)], data[index(gen)]);
+                }
+            }
+            return data;
+        }
+        case bench_distribution::few_unique:
+        {
+            const std::vector<T> values
+                = get_random_data<T>(std::max<size_t>(distribution.unique, 1), min, max, seed);
+            std::uniform_int_distribution<size_t> index(0, values.size() - 1);
+            std::vector<T>                        data(size);
+            std::generate_n(data.begin(),
+                            std::min(size, max_random_size),
+                            [&]() { return values[index(gen)]; });
+            for(size_t i = max_random_size; i < size; i += max_random_size)
+            {
+                std::copy_n(data.begin(), std::min(size - i, max_random_size), data.begin() + i);
+            }
+            return data;
+        }
+        case bench_distribution::zipf:
+        case bench_distribution::entropy:
+        {
+            std::vector<T> data(size);
+            if(distribution.type == bench_distribution::zipf)
+            {
+                generate_zipf_data(data, T(min), T(max), distribution.zipf_s, gen, max_random_size);
+            }
+            else
+            {
+                generate_entropy_data(data,
+                                      T(min),
+                                      T(max),
+                                      distribution.and_count,
+                                      gen,
+                                      max_random_size);
+            }
+            for(size_t i = max_random_size; i < size; i += max_random_size)
+            {
+                std::copy_n(data.begin(), std::min(size - i, max_random_size), data.begin() + i);
+            }
+            return data;
+        }
+        default: return get_random_data<T>(size, min, max, seed, max_random_size);
+    }
+}
+
+template<class T, class U, class V>
+inline auto get_distributed_data(const bench_distribution& /*distribution*/,
+                                 size_t       size,
+                                 U            min,
+                                 V            max,
+                                 unsigned int seed,
+                                 size_t       max_random_size)
+    -> std::enable_if_t<!is_distribution_supported<T>::value, std::vector<T>>
+{
+    return get_random_data<T>(size, min, max, seed, max_random_size);
+}
+
+} // namespace detail
+
+/// \brief Generates \p size keys in [min, max] of the distribution selected with
+/// bench_distribution.
+///
+/// Uniform keys are the same as the ones of get_random_data(). The other distributions are
+/// generated for integral types of up to 64 bits, float and double; other types (half, bfloat16,
+/// 128-bit integers and custom types) always get uniform keys.
+template<class T, class U, class V>
+inline std::vector<T> get_distributed_data(
+    size_t size, U min, V max, unsigned int seed, size_t max_random_size = 1024 * 1024)
+{
+    return detail::get_distributed_data<T>(bench_distribution::get(),
+                                           size,
+                                           min,
+                                           max,
+                                           seed,
+                                           max_random_size);
+}
+
+inline const char* get_segment_distribution_message()
+{
+    return "distribution of the segment lengths, a comma-separated list of: fixed, normal[:d] "
+           "(standard deviation d times the mean, default 0.1), uniform[:min:max] (default 0 to "
+           "twice the mean), log_normal[:sigma] (default 1), power_law[:alpha] (Pareto exponent, "
+           "default 1.5), many_empty[:p] (fraction p of the segments empty, default 0.9); or all";
+}
+
+/// \brief Distribution of the segment lengths of segmented benchmarks.
+///
+/// It is selected with the "segment_distribution" option of segmented benchmarks, which register
+/// their benchmarks for each of the distributions in the list. Every distribution has the mean
+/// segment length requested by the benchmark, except uniform with explicit bounds, so the
+/// distributions of one benchmark process about the same number of items.
+struct bench_segment_distribution
+{
+    enum kind
+    {
+        fixed,
+        normal,
+        uniform,
+        log_normal,
+        power_law,
+        many_empty
+    };
+
+    kind type = normal;
+    // Standard deviation of normal, relative to the mean
+    double relative_stddev = 0.1;
+    // Bounds of uniform, negative for 0 and twice the mean
+    double min_length = -1.0;
+    double max_length = -1.0;
+    // Standard deviation of the logarithm of the lengths of log_normal
+    double sigma = 1.0;
+    // Exponent of power_law, the lengths are capped at 1000 times the mean
+    double alpha = 1.5;
+    // Fraction of the segments of many_empty that are empty, the others have the same length
+    double empty_fraction = 0.9;
+
+    static std::vector<bench_segment_distribution>& get()
+    {
+        static std::vector<bench_segment_distribution> storage(1);
+        return storage;
+    }
+
+    static void set(const std::string& argument)
+    {
+        std::vector<bench_segment_distribution> result;
+        if(argument == "all")
+        {
+            for(const kind type : {fixed, normal, uniform, log_normal, power_law, many_empty})
+            {
+                result.emplace_back();
+                result.back().type = type;
+            }
+        }
+        else
+        {
+            std::stringstream stream(argument);
+            std::string       item;
+            while(std::getline(stream, item, ','))
+            {
+                result.push_back(parse(item));
+            }
+        }
+        if(result.empty())
+        {
+            std::cout << "No segment distribution selected" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        get() = result;
+    }
+
+    std::string name() const
+    {
+        switch(type)
+        {
+            case fixed: return "fixed";
+            case uniform:
+                return min_length < 0 ? "uniform"
+                                      : "uniform:" + std::to_string(min_length) + ":"
+                                            + std::to_string(max_length);
+            case log_normal: return "log_normal:" + std::to_string(sigma);
+            case power_law: return "power_law:" + std::to_string(alpha);
+            case many_empty: return "many_empty:" + std::to_string(empty_fraction);
+            default: return "normal:" + std::to_string(relative_stddev);
+        }
+    }
+
+private:
+    static bench_segment_distribution parse(const std::string& argument)
+    {
+        const size_t               colon     = argument.find(':');
+        const std::string          name      = argument.substr(0, colon);
+        const bool                 has_param = colon != std::string::npos;
+        const std::string          param     = has_param ? argument.substr(colon + 1) : "";
+        bench_segment_distribution result;
+        bool                       valid = true;
+        if(name == "fixed")
+        {
+            result.type = fixed;
+        }
+        else if(name == "normal")
+        {
+            result.type            = normal;
+            result.relative_stddev = has_param ? std::stod(param) : result.relative_stddev;
+        }
+        else if(name == "uniform")
+        {
+            result.type = uniform;
+            if(has_param)
+            {
+                const size_t bounds = param.find(':');
+                valid               = bounds != std::string::npos;
+                if(valid)
+                {
+                    result.min_length = std::stod(param.substr(0, bounds));
+                    result.max_length = std::stod(param.substr(bounds + 1));
+                    valid = result.min_length >= 0 && result.max_length > 0
+                            && result.max_length >= result.min_length;
+                }
+            }
+        }
+        else if(name == "log_normal")
+        {
+            result.type  = log_normal;
+            result.sigma = has_param ? std::stod(param) : result.sigma;
+        }
+        else if(name == "power_law")
+        {
+            result.type  = power_law;
+            result.alpha = has_param ? std::stod(param) : result.alpha;
+            // The mean is infinite otherwise
+            valid = result.alpha > 1.0;
+        }
+        else if(name == "many_empty")
+        {
+            result.type           = many_empty;
+            result.empty_fraction = has_param ? std::stod(param) : result.empty_fraction;
+            valid = result.empty_fraction >= 0.0 && result.empty_fraction < 1.0;
+        }
+        else
+        {
+            valid = false;
+        }
+        if(!valid)
+        {
+            std::cout << "Unknown segment distribution: " << argument << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        return result;
+    }
+};
+
+/// \brief Draws segment lengths of a bench_segment_distribution with a given mean.
+class segment_length_generator
+{
+public:
+    segment_length_generator(const bench_segment_distribution& distribution, const double mean)
+        : distribution_(distribution)
+        , mean_(mean)
+        , normal_(mean, std::max(distribution.relative_stddev * mean, 1e-9))
+        , uniform_(distribution.min_length < 0 ? 0.0 : distribution.min_length,
+                   distribution.max_length < 0 ? 2.0 * mean : distribution.max_length)
+        , log_normal_(std::log(std::max(mean, 1e-9))
+                          - distribution.sigma * distribution.sigma / 2.0,
+                      distribution.sigma)
+    {}
+
+    size_t operator()(engine_type& gen)
+    {
+        switch(distribution_.type)
+        {
+            case bench_segment_distribution::fixed: return round_length(mean_);
+            case bench_segment_distribution::uniform: return round_length(uniform_(gen));
+            case bench_segment_distribution::log_normal: return round_length(log_normal_(gen));
+            case bench_segment_distribution::power_law:
+            {
+                // Pareto distribution whose minimum gives the requested mean
+                const double alpha    = distribution_.alpha;
+                const double min      = mean_ * (alpha - 1.0) / alpha;
+                const double length   = min * std::pow(1.0 - unit_(gen), -1.0 / alpha);
+                return round_length(std::min(length, 1000.0 * mean_));
+            }
+            case bench_segment_distribution::many_empty:
+                return unit_(gen) < distribution_.empty_fraction
+                           ? 0
+                           : round_length(mean_ / (1.0 - distribution_.empty_fraction));
+            default:
+            {
+                double length;
+                do
+                {
+                    length = std::round(normal_(gen));
+                }
+                while(length < 0);
+                return static_cast<size_t>(length);
+            }
+        }
+    }
+
+private:
+    static size_t round_length(const double length)
+    {
+        return static_cast<size_t>(std::round(std::max(length, 0.0)));
+    }
+
+    bench_segment_distribution             distribution_;
+    double                                 mean_;
+    std::normal_distribution<double>       normal_;
+    std::uniform_real_distribution<double> uniform_;
+    std::lognormal_distribution<double>    log_normal_;
+    std::uniform_real_distribution<double> unit_;
+};
+
+/// \brief Generates the offsets of \p segments segments with lengths of \p distribution with
+/// mean \p mean_length. The result has <tt>segments + 1</tt> elements.
+template<class OffsetT>
+inline std::vector<OffsetT> get_segment_offsets(const bench_segment_distribution& distribution,
+                                                const size_t                      segments,
+                                                const size_t                      mean_length,
+                                                const unsigned int                seed)
+{
+    engine_type              gen(seed);
+    segment_length_generator segment_length(distribution, static_cast<double>(mean_length));
+
+    std::vector<OffsetT> offsets;
+    offsets.reserve(segments + 1);
+    offsets.push_back(0);
+    size_t offset = 0;
+    for(size_t segment_index = 0; segment_index < segments; ++segment_index)
+    {
+        offset += segment_length(gen);
+        offsets.push_back(static_cast<OffsetT>(offset));
+    }
+    return offsets;
+}
+
 template<typename T, typename U>
 auto limit_cast(U value) -> T
 {
@@ -1035,6 +1598,90 @@ inline const char* Traits<HIP_vector_type<double, 2>>::name()
     return "double2";
 }
 
+/// \brief Peak bandwidth of the global memory of the current device, in bytes per second.
+///
+/// It is the theoretical bandwidth of the device properties (memory clock rate times bus width,
+/// twice per clock), unless the environment variable ROCPRIM_BENCHMARK_PEAK_BANDWIDTH gives it in
+/// GB/s, e.g. the bandwidth measured by benchmark_device_memory.
+inline double get_peak_bandwidth()
+{
+    static const double peak_bandwidth = []
+    {
+        if(const char* value = std::getenv("ROCPRIM_BENCHMARK_PEAK_BANDWIDTH"))
+        {
+            return std::stod(value) * 1e9;
+        }
+        hipDeviceProp_t devProp;
+        int             device_id = 0;
+        HIP_CHECK(hipGetDevice(&device_id));
+        HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+        // memoryClockRate is in kHz, memoryBusWidth in bits
+        return 2.0 * devProp.memoryClockRate * 1000.0 * devProp.memoryBusWidth / 8.0;
+    }();
+    return peak_bandwidth;
+}
+
+/// \brief Evicts the L2 cache of the device between the timed iterations of a benchmark.
+///
+/// Repeated runs on the same input find most of it in the L2 cache when it is not much larger than
+/// the cache, so small sizes measure the cache and not the global memory. When the environment
+/// variable ROCPRIM_BENCHMARK_FLUSH_L2 is set (to anything but 0), or \p enabled is passed, a call
+/// writes a buffer of twice the L2 size on the stream, which evicts the lines of the earlier runs.
+/// Otherwise it does nothing, so the benchmarks call it before every timed iteration. Only the
+/// first run of a batch starts cold.
+class l2_flush
+{
+public:
+    l2_flush() : l2_flush(is_requested()) {}
+
+    explicit l2_flush(const bool enabled)
+    {
+        if(enabled)
+        {
+            hipDeviceProp_t devProp;
+            int             device_id = 0;
+            HIP_CHECK(hipGetDevice(&device_id));
+            HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+            size_ = 2 * static_cast<size_t>(devProp.l2CacheSize);
+            HIP_CHECK(hipMalloc(&buffer_, size_));
+        }
+    }
+
+    l2_flush(const l2_flush&)            = delete;
+    l2_flush& operator=(const l2_flush&) = delete;
+
+    ~l2_flush()
+    {
+        if(buffer_ != nullptr)
+        {
+            HIP_CHECK(hipFree(buffer_));
+        }
+    }
+
+    void operator()(hipStream_t stream) const
+    {
+        if(buffer_ != nullptr)
+        {
+            HIP_CHECK(hipMemsetAsync(buffer_, 0, size_, stream));
+        }
+    }
+
+    bool enabled() const
+    {
+        return buffer_ != nullptr;
+    }
+
+    static bool is_requested()
+    {
+        const char* value = std::getenv("ROCPRIM_BENCHMARK_FLUSH_L2");
+        return value != nullptr && std::string(value) != "0";
+    }
+
+private:
+    void*  buffer_ = nullptr;
+    size_t size_   = 0;
+};
+
 inline void add_common_benchmark_info()
 {
     hipDeviceProp_t   devProp;
@@ -1071,11 +1718,27 @@ inline void add_common_benchmark_info()
     num("hdp_clock_rate", devProp.clockRate);
     num("hdp_memory_clock_rate", devProp.memoryClockRate);
     num("hdp_memory_bus_width", devProp.memoryBusWidth);
+    num("hdp_peak_bandwidth", get_peak_bandwidth());
     num("hdp_total_const_mem", devProp.totalConstMem);
     num("hdp_major", devProp.major);
     num("hdp_minor", devProp.minor);
     num("hdp_multi_processor_count", devProp.multiProcessorCount);
     num("hdp_l2_cache_size", devProp.l2CacheSize);
+    str("l2_flush", l2_flush::is_requested() ? "on" : "off");
+#ifdef ROCPRIM_BENCHMARK_ENERGY
+    str("energy", "on");
+#else
+    str("energy", "off");
+#endif
+
+    // The benchmarks run on the default stream
+    const bool minimize_memory = std::getenv("ROCPRIM_BENCHMARK_MINIMIZE_MEMORY") != nullptr;
+    if(minimize_memory)
+    {
+        HIP_CHECK(rocprim::set_stream_execution_hint(hipStreamDefault,
+                                                     rocprim::execution_hint::minimize_memory));
+    }
+    str("minimize_memory", minimize_memory ? "on" : "off");
     num("hdp_max_threads_per_multiprocessor", devProp.maxThreadsPerMultiProcessor);
     num("hdp_compute_mode", devProp.computeMode);
     num("hdp_clock_instruction_rate", devProp.clockInstructionRate);
@@ -1132,6 +1795,423 @@ inline void add_common_benchmark_info()
     num("hdp_arch_has_dynamic_parallelism", arch.hasDynamicParallelism);
 }
 
+/// \brief Reports the global memory traffic of a benchmark against the peak bandwidth.
+///
+/// \p bytes_moved is the number of bytes that all timed runs of the algorithm read from and wrote
+/// to global memory, including the extra passes and temporary storage of the algorithm, so it is
+/// usually more than the processed bytes. Adds the counters "memory_bytes_per_second" and
+/// "peak_bandwidth_percent", the achieved fraction of get_peak_bandwidth().
+inline void set_memory_traffic(benchmark::State& state, const double bytes_moved)
+{
+    state.counters["memory_bytes_per_second"]
+        = benchmark::Counter(bytes_moved, benchmark::Counter::kIsRate);
+    state.counters["peak_bandwidth_percent"]
+        = benchmark::Counter(100.0 * bytes_moved / get_peak_bandwidth(),
+                             benchmark::Counter::kIsRate);
+}
+
+/// \brief Statistics of the times of the timed iterations of a benchmark.
+///
+/// google-benchmark only reports the mean time, which hides the spread of the iterations, and for
+/// small sizes that easily reaches 10%. add() collects the time of every iteration. report()
+/// rejects the outliers, the times whose modified z-score (Iglewicz and Hoaglin) from the median
+/// is above 3.5, and adds counters of the remaining times, which are also written to the JSON
+/// output: "median_ms", "p95_ms", "mean_ms", "stddev_ms", the 95% confidence interval of the mean
+/// "ci95_low_ms" to "ci95_high_ms" (Student's t distribution) and the number of "outliers". The
+/// time of google-benchmark still includes the outliers.
+class iteration_statistics
+{
+public:
+    void add(const double seconds)
+    {
+        seconds_.push_back(seconds);
+    }
+
+    void report(benchmark::State& state) const
+    {
+        if(seconds_.empty())
+        {
+            return;
+        }
+        std::vector<double> sorted = seconds_;
+        std::sort(sorted.begin(), sorted.end());
+        const double median = get_median(sorted);
+
+        std::vector<double> deviations;
+        for(const double seconds : sorted)
+        {
+            deviations.push_back(std::abs(seconds - median));
+        }
+        std::sort(deviations.begin(), deviations.end());
+        const double mad = get_median(deviations);
+
+        // Without any spread (e.g. a single iteration) nothing is rejected
+        std::vector<double> kept;
+        for(const double seconds : sorted)
+        {
+            if(mad == 0.0 || 0.6745 * std::abs(seconds - median) / mad <= 3.5)
+            {
+                kept.push_back(seconds);
+            }
+        }
+
+        const size_t count    = kept.size();
+        const double mean     = std::accumulate(kept.begin(), kept.end(), 0.0) / count;
+        double       variance = 0.0;
+        for(const double seconds : kept)
+        {
+            variance += (seconds - mean) * (seconds - mean);
+        }
+        const double stddev = count > 1 ? std::sqrt(variance / (count - 1)) : 0.0;
+        const double ci95
+            = count > 1 ? get_t_critical_value(count - 1) * stddev / std::sqrt(double(count))
+                        : 0.0;
+        const size_t p95_index = (count * 95 + 99) / 100 - 1;
+
+        state.counters["median_ms"]    = get_median(kept) * 1e3;
+        state.counters["p95_ms"]       = kept[p95_index] * 1e3;
+        state.counters["mean_ms"]      = mean * 1e3;
+        state.counters["stddev_ms"]    = stddev * 1e3;
+        state.counters["ci95_low_ms"]  = (mean - ci95) * 1e3;
+        state.counters["ci95_high_ms"] = (mean + ci95) * 1e3;
+        state.counters["outliers"]     = static_cast<double>(sorted.size() - count);
+    }
+
+private:
+    static double get_median(const std::vector<double>& sorted)
+    {
+        const size_t count = sorted.size();
+        return count % 2 ? sorted[count / 2] : (sorted[count / 2 - 1] + sorted[count / 2]) / 2;
+    }
+
+    // Two-sided 95% critical values of Student's t distribution, the normal one above 30
+    static double get_t_critical_value(const size_t degrees_of_freedom)
+    {
+        static constexpr double values[]
+            = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+               2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+               2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+        return degrees_of_freedom <= 30 ? values[degrees_of_freedom - 1] : 1.960;
+    }
+
+    std::vector<double> seconds_;
+};
+
+/// \brief Samples the power, the clocks and the temperature of the device during a benchmark.
+///
+/// On power-capped devices a config that is a bit faster but draws much more power is not better.
+/// When the benchmarks are built with BENCHMARK_ENERGY, start() starts a thread that samples the
+/// average power, the SCLK and MCLK and the temperature of the current device with rocm_smi every
+/// 10 ms (or every ROCPRIM_BENCHMARK_ENERGY_INTERVAL_MS), and stop() adds the counters
+/// "joules_per_item", "average_power_w", "average_sclk_mhz", "average_mclk_mhz" and
+/// "max_temperature_c". The energy is read from the energy counter of the device if it has one,
+/// otherwise it is the average power times the time. It covers everything between start() and
+/// stop(), so the host work between the timed iterations lowers the average power a little.
+/// Without BENCHMARK_ENERGY, or if rocm_smi does not find the device, nothing is reported.
+class energy_sampler
+{
+public:
+#ifdef ROCPRIM_BENCHMARK_ENERGY
+    energy_sampler()
+    {
+        static const bool initialized = rsmi_init(0) == RSMI_STATUS_SUCCESS;
+        if(!initialized)
+        {
+            return;
+        }
+
+        hipDeviceProp_t devProp;
+        int             device_id = 0;
+        HIP_CHECK(hipGetDevice(&device_id));
+        HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+
+        // rocm_smi enumerates the devices independently of HIP, they are matched by PCI address
+        uint32_t devices = 0;
+        if(rsmi_num_monitor_devices(&devices) != RSMI_STATUS_SUCCESS)
+        {
+            return;
+        }
+        for(uint32_t index = 0; index < devices; ++index)
+        {
+            uint64_t bdfid;
+            if(rsmi_dev_pci_id_get(index, &bdfid) == RSMI_STATUS_SUCCESS
+               && (bdfid >> 32) == uint64_t(devProp.pciDomainID)
+               && ((bdfid >> 8) & 0xff) == uint64_t(devProp.pciBusID)
+               && ((bdfid >> 3) & 0x1f) == uint64_t(devProp.pciDeviceID))
+            {
+                index_ = index;
+                found_ = true;
+                break;
+            }
+        }
+
+        if(const char* value = std::getenv("ROCPRIM_BENCHMARK_ENERGY_INTERVAL_MS"))
+        {
+            interval_ = std::chrono::milliseconds(std::stoi(value));
+        }
+    }
+
+    energy_sampler(const energy_sampler&)            = delete;
+    energy_sampler& operator=(const energy_sampler&) = delete;
+
+    ~energy_sampler()
+    {
+        if(thread_.joinable())
+        {
+            stopping_.store(true);
+            thread_.join();
+        }
+    }
+
+    void start()
+    {
+        if(!found_)
+        {
+            return;
+        }
+        has_energy_counter_ = read_energy_counter(start_energy_);
+        start_time_         = std::chrono::steady_clock::now();
+        stopping_.store(false);
+        thread_ = std::thread(
+            [this]
+            {
+                while(!stopping_.load())
+                {
+                    sample();
+                    std::this_thread::sleep_for(interval_);
+                }
+            });
+    }
+
+    /// \p items is the number of items processed by all timed runs.
+    void stop(benchmark::State& state, const double items)
+    {
+        if(!thread_.joinable())
+        {
+            return;
+        }
+        stopping_.store(true);
+        thread_.join();
+
+        const double seconds
+            = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time_)
+                  .count();
+        const double average_power = power_samples_ == 0 ? 0.0 : power_sum_ / power_samples_;
+
+        double joules = average_power * seconds;
+        double end_energy;
+        if(has_energy_counter_ && read_energy_counter(end_energy) && end_energy > start_energy_)
+        {
+            joules = end_energy - start_energy_;
+        }
+
+        state.counters["joules_per_item"] = items == 0 ? 0.0 : joules / items;
+        state.counters["average_power_w"] = seconds == 0 ? average_power : joules / seconds;
+        state.counters["average_sclk_mhz"]
+            = sclk_samples_ == 0 ? 0.0 : sclk_sum_ / sclk_samples_;
+        state.counters["average_mclk_mhz"]
+            = mclk_samples_ == 0 ? 0.0 : mclk_sum_ / mclk_samples_;
+        state.counters["max_temperature_c"] = max_temperature_;
+    }
+
+private:
+    // Only the sampling thread updates the sums, they are read after it is joined
+    void sample()
+    {
+        uint64_t power;
+        if(rsmi_dev_power_ave_get(index_, 0, &power) == RSMI_STATUS_SUCCESS)
+        {
+            // microwatts
+            power_sum_ += power * 1e-6;
+            ++power_samples_;
+        }
+        const auto clock = [this](const rsmi_clk_type_t type, double& sum, size_t& samples)
+        {
+            rsmi_frequencies_t frequencies;
+            if(rsmi_dev_gpu_clk_freq_get(index_, type, &frequencies) == RSMI_STATUS_SUCCESS
+               && frequencies.current < frequencies.num_supported)
+            {
+                // hertz
+                sum += frequencies.frequency[frequencies.current] * 1e-6;
+                ++samples;
+            }
+        };
+        clock(RSMI_CLK_TYPE_SYS, sclk_sum_, sclk_samples_);
+        clock(RSMI_CLK_TYPE_MEM, mclk_sum_, mclk_samples_);
+        int64_t temperature;
+        if(rsmi_dev_temp_metric_get(index_, RSMI_TEMP_TYPE_EDGE, RSMI_TEMP_CURRENT, &temperature)
+           == RSMI_STATUS_SUCCESS)
+        {
+            // millidegrees Celsius
+            max_temperature_ = std::max(max_temperature_, temperature * 1e-3);
+        }
+    }
+
+    // The energy consumed by the device since some point in the past, in joules
+    bool read_energy_counter(double& joules) const
+    {
+        uint64_t counter;
+        float    resolution;
+        uint64_t timestamp;
+        if(rsmi_dev_energy_count_get(index_, &counter, &resolution, &timestamp)
+           != RSMI_STATUS_SUCCESS)
+        {
+            return false;
+        }
+        // The resolution is in microjoules
+        joules = counter * double(resolution) * 1e-6;
+        return true;
+    }
+
+    uint32_t                              index_ = 0;
+    bool                                  found_ = false;
+    std::chrono::milliseconds             interval_{10};
+    std::thread                           thread_;
+    std::atomic<bool>                     stopping_{false};
+    std::chrono::steady_clock::time_point start_time_;
+    bool                                  has_energy_counter_ = false;
+    double                                start_energy_       = 0.0;
+    double                                power_sum_          = 0.0;
+    size_t                                power_samples_      = 0;
+    double                                sclk_sum_           = 0.0;
+    size_t                                sclk_samples_       = 0;
+    double                                mclk_sum_           = 0.0;
+    size_t                                mclk_samples_       = 0;
+    double                                max_temperature_    = 0.0;
+#else
+    void start() {}
+
+    void stop(benchmark::State& /*state*/, const double /*items*/) {}
+#endif
+};
+
+/// \brief Reports the temporary storage of a device algorithm.
+///
+/// Adds the counters "temporary_storage_bytes", the temporary storage of one call, and
+/// "temporary_storage_ratio", its ratio to the \p input_bytes of the call, so that the footprint
+/// of an algorithm can be compared between configs and sizes.
+inline void set_temporary_storage(benchmark::State& state,
+                                  const size_t      temporary_storage_bytes,
+                                  const size_t      input_bytes)
+{
+    state.counters["temporary_storage_bytes"] = static_cast<double>(temporary_storage_bytes);
+    state.counters["temporary_storage_ratio"]
+        = input_bytes == 0 ? 0.0 : double(temporary_storage_bytes) / input_bytes;
+}
+
+/// \brief Problem sizes of latency benchmarks, powers of 4 from 1 to 1M.
+inline std::vector<size_t> get_latency_sizes()
+{
+    std::vector<size_t> sizes;
+    for(size_t size = 1; size <= 1024 * 1024; size *= 4)
+    {
+        sizes.push_back(size);
+    }
+    return sizes;
+}
+
+/// \brief Measures the latency of single calls of a device algorithm.
+///
+/// For small sizes the time of a call is dominated by the launches of its kernels, which the
+/// throughput benchmarks hide by batching many calls. \p call enqueues one call on the stream it
+/// is passed. Every iteration makes \p calls_per_iteration calls, each one timed on the host from
+/// its launch until the stream is idle. With \p use_graph the call is captured in a hipGraph once
+/// and the graph is launched instead.
+///
+/// Besides the total time, reports the counters "p50_us" and "p99_us", the median and the 99th
+/// percentile of the call times in microseconds, and "kernel_launches" and "copy_launches", the
+/// kernels and the memory copies and sets of a call, counted on its captured graph. The items
+/// processed are the calls.
+template<class Call>
+inline void run_latency_benchmark(benchmark::State&  state,
+                                  Call               call,
+                                  const bool         use_graph,
+                                  const unsigned int calls_per_iteration = 100)
+{
+    // Default stream does not support hipGraph stream capture, so create one
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    hipGraph_t graph;
+    HIP_CHECK(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    call(stream);
+    HIP_CHECK(hipStreamEndCapture(stream, &graph));
+
+    size_t node_count = 0;
+    HIP_CHECK(hipGraphGetNodes(graph, nullptr, &node_count));
+    std::vector<hipGraphNode_t> nodes(node_count);
+    HIP_CHECK(hipGraphGetNodes(graph, nodes.data(), &node_count));
+    size_t kernel_launches = 0;
+    size_t copy_launches   = 0;
+    for(const hipGraphNode_t node : nodes)
+    {
+        hipGraphNodeType type;
+        HIP_CHECK(hipGraphNodeGetType(node, &type));
+        kernel_launches += type == hipGraphNodeTypeKernel;
+        copy_launches += type == hipGraphNodeTypeMemcpy || type == hipGraphNodeTypeMemset;
+    }
+
+    hipGraphExec_t graph_instance = nullptr;
+    if(use_graph)
+    {
+        HIP_CHECK(hipGraphInstantiate(&graph_instance, graph, nullptr, nullptr, 0));
+    }
+    const auto launch = [&]
+    {
+        if(use_graph)
+        {
+            HIP_CHECK(hipGraphLaunch(graph_instance, stream));
+        }
+        else
+        {
+            call(stream);
+        }
+    };
+
+    // Warm-up
+    for(unsigned int i = 0; i < 10; ++i)
+    {
+        launch();
+    }
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    std::vector<double> call_seconds;
+    for(auto _ : state)
+    {
+        double iteration_seconds = 0;
+        for(unsigned int i = 0; i < calls_per_iteration; ++i)
+        {
+            const auto start = std::chrono::high_resolution_clock::now();
+            launch();
+            HIP_CHECK(hipStreamSynchronize(stream));
+            const auto end = std::chrono::high_resolution_clock::now();
+
+            const double seconds = std::chrono::duration<double>(end - start).count();
+            call_seconds.push_back(seconds);
+            iteration_seconds += seconds;
+        }
+        state.SetIterationTime(iteration_seconds);
+    }
+
+    if(!call_seconds.empty())
+    {
+        std::sort(call_seconds.begin(), call_seconds.end());
+        const size_t count = call_seconds.size();
+        state.counters["p50_us"] = call_seconds[count / 2] * 1e6;
+        state.counters["p99_us"] = call_seconds[std::min(count - 1, count * 99 / 100)] * 1e6;
+    }
+    state.counters["kernel_launches"] = static_cast<double>(kernel_launches);
+    state.counters["copy_launches"]   = static_cast<double>(copy_launches);
+    state.SetItemsProcessed(state.iterations() * calls_per_iteration);
+
+    if(use_graph)
+    {
+        HIP_CHECK(hipGraphExecDestroy(graph_instance));
+    }
+    HIP_CHECK(hipGraphDestroy(graph));
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
 inline const char* get_block_scan_method_name(rocprim::block_scan_algorithm alg)
 {
     switch(alg)
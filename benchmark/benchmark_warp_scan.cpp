@@ -45,7 +45,10 @@ const size_t DEFAULT_BYTES = 1024 * 1024 * 32 * 4;
 
 namespace rp = rocprim;
 
-template<class T, unsigned int WarpSize, unsigned int Trials>
+template<class T,
+         unsigned int WarpSize,
+         unsigned int Trials,
+         template<class, unsigned int> class WarpScan>
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
 void warp_inclusive_scan_kernel(const T* input, T* output)
@@ -53,18 +56,21 @@ void warp_inclusive_scan_kernel(const T* input, T* output)
     const unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
     auto value = input[i];
 
-    using wscan_t = rp::warp_scan<T, WarpSize>;
+    using wscan_t = WarpScan<T, WarpSize>;
     __shared__ typename wscan_t::storage_type storage;
     ROCPRIM_NO_UNROLL
     for(unsigned int trial = 0; trial < Trials; trial++)
     {
-        wscan_t().inclusive_scan(value, value, storage);
+        wscan_t().inclusive_scan(value, value, storage, rp::plus<T>());
     }
 
     output[i] = value;
 }
 
-template<class T, unsigned int WarpSize, unsigned int Trials>
+template<class T,
+         unsigned int WarpSize,
+         unsigned int Trials,
+         template<class, unsigned int> class WarpScan>
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
 void warp_exclusive_scan_kernel(const T* input, T* output, const T init)
@@ -72,12 +78,12 @@ void warp_exclusive_scan_kernel(const T* input, T* output, const T init)
     const unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
     auto value = input[i];
 
-    using wscan_t = rp::warp_scan<T, WarpSize>;
+    using wscan_t = WarpScan<T, WarpSize>;
     __shared__ typename wscan_t::storage_type storage;
     ROCPRIM_NO_UNROLL
     for(unsigned int trial = 0; trial < Trials; trial++)
     {
-        wscan_t().exclusive_scan(value, value, init, storage);
+        wscan_t().exclusive_scan(value, value, init, storage, rp::plus<T>());
     }
 
     output[i] = value;
@@ -88,7 +94,8 @@ template<
     unsigned int BlockSize,
     unsigned int WarpSize,
     bool Inclusive = true,
-    unsigned int Trials = 100
+    unsigned int Trials = 100,
+    template<class, unsigned int> class WarpScan = rp::warp_scan
 >
 void run_benchmark(benchmark::State& state, hipStream_t stream, size_t bytes)
 {
@@ -125,7 +132,7 @@ void run_benchmark(benchmark::State& state, hipStream_t stream, size_t bytes)
         if(Inclusive)
         {
             hipLaunchKernelGGL(
-                HIP_KERNEL_NAME(warp_inclusive_scan_kernel<T, WarpSize, Trials>),
+                HIP_KERNEL_NAME(warp_inclusive_scan_kernel<T, WarpSize, Trials, WarpScan>),
                 dim3(size/BlockSize), dim3(BlockSize), 0, stream,
                 d_input, d_output
             );
@@ -133,7 +140,7 @@ void run_benchmark(benchmark::State& state, hipStream_t stream, size_t bytes)
         else
         {
             hipLaunchKernelGGL(
-                HIP_KERNEL_NAME(warp_exclusive_scan_kernel<T, WarpSize, Trials>),
+                HIP_KERNEL_NAME(warp_exclusive_scan_kernel<T, WarpSize, Trials, WarpScan>),
                 dim3(size/BlockSize), dim3(BlockSize), 0, stream,
                 d_input, d_output, input[0]
             );
@@ -170,6 +177,21 @@ void run_benchmark(benchmark::State& state, hipStream_t stream, size_t bytes)
         stream,                                                                        \
         bytes)
 
+#define CREATE_METHOD_BENCHMARK(T, BS, WS, INCLUSIVE, METHOD, WARP_SCAN)                 \
+    benchmark::RegisterBenchmark(                                                          \
+        bench_naming::format_name("{lvl:warp,algo:scan,key_type:" #T ",subalgo:"           \
+                                  + std::string(Inclusive ? "inclusive" : "exclusive")     \
+                                  + ",ws:" #WS ",cfg:{bs:" #BS ",method:" #METHOD "}}")    \
+            .c_str(),                                                                      \
+        run_benchmark<T, BS, WS, INCLUSIVE, 100, WARP_SCAN>,                               \
+        stream,                                                                            \
+        bytes)
+
+// Compares the default scan (DPP where available) with the shuffle based scan
+#define BENCHMARK_METHODS(T, BS, WS)                                                       \
+    CREATE_METHOD_BENCHMARK(T, BS, WS, Inclusive, default, rp::warp_scan),                 \
+    CREATE_METHOD_BENCHMARK(T, BS, WS, Inclusive, shuffle, rp::detail::warp_scan_shuffle)
+
 #define BENCHMARK_TYPE(type) \
     CREATE_BENCHMARK(type, 64, 64, Inclusive), \
     CREATE_BENCHMARK(type, 128, 64, Inclusive), \
@@ -197,7 +219,12 @@ void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
         BENCHMARK_TYPE(uint8_t),
         BENCHMARK_TYPE(rocprim::half),
         BENCHMARK_TYPE(custom_double2),
-        BENCHMARK_TYPE(custom_int_double)
+        BENCHMARK_TYPE(custom_int_double),
+
+        BENCHMARK_METHODS(int, 256, 32),
+        BENCHMARK_METHODS(int, 256, 16),
+        BENCHMARK_METHODS(float, 256, 32),
+        BENCHMARK_METHODS(float, 256, 16)
     };
     benchmarks.insert(benchmarks.end(), new_benchmarks.begin(), new_benchmarks.end());
 }
@@ -55,4 +55,8 @@ function(print_configuration_summary)
   message(STATUS "  BUILD_NAIVE_BENCHMARK     : ${BUILD_NAIVE_BENCHMARK}")
   message(STATUS "  BUILD_EXAMPLE             : ${BUILD_EXAMPLE}")
   message(STATUS "  BUILD_DOCS                : ${BUILD_DOCS}")
+  message(STATUS "  BUILD_PREBUILT            : ${BUILD_PREBUILT}")
+  if(ROCPRIM_DISPATCH_ARCHS)
+    message(STATUS "  ROCPRIM_DISPATCH_ARCHS    : ${ROCPRIM_DISPATCH_ARCHS}")
+  endif()
 endfunction()
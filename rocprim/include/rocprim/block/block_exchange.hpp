@@ -27,6 +27,7 @@
 #include "../functional.hpp"
 #include "../intrinsics.hpp"
 #include "../types.hpp"
+#include "../warp/warp_exchange.hpp"
 
 #include "config.hpp"
 
@@ -54,6 +55,9 @@ BEGIN_ROCPRIM_NAMESPACE
 ///   * Scattering items to a blocked arrangement.
 ///   * Scattering items to a striped arrangement.
 /// * Data is automatically be padded to ensure zero bank conflicts.
+/// * With \p block_padding_hint::xor_swizzle the data is not padded. Instead, the shared memory
+///   layout is permuted with an XOR swizzle, which avoids the bank conflicts of power-of-two
+///   \p ItemsPerThread without using more shared memory.
 ///
 /// \par Examples
 /// \parblock
@@ -96,9 +100,18 @@ class block_exchange
     static constexpr unsigned int buffer_size
         = static_cast<unsigned int>(rocprim::max(size_t{1}, size_t{4} / sizeof(T)));
 
+    // Number of items in a row of all LDS banks
+    static constexpr unsigned int row_items = banks_no * buffer_size;
+    // The swizzle permutes units of a bank word (for types smaller than 4 bytes) or of an item,
+    // in rows of units that cover all banks
+    static constexpr unsigned int swizzle_row_units
+        = banks_no * 4 / static_cast<unsigned int>(rocprim::max(size_t{4}, sizeof(T)));
+    static constexpr unsigned int swizzle_row_items = swizzle_row_units * buffer_size;
+
     struct unpadded_config
     {
         static constexpr bool         has_bank_conflicts = false;
+        static constexpr bool         swizzle            = false;
         static constexpr unsigned int padding            = 0;
     };
 
@@ -109,10 +122,23 @@ class block_exchange
         // (all exchanges from/to blocked).
         static constexpr bool has_bank_conflicts
             = ItemsPerThread >= 2 && ::rocprim::detail::is_power_of_two(ItemsPerThread);
+        static constexpr bool         swizzle = false;
         static constexpr unsigned int padding
             = has_bank_conflicts ? (BlockSize * ItemsPerThread / banks_no) : 0;
     };
 
+    struct swizzled_config
+    {
+        static constexpr bool has_bank_conflicts = false;
+        // The same power-of-two strides are made conflict free by permuting the bank words of
+        // every row instead of shifting the rows. The permutation stays within the rows, so the
+        // layout needs whole rows.
+        static constexpr bool swizzle = ItemsPerThread >= 2
+                                        && ::rocprim::detail::is_power_of_two(ItemsPerThread)
+                                        && (BlockSize * ItemsPerThread) % swizzle_row_items == 0;
+        static constexpr unsigned int padding = 0;
+    };
+
     template<typename Config>
     struct build_config : Config
     {
@@ -121,13 +147,31 @@ class block_exchange
         static constexpr unsigned int occupancy     = detail::get_min_lds_size() / storage_size;
     };
 
-    using config = detail::select_block_padding_config<PaddingHint,
-                                                       build_config<padded_config>,
-                                                       build_config<unpadded_config>>;
+    using config = std::conditional_t<
+        PaddingHint == block_padding_hint::xor_swizzle,
+        build_config<swizzled_config>,
+        detail::select_block_padding_config<PaddingHint,
+                                            build_config<padded_config>,
+                                            build_config<unpadded_config>>>;
 
     static constexpr bool         has_bank_conflicts     = config::has_bank_conflicts;
+    static constexpr bool         swizzle                = config::swizzle;
     static constexpr unsigned int bank_conflicts_padding = config::padding;
     static constexpr unsigned int storage_count          = config::storage_count;
+    // The padding is inserted every row_items items. If ItemsPerThread divides that, the
+    // blocked items of a thread never straddle the padding and stay contiguous. The swizzle
+    // reorders the bank words within a row, so the items are not contiguous.
+    static constexpr bool blocked_items_contiguous
+        = !swizzle && (!has_bank_conflicts || row_items % ItemsPerThread == 0);
+
+    // A block of a single warp can exchange with warp shuffles. The shuffles of the generic
+    // transpose grow with the square of ItemsPerThread, so they are used automatically (by the
+    // overloads without storage) only for a few items or in the square case.
+    static constexpr bool can_shuffle = BlockSize <= ::rocprim::device_warp_size()
+                                        && ::rocprim::detail::is_power_of_two(BlockSize)
+                                        && BlockSize % ItemsPerThread == 0;
+    static constexpr bool use_shuffle
+        = can_shuffle && (ItemsPerThread <= 4 || ItemsPerThread == BlockSize);
 
     struct storage_type_
     {
@@ -148,6 +192,9 @@ public:
     /// \brief Transposes a blocked arrangement of items to a striped arrangement
     /// across the thread block.
     ///
+    /// If the block is a single warp and \p ItemsPerThread is at most 4 or equal to the
+    /// block size, the items are exchanged with warp shuffles, without shared memory.
+    ///
     /// \tparam U - [inferred] the output type.
     ///
     /// \param [in] input - array that data is loaded from.
@@ -157,8 +204,7 @@ public:
     void blocked_to_striped(const T (&input)[ItemsPerThread],
                             U (&output)[ItemsPerThread])
     {
-        ROCPRIM_SHARED_MEMORY storage_type storage;
-        blocked_to_striped(input, output, storage);
+        blocked_to_striped_impl(input, output, std::integral_constant<bool, use_shuffle>{});
     }
 
     /// \brief Transposes a blocked arrangement of items to a striped arrangement
@@ -201,7 +247,7 @@ public:
 
         for(unsigned int i = 0; i < ItemsPerThread; i++)
         {
-            storage.buffer.emplace(index(flat_id * ItemsPerThread + i), input[i]);
+            storage.buffer.emplace(blocked_index(flat_id * ItemsPerThread, i), input[i]);
         }
         ::rocprim::syncthreads();
         const auto& storage_buffer = storage.buffer.get_unsafe_array();
@@ -215,6 +261,9 @@ public:
     /// \brief Transposes a striped arrangement of items to a blocked arrangement
     /// across the thread block.
     ///
+    /// If the block is a single warp and \p ItemsPerThread is at most 4 or equal to the
+    /// block size, the items are exchanged with warp shuffles, without shared memory.
+    ///
     /// \tparam U - [inferred] the output type.
     ///
     /// \param [in] input - array that data is loaded from.
@@ -224,8 +273,51 @@ public:
     void striped_to_blocked(const T (&input)[ItemsPerThread],
                             U (&output)[ItemsPerThread])
     {
-        ROCPRIM_SHARED_MEMORY storage_type storage;
-        striped_to_blocked(input, output, storage);
+        striped_to_blocked_impl(input, output, std::integral_constant<bool, use_shuffle>{});
+    }
+
+    /// \brief Transposes a blocked arrangement of items to a striped arrangement
+    /// across the thread block, using warp shuffle operations.
+    ///
+    /// The exchange does not use shared memory or barriers. The block size must be
+    /// a power of two, not larger than the hardware warp size, and a multiple of
+    /// \p ItemsPerThread.
+    ///
+    /// \tparam U - [inferred] the output type.
+    ///
+    /// \param [in] input - array that data is loaded from.
+    /// \param [out] output - array that data is loaded to.
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void blocked_to_striped_shuffle(const T (&input)[ItemsPerThread],
+                                    U (&output)[ItemsPerThread])
+    {
+        ROCPRIM_DETAIL_DEVICE_STATIC_ASSERT(can_shuffle,
+                                            "blocked_to_striped_shuffle requires a single warp "
+                                            "of a power-of-two size that ItemsPerThread divides");
+        blocked_to_striped_impl(input, output, std::true_type{});
+    }
+
+    /// \brief Transposes a striped arrangement of items to a blocked arrangement
+    /// across the thread block, using warp shuffle operations.
+    ///
+    /// The exchange does not use shared memory or barriers. The block size must be
+    /// a power of two, not larger than the hardware warp size, and a multiple of
+    /// \p ItemsPerThread.
+    ///
+    /// \tparam U - [inferred] the output type.
+    ///
+    /// \param [in] input - array that data is loaded from.
+    /// \param [out] output - array that data is loaded to.
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void striped_to_blocked_shuffle(const T (&input)[ItemsPerThread],
+                                    U (&output)[ItemsPerThread])
+    {
+        ROCPRIM_DETAIL_DEVICE_STATIC_ASSERT(can_shuffle,
+                                            "striped_to_blocked_shuffle requires a single warp "
+                                            "of a power-of-two size that ItemsPerThread divides");
+        striped_to_blocked_impl(input, output, std::true_type{});
     }
 
     /// \brief Transposes a striped arrangement of items to a blocked arrangement
@@ -275,7 +367,7 @@ public:
 
         for(unsigned int i = 0; i < ItemsPerThread; i++)
         {
-            output[i] = storage_buffer[index(flat_id * ItemsPerThread + i)];
+            output[i] = storage_buffer[blocked_index(flat_id * ItemsPerThread, i)];
         }
     }
 
@@ -338,7 +430,7 @@ public:
 
         for(unsigned int i = 0; i < ItemsPerThread; i++)
         {
-            storage.buffer.emplace(index(offset + lane_id * ItemsPerThread + i), input[i]);
+            storage.buffer.emplace(blocked_index(offset + lane_id * ItemsPerThread, i), input[i]);
         }
 
         ::rocprim::wave_barrier();
@@ -417,7 +509,7 @@ public:
 
         for(unsigned int i = 0; i < ItemsPerThread; i++)
         {
-            output[i] = storage_buffer[index(offset + lane_id * ItemsPerThread + i)];
+            output[i] = storage_buffer[blocked_index(offset + lane_id * ItemsPerThread, i)];
         }
     }
 
@@ -511,7 +603,7 @@ public:
 
         for(unsigned int i = 0; i < ItemsPerThread; i++)
         {
-            output[i] = storage_buffer[index(flat_id * ItemsPerThread + i)];
+            output[i] = storage_buffer[blocked_index(flat_id * ItemsPerThread, i)];
         }
     }
 
@@ -862,6 +954,43 @@ public:
     }
 
 private:
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void blocked_to_striped_impl(const T (&input)[ItemsPerThread],
+                                 U (&output)[ItemsPerThread],
+                                 std::true_type /*use_shuffle*/)
+    {
+        warp_exchange<T, ItemsPerThread, BlockSize>().blocked_to_striped_shuffle(input, output);
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void blocked_to_striped_impl(const T (&input)[ItemsPerThread],
+                                 U (&output)[ItemsPerThread],
+                                 std::false_type /*use_shuffle*/)
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        blocked_to_striped(input, output, storage);
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void striped_to_blocked_impl(const T (&input)[ItemsPerThread],
+                                 U (&output)[ItemsPerThread],
+                                 std::true_type /*use_shuffle*/)
+    {
+        warp_exchange<T, ItemsPerThread, BlockSize>().striped_to_blocked_shuffle(input, output);
+    }
+
+    template<class U>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void striped_to_blocked_impl(const T (&input)[ItemsPerThread],
+                                 U (&output)[ItemsPerThread],
+                                 std::false_type /*use_shuffle*/)
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        striped_to_blocked(input, output, storage);
+    }
 
     ROCPRIM_DEVICE ROCPRIM_INLINE
     unsigned int get_current_warp_size() const
@@ -876,8 +1005,38 @@ private:
     ROCPRIM_DEVICE ROCPRIM_INLINE
     unsigned int index(unsigned int n)
     {
+        if ROCPRIM_IF_CONSTEXPR(swizzle)
+        {
+            return swizzled_index(n);
+        }
         // Move every 32-bank wide "row" (32 banks * 4 bytes) by one item
-        return has_bank_conflicts ? (n + (n / (banks_no * buffer_size)) * buffer_size) : n;
+        return has_bank_conflicts ? (n + (n / row_items) * buffer_size) : n;
+    }
+
+    // XOR the unit of the item with a function of its row. Blocked accesses of the threads
+    // at the same time hit different rows: with ItemsPerThread smaller than a row the rows
+    // differ in the low bits that select the unit within the items of a thread, otherwise
+    // every thread spans ItemsPerThread / swizzle_row_items rows and the thread is used.
+    // Striped accesses stay in one row and are permuted the same way.
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned int swizzled_index(unsigned int n)
+    {
+        constexpr unsigned int rows_per_thread
+            = ::rocprim::max(1u, ItemsPerThread / swizzle_row_items);
+
+        const unsigned int row  = n / swizzle_row_items;
+        const unsigned int unit = (n % swizzle_row_items) / buffer_size;
+        const unsigned int mask = (row / rows_per_thread) % swizzle_row_units;
+        return row * swizzle_row_items + (unit ^ mask) * buffer_size + n % buffer_size;
+    }
+
+    // Index of the i-th item of the blocked items starting at first (a multiple of
+    // ItemsPerThread). When the items are contiguous the padded offset is computed only once,
+    // so the compiler can merge the accesses of a thread into wide ds_read/ds_write instructions.
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned int blocked_index(unsigned int first, unsigned int i)
+    {
+        return blocked_items_contiguous ? index(first) + i : index(first + i);
     }
 };
 
@@ -30,6 +30,7 @@
 
 #include "block_load_func.hpp"
 #include "block_exchange.hpp"
+#include "detail/block_load_lds.hpp"
 
 /// \addtogroup blockmodule
 /// @{
@@ -55,10 +56,16 @@ enum class block_load_method
     /// * Performance remains high due to increased memory coalescing, provided that
     /// vectorization requirements are fulfilled. Otherwise, performance will default
     /// to \p block_load_direct.
+    /// * The items of a thread are loaded as raw bytes with up to 128-bit accesses if \p T is
+    /// trivially copyable and they are at least 4 bytes, including packed types of sizes
+    /// that are not powers of two. An input offset (\p block_input) that is not aligned to these
+    /// accesses is handled with 32-bit accesses and byte shifts.
+    /// * A \p cache_modified_input_iterator with \p load_cs is loaded through its pointer with
+    /// nontemporal vectorized loads.
     /// \par Requirements:
-    /// * The input offset (\p block_input) must be quad-item aligned.
-    /// * The following conditions will prevent vectorization and switch to default
+    /// * Otherwise, the following conditions will prevent vectorization and switch to default
     /// \p block_load_direct:
+    ///   * The input offset (\p block_input) is not quad-item aligned.
     ///   * \p ItemsPerThread is odd.
     ///   * The datatype \p T is not a primitive or a HIP vector type (e.g. int2,
     /// int4, etc.
@@ -84,6 +91,18 @@ enum class block_load_method
     /// \p block_load_vectorize due to reordering on local memory.
     block_load_warp_transpose,
 
+    /// A striped arrangement of data from continuous memory is copied to shared memory and
+    /// read into a blocked arrangement of items.
+    /// \par Performance Notes:
+    /// * On CDNA3 (gfx942), the global loads write straight to shared memory without going
+    /// through registers, which halves the registers used for staging. The copy can be started
+    /// with \p load_async, overlapping other work, and finished with \p wait, a barrier.
+    /// * The direct loads are used if the input is a pointer to \p T, \p T is made of
+    /// aligned 32-bit words and the block is made of full warps. Otherwise, and on other
+    /// architectures, \p load is \p block_load_transpose and \p load_async copies through
+    /// registers.
+    block_load_direct_to_lds,
+
     /// Defaults to \p block_load_direct
     default_method = block_load_direct
 };
@@ -105,6 +124,7 @@ enum class block_load_method
 ///   * \p block_load_method::block_load_vectorize
 ///   * \p ::block_load_method::block_load_transpose
 ///   * \p ::block_load_method::block_load_warp_transpose
+///   * \p ::block_load_method::block_load_direct_to_lds
 ///
 /// \par Example:
 /// \parblock
@@ -379,6 +399,66 @@ public:
         (void) storage;
         load(block_input, items, valid, out_of_bounds);
     }
+
+    /// \brief Loads the items selected by a mask from continuous memory into an arrangement
+    /// of items across the thread block.
+    ///
+    /// Item \p i of the thread is loaded if bit \p i of \p mask is set, the other items are
+    /// left unchanged and their inputs are not read.
+    ///
+    /// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+    /// pointer
+    ///
+    /// \param [in] block_input - the input iterator from the thread block to load from.
+    /// \param [out] items - array that data is loaded to.
+    /// \param [in] mask - the mask of the items of the calling thread to load, at most 32
+    /// items per thread are supported.
+    ///
+    /// \par Overview
+    /// * The type \p T must be such that an object of type \p InputIterator
+    /// can be dereferenced and then implicitly converted to \p T.
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_masked(InputIterator block_input,
+                     T (&items)[ItemsPerThread],
+                     unsigned int mask)
+    {
+        using value_type = typename std::iterator_traits<InputIterator>::value_type;
+        static_assert(std::is_convertible<value_type, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_load_direct_blocked_masked(flat_id, block_input, items, mask);
+    }
+
+    /// \brief Loads the items selected by per-item flags from continuous memory into an
+    /// arrangement of items across the thread block.
+    ///
+    /// The flags are arranged like the items: item \p i of the thread is loaded if its flag
+    /// converts to \p true, the other items are left unchanged and their inputs are not read.
+    /// A packed bitmask can be passed as the flags with \p rocprim::bitmask_iterator.
+    ///
+    /// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+    /// pointer
+    /// \tparam FlagIterator - [inferred] an iterator type for the flags, its value type must
+    /// be convertible to \p bool.
+    ///
+    /// \param [in] block_input - the input iterator from the thread block to load from.
+    /// \param [out] items - array that data is loaded to.
+    /// \param [in] flags - the flags of the items of the thread block.
+    template<class InputIterator,
+             class FlagIterator,
+             class = detail::enable_if_flag_iterator_t<FlagIterator>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_masked(InputIterator block_input,
+                     T (&items)[ItemsPerThread],
+                     FlagIterator flags)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        bool item_flags[ItemsPerThread];
+        block_load_direct_blocked(flat_id, flags, item_flags);
+        load_masked(block_input, items, detail::flags_to_item_mask(item_flags));
+    }
 };
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -501,6 +581,34 @@ public:
         block_load_direct_striped<BlockSize>(flat_id, block_input, items, valid,
                                              out_of_bounds);
     }
+
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_masked(InputIterator block_input,
+                     T (&items)[ItemsPerThread],
+                     unsigned int mask)
+    {
+        using value_type = typename std::iterator_traits<InputIterator>::value_type;
+        static_assert(std::is_convertible<value_type, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_load_direct_striped_masked<BlockSize>(flat_id, block_input, items, mask);
+    }
+
+    template<class InputIterator,
+             class FlagIterator,
+             class = detail::enable_if_flag_iterator_t<FlagIterator>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_masked(InputIterator block_input,
+                     T (&items)[ItemsPerThread],
+                     FlagIterator flags)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        bool item_flags[ItemsPerThread];
+        block_load_direct_striped<BlockSize>(flat_id, flags, item_flags);
+        load_masked(block_input, items, detail::flags_to_item_mask(item_flags));
+    }
 };
 
 template<
@@ -543,6 +651,15 @@ public:
         block_load_direct_blocked(flat_id, block_input, items);
     }
 
+    template<class V, cache_load_modifier Modifier, class Difference, class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(cache_modified_input_iterator<V, Modifier, Difference> block_input,
+              U (&items)[ItemsPerThread])
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_load_direct_blocked_vectorized(flat_id, block_input, items);
+    }
+
     template<class InputIterator>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void load(InputIterator block_input,
@@ -632,6 +749,43 @@ public:
         (void) storage;
         load(block_input, items, valid, out_of_bounds);
     }
+
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_masked(InputIterator block_input,
+                     T (&items)[ItemsPerThread],
+                     unsigned int mask)
+    {
+        using value_type = typename std::iterator_traits<InputIterator>::value_type;
+        static_assert(std::is_convertible<value_type, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_load_direct_blocked_masked(flat_id, block_input, items, mask);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_masked(T* block_input,
+                     T (&items)[ItemsPerThread],
+                     unsigned int mask)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_load_direct_blocked_vectorized_masked(flat_id, block_input, items, mask);
+    }
+
+    template<class InputIterator,
+             class FlagIterator,
+             class = detail::enable_if_flag_iterator_t<FlagIterator>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_masked(InputIterator block_input,
+                     T (&items)[ItemsPerThread],
+                     FlagIterator flags)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        bool item_flags[ItemsPerThread];
+        block_load_direct_blocked(flat_id, flags, item_flags);
+        load_masked(block_input, items, detail::flags_to_item_mask(item_flags));
+    }
 };
 
 template<
@@ -660,10 +814,9 @@ public:
         static_assert(std::is_convertible<value_type, T>::value,
                       "The type T must be such that an object of type InputIterator "
                       "can be dereferenced and then implicitly converted to T.");
-        ROCPRIM_SHARED_MEMORY storage_type storage;
         const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
         block_load_direct_striped<BlockSize>(flat_id, block_input, items);
-        block_exchange_type().striped_to_blocked(items, items, storage);
+        block_exchange_type().striped_to_blocked(items, items);
     }
 
     template<class InputIterator>
@@ -676,10 +829,9 @@ public:
         static_assert(std::is_convertible<value_type, T>::value,
                       "The type T must be such that an object of type InputIterator "
                       "can be dereferenced and then implicitly converted to T.");
-        ROCPRIM_SHARED_MEMORY storage_type storage;
         const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
         block_load_direct_striped<BlockSize>(flat_id, block_input, items, valid);
-        block_exchange_type().striped_to_blocked(items, items, storage);
+        block_exchange_type().striped_to_blocked(items, items);
     }
 
     template<
@@ -696,11 +848,10 @@ public:
         static_assert(std::is_convertible<value_type, T>::value,
                       "The type T must be such that an object of type InputIterator "
                       "can be dereferenced and then implicitly converted to T.");
-        ROCPRIM_SHARED_MEMORY storage_type storage;
         const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
         block_load_direct_striped<BlockSize>(flat_id, block_input, items, valid,
                                              out_of_bounds);
-        block_exchange_type().striped_to_blocked(items, items, storage);
+        block_exchange_type().striped_to_blocked(items, items);
     }
 
     template<class InputIterator>
@@ -881,6 +1032,236 @@ public:
     }
 };
 
+template<
+    class T,
+    unsigned int BlockSizeX,
+    unsigned int ItemsPerThread,
+    unsigned int BlockSizeY,
+    unsigned int BlockSizeZ
+>
+class block_load<T, BlockSizeX, ItemsPerThread, block_load_method::block_load_direct_to_lds, BlockSizeY, BlockSizeZ>
+{
+    static constexpr unsigned int BlockSize = BlockSizeX * BlockSizeY * BlockSizeZ;
+
+private:
+    using block_exchange_type = block_exchange<T, BlockSize, ItemsPerThread>;
+
+    union storage_type_
+    {
+        typename block_exchange_type::storage_type            exchange;
+        uninitialized_array<T, BlockSize * ItemsPerThread, 16> items;
+    };
+
+public:
+    using storage_type = storage_type_;
+
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void load(InputIterator block_input,
+              T (&items)[ItemsPerThread])
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        load(block_input, items, storage);
+    }
+
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void load(InputIterator block_input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid)
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        load(block_input, items, valid, storage);
+    }
+
+    template<
+        class InputIterator,
+        class Default
+    >
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void load(InputIterator block_input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid,
+              Default out_of_bounds)
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        load(block_input, items, valid, out_of_bounds, storage);
+    }
+
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator block_input,
+              T (&items)[ItemsPerThread],
+              storage_type& storage)
+    {
+        load_impl(use_lds_loads<InputIterator>{}, block_input, items, storage);
+    }
+
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator block_input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid,
+              storage_type& storage)
+    {
+        load_impl(use_lds_loads<InputIterator>{}, block_input, items, valid, storage);
+    }
+
+    template<
+        class InputIterator,
+        class Default
+    >
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load(InputIterator block_input,
+              T (&items)[ItemsPerThread],
+              unsigned int valid,
+              Default out_of_bounds,
+              storage_type& storage)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; ++item)
+        {
+            items[item] = static_cast<T>(out_of_bounds);
+        }
+        load(block_input, items, valid, storage);
+    }
+
+    /// \brief Starts copying the items of the block from \p block_input to \p storage without
+    /// waiting for the copies.
+    ///
+    /// The threads may do other work that does not use \p storage before they call \p wait.
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_async(InputIterator block_input,
+                    storage_type& storage)
+    {
+        check_input_type<InputIterator>();
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        detail::block_load_to_lds_async<BlockSize, ItemsPerThread, false>(
+            flat_id, block_input, storage.items.get_unsafe_array(), BlockSize * ItemsPerThread);
+    }
+
+    /// \brief Starts copying the first \p valid items of the block from \p block_input to
+    /// \p storage without waiting for the copies.
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_async(InputIterator block_input,
+                    unsigned int valid,
+                    storage_type& storage)
+    {
+        check_input_type<InputIterator>();
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        detail::block_load_to_lds_async<BlockSize, ItemsPerThread, true>(
+            flat_id, block_input, storage.items.get_unsafe_array(), valid);
+    }
+
+    /// \brief Waits for the copies started by \p load_async of all threads of the block
+    /// (a barrier), and reads a blocked arrangement of the items from \p storage.
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void wait(T (&items)[ItemsPerThread],
+              storage_type& storage)
+    {
+        detail::block_load_to_lds_wait();
+        read_blocked(items, BlockSize * ItemsPerThread, storage);
+    }
+
+    /// \brief Waits for the copies started by \p load_async of all threads of the block
+    /// (a barrier), and reads the first \p valid items in a blocked arrangement from \p storage.
+    /// The other items are not changed.
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void wait(T (&items)[ItemsPerThread],
+              unsigned int valid,
+              storage_type& storage)
+    {
+        detail::block_load_to_lds_wait();
+        read_blocked(items, valid, storage);
+    }
+
+private:
+    template<class InputIterator>
+    using use_lds_loads = detail::use_global_load_lds<T, BlockSize, InputIterator>;
+
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void check_input_type()
+    {
+        using value_type = typename std::iterator_traits<InputIterator>::value_type;
+        static_assert(std::is_convertible<value_type, T>::value,
+                      "The type T must be such that an object of type InputIterator "
+                      "can be dereferenced and then implicitly converted to T.");
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void read_blocked(T (&items)[ItemsPerThread],
+                      const unsigned int valid,
+                      storage_type& storage)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const auto& buffer = storage.items.get_unsafe_array();
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < ItemsPerThread; ++item)
+        {
+            const unsigned int index = flat_id * ItemsPerThread + item;
+            if(index < valid)
+            {
+                items[item] = buffer[index];
+            }
+        }
+    }
+
+    // Direct-to-LDS loads
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_impl(std::true_type,
+                   InputIterator block_input,
+                   T (&items)[ItemsPerThread],
+                   storage_type& storage)
+    {
+        load_async(block_input, storage);
+        wait(items, storage);
+    }
+
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_impl(std::true_type,
+                   InputIterator block_input,
+                   T (&items)[ItemsPerThread],
+                   unsigned int valid,
+                   storage_type& storage)
+    {
+        load_async(block_input, valid, storage);
+        wait(items, valid, storage);
+    }
+
+    // The fallback is block_load_transpose
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_impl(std::false_type,
+                   InputIterator block_input,
+                   T (&items)[ItemsPerThread],
+                   storage_type& storage)
+    {
+        check_input_type<InputIterator>();
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_load_direct_striped<BlockSize>(flat_id, block_input, items);
+        block_exchange_type().striped_to_blocked(items, items, storage.exchange);
+    }
+
+    template<class InputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_impl(std::false_type,
+                   InputIterator block_input,
+                   T (&items)[ItemsPerThread],
+                   unsigned int valid,
+                   storage_type& storage)
+    {
+        check_input_type<InputIterator>();
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_load_direct_striped<BlockSize>(flat_id, block_input, items, valid);
+        block_exchange_type().striped_to_blocked(items, items, storage.exchange);
+    }
+};
+
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
 END_ROCPRIM_NAMESPACE
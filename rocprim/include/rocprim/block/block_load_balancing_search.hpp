@@ -0,0 +1,281 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_BLOCK_BLOCK_LOAD_BALANCING_SEARCH_HPP_
+#define ROCPRIM_BLOCK_BLOCK_LOAD_BALANCING_SEARCH_HPP_
+
+#include "../config.hpp"
+#include "../detail/merge_path.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../intrinsics/thread.hpp"
+#include "../iterator/counting_iterator.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The \p block_load_balancing_search class is a block level parallel primitive which
+/// maps work items back to the segments that produce them.
+///
+/// The work of a set of segments is given by the begin offsets of the segments, the exclusive
+/// scan of the numbers of work items of the segments, for example the row offsets of a CSR
+/// matrix. A work item \p w belongs to the last segment whose begin offset is not greater
+/// than \p w, and its rank is its position within the segment.
+///
+/// \par Overview
+/// * The work items and the begin offsets of the segments are merged into one sequence of
+/// <tt>total_work + num_segments</tt> items, in which every segment begin precedes its work
+/// items. A tile is <tt>BlockSize * ItemsPerThread</tt> items of this sequence, found by a
+/// merge-path search, so every tile has the same cost however the work is distributed over
+/// the segments, also when there are many empty segments.
+/// * \p search processes one tile without intermediate arrays in global memory: it reads the
+/// begin offsets of the segments of the tile into shared memory and returns the segment and
+/// rank of every work item of the tile, in a blocked arrangement.
+/// * The number of work items of a tile is at most the tile size, and varies with the number of
+/// segments that begin in the tile.
+/// * The begin offsets must be non-decreasing and the first must be \p 0.
+///
+/// \tparam BlockSize - the number of threads in a block.
+/// \tparam ItemsPerThread - the number of items of the merged sequence processed by each
+/// thread, and the number of work items each thread returns at most.
+/// \tparam OffsetT - the type of the offsets, the segment ids and the ranks. It must hold
+/// <tt>total_work + num_segments</tt>.
+///
+/// \par Example
+/// \parblock
+/// Expanding the rows of a CSR matrix, one tile per block:
+/// \code{.cpp}
+/// __global__ void example_kernel(const unsigned int* row_offsets, unsigned int rows,
+///                                unsigned int nonzeros, ...)
+/// {
+///     using search_type = rocprim::block_load_balancing_search<256, 4>;
+///     __shared__ search_type::storage_type storage;
+///
+///     unsigned int rows_of_items[4];
+///     unsigned int ranks[4];
+///     unsigned int work_begin;
+///     const unsigned int work_items = search_type().search(row_offsets, rows, nonzeros,
+///                                                          blockIdx.x, rows_of_items, ranks,
+///                                                          work_begin, storage);
+///     for(unsigned int i = 0; i < 4; ++i)
+///     {
+///         const unsigned int item = threadIdx.x * 4 + i;
+///         if(item < work_items)
+///         {
+///             // the nonzero work_begin + item is in row rows_of_items[i], at column index
+///             // ranks[i] of the row
+///         }
+///     }
+/// }
+/// \endcode
+/// \endparblock
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class OffsetT = unsigned int>
+class block_load_balancing_search
+{
+    static_assert(ItemsPerThread > 0, "ItemsPerThread must be greater than 0");
+
+    static constexpr unsigned int tile_size = BlockSize * ItemsPerThread;
+
+    struct storage_type_
+    {
+        // The begin offsets of the segment before the tile and of the segments of the tile
+        OffsetT begins[tile_size + 1];
+        // The segment of every work item of the tile, relative to begins
+        OffsetT segments[tile_size];
+        // The segment begins consumed before the tile and up to its end
+        OffsetT split[2];
+    };
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implementation the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    using storage_type = storage_type_;
+
+    /// The number of items of the merged sequence of a tile.
+    static constexpr unsigned int items_per_tile = tile_size;
+
+    /// \brief Returns the number of tiles of \p total_work work items over \p num_segments
+    /// segments.
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE static OffsetT number_of_tiles(const OffsetT num_segments,
+                                                                       const OffsetT total_work)
+    {
+        return ::rocprim::detail::ceiling_div(num_segments + total_work, OffsetT(tile_size));
+    }
+
+    /// \brief Maps the work items of the tile \p tile_index to their segments.
+    ///
+    /// \tparam SegmentOffsetsIterator - [inferred] random-access iterator type of the begin
+    /// offsets of the segments.
+    ///
+    /// \param [in] segment_offsets - the begin offsets of the segments.
+    /// \param [in] num_segments - the number of segments.
+    /// \param [in] total_work - the number of work items of all segments.
+    /// \param [in] tile_index - the tile, less than \p number_of_tiles.
+    /// \param [out] segment_ids - the segment of the work item <tt>work_begin +
+    /// flat_block_thread_id * ItemsPerThread + i</tt> in \p segment_ids[i].
+    /// \param [out] ranks - the position of the same work item within its segment.
+    /// \param [out] work_begin - the first work item of the tile.
+    /// \param [in] storage - reference to a temporary storage object of type \p storage_type.
+    /// \returns The number of work items of the tile. The outputs of the items past it are
+    /// not set.
+    ///
+    /// \par Storage reuse
+    /// A synchronization barrier should be inserted before \p storage is reused.
+    template<class SegmentOffsetsIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE OffsetT search(SegmentOffsetsIterator segment_offsets,
+                                                 const OffsetT          num_segments,
+                                                 const OffsetT          total_work,
+                                                 const OffsetT          tile_index,
+                                                 OffsetT (&segment_ids)[ItemsPerThread],
+                                                 OffsetT (&ranks)[ItemsPerThread],
+                                                 OffsetT&               work_begin,
+                                                 storage_type&          storage)
+    {
+        const unsigned int flat_id   = ::rocprim::flat_block_thread_id();
+        const OffsetT      merged    = num_segments + total_work;
+        const OffsetT      tile_diag = tile_index * OffsetT(tile_size);
+
+        // The merge path of the segment begins and the work items at the bounds of the tile,
+        // where a segment begin precedes the work items of equal value
+        if(flat_id < 2)
+        {
+            const OffsetT diag = ::rocprim::min(tile_diag + flat_id * OffsetT(tile_size), merged);
+            storage.split[flat_id] = ::rocprim::detail::merge_path(segment_offsets,
+                                                                   counting_iterator<OffsetT>(0),
+                                                                   num_segments,
+                                                                   total_work,
+                                                                   diag,
+                                                                   ::rocprim::less<OffsetT>());
+        }
+        ::rocprim::syncthreads();
+
+        const OffsetT segment_begin = storage.split[0];
+        const OffsetT segment_end   = storage.split[1];
+        const OffsetT tile_end      = ::rocprim::min(tile_diag + OffsetT(tile_size), merged);
+        work_begin                  = tile_diag - segment_begin;
+        const OffsetT work_items    = tile_end - segment_end - work_begin;
+        const OffsetT segments      = segment_end - segment_begin;
+
+        // begins[j] is the begin of the segment segment_begin - 1 + j, the first is the segment
+        // of the work items of the tile that precede all segment begins of the tile
+        for(OffsetT j = flat_id; j <= segments; j += BlockSize)
+        {
+            storage.begins[j] = segment_begin + j == 0
+                                    ? OffsetT(0)
+                                    : static_cast<OffsetT>(segment_offsets[segment_begin + j - 1]);
+        }
+        ::rocprim::syncthreads();
+
+        // The merge path of the thread within the tile
+        const OffsetT diag
+            = ::rocprim::min(OffsetT(flat_id * ItemsPerThread), segments + work_items);
+        OffsetT segment = ::rocprim::detail::merge_path(storage.begins + 1,
+                                                        counting_iterator<OffsetT>(work_begin),
+                                                        segments,
+                                                        work_items,
+                                                        diag,
+                                                        ::rocprim::less<OffsetT>());
+        OffsetT work    = diag - segment;
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const bool take_segment
+                = segment < segments
+                  && (work >= work_items || storage.begins[segment + 1] <= work_begin + work);
+            if(take_segment)
+            {
+                ++segment;
+            }
+            else if(work < work_items)
+            {
+                storage.segments[work] = segment;
+                ++work;
+            }
+        }
+        ::rocprim::syncthreads();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const OffsetT item = flat_id * ItemsPerThread + i;
+            if(item < work_items)
+            {
+                const OffsetT segment_of_item = storage.segments[item];
+                segment_ids[i] = segment_begin - 1 + segment_of_item;
+                ranks[i]       = work_begin + item - storage.begins[segment_of_item];
+            }
+        }
+        return work_items;
+    }
+
+    /// \brief Maps the work items of the tile \p tile_index to their segments, without their
+    /// ranks.
+    ///
+    /// \tparam SegmentOffsetsIterator - [inferred] random-access iterator type of the begin
+    /// offsets of the segments.
+    ///
+    /// \param [in] segment_offsets - the begin offsets of the segments.
+    /// \param [in] num_segments - the number of segments.
+    /// \param [in] total_work - the number of work items of all segments.
+    /// \param [in] tile_index - the tile, less than \p number_of_tiles.
+    /// \param [out] segment_ids - the segment of the work item <tt>work_begin +
+    /// flat_block_thread_id * ItemsPerThread + i</tt> in \p segment_ids[i].
+    /// \param [out] work_begin - the first work item of the tile.
+    /// \param [in] storage - reference to a temporary storage object of type \p storage_type.
+    /// \returns The number of work items of the tile. The outputs of the items past it are
+    /// not set.
+    ///
+    /// \par Storage reuse
+    /// A synchronization barrier should be inserted before \p storage is reused.
+    template<class SegmentOffsetsIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE OffsetT search(SegmentOffsetsIterator segment_offsets,
+                                                 const OffsetT          num_segments,
+                                                 const OffsetT          total_work,
+                                                 const OffsetT          tile_index,
+                                                 OffsetT (&segment_ids)[ItemsPerThread],
+                                                 OffsetT&               work_begin,
+                                                 storage_type&          storage)
+    {
+        OffsetT ranks[ItemsPerThread];
+        return search(segment_offsets,
+                      num_segments,
+                      total_work,
+                      tile_index,
+                      segment_ids,
+                      ranks,
+                      work_begin,
+                      storage);
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_LOAD_BALANCING_SEARCH_HPP_
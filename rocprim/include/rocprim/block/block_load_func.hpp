@@ -28,6 +28,17 @@
 #include "../functional.hpp"
 #include "../types.hpp"
 
+#include "../iterator/cache_modified_input_iterator.hpp"
+#include "../iterator/packed_bits_iterator.hpp"
+#include "../iterator/permutation_iterator.hpp"
+
+#include "detail/block_item_mask.hpp"
+#include "detail/block_load_store_vector.hpp"
+
+#include <type_traits>
+
+#include <cstdint>
+
 /// \addtogroup blockmodule
 /// @{
 
@@ -150,6 +161,80 @@ void block_load_direct_blocked(unsigned int flat_id,
     block_load_direct_blocked(flat_id, block_input, items, valid);
 }
 
+namespace detail
+{
+
+template<bool NonTemporal, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto block_load_direct_blocked_vectorized_impl(unsigned int flat_id,
+                                               T*           block_input,
+                                               U (&items)[ItemsPerThread]) ->
+    typename std::enable_if<is_thread_bytes_vectorizable<typename std::remove_cv<T>::type,
+                                                         ItemsPerThread>::value>::type
+{
+    using raw_type = typename std::remove_cv<T>::type;
+
+    raw_type raw_items[ItemsPerThread];
+    load_thread_bytes<NonTemporal>(block_input + flat_id * ItemsPerThread, raw_items);
+
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = raw_items[item];
+    }
+}
+
+template<bool NonTemporal, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto block_load_direct_blocked_vectorized_impl(unsigned int flat_id,
+                                               T*           block_input,
+                                               U (&items)[ItemsPerThread]) ->
+    typename std::enable_if<!is_thread_bytes_vectorizable<typename std::remove_cv<T>::type,
+                                                          ItemsPerThread>::value
+                            && is_vectorizable<T, ItemsPerThread>::value>::type
+{
+    typedef typename match_vector_type<T, ItemsPerThread>::type vector_type;
+    constexpr unsigned int vectors_per_thread = (sizeof(T) * ItemsPerThread) / sizeof(vector_type);
+
+    // The alignment is the same for all threads of the block
+    if(reinterpret_cast<uintptr_t>(block_input) % alignof(vector_type) != 0)
+    {
+        block_load_direct_blocked(flat_id, block_input, items);
+        return;
+    }
+
+    vector_type vector_items[vectors_per_thread];
+
+    const vector_type* vector_ptr = reinterpret_cast<const vector_type*>(block_input) +
+        (flat_id * vectors_per_thread);
+
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < vectors_per_thread; item++)
+    {
+        vector_items[item] = *(vector_ptr + item);
+    }
+
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = *(reinterpret_cast<T*>(vector_items) + item);
+    }
+}
+
+template<bool NonTemporal, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto block_load_direct_blocked_vectorized_impl(unsigned int flat_id,
+                                               T*           block_input,
+                                               U (&items)[ItemsPerThread]) ->
+    typename std::enable_if<!is_thread_bytes_vectorizable<typename std::remove_cv<T>::type,
+                                                          ItemsPerThread>::value
+                            && !is_vectorizable<T, ItemsPerThread>::value>::type
+{
+    block_load_direct_blocked(flat_id, block_input, items);
+}
+
+} // end namespace detail
+
 /// \brief Loads data from continuous memory into a blocked arrangement of items
 /// across the thread block.
 ///
@@ -157,13 +242,14 @@ void block_load_direct_blocked(unsigned int flat_id,
 /// across a thread block. Each thread uses a \p flat_id to load a range of
 /// \p ItemsPerThread into \p items.
 ///
-/// The input offset (\p block_input + offset) must be quad-item aligned.
+/// The items of a thread are loaded as raw bytes with the widest loads (up to 128 bits) that
+/// their size allows, so packed types such as 6- or 12-byte structs are vectorized as well.
+/// This requires the datatype \p T to be trivially copyable, and the items of a thread to be
+/// at least 4 bytes. If the input offset (\p block_input + offset) is not aligned to these
+/// loads, the aligned 32-bit words covering the items are loaded and shifted into place instead.
 ///
-/// The following conditions will prevent vectorization and switch to default
-/// block_load_direct_blocked:
-/// * \p ItemsPerThread is odd.
-/// * The datatype \p T is not a primitive or a HIP vector type (e.g. int2,
-/// int4, etc.
+/// Smaller items are loaded with HIP vector types if they are vectorizable and the input offset
+/// is quad-item aligned, otherwise with block_load_direct_blocked.
 ///
 /// \tparam T - [inferred] the input data type
 /// \tparam U - [inferred] the output data type
@@ -181,43 +267,78 @@ template<
     unsigned int ItemsPerThread
 >
 ROCPRIM_DEVICE ROCPRIM_INLINE
-auto
-block_load_direct_blocked_vectorized(unsigned int flat_id,
-                                     T* block_input,
-                                     U (&items)[ItemsPerThread]) -> typename std::enable_if<detail::is_vectorizable<T, ItemsPerThread>::value>::type
+void block_load_direct_blocked_vectorized(unsigned int flat_id,
+                                          T* block_input,
+                                          U (&items)[ItemsPerThread])
 {
-    typedef typename detail::match_vector_type<T, ItemsPerThread>::type vector_type;
-    constexpr unsigned int vectors_per_thread = (sizeof(T) * ItemsPerThread) / sizeof(vector_type);
-    vector_type vector_items[vectors_per_thread];
-
-    const vector_type* vector_ptr = reinterpret_cast<const vector_type*>(block_input) +
-        (flat_id * vectors_per_thread);
-
-    ROCPRIM_UNROLL
-    for (unsigned int item = 0; item < vectors_per_thread; item++)
-    {
-        vector_items[item] = *(vector_ptr + item);
-    }
+    detail::block_load_direct_blocked_vectorized_impl<false>(flat_id, block_input, items);
+}
 
-    ROCPRIM_UNROLL
-    for (unsigned int item = 0; item < ItemsPerThread; item++)
-    {
-        items[item] = *(reinterpret_cast<T*>(vector_items) + item);
-    }
+/// \brief Loads data from continuous memory into a blocked arrangement of items
+/// across the thread block with nontemporal loads.
+///
+/// Same as block_load_direct_blocked_vectorized, but the vectorized loads are nontemporal
+/// (streaming) loads, which do not keep the input in the caches where the architecture allows.
+/// Use it for input that is read only once, so that it does not evict data that is reused.
+///
+/// \tparam T - [inferred] the input data type
+/// \tparam U - [inferred] the output data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<
+    class T,
+    class U,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked_nontemporal(unsigned int flat_id,
+                                           T* block_input,
+                                           U (&items)[ItemsPerThread])
+{
+    detail::block_load_direct_blocked_vectorized_impl<true>(flat_id, block_input, items);
 }
 
+/// \brief Loads data from continuous memory into a blocked arrangement of items
+/// across the thread block, with the load modifier of a cache_modified_input_iterator.
+///
+/// With \p load_cs the items are loaded as by block_load_direct_blocked_nontemporal from the
+/// wrapped pointer, otherwise as by block_load_direct_blocked.
+///
+/// \tparam T - [inferred] the input data type
+/// \tparam Modifier - [inferred] the cache load modifier of the iterator
+/// \tparam Difference - [inferred] the difference type of the iterator
+/// \tparam U - [inferred] the output data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
 template<
     class T,
+    cache_load_modifier Modifier,
+    class Difference,
     class U,
     unsigned int ItemsPerThread
 >
 ROCPRIM_DEVICE ROCPRIM_INLINE
-auto
-block_load_direct_blocked_vectorized(unsigned int flat_id,
-                                     T* block_input,
-                                     U (&items)[ItemsPerThread]) -> typename std::enable_if<!detail::is_vectorizable<T, ItemsPerThread>::value>::type
+void block_load_direct_blocked_vectorized(
+    unsigned int                                          flat_id,
+    cache_modified_input_iterator<T, Modifier, Difference> block_input,
+    U (&items)[ItemsPerThread])
 {
-    block_load_direct_blocked(flat_id, block_input, items);
+    if ROCPRIM_IF_CONSTEXPR(Modifier == load_cs)
+    {
+        block_load_direct_blocked_nontemporal(flat_id, block_input.base(), items);
+    }
+    else
+    {
+        block_load_direct_blocked(flat_id, block_input, items);
+    }
 }
 
 /// \brief Loads data from continuous memory into a striped arrangement of items
@@ -505,6 +626,418 @@ void block_load_direct_warp_striped(unsigned int flat_id,
     block_load_direct_warp_striped<WarpSize>(flat_id, block_input, items, valid);
 }
 
+/// \brief Loads data from a packed_bits_iterator into a blocked arrangement of items
+/// across the thread block.
+///
+/// The full words that hold the items of the thread are loaded and the items are decoded in
+/// registers.
+///
+/// \tparam Bits - [inferred] the number of bits of an item
+/// \tparam ValueType - [inferred] the value type of the iterator
+/// \tparam Difference - [inferred] the difference type of the iterator
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<unsigned int Bits,
+         class ValueType,
+         class Difference,
+         class T,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked(unsigned int                                      flat_id,
+                               packed_bits_iterator<Bits, ValueType, Difference> block_input,
+                               T (&items)[ItemsPerThread])
+{
+    detail::packed_bits_load<Bits, ValueType>(block_input.words(),
+                                              block_input.index() + flat_id * ItemsPerThread,
+                                              ItemsPerThread,
+                                              items);
+}
+
+/// \brief Loads data from a packed_bits_iterator into a blocked arrangement of items
+/// across the thread block, which is guarded by range \p valid.
+///
+/// The full words that hold the valid items of the thread are loaded and the items are decoded
+/// in registers.
+///
+/// \tparam Bits - [inferred] the number of bits of an item
+/// \tparam ValueType - [inferred] the value type of the iterator
+/// \tparam Difference - [inferred] the difference type of the iterator
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+/// \param valid - maximum range of valid numbers to load
+template<unsigned int Bits,
+         class ValueType,
+         class Difference,
+         class T,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked(unsigned int                                      flat_id,
+                               packed_bits_iterator<Bits, ValueType, Difference> block_input,
+                               T (&items)[ItemsPerThread],
+                               unsigned int                                      valid)
+{
+    const unsigned int offset = flat_id * ItemsPerThread;
+    const unsigned int count  = valid > offset ? ::rocprim::min(valid - offset, ItemsPerThread) : 0;
+    detail::packed_bits_load<Bits, ValueType>(block_input.words(),
+                                              block_input.index() + offset,
+                                              count,
+                                              items);
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace detail
+{
+
+// The gathers of all items are issued after the indices are loaded, so that they are in flight
+// at the same time
+template<class ValueIterator, class Index, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_gather(ValueIterator values,
+                       const Index (&indices)[ItemsPerThread],
+                       T (&items)[ItemsPerThread])
+{
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = values[indices[item]];
+    }
+}
+
+// Item i of the thread is at position first + i * stride of the tile
+template<class ValueIterator, class Index, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_gather(ValueIterator values,
+                       const Index (&indices)[ItemsPerThread],
+                       T (&items)[ItemsPerThread],
+                       const unsigned int first,
+                       const unsigned int stride,
+                       const unsigned int valid)
+{
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        if(first + item * stride < valid)
+        {
+            items[item] = values[indices[item]];
+        }
+    }
+}
+
+} // namespace detail
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// \brief Gathers data through a permutation_iterator into a blocked arrangement of items
+/// across the thread block.
+///
+/// The indices of all items of the thread are loaded first, then all values are gathered.
+///
+/// \tparam ValueIterator - [inferred] the value iterator type of the permutation_iterator
+/// \tparam IndexIterator - [inferred] the index iterator type of the permutation_iterator
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<class ValueIterator, class IndexIterator, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked(unsigned int                                       flat_id,
+                               permutation_iterator<ValueIterator, IndexIterator> block_input,
+                               T (&items)[ItemsPerThread])
+{
+    using index_type = typename permutation_iterator<ValueIterator, IndexIterator>::index_type;
+    index_type indices[ItemsPerThread];
+    block_load_direct_blocked(flat_id, block_input.base(), indices);
+    detail::block_load_gather(block_input.values(), indices, items);
+}
+
+/// \brief Gathers data through a permutation_iterator into a blocked arrangement of items
+/// across the thread block, which is guarded by range \p valid.
+///
+/// The indices of all items of the thread are loaded first, then all values are gathered.
+///
+/// \tparam ValueIterator - [inferred] the value iterator type of the permutation_iterator
+/// \tparam IndexIterator - [inferred] the index iterator type of the permutation_iterator
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+/// \param valid - maximum range of valid numbers to load
+template<class ValueIterator, class IndexIterator, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked(unsigned int                                       flat_id,
+                               permutation_iterator<ValueIterator, IndexIterator> block_input,
+                               T (&items)[ItemsPerThread],
+                               unsigned int                                       valid)
+{
+    using index_type = typename permutation_iterator<ValueIterator, IndexIterator>::index_type;
+    index_type indices[ItemsPerThread];
+    block_load_direct_blocked(flat_id, block_input.base(), indices, valid);
+    detail::block_load_gather(block_input.values(),
+                              indices,
+                              items,
+                              flat_id * ItemsPerThread,
+                              1,
+                              valid);
+}
+
+/// \brief Gathers data through a permutation_iterator into a striped arrangement of items
+/// across the thread block.
+///
+/// The indices of all items of the thread are loaded first, then all values are gathered.
+///
+/// \tparam BlockSize - the number of threads in a block
+/// \tparam ValueIterator - [inferred] the value iterator type of the permutation_iterator
+/// \tparam IndexIterator - [inferred] the index iterator type of the permutation_iterator
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<unsigned int BlockSize,
+         class ValueIterator,
+         class IndexIterator,
+         class T,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_striped(unsigned int                                       flat_id,
+                               permutation_iterator<ValueIterator, IndexIterator> block_input,
+                               T (&items)[ItemsPerThread])
+{
+    using index_type = typename permutation_iterator<ValueIterator, IndexIterator>::index_type;
+    index_type indices[ItemsPerThread];
+    block_load_direct_striped<BlockSize>(flat_id, block_input.base(), indices);
+    detail::block_load_gather(block_input.values(), indices, items);
+}
+
+/// \brief Gathers data through a permutation_iterator into a striped arrangement of items
+/// across the thread block, which is guarded by range \p valid.
+///
+/// The indices of all items of the thread are loaded first, then all values are gathered.
+///
+/// \tparam BlockSize - the number of threads in a block
+/// \tparam ValueIterator - [inferred] the value iterator type of the permutation_iterator
+/// \tparam IndexIterator - [inferred] the index iterator type of the permutation_iterator
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+/// \param valid - maximum range of valid numbers to load
+template<unsigned int BlockSize,
+         class ValueIterator,
+         class IndexIterator,
+         class T,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_striped(unsigned int                                       flat_id,
+                               permutation_iterator<ValueIterator, IndexIterator> block_input,
+                               T (&items)[ItemsPerThread],
+                               unsigned int                                       valid)
+{
+    using index_type = typename permutation_iterator<ValueIterator, IndexIterator>::index_type;
+    index_type indices[ItemsPerThread];
+    block_load_direct_striped<BlockSize>(flat_id, block_input.base(), indices, valid);
+    detail::block_load_gather(block_input.values(), indices, items, flat_id, BlockSize, valid);
+}
+
+/// \brief Gathers data through a permutation_iterator into a warp-striped arrangement of items
+/// across the thread block.
+///
+/// \ingroup blockmodule_warp_load_functions
+/// The indices of all items of the thread are loaded first, then all values are gathered.
+///
+/// \tparam WarpSize - [optional] the number of threads in a warp
+/// \tparam ValueIterator - [inferred] the value iterator type of the permutation_iterator
+/// \tparam IndexIterator - [inferred] the index iterator type of the permutation_iterator
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<unsigned int WarpSize = device_warp_size(),
+         class ValueIterator,
+         class IndexIterator,
+         class T,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_warp_striped(unsigned int                                       flat_id,
+                                    permutation_iterator<ValueIterator, IndexIterator> block_input,
+                                    T (&items)[ItemsPerThread])
+{
+    using index_type = typename permutation_iterator<ValueIterator, IndexIterator>::index_type;
+    index_type indices[ItemsPerThread];
+    block_load_direct_warp_striped<WarpSize>(flat_id, block_input.base(), indices);
+    detail::block_load_gather(block_input.values(), indices, items);
+}
+
+/// \brief Gathers data through a permutation_iterator into a warp-striped arrangement of items
+/// across the thread block, which is guarded by range \p valid.
+///
+/// \ingroup blockmodule_warp_load_functions
+/// The indices of all items of the thread are loaded first, then all values are gathered.
+///
+/// \tparam WarpSize - [optional] the number of threads in a warp
+/// \tparam ValueIterator - [inferred] the value iterator type of the permutation_iterator
+/// \tparam IndexIterator - [inferred] the index iterator type of the permutation_iterator
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+/// \param valid - maximum range of valid numbers to load
+template<unsigned int WarpSize = device_warp_size(),
+         class ValueIterator,
+         class IndexIterator,
+         class T,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_warp_striped(unsigned int                                       flat_id,
+                                    permutation_iterator<ValueIterator, IndexIterator> block_input,
+                                    T (&items)[ItemsPerThread],
+                                    unsigned int                                       valid)
+{
+    using index_type = typename permutation_iterator<ValueIterator, IndexIterator>::index_type;
+    index_type indices[ItemsPerThread];
+    block_load_direct_warp_striped<WarpSize>(flat_id, block_input.base(), indices, valid);
+    const unsigned int thread_id   = detail::logical_lane_id<WarpSize>();
+    const unsigned int warp_offset = flat_id / WarpSize * WarpSize * ItemsPerThread;
+    detail::block_load_gather(block_input.values(),
+                              indices,
+                              items,
+                              warp_offset + thread_id,
+                              WarpSize,
+                              valid);
+}
+
+/// \brief Loads the items selected by a mask from continuous memory into a blocked arrangement
+/// of items across the thread block.
+///
+/// Item \p i of the thread is loaded if bit \p i of \p mask is set, the other items are not
+/// changed. Only the selected items are read, so sparse masks need fewer memory transactions.
+///
+/// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+/// pointer
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread, at most 32
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+/// \param mask - the mask of the items of the thread to load
+template<class InputIterator, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked_masked(unsigned int  flat_id,
+                                      InputIterator block_input,
+                                      T (&items)[ItemsPerThread],
+                                      unsigned int  mask)
+{
+    static_assert(ItemsPerThread <= 32, "Masks of items support at most 32 items per thread");
+    InputIterator thread_iter = block_input + flat_id * ItemsPerThread;
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        if(mask & (1u << item))
+        {
+            items[item] = thread_iter[item];
+        }
+    }
+}
+
+/// \brief Loads the items selected by a mask from continuous memory into a blocked arrangement
+/// of items across the thread block, using vectorized loads where the mask is dense.
+///
+/// If all items of all threads of the warp are selected, the items are loaded as by
+/// block_load_direct_blocked_vectorized. Otherwise only the selected items are loaded as by
+/// block_load_direct_blocked_masked. The choice is made per warp, so the warps do not diverge.
+/// All threads of the warp must call the function.
+///
+/// \tparam T - [inferred] the input data type
+/// \tparam U - [inferred] the output data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread, at most 32
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input pointer from the thread block to load from
+/// \param items - array that data is loaded to
+/// \param mask - the mask of the items of the thread to load
+template<class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_blocked_vectorized_masked(unsigned int flat_id,
+                                                 T*           block_input,
+                                                 U (&items)[ItemsPerThread],
+                                                 unsigned int mask)
+{
+    constexpr unsigned int full_mask = detail::full_item_mask<ItemsPerThread>();
+    if(::rocprim::warp_all((mask & full_mask) == full_mask))
+    {
+        block_load_direct_blocked_vectorized(flat_id, block_input, items);
+    }
+    else
+    {
+        block_load_direct_blocked_masked(flat_id, block_input, items, mask);
+    }
+}
+
+/// \brief Loads the items selected by a mask from continuous memory into a striped arrangement
+/// of items across the thread block.
+///
+/// Item \p i of the thread, at offset <tt>i * BlockSize + flat_id</tt>, is loaded if bit \p i
+/// of \p mask is set, the other items are not changed.
+///
+/// \tparam BlockSize - the number of threads in a block
+/// \tparam InputIterator - [inferred] an iterator type for input (can be a simple
+/// pointer
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread, at most 32
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_input - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+/// \param mask - the mask of the items of the thread to load
+template<unsigned int BlockSize, class InputIterator, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_direct_striped_masked(unsigned int  flat_id,
+                                      InputIterator block_input,
+                                      T (&items)[ItemsPerThread],
+                                      unsigned int  mask)
+{
+    static_assert(ItemsPerThread <= 32, "Masks of items support at most 32 items per thread");
+    InputIterator thread_iter = block_input + flat_id;
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        if(mask & (1u << item))
+        {
+            items[item] = thread_iter[item * BlockSize];
+        }
+    }
+}
+
 END_ROCPRIM_NAMESPACE
 
 /// @}
@@ -0,0 +1,457 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_BLOCK_MERGE_HPP_
+#define ROCPRIM_BLOCK_BLOCK_MERGE_HPP_
+
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../detail/merge_path.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../intrinsics/thread.hpp"
+#include "../types.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The block_merge class is a block level parallel primitive which provides methods for
+/// merging two sorted sequences of items (keys or key-value pairs) into one sorted sequence
+/// partitioned across threads in a block.
+///
+/// \tparam Key - the key type.
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam ItemsPerThread - the number of items contributed by each thread.
+/// \tparam Value - the value type. Default type empty_type indicates a keys-only merge.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * Each thread finds on the merge path where its \p ItemsPerThread outputs begin, by a binary
+///   search of the co-rank of its output position over the two sequences (see \p co_rank),
+///   then merges them serially from shared memory. There is no block-wide sequential step.
+/// * The two sequences are given either in registers, as the first and the second part of the
+///   items of the block, or as two ranges in memory (for example shared memory filled by
+///   another primitive, or global memory), see \p merge and \p merge_ranges.
+/// * The merged items are in a blocked arrangement.
+/// * \p storage_type can be part of a union with the storage of other primitives.
+///
+/// \par Stability
+/// \p block_merge is \b stable: equivalent keys keep their relative order, and the keys of the
+/// first sequence precede the equivalent keys of the second sequence.
+///
+/// \par Examples
+/// \parblock
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     // merge two sorted runs of int keys across a block of 256 threads with 4 items each
+///     using block_merge_int = rocprim::block_merge<int, 256, 4>;
+///     __shared__ block_merge_int::storage_type storage;
+///
+///     // the first 300 items of the block are sorted, and so are the remaining 724
+///     int keys[4] = ...;
+///     block_merge_int().merge(keys, 300, 724, storage);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class Key,
+         unsigned int BlockSizeX,
+         unsigned int ItemsPerThread,
+         class Value             = empty_type,
+         unsigned int BlockSizeY = 1,
+         unsigned int BlockSizeZ = 1>
+class block_merge
+{
+    static constexpr unsigned int BlockSize     = BlockSizeX * BlockSizeY * BlockSizeZ;
+    static constexpr unsigned int ItemsPerBlock = BlockSize * ItemsPerThread;
+    static constexpr bool         with_values   = !std::is_same<Value, empty_type>::value;
+
+    // The values are gathered after the keys are merged, so they reuse the keys' shared memory.
+    union storage_type_
+    {
+        ROCPRIM_DETAIL_SUPPRESS_DEPRECATION_WITH_PUSH
+        detail::raw_storage<Key[ItemsPerBlock]>   keys;
+        detail::raw_storage<Value[ItemsPerBlock]> values;
+        ROCPRIM_DETAIL_SUPPRESS_DEPRECATION_POP
+    };
+
+public:
+/// \brief Struct used to allocate a temporary memory that is required for thread
+/// communication during operations provided by related parallel primitive.
+///
+/// Depending on the implemention the operations exposed by parallel primitive may
+/// require a temporary storage for thread communication. The storage should be allocated
+/// using keywords <tt>__shared__</tt>. It can be aliased to
+/// an externally allocated memory, or be a part of a union type with other storage types
+/// to increase shared memory reusability.
+#ifndef DOXYGEN_SHOULD_SKIP_THIS // hides storage_type implementation for Doxygen
+    ROCPRIM_DETAIL_SUPPRESS_DEPRECATION_WITH_PUSH
+    using storage_type = detail::raw_storage<storage_type_>;
+    ROCPRIM_DETAIL_SUPPRESS_DEPRECATION_POP
+#else
+    using storage_type = storage_type_; // only for Doxygen
+#endif
+
+    /// \brief Returns the number of items taken from the first sequence by the first
+    /// \p diagonal items of the merge of two sorted sequences.
+    ///
+    /// The rest of the first \p diagonal merged items, <tt>diagonal - co_rank(...)</tt>, are
+    /// taken from the second sequence. Threads can use it to find where their part of a merge
+    /// begins without merging the items before it.
+    ///
+    /// \tparam KeysInputIterator1 - [inferred] random-access iterator type of the first sequence.
+    /// \tparam KeysInputIterator2 - [inferred] random-access iterator type of the second sequence.
+    /// \tparam BinaryFunction - [inferred] type of the comparison function object.
+    ///
+    /// \param [in] diagonal - the number of merged items, at most <tt>size1 + size2</tt>.
+    /// \param [in] keys_input1 - iterator to the first item of the first sequence.
+    /// \param [in] size1 - the number of items in the first sequence.
+    /// \param [in] keys_input2 - iterator to the first item of the second sequence.
+    /// \param [in] size2 - the number of items in the second sequence.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second.
+    template<class KeysInputIterator1,
+             class KeysInputIterator2,
+             class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static unsigned int
+        co_rank(const unsigned int diagonal,
+                KeysInputIterator1 keys_input1,
+                const unsigned int size1,
+                KeysInputIterator2 keys_input2,
+                const unsigned int size2,
+                BinaryFunction     compare_function = BinaryFunction())
+    {
+        return detail::merge_path(keys_input1,
+                                  keys_input2,
+                                  size1,
+                                  size2,
+                                  diagonal,
+                                  compare_function);
+    }
+
+    /// \brief Merges the two sorted sequences formed by the keys of the block.
+    ///
+    /// \tparam BinaryFunction - [inferred] type of the comparison function object.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread, in a blocked
+    /// arrangement. The first \p size1 keys of the block form the first sorted sequence, the next
+    /// \p size2 keys form the second. On return the first <tt>size1 + size2</tt> keys of the block
+    /// are merged, the keys after them are unspecified.
+    /// \param [in] size1 - the number of items in the first sequence.
+    /// \param [in] size2 - the number of items in the second sequence. <tt>size1 + size2</tt>
+    /// must be at most <tt>BlockSize * ItemsPerThread</tt>.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge(Key (&keys)[ItemsPerThread],
+               const unsigned int size1,
+               const unsigned int size2,
+               storage_type&      storage,
+               BinaryFunction     compare_function = BinaryFunction())
+    {
+        empty_type values[ItemsPerThread];
+        merge_impl(keys, values, size1, size2, storage, compare_function);
+    }
+
+    /// \overload
+    /// \brief Merges the two sorted sequences formed by the keys of the block.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void merge(Key (&keys)[ItemsPerThread],
+               const unsigned int size1,
+               const unsigned int size2,
+               BinaryFunction     compare_function = BinaryFunction())
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        merge(keys, size1, size2, storage, compare_function);
+    }
+
+    /// \brief Merges the two sorted sequences formed by the key-value pairs of the block.
+    ///
+    /// \see block_merge::merge
+    template<bool WithValues = with_values, class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge(Key (&keys)[ItemsPerThread],
+               typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+               const unsigned int size1,
+               const unsigned int size2,
+               storage_type&      storage,
+               BinaryFunction     compare_function = BinaryFunction())
+    {
+        merge_impl(keys, values, size1, size2, storage, compare_function);
+    }
+
+    /// \overload
+    /// \brief Merges the two sorted sequences formed by the key-value pairs of the block.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    template<bool WithValues = with_values, class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void merge(Key (&keys)[ItemsPerThread],
+               typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+               const unsigned int size1,
+               const unsigned int size2,
+               BinaryFunction     compare_function = BinaryFunction())
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        merge(keys, values, size1, size2, storage, compare_function);
+    }
+
+    /// \brief Merges two sorted ranges of keys in memory into the keys of the block.
+    ///
+    /// The ranges are read once by the block, so they can be in global memory or in shared
+    /// memory outside of \p storage.
+    ///
+    /// \tparam KeysInputIterator1 - [inferred] random-access iterator type of the first range.
+    /// \tparam KeysInputIterator2 - [inferred] random-access iterator type of the second range.
+    /// \tparam BinaryFunction - [inferred] type of the comparison function object.
+    ///
+    /// \param [in] keys_input1 - iterator to the first key of the first range.
+    /// \param [in] size1 - the number of keys in the first range.
+    /// \param [in] keys_input2 - iterator to the first key of the second range.
+    /// \param [in] size2 - the number of keys in the second range. <tt>size1 + size2</tt>
+    /// must be at most <tt>BlockSize * ItemsPerThread</tt>.
+    /// \param [out] keys - reference to an array of the merged keys of a thread, in a blocked
+    /// arrangement. The keys after the first <tt>size1 + size2</tt> keys of the block are
+    /// unspecified.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is ordered before the second.
+    template<class KeysInputIterator1,
+             class KeysInputIterator2,
+             class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge_ranges(KeysInputIterator1 keys_input1,
+                      const unsigned int size1,
+                      KeysInputIterator2 keys_input2,
+                      const unsigned int size2,
+                      Key (&keys)[ItemsPerThread],
+                      storage_type&  storage,
+                      BinaryFunction compare_function = BinaryFunction())
+    {
+        Key* keys_shared = storage.get().keys.get();
+        load_ranges(keys_input1, size1, keys_input2, size2, keys_shared);
+
+        unsigned int indices[ItemsPerThread];
+        merge_shared(keys_shared, keys, indices, size1, size2, compare_function);
+    }
+
+    /// \brief Merges two sorted ranges of key-value pairs in memory into the key-value pairs
+    /// of the block.
+    ///
+    /// \see block_merge::merge_ranges
+    template<class KeysInputIterator1,
+             class ValuesInputIterator1,
+             class KeysInputIterator2,
+             class ValuesInputIterator2,
+             bool WithValues      = with_values,
+             class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge_ranges(KeysInputIterator1   keys_input1,
+                      ValuesInputIterator1 values_input1,
+                      const unsigned int   size1,
+                      KeysInputIterator2   keys_input2,
+                      ValuesInputIterator2 values_input2,
+                      const unsigned int   size2,
+                      Key (&keys)[ItemsPerThread],
+                      typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+                      storage_type&  storage,
+                      BinaryFunction compare_function = BinaryFunction())
+    {
+        Key* keys_shared = storage.get().keys.get();
+        load_ranges(keys_input1, size1, keys_input2, size2, keys_shared);
+
+        unsigned int indices[ItemsPerThread];
+        merge_shared(keys_shared, keys, indices, size1, size2, compare_function);
+
+        // The values are gathered from the inputs, which are not modified by the merge.
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            if(flat_id * ItemsPerThread + i < size1 + size2)
+            {
+                values[i] = indices[i] < size1 ? values_input1[indices[i]]
+                                               : values_input2[indices[i] - size1];
+            }
+        }
+    }
+
+private:
+    template<class KeysInputIterator1, class KeysInputIterator2>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void load_ranges(KeysInputIterator1 keys_input1,
+                     const unsigned int size1,
+                     KeysInputIterator2 keys_input2,
+                     const unsigned int size2,
+                     Key*               keys_shared)
+    {
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int index = BlockSize * i + flat_id;
+            if(index < size1)
+            {
+                keys_shared[index] = keys_input1[index];
+            }
+            else if(index < size1 + size2)
+            {
+                keys_shared[index] = keys_input2[index - size1];
+            }
+        }
+        ::rocprim::syncthreads();
+    }
+
+    // Merges the two sequences stored one after the other in keys_shared. indices are the
+    // positions of the merged keys in keys_shared.
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge_shared(Key* keys_shared,
+                      Key (&keys)[ItemsPerThread],
+                      unsigned int (&indices)[ItemsPerThread],
+                      const unsigned int size1,
+                      const unsigned int size2,
+                      BinaryFunction     compare_function)
+    {
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const unsigned int count = size1 + size2;
+        const unsigned int diag  = flat_id * ItemsPerThread;
+
+        // serial_merge reads the last item of a sequence after it is exhausted, and the threads
+        // past the end of the items would read before an empty one.
+        if(size1 == 0 || size2 == 0 || diag >= count)
+        {
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
+            {
+                indices[i] = ::rocprim::min(diag + i, count == 0 ? 0 : count - 1);
+                keys[i]    = keys_shared[indices[i]];
+            }
+        }
+        else
+        {
+            const unsigned int partition
+                = co_rank(diag, keys_shared, size1, keys_shared + size1, size2, compare_function);
+            const detail::range_t<> range{partition, size1, size1 + diag - partition, count};
+            detail::serial_merge<false>(keys_shared, keys, indices, range, compare_function);
+        }
+    }
+
+    template<class SortedValue, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void merge_impl(Key (&keys)[ItemsPerThread],
+                    SortedValue (&values)[ItemsPerThread],
+                    const unsigned int size1,
+                    const unsigned int size2,
+                    storage_type&      storage,
+                    BinaryFunction     compare_function)
+    {
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const unsigned int count = size1 + size2;
+
+        Key* keys_shared = storage.get().keys.get();
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int index = flat_id * ItemsPerThread + i;
+            if(index < count)
+            {
+                keys_shared[index] = keys[i];
+            }
+        }
+        ::rocprim::syncthreads();
+
+        unsigned int indices[ItemsPerThread];
+        merge_shared(keys_shared, keys, indices, size1, size2, compare_function);
+
+        gather_values(values, indices, count, storage);
+    }
+
+    template<class SortedValue>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void gather_values(SortedValue (&values)[ItemsPerThread],
+                       const unsigned int (&indices)[ItemsPerThread],
+                       const unsigned int count,
+                       storage_type&      storage)
+    {
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+
+        SortedValue* values_shared = storage.get().values.get();
+        ::rocprim::syncthreads(); // The keys are read until all threads have merged them
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int index = flat_id * ItemsPerThread + i;
+            if(index < count)
+            {
+                values_shared[index] = values[i];
+            }
+        }
+        ::rocprim::syncthreads();
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            if(flat_id * ItemsPerThread + i < count)
+            {
+                values[i] = values_shared[indices[i]];
+            }
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void gather_values(empty_type (&values)[ItemsPerThread],
+                       const unsigned int (&indices)[ItemsPerThread],
+                       const unsigned int count,
+                       storage_type&      storage)
+    {
+        (void)values;
+        (void)indices;
+        (void)count;
+        (void)storage;
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_MERGE_HPP_
@@ -551,6 +551,31 @@ public:
     {
         base_type::rank_keys(keys, ranks, storage, digit_extractor, prefix, counts);
     }
+
+    /// \brief Writes items straight to their rank in the output of the block.
+    ///
+    /// Kernels that store the ranked items to global memory can scatter them with this instead of
+    /// exchanging them through shared memory first. The ranks must be a permutation of the
+    /// items of the block, such as the ones computed by \p rank_keys.
+    ///
+    /// \tparam T - [inferred] the item type.
+    /// \tparam ItemsPerThread - [inferred] the number of items contributed by each thread.
+    /// \tparam OutputIterator - [inferred] random-access iterator type of the output of the block.
+    /// \param [in] items - reference to an array of items provided by a thread.
+    /// \param [in] ranks - reference to an array of the ranks of the items.
+    /// \param [out] output - iterator to the first item of the output of the block.
+    template<class T, unsigned ItemsPerThread, class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static void
+        scatter_by_rank(const T (&items)[ItemsPerThread],
+                        const unsigned int (&ranks)[ItemsPerThread],
+                        OutputIterator output)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            output[ranks[i]] = items[i];
+        }
+    }
 };
 
 END_ROCPRIM_NAMESPACE
@@ -33,6 +33,7 @@
 #include "../warp/warp_exchange.hpp"
 #include "block_exchange.hpp"
 #include "block_radix_rank.hpp"
+#include "block_scan.hpp"
 #include "rocprim/block/config.hpp"
 
 /// \addtogroup blockmodule
@@ -135,12 +136,25 @@ class block_radix_sort
     using values_exchange_type
         = ::rocprim::block_exchange<Value, BlockSizeX, ItemsPerThread, BlockSizeY, BlockSizeZ, PaddingHint>;
 
+    // The ids of the segments of the segmented sorts, numbered in the order of their heads.
+    using segment_id_type = std::
+        conditional_t<BlockSize * ItemsPerThread <= 0x10000u, unsigned short, unsigned int>;
+    using segments_exchange_type = ::rocprim::
+        block_exchange<segment_id_type, BlockSizeX, ItemsPerThread, BlockSizeY, BlockSizeZ, PaddingHint>;
+    using segment_scan_type = ::rocprim::block_scan<unsigned int,
+                                                    BlockSizeX,
+                                                    block_scan_algorithm::default_algorithm,
+                                                    BlockSizeY,
+                                                    BlockSizeZ>;
+
     // Struct used for creating a raw_storage object for this primitive's temporary storage.
     union storage_type_
     {
-        typename keys_exchange_type::storage_type   keys_exchange;
-        typename values_exchange_type::storage_type values_exchange;
-        typename block_rank_type::storage_type      rank;
+        typename keys_exchange_type::storage_type     keys_exchange;
+        typename values_exchange_type::storage_type   values_exchange;
+        typename block_rank_type::storage_type        rank;
+        typename segments_exchange_type::storage_type segments_exchange;
+        typename segment_scan_type::storage_type      segment_scan;
     };
 
 public:
@@ -1058,6 +1072,453 @@ public:
         sort_desc_warp_striped_to_striped(keys, storage, begin_bit, end_bit, decomposer);
     }
 
+    /// \brief Performs ascending radix sort over keys partitioned across threads in a block,
+    /// without moving the items to their sorted positions.
+    ///
+    /// The final exchange of the sort through shared memory is skipped: each item stays with the
+    /// thread that ranked it in the last pass, and \p ranks holds its position in the sorted
+    /// block. Kernels that store the sorted block to global memory can then write each item
+    /// directly to its position, for example with \p scatter_by_rank, saving one shared memory
+    /// round trip.
+    ///
+    /// \tparam Decomposer The type of the decomposer argument. Defaults to the identity decomposer.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread, in a blocked
+    /// arrangement. On return the keys of the block are permuted: unsorted but with their ranks.
+    /// \param [out] ranks - reference to an array of the positions of \p keys in the sorted block.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+    /// value: \p <tt>8 * sizeof(Key)</tt>.
+    /// \param [in] decomposer [optional] If `Key` is not an arithmetic type (integral, floating point),
+    ///  a custom decomposer functor should be passed that produces a `::rocprim::tuple` of references to
+    /// fundamental types from this custom type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ///
+    /// \par Examples
+    /// \parblock
+    /// \code{.cpp}
+    /// __global__ void example_kernel(int* output, ...)
+    /// {
+    ///     using block_rsort_int = rocprim::block_radix_sort<int, 256, 8>;
+    ///     __shared__ block_rsort_int::storage_type storage;
+    ///
+    ///     int          keys[8] = ...;
+    ///     unsigned int ranks[8];
+    ///     block_rsort_int().sort_to_ranks(keys, ranks, storage);
+    ///     // writes the sorted keys of the block, without exchanging them first
+    ///     block_rsort_int::scatter_by_rank(keys, ranks, output + blockIdx.x * 256 * 8);
+    /// }
+    /// \endcode
+    /// \endparblock
+    template<class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_to_ranks(
+        Key (&keys)[ItemsPerThread],
+        unsigned int (&ranks)[ItemsPerThread],
+        storage_type& storage,
+        unsigned int  begin_bit  = 0,
+        unsigned int  end_bit    = 8 * sizeof(Key),
+        Decomposer    decomposer = {})
+    {
+        empty_type values[ItemsPerThread];
+        sort_to_ranks_impl<false>(keys,
+                                  values,
+                                  ranks,
+                                  storage,
+                                  begin_bit,
+                                  end_bit,
+                                  decomposer);
+    }
+
+    /// \overload
+    /// \brief Performs ascending radix sort over keys partitioned across threads in a block,
+    /// without moving the items to their sorted positions.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    template<class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void sort_to_ranks(
+        Key (&keys)[ItemsPerThread],
+        unsigned int (&ranks)[ItemsPerThread],
+        unsigned int begin_bit  = 0,
+        unsigned int end_bit    = 8 * sizeof(Key),
+        Decomposer   decomposer = {})
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        sort_to_ranks(keys, ranks, storage, begin_bit, end_bit, decomposer);
+    }
+
+    /// \brief Performs descending radix sort over keys partitioned across threads in a block,
+    /// without moving the items to their sorted positions.
+    ///
+    /// \see block_radix_sort::sort_to_ranks
+    template<class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_desc_to_ranks(
+        Key (&keys)[ItemsPerThread],
+        unsigned int (&ranks)[ItemsPerThread],
+        storage_type& storage,
+        unsigned int  begin_bit  = 0,
+        unsigned int  end_bit    = 8 * sizeof(Key),
+        Decomposer    decomposer = {})
+    {
+        empty_type values[ItemsPerThread];
+        sort_to_ranks_impl<true>(keys,
+                                 values,
+                                 ranks,
+                                 storage,
+                                 begin_bit,
+                                 end_bit,
+                                 decomposer);
+    }
+
+    /// \overload
+    /// \brief Performs descending radix sort over keys partitioned across threads in a block,
+    /// without moving the items to their sorted positions.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    template<class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void sort_desc_to_ranks(
+        Key (&keys)[ItemsPerThread],
+        unsigned int (&ranks)[ItemsPerThread],
+        unsigned int begin_bit  = 0,
+        unsigned int end_bit    = 8 * sizeof(Key),
+        Decomposer   decomposer = {})
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        sort_desc_to_ranks(keys, ranks, storage, begin_bit, end_bit, decomposer);
+    }
+
+    /// \brief Performs ascending radix sort over key-value pairs partitioned across threads in a
+    /// block, without moving the items to their sorted positions.
+    ///
+    /// \see block_radix_sort::sort_to_ranks
+    template<bool WithValues = with_values, class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_to_ranks(
+        Key (&keys)[ItemsPerThread],
+        typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+        unsigned int (&ranks)[ItemsPerThread],
+        storage_type& storage,
+        unsigned int  begin_bit  = 0,
+        unsigned int  end_bit    = 8 * sizeof(Key),
+        Decomposer    decomposer = {})
+    {
+        sort_to_ranks_impl<false>(keys,
+                                  values,
+                                  ranks,
+                                  storage,
+                                  begin_bit,
+                                  end_bit,
+                                  decomposer);
+    }
+
+    /// \overload
+    /// \brief Performs ascending radix sort over key-value pairs partitioned across threads in a
+    /// block, without moving the items to their sorted positions.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    template<bool WithValues = with_values, class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void sort_to_ranks(
+        Key (&keys)[ItemsPerThread],
+        typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+        unsigned int (&ranks)[ItemsPerThread],
+        unsigned int begin_bit  = 0,
+        unsigned int end_bit    = 8 * sizeof(Key),
+        Decomposer   decomposer = {})
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        sort_to_ranks(keys, values, ranks, storage, begin_bit, end_bit, decomposer);
+    }
+
+    /// \brief Performs descending radix sort over key-value pairs partitioned across threads in a
+    /// block, without moving the items to their sorted positions.
+    ///
+    /// \see block_radix_sort::sort_to_ranks
+    template<bool WithValues = with_values, class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_desc_to_ranks(
+        Key (&keys)[ItemsPerThread],
+        typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+        unsigned int (&ranks)[ItemsPerThread],
+        storage_type& storage,
+        unsigned int  begin_bit  = 0,
+        unsigned int  end_bit    = 8 * sizeof(Key),
+        Decomposer    decomposer = {})
+    {
+        sort_to_ranks_impl<true>(keys,
+                                 values,
+                                 ranks,
+                                 storage,
+                                 begin_bit,
+                                 end_bit,
+                                 decomposer);
+    }
+
+    /// \overload
+    /// \brief Performs descending radix sort over key-value pairs partitioned across threads in a
+    /// block, without moving the items to their sorted positions.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    template<bool WithValues = with_values, class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void sort_desc_to_ranks(
+        Key (&keys)[ItemsPerThread],
+        typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+        unsigned int (&ranks)[ItemsPerThread],
+        unsigned int begin_bit  = 0,
+        unsigned int end_bit    = 8 * sizeof(Key),
+        Decomposer   decomposer = {})
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        sort_desc_to_ranks(keys, values, ranks, storage, begin_bit, end_bit, decomposer);
+    }
+
+    /// \brief Writes items straight to their rank in the output of the block, for example the
+    /// keys and values returned by \p sort_to_ranks.
+    ///
+    /// \see block_radix_rank::scatter_by_rank
+    template<class T, class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE static void
+        scatter_by_rank(const T (&items)[ItemsPerThread],
+                        const unsigned int (&ranks)[ItemsPerThread],
+                        OutputIterator output)
+    {
+        block_rank_type::scatter_by_rank(items, ranks, output);
+    }
+
+    /// \brief Performs ascending radix sort over the segments of keys partitioned across threads
+    /// in a block.
+    ///
+    /// The items of the block are split into consecutive segments by \p head_flags, and each
+    /// segment is sorted independently. Many small segments are sorted by one block at once, the
+    /// passes over the segment ids that keep them apart take about
+    /// <tt>ceil(log2(segments) / RadixBitsPerPass)</tt> passes in addition to those over the keys.
+    ///
+    /// \tparam Flag - [inferred] the type of the head flags, convertible to \p bool.
+    /// \tparam Decomposer The type of the decomposer argument. Defaults to the identity decomposer.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread, in a blocked
+    /// arrangement.
+    /// \param [in] head_flags - reference to an array of flags provided by a thread, non-zero for
+    /// the first item of each segment. The first item of the block always starts a segment.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+    /// value: \p <tt>8 * sizeof(Key)</tt>.
+    /// \param [in] decomposer [optional] If `Key` is not an arithmetic type (integral, floating point),
+    ///  a custom decomposer functor should be passed that produces a `::rocprim::tuple` of references to
+    /// fundamental types from this custom type.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ///
+    /// \par Examples
+    /// \parblock
+    /// \code{.cpp}
+    /// __global__ void example_kernel(...)
+    /// {
+    ///     using block_rsort_int = rocprim::block_radix_sort<int, 256, 8>;
+    ///     __shared__ block_rsort_int::storage_type storage;
+    ///
+    ///     int  keys[8] = ...;
+    ///     bool heads[8] = ...;
+    ///     block_rsort_int().sort_segmented(keys, heads, storage);
+    ///     ...
+    /// }
+    /// \endcode
+    ///
+    /// If the keys of the block are <tt>{3, 1, 2, 9, 7, 8, ...}</tt> and the head flags are
+    /// <tt>{1, 0, 0, 1, 0, 0, ...}</tt>, then after the sort the keys start with
+    /// <tt>{1, 2, 3, 7, 8, 9, ...}</tt>.
+    /// \endparblock
+    template<class Flag, class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_segmented(Key (&keys)[ItemsPerThread],
+                        const Flag (&head_flags)[ItemsPerThread],
+                        storage_type& storage,
+                        unsigned int  begin_bit  = 0,
+                        unsigned int  end_bit    = 8 * sizeof(Key),
+                        Decomposer    decomposer = {})
+    {
+        empty_type values[ItemsPerThread];
+        sort_segmented_impl<false>(keys,
+                                   values,
+                                   head_flags,
+                                   storage,
+                                   begin_bit,
+                                   end_bit,
+                                   decomposer);
+    }
+
+    /// \overload
+    /// \brief Performs ascending radix sort over the segments of keys partitioned across threads
+    /// in a block.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    template<class Flag, class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void sort_segmented(Key (&keys)[ItemsPerThread],
+                        const Flag (&head_flags)[ItemsPerThread],
+                        unsigned int begin_bit  = 0,
+                        unsigned int end_bit    = 8 * sizeof(Key),
+                        Decomposer   decomposer = {})
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        sort_segmented(keys, head_flags, storage, begin_bit, end_bit, decomposer);
+    }
+
+    /// \brief Performs descending radix sort over the segments of keys partitioned across threads
+    /// in a block.
+    ///
+    /// \see block_radix_sort::sort_segmented
+    template<class Flag, class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_desc_segmented(Key (&keys)[ItemsPerThread],
+                             const Flag (&head_flags)[ItemsPerThread],
+                             storage_type& storage,
+                             unsigned int  begin_bit  = 0,
+                             unsigned int  end_bit    = 8 * sizeof(Key),
+                             Decomposer    decomposer = {})
+    {
+        empty_type values[ItemsPerThread];
+        sort_segmented_impl<true>(keys,
+                                  values,
+                                  head_flags,
+                                  storage,
+                                  begin_bit,
+                                  end_bit,
+                                  decomposer);
+    }
+
+    /// \overload
+    /// \brief Performs descending radix sort over the segments of keys partitioned across threads
+    /// in a block.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    template<class Flag, class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void sort_desc_segmented(Key (&keys)[ItemsPerThread],
+                             const Flag (&head_flags)[ItemsPerThread],
+                             unsigned int begin_bit  = 0,
+                             unsigned int end_bit    = 8 * sizeof(Key),
+                             Decomposer   decomposer = {})
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        sort_desc_segmented(keys, head_flags, storage, begin_bit, end_bit, decomposer);
+    }
+
+    /// \brief Performs ascending radix sort over the segments of key-value pairs partitioned
+    /// across threads in a block.
+    ///
+    /// \see block_radix_sort::sort_segmented
+    template<bool WithValues = with_values,
+             class Flag,
+             class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_segmented(Key (&keys)[ItemsPerThread],
+                        typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+                        const Flag (&head_flags)[ItemsPerThread],
+                        storage_type& storage,
+                        unsigned int  begin_bit  = 0,
+                        unsigned int  end_bit    = 8 * sizeof(Key),
+                        Decomposer    decomposer = {})
+    {
+        sort_segmented_impl<false>(keys,
+                                   values,
+                                   head_flags,
+                                   storage,
+                                   begin_bit,
+                                   end_bit,
+                                   decomposer);
+    }
+
+    /// \overload
+    /// \brief Performs ascending radix sort over the segments of key-value pairs partitioned
+    /// across threads in a block.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    template<bool WithValues = with_values,
+             class Flag,
+             class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void sort_segmented(Key (&keys)[ItemsPerThread],
+                        typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+                        const Flag (&head_flags)[ItemsPerThread],
+                        unsigned int begin_bit  = 0,
+                        unsigned int end_bit    = 8 * sizeof(Key),
+                        Decomposer   decomposer = {})
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        sort_segmented(keys, values, head_flags, storage, begin_bit, end_bit, decomposer);
+    }
+
+    /// \brief Performs descending radix sort over the segments of key-value pairs partitioned
+    /// across threads in a block.
+    ///
+    /// \see block_radix_sort::sort_segmented
+    template<bool WithValues = with_values,
+             class Flag,
+             class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_desc_segmented(
+        Key (&keys)[ItemsPerThread],
+        typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+        const Flag (&head_flags)[ItemsPerThread],
+        storage_type& storage,
+        unsigned int  begin_bit  = 0,
+        unsigned int  end_bit    = 8 * sizeof(Key),
+        Decomposer    decomposer = {})
+    {
+        sort_segmented_impl<true>(keys,
+                                  values,
+                                  head_flags,
+                                  storage,
+                                  begin_bit,
+                                  end_bit,
+                                  decomposer);
+    }
+
+    /// \overload
+    /// \brief Performs descending radix sort over the segments of key-value pairs partitioned
+    /// across threads in a block.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    template<bool WithValues = with_values,
+             class Flag,
+             class Decomposer = ::rocprim::identity_decomposer>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void sort_desc_segmented(
+        Key (&keys)[ItemsPerThread],
+        typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+        const Flag (&head_flags)[ItemsPerThread],
+        unsigned int begin_bit  = 0,
+        unsigned int end_bit    = 8 * sizeof(Key),
+        Decomposer   decomposer = {})
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage;
+        sort_desc_segmented(keys, values, head_flags, storage, begin_bit, end_bit, decomposer);
+    }
+
 private:
     static constexpr bool use_warp_exchange
         = device_warp_size() % ItemsPerThread == 0 && ItemsPerThread <= 4;
@@ -1097,14 +1558,17 @@ private:
                                                                                            values);
     }
 
+    // Runs all passes but the final exchange. The keys are left encoded, and in the arrangement
+    // of the last pass: blocked, or warp-striped with the match rank. \p ranks are the positions
+    // of the items in the sorted block.
     template<bool Descending,
-             bool ToStriped             = false,
              bool TryEmulateWarpStriped = true,
              class SortedValue,
              class Decomposer>
     ROCPRIM_DEVICE ROCPRIM_INLINE
-    void sort_impl(Key (&keys)[ItemsPerThread],
+    void rank_impl(Key (&keys)[ItemsPerThread],
                    SortedValue (&values)[ItemsPerThread],
+                   unsigned int (&ranks)[ItemsPerThread],
                    storage_type& storage,
                    unsigned int  begin_bit,
                    unsigned int  end_bit,
@@ -1125,8 +1589,6 @@ private:
         if ROCPRIM_IF_CONSTEXPR(TryEmulateWarpStriped && warp_striped && ItemsPerThread > 1)
         {
             // This appears to be slower with high large items per thread.
-            constexpr bool use_warp_exchange
-                = device_warp_size() % ItemsPerThread == 0 && ItemsPerThread <= 4;
             blocked_to_warp_striped(keys,
                                     values,
                                     storage,
@@ -1136,7 +1598,6 @@ private:
             ::rocprim::syncthreads();
         }
 
-        unsigned int ranks[ItemsPerThread];
         while(true)
         {
             const int pass_bits = min(RadixBitsPerPass, end_bit - begin_bit);
@@ -1168,6 +1629,31 @@ private:
             // Synchronization required to make block_rank wait on the next iteration.
             ::rocprim::syncthreads();
         }
+    }
+
+    template<bool Descending,
+             bool ToStriped             = false,
+             bool TryEmulateWarpStriped = true,
+             class SortedValue,
+             class Decomposer>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_impl(Key (&keys)[ItemsPerThread],
+                   SortedValue (&values)[ItemsPerThread],
+                   storage_type& storage,
+                   unsigned int  begin_bit,
+                   unsigned int  end_bit,
+                   Decomposer    decomposer)
+    {
+        using key_codec = ::rocprim::radix_key_codec<Key, Descending>;
+
+        unsigned int ranks[ItemsPerThread];
+        rank_impl<Descending, TryEmulateWarpStriped>(keys,
+                                                     values,
+                                                     ranks,
+                                                     storage,
+                                                     begin_bit,
+                                                     end_bit,
+                                                     decomposer);
 
         if ROCPRIM_IF_CONSTEXPR(ToStriped)
         {
@@ -1188,6 +1674,176 @@ private:
         }
     }
 
+    template<bool Descending, class SortedValue, class Decomposer>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_to_ranks_impl(Key (&keys)[ItemsPerThread],
+                            SortedValue (&values)[ItemsPerThread],
+                            unsigned int (&ranks)[ItemsPerThread],
+                            storage_type& storage,
+                            unsigned int  begin_bit,
+                            unsigned int  end_bit,
+                            Decomposer    decomposer)
+    {
+        using key_codec = ::rocprim::radix_key_codec<Key, Descending>;
+
+        rank_impl<Descending>(keys, values, ranks, storage, begin_bit, end_bit, decomposer);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            key_codec::decode_inplace(keys[i], decomposer);
+        }
+    }
+
+    template<bool Descending, class SortedValue, class Flag, class Decomposer>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_segmented_impl(Key (&keys)[ItemsPerThread],
+                             SortedValue (&values)[ItemsPerThread],
+                             const Flag (&head_flags)[ItemsPerThread],
+                             storage_type& storage,
+                             unsigned int  begin_bit,
+                             unsigned int  end_bit,
+                             Decomposer    decomposer)
+    {
+        using key_codec = ::rocprim::radix_key_codec<Key, Descending>;
+
+        // Number the segments in the order of their heads. After the passes over the keys, a
+        // stable sort by these ids moves the items of each segment back together while keeping
+        // them sorted by key.
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        unsigned int heads[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            heads[i] = (head_flags[i] || (flat_id == 0 && i == 0)) ? 1 : 0;
+        }
+        unsigned int segment_count;
+        segment_scan_type().inclusive_scan(heads, heads, segment_count, storage.get().segment_scan);
+
+        segment_id_type segments[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            segments[i] = static_cast<segment_id_type>(heads[i] - 1);
+        }
+        unsigned int segment_bits = 0;
+        while((1u << segment_bits) < segment_count)
+        {
+            segment_bits++;
+        }
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            key_codec::encode_inplace(keys[i], decomposer);
+        }
+
+        // The scan storage is reused by the exchanges and 'rank_keys'.
+        ::rocprim::syncthreads();
+
+        if ROCPRIM_IF_CONSTEXPR(warp_striped && ItemsPerThread > 1)
+        {
+            blocked_to_warp_striped(keys,
+                                    values,
+                                    storage,
+                                    std::integral_constant<bool, use_warp_exchange>{});
+            ::rocprim::syncthreads();
+            segments_exchange_type().blocked_to_warp_striped(segments,
+                                                             segments,
+                                                             storage.get().segments_exchange);
+            ::rocprim::syncthreads();
+        }
+
+        const unsigned int key_passes
+            = ::rocprim::detail::ceiling_div(end_bit - begin_bit, RadixBitsPerPass);
+        const unsigned int passes
+            = ::rocprim::max(1u,
+                             key_passes
+                                 + ::rocprim::detail::ceiling_div(segment_bits, RadixBitsPerPass));
+
+        unsigned int ranks[ItemsPerThread];
+        for(unsigned int pass = 0;; pass++)
+        {
+            if(pass < key_passes)
+            {
+                const unsigned int bit       = begin_bit + pass * RadixBitsPerPass;
+                const int          pass_bits = min(RadixBitsPerPass, end_bit - bit);
+                block_rank_type().rank_keys(
+                    keys,
+                    ranks,
+                    storage.get().rank,
+                    [bit, pass_bits, decomposer](const Key& key) mutable
+                    { return key_codec::extract_digit(key, bit, pass_bits, decomposer); });
+            }
+            else
+            {
+                const unsigned int bit = (pass - key_passes) * RadixBitsPerPass;
+                const unsigned int mask = (1u << min(RadixBitsPerPass, segment_bits - bit)) - 1;
+                block_rank_type().rank_keys(segments,
+                                            ranks,
+                                            storage.get().rank,
+                                            [bit, mask](const segment_id_type& segment)
+                                            { return (unsigned int{segment} >> bit) & mask; });
+            }
+
+            if(pass + 1 >= passes)
+            {
+                break;
+            }
+
+            if ROCPRIM_IF_CONSTEXPR(warp_striped)
+            {
+                exchange_keys_warp_striped(storage, keys, ranks);
+                exchange_values_warp_striped(storage, values, ranks);
+                exchange_segments_warp_striped(storage, segments, ranks);
+            }
+            else
+            {
+                exchange_keys(storage, keys, ranks);
+                exchange_values(storage, values, ranks);
+                exchange_segments(storage, segments, ranks);
+            }
+
+            ::rocprim::syncthreads();
+        }
+
+        exchange_keys(storage, keys, ranks);
+        exchange_values(storage, values, ranks);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            key_codec::decode_inplace(keys[i], decomposer);
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void exchange_segments(storage_type& storage,
+                           segment_id_type (&segments)[ItemsPerThread],
+                           const unsigned int (&ranks)[ItemsPerThread])
+    {
+        storage_type_& storage_ = storage.get();
+        ::rocprim::syncthreads(); // Storage will be reused (union), synchronization is needed
+        segments_exchange_type().scatter_to_blocked(segments,
+                                                    segments,
+                                                    ranks,
+                                                    storage_.segments_exchange);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void exchange_segments_warp_striped(storage_type& storage,
+                                        segment_id_type (&segments)[ItemsPerThread],
+                                        const unsigned int (&ranks)[ItemsPerThread])
+    {
+        storage_type_& storage_ = storage.get();
+        ::rocprim::syncthreads(); // Storage will be reused (union), synchronization is needed
+        segments_exchange_type().scatter_to_warp_striped(segments,
+                                                         segments,
+                                                         ranks,
+                                                         storage_.segments_exchange);
+    }
+
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void exchange_keys(storage_type& storage,
                        Key (&keys)[ItemsPerThread],
@@ -404,6 +404,87 @@ public:
     {
         base_type::reduce(input, output, valid_items, reduce_op);
     }
+
+    /// \brief Performs \p N independent reductions across threads in a block.
+    ///
+    /// The k-th values of all threads are reduced into the k-th output. With
+    /// \p block_reduce_algorithm::using_warp_reduce all reductions share a single
+    /// synchronization barrier, the other algorithms perform them one after another.
+    ///
+    /// \tparam N - number of independent values.
+    /// \tparam BinaryFunction - type of binary function used for reduce. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - reference to an array containing the thread input values, one
+    /// for every reduction.
+    /// \param [out] output - reference to an array of thread output values. May be aliased
+    /// with \p input. The results are only valid in the first thread of the block.
+    /// \param [in] storage - reference to an array of temporary storage objects, one for every
+    /// reduction.
+    /// \param [in] reduce_op - binary operation function object that will be used for reduce.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ///
+    /// \par Examples
+    /// \parblock
+    /// The example computes the sum, the sum of squares and the count of the values of
+    /// a block of 256 threads.
+    ///
+    /// \code{.cpp}
+    /// __global__ void example_kernel(...) // blockDim.x = 256
+    /// {
+    ///     using block_reduce_float = rocprim::block_reduce<float, 256>;
+    ///     __shared__ block_reduce_float::storage_type storage[3];
+    ///
+    ///     float value = ...;
+    ///     float values[3] = {value, value * value, 1.0f};
+    ///     block_reduce_float().multi_reduce(values, values, storage);
+    ///     ...
+    /// }
+    /// \endcode
+    /// \endparblock
+    template<unsigned int N, class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void multi_reduce(const T (&input)[N],
+                      T (&output)[N],
+                      storage_type (&storage)[N],
+                      BinaryFunction reduce_op = BinaryFunction())
+    {
+        base_type::multi_reduce(input, output, storage, reduce_op);
+    }
+
+    /// \overload
+    /// \brief Performs \p N independent reductions across threads in a block.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    ///
+    /// \tparam N - number of independent values.
+    /// \tparam BinaryFunction - type of binary function used for reduce. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - reference to an array containing the thread input values, one
+    /// for every reduction.
+    /// \param [out] output - reference to an array of thread output values. May be aliased
+    /// with \p input. The results are only valid in the first thread of the block.
+    /// \param [in] reduce_op - binary operation function object that will be used for reduce.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    template<unsigned int N, class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void multi_reduce(const T (&input)[N],
+                      T (&output)[N],
+                      BinaryFunction reduce_op = BinaryFunction())
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage[N];
+        base_type::multi_reduce(input, output, storage, reduce_op);
+    }
 };
 
 END_ROCPRIM_NAMESPACE
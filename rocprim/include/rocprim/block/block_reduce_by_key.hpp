@@ -0,0 +1,489 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_BLOCK_REDUCE_BY_KEY_HPP_
+#define ROCPRIM_BLOCK_BLOCK_REDUCE_BY_KEY_HPP_
+
+#include "../config.hpp"
+#include "../detail/binary_op_wrappers.hpp"
+#include "../detail/various.hpp"
+
+#include "../functional.hpp"
+#include "../intrinsics.hpp"
+#include "../types.hpp"
+
+#include "block_discontinuity.hpp"
+#include "block_scan.hpp"
+
+/// \addtogroup blockmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The run of a reduce-by-key that is still open at the end of a tile, and is
+/// continued by the next tile.
+///
+/// \tparam Key - the key type.
+/// \tparam Value - the type of the aggregates.
+template<class Key, class Value>
+struct reduce_by_key_carry
+{
+    /// \brief The first key of the run.
+    Key key;
+    /// \brief The reduction of the values of the run so far.
+    Value aggregate;
+    /// \brief \p false before the first tile, when there is no open run yet.
+    bool is_open;
+};
+
+/// \brief The \p block_reduce_by_key class is a block level parallel primitive which reduces
+/// the values of runs of consecutive equal keys partitioned across threads in a block.
+///
+/// \tparam Key - the key type.
+/// \tparam Value - the value type, which is also the type of the aggregates.
+/// \tparam BlockSizeX - the number of threads in a block's x dimension.
+/// \tparam Algorithm - selected scan algorithm, block_scan_algorithm::default_algorithm by
+/// default.
+/// \tparam BlockSizeY - the number of threads in a block's y dimension, defaults to 1.
+/// \tparam BlockSizeZ - the number of threads in a block's z dimension, defaults to 1.
+///
+/// \par Overview
+/// * The items are in a blocked arrangement. The runs are numbered in order starting from 0,
+/// and the first key and the aggregate of every run are written at the index of the run to
+/// the output iterators, which may point to shared memory or to global memory.
+/// * The primitive flags the heads of the runs with \p block_discontinuity and reduces the
+/// runs with a single \p block_scan, in the same way as \p rocprim::reduce_by_key.
+/// * Sequences longer than a tile are reduced tile by tile with the overloads that take a
+/// \p reduce_by_key_carry. The last run of a tile is not written, but carried out to the next
+/// tile, which continues it.
+///
+/// \par Examples
+/// \parblock
+/// In the example the runs of a sequence of \p int keys and \p float values are reduced, tile
+/// by tile, with a block of 256 threads and 4 items per thread.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     using block_reduce_by_key_type = rocprim::block_reduce_by_key<int, float, 256>;
+///     // allocate storage in shared memory
+///     __shared__ block_reduce_by_key_type::storage_type storage;
+///
+///     rocprim::reduce_by_key_carry<int, float> carry{};
+///     unsigned int runs = 0;
+///     for(...)
+///     {
+///         int keys[4];
+///         float values[4];
+///         ...
+///         unsigned int run_count;
+///         block_reduce_by_key_type().reduce(keys, values, unique_keys + runs,
+///                                           aggregates + runs, run_count, carry, storage);
+///         runs += run_count;
+///         __syncthreads();
+///     }
+///     // the last run is still open
+///     if(threadIdx.x == 0 && carry.is_open)
+///     {
+///         unique_keys[runs] = carry.key;
+///         aggregates[runs] = carry.aggregate;
+///     }
+/// }
+/// \endcode
+/// \endparblock
+template<class Key,
+         class Value,
+         unsigned int         BlockSizeX,
+         block_scan_algorithm Algorithm  = block_scan_algorithm::default_algorithm,
+         unsigned int         BlockSizeY = 1,
+         unsigned int         BlockSizeZ = 1>
+class block_reduce_by_key
+{
+    static constexpr unsigned int BlockSize = BlockSizeX * BlockSizeY * BlockSizeZ;
+
+    using wrapped_type = ::rocprim::tuple<unsigned int, Value>;
+    using flags_type   = block_discontinuity<Key, BlockSizeX, BlockSizeY, BlockSizeZ>;
+    using scan_type    = block_scan<wrapped_type, BlockSizeX, Algorithm, BlockSizeY, BlockSizeZ>;
+
+    struct storage_type_
+    {
+        typename flags_type::storage_type flags;
+        typename scan_type::storage_type  scan;
+        uninitialized_array<Key, 1>       last_key;
+        uninitialized_array<Value, 1>     last_aggregate;
+    };
+
+public:
+    /// \brief The type of the open run carried from tile to tile.
+    using carry_type = reduce_by_key_carry<Key, Value>;
+
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by related parallel primitive.
+    ///
+    /// Depending on the implemention the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS // hides storage_type implementation for Doxygen
+    ROCPRIM_DETAIL_SUPPRESS_DEPRECATION_WITH_PUSH
+    using storage_type = detail::raw_storage<storage_type_>;
+    ROCPRIM_DETAIL_SUPPRESS_DEPRECATION_POP
+    #else
+    using storage_type = storage_type_;
+    #endif
+
+    /// \brief Reduces the runs of the items of the block.
+    ///
+    /// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+    /// each thread.
+    /// \tparam UniqueOutputIterator - [inferred] random-access iterator type of the output
+    /// range of the first keys of the runs.
+    /// \tparam AggregatesOutputIterator - [inferred] random-access iterator type of the output
+    /// range of the aggregates of the runs.
+    /// \tparam BinaryFunction - [inferred] type of binary function used for the reduction.
+    /// \tparam KeyCompareFunction - [inferred] type of binary function used to compare keys.
+    ///
+    /// \param [in] keys - the keys of the thread, in a blocked arrangement.
+    /// \param [in] values - the values of the thread, in a blocked arrangement.
+    /// \param [out] unique_output - iterator to the first keys of the runs, which must have
+    /// room for <tt>BlockSize * ItemsPerThread</tt> runs.
+    /// \param [out] aggregates_output - iterator to the aggregates of the runs, which must
+    /// have room for <tt>BlockSize * ItemsPerThread</tt> runs.
+    /// \param [out] run_count - the number of runs, same for all threads.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] reduce_op - binary operation function object that is used to reduce the
+    /// values of a run. Default is \p rocprim::plus<Value>.
+    /// \param [in] key_compare_op - binary function object that returns \p true if two keys
+    /// belong to the same run. Default is \p rocprim::equal_to<Key>.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads(). The outputs are only
+    /// complete for all threads after a synchronization barrier.
+    template<unsigned int ItemsPerThread,
+             class UniqueOutputIterator,
+             class AggregatesOutputIterator,
+             class BinaryFunction     = ::rocprim::plus<Value>,
+             class KeyCompareFunction = ::rocprim::equal_to<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reduce(const Key (&keys)[ItemsPerThread],
+                const Value (&values)[ItemsPerThread],
+                UniqueOutputIterator     unique_output,
+                AggregatesOutputIterator aggregates_output,
+                unsigned int&            run_count,
+                storage_type&            storage,
+                BinaryFunction           reduce_op      = BinaryFunction(),
+                KeyCompareFunction       key_compare_op = KeyCompareFunction())
+    {
+        carry_type carry{};
+        reduce_impl<false>(keys,
+                           values,
+                           BlockSize * ItemsPerThread,
+                           unique_output,
+                           aggregates_output,
+                           run_count,
+                           carry,
+                           storage,
+                           reduce_op,
+                           key_compare_op);
+    }
+
+    /// \brief Reduces the runs of the first \p valid_items items of the block.
+    ///
+    /// \param [in] keys - the keys of the thread, in a blocked arrangement.
+    /// \param [in] values - the values of the thread, in a blocked arrangement.
+    /// \param [in] valid_items - the number of valid items in the block, the other items are
+    /// ignored.
+    /// \param [out] unique_output - iterator to the first keys of the runs.
+    /// \param [out] aggregates_output - iterator to the aggregates of the runs.
+    /// \param [out] run_count - the number of runs, same for all threads.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] reduce_op - binary operation function object that is used to reduce the
+    /// values of a run.
+    /// \param [in] key_compare_op - binary function object that returns \p true if two keys
+    /// belong to the same run.
+    template<unsigned int ItemsPerThread,
+             class UniqueOutputIterator,
+             class AggregatesOutputIterator,
+             class BinaryFunction     = ::rocprim::plus<Value>,
+             class KeyCompareFunction = ::rocprim::equal_to<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reduce(const Key (&keys)[ItemsPerThread],
+                const Value (&values)[ItemsPerThread],
+                unsigned int             valid_items,
+                UniqueOutputIterator     unique_output,
+                AggregatesOutputIterator aggregates_output,
+                unsigned int&            run_count,
+                storage_type&            storage,
+                BinaryFunction           reduce_op      = BinaryFunction(),
+                KeyCompareFunction       key_compare_op = KeyCompareFunction())
+    {
+        carry_type carry{};
+        reduce_impl<false>(keys,
+                           values,
+                           valid_items,
+                           unique_output,
+                           aggregates_output,
+                           run_count,
+                           carry,
+                           storage,
+                           reduce_op,
+                           key_compare_op);
+    }
+
+    /// \brief Reduces the runs of the items of the block, continuing the open run of the
+    /// preceding tile and carrying the last run of the block out to the next tile.
+    ///
+    /// If \p carry is open, it is run 0 of the block, and the leading items of the block are
+    /// reduced into it when their keys are equal to its key. The last run is not written, but
+    /// returned in \p carry, so all written runs are complete.
+    ///
+    /// \param [in] keys - the keys of the thread, in a blocked arrangement.
+    /// \param [in] values - the values of the thread, in a blocked arrangement.
+    /// \param [out] unique_output - iterator to the first keys of the runs.
+    /// \param [out] aggregates_output - iterator to the aggregates of the runs.
+    /// \param [out] run_count - the number of runs written, same for all threads.
+    /// \param [in, out] carry - the open run of the preceding tile on input, same for all
+    /// threads, and the open run of this block on output. It must not be open before the first
+    /// tile.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] reduce_op - binary operation function object that is used to reduce the
+    /// values of a run.
+    /// \param [in] key_compare_op - binary function object that returns \p true if two keys
+    /// belong to the same run.
+    template<unsigned int ItemsPerThread,
+             class UniqueOutputIterator,
+             class AggregatesOutputIterator,
+             class BinaryFunction     = ::rocprim::plus<Value>,
+             class KeyCompareFunction = ::rocprim::equal_to<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reduce(const Key (&keys)[ItemsPerThread],
+                const Value (&values)[ItemsPerThread],
+                UniqueOutputIterator     unique_output,
+                AggregatesOutputIterator aggregates_output,
+                unsigned int&            run_count,
+                carry_type&              carry,
+                storage_type&            storage,
+                BinaryFunction           reduce_op      = BinaryFunction(),
+                KeyCompareFunction       key_compare_op = KeyCompareFunction())
+    {
+        reduce_impl<true>(keys,
+                          values,
+                          BlockSize * ItemsPerThread,
+                          unique_output,
+                          aggregates_output,
+                          run_count,
+                          carry,
+                          storage,
+                          reduce_op,
+                          key_compare_op);
+    }
+
+    /// \brief Reduces the runs of the first \p valid_items items of the block, continuing the
+    /// open run of the preceding tile and carrying the last run out to the next tile.
+    ///
+    /// \param [in] keys - the keys of the thread, in a blocked arrangement.
+    /// \param [in] values - the values of the thread, in a blocked arrangement.
+    /// \param [in] valid_items - the number of valid items in the block, the other items are
+    /// ignored. If it is zero, \p carry is not changed.
+    /// \param [out] unique_output - iterator to the first keys of the runs.
+    /// \param [out] aggregates_output - iterator to the aggregates of the runs.
+    /// \param [out] run_count - the number of runs written, same for all threads.
+    /// \param [in, out] carry - the open run of the preceding tile on input, same for all
+    /// threads, and the open run of this block on output.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] reduce_op - binary operation function object that is used to reduce the
+    /// values of a run.
+    /// \param [in] key_compare_op - binary function object that returns \p true if two keys
+    /// belong to the same run.
+    template<unsigned int ItemsPerThread,
+             class UniqueOutputIterator,
+             class AggregatesOutputIterator,
+             class BinaryFunction     = ::rocprim::plus<Value>,
+             class KeyCompareFunction = ::rocprim::equal_to<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reduce(const Key (&keys)[ItemsPerThread],
+                const Value (&values)[ItemsPerThread],
+                unsigned int             valid_items,
+                UniqueOutputIterator     unique_output,
+                AggregatesOutputIterator aggregates_output,
+                unsigned int&            run_count,
+                carry_type&              carry,
+                storage_type&            storage,
+                BinaryFunction           reduce_op      = BinaryFunction(),
+                KeyCompareFunction       key_compare_op = KeyCompareFunction())
+    {
+        reduce_impl<true>(keys,
+                          values,
+                          valid_items,
+                          unique_output,
+                          aggregates_output,
+                          run_count,
+                          carry,
+                          storage,
+                          reduce_op,
+                          key_compare_op);
+    }
+
+private:
+    template<bool WithCarry,
+             unsigned int ItemsPerThread,
+             class UniqueOutputIterator,
+             class AggregatesOutputIterator,
+             class BinaryFunction,
+             class KeyCompareFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reduce_impl(const Key (&keys)[ItemsPerThread],
+                     const Value (&values)[ItemsPerThread],
+                     const unsigned int       valid_items,
+                     UniqueOutputIterator     unique_output,
+                     AggregatesOutputIterator aggregates_output,
+                     unsigned int&            run_count,
+                     carry_type&              carry,
+                     storage_type&            storage,
+                     BinaryFunction           reduce_op,
+                     KeyCompareFunction       key_compare_op)
+    {
+        static constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+        run_count = 0;
+        if(valid_items == 0)
+        {
+            return;
+        }
+
+        storage_type_&     storage_ = storage.get();
+        const unsigned int flat_id
+            = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const unsigned int offset   = flat_id * ItemsPerThread;
+        const bool         carry_in = WithCarry && carry.is_open;
+        const bool         is_full  = valid_items >= items_per_block;
+
+        // The carried run is compared with the first key, so it is the predecessor of the tile.
+        const auto flag_op
+            = detail::guarded_inequality_op<KeyCompareFunction>{key_compare_op, valid_items};
+        unsigned int head_flags[ItemsPerThread];
+        if(carry_in)
+        {
+            flags_type{}.flag_heads(head_flags, carry.key, keys, flag_op, storage_.flags);
+        }
+        else
+        {
+            flags_type{}.flag_heads(head_flags, keys, flag_op, storage_.flags);
+        }
+
+        // The first invalid item is flagged too, so the exclusive scan yields the aggregate of
+        // the last run at that item.
+        wrapped_type wrapped[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            rocprim::get<0>(wrapped[i]) = head_flags[i] | (offset + i == valid_items);
+            rocprim::get<1>(wrapped[i]) = values[i];
+        }
+
+        // The aggregate of the carried run is the prefix of the items that continue it, the
+        // initial value is ignored otherwise.
+        const wrapped_type init
+            = ::rocprim::make_tuple(0u, carry_in ? carry.aggregate : values[0]);
+        auto wrapped_op = detail::run_count_scan_op_wrapper<Value, BinaryFunction>{reduce_op};
+
+        wrapped_type reduction;
+        scan_type{}.exclusive_scan(wrapped, wrapped, init, reduction, storage_.scan, wrapped_op);
+
+        // Run 0 of the block is the carried run, if any.
+        const unsigned int first_run  = carry_in ? 1 : 0;
+        const unsigned int total_runs
+            = rocprim::get<0>(reduction) - (is_full ? 0 : 1) + first_run;
+        // The last run is carried out instead of being written.
+        const unsigned int written_runs = WithCarry ? total_runs - 1 : total_runs;
+
+        if(carry_in && flat_id == 0 && written_runs > 0)
+        {
+            unique_output[0] = carry.key;
+        }
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const bool is_first_invalid = offset + i == valid_items;
+            if(!head_flags[i] && !is_first_invalid)
+            {
+                continue;
+            }
+            // The first invalid item starts the run past the last one.
+            const unsigned int run = rocprim::get<0>(wrapped[i]) + first_run;
+            // The exclusive scan at a head is the aggregate of the preceding run.
+            if(run > 0 && run - 1 < written_runs)
+            {
+                aggregates_output[run - 1] = rocprim::get<1>(wrapped[i]);
+            }
+            else if(WithCarry && is_first_invalid)
+            {
+                storage_.last_aggregate.emplace(0, rocprim::get<1>(wrapped[i]));
+            }
+            if(!is_first_invalid)
+            {
+                if(run < written_runs)
+                {
+                    unique_output[run] = keys[i];
+                }
+                else if(WithCarry)
+                {
+                    storage_.last_key.emplace(0, keys[i]);
+                }
+            }
+        }
+
+        // In a full block the last run ends with the block.
+        if(is_full)
+        {
+            const Value last_aggregate = rocprim::get<1>(wrapped_op(init, reduction));
+            if(!WithCarry && flat_id == BlockSize - 1)
+            {
+                aggregates_output[total_runs - 1] = last_aggregate;
+            }
+            else if(WithCarry && flat_id == 0)
+            {
+                storage_.last_aggregate.emplace(0, last_aggregate);
+            }
+        }
+
+        if(WithCarry)
+        {
+            ::rocprim::syncthreads();
+            // Without a head in the block the carried run stays open.
+            if(total_runs > 1 || !carry_in)
+            {
+                carry.key = storage_.last_key.get_unsafe_array()[0];
+            }
+            carry.aggregate = storage_.last_aggregate.get_unsafe_array()[0];
+            carry.is_open   = true;
+        }
+        run_count = written_runs;
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group blockmodule
+
+#endif // ROCPRIM_BLOCK_BLOCK_REDUCE_BY_KEY_HPP_
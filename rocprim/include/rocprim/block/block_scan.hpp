@@ -1312,6 +1312,151 @@ public:
             base_type::exclusive_scan(input, output, storage, prefix_callback_op, scan_op);
         }
     }
+
+    /// \brief Performs \p N independent inclusive scans across threads in a block.
+    ///
+    /// The k-th values of all threads are scanned into the k-th outputs. With
+    /// \p block_scan_algorithm::using_warp_scan all scans share the synchronization
+    /// barriers, the other algorithms perform them one after another.
+    ///
+    /// \tparam N - number of independent values.
+    /// \tparam BinaryFunction - type of binary function used for scan. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - reference to an array containing the thread input values, one
+    /// for every scan.
+    /// \param [out] output - reference to an array of thread output values. May be aliased
+    /// with \p input.
+    /// \param [in] storage - reference to an array of temporary storage objects, one for every
+    /// scan.
+    /// \param [in] scan_op - binary operation function object that will be used for scan.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    ///
+    /// \par Examples
+    /// \parblock
+    /// The example computes the running sums of two counters in a block of 256 threads.
+    ///
+    /// \code{.cpp}
+    /// __global__ void example_kernel(...) // blockDim.x = 256
+    /// {
+    ///     using block_scan_int = rocprim::block_scan<int, 256>;
+    ///     __shared__ block_scan_int::storage_type storage[2];
+    ///
+    ///     int counters[2] = ...;
+    ///     block_scan_int().multi_inclusive_scan(counters, counters, storage);
+    ///     ...
+    /// }
+    /// \endcode
+    /// \endparblock
+    template<unsigned int N, class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void multi_inclusive_scan(const T (&input)[N],
+                              T (&output)[N],
+                              storage_type (&storage)[N],
+                              BinaryFunction scan_op = BinaryFunction())
+    {
+        base_type::multi_inclusive_scan(input, output, storage, scan_op);
+    }
+
+    /// \overload
+    /// \brief Performs \p N independent inclusive scans across threads in a block.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    ///
+    /// \tparam N - number of independent values.
+    /// \tparam BinaryFunction - type of binary function used for scan. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - reference to an array containing the thread input values, one
+    /// for every scan.
+    /// \param [out] output - reference to an array of thread output values. May be aliased
+    /// with \p input.
+    /// \param [in] scan_op - binary operation function object that will be used for scan.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    template<unsigned int N, class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void multi_inclusive_scan(const T (&input)[N],
+                              T (&output)[N],
+                              BinaryFunction scan_op = BinaryFunction())
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage[N];
+        base_type::multi_inclusive_scan(input, output, storage, scan_op);
+    }
+
+    /// \brief Performs \p N independent exclusive scans across threads in a block.
+    ///
+    /// The k-th values of all threads are scanned into the k-th outputs, starting
+    /// with the k-th initial value. With \p block_scan_algorithm::using_warp_scan all scans
+    /// share the synchronization barriers, the other algorithms perform them one after another.
+    ///
+    /// \tparam N - number of independent values.
+    /// \tparam BinaryFunction - type of binary function used for scan. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - reference to an array containing the thread input values, one
+    /// for every scan.
+    /// \param [out] output - reference to an array of thread output values. May be aliased
+    /// with \p input.
+    /// \param [in] init - reference to an array of initial values, one for every scan.
+    /// \param [in] storage - reference to an array of temporary storage objects, one for every
+    /// scan.
+    /// \param [in] scan_op - binary operation function object that will be used for scan.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<unsigned int N, class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void multi_exclusive_scan(const T (&input)[N],
+                              T (&output)[N],
+                              const T (&init)[N],
+                              storage_type (&storage)[N],
+                              BinaryFunction scan_op = BinaryFunction())
+    {
+        base_type::multi_exclusive_scan(input, output, init, storage, scan_op);
+    }
+
+    /// \overload
+    /// \brief Performs \p N independent exclusive scans across threads in a block.
+    ///
+    /// * This overload does not accept storage argument. Required shared memory is
+    /// allocated by the method itself.
+    ///
+    /// \tparam N - number of independent values.
+    /// \tparam BinaryFunction - type of binary function used for scan. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - reference to an array containing the thread input values, one
+    /// for every scan.
+    /// \param [out] output - reference to an array of thread output values. May be aliased
+    /// with \p input.
+    /// \param [in] init - reference to an array of initial values, one for every scan.
+    /// \param [in] scan_op - binary operation function object that will be used for scan.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    template<unsigned int N, class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void multi_exclusive_scan(const T (&input)[N],
+                              T (&output)[N],
+                              const T (&init)[N],
+                              BinaryFunction scan_op = BinaryFunction())
+    {
+        ROCPRIM_SHARED_MEMORY storage_type storage[N];
+        base_type::multi_exclusive_scan(input, output, init, storage, scan_op);
+    }
 };
 
 END_ROCPRIM_NAMESPACE
@@ -28,6 +28,7 @@
 #include "../functional.hpp"
 #include "../types.hpp"
 
+#include "block_load_func.hpp"
 #include "block_store_func.hpp"
 #include "block_exchange.hpp"
 
@@ -57,10 +58,18 @@ enum class block_store_method
     /// * Performance remains high due to increased memory coalescing, provided that
     /// vectorization requirements are fulfilled. Otherwise, performance will default
     /// to \p block_store_direct.
+    /// * The items of a thread are stored as raw bytes with up to 128-bit accesses if \p T is
+    /// trivially copyable and they are at least 4 bytes, including packed types of sizes
+    /// that are not powers of two. An output offset (\p block_output) that is not aligned to these
+    /// accesses is handled with 32-bit accesses and byte shifts.
+    /// * A \p cache_modified_output_iterator with \p store_cs is stored through its pointer with
+    /// nontemporal vectorized stores.
+    /// * A \p transform_output_iterator or a \p tee_iterator over pointers is stored through
+    /// the pointers with vectorized stores, the items are transformed in registers.
     /// \par Requirements:
-    /// * The output offset (\p block_output) must be quad-item aligned.
-    /// * The following conditions will prevent vectorization and switch to default
+    /// * Otherwise, the following conditions will prevent vectorization and switch to default
     /// \p block_store_direct:
+    ///   * The output offset (\p block_output) is not quad-item aligned.
     ///   * \p ItemsPerThread is odd.
     ///   * The datatype \p T is not a primitive or a HIP vector type (e.g. int2,
     /// int4, etc.
@@ -277,6 +286,58 @@ public:
         (void) storage;
         store(block_output, items, valid);
     }
+
+    /// \brief Stores the items selected by a mask from an arrangement of items across the
+    /// thread block into an arrangement on continuous memory.
+    ///
+    /// Item \p i of the thread is stored if bit \p i of \p mask is set, the other outputs
+    /// are not written.
+    ///
+    /// \tparam OutputIterator - [inferred] an iterator type for output (can be a simple
+    /// pointer.
+    ///
+    /// \param [out] block_output - the output iterator from the thread block to store to.
+    /// \param [in] items - array that data is read from.
+    /// \param [in] mask - the mask of the items of the calling thread to store, at most 32
+    /// items per thread are supported.
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store_masked(OutputIterator block_output,
+                      T (&items)[ItemsPerThread],
+                      unsigned int mask)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_store_direct_blocked_masked(flat_id, block_output, items, mask);
+    }
+
+    /// \brief Stores the items selected by per-item flags from an arrangement of items across
+    /// the thread block into an arrangement on continuous memory.
+    ///
+    /// The flags are arranged like the items: item \p i of the thread is stored if its flag
+    /// converts to \p true, the other outputs are not written. A packed bitmask can be passed
+    /// as the flags with \p rocprim::bitmask_iterator.
+    ///
+    /// \tparam OutputIterator - [inferred] an iterator type for output (can be a simple
+    /// pointer.
+    /// \tparam FlagIterator - [inferred] an iterator type for the flags, its value type must
+    /// be convertible to \p bool.
+    ///
+    /// \param [out] block_output - the output iterator from the thread block to store to.
+    /// \param [in] items - array that data is read from.
+    /// \param [in] flags - the flags of the items of the thread block.
+    template<class OutputIterator,
+             class FlagIterator,
+             class = detail::enable_if_flag_iterator_t<FlagIterator>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store_masked(OutputIterator block_output,
+                      T (&items)[ItemsPerThread],
+                      FlagIterator flags)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        bool item_flags[ItemsPerThread];
+        block_load_direct_blocked(flat_id, flags, item_flags);
+        store_masked(block_output, items, detail::flags_to_item_mask(item_flags));
+    }
 };
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -342,6 +403,30 @@ public:
         const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
         block_store_direct_striped<BlockSize>(flat_id, block_output, items, valid);
     }
+
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store_masked(OutputIterator block_output,
+                      T (&items)[ItemsPerThread],
+                      unsigned int mask)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_store_direct_striped_masked<BlockSize>(flat_id, block_output, items, mask);
+    }
+
+    template<class OutputIterator,
+             class FlagIterator,
+             class = detail::enable_if_flag_iterator_t<FlagIterator>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store_masked(OutputIterator block_output,
+                      T (&items)[ItemsPerThread],
+                      FlagIterator flags)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        bool item_flags[ItemsPerThread];
+        block_load_direct_striped<BlockSize>(flat_id, flags, item_flags);
+        store_masked(block_output, items, detail::flags_to_item_mask(item_flags));
+    }
 };
 
 template<
@@ -380,6 +465,33 @@ public:
         block_store_direct_blocked(flat_id, block_output, items);
     }
 
+    template<class V, cache_store_modifier Modifier, class Difference, class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(cache_modified_output_iterator<V, Modifier, Difference> block_output,
+               U (&items)[ItemsPerThread])
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_store_direct_blocked_vectorized(flat_id, block_output, items);
+    }
+
+    template<class V, class UnaryFunction, class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(transform_output_iterator<V*, UnaryFunction> block_output,
+               U (&items)[ItemsPerThread])
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_store_direct_blocked_vectorized(flat_id, block_output, items);
+    }
+
+    template<class V1, class V2, class U>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store(tee_iterator<V1*, V2*> block_output,
+               U (&items)[ItemsPerThread])
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_store_direct_blocked_vectorized(flat_id, block_output, items);
+    }
+
     template<class OutputIterator>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void store(OutputIterator block_output,
@@ -419,6 +531,39 @@ public:
         (void) storage;
         store(block_output, items, valid);
     }
+
+    template<class OutputIterator>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store_masked(OutputIterator block_output,
+                      T (&items)[ItemsPerThread],
+                      unsigned int mask)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_store_direct_blocked_masked(flat_id, block_output, items, mask);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store_masked(T* block_output,
+                      T (&items)[ItemsPerThread],
+                      unsigned int mask)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        block_store_direct_blocked_vectorized_masked(flat_id, block_output, items, mask);
+    }
+
+    template<class OutputIterator,
+             class FlagIterator,
+             class = detail::enable_if_flag_iterator_t<FlagIterator>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void store_masked(OutputIterator block_output,
+                      T (&items)[ItemsPerThread],
+                      FlagIterator flags)
+    {
+        const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        bool item_flags[ItemsPerThread];
+        block_load_direct_blocked(flat_id, flags, item_flags);
+        store_masked(block_output, items, detail::flags_to_item_mask(item_flags));
+    }
 };
 
 template<
@@ -442,9 +587,8 @@ public:
     void store(OutputIterator block_output,
                T (&items)[ItemsPerThread])
     {
-        ROCPRIM_SHARED_MEMORY storage_type storage;
         const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
-        block_exchange_type().blocked_to_striped(items, items, storage);
+        block_exchange_type().blocked_to_striped(items, items);
         block_store_direct_striped<BlockSize>(flat_id, block_output, items);
     }
 
@@ -454,9 +598,8 @@ public:
                T (&items)[ItemsPerThread],
                unsigned int valid)
     {
-        ROCPRIM_SHARED_MEMORY storage_type storage;
         const unsigned int flat_id = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
-        block_exchange_type().blocked_to_striped(items, items, storage);
+        block_exchange_type().blocked_to_striped(items, items);
         block_store_direct_striped<BlockSize>(flat_id, block_output, items, valid);
     }
 
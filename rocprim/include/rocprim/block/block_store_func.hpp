@@ -28,6 +28,17 @@
 #include "../functional.hpp"
 #include "../types.hpp"
 
+#include "../iterator/cache_modified_output_iterator.hpp"
+#include "../iterator/tee_iterator.hpp"
+#include "../iterator/transform_output_iterator.hpp"
+
+#include "detail/block_item_mask.hpp"
+#include "detail/block_load_store_vector.hpp"
+
+#include <type_traits>
+
+#include <cstdint>
+
 /// \addtogroup blockmodule
 /// @{
 
@@ -116,6 +127,77 @@ void block_store_direct_blocked(unsigned int flat_id,
     }
 }
 
+namespace detail
+{
+
+template<bool NonTemporal, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto block_store_direct_blocked_vectorized_impl(unsigned int flat_id,
+                                                T*           block_output,
+                                                U (&items)[ItemsPerThread]) ->
+    typename std::enable_if<is_thread_bytes_vectorizable<T, ItemsPerThread>::value>::type
+{
+    static_assert(std::is_convertible<U, T>::value,
+                  "The type U must be such that it can be implicitly converted to T.");
+
+    T raw_items[ItemsPerThread];
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        raw_items[item] = items[item];
+    }
+
+    store_thread_bytes<NonTemporal>(block_output + flat_id * ItemsPerThread, raw_items);
+}
+
+template<bool NonTemporal, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto block_store_direct_blocked_vectorized_impl(unsigned int flat_id,
+                                                T*           block_output,
+                                                U (&items)[ItemsPerThread]) ->
+    typename std::enable_if<!is_thread_bytes_vectorizable<T, ItemsPerThread>::value
+                            && is_vectorizable<T, ItemsPerThread>::value>::type
+{
+    static_assert(std::is_convertible<U, T>::value,
+                  "The type U must be such that it can be implicitly converted to T.");
+
+    typedef typename match_vector_type<T, ItemsPerThread>::type vector_type;
+    constexpr unsigned int vectors_per_thread = (sizeof(T) * ItemsPerThread) / sizeof(vector_type);
+
+    // The alignment is the same for all threads of the block
+    if(reinterpret_cast<uintptr_t>(block_output) % alignof(vector_type) != 0)
+    {
+        block_store_direct_blocked(flat_id, block_output, items);
+        return;
+    }
+
+    vector_type *vectors_ptr = reinterpret_cast<vector_type*>(const_cast<T*>(block_output));
+
+    vector_type raw_vector_items[vectors_per_thread];
+    T *raw_items = reinterpret_cast<T*>(raw_vector_items);
+
+    ROCPRIM_UNROLL
+    for (unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        raw_items[item] = items[item];
+    }
+
+    block_store_direct_blocked(flat_id, vectors_ptr, raw_vector_items);
+}
+
+template<bool NonTemporal, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto block_store_direct_blocked_vectorized_impl(unsigned int flat_id,
+                                                T*           block_output,
+                                                U (&items)[ItemsPerThread]) ->
+    typename std::enable_if<!is_thread_bytes_vectorizable<T, ItemsPerThread>::value
+                            && !is_vectorizable<T, ItemsPerThread>::value>::type
+{
+    block_store_direct_blocked(flat_id, block_output, items);
+}
+
+} // end namespace detail
+
 /// \brief Stores a blocked arrangement of items from across the thread block
 /// into a blocked arrangement on continuous memory.
 ///
@@ -123,13 +205,15 @@ void block_store_direct_blocked(unsigned int flat_id,
 /// across a thread block. Each thread uses a \p flat_id to store a range of
 /// \p ItemsPerThread \p items to the thread block.
 ///
-/// The input offset (\p block_output + offset) must be quad-item aligned.
+/// The items of a thread are stored as raw bytes with the widest stores (up to 128 bits) that
+/// their size allows, so packed types such as 6- or 12-byte structs are vectorized as well.
+/// This requires the datatype \p T to be trivially copyable, and the items of a thread to be
+/// at least 4 bytes. If the output offset (\p block_output + offset) is not aligned to these
+/// stores, the bytes before the first and after the last aligned 32-bit word are stored one at
+/// a time, and the words in between are shifted into place.
 ///
-/// The following conditions will prevent vectorization and switch to default
-/// block_load_direct_blocked:
-/// * \p ItemsPerThread is odd.
-/// * The datatype \p T is not a primitive or a HIP vector type (e.g. int2,
-/// int4, etc.
+/// Smaller items are stored with HIP vector types if they are vectorizable and the output offset
+/// is quad-item aligned, otherwise with block_store_direct_blocked.
 ///
 /// \tparam T - [inferred] the output data type
 /// \tparam U - [inferred] the input data type
@@ -147,42 +231,137 @@ template<
     unsigned int ItemsPerThread
 >
 ROCPRIM_DEVICE ROCPRIM_INLINE
-auto
-block_store_direct_blocked_vectorized(unsigned int flat_id,
-                                      T* block_output,
-                                      U (&items)[ItemsPerThread]) -> typename std::enable_if<detail::is_vectorizable<T, ItemsPerThread>::value>::type
+void block_store_direct_blocked_vectorized(unsigned int flat_id,
+                                           T* block_output,
+                                           U (&items)[ItemsPerThread])
 {
-    static_assert(std::is_convertible<U, T>::value,
-                  "The type U must be such that it can be implicitly converted to T.");
-
-    typedef typename detail::match_vector_type<T, ItemsPerThread>::type vector_type;
-    constexpr unsigned int vectors_per_thread = (sizeof(T) * ItemsPerThread) / sizeof(vector_type);
-    vector_type *vectors_ptr = reinterpret_cast<vector_type*>(const_cast<T*>(block_output));
-
-    vector_type raw_vector_items[vectors_per_thread];
-    T *raw_items = reinterpret_cast<T*>(raw_vector_items);
-
-    ROCPRIM_UNROLL
-    for (unsigned int item = 0; item < ItemsPerThread; item++)
-    {
-        raw_items[item] = items[item];
-    }
+    detail::block_store_direct_blocked_vectorized_impl<false>(flat_id, block_output, items);
+}
 
-    block_store_direct_blocked(flat_id, vectors_ptr, raw_vector_items);
+/// \brief Stores a blocked arrangement of items from across the thread block
+/// into a blocked arrangement on continuous memory with nontemporal stores.
+///
+/// Same as block_store_direct_blocked_vectorized, but the vectorized stores are nontemporal
+/// (streaming) stores, which do not keep the output in the caches where the architecture allows.
+/// Use it for output that is not read again soon, so that it does not evict data that is reused.
+///
+/// \tparam T - [inferred] the output data type
+/// \tparam U - [inferred] the input data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_output - the input iterator from the thread block to load from
+/// \param items - array that data is loaded to
+template<
+    class T,
+    class U,
+    unsigned int ItemsPerThread
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_direct_blocked_nontemporal(unsigned int flat_id,
+                                            T* block_output,
+                                            U (&items)[ItemsPerThread])
+{
+    detail::block_store_direct_blocked_vectorized_impl<true>(flat_id, block_output, items);
 }
 
+/// \brief Stores a blocked arrangement of items from across the thread block
+/// into a blocked arrangement on continuous memory, with the store modifier of a
+/// cache_modified_output_iterator.
+///
+/// With \p store_cs the items are stored as by block_store_direct_blocked_nontemporal to the
+/// wrapped pointer, otherwise as by block_store_direct_blocked.
+///
+/// \tparam T - [inferred] the output data type
+/// \tparam Modifier - [inferred] the cache store modifier of the iterator
+/// \tparam Difference - [inferred] the difference type of the iterator
+/// \tparam U - [inferred] the input data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_output - the output iterator from the thread block to store to
+/// \param items - array that data is stored to thread block
 template<
     class T,
+    cache_store_modifier Modifier,
+    class Difference,
     class U,
     unsigned int ItemsPerThread
 >
 ROCPRIM_DEVICE ROCPRIM_INLINE
-auto
-block_store_direct_blocked_vectorized(unsigned int flat_id,
-                                      T* block_output,
-                                      U (&items)[ItemsPerThread]) -> typename std::enable_if<!detail::is_vectorizable<T, ItemsPerThread>::value>::type
+void block_store_direct_blocked_vectorized(
+    unsigned int                                           flat_id,
+    cache_modified_output_iterator<T, Modifier, Difference> block_output,
+    U (&items)[ItemsPerThread])
 {
-    block_store_direct_blocked(flat_id, block_output, items);
+    if ROCPRIM_IF_CONSTEXPR(Modifier == store_cs)
+    {
+        block_store_direct_blocked_nontemporal(flat_id, block_output.base(), items);
+    }
+    else
+    {
+        block_store_direct_blocked(flat_id, block_output, items);
+    }
+}
+
+/// \brief Stores a blocked arrangement of items from across the thread block
+/// into a blocked arrangement on continuous memory, through a transform_output_iterator
+/// over a pointer.
+///
+/// The items are transformed in registers and stored as by
+/// block_store_direct_blocked_vectorized to the wrapped pointer.
+///
+/// \tparam T - [inferred] the output data type
+/// \tparam UnaryFunction - [inferred] the transform functor of the iterator
+/// \tparam U - [inferred] the input data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_output - the output iterator from the thread block to store to
+/// \param items - array that data is stored to thread block
+template<class T, class UnaryFunction, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_direct_blocked_vectorized(
+    unsigned int                                 flat_id,
+    transform_output_iterator<T*, UnaryFunction> block_output,
+    U (&items)[ItemsPerThread])
+{
+    const UnaryFunction transform = block_output.functor();
+
+    T results[ItemsPerThread];
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        results[item] = transform(items[item]);
+    }
+    block_store_direct_blocked_vectorized(flat_id, block_output.base(), results);
+}
+
+/// \brief Stores a blocked arrangement of items from across the thread block
+/// into two blocked arrangements on continuous memory, through a tee_iterator over pointers.
+///
+/// The items are stored as by block_store_direct_blocked_vectorized to both pointers.
+///
+/// \tparam T1 - [inferred] the data type of the first output
+/// \tparam T2 - [inferred] the data type of the second output
+/// \tparam U - [inferred] the input data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_output - the output iterator from the thread block to store to
+/// \param items - array that data is stored to thread block
+template<class T1, class T2, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_direct_blocked_vectorized(unsigned int            flat_id,
+                                           tee_iterator<T1*, T2*> block_output,
+                                           U (&items)[ItemsPerThread])
+{
+    block_store_direct_blocked_vectorized(flat_id, block_output.first(), items);
+    block_store_direct_blocked_vectorized(flat_id, block_output.second(), items);
 }
 
 /// \brief Stores a striped arrangement of items from across the thread block
@@ -387,6 +566,120 @@ void block_store_direct_warp_striped(unsigned int flat_id,
     }
 }
 
+/// \brief Stores the items selected by a mask from a blocked arrangement of items across the
+/// thread block into continuous memory.
+///
+/// Item \p i of the thread is stored if bit \p i of \p mask is set, the other outputs are not
+/// written. Only the selected items are written, so sparse masks need fewer memory transactions.
+///
+/// \tparam OutputIterator - [inferred] an iterator type for output (can be a simple
+/// pointer
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread, at most 32
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_output - the output iterator from the thread block to store to
+/// \param items - array that data is stored from
+/// \param mask - the mask of the items of the thread to store
+template<class OutputIterator, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_direct_blocked_masked(unsigned int   flat_id,
+                                       OutputIterator block_output,
+                                       T (&items)[ItemsPerThread],
+                                       unsigned int   mask)
+{
+    static_assert(std::is_assignable<decltype(block_output[0]), T>::value,
+                  "The type T must be such that an object of type OutputIterator "
+                  "can be dereferenced and assigned a value of type T.");
+    static_assert(ItemsPerThread <= 32, "Masks of items support at most 32 items per thread");
+
+    OutputIterator thread_iter = block_output + flat_id * ItemsPerThread;
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        if(mask & (1u << item))
+        {
+            thread_iter[item] = items[item];
+        }
+    }
+}
+
+/// \brief Stores the items selected by a mask from a blocked arrangement of items across the
+/// thread block into continuous memory, using vectorized stores where the mask is dense.
+///
+/// If all items of all threads of the warp are selected, the items are stored as by
+/// block_store_direct_blocked_vectorized. Otherwise only the selected items are stored as by
+/// block_store_direct_blocked_masked. The choice is made per warp, so the warps do not diverge.
+/// All threads of the warp must call the function.
+///
+/// \tparam T - [inferred] the output data type
+/// \tparam U - [inferred] the input data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread, at most 32
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_output - the output pointer from the thread block to store to
+/// \param items - array that data is stored from
+/// \param mask - the mask of the items of the thread to store
+template<class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_direct_blocked_vectorized_masked(unsigned int flat_id,
+                                                  T*           block_output,
+                                                  U (&items)[ItemsPerThread],
+                                                  unsigned int mask)
+{
+    constexpr unsigned int full_mask = detail::full_item_mask<ItemsPerThread>();
+    if(::rocprim::warp_all((mask & full_mask) == full_mask))
+    {
+        block_store_direct_blocked_vectorized(flat_id, block_output, items);
+    }
+    else
+    {
+        block_store_direct_blocked_masked(flat_id, block_output, items, mask);
+    }
+}
+
+/// \brief Stores the items selected by a mask from a striped arrangement of items across the
+/// thread block into continuous memory.
+///
+/// Item \p i of the thread, at offset <tt>i * BlockSize + flat_id</tt>, is stored if bit \p i
+/// of \p mask is set, the other outputs are not written.
+///
+/// \tparam BlockSize - the number of threads in a block
+/// \tparam OutputIterator - [inferred] an iterator type for output (can be a simple
+/// pointer
+/// \tparam T - [inferred] the data type
+/// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+/// each thread, at most 32
+///
+/// \param flat_id - a local flat 1D thread id in a block (tile) for the calling thread
+/// \param block_output - the output iterator from the thread block to store to
+/// \param items - array that data is stored from
+/// \param mask - the mask of the items of the thread to store
+template<unsigned int BlockSize, class OutputIterator, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_store_direct_striped_masked(unsigned int   flat_id,
+                                       OutputIterator block_output,
+                                       T (&items)[ItemsPerThread],
+                                       unsigned int   mask)
+{
+    static_assert(std::is_assignable<decltype(block_output[0]), T>::value,
+                  "The type T must be such that an object of type OutputIterator "
+                  "can be dereferenced and assigned a value of type T.");
+    static_assert(ItemsPerThread <= 32, "Masks of items support at most 32 items per thread");
+
+    OutputIterator thread_iter = block_output + flat_id;
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        if(mask & (1u << item))
+        {
+            thread_iter[item * BlockSize] = items[item];
+        }
+    }
+}
+
 END_ROCPRIM_NAMESPACE
 
 /// @}
@@ -43,6 +43,12 @@ enum class block_padding_hint {
     /// shared memory. It's advised to use this when LDS usage is restricting
     /// occupancy.
     lds_occupancy_bound = 2,
+
+    /// Never use padding, but permute the shared memory layout with an XOR swizzle so that
+    /// the accesses are free of bank conflicts without using more shared memory, if applicable.
+    /// Only \p block_exchange (and so the exchanges of \p block_radix_sort) supports the
+    /// swizzled layout, other algorithms use it as \p block_padding_hint::never_pad .
+    xor_swizzle = 3,
 };
 
 namespace detail
@@ -64,7 +70,8 @@ template<block_padding_hint PaddingHint, typename PaddedConfig, typename Unpadde
 using select_block_padding_config
     = std::conditional_t<PaddingHint == block_padding_hint::avoid_conflicts,
                          PaddedConfig,
-                         std::conditional_t<PaddingHint == block_padding_hint::never_pad,
+                         std::conditional_t<PaddingHint == block_padding_hint::never_pad
+                                                || PaddingHint == block_padding_hint::xor_swizzle,
                                             UnpaddedConfig,
                                             typename detail::select_max_by_value_t<
                                                 map_occupancy_to_value<PaddedConfig>,
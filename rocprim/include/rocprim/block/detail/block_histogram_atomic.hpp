@@ -68,22 +68,10 @@ public:
         {
             const unsigned int bin = static_cast<unsigned int>(input[i]);
 
-            // Get a mask with the threads that have the same value for `bin`.
-            ::rocprim::lane_mask_type peer_mask
-                = ::rocprim::match_any<::rocprim::Log2<Bins>::VALUE>(bin);
-
-            // The total number of threads in the warp which also have this digit.
-            const unsigned int bin_count = bit_count(peer_mask);
-
-            // The number of threads in the warp that have the same digit AND whose lane id is lower
-            // than the current thread's.
-            const unsigned int peer_digit_prefix = masked_bit_count(peer_mask);
-
-            // Set counter value.
-            if(peer_digit_prefix == 0)
-            {
-                detail::atomic_add(&hist[bin], Counter(bin_count));
-            }
+            // The threads of the warp with the same bin add their count with one atomic.
+            ::rocprim::warp_aggregated_atomic_add<::rocprim::Log2<Bins>::VALUE>(hist,
+                                                                                bin,
+                                                                                Counter(1));
         }
         ::rocprim::syncthreads();
     }
@@ -0,0 +1,64 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_DETAIL_BLOCK_ITEM_MASK_HPP_
+#define ROCPRIM_BLOCK_DETAIL_BLOCK_ITEM_MASK_HPP_
+
+#include "../../config.hpp"
+
+#include <type_traits>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The mask of the ItemsPerThread items of a thread in which all items are set.
+template<unsigned int ItemsPerThread>
+ROCPRIM_HOST_DEVICE constexpr unsigned int full_item_mask()
+{
+    static_assert(ItemsPerThread >= 1 && ItemsPerThread <= 32,
+                  "Masks of items support at most 32 items per thread");
+    return ItemsPerThread == 32 ? ~0u : (1u << ItemsPerThread) - 1u;
+}
+
+// Converts the flags of the items of a thread to a mask, bit i is flag i.
+template<class Flag, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned int flags_to_item_mask(const Flag (&flags)[ItemsPerThread])
+{
+    static_assert(ItemsPerThread <= 32, "Masks of items support at most 32 items per thread");
+    unsigned int mask = 0;
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        mask |= (static_cast<bool>(flags[item]) ? 1u : 0u) << item;
+    }
+    return mask;
+}
+
+template<class FlagIterator>
+using enable_if_flag_iterator_t = std::enable_if_t<!std::is_integral<FlagIterator>::value>;
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_BLOCK_DETAIL_BLOCK_ITEM_MASK_HPP_
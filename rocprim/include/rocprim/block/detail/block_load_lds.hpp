@@ -0,0 +1,148 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_DETAIL_BLOCK_LOAD_LDS_HPP_
+#define ROCPRIM_BLOCK_DETAIL_BLOCK_LOAD_LDS_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics/thread.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+// CDNA3 global loads can write their results straight to shared memory (LDS), without going
+// through registers.
+#if defined(__HIP_DEVICE_COMPILE__)                                       \
+    && (defined(__gfx940__) || defined(__gfx941__) || defined(__gfx942__) \
+        || defined(__gfx950__))
+    #if __has_builtin(__builtin_amdgcn_global_load_lds)
+        #define ROCPRIM_DETAIL_HAS_GLOBAL_LOAD_LDS 1
+    #endif
+#endif
+#ifndef ROCPRIM_DETAIL_HAS_GLOBAL_LOAD_LDS
+    #define ROCPRIM_DETAIL_HAS_GLOBAL_LOAD_LDS 0
+#endif
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Whether the items of a block of BlockSize threads can be copied from InputIterator to shared
+// memory with direct-to-LDS loads: the input is a pointer to T, and T is made of aligned 32-bit
+// words, the size of the loads. Every wave writes whole rows of the shared memory, so the block
+// must be made of full waves.
+template<class T, unsigned int BlockSize, class InputIterator>
+struct use_global_load_lds
+    : std::integral_constant<
+          bool,
+          ROCPRIM_DETAIL_HAS_GLOBAL_LOAD_LDS && std::is_pointer<InputIterator>::value
+              && std::is_same<std::remove_cv_t<std::remove_pointer_t<InputIterator>>, T>::value
+              && std::is_trivially_copyable<T>::value && sizeof(T) % 4 == 0
+              && alignof(T) >= 4 && BlockSize % ::rocprim::device_warp_size() == 0>
+{};
+
+// Copies the first `valid` of the BlockSize * ItemsPerThread items of `input` to `lds` in the
+// same order. The copy is asynchronous: `block_load_to_lds_wait` must be called by all threads
+// before the items are read.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         bool         Guarded,
+         class InputIterator,
+         class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto block_load_to_lds_async(const unsigned int flat_id,
+                             InputIterator      input,
+                             T*                 lds,
+                             const unsigned int valid)
+    -> std::enable_if_t<use_global_load_lds<T, BlockSize, InputIterator>::value>
+{
+#if ROCPRIM_DETAIL_HAS_GLOBAL_LOAD_LDS
+    // Each lane loads one word of a row of the wave, and the wave writes the row contiguously
+    // starting from a wave-uniform address.
+    constexpr unsigned int words_per_item = sizeof(T) / 4;
+    constexpr unsigned int words          = BlockSize * ItemsPerThread * words_per_item;
+    const unsigned int     wave_offset    = flat_id - ::rocprim::lane_id();
+    const unsigned int     valid_words    = valid * words_per_item;
+
+    const unsigned int* src = reinterpret_cast<const unsigned int*>(input);
+    unsigned int*       dst = reinterpret_cast<unsigned int*>(lds);
+    ROCPRIM_UNROLL
+    for(unsigned int offset = 0; offset < words; offset += BlockSize)
+    {
+        if(!Guarded || offset + flat_id < valid_words)
+        {
+            __builtin_amdgcn_global_load_lds(
+                (__attribute__((address_space(1))) void*)(src + offset + flat_id),
+                (__attribute__((address_space(3))) void*)(dst + offset + wave_offset),
+                4 /* size */,
+                0 /* offset */,
+                0 /* aux */);
+        }
+    }
+#else
+    (void)flat_id;
+    (void)input;
+    (void)lds;
+    (void)valid;
+#endif
+}
+
+// The fallback copies through registers.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         bool         Guarded,
+         class InputIterator,
+         class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto block_load_to_lds_async(const unsigned int flat_id,
+                             InputIterator      input,
+                             T*                 lds,
+                             const unsigned int valid)
+    -> std::enable_if_t<!use_global_load_lds<T, BlockSize, InputIterator>::value>
+{
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; ++item)
+    {
+        const unsigned int index = item * BlockSize + flat_id;
+        if(!Guarded || index < valid)
+        {
+            lds[index] = input[index];
+        }
+    }
+}
+
+// Waits for the copies of `block_load_to_lds_async` of all threads of the block.
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void block_load_to_lds_wait()
+{
+#if ROCPRIM_DETAIL_HAS_GLOBAL_LOAD_LDS
+    // Direct-to-LDS loads are counted by vmcnt, not lgkmcnt.
+    asm volatile("s_waitcnt vmcnt(0)" ::: "memory");
+#endif
+    ::rocprim::syncthreads();
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_BLOCK_DETAIL_BLOCK_LOAD_LDS_HPP_
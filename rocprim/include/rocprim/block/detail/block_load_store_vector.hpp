@@ -0,0 +1,260 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_BLOCK_DETAIL_BLOCK_LOAD_STORE_VECTOR_HPP_
+#define ROCPRIM_BLOCK_DETAIL_BLOCK_LOAD_STORE_VECTOR_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include <type_traits>
+
+#include <cstdint>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Vectors of 32-bit words of 4, 8 and 16 bytes, which are also the types that
+// __builtin_nontemporal_load and __builtin_nontemporal_store take.
+template<unsigned int Bytes>
+struct dword_vector
+{};
+
+template<>
+struct dword_vector<4>
+{
+    using type = unsigned int;
+};
+
+template<>
+struct dword_vector<8>
+{
+    using type = unsigned int __attribute__((ext_vector_type(2)));
+};
+
+template<>
+struct dword_vector<16>
+{
+    using type = unsigned int __attribute__((ext_vector_type(4)));
+};
+
+// Loads and stores a vector, with nontemporal (streaming) accesses if NonTemporal is set and the
+// vector is 4, 8 or 16 bytes. Nontemporal accesses bypass the caches where the architecture
+// allows, so data touched once does not evict data that is reused.
+template<bool NonTemporal, class V, class Enable = void>
+struct vector_access
+{
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static V load(const V* ptr)
+    {
+        return *ptr;
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void store(V* ptr, const V& value)
+    {
+        *ptr = value;
+    }
+};
+
+template<class V>
+struct vector_access<true,
+                     V,
+                     typename std::enable_if<sizeof(V) == 4 || sizeof(V) == 8
+                                             || sizeof(V) == 16>::type>
+{
+    using word_type = typename dword_vector<sizeof(V)>::type;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static V load(const V* ptr)
+    {
+        return bit_cast<V>(__builtin_nontemporal_load(reinterpret_cast<const word_type*>(ptr)));
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static void store(V* ptr, const V& value)
+    {
+        __builtin_nontemporal_store(bit_cast<word_type>(value), reinterpret_cast<word_type*>(ptr));
+    }
+};
+
+// Whether the items of a thread are loaded and stored as raw bytes by load_thread_bytes and
+// store_thread_bytes.
+template<class T, unsigned int ItemsPerThread>
+struct is_thread_bytes_vectorizable
+    : std::integral_constant<bool,
+                             std::is_trivially_copyable<T>::value
+                                 && sizeof(T) * ItemsPerThread >= 4>
+{};
+
+// The widest word that the bytes of the items of a thread are a multiple of.
+template<unsigned int Bytes>
+using thread_bytes_word_type =
+    typename dword_vector<Bytes % 16 == 0 ? 16 : Bytes % 8 == 0 ? 8 : 4>::type;
+
+// The 32 bits starting `shift` bytes into `lo`, continuing into `hi`. The compiler emits a
+// single v_alignbyte_b32 for it.
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned int funnel_shift_bytes(const unsigned int lo,
+                                const unsigned int hi,
+                                const unsigned int shift)
+{
+    return static_cast<unsigned int>(
+        ((static_cast<unsigned long long>(hi) << 32) | lo) >> (8 * shift));
+}
+
+// Loads the items of a thread as raw bytes, so that any trivially copyable type is loaded with
+// the widest words its size allows. If the items are aligned to that word, which holds for
+// all threads of a block or for none, they are loaded directly. Otherwise the 32-bit words
+// covering the items are loaded and shifted into place: the first and the last word only
+// partially belong to the items, but all words hold at least one byte of them.
+template<bool NonTemporal, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void load_thread_bytes(const T* input, T (&items)[ItemsPerThread])
+{
+    static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+    constexpr unsigned int bytes = sizeof(T) * ItemsPerThread;
+    constexpr unsigned int words = ceiling_div(bytes, 4u);
+    static_assert(bytes >= 4, "The items of a thread must cover at least one word");
+
+    using word_type                      = thread_bytes_word_type<bytes>;
+    constexpr unsigned int aligned_words = ceiling_div(bytes, unsigned(sizeof(word_type)));
+    constexpr bool         whole_words   = bytes % 4 == 0;
+
+    const uintptr_t address = reinterpret_cast<uintptr_t>(input);
+    if(whole_words && address % sizeof(word_type) == 0)
+    {
+        word_type loaded[aligned_words];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < aligned_words; ++i)
+        {
+            loaded[i] = vector_access<NonTemporal, word_type>::load(
+                reinterpret_cast<const word_type*>(input) + i);
+        }
+        __builtin_memcpy(items, loaded, bytes);
+        return;
+    }
+
+    const unsigned int  shift   = address % 4;
+    const unsigned int* aligned = reinterpret_cast<const unsigned int*>(address - shift);
+
+    unsigned int loaded[words + 1];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i <= words; ++i)
+    {
+        loaded[i] = 0;
+        if(4 * i < shift + bytes)
+        {
+            loaded[i] = vector_access<NonTemporal, unsigned int>::load(aligned + i);
+        }
+    }
+
+    unsigned int shifted[words];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < words; ++i)
+    {
+        shifted[i] = funnel_shift_bytes(loaded[i], loaded[i + 1], shift);
+    }
+    __builtin_memcpy(items, shifted, bytes);
+}
+
+// Stores the items of a thread as raw bytes, the counterpart of load_thread_bytes. Stores must
+// not touch bytes outside of the items, so if they are not aligned, the bytes before the first
+// and after the last whole 32-bit word are stored one at a time, and the words in between are
+// shifted into place.
+template<bool NonTemporal, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void store_thread_bytes(T* output, const T (&items)[ItemsPerThread])
+{
+    static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+    constexpr unsigned int bytes = sizeof(T) * ItemsPerThread;
+    constexpr unsigned int words = ceiling_div(bytes, 4u);
+    static_assert(bytes >= 4, "The items of a thread must cover at least one word");
+
+    using word_type                      = thread_bytes_word_type<bytes>;
+    constexpr unsigned int aligned_words = ceiling_div(bytes, unsigned(sizeof(word_type)));
+    constexpr bool         whole_words   = bytes % 4 == 0;
+
+    const uintptr_t address = reinterpret_cast<uintptr_t>(output);
+    if(whole_words && address % sizeof(word_type) == 0)
+    {
+        word_type stored[aligned_words];
+        __builtin_memcpy(stored, items, bytes);
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < aligned_words; ++i)
+        {
+            vector_access<NonTemporal, word_type>::store(reinterpret_cast<word_type*>(output) + i,
+                                                         stored[i]);
+        }
+        return;
+    }
+
+    unsigned int data[words + 1] = {};
+    __builtin_memcpy(data, items, bytes);
+
+    unsigned char* const output_bytes = reinterpret_cast<unsigned char*>(output);
+
+    // The bytes before the first aligned word
+    const unsigned int head = (4 - address % 4) % 4;
+    ROCPRIM_UNROLL
+    for(unsigned int j = 0; j < 3; ++j)
+    {
+        if(j < head)
+        {
+            output_bytes[j] = static_cast<unsigned char>(data[0] >> (8 * j));
+        }
+    }
+
+    // The whole words, and the bytes after the last one
+    unsigned int* const aligned = reinterpret_cast<unsigned int*>(output_bytes + head);
+    const unsigned int  body    = (bytes - head) / 4;
+    const unsigned int  tail    = (bytes - head) % 4;
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < words; ++i)
+    {
+        const unsigned int word = funnel_shift_bytes(data[i], data[i + 1], head);
+        if(i < body)
+        {
+            vector_access<NonTemporal, unsigned int>::store(aligned + i, word);
+        }
+        else if(i == body)
+        {
+            unsigned char* const tail_bytes = reinterpret_cast<unsigned char*>(aligned + i);
+            ROCPRIM_UNROLL
+            for(unsigned int j = 0; j < 3; ++j)
+            {
+                if(j < tail)
+                {
+                    tail_bytes[j] = static_cast<unsigned char>(word >> (8 * j));
+                }
+            }
+        }
+    }
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_BLOCK_DETAIL_BLOCK_LOAD_STORE_VECTOR_HPP_
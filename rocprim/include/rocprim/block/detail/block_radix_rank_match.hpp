@@ -31,6 +31,8 @@
 #include "../block_scan.hpp"
 #include "../config.hpp"
 
+#include <type_traits>
+
 BEGIN_ROCPRIM_NAMESPACE
 
 namespace detail
@@ -43,9 +45,15 @@ template<unsigned int       BlockSizeX,
          block_padding_hint PaddingHint = block_padding_hint::avoid_conflicts>
 class block_radix_rank_match
 {
-    using digit_counter_type = unsigned int;
-
-    using block_scan_type = ::rocprim::block_scan<digit_counter_type,
+    // Wave32 devices have twice as many warps per block, and so twice as many per-warp digit
+    // counters, as wave64 devices. 16-bit counters keep the shared memory, and the occupancy, of
+    // wave64, at the cost of limiting a block to fewer than 65536 items.
+    using digit_counter_type
+        = std::conditional_t<device_warp_size() == 32, unsigned short, unsigned int>;
+    // The counters are scanned in 32 bits, the total may not fit in a counter.
+    using scan_counter_type = unsigned int;
+
+    using block_scan_type = ::rocprim::block_scan<scan_counter_type,
                                                   BlockSizeX,
                                                   ::rocprim::block_scan_algorithm::using_warp_scan,
                                                   BlockSizeY,
@@ -116,6 +124,10 @@ private:
                                        storage_type_& storage,
                                        DigitExtractor digit_extractor)
     {
+        static_assert(sizeof(digit_counter_type) >= sizeof(unsigned int)
+                          || block_size * ItemsPerThread <= 0xFFFFu,
+                      "The match rank of wave32 devices ranks fewer than 65536 items per block.");
+
         const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
         const unsigned int warp_id = ::rocprim::warp_id();
 
@@ -141,8 +153,7 @@ private:
             // Read the prefix sum of that digit. We already know it's 0 on the first iteration. So
             // we can skip a read-after-write dependency. The conditional gets optimized out due to
             // loop unrolling.
-            const digit_counter_type warp_digit_prefix
-                = i == 0 ? digit_counter_type(0) : *digit_counters[i];
+            const unsigned int warp_digit_prefix = i == 0 ? 0u : *digit_counters[i];
 
             // Construct a mask of threads in this wave which have the same digit.
             ::rocprim::lane_mask_type peer_mask = ::rocprim::match_any<RadixBits>(digit);
@@ -157,7 +168,8 @@ private:
 
             if(::rocprim::group_elect(peer_mask))
             {
-                *digit_counters[i] = warp_digit_prefix + digit_count;
+                *digit_counters[i]
+                    = static_cast<digit_counter_type>(warp_digit_prefix + digit_count);
             }
 
             ::rocprim::wave_barrier();
@@ -169,7 +181,7 @@ private:
         ::rocprim::syncthreads();
 
         // Scan the per-warp counters to get a rank-offset per warp counter.
-        digit_counter_type scan_counters[counters_per_thread];
+        scan_counter_type scan_counters[counters_per_thread];
 
         ROCPRIM_UNROLL
         for(unsigned int i = 0; i < counters_per_thread; ++i)
@@ -182,7 +194,8 @@ private:
         ROCPRIM_UNROLL
         for(unsigned int i = 0; i < counters_per_thread; ++i)
         {
-            storage.counters[flat_id * counters_per_thread + i] = scan_counters[i];
+            storage.counters[flat_id * counters_per_thread + i]
+                = static_cast<digit_counter_type>(scan_counters[i]);
         }
 
         ::rocprim::syncthreads();
@@ -225,6 +225,26 @@ public:
         this->reduce(input, output, valid_items, storage, reduce_op);
     }
 
+    /// \brief Computes \p N independent thread block-wide reductions. The return values are only valid for thread<sub>0</sub>.
+    /// \param input     [in]  Calling thread's inputs, one for every reduction
+    /// \param output    [out] Variables containing the reduction outputs
+    /// \param storage   [in]  Temporary Storage used for the reductions, one for every reduction
+    /// \param reduce_op [in]  Binary reduction operator
+    template<unsigned int N, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void multi_reduce(const T (&input)[N],
+                                                    T (&output)[N],
+                                                    storage_type (&storage)[N],
+                                                    BinaryFunction reduce_op)
+    {
+        // Every reduction has its own storage, so no barriers are needed between them
+        const auto flat_tid = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        ROCPRIM_UNROLL
+        for(unsigned int k = 0; k < N; k++)
+        {
+            this->reduce_impl(flat_tid, input[k], output[k], storage[k], reduce_op);
+        }
+    }
+
 private:
     template<class BinaryFunction, bool FunctionCommutativeOnly = CommutativeOnly>
     ROCPRIM_DEVICE ROCPRIM_INLINE auto reduce_impl(const unsigned int flat_tid,
@@ -54,6 +54,10 @@ class block_reduce_warp_reduce
     // Check if we have to pass number of valid items into warp reduction primitive
     static constexpr bool block_size_is_warp_multiple_ = ((BlockSize % warp_size_) == 0);
     static constexpr bool warps_no_is_pow_of_two_ = detail::is_power_of_two(warps_no_);
+    // With a few warps the first warp folds the partials read from LDS (all lanes read the same
+    // addresses, so the reads are broadcasts) instead of reducing them with another warp reduce,
+    // which needs LDS permutes when the partials do not fill a hardware warp.
+    static constexpr bool fold_warp_partials_ = warps_no_ <= 4;
 
     // typedef of warp_reduce primitive that will be used to perform warp-level
     // reduce operation on input values.
@@ -159,6 +163,70 @@ public:
         this->reduce(input, output, valid_items, storage, reduce_op);
     }
 
+    template<unsigned int N, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void multi_reduce(const T (&input)[N],
+                      T (&output)[N],
+                      storage_type (&storage)[N],
+                      BinaryFunction reduce_op)
+    {
+        const auto flat_tid = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const auto warp_id  = ::rocprim::warp_id(flat_tid);
+        const auto lane_id  = ::rocprim::lane_id();
+        const unsigned int warp_offset = warp_id * warp_size_;
+        const unsigned int num_valid = (warp_offset < BlockSize) ? BlockSize - warp_offset : 0;
+
+        ROCPRIM_UNROLL
+        for(unsigned int k = 0; k < N; k++)
+        {
+            warp_reduce<!block_size_is_warp_multiple_, warp_reduce_input_type>(input[k],
+                                                                               output[k],
+                                                                               num_valid,
+                                                                               reduce_op);
+        }
+
+        if ROCPRIM_IF_CONSTEXPR(warps_no_ > 1)
+        {
+            // The partials of all values are stored before the only barrier
+            if(lane_id == 0)
+            {
+                ROCPRIM_UNROLL
+                for(unsigned int k = 0; k < N; k++)
+                {
+                    storage[k].get().warp_partials[warp_id] = output[k];
+                }
+            }
+            ::rocprim::syncthreads();
+
+            if(warp_id == 0)
+            {
+                ROCPRIM_UNROLL
+                for(unsigned int k = 0; k < N; k++)
+                {
+                    storage_type_& storage_ = storage[k].get();
+                    if ROCPRIM_IF_CONSTEXPR(fold_warp_partials_)
+                    {
+                        output[k] = storage_.warp_partials[0];
+                        ROCPRIM_UNROLL
+                        for(unsigned int i = 1; i < warps_no_; i++)
+                        {
+                            output[k] = reduce_op(output[k], storage_.warp_partials[i]);
+                        }
+                    }
+                    else
+                    {
+                        auto warp_partial = storage_.warp_partials[lane_id % warps_no_];
+                        warp_reduce<!warps_no_is_pow_of_two_, warp_reduce_output_type>(
+                            warp_partial,
+                            output[k],
+                            warps_no_,
+                            reduce_op);
+                    }
+                }
+            }
+        }
+    }
+
 private:
     template<class BinaryFunction>
     ROCPRIM_DEVICE ROCPRIM_INLINE
@@ -190,7 +258,19 @@ private:
             }
             ::rocprim::syncthreads();
 
-            if(warp_id == 0)
+            if ROCPRIM_IF_CONSTEXPR(fold_warp_partials_)
+            {
+                if(warp_id == 0)
+                {
+                    output = storage_.warp_partials[0];
+                    ROCPRIM_UNROLL
+                    for(unsigned int i = 1; i < warps_no_; i++)
+                    {
+                        output = reduce_op(output, storage_.warp_partials[i]);
+                    }
+                }
+            }
+            else if(warp_id == 0)
             {
                 // Use warp partial to calculate the final reduce results for every thread
                 auto warp_partial = storage_.warp_partials[lane_id % warps_no_];
@@ -261,12 +341,27 @@ private:
             }
             ::rocprim::syncthreads();
 
-            if(flat_tid < warps_no_)
+            const unsigned int valid_warps_no = (valid_items + warp_size_ - 1) / warp_size_;
+            if ROCPRIM_IF_CONSTEXPR(fold_warp_partials_)
+            {
+                if(warp_id == 0)
+                {
+                    output = storage_.warp_partials[0];
+                    ROCPRIM_UNROLL
+                    for(unsigned int i = 1; i < warps_no_; i++)
+                    {
+                        if(i < valid_warps_no)
+                        {
+                            output = reduce_op(output, storage_.warp_partials[i]);
+                        }
+                    }
+                }
+            }
+            else if(flat_tid < warps_no_)
             {
                 // Use warp partial to calculate the final reduce results for every thread
                 auto warp_partial = storage_.warp_partials[lane_id];
 
-                unsigned int valid_warps_no = (valid_items + warp_size_ - 1) / warp_size_;
                 warp_reduce_output_type().reduce(
                     warp_partial, output, valid_warps_no, reduce_op
                 );
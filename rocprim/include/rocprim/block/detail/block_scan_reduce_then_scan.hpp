@@ -471,6 +471,36 @@ public:
         }
     }
 
+    // Every scan has its own storage, so no barriers are needed between them
+    template<unsigned int N, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void multi_inclusive_scan(const T (&input)[N],
+                              T (&output)[N],
+                              storage_type (&storage)[N],
+                              BinaryFunction scan_op)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int k = 0; k < N; k++)
+        {
+            this->inclusive_scan(input[k], output[k], storage[k], scan_op);
+        }
+    }
+
+    template<unsigned int N, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void multi_exclusive_scan(const T (&input)[N],
+                              T (&output)[N],
+                              const T (&init)[N],
+                              storage_type (&storage)[N],
+                              BinaryFunction scan_op)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int k = 0; k < N; k++)
+        {
+            this->exclusive_scan(input[k], output[k], init[k], storage[k], scan_op);
+        }
+    }
+
 private:
 
     // Calculates inclusive scan results and stores them in storage_.threads,
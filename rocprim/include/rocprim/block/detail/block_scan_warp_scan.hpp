@@ -496,7 +496,103 @@ public:
         }
     }
 
+    template<unsigned int N, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void multi_inclusive_scan(const T (&input)[N],
+                              T (&output)[N],
+                              storage_type (&storage)[N],
+                              BinaryFunction scan_op)
+    {
+        const auto flat_tid = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const auto warp_id  = ::rocprim::warp_id(flat_tid);
+        ROCPRIM_UNROLL
+        for(unsigned int k = 0; k < N; k++)
+        {
+            warp_scan_input_type().inclusive_scan(input[k], output[k], scan_op);
+        }
+        if ROCPRIM_IF_CONSTEXPR(warps_no_ > 1)
+        {
+            this->calculate_multi_warp_prefixes(flat_tid, warp_id, output, storage, scan_op);
+            if(warp_id != 0)
+            {
+                ROCPRIM_UNROLL
+                for(unsigned int k = 0; k < N; k++)
+                {
+                    output[k] = scan_op(storage[k].get().warp_prefixes[warp_id - 1], output[k]);
+                }
+            }
+        }
+    }
+
+    template<unsigned int N, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void multi_exclusive_scan(const T (&input)[N],
+                              T (&output)[N],
+                              const T (&init)[N],
+                              storage_type (&storage)[N],
+                              BinaryFunction scan_op)
+    {
+        const auto flat_tid = ::rocprim::flat_block_thread_id<BlockSizeX, BlockSizeY, BlockSizeZ>();
+        const auto warp_id  = ::rocprim::warp_id(flat_tid);
+        ROCPRIM_UNROLL
+        for(unsigned int k = 0; k < N; k++)
+        {
+            warp_scan_input_type().inclusive_scan(input[k], output[k], scan_op);
+        }
+        if ROCPRIM_IF_CONSTEXPR(warps_no_ > 1)
+        {
+            this->calculate_multi_warp_prefixes(flat_tid, warp_id, output, storage, scan_op);
+        }
+        ROCPRIM_UNROLL
+        for(unsigned int k = 0; k < N; k++)
+        {
+            T warp_prefix = init[k];
+            if(warps_no_ > 1 && warp_id != 0)
+            {
+                warp_prefix = scan_op(init[k], storage[k].get().warp_prefixes[warp_id - 1]);
+            }
+            output[k] = scan_op(warp_prefix, output[k]);
+            output[k] = warp_shuffle_up(output[k], 1, warp_size_);
+            if(::rocprim::lane_id() == 0)
+            {
+                output[k] = warp_prefix;
+            }
+        }
+    }
+
 private:
+    // Like calculate_warp_prefixes for N values, sharing the barriers
+    template<unsigned int N, class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void calculate_multi_warp_prefixes(const unsigned int flat_tid,
+                                       const unsigned int warp_id,
+                                       const T (&inclusive_input)[N],
+                                       storage_type (&storage)[N],
+                                       BinaryFunction scan_op)
+    {
+        if(flat_tid == ::rocprim::min((warp_id + 1) * warp_size_, BlockSize) - 1)
+        {
+            ROCPRIM_UNROLL
+            for(unsigned int k = 0; k < N; k++)
+            {
+                storage[k].get().warp_prefixes[warp_id] = inclusive_input[k];
+            }
+        }
+        ::rocprim::syncthreads();
+
+        if(flat_tid < warps_no_)
+        {
+            ROCPRIM_UNROLL
+            for(unsigned int k = 0; k < N; k++)
+            {
+                auto warp_prefix = storage[k].get().warp_prefixes[flat_tid];
+                warp_scan_prefix_type().inclusive_scan(warp_prefix, warp_prefix, scan_op);
+                storage[k].get().warp_prefixes[flat_tid] = warp_prefix;
+            }
+        }
+        ::rocprim::syncthreads();
+    }
+
     template<class BinaryFunction, unsigned int BlockSize_ = BlockSize>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     auto inclusive_scan_impl(const unsigned int flat_tid,
@@ -30,6 +30,7 @@ namespace detail
             auto _error = hipGetLastError();                                                         \
             if(_error != hipSuccess)                                                                 \
                 return _error;                                                                       \
+            ::rocprim::detail::notify_kernel_launch(name, size, stream);                             \
             if(debug_synchronous)                                                                    \
             {                                                                                        \
                 std::cout << name << "(" << size << ")";                                             \
@@ -59,4 +60,7 @@ namespace detail
 
 } // namespace detail
 
+// The notification of kernel launches used by ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR
+#include "device/instrumentation.hpp"
+
 #endif // ROCPRIM_COMMON_HPP_
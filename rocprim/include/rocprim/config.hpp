@@ -90,6 +90,11 @@
     #define ROCPRIM_DETAIL_HAS_DPP_WF 1
 #endif
 
+// v_permlanex16 exchanges values between the two rows of 16 lanes of a wave32 (GFX10+)
+#if defined(ROCPRIM_DETAIL_HAS_DPP) && (defined(__GFX10__) || defined(__GFX11__) || defined(__GFX12__))
+    #define ROCPRIM_DETAIL_HAS_PERMLANEX16 1
+#endif
+
 #ifndef ROCPRIM_THREAD_LOAD_USE_CACHE_MODIFIERS
     #define ROCPRIM_THREAD_LOAD_USE_CACHE_MODIFIERS 1
 #endif
@@ -99,14 +104,40 @@
 #endif
 
 
-// Defines targeted AMD architecture. Supported values:
+// Defines targeted AMD architecture, the value of the matching rocprim::detail::target_arch:
 // * 803 (gfx803)
 // * 900 (gfx900)
 // * 906 (gfx906)
 // * 908 (gfx908)
 // * 910 (gfx90a)
+// * 942 (gfx942)
+// * 1030 (gfx1030)
+// * 1100 (gfx1100)
+// * 1102 (gfx1102)
+// Unless it is defined by the user, it is the architecture being compiled for in the device
+// compilation, and 0 (no tuned architecture) in the host compilation and for other architectures.
 #ifndef ROCPRIM_TARGET_ARCH
-    #define ROCPRIM_TARGET_ARCH 0
+    #if defined(__HIP_DEVICE_COMPILE__) && defined(__gfx803__)
+        #define ROCPRIM_TARGET_ARCH 803
+    #elif defined(__HIP_DEVICE_COMPILE__) && defined(__gfx900__)
+        #define ROCPRIM_TARGET_ARCH 900
+    #elif defined(__HIP_DEVICE_COMPILE__) && defined(__gfx906__)
+        #define ROCPRIM_TARGET_ARCH 906
+    #elif defined(__HIP_DEVICE_COMPILE__) && defined(__gfx908__)
+        #define ROCPRIM_TARGET_ARCH 908
+    #elif defined(__HIP_DEVICE_COMPILE__) && defined(__gfx90a__)
+        #define ROCPRIM_TARGET_ARCH 910
+    #elif defined(__HIP_DEVICE_COMPILE__) && defined(__gfx942__)
+        #define ROCPRIM_TARGET_ARCH 942
+    #elif defined(__HIP_DEVICE_COMPILE__) && defined(__gfx1030__)
+        #define ROCPRIM_TARGET_ARCH 1030
+    #elif defined(__HIP_DEVICE_COMPILE__) && defined(__gfx1100__)
+        #define ROCPRIM_TARGET_ARCH 1100
+    #elif defined(__HIP_DEVICE_COMPILE__) && defined(__gfx1102__)
+        #define ROCPRIM_TARGET_ARCH 1102
+    #else
+        #define ROCPRIM_TARGET_ARCH 0
+    #endif
 #endif
 
 #ifndef ROCPRIM_NAVI
@@ -104,6 +104,50 @@ private:
 };
 
 
+// Wrapper for reducing runs with a scan, every item is paired with 1 if it is the head of a
+// run and 0 otherwise. The result counts the heads and reduces the values since the last head.
+template<class V, class BinaryFunction>
+struct run_count_scan_op_wrapper
+{
+    using result_type = rocprim::tuple<unsigned int, V>;
+    using input_type  = result_type;
+
+    ROCPRIM_HOST_DEVICE inline
+    run_count_scan_op_wrapper(BinaryFunction reduce_op)
+        : reduce_op_(reduce_op)
+    {
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    result_type operator()(const input_type& t1, const input_type& t2)
+    {
+        return result_type{rocprim::get<0>(t1) + rocprim::get<0>(t2),
+                           rocprim::get<0>(t2) == 0
+                               ? static_cast<V>(reduce_op_(rocprim::get<1>(t1),
+                                                           rocprim::get<1>(t2)))
+                               : rocprim::get<1>(t2)};
+    }
+
+private:
+    BinaryFunction reduce_op_;
+};
+
+// Flags the heads of runs in a tile of which only the first valid_items items are valid, the
+// invalid items are never flagged.
+template<class EqualityOp>
+struct guarded_inequality_op
+{
+    EqualityOp   equality_op;
+    unsigned int valid_items;
+
+    template<class T>
+    ROCPRIM_HOST_DEVICE inline
+    bool operator()(const T& a, const T& b, unsigned int b_index)
+    {
+        return b_index < valid_items && !equality_op(a, b);
+    }
+};
+
 template<class EqualityOp>
 struct inequality_wrapper
 {
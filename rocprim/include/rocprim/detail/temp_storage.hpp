@@ -27,6 +27,8 @@
 #include "../types.hpp"
 #include "various.hpp"
 
+#include "../device/diagnostics.hpp"
+
 BEGIN_ROCPRIM_NAMESPACE
 namespace detail
 {
@@ -289,6 +291,11 @@ hipError_t
     }
     else if(storage_size < required_size)
     {
+#ifndef __HIP_DEVICE_COMPILE__
+        ::rocprim::detail::record_diagnostic(diagnostic_code::temporary_storage_too_small,
+                                             required_size,
+                                             storage_size);
+#endif
         return hipErrorInvalidValue;
     }
 
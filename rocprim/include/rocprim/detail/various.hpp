@@ -236,6 +236,9 @@ struct type_identity {
     using type = T;
 };
 
+template<typename T>
+using type_identity_t = typename type_identity<T>::type;
+
 template<class T, class = void>
 struct extract_type_impl : type_identity<T> { };
 
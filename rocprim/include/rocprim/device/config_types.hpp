@@ -24,6 +24,9 @@
 #include <algorithm>
 #include <atomic>
 #include <limits>
+#include <map>
+#include <mutex>
+#include <tuple>
 #include <type_traits>
 
 #include <cassert>
@@ -69,6 +72,9 @@ struct kernel_config_params
     unsigned int items_per_thread = 1;
     /// \brief Number of items processed by a single kernel launch.
     unsigned int size_limit = ROCPRIM_GRID_SIZE_LIMIT;
+    /// \brief Number of tiles each block loads ahead of the tile it processes, 0 disables
+    /// the prefetch pipeline.
+    unsigned int prefetch_tiles = 0;
 };
 
 } // namespace detail
@@ -77,12 +83,22 @@ struct kernel_config_params
 ///
 /// \tparam BlockSize - number of threads in a block.
 /// \tparam ItemsPerThread - number of items processed by each thread.
+/// \tparam SizeLimit - limit on the number of items processed by a single kernel launch.
+/// \tparam PrefetchTiles - number of tiles each block loads ahead of the tile it processes.
+/// When it is not 0, the kernel runs a persistent grid where each block transforms tiles with
+/// a stride of the grid size, and the loads of its next \p PrefetchTiles tiles are issued
+/// before the current tile is processed, which hides the latency of the loads when the
+/// occupancy is low (large \p ItemsPerThread). The tiles in flight take
+/// \p PrefetchTiles * \p ItemsPerThread additional registers per thread. It's supported by
+/// \p transform, other algorithms ignore it.
 template<unsigned int BlockSize,
          unsigned int ItemsPerThread,
-         unsigned int SizeLimit = ROCPRIM_GRID_SIZE_LIMIT>
+         unsigned int SizeLimit     = ROCPRIM_GRID_SIZE_LIMIT,
+         unsigned int PrefetchTiles = 0>
 struct kernel_config : detail::kernel_config_params
 {
-    constexpr kernel_config() : detail::kernel_config_params{BlockSize, ItemsPerThread, SizeLimit}
+    constexpr kernel_config()
+        : detail::kernel_config_params{BlockSize, ItemsPerThread, SizeLimit, PrefetchTiles}
     {}
     /// \brief Number of threads in a block.
     static constexpr unsigned int block_size = BlockSize;
@@ -90,6 +106,8 @@ struct kernel_config : detail::kernel_config_params
     static constexpr unsigned int items_per_thread = ItemsPerThread;
     /// \brief Number of items processed by a single kernel launch.
     static constexpr unsigned int size_limit = SizeLimit;
+    /// \brief Number of tiles each block loads ahead of the tile it processes.
+    static constexpr unsigned int prefetch_tiles = PrefetchTiles;
 };
 
 namespace detail
@@ -258,41 +276,74 @@ constexpr target_arch device_target_arch()
 #endif
 }
 
+// Architectures whose configs are dispatched to, all by default. ROCPRIM_DISPATCH_TARGET_ARCHS can
+// be defined to a comma-separated list of target_arch values (e.g. 942,1100) to only instantiate
+// the configs of the architectures that are compiled for: the other architectures run with the
+// configs of target_arch::unknown, on both host and device, so the launches stay consistent.
+constexpr bool is_dispatched_target_arch(const target_arch arch)
+{
+#ifdef ROCPRIM_DISPATCH_TARGET_ARCHS
+    constexpr unsigned int dispatched_archs[] = {ROCPRIM_DISPATCH_TARGET_ARCHS};
+    for(const unsigned int dispatched_arch : dispatched_archs)
+    {
+        if(dispatched_arch == static_cast<unsigned int>(arch))
+        {
+            return true;
+        }
+    }
+    return false;
+#else
+    (void)arch;
+    return true;
+#endif
+}
+
+constexpr target_arch dispatched_target_arch(const target_arch arch)
+{
+    return is_dispatched_target_arch(arch) ? arch : target_arch::unknown;
+}
+
+template<class Config, target_arch Arch>
+constexpr auto dispatched_params()
+{
+    return Config::template architecture_config<dispatched_target_arch(Arch)>::params;
+}
+
 template<class Config>
 auto dispatch_target_arch(const target_arch target_arch)
 {
     switch(target_arch)
     {
         case target_arch::unknown:
-            return Config::template architecture_config<target_arch::unknown>::params;
+            return dispatched_params<Config, target_arch::unknown>();
         case target_arch::gfx803:
-            return Config::template architecture_config<target_arch::gfx803>::params;
+            return dispatched_params<Config, target_arch::gfx803>();
         case target_arch::gfx900:
-            return Config::template architecture_config<target_arch::gfx900>::params;
+            return dispatched_params<Config, target_arch::gfx900>();
         case target_arch::gfx906:
-            return Config::template architecture_config<target_arch::gfx906>::params;
+            return dispatched_params<Config, target_arch::gfx906>();
         case target_arch::gfx908:
-            return Config::template architecture_config<target_arch::gfx908>::params;
+            return dispatched_params<Config, target_arch::gfx908>();
         case target_arch::gfx90a:
-            return Config::template architecture_config<target_arch::gfx90a>::params;
+            return dispatched_params<Config, target_arch::gfx90a>();
         case target_arch::gfx942:
-            return Config::template architecture_config<target_arch::gfx942>::params;
+            return dispatched_params<Config, target_arch::gfx942>();
         case target_arch::gfx1030:
-            return Config::template architecture_config<target_arch::gfx1030>::params;
+            return dispatched_params<Config, target_arch::gfx1030>();
         case target_arch::gfx1100:
-            return Config::template architecture_config<target_arch::gfx1100>::params;
+            return dispatched_params<Config, target_arch::gfx1100>();
         case target_arch::gfx1102:
-            return Config::template architecture_config<target_arch::gfx1102>::params;
+            return dispatched_params<Config, target_arch::gfx1102>();
         case target_arch::invalid:
             assert(false && "Invalid target architecture selected at runtime.");
     }
-    return Config::template architecture_config<target_arch::unknown>::params;
+    return dispatched_params<Config, target_arch::unknown>();
 }
 
 template<typename Config>
 constexpr auto device_params()
 {
-    return Config::template architecture_config<device_target_arch()>::params;
+    return dispatched_params<Config, device_target_arch()>();
 }
 
 inline target_arch parse_gcn_arch(const char* arch_name)
@@ -306,34 +357,74 @@ inline target_arch parse_gcn_arch(const char* arch_name)
     return get_target_arch_from_name(arch_name, arch_end - arch_name);
 }
 
-inline hipError_t get_device_arch(int device_id, target_arch& arch)
+// The properties of a device that the host-side dispatch of the algorithms queries.
+struct device_properties
+{
+    target_arch  arch;
+    unsigned int multiprocessor_count;
+    unsigned int warp_size;
+    int          asic_revision;
+    bool         cooperative_launch;
+};
+
+// Returns the properties of the device, queried with hipGetDeviceProperties only by the first
+// call for the device. The size queries and launches of the algorithms call this, so the cost of
+// hipGetDeviceProperties is not repeated by every call.
+inline hipError_t get_device_properties(const int device_id, device_properties& properties)
 {
-    static constexpr unsigned int   device_arch_cache_size             = 512;
-    static std::atomic<target_arch> arch_cache[device_arch_cache_size] = {};
+    static constexpr unsigned int device_properties_cache_size = 512;
+    static std::atomic<bool>      cached[device_properties_cache_size] = {};
+    static device_properties      cache[device_properties_cache_size];
+    static std::mutex             mutex;
 
     assert(device_id >= 0);
-    if(static_cast<unsigned int>(device_id) >= device_arch_cache_size)
+    if(static_cast<unsigned int>(device_id) >= device_properties_cache_size)
     {
-        // Device architecture cache is too small.
+        // Device properties cache is too small.
         return hipErrorUnknown;
     }
 
-    arch = arch_cache[device_id].load(std::memory_order_relaxed);
-    if(arch != target_arch::invalid)
+    if(cached[device_id].load(std::memory_order_acquire))
     {
+        properties = cache[device_id];
         return hipSuccess;
     }
 
-    hipDeviceProp_t  device_props;
-    const hipError_t result = hipGetDeviceProperties(&device_props, device_id);
+    std::lock_guard<std::mutex> lock(mutex);
+    if(!cached[device_id].load(std::memory_order_relaxed))
+    {
+        hipDeviceProp_t  device_props;
+        const hipError_t result = hipGetDeviceProperties(&device_props, device_id);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+
+        device_properties& entry  = cache[device_id];
+        entry.arch                 = parse_gcn_arch(device_props.gcnArchName);
+        entry.multiprocessor_count = static_cast<unsigned int>(device_props.multiProcessorCount);
+        entry.warp_size            = static_cast<unsigned int>(device_props.warpSize);
+#if HIP_VERSION >= 307
+        entry.asic_revision = device_props.asicRevision;
+#else
+        entry.asic_revision = 0;
+#endif
+        entry.cooperative_launch = device_props.cooperativeLaunch != 0;
+        cached[device_id].store(true, std::memory_order_release);
+    }
+    properties = cache[device_id];
+    return hipSuccess;
+}
+
+inline hipError_t get_device_arch(int device_id, target_arch& arch)
+{
+    device_properties properties;
+    const hipError_t  result = get_device_properties(device_id, properties);
     if(result != hipSuccess)
     {
         return result;
     }
-
-    arch = parse_gcn_arch(device_props.gcnArchName);
-    arch_cache[device_id].exchange(arch, std::memory_order_relaxed);
-
+    arch = properties.arch;
     return hipSuccess;
 }
 
@@ -374,6 +465,96 @@ inline hipError_t host_target_arch(const hipStream_t stream, target_arch& arch)
     return get_device_arch(device_id, arch);
 }
 
+inline hipError_t get_device_properties(const hipStream_t stream, device_properties& properties)
+{
+    int              device_id;
+    const hipError_t result = get_device_from_stream(stream, device_id);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    return get_device_properties(device_id, properties);
+}
+
+// Returns the number of blocks of `kernel` with `block_size` threads and
+// `dynamic_shared_memory` bytes of dynamic shared memory that can be resident at once on a
+// multiprocessor of the device. The result of hipOccupancyMaxActiveBlocksPerMultiprocessor,
+// which needs the device to be made current, is memoised per kernel, block size, dynamic shared
+// memory size and device.
+template<class Kernel>
+inline hipError_t max_active_blocks_per_multiprocessor(Kernel             kernel,
+                                                       const unsigned int block_size,
+                                                       const size_t       dynamic_shared_memory,
+                                                       const int          device_id,
+                                                       unsigned int&      blocks_per_multiprocessor)
+{
+    using key_type = std::tuple<const void*, unsigned int, size_t, int>;
+    static std::map<key_type, unsigned int> cache;
+    static std::mutex                       mutex;
+
+    const key_type key(reinterpret_cast<const void*>(kernel),
+                       block_size,
+                       dynamic_shared_memory,
+                       device_id);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto                  it = cache.find(key);
+        if(it != cache.end())
+        {
+            blocks_per_multiprocessor = it->second;
+            return hipSuccess;
+        }
+    }
+
+    // `hipOccupancyMaxActiveBlocksPerMultiprocessor` uses the current device.
+    int        previous_device;
+    hipError_t result = hipGetDevice(&previous_device);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    result = hipSetDevice(device_id);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    int              blocks = 0;
+    const hipError_t error  = hipOccupancyMaxActiveBlocksPerMultiprocessor(&blocks,
+                                                                          kernel,
+                                                                          block_size,
+                                                                          dynamic_shared_memory);
+    result = hipSetDevice(previous_device);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    blocks_per_multiprocessor = static_cast<unsigned int>(std::max(blocks, 0));
+    std::lock_guard<std::mutex> lock(mutex);
+    cache.emplace(key, blocks_per_multiprocessor);
+    return hipSuccess;
+}
+
+// Returns the number of blocks of `kernel` with `block_size` threads and no dynamic shared memory
+// that can be resident at once on a multiprocessor of the device.
+template<class Kernel>
+inline hipError_t max_active_blocks_per_multiprocessor(Kernel             kernel,
+                                                       const unsigned int block_size,
+                                                       const int          device_id,
+                                                       unsigned int&      blocks_per_multiprocessor)
+{
+    return max_active_blocks_per_multiprocessor(kernel,
+                                                block_size,
+                                                0,
+                                                device_id,
+                                                blocks_per_multiprocessor);
+}
+
 } // end namespace detail
 
 /// \brief Returns a number of threads in a hardware warp for the actual device.
@@ -386,12 +567,12 @@ inline hipError_t host_target_arch(const hipStream_t stream, target_arch& arch)
 ROCPRIM_HOST inline hipError_t host_warp_size(const int device_id, unsigned int& warp_size)
 {
     warp_size = -1;
-    hipDeviceProp_t device_prop;
-    hipError_t      success = hipGetDeviceProperties(&device_prop, device_id);
+    detail::device_properties properties;
+    hipError_t                success = detail::get_device_properties(device_id, properties);
 
     if(success == hipSuccess)
     {
-        warp_size = device_prop.warpSize;
+        warp_size = properties.warp_size;
     }
     return success;
 };
@@ -0,0 +1,292 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DECOUPLED_LOOKBACK_HPP_
+#define ROCPRIM_DEVICE_DECOUPLED_LOOKBACK_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../functional.hpp"
+
+#include "detail/device_scan_common.hpp"
+#include "detail/lookback_backoff.hpp"
+#include "detail/lookback_scan_state.hpp"
+#include "detail/ordered_block_id.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The decoupled look-back of the single-pass device algorithms, as a building block of
+/// custom single-pass kernels.
+///
+/// A single-pass kernel processes the tiles of its input in the order of their ids, and every
+/// tile gets the reduction of the preceding tiles (its prefix) by looking back at the states
+/// that the preceding tiles publish. This class holds those states together with the counter
+/// that hands out the tile ids, and keeps the backoff, memory ordering and state layouts that
+/// the device scans use on every architecture.
+///
+/// \par Overview
+/// * On the host, \p get_temp_storage_size gives the size of the storage for a number of
+/// tiles, \p create binds the storage, and \p initialize resets the states on a stream before
+/// every launch of the kernel that uses them.
+/// * In the kernel, every block gets the id of its tile from \p get_block_id, rather than from
+/// \p blockIdx, so the tiles are processed in the order the blocks start in. This keeps the
+/// look-back from waiting on tiles whose blocks have not started yet.
+/// * The tile with id \p 0 has no prefix, it publishes its reduction with \p set_complete. The
+/// other tiles pass the callback returned by \p prefix_callback to the prefix callback overloads
+/// of \p block_scan, which publish the reduction of the tile and return its prefix.
+/// * The object is passed to the kernel by value and must be an lvalue in the kernel, since the
+/// prefix callback refers to it.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// using lookback_type = rocprim::decoupled_lookback<int>;
+///
+/// __global__ void scan_kernel(const int* input, int* output, lookback_type lookback)
+/// {
+///     using block_scan_type = rocprim::block_scan<int, 256>;
+///     __shared__ typename lookback_type::storage_type   lookback_storage;
+///     __shared__ typename block_scan_type::storage_type scan_storage;
+///
+///     const unsigned int tile_id = lookback.get_block_id(lookback_storage);
+///     const int          value   = input[tile_id * 256 + threadIdx.x];
+///     int                result;
+///     if(tile_id == 0)
+///     {
+///         int reduction;
+///         block_scan_type().inclusive_scan(value, result, reduction, scan_storage);
+///         if(threadIdx.x == 0)
+///         {
+///             lookback.set_complete(0, reduction);
+///         }
+///     }
+///     else
+///     {
+///         auto prefix_op = lookback.prefix_callback(tile_id);
+///         block_scan_type().inclusive_scan(value, result, scan_storage, prefix_op,
+///                                          rocprim::plus<int>());
+///     }
+///     output[tile_id * 256 + threadIdx.x] = result;
+/// }
+///
+/// // Host
+/// size_t storage_size;
+/// lookback_type::get_temp_storage_size(tiles, stream, storage_size);
+/// hipMalloc(&storage, storage_size);
+///
+/// lookback_type lookback;
+/// lookback_type::create(lookback, storage, storage_size, tiles, stream);
+/// lookback.initialize(stream);
+/// scan_kernel<<<tiles, 256, 0, stream>>>(input, output, lookback);
+/// \endcode
+/// \endparblock
+///
+/// \tparam T - type of the reductions of the tiles.
+/// \tparam BinaryFunction - type of the associative operator combining the reductions.
+/// \tparam Deterministic - if \p true, the prefixes are reduced in the same order in every run,
+/// so they are bitwise reproducible also for non-associative operators such as floating point
+/// addition. This is slower.
+template<class T, class BinaryFunction = ::rocprim::plus<T>, bool Deterministic = false>
+class decoupled_lookback
+{
+    using scan_state_type = detail::lookback_scan_state<T>;
+    using block_id_type   = detail::ordered_block_id<unsigned int>;
+
+    static constexpr detail::lookback_scan_determinism determinism
+        = Deterministic ? detail::lookback_scan_determinism::deterministic
+                        : detail::lookback_scan_determinism::nondeterministic;
+
+    static constexpr unsigned int init_block_size = ROCPRIM_DEFAULT_MAX_BLOCK_SIZE;
+
+public:
+    /// The type of the reductions of the tiles.
+    using value_type = T;
+    /// The shared memory storage of \p get_block_id.
+    using storage_type = typename block_id_type::storage_type;
+    /// The prefix callback of a tile, see \p prefix_callback.
+    using prefix_callback_type
+        = detail::lookback_scan_prefix_op<T, BinaryFunction, scan_state_type, determinism>;
+
+    /// \brief Returns the size of the temporary storage for \p number_of_blocks tiles.
+    ///
+    /// \param [in] number_of_blocks the number of tiles of a launch.
+    /// \param [in] stream the stream whose device runs the kernels.
+    /// \param [out] storage_size the size of the storage in bytes.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    ROCPRIM_HOST static hipError_t get_temp_storage_size(const unsigned int number_of_blocks,
+                                                         const hipStream_t  stream,
+                                                         size_t&            storage_size)
+    {
+        storage_size = 0;
+        void*         scan_state_storage;
+        unsigned int* block_id_storage;
+        return partition_storage(nullptr,
+                                 storage_size,
+                                 number_of_blocks,
+                                 stream,
+                                 scan_state_storage,
+                                 block_id_storage);
+    }
+
+    /// \brief Binds temporary storage to a look-back of \p number_of_blocks tiles.
+    ///
+    /// \tparam Backoff - type of the backoff, one of the \p lookback_backoff_config types.
+    ///
+    /// \param [out] lookback the created look-back.
+    /// \param [in] temporary_storage the storage, of at least the size given by
+    /// \p get_temp_storage_size.
+    /// \param [in] storage_size the size of \p temporary_storage in bytes.
+    /// \param [in] number_of_blocks the number of tiles of a launch.
+    /// \param [in] stream the stream whose device runs the kernels.
+    /// \param [in] backoff how the look-back waits for the states of preceding tiles. By default
+    /// the policy tuned for the architecture of the device.
+    /// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if the
+    /// storage is too small; otherwise a HIP runtime error of type \p hipError_t.
+    template<class Backoff = lookback_backoff_config<>>
+    ROCPRIM_HOST static hipError_t create(decoupled_lookback& lookback,
+                                          void* const         temporary_storage,
+                                          size_t              storage_size,
+                                          const unsigned int  number_of_blocks,
+                                          const hipStream_t   stream,
+                                          const Backoff&      backoff = Backoff())
+    {
+        if(temporary_storage == nullptr)
+        {
+            return hipErrorInvalidValue;
+        }
+        void*         scan_state_storage;
+        unsigned int* block_id_storage;
+        ROCPRIM_RETURN_ON_ERROR(partition_storage(temporary_storage,
+                                                  storage_size,
+                                                  number_of_blocks,
+                                                  stream,
+                                                  scan_state_storage,
+                                                  block_id_storage));
+        lookback.number_of_blocks_ = number_of_blocks;
+        lookback.block_id_         = block_id_type::create(block_id_storage);
+        return scan_state_type::create(lookback.scan_state_,
+                                       scan_state_storage,
+                                       number_of_blocks,
+                                       stream,
+                                       backoff);
+    }
+
+    /// \brief Resets the states and the tile id counter on \p stream. It must be called before
+    /// every launch of a kernel that uses the look-back.
+    ///
+    /// \param [in] stream the stream of the kernel that uses the look-back.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    ROCPRIM_HOST hipError_t initialize(const hipStream_t stream) const
+    {
+        if(number_of_blocks_ == 0)
+        {
+            return hipSuccess;
+        }
+        const unsigned int grid_size = detail::ceiling_div(number_of_blocks_, init_block_size);
+        detail::init_lookback_scan_state_kernel<<<dim3(grid_size),
+                                                  dim3(init_block_size),
+                                                  0,
+                                                  stream>>>(scan_state_,
+                                                            number_of_blocks_,
+                                                            block_id_);
+        ROCPRIM_RETURN_ON_ERROR(hipGetLastError());
+        detail::notify_kernel_launch("init_lookback_scan_state_kernel", number_of_blocks_, stream);
+        return hipSuccess;
+    }
+
+    /// \brief Returns the id of the tile of the calling block, in the order the blocks start in.
+    /// It must be called by all threads of the block, and synchronizes them.
+    ///
+    /// \param [in] storage the shared memory storage.
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int get_block_id(storage_type& storage)
+    {
+        return block_id_.get(::rocprim::detail::block_thread_id<0>(), storage);
+    }
+
+    /// \brief Returns the prefix callback of the tile \p block_id, for the prefix callback
+    /// overloads of \p block_scan. The callback publishes the reduction of the tile and returns
+    /// the reduction of all preceding tiles. \p block_id must not be \p 0.
+    ///
+    /// \param [in] block_id the id of the tile, from \p get_block_id.
+    /// \param [in] op the operator combining the reductions.
+    ROCPRIM_DEVICE ROCPRIM_INLINE prefix_callback_type
+        prefix_callback(const unsigned int block_id, BinaryFunction op = BinaryFunction())
+    {
+        return prefix_callback_type(block_id, op, scan_state_);
+    }
+
+    /// \brief Publishes the complete reduction of the tile \p block_id, which is the prefix of
+    /// the tile after it. Used by a single thread of the tile \p 0, which has no prefix.
+    ///
+    /// \param [in] block_id the id of the tile, from \p get_block_id.
+    /// \param [in] value the reduction of all tiles up to and including \p block_id.
+    ROCPRIM_DEVICE ROCPRIM_INLINE void set_complete(const unsigned int block_id, const T value)
+    {
+        scan_state_.set_complete(block_id, value);
+    }
+
+    /// \brief Returns the number of tiles of the look-back.
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE unsigned int number_of_blocks() const
+    {
+        return number_of_blocks_;
+    }
+
+private:
+    ROCPRIM_HOST static hipError_t partition_storage(void* const        temporary_storage,
+                                                     size_t&            storage_size,
+                                                     const unsigned int number_of_blocks,
+                                                     const hipStream_t  stream,
+                                                     void*&             scan_state_storage,
+                                                     unsigned int*&     block_id_storage)
+    {
+        detail::temp_storage::layout layout{};
+        ROCPRIM_RETURN_ON_ERROR(
+            scan_state_type::get_temp_storage_layout(number_of_blocks, stream, layout));
+        return detail::temp_storage::partition(
+            temporary_storage,
+            storage_size,
+            detail::temp_storage::make_linear_partition(
+                detail::temp_storage::make_partition(&scan_state_storage, layout),
+                detail::temp_storage::ptr_aligned_array(&block_id_storage, 1)));
+    }
+
+    scan_state_type scan_state_;
+    block_id_type   block_id_;
+    unsigned int    number_of_blocks_ = 0;
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DECOUPLED_LOOKBACK_HPP_
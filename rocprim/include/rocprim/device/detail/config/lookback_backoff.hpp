@@ -0,0 +1,78 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_CONFIG_LOOKBACK_BACKOFF_HPP_
+#define ROCPRIM_DEVICE_DETAIL_CONFIG_LOOKBACK_BACKOFF_HPP_
+
+#include "../../../config.hpp"
+#include "../../config_types.hpp"
+#include "../lookback_backoff.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The backoff of look-back scans whose config uses lookback_backoff_kind::default_backoff.
+// No architecture has measurements showing that sleeping in the look-back is faster, so the
+// default polls again immediately until tuning results select a backoff per architecture.
+constexpr lookback_backoff_params default_lookback_backoff(const target_arch /*arch*/)
+{
+    return lookback_backoff_none();
+}
+
+// Resolves the backoff of a config for the device of the stream.
+//
+// It is known that early revisions of MI100 (gfx908) hang in the wait loop of the look-back
+// without sleeping, so a backoff that never sleeps is replaced there.
+inline hipError_t resolve_lookback_backoff(const hipStream_t              stream,
+                                           const lookback_backoff_params& requested,
+                                           lookback_backoff_params&       backoff)
+{
+    target_arch arch;
+    if(const hipError_t error = host_target_arch(stream, arch))
+    {
+        return error;
+    }
+    backoff = requested.kind == lookback_backoff_kind::default_backoff
+                  ? default_lookback_backoff(arch)
+                  : requested;
+    if(arch != target_arch::gfx908 || backoff.kind != lookback_backoff_kind::none)
+    {
+        return hipSuccess;
+    }
+
+    device_properties properties;
+    if(const hipError_t error = get_device_properties(stream, properties))
+    {
+        return error;
+    }
+    if(properties.asic_revision < 2)
+    {
+        backoff = lookback_backoff_exponential<1, 32>();
+    }
+    return hipSuccess;
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_CONFIG_LOOKBACK_BACKOFF_HPP_
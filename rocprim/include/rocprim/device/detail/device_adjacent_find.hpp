@@ -22,10 +22,10 @@
 #define ROCPRIM_DEVICE_DETAIL_DEVICE_ADJACENT_FIND_HPP_
 
 #include "device_config_helper.hpp"
+#include "device_ordered_find.hpp"
 #include "ordered_block_id.hpp"
 
 #include "../../block/block_load.hpp"
-#include "../../block/block_reduce.hpp"
 #include "../../intrinsics/thread.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -40,20 +40,8 @@ template<typename Config,
          typename OrderedTileIdType>
 struct adjacent_find_impl_kernels
 {
-    template<class OutputT, class IdT>
-    static
-ROCPRIM_KERNEL __launch_bounds__(1)
-    void init_adjacent_find(OutputT*              reduce_output,
-                            ordered_block_id<IdT> ordered_tile_id,
-                            const size_t          size)
-    {
-        // Reset output value.
-        *reduce_output = size;
-
-        // Reset ordered_block_id.
-        ordered_tile_id.reset();
-    }
-
+    // The transformed input is the index of every pair that satisfies the predicate, otherwise it
+    // is size. The tiles of the pairs are taken in order.
     static
 ROCPRIM_KERNEL
 #ifndef DOXYGEN_DOCUMENTATION_BUILD
@@ -72,86 +60,47 @@ __launch_bounds__(device_params<Config>().kernel_config.block_size)
 
         using transformed_input_type =
             typename std::iterator_traits<TransformedInputIterator>::value_type;
-        using block_reduce_type = ::rocprim::block_reduce<
-            transformed_input_type,
-            block_size,
-            block_reduce_algorithm::raking_reduce>; // TODO?: params.block_reduce_method>;
-
-        ROCPRIM_SHARED_MEMORY union
-        {
-            typename decltype(ordered_tile_id)::storage_type tile_id;
-            std::size_t                                      global_reduce_output;
-        } storage;
-
-        // Get initial tile id
-        const unsigned int thread_id = threadIdx.x;
-        std::size_t        tile_offset
-            = ordered_tile_id.get(threadIdx.x, storage.tile_id) * items_per_tile;
-
-        while(tile_offset < size)
-        {
-            // First thread of each block loads the latest global adjacent index found
-            if(thread_id == 0)
-            {
-                storage.global_reduce_output = atomic_load(reduce_output);
-            }
-            syncthreads();
-
-            // Early exit if a previous block or tile found an adjacent pair
-            if(storage.global_reduce_output < tile_offset)
-            {
-                return;
-            }
 
-            // Do block reduction
-            transformed_input_type transformed_input_values[items_per_thread];
-            transformed_input_type output_value;
+        const unsigned int thread_id = block_thread_id<0>();
 
-            if(tile_offset + items_per_tile > size_t{size - 1}) /* Last incomplete processing */
+        ordered_find_loop<block_size, items_per_tile>(
+            reduce_output,
+            size - 1,
+            ordered_tile_id,
+            [&](const std::size_t tile_offset, const unsigned int valid)
             {
-                const std::size_t valid_in_last_iteration = size - 1 - tile_offset;
-                block_load_direct_striped<block_size>(thread_id,
-                                                      transformed_input + tile_offset,
-                                                      transformed_input_values,
-                                                      valid_in_last_iteration);
-
-                // Thread reductions with boundary check
-                output_value = transformed_input_values[0];
-                ROCPRIM_UNROLL
-                for(unsigned int i = 1; i < items_per_thread; i++)
+                transformed_input_type transformed_input_values[items_per_thread];
+                transformed_input_type output_value = size;
+                if(valid < items_per_tile) /* Last incomplete processing */
+                {
+                    block_load_direct_striped<block_size>(thread_id,
+                                                          transformed_input + tile_offset,
+                                                          transformed_input_values,
+                                                          valid);
+                    ROCPRIM_UNROLL
+                    for(unsigned int i = 0; i < items_per_thread; i++)
+                    {
+                        if(thread_id + i * block_size < valid)
+                        {
+                            output_value = op(output_value, transformed_input_values[i]);
+                        }
+                    }
+                }
+                else /* Complete processings */
                 {
-                    if(thread_id + i * block_size < valid_in_last_iteration)
+                    block_load_direct_striped<block_size>(thread_id,
+                                                          transformed_input + tile_offset,
+                                                          transformed_input_values);
+                    ROCPRIM_UNROLL
+                    for(unsigned int i = 0; i < items_per_thread; i++)
                     {
                         output_value = op(output_value, transformed_input_values[i]);
                     }
                 }
-                // Reduce thread reductions
-                block_reduce_type().reduce(
-                    output_value, // input
-                    output_value, // output
-                    std::min(valid_in_last_iteration, std::size_t{block_size}),
-                    op);
-            }
-            else /* Complete processings */
-            {
-                block_load_direct_striped<block_size>(thread_id,
-                                                      transformed_input + tile_offset,
-                                                      transformed_input_values);
-                block_reduce_type().reduce(transformed_input_values, // input
-                                           output_value, // output
-                                           op);
-            }
-
-            // Save reduction's index into output if an adjacent pair is found
-            if(thread_id == 0 && output_value < size)
-            {
-                // Store global minimum
-                atomic_min(reduce_output, output_value);
-            }
-
-            // Get next tile's id
-            tile_offset = ordered_tile_id.get(threadIdx.x, storage.tile_id) * items_per_tile;
-        }
+                return output_value < size
+                           ? static_cast<unsigned int>(output_value - tile_offset)
+                           : ordered_find_no_match;
+            });
     }
 };
 
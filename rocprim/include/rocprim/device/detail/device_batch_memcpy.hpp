@@ -34,6 +34,7 @@
 #include "rocprim/device/detail/lookback_scan_state.hpp"
 #include "rocprim/device/device_memcpy_config.hpp"
 #include "rocprim/device/device_scan.hpp"
+#include "rocprim/device/execution_budget.hpp"
 
 #include "rocprim/block/block_exchange.hpp"
 #include "rocprim/block/block_load.hpp"
@@ -52,12 +53,16 @@
 #include "rocprim/functional.hpp"
 #include "rocprim/intrinsics.hpp"
 #include "rocprim/intrinsics/thread.hpp"
+#include "rocprim/iterator/constant_iterator.hpp"
+#include "rocprim/iterator/transform_iterator.hpp"
 
 #include "rocprim/common.hpp"
 #include "rocprim/config.hpp"
 
 #include <hip/hip_runtime.h>
 
+#include <chrono>
+
 #include <stdint.h>
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -1111,46 +1116,15 @@ ROCPRIM_INLINE static hipError_t batch_memcpy_func(void*              temporary_
 
     // Compute launch parameters.
 
-    int device_id = hipGetStreamDeviceId(stream);
-
-    // Get the number of multiprocessors
-    int multiprocessor_count{};
-    error = hipDeviceGetAttribute(&multiprocessor_count,
-                                  hipDeviceAttributeMultiprocessorCount,
-                                  device_id);
-    if(error != hipSuccess)
-    {
-        return error;
-    }
-
-    // `hipOccupancyMaxActiveBlocksPerMultiprocessor` uses the default device.
-    // We need to perserve the current default device id while we change it temporarily
-    // to get the max occupancy on this stream.
-    int previous_device;
-    error = hipGetDevice(&previous_device);
-    if(error != hipSuccess)
-    {
-        return error;
-    }
-
-    error = hipSetDevice(device_id);
-    if(error != hipSuccess)
-    {
-        return error;
-    }
-
-    int blev_occupancy{};
-    error = hipOccupancyMaxActiveBlocksPerMultiprocessor(&blev_occupancy,
-                                                         batch_memcpy_impl_type::blev_memcpy_kernel,
-                                                         blev_block_size,
-                                                         0 /* dynSharedMemPerBlk */);
-    if(error != hipSuccess)
-    {
-        return error;
-    }
-
-    // Restore the default device id to initial state
-    error = hipSetDevice(previous_device);
+    // The grid-stride blev kernel gets as many blocks as can be resident at once on the device,
+    // limited to the block budget of the stream.
+    unsigned int batch_memcpy_blev_grid_size;
+    error = occupancy_grid_size(batch_memcpy_impl_type::blev_memcpy_kernel,
+                                blev_block_size,
+                                0,
+                                0,
+                                stream,
+                                batch_memcpy_blev_grid_size);
     if(error != hipSuccess)
     {
         return error;
@@ -1160,9 +1134,6 @@ ROCPRIM_INLINE static hipError_t batch_memcpy_func(void*              temporary_
     const BlockOffsetType     init_kernel_grid_size
         = rocprim::detail::ceiling_div(num_blocks, init_kernel_threads);
 
-    auto batch_memcpy_blev_grid_size
-        = multiprocessor_count * blev_occupancy * 1 /* subscription factor */;
-
     BlockOffsetType batch_memcpy_grid_size = num_blocks;
 
     // Prepare init_scan_states_kernel.
@@ -1239,6 +1210,154 @@ ROCPRIM_INLINE static hipError_t batch_memcpy_func(void*              temporary_
     return hipSuccess;
 }
 
+// Turns the value of a fill into the source of a copy, so that a batch of fills runs on the
+// thread-, warp- and block-level copies of batch_copy.
+template<class T>
+struct batch_fill_source_op
+{
+    ROCPRIM_HOST_DEVICE ::rocprim::constant_iterator<T> operator()(const T& value) const
+    {
+        return ::rocprim::constant_iterator<T>(value);
+    }
+};
+
+// Views a destination of a memset as bytes.
+struct batch_memset_destination_op
+{
+    template<class Pointer>
+    ROCPRIM_HOST_DEVICE unsigned char* operator()(Pointer pointer) const
+    {
+        return static_cast<unsigned char*>(static_cast<void*>(pointer));
+    }
+};
+
+struct batch_memset_value_op
+{
+    template<class Value>
+    ROCPRIM_HOST_DEVICE unsigned char operator()(const Value& value) const
+    {
+        return static_cast<unsigned char>(value);
+    }
+};
+
+template<class Config_,
+         class OutputBufferItType,
+         class ValueItType,
+         class BufferSizeItType>
+ROCPRIM_INLINE static hipError_t batch_fill_func(void*              temporary_storage,
+                                                 size_t&            storage_size,
+                                                 OutputBufferItType destinations,
+                                                 ValueItType        values,
+                                                 BufferSizeItType   sizes,
+                                                 uint32_t           num_fills,
+                                                 hipStream_t        stream,
+                                                 bool               debug_synchronous)
+{
+    using value_type  = typename std::iterator_traits<ValueItType>::value_type;
+    using source_type = ::rocprim::transform_iterator<ValueItType,
+                                                      batch_fill_source_op<value_type>,
+                                                      ::rocprim::constant_iterator<value_type>>;
+
+    return batch_memcpy_func<Config_, source_type, OutputBufferItType, BufferSizeItType, false>(
+        temporary_storage,
+        storage_size,
+        source_type(values, batch_fill_source_op<value_type>{}),
+        destinations,
+        sizes,
+        num_fills,
+        stream,
+        debug_synchronous);
+}
+
+// Copies the rows of the 2D copies, every warp of a block copies rows of the same copy.
+template<uint32_t BlockSize,
+         class InputBufferItType,
+         class InputPitchItType,
+         class OutputBufferItType,
+         class OutputPitchItType,
+         class WidthItType,
+         class HeightItType>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize) void batch_memcpy_2d_kernel(InputBufferItType  sources,
+                                                         InputPitchItType   source_pitches,
+                                                         OutputBufferItType destinations,
+                                                         OutputPitchItType  destination_pitches,
+                                                         WidthItType        widths,
+                                                         HeightItType       heights,
+                                                         uint32_t           num_copies)
+{
+    constexpr uint32_t warps_per_block = BlockSize / ::rocprim::device_warp_size();
+
+    const uint32_t warp_id = ::rocprim::warp_id();
+    for(uint32_t copy = ::rocprim::detail::block_id<0>(); copy < num_copies;
+        copy += ::rocprim::detail::grid_size<0>())
+    {
+        const unsigned char* source
+            = static_cast<const unsigned char*>(static_cast<const void*>(sources[copy]));
+        unsigned char* destination
+            = static_cast<unsigned char*>(static_cast<void*>(destinations[copy]));
+        const size_t source_pitch      = source_pitches[copy];
+        const size_t destination_pitch = destination_pitches[copy];
+        const size_t width             = widths[copy];
+        const size_t height            = heights[copy];
+
+        for(size_t row = warp_id; row < height; row += warps_per_block)
+        {
+            batch_memcpy::vectorized_copy_bytes<size_t>(source + row * source_pitch,
+                                                        destination + row * destination_pitch,
+                                                        width);
+        }
+    }
+}
+
+template<class Config_,
+         class InputBufferItType,
+         class InputPitchItType,
+         class OutputBufferItType,
+         class OutputPitchItType,
+         class WidthItType,
+         class HeightItType>
+ROCPRIM_INLINE static hipError_t batch_memcpy_2d_func(InputBufferItType  sources,
+                                                      InputPitchItType   source_pitches,
+                                                      OutputBufferItType destinations,
+                                                      OutputPitchItType  destination_pitches,
+                                                      WidthItType        widths,
+                                                      HeightItType       heights,
+                                                      uint32_t           num_copies,
+                                                      hipStream_t        stream,
+                                                      bool               debug_synchronous)
+{
+    using Config = detail::default_or_custom_config<Config_, batch_memcpy_config<>>;
+
+    static constexpr uint32_t block_size    = Config::blev_block_size;
+    static constexpr uint32_t max_grid_size = 1u << 20;
+    static_assert(block_size % ROCPRIM_MAX_WARP_SIZE == 0,
+                  "blev_block_size must be a multiple of the warp size");
+
+    if(num_copies == 0)
+    {
+        return hipSuccess;
+    }
+
+    const uint32_t grid_size = ::rocprim::min(num_copies, max_grid_size);
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    batch_memcpy_2d_kernel<block_size><<<grid_size, block_size, 0, stream>>>(sources,
+                                                                             source_pitches,
+                                                                             destinations,
+                                                                             destination_pitches,
+                                                                             widths,
+                                                                             heights,
+                                                                             num_copies);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("batch_memcpy_2d_kernel", num_copies, start);
+
+    return hipSuccess;
+}
+
 } // namespace detail
 
 END_ROCPRIM_NAMESPACE
@@ -0,0 +1,556 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_BATCHED_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_BATCHED_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+
+#include "device_config_helper.hpp"
+#include "device_histogram.hpp"
+#include "device_segmented_radix_sort.hpp"
+#include "device_segmented_reduce.hpp"
+#include "device_segmented_scan.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Each block processes one problem: inputs[problem], sizes[problem] items, and outputs[problem].
+
+template<class Config,
+         class InputPointersIterator,
+         class OutputIterator,
+         class SizesIterator,
+         class ResultType,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+__launch_bounds__(device_params<Config>().reduce_config.block_size)
+void batched_reduce_kernel(InputPointersIterator inputs,
+                           OutputIterator        outputs,
+                           SizesIterator         sizes,
+                           BinaryFunction        reduce_op,
+                           ResultType            initial_value)
+{
+    using size_type = typename std::iterator_traits<SizesIterator>::value_type;
+
+    const unsigned int problem_id = ::rocprim::detail::block_id<0>();
+    segmented_reduce_segment<Config>(inputs[problem_id],
+                                     outputs,
+                                     problem_id,
+                                     size_type(0),
+                                     static_cast<size_type>(sizes[problem_id]),
+                                     reduce_op,
+                                     initial_value);
+}
+
+template<bool Exclusive,
+         class Config,
+         class ResultType,
+         class InputPointersIterator,
+         class OutputPointersIterator,
+         class SizesIterator,
+         class InitValueType,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+__launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
+void batched_scan_kernel(InputPointersIterator  inputs,
+                         OutputPointersIterator outputs,
+                         SizesIterator          sizes,
+                         InitValueType          initial_value,
+                         BinaryFunction         scan_op)
+{
+    const unsigned int problem_id = ::rocprim::detail::block_id<0>();
+    segmented_scan_segment<Exclusive, Config, ResultType>(inputs[problem_id],
+                                                          outputs[problem_id],
+                                                          0u,
+                                                          static_cast<unsigned int>(
+                                                              sizes[problem_id]),
+                                                          static_cast<ResultType>(initial_value),
+                                                          scan_op);
+}
+
+template<class Config,
+         bool Descending,
+         class Key,
+         class Value,
+         class KeysInputPointersIterator,
+         class KeysOutputPointersIterator,
+         class ValuesInputPointersIterator,
+         class ValuesOutputPointersIterator,
+         class SizesIterator>
+ROCPRIM_KERNEL
+__launch_bounds__(Config::block_size)
+void batched_radix_sort_kernel(KeysInputPointersIterator    keys_inputs,
+                               KeysOutputPointersIterator   keys_outputs,
+                               ValuesInputPointersIterator  values_inputs,
+                               ValuesOutputPointersIterator values_outputs,
+                               SizesIterator                sizes,
+                               unsigned int                 begin_bit,
+                               unsigned int                 end_bit)
+{
+    static constexpr bool with_values = !std::is_same<Value, ::rocprim::empty_type>::value;
+
+    using single_block_helper_type
+        = segmented_radix_sort_single_block_helper<Key,
+                                                   Value,
+                                                   Config::block_size,
+                                                   Config::items_per_thread,
+                                                   Descending>;
+
+    ROCPRIM_SHARED_MEMORY typename single_block_helper_type::storage_type storage;
+
+    const unsigned int problem_id = ::rocprim::detail::block_id<0>();
+    const unsigned int size       = sizes[problem_id];
+
+    using values_input_type =
+        typename std::iterator_traits<ValuesInputPointersIterator>::value_type;
+    using values_output_type =
+        typename std::iterator_traits<ValuesOutputPointersIterator>::value_type;
+
+    // Keys-only sorts pass null iterators of values
+    const values_input_type  values_input  = with_values ? values_inputs[problem_id] : nullptr;
+    const values_output_type values_output = with_values ? values_outputs[problem_id] : nullptr;
+
+    // Problems larger than a tile are rejected by the helper and left unsorted
+    single_block_helper_type().sort(keys_inputs[problem_id],
+                                    keys_outputs[problem_id],
+                                    values_input,
+                                    values_output,
+                                    0u,
+                                    size,
+                                    begin_bit,
+                                    end_bit,
+                                    storage);
+}
+
+// The offsets of the problems of a batch of equally sized problems: of their first items when
+// extra is 0, and past their last items when extra is the problem size.
+struct batched_problem_offset
+{
+    unsigned int stride;
+    unsigned int extra;
+
+    ROCPRIM_HOST_DEVICE
+    unsigned int operator()(const unsigned int problem) const
+    {
+        return problem * stride + extra;
+    }
+};
+
+// Iterates over the items of a batch of problems of problem_size items each, one problem after
+// the other. The item j of problem i is at i * problem_stride + j * item_stride, e.g. the columns
+// of a row-major matrix are problems with problem_stride 1 and item_stride the row length.
+template<class T>
+class batched_strided_iterator
+{
+public:
+    using value_type        = typename std::remove_const<T>::type;
+    using reference         = T&;
+    using pointer           = T*;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    ROCPRIM_HOST_DEVICE
+    batched_strided_iterator(T*                    ptr,
+                             const unsigned int    problem_size,
+                             const size_t          problem_stride,
+                             const size_t          item_stride,
+                             const difference_type index = 0)
+        : ptr_(ptr)
+        , problem_size_(problem_size)
+        , problem_stride_(problem_stride)
+        , item_stride_(item_stride)
+        , index_(index)
+    {}
+
+    ROCPRIM_HOST_DEVICE
+    reference operator*() const
+    {
+        return at(index_);
+    }
+
+    ROCPRIM_HOST_DEVICE
+    reference operator[](const difference_type distance) const
+    {
+        return at(index_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE
+    batched_strided_iterator operator+(const difference_type distance) const
+    {
+        return batched_strided_iterator(ptr_,
+                                        problem_size_,
+                                        problem_stride_,
+                                        item_stride_,
+                                        index_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE
+    batched_strided_iterator& operator+=(const difference_type distance)
+    {
+        index_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE
+    batched_strided_iterator operator-(const difference_type distance) const
+    {
+        return *this + (-distance);
+    }
+
+    ROCPRIM_HOST_DEVICE
+    difference_type operator-(const batched_strided_iterator& other) const
+    {
+        return index_ - other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE
+    batched_strided_iterator& operator++()
+    {
+        ++index_;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE
+    bool operator==(const batched_strided_iterator& other) const
+    {
+        return ptr_ == other.ptr_ && index_ == other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE
+    bool operator!=(const batched_strided_iterator& other) const
+    {
+        return !(*this == other);
+    }
+
+private:
+    ROCPRIM_HOST_DEVICE
+    reference at(const difference_type index) const
+    {
+        const size_t problem = static_cast<size_t>(index) / problem_size_;
+        const size_t item    = static_cast<size_t>(index) - problem * problem_size_;
+        return ptr_[problem * problem_stride_ + item * item_stride_];
+    }
+
+    T*              ptr_;
+    unsigned int    problem_size_;
+    size_t          problem_stride_;
+    size_t          item_stride_;
+    difference_type index_;
+};
+
+// The first item of every row of a pitched 2D array, for the kernels of the batched algorithms.
+template<class Iterator>
+struct pitched_row_op
+{
+    Iterator base;
+    size_t   pitch;
+
+    ROCPRIM_HOST_DEVICE
+    Iterator operator()(const unsigned int row) const
+    {
+        return base + row * pitch;
+    }
+};
+
+// The columns of a pitched 2D array are processed by one thread per column and chunk of rows,
+// so the threads of a block load consecutive items of a row. The chunks of a column are combined
+// in order, so the operator only needs to be associative.
+constexpr unsigned int column_block_size = 256;
+
+// Reduces the rows of every chunk of every column into partials[chunk * columns + column].
+template<unsigned int BlockSize,
+         class ResultType,
+         class InputIterator,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void column_reduce_chunks_kernel(InputIterator      input,
+                                 const size_t       pitch,
+                                 const unsigned int rows,
+                                 const unsigned int columns,
+                                 const unsigned int rows_per_chunk,
+                                 ResultType*        partials,
+                                 BinaryFunction     reduce_op)
+{
+    const unsigned int column = ::rocprim::detail::block_id<0>() * BlockSize
+                                + ::rocprim::detail::block_thread_id<0>();
+    const unsigned int chunk = ::rocprim::detail::block_id<1>();
+    if(column >= columns)
+    {
+        return;
+    }
+
+    const unsigned int row_begin = chunk * rows_per_chunk;
+    const unsigned int row_end   = ::rocprim::min(rows, row_begin + rows_per_chunk);
+
+    ResultType result = input[row_begin * pitch + column];
+    for(unsigned int row = row_begin + 1; row < row_end; row++)
+    {
+        result = reduce_op(result, input[row * pitch + column]);
+    }
+    partials[size_t(chunk) * columns + column] = result;
+}
+
+template<unsigned int BlockSize, class ResultType, class OutputIterator, class BinaryFunction>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void column_reduce_kernel(const ResultType*  partials,
+                          const unsigned int chunks,
+                          const unsigned int columns,
+                          OutputIterator     output,
+                          BinaryFunction     reduce_op,
+                          ResultType         initial_value)
+{
+    const unsigned int column = ::rocprim::detail::block_id<0>() * BlockSize
+                                + ::rocprim::detail::block_thread_id<0>();
+    if(column >= columns)
+    {
+        return;
+    }
+
+    ResultType result = initial_value;
+    for(unsigned int chunk = 0; chunk < chunks; chunk++)
+    {
+        result = reduce_op(result, partials[size_t(chunk) * columns + column]);
+    }
+    output[column] = result;
+}
+
+// Scans every chunk of every column, starting from the reduction of the preceding chunks of the
+// column. partials is only read when there are several chunks.
+template<bool Exclusive,
+         unsigned int BlockSize,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void column_scan_kernel(InputIterator      input,
+                        const size_t       input_pitch,
+                        OutputIterator     output,
+                        const size_t       output_pitch,
+                        const unsigned int rows,
+                        const unsigned int columns,
+                        const unsigned int rows_per_chunk,
+                        const ResultType*  partials,
+                        BinaryFunction     scan_op,
+                        ResultType         initial_value)
+{
+    const unsigned int column = ::rocprim::detail::block_id<0>() * BlockSize
+                                + ::rocprim::detail::block_thread_id<0>();
+    const unsigned int chunk = ::rocprim::detail::block_id<1>();
+    if(column >= columns)
+    {
+        return;
+    }
+
+    const unsigned int row_begin = chunk * rows_per_chunk;
+    const unsigned int row_end   = ::rocprim::min(rows, row_begin + rows_per_chunk);
+
+    // The inclusive scan has no prefix before the first item of the column
+    bool       has_prefix = Exclusive;
+    ResultType prefix     = initial_value;
+    for(unsigned int previous = 0; previous < chunk; previous++)
+    {
+        const ResultType partial = partials[size_t(previous) * columns + column];
+        prefix                   = has_prefix ? scan_op(prefix, partial) : partial;
+        has_prefix               = true;
+    }
+
+    for(unsigned int row = row_begin; row < row_end; row++)
+    {
+        const ResultType value = input[row * input_pitch + column];
+        if(Exclusive)
+        {
+            output[row * output_pitch + column] = prefix;
+            prefix                              = scan_op(prefix, value);
+        }
+        else
+        {
+            prefix = has_prefix ? scan_op(prefix, value) : value;
+            output[row * output_pitch + column] = prefix;
+        }
+        has_prefix = true;
+    }
+}
+
+// Splits the rows into chunks, so that the columns of a narrow array are still processed by enough
+// threads to fill the device. Every chunk has at least min_rows rows.
+inline unsigned int column_rows_per_chunk(const unsigned int rows, const unsigned int columns)
+{
+    constexpr unsigned int min_threads = 1u << 16;
+    constexpr unsigned int min_rows    = 64;
+    constexpr unsigned int max_chunks  = 4096;
+
+    const unsigned int wanted_chunks
+        = ::rocprim::min(max_chunks, ceiling_div(min_threads, ::rocprim::max(columns, 1u)));
+    const unsigned int chunks
+        = ::rocprim::max(1u, ::rocprim::min(wanted_chunks, ceiling_div(rows, min_rows)));
+    return ::rocprim::max(1u, ceiling_div(rows, chunks));
+}
+
+// A batched histogram has a block per problem, so the block also initializes the histogram and
+// no separate launch is needed. The bins of a problem are counted in shared memory when there
+// are at most batched_histogram_shared_bins of them, and with global atomics otherwise.
+constexpr unsigned int batched_histogram_block_size  = 256;
+constexpr unsigned int batched_histogram_shared_bins = 2048;
+
+// The bins of problem i of a batched histogram with equal-width bins.
+template<class LevelsIterator, class LevelIterator>
+struct batched_histogram_even_op
+{
+    using level_type = typename std::iterator_traits<LevelIterator>::value_type;
+
+    LevelsIterator levels;
+    LevelIterator  lower_levels;
+    LevelIterator  upper_levels;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned int bins(const unsigned int problem) const
+    {
+        const unsigned int problem_levels = levels[problem];
+        return problem_levels < 2 ? 0 : problem_levels - 1;
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    sample_to_bin_even<level_type> operator()(const unsigned int problem,
+                                              const unsigned int problem_bins) const
+    {
+        return sample_to_bin_even<level_type>(problem_bins,
+                                              lower_levels[problem],
+                                              upper_levels[problem]);
+    }
+};
+
+// The bins of problem i of a batched histogram with the specified bin boundary levels.
+template<class LevelsIterator, class LevelValuesPointersIterator>
+struct batched_histogram_range_op
+{
+    using level_type = typename std::remove_cv<typename std::iterator_traits<
+        typename std::iterator_traits<LevelValuesPointersIterator>::value_type>::value_type>::type;
+
+    LevelsIterator              levels;
+    LevelValuesPointersIterator level_values;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    unsigned int bins(const unsigned int problem) const
+    {
+        const unsigned int problem_levels = levels[problem];
+        return problem_levels < 2 ? 0 : problem_levels - 1;
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    sample_to_bin_range<level_type> operator()(const unsigned int problem,
+                                               const unsigned int problem_bins) const
+    {
+        return sample_to_bin_range<level_type>(problem_bins, level_values[problem]);
+    }
+};
+
+template<unsigned int BlockSize,
+         class SamplePointersIterator,
+         class SizesIterator,
+         class HistogramPointersIterator,
+         class SampleToBinOpFactory>
+ROCPRIM_KERNEL
+__launch_bounds__(BlockSize)
+void batched_histogram_kernel(SamplePointersIterator    samples,
+                              SizesIterator             sizes,
+                              HistogramPointersIterator histograms,
+                              SampleToBinOpFactory      sample_to_bin_ops)
+{
+    using histogram_type = typename std::iterator_traits<HistogramPointersIterator>::value_type;
+    using counter_type   = typename std::iterator_traits<histogram_type>::value_type;
+
+    ROCPRIM_SHARED_MEMORY unsigned int shared_histogram[batched_histogram_shared_bins];
+
+    const unsigned int flat_id    = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int problem_id = ::rocprim::detail::block_id<0>();
+
+    // Problems with fewer than 2 levels have no bins
+    const unsigned int bins = sample_to_bin_ops.bins(problem_id);
+    if(bins == 0)
+    {
+        return;
+    }
+
+    const auto           sample_to_bin_op = sample_to_bin_ops(problem_id, bins);
+    const auto           input            = samples[problem_id];
+    const unsigned int   size             = sizes[problem_id];
+    const histogram_type histogram        = histograms[problem_id];
+    const bool           in_shared        = bins <= batched_histogram_shared_bins;
+
+    for(unsigned int bin = flat_id; bin < bins; bin += BlockSize)
+    {
+        if(in_shared)
+        {
+            shared_histogram[bin] = 0;
+        }
+        else
+        {
+            histogram[bin] = counter_type(0);
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int i = flat_id; i < size; i += BlockSize)
+    {
+        unsigned int bin;
+        if(sample_to_bin_op(input[i], bin))
+        {
+            if(in_shared)
+            {
+                ::rocprim::detail::atomic_add(&shared_histogram[bin], 1u);
+            }
+            else
+            {
+                ::rocprim::detail::atomic_add(&histogram[bin], counter_type(1));
+            }
+        }
+    }
+
+    if(in_shared)
+    {
+        ::rocprim::syncthreads();
+        for(unsigned int bin = flat_id; bin < bins; bin += BlockSize)
+        {
+            histogram[bin] = static_cast<counter_type>(shared_histogram[bin]);
+        }
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_BATCHED_HPP_
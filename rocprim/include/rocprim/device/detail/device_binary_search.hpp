@@ -21,6 +21,12 @@
 #ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_BINARY_SEARCH_HPP_
 #define ROCPRIM_DEVICE_DETAIL_DEVICE_BINARY_SEARCH_HPP_
 
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+
+#include <cstddef>
+
 BEGIN_ROCPRIM_NAMESPACE
 
 namespace detail
@@ -113,6 +119,153 @@ struct binary_search_op
     }
 };
 
+// The search index of a sorted haystack is an implicit binary search tree in Eytzinger (breadth
+// first) order over the first items of the groups of the haystack, where a group spans 128 bytes,
+// the size of a cache line. The tree is perfect, with 2^levels - 1 nodes, and the nodes past the
+// last group are treated as greater than any value. The first levels of the tree are shared by
+// all searches and stay in the caches, and the children of a node are next to each other, so a
+// search touches far fewer cache lines than a binary search over the entire haystack. The search
+// finishes with a binary search within a single group of the haystack.
+template<class T>
+ROCPRIM_HOST_DEVICE constexpr size_t search_index_group_size()
+{
+    return sizeof(T) < 128 ? 128 / sizeof(T) : 1;
+}
+
+struct search_index_layout
+{
+    size_t       groups;
+    unsigned int levels;
+};
+
+template<class T>
+ROCPRIM_HOST_DEVICE inline search_index_layout get_search_index_layout(const size_t haystack_size)
+{
+    search_index_layout layout{ceiling_div(haystack_size, search_index_group_size<T>()), 0};
+    while((size_t(1) << layout.levels) - 1 < layout.groups)
+    {
+        layout.levels++;
+    }
+    return layout;
+}
+
+// Returns the group of the haystack whose first item is stored in a node of the index, or
+// the last group for the nodes past the last group.
+struct search_index_node_op
+{
+    search_index_layout layout;
+
+    ROCPRIM_HOST_DEVICE inline size_t operator()(const size_t node) const
+    {
+        // The node is the (position + 1)th node at the depth, counting from 0 at the root
+        const size_t heap_index = node + 1;
+        unsigned int depth      = 0;
+        while((heap_index >> (depth + 1)) != 0)
+        {
+            depth++;
+        }
+        const size_t position = heap_index - (size_t(1) << depth);
+        const size_t group    = ((2 * position + 1) << (layout.levels - 1 - depth)) - 1;
+        return ::rocprim::min(group, layout.groups - 1);
+    }
+};
+
+// Returns the number of groups whose first item satisfies the predicate, where the predicate
+// holds for a prefix of the groups.
+template<class T, class Predicate>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+size_t search_index_count_groups(const T*                  nodes,
+                                 const search_index_layout layout,
+                                 Predicate                 predicate)
+{
+    size_t heap_index = 1;
+    size_t group      = (size_t(1) << layout.levels >> 1) - 1;
+    size_t delta      = size_t(1) << layout.levels >> 1;
+    for(unsigned int level = 0; level < layout.levels; level++)
+    {
+        const bool right = group < layout.groups && predicate(nodes[heap_index - 1]);
+        delta >>= 1;
+        heap_index = 2 * heap_index + right;
+        group      = right ? group + delta : group - delta;
+    }
+    return heap_index - (size_t(1) << layout.levels);
+}
+
+template<class T>
+struct search_index_lower_bound_op
+{
+    const T*            nodes;
+    search_index_layout layout;
+
+    template<class HaystackIterator, class CompareOp, class Size, class Value>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    Size operator()(HaystackIterator haystack,
+                    Size             size,
+                    const Value&     value,
+                    CompareOp        compare_op) const
+    {
+        const size_t groups = search_index_count_groups(nodes,
+                                                        layout,
+                                                        [&](const T& first)
+                                                        { return compare_op(first, value); });
+        if(groups == 0)
+        {
+            return 0;
+        }
+        const Size first = static_cast<Size>((groups - 1) * search_index_group_size<T>());
+        const Size group_size
+            = ::rocprim::min<Size>(size - first, static_cast<Size>(search_index_group_size<T>()));
+        return first + lower_bound_n(haystack + first, group_size, value, compare_op);
+    }
+};
+
+template<class T>
+struct search_index_upper_bound_op
+{
+    const T*            nodes;
+    search_index_layout layout;
+
+    template<class HaystackIterator, class CompareOp, class Size, class Value>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    Size operator()(HaystackIterator haystack,
+                    Size             size,
+                    const Value&     value,
+                    CompareOp        compare_op) const
+    {
+        const size_t groups = search_index_count_groups(nodes,
+                                                        layout,
+                                                        [&](const T& first)
+                                                        { return !compare_op(value, first); });
+        if(groups == 0)
+        {
+            return 0;
+        }
+        const Size first = static_cast<Size>((groups - 1) * search_index_group_size<T>());
+        const Size group_size
+            = ::rocprim::min<Size>(size - first, static_cast<Size>(search_index_group_size<T>()));
+        return first + upper_bound_n(haystack + first, group_size, value, compare_op);
+    }
+};
+
+template<class T>
+struct search_index_binary_search_op
+{
+    const T*            nodes;
+    search_index_layout layout;
+
+    template<class HaystackIterator, class CompareOp, class Size, class Value>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(HaystackIterator haystack,
+                    Size             size,
+                    const Value&     value,
+                    CompareOp        compare_op) const
+    {
+        const Size n
+            = search_index_lower_bound_op<T>{nodes, layout}(haystack, size, value, compare_op);
+        return n != size && !compare_op(value, haystack[n]);
+    }
+};
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
@@ -0,0 +1,247 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_BITPACK_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_BITPACK_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+
+#include "../../block/block_reduce.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+constexpr unsigned int bitpack_block_size       = 256;
+constexpr unsigned int bitpack_items_per_thread = 4;
+
+static_assert(bitpack_block_size * bitpack_items_per_thread % 32 == 0,
+              "The packed words of every full tile must not be shared with the next tile");
+
+// The items of a tile are stored as the offsets from the minimum of the tile, in an unsigned
+// type, so that the offsets of signed items do not overflow.
+template<class T>
+using bitpack_unsigned_type = typename std::make_unsigned<T>::type;
+
+template<class T>
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+bitpack_unsigned_type<T> bitpack_offset(const T value, const T minimum)
+{
+    return static_cast<bitpack_unsigned_type<T>>(static_cast<bitpack_unsigned_type<T>>(value)
+                                                 - static_cast<bitpack_unsigned_type<T>>(minimum));
+}
+
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned int bitpack_bit_width(const unsigned long long value)
+{
+    return value == 0 ? 0u : 64u - static_cast<unsigned int>(__clzll(value));
+}
+
+// Number of 32-bit words of a tile with the items packed to bit_width bits
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+size_t bitpack_tile_words(const unsigned int items, const unsigned int bit_width)
+{
+    return ::rocprim::detail::ceiling_div(size_t(items) * bit_width, size_t(32));
+}
+
+// The first pass finds the minimum and the bit width of the offsets of every tile, and the
+// number of packed words of the tile, which are scanned to the offsets of the tiles.
+template<class InputIterator, class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void bitpack_tile_stats_kernel_impl(InputIterator input,
+                                    const size_t  size,
+                                    T*            tile_minimums,
+                                    unsigned int* tile_bit_widths,
+                                    size_t*       tile_words)
+{
+    constexpr unsigned int items_per_block = bitpack_block_size * bitpack_items_per_thread;
+
+    using block_reduce_type = ::rocprim::block_reduce<T, bitpack_block_size>;
+
+    ROCPRIM_SHARED_MEMORY typename block_reduce_type::storage_type storage;
+
+    const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int tile         = ::rocprim::detail::block_id<0>();
+    const unsigned int tiles        = ::rocprim::detail::grid_size<0>();
+    const size_t       block_offset = size_t(tile) * items_per_block;
+    const unsigned int valid_in_block
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    // Threads without valid items take the first item of the tile, which is always valid
+    T thread_minimum = input[block_offset];
+    T thread_maximum = thread_minimum;
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < bitpack_items_per_thread; i++)
+    {
+        const unsigned int position = flat_id * bitpack_items_per_thread + i;
+        if(position < valid_in_block)
+        {
+            const T value  = input[block_offset + position];
+            thread_minimum = ::rocprim::min(thread_minimum, value);
+            thread_maximum = ::rocprim::max(thread_maximum, value);
+        }
+    }
+
+    T minimum;
+    T maximum;
+    block_reduce_type().reduce(thread_minimum, minimum, storage, ::rocprim::minimum<T>());
+    ::rocprim::syncthreads();
+    block_reduce_type().reduce(thread_maximum, maximum, storage, ::rocprim::maximum<T>());
+
+    if(flat_id == 0)
+    {
+        const unsigned int bit_width = bitpack_bit_width(bitpack_offset(maximum, minimum));
+        tile_minimums[tile]          = minimum;
+        tile_bit_widths[tile]        = bit_width;
+        tile_words[tile]             = bitpack_tile_words(valid_in_block, bit_width);
+        if(tile == tiles - 1)
+        {
+            // The scan of the word counts also gives the end of the last tile
+            tile_words[tiles] = 0;
+        }
+    }
+}
+
+// The second pass stages the offsets of a tile in shared memory, and every thread assembles
+// whole 32-bit words of the tile from the items that overlap them, so the words are stored
+// without atomics and coalesced.
+template<class InputIterator, class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void bitpack_pack_kernel_impl(InputIterator       input,
+                              const size_t        size,
+                              const T*            tile_minimums,
+                              const unsigned int* tile_bit_widths,
+                              const size_t*       tile_offsets,
+                              unsigned int*       packed_output)
+{
+    constexpr unsigned int items_per_block = bitpack_block_size * bitpack_items_per_thread;
+
+    using unsigned_type = bitpack_unsigned_type<T>;
+
+    ROCPRIM_SHARED_MEMORY unsigned_type offsets[items_per_block];
+
+    const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int tile         = ::rocprim::detail::block_id<0>();
+    const size_t       block_offset = size_t(tile) * items_per_block;
+    const unsigned int valid_in_block
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    const T            minimum   = tile_minimums[tile];
+    const unsigned int bit_width = tile_bit_widths[tile];
+    if(bit_width == 0)
+    {
+        return;
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < bitpack_items_per_thread; i++)
+    {
+        const unsigned int position = i * bitpack_block_size + flat_id;
+        if(position < valid_in_block)
+        {
+            offsets[position] = bitpack_offset(static_cast<T>(input[block_offset + position]),
+                                               minimum);
+        }
+    }
+    ::rocprim::syncthreads();
+
+    unsigned int* const tile_output = packed_output + tile_offsets[tile];
+    const unsigned int  words
+        = static_cast<unsigned int>(bitpack_tile_words(valid_in_block, bit_width));
+    for(unsigned int word = flat_id; word < words; word += bitpack_block_size)
+    {
+        const unsigned long long word_begin = 32ull * word;
+        const unsigned int       first      = static_cast<unsigned int>(word_begin / bit_width);
+        const unsigned int       last       = ::rocprim::min(
+            static_cast<unsigned int>((word_begin + 31) / bit_width) + 1, valid_in_block);
+
+        unsigned long long result = 0;
+        for(unsigned int item = first; item < last; item++)
+        {
+            const unsigned long long value     = offsets[item];
+            const unsigned long long bit_begin = 1ull * item * bit_width;
+            result |= bit_begin >= word_begin ? value << (bit_begin - word_begin)
+                                              : value >> (word_begin - bit_begin);
+        }
+        tile_output[word] = static_cast<unsigned int>(result);
+    }
+}
+
+// Decodes one item of the packed tiles, the words of an item are in its tile, so reading them
+// does not go past the end of the packed words.
+template<class T>
+struct bitpack_unpack_op
+{
+    const unsigned int* packed;
+    const size_t*       tile_offsets;
+    const T*            tile_minimums;
+    const unsigned int* tile_bit_widths;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    T operator()(const size_t index) const
+    {
+        constexpr unsigned int items_per_block = bitpack_block_size * bitpack_items_per_thread;
+
+        const size_t       tile      = index / items_per_block;
+        const unsigned int position  = static_cast<unsigned int>(index % items_per_block);
+        const unsigned int bit_width = tile_bit_widths[tile];
+        const T            minimum   = tile_minimums[tile];
+        if(bit_width == 0)
+        {
+            return minimum;
+        }
+
+        const unsigned long long bit_begin = 1ull * position * bit_width;
+        const unsigned int*      words     = packed + tile_offsets[tile] + bit_begin / 32;
+        const unsigned int       shift     = static_cast<unsigned int>(bit_begin % 32);
+        const unsigned int       count     = (shift + bit_width + 31) / 32;
+
+        unsigned long long value = words[0] >> shift;
+        if(count > 1)
+        {
+            value |= static_cast<unsigned long long>(words[1]) << (32 - shift);
+        }
+        if(count > 2)
+        {
+            value |= static_cast<unsigned long long>(words[2]) << (64 - shift);
+        }
+        if(bit_width < 64)
+        {
+            value &= (1ull << bit_width) - 1;
+        }
+
+        using unsigned_type = bitpack_unsigned_type<T>;
+        return static_cast<T>(static_cast<unsigned_type>(static_cast<unsigned_type>(minimum)
+                                                         + static_cast<unsigned_type>(value)));
+    }
+};
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_BITPACK_HPP_
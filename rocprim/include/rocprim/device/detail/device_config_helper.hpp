@@ -35,6 +35,7 @@
 #include "rocprim/block/block_radix_rank.hpp"
 #include "rocprim/block/block_sort.hpp"
 
+#include "lookback_backoff.hpp"
 #include "lookback_scan_state.hpp"
 
 /// \addtogroup primitivesmodule_deviceconfigs
@@ -176,6 +177,13 @@ struct radix_sort_onesweep_config_params
 
     /// \brief The internal block radix rank algorithm to use during the onesweep iteration.
     block_radix_rank_algorithm radix_rank_algorithm = block_radix_rank_algorithm::default_algorithm;
+
+    /// \brief The backoff of the look-back of the onesweep iteration.
+    lookback_backoff_params backoff{};
+
+    /// \brief The number of bits of the short onesweep iterations, 0 if every iteration sorts
+    /// \p radix_bits_per_place bits.
+    unsigned int short_radix_bits = 0;
 };
 
 } // namespace detail
@@ -186,13 +194,25 @@ struct radix_sort_onesweep_config_params
 /// \tparam SortConfig - configuration of sort kernel.
 /// \tparam RadixBits - number of bits per iteration.
 /// \tparam RadixRankAlgorithm - algorithm used for radix rank.
+/// \tparam LookbackBackoff - backoff of the look-back of the sort kernel, see
+/// \p lookback_backoff_config.
+/// \tparam ShortRadixBits - number of bits of the short iterations, \p 0 sorts \p RadixBits bits
+/// in every iteration. Otherwise the bits are sorted in the same number of iterations, of which as
+/// many as possible are short, for example 11 + 11 + 10 bits for 32-bit keys with \p RadixBits
+/// 11 and \p ShortRadixBits 10. The short iterations run a sort kernel compiled for
+/// \p ShortRadixBits, whose digit counters take less shared memory.
 template<class HistogramConfig                = kernel_config<256, 12>,
          class SortConfig                     = kernel_config<256, 12>,
          unsigned int               RadixBits = 4,
          block_radix_rank_algorithm RadixRankAlgorithm
-         = block_radix_rank_algorithm::default_algorithm>
+         = block_radix_rank_algorithm::default_algorithm,
+         class LookbackBackoff       = lookback_backoff_config<>,
+         unsigned int ShortRadixBits = 0>
 struct radix_sort_onesweep_config : detail::radix_sort_onesweep_config_params
 {
+    static_assert(ShortRadixBits < RadixBits,
+                  "ShortRadixBits must be less than RadixBits, or 0 to disable short iterations");
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
     /// \brief Configration of radix sort onesweep histogram kernel.
     using histogram = HistogramConfig;
@@ -205,6 +225,8 @@ struct radix_sort_onesweep_config : detail::radix_sort_onesweep_config_params
             {     SortConfig::block_size,      SortConfig::items_per_thread},
             RadixBits,
             RadixRankAlgorithm,
+            LookbackBackoff(),
+            ShortRadixBits,
     } {};
 #endif
 };
@@ -222,10 +244,39 @@ struct radix_sort_onesweep_config_base
     static constexpr unsigned int item_scale = ::rocprim::max(sizeof(Key), sizeof(Value));
 
     static constexpr unsigned int block_size = merge_sort_block_size(item_scale) * 4;
-    using type                               = radix_sort_onesweep_config<
+
+    // Keys wider than 64 bits (e.g. 128-bit integers) would take 32 iterations with 4 bits, so
+    // they use 8 bits like the tuned configurations of 64-bit keys, ranked by the match rank,
+    // whose digit counters are per warp instead of per thread. The 16 places of their shared
+    // histogram use 2 atomic stripes instead of 4, which keeps it at 32 KiB as for 64-bit keys.
+    static constexpr bool         wide_key   = sizeof(Key) > 8;
+    static constexpr unsigned int radix_bits = wide_key ? 8 : 4;
+
+    using type = radix_sort_onesweep_config<
         kernel_config<256, 12>,
         kernel_config<block_size, ::rocprim::max(1u, 65000u / block_size / item_scale)>,
-        4>;
+        radix_bits,
+        wide_key ? block_radix_rank_algorithm::match
+                 : block_radix_rank_algorithm::default_algorithm>;
+};
+
+// The configurations of wave32 architectures without tuned onesweep configurations (RDNA3).
+// It follows the shape of the tuned gfx1030 configurations: 8 bits per place ranked by the match
+// rank, whose 16-bit per-warp digit counters fit in shared memory for blocks of 1024 threads.
+template<class Key, class Value>
+struct radix_sort_onesweep_wave32_config_base
+{
+    static constexpr unsigned int item_scale = ::rocprim::max(sizeof(Key), sizeof(Value));
+
+    static constexpr unsigned int items_per_thread
+        = ::rocprim::max(1u, ::rocprim::min(8u, 16u / item_scale));
+
+    static constexpr unsigned int radix_bits = 8;
+
+    using type = radix_sort_onesweep_config<kernel_config<1024, items_per_thread>,
+                                            kernel_config<1024, items_per_thread>,
+                                            radix_bits,
+                                            block_radix_rank_algorithm::match>;
 };
 
 struct reduce_config_params
@@ -283,6 +334,9 @@ struct scan_config_params
     ::rocprim::block_load_method    block_load_method{};
     ::rocprim::block_store_method   block_store_method{};
     ::rocprim::block_scan_algorithm block_scan_method{};
+    bool                            persistent{};
+    lookback_backoff_params         backoff{};
+    bool                            two_pass{};
 };
 
 } // namespace detail
@@ -294,13 +348,23 @@ struct scan_config_params
 /// \tparam BlockLoadMethod - method for loading input values.
 /// \tparam StoreLoadMethod - method for storing values.
 /// \tparam BlockScanMethod - algorithm for block scan.
-/// \tparam SizeLimit - limit on the number of items for a single scan kernel launch.
+/// \tparam SizeLimit - limit on the number of items for a single scan kernel launch. Larger
+/// inputs are scanned by a persistent grid instead of several launches.
+/// \tparam Persistent - if true, a single launch of as many blocks as can be resident on the
+/// device processes all tiles, taking them in order. \p SizeLimit is then ignored.
+/// \tparam LookbackBackoff - backoff of the look-back, see \p lookback_backoff_config.
+/// \tparam TwoPass - if true, the scan reduces the tiles, scans the tile reductions and then
+/// scans the tiles again, instead of the single pass with look-back. No block waits on another
+/// one and the result is deterministic. \p SizeLimit and \p Persistent are then ignored.
 template<unsigned int                    BlockSize,
          unsigned int                    ItemsPerThread,
          ::rocprim::block_load_method    BlockLoadMethod,
          ::rocprim::block_store_method   BlockStoreMethod,
          ::rocprim::block_scan_algorithm BlockScanMethod,
-         unsigned int                    SizeLimit = ROCPRIM_GRID_SIZE_LIMIT>
+         unsigned int                    SizeLimit       = ROCPRIM_GRID_SIZE_LIMIT,
+         bool                            Persistent      = false,
+         class                           LookbackBackoff = lookback_backoff_config<>,
+         bool                            TwoPass         = false>
 struct scan_config : ::rocprim::detail::scan_config_params
 {
     /// \brief Identifies the algorithm associated to the config.
@@ -322,13 +386,20 @@ struct scan_config : ::rocprim::detail::scan_config_params
     static constexpr ::rocprim::block_scan_algorithm block_scan_method = BlockScanMethod;
     /// \brief Limit on the number of items for a single scan kernel launch.
     static constexpr unsigned int size_limit = SizeLimit;
+    /// \brief Whether a persistent grid processes all tiles.
+    static constexpr bool persistent = Persistent;
+    /// \brief Whether the tiles are reduced before they are scanned.
+    static constexpr bool two_pass = TwoPass;
 
     constexpr scan_config()
         : ::rocprim::detail::scan_config_params{
             {BlockSize, ItemsPerThread, SizeLimit},
             BlockLoadMethod,
             BlockStoreMethod,
-            BlockScanMethod
+            BlockScanMethod,
+            Persistent,
+            LookbackBackoff(),
+            TwoPass
     } {};
 #endif
 };
@@ -360,6 +431,9 @@ struct scan_by_key_config_params
     ::rocprim::block_load_method    block_load_method;
     ::rocprim::block_store_method   block_store_method;
     ::rocprim::block_scan_algorithm block_scan_method;
+    bool                            persistent;
+    lookback_backoff_params         backoff;
+    bool                            two_pass;
 };
 
 } // namespace detail
@@ -371,13 +445,23 @@ struct scan_by_key_config_params
 /// \tparam BlockLoadMethod - method for loading input values.
 /// \tparam StoreLoadMethod - method for storing values.
 /// \tparam BlockScanMethod - algorithm for block scan.
-/// \tparam SizeLimit - limit on the number of items for a single scan kernel launch.
+/// \tparam SizeLimit - limit on the number of items for a single scan kernel launch. Larger
+/// inputs are scanned by a persistent grid instead of several launches.
+/// \tparam Persistent - if true, a single launch of as many blocks as can be resident on the
+/// device processes all tiles, taking them in order. \p SizeLimit is then ignored.
+/// \tparam LookbackBackoff - backoff of the look-back, see \p lookback_backoff_config.
+/// \tparam TwoPass - if true, the scan reduces the flagged tiles, scans the tile reductions and
+/// then scans the tiles again, instead of the single pass with look-back. No block waits on
+/// another one and the result is deterministic. \p SizeLimit and \p Persistent are then ignored.
 template<unsigned int                    BlockSize,
          unsigned int                    ItemsPerThread,
          ::rocprim::block_load_method    BlockLoadMethod,
          ::rocprim::block_store_method   BlockStoreMethod,
          ::rocprim::block_scan_algorithm BlockScanMethod,
-         unsigned int                    SizeLimit = ROCPRIM_GRID_SIZE_LIMIT>
+         unsigned int                    SizeLimit       = ROCPRIM_GRID_SIZE_LIMIT,
+         bool                            Persistent      = false,
+         class                           LookbackBackoff = lookback_backoff_config<>,
+         bool                            TwoPass         = false>
 struct scan_by_key_config : ::rocprim::detail::scan_by_key_config_params
 {
     /// \brief Identifies the algorithm associated to the config.
@@ -399,13 +483,20 @@ struct scan_by_key_config : ::rocprim::detail::scan_by_key_config_params
     static constexpr ::rocprim::block_scan_algorithm block_scan_method = BlockScanMethod;
     /// \brief Limit on the number of items for a single scan kernel launch.
     static constexpr unsigned int size_limit = SizeLimit;
+    /// \brief Whether a persistent grid processes all tiles.
+    static constexpr bool persistent = Persistent;
+    /// \brief Whether the tiles are reduced before they are scanned.
+    static constexpr bool two_pass = TwoPass;
 
     constexpr scan_by_key_config()
         : ::rocprim::detail::scan_by_key_config_params{
             {BlockSize, ItemsPerThread, SizeLimit},
             BlockLoadMethod,
             BlockStoreMethod,
-            BlockScanMethod
+            BlockScanMethod,
+            Persistent,
+            LookbackBackoff(),
+            TwoPass
     } {};
 #endif
 };
@@ -476,6 +567,9 @@ struct segmented_radix_sort_config_params
     bool enable_unpartitioned_warp_sort = true;
     /// \brief Warp sort config params
     warp_sort_config_params warp_sort_config{};
+    /// \brief When partitioning happens, segments with at least this many items are sorted by the
+    /// device-wide onesweep radix sort instead of by a single block. \p 0 disables this path.
+    unsigned int onesweep_segment_threshold = 0;
 };
 
 } // namespace detail
@@ -566,16 +660,25 @@ struct DisabledWarpSortConfig
 /// If a segment's element count is low ( <= warp_sort_config::items_per_thread * warp_sort_config::logical_warp_size ),
 /// it is sorted by a special warp-level sorting method.
 ///
+/// If partitioning happens and a segment's element count is at least `OnesweepSegmentThreshold`,
+/// it is sorted by the device-wide onesweep radix sort, so that a few huge segments are not
+/// each left to a single block while the rest of the device is idle.
+///
 /// \tparam LongRadixBits - number of bits in long iterations.
 /// \tparam ShortRadixBits - number of bits in short iterations, must be equal to or less than `LongRadixBits`.
 /// Deprecated and no longer used.
 /// \tparam SortConfig - configuration of radix sort kernel. Must be `kernel_config`.
 /// \tparam WarpSortConfig - configuration of the warp sort that is used on the short segments.
+/// \tparam EnableUnpartitionedWarpSort - If set to \p true, warp sort can be used to sort
+/// the small segments, even if no partitioning happens.
+/// \tparam OnesweepSegmentThreshold - minimal number of items in a segment for it to be sorted by the
+/// device-wide onesweep radix sort. Only used when partitioning happens. \p 0 disables it.
 template<unsigned int LongRadixBits,
          unsigned int ShortRadixBits,
          class SortConfig,
-         class WarpSortConfig             = DisabledWarpSortConfig,
-         bool EnableUnpartitionedWarpSort = true>
+         class WarpSortConfig                     = DisabledWarpSortConfig,
+         bool         EnableUnpartitionedWarpSort = true,
+         unsigned int OnesweepSegmentThreshold    = (1u << 22)>
 struct segmented_radix_sort_config : public detail::segmented_radix_sort_config_params
 {
     /// \brief Identifies the algorithm associated to the config.
@@ -598,6 +701,9 @@ struct segmented_radix_sort_config : public detail::segmented_radix_sort_config_
     /// \brief If set to \p true, warp sort can be used to sort the small segments, even if no partitioning happens.
     static constexpr bool enable_unpartitioned_warp_sort = EnableUnpartitionedWarpSort;
 
+    /// \brief Minimal number of items in a segment for it to be sorted by the device-wide onesweep radix sort.
+    static constexpr unsigned int onesweep_segment_threshold = OnesweepSegmentThreshold;
+
     /// \brief Limit on the number of items for a single kernel launch.
     static constexpr unsigned int size_limit = SortConfig::size_limit;
 
@@ -616,7 +722,8 @@ struct segmented_radix_sort_config : public detail::segmented_radix_sort_config_
               warp_sort_config::partitioning_threshold,
               warp_sort_config::logical_warp_size_medium,
               warp_sort_config::items_per_thread_medium,
-              warp_sort_config::block_size_medium}
+              warp_sort_config::block_size_medium},
+            OnesweepSegmentThreshold
     }
     {}
 #endif
@@ -647,9 +754,12 @@ struct default_segmented_radix_sort_config_base
 /// \tparam BlockSize Number of threads in a block.
 /// \tparam ItemsPerThread Number of items processed by each thread.
 /// \tparam SizeLimit Limit on the number of items for a single kernel launch.
+/// \tparam PrefetchTiles Number of tiles each block loads ahead of the tile it transforms,
+/// see \p kernel_config. 0 disables the prefetch pipeline.
 template<unsigned int BlockSize,
          unsigned int ItemsPerThread,
-         unsigned int SizeLimit = ROCPRIM_GRID_SIZE_LIMIT>
+         unsigned int SizeLimit     = ROCPRIM_GRID_SIZE_LIMIT,
+         unsigned int PrefetchTiles = 0>
 struct transform_config : public detail::transform_config_params
 {
     /// \brief Identifies the algorithm associated to the config.
@@ -665,9 +775,12 @@ struct transform_config : public detail::transform_config_params
     /// \brief Limit on the number of items for a single kernel launch.
     static constexpr unsigned int size_limit = SizeLimit;
 
+    /// \brief Number of tiles each block loads ahead of the tile it transforms.
+    static constexpr unsigned int prefetch_tiles = PrefetchTiles;
+
     constexpr transform_config()
         : detail::transform_config_params{
-            {BlockSize, ItemsPerThread, SizeLimit}
+            {BlockSize, ItemsPerThread, SizeLimit, PrefetchTiles}
     }
     {}
 #endif
@@ -756,6 +869,7 @@ struct histogram_config_params
     unsigned int max_grid_size          = 0;
     unsigned int shared_impl_max_bins   = 0;
     unsigned int shared_impl_histograms = 0;
+    unsigned int tiled_impl_tile_bins   = 0;
 };
 
 } // namespace detail
@@ -769,24 +883,36 @@ struct histogram_config_params
 /// when exceeded the global memory implementation is used (samples -> global memory bins).
 /// \tparam SharedImplHistograms - number of histograms in the shared memory to reduce bank conflicts
 /// for atomic operations with narrow sample distributions. Sweetspot for 9xx and 10xx is 3.
+/// \tparam TiledImplTileBins - number of bins of a tile of the tiled implementation, which is used
+/// instead of the global memory implementation when there are at least as many samples as bins
+/// (samples -> samples partitioned by tile -> shared memory bins of a tile -> global memory bins).
+/// Must be a power of two, or 0 to disable the tiled implementation.
 template<class HistogramConfig,
          unsigned int MaxGridSize          = 1024,
          unsigned int SharedImplMaxBins    = 2048,
-         unsigned int SharedImplHistograms = 3>
+         unsigned int SharedImplHistograms = 3,
+         unsigned int TiledImplTileBins    = 8192>
 struct histogram_config : detail::histogram_config_params
 {
     /// \brief Identifies the algorithm associated to the config.
     using tag = detail::histogram_config_tag;
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    static_assert(TiledImplTileBins == 0 || detail::is_power_of_two(TiledImplTileBins),
+                  "TiledImplTileBins must be 0 or a power of two");
+
     using histogram = HistogramConfig;
 
     static constexpr unsigned int max_grid_size          = MaxGridSize;
     static constexpr unsigned int shared_impl_max_bins   = SharedImplMaxBins;
     static constexpr unsigned int shared_impl_histograms = SharedImplHistograms;
+    static constexpr unsigned int tiled_impl_tile_bins   = TiledImplTileBins;
 
     constexpr histogram_config()
-        : detail::histogram_config_params{
-            HistogramConfig{}, MaxGridSize, SharedImplMaxBins, SharedImplHistograms} {};
+        : detail::histogram_config_params{HistogramConfig{},
+                                          MaxGridSize,
+                                          SharedImplMaxBins,
+                                          SharedImplHistograms,
+                                          TiledImplTileBins} {};
 #endif
 };
 
@@ -868,11 +994,13 @@ namespace detail
 
 struct partition_config_params
 {
-    kernel_config_params kernel_config;
-    block_load_method    key_block_load_method;
-    block_load_method    value_block_load_method;
-    block_load_method    flag_block_load_method;
-    block_scan_algorithm block_scan_method;
+    kernel_config_params    kernel_config;
+    block_load_method       key_block_load_method;
+    block_load_method       value_block_load_method;
+    block_load_method       flag_block_load_method;
+    block_scan_algorithm    block_scan_method;
+    lookback_backoff_params backoff;
+    bool                    two_pass;
 };
 
 } // namespace detail
@@ -886,6 +1014,10 @@ struct partition_config_params
 /// \tparam FlagBlockLoadMethod - method for loading flag values.
 /// \tparam BlockScanMethod - algorithm for block scan.
 /// \tparam SizeLimit - limit on the number of items for a single select kernel launch.
+/// \tparam LookbackBackoff - backoff of the look-back, see \p lookback_backoff_config.
+/// \tparam TwoPass - if true, the selected items of the tiles are counted, the counts are scanned
+/// and then the tiles are scattered, instead of the single pass with look-back. No block waits on
+/// another one. \p SizeLimit is then ignored.
 template<unsigned int                 BlockSize,
          unsigned int                 ItemsPerThread,
          ::rocprim::block_load_method KeyBlockLoadMethod
@@ -896,7 +1028,9 @@ template<unsigned int                 BlockSize,
          = ::rocprim::block_load_method::block_load_transpose,
          ::rocprim::block_scan_algorithm BlockScanMethod
          = ::rocprim::block_scan_algorithm::using_warp_scan,
-         unsigned int SizeLimit = ROCPRIM_GRID_SIZE_LIMIT>
+         unsigned int SizeLimit       = ROCPRIM_GRID_SIZE_LIMIT,
+         class        LookbackBackoff = lookback_backoff_config<>,
+         bool         TwoPass         = false>
 struct select_config : public detail::partition_config_params
 {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -914,6 +1048,8 @@ struct select_config : public detail::partition_config_params
     static constexpr block_scan_algorithm block_scan_method = BlockScanMethod;
     /// \brief Limit on the number of items for a single select kernel launch.
     static constexpr unsigned int size_limit = SizeLimit;
+    /// \brief Whether the selected items are counted before they are scattered.
+    static constexpr bool two_pass = TwoPass;
 
     constexpr select_config()
         : detail::partition_config_params{
@@ -921,7 +1057,9 @@ struct select_config : public detail::partition_config_params
             KeyBlockLoadMethod,
             ValueBlockLoadMethod,
             FlagBlockLoadMethod,
-            BlockScanMethod
+            BlockScanMethod,
+            LookbackBackoff(),
+            TwoPass
     } {};
 #endif
 };
@@ -953,11 +1091,13 @@ struct default_partition_config_base
 
 struct reduce_by_key_config_params
 {
-    kernel_config_params kernel_config;
-    unsigned int         tiles_per_block;
-    block_load_method    load_keys_method;
-    block_load_method    load_values_method;
-    block_scan_algorithm scan_algorithm;
+    kernel_config_params    kernel_config;
+    unsigned int            tiles_per_block;
+    block_load_method       load_keys_method;
+    block_load_method       load_values_method;
+    block_scan_algorithm    scan_algorithm;
+    bool                    long_runs;
+    lookback_backoff_params backoff;
 };
 
 } // namespace detail
@@ -972,6 +1112,11 @@ struct reduce_by_key_config_params
  * \tparam ScanAlgorithm block level scan algorithm to use
  * \tparam TilesPerBlock number of tiles (`BlockSize` * `ItemsPerThread` items) to process per block
  * \tparam SizeLimit limit on the number of items for a single reduce_by_key kernel launch.
+ * \tparam LongRuns if true, the input is split into a fixed number of large chunks that are
+ * reduced without a look-back, and the segments that cross chunks are merged afterwards. This
+ * is faster for inputs with few unique keys (long runs of equal keys), and slower for inputs with
+ * many. \p TilesPerBlock and \p SizeLimit are then ignored.
+ * \tparam LookbackBackoff backoff of the look-back, see \p lookback_backoff_config.
  */
 template<unsigned int         BlockSize,
          unsigned int         ItemsPerThread,
@@ -979,7 +1124,9 @@ template<unsigned int         BlockSize,
          block_load_method    LoadValuesMethod = block_load_method::block_load_transpose,
          block_scan_algorithm ScanAlgorithm    = block_scan_algorithm::using_warp_scan,
          unsigned int         TilesPerBlock    = 1,
-         unsigned int         SizeLimit        = ROCPRIM_GRID_SIZE_LIMIT>
+         unsigned int         SizeLimit        = ROCPRIM_GRID_SIZE_LIMIT,
+         bool                 LongRuns         = false,
+         class                LookbackBackoff  = lookback_backoff_config<>>
 struct reduce_by_key_config : public detail::reduce_by_key_config_params
 {
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -1000,6 +1147,8 @@ struct reduce_by_key_config : public detail::reduce_by_key_config_params
     static constexpr block_scan_algorithm scan_algorithm = ScanAlgorithm;
     /// Maximum possible number of values. Defaults to ROCPRIM_GRID_SIZE_LIMIT.
     static constexpr unsigned int size_limit = SizeLimit;
+    /// Whether the input is reduced in large chunks without a look-back.
+    static constexpr bool long_runs = LongRuns;
 
     constexpr reduce_by_key_config()
         : detail::reduce_by_key_config_params{
@@ -1007,7 +1156,9 @@ struct reduce_by_key_config : public detail::reduce_by_key_config_params
             TilesPerBlock,
             LoadKeysMethod,
             LoadValuesMethod,
-            ScanAlgorithm
+            ScanAlgorithm,
+            LongRuns,
+            LookbackBackoff()
     } {};
 #endif
 };
@@ -1251,6 +1402,261 @@ struct merge_config : public detail::merge_config_params
 namespace detail
 {
 
+struct topk_config_params
+{
+    kernel_config_params kernel_config;
+    unsigned int         radix_bits;
+};
+
+} // namespace detail
+
+/// \brief Configuration of device-level top-k selection.
+///
+/// \tparam BlockSize number of threads in a block.
+/// \tparam ItemsPerThread number of items processed by each thread.
+/// \tparam RadixBits number of key bits that are resolved by each digit pass. The block size
+///   must be at least <tt>1 << RadixBits</tt>.
+template<unsigned int BlockSize, unsigned int ItemsPerThread, unsigned int RadixBits = 8>
+struct topk_config : public detail::topk_config_params
+{
+#ifndef DOXYGEN_DOCUMENTATION_BUILD
+    static_assert(RadixBits > 0 && RadixBits <= 8, "RadixBits must be in the range [1, 8]");
+    static_assert(BlockSize >= (1u << RadixBits),
+                  "BlockSize must be at least the number of radix digits");
+
+    constexpr topk_config()
+        : detail::topk_config_params{
+            {BlockSize, ItemsPerThread, ROCPRIM_GRID_SIZE_LIMIT},
+            RadixBits
+    }
+    {}
+#endif
+};
+
+namespace detail
+{
+
+struct segmented_merge_sort_config_params
+{
+    kernel_config_params    kernel_config;
+    warp_sort_config_params warp_sort_config;
+};
+
+} // namespace detail
+
+/// \brief Configuration of device-level segmented merge sort.
+///
+/// Segments larger than the items of a medium warp are sorted by one block each, the tiles of
+/// the segment are sorted by a block merge sort and then merged pairwise in global memory.
+/// When partitioning happens, the small and medium segments are sorted by logical warps.
+///
+/// \tparam BlockSize number of threads in a block, must be a power of two.
+/// \tparam ItemsPerThread number of items processed by each thread, must be a power of two.
+/// \tparam WarpSortConfig configuration of the warp sort of the small and medium segments,
+///   must be \p WarpSortConfig or \p DisabledWarpSortConfig. The items per thread of both warp
+///   sorts must be at most 16.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class WarpSortConfig = WarpSortConfig<8, 4, 256, 3000, 32, 8, 256>>
+struct segmented_merge_sort_config : public detail::segmented_merge_sort_config_params
+{
+#ifndef DOXYGEN_DOCUMENTATION_BUILD
+    static_assert(detail::is_power_of_two(BlockSize) && detail::is_power_of_two(ItemsPerThread),
+                  "The block size and items per thread of segmented merge sort must be powers "
+                  "of two");
+    static_assert(WarpSortConfig::items_per_thread_small <= 16
+                      && WarpSortConfig::items_per_thread_medium <= 16,
+                  "The warp sort of segmented merge sort supports at most 16 items per thread");
+
+    constexpr segmented_merge_sort_config()
+        : detail::segmented_merge_sort_config_params{
+            {BlockSize, ItemsPerThread, ROCPRIM_GRID_SIZE_LIMIT},
+            {WarpSortConfig::partitioning_allowed,
+              WarpSortConfig::logical_warp_size_small,
+              WarpSortConfig::items_per_thread_small,
+              WarpSortConfig::block_size_small,
+              WarpSortConfig::partitioning_threshold,
+              WarpSortConfig::logical_warp_size_medium,
+              WarpSortConfig::items_per_thread_medium,
+              WarpSortConfig::block_size_medium}
+    }
+    {}
+#endif
+};
+
+namespace detail
+{
+
+struct partition_n_config_params
+{
+    kernel_config_params kernel_config;
+};
+
+} // namespace detail
+
+/// \brief Configuration of device-level multi-way partition.
+///
+/// \tparam BlockSize number of threads in a block.
+/// \tparam ItemsPerThread number of items processed by each thread.
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+struct partition_n_config : public detail::partition_n_config_params
+{
+#ifndef DOXYGEN_DOCUMENTATION_BUILD
+    constexpr partition_n_config()
+        : detail::partition_n_config_params{
+            {BlockSize, ItemsPerThread, ROCPRIM_GRID_SIZE_LIMIT}
+    }
+    {}
+#endif
+};
+
+namespace detail
+{
+
+struct run_length_decode_config_params
+{
+    kernel_config_params kernel_config;
+};
+
+} // namespace detail
+
+/// \brief Configuration of device-level run-length decoding.
+///
+/// \tparam BlockSize number of threads in a block.
+/// \tparam ItemsPerThread number of runs and output items processed by each thread.
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+struct run_length_decode_config : public detail::run_length_decode_config_params
+{
+#ifndef DOXYGEN_DOCUMENTATION_BUILD
+    constexpr run_length_decode_config()
+        : detail::run_length_decode_config_params{
+            {BlockSize, ItemsPerThread, ROCPRIM_GRID_SIZE_LIMIT}
+    }
+    {}
+#endif
+};
+
+namespace detail
+{
+
+struct multi_search_config_params
+{
+    kernel_config_params kernel_config;
+};
+
+} // namespace detail
+
+/// \brief Configuration of device-level multi-pattern search.
+///
+/// \tparam BlockSize number of threads in a block.
+/// \tparam ItemsPerThread number of input items processed by each thread. Every thread also
+///   reads up to the maximum pattern length minus one items before its items, so larger values
+///   make this overlap cheaper.
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+struct multi_search_config : public detail::multi_search_config_params
+{
+#ifndef DOXYGEN_DOCUMENTATION_BUILD
+    constexpr multi_search_config()
+        : detail::multi_search_config_params{
+            {BlockSize, ItemsPerThread, ROCPRIM_GRID_SIZE_LIMIT}
+    }
+    {}
+#endif
+};
+
+/// \brief Probe sequences of the device-level hash tables.
+enum class hash_probe_scheme
+{
+    /// \brief Consecutive slots are probed. This has the best locality, but long runs of occupied
+    /// slots form at high load factors.
+    linear,
+    /// \brief The distance between the probed slots grows by one slot after every probe.
+    quadratic,
+    /// \brief The distance between the probed slots is given by a second hash of the key.
+    double_hashing,
+    /// \brief The default probe scheme.
+    default_scheme = linear,
+};
+
+namespace detail
+{
+
+struct hash_table_config_params
+{
+    kernel_config_params kernel_config;
+    hash_probe_scheme    probe_scheme;
+    unsigned int         shared_slots;
+};
+
+} // namespace detail
+
+/// \brief Configuration of the device-level hash tables (\p hash_reduce_by_key, \p distinct,
+/// \p distinct_count, \p hyperloglog_sketch, \p hash_join_build and \p hash_join_probe).
+///
+/// \tparam BlockSize number of threads in a block.
+/// \tparam ItemsPerThread number of items processed by each thread.
+/// \tparam ProbeScheme the sequence of slots that is probed for a key.
+/// \tparam SharedSlots number of slots of the table in shared memory that every block uses to
+///   pre-aggregate its keys in \p hash_reduce_by_key, or to filter out the duplicates of its keys
+///   in \p distinct. Must be a power of two, or 0 to insert the keys directly into the table in
+///   global memory.
+template<unsigned int      BlockSize,
+         unsigned int      ItemsPerThread,
+         hash_probe_scheme ProbeScheme = hash_probe_scheme::default_scheme,
+         unsigned int      SharedSlots = 1024>
+struct hash_table_config : public detail::hash_table_config_params
+{
+#ifndef DOXYGEN_DOCUMENTATION_BUILD
+    static_assert(SharedSlots == 0 || detail::is_power_of_two(SharedSlots),
+                  "SharedSlots must be 0 or a power of two");
+
+    constexpr hash_table_config()
+        : detail::hash_table_config_params{
+            {BlockSize, ItemsPerThread, ROCPRIM_GRID_SIZE_LIMIT},
+            ProbeScheme,
+            SharedSlots
+    }
+    {}
+#endif
+};
+
+namespace detail
+{
+
+struct transpose_config_params
+{
+    kernel_config_params kernel_config;
+    unsigned int         tile_size;
+};
+
+} // namespace detail
+
+/// \brief Configuration of the device-level transposes (\p transpose, \p batched_transpose,
+/// \p aos_to_soa and \p soa_to_aos).
+///
+/// \tparam TileSize number of rows and columns of the square tiles that are staged in shared
+///   memory. Must be a power of two.
+/// \tparam BlockRows number of rows of a tile that a block loads and stores at once, a block
+///   has <tt>TileSize * BlockRows</tt> threads. Must divide \p TileSize.
+template<unsigned int TileSize, unsigned int BlockRows>
+struct transpose_config : public detail::transpose_config_params
+{
+#ifndef DOXYGEN_DOCUMENTATION_BUILD
+    static_assert(detail::is_power_of_two(TileSize), "TileSize must be a power of two");
+    static_assert(TileSize % BlockRows == 0, "BlockRows must divide TileSize");
+
+    constexpr transpose_config()
+        : detail::transpose_config_params{
+            {TileSize * BlockRows, TileSize / BlockRows, ROCPRIM_GRID_SIZE_LIMIT},
+            TileSize
+    }
+    {}
+#endif
+};
+
+namespace detail
+{
+
 template<class Key, class Value>
 struct default_merge_config_base
 {
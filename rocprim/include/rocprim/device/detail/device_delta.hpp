@@ -0,0 +1,263 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_DELTA_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_DELTA_HPP_
+
+#include "../../block/block_adjacent_difference.hpp"
+#include "../../block/block_load.hpp"
+#include "../../block/block_store.hpp"
+
+#include "../../detail/various.hpp"
+
+#include "../../config.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics/thread.hpp"
+#include "../../type_traits.hpp"
+#include "device_config_helper.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <iterator>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Subtracts the previous item from each item of a tile, the first item of the sequence is kept.
+// `tile_predecessor` is only used when `has_predecessor` is set.
+template<typename AdjacentDifference, typename T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void delta_subtract_left(const T (&input)[ItemsPerThread],
+                         T (&output)[ItemsPerThread],
+                         const bool                                 has_predecessor,
+                         const T                                    tile_predecessor,
+                         const bool                                 is_full_tile,
+                         const unsigned int                         valid_items,
+                         typename AdjacentDifference::storage_type& storage)
+{
+    const ::rocprim::minus<T> op{};
+    if(has_predecessor)
+    {
+        if(is_full_tile)
+        {
+            AdjacentDifference{}.subtract_left(input, output, op, tile_predecessor, storage);
+        }
+        else
+        {
+            AdjacentDifference{}.subtract_left_partial(input,
+                                                       output,
+                                                       op,
+                                                       tile_predecessor,
+                                                       valid_items,
+                                                       storage);
+        }
+    }
+    else
+    {
+        if(is_full_tile)
+        {
+            AdjacentDifference{}.subtract_left(input, output, op, storage);
+        }
+        else
+        {
+            AdjacentDifference{}.subtract_left_partial(input, output, op, valid_items, storage);
+        }
+    }
+}
+
+// Encodes a tile in a single pass: the differences of `Order` levels are computed on the loaded
+// items and the epilogue is applied to them before storing. The items before the tile, which are
+// needed by the differences at the tile boundary, are read from the input, so the input and the
+// output must not overlap.
+template<typename Config,
+         unsigned int Order,
+         typename InputIt,
+         typename OutputIt,
+         typename UnaryFunction>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void delta_encode_kernel_impl(const InputIt       input,
+                              const OutputIt      output,
+                              const std::size_t   size,
+                              const UnaryFunction epilogue,
+                              const std::size_t   starting_block)
+{
+    static_assert(Order == 1 || Order == 2, "Only delta and delta-of-delta are supported");
+
+    using value_type  = typename std::iterator_traits<InputIt>::value_type;
+    using output_type = ::rocprim::invoke_result_t<UnaryFunction, value_type>;
+
+    static constexpr adjacent_difference_config_params params = device_params<Config>();
+
+    static constexpr unsigned int block_size = params.adjacent_difference_kernel_config.block_size;
+    static constexpr unsigned int items_per_thread
+        = params.adjacent_difference_kernel_config.items_per_thread;
+    static constexpr unsigned int items_per_block = block_size * items_per_thread;
+
+    using block_load_type
+        = ::rocprim::block_load<value_type, block_size, items_per_thread, params.block_load_method>;
+    using block_store_type = ::rocprim::
+        block_store<output_type, block_size, items_per_thread, params.block_store_method>;
+    using adjacent_difference_type = ::rocprim::block_adjacent_difference<value_type, block_size>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_load_type::storage_type          load;
+        typename adjacent_difference_type::storage_type adjacent_difference;
+        typename block_store_type::storage_type         store;
+    } storage;
+
+    const unsigned int block_id     = blockIdx.x;
+    const unsigned int block_offset = block_id * items_per_block;
+
+    const std::size_t  num_blocks   = ceiling_div(size, items_per_block);
+    const std::size_t  tile_id      = starting_block + block_id;
+    const std::size_t  tile_offset  = tile_id * items_per_block;
+    const bool         is_full_tile = tile_id != num_blocks - 1;
+    const unsigned int valid_items
+        = is_full_tile ? items_per_block : static_cast<unsigned int>(size - tile_offset);
+
+    const InputIt block_input = input + block_offset;
+
+    value_type thread_input[items_per_thread];
+    if(is_full_tile)
+    {
+        block_load_type{}.load(block_input, thread_input, storage.load);
+    }
+    else
+    {
+        block_load_type{}.load(block_input, thread_input, valid_items, storage.load);
+    }
+    ::rocprim::syncthreads();
+
+    // The first items of the sequence are the initial values of the differences, so the result
+    // does not depend on where the tiles start.
+    const bool       has_predecessor  = tile_offset != 0;
+    const value_type tile_predecessor = has_predecessor ? block_input[-1] : value_type{};
+
+    value_type deltas[items_per_thread];
+    delta_subtract_left<adjacent_difference_type>(thread_input,
+                                                  deltas,
+                                                  has_predecessor,
+                                                  tile_predecessor,
+                                                  is_full_tile,
+                                                  valid_items,
+                                                  storage.adjacent_difference);
+
+    if ROCPRIM_IF_CONSTEXPR(Order == 2)
+    {
+        // The first level delta before the tile, it is the first item itself at the start of the
+        // sequence
+        const value_type delta_predecessor
+            = tile_offset >= 2 ? ::rocprim::minus<value_type>{}(tile_predecessor, block_input[-2])
+                               : tile_predecessor;
+
+        value_type first_deltas[items_per_thread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; ++i)
+        {
+            first_deltas[i] = deltas[i];
+        }
+        ::rocprim::syncthreads();
+        delta_subtract_left<adjacent_difference_type>(first_deltas,
+                                                      deltas,
+                                                      has_predecessor,
+                                                      delta_predecessor,
+                                                      is_full_tile,
+                                                      valid_items,
+                                                      storage.adjacent_difference);
+    }
+    ::rocprim::syncthreads();
+
+    output_type thread_output[items_per_thread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        thread_output[i] = epilogue(deltas[i]);
+    }
+
+    if(is_full_tile)
+    {
+        block_store_type{}.store(output + block_offset, thread_output, storage.store);
+    }
+    else
+    {
+        block_store_type{}.store(output + block_offset, thread_output, valid_items, storage.store);
+    }
+}
+
+// The prefix state of the two level (delta-of-delta) decode: `first` is the inclusive scan of
+// the input, which are the first level deltas, and `second` is the inclusive scan of `first`,
+// which are the decoded values.
+template<typename T>
+struct delta_of_delta_state
+{
+    std::size_t count;
+    T           first;
+    T           second;
+};
+
+// Combines the states of two consecutive ranges, the scan of `first` in `b` is offset by the
+// `first` of `a` for each of its items.
+template<typename T>
+struct delta_of_delta_scan_op
+{
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    delta_of_delta_state<T> operator()(const delta_of_delta_state<T>& a,
+                                       const delta_of_delta_state<T>& b) const
+    {
+        return {a.count + b.count,
+                static_cast<T>(a.first + b.first),
+                static_cast<T>(a.second + static_cast<T>(b.count) * a.first + b.second)};
+    }
+};
+
+// Makes the state of a single item after applying the prologue to it
+template<typename T, typename UnaryFunction>
+struct delta_of_delta_state_op
+{
+    UnaryFunction prologue;
+
+    template<typename Value>
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    delta_of_delta_state<T> operator()(const Value& value) const
+    {
+        const T delta = prologue(value);
+        return {1, delta, delta};
+    }
+};
+
+template<typename T>
+struct delta_of_delta_value_op
+{
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    T operator()(const delta_of_delta_state<T>& state) const
+    {
+        return state.second;
+    }
+};
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_DELTA_HPP_
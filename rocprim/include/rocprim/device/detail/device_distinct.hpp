@@ -0,0 +1,310 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_DISTINCT_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_DISTINCT_HPP_
+
+#include "../../block/block_reduce.hpp"
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+
+#include "device_config_helper.hpp"
+#include "device_hash_table.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include <cmath>
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The registers of a HyperLogLog sketch in shared memory, larger sketches are updated in global
+// memory directly.
+constexpr unsigned int hyperloglog_max_shared_precision = 12;
+
+constexpr unsigned int hyperloglog_min_precision = 4;
+constexpr unsigned int hyperloglog_max_precision = 18;
+
+// Inserts the keys into the table, and writes every key that is inserted for the first time to
+// `output`. Keys that are already in the table of the block in shared memory are duplicates, so
+// the table in global memory is only probed for the first occurrence of a key in the block.
+template<class Config, class InputIterator, class Bits, class OutputIterator>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    distinct_insert_kernel(InputIterator  input,
+                           const size_t   size,
+                           Bits*          slots,
+                           const size_t   mask,
+                           const Bits     empty_bits,
+                           OutputIterator output,
+                           size_t*        unique_count)
+{
+    constexpr hash_table_config_params params           = device_params<Config>();
+    constexpr unsigned int             block_size       = params.kernel_config.block_size;
+    constexpr unsigned int             items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int             items_per_block  = block_size * items_per_thread;
+    constexpr hash_probe_scheme        scheme           = params.probe_scheme;
+    constexpr unsigned int             shared_slots     = params.shared_slots;
+    constexpr bool                     pre_filter       = shared_slots != 0;
+    // Once the shared table is mostly occupied, keys that are not in it at this point are
+    // inserted into the global table instead of probing the whole shared table.
+    constexpr size_t shared_max_probes = 16;
+
+    using key_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    ROCPRIM_SHARED_MEMORY Bits shared_table[pre_filter ? shared_slots : 1];
+
+    const unsigned int flat_id = block_thread_id<0>();
+
+    if ROCPRIM_IF_CONSTEXPR(pre_filter)
+    {
+        for(unsigned int i = flat_id; i < shared_slots; i += block_size)
+        {
+            shared_table[i] = empty_bits;
+        }
+        syncthreads();
+    }
+
+    const size_t       block_offset = static_cast<size_t>(block_id<0>()) * items_per_block;
+    const unsigned int valid_count
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const unsigned int pos = i * block_size + flat_id;
+        if(pos >= valid_count)
+        {
+            continue;
+        }
+        const key_type key  = input[block_offset + pos];
+        const Bits     bits = bit_cast<Bits>(key);
+
+        bool inserted;
+        if ROCPRIM_IF_CONSTEXPR(pre_filter)
+        {
+            const size_t slot = hash_table_insert<scheme>(shared_table,
+                                                          shared_slots - 1,
+                                                          bits,
+                                                          empty_bits,
+                                                          shared_max_probes,
+                                                          inserted);
+            if(slot < shared_slots && !inserted)
+            {
+                continue;
+            }
+        }
+
+        hash_table_insert<scheme>(slots, mask, bits, empty_bits, mask + 1, inserted);
+        if(inserted)
+        {
+            output[warp_aggregated_atomic_add(unique_count, size_t(1))] = key;
+        }
+    }
+}
+
+// Flags the first occurrence of every key, the table holds the smallest index of every key.
+template<class Config, class InputIterator, class Bits>
+struct distinct_first_occurrence_op
+{
+    InputIterator input;
+    const Bits*   slots;
+    const size_t* first_indices;
+    size_t        mask;
+    Bits          empty_bits;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE bool operator()(const size_t index) const
+    {
+        constexpr hash_probe_scheme scheme = device_params<Config>().probe_scheme;
+
+        using key_type = typename std::iterator_traits<InputIterator>::value_type;
+
+        const Bits   bits = bit_cast<Bits>(static_cast<key_type>(input[index]));
+        const size_t slot = hash_table_find<scheme>(slots, mask, bits, empty_bits);
+        return slot <= mask && first_indices[slot] == index;
+    }
+};
+
+// The register of a key is selected by the high bits of its 64-bit hash, and its rank is the
+// position of the first set bit in the remaining bits.
+template<class Key>
+ROCPRIM_DEVICE ROCPRIM_INLINE void hyperloglog_hash(const Key&         key,
+                                                    const unsigned int precision,
+                                                    unsigned int&      register_index,
+                                                    unsigned int&      rank)
+{
+    const unsigned long long hash = hash_table_mix(
+        static_cast<unsigned long long>(bit_cast<hash_table_bits_type<Key>>(key)));
+
+    register_index = static_cast<unsigned int>(hash >> (64 - precision));
+    // The guard bit limits the rank to 64 - precision + 1
+    rank = __clzll((hash << precision) | (1ull << (precision - 1))) + 1;
+}
+
+// Returns the largest rank of the lanes in `group`, bit by bit from the top with one ballot per
+// bit. Every lane of the warp must call it. The ranks are less than 64.
+ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int hyperloglog_group_max(const unsigned int   rank,
+                                                                 const lane_mask_type group)
+{
+    unsigned int group_max = 0;
+    ROCPRIM_UNROLL
+    for(int bit = 5; bit >= 0; --bit)
+    {
+        const unsigned int candidate = group_max | (1u << bit);
+        if((::rocprim::ballot(group != 0 && rank >= candidate) & group) != 0)
+        {
+            group_max = candidate;
+        }
+    }
+    return group_max;
+}
+
+// Updates `registers` with the maximum rank of the keys of every register. The lanes of a warp
+// that update the same register are combined first, so a register is updated once per warp.
+// With `SharedRegisters`, every block updates its registers in shared memory and then merges
+// them into `registers`.
+template<class Config, bool SharedRegisters, class InputIterator>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    hyperloglog_sketch_kernel(InputIterator      input,
+                              const size_t       size,
+                              unsigned int*      registers,
+                              const unsigned int precision)
+{
+    constexpr hash_table_config_params params           = device_params<Config>();
+    constexpr unsigned int             block_size       = params.kernel_config.block_size;
+    constexpr unsigned int             items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int             items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int             shared_registers
+        = SharedRegisters ? 1u << hyperloglog_max_shared_precision : 1;
+
+    using key_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    ROCPRIM_SHARED_MEMORY unsigned int block_registers[shared_registers];
+
+    const unsigned int flat_id        = block_thread_id<0>();
+    const unsigned int register_count = 1u << precision;
+
+    unsigned int* target = registers;
+    if ROCPRIM_IF_CONSTEXPR(SharedRegisters)
+    {
+        for(unsigned int i = flat_id; i < register_count; i += block_size)
+        {
+            block_registers[i] = 0;
+        }
+        syncthreads();
+        target = block_registers;
+    }
+
+    const size_t block_offset = static_cast<size_t>(block_id<0>()) * items_per_block;
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const size_t index = block_offset + i * block_size + flat_id;
+        const bool   valid = index < size;
+
+        unsigned int register_index = 0;
+        unsigned int rank           = 0;
+        if(valid)
+        {
+            hyperloglog_hash(static_cast<key_type>(input[index]), precision, register_index, rank);
+        }
+
+        const lane_mask_type group     = ::rocprim::match_any(register_index, precision, valid);
+        const unsigned int   group_max = hyperloglog_group_max(rank, group);
+        if(::rocprim::group_elect(group))
+        {
+            atomic_max(&target[register_index], group_max);
+        }
+    }
+
+    if ROCPRIM_IF_CONSTEXPR(SharedRegisters)
+    {
+        syncthreads();
+        for(unsigned int i = flat_id; i < register_count; i += block_size)
+        {
+            const unsigned int rank = block_registers[i];
+            if(rank != 0)
+            {
+                atomic_max(&registers[i], rank);
+            }
+        }
+    }
+}
+
+// Estimates the number of distinct keys from the harmonic mean of the registers, with linear
+// counting for small cardinalities.
+template<unsigned int BlockSize, class OutputIterator>
+ROCPRIM_KERNEL __launch_bounds__(BlockSize) void hyperloglog_estimate_kernel(
+    const unsigned int* registers, const unsigned int precision, OutputIterator estimate_output)
+{
+    using block_reduce_sum   = ::rocprim::block_reduce<double, BlockSize>;
+    using block_reduce_count = ::rocprim::block_reduce<unsigned int, BlockSize>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_reduce_sum::storage_type   sum;
+        typename block_reduce_count::storage_type count;
+    } storage;
+
+    const unsigned int flat_id        = block_thread_id<0>();
+    const unsigned int register_count = 1u << precision;
+
+    double       sum   = 0.0;
+    unsigned int zeros = 0;
+    for(unsigned int i = flat_id; i < register_count; i += BlockSize)
+    {
+        const unsigned int rank = registers[i];
+        sum += 1.0 / static_cast<double>(1ull << rank);
+        zeros += rank == 0 ? 1 : 0;
+    }
+
+    block_reduce_sum().reduce(sum, sum, storage.sum);
+    syncthreads();
+    block_reduce_count().reduce(zeros, zeros, storage.count);
+
+    if(flat_id == 0)
+    {
+        const double m     = static_cast<double>(register_count);
+        const double alpha = register_count == 16   ? 0.673
+                             : register_count == 32 ? 0.697
+                             : register_count == 64 ? 0.709
+                                                    : 0.7213 / (1.0 + 1.079 / m);
+
+        double estimate = alpha * m * m / sum;
+        if(estimate <= 2.5 * m && zeros != 0)
+        {
+            estimate = m * ::log(m / static_cast<double>(zeros));
+        }
+        *estimate_output = estimate;
+    }
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_DISTINCT_HPP_
@@ -0,0 +1,148 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_FOR_EACH_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_FOR_EACH_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../block/block_load_func.hpp"
+#include "../../intrinsics.hpp"
+#include "transform_load.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Calls the function for the items of a block in a striped arrangement, with the references of
+// the iterator, so the function can modify the items. Nothing is stored by the kernel.
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class InputIterator, class Function>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void for_each_kernel_impl(InputIterator input,
+                          const size_t  launch_offset,
+                          const size_t  size,
+                          Function      function)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const size_t       block_offset
+        = launch_offset + size_t(::rocprim::detail::block_id<0>()) * items_per_block;
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        const size_t index = block_offset + i * BlockSize + flat_id;
+        if(index < size)
+        {
+            function(input[index]);
+        }
+    }
+}
+
+// Functions of for_each_index are called with the indices of the items.
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class Function>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void for_each_index_kernel_impl(const size_t launch_offset, const size_t size, Function function)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const size_t       block_offset
+        = launch_offset + size_t(::rocprim::detail::block_id<0>()) * items_per_block;
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        const size_t index = block_offset + i * BlockSize + flat_id;
+        if(index < size)
+        {
+            function(index);
+        }
+    }
+}
+
+// Loads the items of a thread of a full tile in a blocked arrangement: raw pointers and
+// transform iterators over raw pointers with vector loads, other iterators item by item.
+template<class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void for_each_tile_load(const unsigned int flat_id, T* input, U (&items)[ItemsPerThread])
+{
+    block_load_direct_blocked_vectorized(flat_id, input, items);
+}
+
+template<class InputIterator, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void for_each_tile_load(const unsigned int flat_id,
+                        InputIterator      input,
+                        U (&items)[ItemsPerThread])
+{
+    if(!transform_load_blocked_vectorized(flat_id, input, items))
+    {
+        block_load_direct_blocked(flat_id, input, items);
+    }
+}
+
+// Every thread loads its items of the tile in a blocked arrangement and passes them to the
+// function, with the index of its first item and the number of its valid items. Threads
+// without valid items in the last tile do not call the function.
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class InputIterator, class Function>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void for_each_tile_kernel_impl(InputIterator input,
+                               const size_t  launch_offset,
+                               const size_t  size,
+                               Function      function)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const size_t       block_offset
+        = launch_offset + size_t(::rocprim::detail::block_id<0>()) * items_per_block;
+    const unsigned int valid_in_block
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+    const size_t thread_offset = block_offset + flat_id * ItemsPerThread;
+
+    value_type items[ItemsPerThread];
+    if(valid_in_block == items_per_block)
+    {
+        for_each_tile_load(flat_id, input + block_offset, items);
+        function(items, thread_offset, ItemsPerThread);
+    }
+    else if(flat_id * ItemsPerThread < valid_in_block)
+    {
+        block_load_direct_blocked(flat_id, input + block_offset, items, valid_in_block);
+        function(items,
+                 thread_offset,
+                 ::rocprim::min(valid_in_block - flat_id * ItemsPerThread, ItemsPerThread));
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_FOR_EACH_HPP_
@@ -0,0 +1,136 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_FUTURE_SIZE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_FUTURE_SIZE_HPP_
+
+#include "../../config.hpp"
+#include "../../iterator/counting_iterator.hpp"
+#include "../../iterator/transform_iterator.hpp"
+#include "../../types/future_value.hpp"
+
+#include <iterator>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The algorithms taking a future_value size run over an upper bound of the size, known on the
+// host. The items past the actual size, read on the device, are replaced by a padding value
+// that does not change the result for the items before the size.
+
+template<class InputIterator, class SizeType, class SizeIterator>
+struct future_size_input_op
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    InputIterator                        input;
+    future_value<SizeType, SizeIterator> size;
+    value_type                           padding;
+
+    ROCPRIM_HOST_DEVICE inline value_type operator()(const size_t index) const
+    {
+        return index < static_cast<size_t>(size) ? static_cast<value_type>(input[index])
+                                                 : padding;
+    }
+};
+
+template<class InputIterator, class SizeType, class SizeIterator>
+using future_size_input_iterator
+    = transform_iterator<counting_iterator<size_t>,
+                         future_size_input_op<InputIterator, SizeType, SizeIterator>,
+                         typename std::iterator_traits<InputIterator>::value_type>;
+
+// Returns an iterator over the input, which returns padding past the size
+template<class InputIterator, class SizeType, class SizeIterator>
+ROCPRIM_HOST_DEVICE inline future_size_input_iterator<InputIterator, SizeType, SizeIterator>
+    make_future_size_input(InputIterator                                                  input,
+                           future_value<SizeType, SizeIterator>                           size,
+                           typename std::iterator_traits<InputIterator>::value_type padding)
+{
+    return future_size_input_iterator<InputIterator, SizeType, SizeIterator>(
+        counting_iterator<size_t>(0),
+        future_size_input_op<InputIterator, SizeType, SizeIterator>{input, size, padding});
+}
+
+// A value that may be past the size. Invalid values are skipped by the reduction, so no
+// identity of the reduction operator is needed as padding.
+template<class T>
+struct future_size_reduce_item
+{
+    T    value;
+    bool valid;
+};
+
+template<class InputIterator, class SizeType, class SizeIterator, class T>
+struct future_size_reduce_input_op
+{
+    InputIterator                        input;
+    future_value<SizeType, SizeIterator> size;
+
+    ROCPRIM_HOST_DEVICE inline future_size_reduce_item<T> operator()(const size_t index) const
+    {
+        future_size_reduce_item<T> item;
+        item.valid = index < static_cast<size_t>(size);
+        if(item.valid)
+        {
+            item.value = static_cast<T>(input[index]);
+        }
+        return item;
+    }
+};
+
+template<class T, class BinaryFunction>
+struct future_size_reduce_op
+{
+    BinaryFunction reduce_op;
+
+    ROCPRIM_HOST_DEVICE inline future_size_reduce_item<T>
+        operator()(const future_size_reduce_item<T>& a, const future_size_reduce_item<T>& b)
+    {
+        if(!b.valid)
+        {
+            return a;
+        }
+        if(!a.valid)
+        {
+            return b;
+        }
+        return future_size_reduce_item<T>{static_cast<T>(reduce_op(a.value, b.value)), true};
+    }
+};
+
+template<class T>
+struct future_size_reduce_value_op
+{
+    ROCPRIM_HOST_DEVICE inline T operator()(const future_size_reduce_item<T>& item) const
+    {
+        return item.value;
+    }
+};
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_FUTURE_SIZE_HPP_
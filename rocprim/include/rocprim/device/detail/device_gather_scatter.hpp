@@ -0,0 +1,300 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_GATHER_SCATTER_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_GATHER_SCATTER_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+
+#include "../../block/block_load_func.hpp"
+#include "../../block/block_store_func.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The items of a tile are gathered in a striped arrangement, so the consecutive indices of runs
+// of a warp give coalesced loads. Every thread loads all its indices and then all its values
+// before the first store, which keeps ItemsPerThread random loads in flight per thread.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class InputIterator,
+         class IndexIterator,
+         class OutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void gather_kernel_impl(InputIterator  input,
+                        IndexIterator  indices,
+                        OutputIterator output,
+                        const size_t   launch_offset,
+                        const size_t   size)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using index_type = typename std::iterator_traits<IndexIterator>::value_type;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const size_t       block_offset
+        = launch_offset + size_t(::rocprim::detail::block_id<0>()) * items_per_block;
+    const unsigned int valid_in_block
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    index_type index_items[ItemsPerThread];
+    value_type items[ItemsPerThread];
+    if(valid_in_block == items_per_block)
+    {
+        block_load_direct_striped<BlockSize>(flat_id, indices + block_offset, index_items);
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            items[i] = input[index_items[i]];
+        }
+        block_store_direct_striped<BlockSize>(flat_id, output + block_offset, items);
+    }
+    else
+    {
+        block_load_direct_striped<BlockSize>(flat_id,
+                                             indices + block_offset,
+                                             index_items,
+                                             valid_in_block);
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            if(i * BlockSize + flat_id < valid_in_block)
+            {
+                items[i] = input[index_items[i]];
+            }
+        }
+        block_store_direct_striped<BlockSize>(flat_id,
+                                              output + block_offset,
+                                              items,
+                                              valid_in_block);
+    }
+}
+
+// Scatters load the indices and the values of a tile in a striped arrangement, the stores
+// of runs of consecutive indices in a warp are coalesced.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class InputIterator,
+         class IndexIterator,
+         class OutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void scatter_kernel_impl(InputIterator  input,
+                         IndexIterator  indices,
+                         OutputIterator output,
+                         const size_t   launch_offset,
+                         const size_t   size)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using index_type = typename std::iterator_traits<IndexIterator>::value_type;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const size_t       block_offset
+        = launch_offset + size_t(::rocprim::detail::block_id<0>()) * items_per_block;
+    const unsigned int valid_in_block
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    index_type index_items[ItemsPerThread];
+    value_type items[ItemsPerThread];
+    if(valid_in_block == items_per_block)
+    {
+        block_load_direct_striped<BlockSize>(flat_id, indices + block_offset, index_items);
+        block_load_direct_striped<BlockSize>(flat_id, input + block_offset, items);
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            output[index_items[i]] = items[i];
+        }
+    }
+    else
+    {
+        block_load_direct_striped<BlockSize>(flat_id,
+                                             indices + block_offset,
+                                             index_items,
+                                             valid_in_block);
+        block_load_direct_striped<BlockSize>(flat_id,
+                                             input + block_offset,
+                                             items,
+                                             valid_in_block);
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            if(i * BlockSize + flat_id < valid_in_block)
+            {
+                output[index_items[i]] = items[i];
+            }
+        }
+    }
+}
+
+// Sums of types with a hardware atomic add use it, every other operation and type is
+// combined with a compare-and-swap loop over the bits of the value.
+template<class T, class BinaryFunction>
+struct scatter_reduce_has_atomic_add : std::false_type
+{};
+
+template<class T>
+struct scatter_reduce_has_atomic_add<T, ::rocprim::plus<T>>
+    : std::integral_constant<bool,
+                             std::is_same<T, int>::value || std::is_same<T, unsigned int>::value
+                                 || std::is_same<T, unsigned long long>::value
+                                 || std::is_same<T, float>::value
+                                 || std::is_same<T, double>::value>
+{};
+
+template<class T>
+struct scatter_reduce_has_atomic_add<T, ::rocprim::plus<void>>
+    : scatter_reduce_has_atomic_add<T, ::rocprim::plus<T>>
+{};
+
+template<class T>
+using scatter_reduce_cas_type =
+    typename std::conditional<sizeof(T) == sizeof(unsigned int),
+                              unsigned int,
+                              unsigned long long>::type;
+
+template<class T, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto scatter_reduce_atomic(T* address, const T value, BinaryFunction)
+    -> typename std::enable_if<scatter_reduce_has_atomic_add<T, BinaryFunction>::value>::type
+{
+    ::rocprim::detail::atomic_add(address, value);
+}
+
+template<class T, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto scatter_reduce_atomic(T* address, const T value, BinaryFunction reduce_op)
+    -> typename std::enable_if<!scatter_reduce_has_atomic_add<T, BinaryFunction>::value>::type
+{
+    static_assert(sizeof(T) == sizeof(unsigned int) || sizeof(T) == sizeof(unsigned long long),
+                  "scatter_reduce supports only 4 and 8 byte types");
+    using cas_type = scatter_reduce_cas_type<T>;
+
+    cas_type* cas_address = reinterpret_cast<cas_type*>(address);
+    cas_type  assumed;
+    cas_type  old = __builtin_bit_cast(cas_type, *address);
+    do
+    {
+        assumed = old;
+        const T result = static_cast<T>(reduce_op(__builtin_bit_cast(T, assumed), value));
+        old = ::rocprim::detail::atomic_cas(cas_address,
+                                            assumed,
+                                            __builtin_bit_cast(cas_type, result));
+    }
+    while(old != assumed);
+}
+
+// Every thread reduces the runs of equal indices of its items in a blocked arrangement and
+// issues one atomic per run, so sorted or clustered indices need few atomics.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class InputIterator,
+         class IndexIterator,
+         class T,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void scatter_reduce_kernel_impl(InputIterator  input,
+                                IndexIterator  indices,
+                                T*             output,
+                                const size_t   launch_offset,
+                                const size_t   size,
+                                BinaryFunction reduce_op)
+{
+    using index_type = typename std::iterator_traits<IndexIterator>::value_type;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const size_t       block_offset
+        = launch_offset + size_t(::rocprim::detail::block_id<0>()) * items_per_block;
+    const unsigned int valid_in_block
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+    if(flat_id * ItemsPerThread >= valid_in_block)
+    {
+        return;
+    }
+    const unsigned int valid
+        = ::rocprim::min(valid_in_block - flat_id * ItemsPerThread, ItemsPerThread);
+
+    index_type index_items[ItemsPerThread];
+    T          items[ItemsPerThread];
+    if(valid == ItemsPerThread)
+    {
+        block_load_direct_blocked(flat_id, indices + block_offset, index_items);
+        block_load_direct_blocked(flat_id, input + block_offset, items);
+    }
+    else
+    {
+        block_load_direct_blocked(flat_id, indices + block_offset, index_items, valid_in_block);
+        block_load_direct_blocked(flat_id, input + block_offset, items, valid_in_block);
+    }
+
+    index_type run_index = index_items[0];
+    T          run_value = items[0];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 1; i < ItemsPerThread; i++)
+    {
+        if(i < valid)
+        {
+            if(index_items[i] == run_index)
+            {
+                run_value = static_cast<T>(reduce_op(run_value, items[i]));
+            }
+            else
+            {
+                scatter_reduce_atomic(output + run_index, run_value, reduce_op);
+                run_index = index_items[i];
+                run_value = items[i];
+            }
+        }
+    }
+    scatter_reduce_atomic(output + run_index, run_value, reduce_op);
+}
+
+// Row pointers of gather_rows for batch_memcpy
+template<class T>
+struct gather_row_pointer
+{
+    T*     base;
+    size_t row_size;
+
+    template<class Index>
+    ROCPRIM_HOST_DEVICE
+    T* operator()(const Index row) const
+    {
+        return base + static_cast<size_t>(row) * row_size;
+    }
+};
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_GATHER_SCATTER_HPP_
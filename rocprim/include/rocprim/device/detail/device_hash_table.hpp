@@ -0,0 +1,497 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_HASH_TABLE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_HASH_TABLE_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+
+#include "device_config_helper.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Keys are stored in the slots of the table as their bit representation, so that they can be
+// claimed by a single compare-and-swap. Aggregated values are updated in the same way.
+template<class T>
+using hash_table_bits_type =
+    typename std::conditional<sizeof(T) == 4, unsigned int, unsigned long long>::type;
+
+template<class T>
+struct is_hash_table_word
+    : std::integral_constant<bool,
+                             (sizeof(T) == 4 || sizeof(T) == 8)
+                                 && std::is_trivially_copyable<T>::value>
+{};
+
+// Finalizers of MurmurHash3, every bit of the key affects the low bits that select the slot.
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE unsigned int hash_table_mix(unsigned int h)
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE unsigned long long hash_table_mix(unsigned long long h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+// The number of slots is a power of two of at least twice the number of keys, which keeps the
+// load factor at or below 0.5.
+inline size_t hash_table_capacity(const size_t max_keys)
+{
+    size_t capacity = 2;
+    while(capacity < 2 * max_keys)
+    {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+// Every scheme visits all slots of a table with a power of two slots within `capacity` probes:
+// the quadratic scheme uses triangular numbers as offsets and double hashing uses an odd step.
+template<hash_probe_scheme Scheme>
+struct hash_table_probe
+{
+    size_t slot;
+    size_t step;
+    size_t mask;
+
+    template<class Bits>
+    ROCPRIM_DEVICE ROCPRIM_INLINE hash_table_probe(const Bits bits, const size_t mask)
+        : slot(static_cast<size_t>(hash_table_mix(bits)) & mask)
+        , step(Scheme == hash_probe_scheme::double_hashing
+                   ? static_cast<size_t>(hash_table_mix(static_cast<Bits>(~bits))) | 1
+                   : 1)
+        , mask(mask)
+    {}
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE void next()
+    {
+        slot = (slot + step) & mask;
+        if(Scheme == hash_probe_scheme::quadratic)
+        {
+            ++step;
+        }
+    }
+};
+
+// Returns the slot of `bits`, the key is inserted into an empty slot if it is not in the table
+// yet. `inserted` is set if this call inserted the key. Returns `mask + 1` if the key is not
+// found within `max_probes` probes.
+template<hash_probe_scheme Scheme, class Bits>
+ROCPRIM_DEVICE ROCPRIM_INLINE size_t hash_table_insert(Bits*        slots,
+                                                       const size_t mask,
+                                                       const Bits   bits,
+                                                       const Bits   empty_bits,
+                                                       const size_t max_probes,
+                                                       bool&        inserted)
+{
+    inserted = false;
+    hash_table_probe<Scheme> probe(bits, mask);
+    for(size_t i = 0; i < max_probes; ++i)
+    {
+        Bits current = atomic_load(&slots[probe.slot]);
+        if(current == empty_bits)
+        {
+            current = atomic_cas(&slots[probe.slot], empty_bits, bits);
+            if(current == empty_bits)
+            {
+                inserted = true;
+                return probe.slot;
+            }
+        }
+        if(current == bits)
+        {
+            return probe.slot;
+        }
+        probe.next();
+    }
+    return mask + 1;
+}
+
+template<hash_probe_scheme Scheme, class Bits>
+ROCPRIM_DEVICE ROCPRIM_INLINE size_t hash_table_insert(Bits*        slots,
+                                                       const size_t mask,
+                                                       const Bits   bits,
+                                                       const Bits   empty_bits,
+                                                       const size_t max_probes)
+{
+    bool inserted;
+    return hash_table_insert<Scheme>(slots, mask, bits, empty_bits, max_probes, inserted);
+}
+
+// Returns the slot of `bits`, or `mask + 1` if the key is not in the table.
+template<hash_probe_scheme Scheme, class Bits>
+ROCPRIM_DEVICE ROCPRIM_INLINE size_t hash_table_find(const Bits*  slots,
+                                                     const size_t mask,
+                                                     const Bits   bits,
+                                                     const Bits   empty_bits)
+{
+    hash_table_probe<Scheme> probe(bits, mask);
+    for(size_t i = 0; i <= mask; ++i)
+    {
+        const Bits current = slots[probe.slot];
+        if(current == bits)
+        {
+            return probe.slot;
+        }
+        if(current == empty_bits)
+        {
+            break;
+        }
+        probe.next();
+    }
+    return mask + 1;
+}
+
+// Combines `value` into `*address` with a compare-and-swap loop, which works for any operator.
+template<class Value, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    hash_table_atomic_reduce(Value* address, const Value value, BinaryFunction reduce_op)
+{
+    using bits_type = hash_table_bits_type<Value>;
+
+    bits_type* bits_address = reinterpret_cast<bits_type*>(address);
+    bits_type  expected     = atomic_load(bits_address);
+    while(true)
+    {
+        const bits_type desired = bit_cast<bits_type>(
+            static_cast<Value>(reduce_op(bit_cast<Value>(expected), value)));
+        const bits_type previous = atomic_cas(bits_address, expected, desired);
+        if(previous == expected)
+        {
+            return;
+        }
+        expected = previous;
+    }
+}
+
+// Sums use the atomic add of the hardware where it exists.
+template<class Value>
+ROCPRIM_DEVICE ROCPRIM_INLINE auto
+    hash_table_atomic_reduce(Value* address, const Value value, ::rocprim::plus<Value>)
+        -> decltype(atomic_add(address, value), void())
+{
+    atomic_add(address, value);
+}
+
+template<class Config, class Bits, class Value>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size) void hash_table_init_kernel(
+        Bits*        slots,
+        Value*       values,
+        const size_t capacity,
+        const Bits   empty_bits,
+        const Value  initial_value)
+{
+    constexpr unsigned int block_size = device_params<Config>().kernel_config.block_size;
+
+    const size_t index = static_cast<size_t>(block_id<0>()) * block_size + block_thread_id<0>();
+    if(index < capacity)
+    {
+        slots[index] = empty_bits;
+        if(values != nullptr)
+        {
+            values[index] = initial_value;
+        }
+    }
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class Bits,
+         class Value,
+         class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    hash_reduce_by_key_insert_kernel(KeysInputIterator   keys_input,
+                                     ValuesInputIterator values_input,
+                                     const size_t        size,
+                                     Bits*               slots,
+                                     Value*              aggregates,
+                                     const size_t        mask,
+                                     const Bits          empty_bits,
+                                     const Value         initial_value,
+                                     BinaryFunction      reduce_op)
+{
+    constexpr hash_table_config_params params           = device_params<Config>();
+    constexpr unsigned int             block_size       = params.kernel_config.block_size;
+    constexpr unsigned int             items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int             items_per_block  = block_size * items_per_thread;
+    constexpr hash_probe_scheme        scheme           = params.probe_scheme;
+    constexpr unsigned int             shared_slots     = params.shared_slots;
+    constexpr bool                     pre_aggregate    = shared_slots != 0;
+    // Once the shared table is mostly occupied, keys that are not in it at this point are
+    // inserted into the global table instead of probing the whole shared table.
+    constexpr size_t shared_max_probes = 16;
+
+    using key_type        = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_bits_type = hash_table_bits_type<Value>;
+
+    // Values are stored as their bit representation, so they do not need to be constructible in
+    // shared memory.
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        Bits            slots[pre_aggregate ? shared_slots : 1];
+        value_bits_type values[pre_aggregate ? shared_slots : 1];
+    } storage;
+
+    const unsigned int flat_id = block_thread_id<0>();
+
+    if ROCPRIM_IF_CONSTEXPR(pre_aggregate)
+    {
+        for(unsigned int i = flat_id; i < shared_slots; i += block_size)
+        {
+            storage.slots[i]  = empty_bits;
+            storage.values[i] = bit_cast<value_bits_type>(initial_value);
+        }
+        syncthreads();
+    }
+
+    const size_t       block_offset = static_cast<size_t>(block_id<0>()) * items_per_block;
+    const unsigned int valid_count
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const unsigned int pos = i * block_size + flat_id;
+        if(pos >= valid_count)
+        {
+            continue;
+        }
+        const Bits  bits  = bit_cast<Bits>(static_cast<key_type>(keys_input[block_offset + pos]));
+        const Value value = values_input[block_offset + pos];
+
+        if ROCPRIM_IF_CONSTEXPR(pre_aggregate)
+        {
+            const size_t slot = hash_table_insert<scheme>(storage.slots,
+                                                          shared_slots - 1,
+                                                          bits,
+                                                          empty_bits,
+                                                          shared_max_probes);
+            if(slot < shared_slots)
+            {
+                hash_table_atomic_reduce(reinterpret_cast<Value*>(&storage.values[slot]),
+                                         value,
+                                         reduce_op);
+                continue;
+            }
+        }
+
+        const size_t slot = hash_table_insert<scheme>(slots, mask, bits, empty_bits, mask + 1);
+        if(slot <= mask)
+        {
+            hash_table_atomic_reduce(&aggregates[slot], value, reduce_op);
+        }
+    }
+
+    if ROCPRIM_IF_CONSTEXPR(pre_aggregate)
+    {
+        syncthreads();
+
+        // Flush the partial aggregates of the block into the global table.
+        for(unsigned int i = flat_id; i < shared_slots; i += block_size)
+        {
+            const Bits bits = storage.slots[i];
+            if(bits != empty_bits)
+            {
+                const size_t slot
+                    = hash_table_insert<scheme>(slots, mask, bits, empty_bits, mask + 1);
+                if(slot <= mask)
+                {
+                    hash_table_atomic_reduce(&aggregates[slot],
+                                             bit_cast<Value>(storage.values[i]),
+                                             reduce_op);
+                }
+            }
+        }
+    }
+}
+
+template<class Config,
+         class Key,
+         class Bits,
+         class Value,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    hash_reduce_by_key_compact_kernel(const Bits*              slots,
+                                      const Value*             aggregates,
+                                      const size_t             capacity,
+                                      const Bits               empty_bits,
+                                      UniqueOutputIterator     unique_output,
+                                      AggregatesOutputIterator aggregates_output,
+                                      size_t*                  unique_count)
+{
+    constexpr hash_table_config_params params           = device_params<Config>();
+    constexpr unsigned int             block_size       = params.kernel_config.block_size;
+    constexpr unsigned int             items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int             items_per_block  = block_size * items_per_thread;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        unsigned int count;
+        size_t       base;
+    } storage;
+
+    const unsigned int flat_id = block_thread_id<0>();
+    if(flat_id == 0)
+    {
+        storage.count = 0;
+    }
+    syncthreads();
+
+    const size_t block_offset = static_cast<size_t>(block_id<0>()) * items_per_block;
+
+    unsigned int ranks[items_per_thread];
+    bool         occupied[items_per_thread];
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const size_t index = block_offset + i * block_size + flat_id;
+        occupied[i]        = index < capacity && slots[index] != empty_bits;
+        if(occupied[i])
+        {
+            ranks[i] = atomic_add(&storage.count, 1u);
+        }
+    }
+    syncthreads();
+
+    if(flat_id == 0)
+    {
+        const unsigned int count = storage.count;
+        storage.base = count != 0 ? atomic_add(unique_count, size_t(count)) : 0;
+    }
+    syncthreads();
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        if(occupied[i])
+        {
+            const size_t index          = block_offset + i * block_size + flat_id;
+            const size_t output_index   = storage.base + ranks[i];
+            unique_output[output_index] = bit_cast<Key>(slots[index]);
+            aggregates_output[output_index] = aggregates[index];
+        }
+    }
+}
+
+template<class Config, class KeysInputIterator, class ValuesInputIterator, class Bits, class Value>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    hash_join_build_kernel(KeysInputIterator   keys_input,
+                           ValuesInputIterator values_input,
+                           const size_t        size,
+                           Bits*               slots,
+                           Value*              table_values,
+                           const size_t        mask,
+                           const Bits          empty_bits)
+{
+    constexpr hash_table_config_params params           = device_params<Config>();
+    constexpr unsigned int             block_size       = params.kernel_config.block_size;
+    constexpr unsigned int             items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int             items_per_block  = block_size * items_per_thread;
+    constexpr hash_probe_scheme        scheme           = params.probe_scheme;
+
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    const unsigned int flat_id      = block_thread_id<0>();
+    const size_t       block_offset = static_cast<size_t>(block_id<0>()) * items_per_block;
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const size_t index = block_offset + i * block_size + flat_id;
+        if(index < size)
+        {
+            const Bits   bits = bit_cast<Bits>(static_cast<key_type>(keys_input[index]));
+            const size_t slot
+                = hash_table_insert<scheme>(slots, mask, bits, empty_bits, mask + 1);
+            if(slot <= mask)
+            {
+                table_values[slot] = values_input[index];
+            }
+        }
+    }
+}
+
+template<class Config, class KeysInputIterator, class ValuesOutputIterator, class Bits, class Value>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    hash_join_probe_kernel(const Bits*          slots,
+                           const Value*         table_values,
+                           const size_t         mask,
+                           const Bits           empty_bits,
+                           KeysInputIterator    keys_input,
+                           const size_t         size,
+                           ValuesOutputIterator values_output,
+                           const Value          not_found_value)
+{
+    constexpr hash_table_config_params params           = device_params<Config>();
+    constexpr unsigned int             block_size       = params.kernel_config.block_size;
+    constexpr unsigned int             items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int             items_per_block  = block_size * items_per_thread;
+    constexpr hash_probe_scheme        scheme           = params.probe_scheme;
+
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    const unsigned int flat_id      = block_thread_id<0>();
+    const size_t       block_offset = static_cast<size_t>(block_id<0>()) * items_per_block;
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const size_t index = block_offset + i * block_size + flat_id;
+        if(index < size)
+        {
+            const Bits   bits = bit_cast<Bits>(static_cast<key_type>(keys_input[index]));
+            const size_t slot = hash_table_find<scheme>(slots, mask, bits, empty_bits);
+            values_output[index] = slot <= mask ? table_values[slot] : not_found_value;
+        }
+    }
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_HASH_TABLE_HPP_
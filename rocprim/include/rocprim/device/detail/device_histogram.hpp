@@ -21,6 +21,7 @@
 #ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_HISTOGRAM_HPP_
 #define ROCPRIM_DEVICE_DETAIL_DEVICE_HISTOGRAM_HPP_
 
+#include <algorithm>
 #include <cmath>
 #include <iterator>
 #include <type_traits>
@@ -31,7 +32,11 @@
 #include "../../intrinsics.hpp"
 #include "../../type_traits.hpp"
 
+#include "../../block/block_discontinuity.hpp"
 #include "../../block/block_load.hpp"
+#include "../../block/block_radix_sort.hpp"
+#include "../../block/block_reduce.hpp"
+#include "../../block/block_scan.hpp"
 
 #include "uint_fast_div.hpp"
 
@@ -209,6 +214,307 @@ struct sample_to_bin_range
     }
 };
 
+// Histograms with at least this many bins of arithmetic levels search the levels with a lookup
+// table of histogram_range_lut_buckets(bins) + 1 entries rather than with a binary search over
+// all levels.
+constexpr unsigned int histogram_range_lut_min_bins    = 64;
+constexpr unsigned int histogram_range_lut_max_buckets = 8192;
+
+inline unsigned int histogram_range_lut_buckets(const unsigned int bins)
+{
+    return std::min(static_cast<unsigned int>(next_power_of_two(bins)),
+                    histogram_range_lut_max_buckets);
+}
+
+// Splits [level_values[0], level_values[bins]) into lut_buckets buckets of equal width, lut[k]
+// is the bin of the start of bucket k and lut[lut_buckets] is the last bin. A sample only
+// searches the levels between the bins of the starts of its bucket and of the next one, which
+// are usually one or two levels. The levels are in device memory, so the lowest level and the
+// scale of the buckets are computed with the table, into lut_scale. The bucket is computed in
+// floating point, rounding is corrected by widening the searched levels until they enclose the
+// sample.
+template<class Level>
+struct sample_to_bin_range_lut
+{
+    using scale_type = typename std::conditional<std::is_same<Level, double>::value,
+                                                 double,
+                                                 float>::type;
+
+    unsigned int        bins;
+    const Level*        level_values;
+    const unsigned int* lut;
+    const scale_type*   lut_scale;
+    unsigned int        lut_buckets;
+
+    ROCPRIM_HOST_DEVICE inline sample_to_bin_range_lut() = default;
+
+    ROCPRIM_HOST_DEVICE inline sample_to_bin_range_lut(unsigned int        bins,
+                                                       const Level*        level_values,
+                                                       const unsigned int* lut,
+                                                       const scale_type*   lut_scale,
+                                                       unsigned int        lut_buckets)
+        : bins(bins)
+        , level_values(level_values)
+        , lut(lut)
+        , lut_scale(lut_scale)
+        , lut_buckets(lut_buckets)
+    {}
+
+    template<class Sample>
+    ROCPRIM_HOST_DEVICE inline bool operator()(Sample sample, unsigned int& bin) const
+    {
+        const Level s = static_cast<Level>(sample);
+        // Also rejects NaN
+        if(!(s >= level_values[0] && s < level_values[bins]))
+        {
+            return false;
+        }
+
+        const scale_type offset = (static_cast<scale_type>(s) - lut_scale[0]) * lut_scale[1];
+        const unsigned int k    = static_cast<unsigned int>(
+            ::rocprim::min(::rocprim::max(offset, scale_type(0)),
+                           static_cast<scale_type>(lut_buckets - 1)));
+
+        unsigned int first = lut[k];
+        unsigned int last  = lut[k + 1] + 1;
+        while(first > 0 && s < level_values[first])
+        {
+            first--;
+        }
+        while(last < bins && !(s < level_values[last]))
+        {
+            last++;
+        }
+        bin = first + upper_bound(level_values + first, last - first, s) - 1;
+        return true;
+    }
+};
+
+// Fills the lookup table of channel block_id<1>, one entry per thread
+template<unsigned int BlockSize, unsigned int ActiveChannels, class Level>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    histogram_range_lut(fixed_array<sample_to_bin_range_lut<Level>, ActiveChannels> ops,
+                        fixed_array<unsigned int*, ActiveChannels>                   luts,
+                        fixed_array<typename sample_to_bin_range_lut<Level>::scale_type*,
+                                    ActiveChannels>                                  lut_scales)
+{
+    using scale_type = typename sample_to_bin_range_lut<Level>::scale_type;
+
+    const unsigned int channel = ::rocprim::detail::block_id<1>();
+    const unsigned int k
+        = ::rocprim::detail::block_id<0>() * BlockSize + ::rocprim::detail::block_thread_id<0>();
+
+    const sample_to_bin_range_lut<Level>& op = ops[channel];
+    if(k > op.lut_buckets)
+    {
+        return;
+    }
+
+    // Levels too close to be told apart by scale_type put all samples in the first bucket
+    const scale_type lower = static_cast<scale_type>(op.level_values[0]);
+    const scale_type upper = static_cast<scale_type>(op.level_values[op.bins]);
+    const scale_type scale
+        = upper > lower ? static_cast<scale_type>(op.lut_buckets) / (upper - lower)
+                        : scale_type(0);
+    if(k == 0)
+    {
+        lut_scales[channel][0] = lower;
+        lut_scales[channel][1] = scale;
+    }
+    if(k == op.lut_buckets)
+    {
+        luts[channel][k] = op.bins - 1;
+        return;
+    }
+
+    // The bin of the bucket start is the number of levels not greater than it, minus one
+    const scale_type start = k == 0 ? lower : lower + static_cast<scale_type>(k) / scale;
+    unsigned int     count = 0;
+    unsigned int     size  = op.bins + 1;
+    while(size > 0)
+    {
+        const unsigned int half = size / 2;
+        if(start < static_cast<scale_type>(op.level_values[count + half]))
+        {
+            size = half;
+        }
+        else
+        {
+            count += half + 1;
+            size -= half + 1;
+        }
+    }
+    luts[channel][k] = ::rocprim::min(::rocprim::max(count, 1u) - 1, op.bins - 1);
+}
+
+// Ranks of samples in sorted histograms: 0 below the lowest level, bin + 1 for bins of the
+// histogram and bins + 1 above the highest level, so the ranks of sorted samples are sorted too
+template<class Level, class Sample>
+ROCPRIM_HOST_DEVICE inline unsigned int histogram_sorted_rank(const sample_to_bin_even<Level>& op,
+                                                              Sample sample)
+{
+    unsigned int bin;
+    if(op(sample, bin))
+    {
+        return ::rocprim::min(bin, op.bins - 1) + 1;
+    }
+    return static_cast<Level>(sample) < op.lower_level ? 0 : op.bins + 1;
+}
+
+template<class Level, class Sample>
+ROCPRIM_HOST_DEVICE inline unsigned int
+    histogram_sorted_rank(const sample_to_bin_range<Level>& op, Sample sample)
+{
+    return upper_bound(op.level_values, op.bins + 1, static_cast<Level>(sample));
+}
+
+// Returns the first position in [begin, end) of the sorted samples with a rank not less than rank
+template<class SampleIterator, class SampleToBinOp>
+ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int
+    histogram_sorted_lower_bound(SampleIterator       samples,
+                                 unsigned int         begin,
+                                 unsigned int         end,
+                                 const SampleToBinOp& sample_to_bin_op,
+                                 unsigned int         rank)
+{
+    while(begin < end)
+    {
+        const unsigned int mid = begin + (end - begin) / 2;
+        if(histogram_sorted_rank(sample_to_bin_op, samples[mid]) < rank)
+        {
+            begin = mid + 1;
+        }
+        else
+        {
+            end = mid;
+        }
+    }
+    return begin;
+}
+
+// One thread per bin, the bin is the distance between the first samples of it and of the next bin
+template<unsigned int BlockSize, class SampleIterator, class Counter, class SampleToBinOp>
+ROCPRIM_DEVICE ROCPRIM_INLINE void histogram_sorted_search(SampleIterator samples,
+                                                           unsigned int   size,
+                                                           Counter*       histogram,
+                                                           SampleToBinOp  sample_to_bin_op)
+{
+    const unsigned int bin
+        = ::rocprim::detail::block_id<0>() * BlockSize + ::rocprim::detail::block_thread_id<0>();
+    if(bin >= sample_to_bin_op.bins)
+    {
+        return;
+    }
+
+    const unsigned int begin
+        = histogram_sorted_lower_bound(samples, 0, size, sample_to_bin_op, bin + 1);
+    const unsigned int end
+        = histogram_sorted_lower_bound(samples, begin, size, sample_to_bin_op, bin + 2);
+    histogram[bin] = static_cast<Counter>(end - begin);
+}
+
+// One thread per sample for histograms with more bins than samples: the first sample of every
+// run of equal ranks searches the end of its run and writes the bin, other bins stay zero
+template<unsigned int BlockSize, class SampleIterator, class Counter, class SampleToBinOp>
+ROCPRIM_DEVICE ROCPRIM_INLINE void histogram_sorted_walk(SampleIterator samples,
+                                                         unsigned int   size,
+                                                         Counter*       histogram,
+                                                         SampleToBinOp  sample_to_bin_op)
+{
+    const unsigned int i
+        = ::rocprim::detail::block_id<0>() * BlockSize + ::rocprim::detail::block_thread_id<0>();
+    if(i >= size)
+    {
+        return;
+    }
+
+    const unsigned int rank = histogram_sorted_rank(sample_to_bin_op, samples[i]);
+    if(rank == 0 || rank > sample_to_bin_op.bins
+       || (i > 0 && histogram_sorted_rank(sample_to_bin_op, samples[i - 1]) == rank))
+    {
+        return;
+    }
+
+    const unsigned int end
+        = histogram_sorted_lower_bound(samples, i + 1, size, sample_to_bin_op, rank + 1);
+    histogram[rank - 1] = static_cast<Counter>(end - i);
+}
+
+// Flattens the bins of the dimensions of a joint histogram: the first dimension varies slowest,
+// samples outside the range of any dimension get the bin total_bins
+template<unsigned int Dimensions, class SampleToBinOp>
+struct histogram_joint_bins
+{
+    SampleToBinOp ops[Dimensions];
+    unsigned int  total_bins;
+
+    template<class Sample>
+    ROCPRIM_HOST_DEVICE inline bool
+        add(unsigned int dimension, Sample sample, unsigned int& index) const
+    {
+        unsigned int bin;
+        if(!ops[dimension](sample, bin))
+        {
+            return false;
+        }
+        // Rounding of the even levels can not move a sample into the next row of bins
+        index = index * ops[dimension].bins + ::rocprim::min(bin, ops[dimension].bins - 1);
+        return true;
+    }
+};
+
+// Maps index i to the flattened bin of the pair (x[i], y[i])
+template<class SampleIterator1, class SampleIterator2, class SampleToBinOp>
+struct histogram2d_bin_op
+{
+    SampleIterator1                        x_samples;
+    SampleIterator2                        y_samples;
+    histogram_joint_bins<2, SampleToBinOp> joint;
+
+    ROCPRIM_HOST_DEVICE inline unsigned int operator()(unsigned int i) const
+    {
+        unsigned int index = 0;
+        if(joint.add(0, x_samples[i], index) && joint.add(1, y_samples[i], index))
+        {
+            return index;
+        }
+        return joint.total_bins;
+    }
+};
+
+// Maps index i to the flattened bin of the Dimensions interleaved values of sample i
+template<unsigned int Dimensions, class SampleIterator, class SampleToBinOp>
+struct histogram_nd_bin_op
+{
+    SampleIterator                                  samples;
+    histogram_joint_bins<Dimensions, SampleToBinOp> joint;
+
+    ROCPRIM_HOST_DEVICE inline unsigned int operator()(unsigned int i) const
+    {
+        unsigned int index = 0;
+        for(unsigned int dimension = 0; dimension < Dimensions; dimension++)
+        {
+            if(!joint.add(dimension, samples[size_t(i) * Dimensions + dimension], index))
+            {
+                return joint.total_bins;
+            }
+        }
+        return index;
+    }
+};
+
+// Counts the flattened bins of joint histograms, the bin index bins marks invalid samples
+struct sample_to_bin_joint
+{
+    unsigned int bins;
+
+    ROCPRIM_HOST_DEVICE inline bool operator()(unsigned int sample, unsigned int& bin) const
+    {
+        bin = sample;
+        return sample < bins;
+    }
+};
+
 template<class T, unsigned int Size>
 struct sample_vector
 {
@@ -305,9 +611,18 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
     }
 }
 
+// Scales an existing bin by decay, the result is converted back to the bin type
+template<class Counter>
+ROCPRIM_DEVICE ROCPRIM_INLINE Counter histogram_decayed_bin(Counter bin, double decay)
+{
+    return decay == 1.0 ? bin : static_cast<Counter>(static_cast<double>(bin) * decay);
+}
+
+// Clears the bins if decay is 0 (without reading them), otherwise scales them by decay
 template<unsigned int BlockSize, unsigned int ActiveChannels, class Counter>
 ROCPRIM_DEVICE ROCPRIM_INLINE void init_histogram(fixed_array<Counter*, ActiveChannels> histogram,
-                                                  fixed_array<unsigned int, ActiveChannels> bins)
+                                                  fixed_array<unsigned int, ActiveChannels> bins,
+                                                  double decay)
 {
     const unsigned int flat_id  = ::rocprim::detail::block_thread_id<0>();
     const unsigned int block_id = ::rocprim::detail::block_id<0>();
@@ -317,11 +632,70 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void init_histogram(fixed_array<Counter*, ActiveCh
     {
         if(index < bins[channel])
         {
-            histogram[channel][index] = 0;
+            histogram[channel][index]
+                = decay == 0.0 ? Counter(0)
+                               : histogram_decayed_bin(histogram[channel][index], decay);
         }
     }
 }
 
+// Counts the bins of a tile by sorting them and adding the length of every run of equal bins to
+// the shared histogram. Used for tiles where most samples fall into few bins, whose shared atomics
+// would be serialized: every distinct bin costs two atomics instead of one atomic per sample.
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+struct histogram_shared_runs
+{
+    using radix_sort_type    = block_radix_sort<unsigned int, BlockSize, ItemsPerThread>;
+    using discontinuity_type = block_discontinuity<unsigned int, BlockSize>;
+
+    union storage_type
+    {
+        typename radix_sort_type::storage_type    sort;
+        typename discontinuity_type::storage_type flags;
+    };
+
+    // Bins equal to bins are samples outside of the histogram and are not counted
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void count(unsigned int (&tile_bins)[ItemsPerThread],
+               unsigned int  bins,
+               unsigned int* block_histogram,
+               storage_type& storage)
+    {
+        const unsigned int flat_id  = ::rocprim::detail::block_thread_id<0>();
+        const unsigned int bin_bits = 8 * sizeof(unsigned int) - __clz(bins);
+
+        radix_sort_type().sort(tile_bins, storage.sort, 0, bin_bits);
+        ::rocprim::syncthreads();
+
+        bool head_flags[ItemsPerThread];
+        bool tail_flags[ItemsPerThread];
+        discontinuity_type().flag_heads_and_tails(head_flags,
+                                                  tail_flags,
+                                                  tile_bins,
+                                                  ::rocprim::not_equal_to<unsigned int>(),
+                                                  storage.flags);
+
+        // A run from start to end (exclusive) adds end - start, as a wrapping sum of -start
+        // and end, which may be added in any order
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int rank = flat_id * ItemsPerThread + i;
+            if(tile_bins[i] < bins)
+            {
+                if(head_flags[i])
+                {
+                    ::rocprim::detail::atomic_add(block_histogram + tile_bins[i], 0u - rank);
+                }
+                if(tail_flags[i])
+                {
+                    ::rocprim::detail::atomic_add(block_histogram + tile_bins[i], rank + 1);
+                }
+            }
+        }
+        ::rocprim::syncthreads();
+    }
+};
+
 template<unsigned int BlockSize,
          unsigned int ItemsPerThread,
          unsigned int Channels,
@@ -344,8 +718,12 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
     using sample_type        = typename std::iterator_traits<SampleIterator>::value_type;
     using sample_vector_type = sample_vector<sample_type, Channels>;
 
+    using runs_type          = histogram_shared_runs<BlockSize, ItemsPerThread>;
+
     constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
 
+    ROCPRIM_SHARED_MEMORY typename runs_type::storage_type runs_storage;
+
     const unsigned int flat_id    = ::rocprim::detail::block_thread_id<0>();
     const unsigned int block_id0  = ::rocprim::detail::block_id<0>();
     const unsigned int block_id1  = ::rocprim::detail::block_id<1>();
@@ -385,16 +763,47 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
             {
                 load_samples<BlockSize>(flat_id, row_samples + Channels * block_offset, values);
 
-                for(unsigned int i = 0; i < ItemsPerThread; i++)
+                // The tile is sorted when most lanes sample the same bin as the first lane of
+                // their warp, e.g. in constant regions of images
+                unsigned int first_bin;
+                if(!sample_to_bin_op[0](values[0].values[0], first_bin))
+                {
+                    first_bin = bins[0];
+                }
+                const bool same_bin
+                    = first_bin < bins[0] && first_bin == ::rocprim::warp_shuffle(first_bin, 0);
+
+                if(__syncthreads_count(same_bin) > BlockSize / 2)
                 {
                     for(unsigned int channel = 0; channel < ActiveChannels; channel++)
                     {
-                        unsigned int bin;
-                        if(sample_to_bin_op[channel](values[i].values[channel], bin))
+                        unsigned int tile_bins[ItemsPerThread];
+                        for(unsigned int i = 0; i < ItemsPerThread; i++)
                         {
-                            ::rocprim::detail::atomic_add(block_histogram[channel] + bin
-                                                              + thread_shift,
-                                                          1);
+                            if(!sample_to_bin_op[channel](values[i].values[channel], tile_bins[i]))
+                            {
+                                tile_bins[i] = bins[channel];
+                            }
+                        }
+                        runs_type().count(tile_bins,
+                                          bins[channel],
+                                          block_histogram[channel],
+                                          runs_storage);
+                    }
+                }
+                else
+                {
+                    for(unsigned int i = 0; i < ItemsPerThread; i++)
+                    {
+                        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+                        {
+                            unsigned int bin;
+                            if(sample_to_bin_op[channel](values[i].values[channel], bin))
+                            {
+                                ::rocprim::detail::atomic_add(block_histogram[channel] + bin
+                                                                  + thread_shift,
+                                                              1);
+                            }
                         }
                     }
                 }
@@ -498,16 +907,534 @@ ROCPRIM_DEVICE ROCPRIM_INLINE void
                 lane_mask_type     same_bin_lanes_mask
                     = ::rocprim::match_any(bin, bins_bits[channel], pos < valid_count);
 
-                if(::rocprim::group_elect(same_bin_lanes_mask))
+                // The lanes having this bin add their count with one atomic
+                ::rocprim::warp_aggregated_atomic_add(&histogram[channel][bin],
+                                                      Counter(1),
+                                                      same_bin_lanes_mask);
+            }
+        }
+    }
+}
+
+// Maximum number of tiles of the tiled implementation, the partitioning kernels keep a counter
+// per tile in shared memory
+constexpr unsigned int histogram_tiled_max_tiles = 1024;
+
+// Partitions samples by the tile of their bin. Bins of all active channels form one space of
+// total_bins bins, the bin of a sample of channel c is offset by the bins of channels before c.
+// Without Scatter only the number of samples of each tile is added to tile_counts, with Scatter
+// tile_counts holds the current end of each tile in partitioned_bins.
+// The samples of a tile are counted within a warp first, then within a block, so skewed
+// distributions produce one shared and one global atomic per warp and per block respectively.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int Channels,
+         unsigned int ActiveChannels,
+         bool         Scatter,
+         class SampleIterator,
+         class SampleToBinOp>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    histogram_tiled_partition(SampleIterator                             samples,
+                              unsigned int                               columns,
+                              unsigned int                               row_stride,
+                              fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
+                              fixed_array<unsigned int, ActiveChannels>  bin_offsets,
+                              unsigned int                               tile_bits,
+                              unsigned int                               num_tiles,
+                              unsigned int                               num_tiles_bits,
+                              size_t*                                    tile_counts,
+                              unsigned int*                              partitioned_bins)
+{
+    using sample_type        = typename std::iterator_traits<SampleIterator>::value_type;
+    using sample_vector_type = sample_vector<sample_type, Channels>;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    ROCPRIM_SHARED_MEMORY unsigned int block_counts[histogram_tiled_max_tiles];
+    ROCPRIM_SHARED_MEMORY size_t       block_bases[Scatter ? histogram_tiled_max_tiles : 1];
+
+    const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_id0    = ::rocprim::detail::block_id<0>();
+    const unsigned int block_id1    = ::rocprim::detail::block_id<1>();
+    const unsigned int block_offset = block_id0 * items_per_block;
+
+    for(unsigned int tile = flat_id; tile < num_tiles; tile += BlockSize)
+    {
+        block_counts[tile] = 0;
+    }
+    ::rocprim::syncthreads();
+
+    samples += block_id1 * row_stride + Channels * block_offset;
+
+    sample_vector_type values[ItemsPerThread];
+    unsigned int       valid_count;
+    if(block_offset + items_per_block <= columns)
+    {
+        valid_count = items_per_block;
+        load_samples<BlockSize>(flat_id, samples, values);
+    }
+    else
+    {
+        valid_count = columns - block_offset;
+        load_samples<BlockSize>(flat_id, samples, values, valid_count);
+    }
+
+    unsigned int bins[ItemsPerThread][ActiveChannels];
+    unsigned int ranks[ItemsPerThread][ActiveChannels];
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+        {
+            unsigned int bin   = 0;
+            const bool   valid = flat_id * ItemsPerThread + i < valid_count
+                               && sample_to_bin_op[channel](values[i].values[channel], bin);
+
+            bins[i][channel]        = valid ? bin_offsets[channel] + bin : ~0u;
+            const unsigned int tile = bins[i][channel] >> tile_bits;
+
+            const lane_mask_type same_tile_lanes_mask
+                = ::rocprim::match_any(tile, num_tiles_bits, valid);
+
+            // The first lane of the group reserves ranks for all lanes of the group
+            const unsigned int rank
+                = ::rocprim::warp_aggregated_atomic_add(&block_counts[valid ? tile : 0],
+                                                        1u,
+                                                        same_tile_lanes_mask);
+            if(Scatter)
+            {
+                ranks[i][channel] = rank;
+            }
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int tile = flat_id; tile < num_tiles; tile += BlockSize)
+    {
+        const unsigned int count = block_counts[tile];
+        if(count > 0)
+        {
+            const size_t base
+                = ::rocprim::detail::atomic_add(&tile_counts[tile], static_cast<size_t>(count));
+            if(Scatter)
+            {
+                block_bases[tile] = base;
+            }
+        }
+    }
+
+    if(Scatter)
+    {
+        ::rocprim::syncthreads();
+
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+            {
+                const unsigned int bin = bins[i][channel];
+                if(bin != ~0u)
+                {
+                    partitioned_bins[block_bases[bin >> tile_bits] + ranks[i][channel]] = bin;
+                }
+            }
+        }
+    }
+}
+
+// Replaces the sample counts of tiles by the offsets of tiles in the partitioned bins,
+// tile_offsets receives num_tiles + 1 offsets. Launched as a single block.
+template<unsigned int BlockSize>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    histogram_tiled_scan(size_t* tile_counts, size_t* tile_offsets, unsigned int num_tiles)
+{
+    constexpr unsigned int items_per_thread
+        = ::rocprim::detail::ceiling_div(histogram_tiled_max_tiles, BlockSize);
+
+    using block_scan_type = ::rocprim::block_scan<size_t, BlockSize>;
+
+    ROCPRIM_SHARED_MEMORY typename block_scan_type::storage_type storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    size_t counts[items_per_thread];
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const unsigned int tile = flat_id * items_per_thread + i;
+        counts[i]               = tile < num_tiles ? tile_counts[tile] : 0;
+    }
+
+    size_t offsets[items_per_thread];
+    size_t total;
+    block_scan_type().exclusive_scan(counts,
+                                     offsets,
+                                     size_t(0),
+                                     total,
+                                     storage,
+                                     ::rocprim::plus<size_t>());
+
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const unsigned int tile = flat_id * items_per_thread + i;
+        if(tile < num_tiles)
+        {
+            tile_counts[tile]  = offsets[i];
+            tile_offsets[tile] = offsets[i];
+        }
+    }
+    if(flat_id == 0)
+    {
+        tile_offsets[num_tiles] = total;
+    }
+}
+
+// Computes the histogram of one tile (block_id<1>) of the partitioned bins in shared memory.
+// Equal bins are counted within a warp before they are added to the shared histogram.
+template<unsigned int BlockSize, unsigned int TileBins, unsigned int ActiveChannels, class Counter>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    histogram_tiled_tile(const unsigned int*                       partitioned_bins,
+                         const size_t*                             tile_offsets,
+                         unsigned int                              tile_bits,
+                         fixed_array<Counter*, ActiveChannels>     histogram,
+                         fixed_array<unsigned int, ActiveChannels> bins)
+{
+    ROCPRIM_SHARED_MEMORY unsigned int tile_histogram[TileBins];
+
+    const unsigned int flat_id    = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_id0  = ::rocprim::detail::block_id<0>();
+    const unsigned int tile       = ::rocprim::detail::block_id<1>();
+    const unsigned int grid_size0 = ::rocprim::detail::grid_size<0>();
+
+    for(unsigned int bin = flat_id; bin < TileBins; bin += BlockSize)
+    {
+        tile_histogram[bin] = 0;
+    }
+    ::rocprim::syncthreads();
+
+    const size_t begin = tile_offsets[tile];
+    const size_t end   = tile_offsets[tile + 1];
+    for(size_t offset = begin + size_t(block_id0) * BlockSize; offset < end;
+        offset += size_t(grid_size0) * BlockSize)
+    {
+        const size_t       index = offset + flat_id;
+        const bool         valid = index < end;
+        const unsigned int bin   = valid ? partitioned_bins[index] & (TileBins - 1) : 0;
+
+        const lane_mask_type same_bin_lanes_mask = ::rocprim::match_any(bin, tile_bits, valid);
+        ::rocprim::warp_aggregated_atomic_add(&tile_histogram[bin], 1u, same_bin_lanes_mask);
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int bin = flat_id; bin < TileBins; bin += BlockSize)
+    {
+        const unsigned int count = tile_histogram[bin];
+        if(count > 0)
+        {
+            // Find the channel of the bin
+            unsigned int channel_bin = (tile << tile_bits) + bin;
+            unsigned int channel     = 0;
+            while(channel_bin >= bins[channel])
+            {
+                channel_bin -= bins[channel];
+                channel++;
+            }
+            ::rocprim::detail::atomic_add(&histogram[channel][channel_bin], count);
+        }
+    }
+}
+
+// Type of the bin totals of weighted histograms. Floating-point weights are accumulated in float
+// or double, integral weights and floating-point weights of deterministic histograms (as
+// fixed-point numbers) in 64-bit two's complement integers. Integer addition is associative, so
+// these totals do not depend on the order of the atomic operations.
+template<class Weight, bool Deterministic>
+using histogram_weight_accumulator_t = typename std::conditional<
+    ::rocprim::is_floating_point<Weight>::value && !Deterministic,
+    typename std::conditional<sizeof(Weight) <= sizeof(float), float, double>::type,
+    unsigned long long>::type;
+
+// Returns the scale of fixed-point weights. The total of size weights of magnitude up to
+// max_abs_weight must fit into 63 bits.
+ROCPRIM_HOST_DEVICE inline double
+    histogram_fixed_point_scale(unsigned long long max_abs_weight_bits, unsigned int size)
+{
+    const double max_abs_weight = ::rocprim::detail::bit_cast<double>(max_abs_weight_bits);
+    if(!(max_abs_weight > 0.0))
+    {
+        return 1.0;
+    }
+    int size_bits = 0;
+    while((1ull << size_bits) < size)
+    {
+        size_bits++;
+    }
+    const int exponent = 62 - size_bits - (::ilogb(max_abs_weight) + 1);
+    return ::ldexp(1.0, ::rocprim::max(-1000, ::rocprim::min(exponent, 1000)));
+}
+
+template<class Accumulator, class Weight>
+ROCPRIM_HOST_DEVICE inline auto histogram_weight_to_accumulator(Weight weight, double /*scale*/) ->
+    typename std::enable_if<::rocprim::is_floating_point<Accumulator>::value, Accumulator>::type
+{
+    return static_cast<Accumulator>(weight);
+}
+
+template<class Accumulator, class Weight>
+ROCPRIM_HOST_DEVICE inline auto histogram_weight_to_accumulator(Weight weight, double /*scale*/) ->
+    typename std::enable_if<!::rocprim::is_floating_point<Accumulator>::value
+                                && !::rocprim::is_floating_point<Weight>::value,
+                            Accumulator>::type
+{
+    return static_cast<Accumulator>(static_cast<long long>(weight));
+}
+
+template<class Accumulator, class Weight>
+ROCPRIM_HOST_DEVICE inline auto histogram_weight_to_accumulator(Weight weight, double scale) ->
+    typename std::enable_if<!::rocprim::is_floating_point<Accumulator>::value
+                                && ::rocprim::is_floating_point<Weight>::value,
+                            Accumulator>::type
+{
+    return static_cast<Accumulator>(::llrint(static_cast<double>(weight) * scale));
+}
+
+template<class Output, class Weight, class Accumulator>
+ROCPRIM_HOST_DEVICE inline auto histogram_accumulator_to_output(Accumulator total,
+                                                                double /*scale*/) ->
+    typename std::enable_if<::rocprim::is_floating_point<Accumulator>::value, Output>::type
+{
+    return static_cast<Output>(total);
+}
+
+template<class Output, class Weight, class Accumulator>
+ROCPRIM_HOST_DEVICE inline auto histogram_accumulator_to_output(Accumulator total,
+                                                                double /*scale*/) ->
+    typename std::enable_if<!::rocprim::is_floating_point<Accumulator>::value
+                                && !::rocprim::is_floating_point<Weight>::value,
+                            Output>::type
+{
+    return static_cast<Output>(static_cast<long long>(total));
+}
+
+template<class Output, class Weight, class Accumulator>
+ROCPRIM_HOST_DEVICE inline auto histogram_accumulator_to_output(Accumulator total, double scale) ->
+    typename std::enable_if<!::rocprim::is_floating_point<Accumulator>::value
+                                && ::rocprim::is_floating_point<Weight>::value,
+                            Output>::type
+{
+    return static_cast<Output>(static_cast<double>(static_cast<long long>(total)) / scale);
+}
+
+// Computes the maximum magnitude of finite weights as the bits of a double
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class WeightIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE void histogram_weight_max(WeightIterator      weights,
+                                                        unsigned int        size,
+                                                        unsigned long long* max_abs_weight_bits)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using block_reduce_type = ::rocprim::block_reduce<double, BlockSize>;
+
+    ROCPRIM_SHARED_MEMORY typename block_reduce_type::storage_type storage;
+
+    const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_offset = ::rocprim::detail::block_id<0>() * items_per_block;
+
+    double max_abs_weight = 0.0;
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        const unsigned int index = block_offset + i * BlockSize + flat_id;
+        if(index < size)
+        {
+            const double abs_weight = ::fabs(static_cast<double>(weights[index]));
+            if(::isfinite(abs_weight) && abs_weight > max_abs_weight)
+            {
+                max_abs_weight = abs_weight;
+            }
+        }
+    }
+
+    block_reduce_type().reduce(max_abs_weight,
+                               max_abs_weight,
+                               storage,
+                               ::rocprim::maximum<double>());
+    if(flat_id == 0)
+    {
+        // Bits of non-negative doubles are ordered like their values
+        ::rocprim::detail::atomic_max(max_abs_weight_bits,
+                                      ::rocprim::detail::bit_cast<unsigned long long>(
+                                          max_abs_weight));
+    }
+}
+
+// Adds the weights of samples to histograms in shared memory, shared_histograms histograms
+// reduce conflicts of atomics like in histogram_shared
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int Channels,
+         unsigned int ActiveChannels,
+         class SampleIterator,
+         class WeightIterator,
+         class Accumulator,
+         class SampleToBinOp>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    histogram_weighted_shared(SampleIterator                             samples,
+                              WeightIterator                             weights,
+                              unsigned int                               size,
+                              unsigned int                               shared_histograms,
+                              fixed_array<Accumulator*, ActiveChannels>  histogram,
+                              fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
+                              fixed_array<unsigned int, ActiveChannels>  bins,
+                              const unsigned long long*                  max_abs_weight_bits,
+                              Accumulator*                               block_histogram_start)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id    = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_id0  = ::rocprim::detail::block_id<0>();
+    const unsigned int grid_size0 = ::rocprim::detail::grid_size<0>();
+
+    const double scale = max_abs_weight_bits != nullptr
+                             ? histogram_fixed_point_scale(*max_abs_weight_bits, size)
+                             : 1.0;
+
+    // starts of the first histogram for each channel
+    Accumulator* block_histogram[ActiveChannels];
+    unsigned int total_bins = 0;
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        block_histogram[channel] = block_histogram_start + total_bins;
+        total_bins += bins[channel];
+    }
+
+    // partial histogram to work with
+    const unsigned int thread_shift = (flat_id % shared_histograms) * total_bins;
+
+    for(unsigned int i = flat_id; i < total_bins * shared_histograms; i += BlockSize)
+    {
+        block_histogram_start[i] = 0;
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int block_offset = block_id0 * items_per_block; block_offset < size;
+        block_offset += grid_size0 * items_per_block)
+    {
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int index = block_offset + i * BlockSize + flat_id;
+            if(index < size)
+            {
+                const Accumulator weight
+                    = histogram_weight_to_accumulator<Accumulator>(weights[index], scale);
+                for(unsigned int channel = 0; channel < ActiveChannels; channel++)
                 {
-                    // Write the number of lanes having this bin,
-                    // if the current lane is the first (and maybe only) lane with this bin.
-                    ::rocprim::detail::atomic_add(&histogram[channel][bin],
-                                                  ::rocprim::bit_count(same_bin_lanes_mask));
+                    unsigned int bin;
+                    if(sample_to_bin_op[channel](samples[index * Channels + channel], bin))
+                    {
+                        ::rocprim::detail::atomic_add(block_histogram[channel] + bin
+                                                          + thread_shift,
+                                                      weight);
+                    }
                 }
             }
         }
     }
+    ::rocprim::syncthreads();
+
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        for(unsigned int bin = flat_id; bin < bins[channel]; bin += BlockSize)
+        {
+            Accumulator total = 0;
+            for(unsigned int i = 0; i < shared_histograms; i++)
+            {
+                total += block_histogram[channel][bin + i * total_bins];
+            }
+            if(total != Accumulator(0))
+            {
+                ::rocprim::detail::atomic_add(&histogram[channel][bin], total);
+            }
+        }
+    }
+}
+
+// Adds the weights of samples to histograms in global memory
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int Channels,
+         unsigned int ActiveChannels,
+         class SampleIterator,
+         class WeightIterator,
+         class Accumulator,
+         class SampleToBinOp>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    histogram_weighted_global(SampleIterator                             samples,
+                              WeightIterator                             weights,
+                              unsigned int                               size,
+                              fixed_array<Accumulator*, ActiveChannels>  histogram,
+                              fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
+                              const unsigned long long*                  max_abs_weight_bits)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_offset = ::rocprim::detail::block_id<0>() * items_per_block;
+
+    const double scale = max_abs_weight_bits != nullptr
+                             ? histogram_fixed_point_scale(*max_abs_weight_bits, size)
+                             : 1.0;
+
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        const unsigned int index = block_offset + i * BlockSize + flat_id;
+        if(index < size)
+        {
+            const Accumulator weight
+                = histogram_weight_to_accumulator<Accumulator>(weights[index], scale);
+            for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+            {
+                unsigned int bin;
+                if(sample_to_bin_op[channel](samples[index * Channels + channel], bin))
+                {
+                    ::rocprim::detail::atomic_add(&histogram[channel][bin], weight);
+                }
+            }
+        }
+    }
+}
+
+// Converts the bin totals to the output type, and adds them to the existing bins scaled by decay
+// unless decay is 0
+template<unsigned int BlockSize,
+         unsigned int ActiveChannels,
+         class Weight,
+         class Accumulator,
+         class Output>
+ROCPRIM_DEVICE ROCPRIM_INLINE void
+    histogram_weighted_output(fixed_array<const Accumulator*, ActiveChannels> totals,
+                              fixed_array<Output*, ActiveChannels>            histogram,
+                              fixed_array<unsigned int, ActiveChannels>       bins,
+                              unsigned int                                    size,
+                              const unsigned long long*                       max_abs_weight_bits,
+                              double                                          decay)
+{
+    const unsigned int index
+        = ::rocprim::detail::block_id<0>() * BlockSize + ::rocprim::detail::block_thread_id<0>();
+
+    const double scale = max_abs_weight_bits != nullptr
+                             ? histogram_fixed_point_scale(*max_abs_weight_bits, size)
+                             : 1.0;
+
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        if(index < bins[channel])
+        {
+            Output value
+                = histogram_accumulator_to_output<Output, Weight>(totals[channel][index], scale);
+            if(decay != 0.0)
+            {
+                value = histogram_decayed_bin(histogram[channel][index], decay) + value;
+            }
+            histogram[channel][index] = value;
+        }
+    }
 }
 
 } // namespace detail
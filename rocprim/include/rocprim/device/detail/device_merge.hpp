@@ -31,8 +31,10 @@
 #include "../../functional.hpp"
 #include "../../types.hpp"
 
+#include "../../block/block_load_func.hpp"
 #include "../../block/block_store.hpp"
 #include "../../detail/merge_path.hpp"
+#include "../../thread/thread_search.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -340,6 +342,294 @@ void merge_kernel_impl(IndexIterator indices,
     );
 }
 
+/// Inputs where the larger one holds at least this many times as many items as the smaller one
+/// are merged by locating every item of the smaller input in the larger one, instead of
+/// partitioning along the merge path.
+constexpr unsigned int merge_unbalanced_ratio = 256;
+
+/// Returns whether \p big_key of the larger input is placed before \p small_key of the smaller
+/// input. Ties are resolved in favour of the first input, as in the merge path.
+template<bool SmallIsFirst, class Key, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+bool merge_unbalanced_goes_before(const Key&     big_key,
+                                  const Key&     small_key,
+                                  BinaryFunction compare_function)
+{
+    return SmallIsFirst ? compare_function(big_key, small_key)
+                        : !compare_function(small_key, big_key);
+}
+
+/// Returns the number of items of the larger input placed before \p small_key. The search gallops
+/// outwards from \p guess with doubling steps, then finishes with a binary search in the bracket.
+template<bool SmallIsFirst, class KeysInputIterator, class Key, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned int merge_unbalanced_gallop(KeysInputIterator  big_keys,
+                                     const unsigned int big_size,
+                                     const Key&         small_key,
+                                     const unsigned int guess,
+                                     BinaryFunction     compare_function)
+{
+    unsigned int begin = 0;
+    unsigned int end   = big_size;
+    if(guess < big_size
+       && merge_unbalanced_goes_before<SmallIsFirst>(big_keys[guess], small_key, compare_function))
+    {
+        begin = guess + 1;
+        for(unsigned int step = 1; begin + step - 1 < big_size; step *= 2)
+        {
+            const unsigned int probe = begin + step - 1;
+            if(!merge_unbalanced_goes_before<SmallIsFirst>(big_keys[probe],
+                                                           small_key,
+                                                           compare_function))
+            {
+                end = probe;
+                break;
+            }
+            begin = probe + 1;
+        }
+    }
+    else
+    {
+        end = guess;
+        for(unsigned int step = 1; step <= end; step *= 2)
+        {
+            const unsigned int probe = end - step;
+            if(merge_unbalanced_goes_before<SmallIsFirst>(big_keys[probe],
+                                                          small_key,
+                                                          compare_function))
+            {
+                begin = probe + 1;
+                break;
+            }
+            end = probe;
+        }
+    }
+
+    while(begin < end)
+    {
+        const unsigned int mid = begin + (end - begin) / 2;
+        if(merge_unbalanced_goes_before<SmallIsFirst>(big_keys[mid], small_key, compare_function))
+        {
+            begin = mid + 1;
+        }
+        else
+        {
+            end = mid;
+        }
+    }
+    return begin;
+}
+
+template<bool WithValues, class ValuesInputIterator, class ValuesOutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+typename std::enable_if<WithValues>::type
+    merge_unbalanced_scatter_value(ValuesInputIterator  values_input,
+                                   ValuesOutputIterator values_output,
+                                   const unsigned int   input_index,
+                                   const unsigned int   output_index)
+{
+    values_output[output_index] = values_input[input_index];
+}
+
+template<bool WithValues, class ValuesInputIterator, class ValuesOutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+typename std::enable_if<!WithValues>::type
+    merge_unbalanced_scatter_value(ValuesInputIterator  values_input,
+                                   ValuesOutputIterator values_output,
+                                   const unsigned int   input_index,
+                                   const unsigned int   output_index)
+{
+    (void)values_input;
+    (void)values_output;
+    (void)input_index;
+    (void)output_index;
+}
+
+/// One thread per item of the smaller input: finds its rank in the larger input, stores the rank
+/// and writes the item straight to its final position.
+template<bool SmallIsFirst,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void merge_unbalanced_rank_kernel_impl(unsigned int*        ranks,
+                                       KeysInputIterator1   small_keys,
+                                       KeysInputIterator2   big_keys,
+                                       KeysOutputIterator   keys_output,
+                                       ValuesInputIterator  small_values,
+                                       ValuesOutputIterator values_output,
+                                       const unsigned int   small_size,
+                                       const unsigned int   big_size,
+                                       BinaryFunction       compare_function)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator1>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    const unsigned int id = ::rocprim::detail::block_id<0>() * ::rocprim::detail::block_size<0>()
+                            + ::rocprim::detail::block_thread_id<0>();
+    if(id >= small_size)
+    {
+        return;
+    }
+
+    const key_type     key   = small_keys[id];
+    const unsigned int guess = static_cast<unsigned int>(static_cast<unsigned long long>(id)
+                                                         * big_size / small_size);
+    const unsigned int rank
+        = merge_unbalanced_gallop<SmallIsFirst>(big_keys, big_size, key, guess, compare_function);
+
+    ranks[id]              = rank;
+    keys_output[rank + id] = key;
+    merge_unbalanced_scatter_value<with_values>(small_values, values_output, id, rank + id);
+}
+
+/// Copies one tile of the larger input. An item of the larger input at index \p j is shifted by the
+/// number of ranks that are not greater than \p j, which is constant across the tile unless an item
+/// of the smaller input lands inside it.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class InputIterator,
+         class OutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void merge_unbalanced_copy_tile(const unsigned int  flat_id,
+                                InputIterator       input,
+                                OutputIterator      output,
+                                const unsigned int* ranks,
+                                const unsigned int  first,
+                                const unsigned int  last,
+                                const unsigned int  block_offset,
+                                const unsigned int  valid)
+{
+    using type = typename std::iterator_traits<InputIterator>::value_type;
+
+    type items[ItemsPerThread];
+    block_load_direct_striped<BlockSize>(flat_id, input + block_offset, items, valid);
+
+    if(first == last)
+    {
+        block_store_direct_striped<BlockSize>(flat_id,
+                                              output + block_offset + first,
+                                              items,
+                                              valid);
+        return;
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int index = i * BlockSize + flat_id;
+        if(index < valid)
+        {
+            const unsigned int j = block_offset + index;
+            output[j + first + ::rocprim::upper_bound(ranks + first, last - first, j)] = items[i];
+        }
+    }
+}
+
+template<bool         WithValues,
+         unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+typename std::enable_if<WithValues>::type
+    merge_unbalanced_copy_values(const unsigned int   flat_id,
+                                 ValuesInputIterator  values_input,
+                                 ValuesOutputIterator values_output,
+                                 const unsigned int*  ranks,
+                                 const unsigned int   first,
+                                 const unsigned int   last,
+                                 const unsigned int   block_offset,
+                                 const unsigned int   valid)
+{
+    merge_unbalanced_copy_tile<BlockSize, ItemsPerThread>(flat_id,
+                                                          values_input,
+                                                          values_output,
+                                                          ranks,
+                                                          first,
+                                                          last,
+                                                          block_offset,
+                                                          valid);
+}
+
+template<bool         WithValues,
+         unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+typename std::enable_if<!WithValues>::type
+    merge_unbalanced_copy_values(const unsigned int   flat_id,
+                                 ValuesInputIterator  values_input,
+                                 ValuesOutputIterator values_output,
+                                 const unsigned int*  ranks,
+                                 const unsigned int   first,
+                                 const unsigned int   last,
+                                 const unsigned int   block_offset,
+                                 const unsigned int   valid)
+{
+    (void)flat_id;
+    (void)values_input;
+    (void)values_output;
+    (void)ranks;
+    (void)first;
+    (void)last;
+    (void)block_offset;
+    (void)valid;
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void merge_unbalanced_copy_kernel_impl(const unsigned int*  ranks,
+                                       KeysInputIterator    big_keys,
+                                       KeysOutputIterator   keys_output,
+                                       ValuesInputIterator  big_values,
+                                       ValuesOutputIterator values_output,
+                                       const unsigned int   small_size,
+                                       const unsigned int   big_size)
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_offset = ::rocprim::detail::block_id<0>() * items_per_block;
+    const unsigned int valid        = ::rocprim::min(items_per_block, big_size - block_offset);
+
+    // Numbers of items of the smaller input placed before the first and the last item of the tile.
+    const unsigned int tile_end = block_offset + valid - 1;
+    const unsigned int first    = ::rocprim::upper_bound(ranks, small_size, block_offset);
+    const unsigned int last
+        = first + ::rocprim::upper_bound(ranks + first, small_size - first, tile_end);
+
+    merge_unbalanced_copy_tile<BlockSize, ItemsPerThread>(flat_id,
+                                                          big_keys,
+                                                          keys_output,
+                                                          ranks,
+                                                          first,
+                                                          last,
+                                                          block_offset,
+                                                          valid);
+    merge_unbalanced_copy_values<with_values, BlockSize, ItemsPerThread>(flat_id,
+                                                                         big_values,
+                                                                         values_output,
+                                                                         ranks,
+                                                                         first,
+                                                                         last,
+                                                                         block_offset,
+                                                                         valid);
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
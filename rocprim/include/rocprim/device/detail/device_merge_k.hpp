@@ -0,0 +1,372 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_MERGE_K_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_MERGE_K_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/merge_path.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+#include "../../types/uninitialized_array.hpp"
+
+#include "../../block/block_reduce.hpp"
+#include "../../block/block_scan.hpp"
+
+#include "device_binary_search.hpp"
+
+#include <iterator>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The offsets of the runs in a tile are kept in shared memory by the merge kernel, and the
+// bounds of the runs in registers by the partition kernel, which limits the number of runs.
+constexpr unsigned int merge_k_max_runs = 1024;
+
+// Finds, for the first diag = tile * items_per_tile merged keys, how many come from every run
+// (multi-sequence selection). Keys are ordered by key, then by run, then by index, so the merge
+// is stable. The block narrows down [lo, hi) of every run: a pivot is taken in the middle of the
+// largest interval and the number of keys ordered before it, counted in the intervals with binary
+// searches, tells whether the pivot and the keys before it are selected or not.
+template<unsigned int BlockSize,
+         class KeysInputIterator,
+         class OffsetIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void merge_k_partition_kernel_impl(KeysInputIterator  keys_input,
+                                   OffsetIterator     begin_offsets,
+                                   OffsetIterator     end_offsets,
+                                   unsigned int*      splits,
+                                   const unsigned int size,
+                                   const unsigned int runs,
+                                   const unsigned int items_per_tile,
+                                   BinaryFunction     compare_function)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    constexpr unsigned int runs_per_thread = ceiling_div(merge_k_max_runs, BlockSize);
+
+    using block_reduce_pivot_type = block_reduce<unsigned long long, BlockSize>;
+    using block_reduce_count_type = block_reduce<unsigned int, BlockSize>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_reduce_pivot_type::storage_type pivot;
+        typename block_reduce_count_type::storage_type count;
+    } storage;
+    ROCPRIM_SHARED_MEMORY unsigned long long                pivot_shared;
+    ROCPRIM_SHARED_MEMORY unsigned int                      count_shared;
+    ROCPRIM_SHARED_MEMORY uninitialized_array<key_type, 1> pivot_key_shared;
+
+    const unsigned int flat_id = block_thread_id<0>();
+    const unsigned int tile    = block_id<0>();
+    const unsigned int diag
+        = static_cast<unsigned int>(min(size_t(tile) * items_per_tile, size_t(size)));
+
+    // The keys of [0, lo) of a run are selected and the keys of [hi, length) are not.
+    size_t       begin[runs_per_thread];
+    unsigned int lo[runs_per_thread];
+    unsigned int hi[runs_per_thread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < runs_per_thread; ++i)
+    {
+        const unsigned int run = i * BlockSize + flat_id;
+        lo[i]                  = 0;
+        hi[i]                  = 0;
+        if(run < runs)
+        {
+            begin[i]                  = begin_offsets[run];
+            const auto length = static_cast<unsigned int>(end_offsets[run] - begin[i]);
+            lo[i]                     = diag > size - length ? diag - (size - length) : 0;
+            hi[i]                     = min(length, diag);
+        }
+    }
+
+    while(true)
+    {
+        unsigned long long largest = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < runs_per_thread; ++i)
+        {
+            const unsigned int run = i * BlockSize + flat_id;
+            if(run < runs)
+            {
+                const unsigned long long interval = hi[i] - lo[i];
+                largest = max(largest, (interval << 32) | run);
+            }
+        }
+        block_reduce_pivot_type().reduce(largest,
+                                         largest,
+                                         storage.pivot,
+                                         ::rocprim::maximum<unsigned long long>());
+        if(flat_id == 0)
+        {
+            pivot_shared = largest;
+        }
+        ::rocprim::syncthreads();
+
+        const unsigned int pivot_run  = static_cast<unsigned int>(pivot_shared & 0xFFFFFFFFu);
+        const unsigned int pivot_size = static_cast<unsigned int>(pivot_shared >> 32);
+        if(pivot_size == 0)
+        {
+            break;
+        }
+
+        if(pivot_run % BlockSize == flat_id)
+        {
+            const unsigned int i = pivot_run / BlockSize;
+            pivot_key_shared.emplace(0, keys_input[begin[i] + lo[i] + pivot_size / 2]);
+        }
+        ::rocprim::syncthreads();
+        const key_type pivot_key = pivot_key_shared.get_unsafe_array()[0];
+
+        // The number of keys of every run ordered before the pivot, clamped to [lo, hi]
+        unsigned int counts[runs_per_thread];
+        unsigned int thread_count = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < runs_per_thread; ++i)
+        {
+            const unsigned int run = i * BlockSize + flat_id;
+            counts[i]              = lo[i];
+            if(run == pivot_run)
+            {
+                counts[i] = lo[i] + pivot_size / 2;
+            }
+            else if(run < runs)
+            {
+                const auto         window = keys_input + begin[i] + lo[i];
+                const unsigned int length = hi[i] - lo[i];
+                counts[i] += run < pivot_run
+                                 ? upper_bound_n(window, length, pivot_key, compare_function)
+                                 : lower_bound_n(window, length, pivot_key, compare_function);
+            }
+            thread_count += counts[i];
+        }
+        block_reduce_count_type().reduce(thread_count, thread_count, storage.count);
+        if(flat_id == 0)
+        {
+            count_shared = thread_count;
+        }
+        ::rocprim::syncthreads();
+
+        // The pivot is selected together with the keys before it, or neither of them is
+        const bool selected = count_shared < diag;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < runs_per_thread; ++i)
+        {
+            const unsigned int run = i * BlockSize + flat_id;
+            if(selected)
+            {
+                lo[i] = counts[i] + (run == pivot_run ? 1 : 0);
+            }
+            else if(run < runs)
+            {
+                hi[i] = counts[i];
+            }
+        }
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < runs_per_thread; ++i)
+    {
+        const unsigned int run = i * BlockSize + flat_id;
+        if(run < runs)
+        {
+            splits[size_t(tile) * runs + run] = lo[i];
+        }
+    }
+}
+
+// Merges the keys a tile takes from every run. The keys are loaded into shared memory once, one
+// run after the other, and adjacent groups of runs are merged in shared memory until one is left.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         bool         WithValues,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void merge_k_kernel_impl(KeysInputIterator    keys_input,
+                         ValuesInputIterator  values_input,
+                         KeysOutputIterator   keys_output,
+                         ValuesOutputIterator values_output,
+                         OffsetIterator       begin_offsets,
+                         const unsigned int*  splits,
+                         const unsigned int   size,
+                         const unsigned int   runs,
+                         BinaryFunction       compare_function)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    using block_scan_type = block_scan<unsigned int, BlockSize>;
+
+    ROCPRIM_SHARED_MEMORY typename block_scan_type::storage_type scan_storage;
+    ROCPRIM_SHARED_MEMORY uninitialized_array<key_type, items_per_block> keys_storage;
+    // The positions of the keys in the tile before the merge, to gather the values from
+    ROCPRIM_SHARED_MEMORY unsigned int sources_shared[WithValues ? items_per_block : 1];
+    ROCPRIM_SHARED_MEMORY unsigned int offsets[merge_k_max_runs + 1];
+    ROCPRIM_SHARED_MEMORY size_t       starts[merge_k_max_runs];
+
+    const unsigned int flat_id     = block_thread_id<0>();
+    const unsigned int tile        = block_id<0>();
+    const unsigned int tile_offset = tile * items_per_block;
+    const unsigned int count       = min(size - tile_offset, items_per_block);
+
+    // The offsets of the runs in the tile and the positions of their first keys in the input
+    unsigned int carry = 0;
+    for(unsigned int chunk = 0; chunk < runs; chunk += BlockSize)
+    {
+        const unsigned int run    = chunk + flat_id;
+        unsigned int       length = 0;
+        if(run < runs)
+        {
+            const unsigned int split = splits[size_t(tile) * runs + run];
+            length                   = splits[size_t(tile + 1) * runs + run] - split;
+            starts[run]              = begin_offsets[run] + split;
+        }
+        unsigned int offset;
+        unsigned int reduction;
+        block_scan_type().exclusive_scan(length, offset, 0u, reduction, scan_storage);
+        if(run < runs)
+        {
+            offsets[run] = carry + offset;
+        }
+        carry += reduction;
+        ::rocprim::syncthreads();
+    }
+    if(flat_id == 0)
+    {
+        offsets[runs] = carry;
+    }
+    ::rocprim::syncthreads();
+
+    // The run of the key at position of the tile
+    const auto run_of = [&](const unsigned int position)
+    { return upper_bound_n(offsets, runs + 1, position, ::rocprim::less<unsigned int>()) - 1; };
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int position = i * BlockSize + flat_id;
+        if(position < count)
+        {
+            const unsigned int run = run_of(position);
+            keys_storage.emplace(position, keys_input[starts[run] + position - offsets[run]]);
+            if ROCPRIM_IF_CONSTEXPR(WithValues)
+            {
+                sources_shared[position] = position;
+            }
+        }
+    }
+    ::rocprim::syncthreads();
+
+    key_type* keys_shared = keys_storage.get_unsafe_array();
+    for(unsigned int width = 1; width < runs; width *= 2)
+    {
+        key_type     keys[ItemsPerThread];
+        unsigned int sources[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int position = i * BlockSize + flat_id;
+            if(position < count)
+            {
+                // The group of 2 * width runs of the key is merged from its two halves
+                const unsigned int first  = run_of(position) / (2 * width) * (2 * width);
+                const unsigned int begin1 = offsets[first];
+                const unsigned int begin2 = offsets[min(first + width, runs)];
+                const unsigned int end2   = offsets[min(first + 2 * width, runs)];
+                const unsigned int diag   = position - begin1;
+                const unsigned int size1  = begin2 - begin1;
+                const unsigned int size2  = end2 - begin2;
+
+                const unsigned int index1 = merge_path(keys_shared + begin1,
+                                                       keys_shared + begin2,
+                                                       size1,
+                                                       size2,
+                                                       diag,
+                                                       compare_function);
+                const unsigned int index2 = diag - index1;
+                const bool         take1
+                    = index1 < size1
+                      && (index2 >= size2
+                          || !compare_function(keys_shared[begin2 + index2],
+                                               keys_shared[begin1 + index1]));
+                const unsigned int index = take1 ? begin1 + index1 : begin2 + index2;
+
+                keys[i] = keys_shared[index];
+                if ROCPRIM_IF_CONSTEXPR(WithValues)
+                {
+                    sources[i] = sources_shared[index];
+                }
+            }
+        }
+        ::rocprim::syncthreads();
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int position = i * BlockSize + flat_id;
+            if(position < count)
+            {
+                keys_shared[position] = keys[i];
+                if ROCPRIM_IF_CONSTEXPR(WithValues)
+                {
+                    sources_shared[position] = sources[i];
+                }
+            }
+        }
+        ::rocprim::syncthreads();
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int position = i * BlockSize + flat_id;
+        if(position < count)
+        {
+            keys_output[tile_offset + position] = keys_shared[position];
+            if ROCPRIM_IF_CONSTEXPR(WithValues)
+            {
+                const unsigned int source = sources_shared[position];
+                const unsigned int run    = run_of(source);
+                values_output[tile_offset + position]
+                    = values_input[starts[run] + source - offsets[run]];
+            }
+        }
+    }
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_MERGE_K_HPP_
@@ -329,7 +329,7 @@ template<typename Key, unsigned int BlockSize, unsigned int ItemsPerThread>
 struct block_sort_impl<Key, rocprim::empty_type, BlockSize, ItemsPerThread>
 {
     using keys_load_type
-        = block_load<Key, BlockSize, ItemsPerThread, block_load_method::block_load_transpose>;
+        = block_load<Key, BlockSize, ItemsPerThread, block_load_method::block_load_direct_to_lds>;
 
     using sort_type = block_sort<Key,
                                  BlockSize,
@@ -391,10 +391,10 @@ struct block_sort_impl<Key,
                        std::enable_if_t<(sizeof(Value) <= sizeof(int))>>
 {
     using keys_load_type
-        = block_load<Key, BlockSize, ItemsPerThread, block_load_method::block_load_transpose>;
+        = block_load<Key, BlockSize, ItemsPerThread, block_load_method::block_load_direct_to_lds>;
 
     using values_load_type
-        = block_load<Value, BlockSize, ItemsPerThread, block_load_method::block_load_transpose>;
+        = block_load<Value, BlockSize, ItemsPerThread, block_load_method::block_load_direct_to_lds>;
 
     using sort_type = block_sort<Key,
                                  BlockSize,
@@ -471,7 +471,7 @@ struct block_sort_impl<Key,
                        std::enable_if_t<(sizeof(Value) > sizeof(int))>>
 {
     using keys_load_type
-        = block_load<Key, BlockSize, ItemsPerThread, block_load_method::block_load_transpose>;
+        = block_load<Key, BlockSize, ItemsPerThread, block_load_method::block_load_direct_to_lds>;
 
     using sort_type = block_sort<Key,
                                  BlockSize,
@@ -591,6 +591,172 @@ void block_sort_kernel_impl(KeysInputIterator    keys_input,
                      storage);
 }
 
+// Flags of a tile of merge_sort_adaptive, found by merge_sort_detect_runs_kernel_impl
+constexpr unsigned char merge_sort_tile_unsorted = 1; // The keys of the tile are not sorted
+constexpr unsigned char merge_sort_tile_descent = 2; // The first key precedes the previous key
+
+// Finds the flags of a tile of the keys of block_sort_kernel_impl
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeysInputIterator,
+         class OffsetT,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void merge_sort_detect_runs_kernel_impl(KeysInputIterator  keys_input,
+                                        const OffsetT      input_size,
+                                        const unsigned int num_blocks,
+                                        unsigned char*     tile_flags,
+                                        BinaryFunction     compare_function)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id       = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id = ::rocprim::flat_block_id();
+    if(flat_block_id >= num_blocks)
+    {
+        return;
+    }
+
+    const OffsetT      block_offset  = static_cast<OffsetT>(flat_block_id) * items_per_block;
+    const unsigned int valid         = ::rocprim::min<OffsetT>(input_size - block_offset,
+                                                               items_per_block);
+    const unsigned int thread_offset = flat_id * ItemsPerThread;
+
+    ROCPRIM_SHARED_MEMORY bool unsorted;
+    if(flat_id == 0)
+    {
+        unsorted = false;
+    }
+
+    key_type keys[ItemsPerThread];
+    block_load_direct_blocked(flat_id, keys_input + block_offset, keys, valid);
+
+    bool descent = false;
+    if(thread_offset < valid)
+    {
+        if(flat_id != 0)
+        {
+            const key_type previous = keys_input[block_offset + thread_offset - 1];
+            descent                 = compare_function(keys[0], previous);
+        }
+        ROCPRIM_UNROLL
+        for(unsigned int i = 1; i < ItemsPerThread; i++)
+        {
+            if(thread_offset + i < valid && compare_function(keys[i], keys[i - 1]))
+            {
+                descent = true;
+            }
+        }
+    }
+
+    ::rocprim::syncthreads();
+    if(descent)
+    {
+        unsorted = true;
+    }
+    ::rocprim::syncthreads();
+
+    if(flat_id == 0)
+    {
+        unsigned char flags = unsorted ? merge_sort_tile_unsorted : 0;
+        if(block_offset != 0 && compare_function(keys[0], keys_input[block_offset - 1]))
+        {
+            flags |= merge_sort_tile_descent;
+        }
+        tile_flags[flat_block_id] = flags;
+    }
+}
+
+// A tile starts a run if it is not sorted, or if together with the previous tile it is not
+// sorted. The tile past the last one starts a run, so that the offsets of the runs end with the
+// size of the input.
+struct merge_sort_is_run_start
+{
+    const unsigned char* tile_flags;
+    unsigned int         num_tiles;
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator()(const unsigned int tile) const
+    {
+        return tile == 0 || tile == num_tiles
+               || (tile_flags[tile] & (merge_sort_tile_unsorted | merge_sort_tile_descent)) != 0
+               || (tile_flags[tile - 1] & merge_sort_tile_unsorted) != 0;
+    }
+};
+
+template<class OffsetT>
+struct merge_sort_tile_offset
+{
+    unsigned int items_per_tile;
+    OffsetT      input_size;
+
+    ROCPRIM_HOST_DEVICE inline
+    OffsetT operator()(const unsigned int tile) const
+    {
+        return ::rocprim::min(static_cast<OffsetT>(tile) * items_per_tile, input_size);
+    }
+};
+
+// Sorts the tiles of block_sort_kernel_impl that are not sorted yet, and copies the rest.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetT,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void block_sort_adaptive_kernel_impl(KeysInputIterator    keys_input,
+                                     KeysOutputIterator   keys_output,
+                                     ValuesInputIterator  values_input,
+                                     ValuesOutputIterator values_output,
+                                     const OffsetT        input_size,
+                                     const unsigned int   num_blocks,
+                                     const unsigned char* tile_flags,
+                                     BinaryFunction       compare_function)
+{
+    using key_type             = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type           = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_block_id = ::rocprim::flat_block_id();
+    if(flat_block_id >= num_blocks)
+    {
+        return;
+    }
+
+    if((tile_flags[flat_block_id] & merge_sort_tile_unsorted) != 0)
+    {
+        block_sort_kernel_impl<BlockSize, ItemsPerThread>(keys_input,
+                                                          keys_output,
+                                                          values_input,
+                                                          values_output,
+                                                          input_size,
+                                                          num_blocks,
+                                                          compare_function);
+        return;
+    }
+
+    const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
+    const OffsetT      block_offset = static_cast<OffsetT>(flat_block_id) * items_per_block;
+    const unsigned int valid = ::rocprim::min<OffsetT>(input_size - block_offset, items_per_block);
+
+    key_type keys[ItemsPerThread];
+    block_load_direct_blocked(flat_id, keys_input + block_offset, keys, valid);
+    block_store_direct_blocked(flat_id, keys_output + block_offset, keys, valid);
+    if ROCPRIM_IF_CONSTEXPR(with_values)
+    {
+        value_type values[ItemsPerThread];
+        block_load_direct_blocked(flat_id, values_input + block_offset, values, valid);
+        block_store_direct_blocked(flat_id, values_output + block_offset, values, valid);
+    }
+}
+
 template<unsigned int BlockSize,
          unsigned int ItemsPerThread,
          class KeysInputIterator,
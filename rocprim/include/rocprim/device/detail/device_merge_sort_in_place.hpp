@@ -0,0 +1,245 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_MERGE_SORT_IN_PLACE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_MERGE_SORT_IN_PLACE_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/merge_path.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+
+#include "device_merge_sort_mergepath.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The in-place merge of two sorted blocks A and B of sorted_block_size items splits the merged
+// output into pieces of ItemsPerPiece items with the partitions of
+// device_block_merge_mergepath_partition_kernel, such that piece i is the merge of A_i and B_i.
+// The layout A_0 .. A_k B_0 .. B_k is then rearranged into A_0 B_0 .. A_k B_k with rotations,
+// which are done by reversals, and finally every piece is merged on its own. Only the
+// partitions are stored outside of the keys and values.
+template<class OffsetT>
+struct merge_in_place_pair
+{
+    OffsetT      begin; // Start of A
+    OffsetT      mid; // End of A and start of B
+    OffsetT      end; // End of B
+    unsigned int pieces;
+};
+
+template<unsigned int ItemsPerPiece, class OffsetT>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+merge_in_place_pair<OffsetT> merge_in_place_get_pair(const OffsetT position,
+                                                     const OffsetT input_size,
+                                                     const OffsetT sorted_block_size)
+{
+    const OffsetT begin = position / (2 * sorted_block_size) * (2 * sorted_block_size);
+    const OffsetT mid   = ::rocprim::min(input_size, begin + sorted_block_size);
+    const OffsetT end   = ::rocprim::min(input_size, begin + 2 * sorted_block_size);
+    return merge_in_place_pair<OffsetT>{
+        begin,
+        mid,
+        end,
+        static_cast<unsigned int>(ceiling_div(end - begin, ItemsPerPiece))};
+}
+
+// The starts of A_i and B_i in the layout before the rearrangement
+template<unsigned int ItemsPerPiece, class OffsetT>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void merge_in_place_split(const merge_in_place_pair<OffsetT>& pair,
+                          const unsigned int                  piece,
+                          const OffsetT*                      merge_partitions,
+                          OffsetT&                            a,
+                          OffsetT&                            b)
+{
+    if(piece == pair.pieces)
+    {
+        a = pair.mid;
+        b = pair.end;
+        return;
+    }
+    a = merge_partitions[pair.begin / ItemsPerPiece + piece];
+    b = pair.mid + static_cast<OffsetT>(piece) * ItemsPerPiece - (a - pair.begin);
+}
+
+// One step of a level of the rearrangement. Before the level, the pieces of each aligned range of
+// pieces_per_range pieces are laid out as [A_i0 .. A_i1][B_i0 .. B_i1]. The level rotates
+// X = A_m .. A_i1 and Y = B_i0 .. B_m with the middle piece m, so that afterwards both halves of
+// the range have the same layout. Step 0 reverses X and Y on their own, step 1 reverses XY.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerPiece,
+         unsigned int Step,
+         class KeysIterator,
+         class ValuesIterator,
+         class OffsetT>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void merge_in_place_reverse_kernel_impl(KeysIterator       keys,
+                                        ValuesIterator     values,
+                                        const OffsetT      input_size,
+                                        const OffsetT      sorted_block_size,
+                                        const unsigned int pieces_per_range,
+                                        const OffsetT*     merge_partitions)
+{
+    using value_type           = typename std::iterator_traits<ValuesIterator>::value_type;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    const OffsetT position = static_cast<OffsetT>(::rocprim::detail::block_id<0>()) * BlockSize
+                             + ::rocprim::detail::block_thread_id<0>();
+    if(position >= input_size)
+    {
+        return;
+    }
+
+    const merge_in_place_pair<OffsetT> pair
+        = merge_in_place_get_pair<ItemsPerPiece>(position, input_size, sorted_block_size);
+    if(pair.mid == pair.end)
+    {
+        // The last block has nothing to be merged with
+        return;
+    }
+
+    const OffsetT      range_items = static_cast<OffsetT>(pieces_per_range) * ItemsPerPiece;
+    const unsigned int first_piece
+        = static_cast<unsigned int>((position - pair.begin) / range_items) * pieces_per_range;
+    const unsigned int last_piece = ::rocprim::min(first_piece + pieces_per_range, pair.pieces);
+    const unsigned int mid_piece
+        = ::rocprim::min(first_piece + pieces_per_range / 2, pair.pieces);
+    if(mid_piece >= last_piece)
+    {
+        return;
+    }
+
+    OffsetT a_first, b_first, a_mid, b_mid, a_last, b_last;
+    merge_in_place_split<ItemsPerPiece>(pair, first_piece, merge_partitions, a_first, b_first);
+    merge_in_place_split<ItemsPerPiece>(pair, mid_piece, merge_partitions, a_mid, b_mid);
+    merge_in_place_split<ItemsPerPiece>(pair, last_piece, merge_partitions, a_last, b_last);
+
+    const OffsetT x_begin
+        = pair.begin + static_cast<OffsetT>(first_piece) * ItemsPerPiece + (a_mid - a_first);
+    const OffsetT y_begin = x_begin + (a_last - a_mid);
+    const OffsetT y_end   = y_begin + (b_mid - b_first);
+
+    OffsetT mirror;
+    if ROCPRIM_IF_CONSTEXPR(Step == 0)
+    {
+        if(position >= x_begin && position < y_begin)
+        {
+            mirror = x_begin + y_begin - 1 - position;
+        }
+        else if(position >= y_begin && position < y_end)
+        {
+            mirror = y_begin + y_end - 1 - position;
+        }
+        else
+        {
+            return;
+        }
+    }
+    else
+    {
+        if(position < x_begin || position >= y_end)
+        {
+            return;
+        }
+        mirror = x_begin + y_end - 1 - position;
+    }
+
+    // Every pair of items is swapped by the thread of the first item
+    if(position < mirror)
+    {
+        auto key         = keys[position];
+        keys[position]   = keys[mirror];
+        keys[mirror]     = key;
+        if ROCPRIM_IF_CONSTEXPR(with_values)
+        {
+            auto value       = values[position];
+            values[position] = values[mirror];
+            values[mirror]   = value;
+        }
+    }
+}
+
+// Merges A_i and B_i of a piece after the rearrangement, they are next to each other and the
+// merged piece replaces them.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeysIterator,
+         class ValuesIterator,
+         class OffsetT,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void block_merge_in_place_kernel_impl(KeysIterator       keys,
+                                      ValuesIterator     values,
+                                      const OffsetT      input_size,
+                                      const OffsetT      sorted_block_size,
+                                      const unsigned int num_blocks,
+                                      BinaryFunction     compare_function,
+                                      const OffsetT*     merge_partitions)
+{
+    constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_block_id = ::rocprim::flat_block_id();
+    if(flat_block_id >= num_blocks)
+    {
+        return;
+    }
+
+    const OffsetT tile_begin = static_cast<OffsetT>(flat_block_id) * items_per_tile;
+    const merge_in_place_pair<OffsetT> pair
+        = merge_in_place_get_pair<items_per_tile>(tile_begin, input_size, sorted_block_size);
+    if(pair.mid == pair.end)
+    {
+        return;
+    }
+
+    const unsigned int piece
+        = static_cast<unsigned int>((tile_begin - pair.begin) / items_per_tile);
+    OffsetT a_begin, b_begin, a_end, b_end;
+    merge_in_place_split<items_per_tile>(pair, piece, merge_partitions, a_begin, b_begin);
+    merge_in_place_split<items_per_tile>(pair, piece + 1, merge_partitions, a_end, b_end);
+
+    const OffsetT keys1_end = tile_begin + (a_end - a_begin);
+    const OffsetT keys2_end = keys1_end + (b_end - b_begin);
+
+    // All items of the tile are loaded before any of them is stored, so the tile can be merged
+    // in place
+    block_merge_process_tile<BlockSize, ItemsPerThread>(
+        keys,
+        keys,
+        values,
+        values,
+        input_size,
+        flat_block_id,
+        range_t<OffsetT>{tile_begin, keys1_end, keys1_end, keys2_end},
+        compare_function);
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_MERGE_SORT_IN_PLACE_HPP_
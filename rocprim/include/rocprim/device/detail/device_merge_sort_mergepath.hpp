@@ -35,6 +35,7 @@
 
 #include "device_merge_sort.hpp"
 #include "device_merge.hpp"
+#include "grid_barrier.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -101,10 +102,9 @@ namespace detail
                                                                       ValuesInputIterator  values_input,
                                                                       ValuesOutputIterator values_output,
                                                                       const OffsetT        input_size,
-                                                                      const OffsetT  sorted_block_size,
-                                                                      const unsigned int   num_blocks,
-                                                                      BinaryFunction compare_function,
-                                                                      const OffsetT* merge_partitions)
+                                                                      const unsigned int flat_block_id,
+                                                                      const range_t<OffsetT> range,
+                                                                      BinaryFunction compare_function)
         -> std::enable_if_t<(!std::is_trivially_copyable<ValueType>::value
                              || rocprim::is_floating_point<ValueType>::value
                              || std::is_integral<ValueType>::value),
@@ -132,37 +132,13 @@ namespace detail
         auto& values_shared = storage.values.get();
 
         const unsigned short flat_id = block_thread_id<0>();
-        const unsigned int flat_block_id = ::rocprim::flat_block_id();
-        if(flat_block_id >= num_blocks)
-        {
-            return;
-        }
 
         const bool is_incomplete_tile = flat_block_id == (input_size / items_per_tile);
 
-        const OffsetT partition_beg = merge_partitions[flat_block_id];
-        const OffsetT partition_end = merge_partitions[flat_block_id + 1];
-
-        const unsigned int merged_tiles_number = sorted_block_size / items_per_tile;
-        const unsigned int target_merged_tiles_number = merged_tiles_number * 2;
-        const unsigned int mask  = target_merged_tiles_number - 1;
-        const unsigned int tilegroup_start_id  = ~mask & flat_block_id;
-
-        const OffsetT tilegroup_start
-            = static_cast<OffsetT>(tilegroup_start_id) * items_per_tile; // Tile-group starts here
-        const OffsetT diag = static_cast<OffsetT>(flat_block_id) * items_per_tile - tilegroup_start;
-
-
-        const OffsetT keys1_beg = partition_beg;
-        OffsetT keys1_end = partition_end;
-        const OffsetT keys2_beg = rocprim::min(input_size, 2 * tilegroup_start + sorted_block_size + diag - partition_beg);
-        OffsetT keys2_end = rocprim::min(input_size, 2 * tilegroup_start + sorted_block_size + diag + items_per_tile - partition_end);
-
-        if (mask == (mask & flat_block_id)) // If last tile in the tile-group
-        {
-            keys1_end = rocprim::min(input_size, tilegroup_start + sorted_block_size);
-            keys2_end = rocprim::min(input_size, tilegroup_start + sorted_block_size * 2);
-        }
+        const OffsetT keys1_beg = range.begin1;
+        const OffsetT keys1_end = range.end1;
+        const OffsetT keys2_beg = range.begin2;
+        const OffsetT keys2_end = range.end2;
 
         // Number of keys per tile
         const unsigned int num_keys1 = static_cast<unsigned int>(keys1_end - keys1_beg);
@@ -254,10 +230,9 @@ namespace detail
                                                                       ValuesInputIterator  values_input,
                                                                       ValuesOutputIterator values_output,
                                                                       const OffsetT        input_size,
-                                                                      const OffsetT  sorted_block_size,
-                                                                      const unsigned int   num_blocks,
-                                                                      BinaryFunction compare_function,
-                                                                      const OffsetT* merge_partitions)
+                                                                      const unsigned int flat_block_id,
+                                                                      const range_t<OffsetT> range,
+                                                                      BinaryFunction compare_function)
         -> std::enable_if_t<(std::is_trivially_copyable<ValueType>::value
                              && !rocprim::is_floating_point<ValueType>::value
                              && !std::is_integral<ValueType>::value),
@@ -284,37 +259,14 @@ namespace detail
         auto& keys_shared = storage.keys.get();
         auto& values_shared = storage.values.get();
 
-        const unsigned short flat_id            = block_thread_id<0>();
-        const unsigned int flat_block_id = ::rocprim::flat_block_id();
-        if(flat_block_id >= num_blocks)
-        {
-            return;
-        }
+        const unsigned short flat_id = block_thread_id<0>();
 
         const bool is_incomplete_tile = flat_block_id == (input_size / items_per_tile);
 
-        const OffsetT partition_beg = merge_partitions[flat_block_id];
-        const OffsetT partition_end = merge_partitions[flat_block_id + 1];
-
-        const unsigned int merged_tiles_number = sorted_block_size / items_per_tile;
-        const unsigned int target_merged_tiles_number = merged_tiles_number * 2;
-        const unsigned int mask  = target_merged_tiles_number - 1;
-        const unsigned int tilegroup_start_id  = ~mask & flat_block_id;
-        const OffsetT tilegroup_start
-            = static_cast<OffsetT>(tilegroup_start_id) * items_per_tile; // Tile-group starts here
-        const OffsetT diag = static_cast<OffsetT>(flat_block_id) * items_per_tile - tilegroup_start;
-
-
-        const OffsetT keys1_beg = partition_beg;
-        OffsetT keys1_end = partition_end;
-        const OffsetT keys2_beg = rocprim::min(input_size, 2 * tilegroup_start + sorted_block_size + diag - partition_beg);
-        OffsetT keys2_end = rocprim::min(input_size, 2 * tilegroup_start + sorted_block_size + diag + items_per_tile - partition_end);
-
-        if (mask == (mask & flat_block_id)) // If last tile in the tile-group
-        {
-            keys1_end = rocprim::min(input_size, tilegroup_start + sorted_block_size);
-            keys2_end = rocprim::min(input_size, tilegroup_start + sorted_block_size * 2);
-        }
+        const OffsetT keys1_beg = range.begin1;
+        const OffsetT keys1_end = range.end1;
+        const OffsetT keys2_beg = range.begin2;
+        const OffsetT keys2_end = range.end2;
 
         // Number of keys per tile
         const unsigned int num_keys1 = static_cast<unsigned int>(keys1_end - keys1_beg);
@@ -428,6 +380,135 @@ namespace detail
                             storage.store);
     }
 
+    // The start in the first sorted block of the items of partition_id in the merge of pairs of
+    // sorted blocks of sorted_block_size items, where partition_id * items_per_tile is the
+    // position in the output of the merge.
+    template<unsigned int ItemsPerTile, class KeysInputIterator, class OffsetT, class CompareOpT>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    OffsetT block_merge_mergepath_partition(KeysInputIterator  keys,
+                                            const OffsetT      input_size,
+                                            const unsigned int partition_id,
+                                            const CompareOpT   compare_op,
+                                            const OffsetT      sorted_block_size)
+    {
+        const unsigned int merged_tiles        = sorted_block_size / ItemsPerTile;
+        const unsigned int target_merged_tiles = merged_tiles * 2;
+        const unsigned int mask                = target_merged_tiles - 1;
+
+        // id of the first tile in the current tile-group
+        const unsigned int tilegroup_start_id = ~mask & partition_id;
+        // id of the current tile in the current tile-group
+        const unsigned int local_tile_id = mask & partition_id;
+
+        // index of the first item in the current tile-group
+        const OffsetT tilegroup_start = static_cast<OffsetT>(tilegroup_start_id) * ItemsPerTile;
+
+        const OffsetT keys1_beg = rocprim::min(input_size, tilegroup_start);
+        const OffsetT keys1_end = rocprim::min(input_size, tilegroup_start + sorted_block_size);
+        const OffsetT keys2_beg = keys1_end;
+        const OffsetT keys2_end = rocprim::min(input_size, keys2_beg + sorted_block_size);
+
+        const OffsetT partition_at = rocprim::min(keys2_end - keys1_beg,
+                                                  static_cast<OffsetT>(local_tile_id)
+                                                      * ItemsPerTile);
+
+        const OffsetT partition_diag = ::rocprim::detail::merge_path(keys + keys1_beg,
+                                                                     keys + keys2_beg,
+                                                                     keys1_end - keys1_beg,
+                                                                     keys2_end - keys2_beg,
+                                                                     partition_at,
+                                                                     compare_op);
+
+        return keys1_beg + partition_diag;
+    }
+
+    // Merges tile tile_id of the merge of pairs of sorted blocks of sorted_block_size items,
+    // between the partitions of block_merge_mergepath_partition of tile_id and tile_id + 1.
+    template<unsigned int BlockSize,
+             unsigned int ItemsPerThread,
+             class KeysInputIterator,
+             class KeysOutputIterator,
+             class ValuesInputIterator,
+             class ValuesOutputIterator,
+             class OffsetT,
+             class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+        block_merge_mergepath_tile(KeysInputIterator    keys_input,
+                                   KeysOutputIterator   keys_output,
+                                   ValuesInputIterator  values_input,
+                                   ValuesOutputIterator values_output,
+                                   const OffsetT        input_size,
+                                   const OffsetT        sorted_block_size,
+                                   const unsigned int   tile_id,
+                                   BinaryFunction       compare_function,
+                                   const OffsetT        partition_beg,
+                                   const OffsetT        partition_end)
+    {
+        constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+
+        const unsigned int merged_tiles_number = sorted_block_size / items_per_tile;
+        const unsigned int target_merged_tiles_number = merged_tiles_number * 2;
+        const unsigned int mask  = target_merged_tiles_number - 1;
+        const unsigned int tilegroup_start_id  = ~mask & tile_id;
+
+        const OffsetT tilegroup_start
+            = static_cast<OffsetT>(tilegroup_start_id) * items_per_tile; // Tile-group starts here
+        const OffsetT diag = static_cast<OffsetT>(tile_id) * items_per_tile - tilegroup_start;
+
+        const OffsetT keys1_beg = partition_beg;
+        OffsetT keys1_end = partition_end;
+        const OffsetT keys2_beg = rocprim::min(input_size, 2 * tilegroup_start + sorted_block_size + diag - partition_beg);
+        OffsetT keys2_end = rocprim::min(input_size, 2 * tilegroup_start + sorted_block_size + diag + items_per_tile - partition_end);
+
+        if (mask == (mask & tile_id)) // If last tile in the tile-group
+        {
+            keys1_end = rocprim::min(input_size, tilegroup_start + sorted_block_size);
+            keys2_end = rocprim::min(input_size, tilegroup_start + sorted_block_size * 2);
+        }
+
+        block_merge_process_tile<BlockSize, ItemsPerThread>(
+            keys_input,
+            keys_output,
+            values_input,
+            values_output,
+            input_size,
+            tile_id,
+            range_t<OffsetT>{keys1_beg, keys1_end, keys2_beg, keys2_end},
+            compare_function);
+    }
+
+    // Merges tile tile_id between the partitions of all tiles in merge_partitions.
+    template<unsigned int BlockSize,
+             unsigned int ItemsPerThread,
+             class KeysInputIterator,
+             class KeysOutputIterator,
+             class ValuesInputIterator,
+             class ValuesOutputIterator,
+             class OffsetT,
+             class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+        block_merge_mergepath_tile(KeysInputIterator    keys_input,
+                                   KeysOutputIterator   keys_output,
+                                   ValuesInputIterator  values_input,
+                                   ValuesOutputIterator values_output,
+                                   const OffsetT        input_size,
+                                   const OffsetT        sorted_block_size,
+                                   const unsigned int   tile_id,
+                                   BinaryFunction       compare_function,
+                                   const OffsetT*       merge_partitions)
+    {
+        block_merge_mergepath_tile<BlockSize, ItemsPerThread>(keys_input,
+                                                              keys_output,
+                                                              values_input,
+                                                              values_output,
+                                                              input_size,
+                                                              sorted_block_size,
+                                                              tile_id,
+                                                              compare_function,
+                                                              merge_partitions[tile_id],
+                                                              merge_partitions[tile_id + 1]);
+    }
+
     template<unsigned int BlockSize,
              unsigned int ItemsPerThread,
              class KeysInputIterator,
@@ -447,15 +528,231 @@ namespace detail
                                      BinaryFunction       compare_function,
                                      const OffsetT*       merge_partitions)
     {
-        block_merge_process_tile<BlockSize, ItemsPerThread>(keys_input,
-                                                            keys_output,
-                                                            values_input,
-                                                            values_output,
-                                                            input_size,
-                                                            sorted_block_size,
-                                                            num_blocks,
-                                                            compare_function,
-                                                            merge_partitions);
+        const unsigned int flat_block_id = ::rocprim::flat_block_id();
+        if(flat_block_id >= num_blocks)
+        {
+            return;
+        }
+
+        block_merge_mergepath_tile<BlockSize, ItemsPerThread>(keys_input,
+                                                              keys_output,
+                                                              values_input,
+                                                              values_output,
+                                                              input_size,
+                                                              sorted_block_size,
+                                                              flat_block_id,
+                                                              compare_function,
+                                                              merge_partitions);
+    }
+
+    // One level of block_merge_persistent_kernel_impl: the partitions of all tiles are found
+    // with a grid stride over the threads, then the tiles are merged with a grid stride over the
+    // blocks.
+    template<unsigned int BlockSize,
+             unsigned int ItemsPerThread,
+             class KeysInputIterator,
+             class KeysOutputIterator,
+             class ValuesInputIterator,
+             class ValuesOutputIterator,
+             class OffsetT,
+             class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void block_merge_persistent_level(KeysInputIterator    keys_input,
+                                      KeysOutputIterator   keys_output,
+                                      ValuesInputIterator  values_input,
+                                      ValuesOutputIterator values_output,
+                                      const OffsetT        input_size,
+                                      const OffsetT        sorted_block_size,
+                                      const unsigned int   num_tiles,
+                                      BinaryFunction       compare_function,
+                                      OffsetT*             merge_partitions,
+                                      grid_barrier&        barrier)
+    {
+        constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+
+        const unsigned int flat_block_id = block_id<0>();
+        const unsigned int grid          = grid_size<0>();
+
+        for(unsigned int partition_id = flat_block_id * BlockSize + block_thread_id<0>();
+            partition_id <= num_tiles;
+            partition_id += grid * BlockSize)
+        {
+            merge_partitions[partition_id]
+                = block_merge_mergepath_partition<items_per_tile>(keys_input,
+                                                                  input_size,
+                                                                  partition_id,
+                                                                  compare_function,
+                                                                  sorted_block_size);
+        }
+        barrier.sync();
+
+        for(unsigned int tile_id = flat_block_id; tile_id < num_tiles; tile_id += grid)
+        {
+            block_merge_mergepath_tile<BlockSize, ItemsPerThread>(keys_input,
+                                                                  keys_output,
+                                                                  values_input,
+                                                                  values_output,
+                                                                  input_size,
+                                                                  sorted_block_size,
+                                                                  tile_id,
+                                                                  compare_function,
+                                                                  merge_partitions);
+            // The shared memory of the tile is reused by the next one
+            ::rocprim::syncthreads();
+        }
+        barrier.sync();
+    }
+
+    // Merges the sorted blocks of sorted_block_size items until the whole input is sorted, with
+    // all levels of the merge in one launch. The levels are separated by grid barriers, so all
+    // blocks must be resident. The first level merges keys into keys_buffer, the next ones
+    // alternate between the two.
+    template<unsigned int BlockSize,
+             unsigned int ItemsPerThread,
+             class KeysIterator,
+             class ValuesIterator,
+             class OffsetT,
+             class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void block_merge_persistent_kernel_impl(
+        KeysIterator                                               keys,
+        typename std::iterator_traits<KeysIterator>::value_type*   keys_buffer,
+        ValuesIterator                                             values,
+        typename std::iterator_traits<ValuesIterator>::value_type* values_buffer,
+        const OffsetT                                              input_size,
+        OffsetT                                                    sorted_block_size,
+        const unsigned int                                         num_tiles,
+        BinaryFunction                                             compare_function,
+        OffsetT*                                                   merge_partitions,
+        unsigned int*                                              barrier_counter)
+    {
+        grid_barrier barrier(barrier_counter);
+
+        bool from_buffer = false;
+        for(; sorted_block_size < input_size; sorted_block_size *= 2)
+        {
+            if(from_buffer)
+            {
+                block_merge_persistent_level<BlockSize, ItemsPerThread>(keys_buffer,
+                                                                        keys,
+                                                                        values_buffer,
+                                                                        values,
+                                                                        input_size,
+                                                                        sorted_block_size,
+                                                                        num_tiles,
+                                                                        compare_function,
+                                                                        merge_partitions,
+                                                                        barrier);
+            }
+            else
+            {
+                block_merge_persistent_level<BlockSize, ItemsPerThread>(keys,
+                                                                        keys_buffer,
+                                                                        values,
+                                                                        values_buffer,
+                                                                        input_size,
+                                                                        sorted_block_size,
+                                                                        num_tiles,
+                                                                        compare_function,
+                                                                        merge_partitions,
+                                                                        barrier);
+            }
+            from_buffer = !from_buffer;
+        }
+    }
+
+    // The pair of runs that is merged into the output at position, when runs j and j + RunStride
+    // of the num_runs runs starting at run_offsets are merged for each j that is a multiple of
+    // 2 * RunStride. run_offsets[num_runs] is the size of the input. An unpaired last run is
+    // returned with an empty second run.
+    template<class OffsetT>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    range_t<OffsetT> merge_runs_pair(const OffsetT*     run_offsets,
+                                     const unsigned int num_runs,
+                                     const unsigned int run_stride,
+                                     const OffsetT      position)
+    {
+        const unsigned int pair_stride = 2 * run_stride;
+
+        unsigned int first = 0;
+        unsigned int last  = ceiling_div(num_runs, pair_stride);
+        while(last - first > 1)
+        {
+            const unsigned int mid = (first + last) / 2;
+            if(run_offsets[mid * pair_stride] <= position)
+            {
+                first = mid;
+            }
+            else
+            {
+                last = mid;
+            }
+        }
+
+        const unsigned int run    = first * pair_stride;
+        const OffsetT      middle = run_offsets[rocprim::min(run + run_stride, num_runs)];
+        return range_t<OffsetT>{run_offsets[run],
+                                middle,
+                                middle,
+                                run_offsets[rocprim::min(run + pair_stride, num_runs)]};
+    }
+
+    // Merges the pairs of runs of merge_runs_pair, which may have any length. The run offsets
+    // must be multiples of the items of a tile, except for the size of the input, so that every
+    // tile belongs to a single pair.
+    template<unsigned int BlockSize,
+             unsigned int ItemsPerThread,
+             class KeysInputIterator,
+             class KeysOutputIterator,
+             class ValuesInputIterator,
+             class ValuesOutputIterator,
+             class OffsetT,
+             class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+        block_merge_runs_kernel(KeysInputIterator    keys_input,
+                                KeysOutputIterator   keys_output,
+                                ValuesInputIterator  values_input,
+                                ValuesOutputIterator values_output,
+                                const OffsetT        input_size,
+                                const OffsetT*       run_offsets,
+                                const unsigned int   num_runs,
+                                const unsigned int   run_stride,
+                                const unsigned int   num_blocks,
+                                BinaryFunction       compare_function,
+                                const OffsetT*       merge_partitions)
+    {
+        constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+
+        const unsigned int flat_block_id = ::rocprim::flat_block_id();
+        if(flat_block_id >= num_blocks)
+        {
+            return;
+        }
+
+        const OffsetT          tile_beg = static_cast<OffsetT>(flat_block_id) * items_per_tile;
+        const range_t<OffsetT> pair
+            = merge_runs_pair(run_offsets, num_runs, run_stride, tile_beg);
+        const OffsetT diag = tile_beg - pair.begin1;
+
+        const OffsetT keys1_beg = merge_partitions[flat_block_id];
+        const OffsetT keys2_beg = pair.begin2 + diag - (keys1_beg - pair.begin1);
+        OffsetT       keys1_end = pair.end1;
+        OffsetT       keys2_end = pair.end2;
+        if(tile_beg + items_per_tile < pair.end2) // If not the last tile of the pair
+        {
+            keys1_end = merge_partitions[flat_block_id + 1];
+            keys2_end = pair.begin2 + diag + items_per_tile - (keys1_end - pair.begin1);
+        }
+
+        block_merge_process_tile<BlockSize, ItemsPerThread>(
+            keys_input,
+            keys_output,
+            values_input,
+            values_output,
+            input_size,
+            flat_block_id,
+            range_t<OffsetT>{keys1_beg, keys1_end, keys2_beg, keys2_end},
+            compare_function);
     }
 
 } // end of detail namespace
@@ -0,0 +1,356 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_MULTI_SEARCH_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_MULTI_SEARCH_HPP_
+
+#include "../../block/block_scan.hpp"
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+
+#include "device_config_helper.hpp"
+#include "lookback_scan_state.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The automaton of a device-level multi-pattern search, built by
+/// \p multi_search_build.
+///
+/// It refers to the storage that was passed to \p multi_search_build, so it is valid as long as
+/// that storage is. It can be copied freely.
+struct multi_search_automaton
+{
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    const unsigned char* byte_classes    = nullptr;
+    const unsigned int*  transitions     = nullptr;
+    const unsigned int*  output_offsets  = nullptr;
+    const unsigned int*  outputs         = nullptr;
+    const unsigned int*  pattern_lengths = nullptr;
+    unsigned int         classes         = 0;
+    unsigned int         max_length      = 0;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+};
+
+namespace detail
+{
+
+// An Aho-Corasick automaton over bytes, where the failure links are resolved into a complete
+// transition table. Bytes that do not occur in the patterns share one class, and every other
+// byte has its own class, which keeps the rows of the table short. The outputs of a state are
+// the patterns that end at it, longest first, stored as offsets into the outputs.
+struct multi_search_host_automaton
+{
+    std::vector<unsigned char> byte_classes;
+    std::vector<unsigned int>  transitions;
+    std::vector<unsigned int>  output_offsets;
+    std::vector<unsigned int>  outputs;
+    std::vector<unsigned int>  pattern_lengths;
+    unsigned int               classes    = 0;
+    unsigned int               max_length = 0;
+};
+
+template<class PatternsIterator, class OffsetsIterator>
+inline hipError_t build_multi_search_automaton(PatternsIterator             patterns,
+                                               OffsetsIterator              pattern_offsets,
+                                               const size_t                 patterns_count,
+                                               multi_search_host_automaton& automaton)
+{
+    constexpr unsigned int none = std::numeric_limits<unsigned int>::max();
+
+    if(patterns_count >= none)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    automaton.byte_classes.assign(256, 0);
+    automaton.classes    = 1;
+    automaton.max_length = 0;
+    for(size_t pattern = 0; pattern < patterns_count; ++pattern)
+    {
+        const size_t length = pattern_offsets[pattern + 1] - pattern_offsets[pattern];
+        if(length == 0 || length >= none)
+        {
+            return hipErrorInvalidValue;
+        }
+        automaton.max_length
+            = ::rocprim::max(automaton.max_length, static_cast<unsigned int>(length));
+        for(size_t i = pattern_offsets[pattern]; i < pattern_offsets[pattern + 1]; ++i)
+        {
+            unsigned char& byte_class
+                = automaton.byte_classes[static_cast<unsigned char>(patterns[i])];
+            // When all bytes occur, the last of them keeps class 0 to itself
+            if(byte_class == 0 && automaton.classes < 256)
+            {
+                byte_class = static_cast<unsigned char>(automaton.classes++);
+            }
+        }
+    }
+    const unsigned int classes = automaton.classes;
+
+    // The trie of the patterns, with the patterns that end at every state
+    std::vector<std::vector<unsigned int>> ends(1);
+    automaton.transitions.assign(classes, none);
+    automaton.pattern_lengths.resize(patterns_count);
+    for(size_t pattern = 0; pattern < patterns_count; ++pattern)
+    {
+        unsigned int state = 0;
+        for(size_t i = pattern_offsets[pattern]; i < pattern_offsets[pattern + 1]; ++i)
+        {
+            const unsigned int byte_class
+                = automaton.byte_classes[static_cast<unsigned char>(patterns[i])];
+            unsigned int& next = automaton.transitions[size_t(state) * classes + byte_class];
+            if(next == none)
+            {
+                if(ends.size() >= none)
+                {
+                    return hipErrorInvalidValue;
+                }
+                next = static_cast<unsigned int>(ends.size());
+                ends.emplace_back();
+                // The reference is invalidated by the resize
+                const unsigned int child = next;
+                automaton.transitions.resize(ends.size() * classes, none);
+                state = child;
+            }
+            else
+            {
+                state = next;
+            }
+        }
+        ends[state].push_back(static_cast<unsigned int>(pattern));
+        automaton.pattern_lengths[pattern] = static_cast<unsigned int>(
+            pattern_offsets[pattern + 1] - pattern_offsets[pattern]);
+    }
+    const size_t states = ends.size();
+
+    // Resolves the failure links in breadth-first order, where the failure state of a state is
+    // shallower, so its transitions and outputs are complete.
+    std::vector<unsigned int> failures(states, 0);
+    std::vector<unsigned int> order;
+    order.reserve(states);
+    order.push_back(0);
+    for(size_t i = 0; i < order.size(); ++i)
+    {
+        const unsigned int state = order[i];
+        for(unsigned int byte_class = 0; byte_class < classes; ++byte_class)
+        {
+            const size_t       failure_row = size_t(failures[state]) * classes;
+            unsigned int&      next = automaton.transitions[size_t(state) * classes + byte_class];
+            const unsigned int failure_next
+                = state == 0 ? 0 : automaton.transitions[failure_row + byte_class];
+            if(next == none)
+            {
+                next = failure_next;
+            }
+            else
+            {
+                failures[next] = failure_next;
+                order.push_back(next);
+            }
+        }
+    }
+
+    std::vector<size_t> output_counts(states, 0);
+    for(const unsigned int state : order)
+    {
+        output_counts[state]
+            = ends[state].size() + (state == 0 ? 0 : output_counts[failures[state]]);
+    }
+    automaton.output_offsets.resize(states + 1);
+    size_t total_outputs = 0;
+    for(size_t state = 0; state < states; ++state)
+    {
+        automaton.output_offsets[state] = static_cast<unsigned int>(total_outputs);
+        total_outputs += output_counts[state];
+        if(total_outputs >= none)
+        {
+            return hipErrorInvalidValue;
+        }
+    }
+    automaton.output_offsets[states] = static_cast<unsigned int>(total_outputs);
+
+    automaton.outputs.resize(total_outputs);
+    for(const unsigned int state : order)
+    {
+        auto output = automaton.outputs.begin() + automaton.output_offsets[state];
+        output      = std::copy(ends[state].begin(), ends[state].end(), output);
+        if(state != 0)
+        {
+            std::copy(automaton.outputs.begin() + automaton.output_offsets[failures[state]],
+                      automaton.outputs.begin() + automaton.output_offsets[failures[state] + 1],
+                      output);
+        }
+    }
+
+    return hipSuccess;
+}
+
+// Finds the matches of the patterns with a single pass over the input. Every thread runs the
+// automaton over its items, starting max_length - 1 items before them, so the state at its
+// first item is the same as when the automaton runs over the entire input. The numbers of
+// the matches that end at the items of the threads are scanned with look-back over the tiles,
+// which yields the offsets of the matches in the output, ordered by their end.
+//
+// The first block of a launch starts from the matches of the preceding launches in carry, which
+// the initialization of the scan state saves from the last block of the preceding launch.
+template<class Config,
+         class InputIterator,
+         class PositionsOutputIterator,
+         class PatternsOutputIterator,
+         class MatchesCountOutputIterator,
+         class LookbackScanState>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void multi_search_kernel(InputIterator              input,
+                         const size_t               launch_offset,
+                         const size_t               size,
+                         const multi_search_automaton automaton,
+                         PositionsOutputIterator    positions_output,
+                         PatternsOutputIterator     patterns_output,
+                         MatchesCountOutputIterator matches_count_output,
+                         const size_t               max_matches,
+                         LookbackScanState          scan_state,
+                         const size_t*              carry)
+{
+    static constexpr multi_search_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.kernel_config.block_size;
+    constexpr unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using block_scan_type = block_scan<size_t, block_size>;
+    using prefix_op_type  = offset_lookback_scan_prefix_op<size_t, LookbackScanState>;
+
+    ROCPRIM_SHARED_MEMORY unsigned char byte_classes[256];
+    ROCPRIM_SHARED_MEMORY typename block_scan_type::storage_type storage_scan;
+    ROCPRIM_SHARED_MEMORY typename prefix_op_type::storage_type  storage_prefix_op;
+
+    const unsigned int flat_id       = block_thread_id<0>();
+    const unsigned int flat_block    = block_id<0>();
+    const size_t       block_offset  = launch_offset + size_t(flat_block) * items_per_block;
+    const size_t       thread_offset = block_offset + flat_id * items_per_thread;
+    const bool         is_last       = block_offset + items_per_block >= size;
+
+    for(unsigned int i = flat_id; i < 256; i += block_size)
+    {
+        byte_classes[i] = automaton.byte_classes[i];
+    }
+    ::rocprim::syncthreads();
+
+    const auto next_state = [&](const unsigned int state, const size_t offset)
+    {
+        const unsigned char byte = static_cast<unsigned char>(input[offset]);
+        return automaton.transitions[size_t(state) * automaton.classes + byte_classes[byte]];
+    };
+
+    unsigned int state = 0;
+    if(thread_offset < size)
+    {
+        const size_t overlap = ::rocprim::min<size_t>(thread_offset, automaton.max_length - 1);
+        for(size_t offset = thread_offset - overlap; offset < thread_offset; ++offset)
+        {
+            state = next_state(state, offset);
+        }
+    }
+
+    unsigned int states[items_per_thread];
+    size_t       count = 0;
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        if(thread_offset + i < size)
+        {
+            state     = next_state(state, thread_offset + i);
+            states[i] = state;
+            count += automaton.output_offsets[state + 1] - automaton.output_offsets[state];
+        }
+    }
+
+    size_t offset;
+    size_t prefix;
+    size_t reduction;
+    if(flat_block == 0)
+    {
+        prefix = launch_offset == 0 ? 0 : *carry;
+        block_scan_type().exclusive_scan(count,
+                                         offset,
+                                         prefix,
+                                         reduction,
+                                         storage_scan,
+                                         ::rocprim::plus<size_t>());
+        if(flat_id == 0)
+        {
+            scan_state.set_complete(flat_block, prefix + reduction);
+        }
+    }
+    else
+    {
+        prefix_op_type prefix_op(flat_block, scan_state, storage_prefix_op);
+        block_scan_type().exclusive_scan(count,
+                                         offset,
+                                         storage_scan,
+                                         prefix_op,
+                                         ::rocprim::plus<size_t>());
+        ::rocprim::syncthreads();
+        prefix    = prefix_op.get_prefix();
+        reduction = prefix_op.get_reduction();
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        if(thread_offset + i < size)
+        {
+            const unsigned int end = automaton.output_offsets[states[i] + 1];
+            for(unsigned int output = automaton.output_offsets[states[i]]; output < end; ++output)
+            {
+                if(offset < max_matches)
+                {
+                    const unsigned int pattern = automaton.outputs[output];
+                    positions_output[offset]
+                        = thread_offset + i + 1 - automaton.pattern_lengths[pattern];
+                    patterns_output[offset] = pattern;
+                }
+                ++offset;
+            }
+        }
+    }
+
+    if(is_last && flat_id == 0)
+    {
+        matches_count_output[0] = prefix + reduction;
+    }
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_MULTI_SEARCH_HPP_
@@ -27,14 +27,17 @@
 #include "../../block/block_sort.hpp"
 #include "../../block/block_store.hpp"
 
-#include "../../config.hpp"
 #include "../../common.hpp"
+#include "../../config.hpp"
+#include "../../detail/merge_path.hpp"
 #include "../../intrinsics.hpp"
 #include "../../type_traits.hpp"
 
 #include "../device_transform.hpp"
+#include "../execution_budget.hpp"
 
 #include "device_config_helper.hpp"
+#include "ordered_block_id.hpp"
 
 #include <cstdint>
 #include <hip/amd_detail/amd_hip_runtime.h>
@@ -118,6 +121,22 @@ struct n_th_element_iteration_data
     bool   equality_bucket;
 };
 
+// The subrange of the keys that still contains the nth element. It is kept in device memory, so
+// that the bucket passes can be enqueued without reading the chosen bucket back to the host.
+struct nth_element_range_state
+{
+    size_t offset;
+    size_t size;
+    size_t rank;
+    bool   done;
+
+    // Whether the subrange still has to be narrowed down by bucket passes.
+    ROCPRIM_DEVICE ROCPRIM_INLINE bool is_active(const unsigned int stop_recursion_size) const
+    {
+        return !done && size >= stop_recursion_size;
+    }
+};
+
 template<class config, class KeysIterator, class BinaryFunction>
 ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
     kernel_block_sort_impl(KeysIterator keys, const size_t size, BinaryFunction compare_function)
@@ -155,9 +174,185 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
 template<class config, class KeysIterator, class BinaryFunction>
 ROCPRIM_KERNEL
     __launch_bounds__(device_params<config>().stop_recursion_size) void kernel_block_sort(
-        KeysIterator keys, const size_t size, BinaryFunction compare_function)
+        KeysIterator keys, const nth_element_range_state* range, BinaryFunction compare_function)
 {
-    kernel_block_sort_impl<config>(keys, size, compare_function);
+    // Subranges that are still too large are finished by kernel_fallback_sort.
+    if(range->done || range->size >= device_params<config>().stop_recursion_size)
+    {
+        return;
+    }
+    kernel_block_sort_impl<config>(keys + range->offset, range->size, compare_function);
+}
+
+template<unsigned int BlockSize,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE void nth_element_merge_pass(KeysInputIterator  keys_input,
+                                                          KeysOutputIterator keys_output,
+                                                          const size_t       size,
+                                                          const size_t       width,
+                                                          BinaryFunction     compare_function)
+{
+    for(size_t i = threadIdx.x; i < size; i += BlockSize)
+    {
+        const size_t begin1 = i / (2 * width) * (2 * width);
+        const size_t end1   = ::rocprim::min(begin1 + width, size);
+        const size_t end2   = ::rocprim::min(begin1 + 2 * width, size);
+        const size_t diag   = i - begin1;
+        const size_t count1 = end1 - begin1;
+        const size_t count2 = end2 - end1;
+
+        const size_t x = merge_path(keys_input + begin1,
+                                    keys_input + end1,
+                                    count1,
+                                    count2,
+                                    diag,
+                                    compare_function);
+        const size_t y = diag - x;
+
+        const bool take_first
+            = y >= count2
+              || (x < count1 && !compare_function(keys_input[end1 + y], keys_input[begin1 + x]));
+        keys_output[i] = take_first ? keys_input[begin1 + x] : keys_input[end1 + y];
+    }
+}
+
+// Sorts the remaining subrange with a single block when the bucket passes did not narrow it down
+// enough within the bound on their number. Only reachable for inputs crafted against the sampled
+// splitters, on other inputs every pass shrinks the subrange by far more than half, and the
+// subranges of repeated keys end in an equality bucket.
+template<class config, class KeysIterator, class BinaryFunction>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<config>().stop_recursion_size) void kernel_fallback_sort(
+        KeysIterator                                             keys,
+        typename std::iterator_traits<KeysIterator>::value_type* keys_buffer,
+        const nth_element_range_state*                           range,
+        BinaryFunction                                           compare_function)
+{
+    constexpr nth_element_config_params params = device_params<config>();
+
+    constexpr unsigned int tile_size = params.stop_recursion_size;
+
+    using key_type = typename std::iterator_traits<KeysIterator>::value_type;
+
+    using block_load_key  = block_load<key_type, tile_size, 1>;
+    using block_sort_key  = block_sort<key_type, tile_size>;
+    using block_store_key = block_store<key_type, tile_size, 1>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_load_key::storage_type  load;
+        typename block_sort_key::storage_type  sort;
+        typename block_store_key::storage_type store;
+    } storage;
+
+    if(!range->is_active(tile_size))
+    {
+        return;
+    }
+
+    keys += range->offset;
+    const size_t size = range->size;
+
+    // Sort the tiles in place
+    for(size_t tile_offset = 0; tile_offset < size; tile_offset += tile_size)
+    {
+        const unsigned int valid
+            = static_cast<unsigned int>(::rocprim::min<size_t>(size - tile_offset, tile_size));
+
+        key_type items[1];
+        block_load_key().load(keys + tile_offset, items, valid, storage.load);
+        syncthreads();
+        block_sort_key().sort(items, storage.sort, valid, compare_function);
+        syncthreads();
+        block_store_key().store(keys + tile_offset, items, valid, storage.store);
+        syncthreads();
+    }
+
+    // Merge the sorted tiles, alternating between the keys and the buffer
+    bool in_buffer = false;
+    for(size_t width = tile_size; width < size; width *= 2)
+    {
+        if(in_buffer)
+        {
+            nth_element_merge_pass<tile_size>(keys_buffer, keys, size, width, compare_function);
+        }
+        else
+        {
+            nth_element_merge_pass<tile_size>(keys, keys_buffer, size, width, compare_function);
+        }
+        in_buffer = !in_buffer;
+        syncthreads();
+    }
+
+    if(in_buffer)
+    {
+        for(size_t i = threadIdx.x; i < size; i += tile_size)
+        {
+            keys[i] = keys_buffer[i];
+        }
+    }
+}
+
+// Clears the bucket sizes, the equality buckets and the tile counter for the next bucket pass.
+// Launched with one thread per bucket.
+ROCPRIM_DEVICE ROCPRIM_INLINE void nth_element_reset_pass(size_t* buckets,
+                                                          bool*   equality_buckets,
+                                                          ordered_block_id<unsigned int> tile_id)
+{
+    buckets[threadIdx.x]          = 0;
+    equality_buckets[threadIdx.x] = false;
+    if(threadIdx.x == 0)
+    {
+        tile_id.reset();
+    }
+}
+
+template<class config>
+ROCPRIM_KERNEL __launch_bounds__(device_params<config>().number_of_buckets) void kernel_init_range(
+    nth_element_range_state*       range,
+    const size_t                   size,
+    const size_t                   rank,
+    size_t*                        buckets,
+    bool*                          equality_buckets,
+    ordered_block_id<unsigned int> tile_id)
+{
+    nth_element_reset_pass(buckets, equality_buckets, tile_id);
+    if(threadIdx.x == 0)
+    {
+        range->offset = 0;
+        range->size   = size;
+        range->rank   = rank;
+        range->done   = false;
+    }
+}
+
+template<class config>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<config>().number_of_buckets) void kernel_update_range(
+        nth_element_range_state*           range,
+        const n_th_element_iteration_data* nth_element_data,
+        size_t*                            buckets,
+        bool*                              equality_buckets,
+        ordered_block_id<unsigned int>     tile_id)
+{
+    const bool is_active = range->is_active(device_params<config>().stop_recursion_size);
+    syncthreads();
+    if(!is_active)
+    {
+        return;
+    }
+    nth_element_reset_pass(buckets, equality_buckets, tile_id);
+    if(threadIdx.x == 0)
+    {
+        // rank is the n from the nth-element, but it reduces based on the previous iteration
+        range->offset += nth_element_data->offset;
+        range->rank -= nth_element_data->offset;
+        range->size = nth_element_data->size;
+        // If all values are the same it is already sorted
+        range->done = nth_element_data->equality_bucket;
+    }
 }
 
 template<class config, class KeysIterator, class BinaryFunction>
@@ -207,11 +402,19 @@ ROCPRIM_KERNEL __launch_bounds__(
     device_params<config>().number_of_buckets
     - 1) void kernel_find_splitters(KeysIterator                                             keys,
                                     typename std::iterator_traits<KeysIterator>::value_type* tree,
-                                    bool*          equality_buckets,
-                                    const size_t   size,
-                                    BinaryFunction compare_function)
+                                    bool*                          equality_buckets,
+                                    const nth_element_range_state* range,
+                                    BinaryFunction                 compare_function)
 {
-    kernel_find_splitters_impl<config>(keys, tree, equality_buckets, size, compare_function);
+    if(!range->is_active(device_params<config>().stop_recursion_size))
+    {
+        return;
+    }
+    kernel_find_splitters_impl<config>(keys + range->offset,
+                                       tree,
+                                       equality_buckets,
+                                       range->size,
+                                       compare_function);
 }
 
 template<class config, class KeysIterator, class BinaryFunction>
@@ -219,6 +422,7 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
     kernel_count_bucket_sizes_impl(KeysIterator                                             keys,
                                    typename std::iterator_traits<KeysIterator>::value_type* tree,
                                    const size_t                                             size,
+                                   const size_t                                             tile,
                                    size_t*                                                  buckets,
                                    bool*          equality_buckets,
                                    BinaryFunction compare_function)
@@ -266,7 +470,7 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
     const key_type* search_tree = storage.buffer.get_unsafe_array();
 
     key_type     elements[num_items_per_thread];
-    const size_t offset            = blockIdx.x * num_items_per_block;
+    const size_t offset            = tile * num_items_per_block;
     const bool   is_complete_block = offset + num_items_per_block <= size;
 
     if(is_complete_block)
@@ -325,17 +529,32 @@ ROCPRIM_KERNEL __launch_bounds__(
         .block_size) void kernel_count_bucket_sizes(KeysIterator keys,
                                                     typename std::iterator_traits<
                                                         KeysIterator>::value_type* tree,
-                                                    const size_t                   size,
+                                                    const nth_element_range_state* range,
                                                     size_t*                        buckets,
                                                     bool*                          equality_buckets,
                                                     BinaryFunction                 compare_function)
 {
-    kernel_count_bucket_sizes_impl<config>(keys,
-                                           tree,
-                                           size,
-                                           buckets,
-                                           equality_buckets,
-                                           compare_function);
+    constexpr nth_element_config_params params = device_params<config>();
+    constexpr unsigned int              num_items_per_block
+        = params.kernel_config.block_size * params.kernel_config.items_per_thread;
+
+    if(!range->is_active(params.stop_recursion_size))
+    {
+        return;
+    }
+    // The grid of the passes after the first one is smaller than the subrange can be
+    const size_t size = range->size;
+    for(size_t tile = blockIdx.x; tile * num_items_per_block < size; tile += gridDim.x)
+    {
+        kernel_count_bucket_sizes_impl<config>(keys + range->offset,
+                                               tree,
+                                               size,
+                                               tile,
+                                               buckets,
+                                               equality_buckets,
+                                               compare_function);
+        syncthreads();
+    }
 }
 
 template<class config>
@@ -389,12 +608,20 @@ ROCPRIM_KERNEL __launch_bounds__(
     device_params<config>()
         .number_of_buckets) void kernel_find_nth_element_bucket(size_t* buckets,
                                                                 n_th_element_iteration_data*
-                                                                             nth_element_data,
-                                                                bool*        equality_buckets,
-                                                                const size_t rank)
+                                                                      nth_element_data,
+                                                                bool* equality_buckets,
+                                                                const nth_element_range_state*
+                                                                    range)
 
 {
-    kernel_find_nth_element_bucket_impl<config>(buckets, nth_element_data, equality_buckets, rank);
+    if(!range->is_active(device_params<config>().stop_recursion_size))
+    {
+        return;
+    }
+    kernel_find_nth_element_bucket_impl<config>(buckets,
+                                                nth_element_data,
+                                                equality_buckets,
+                                                range->rank);
 }
 
 template<class config, unsigned int NumPartitions, class KeysIterator, class BinaryFunction>
@@ -402,6 +629,7 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
     kernel_copy_buckets_impl(KeysIterator                                             keys,
                              typename std::iterator_traits<KeysIterator>::value_type* tree,
                              const size_t                                             size,
+                             const size_t                                             tile,
                              nth_element_onesweep_lookback_state* lookback_states,
                              n_th_element_iteration_data*         nth_element_data,
                              typename std::iterator_traits<KeysIterator>::value_type* keys_buffer,
@@ -443,7 +671,7 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
     const bool     equality_bucket = nth_element_data->equality_bucket;
     const bool     equality_bucket_before = nth_element > 0 && equality_buckets[nth_element - 1];
 
-    const size_t offset            = blockIdx.x * num_items_per_block;
+    const size_t offset            = tile * num_items_per_block;
     const bool   is_complete_block = offset + num_items_per_block <= size;
 
     key_type elements[num_items_per_thread];
@@ -519,11 +747,11 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
     const unsigned int partition = threadIdx.x;
     if(partition < num_partitions)
     {
-        state* block_state = &lookback_states[blockIdx.x * num_partitions + partition];
+        state* block_state = &lookback_states[tile * num_partitions + partition];
         state(state::PARTIAL, partition_counts[0]).store(block_state);
 
         unsigned int exclusive_prefix  = 0;
-        unsigned int lookback_block_id = blockIdx.x;
+        size_t       lookback_block_id = tile;
         // The main back tracking loop.
         while(lookback_block_id > 0)
         {
@@ -591,21 +819,89 @@ ROCPRIM_KERNEL
     __launch_bounds__(device_params<config>().kernel_config.block_size) void kernel_copy_buckets(
         KeysIterator                                             keys,
         typename std::iterator_traits<KeysIterator>::value_type* tree,
-        const size_t                                             size,
+        const nth_element_range_state*                           range,
         nth_element_onesweep_lookback_state*                     lookback_states,
         n_th_element_iteration_data*                             nth_element_data,
         typename std::iterator_traits<KeysIterator>::value_type* keys_buffer,
         bool*                                                    equality_buckets,
+        ordered_block_id<unsigned int>                           tile_id,
         BinaryFunction                                           compare_function)
 {
-    kernel_copy_buckets_impl<config, NumPartitions>(keys,
-                                                    tree,
-                                                    size,
-                                                    lookback_states,
-                                                    nth_element_data,
-                                                    keys_buffer,
-                                                    equality_buckets,
-                                                    compare_function);
+    constexpr nth_element_config_params params = device_params<config>();
+    constexpr unsigned int              num_items_per_block
+        = params.kernel_config.block_size * params.kernel_config.items_per_thread;
+
+    ROCPRIM_SHARED_MEMORY typename ordered_block_id<unsigned int>::storage_type tile_id_storage;
+
+    if(!range->is_active(params.stop_recursion_size))
+    {
+        return;
+    }
+    // The tiles are claimed in order, so the tiles a block looks back at belong to blocks that
+    // are already running, whatever the size of the grid. Blocks exit at the first tile past the
+    // subrange.
+    const size_t size = range->size;
+    while(true)
+    {
+        const size_t tile = tile_id.get(threadIdx.x, tile_id_storage);
+        if(tile * num_items_per_block >= size)
+        {
+            return;
+        }
+        kernel_copy_buckets_impl<config, NumPartitions>(keys + range->offset,
+                                                        tree,
+                                                        size,
+                                                        tile,
+                                                        lookback_states,
+                                                        nth_element_data,
+                                                        keys_buffer,
+                                                        equality_buckets,
+                                                        compare_function);
+        syncthreads();
+    }
+}
+
+// Copies the partitioned subrange back to the keys, and clears the lookback states of its tiles
+// for the next pass, whose subrange is not larger.
+template<class config, unsigned int NumPartitions, class KeysIterator>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<config>().kernel_config.block_size) void kernel_copy_back(
+        typename std::iterator_traits<KeysIterator>::value_type* keys_buffer,
+        KeysIterator                                             keys,
+        const nth_element_range_state*                           range,
+        nth_element_onesweep_lookback_state*                     lookback_states)
+{
+    constexpr nth_element_config_params params = device_params<config>();
+
+    constexpr unsigned int num_threads_per_block = params.kernel_config.block_size;
+    constexpr unsigned int num_items_per_thread  = params.kernel_config.items_per_thread;
+    constexpr unsigned int num_items_per_block   = num_threads_per_block * num_items_per_thread;
+
+    if(!range->is_active(params.stop_recursion_size))
+    {
+        return;
+    }
+
+    const size_t size = range->size;
+    keys += range->offset;
+
+    for(size_t tile = blockIdx.x; tile * num_items_per_block < size; tile += gridDim.x)
+    {
+        const size_t offset = tile * num_items_per_block;
+        ROCPRIM_UNROLL
+        for(unsigned int item = 0; item < num_items_per_thread; item++)
+        {
+            const size_t idx = offset + item * num_threads_per_block + threadIdx.x;
+            if(idx < size)
+            {
+                keys[idx] = keys_buffer[idx];
+            }
+        }
+        if(threadIdx.x < NumPartitions)
+        {
+            lookback_states[tile * NumPartitions + threadIdx.x].state = 0;
+        }
+    }
 }
 
 template<class config, unsigned int NumPartitions, class KeysIterator, class BinaryFunction>
@@ -623,16 +919,16 @@ ROCPRIM_INLINE hipError_t
                           const unsigned int           num_threads_per_block,
                           const unsigned int           num_items_per_thread,
                           n_th_element_iteration_data* nth_element_data,
+                          nth_element_range_state*     range,
+                          unsigned int*                tile_counter,
                           BinaryFunction               compare_function,
                           hipStream_t                  stream,
                           bool                         debug_synchronous)
 {
-    using key_type = typename std::iterator_traits<KeysIterator>::value_type;
-
     constexpr unsigned int num_partitions      = NumPartitions;
     const unsigned int     num_splitters       = num_buckets - 1;
     const unsigned int     num_items_per_block = num_threads_per_block * num_items_per_thread;
-    size_t                 iteration           = 0;
+    const unsigned int     num_blocks          = ceiling_div(size, num_items_per_block);
 
     // Start point for time measurements
     std::chrono::steady_clock::time_point start;
@@ -645,96 +941,127 @@ ROCPRIM_INLINE hipError_t
         }
     };
 
-    while(size >= stop_recursion_size)
+    // The subrange that contains the nth element only lives on the device, so the number of
+    // bucket passes is fixed up front. On typical inputs every pass shrinks the subrange by
+    // about the number of buckets, the bound allows for passes that only halve it. Passes after
+    // the subrange became small enough (or all its values are equal) exit immediately.
+    unsigned int max_iterations = 0;
+    for(size_t bound_size = size; bound_size >= stop_recursion_size; bound_size /= 2)
     {
-        const unsigned int num_blocks = ceiling_div(size, num_items_per_block);
-
-        if(debug_synchronous)
-        {
-            std::cout << "-----" << '\n';
-            std::cout << "size: " << size << '\n';
-            std::cout << "rank: " << rank << '\n';
-            std::cout << "iteration: " << iteration++ << '\n';
-        }
+        ++max_iterations;
+    }
 
-        ROCPRIM_RETURN_ON_ERROR(hipMemsetAsync(buckets, 0, sizeof(*buckets) * num_buckets, stream));
+    using ordered_tile_id         = ordered_block_id<unsigned int>;
+    const ordered_tile_id tile_id = ordered_tile_id::create(tile_counter);
 
-        ROCPRIM_RETURN_ON_ERROR(
-            hipMemsetAsync(equality_buckets, 0, sizeof(*equality_buckets) * num_buckets, stream));
+    // The first pass covers all keys with one block per tile. The subranges of the later passes
+    // are not known on the host, their kernels loop over the tiles with the blocks that can be
+    // resident at once, so the passes that are no longer needed are cheap.
+    unsigned int pass_grid_size = num_blocks;
+    if(max_iterations > 1)
+    {
+        ROCPRIM_RETURN_ON_ERROR(occupancy_grid_size(
+            kernel_copy_buckets<config, num_partitions, KeysIterator, BinaryFunction>,
+            num_threads_per_block,
+            0,
+            num_blocks,
+            stream,
+            pass_grid_size));
+    }
+    if(debug_synchronous)
+    {
+        std::cout << "max_iterations: " << max_iterations << '\n';
+        std::cout << "pass_grid_size: " << pass_grid_size << '\n';
+    }
 
-        // Reset lookback scan states to zero, indicating empty prefix.
+    // Each pass clears the lookback states of the tiles it used in kernel_copy_back
+    if(max_iterations > 0)
+    {
         ROCPRIM_RETURN_ON_ERROR(
             nth_element_onesweep_lookback_state::reset(lookback_states,
                                                        num_partitions * num_blocks,
                                                        stream));
+    }
+
+    start_timer();
+    kernel_init_range<config><<<1, num_buckets, 0, stream>>>(range,
+                                                             size,
+                                                             rank,
+                                                             buckets,
+                                                             equality_buckets,
+                                                             tile_id);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("kernel_init_range", size, start);
+
+    for(unsigned int iteration = 0; iteration < max_iterations; ++iteration)
+    {
+        if(debug_synchronous)
+        {
+            std::cout << "-----" << '\n';
+            std::cout << "iteration: " << iteration << " of " << max_iterations << '\n';
+        }
+        const unsigned int grid_size = iteration == 0 ? num_blocks : pass_grid_size;
 
         start_timer();
         kernel_find_splitters<config>
-            <<<1, num_splitters, 0, stream>>>(keys, tree, equality_buckets, size, compare_function);
+            <<<1, num_splitters, 0, stream>>>(keys, tree, equality_buckets, range, compare_function);
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("kernel_find_splitters", size, start);
 
         start_timer();
         kernel_count_bucket_sizes<config>
-            <<<num_blocks, num_threads_per_block, 0, stream>>>(keys,
-                                                               tree,
-                                                               size,
-                                                               buckets,
-                                                               equality_buckets,
-                                                               compare_function);
+            <<<grid_size, num_threads_per_block, 0, stream>>>(keys,
+                                                              tree,
+                                                              range,
+                                                              buckets,
+                                                              equality_buckets,
+                                                              compare_function);
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("kernel_count_bucket_sizes", size, start);
 
         start_timer();
         kernel_find_nth_element_bucket<config>
-            <<<1, num_buckets, 0, stream>>>(buckets, nth_element_data, equality_buckets, rank);
+            <<<1, num_buckets, 0, stream>>>(buckets, nth_element_data, equality_buckets, range);
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("kernel_find_nth_element_bucket", size, start);
 
         start_timer();
         kernel_copy_buckets<config, num_partitions>
-            <<<num_blocks, num_threads_per_block, 0, stream>>>(keys,
-                                                               tree,
-                                                               size,
-                                                               lookback_states,
-                                                               nth_element_data,
-                                                               keys_buffer,
-                                                               equality_buckets,
-                                                               compare_function);
+            <<<grid_size, num_threads_per_block, 0, stream>>>(keys,
+                                                              tree,
+                                                              range,
+                                                              lookback_states,
+                                                              nth_element_data,
+                                                              keys_buffer,
+                                                              equality_buckets,
+                                                              tile_id,
+                                                              compare_function);
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("kernel_copy_buckets", size, start);
 
         // Copy the results in keys_buffer back to the keys
-        ROCPRIM_RETURN_ON_ERROR(transform(keys_buffer,
-                                          keys,
-                                          size,
-                                          ::rocprim::identity<key_type>(),
-                                          stream,
-                                          debug_synchronous));
-
-        n_th_element_iteration_data h_nth_element_data;
-        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(&h_nth_element_data,
-                                               nth_element_data,
-                                               sizeof(h_nth_element_data),
-                                               hipMemcpyDeviceToHost,
-                                               stream));
-
-        ROCPRIM_RETURN_ON_ERROR(hipStreamSynchronize(stream));
-
-        size_t offset          = h_nth_element_data.offset;
-        size_t bucket_size     = h_nth_element_data.size;
-        bool   equality_bucket = h_nth_element_data.equality_bucket;
+        start_timer();
+        kernel_copy_back<config, num_partitions>
+            <<<grid_size, num_threads_per_block, 0, stream>>>(keys_buffer,
+                                                              keys,
+                                                              range,
+                                                              lookback_states);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("kernel_copy_back", size, start);
 
-        // If all values are the same it is already sorted
-        if(equality_bucket)
-        {
-            return hipSuccess;
-        }
+        start_timer();
+        kernel_update_range<config><<<1, num_buckets, 0, stream>>>(range,
+                                                                   nth_element_data,
+                                                                   buckets,
+                                                                   equality_buckets,
+                                                                   tile_id);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("kernel_update_range", size, start);
+    }
 
-        size = bucket_size;
-        // rank is the n from the nth-element, but it reduces based on the previous iteration
-        rank = rank - offset;
-        keys = keys + offset;
+    if(max_iterations > 0)
+    {
+        start_timer();
+        kernel_fallback_sort<config>
+            <<<1, stop_recursion_size, 0, stream>>>(keys, keys_buffer, range, compare_function);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("kernel_fallback_sort", size, start);
     }
 
     start_timer();
-    kernel_block_sort<config><<<1, stop_recursion_size, 0, stream>>>(keys, size, compare_function);
+    kernel_block_sort<config><<<1, stop_recursion_size, 0, stream>>>(keys, range, compare_function);
     ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("kernel_block_sort", size, start);
     return hipSuccess;
 }
@@ -0,0 +1,180 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_ORDERED_FIND_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_ORDERED_FIND_HPP_
+
+#include "ordered_block_id.hpp"
+
+#include "../../common.hpp"
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The early exit protocol of the searches for the first match in the input: a persistent grid
+// takes the tiles in order with an ordered block id, and the index of the best match so far is
+// checked before every tile. Once a tile has a match, no later tile can have a better one,
+// so a match at the start of a large input is found after a few tiles.
+
+// Returned by the tile functions of ordered_find_loop when the tile has no match.
+constexpr unsigned int ordered_find_no_match = std::numeric_limits<unsigned int>::max();
+
+template<class T>
+ROCPRIM_KERNEL __launch_bounds__(1)
+void ordered_find_init_kernel(T* best, const T initial, ordered_block_id<T> ordered_tile_id)
+{
+    *best = initial;
+    ordered_tile_id.reset();
+}
+
+// Processes the tiles of ItemsPerTile candidate positions in [0, candidates) in order, until a
+// tile with a match is found or a preceding tile had one. For every tile, all threads call
+// tile_function(tile_offset, valid), where valid is the number of candidates of the tile,
+// which returns the index of the thread's first match relative to the tile or
+// ordered_find_no_match. The first match of the tile is stored to best with an atomic minimum.
+template<unsigned int BlockSize, unsigned int ItemsPerTile, class TileFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE void ordered_find_loop(size_t*                  best,
+                                                     const size_t             candidates,
+                                                     ordered_block_id<size_t> ordered_tile_id,
+                                                     TileFunction&&           tile_function)
+{
+    const unsigned int thread_id = block_thread_id<0>();
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        unsigned int block_first_index;
+        size_t       global_first_index;
+
+        typename ordered_block_id<size_t>::storage_type ordered_tile_id;
+    } storage;
+
+    if(thread_id == 0)
+    {
+        storage.block_first_index = ordered_find_no_match;
+    }
+
+    while(true)
+    {
+        if(thread_id == 0)
+        {
+            storage.global_first_index = atomic_load(best);
+        }
+        // ordered_tile_id.get() calls syncthreads(), it is safe to read global_first_index
+        const size_t tile_offset = ordered_tile_id.get(thread_id, storage.ordered_tile_id)
+                                   * size_t(ItemsPerTile);
+
+        // Exit if all input has been processed or one of previous tiles has a match
+        if(tile_offset >= ::rocprim::min(candidates, storage.global_first_index))
+        {
+            break;
+        }
+
+        const unsigned int valid = static_cast<unsigned int>(
+            ::rocprim::min<size_t>(candidates - tile_offset, ItemsPerTile));
+        const unsigned int thread_first_index = tile_function(tile_offset, valid);
+        if(thread_first_index != ordered_find_no_match)
+        {
+            // This happens to some blocks rarely so it is not beneficial to avoid atomic
+            // conflicts with block_reduce which needs to be computed even if no threads have
+            // a match.
+            atomic_min(&storage.block_first_index, thread_first_index);
+        }
+        syncthreads();
+        if(storage.block_first_index != ordered_find_no_match)
+        {
+            if(thread_id == 0)
+            {
+                atomic_min(best, tile_offset + storage.block_first_index);
+            }
+            break;
+        }
+    }
+}
+
+// Launches the minimum grid size needed to achieve the highest occupancy, as more blocks than
+// that wait for the ordered block ids anyway.
+template<class Kernel, class... Args>
+inline hipError_t ordered_find_launch(Kernel             kernel,
+                                      const char*        name,
+                                      const unsigned int block_size,
+                                      const unsigned int items_per_tile,
+                                      const size_t       candidates,
+                                      const hipStream_t  stream,
+                                      const bool         debug_synchronous,
+                                      Args... args)
+{
+    const size_t shared_memory_size = 0;
+
+    int min_grid_size, max_block_size;
+    ROCPRIM_RETURN_ON_ERROR(hipOccupancyMaxPotentialBlockSize(&min_grid_size,
+                                                              &max_block_size,
+                                                              kernel,
+                                                              shared_memory_size,
+                                                              int(block_size)));
+
+    const size_t num_blocks
+        = std::min(size_t(min_grid_size), ceiling_div(candidates, items_per_tile));
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    kernel<<<num_blocks, block_size, shared_memory_size, stream>>>(args...);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, candidates, start);
+
+    return hipSuccess;
+}
+
+// Resets the best match to initial and the ordered tile ids.
+inline hipError_t ordered_find_init(size_t*                        best,
+                                    const size_t                   initial,
+                                    const ordered_block_id<size_t> ordered_tile_id,
+                                    const hipStream_t              stream,
+                                    const bool                     debug_synchronous)
+{
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    ordered_find_init_kernel<<<1, 1, 0, stream>>>(best, initial, ordered_tile_id);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("ordered_find_init_kernel", 1, start);
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_ORDERED_FIND_HPP_
@@ -30,6 +30,7 @@
 #include "../../types.hpp"
 
 #include "../../block/block_load.hpp"
+#include "../../block/block_reduce.hpp"
 #include "../../block/block_store.hpp"
 #include "../../block/block_scan.hpp"
 #include "../../block/block_discontinuity.hpp"
@@ -908,35 +909,92 @@ public:
     {}
 };
 
-template<select_method SelectMethod,
-         bool          OnlySelected,
-         class Config,
-         class KeyIterator,
-         class ValueIterator, // Can be rocprim::empty_type* if key only
-         class FlagIterator,
-         class OutputKeyIterator,
-         class OutputValueIterator,
-         class InequalityOp,
-         class OffsetLookbackScanState,
-         class... UnaryPredicates>
-ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto partition_kernel_impl(KeyIterator,
-                                                               ValueIterator,
-                                                               FlagIterator,
-                                                               OutputKeyIterator,
-                                                               OutputValueIterator,
-                                                               size_t*,
-                                                               size_t*,
-                                                               size_t,
-                                                               const size_t,
-                                                               InequalityOp,
-                                                               OffsetLookbackScanState,
-                                                               const unsigned int,
-                                                               UnaryPredicates...)
-    -> std::enable_if_t<!is_lookback_kernel_runnable<OffsetLookbackScanState>()>
+// Scans the selection offsets of the tile `flat_block_id` with the look-back of the single
+// pass partition.
+template<class OffsetLookbackScanState>
+struct partition_lookback_offset_scan
 {
-    // No need to build the kernel with sleep on a device that does not require it
-}
+    using offset_type = typename OffsetLookbackScanState::value_type;
+
+    OffsetLookbackScanState offset_scan_state;
+
+    template<class BlockScan, unsigned int ItemsPerThread>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void scan(offset_type (&output_indices)[ItemsPerThread],
+                                            offset_type&                     selected_prefix,
+                                            offset_type&                     selected_in_block,
+                                            typename BlockScan::storage_type& storage,
+                                            const unsigned int               flat_block_id,
+                                            const unsigned int               flat_block_thread_id)
+    {
+        // Offset prefix operation type
+        using offset_scan_prefix_op_type
+            = offset_lookback_scan_prefix_op<offset_type, OffsetLookbackScanState>;
+
+        if(flat_block_id == 0)
+        {
+            BlockScan().exclusive_scan(output_indices,
+                                       output_indices,
+                                       offset_type{}, /** initial value */
+                                       selected_in_block,
+                                       storage,
+                                       ::rocprim::plus<offset_type>());
+            if(flat_block_thread_id == 0)
+            {
+                offset_scan_state.set_complete(flat_block_id, selected_in_block);
+            }
+            ::rocprim::syncthreads(); // sync threads to reuse shared memory
+        }
+        else
+        {
+            ROCPRIM_SHARED_MEMORY typename offset_scan_prefix_op_type::storage_type
+                storage_prefix_op;
+            auto prefix_op
+                = offset_scan_prefix_op_type(flat_block_id, offset_scan_state, storage_prefix_op);
+            BlockScan().exclusive_scan(output_indices,
+                                       output_indices,
+                                       storage,
+                                       prefix_op,
+                                       ::rocprim::plus<offset_type>());
+            ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+            selected_in_block = prefix_op.get_reduction();
+            selected_prefix   = prefix_op.get_prefix();
+        }
+    }
+};
+
+// Scans the selection offsets of the tiles of a partition in order for the two-pass partition.
+// `prefix` is the number of selected items before the next tile.
+template<class OffsetT>
+struct partition_two_pass_offset_scan
+{
+    using offset_type = OffsetT;
+
+    offset_type prefix;
 
+    template<class BlockScan, unsigned int ItemsPerThread>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void scan(offset_type (&output_indices)[ItemsPerThread],
+                                            offset_type&                     selected_prefix,
+                                            offset_type&                     selected_in_block,
+                                            typename BlockScan::storage_type& storage,
+                                            const unsigned int /* flat_block_id */,
+                                            const unsigned int /* flat_block_thread_id */)
+    {
+        BlockScan().exclusive_scan(output_indices,
+                                   output_indices,
+                                   prefix,
+                                   selected_in_block,
+                                   storage,
+                                   ::rocprim::plus<offset_type>());
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        selected_prefix = prefix;
+        prefix          = prefix + selected_in_block;
+    }
+};
+
+// Partitions the tile `flat_block_id` of the launch. OffsetScan computes the number of selected
+// items before the tile and the output indices of its items.
 template<select_method SelectMethod,
          bool          OnlySelected,
          class Config,
@@ -946,23 +1004,22 @@ template<select_method SelectMethod,
          class OutputKeyIterator,
          class OutputValueIterator,
          class InequalityOp,
-         class OffsetLookbackScanState,
+         class OffsetScan,
          class... UnaryPredicates>
-ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
-    partition_kernel_impl(KeyIterator             keys_input,
-                          ValueIterator           values_input,
-                          FlagIterator            flags,
-                          OutputKeyIterator       keys_output,
-                          OutputValueIterator     values_output,
-                          size_t*                 selected_count,
-                          size_t*                 prev_selected_count,
-                          size_t                  prev_processed,
-                          const size_t            total_size,
-                          InequalityOp            inequality_op,
-                          OffsetLookbackScanState offset_scan_state,
-                          const unsigned int      number_of_blocks,
-                          UnaryPredicates... predicates)
-        -> std::enable_if_t<is_lookback_kernel_runnable<OffsetLookbackScanState>()>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void partition_tile(const unsigned int  flat_block_id,
+                                                        KeyIterator         keys_input,
+                                                        ValueIterator       values_input,
+                                                        FlagIterator        flags,
+                                                        OutputKeyIterator   keys_output,
+                                                        OutputValueIterator values_output,
+                                                        size_t*             selected_count,
+                                                        size_t*             prev_selected_count,
+                                                        size_t              prev_processed,
+                                                        const size_t        total_size,
+                                                        InequalityOp        inequality_op,
+                                                        OffsetScan&         offset_scan,
+                                                        const unsigned int  number_of_blocks,
+                                                        UnaryPredicates... predicates)
 {
     static constexpr partition_config_params params = device_params<Config>();
 
@@ -970,7 +1027,7 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
     constexpr auto         items_per_thread = params.kernel_config.items_per_thread;
     constexpr unsigned int items_per_block  = block_size * items_per_thread;
 
-    using offset_type = typename OffsetLookbackScanState::value_type;
+    using offset_type = typename OffsetScan::offset_type;
     using key_type = typename std::iterator_traits<KeyIterator>::value_type;
     using value_type = typename std::iterator_traits<ValueIterator>::value_type;
     using flag_type =
@@ -989,11 +1046,6 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
         = ::rocprim::block_scan<offset_type, block_size, params.block_scan_method>;
     using block_discontinuity_key_type = ::rocprim::block_discontinuity<key_type, block_size>;
 
-    // Offset prefix operation type
-    using offset_scan_prefix_op_type = offset_lookback_scan_prefix_op<
-        offset_type, OffsetLookbackScanState
-    >;
-
     // Memory required for 2-phase scatter
     using exchange_keys_storage_type   = key_type[items_per_block];
     using exchange_values_storage_type = value_type[items_per_block];
@@ -1022,7 +1074,6 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
     load_selected_count(prev_selected_count, prev_selected_count_values);
 
     const auto         flat_block_thread_id = ::rocprim::detail::block_thread_id<0>();
-    const auto         flat_block_id        = ::rocprim::detail::block_id<0>();
     const auto         block_offset         = flat_block_id * items_per_block;
     const unsigned int valid_in_global_last_block
         = total_size - prev_processed - items_per_block * (number_of_blocks - 1);
@@ -1093,44 +1144,12 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
     offset_type selected_in_block{};
 
     // Calculate number of selected values in block and their indices
-    if(flat_block_id == 0)
-    {
-        block_scan_offset_type()
-            .exclusive_scan(
-                output_indices,
-                output_indices,
-                offset_type{}, /** initial value */
-                selected_in_block,
-                storage.scan_offsets,
-                ::rocprim::plus<offset_type>()
-            );
-        if(flat_block_thread_id == 0)
-        {
-            offset_scan_state.set_complete(flat_block_id, selected_in_block);
-        }
-        ::rocprim::syncthreads(); // sync threads to reuse shared memory
-    }
-    else
-    {
-        ROCPRIM_SHARED_MEMORY typename offset_scan_prefix_op_type::storage_type storage_prefix_op;
-        auto prefix_op = offset_scan_prefix_op_type(
-            flat_block_id,
-            offset_scan_state,
-            storage_prefix_op
-        );
-        block_scan_offset_type()
-            .exclusive_scan(
-                output_indices,
-                output_indices,
-                storage.scan_offsets,
-                prefix_op,
-                ::rocprim::plus<offset_type>()
-            );
-        ::rocprim::syncthreads(); // sync threads to reuse shared memory
-
-        selected_in_block = prefix_op.get_reduction();
-        selected_prefix   = prefix_op.get_prefix();
-    }
+    offset_scan.template scan<block_scan_offset_type>(output_indices,
+                                                      selected_prefix,
+                                                      selected_in_block,
+                                                      storage.scan_offsets,
+                                                      flat_block_id,
+                                                      flat_block_thread_id);
 
     // Scatter selected and rejected values
     partition_scatter<OnlySelected, block_size>(keys,
@@ -1173,6 +1192,208 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
     }
 }
 
+template<select_method SelectMethod,
+         bool          OnlySelected,
+         class Config,
+         class KeyIterator,
+         class ValueIterator, // Can be rocprim::empty_type* if key only
+         class FlagIterator,
+         class OutputKeyIterator,
+         class OutputValueIterator,
+         class InequalityOp,
+         class OffsetLookbackScanState,
+         class... UnaryPredicates>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    partition_kernel_impl(KeyIterator             keys_input,
+                          ValueIterator           values_input,
+                          FlagIterator            flags,
+                          OutputKeyIterator       keys_output,
+                          OutputValueIterator     values_output,
+                          size_t*                 selected_count,
+                          size_t*                 prev_selected_count,
+                          size_t                  prev_processed,
+                          const size_t            total_size,
+                          InequalityOp            inequality_op,
+                          OffsetLookbackScanState offset_scan_state,
+                          const unsigned int      number_of_blocks,
+                          UnaryPredicates... predicates)
+{
+    partition_lookback_offset_scan<OffsetLookbackScanState> offset_scan{offset_scan_state};
+    partition_tile<SelectMethod, OnlySelected, Config>(::rocprim::detail::block_id<0>(),
+                                                       keys_input,
+                                                       values_input,
+                                                       flags,
+                                                       keys_output,
+                                                       values_output,
+                                                       selected_count,
+                                                       prev_selected_count,
+                                                       prev_processed,
+                                                       total_size,
+                                                       inequality_op,
+                                                       offset_scan,
+                                                       number_of_blocks,
+                                                       predicates...);
+}
+
+// Counts the selected items of the partition `block_id` of the tiles for the two-pass partition,
+// see two_pass_scan_reduce_kernel_impl. The count of the last partition is not needed, so only
+// partitions of full tiles are counted.
+template<select_method SelectMethod,
+         class Config,
+         class OffsetT,
+         class KeyIterator,
+         class FlagIterator,
+         class InequalityOp,
+         class... UnaryPredicates>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    partition_two_pass_count_kernel_impl(KeyIterator  keys_input,
+                                         FlagIterator flags,
+                                         InequalityOp inequality_op,
+                                         const size_t tiles_per_partition,
+                                         OffsetT*     partition_counts,
+                                         UnaryPredicates... predicates)
+{
+    static constexpr partition_config_params params = device_params<Config>();
+
+    constexpr auto         block_size       = params.kernel_config.block_size;
+    constexpr auto         items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using offset_type = OffsetT;
+    using key_type    = typename std::iterator_traits<KeyIterator>::value_type;
+    using flag_type =
+        typename std::conditional<SelectMethod == select_method::predicated_flag,
+                                  typename std::iterator_traits<FlagIterator>::value_type,
+                                  bool>::type;
+
+    // Block primitives
+    using block_load_key_type = ::rocprim::
+        block_load<key_type, block_size, items_per_thread, params.key_block_load_method>;
+    using block_load_flag_type = ::rocprim::
+        block_load<flag_type, block_size, items_per_thread, params.flag_block_load_method>;
+    using block_reduce_offset_type     = ::rocprim::block_reduce<offset_type, block_size>;
+    using block_discontinuity_key_type = ::rocprim::block_discontinuity<key_type, block_size>;
+
+    using is_selected_type = std::conditional_t<
+        sizeof...(UnaryPredicates) == 1,
+        bool[items_per_thread],
+        bool[sizeof...(UnaryPredicates)][items_per_thread]>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_load_key_type::storage_type          load_keys;
+        typename block_load_flag_type::storage_type         load_flags;
+        typename block_discontinuity_key_type::storage_type discontinuity_values;
+        typename block_reduce_offset_type::storage_type     reduce_offsets;
+    } storage;
+
+    const unsigned int flat_block_thread_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int partition_id         = ::rocprim::detail::block_id<0>();
+    const size_t       first_tile           = partition_id * tiles_per_partition;
+
+    // Only valid in the first thread
+    offset_type partition_count{};
+    for(size_t tile = first_tile; tile < first_tile + tiles_per_partition; tile++)
+    {
+        const size_t block_offset = tile * items_per_block;
+
+        key_type         keys[items_per_thread];
+        is_selected_type is_selected;
+        offset_type      selected[items_per_thread];
+
+        block_load_key_type().load(keys_input + block_offset, keys, storage.load_keys);
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        partition_block_load_flags<SelectMethod,
+                                   block_size,
+                                   block_load_flag_type,
+                                   block_discontinuity_key_type>(keys_input + block_offset - 1,
+                                                                 flags + block_offset,
+                                                                 keys,
+                                                                 is_selected,
+                                                                 predicates...,
+                                                                 inequality_op,
+                                                                 storage,
+                                                                 tile == 0,
+                                                                 flat_block_thread_id,
+                                                                 false,
+                                                                 items_per_block);
+
+        // Convert true/false is_selected flags to 0s and 1s
+        convert_selected_to_indices(selected, is_selected);
+
+        offset_type selected_in_block;
+        block_reduce_offset_type().reduce(selected,
+                                          selected_in_block,
+                                          storage.reduce_offsets,
+                                          ::rocprim::plus<offset_type>());
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        partition_count = partition_count + selected_in_block;
+    }
+
+    if(flat_block_thread_id == 0)
+    {
+        partition_counts[partition_id] = partition_count;
+    }
+}
+
+// Partitions the partition `block_id` of the tiles for the two-pass partition, see
+// two_pass_scan_kernel_impl. `partition_prefixes` holds the inclusive scan of the selected
+// counts of all partitions but the last one.
+template<select_method SelectMethod,
+         bool          OnlySelected,
+         class Config,
+         class OffsetT,
+         class KeyIterator,
+         class ValueIterator, // Can be rocprim::empty_type* if key only
+         class FlagIterator,
+         class OutputKeyIterator,
+         class OutputValueIterator,
+         class InequalityOp,
+         class... UnaryPredicates>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    partition_two_pass_kernel_impl(KeyIterator         keys_input,
+                                   ValueIterator       values_input,
+                                   FlagIterator        flags,
+                                   OutputKeyIterator   keys_output,
+                                   OutputValueIterator values_output,
+                                   size_t*             selected_count,
+                                   size_t*             prev_selected_count,
+                                   const size_t        total_size,
+                                   InequalityOp        inequality_op,
+                                   const OffsetT*      partition_prefixes,
+                                   const size_t        tiles_per_partition,
+                                   const unsigned int  number_of_tiles,
+                                   UnaryPredicates... predicates)
+{
+    const unsigned int partition_id = ::rocprim::detail::block_id<0>();
+    const size_t       first_tile   = partition_id * tiles_per_partition;
+    const size_t       last_tile
+        = ::rocprim::min<size_t>(first_tile + tiles_per_partition, number_of_tiles);
+
+    partition_two_pass_offset_scan<OffsetT> offset_scan{
+        partition_id > 0 ? partition_prefixes[partition_id - 1] : OffsetT{}};
+    for(size_t tile = first_tile; tile < last_tile; tile++)
+    {
+        partition_tile<SelectMethod, OnlySelected, Config>(static_cast<unsigned int>(tile),
+                                                           keys_input,
+                                                           values_input,
+                                                           flags,
+                                                           keys_output,
+                                                           values_output,
+                                                           selected_count,
+                                                           prev_selected_count,
+                                                           0,
+                                                           total_size,
+                                                           inequality_op,
+                                                           offset_scan,
+                                                           number_of_tiles,
+                                                           predicates...);
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+    }
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
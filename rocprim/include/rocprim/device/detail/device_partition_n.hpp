@@ -0,0 +1,414 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_PARTITION_N_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_PARTITION_N_HPP_
+
+#include "../../block/block_load.hpp"
+#include "../../block/block_radix_rank.hpp"
+#include "../../block/block_scan.hpp"
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+
+#include "device_config_helper.hpp"
+#include "device_radix_sort.hpp"
+#include "lookback_backoff.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The buckets are ranked as radix digits of the smallest number of bits that holds them. The
+// items past the end of the last tile are ranked in the largest digit, after all buckets.
+template<unsigned int Buckets>
+struct partition_n_radix
+{
+    static constexpr unsigned int bits = ::rocprim::max(1u, static_cast<unsigned int>(
+                                                                ::rocprim::Log2<Buckets>::VALUE));
+    static constexpr unsigned int size = 1u << bits;
+};
+
+// The separate outputs of the buckets of a segmented partition, e.g. the buffers of the peers of a
+// hash-partitioned shuffle. The items of a bucket are stored at their offsets in the bucket.
+template<class OutputIterator, unsigned int Buckets>
+struct partition_n_bucket_outputs
+{
+    OutputIterator outputs[Buckets];
+};
+
+template<class OutputIterator>
+struct partition_n_relative_offsets : std::false_type
+{};
+
+template<class OutputIterator, unsigned int Buckets>
+struct partition_n_relative_offsets<partition_n_bucket_outputs<OutputIterator, Buckets>>
+    : std::true_type
+{};
+
+template<class OutputIterator, class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void partition_n_store(OutputIterator     output,
+                       const unsigned int /*bucket*/,
+                       const size_t       offset,
+                       const T&           value)
+{
+    output[offset] = value;
+}
+
+template<class OutputIterator, unsigned int Buckets, class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void partition_n_store(const partition_n_bucket_outputs<OutputIterator, Buckets>& output,
+                       const unsigned int                                          bucket,
+                       const size_t                                                offset,
+                       const T&                                                    value)
+{
+    output.outputs[bucket][offset] = value;
+}
+
+// Counts the items of each bucket of a tile in shared memory, and adds the counts to the counts of
+// the whole input.
+template<class Config, unsigned int Buckets, class InputIterator, class BucketOp>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void partition_n_histogram_kernel(InputIterator input,
+                                  const size_t  size,
+                                  BucketOp      bucket_op,
+                                  size_t*       bucket_counts)
+{
+    constexpr partition_n_config_params params           = device_params<Config>();
+    constexpr unsigned int              block_size       = params.kernel_config.block_size;
+    constexpr unsigned int              items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int              items_per_block  = block_size * items_per_thread;
+
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    ROCPRIM_SHARED_MEMORY unsigned int block_histogram[Buckets];
+
+    const unsigned int flat_id = block_thread_id<0>();
+    for(unsigned int bucket = flat_id; bucket < Buckets; bucket += block_size)
+    {
+        block_histogram[bucket] = 0;
+    }
+    syncthreads();
+
+    const size_t       block_offset = static_cast<size_t>(block_id<0>()) * items_per_block;
+    const unsigned int valid_count
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    input_type items[items_per_thread];
+    block_load_direct_striped<block_size>(flat_id, input + block_offset, items, valid_count);
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        if(i * block_size + flat_id < valid_count)
+        {
+            atomic_add(&block_histogram[static_cast<unsigned int>(bucket_op(items[i]))], 1u);
+        }
+    }
+    syncthreads();
+
+    for(unsigned int bucket = flat_id; bucket < Buckets; bucket += block_size)
+    {
+        const unsigned int count = block_histogram[bucket];
+        if(count != 0)
+        {
+            atomic_add(&bucket_counts[bucket], static_cast<size_t>(count));
+        }
+    }
+}
+
+// Counts the items of each bucket of every segment. The blocks of a segment stride over its tiles
+// and add the counts of their tiles to the counts of the segment and of the whole input. The counts
+// of the segments are stored bucket-major, so the counts of a bucket in all segments are adjacent.
+template<class Config,
+         unsigned int Buckets,
+         class InputIterator,
+         class SegmentOffsetIterator,
+         class BucketOp>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void partition_n_segmented_histogram_kernel(InputIterator         input,
+                                            SegmentOffsetIterator segment_offsets,
+                                            const size_t          segments,
+                                            BucketOp              bucket_op,
+                                            size_t*               bucket_counts,
+                                            size_t*               segment_bucket_counts)
+{
+    constexpr partition_n_config_params params           = device_params<Config>();
+    constexpr unsigned int              block_size       = params.kernel_config.block_size;
+    constexpr unsigned int              items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int              items_per_block  = block_size * items_per_thread;
+
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    ROCPRIM_SHARED_MEMORY unsigned int block_histogram[Buckets];
+
+    const unsigned int flat_id = block_thread_id<0>();
+    for(unsigned int bucket = flat_id; bucket < Buckets; bucket += block_size)
+    {
+        block_histogram[bucket] = 0;
+    }
+    syncthreads();
+
+    const unsigned int segment = block_id<0>();
+    const size_t       begin   = static_cast<size_t>(segment_offsets[segment]);
+    const size_t       end     = static_cast<size_t>(segment_offsets[segment + 1]);
+
+    for(size_t tile_offset = begin + static_cast<size_t>(block_id<1>()) * items_per_block;
+        tile_offset < end;
+        tile_offset += static_cast<size_t>(grid_size<1>()) * items_per_block)
+    {
+        const unsigned int valid_count = static_cast<unsigned int>(
+            ::rocprim::min<size_t>(end - tile_offset, items_per_block));
+
+        input_type items[items_per_thread];
+        block_load_direct_striped<block_size>(flat_id, input + tile_offset, items, valid_count);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; ++i)
+        {
+            if(i * block_size + flat_id < valid_count)
+            {
+                atomic_add(&block_histogram[static_cast<unsigned int>(bucket_op(items[i]))], 1u);
+            }
+        }
+    }
+    syncthreads();
+
+    for(unsigned int bucket = flat_id; bucket < Buckets; bucket += block_size)
+    {
+        const unsigned int count = block_histogram[bucket];
+        if(count != 0)
+        {
+            atomic_add(&bucket_counts[bucket], static_cast<size_t>(count));
+            atomic_add(&segment_bucket_counts[bucket * segments + segment],
+                       static_cast<size_t>(count));
+        }
+    }
+}
+
+// Scans the counts of the buckets to the offset of every bucket in the output, and writes the
+// counts and the offsets to their outputs.
+template<unsigned int Buckets, class BucketCountOutputIterator, class BucketOffsetOutputIterator>
+ROCPRIM_KERNEL
+    __launch_bounds__(partition_n_radix<Buckets>::size)
+void partition_n_offsets_kernel(const size_t*              bucket_counts,
+                                size_t*                    bucket_offsets,
+                                BucketCountOutputIterator  bucket_counts_output,
+                                BucketOffsetOutputIterator bucket_offsets_output)
+{
+    constexpr unsigned int radix_size = partition_n_radix<Buckets>::size;
+
+    using block_scan_type = block_scan<size_t, radix_size>;
+
+    ROCPRIM_SHARED_MEMORY typename block_scan_type::storage_type storage;
+
+    using count_type  = typename std::iterator_traits<BucketCountOutputIterator>::value_type;
+    using offset_type = typename std::iterator_traits<BucketOffsetOutputIterator>::value_type;
+
+    const unsigned int bucket = block_thread_id<0>();
+    const size_t       count  = bucket < Buckets ? bucket_counts[bucket] : 0;
+    size_t             offset;
+    block_scan_type().exclusive_scan(count, offset, size_t(0), storage);
+
+    bucket_offsets[bucket] = offset;
+    if(bucket < Buckets)
+    {
+        bucket_counts_output[bucket]  = static_cast<count_type>(count);
+        bucket_offsets_output[bucket] = static_cast<offset_type>(offset);
+    }
+}
+
+// Scatters the items of a tile of a batch to their buckets. The items are ranked by bucket within
+// the tile, then the offset of every bucket of the tile in the batch is found with a decoupled
+// look-back over the counts of that bucket in the preceding tiles, like an iteration of the
+// onesweep radix sort.
+template<class Config,
+         unsigned int Buckets,
+         class InputIterator,
+         class OutputIterator,
+         class BucketOp>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void partition_n_scatter_kernel(InputIterator                 input,
+                                OutputIterator                output,
+                                const unsigned int            size,
+                                BucketOp                      bucket_op,
+                                const size_t*                 bucket_offsets_in,
+                                size_t*                       bucket_offsets_out,
+                                onesweep_lookback_state*      lookback_states,
+                                const unsigned int            lookback_epoch,
+                                const lookback_backoff_params backoff)
+{
+    constexpr partition_n_config_params params           = device_params<Config>();
+    constexpr unsigned int              block_size       = params.kernel_config.block_size;
+    constexpr unsigned int              items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int              items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int              radix_bits       = partition_n_radix<Buckets>::bits;
+    constexpr unsigned int              radix_size       = partition_n_radix<Buckets>::size;
+
+    using input_type      = typename std::iterator_traits<InputIterator>::value_type;
+    // The match rank keeps per-warp instead of per-thread counters, so its shared memory stays
+    // small for up to 256 buckets.
+    using radix_rank_type
+        = block_radix_rank<block_size, radix_bits, block_radix_rank_algorithm::match>;
+
+    constexpr unsigned int digits_per_thread = radix_rank_type::digits_per_thread;
+
+    union storage_type_
+    {
+        typename radix_rank_type::storage_type rank;
+        struct
+        {
+            size_t        bucket_offsets[radix_size];
+            unsigned char ordered_buckets[items_per_block];
+            input_type    ordered_items[items_per_block];
+        };
+    };
+    ROCPRIM_DETAIL_SUPPRESS_DEPRECATION_WITH_PUSH
+    ROCPRIM_SHARED_MEMORY detail::raw_storage<storage_type_> storage_;
+    ROCPRIM_DETAIL_SUPPRESS_DEPRECATION_POP
+    storage_type_& storage = storage_.get();
+
+    const unsigned int flat_id      = block_thread_id<0>();
+    const unsigned int flat_block   = block_id<0>();
+    const unsigned int block_offset = flat_block * items_per_block;
+    const unsigned int valid_items  = ::rocprim::min(size - block_offset, items_per_block);
+
+    input_type   items[items_per_thread];
+    unsigned int buckets[items_per_thread];
+    block_load_direct_blocked(flat_id, input + block_offset, items, valid_items);
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        buckets[i] = flat_id * items_per_thread + i < valid_items
+                         ? static_cast<unsigned int>(bucket_op(items[i]))
+                         : radix_size - 1;
+    }
+
+    unsigned int ranks[items_per_thread];
+    unsigned int exclusive_bucket_prefix[digits_per_thread];
+    unsigned int bucket_counts[digits_per_thread];
+    radix_rank_type{}.rank_keys(
+        buckets,
+        ranks,
+        storage.rank,
+        [](const unsigned int bucket) { return bucket; },
+        exclusive_bucket_prefix,
+        bucket_counts);
+    syncthreads();
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        storage.ordered_items[ranks[i]]   = items[i];
+        storage.ordered_buckets[ranks[i]] = static_cast<unsigned char>(buckets[i]);
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < digits_per_thread; ++i)
+    {
+        const unsigned int bucket = flat_id * digits_per_thread + i;
+        if(radix_size % block_size == 0 || bucket < radix_size)
+        {
+            // The items past the end are ranked last in the largest bucket, which may be a
+            // bucket of the partition, so they are not counted.
+            const unsigned int count
+                = bucket_counts[i] - (bucket == radix_size - 1 ? items_per_block - valid_items : 0);
+
+            onesweep_lookback_state* block_state
+                = &lookback_states[flat_block * radix_size + bucket];
+            onesweep_lookback_state(onesweep_lookback_state::PARTIAL, count, lookback_epoch)
+                .store(block_state);
+
+            unsigned int exclusive_prefix  = 0;
+            unsigned int lookback_block_id = flat_block;
+            while(lookback_block_id > 0)
+            {
+                --lookback_block_id;
+                onesweep_lookback_state* lookback_state_ptr
+                    = &lookback_states[lookback_block_id * radix_size + bucket];
+                onesweep_lookback_state lookback_state
+                    = onesweep_lookback_state::load(lookback_state_ptr);
+                lookback_backoff wait(backoff);
+                while(lookback_state.status(lookback_epoch) == onesweep_lookback_state::EMPTY)
+                {
+                    wait();
+                    lookback_state = onesweep_lookback_state::load(lookback_state_ptr);
+                }
+
+                exclusive_prefix += lookback_state.value();
+                if(lookback_state.status(lookback_epoch) == onesweep_lookback_state::COMPLETE)
+                {
+                    break;
+                }
+            }
+
+            onesweep_lookback_state(onesweep_lookback_state::COMPLETE,
+                                    exclusive_prefix + count,
+                                    lookback_epoch)
+                .store(block_state);
+
+            // The items are already ordered by bucket in the tile, so the offset of the bucket in
+            // the tile is subtracted from the offset of its items in the output.
+            storage.bucket_offsets[bucket]
+                = bucket_offsets_in[bucket] + exclusive_prefix - exclusive_bucket_prefix[i];
+
+            // The last tile of the batch moves the offsets past the items of the batch.
+            if(flat_block == grid_size<0>() - 1)
+            {
+                bucket_offsets_out[bucket]
+                    = bucket_offsets_in[bucket] + exclusive_prefix + count;
+            }
+        }
+    }
+    syncthreads();
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const unsigned int rank = i * block_size + flat_id;
+        if(rank < valid_items)
+        {
+            const unsigned int bucket = storage.ordered_buckets[rank];
+            partition_n_store(output,
+                              bucket,
+                              storage.bucket_offsets[bucket] + rank,
+                              storage.ordered_items[rank]);
+        }
+    }
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_PARTITION_N_HPP_
@@ -0,0 +1,142 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_PREBUILT_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_PREBUILT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+// Instantiations of device algorithms compiled into the optional rocprim_prebuilt library.
+// Every list is applied as X(Prefix, ...): the library expands it with Prefix = template to define
+// the instantiations, and with ROCPRIM_USE_PREBUILT (set by linking rocprim_prebuilt) the headers
+// expand it with Prefix = extern template, so calls with exactly these types are not instantiated
+// again in every translation unit.
+//
+// Only calls with pointers to the listed types, the default config and size_t sizes match.
+
+#define ROCPRIM_DETAIL_PREBUILT_FOR_EACH_KEY(X, Prefix) \
+    X(Prefix, int)                                      \
+    X(Prefix, std::int64_t)                             \
+    X(Prefix, float)                                    \
+    X(Prefix, double)
+
+#define ROCPRIM_DETAIL_PREBUILT_FOR_EACH_VALUE(X, Prefix, Key) \
+    X(Prefix, Key, int)                                        \
+    X(Prefix, Key, std::int64_t)
+
+#define ROCPRIM_DETAIL_PREBUILT_FOR_EACH_OP(X, Prefix, T) \
+    X(Prefix, T, ::rocprim::plus<T>)                      \
+    X(Prefix, T, ::rocprim::minimum<T>)                   \
+    X(Prefix, T, ::rocprim::maximum<T>)
+
+#define ROCPRIM_DETAIL_PREBUILT_RADIX_SORT_KEYS(Prefix, Key)             \
+    Prefix hipError_t radix_sort_keys<default_config>(void*,             \
+                                                      size_t&,           \
+                                                      Key*,              \
+                                                      Key*,              \
+                                                      size_t,            \
+                                                      unsigned int,      \
+                                                      unsigned int,      \
+                                                      hipStream_t,       \
+                                                      bool);             \
+    Prefix hipError_t radix_sort_keys_desc<default_config>(void*,        \
+                                                           size_t&,      \
+                                                           Key*,         \
+                                                           Key*,         \
+                                                           size_t,       \
+                                                           unsigned int, \
+                                                           unsigned int, \
+                                                           hipStream_t,  \
+                                                           bool);
+
+#define ROCPRIM_DETAIL_PREBUILT_RADIX_SORT_PAIRS(Prefix, Key, Value)      \
+    Prefix hipError_t radix_sort_pairs<default_config>(void*,             \
+                                                       size_t&,           \
+                                                       Key*,              \
+                                                       Key*,              \
+                                                       Value*,            \
+                                                       Value*,            \
+                                                       size_t,            \
+                                                       unsigned int,      \
+                                                       unsigned int,      \
+                                                       hipStream_t,       \
+                                                       bool);             \
+    Prefix hipError_t radix_sort_pairs_desc<default_config>(void*,        \
+                                                            size_t&,      \
+                                                            Key*,         \
+                                                            Key*,         \
+                                                            Value*,       \
+                                                            Value*,       \
+                                                            size_t,       \
+                                                            unsigned int, \
+                                                            unsigned int, \
+                                                            hipStream_t,  \
+                                                            bool);
+
+#define ROCPRIM_DETAIL_PREBUILT_RADIX_SORT_PAIRS_KEY(Prefix, Key) \
+    ROCPRIM_DETAIL_PREBUILT_FOR_EACH_VALUE(ROCPRIM_DETAIL_PREBUILT_RADIX_SORT_PAIRS, Prefix, Key)
+
+#define ROCPRIM_DETAIL_PREBUILT_RADIX_SORT(Prefix)                                        \
+    ROCPRIM_DETAIL_PREBUILT_FOR_EACH_KEY(ROCPRIM_DETAIL_PREBUILT_RADIX_SORT_KEYS, Prefix) \
+    ROCPRIM_DETAIL_PREBUILT_FOR_EACH_KEY(ROCPRIM_DETAIL_PREBUILT_RADIX_SORT_PAIRS_KEY, Prefix)
+
+#define ROCPRIM_DETAIL_PREBUILT_REDUCE_OP(Prefix, T, Op)  \
+    Prefix hipError_t reduce<default_config>(void*,       \
+                                             size_t&,     \
+                                             T*,          \
+                                             T*,          \
+                                             T,           \
+                                             size_t,      \
+                                             Op,          \
+                                             hipStream_t, \
+                                             bool);
+
+#define ROCPRIM_DETAIL_PREBUILT_REDUCE_TYPE(Prefix, T) \
+    ROCPRIM_DETAIL_PREBUILT_FOR_EACH_OP(ROCPRIM_DETAIL_PREBUILT_REDUCE_OP, Prefix, T)
+
+#define ROCPRIM_DETAIL_PREBUILT_REDUCE(Prefix) \
+    ROCPRIM_DETAIL_PREBUILT_FOR_EACH_KEY(ROCPRIM_DETAIL_PREBUILT_REDUCE_TYPE, Prefix)
+
+#define ROCPRIM_DETAIL_PREBUILT_SCAN_OP(Prefix, T, Op)            \
+    Prefix hipError_t inclusive_scan<default_config>(void*,       \
+                                                     size_t&,     \
+                                                     T*,          \
+                                                     T*,          \
+                                                     size_t,      \
+                                                     Op,          \
+                                                     hipStream_t, \
+                                                     bool);       \
+    Prefix hipError_t exclusive_scan<default_config>(void*,       \
+                                                     size_t&,     \
+                                                     T*,          \
+                                                     T*,          \
+                                                     T,           \
+                                                     size_t,      \
+                                                     Op,          \
+                                                     hipStream_t, \
+                                                     bool);
+
+#define ROCPRIM_DETAIL_PREBUILT_SCAN_TYPE(Prefix, T) \
+    ROCPRIM_DETAIL_PREBUILT_FOR_EACH_OP(ROCPRIM_DETAIL_PREBUILT_SCAN_OP, Prefix, T)
+
+#define ROCPRIM_DETAIL_PREBUILT_SCAN(Prefix) \
+    ROCPRIM_DETAIL_PREBUILT_FOR_EACH_KEY(ROCPRIM_DETAIL_PREBUILT_SCAN_TYPE, Prefix)
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_PREBUILT_HPP_
@@ -0,0 +1,325 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_QUANTILES_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_QUANTILES_HPP_
+
+#include "../../block/block_load.hpp"
+#include "../../block/block_radix_sort.hpp"
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+#include "../../thread/radix_key_codec.hpp"
+
+#include "device_hash_table.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+constexpr unsigned int quantiles_block_size       = 256;
+constexpr unsigned int quantiles_items_per_thread = 8;
+constexpr unsigned int quantiles_items_per_block
+    = quantiles_block_size * quantiles_items_per_thread;
+
+// Every pass of the radix select finds the next 8 bits of all ranks.
+constexpr unsigned int radix_select_radix_bits = 8;
+constexpr unsigned int radix_select_radix_size = 1u << radix_select_radix_bits;
+
+// Up to this many ranks are counted in shared memory.
+constexpr unsigned int radix_select_max_shared_ranks = 16;
+
+// Returns the first rank whose prefix is not less than `prefix`. The prefixes of ascending
+// ranks are ascending, so the ranks with the same prefix are consecutive and the first of them
+// owns the histogram of the prefix.
+template<class BitKey>
+ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int radix_select_find_prefix(const BitKey*      prefixes,
+                                                                    const unsigned int num_ranks,
+                                                                    const BitKey       prefix)
+{
+    unsigned int first = 0;
+    unsigned int last  = num_ranks;
+    while(first < last)
+    {
+        const unsigned int mid = (first + last) / 2;
+        if(prefixes[mid] < prefix)
+        {
+            first = mid + 1;
+        }
+        else
+        {
+            last = mid;
+        }
+    }
+    return first;
+}
+
+// Counts the digits of the keys that share the prefix of a rank found by the previous passes, in
+// one histogram of `radix_select_radix_size` counters for every distinct prefix.
+template<bool SharedCounters, class KeysIterator, class BitKey>
+ROCPRIM_KERNEL __launch_bounds__(quantiles_block_size) void radix_select_histogram_kernel(
+    KeysIterator       keys_input,
+    const size_t       size,
+    const BitKey*      prefixes,
+    const unsigned int num_ranks,
+    const unsigned int pass,
+    size_t*            histograms)
+{
+    using key_type = typename std::iterator_traits<KeysIterator>::value_type;
+    using codec    = radix_key_codec<key_type>;
+
+    constexpr unsigned int key_bits       = 8 * sizeof(BitKey);
+    constexpr unsigned int shared_ranks   = SharedCounters ? radix_select_max_shared_ranks : 1;
+    constexpr unsigned int shared_counter = shared_ranks * radix_select_radix_size;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        unsigned int counters[shared_counter];
+        BitKey       prefixes[shared_ranks];
+    } storage;
+
+    const unsigned int flat_id  = block_thread_id<0>();
+    const unsigned int counters = num_ranks * radix_select_radix_size;
+
+    const BitKey* block_prefixes = prefixes;
+    if ROCPRIM_IF_CONSTEXPR(SharedCounters)
+    {
+        for(unsigned int i = flat_id; i < counters; i += quantiles_block_size)
+        {
+            storage.counters[i] = 0;
+        }
+        for(unsigned int i = flat_id; i < num_ranks; i += quantiles_block_size)
+        {
+            storage.prefixes[i] = prefixes[i];
+        }
+        syncthreads();
+        block_prefixes = storage.prefixes;
+    }
+
+    const unsigned int digit_shift  = key_bits - radix_select_radix_bits * (pass + 1);
+    const size_t       block_offset
+        = static_cast<size_t>(block_id<0>()) * quantiles_items_per_block;
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < quantiles_items_per_thread; ++i)
+    {
+        const size_t index = block_offset + i * quantiles_block_size + flat_id;
+        if(index < size)
+        {
+            const BitKey bit_key = codec::encode(static_cast<key_type>(keys_input[index]));
+            const BitKey prefix
+                = pass == 0 ? BitKey(0) : static_cast<BitKey>(bit_key >> (digit_shift + 8));
+            const unsigned int rank = radix_select_find_prefix(block_prefixes, num_ranks, prefix);
+            if(rank < num_ranks && block_prefixes[rank] == prefix)
+            {
+                const unsigned int digit
+                    = static_cast<unsigned int>(bit_key >> digit_shift) & 0xFFu;
+                const unsigned int counter = rank * radix_select_radix_size + digit;
+                if ROCPRIM_IF_CONSTEXPR(SharedCounters)
+                {
+                    atomic_add(&storage.counters[counter], 1u);
+                }
+                else
+                {
+                    atomic_add(&histograms[counter], size_t(1));
+                }
+            }
+        }
+    }
+
+    if ROCPRIM_IF_CONSTEXPR(SharedCounters)
+    {
+        syncthreads();
+        for(unsigned int i = flat_id; i < counters; i += quantiles_block_size)
+        {
+            const unsigned int count = storage.counters[i];
+            if(count != 0)
+            {
+                atomic_add(&histograms[i], size_t(count));
+            }
+        }
+    }
+}
+
+// Appends the digit of every rank to its prefix: the digit whose keys hold the remaining rank in
+// the histogram of the prefix. The remaining rank becomes the rank within the keys with the
+// digit. After the last pass the prefixes are the keys of the ranks.
+template<class RanksIterator, class OutputIterator, class BitKey>
+ROCPRIM_KERNEL __launch_bounds__(quantiles_block_size) void radix_select_digits_kernel(
+    RanksIterator      ranks,
+    const unsigned int num_ranks,
+    const BitKey*      prefixes_input,
+    BitKey*            prefixes_output,
+    size_t*            remaining_ranks,
+    const size_t*      histograms,
+    const unsigned int pass,
+    const bool         last_pass,
+    OutputIterator     output)
+{
+    using key_type = typename std::iterator_traits<OutputIterator>::value_type;
+    using codec    = radix_key_codec<key_type>;
+
+    static_assert(std::is_same<typename codec::bit_key_type, BitKey>::value,
+                  "The output type must have the bit key type of the input type");
+
+    for(unsigned int rank = block_thread_id<0>(); rank < num_ranks; rank += quantiles_block_size)
+    {
+        const BitKey prefix    = prefixes_input[rank];
+        size_t       remaining
+            = pass == 0 ? static_cast<size_t>(ranks[rank]) : remaining_ranks[rank];
+
+        const unsigned int owner     = radix_select_find_prefix(prefixes_input, num_ranks, prefix);
+        const size_t*      histogram = histograms + owner * radix_select_radix_size;
+
+        unsigned int digit = 0;
+        for(; digit < radix_select_radix_size - 1; ++digit)
+        {
+            if(remaining < histogram[digit])
+            {
+                break;
+            }
+            remaining -= histogram[digit];
+        }
+
+        const BitKey bit_key = static_cast<BitKey>((prefix << radix_select_radix_bits) | digit);
+        prefixes_output[rank] = bit_key;
+        remaining_ranks[rank] = remaining;
+        if(last_pass)
+        {
+            output[rank] = codec::decode(bit_key);
+        }
+    }
+}
+
+// Sorts the keys of every full block and keeps every `compaction`-th of them, starting at a
+// pseudo-random offset, with a weight of `compaction`. The offset makes the rank errors of the
+// blocks cancel out instead of adding up. The keys of the last block, if it is not full, are kept
+// with a weight of 1.
+template<class KeysIterator>
+ROCPRIM_KERNEL __launch_bounds__(quantiles_block_size) void quantiles_compact_kernel(
+    KeysIterator                                             keys_input,
+    const size_t                                             size,
+    const unsigned int                                       compaction,
+    typename std::iterator_traits<KeysIterator>::value_type* samples,
+    unsigned int*                                            weights)
+{
+    using key_type        = typename std::iterator_traits<KeysIterator>::value_type;
+    using block_load_type = block_load<key_type,
+                                       quantiles_block_size,
+                                       quantiles_items_per_thread,
+                                       block_load_method::block_load_transpose>;
+    using block_sort_type
+        = block_radix_sort<key_type, quantiles_block_size, quantiles_items_per_thread>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_load_type::storage_type load;
+        typename block_sort_type::storage_type sort;
+    } storage;
+
+    const unsigned int flat_id           = block_thread_id<0>();
+    const size_t       block             = block_id<0>();
+    const size_t       block_offset      = block * quantiles_items_per_block;
+    const size_t       full_blocks       = size / quantiles_items_per_block;
+    const unsigned int samples_per_block = quantiles_items_per_block / compaction;
+
+    if(block >= full_blocks)
+    {
+        const size_t sample_offset = full_blocks * samples_per_block;
+        for(size_t index = block_offset + flat_id; index < size; index += quantiles_block_size)
+        {
+            samples[sample_offset + index - block_offset] = keys_input[index];
+            weights[sample_offset + index - block_offset] = 1;
+        }
+        return;
+    }
+
+    key_type keys[quantiles_items_per_thread];
+    block_load_type().load(keys_input + block_offset, keys, storage.load);
+    syncthreads();
+    block_sort_type().sort(keys, storage.sort);
+
+    const unsigned int offset
+        = static_cast<unsigned int>(hash_table_mix(static_cast<unsigned int>(block))) % compaction;
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < quantiles_items_per_thread; ++i)
+    {
+        const unsigned int position = flat_id * quantiles_items_per_thread + i;
+        if(position >= offset && (position - offset) % compaction == 0)
+        {
+            const size_t sample = block * samples_per_block + (position - offset) / compaction;
+            samples[sample]     = keys[i];
+            weights[sample]     = compaction;
+        }
+    }
+}
+
+// Finds the sample of every quantile: the first one whose cumulative weight exceeds the rank of
+// the quantile.
+template<class QuantilesIterator, class Key, class OutputIterator>
+ROCPRIM_KERNEL __launch_bounds__(quantiles_block_size) void quantiles_lookup_kernel(
+    QuantilesIterator  quantiles,
+    const unsigned int num_quantiles,
+    const Key*         sorted_samples,
+    const size_t*      cumulative_weights,
+    const size_t       num_samples,
+    const size_t       size,
+    OutputIterator     output)
+{
+    const unsigned int index = block_id<0>() * quantiles_block_size + block_thread_id<0>();
+    if(index >= num_quantiles)
+    {
+        return;
+    }
+
+    const double quantile = ::rocprim::min(::rocprim::max(static_cast<double>(quantiles[index]),
+                                                          0.0),
+                                           1.0);
+    const size_t rank     = static_cast<size_t>(quantile * static_cast<double>(size - 1) + 0.5);
+
+    size_t first = 0;
+    size_t last  = num_samples - 1;
+    while(first < last)
+    {
+        const size_t mid = (first + last) / 2;
+        if(cumulative_weights[mid] > rank)
+        {
+            last = mid;
+        }
+        else
+        {
+            first = mid + 1;
+        }
+    }
+    output[index] = sorted_samples[first];
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_QUANTILES_HPP_
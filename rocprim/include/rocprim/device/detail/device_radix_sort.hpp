@@ -24,6 +24,7 @@
 #include <type_traits>
 #include <iterator>
 
+#include "../../common.hpp"
 #include "../../config.hpp"
 #include "../../detail/various.hpp"
 
@@ -41,6 +42,9 @@
 #include "../../block/block_store_func.hpp"
 #include "../../thread/radix_key_codec.hpp"
 
+#include "lookback_backoff.hpp"
+#include "lookback_telemetry.hpp"
+
 BEGIN_ROCPRIM_NAMESPACE
 
 namespace detail
@@ -136,7 +140,8 @@ struct radix_digit_count_helper
     template<
         bool IsFull = false,
         class KeysInputIterator,
-        class Offset
+        class Offset,
+        class Decomposer = ::rocprim::identity_decomposer
     >
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void count_digits(KeysInputIterator keys_input,
@@ -145,14 +150,14 @@ struct radix_digit_count_helper
                       unsigned int bit,
                       unsigned int current_radix_bits,
                       storage_type& storage,
-                      unsigned int& digit_count)  // i-th thread will get i-th digit's value
+                      unsigned int& digit_count, // i-th thread will get i-th digit's value
+                      Decomposer decomposer = {})
     {
         constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
 
         using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
 
-        using key_codec    = ::rocprim::radix_key_codec<key_type, Descending>;
-        using bit_key_type = typename key_codec::bit_key_type;
+        using key_codec = ::rocprim::radix_key_codec<key_type, Descending>;
 
         const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
         const unsigned int stripe  = flat_id % atomic_stripes;
@@ -191,8 +196,9 @@ struct radix_digit_count_helper
             ROCPRIM_UNROLL
             for(unsigned int i = 0; i < ItemsPerThread; i++)
             {
-                const bit_key_type bit_key = key_codec::encode(keys[i]);
-                const unsigned int digit = key_codec::extract_digit(bit_key, bit, current_radix_bits);
+                key_codec::encode_inplace(keys[i], decomposer);
+                const unsigned int digit
+                    = key_codec::extract_digit(keys[i], bit, current_radix_bits, decomposer);
                 const unsigned int pos = i * BlockSize + flat_id;
 
                 if(IsFull || pos < valid_count)
@@ -371,7 +377,8 @@ struct radix_sort_and_scatter_helper
              class KeysInputIterator,
              class KeysOutputIterator,
              class ValuesInputIterator,
-             class ValuesOutputIterator>
+             class ValuesOutputIterator,
+             class Decomposer = ::rocprim::identity_decomposer>
     ROCPRIM_DEVICE ROCPRIM_INLINE
     void sort_and_scatter(KeysInputIterator    keys_input,
                           KeysOutputIterator   keys_output,
@@ -382,7 +389,8 @@ struct radix_sort_and_scatter_helper
                           unsigned int         bit,
                           unsigned int         current_radix_bits,
                           Offset        digit_start, // i-th thread must pass i-th digit's value
-                          storage_type& storage_)
+                          storage_type& storage_,
+                          Decomposer    decomposer = {})
     {
         auto&              storage = storage_.get();
         const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
@@ -418,7 +426,7 @@ struct radix_sort_and_scatter_helper
                 // Note that this will lead to an incorrect digit count. Since this is the very last digit,
                 // it does not matter. It does cause the final digit offset to be increased past its end,
                 // but again this does not matter since this is the last iteration in which it will be used anyway.
-                const Key out_of_bounds = key_codec::get_out_of_bounds_key();
+                const Key out_of_bounds = key_codec::get_out_of_bounds_key(decomposer);
                 if ROCPRIM_IF_CONSTEXPR(load_warp_striped)
                 {
                     block_load_direct_warp_striped(flat_id,
@@ -440,7 +448,7 @@ struct radix_sort_and_scatter_helper
             ROCPRIM_UNROLL
             for(unsigned int i = 0; i < ItemsPerThread; ++i)
             {
-                key_codec::encode_inplace(keys[i]);
+                key_codec::encode_inplace(keys[i], decomposer);
             }
 
             unsigned int ranks[ItemsPerThread];
@@ -451,8 +459,8 @@ struct radix_sort_and_scatter_helper
                 keys,
                 ranks,
                 storage.rank,
-                [bit, current_radix_bits](const Key& key)
-                { return key_codec::extract_digit(key, bit, current_radix_bits); },
+                [bit, current_radix_bits, decomposer](const Key& key)
+                { return key_codec::extract_digit(key, bit, current_radix_bits, decomposer); },
                 exclusive_digit_prefix,
                 digit_counts);
 
@@ -482,8 +490,8 @@ struct radix_sort_and_scatter_helper
                 {
                     Key                key = storage.ordered_tile_keys[rank];
                     const unsigned int digit
-                        = key_codec::extract_digit(key, bit, current_radix_bits);
-                    key_codec::decode_inplace(key);
+                        = key_codec::extract_digit(key, bit, current_radix_bits, decomposer);
+                    key_codec::decode_inplace(key, decomposer);
                     const Offset global_offset        = storage.digit_offsets[digit];
                     keys_output[rank + global_offset] = key;
                 }
@@ -534,7 +542,8 @@ struct radix_sort_and_scatter_helper
                     if(IsFull || rank < valid_items)
                     {
                         const Key key = storage.ordered_tile_keys[rank];
-                        digits[i]     = key_codec::extract_digit(key, bit, current_radix_bits);
+                        digits[i]
+                            = key_codec::extract_digit(key, bit, current_radix_bits, decomposer);
                     }
                 }
 
@@ -675,7 +684,10 @@ struct radix_merge_compare<Descending, true, T, identity_decomposer>
                                             const unsigned int current_radix_bits,
                                             identity_decomposer = {})
     {
-        T radix_mask_upper  = (T(1) << (current_radix_bits + start_bit)) - 1;
+        // Shifting by the full width of T is undefined, which happens for the most significant
+        // bits of a key (e.g. bits [64, 128) of a 128-bit key)
+        const unsigned int end_bit = current_radix_bits + start_bit;
+        T radix_mask_upper = end_bit >= sizeof(T) * 8 ? T(~T(0)) : T((T(1) << end_bit) - 1);
         T radix_mask_bottom = (T(1) << start_bit) - 1;
         radix_mask = radix_mask_upper ^ radix_mask_bottom;
     }
@@ -746,6 +758,66 @@ struct radix_merge_compare<Descending, true, T, Decomposer>
     }
 };
 
+// The digit places of a onesweep sort: the first long_places places have long_bits bits, the other
+// places short_bits bits, and the last place ends at end_bit.
+struct onesweep_digit_places
+{
+    unsigned int begin_bit;
+    unsigned int end_bit;
+    unsigned int long_bits;
+    unsigned int short_bits;
+    unsigned int long_places;
+    unsigned int count;
+
+    ROCPRIM_HOST_DEVICE
+    unsigned int bit(const unsigned int place) const
+    {
+        return place < long_places
+                   ? begin_bit + place * long_bits
+                   : begin_bit + long_places * long_bits + (place - long_places) * short_bits;
+    }
+
+    ROCPRIM_HOST_DEVICE
+    unsigned int radix_bits(const unsigned int place) const
+    {
+        return ::rocprim::min(place < long_places ? long_bits : short_bits, end_bit - bit(place));
+    }
+
+    ROCPRIM_HOST_DEVICE
+    unsigned int place(const unsigned int bit) const
+    {
+        const unsigned int long_end_bit = begin_bit + long_places * long_bits;
+        return bit < long_end_bit ? (bit - begin_bit) / long_bits
+                                  : long_places + (bit - long_end_bit) / short_bits;
+    }
+};
+
+// Splits [begin_bit, end_bit) into the fewest places of at most long_bits bits, of which as many as
+// possible have short_bits bits. Without short places (short_bits is 0) every place has long_bits.
+ROCPRIM_HOST_DEVICE
+inline onesweep_digit_places make_onesweep_digit_places(const unsigned int begin_bit,
+                                                        const unsigned int end_bit,
+                                                        const unsigned int long_bits,
+                                                        const unsigned int short_bits)
+{
+    const unsigned int bits        = end_bit - begin_bit;
+    const unsigned int count       = ceiling_div(bits, long_bits);
+    unsigned int       long_places = count;
+    if(short_bits != 0)
+    {
+        // The long places cover the bits that the short places can not
+        long_places = count * short_bits >= bits
+                          ? 0
+                          : ceiling_div(bits - count * short_bits, long_bits - short_bits);
+    }
+    return {begin_bit,
+            end_bit,
+            long_bits,
+            short_bits != 0 ? short_bits : long_bits,
+            ::rocprim::min(long_places, count),
+            count};
+}
+
 template<class KeyType,
          unsigned int BlockSize,
          unsigned int ItemsPerThread,
@@ -762,7 +834,17 @@ struct onesweep_histograms_helper
     static constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
     static constexpr unsigned int digits_per_thread
         = ::rocprim::detail::ceiling_div(radix_size, BlockSize);
-    static constexpr unsigned int atomic_stripes = 4;
+    // The counters are striped to reduce the contention of the atomics, with as many stripes as
+    // fit 32 KiB (up to 4). All places of 8-bit digits of 64-bit keys have 4 stripes in 32 KiB,
+    // 128-bit keys have 2: 256 digits * 16 places * 4 stripes * 4 bytes would be the 64 KiB
+    // limit of the shared memory of a block, leaving one block per CU.
+    static constexpr unsigned int max_histogram_bytes = 32 * 1024;
+    static constexpr unsigned int atomic_stripes      = ::rocprim::max(
+        1u,
+        ::rocprim::min(4u,
+                       max_histogram_bytes
+                           / static_cast<unsigned int>(radix_size * max_digit_places
+                                                       * sizeof(uint32_t))));
     static constexpr unsigned int histogram_counters
         = radix_size * max_digit_places * atomic_stripes;
 
@@ -816,13 +898,12 @@ struct onesweep_histograms_helper
     }
 
     template<bool IsFull, class KeysInputIterator, class Offset>
-    ROCPRIM_DEVICE void count_digits(KeysInputIterator  keys_input,
-                                     Offset*            global_digit_counts,
-                                     const unsigned int valid_count,
-                                     Decomposer         decomposer,
-                                     const unsigned int begin_bit,
-                                     const unsigned int end_bit,
-                                     storage_type&      storage)
+    ROCPRIM_DEVICE void count_digits(KeysInputIterator           keys_input,
+                                     Offset*                     global_digit_counts,
+                                     const unsigned int          valid_count,
+                                     Decomposer                  decomposer,
+                                     const onesweep_digit_places digit_places,
+                                     storage_type&               storage)
     {
         const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
         const unsigned int stripe  = flat_id % atomic_stripes;
@@ -850,15 +931,15 @@ struct onesweep_histograms_helper
             key_codec::encode_inplace(keys[i], decomposer);
         }
 
-        for(unsigned int bit = begin_bit, place = 0; bit < end_bit; bit += RadixBits, ++place)
+        for(unsigned int place = 0; place < digit_places.count; ++place)
         {
             count_digits_at_place<IsFull>(flat_id,
                                           stripe,
                                           keys,
                                           place,
                                           decomposer,
-                                          bit,
-                                          min(RadixBits, end_bit - bit),
+                                          digit_places.bit(place),
+                                          digit_places.radix_bits(place),
                                           valid_count,
                                           storage);
         }
@@ -867,8 +948,7 @@ struct onesweep_histograms_helper
 
         // Combine the local histograms into a global histogram.
 
-        unsigned int place = 0;
-        for(unsigned int bit = begin_bit; bit < end_bit; bit += RadixBits)
+        for(unsigned int place = 0; place < digit_places.count; ++place)
         {
             for(unsigned int digit = flat_id; digit < radix_size; digit += BlockSize)
             {
@@ -883,7 +963,6 @@ struct onesweep_histograms_helper
                 ::rocprim::detail::atomic_add(&global_digit_counts[place * radix_size + digit],
                                               total);
             }
-            ++place;
         }
     }
 };
@@ -895,13 +974,13 @@ template<unsigned int BlockSize,
          class KeysInputIterator,
          class Offset,
          class Decomposer>
-ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void onesweep_histograms(KeysInputIterator  keys_input,
-                                                             Offset*            global_digit_counts,
-                                                             const Offset       size,
-                                                             const Offset       full_blocks,
-                                                             Decomposer         decomposer,
-                                                             const unsigned int begin_bit,
-                                                             const unsigned int end_bit)
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void onesweep_histograms(KeysInputIterator           keys_input,
+                         Offset*                     global_digit_counts,
+                         const Offset                size,
+                         const Offset                full_blocks,
+                         Decomposer                  decomposer,
+                         const onesweep_digit_places digit_places)
 {
     using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
     using count_helper_type = onesweep_histograms_helper<key_type,
@@ -924,8 +1003,7 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void onesweep_histograms(KeysInputIterator
                                                         global_digit_counts,
                                                         items_per_block,
                                                         decomposer,
-                                                        begin_bit,
-                                                        end_bit,
+                                                        digit_places,
                                                         storage);
     }
     else
@@ -935,14 +1013,17 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void onesweep_histograms(KeysInputIterator
                                                          global_digit_counts,
                                                          valid_in_last_block,
                                                          decomposer,
-                                                         begin_bit,
-                                                         end_bit,
+                                                         digit_places,
                                                          storage);
     }
 }
 
+// If trivial_digits is not null, trivial_digits[place] is set to the digit of every key when all
+// keys have the same digit in that place. It must be set to a value that is not a digit before.
 template<unsigned int BlockSize, unsigned int RadixBits, class Offset>
-ROCPRIM_DEVICE void onesweep_scan_histograms(Offset* global_digit_offsets)
+ROCPRIM_DEVICE void onesweep_scan_histograms(Offset*       global_digit_offsets,
+                                             const Offset  size,
+                                             unsigned int* trivial_digits)
 {
     using block_scan_type = block_scan<Offset, BlockSize>;
 
@@ -955,60 +1036,284 @@ ROCPRIM_DEVICE void onesweep_scan_histograms(Offset* global_digit_offsets)
 
     Offset offsets[items_per_thread];
     block_load_direct_blocked(flat_id, global_digit_offsets + block_offset, offsets, radix_size);
+    if(trivial_digits != nullptr)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; ++i)
+        {
+            const unsigned int digit = flat_id * items_per_thread + i;
+            if(digit < radix_size && offsets[i] == size)
+            {
+                trivial_digits[digit_place] = digit;
+            }
+        }
+    }
     block_scan_type{}.exclusive_scan(offsets, offsets, 0);
     block_store_direct_blocked(flat_id, global_digit_offsets + block_offset, offsets, radix_size);
 }
 
-struct onesweep_lookback_state
+// The value of trivial_digits of a digit place in which the keys have different digits.
+constexpr unsigned int onesweep_nontrivial_place = 0xFFFFFFFFu;
+// The value of trivial_digits of a pass that has nothing to sort and exits immediately.
+constexpr unsigned int onesweep_skipped_pass = 0xFFFFFFFEu;
+
+// The bits that a pass of the onesweep iteration sorts, planned on the device.
+struct onesweep_pass
+{
+    unsigned int bit;
+    unsigned int radix_bits;
+};
+
+// Plans the passes of the onesweep iterations after the histograms are scanned, with one block and
+// without a host synchronization. The host launches one pass for every digit place, and the
+// buffers that every pass reads from and writes to are fixed. The digit places in which all keys
+// have the same digit are not sorted: the places with different digits are moved to the first
+// passes, in order, and at most two copies keep the result in the buffer of the last pass. The
+// remaining passes are skipped. The digit offsets and trivial_digits are reordered to the passes,
+// and passes[pass] holds the bits of the place that the pass sorts. The places are moved to
+// earlier passes, whose digits are not narrower, so the sort kernel of every pass fits its place.
+template<unsigned int BlockSize, unsigned int RadixBits, class Offset>
+ROCPRIM_DEVICE void onesweep_plan_passes(Offset*                     global_digit_offsets,
+                                         const Offset                size,
+                                         unsigned int*               trivial_digits,
+                                         onesweep_pass*              passes,
+                                         const onesweep_digit_places digit_places)
+{
+    constexpr unsigned int radix_size = 1u << RadixBits;
+    // The copies move all keys to the offset of this digit, which fits every pass
+    constexpr unsigned int copied_digit = 0;
+
+    const unsigned int places = digit_places.count;
+
+    ROCPRIM_SHARED_MEMORY unsigned int sorted_passes;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    if(flat_id == 0)
+    {
+        unsigned int sorted = 0;
+        for(unsigned int place = 0; place < places; ++place)
+        {
+            if(trivial_digits[place] < radix_size)
+            {
+                continue;
+            }
+            // The places are moved to earlier passes, so the place is read before it is written
+            passes[sorted] = {digit_places.bit(place), digit_places.radix_bits(place)};
+            trivial_digits[sorted] = onesweep_nontrivial_place;
+            ++sorted;
+        }
+
+        // Every pass writes to the other buffer than it reads from, so the number of passes that
+        // move the keys must have the parity of the number of places.
+        unsigned int moved = sorted + ((places - sorted) & 1u);
+        moved              = moved == 0 ? 2 : moved;
+        for(unsigned int pass = sorted; pass < places; ++pass)
+        {
+            passes[pass]         = {digit_places.begin_bit, 0};
+            trivial_digits[pass] = pass < moved ? copied_digit : onesweep_skipped_pass;
+        }
+        sorted_passes = sorted;
+    }
+    ::rocprim::syncthreads();
+
+    // Every thread moves the offsets of the same digits in increasing passes, and every pass reads
+    // a place that is not before it, so the places are read before they are written.
+    const unsigned int sorted = sorted_passes;
+    for(unsigned int pass = 0; pass < places; ++pass)
+    {
+        const unsigned int place = pass < sorted ? digit_places.place(passes[pass].bit) : 0;
+        for(unsigned int digit = flat_id; digit < radix_size; digit += BlockSize)
+        {
+            global_digit_offsets[pass * radix_size + digit]
+                = pass < sorted ? global_digit_offsets[place * radix_size + digit]
+                                : (digit <= copied_digit ? 0 : size);
+        }
+    }
+}
+
+// The two most significant bits are used to indicate the status of the prefix, the next bits hold
+// the epoch of the launch that stored the prefix - leaving the low `ValueBits` bits for the counter
+// value. A prefix stored by a launch with another epoch reads as empty, so launches that use new
+// epochs do not need the states to be cleared in between.
+template<class UnderlyingType, unsigned int ValueBits>
+struct onesweep_basic_lookback_state
 {
-    // The two most significant bits are used to indicate the status of the prefix - leaving the other 30 bits for the
-    // counter value.
-    using underlying_type = uint32_t;
+    using underlying_type = UnderlyingType;
 
     static constexpr unsigned int state_bits = 8u * sizeof(underlying_type);
+    static constexpr unsigned int value_bits = ValueBits;
+    static constexpr unsigned int epoch_bits = state_bits - 2 - value_bits;
 
     enum prefix_flag : underlying_type
     {
-        EMPTY    = 0,
-        PARTIAL  = 1u << (state_bits - 2),
-        COMPLETE = 2u << (state_bits - 2)
+        EMPTY    = underlying_type(0),
+        PARTIAL  = underlying_type(1) << (state_bits - 2),
+        COMPLETE = underlying_type(2) << (state_bits - 2)
     };
 
-    static constexpr underlying_type status_mask = 3u << (state_bits - 2);
-    static constexpr underlying_type value_mask  = ~status_mask;
+    static constexpr underlying_type status_mask = underlying_type(3) << (state_bits - 2);
+    static constexpr underlying_type value_mask  = (underlying_type(1) << value_bits) - 1;
+    static constexpr unsigned int    max_epoch   = (1u << epoch_bits) - 1;
 
     underlying_type state;
 
-    ROCPRIM_DEVICE ROCPRIM_INLINE explicit onesweep_lookback_state(underlying_type state)
+    ROCPRIM_DEVICE ROCPRIM_INLINE explicit onesweep_basic_lookback_state(underlying_type state)
         : state(state)
     {}
 
-    ROCPRIM_DEVICE ROCPRIM_INLINE onesweep_lookback_state(prefix_flag status, underlying_type value)
-        : state(static_cast<underlying_type>(status) | value)
+    ROCPRIM_DEVICE ROCPRIM_INLINE onesweep_basic_lookback_state(prefix_flag        status,
+                                                                const unsigned int value,
+                                                                const unsigned int epoch = 0)
+        : state(static_cast<underlying_type>(status)
+                | (static_cast<underlying_type>(epoch) << value_bits) | value)
     {}
 
-    ROCPRIM_DEVICE ROCPRIM_INLINE underlying_type value() const
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int value() const
     {
-        return this->state & value_mask;
+        return static_cast<unsigned int>(this->state & value_mask);
     }
 
-    ROCPRIM_DEVICE ROCPRIM_INLINE prefix_flag status() const
+    // Returns the status of the prefix, EMPTY if it was stored by a launch with another epoch.
+    ROCPRIM_DEVICE ROCPRIM_INLINE prefix_flag status(const unsigned int epoch = 0) const
     {
-        return static_cast<prefix_flag>(this->state & status_mask);
+        const unsigned int state_epoch
+            = static_cast<unsigned int>((this->state & ~status_mask) >> value_bits);
+        return state_epoch == epoch ? static_cast<prefix_flag>(this->state & status_mask) : EMPTY;
     }
 
-    ROCPRIM_DEVICE ROCPRIM_INLINE static onesweep_lookback_state load(onesweep_lookback_state* ptr)
+    ROCPRIM_DEVICE ROCPRIM_INLINE static onesweep_basic_lookback_state
+        load(onesweep_basic_lookback_state* ptr)
     {
         underlying_type state = ::rocprim::detail::atomic_load(&ptr->state);
-        return onesweep_lookback_state(state);
+        return onesweep_basic_lookback_state(state);
     }
 
-    ROCPRIM_DEVICE ROCPRIM_INLINE void store(onesweep_lookback_state* ptr) const
+    ROCPRIM_DEVICE ROCPRIM_INLINE void store(onesweep_basic_lookback_state* ptr) const
     {
         ::rocprim::detail::atomic_store(&ptr->state, this->state);
     }
 };
 
+// The state holds 32-bit counts with 30 bits of epochs.
+using onesweep_lookback_state = onesweep_basic_lookback_state<uint64_t, 32>;
+
+// The compact state holds 24-bit counts with 6 bits of epochs in half the size, so batches of
+// fewer than 2^24 items publish and read their prefixes with half the memory traffic, and clear
+// half the bytes once every 63 launches.
+using onesweep_compact_lookback_state = onesweep_basic_lookback_state<uint32_t, 24>;
+
+// Returns whether the prefixes of the digits of a batch fit the compact lookback states.
+ROCPRIM_HOST_DEVICE
+constexpr bool onesweep_compact_lookback(const size_t items_per_batch)
+{
+    return items_per_batch <= onesweep_compact_lookback_state::value_mask;
+}
+
+// The lookback states of a launch, which are compact or not.
+struct onesweep_lookback_states
+{
+    void* states;
+    bool  compact;
+
+    ROCPRIM_HOST_DEVICE onesweep_lookback_states(onesweep_lookback_state* states)
+        : states(states), compact(false)
+    {}
+
+    ROCPRIM_HOST_DEVICE onesweep_lookback_states(onesweep_compact_lookback_state* states)
+        : states(states), compact(true)
+    {}
+
+    ROCPRIM_HOST_DEVICE size_t state_size() const
+    {
+        return compact ? sizeof(onesweep_compact_lookback_state) : sizeof(onesweep_lookback_state);
+    }
+
+    ROCPRIM_HOST_DEVICE unsigned int max_epoch() const
+    {
+        return compact ? onesweep_compact_lookback_state::max_epoch
+                       : onesweep_lookback_state::max_epoch;
+    }
+};
+
+// The epoch of the launches that share the lookback states of a call, and how many states have
+// been cleared since the epochs last started over.
+struct onesweep_lookback_epoch
+{
+    unsigned int epoch          = 0;
+    size_t       cleared_states = 0;
+
+    // Advances to the epoch of the next launch, which uses `num_states` states. The states are
+    // only cleared (all zeroes is the empty prefix) before the first launch, before a launch that
+    // uses more states than were cleared, and when the epochs wrap around.
+    hipError_t next(const onesweep_lookback_states states,
+                    const size_t                   num_states,
+                    const hipStream_t              stream)
+    {
+        if(epoch != 0 && epoch < states.max_epoch() && num_states <= cleared_states)
+        {
+            ++epoch;
+            return hipSuccess;
+        }
+        ROCPRIM_RETURN_ON_ERROR(
+            hipMemsetAsync(states.states, 0, states.state_size() * num_states, stream));
+        epoch          = 1;
+        cleared_states = num_states;
+        return hipSuccess;
+    }
+};
+
+// Publishes the count of a digit in a block and finds the exclusive prefix of the digit with
+// a decoupled look-back over the counts of the preceding blocks.
+template<class LookbackState>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned int onesweep_lookback(LookbackState*                lookback_states,
+                               const unsigned int            block_id,
+                               const unsigned int            radix_size,
+                               const unsigned int            digit,
+                               const unsigned int            digit_count,
+                               const unsigned int            lookback_epoch,
+                               const lookback_telemetry      telemetry,
+                               const lookback_backoff_params backoff)
+{
+    LookbackState* block_state = &lookback_states[block_id * radix_size + digit];
+    LookbackState(LookbackState::PARTIAL, digit_count, lookback_epoch).store(block_state);
+
+    unsigned int exclusive_prefix  = 0;
+    unsigned int lookback_block_id = block_id;
+    // The main back tracking loop.
+    while(lookback_block_id > 0)
+    {
+        --lookback_block_id;
+        LookbackState* lookback_state_ptr
+            = &lookback_states[lookback_block_id * radix_size + digit];
+        LookbackState    lookback_state = LookbackState::load(lookback_state_ptr);
+        unsigned int     spins          = 0;
+        lookback_backoff wait(backoff);
+        while(lookback_state.status(lookback_epoch) == LookbackState::EMPTY)
+        {
+            ++spins;
+            wait();
+            lookback_state = LookbackState::load(lookback_state_ptr);
+        }
+        telemetry.add_wait_spins(lookback_block_id, spins);
+
+        exclusive_prefix += lookback_state.value();
+        if(lookback_state.status(lookback_epoch) == LookbackState::COMPLETE)
+        {
+            break;
+        }
+    }
+    telemetry.record_distance(block_id, block_id - lookback_block_id);
+
+    // Update the state for the current block.
+    // Note that this should not deadlock, as HSA guarantees that blocks with a lower block ID
+    // launch before those with a higher block id.
+    LookbackState(LookbackState::COMPLETE, exclusive_prefix + digit_count, lookback_epoch)
+        .store(block_state);
+
+    return exclusive_prefix;
+}
+
 template<class Key,
          class Value,
          class Offset,
@@ -1055,18 +1360,21 @@ struct onesweep_iteration_helper
              class KeysOutputIterator,
              class ValuesInputIterator,
              class ValuesOutputIterator>
-    ROCPRIM_DEVICE void onesweep(KeysInputIterator        keys_input,
-                                 KeysOutputIterator       keys_output,
-                                 ValuesInputIterator      values_input,
-                                 ValuesOutputIterator     values_output,
-                                 Offset*                  global_digit_offsets_in,
-                                 Offset*                  global_digit_offsets_out,
-                                 onesweep_lookback_state* lookback_states,
-                                 Decomposer               decomposer,
-                                 const unsigned int       bit,
-                                 const unsigned int       current_radix_bits,
-                                 const unsigned int       valid_items,
-                                 storage_type_&           storage)
+    ROCPRIM_DEVICE void onesweep(KeysInputIterator             keys_input,
+                                 KeysOutputIterator            keys_output,
+                                 ValuesInputIterator           values_input,
+                                 ValuesOutputIterator          values_output,
+                                 Offset*                       global_digit_offsets_in,
+                                 Offset*                       global_digit_offsets_out,
+                                 onesweep_lookback_states      lookback_states,
+                                 const unsigned int            lookback_epoch,
+                                 const lookback_telemetry      telemetry,
+                                 const lookback_backoff_params backoff,
+                                 Decomposer                    decomposer,
+                                 const unsigned int            bit,
+                                 const unsigned int            current_radix_bits,
+                                 const unsigned int            valid_items,
+                                 storage_type_&                storage)
     {
         const unsigned int flat_id      = ::rocprim::detail::block_thread_id<0>();
         const unsigned int block_id     = ::rocprim::detail::block_id<0>();
@@ -1145,46 +1453,33 @@ struct onesweep_iteration_helper
         ::rocprim::syncthreads();
 
         // Compute the global prefix for each histogram.
-        // At this point `lookback_states` already hold `onesweep_lookback_state::EMPTY`.
+        // At this point `lookback_states` hold empty prefixes or prefixes of other epochs.
         ROCPRIM_UNROLL
         for(unsigned int i = 0; i < digits_per_thread; ++i)
         {
             const unsigned int digit = flat_id * digits_per_thread + i;
             if(radix_size % BlockSize == 0 || digit < radix_size)
             {
-                onesweep_lookback_state* block_state
-                    = &lookback_states[block_id * radix_size + digit];
-                onesweep_lookback_state(onesweep_lookback_state::PARTIAL, digit_counts[i])
-                    .store(block_state);
-
-                unsigned int exclusive_prefix  = 0;
-                unsigned int lookback_block_id = block_id;
-                // The main back tracking loop.
-                while(lookback_block_id > 0)
-                {
-                    --lookback_block_id;
-                    onesweep_lookback_state* lookback_state_ptr
-                        = &lookback_states[lookback_block_id * radix_size + digit];
-                    onesweep_lookback_state lookback_state
-                        = onesweep_lookback_state::load(lookback_state_ptr);
-                    while(lookback_state.status() == onesweep_lookback_state::EMPTY)
-                    {
-                        lookback_state = onesweep_lookback_state::load(lookback_state_ptr);
-                    }
-
-                    exclusive_prefix += lookback_state.value();
-                    if(lookback_state.status() == onesweep_lookback_state::COMPLETE)
-                    {
-                        break;
-                    }
-                }
-
-                // Update the state for the current block.
-                const unsigned int inclusive_digit_prefix = exclusive_prefix + digit_counts[i];
-                // Note that this should not deadlock, as HSA guarantees that blocks with a lower block ID launch before
-                // those with a higher block id.
-                onesweep_lookback_state(onesweep_lookback_state::COMPLETE, inclusive_digit_prefix)
-                    .store(block_state);
+                const unsigned int exclusive_prefix
+                    = lookback_states.compact
+                          ? onesweep_lookback(
+                              static_cast<onesweep_compact_lookback_state*>(lookback_states.states),
+                              block_id,
+                              radix_size,
+                              digit,
+                              digit_counts[i],
+                              lookback_epoch,
+                              telemetry,
+                              backoff)
+                          : onesweep_lookback(
+                              static_cast<onesweep_lookback_state*>(lookback_states.states),
+                              block_id,
+                              radix_size,
+                              digit,
+                              digit_counts[i],
+                              lookback_epoch,
+                              telemetry,
+                              backoff);
 
                 // Subtract the exclusive digit prefix from the global offset here, since we already ordered the keys in shared
                 // memory.
@@ -1301,6 +1596,65 @@ struct onesweep_iteration_helper
     }
 };
 
+// Scatters a tile of a digit place in which every key has the same digit. The scatter is stable,
+// so it is a copy to the offset of that digit, and the keys do not need to be ranked.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class Offset>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void onesweep_copy(KeysInputIterator    keys_input,
+                   KeysOutputIterator   keys_output,
+                   ValuesInputIterator  values_input,
+                   ValuesOutputIterator values_output,
+                   const unsigned int   size,
+                   Offset*              global_digit_offsets_in,
+                   Offset*              global_digit_offsets_out,
+                   const unsigned int   digit,
+                   const unsigned int   radix_size,
+                   const unsigned int   valid_items)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id       = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int block_id      = ::rocprim::detail::block_id<0>();
+    const unsigned int block_offset  = block_id * items_per_block;
+    const Offset       output_offset = global_digit_offsets_in[digit] + block_offset;
+
+    key_type keys[ItemsPerThread];
+    block_load_direct_striped<BlockSize>(flat_id, keys_input + block_offset, keys, valid_items);
+    block_store_direct_striped<BlockSize>(flat_id, keys_output + output_offset, keys, valid_items);
+    if ROCPRIM_IF_CONSTEXPR(with_values)
+    {
+        value_type values[ItemsPerThread];
+        block_load_direct_striped<BlockSize>(flat_id,
+                                             values_input + block_offset,
+                                             values,
+                                             valid_items);
+        block_store_direct_striped<BlockSize>(flat_id,
+                                              values_output + output_offset,
+                                              values,
+                                              valid_items);
+    }
+
+    // Update the global digit offset if we are batching
+    if(block_id == ::rocprim::detail::grid_size<0>() - 1)
+    {
+        for(unsigned int d = flat_id; d < radix_size; d += BlockSize)
+        {
+            global_digit_offsets_out[d] = global_digit_offsets_in[d] + (d == digit ? size : 0);
+        }
+    }
+}
+
 template<unsigned int               BlockSize,
          unsigned int               ItemsPerThread,
          unsigned int               RadixBits,
@@ -1313,18 +1667,23 @@ template<unsigned int               BlockSize,
          class Offset,
          class Decomposer>
 ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
-    onesweep_iteration(KeysInputIterator        keys_input,
-                       KeysOutputIterator       keys_output,
-                       ValuesInputIterator      values_input,
-                       ValuesOutputIterator     values_output,
-                       const unsigned int       size,
-                       Offset*                  global_digit_offsets_in,
-                       Offset*                  global_digit_offsets_out,
-                       onesweep_lookback_state* lookback_states,
-                       Decomposer               decomposer,
-                       const unsigned int       bit,
-                       const unsigned int       current_radix_bits,
-                       const unsigned int       full_blocks)
+    onesweep_iteration(KeysInputIterator             keys_input,
+                       KeysOutputIterator            keys_output,
+                       ValuesInputIterator           values_input,
+                       ValuesOutputIterator          values_output,
+                       const unsigned int            size,
+                       Offset*                       global_digit_offsets_in,
+                       Offset*                       global_digit_offsets_out,
+                       onesweep_lookback_states      lookback_states,
+                       const unsigned int            lookback_epoch,
+                       const lookback_telemetry      telemetry,
+                       const lookback_backoff_params backoff,
+                       const unsigned int*           trivial_digit,
+                       const onesweep_pass*          pass,
+                       Decomposer                    decomposer,
+                       unsigned int                  bit,
+                       unsigned int                  current_radix_bits,
+                       const unsigned int            full_blocks)
 {
     using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
@@ -1342,6 +1701,36 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
     constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
     const unsigned int     block_id        = ::rocprim::detail::block_id<0>();
 
+    constexpr unsigned int radix_size      = 1u << RadixBits;
+
+    if(trivial_digit != nullptr && *trivial_digit == onesweep_skipped_pass)
+    {
+        return;
+    }
+    if(pass != nullptr)
+    {
+        bit                = pass->bit;
+        current_radix_bits = pass->radix_bits;
+    }
+
+    // All keys have the same digit in this place, which the histograms have found
+    if(trivial_digit != nullptr && *trivial_digit < radix_size)
+    {
+        onesweep_copy<BlockSize, ItemsPerThread>(keys_input,
+                                                 keys_output,
+                                                 values_input,
+                                                 values_output,
+                                                 size,
+                                                 global_digit_offsets_in,
+                                                 global_digit_offsets_out,
+                                                 *trivial_digit,
+                                                 radix_size,
+                                                 block_id < full_blocks
+                                                     ? items_per_block
+                                                     : size - items_per_block * full_blocks);
+        return;
+    }
+
     ROCPRIM_SHARED_MEMORY typename onesweep_iteration_helper_type::storage_type storage;
 
     if(block_id < full_blocks)
@@ -1353,6 +1742,9 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
                                                                  global_digit_offsets_in,
                                                                  global_digit_offsets_out,
                                                                  lookback_states,
+                                                                 lookback_epoch,
+                                                                 telemetry,
+                                                                 backoff,
                                                                  decomposer,
                                                                  bit,
                                                                  current_radix_bits,
@@ -1369,6 +1761,9 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
                                                                   global_digit_offsets_in,
                                                                   global_digit_offsets_out,
                                                                   lookback_states,
+                                                                  lookback_epoch,
+                                                                  telemetry,
+                                                                  backoff,
                                                                   decomposer,
                                                                   bit,
                                                                   current_radix_bits,
@@ -0,0 +1,151 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_RADIX_SORT_COLUMNS_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_RADIX_SORT_COLUMNS_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+constexpr unsigned int radix_sort_columns_block_size       = 256;
+constexpr unsigned int radix_sort_columns_items_per_thread = 4;
+
+// Copies the items of one column at the gathered positions. The items of a thread are strided by
+// the block size, so both the index loads and the stores are coalesced.
+template<class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE void radix_sort_columns_gather(const void* const   input,
+                                                             void* const         output,
+                                                             const unsigned int* indices,
+                                                             const size_t        tile_offset,
+                                                             const size_t        size)
+{
+    const T* const typed_input  = static_cast<const T*>(input);
+    T* const       typed_output = static_cast<T*>(output);
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < radix_sort_columns_items_per_thread; ++i)
+    {
+        const size_t position = tile_offset + i * radix_sort_columns_block_size;
+        if(position < size)
+        {
+            typed_output[position] = typed_input[indices[i]];
+        }
+    }
+}
+
+// Fallback for widths without a matching type, or for columns that are not aligned to their
+// width.
+ROCPRIM_DEVICE ROCPRIM_INLINE void radix_sort_columns_gather_bytes(const void* const   input,
+                                                                   void* const         output,
+                                                                   const size_t        width,
+                                                                   const unsigned int* indices,
+                                                                   const size_t        tile_offset,
+                                                                   const size_t        size)
+{
+    const unsigned char* const byte_input  = static_cast<const unsigned char*>(input);
+    unsigned char* const       byte_output = static_cast<unsigned char*>(output);
+    for(unsigned int i = 0; i < radix_sort_columns_items_per_thread; ++i)
+    {
+        const size_t position = tile_offset + i * radix_sort_columns_block_size;
+        if(position < size)
+        {
+            const unsigned char* const source      = byte_input + indices[i] * width;
+            unsigned char* const       destination = byte_output + position * width;
+            for(size_t byte = 0; byte < width; ++byte)
+            {
+                destination[byte] = source[byte];
+            }
+        }
+    }
+}
+
+// Gathers every value column with the sorted indices. The indices of a tile are loaded once and
+// reused for all columns, each of which is copied with loads of its own width.
+template<class ValuesInputsIterator, class ValuesOutputsIterator, class ValueSizesIterator>
+ROCPRIM_KERNEL __launch_bounds__(radix_sort_columns_block_size) void radix_sort_columns_kernel(
+    const unsigned int* const indices,
+    const size_t              size,
+    ValuesInputsIterator      values_inputs,
+    ValuesOutputsIterator     values_outputs,
+    ValueSizesIterator        value_sizes,
+    const unsigned int        num_columns)
+{
+    constexpr unsigned int items_per_block
+        = radix_sort_columns_block_size * radix_sort_columns_items_per_thread;
+
+    const size_t tile_offset = static_cast<size_t>(block_id<0>()) * items_per_block
+                               + block_thread_id<0>();
+
+    unsigned int items[radix_sort_columns_items_per_thread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < radix_sort_columns_items_per_thread; ++i)
+    {
+        const size_t position = tile_offset + i * radix_sort_columns_block_size;
+        items[i]              = position < size ? indices[position] : 0;
+    }
+
+    for(unsigned int column = 0; column < num_columns; ++column)
+    {
+        const void* const input  = values_inputs[column];
+        void* const       output = values_outputs[column];
+        const size_t      width  = value_sizes[column];
+
+        const uintptr_t alignment
+            = reinterpret_cast<uintptr_t>(input) | reinterpret_cast<uintptr_t>(output);
+        if(!is_power_of_two(width) || width > 16 || (alignment & (width - 1)) != 0)
+        {
+            radix_sort_columns_gather_bytes(input, output, width, items, tile_offset, size);
+            continue;
+        }
+
+        switch(width)
+        {
+            case 1:
+                radix_sort_columns_gather<uint8_t>(input, output, items, tile_offset, size);
+                break;
+            case 2:
+                radix_sort_columns_gather<uint16_t>(input, output, items, tile_offset, size);
+                break;
+            case 4:
+                radix_sort_columns_gather<uint32_t>(input, output, items, tile_offset, size);
+                break;
+            case 8:
+                radix_sort_columns_gather<uint64_t>(input, output, items, tile_offset, size);
+                break;
+            default:
+                radix_sort_columns_gather<uint4>(input, output, items, tile_offset, size);
+                break;
+        }
+    }
+}
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_RADIX_SORT_COLUMNS_HPP_
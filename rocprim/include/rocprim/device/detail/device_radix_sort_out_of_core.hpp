@@ -0,0 +1,117 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_RADIX_SORT_OUT_OF_CORE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_RADIX_SORT_OUT_OF_CORE_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "device_binary_search.hpp"
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Maximum number of sorted runs that are merged at once. More runs are merged in several passes.
+constexpr unsigned int out_of_core_max_fan_in = 16;
+
+constexpr unsigned int out_of_core_corank_block_size = 64;
+
+// Offset of the first key of window `r`, or of the key past its contribution to the next merged
+// keys when `counts` is set.
+struct out_of_core_window_offset
+{
+    size_t        window_capacity;
+    const size_t* counts;
+
+    ROCPRIM_HOST_DEVICE
+    size_t operator()(const unsigned int r) const
+    {
+        return r * window_capacity + (counts != nullptr ? counts[r] : 0);
+    }
+};
+
+// Finds, for every run, how many keys of its window belong to the next `target` merged keys.
+//
+// Window `r` holds the next `lengths[r]` keys of run `r`, and the keys are merged stably:
+// equal keys are ordered by their run. The rank of the key at position `i` of window `run`
+// is `i`, plus the number of keys of earlier runs that are not greater, plus the number of
+// keys of later runs that are smaller. The keys with a rank below `target` are the next
+// merged keys. This only needs the windows: a window that does not hold the rest of its run
+// is full, and every key past it has a rank of at least the window capacity.
+template<class Key, class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(out_of_core_corank_block_size) void out_of_core_corank_kernel(
+    const Key* const    windows,
+    const size_t        window_capacity,
+    const size_t* const lengths,
+    size_t* const       counts,
+    const unsigned int  runs,
+    const size_t        target,
+    BinaryFunction      compare_function)
+{
+    const unsigned int run = blockIdx.x * out_of_core_corank_block_size + threadIdx.x;
+    if(run >= runs)
+    {
+        return;
+    }
+
+    const Key* const window = windows + run * window_capacity;
+
+    size_t begin = 0;
+    size_t end   = lengths[run];
+    while(begin < end)
+    {
+        const size_t mid = begin + (end - begin) / 2;
+        const Key    key = window[mid];
+
+        size_t rank = mid;
+        for(unsigned int other = 0; other < runs && rank < target; ++other)
+        {
+            if(other == run)
+            {
+                continue;
+            }
+            const Key* const other_window = windows + other * window_capacity;
+            rank += other < run
+                        ? upper_bound_n(other_window, lengths[other], key, compare_function)
+                        : lower_bound_n(other_window, lengths[other], key, compare_function);
+        }
+
+        if(rank < target)
+        {
+            begin = mid + 1;
+        }
+        else
+        {
+            end = mid;
+        }
+    }
+    counts[run] = begin;
+}
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_RADIX_SORT_OUT_OF_CORE_HPP_
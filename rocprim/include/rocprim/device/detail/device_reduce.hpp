@@ -34,6 +34,8 @@
 #include "../../block/block_load.hpp"
 #include "../../block/block_reduce.hpp"
 
+#include "transform_load.hpp"
+
 #include <iterator>
 #include <type_traits>
 
@@ -126,7 +128,10 @@ void block_reduce_kernel_impl(InputIterator input,
     }
     else
     {
-        block_load_direct_striped<block_size>(flat_id, input + block_offset, values);
+        if(!transform_load_blocked_vectorized(flat_id, input + block_offset, values))
+        {
+            block_load_direct_striped<block_size>(flat_id, input + block_offset, values);
+        }
 
         // load input values into values
         block_reduce_type().reduce(values, // input
@@ -145,6 +150,109 @@ void block_reduce_kernel_impl(InputIterator input,
                                                           reduce_op);
     }
 }
+
+// Single-pass reduction: every block reduces its tile into `block_partials`, and the last block
+// to finish reduces the partials. The partials are always combined in block order by the same
+// block-wide reduction, so the result does not depend on the order in which blocks complete.
+// `retired_blocks` must be zero-initialized, and the grid must have at most
+// `block_size * items_per_thread` blocks.
+template<bool WithInitialValue,
+         class Config,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void single_pass_reduce_kernel_impl(InputIterator       input,
+                                    const size_t        input_size,
+                                    ResultType* const   block_partials,
+                                    unsigned int* const retired_blocks,
+                                    OutputIterator      output,
+                                    InitValueType       initial_value,
+                                    BinaryFunction      reduce_op)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.reduce_config.block_size;
+    constexpr unsigned int items_per_thread = params.reduce_config.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using result_type = ResultType;
+    using block_reduce_type
+        = ::rocprim::block_reduce<result_type, block_size, params.block_reduce_method>;
+
+    ROCPRIM_SHARED_MEMORY bool is_last_block;
+
+    const unsigned int flat_id          = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int flat_block_id    = ::rocprim::detail::block_id<0>();
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+    const size_t       block_offset     = static_cast<size_t>(flat_block_id) * items_per_block;
+
+    const auto reduce_tile = [&](auto tile_input, const unsigned int valid) -> result_type
+    {
+        result_type values[items_per_thread];
+        result_type tile_value;
+        if(valid < items_per_block)
+        {
+            block_load_direct_striped<block_size>(flat_id, tile_input, values, valid);
+
+            tile_value = values[0];
+            ROCPRIM_UNROLL
+            for(unsigned int i = 1; i < items_per_thread; i++)
+            {
+                if(flat_id + i * block_size < valid)
+                {
+                    tile_value = reduce_op(tile_value, values[i]);
+                }
+            }
+            block_reduce_type().reduce(tile_value,
+                                       tile_value,
+                                       std::min(valid, block_size),
+                                       reduce_op);
+        }
+        else
+        {
+            if(!transform_load_blocked_vectorized(flat_id, tile_input, values))
+            {
+                block_load_direct_striped<block_size>(flat_id, tile_input, values);
+            }
+            block_reduce_type().reduce(values, tile_value, reduce_op);
+        }
+        return tile_value;
+    };
+
+    const unsigned int valid
+        = static_cast<unsigned int>(std::min<size_t>(input_size - block_offset, items_per_block));
+    const result_type block_value = reduce_tile(input + block_offset, valid);
+
+    if(flat_id == 0)
+    {
+        block_partials[flat_block_id] = block_value;
+        // Make the partial visible before this block is counted as retired.
+        ::rocprim::detail::memory_fence_device();
+        is_last_block
+            = ::rocprim::detail::atomic_add(retired_blocks, 1u) == number_of_blocks - 1;
+    }
+    ::rocprim::syncthreads();
+
+    if(!is_last_block)
+    {
+        return;
+    }
+
+    // All other partials are visible after this fence.
+    ::rocprim::detail::memory_fence_device();
+    const result_type total = reduce_tile(block_partials, number_of_blocks);
+
+    if(flat_id == 0)
+    {
+        *output = reduce_with_initial<WithInitialValue>(total,
+                                                        static_cast<result_type>(initial_value),
+                                                        reduce_op);
+    }
+}
+
 } // namespace detail
 
 END_ROCPRIM_NAMESPACE
@@ -57,9 +57,20 @@ using accumulator_type_t =
 template<typename AccumulatorType>
 using wrapped_type_t = rocprim::tuple<unsigned int, AccumulatorType>;
 
-template<typename AccumulatorType, bool UseSleep = false>
-using lookback_scan_state_t
-    = detail::lookback_scan_state<wrapped_type_t<AccumulatorType>, UseSleep>;
+template<typename AccumulatorType>
+using lookback_scan_state_t = detail::lookback_scan_state<wrapped_type_t<AccumulatorType>>;
+
+// The open run of a reduce-by-key over successive chunks, see streaming_reduce_by_key.
+template<typename KeyType, typename AccumulatorType>
+struct stream_state
+{
+    // The last key of the run.
+    KeyType key;
+    // The reduction of the values of the run so far.
+    AccumulatorType aggregate;
+    // Zero until a chunk has been reduced.
+    unsigned int has_open_run;
+};
 
 template<typename EqualityOp>
 struct guarded_inequality_wrapper
@@ -304,7 +315,9 @@ public:
                      const std::size_t            size,
                      storage_type&                storage,
                      const std::size_t* const     global_head_count,
-                     const AccumulatorType* const previous_accumulated)
+                     const AccumulatorType* const previous_accumulated,
+                     const stream_state<KeyType, AccumulatorType>* const stream_carry_in,
+                     stream_state<KeyType, AccumulatorType>* const       stream_carry_out)
     {
 
         static constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
@@ -323,6 +336,12 @@ public:
         const bool is_global_last_tile  = global_tile_id == total_number_of_tiles - 1;
         // first tile in this launch
         const bool is_first_tile = tile_id == 0;
+        // The open run of the preceding chunks of a stream is the segment before the first key.
+        const bool carry_in = stream_carry_in != nullptr && stream_carry_in->has_open_run;
+        // The first segment head of the input does not end a segment.
+        const bool starts_stream = is_global_first_tile && !carry_in;
+        // The last segment of a chunk of a stream is not written, but carried to the next chunk.
+        const bool keeps_last_segment = stream_carry_out != nullptr;
 
         // When in last tile valid_in_global_last_tile = remaining
         const unsigned int valid_in_global_last_tile
@@ -353,6 +372,10 @@ public:
                                         is_global_last_tile,
                                         remaining,
                                         storage.scan.flags);
+        if(is_global_first_tile && carry_in && flat_thread_id == 0)
+        {
+            head_flags[0] = !compare(stream_carry_in->key, keys[0]);
+        }
 
         wrapped_type wrapped_values[ItemsPerThread];
         for(unsigned int i = 0; i < ItemsPerThread; ++i)
@@ -376,6 +399,10 @@ public:
             {
                 initial_value = ::rocprim::make_tuple(0u, *previous_accumulated);
             }
+            else if(carry_in)
+            {
+                initial_value = ::rocprim::make_tuple(0u, stream_carry_in->aggregate);
+            }
 
             block_scan_type{}.exclusive_scan(wrapped_values,
                                              wrapped_values,
@@ -420,7 +447,7 @@ public:
         rocprim::syncthreads();
 
         const std::size_t segment_heads_in_previous_launches
-            = global_head_count != nullptr ? *global_head_count : 0u;
+            = (global_head_count != nullptr ? *global_head_count : 0u) + (carry_in ? 1u : 0u);
 
         // At this point each item that is flagged as segment head has
         // - The first key of the segment
@@ -435,28 +462,33 @@ public:
             segment_heads_in_block,
             flat_thread_id,
             storage.scatter_keys);
+        if(is_global_first_tile && carry_in && flat_thread_id == 0)
+        {
+            unique_keys[0] = stream_carry_in->key;
+        }
         ::rocprim::syncthreads();
 
         // The first item in the global first tile does not have a reduction
         // The first out of bounds item in the global last tile has the reduction for the last segment
+        const bool ends_last_segment = is_global_last_tile && !keeps_last_segment;
         const unsigned int reductions_in_block
-            = segment_heads_in_block - (is_global_first_tile ? 1 : 0)
-              + (is_global_last_tile && valid_in_global_last_tile != items_per_tile ? 1 : 0);
+            = segment_heads_in_block - (starts_stream ? 1 : 0)
+              + (ends_last_segment && valid_in_global_last_tile != items_per_tile ? 1 : 0);
 
-        if(is_global_first_tile && flat_thread_id == 0)
+        if(starts_stream && flat_thread_id == 0)
         {
             head_flags[0] = 0;
         }
-        if(is_global_last_tile && flat_thread_id == valid_in_global_last_tile / ItemsPerThread)
+        if(ends_last_segment && flat_thread_id == valid_in_global_last_tile / ItemsPerThread)
         {
             head_flags[valid_in_global_last_tile - flat_thread_id * ItemsPerThread] = 1;
         }
         scatter_values_type{}.scatter(
             reductions + segment_heads_in_previous_launches + segment_heads_before
-                - (!is_global_first_tile ? 1 : 0),
+                - (!starts_stream ? 1 : 0),
             [&wrapped_values](unsigned int i) { return rocprim::get<1>(wrapped_values[i]); },
             head_flags,
-            [&, offset = segment_heads_before + (is_global_first_tile ? 1 : 0)](
+            [&, offset = segment_heads_before + (starts_stream ? 1 : 0)](
                 const unsigned int i) { return rocprim::get<0>(wrapped_values[i]) - offset; },
             reductions_in_block,
             flat_thread_id,
@@ -466,12 +498,36 @@ public:
         {
             const std::size_t total_segment_heads = segment_heads_in_previous_launches
                                                     + segment_heads_before + segment_heads_in_block;
-            *unique_count = total_segment_heads;
-            if(valid_in_global_last_tile == items_per_tile)
+            *unique_count = total_segment_heads - (keeps_last_segment ? 1 : 0);
+            if(!keeps_last_segment && valid_in_global_last_tile == items_per_tile)
             {
                 reductions[total_segment_heads - 1] = rocprim::get<1>(reduction);
             }
         }
+
+        if(is_global_last_tile && keeps_last_segment)
+        {
+            // The reduction of the last segment is the exclusive scan of the first out of bounds
+            // item, or the reduction of a full tile.
+            if(valid_in_global_last_tile == items_per_tile)
+            {
+                if(flat_thread_id == BlockSize - 1)
+                {
+                    stream_carry_out->aggregate = rocprim::get<1>(reduction);
+                }
+            }
+            else if(flat_thread_id == valid_in_global_last_tile / ItemsPerThread)
+            {
+                stream_carry_out->aggregate = rocprim::get<1>(
+                    wrapped_values[valid_in_global_last_tile - flat_thread_id * ItemsPerThread]);
+            }
+            const unsigned int last_item = valid_in_global_last_tile - 1;
+            if(flat_thread_id == last_item / ItemsPerThread)
+            {
+                stream_carry_out->key          = keys[last_item - flat_thread_id * ItemsPerThread];
+                stream_carry_out->has_open_run = 1;
+            }
+        }
     }
 };
 
@@ -486,38 +542,7 @@ template<lookback_scan_determinism Determinism,
          typename CompareFunction,
          typename BinaryOp,
          typename LookbackScanState>
-ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto kernel_impl(KeyIterator,
-                                                     ValueIterator,
-                                                     const UniqueIterator,
-                                                     const ReductionIterator,
-                                                     const UniqueCountIterator,
-                                                     const BinaryOp,
-                                                     const CompareFunction,
-                                                     const LookbackScanState,
-                                                     ordered_block_id<unsigned int>,
-                                                     const std::size_t,
-                                                     const std::size_t,
-                                                     const std::size_t,
-                                                     const std::size_t* const,
-                                                     const AccumulatorType* const,
-                                                     const std::size_t)
-    -> std::enable_if_t<!is_lookback_kernel_runnable<LookbackScanState>()>
-{
-    // No need to build the kernel with sleep on a device that does not require it
-}
-
-template<lookback_scan_determinism Determinism,
-         typename Config,
-         typename AccumulatorType,
-         typename KeyIterator,
-         typename ValueIterator,
-         typename UniqueIterator,
-         typename ReductionIterator,
-         typename UniqueCountIterator,
-         typename CompareFunction,
-         typename BinaryOp,
-         typename LookbackScanState>
-ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
     kernel_impl(KeyIterator                    keys_input,
                 ValueIterator                  values_input,
                 const UniqueIterator           unique_keys,
@@ -532,8 +557,10 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
                 const std::size_t              size,
                 const std::size_t* const       global_head_count,
                 const AccumulatorType* const   previous_accumulated,
-                const std::size_t              number_of_tiles_launch)
-        -> std::enable_if_t<is_lookback_kernel_runnable<LookbackScanState>()>
+                const std::size_t              number_of_tiles_launch,
+                const stream_state<value_type_t<KeyIterator>, AccumulatorType>* const
+                    stream_carry_in,
+                stream_state<value_type_t<KeyIterator>, AccumulatorType>* const stream_carry_out)
 {
     static constexpr reduce_by_key_config_params params = device_params<Config>();
 
@@ -590,7 +617,463 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
                                       size,
                                       storage.tile,
                                       global_head_count,
-                                      previous_accumulated);
+                                      previous_accumulated,
+                                      stream_carry_in,
+                                      stream_carry_out);
+    }
+}
+
+// The long-runs mode (reduce_by_key_config::long_runs) splits the input into at most this many
+// chunks of consecutive tiles, each processed by one block without a look-back. The segments of
+// a chunk are staged in temporary storage, up to this many per chunk, and then copied to the
+// output once the number of segments in the preceding chunks is known.
+constexpr unsigned int long_runs_max_chunks   = 2048;
+constexpr unsigned int long_runs_staged_heads = 64;
+
+// Block size of the scan of the segment counts of the chunks.
+constexpr unsigned int long_runs_scan_block_size = 256;
+
+// The partial results of a chunk in the long-runs mode.
+template<typename AccumulatorType>
+struct long_runs_chunk
+{
+    // The number of segment heads in the chunk.
+    std::size_t heads;
+    // The number of segment heads in the preceding chunks.
+    std::size_t heads_before;
+    // Whether the chunk starts in a segment of a preceding chunk.
+    bool has_lead;
+    // The reduction of the items before the first head of the chunk, or of all items of the
+    // chunk if it has no heads. Valid if has_lead is true.
+    AccumulatorType lead;
+    // The reduction of the items from the last head of the chunk to its end. Valid if heads is
+    // not zero.
+    AccumulatorType tail;
+};
+
+template<typename KeyType,
+         typename AccumulatorType,
+         unsigned int         BlockSize,
+         unsigned int         ItemsPerThread,
+         block_load_method    load_keys_method,
+         block_load_method    load_values_method,
+         block_scan_algorithm scan_algorithm>
+class long_runs_chunk_helper
+{
+private:
+    using load_type = reduce_by_key::load_helper<KeyType,
+                                                 AccumulatorType,
+                                                 BlockSize,
+                                                 ItemsPerThread,
+                                                 load_keys_method,
+                                                 load_values_method>;
+
+    using wrapped_type = reduce_by_key::wrapped_type_t<AccumulatorType>;
+
+    using discontinuity_type = reduce_by_key::discontinuity_helper<KeyType, BlockSize>;
+    using block_scan_type    = rocprim::block_scan<wrapped_type, BlockSize, scan_algorithm>;
+
+public:
+    union storage_type
+    {
+        typename load_type::storage_type load;
+        struct
+        {
+            typename discontinuity_type::storage_type flags;
+            typename block_scan_type::storage_type    scan;
+        } scan;
+    };
+
+    // Reduces the segments of the tiles [first_tile, last_tile). The key and the reduction of
+    // the i-th segment that starts in the chunk are written to unique_keys[i] and reductions[i]
+    // if i is less than output_limit, except for the reduction of the last segment, which may
+    // continue in the following chunks. The partial results are written to chunk, if it is not
+    // a null pointer.
+    template<typename KeyIterator,
+             typename ValueIterator,
+             typename UniqueIterator,
+             typename ReductionIterator,
+             typename CompareFunction,
+             typename BinaryOp>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+        process_chunk(const KeyIterator                       keys_input,
+                      const ValueIterator                     values_input,
+                      UniqueIterator                          unique_keys,
+                      ReductionIterator                       reductions,
+                      const std::size_t                       output_limit,
+                      BinaryOp                                reduce_op,
+                      const CompareFunction                   compare,
+                      const std::size_t                       first_tile,
+                      const std::size_t                       last_tile,
+                      const std::size_t                       size,
+                      long_runs_chunk<AccumulatorType>* const chunk,
+                      storage_type&                           storage)
+    {
+        static constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+
+        auto wrapped_op = [&](const wrapped_type& lhs, const wrapped_type& rhs)
+        {
+            return wrapped_type{rocprim::get<0>(lhs) + rocprim::get<0>(rhs),
+                                rocprim::get<0>(rhs) == 0
+                                    ? reduce_op(rocprim::get<1>(lhs), rocprim::get<1>(rhs))
+                                    : rocprim::get<1>(rhs)};
+        };
+
+        const unsigned int flat_thread_id        = threadIdx.x;
+        const std::size_t  total_number_of_tiles = ceiling_div(size, items_per_tile);
+
+        // The first item of the chunk starts a segment, or continues the segment of the
+        // preceding chunk (the lead). The lead is counted as a segment with a virtual head,
+        // so the first tile of the chunk does not need a prefix.
+        const std::size_t chunk_offset = first_tile * items_per_tile;
+        const bool        has_lead
+            = chunk_offset != 0 && compare(keys_input[chunk_offset - 1], keys_input[chunk_offset]);
+        const std::size_t lead_segments = has_lead ? 1 : 0;
+
+        std::size_t     segments = 0;
+        AccumulatorType carry;
+        bool            carry_stored = false;
+
+        for(std::size_t tile = first_tile; tile < last_tile; ++tile)
+        {
+            const std::size_t   tile_offset          = tile * items_per_tile;
+            const KeyIterator   tile_keys            = keys_input + tile_offset;
+            const ValueIterator tile_values          = values_input + tile_offset;
+            const bool          is_global_first_tile = tile == 0;
+            const bool          is_global_last_tile  = tile == total_number_of_tiles - 1;
+            const std::size_t   remaining            = size - tile_offset;
+            const unsigned int  valid_in_tile
+                = is_global_last_tile ? static_cast<unsigned int>(remaining) : items_per_tile;
+
+            KeyType         keys[ItemsPerThread];
+            AccumulatorType values[ItemsPerThread];
+
+            ::rocprim::syncthreads();
+            load_type{}.load_keys_values(tile_keys,
+                                         tile_values,
+                                         is_global_last_tile,
+                                         valid_in_tile,
+                                         keys,
+                                         values,
+                                         storage.load);
+            ::rocprim::syncthreads();
+
+            unsigned int head_flags[ItemsPerThread];
+            discontinuity_type{}.flag_heads(tile_keys,
+                                            keys,
+                                            compare,
+                                            head_flags,
+                                            is_global_first_tile,
+                                            is_global_last_tile,
+                                            remaining,
+                                            storage.scan.flags);
+
+            if(tile == first_tile)
+            {
+                // The real or virtual head of the first segment. The carry is a dummy value,
+                // the head discards it.
+                carry = values[0];
+                if(flat_thread_id == 0)
+                {
+                    head_flags[0] = 1;
+                }
+            }
+
+            wrapped_type wrapped_values[ItemsPerThread];
+            for(unsigned int i = 0; i < ItemsPerThread; ++i)
+            {
+                rocprim::get<0>(wrapped_values[i]) = head_flags[i];
+                rocprim::get<1>(wrapped_values[i]) = values[i];
+            }
+
+            const wrapped_type initial_value = ::rocprim::make_tuple(0u, carry);
+            wrapped_type       reduction;
+            block_scan_type{}.exclusive_scan(wrapped_values,
+                                             wrapped_values,
+                                             initial_value,
+                                             reduction,
+                                             storage.scan.scan,
+                                             wrapped_op);
+
+            // Long runs leave most tiles without heads, those only update the carry.
+            if(rocprim::get<0>(reduction) != 0)
+            {
+                for(unsigned int i = 0; i < ItemsPerThread; ++i)
+                {
+                    if(!head_flags[i])
+                    {
+                        continue;
+                    }
+                    // The number of segments of the chunk before the head
+                    const std::size_t segment = segments + rocprim::get<0>(wrapped_values[i]);
+                    if(segment == 0)
+                    {
+                        continue;
+                    }
+                    // The head ends the preceding segment
+                    if(segment == lead_segments)
+                    {
+                        if(chunk != nullptr)
+                        {
+                            chunk->lead = rocprim::get<1>(wrapped_values[i]);
+                        }
+                    }
+                    else if(segment - lead_segments - 1 < output_limit)
+                    {
+                        reductions[segment - lead_segments - 1]
+                            = rocprim::get<1>(wrapped_values[i]);
+                    }
+                }
+                for(unsigned int i = 0; i < ItemsPerThread; ++i)
+                {
+                    if(!head_flags[i])
+                    {
+                        continue;
+                    }
+                    const std::size_t segment = segments + rocprim::get<0>(wrapped_values[i]);
+                    // The virtual head of the lead has no key
+                    if(segment >= lead_segments && segment - lead_segments < output_limit)
+                    {
+                        unique_keys[segment - lead_segments] = keys[i];
+                    }
+                }
+            }
+            segments += rocprim::get<0>(reduction);
+            carry = rocprim::get<1>(wrapped_op(initial_value, reduction));
+
+            // The out-of-bounds items of the last tile are reduced into the carry, the last
+            // segment ends before the first of them.
+            if(is_global_last_tile && valid_in_tile != items_per_tile)
+            {
+                carry_stored = true;
+                if(chunk != nullptr && flat_thread_id == valid_in_tile / ItemsPerThread)
+                {
+                    const AccumulatorType last_segment = rocprim::get<1>(
+                        wrapped_values[valid_in_tile - flat_thread_id * ItemsPerThread]);
+                    if(segments == lead_segments)
+                    {
+                        chunk->lead = last_segment;
+                    }
+                    else
+                    {
+                        chunk->tail = last_segment;
+                    }
+                }
+            }
+        }
+
+        if(chunk != nullptr && flat_thread_id == 0)
+        {
+            chunk->heads    = segments - lead_segments;
+            chunk->has_lead = has_lead;
+            if(!carry_stored)
+            {
+                if(segments == lead_segments)
+                {
+                    chunk->lead = carry;
+                }
+                else
+                {
+                    chunk->tail = carry;
+                }
+            }
+        }
+    }
+};
+
+template<typename Config,
+         typename AccumulatorType,
+         typename KeyIterator,
+         typename ValueIterator,
+         typename KeyType,
+         typename CompareFunction,
+         typename BinaryOp>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    long_runs_kernel_impl(const KeyIterator                       keys_input,
+                          const ValueIterator                     values_input,
+                          KeyType* const                          staged_keys,
+                          AccumulatorType* const                  staged_reductions,
+                          long_runs_chunk<AccumulatorType>* const chunks,
+                          const BinaryOp                          reduce_op,
+                          const CompareFunction                   compare,
+                          const std::size_t                       tiles_per_chunk,
+                          const std::size_t                       size)
+{
+    static constexpr reduce_by_key_config_params params = device_params<Config>();
+
+    static constexpr unsigned int block_size       = params.kernel_config.block_size;
+    static constexpr unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    static constexpr unsigned int items_per_tile   = block_size * items_per_thread;
+
+    using chunk_processor = long_runs_chunk_helper<KeyType,
+                                                   AccumulatorType,
+                                                   block_size,
+                                                   items_per_thread,
+                                                   params.load_keys_method,
+                                                   params.load_values_method,
+                                                   params.scan_algorithm>;
+
+    ROCPRIM_SHARED_MEMORY typename chunk_processor::storage_type storage;
+
+    const unsigned int chunk_id   = ::rocprim::detail::block_id<0>();
+    const std::size_t  first_tile = chunk_id * tiles_per_chunk;
+    const std::size_t  last_tile
+        = ::rocprim::min(first_tile + tiles_per_chunk, ceiling_div(size, items_per_tile));
+
+    chunk_processor{}.process_chunk(keys_input,
+                                    values_input,
+                                    staged_keys + chunk_id * long_runs_staged_heads,
+                                    staged_reductions + chunk_id * long_runs_staged_heads,
+                                    long_runs_staged_heads,
+                                    reduce_op,
+                                    compare,
+                                    first_tile,
+                                    last_tile,
+                                    size,
+                                    chunks + chunk_id,
+                                    storage);
+}
+
+template<typename AccumulatorType, typename UniqueCountIterator>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    long_runs_scan_kernel_impl(long_runs_chunk<AccumulatorType>* const chunks,
+                               const unsigned int                      number_of_chunks,
+                               const UniqueCountIterator               unique_count)
+{
+    static constexpr unsigned int items_per_thread
+        = long_runs_max_chunks / long_runs_scan_block_size;
+
+    using block_scan_type = rocprim::block_scan<std::size_t, long_runs_scan_block_size>;
+
+    ROCPRIM_SHARED_MEMORY typename block_scan_type::storage_type storage;
+
+    const unsigned int flat_thread_id = threadIdx.x;
+
+    std::size_t heads[items_per_thread];
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const unsigned int chunk_id = flat_thread_id * items_per_thread + i;
+        heads[i]                    = chunk_id < number_of_chunks ? chunks[chunk_id].heads : 0;
+    }
+
+    std::size_t total_heads;
+    block_scan_type{}.exclusive_scan(heads, heads, std::size_t{0}, total_heads, storage);
+
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const unsigned int chunk_id = flat_thread_id * items_per_thread + i;
+        if(chunk_id < number_of_chunks)
+        {
+            chunks[chunk_id].heads_before = heads[i];
+        }
+    }
+    if(flat_thread_id == 0)
+    {
+        *unique_count = total_heads;
+    }
+}
+
+template<typename Config,
+         typename AccumulatorType,
+         typename KeyIterator,
+         typename ValueIterator,
+         typename KeyType,
+         typename UniqueIterator,
+         typename ReductionIterator,
+         typename CompareFunction,
+         typename BinaryOp>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    long_runs_merge_kernel_impl(const KeyIterator                             keys_input,
+                                const ValueIterator                           values_input,
+                                const KeyType* const                          staged_keys,
+                                const AccumulatorType* const                  staged_reductions,
+                                const long_runs_chunk<AccumulatorType>* const chunks,
+                                const unsigned int                            number_of_chunks,
+                                const UniqueIterator                          unique_keys,
+                                const ReductionIterator                       reductions,
+                                const BinaryOp                                reduce_op,
+                                const CompareFunction                         compare,
+                                const std::size_t                             tiles_per_chunk,
+                                const std::size_t                             size)
+{
+    static constexpr reduce_by_key_config_params params = device_params<Config>();
+
+    static constexpr unsigned int block_size       = params.kernel_config.block_size;
+    static constexpr unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    static constexpr unsigned int items_per_tile   = block_size * items_per_thread;
+
+    using chunk_processor = long_runs_chunk_helper<KeyType,
+                                                   AccumulatorType,
+                                                   block_size,
+                                                   items_per_thread,
+                                                   params.load_keys_method,
+                                                   params.load_values_method,
+                                                   params.scan_algorithm>;
+
+    ROCPRIM_SHARED_MEMORY typename chunk_processor::storage_type storage;
+
+    const unsigned int flat_thread_id = threadIdx.x;
+    const unsigned int chunk_id       = ::rocprim::detail::block_id<0>();
+    const std::size_t  heads          = chunks[chunk_id].heads;
+    if(heads == 0)
+    {
+        return;
+    }
+
+    const std::size_t       heads_before     = chunks[chunk_id].heads_before;
+    const UniqueIterator    chunk_keys       = unique_keys + heads_before;
+    const ReductionIterator chunk_reductions = reductions + heads_before;
+
+    if(heads <= long_runs_staged_heads)
+    {
+        const std::size_t staged_offset = chunk_id * long_runs_staged_heads;
+        for(unsigned int i = flat_thread_id; i < heads; i += block_size)
+        {
+            chunk_keys[i] = staged_keys[staged_offset + i];
+            if(i + 1 < heads)
+            {
+                chunk_reductions[i] = staged_reductions[staged_offset + i];
+            }
+        }
+    }
+    else
+    {
+        // Too many segments to stage, the chunk is reduced again straight into the output.
+        const std::size_t first_tile = chunk_id * tiles_per_chunk;
+        const std::size_t last_tile
+            = ::rocprim::min(first_tile + tiles_per_chunk, ceiling_div(size, items_per_tile));
+        chunk_processor{}.process_chunk(keys_input,
+                                        values_input,
+                                        chunk_keys,
+                                        chunk_reductions,
+                                        heads,
+                                        reduce_op,
+                                        compare,
+                                        first_tile,
+                                        last_tile,
+                                        size,
+                                        nullptr,
+                                        storage);
+    }
+
+    // The last segment of the chunk continues into the leads of the following chunks, up to
+    // and including the next chunk with a head. The leads are reduced in order, because the
+    // reduction operator may not be commutative.
+    if(flat_thread_id == 0)
+    {
+        AccumulatorType reduction = chunks[chunk_id].tail;
+        for(unsigned int next = chunk_id + 1; next < number_of_chunks; ++next)
+        {
+            if(chunks[next].has_lead)
+            {
+                reduction = reduce_op(reduction, chunks[next].lead);
+            }
+            if(chunks[next].heads != 0)
+            {
+                break;
+            }
+        }
+        chunk_reductions[heads - 1] = reduction;
     }
 }
 
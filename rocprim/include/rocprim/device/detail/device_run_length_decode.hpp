@@ -0,0 +1,153 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_RUN_LENGTH_DECODE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_RUN_LENGTH_DECODE_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+
+#include "device_config_helper.hpp"
+
+#include <iterator>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Returns the number of runs that are merged before diagonal in the merge path of the ends of
+// the runs and the indices of the output items. A run is merged before the items at its end.
+ROCPRIM_DEVICE ROCPRIM_INLINE
+size_t run_length_decode_merge_path(const size_t* run_ends,
+                                    const size_t  num_runs,
+                                    const size_t  output_size,
+                                    const size_t  diagonal)
+{
+    size_t begin = diagonal > output_size ? diagonal - output_size : 0;
+    size_t end   = ::rocprim::min(diagonal, num_runs);
+    while(begin < end)
+    {
+        const size_t mid = begin + (end - begin) / 2;
+        if(run_ends[mid] <= diagonal - mid - 1)
+        {
+            begin = mid + 1;
+        }
+        else
+        {
+            end = mid;
+        }
+    }
+    return begin;
+}
+
+// Expands the runs with a persistent grid. The tiles split the merge path of the ends of the
+// runs (the inclusive scan of their lengths) and the indices of the output items into equal
+// parts, so every tile processes at most items_per_block runs and output items together, no
+// matter how long the runs are. The runs of a tile and their values are staged in shared
+// memory, where every output item finds its run with a binary search.
+template<class Config,
+         class ValuesInputIterator,
+         class OutputIterator,
+         class RelativeOffsetsOutputIterator>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void run_length_decode_kernel(ValuesInputIterator           values_input,
+                              const size_t*                 run_ends,
+                              const size_t                  num_runs,
+                              OutputIterator                output,
+                              RelativeOffsetsOutputIterator relative_offsets_output)
+{
+    static constexpr run_length_decode_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.kernel_config.block_size;
+    constexpr unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    // The end of the run preceding the tile, and the runs of the tile with the run of its last
+    // output item, which is merged after the tile.
+    ROCPRIM_SHARED_MEMORY size_t ends[items_per_block + 2];
+    ROCPRIM_DETAIL_SUPPRESS_DEPRECATION_WITH_PUSH
+    ROCPRIM_SHARED_MEMORY detail::raw_storage<value_type[items_per_block + 1]> values_storage;
+    ROCPRIM_DETAIL_SUPPRESS_DEPRECATION_POP
+    value_type(&values)[items_per_block + 1] = values_storage.get();
+
+    const unsigned int flat_id     = block_thread_id<0>();
+    const size_t       output_size = num_runs == 0 ? 0 : run_ends[num_runs - 1];
+    const size_t       path_size   = num_runs + output_size;
+
+    for(size_t tile = block_id<0>(); tile * items_per_block < path_size; tile += grid_size<0>())
+    {
+        const size_t diagonal_begin = tile * items_per_block;
+        const size_t diagonal_end   = ::rocprim::min(diagonal_begin + items_per_block, path_size);
+        const size_t run_begin
+            = run_length_decode_merge_path(run_ends, num_runs, output_size, diagonal_begin);
+        const size_t run_end
+            = run_length_decode_merge_path(run_ends, num_runs, output_size, diagonal_end);
+        const size_t output_begin = diagonal_begin - run_begin;
+        const size_t output_end   = diagonal_end - run_end;
+
+        const unsigned int tile_runs
+            = static_cast<unsigned int>(::rocprim::min(run_end + 1, num_runs) - run_begin);
+        for(unsigned int i = flat_id; i < tile_runs + 1; i += block_size)
+        {
+            const size_t run = run_begin + i;
+            ends[i]          = run == 0 ? 0 : run_ends[run - 1];
+            if(i < tile_runs)
+            {
+                values[i] = values_input[run];
+            }
+        }
+        ::rocprim::syncthreads();
+
+        for(size_t item = output_begin + flat_id; item < output_end; item += block_size)
+        {
+            // The run of the item is the last run of the tile that begins at or before it.
+            unsigned int begin = 0;
+            unsigned int end   = tile_runs;
+            while(end - begin > 1)
+            {
+                const unsigned int mid = (begin + end) / 2;
+                if(ends[mid] <= item)
+                {
+                    begin = mid;
+                }
+                else
+                {
+                    end = mid;
+                }
+            }
+            output[item]                  = values[begin];
+            relative_offsets_output[item] = item - ends[begin];
+        }
+        ::rocprim::syncthreads();
+    }
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_RUN_LENGTH_DECODE_HPP_
@@ -0,0 +1,241 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_RUN_LENGTH_ENCODE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_RUN_LENGTH_ENCODE_HPP_
+
+#include "../../block/block_discontinuity.hpp"
+#include "../../block/block_load.hpp"
+#include "../../block/block_scan.hpp"
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+
+#include "device_config_helper.hpp"
+#include "lookback_scan_state.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The value scanned over the items by the single-pass run-length encoding: the number of run
+// heads, the number of tails of non-trivial runs and the offset of the last run head.
+struct run_length_encode_prefix
+{
+    unsigned int runs;
+    unsigned int non_trivial_runs;
+    unsigned int last_head;
+};
+
+struct run_length_encode_scan_op
+{
+    ROCPRIM_HOST_DEVICE inline
+    run_length_encode_prefix operator()(const run_length_encode_prefix& a,
+                                        const run_length_encode_prefix& b) const
+    {
+        return run_length_encode_prefix{a.runs + b.runs,
+                                        a.non_trivial_runs + b.non_trivial_runs,
+                                        b.runs != 0 ? b.last_head : a.last_head};
+    }
+};
+
+template<class EqualityOp>
+struct run_length_encode_inequality_op
+{
+    template<class T>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const T& a, const T& b) const
+    {
+        return !equality_op(a, b);
+    }
+
+    EqualityOp equality_op;
+};
+
+// Encodes the runs of a tile in a single pass. The heads and the tails of the runs are flagged
+// with block_discontinuity, and one scan with look-back over the tiles yields for every item
+// the index of its run, the index of its run among the non-trivial runs and the offset of the
+// head of its run. The unique value of a run is written by its head, the offset and the length
+// by its tail. A run is non-trivial if its head is not also its tail, which both know locally.
+// Only non-trivial runs are written if NonTrivialOnly is set.
+//
+// The first block of a launch starts from the prefix of the preceding launches in carry, which
+// the initialization of the scan state saves from the last block of the preceding launch.
+template<bool NonTrivialOnly,
+         class Config,
+         class InputIterator,
+         class UniqueOutputIterator,
+         class OffsetsOutputIterator,
+         class CountsOutputIterator,
+         class RunsCountOutputIterator,
+         class EqualityOp,
+         class LookbackScanState>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void run_length_encode_kernel(InputIterator                   input,
+                              const unsigned int              launch_offset,
+                              const unsigned int              size,
+                              UniqueOutputIterator            unique_output,
+                              OffsetsOutputIterator           offsets_output,
+                              CountsOutputIterator            counts_output,
+                              RunsCountOutputIterator         runs_count_output,
+                              EqualityOp                      equality_op,
+                              LookbackScanState               scan_state,
+                              const run_length_encode_prefix* carry)
+{
+    static constexpr partition_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.kernel_config.block_size;
+    constexpr unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using input_type  = typename std::iterator_traits<InputIterator>::value_type;
+    using prefix_type = run_length_encode_prefix;
+
+    using block_load_type
+        = block_load<input_type, block_size, items_per_thread, params.key_block_load_method>;
+    using block_discontinuity_type = block_discontinuity<input_type, block_size>;
+    using block_scan_type = block_scan<prefix_type, block_size, params.block_scan_method>;
+    using prefix_op_type
+        = offset_lookback_scan_prefix_op<prefix_type, LookbackScanState, run_length_encode_scan_op>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_load_type::storage_type          load;
+        typename block_discontinuity_type::storage_type discontinuity;
+        typename block_scan_type::storage_type          scan;
+    } storage;
+    ROCPRIM_SHARED_MEMORY typename prefix_op_type::storage_type storage_prefix_op;
+
+    const unsigned int flat_id      = block_thread_id<0>();
+    const unsigned int flat_block   = block_id<0>();
+    const unsigned int block_offset = launch_offset + flat_block * items_per_block;
+    const unsigned int valid_count  = ::rocprim::min(size - block_offset, items_per_block);
+    const bool         is_last      = block_offset + valid_count == size;
+
+    input_type items[items_per_thread];
+    if(valid_count < items_per_block)
+    {
+        block_load_type().load(input + block_offset, items, valid_count, storage.load);
+    }
+    else
+    {
+        block_load_type().load(input + block_offset, items, storage.load);
+    }
+    ::rocprim::syncthreads();
+
+    // The neighbours outside of the input are not compared, the flags of the first and the last
+    // item are set below.
+    const input_type predecessor = block_offset == 0 ? items[0] : input[block_offset - 1];
+    const input_type successor   = is_last ? items[0] : input[block_offset + items_per_block];
+
+    bool heads[items_per_thread];
+    bool tails[items_per_thread];
+    block_discontinuity_type().flag_heads_and_tails(
+        heads,
+        predecessor,
+        tails,
+        successor,
+        items,
+        run_length_encode_inequality_op<EqualityOp>{equality_op},
+        storage.discontinuity);
+    ::rocprim::syncthreads();
+
+    prefix_type values[items_per_thread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const unsigned int rank = flat_id * items_per_thread + i;
+        heads[i] = rank < valid_count && (heads[i] || block_offset + rank == 0);
+        tails[i] = rank < valid_count && (tails[i] || (is_last && rank == valid_count - 1));
+        values[i] = prefix_type{heads[i] ? 1u : 0u,
+                                tails[i] && !heads[i] ? 1u : 0u,
+                                heads[i] ? block_offset + rank : 0u};
+    }
+
+    prefix_type prefix;
+    prefix_type reduction;
+    if(flat_block == 0)
+    {
+        prefix = launch_offset == 0 ? prefix_type{0, 0, 0} : *carry;
+        block_scan_type().exclusive_scan(values,
+                                         values,
+                                         prefix,
+                                         reduction,
+                                         storage.scan,
+                                         run_length_encode_scan_op{});
+        if(flat_id == 0)
+        {
+            scan_state.set_complete(flat_block, run_length_encode_scan_op{}(prefix, reduction));
+        }
+    }
+    else
+    {
+        prefix_op_type prefix_op(flat_block, scan_state, storage_prefix_op);
+        block_scan_type().exclusive_scan(values,
+                                         values,
+                                         storage.scan,
+                                         prefix_op,
+                                         run_length_encode_scan_op{});
+        ::rocprim::syncthreads();
+        prefix    = prefix_op.get_prefix();
+        reduction = prefix_op.get_reduction();
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const unsigned int offset = block_offset + flat_id * items_per_thread + i;
+        // An item is the head of a non-trivial run if it is not also its tail. The tails of all
+        // preceding runs precede it, so its index among the non-trivial runs is the exclusive
+        // prefix of non-trivial tails.
+        if(heads[i] && (!NonTrivialOnly || !tails[i]))
+        {
+            unique_output[NonTrivialOnly ? values[i].non_trivial_runs : values[i].runs]
+                = items[i];
+        }
+        if(tails[i] && (!NonTrivialOnly || !heads[i]))
+        {
+            const unsigned int head = heads[i] ? offset : values[i].last_head;
+            const unsigned int run
+                = NonTrivialOnly ? values[i].non_trivial_runs : values[i].runs - (heads[i] ? 0 : 1);
+            offsets_output[run] = head;
+            counts_output[run]  = offset + 1 - head;
+        }
+    }
+
+    if(is_last && flat_id == 0)
+    {
+        const prefix_type total = run_length_encode_scan_op{}(prefix, reduction);
+        runs_count_output[0]    = NonTrivialOnly ? total.non_trivial_runs : total.runs;
+    }
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_RUN_LENGTH_ENCODE_HPP_
@@ -0,0 +1,306 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SAMPLE_SORT_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SAMPLE_SORT_HPP_
+
+#include "../../block/block_load.hpp"
+#include "../../block/block_sort.hpp"
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+
+#include "device_config_helper.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Samples taken for every splitter. The splitters are evenly spaced in the sorted samples.
+constexpr unsigned int sample_sort_oversampling = 8;
+
+// Buckets up to this size are sorted together by a segmented sort, larger ones on their own.
+constexpr unsigned int sample_sort_max_segment_size = 1 << 16;
+
+// Finds the bucket of `element`: the bucket before the first splitter that is greater, or the
+// equality bucket of the splitter before if there is one and the element is equivalent to it.
+// The keys are only compared with `compare_function`.
+template<unsigned int NumBuckets, class Key, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int sample_sort_find_bucket(const Key&     element,
+                                                                   const Key*     splitters,
+                                                                   const bool*    equality_buckets,
+                                                                   BinaryFunction compare_function)
+{
+    unsigned int left  = 0;
+    unsigned int right = NumBuckets - 1;
+    for(unsigned int i = 0; i < Log2<NumBuckets>::VALUE; i++)
+    {
+        const unsigned int mid  = (left + right) >> 1;
+        const bool         comp = compare_function(element, splitters[mid]);
+        right                   = comp ? mid : right;
+        left                    = comp ? left : mid;
+    }
+
+    unsigned int bucket = right;
+    if(bucket > 0 && equality_buckets[bucket - 1]
+       && !compare_function(splitters[bucket - 1], element))
+    {
+        bucket = bucket - 1;
+    }
+    return bucket;
+}
+
+// Picks the splitters from the sorted samples. A splitter that is equivalent to the one before,
+// but not to the one after, gets an equality bucket: the bucket between the two equivalent
+// splitters would be empty, so it holds the keys equivalent to the splitter instead.
+template<class Config, class KeysIterator, class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().number_of_buckets - 1) void
+    sample_sort_find_splitters_kernel(
+        KeysIterator                                             keys,
+        typename std::iterator_traits<KeysIterator>::value_type* splitters,
+        bool*                                                    equality_buckets,
+        const size_t                                             size,
+        BinaryFunction                                           compare_function)
+{
+    constexpr nth_element_config_params params        = device_params<Config>();
+    constexpr unsigned int              num_splitters = params.number_of_buckets - 1;
+    constexpr unsigned int              oversampling  = sample_sort_oversampling;
+
+    using key_type       = typename std::iterator_traits<KeysIterator>::value_type;
+    using block_sort_key = block_sort<key_type, num_splitters, oversampling>;
+
+    ROCPRIM_SHARED_MEMORY typename block_sort_key::storage_type storage;
+
+    const size_t       stride = size / (num_splitters * oversampling);
+    const unsigned int idx    = threadIdx.x;
+
+    key_type samples[oversampling];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < oversampling; i++)
+    {
+        samples[i] = keys[stride * (idx * oversampling + i)];
+    }
+    block_sort_key().sort(samples, storage, compare_function);
+
+    // Every thread holds consecutive samples, its middle one is the splitter
+    const key_type splitter = samples[oversampling / 2];
+    splitters[idx]          = splitter;
+
+    syncthreads();
+
+    equality_buckets[idx] = idx > 0 && !compare_function(splitters[idx - 1], splitter)
+                            && (idx == num_splitters - 1
+                                || compare_function(splitter, splitters[idx + 1]));
+}
+
+// Loads the keys of a block, and finds their buckets and their ranks in the buckets within the
+// block. `counts` holds the number of keys of every bucket in the block afterwards.
+template<class Config, class KeysIterator, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE void sample_sort_bucket_block(
+    KeysIterator                                                   keys,
+    const typename std::iterator_traits<KeysIterator>::value_type* splitters,
+    const bool*                                                    equality_buckets,
+    const size_t                                                   size,
+    typename std::iterator_traits<KeysIterator>::value_type*       elements,
+    unsigned int*                                                  buckets,
+    unsigned int*                                                  ranks,
+    unsigned int*                                                  counts,
+    BinaryFunction                                                 compare_function)
+{
+    constexpr nth_element_config_params params = device_params<Config>();
+
+    constexpr unsigned int num_buckets           = params.number_of_buckets;
+    constexpr unsigned int num_threads_per_block = params.kernel_config.block_size;
+    constexpr unsigned int num_items_per_thread  = params.kernel_config.items_per_thread;
+    constexpr unsigned int num_splitters         = num_buckets - 1;
+    constexpr unsigned int num_items_per_block   = num_threads_per_block * num_items_per_thread;
+
+    static_assert(num_threads_per_block >= num_buckets,
+                  "num_threads_per_block should be larger or equal than the number_of_buckets");
+    static_assert(detail::is_power_of_two(num_buckets),
+                  "number_of_buckets should be a power of two");
+
+    using key_type       = typename std::iterator_traits<KeysIterator>::value_type;
+    using block_load_key = block_load<key_type, num_threads_per_block, num_items_per_thread>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        uninitialized_array<key_type, num_splitters> splitters;
+        bool                                         equality_buckets[num_buckets];
+    } storage;
+
+    if(threadIdx.x < num_buckets)
+    {
+        counts[threadIdx.x]                   = 0;
+        storage.equality_buckets[threadIdx.x] = equality_buckets[threadIdx.x];
+    }
+    if(threadIdx.x < num_splitters)
+    {
+        storage.splitters.emplace(threadIdx.x, splitters[threadIdx.x]);
+    }
+    const key_type* search_tree = storage.splitters.get_unsafe_array();
+
+    const size_t offset = blockIdx.x * num_items_per_block;
+    if(offset + num_items_per_block <= size)
+    {
+        block_load_key().load(keys + offset, elements);
+    }
+    else
+    {
+        block_load_key().load(keys + offset, elements, size - offset);
+    }
+
+    syncthreads();
+
+    for(unsigned int item = 0; item < num_items_per_thread; item++)
+    {
+        if(offset + threadIdx.x * num_items_per_thread + item < size)
+        {
+            buckets[item] = sample_sort_find_bucket<num_buckets>(elements[item],
+                                                                 search_tree,
+                                                                 storage.equality_buckets,
+                                                                 compare_function);
+            ranks[item]   = atomic_add(&counts[buckets[item]], 1);
+        }
+    }
+
+    syncthreads();
+}
+
+template<class Config, class KeysIterator, class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    sample_sort_count_kernel(
+        KeysIterator                                                   keys,
+        const typename std::iterator_traits<KeysIterator>::value_type* splitters,
+        const bool*                                                    equality_buckets,
+        size_t*                                                        bucket_sizes,
+        const size_t                                                   size,
+        BinaryFunction                                                 compare_function)
+{
+    constexpr nth_element_config_params params = device_params<Config>();
+    constexpr unsigned int              num_items_per_thread
+        = params.kernel_config.items_per_thread;
+
+    using key_type = typename std::iterator_traits<KeysIterator>::value_type;
+
+    ROCPRIM_SHARED_MEMORY unsigned int counts[params.number_of_buckets];
+
+    key_type     elements[num_items_per_thread];
+    unsigned int buckets[num_items_per_thread];
+    unsigned int ranks[num_items_per_thread];
+    sample_sort_bucket_block<Config>(keys,
+                                     splitters,
+                                     equality_buckets,
+                                     size,
+                                     elements,
+                                     buckets,
+                                     ranks,
+                                     counts,
+                                     compare_function);
+
+    if(threadIdx.x < params.number_of_buckets)
+    {
+        atomic_add(&bucket_sizes[threadIdx.x], static_cast<size_t>(counts[threadIdx.x]));
+    }
+}
+
+// Moves every key (and value) to its bucket. The blocks reserve their part of every bucket
+// through `cursors`, so the order of the keys in a bucket is not preserved.
+template<class Config, class KeysIterator, class ValuesIterator, class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    sample_sort_scatter_kernel(
+        KeysIterator                                                   keys,
+        ValuesIterator                                                 values,
+        const typename std::iterator_traits<KeysIterator>::value_type* splitters,
+        const bool*                                                    equality_buckets,
+        size_t*                                                        cursors,
+        typename std::iterator_traits<KeysIterator>::value_type*       keys_output,
+        typename std::iterator_traits<ValuesIterator>::value_type*     values_output,
+        const size_t                                                   size,
+        BinaryFunction                                                 compare_function)
+{
+    constexpr nth_element_config_params params = device_params<Config>();
+
+    constexpr unsigned int num_buckets           = params.number_of_buckets;
+    constexpr unsigned int num_threads_per_block = params.kernel_config.block_size;
+    constexpr unsigned int num_items_per_thread  = params.kernel_config.items_per_thread;
+    constexpr unsigned int num_items_per_block   = num_threads_per_block * num_items_per_thread;
+
+    using key_type   = typename std::iterator_traits<KeysIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesIterator>::value_type;
+
+    constexpr bool with_values = !std::is_same<value_type, empty_type>::value;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        unsigned int counts[num_buckets];
+        size_t       offsets[num_buckets];
+    } storage;
+
+    key_type     elements[num_items_per_thread];
+    unsigned int buckets[num_items_per_thread];
+    unsigned int ranks[num_items_per_thread];
+    sample_sort_bucket_block<Config>(keys,
+                                     splitters,
+                                     equality_buckets,
+                                     size,
+                                     elements,
+                                     buckets,
+                                     ranks,
+                                     storage.counts,
+                                     compare_function);
+
+    if(threadIdx.x < num_buckets)
+    {
+        storage.offsets[threadIdx.x]
+            = atomic_add(&cursors[threadIdx.x], static_cast<size_t>(storage.counts[threadIdx.x]));
+    }
+
+    syncthreads();
+
+    const size_t offset = blockIdx.x * num_items_per_block;
+    for(unsigned int item = 0; item < num_items_per_thread; item++)
+    {
+        const size_t idx = offset + threadIdx.x * num_items_per_thread + item;
+        if(idx < size)
+        {
+            const size_t position = storage.offsets[buckets[item]] + ranks[item];
+            keys_output[position] = elements[item];
+            if(with_values)
+            {
+                values_output[position] = values[idx];
+            }
+        }
+    }
+}
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SAMPLE_SORT_HPP_
@@ -38,6 +38,7 @@
 #include "device_scan_common.hpp"
 #include "lookback_scan_state.hpp"
 #include "ordered_block_id.hpp"
+#include "transform_load.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -48,6 +49,16 @@ BEGIN_ROCPRIM_NAMESPACE
 namespace detail
 {
 
+// The carry of a scan over successive chunks, see streaming_inclusive_scan.
+template<class T>
+struct scan_stream_state
+{
+    // The reduction of all preceding chunks, including the initial value of an exclusive scan.
+    T carry;
+    // Zero until a chunk has been scanned.
+    unsigned int has_carry;
+};
+
 // Helper functions for performing exclusive or inclusive
 // block scan in single_scan.
 template<bool Exclusive,
@@ -88,6 +99,7 @@ ROCPRIM_DEVICE ROCPRIM_INLINE auto single_scan_block_scan(T (&input)[ItemsPerThr
                                scan_op);
 }
 
+// Scans the tile `flat_block_id` of the input.
 template<lookback_scan_determinism Determinism,
          bool                      Exclusive,
          class Config,
@@ -96,43 +108,21 @@ template<lookback_scan_determinism Determinism,
          class BinaryFunction,
          class AccType,
          class LookbackScanState>
-ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto lookback_scan_kernel_impl(InputIterator,
-                                                                   OutputIterator,
-                                                                   const size_t,
-                                                                   AccType,
-                                                                   BinaryFunction,
-                                                                   LookbackScanState,
-                                                                   const unsigned int,
-                                                                   AccType* = nullptr,
-                                                                   AccType* = nullptr,
-                                                                   bool     = false,
-                                                                   bool     = false)
-    -> std::enable_if_t<!is_lookback_kernel_runnable<LookbackScanState>()>
-{
-    // No need to build the kernel with sleep on a device that does not require it
-}
-
-template<lookback_scan_determinism Determinism,
-         bool                      Exclusive,
-         class Config,
-         class InputIterator,
-         class OutputIterator,
-         class BinaryFunction,
-         class AccType,
-         class LookbackScanState>
-ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
-    lookback_scan_kernel_impl(InputIterator      input,
-                              OutputIterator     output,
-                              const size_t       size,
-                              AccType            initial_value,
-                              BinaryFunction     scan_op,
-                              LookbackScanState  scan_state,
-                              const unsigned int number_of_blocks,
-                              AccType*           previous_last_element = nullptr,
-                              AccType*           new_last_element      = nullptr,
-                              bool               override_first_value  = false,
-                              bool               save_last_value       = false)
-        -> std::enable_if_t<is_lookback_kernel_runnable<LookbackScanState>()>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    lookback_scan_tile(const unsigned int                flat_block_id,
+                       InputIterator                     input,
+                       OutputIterator                    output,
+                       const size_t                      size,
+                       AccType                           initial_value,
+                       BinaryFunction                    scan_op,
+                       LookbackScanState                 scan_state,
+                       const unsigned int                number_of_blocks,
+                       AccType*                          previous_last_element,
+                       AccType*                          new_last_element,
+                       bool                              override_first_value,
+                       bool                              save_last_value,
+                       const scan_stream_state<AccType>* stream_carry_in,
+                       scan_stream_state<AccType>*       stream_carry_out)
 {
     static_assert(std::is_same<AccType, typename LookbackScanState::value_type>::value,
                   "value_type of LookbackScanState must be result_type");
@@ -158,10 +148,10 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
         typename block_scan_type::storage_type  scan;
     } storage;
 
-    const auto         flat_block_thread_id = ::rocprim::detail::block_thread_id<0>();
-    const auto         flat_block_id        = ::rocprim::detail::block_id<0>();
-    const unsigned int block_offset         = flat_block_id * items_per_block;
-    const auto         valid_in_last_block  = size - items_per_block * (number_of_blocks - 1);
+    const auto   flat_block_thread_id = ::rocprim::detail::block_thread_id<0>();
+    const size_t block_offset         = static_cast<size_t>(flat_block_id) * items_per_block;
+    const auto   valid_in_last_block
+        = size - static_cast<size_t>(items_per_block) * (number_of_blocks - 1);
 
     // For input values
     AccType values[items_per_thread];
@@ -175,7 +165,9 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
                                *(input + block_offset),
                                storage.load);
     }
-    else
+    else if(!transform_load_blocked_vectorized(flat_block_thread_id,
+                                               input + block_offset,
+                                               values))
     {
         block_load_type().load(input + block_offset, values, storage.load);
     }
@@ -193,6 +185,14 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
             else if(flat_block_thread_id == 0)
                 values[0] = scan_op(previous_last_element[0], values[0]);
         }
+        // The first tile of a chunk continues the scan of the preceding chunks.
+        else if(stream_carry_in != nullptr && stream_carry_in->has_carry)
+        {
+            if(Exclusive)
+                initial_value = stream_carry_in->carry;
+            else if(flat_block_thread_id == 0)
+                values[0] = scan_op(stream_carry_in->carry, values[0]);
+        }
 
         AccType reduction;
         lookback_block_scan<Exclusive, block_scan_type>(values, // input/output
@@ -234,6 +234,25 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
                 }
             }
         }
+
+        // The carry includes the last input, also of an exclusive scan.
+        if(stream_carry_out != nullptr
+           && (::rocprim::detail::block_thread_id<0>()
+               == (valid_in_last_block - 1) / items_per_thread))
+        {
+            for(unsigned int i = 0; i < items_per_thread; i++)
+            {
+                if(i == (valid_in_last_block - 1) % items_per_thread)
+                {
+                    stream_carry_out->carry
+                        = Exclusive ? scan_op(values[i],
+                                              static_cast<AccType>(
+                                                  input[block_offset + valid_in_last_block - 1]))
+                                    : values[i];
+                    stream_carry_out->has_carry = 1;
+                }
+            }
+        }
     }
     else
     {
@@ -241,6 +260,98 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
     }
 }
 
+template<lookback_scan_determinism Determinism,
+         bool                      Exclusive,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction,
+         class AccType,
+         class LookbackScanState>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    lookback_scan_kernel_impl(InputIterator                     input,
+                              OutputIterator                    output,
+                              const size_t                      size,
+                              AccType                           initial_value,
+                              BinaryFunction                    scan_op,
+                              LookbackScanState                 scan_state,
+                              const unsigned int                number_of_blocks,
+                              AccType*                          previous_last_element = nullptr,
+                              AccType*                          new_last_element      = nullptr,
+                              bool                              override_first_value  = false,
+                              bool                              save_last_value       = false,
+                              const scan_stream_state<AccType>* stream_carry_in       = nullptr,
+                              scan_stream_state<AccType>*       stream_carry_out      = nullptr)
+{
+    lookback_scan_tile<Determinism, Exclusive, Config>(::rocprim::detail::block_id<0>(),
+                                                       input,
+                                                       output,
+                                                       size,
+                                                       initial_value,
+                                                       scan_op,
+                                                       scan_state,
+                                                       number_of_blocks,
+                                                       previous_last_element,
+                                                       new_last_element,
+                                                       override_first_value,
+                                                       save_last_value,
+                                                       stream_carry_in,
+                                                       stream_carry_out);
+}
+
+// Persistent variant: the blocks take tiles in order until all tiles are scanned. A tile is only
+// taken after all preceding tiles have been taken, so the look-back never waits on a tile that
+// is not being processed.
+template<lookback_scan_determinism Determinism,
+         bool                      Exclusive,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction,
+         class AccType,
+         class LookbackScanState>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    persistent_lookback_scan_kernel_impl(InputIterator                     input,
+                                         OutputIterator                    output,
+                                         const size_t                      size,
+                                         AccType                           initial_value,
+                                         BinaryFunction                    scan_op,
+                                         LookbackScanState                 scan_state,
+                                         ordered_block_id<unsigned int>    ordered_tile_id,
+                                         const unsigned int                number_of_tiles,
+                                         const scan_stream_state<AccType>* stream_carry_in,
+                                         scan_stream_state<AccType>*       stream_carry_out)
+{
+    ROCPRIM_SHARED_MEMORY typename decltype(ordered_tile_id)::storage_type tile_id_storage;
+
+    while(true)
+    {
+        // ordered_block_id::get synchronizes the block, so the previous tile's shared memory can
+        // be reused.
+        const unsigned int tile_id
+            = ordered_tile_id.get(::rocprim::detail::block_thread_id<0>(), tile_id_storage);
+        if(tile_id >= number_of_tiles)
+        {
+            return;
+        }
+
+        lookback_scan_tile<Determinism, Exclusive, Config>(tile_id,
+                                                           input,
+                                                           output,
+                                                           size,
+                                                           initial_value,
+                                                           scan_op,
+                                                           scan_state,
+                                                           number_of_tiles,
+                                                           static_cast<AccType*>(nullptr),
+                                                           static_cast<AccType*>(nullptr),
+                                                           false,
+                                                           false,
+                                                           stream_carry_in,
+                                                           stream_carry_out);
+    }
+}
+
 } // end of namespace detail
 
 END_ROCPRIM_NAMESPACE
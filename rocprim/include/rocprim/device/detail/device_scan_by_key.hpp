@@ -23,9 +23,11 @@
 
 #include "device_scan_common.hpp"
 #include "lookback_scan_state.hpp"
+#include "ordered_block_id.hpp"
 
 #include "../../block/block_discontinuity.hpp"
 #include "../../block/block_load.hpp"
+#include "../../block/block_reduce.hpp"
 #include "../../block/block_scan.hpp"
 #include "../../block/block_store.hpp"
 #include "../../config.hpp"
@@ -87,9 +89,9 @@ namespace detail
                  storage_type& storage)
         {
             constexpr static unsigned int items_per_block = items_per_thread * block_size;
-            const unsigned int            block_offset    = flat_block_id * items_per_block;
-            KeyIterator                   block_keys      = keys_input + block_offset;
-            ValueIterator                 block_values    = values_input + block_offset;
+            const size_t  block_offset = static_cast<size_t>(flat_block_id) * items_per_block;
+            KeyIterator   block_keys   = keys_input + block_offset;
+            ValueIterator block_values = values_input + block_offset;
 
             key_type    keys[items_per_thread];
             result_type values[items_per_thread];
@@ -203,7 +205,7 @@ namespace detail
                   storage_type& storage)
         {
             constexpr static unsigned int items_per_block = items_per_thread * block_size;
-            const unsigned int block_offset = flat_block_id * items_per_block;
+            const size_t   block_offset = static_cast<size_t>(flat_block_id) * items_per_block;
             OutputIterator block_output = output + block_offset;
 
             result_type thread_values[items_per_thread];
@@ -243,6 +245,7 @@ namespace detail
         }
     };
 
+    // Scans the tile `flat_block_id` of the launch.
     template<lookback_scan_determinism Determinism,
              bool                      Exclusive,
              typename Config,
@@ -253,34 +256,8 @@ namespace detail
              typename CompareFunction,
              typename BinaryFunction,
              typename LookbackScanState>
-    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto
-        device_scan_by_key_kernel_impl(KeyInputIterator,
-                                       InputIterator,
-                                       OutputIterator,
-                                       ResultType,
-                                       const CompareFunction,
-                                       const BinaryFunction,
-                                       LookbackScanState,
-                                       const size_t,
-                                       const size_t,
-                                       const size_t,
-                                       const rocprim::tuple<ResultType, bool>* const)
-            -> std::enable_if_t<!is_lookback_kernel_runnable<LookbackScanState>()>
-    {
-        // No need to build the kernel with sleep on a device that does not require it
-    }
-
-    template<lookback_scan_determinism Determinism,
-             bool                      Exclusive,
-             typename Config,
-             typename KeyInputIterator,
-             typename InputIterator,
-             typename OutputIterator,
-             typename ResultType,
-             typename CompareFunction,
-             typename BinaryFunction,
-             typename LookbackScanState>
-    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE auto device_scan_by_key_kernel_impl(
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void device_scan_by_key_tile(
+        const unsigned int                            flat_block_id,
         KeyInputIterator                              keys,
         InputIterator                                 values,
         OutputIterator                                output,
@@ -292,7 +269,6 @@ namespace detail
         const size_t                                  starting_block,
         const size_t                                  number_of_blocks,
         const rocprim::tuple<ResultType, bool>* const previous_last_value)
-        -> std::enable_if_t<is_lookback_kernel_runnable<LookbackScanState>()>
     {
         using result_type = ResultType;
         static_assert(std::is_same<rocprim::tuple<ResultType, bool>,
@@ -331,7 +307,6 @@ namespace detail
         } storage;
 
         const auto flat_thread_id = ::rocprim::detail::block_thread_id<0>();
-        const auto flat_block_id  = ::rocprim::detail::block_id<0>();
 
         // Load input
         wrapped_type wrapped_values[items_per_thread];
@@ -405,6 +380,300 @@ namespace detail
                               wrapped_values,
                               storage.store);
     }
+
+    template<lookback_scan_determinism Determinism,
+             bool                      Exclusive,
+             typename Config,
+             typename KeyInputIterator,
+             typename InputIterator,
+             typename OutputIterator,
+             typename ResultType,
+             typename CompareFunction,
+             typename BinaryFunction,
+             typename LookbackScanState>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void device_scan_by_key_kernel_impl(
+        KeyInputIterator                              keys,
+        InputIterator                                 values,
+        OutputIterator                                output,
+        ResultType                                    initial_value,
+        const CompareFunction                         compare,
+        const BinaryFunction                          scan_op,
+        LookbackScanState                             scan_state,
+        const size_t                                  size,
+        const size_t                                  starting_block,
+        const size_t                                  number_of_blocks,
+        const rocprim::tuple<ResultType, bool>* const previous_last_value)
+    {
+        device_scan_by_key_tile<Determinism, Exclusive, Config>(::rocprim::detail::block_id<0>(),
+                                                                keys,
+                                                                values,
+                                                                output,
+                                                                initial_value,
+                                                                compare,
+                                                                scan_op,
+                                                                scan_state,
+                                                                size,
+                                                                starting_block,
+                                                                number_of_blocks,
+                                                                previous_last_value);
+    }
+
+    // Persistent variant: the blocks take tiles in order until all tiles are scanned, see
+    // persistent_lookback_scan_kernel_impl.
+    template<lookback_scan_determinism Determinism,
+             bool                      Exclusive,
+             typename Config,
+             typename KeyInputIterator,
+             typename InputIterator,
+             typename OutputIterator,
+             typename ResultType,
+             typename CompareFunction,
+             typename BinaryFunction,
+             typename LookbackScanState>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+        persistent_device_scan_by_key_kernel_impl(KeyInputIterator               keys,
+                                                  InputIterator                  values,
+                                                  OutputIterator                 output,
+                                                  ResultType                     initial_value,
+                                                  const CompareFunction          compare,
+                                                  const BinaryFunction           scan_op,
+                                                  LookbackScanState              scan_state,
+                                                  ordered_block_id<unsigned int> ordered_tile_id,
+                                                  const size_t                   size,
+                                                  const unsigned int             number_of_tiles)
+    {
+        ROCPRIM_SHARED_MEMORY typename decltype(ordered_tile_id)::storage_type tile_id_storage;
+
+        while(true)
+        {
+            const unsigned int tile_id
+                = ordered_tile_id.get(::rocprim::detail::block_thread_id<0>(), tile_id_storage);
+            if(tile_id >= number_of_tiles)
+            {
+                return;
+            }
+
+            device_scan_by_key_tile<Determinism, Exclusive, Config>(
+                tile_id,
+                keys,
+                values,
+                output,
+                initial_value,
+                compare,
+                scan_op,
+                scan_state,
+                size,
+                0,
+                number_of_tiles,
+                static_cast<const rocprim::tuple<ResultType, bool>*>(nullptr));
+        }
+    }
+
+    // Reduces the flagged values of the partition `block_id` of the tiles for the two-pass
+    // scan-by-key, see two_pass_scan_reduce_kernel_impl. The flags make the reduction restart at
+    // every segment head, so the reduction of the partitions can be scanned with the same
+    // operator as the tiles.
+    template<bool Exclusive,
+             typename Config,
+             typename KeyInputIterator,
+             typename InputIterator,
+             typename ResultType,
+             typename CompareFunction,
+             typename BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void two_pass_scan_by_key_reduce_kernel_impl(
+        KeyInputIterator                  keys,
+        InputIterator                     values,
+        ResultType                        initial_value,
+        const CompareFunction             compare,
+        const BinaryFunction              scan_op,
+        const size_t                      size,
+        const size_t                      tiles_per_partition,
+        const size_t                      number_of_tiles,
+        rocprim::tuple<ResultType, bool>* partition_reductions)
+    {
+        using result_type = ResultType;
+        static constexpr scan_by_key_config_params params = device_params<Config>();
+
+        constexpr auto block_size         = params.kernel_config.block_size;
+        constexpr auto items_per_thread   = params.kernel_config.items_per_thread;
+        constexpr auto load_keys_method   = params.block_load_method;
+        constexpr auto load_values_method = load_keys_method;
+
+        using key_type = typename std::iterator_traits<KeyInputIterator>::value_type;
+        using load_flagged = load_values_flagged<Exclusive,
+                                                 block_size,
+                                                 items_per_thread,
+                                                 key_type,
+                                                 result_type,
+                                                 load_keys_method,
+                                                 load_values_method>;
+
+        auto wrapped_op = headflag_scan_op_wrapper<result_type, bool, BinaryFunction>{scan_op};
+        using wrapped_type = rocprim::tuple<result_type, bool>;
+
+        using block_reduce_type = ::rocprim::block_reduce<wrapped_type, block_size>;
+
+        ROCPRIM_SHARED_MEMORY union
+        {
+            typename load_flagged::storage_type      load;
+            typename block_reduce_type::storage_type reduce;
+        } storage;
+
+        const auto         flat_thread_id = ::rocprim::detail::block_thread_id<0>();
+        const unsigned int partition_id   = ::rocprim::detail::block_id<0>();
+        const size_t       first_tile     = partition_id * tiles_per_partition;
+
+        // Only valid in the first thread
+        wrapped_type partition_reduction;
+        for(size_t tile = 0; tile < tiles_per_partition; tile++)
+        {
+            wrapped_type wrapped_values[items_per_thread];
+            load_flagged{}.load(keys,
+                                values,
+                                compare,
+                                initial_value,
+                                static_cast<unsigned int>(first_tile + tile),
+                                0,
+                                number_of_tiles,
+                                flat_thread_id,
+                                size,
+                                wrapped_values,
+                                storage.load);
+            ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+            wrapped_type tile_reduction;
+            block_reduce_type().reduce(wrapped_values, tile_reduction, storage.reduce, wrapped_op);
+            ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+            partition_reduction
+                = tile == 0 ? tile_reduction : wrapped_op(partition_reduction, tile_reduction);
+        }
+
+        if(flat_thread_id == 0)
+        {
+            partition_reductions[partition_id] = partition_reduction;
+        }
+    }
+
+    // Scans the partition `block_id` of the tiles for the two-pass scan-by-key, see
+    // two_pass_scan_kernel_impl. `partition_prefixes` holds the inclusive scan of the flagged
+    // reductions of all partitions but the last one.
+    template<bool Exclusive,
+             typename Config,
+             typename KeyInputIterator,
+             typename InputIterator,
+             typename OutputIterator,
+             typename ResultType,
+             typename CompareFunction,
+             typename BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void two_pass_scan_by_key_kernel_impl(
+        KeyInputIterator                              keys,
+        InputIterator                                 values,
+        OutputIterator                                output,
+        ResultType                                    initial_value,
+        const CompareFunction                         compare,
+        const BinaryFunction                          scan_op,
+        const rocprim::tuple<ResultType, bool>* const partition_prefixes,
+        const size_t                                  size,
+        const size_t                                  tiles_per_partition,
+        const size_t                                  number_of_tiles)
+    {
+        using result_type = ResultType;
+        static constexpr scan_by_key_config_params params = device_params<Config>();
+
+        constexpr auto block_size         = params.kernel_config.block_size;
+        constexpr auto items_per_thread   = params.kernel_config.items_per_thread;
+        constexpr auto load_keys_method   = params.block_load_method;
+        constexpr auto load_values_method = load_keys_method;
+
+        using key_type = typename std::iterator_traits<KeyInputIterator>::value_type;
+        using load_flagged = load_values_flagged<Exclusive,
+                                                 block_size,
+                                                 items_per_thread,
+                                                 key_type,
+                                                 result_type,
+                                                 load_keys_method,
+                                                 load_values_method>;
+
+        auto wrapped_op = headflag_scan_op_wrapper<result_type, bool, BinaryFunction>{scan_op};
+        using wrapped_type = rocprim::tuple<result_type, bool>;
+
+        using block_scan_type
+            = ::rocprim::block_scan<wrapped_type, block_size, params.block_scan_method>;
+
+        constexpr auto store_method = params.block_store_method;
+        using store_unwrap = unwrap_store<block_size, items_per_thread, result_type, store_method>;
+
+        ROCPRIM_SHARED_MEMORY union
+        {
+            typename load_flagged::storage_type    load;
+            typename block_scan_type::storage_type scan;
+            typename store_unwrap::storage_type    store;
+        } storage;
+
+        const auto         flat_thread_id = ::rocprim::detail::block_thread_id<0>();
+        const unsigned int partition_id   = ::rocprim::detail::block_id<0>();
+        const size_t       first_tile     = partition_id * tiles_per_partition;
+        const size_t       last_tile
+            = ::rocprim::min(first_tile + tiles_per_partition, number_of_tiles);
+
+        // The prefix of an inclusive scan is folded into the first item of the tile.
+        const wrapped_type wrapped_initial_value = rocprim::make_tuple(initial_value, false);
+        wrapped_type       prefix                = wrapped_initial_value;
+        bool               has_prefix            = Exclusive;
+        if(partition_id > 0)
+        {
+            const wrapped_type partition_prefix = partition_prefixes[partition_id - 1];
+            prefix     = Exclusive ? wrapped_op(wrapped_initial_value, partition_prefix)
+                                   : partition_prefix;
+            has_prefix = true;
+        }
+
+        for(size_t tile = first_tile; tile < last_tile; tile++)
+        {
+            const unsigned int tile_id = static_cast<unsigned int>(tile);
+
+            wrapped_type wrapped_values[items_per_thread];
+            load_flagged{}.load(keys,
+                                values,
+                                compare,
+                                initial_value,
+                                tile_id,
+                                0,
+                                number_of_tiles,
+                                flat_thread_id,
+                                size,
+                                wrapped_values,
+                                storage.load);
+            ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+            if(!Exclusive && has_prefix && flat_thread_id == 0)
+            {
+                wrapped_values[0] = wrapped_op(prefix, wrapped_values[0]);
+            }
+
+            // The reduction includes the prefix, so it is the prefix of the next tile.
+            wrapped_type reduction;
+            lookback_block_scan<Exclusive, block_scan_type>(wrapped_values,
+                                                            prefix,
+                                                            reduction,
+                                                            storage.scan,
+                                                            wrapped_op);
+            prefix     = reduction;
+            has_prefix = true;
+
+            // synchronization is inside the function after unwrapping
+            store_unwrap{}.store(output,
+                                 tile_id,
+                                 0,
+                                 number_of_tiles,
+                                 flat_thread_id,
+                                 size,
+                                 wrapped_values,
+                                 storage.store);
+            ::rocprim::syncthreads(); // sync threads to reuse shared memory
+        }
+    }
 } // namespace detail
 
 END_ROCPRIM_NAMESPACE
@@ -21,14 +21,18 @@
 #ifndef ROCPRIM_DEVICE_SCAN_COMMON_HPP_
 #define ROCPRIM_DEVICE_SCAN_COMMON_HPP_
 
+#include "../../common.hpp"
 #include "../../config.hpp"
 #include "../../intrinsics/thread.hpp"
 
+#include "../execution_budget.hpp"
 #include "lookback_scan_state.hpp"
 #include "ordered_block_id.hpp"
 
 #include <hip/hip_runtime.h>
 
+#include <algorithm>
+
 BEGIN_ROCPRIM_NAMESPACE
 
 namespace detail
@@ -216,6 +220,18 @@ ROCPRIM_KERNEL
     }
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
+// Key comparison of the by-key primitives when the keys are head flags: neighbouring items are
+// in the same segment unless the next one starts a segment. The by-key kernels always compare
+// a key with the key that follows it, so the flag of the previous item is not needed.
+struct head_flag_compare
+{
+    template<class Flag>
+    ROCPRIM_HOST_DEVICE inline bool operator()(const Flag& /*previous*/, const Flag& next) const
+    {
+        return !static_cast<bool>(next);
+    }
+};
+
 } // namespace detail
 
 END_ROCPRIM_NAMESPACE
@@ -0,0 +1,250 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SCAN_TWO_PASS_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SCAN_TWO_PASS_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+
+#include "../../block/block_load.hpp"
+#include "../../block/block_reduce.hpp"
+#include "../../block/block_scan.hpp"
+#include "../../block/block_store.hpp"
+
+#include "../device_scan_config.hpp"
+
+#include "device_scan_common.hpp"
+#include "transform_load.hpp"
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+// The two-pass scan splits the tiles into one contiguous partition per block. The first pass
+// reduces the partitions, a single block scans the reductions and the second pass scans every
+// partition, starting from the reduction of the partitions preceding it. No block waits on
+// another one, and the order of the operations only depends on the size and the grid size.
+
+namespace detail
+{
+
+// Tile count up to which deterministic scans use the two-pass scan. For more tiles, each
+// partition has many tiles that are no longer in the cache when the second pass reads them.
+constexpr size_t two_pass_scan_max_auto_tiles = 1024;
+
+// Accumulator size above which all scans use the two-pass scan. The look-back of larger values
+// stores every tile's value in the scan state and loads them again while it waits, and the
+// values of the look-back window do not fit in registers. The two-pass scan only keeps one
+// reduction per partition in global memory, which is worth reading the input twice.
+constexpr size_t two_pass_scan_min_large_value_size = 32;
+
+// Reduces the partition `block_id` of the input. The reduction of the last partition is not
+// needed, so only partitions of full tiles are reduced.
+template<class Config, class InputIterator, class BinaryFunction, class AccType>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    two_pass_scan_reduce_kernel_impl(InputIterator  input,
+                                     const size_t   tiles_per_partition,
+                                     BinaryFunction scan_op,
+                                     AccType*       partition_reductions)
+{
+    static constexpr scan_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.kernel_config.block_size;
+    constexpr unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using block_load_type
+        = ::rocprim::block_load<AccType, block_size, items_per_thread, params.block_load_method>;
+    using block_reduce_type = ::rocprim::block_reduce<AccType, block_size>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_load_type::storage_type   load;
+        typename block_reduce_type::storage_type reduce;
+    } storage;
+
+    const unsigned int flat_block_thread_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int partition_id         = ::rocprim::detail::block_id<0>();
+    const size_t       first_tile           = partition_id * tiles_per_partition;
+
+    // Only valid in the first thread
+    AccType partition_reduction;
+    for(size_t tile = 0; tile < tiles_per_partition; tile++)
+    {
+        const size_t block_offset = (first_tile + tile) * items_per_block;
+
+        AccType values[items_per_thread];
+        if(!transform_load_blocked_vectorized(flat_block_thread_id, input + block_offset, values))
+        {
+            block_load_type().load(input + block_offset, values, storage.load);
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        AccType tile_reduction;
+        block_reduce_type().reduce(values, tile_reduction, storage.reduce, scan_op);
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        partition_reduction
+            = tile == 0 ? tile_reduction : scan_op(partition_reduction, tile_reduction);
+    }
+
+    if(flat_block_thread_id == 0)
+    {
+        partition_reductions[partition_id] = partition_reduction;
+    }
+}
+
+// Scans the partition `block_id` of the input. `partition_prefixes` holds the inclusive scan of
+// the reductions of all partitions but the last one.
+template<bool Exclusive,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction,
+         class AccType>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    two_pass_scan_kernel_impl(InputIterator  input,
+                              OutputIterator output,
+                              const size_t   size,
+                              AccType        initial_value,
+                              BinaryFunction scan_op,
+                              const AccType* partition_prefixes,
+                              const size_t   tiles_per_partition,
+                              const size_t   number_of_tiles)
+{
+    static constexpr scan_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.kernel_config.block_size;
+    constexpr unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using block_load_type
+        = ::rocprim::block_load<AccType, block_size, items_per_thread, params.block_load_method>;
+    using block_store_type
+        = ::rocprim::block_store<AccType, block_size, items_per_thread, params.block_store_method>;
+    using block_scan_type = ::rocprim::block_scan<AccType, block_size, params.block_scan_method>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_load_type::storage_type  load;
+        typename block_store_type::storage_type store;
+        typename block_scan_type::storage_type  scan;
+    } storage;
+
+    const unsigned int flat_block_thread_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int partition_id         = ::rocprim::detail::block_id<0>();
+    const size_t       first_tile           = partition_id * tiles_per_partition;
+    const size_t       last_tile
+        = ::rocprim::min(first_tile + tiles_per_partition, number_of_tiles);
+
+    // The prefix of an inclusive scan is folded into the first item of the tile.
+    AccType prefix     = initial_value;
+    bool    has_prefix = Exclusive;
+    if(partition_id > 0)
+    {
+        const AccType partition_prefix = partition_prefixes[partition_id - 1];
+        prefix     = Exclusive ? scan_op(initial_value, partition_prefix) : partition_prefix;
+        has_prefix = true;
+    }
+
+    for(size_t tile = first_tile; tile < last_tile; tile++)
+    {
+        const size_t       block_offset = tile * items_per_block;
+        const bool         is_last_tile = tile + 1 == number_of_tiles;
+        const unsigned int valid
+            = is_last_tile ? static_cast<unsigned int>(size - block_offset) : items_per_block;
+
+        AccType values[items_per_thread];
+        if(is_last_tile)
+        {
+            block_load_type().load(input + block_offset,
+                                   values,
+                                   valid,
+                                   *(input + block_offset),
+                                   storage.load);
+        }
+        else if(!transform_load_blocked_vectorized(flat_block_thread_id,
+                                                   input + block_offset,
+                                                   values))
+        {
+            block_load_type().load(input + block_offset, values, storage.load);
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        if(!Exclusive && has_prefix && flat_block_thread_id == 0)
+        {
+            values[0] = scan_op(prefix, values[0]);
+        }
+
+        // The reduction includes the prefix, so it is the prefix of the next tile. The reduction
+        // of the last tile includes values past the end of the input, but it is not used.
+        AccType reduction;
+        lookback_block_scan<Exclusive, block_scan_type>(values, // input/output
+                                                        prefix,
+                                                        reduction,
+                                                        storage.scan,
+                                                        scan_op);
+        prefix     = reduction;
+        has_prefix = true;
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+
+        if(is_last_tile)
+        {
+            block_store_type().store(output + block_offset, values, valid, storage.store);
+        }
+        else
+        {
+            block_store_type().store(output + block_offset, values, storage.store);
+        }
+        ::rocprim::syncthreads(); // sync threads to reuse shared memory
+    }
+}
+
+// Scans the `count` partition reductions of a two-pass algorithm in place with a single block.
+// The algorithms have at most as many partitions as a block of Config processes items.
+template<class Config, class T, class BinaryFunction>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    two_pass_scan_partitions_kernel(T*                 partition_reductions,
+                                    const unsigned int count,
+                                    BinaryFunction     scan_op)
+{
+    constexpr unsigned int block_size = device_params<Config>().kernel_config.block_size;
+    constexpr unsigned int items_per_thread
+        = device_params<Config>().kernel_config.items_per_thread;
+
+    using block_load_type  = ::rocprim::block_load<T, block_size, items_per_thread>;
+    using block_store_type = ::rocprim::block_store<T, block_size, items_per_thread>;
+    using block_scan_type  = ::rocprim::block_scan<T, block_size>;
+
+    ROCPRIM_SHARED_MEMORY typename block_scan_type::storage_type storage;
+
+    T values[items_per_thread];
+    block_load_type().load(partition_reductions, values, count, partition_reductions[0]);
+    block_scan_type().inclusive_scan(values, values, storage, scan_op);
+    block_store_type().store(partition_reductions, values, count);
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SCAN_TWO_PASS_HPP_
@@ -28,9 +28,13 @@
 
 #include "../../intrinsics.hpp"
 #include "../../iterator/reverse_iterator.hpp"
+#include "../../block/block_load_func.hpp"
 #include "../config_types.hpp"
 #include "../device_search_config.hpp"
 #include "../device_transform.hpp"
+#include "device_ordered_find.hpp"
+#include "device_search_rolling_hash.hpp"
+#include "ordered_block_id.hpp"
 
 #include <iostream>
 #include <iterator>
@@ -43,14 +47,35 @@ BEGIN_ROCPRIM_NAMESPACE
 namespace detail
 {
 
+// Returns whether the keys match the input at start. Values returns the input value at an
+// offset from start.
+template<class Values, class Keys, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE bool search_matches(Values&&       values,
+                                                  Keys           keys,
+                                                  const size_t   keys_size,
+                                                  BinaryFunction compare_function)
+{
+    for(size_t i = 0; i < keys_size; i++)
+    {
+        if(!compare_function(values(i), keys[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Every thread checks the items_per_thread consecutive start positions of the keys, the tiles
+// are taken in order so that the search stops after the first tile with a match.
 template<class Config, class InputIterator1, class InputIterator2, class BinaryFunction>
 ROCPRIM_DEVICE
-void search_kernel_impl(InputIterator1 input,
-                        InputIterator2 keys,
-                        size_t*        output,
-                        size_t         size,
-                        size_t         keys_size,
-                        BinaryFunction compare_function)
+void search_kernel_impl(InputIterator1           input,
+                        InputIterator2           keys,
+                        size_t*                  output,
+                        size_t                   size,
+                        size_t                   keys_size,
+                        ordered_block_id<size_t> ordered_bid,
+                        BinaryFunction           compare_function)
 {
     constexpr search_config_params params = device_params<Config>();
 
@@ -58,65 +83,44 @@ void search_kernel_impl(InputIterator1 input,
     constexpr unsigned int items_per_thread = params.kernel_config.items_per_thread;
     constexpr unsigned int items_per_block  = block_size * items_per_thread;
 
-    const unsigned int flat_id       = rocprim::detail::block_thread_id<0>();
-    const unsigned int flat_block_id = rocprim::detail::block_id<0>();
+    const unsigned int flat_id = rocprim::detail::block_thread_id<0>();
 
-    const size_t offset       = flat_id * items_per_thread + flat_block_id * items_per_block;
-    bool         find_pattern = false;
-
-    // Check if it can have fit a key and a key has not yet be found with a lower index.
-    if(offset + keys_size > size || offset > atomic_load(output))
-    {
-        return;
-    }
-
-    size_t index = 0;
-    for(size_t id = offset; id < offset + items_per_thread; id++)
-    {
-        size_t i          = 0;
-        size_t current_id = id;
-        for(; i < keys_size - 1 && current_id < size; i++, current_id++)
+    ordered_find_loop<block_size, items_per_block>(
+        output,
+        size - keys_size + 1,
+        ordered_bid,
+        [&](const size_t block_offset, const unsigned int valid)
         {
-            if(!compare_function(input[current_id], keys[i]))
+            for(unsigned int id = flat_id * items_per_thread;
+                id < ::rocprim::min((flat_id + 1) * items_per_thread, valid);
+                id++)
             {
-                break;
+                const size_t start = block_offset + id;
+                if(search_matches([&](const size_t i) { return input[start + i]; },
+                                  keys,
+                                  keys_size,
+                                  compare_function))
+                {
+                    // Want to find the first occurance, do not need to search further.
+                    return id;
+                }
             }
-        }
-
-        // If the i is the last value for the key and the compare is also true,
-        // the pattern is found.
-        if(current_id < size && i == (keys_size - 1)
-           && compare_function(input[current_id], keys[i]))
-        {
-            index        = id;
-            find_pattern = true;
-            break;
-        }
-    }
-
-    // Construct a mask of threads in this wave which have the same digit.
-    lane_mask_type peer_mask = ballot(find_pattern);
-
-    wave_barrier();
-
-    // The number of threads in the warp that have the same digit AND whose lane id is lower
-    // than the current thread's.
-    const unsigned int peer_digit_prefix = masked_bit_count(peer_mask);
-
-    if(find_pattern && (peer_digit_prefix == 0))
-    {
-        atomic_min(output, index);
-    }
+            return ordered_find_no_match;
+        });
 }
 
+// The keys are loaded to shared memory once per block, and the input of every tile is loaded to
+// shared memory before it is searched. The keys can extend past the tile, those items are read
+// from the input.
 template<class Config, class InputIterator1, class InputIterator2, class BinaryFunction>
 ROCPRIM_DEVICE
-void search_kernel_shared_impl(InputIterator1 input,
-                               InputIterator2 keys,
-                               size_t*        output,
-                               size_t         size,
-                               size_t         keys_size,
-                               BinaryFunction compare_function)
+void search_kernel_shared_impl(InputIterator1           input,
+                               InputIterator2           keys,
+                               size_t*                  output,
+                               size_t                   size,
+                               size_t                   keys_size,
+                               ordered_block_id<size_t> ordered_bid,
+                               BinaryFunction           compare_function)
 {
     using value_type = typename std::iterator_traits<InputIterator1>::value_type;
     using key_type   = typename std::iterator_traits<InputIterator2>::value_type;
@@ -128,126 +132,108 @@ void search_kernel_shared_impl(InputIterator1 input,
     constexpr unsigned int items_per_block  = block_size * items_per_thread;
     constexpr unsigned int max_shared_key   = params.max_shared_key_bytes / sizeof(key_type);
 
-    const unsigned int flat_id       = rocprim::detail::block_thread_id<0>();
-    const unsigned int flat_block_id = rocprim::detail::block_id<0>();
-
-    const size_t block_offset = flat_block_id * items_per_block;
-    const size_t offset       = flat_id * items_per_thread;
-    bool find_pattern = false;
+    const unsigned int flat_id = rocprim::detail::block_thread_id<0>();
 
     ROCPRIM_SHARED_MEMORY uninitialized_array<key_type, max_shared_key> local_keys_;
     ROCPRIM_SHARED_MEMORY uninitialized_array<value_type, items_per_block> local_input_;
 
-    // Check if a key was already found in a place before this block
-    if(block_offset > atomic_load(output))
-    {
-        return;
-    }
-
     // Load in key in shared memory
-    const size_t batch_size = ceiling_div(keys_size, block_size);
-    for(size_t i = 0; i < batch_size; i++)
+    for(size_t index = flat_id; index < keys_size; index += block_size)
     {
-        const size_t index = flat_id * batch_size + i;
-        if(index < keys_size)
-        {
-            local_keys_.emplace(index, keys[index]);
-        }
-    }
-
-    using block_load_input = block_load<value_type, items_per_thread, items_per_thread>;
-
-    value_type elements[items_per_thread];
-
-    const bool is_complete_block = block_offset + items_per_block <= size;
-
-    // Load in all the input values that are guaranteed to be loaded.
-    if(is_complete_block)
-    {
-        block_load_input().load(input + block_offset, elements);
-        for(size_t i = 0; i < items_per_thread; i++)
-        {
-            const size_t index = flat_id * items_per_thread + i;
-            local_input_.emplace(index, elements[i]);
-        }
-    }
-    else
-    {
-        block_load_input().load(input + block_offset, elements, size - block_offset);
-        for(size_t i = 0; i < items_per_thread; i++)
-        {
-            const size_t index       = flat_id * items_per_thread + i;
-            const size_t index_value = block_offset + index;
-            if(index_value < size)
-            {
-                local_input_.emplace(index, elements[i]);
-            }
-        }
+        local_keys_.emplace(index, keys[index]);
     }
 
     const key_type*   local_keys  = local_keys_.get_unsafe_array();
     const value_type* local_input = local_input_.get_unsafe_array();
 
-    syncthreads();
-
-    // Check if it can have fit a key and a key has not yet be found with a lower index.
-    if(offset + block_offset + keys_size > size || offset > atomic_load(output))
-    {
-        return;
-    }
-
-    size_t       index      = 0;
-    const size_t check      = size - block_offset;
-    const size_t check_both = rocprim::min(check, size_t(items_per_block));
-    for(size_t id = offset; id < offset + items_per_thread; id++)
-    {
-        size_t i          = 0;
-        size_t current_id = id;
-        // Values till the items_per_block are in shared_memory
-        for(; i < keys_size - 1 && current_id < check_both; i++, current_id++)
+    ordered_find_loop<block_size, items_per_block>(
+        output,
+        size - keys_size + 1,
+        ordered_bid,
+        [&](const size_t block_offset, const unsigned int valid)
         {
-            if(!compare_function(local_input[current_id], local_keys[i]))
+            // Load in all the input values of the tile.
+            const unsigned int loaded
+                = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset,
+                                                                   items_per_block));
+            value_type elements[items_per_thread];
+            block_load_direct_blocked(flat_id, input + block_offset, elements, loaded);
+            for(unsigned int i = 0; i < items_per_thread; i++)
             {
-                break;
+                const unsigned int index = flat_id * items_per_thread + i;
+                if(index < loaded)
+                {
+                    local_input_.emplace(index, elements[i]);
+                }
             }
-        }
-        // Compare values that are not in the shared memory
-        for(; current_id >= items_per_block && i < keys_size - 1 && current_id < check;
-            i++, current_id++)
-        {
-            if(!compare_function(input[current_id + block_offset], local_keys[i]))
+            // The keys are also synchronized on the first tile
+            syncthreads();
+
+            for(unsigned int id = flat_id * items_per_thread;
+                id < ::rocprim::min((flat_id + 1) * items_per_thread, valid);
+                id++)
             {
-                break;
+                const auto values = [&](const size_t i)
+                {
+                    // Values till the items_per_block are in shared_memory
+                    return id + i < loaded ? local_input[id + i] : input[block_offset + id + i];
+                };
+                if(search_matches(values, local_keys, keys_size, compare_function))
+                {
+                    // Want to find the first occurance, do not need to search further.
+                    return id;
+                }
             }
-        }
-
-        // If the i is the last value for the key and the compare is also true,
-        // the pattern is found.
-        if(current_id + block_offset < size && i == (keys_size - 1)
-           && compare_function(current_id < items_per_block ? local_input[current_id]
-                                                            : input[current_id + block_offset],
-                               local_keys[i]))
-        {
-            index        = id + block_offset;
-            find_pattern = true;
-            // Want to find the first occurance, do not need to search further.
-            break;
-        }
-    }
+            return ordered_find_no_match;
+        });
+}
 
-    // Construct a mask of threads in this wave which have the same digit.
-    lane_mask_type peer_mask = ballot(find_pattern);
+// Every candidate position is checked by the hash of the window, from the prefix hashes of the
+// input, and only the positions with the hash of the keys are compared item by item. The
+// threads check their positions in a striped arrangement, so the prefix hashes are coalesced.
+template<class Config, class InputIterator1, class InputIterator2, class BinaryFunction>
+ROCPRIM_DEVICE
+void search_kernel_rolling_hash_impl(InputIterator1            input,
+                                     InputIterator2            keys,
+                                     const unsigned long long* prefix_hashes,
+                                     const unsigned long long* key_hash,
+                                     const unsigned long long  key_power,
+                                     size_t*                   output,
+                                     size_t                    size,
+                                     size_t                    keys_size,
+                                     ordered_block_id<size_t>  ordered_bid,
+                                     BinaryFunction            compare_function)
+{
+    constexpr search_config_params params = device_params<Config>();
 
-    wave_barrier();
+    constexpr unsigned int block_size       = params.kernel_config.block_size;
+    constexpr unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
 
-    // The number of threads in the warp that have the same digit AND whose lane id is lower
-    // than the current thread's.
-    const unsigned int peer_digit_prefix = masked_bit_count(peer_mask);
+    const unsigned int       flat_id = rocprim::detail::block_thread_id<0>();
+    const unsigned long long hash    = *key_hash;
 
-    if(find_pattern && (peer_digit_prefix == 0))
-    {
-        atomic_min(output, index);
-    }
+    ordered_find_loop<block_size, items_per_block>(
+        output,
+        size - keys_size + 1,
+        ordered_bid,
+        [&](const size_t block_offset, const unsigned int valid)
+        {
+            for(unsigned int id = flat_id; id < valid; id += block_size)
+            {
+                const size_t start = block_offset + id;
+                if(prefix_hashes[start + keys_size] - prefix_hashes[start] * key_power == hash
+                   && search_matches([&](const size_t i) { return input[start + i]; },
+                                     keys,
+                                     keys_size,
+                                     compare_function))
+                {
+                    // The positions of a thread are ascending, the first match is its lowest.
+                    return id;
+                }
+            }
+            return ordered_find_no_match;
+        });
 }
 
 template<class Config, class InputIterator1, class InputIterator2, class BinaryFunction>
@@ -255,57 +241,65 @@ struct search_impl_kernels
 {
     static ROCPRIM_KERNEL
 __launch_bounds__(device_params<Config>().kernel_config.block_size)
-    void search_kernel_shared(InputIterator1 input,
-                              InputIterator2 keys,
-                              size_t*        output,
-                              size_t         size,
-                              size_t         keys_size,
-                              BinaryFunction compare_function)
-    {
-        search_kernel_shared_impl<Config>(input, keys, output, size, keys_size, compare_function);
-    }
-
-    static ROCPRIM_KERNEL
-__launch_bounds__(device_params<Config>().kernel_config.block_size)
-    void search_kernel(InputIterator1 input,
-                       InputIterator2 keys,
-                       size_t*        output,
-                       size_t         size,
-                       size_t         keys_size,
-                       BinaryFunction compare_function)
+    void search_kernel_shared(InputIterator1           input,
+                              InputIterator2           keys,
+                              size_t*                  output,
+                              size_t                   size,
+                              size_t                   keys_size,
+                              ordered_block_id<size_t> ordered_bid,
+                              BinaryFunction           compare_function)
     {
-        search_kernel_impl<Config>(input, keys, output, size, keys_size, compare_function);
+        search_kernel_shared_impl<Config>(input,
+                                          keys,
+                                          output,
+                                          size,
+                                          keys_size,
+                                          ordered_bid,
+                                          compare_function);
     }
 
     static ROCPRIM_KERNEL
 __launch_bounds__(device_params<Config>().kernel_config.block_size)
-    void search_kernel_shared(reverse_iterator<InputIterator1> input,
-                              reverse_iterator<InputIterator2> keys,
-                              size_t*                          output,
-                              size_t                           size,
-                              size_t                           keys_size,
-                              BinaryFunction                   compare_function)
+    void search_kernel(InputIterator1           input,
+                       InputIterator2           keys,
+                       size_t*                  output,
+                       size_t                   size,
+                       size_t                   keys_size,
+                       ordered_block_id<size_t> ordered_bid,
+                       BinaryFunction           compare_function)
     {
-        search_kernel_shared_impl<Config>(input, keys, output, size, keys_size, compare_function);
+        search_kernel_impl<Config>(input,
+                                   keys,
+                                   output,
+                                   size,
+                                   keys_size,
+                                   ordered_bid,
+                                   compare_function);
     }
 
     static ROCPRIM_KERNEL
 __launch_bounds__(device_params<Config>().kernel_config.block_size)
-    void search_kernel(reverse_iterator<InputIterator1> input,
-                       reverse_iterator<InputIterator2> keys,
-                       size_t*                          output,
-                       size_t                           size,
-                       size_t                           keys_size,
-                       BinaryFunction                   compare_function)
+    void search_kernel_rolling_hash(InputIterator1            input,
+                                    InputIterator2            keys,
+                                    const unsigned long long* prefix_hashes,
+                                    const unsigned long long* key_hash,
+                                    const unsigned long long  key_power,
+                                    size_t*                   output,
+                                    size_t                    size,
+                                    size_t                    keys_size,
+                                    ordered_block_id<size_t>  ordered_bid,
+                                    BinaryFunction            compare_function)
     {
-        search_kernel_impl<Config>(input, keys, output, size, keys_size, compare_function);
-    }
-
-    template<class T>
-    static ROCPRIM_KERNEL
-    void set_output_kernel(T* output, T value)
-    {
-        *output = value;
+        search_kernel_rolling_hash_impl<Config>(input,
+                                                keys,
+                                                prefix_hashes,
+                                                key_hash,
+                                                key_power,
+                                                output,
+                                                size,
+                                                keys_size,
+                                                ordered_bid,
+                                                compare_function);
     }
 
     template<class T>
@@ -345,6 +339,11 @@ hipError_t search_impl(void*          temporary_storage,
     using config = wrapped_search_config<Config, input_type>;
     using search_kernels
         = search_impl_kernels<config, InputIterator1, InputIterator2, BinaryFunction>;
+    // find_end searches for the reversed keys in the reversed input
+    using reverse_search_kernels = search_impl_kernels<config,
+                                                       reverse_iterator<InputIterator1>,
+                                                       reverse_iterator<InputIterator2>,
+                                                       BinaryFunction>;
 
     target_arch target_arch;
     ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, target_arch));
@@ -369,9 +368,59 @@ hipError_t search_impl(void*          temporary_storage,
         }
     };
 
+    using ordered_bid_type = ordered_block_id<size_t>;
+
+    // Long keys of integers compared for equality are searched by rolling hashes
+    using rolling_hash = search_rolling_hash<
+        search_use_rolling_hash<input_type, key_type, BinaryFunction>::value>;
+    const bool use_rolling_hash
+        = search_use_rolling_hash<input_type, key_type, BinaryFunction>::value
+          && keys_size >= search_rolling_hash_min_keys && keys_size <= size;
+
+    size_t scan_storage_size = 0;
+    if(use_rolling_hash)
+    {
+        if ROCPRIM_IF_CONSTEXPR(find_first)
+        {
+            ROCPRIM_RETURN_ON_ERROR(
+                rolling_hash::scan_storage_size(scan_storage_size,
+                                                input,
+                                                keys,
+                                                size,
+                                                keys_size,
+                                                stream));
+        }
+        else
+        {
+            ROCPRIM_RETURN_ON_ERROR(rolling_hash::scan_storage_size(
+                scan_storage_size,
+                rocprim::make_reverse_iterator(input + size),
+                rocprim::make_reverse_iterator(keys + keys_size),
+                size,
+                keys_size,
+                stream));
+        }
+    }
+
+    size_t*                    tmp_output          = nullptr;
+    ordered_bid_type::id_type* ordered_bid_storage = nullptr;
+    unsigned long long*        prefix_hashes       = nullptr;
+    unsigned long long*        key_prefix_hashes   = nullptr;
+    void*                      scan_storage        = nullptr;
+
+    ROCPRIM_RETURN_ON_ERROR(temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::ptr_aligned_array(&tmp_output, 1),
+            temp_storage::make_partition(&ordered_bid_storage,
+                                         ordered_bid_type::get_temp_storage_layout()),
+            temp_storage::ptr_aligned_array(&prefix_hashes, use_rolling_hash ? size + 1 : 0),
+            temp_storage::ptr_aligned_array(&key_prefix_hashes,
+                                            use_rolling_hash ? keys_size : 0),
+            temp_storage::make_partition(&scan_storage, scan_storage_size))));
     if(temporary_storage == nullptr)
     {
-        storage_size = sizeof(size_t);
         return hipSuccess;
     }
 
@@ -380,68 +429,160 @@ hipError_t search_impl(void*          temporary_storage,
         return hipErrorInvalidValue;
     }
 
-    size_t* tmp_output = reinterpret_cast<size_t*>(temporary_storage);
-
-    start_timer();
-    search_kernels::set_output_kernel<<<1, 1, 0, stream>>>(tmp_output,
-                                                           find_first && keys_size <= 0 ? 0 : size);
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("set_output_kernel", 1, start);
+    const auto ordered_bid = ordered_bid_type::create(ordered_bid_storage);
+    ROCPRIM_RETURN_ON_ERROR(ordered_find_init(tmp_output,
+                                              find_first && keys_size <= 0 ? 0 : size,
+                                              ordered_bid,
+                                              stream,
+                                              debug_synchronous));
 
     if(size > 0 && keys_size > 0)
     {
-        const unsigned int num_blocks = ceiling_div(size, items_per_block);
-        if(key_size_bytes < shared_key_mem_size_bytes)
+        // The number of start positions of the keys
+        const size_t candidates = size - keys_size + 1;
+        if(use_rolling_hash)
+        {
+            const unsigned long long  key_power = search_hash_power(keys_size);
+            const unsigned long long* key_hash  = key_prefix_hashes + keys_size - 1;
+            if ROCPRIM_IF_CONSTEXPR(find_first)
+            {
+                ROCPRIM_RETURN_ON_ERROR(rolling_hash::prepare(scan_storage,
+                                                              scan_storage_size,
+                                                              input,
+                                                              keys,
+                                                              size,
+                                                              keys_size,
+                                                              prefix_hashes,
+                                                              key_prefix_hashes,
+                                                              stream,
+                                                              debug_synchronous));
+                ROCPRIM_RETURN_ON_ERROR(
+                    ordered_find_launch(search_kernels::search_kernel_rolling_hash,
+                                        "search_kernel_rolling_hash",
+                                        block_size,
+                                        items_per_block,
+                                        candidates,
+                                        stream,
+                                        debug_synchronous,
+                                        input,
+                                        keys,
+                                        static_cast<const unsigned long long*>(prefix_hashes),
+                                        key_hash,
+                                        key_power,
+                                        tmp_output,
+                                        size,
+                                        keys_size,
+                                        ordered_bid,
+                                        compare_function));
+            }
+            else
+            {
+                const auto reverse_input = rocprim::make_reverse_iterator(input + size);
+                const auto reverse_keys  = rocprim::make_reverse_iterator(keys + keys_size);
+                ROCPRIM_RETURN_ON_ERROR(rolling_hash::prepare(scan_storage,
+                                                              scan_storage_size,
+                                                              reverse_input,
+                                                              reverse_keys,
+                                                              size,
+                                                              keys_size,
+                                                              prefix_hashes,
+                                                              key_prefix_hashes,
+                                                              stream,
+                                                              debug_synchronous));
+                ROCPRIM_RETURN_ON_ERROR(
+                    ordered_find_launch(reverse_search_kernels::search_kernel_rolling_hash,
+                                        "search_kernel_rolling_hash",
+                                        block_size,
+                                        items_per_block,
+                                        candidates,
+                                        stream,
+                                        debug_synchronous,
+                                        reverse_input,
+                                        reverse_keys,
+                                        static_cast<const unsigned long long*>(prefix_hashes),
+                                        key_hash,
+                                        key_power,
+                                        tmp_output,
+                                        size,
+                                        keys_size,
+                                        ordered_bid,
+                                        compare_function));
+            }
+        }
+        else if(key_size_bytes < shared_key_mem_size_bytes)
         {
             if ROCPRIM_IF_CONSTEXPR(find_first)
             {
-                start_timer();
-                search_kernels::search_kernel_shared<<<num_blocks, block_size, 0, stream>>>(
-                    input,
-                    keys,
-                    tmp_output,
-                    size,
-                    keys_size,
-                    compare_function);
-                ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("search_kernel_shared", size, start);
+                ROCPRIM_RETURN_ON_ERROR(ordered_find_launch(search_kernels::search_kernel_shared,
+                                                            "search_kernel_shared",
+                                                            block_size,
+                                                            items_per_block,
+                                                            candidates,
+                                                            stream,
+                                                            debug_synchronous,
+                                                            input,
+                                                            keys,
+                                                            tmp_output,
+                                                            size,
+                                                            keys_size,
+                                                            ordered_bid,
+                                                            compare_function));
             }
             else
             {
-                start_timer();
-                search_kernels::search_kernel_shared<<<num_blocks, block_size, 0, stream>>>(
-                    rocprim::make_reverse_iterator(input + size),
-                    rocprim::make_reverse_iterator(keys + keys_size),
-                    tmp_output,
-                    size,
-                    keys_size,
-                    compare_function);
-                ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("search_kernel_shared", size, start);
+                ROCPRIM_RETURN_ON_ERROR(
+                    ordered_find_launch(reverse_search_kernels::search_kernel_shared,
+                                        "search_kernel_shared",
+                                        block_size,
+                                        items_per_block,
+                                        candidates,
+                                        stream,
+                                        debug_synchronous,
+                                        rocprim::make_reverse_iterator(input + size),
+                                        rocprim::make_reverse_iterator(keys + keys_size),
+                                        tmp_output,
+                                        size,
+                                        keys_size,
+                                        ordered_bid,
+                                        compare_function));
             }
         }
         else
         {
             if ROCPRIM_IF_CONSTEXPR(find_first)
             {
-                start_timer();
-                search_kernels::search_kernel<<<num_blocks, block_size, 0, stream>>>(
-                    input,
-                    keys,
-                    tmp_output,
-                    size,
-                    keys_size,
-                    compare_function);
-                ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("search_kernel", size, start);
+                ROCPRIM_RETURN_ON_ERROR(ordered_find_launch(search_kernels::search_kernel,
+                                                            "search_kernel",
+                                                            block_size,
+                                                            items_per_block,
+                                                            candidates,
+                                                            stream,
+                                                            debug_synchronous,
+                                                            input,
+                                                            keys,
+                                                            tmp_output,
+                                                            size,
+                                                            keys_size,
+                                                            ordered_bid,
+                                                            compare_function));
             }
             else
             {
-                start_timer();
-                search_kernels::search_kernel<<<num_blocks, block_size, 0, stream>>>(
-                    rocprim::make_reverse_iterator(input + size),
-                    rocprim::make_reverse_iterator(keys + keys_size),
-                    tmp_output,
-                    size,
-                    keys_size,
-                    compare_function);
-                ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("search_kernel", size, start);
+                ROCPRIM_RETURN_ON_ERROR(
+                    ordered_find_launch(reverse_search_kernels::search_kernel,
+                                        "search_kernel",
+                                        block_size,
+                                        items_per_block,
+                                        candidates,
+                                        stream,
+                                        debug_synchronous,
+                                        rocprim::make_reverse_iterator(input + size),
+                                        rocprim::make_reverse_iterator(keys + keys_size),
+                                        tmp_output,
+                                        size,
+                                        keys_size,
+                                        ordered_bid,
+                                        compare_function));
             }
         }
 
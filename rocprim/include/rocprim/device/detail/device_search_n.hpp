@@ -23,10 +23,13 @@
 
 #include "../../common.hpp"
 #include "../../config.hpp"
+#include "../../detail/temp_storage.hpp"
 #include "../config_types.hpp"
 #include "../device_reduce.hpp"
 #include "../device_search_n_config.hpp"
 #include "../device_transform.hpp"
+#include "device_ordered_find.hpp"
+#include "ordered_block_id.hpp"
 
 #include <iterator>
 
@@ -56,6 +59,8 @@ struct search_n_impl_kernels
 
     /// \brief Supports all forms of search_n operations,
     /// but the efficiency is insufficient when `items_per_block` is too large.
+    /// The tiles of the start positions are taken in order, so the search stops after the first
+    /// tile with a match.
     static ROCPRIM_KERNEL
 #ifndef DOXYGEN_DOCUMENTATION_BUILD
 __launch_bounds__(device_params<Config>().kernel_config.block_size)
@@ -66,47 +71,53 @@ __launch_bounds__(device_params<Config>().kernel_config.block_size)
             const size_t                                                    size,
             const size_t                                                    count,
             const typename std::iterator_traits<InputIterator>::value_type* value,
-            const BinaryPredicate                                           binary_predicate)
+            const BinaryPredicate                                           binary_predicate,
+            ordered_block_id<size_t>                                        ordered_bid)
     {
         constexpr auto params           = device_params<Config>();
         constexpr auto block_size       = params.kernel_config.block_size;
         constexpr auto items_per_thread = params.kernel_config.items_per_thread;
         constexpr auto items_per_block  = block_size * items_per_thread;
 
-        const size_t this_thread_start_idx
-            = (block_id<0>() * items_per_block) + (items_per_thread * block_thread_id<0>());
-
-        // TODO: This could cause load imbalance among threads
-        // So maybe there is a better way to do this
-        if(size < count + this_thread_start_idx)
-        { // not able to find a sequence equal to or longer than count
-            return;
-        }
-
-        size_t remaining_count    = count;
-        size_t sequence_start_idx = this_thread_start_idx;
-
-        const size_t items_this_thread
-            = std::min<size_t>(size - this_thread_start_idx, items_per_thread);
-        for(size_t i = this_thread_start_idx;
-            sequence_start_idx - this_thread_start_idx < items_this_thread
-            && i + remaining_count <= size;
-            ++i)
-        {
-            if(binary_predicate(input[i], *value))
+        ordered_find_loop<block_size, items_per_block>(
+            output,
+            size - count + 1,
+            ordered_bid,
+            [&](const size_t block_offset, const unsigned int valid) -> unsigned int
             {
-                if(--remaining_count == 0)
+                const unsigned int this_thread_start = items_per_thread * block_thread_id<0>();
+                if(this_thread_start >= valid)
+                { // not able to find a sequence equal to or longer than count
+                    return ordered_find_no_match;
+                }
+
+                // TODO: There can be overlapping between threads, this probably can be optimized
+                const size_t this_thread_start_idx = block_offset + this_thread_start;
+                const size_t items_this_thread
+                    = std::min<size_t>(valid - this_thread_start, items_per_thread);
+
+                size_t remaining_count    = count;
+                size_t sequence_start_idx = this_thread_start_idx;
+                for(size_t i = this_thread_start_idx;
+                    sequence_start_idx - this_thread_start_idx < items_this_thread
+                    && i + remaining_count <= size;
+                    ++i)
                 {
-                    atomic_min(output, sequence_start_idx);
-                    return;
+                    if(binary_predicate(input[i], *value))
+                    {
+                        if(--remaining_count == 0)
+                        {
+                            return static_cast<unsigned int>(sequence_start_idx - block_offset);
+                        }
+                    }
+                    else
+                    {
+                        remaining_count    = count;
+                        sequence_start_idx = i + 1;
+                    }
                 }
-            }
-            else
-            {
-                remaining_count    = count;
-                sequence_start_idx = i + 1;
-            }
-        }
+                return ordered_find_no_match;
+            });
     }
 
     static ROCPRIM_KERNEL
@@ -322,26 +333,41 @@ hipError_t search_n_impl(void*          temporary_storage,
     else if(count <= params.threshold)
     { // reduce search_n will have a maximum access time of params.threshold
         // So if the count is equals to or smaller than params.threshold, `normal_search_n` should be faster
+        using ordered_bid_type = ordered_block_id<size_t>;
+
+        ordered_bid_type::id_type* ordered_bid_storage = nullptr;
+
         // calculate size
-        if(tmp_output == nullptr)
+        ROCPRIM_RETURN_ON_ERROR(temp_storage::partition(
+            temporary_storage,
+            storage_size,
+            temp_storage::make_linear_partition(
+                temp_storage::ptr_aligned_array(&tmp_output, 1),
+                temp_storage::make_partition(&ordered_bid_storage,
+                                             ordered_bid_type::get_temp_storage_layout()))));
+        if(temporary_storage == nullptr)
         {
-            storage_size = sizeof(size_t);
             return hipSuccess;
         }
 
         // do `normal_search_n`
-        search_n_start_timer(start, debug_synchronous);
-        search_n_kernels::search_n_init_kernel<<<1, 1, 0, stream>>>(tmp_output, size);
-        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("search_n_init_kernel", 1, start);
-        // TODO: There can be overlapping between threads, this probably can be optimized
-        search_n_kernels::search_n_normal_kernel<<<num_blocks, block_size, 0, stream>>>(
-            input,
-            tmp_output,
-            size,
-            count,
-            value,
-            binary_predicate);
-        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("search_n_normal_kernel", size, start);
+        const auto ordered_bid = ordered_bid_type::create(ordered_bid_storage);
+        ROCPRIM_RETURN_ON_ERROR(
+            ordered_find_init(tmp_output, size, ordered_bid, stream, debug_synchronous));
+        ROCPRIM_RETURN_ON_ERROR(ordered_find_launch(search_n_kernels::search_n_normal_kernel,
+                                                    "search_n_normal_kernel",
+                                                    block_size,
+                                                    items_per_block,
+                                                    size - count + 1,
+                                                    stream,
+                                                    debug_synchronous,
+                                                    input,
+                                                    tmp_output,
+                                                    size,
+                                                    count,
+                                                    value,
+                                                    binary_predicate,
+                                                    ordered_bid));
         ROCPRIM_RETURN_ON_ERROR(
             transform(tmp_output, output, 1, identity<output_type>(), stream, debug_synchronous));
         return hipSuccess;
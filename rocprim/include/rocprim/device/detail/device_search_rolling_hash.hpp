@@ -0,0 +1,234 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SEARCH_ROLLING_HASH_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SEARCH_ROLLING_HASH_HPP_
+
+#include "../../config.hpp"
+#include "../../functional.hpp"
+
+#include "../../iterator/transform_iterator.hpp"
+#include "../../iterator/transform_output_iterator.hpp"
+#include "../device_scan.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Keys of at least this many items are searched by their rolling hash, so that a candidate
+// position costs two loads until its hash matches, however long the common prefixes are.
+constexpr size_t search_rolling_hash_min_keys = 1024;
+
+// Only equal integers have equal hashes, other types and other comparisons are compared item
+// by item.
+template<class InputType, class KeyType, class BinaryFunction>
+struct search_use_rolling_hash
+    : std::integral_constant<
+          bool,
+          std::is_integral<InputType>::value && std::is_same<InputType, KeyType>::value
+              && (std::is_same<BinaryFunction, ::rocprim::equal_to<InputType>>::value
+                  || std::is_same<BinaryFunction, ::rocprim::equal_to<>>::value)>
+{};
+
+// The polynomial hash of the items x[0..n) is sum(h(x[i]) * base^(n - 1 - i)) modulo 2^64, the
+// state of a range keeps its hash and base^n, so that the hashes of adjacent ranges combine.
+struct search_hash_state
+{
+    unsigned long long hash;
+    unsigned long long power;
+};
+
+constexpr unsigned long long search_hash_base = 0x100000001b3ull;
+
+// The items are mixed before they are hashed, so that structured inputs do not collide.
+template<class T>
+struct search_hash_input_op
+{
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    search_hash_state operator()(const T& value) const
+    {
+        unsigned long long x = static_cast<unsigned long long>(value);
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdull;
+        x ^= x >> 33;
+        return search_hash_state{x, search_hash_base};
+    }
+};
+
+struct search_hash_combine_op
+{
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    search_hash_state operator()(const search_hash_state& a, const search_hash_state& b) const
+    {
+        return search_hash_state{a.hash * b.power + b.hash, a.power * b.power};
+    }
+};
+
+struct search_hash_extract_op
+{
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    unsigned long long operator()(const search_hash_state& state) const
+    {
+        return state.hash;
+    }
+};
+
+inline unsigned long long search_hash_power(size_t exponent)
+{
+    unsigned long long result = 1;
+    unsigned long long base   = search_hash_base;
+    for(; exponent != 0; exponent >>= 1)
+    {
+        if(exponent & 1)
+        {
+            result *= base;
+        }
+        base *= base;
+    }
+    return result;
+}
+
+// The prefix hashes of the input are its inclusive scan with the combination of the hash
+// states, which gives the carries between the tiles. The hash of the keys is the last prefix
+// hash of the keys.
+template<bool Hashable>
+struct search_rolling_hash
+{
+    template<class InputIterator1, class InputIterator2>
+    static hipError_t scan_storage_size(size_t&           storage_size,
+                                        InputIterator1    input,
+                                        InputIterator2    keys,
+                                        const size_t      size,
+                                        const size_t      keys_size,
+                                        const hipStream_t stream)
+    {
+        using input_type = typename std::iterator_traits<InputIterator1>::value_type;
+        using key_type   = typename std::iterator_traits<InputIterator2>::value_type;
+
+        const auto prefix_output
+            = ::rocprim::make_transform_output_iterator(static_cast<unsigned long long*>(nullptr),
+                                                        search_hash_extract_op());
+
+        size_t input_storage_size;
+        size_t keys_storage_size;
+        ROCPRIM_RETURN_ON_ERROR(::rocprim::inclusive_scan(
+            nullptr,
+            input_storage_size,
+            ::rocprim::make_transform_iterator(input, search_hash_input_op<input_type>()),
+            prefix_output,
+            size,
+            search_hash_combine_op(),
+            stream));
+        ROCPRIM_RETURN_ON_ERROR(::rocprim::inclusive_scan(
+            nullptr,
+            keys_storage_size,
+            ::rocprim::make_transform_iterator(keys, search_hash_input_op<key_type>()),
+            prefix_output,
+            keys_size,
+            search_hash_combine_op(),
+            stream));
+        storage_size = std::max(input_storage_size, keys_storage_size);
+        return hipSuccess;
+    }
+
+    // prefix_hashes[i] is the hash of the first i items of the input
+    template<class InputIterator1, class InputIterator2>
+    static hipError_t prepare(void*               scan_storage,
+                              size_t              scan_storage_size,
+                              InputIterator1      input,
+                              InputIterator2      keys,
+                              const size_t        size,
+                              const size_t        keys_size,
+                              unsigned long long* prefix_hashes,
+                              unsigned long long* key_prefix_hashes,
+                              const hipStream_t   stream,
+                              const bool          debug_synchronous)
+    {
+        using input_type = typename std::iterator_traits<InputIterator1>::value_type;
+        using key_type   = typename std::iterator_traits<InputIterator2>::value_type;
+
+        ROCPRIM_RETURN_ON_ERROR(
+            hipMemsetAsync(prefix_hashes, 0, sizeof(unsigned long long), stream));
+        ROCPRIM_RETURN_ON_ERROR(::rocprim::inclusive_scan(
+            scan_storage,
+            scan_storage_size,
+            ::rocprim::make_transform_iterator(input, search_hash_input_op<input_type>()),
+            ::rocprim::make_transform_output_iterator(prefix_hashes + 1,
+                                                      search_hash_extract_op()),
+            size,
+            search_hash_combine_op(),
+            stream,
+            debug_synchronous));
+        return ::rocprim::inclusive_scan(
+            scan_storage,
+            scan_storage_size,
+            ::rocprim::make_transform_iterator(keys, search_hash_input_op<key_type>()),
+            ::rocprim::make_transform_output_iterator(key_prefix_hashes,
+                                                      search_hash_extract_op()),
+            keys_size,
+            search_hash_combine_op(),
+            stream,
+            debug_synchronous);
+    }
+};
+
+template<>
+struct search_rolling_hash<false>
+{
+    template<class InputIterator1, class InputIterator2>
+    static hipError_t scan_storage_size(size_t& storage_size,
+                                        InputIterator1,
+                                        InputIterator2,
+                                        const size_t,
+                                        const size_t,
+                                        const hipStream_t)
+    {
+        storage_size = 0;
+        return hipSuccess;
+    }
+
+    template<class InputIterator1, class InputIterator2>
+    static hipError_t prepare(void*,
+                              size_t,
+                              InputIterator1,
+                              InputIterator2,
+                              const size_t,
+                              const size_t,
+                              unsigned long long*,
+                              unsigned long long*,
+                              const hipStream_t,
+                              const bool)
+    {
+        return hipErrorInvalidValue;
+    }
+};
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SEARCH_ROLLING_HASH_HPP_
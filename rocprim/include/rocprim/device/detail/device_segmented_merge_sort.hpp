@@ -0,0 +1,433 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_MERGE_SORT_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_MERGE_SORT_HPP_
+
+#include "../../block/block_load_func.hpp"
+#include "../../block/block_store_func.hpp"
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+#include "../../warp/warp_merge_sort.hpp"
+
+#include "device_config_helper.hpp"
+#include "device_merge_sort.hpp"
+#include "device_merge_sort_mergepath.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class WarpSort, class Key, unsigned int ItemsPerThread, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void segmented_merge_sort_warp_items(Key (&keys)[ItemsPerThread],
+                                     empty_type (&/*values*/)[ItemsPerThread],
+                                     typename WarpSort::storage_type& storage,
+                                     const unsigned int               valid_items,
+                                     BinaryFunction                   compare_function)
+{
+    WarpSort().sort(keys, storage, valid_items, compare_function);
+}
+
+template<class WarpSort,
+         class Key,
+         class Value,
+         unsigned int ItemsPerThread,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void segmented_merge_sort_warp_items(Key (&keys)[ItemsPerThread],
+                                     Value (&values)[ItemsPerThread],
+                                     typename WarpSort::storage_type& storage,
+                                     const unsigned int               valid_items,
+                                     BinaryFunction                   compare_function)
+{
+    WarpSort().sort(keys, values, storage, valid_items, compare_function);
+}
+
+// Sorts one segment of at most LogicalWarpSize * ItemsPerThread items by each logical warp.
+// The warp sort only compares the valid items, so no padding keys are needed.
+template<unsigned int BlockSize,
+         unsigned int LogicalWarpSize,
+         unsigned int ItemsPerThread,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class SegmentIndexIterator,
+         class OffsetIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void segmented_merge_sort_warp(KeysInputIterator    keys_input,
+                               KeysOutputIterator   keys_output,
+                               ValuesInputIterator  values_input,
+                               ValuesOutputIterator values_output,
+                               const unsigned int   num_segments,
+                               SegmentIndexIterator segment_indices,
+                               OffsetIterator       begin_offsets,
+                               OffsetIterator       end_offsets,
+                               BinaryFunction       compare_function)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using sort_type  = warp_merge_sort<key_type, ItemsPerThread, LogicalWarpSize, value_type>;
+
+    constexpr bool         with_values     = !std::is_same<value_type, empty_type>::value;
+    constexpr unsigned int warps_per_block = BlockSize / LogicalWarpSize;
+
+    ROCPRIM_SHARED_MEMORY typename sort_type::storage_type storage[warps_per_block];
+
+    const unsigned int warp_id    = block_thread_id<0>() / LogicalWarpSize;
+    const unsigned int lane       = logical_lane_id<LogicalWarpSize>();
+    const unsigned int segment_id = block_id<0>() * warps_per_block + warp_id;
+    if(segment_id >= num_segments)
+    {
+        return;
+    }
+
+    const unsigned int segment_index = segment_indices[segment_id];
+    const unsigned int begin_offset  = begin_offsets[segment_index];
+    const unsigned int end_offset    = end_offsets[segment_index];
+    if(end_offset <= begin_offset)
+    {
+        return;
+    }
+    const unsigned int valid_items = end_offset - begin_offset;
+
+    key_type   keys[ItemsPerThread];
+    value_type values[ItemsPerThread];
+    block_load_direct_blocked(lane, keys_input + begin_offset, keys, valid_items);
+    if ROCPRIM_IF_CONSTEXPR(with_values)
+    {
+        block_load_direct_blocked(lane, values_input + begin_offset, values, valid_items);
+    }
+
+    segmented_merge_sort_warp_items<sort_type>(keys,
+                                               values,
+                                               storage[warp_id],
+                                               valid_items,
+                                               compare_function);
+
+    block_store_direct_blocked(lane, keys_output + begin_offset, keys, valid_items);
+    if ROCPRIM_IF_CONSTEXPR(with_values)
+    {
+        block_store_direct_blocked(lane, values_output + begin_offset, values, valid_items);
+    }
+}
+
+// Sorts each tile of a segment of size items by the block sort of merge sort.
+template<class BlockSort,
+         unsigned int ItemsPerTile,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void segmented_merge_sort_block_tiles(KeysInputIterator                 keys_input,
+                                      KeysOutputIterator                keys_output,
+                                      ValuesInputIterator               values_input,
+                                      ValuesOutputIterator              values_output,
+                                      const unsigned int                size,
+                                      BinaryFunction                    compare_function,
+                                      typename BlockSort::storage_type& storage)
+{
+    for(unsigned int offset = 0; offset < size; offset += ItemsPerTile)
+    {
+        const unsigned int valid_items = ::rocprim::min(size - offset, ItemsPerTile);
+        BlockSort().sort(valid_items,
+                         valid_items < ItemsPerTile,
+                         keys_input + offset,
+                         keys_output + offset,
+                         values_input + offset,
+                         values_output + offset,
+                         compare_function,
+                         storage);
+        // The shared memory of the tile is reused by the next one
+        ::rocprim::syncthreads();
+    }
+}
+
+// Merges the pairs of sorted runs of sorted_block_size items of a segment of size items, with
+// the tiles and partitions of the mergepath merge of merge sort.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void segmented_merge_sort_block_merge(KeysInputIterator    keys_input,
+                                      KeysOutputIterator   keys_output,
+                                      ValuesInputIterator  values_input,
+                                      ValuesOutputIterator values_output,
+                                      const unsigned int   size,
+                                      const unsigned int   sorted_block_size,
+                                      BinaryFunction       compare_function,
+                                      unsigned int (&partitions)[2])
+{
+    constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id   = block_thread_id<0>();
+    const unsigned int num_tiles = ceiling_div(size, items_per_tile);
+    for(unsigned int tile_id = 0; tile_id < num_tiles; ++tile_id)
+    {
+        if(flat_id < 2)
+        {
+            partitions[flat_id]
+                = block_merge_mergepath_partition<items_per_tile>(keys_input,
+                                                                  size,
+                                                                  tile_id + flat_id,
+                                                                  compare_function,
+                                                                  sorted_block_size);
+        }
+        ::rocprim::syncthreads();
+
+        block_merge_mergepath_tile<BlockSize, ItemsPerThread>(keys_input,
+                                                              keys_output,
+                                                              values_input,
+                                                              values_output,
+                                                              size,
+                                                              sorted_block_size,
+                                                              tile_id,
+                                                              compare_function,
+                                                              partitions[0],
+                                                              partitions[1]);
+        ::rocprim::syncthreads();
+    }
+}
+
+// Sorts one segment by each block: the tiles of the segment are sorted, then the sorted runs are
+// merged pairwise until the segment is sorted, alternating between the output and keys_tmp. The
+// tiles are sorted into the buffer that makes the last merge end in the output.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class SegmentIndexIterator,
+         class OffsetIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void segmented_merge_sort_block(
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    SegmentIndexIterator                                            segment_indices,
+    OffsetIterator                                                  begin_offsets,
+    OffsetIterator                                                  end_offsets,
+    BinaryFunction                                                  compare_function)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using sort_type  = block_sort_impl<key_type, value_type, BlockSize, ItemsPerThread>;
+
+    constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+
+    ROCPRIM_SHARED_MEMORY typename sort_type::storage_type storage;
+    ROCPRIM_SHARED_MEMORY unsigned int                     partitions[2];
+
+    const unsigned int segment_index = segment_indices[block_id<0>()];
+    const unsigned int begin_offset  = begin_offsets[segment_index];
+    const unsigned int end_offset    = end_offsets[segment_index];
+    if(end_offset <= begin_offset)
+    {
+        return;
+    }
+    const unsigned int size = end_offset - begin_offset;
+
+    unsigned int levels = 0;
+    for(unsigned int tiles = ceiling_div(size, items_per_tile); tiles > 1; tiles = (tiles + 1) / 2)
+    {
+        ++levels;
+    }
+
+    bool to_output = levels % 2 == 0;
+    if(to_output)
+    {
+        segmented_merge_sort_block_tiles<sort_type, items_per_tile>(keys_input + begin_offset,
+                                                                    keys_output + begin_offset,
+                                                                    values_input + begin_offset,
+                                                                    values_output + begin_offset,
+                                                                    size,
+                                                                    compare_function,
+                                                                    storage);
+    }
+    else
+    {
+        segmented_merge_sort_block_tiles<sort_type, items_per_tile>(keys_input + begin_offset,
+                                                                    keys_tmp + begin_offset,
+                                                                    values_input + begin_offset,
+                                                                    values_tmp + begin_offset,
+                                                                    size,
+                                                                    compare_function,
+                                                                    storage);
+    }
+
+    for(unsigned int level = 0; level < levels; ++level)
+    {
+        const unsigned int sorted_block_size = items_per_tile << level;
+        if(to_output)
+        {
+            segmented_merge_sort_block_merge<BlockSize, ItemsPerThread>(
+                keys_output + begin_offset,
+                keys_tmp + begin_offset,
+                values_output + begin_offset,
+                values_tmp + begin_offset,
+                size,
+                sorted_block_size,
+                compare_function,
+                partitions);
+        }
+        else
+        {
+            segmented_merge_sort_block_merge<BlockSize, ItemsPerThread>(
+                keys_tmp + begin_offset,
+                keys_output + begin_offset,
+                values_tmp + begin_offset,
+                values_output + begin_offset,
+                size,
+                sorted_block_size,
+                compare_function,
+                partitions);
+        }
+        to_output = !to_output;
+    }
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class SegmentIndexIterator,
+         class OffsetIterator,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void segmented_merge_sort_block_kernel(
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    SegmentIndexIterator                                            segment_indices,
+    OffsetIterator                                                  begin_offsets,
+    OffsetIterator                                                  end_offsets,
+    BinaryFunction                                                  compare_function)
+{
+    constexpr segmented_merge_sort_config_params params = device_params<Config>();
+    segmented_merge_sort_block<params.kernel_config.block_size,
+                               params.kernel_config.items_per_thread>(keys_input,
+                                                                      keys_tmp,
+                                                                      keys_output,
+                                                                      values_input,
+                                                                      values_tmp,
+                                                                      values_output,
+                                                                      segment_indices,
+                                                                      begin_offsets,
+                                                                      end_offsets,
+                                                                      compare_function);
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class SegmentIndexIterator,
+         class OffsetIterator,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().warp_sort_config.block_size_small)
+void segmented_merge_sort_small_kernel(KeysInputIterator    keys_input,
+                                       KeysOutputIterator   keys_output,
+                                       ValuesInputIterator  values_input,
+                                       ValuesOutputIterator values_output,
+                                       const unsigned int   num_segments,
+                                       SegmentIndexIterator segment_indices,
+                                       OffsetIterator       begin_offsets,
+                                       OffsetIterator       end_offsets,
+                                       BinaryFunction       compare_function)
+{
+    constexpr warp_sort_config_params params = device_params<Config>().warp_sort_config;
+    segmented_merge_sort_warp<params.block_size_small,
+                              params.logical_warp_size_small,
+                              params.items_per_thread_small>(keys_input,
+                                                             keys_output,
+                                                             values_input,
+                                                             values_output,
+                                                             num_segments,
+                                                             segment_indices,
+                                                             begin_offsets,
+                                                             end_offsets,
+                                                             compare_function);
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class SegmentIndexIterator,
+         class OffsetIterator,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().warp_sort_config.block_size_medium)
+void segmented_merge_sort_medium_kernel(KeysInputIterator    keys_input,
+                                        KeysOutputIterator   keys_output,
+                                        ValuesInputIterator  values_input,
+                                        ValuesOutputIterator values_output,
+                                        const unsigned int   num_segments,
+                                        SegmentIndexIterator segment_indices,
+                                        OffsetIterator       begin_offsets,
+                                        OffsetIterator       end_offsets,
+                                        BinaryFunction       compare_function)
+{
+    constexpr warp_sort_config_params params = device_params<Config>().warp_sort_config;
+    segmented_merge_sort_warp<params.block_size_medium,
+                              params.logical_warp_size_medium,
+                              params.items_per_thread_medium>(keys_input,
+                                                              keys_output,
+                                                              values_input,
+                                                              values_output,
+                                                              num_segments,
+                                                              segment_indices,
+                                                              begin_offsets,
+                                                              end_offsets,
+                                                              compare_function);
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_MERGE_SORT_HPP_
@@ -57,7 +57,8 @@ template<
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
     unsigned int RadixBits,
-    bool Descending
+    bool Descending,
+    class Decomposer = ::rocprim::identity_decomposer
 >
 class segmented_radix_sort_helper
 {
@@ -99,7 +100,8 @@ public:
               unsigned int bit,
               unsigned int begin_bit,
               unsigned int end_bit,
-              storage_type& storage)
+              storage_type& storage,
+              Decomposer decomposer = {})
     {
         // Handle cases when (end_bit - bit) is not divisible by radix_bits, i.e. the last
         // iteration has a shorter mask.
@@ -115,7 +117,8 @@ public:
                     keys_input, keys_output, values_input, values_output,
                     begin_offset, end_offset,
                     bit, current_radix_bits,
-                    storage
+                    storage,
+                    decomposer
                 );
             }
             else
@@ -124,7 +127,8 @@ public:
                     keys_input, keys_tmp, values_input, values_tmp,
                     begin_offset, end_offset,
                     bit, current_radix_bits,
-                    storage
+                    storage,
+                    decomposer
                 );
             }
         }
@@ -136,7 +140,8 @@ public:
                     keys_tmp, keys_output, values_tmp, values_output,
                     begin_offset, end_offset,
                     bit, current_radix_bits,
-                    storage
+                    storage,
+                    decomposer
                 );
             }
             else
@@ -145,7 +150,8 @@ public:
                     keys_output, keys_tmp, values_output, values_tmp,
                     begin_offset, end_offset,
                     bit, current_radix_bits,
-                    storage
+                    storage,
+                    decomposer
                 );
             }
         }
@@ -165,7 +171,8 @@ public:
               unsigned int bit,
               unsigned int begin_bit,
               unsigned int end_bit,
-              storage_type& storage)
+              storage_type& storage,
+              Decomposer decomposer = {})
     {
         // Handle cases when (end_bit - bit) is not divisible by radix_bits, i.e. the last
         // iteration has a shorter mask.
@@ -215,7 +222,8 @@ public:
             current_keys_input, current_keys_output, current_values_input, current_values_output,
             begin_offset, end_offset,
             bit, current_radix_bits,
-            storage
+            storage,
+            decomposer
         );
     }
 
@@ -236,7 +244,8 @@ private:
               unsigned int end_offset,
               unsigned int bit,
               unsigned int current_radix_bits,
-              storage_type& storage)
+              storage_type& storage,
+              Decomposer decomposer)
     {
         unsigned int digit_count;
         count_helper_type().count_digits(
@@ -244,7 +253,8 @@ private:
             begin_offset, end_offset,
             bit, current_radix_bits,
             storage.count_helper,
-            digit_count
+            digit_count,
+            decomposer
         );
 
         unsigned int digit_start;
@@ -258,7 +268,8 @@ private:
             begin_offset, end_offset,
             bit, current_radix_bits,
             digit_start,
-            storage.sort_and_scatter_helper
+            storage.sort_and_scatter_helper,
+            decomposer
         );
 
         ::rocprim::syncthreads();
@@ -270,7 +281,8 @@ template<
     class Value,
     unsigned int BlockSize,
     unsigned int ItemsPerThread,
-    bool Descending
+    bool Descending,
+    class Decomposer = ::rocprim::identity_decomposer
 >
 class segmented_radix_sort_single_block_helper
 {
@@ -310,7 +322,8 @@ public:
               unsigned int         end_offset,
               unsigned int         begin_bit,
               unsigned int         end_bit,
-              storage_type&        storage)
+              storage_type&        storage,
+              Decomposer           decomposer = {})
     {
         if(to_output)
         {
@@ -318,7 +331,8 @@ public:
                 keys_input, keys_output, values_input, values_output,
                 begin_offset, end_offset,
                 begin_bit, end_bit,
-                storage
+                storage,
+                decomposer
             );
         }
         else
@@ -327,7 +341,8 @@ public:
                 keys_input, keys_tmp, values_input, values_tmp,
                 begin_offset, end_offset,
                 begin_bit, end_bit,
-                storage
+                storage,
+                decomposer
             );
         }
     }
@@ -345,13 +360,15 @@ public:
               unsigned int  end_offset,
               unsigned int  begin_bit,
               unsigned int  end_bit,
-              storage_type& storage)
+              storage_type& storage,
+              Decomposer    decomposer = {})
     {
         sort(
             keys_input, (to_output ? keys_output : keys_tmp), values_input, (to_output ? values_output : values_tmp),
             begin_offset, end_offset,
             begin_bit, end_bit,
-            storage
+            storage,
+            decomposer
         );
     }
 
@@ -370,7 +387,8 @@ public:
               unsigned int end_offset,
               unsigned int begin_bit,
               unsigned int end_bit,
-              storage_type& storage)
+              storage_type& storage,
+              Decomposer    decomposer = {})
     {
         constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
 
@@ -379,7 +397,8 @@ public:
                                                        Value,
                                                        BlockSize,
                                                        ItemsPerThread / 2,
-                                                       Descending>;
+                                                       Descending,
+                                                       Decomposer>;
 
         // Segment is longer than supported by this function
         if(end_offset - begin_offset > items_per_block)
@@ -393,7 +412,8 @@ public:
                 keys_input, keys_output, values_input, values_output,
                 begin_offset, end_offset,
                 begin_bit, end_bit,
-                reinterpret_cast<typename shorter_single_block_helper::storage_type&>(storage)
+                reinterpret_cast<typename shorter_single_block_helper::storage_type&>(storage),
+                decomposer
             );
         if(processed_by_shorter)
         {
@@ -406,7 +426,7 @@ public:
         Value              values[ItemsPerThread];
         const unsigned int valid_count = end_offset - begin_offset;
         // Sort will leave "invalid" (out of size) items at the end of the sorted sequence
-        const Key out_of_bounds = key_codec::get_out_of_bounds_key();
+        const Key out_of_bounds = key_codec::get_out_of_bounds_key(decomposer);
         block_load_direct_warp_striped(flat_id,
                                        keys_input + begin_offset,
                                        keys,
@@ -425,7 +445,7 @@ public:
                                                  keys,
                                                  values,
                                                  storage.sort,
-                                                 identity_decomposer{},
+                                                 decomposer,
                                                  begin_bit,
                                                  end_bit);
 
@@ -450,9 +470,10 @@ template<
     class Key,
     class Value,
     unsigned int BlockSize,
-    bool Descending
+    bool Descending,
+    class Decomposer
 >
-class segmented_radix_sort_single_block_helper<Key, Value, BlockSize, 0, Descending>
+class segmented_radix_sort_single_block_helper<Key, Value, BlockSize, 0, Descending, Decomposer>
 {
 public:
 
@@ -473,7 +494,8 @@ public:
               unsigned int,
               unsigned int,
               unsigned int,
-              storage_type&)
+              storage_type&,
+              Decomposer)
     {
         // It can't sort anything because ItemsPerThread is 0.
         // The segment will be sorted by the calles (i.e. using ItemsPerThread = 1)
@@ -505,7 +527,13 @@ using select_warp_sort_helper_config_t
                          WarpSortHelperConfig<logical_warp_size, items_per_thread, block_size>,
                          DisabledWarpSortHelperConfig>;
 
-template<class Config, class Key, class Value, int BlockSize, bool Descending, class Enable = void>
+template<class Config,
+         class Key,
+         class Value,
+         int  BlockSize,
+         bool Descending,
+         class Decomposer = ::rocprim::identity_decomposer,
+         class Enable     = void>
 struct segmented_warp_sort_helper
 {
     static constexpr unsigned int items_per_warp = 0;
@@ -518,13 +546,14 @@ struct segmented_warp_sort_helper
     }
 };
 
-template<class Config, class Key, class Value, int BlockSize, bool Descending>
+template<class Config, class Key, class Value, int BlockSize, bool Descending, class Decomposer>
 class segmented_warp_sort_helper<
     Config,
     Key,
     Value,
     BlockSize,
     Descending,
+    Decomposer,
     std::enable_if_t<!std::is_same<DisabledWarpSortHelperConfig, Config>::value>>
 {
     static constexpr unsigned int logical_warp_size = Config::logical_warp_size;
@@ -581,26 +610,30 @@ private:
         sort_type().sort(keys, values, storage.sort, comparator);
     }
 
-    template<class K = Key>
+    template<class K = Key, class D = Decomposer>
     ROCPRIM_DEVICE
     auto invoke_warp_sort(Key (&keys)[items_per_thread],
                           Value (&values)[items_per_thread],
                           storage_type& storage,
                           unsigned int  begin_bit,
-                          unsigned int  end_bit) -> std::enable_if_t<!is_integral<K>::value>
+                          unsigned int  end_bit,
+                          D) -> std::enable_if_t<std::is_same<D, identity_decomposer>::value
+                                                 && !is_integral<K>::value>
     {
         (void)begin_bit;
         (void)end_bit;
         invoke_warp_sort(keys, values, storage, radix_comparator_type<false>{});
     }
 
-    template<class K = Key>
+    template<class K = Key, class D = Decomposer>
     ROCPRIM_DEVICE
     auto invoke_warp_sort(Key (&keys)[items_per_thread],
                           Value (&values)[items_per_thread],
                           storage_type& storage,
                           unsigned int  begin_bit,
-                          unsigned int  end_bit) -> std::enable_if_t<is_integral<K>::value>
+                          unsigned int  end_bit,
+                          D) -> std::enable_if_t<std::is_same<D, identity_decomposer>::value
+                                                 && is_integral<K>::value>
     {
         if(begin_bit == 0 && end_bit == 8 * sizeof(Key))
         {
@@ -613,6 +646,24 @@ private:
         }
     }
 
+    // Custom keys are compared by the bits of their decomposed elements.
+    template<class D = Decomposer>
+    ROCPRIM_DEVICE
+    auto invoke_warp_sort(Key (&keys)[items_per_thread],
+                          Value (&values)[items_per_thread],
+                          storage_type& storage,
+                          unsigned int  begin_bit,
+                          unsigned int  end_bit,
+                          D             decomposer)
+        -> std::enable_if_t<!std::is_same<D, identity_decomposer>::value>
+    {
+        ::rocprim::detail::radix_merge_compare<Descending, true, Key, Decomposer> comparator(
+            begin_bit,
+            end_bit - begin_bit,
+            decomposer);
+        invoke_warp_sort(keys, values, storage, comparator);
+    }
+
 public:
     template<
         class KeysInputIterator,
@@ -629,10 +680,11 @@ public:
               unsigned int end_offset,
               unsigned int begin_bit,
               unsigned int end_bit,
-              storage_type& storage)
+              storage_type& storage,
+              Decomposer decomposer = {})
     {
         const unsigned int num_items = end_offset - begin_offset;
-        const Key          out_of_bounds = key_codec::get_out_of_bounds_key();
+        const Key          out_of_bounds = key_codec::get_out_of_bounds_key(decomposer);
 
         Key   keys[items_per_thread];
         Value values[items_per_thread];
@@ -645,7 +697,7 @@ public:
         }
 
         ::rocprim::wave_barrier();
-        invoke_warp_sort(keys, values, storage, begin_bit, end_bit);
+        invoke_warp_sort(keys, values, storage, begin_bit, end_bit, decomposer);
 
         ::rocprim::wave_barrier();
         keys_store_type().store(keys_output + begin_offset, keys, num_items, storage.keys_store);
@@ -673,7 +725,8 @@ public:
               unsigned int         end_offset,
               unsigned int         begin_bit,
               unsigned int         end_bit,
-              storage_type&        storage)
+              storage_type&        storage,
+              Decomposer           decomposer = {})
     {
         if(to_output)
         {
@@ -681,7 +734,8 @@ public:
                 keys_input, keys_output, values_input, values_output,
                 begin_offset, end_offset,
                 begin_bit, end_bit,
-                storage
+                storage,
+                decomposer
             );
         }
         else
@@ -690,7 +744,8 @@ public:
                 keys_input, keys_tmp, values_input, values_tmp,
                 begin_offset, end_offset,
                 begin_bit, end_bit,
-                storage
+                storage,
+                decomposer
             );
         }
     }
@@ -703,7 +758,8 @@ template<
     class KeysOutputIterator,
     class ValuesInputIterator,
     class ValuesOutputIterator,
-    class OffsetIterator
+    class OffsetIterator,
+    class Decomposer
 >
 ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
 void segmented_sort(KeysInputIterator keys_input,
@@ -717,7 +773,8 @@ void segmented_sort(KeysInputIterator keys_input,
                     OffsetIterator end_offsets,
                     unsigned int iterations,
                     unsigned int begin_bit,
-                    unsigned int end_bit)
+                    unsigned int end_bit,
+                    Decomposer decomposer)
 {
     static constexpr segmented_radix_sort_config_params params = device_params<Config>();
 
@@ -733,7 +790,7 @@ void segmented_sort(KeysInputIterator keys_input,
     using single_block_helper_type = segmented_radix_sort_single_block_helper<
         key_type, value_type,
         block_size, items_per_thread,
-        Descending
+        Descending, Decomposer
     >;
     using long_radix_helper_type = segmented_radix_sort_helper<key_type,
                                                                value_type,
@@ -741,7 +798,8 @@ void segmented_sort(KeysInputIterator keys_input,
                                                                block_size,
                                                                items_per_thread,
                                                                long_radix_bits,
-                                                               Descending>;
+                                                               Descending,
+                                                               Decomposer>;
     using warp_sort_helper_type  = segmented_warp_sort_helper<
         select_warp_sort_helper_config_t<params.warp_sort_config.partitioning_allowed,
                                          params.warp_sort_config.logical_warp_size_small,
@@ -750,7 +808,8 @@ void segmented_sort(KeysInputIterator keys_input,
         key_type,
         value_type,
         block_size,
-        Descending>;
+        Descending,
+        Decomposer>;
 
     static constexpr unsigned int items_per_warp = warp_sort_helper_type::items_per_warp;
 
@@ -782,7 +841,8 @@ void segmented_sort(KeysInputIterator keys_input,
                 to_output,
                 begin_offset, end_offset,
                 bit, begin_bit, end_bit,
-                storage.long_radix_helper
+                storage.long_radix_helper,
+                decomposer
             );
 
             to_output = !to_output;
@@ -802,7 +862,8 @@ void segmented_sort(KeysInputIterator keys_input,
                                         end_offset,
                                         begin_bit,
                                         end_bit,
-                                        storage.single_block_helper);
+                                        storage.single_block_helper,
+                                        decomposer);
     }
     else if(::rocprim::flat_block_thread_id() < params.warp_sort_config.logical_warp_size_small)
     {
@@ -818,7 +879,8 @@ void segmented_sort(KeysInputIterator keys_input,
                                      end_offset,
                                      begin_bit,
                                      end_bit,
-                                     storage.warp_sort_helper);
+                                     storage.warp_sort_helper,
+                                     decomposer);
     }
 }
 
@@ -830,7 +892,8 @@ template<
     class ValuesInputIterator,
     class ValuesOutputIterator,
     class SegmentIndexIterator,
-    class OffsetIterator
+    class OffsetIterator,
+    class Decomposer
 >
 ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
 void segmented_sort_large(KeysInputIterator keys_input,
@@ -845,7 +908,8 @@ void segmented_sort_large(KeysInputIterator keys_input,
                           OffsetIterator end_offsets,
                           unsigned int iterations,
                           unsigned int begin_bit,
-                          unsigned int end_bit)
+                          unsigned int end_bit,
+                          Decomposer decomposer)
 {
     static constexpr segmented_radix_sort_config_params params = device_params<Config>();
 
@@ -860,7 +924,7 @@ void segmented_sort_large(KeysInputIterator keys_input,
     using single_block_helper_type = segmented_radix_sort_single_block_helper<
         key_type, value_type,
         block_size, items_per_thread,
-        Descending
+        Descending, Decomposer
     >;
     using long_radix_helper_type = segmented_radix_sort_helper<key_type,
                                                                value_type,
@@ -868,7 +932,8 @@ void segmented_sort_large(KeysInputIterator keys_input,
                                                                block_size,
                                                                items_per_thread,
                                                                long_radix_bits,
-                                                               Descending>;
+                                                               Descending,
+                                                               Decomposer>;
 
     ROCPRIM_SHARED_MEMORY union
     {
@@ -895,7 +960,8 @@ void segmented_sort_large(KeysInputIterator keys_input,
                 to_output,
                 begin_offset, end_offset,
                 bit, begin_bit, end_bit,
-                storage.long_radix_helper
+                storage.long_radix_helper,
+                decomposer
             );
 
             to_output = !to_output;
@@ -914,7 +980,8 @@ void segmented_sort_large(KeysInputIterator keys_input,
                                         end_offset,
                                         begin_bit,
                                         end_bit,
-                                        storage.single_block_helper);
+                                        storage.single_block_helper,
+                                        decomposer);
     }
 }
 
@@ -926,7 +993,8 @@ template<
     class ValuesInputIterator,
     class ValuesOutputIterator,
     class SegmentIndexIterator,
-    class OffsetIterator
+    class OffsetIterator,
+    class Decomposer
 >
 ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
 void segmented_sort_small(KeysInputIterator keys_input,
@@ -941,7 +1009,8 @@ void segmented_sort_small(KeysInputIterator keys_input,
                           OffsetIterator begin_offsets,
                           OffsetIterator end_offsets,
                           unsigned int begin_bit,
-                          unsigned int end_bit)
+                          unsigned int end_bit,
+                          Decomposer decomposer)
 {
     static constexpr segmented_radix_sort_config_params params = device_params<Config>();
 
@@ -963,7 +1032,8 @@ void segmented_sort_small(KeysInputIterator keys_input,
         key_type,
         value_type,
         block_size,
-        Descending>;
+        Descending,
+        Decomposer>;
 
     ROCPRIM_SHARED_MEMORY typename warp_sort_helper_type::storage_type storage;
 
@@ -995,7 +1065,8 @@ void segmented_sort_small(KeysInputIterator keys_input,
                                  end_offset,
                                  begin_bit,
                                  end_bit,
-                                 storage);
+                                 storage,
+                                 decomposer);
 }
 
 template<class Config,
@@ -1005,7 +1076,8 @@ template<class Config,
          class ValuesInputIterator,
          class ValuesOutputIterator,
          class SegmentIndexIterator,
-         class OffsetIterator>
+         class OffsetIterator,
+         class Decomposer>
 ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void segmented_sort_medium(
     KeysInputIterator                                               keys_input,
     typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
@@ -1019,7 +1091,8 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void segmented_sort_medium(
     OffsetIterator                                                  begin_offsets,
     OffsetIterator                                                  end_offsets,
     unsigned int                                                    begin_bit,
-    unsigned int                                                    end_bit)
+    unsigned int                                                    end_bit,
+    Decomposer                                                      decomposer)
 {
     static constexpr segmented_radix_sort_config_params params = device_params<Config>();
 
@@ -1041,7 +1114,8 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void segmented_sort_medium(
         key_type,
         value_type,
         block_size,
-        Descending>;
+        Descending,
+        Decomposer>;
 
     ROCPRIM_SHARED_MEMORY typename warp_sort_helper_type::storage_type storage;
 
@@ -1065,7 +1139,7 @@ ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void segmented_sort_medium(
         keys_input, keys_tmp, keys_output,
         values_input, values_tmp, values_output,
         to_output, begin_offset, end_offset,
-        begin_bit, end_bit, storage
+        begin_bit, end_bit, storage, decomposer
     );
 }
 
@@ -32,6 +32,10 @@
 
 #include "../../block/block_load_func.hpp"
 #include "../../block/block_reduce.hpp"
+#include "../../block/block_scan.hpp"
+#include "../../detail/merge_path.hpp"
+#include "../../functional.hpp"
+#include "../../iterator/counting_iterator.hpp"
 #include "../config_types.hpp"
 #include "../device_reduce_config.hpp"
 
@@ -40,23 +44,23 @@ BEGIN_ROCPRIM_NAMESPACE
 namespace detail
 {
 
-template<
-    class Config,
-    class InputIterator,
-    class OutputIterator,
-    class OffsetIterator,
-    class ResultType,
-    class BinaryFunction
->
+// Reduces input[begin_offset, end_offset) into output[segment_id] with the calling block.
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class OffsetType,
+         class ResultType,
+         class BinaryFunction>
 ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
-void segmented_reduce(InputIterator input,
-                      OutputIterator output,
-                      OffsetIterator begin_offsets,
-                      OffsetIterator end_offsets,
-                      BinaryFunction reduce_op,
-                      ResultType initial_value)
+void segmented_reduce_segment(InputIterator      input,
+                              OutputIterator     output,
+                              const unsigned int segment_id,
+                              const OffsetType   begin_offset,
+                              const OffsetType   end_offset,
+                              BinaryFunction     reduce_op,
+                              ResultType         initial_value)
 {
-    using offset_type = typename std::iterator_traits<OffsetIterator>::value_type;
+    using offset_type = OffsetType;
 
     static constexpr reduce_config_params params = device_params<Config>();
 
@@ -69,10 +73,6 @@ void segmented_reduce(InputIterator input,
     ROCPRIM_SHARED_MEMORY typename reduce_type::storage_type reduce_storage;
 
     const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
-    const unsigned int segment_id = ::rocprim::detail::block_id<0>();
-
-    const offset_type begin_offset = begin_offsets[segment_id];
-    const offset_type end_offset   = end_offsets[segment_id];
 
     // Empty segment
     if(end_offset <= begin_offset)
@@ -166,6 +166,284 @@ void segmented_reduce(InputIterator input,
     }
 }
 
+template<
+    class Config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class ResultType,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_reduce(InputIterator input,
+                      OutputIterator output,
+                      OffsetIterator begin_offsets,
+                      OffsetIterator end_offsets,
+                      BinaryFunction reduce_op,
+                      ResultType initial_value)
+{
+    using offset_type = typename std::iterator_traits<OffsetIterator>::value_type;
+
+    const unsigned int segment_id = ::rocprim::detail::block_id<0>();
+
+    const offset_type begin_offset = begin_offsets[segment_id];
+    const offset_type end_offset   = end_offsets[segment_id];
+
+    segmented_reduce_segment<Config>(input,
+                                     output,
+                                     segment_id,
+                                     begin_offset,
+                                     end_offset,
+                                     reduce_op,
+                                     initial_value);
+}
+
+// Partial result of the load-balanced segmented reduction of a range of the merge path:
+// whether the range contains a segment end, and the reduction of the values after the last one.
+template<class T>
+struct segmented_reduce_balanced_carry
+{
+    bool closes;
+    bool valid;
+    T    value;
+};
+
+// Combines the partial results of consecutive ranges of the merge path
+template<class T, class BinaryFunction>
+struct segmented_reduce_balanced_carry_op
+{
+    BinaryFunction reduce_op;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE segmented_reduce_balanced_carry<T>
+        operator()(const segmented_reduce_balanced_carry<T>& a,
+                   const segmented_reduce_balanced_carry<T>& b) const
+    {
+        segmented_reduce_balanced_carry<T> result;
+        result.closes = a.closes || b.closes;
+        if(b.closes || !a.valid)
+        {
+            result.valid = b.valid;
+            result.value = b.value;
+        }
+        else if(!b.valid)
+        {
+            result.valid = a.valid;
+            result.value = a.value;
+        }
+        else
+        {
+            result.valid = true;
+            result.value = reduce_op(a.value, b.value);
+        }
+        return result;
+    }
+};
+
+// Reduces one tile of the load-balanced segmented reduction.
+//
+// The work is the merge path of the segment ends (offsets[1..segments]) and the input indices
+// [0, size), so every tile has the same number of values and segment ends regardless of segment
+// lengths. Each thread reduces ItemsPerThread consecutive merge path items, a block scan passes
+// the values of segments that continue from thread to thread. Segments which end in the tile are
+// written to output, except for a segment that starts in an earlier tile: its partial result is
+// written to tile_heads and the values from earlier tiles to the tile carry-out, to be combined by
+// segmented_reduce_balanced_fixup.
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class OffsetIterator,
+         class ResultType,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_reduce_balanced_tile(InputIterator      input,
+                                    OutputIterator     output,
+                                    const size_t       size,
+                                    const unsigned int segments,
+                                    OffsetIterator     offsets,
+                                    unsigned int*      tile_carry_segments,
+                                    ResultType*        tile_carry_values,
+                                    ResultType*        tile_heads,
+                                    bool*              tile_head_valid,
+                                    BinaryFunction     reduce_op,
+                                    ResultType         initial_value)
+{
+    static constexpr reduce_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.reduce_config.block_size;
+    constexpr unsigned int items_per_thread = params.reduce_config.items_per_thread;
+    constexpr unsigned int items_per_tile   = block_size * items_per_thread;
+
+    using carry_type    = segmented_reduce_balanced_carry<ResultType>;
+    using carry_op_type = segmented_reduce_balanced_carry_op<ResultType, BinaryFunction>;
+    using scan_type     = ::rocprim::block_scan<carry_type, block_size>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename scan_type::storage_type scan;
+        size_t                           tile_item_begin;
+        unsigned int                     tile_end_segment;
+    } storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int tile_id = ::rocprim::detail::block_id<0>();
+
+    const size_t total      = size + segments;
+    const size_t tile_begin = size_t(tile_id) * items_per_tile;
+    const size_t tile_end   = ::rocprim::min(tile_begin + items_per_tile, total);
+
+    // A segment end comes before the input index equal to it
+    const auto                              segment_ends = offsets + 1;
+    const ::rocprim::counting_iterator<size_t> indices(0);
+    const ::rocprim::less<size_t>           compare;
+
+    if(flat_id == 0)
+    {
+        storage.tile_item_begin
+            = tile_begin
+              - merge_path(segment_ends, indices, size_t(segments), size, tile_begin, compare);
+        storage.tile_end_segment = static_cast<unsigned int>(
+            merge_path(segment_ends, indices, size_t(segments), size, tile_end, compare));
+    }
+
+    const size_t thread_begin
+        = ::rocprim::min(tile_begin + size_t(flat_id) * items_per_thread, tile_end);
+    const size_t thread_end = ::rocprim::min(thread_begin + items_per_thread, tile_end);
+
+    size_t segment
+        = merge_path(segment_ends, indices, size_t(segments), size, thread_begin, compare);
+    size_t item          = thread_begin - segment;
+    size_t segment_begin = segment < segments ? static_cast<size_t>(offsets[segment]) : size;
+    size_t segment_end   = segment < segments ? static_cast<size_t>(offsets[segment + 1]) : size;
+
+    carry_type carry;
+    carry.closes = false;
+    carry.valid  = false;
+
+    // The first segment ending in this thread may continue from previous threads
+    bool         head_valid = false;
+    ResultType   head;
+    unsigned int head_segment = 0;
+    size_t       head_begin   = 0;
+
+    for(size_t step = thread_begin; step < thread_end; step++)
+    {
+        if(segment < segments && segment_end <= item)
+        {
+            if(!carry.closes)
+            {
+                carry.closes = true;
+                head_valid   = carry.valid;
+                head         = carry.value;
+                head_segment = static_cast<unsigned int>(segment);
+                head_begin   = segment_begin;
+            }
+            else
+            {
+                output[segment]
+                    = carry.valid ? reduce_op(initial_value, carry.value) : initial_value;
+            }
+            carry.valid = false;
+            segment++;
+            segment_begin = segment_end;
+            if(segment < segments)
+            {
+                segment_end = static_cast<size_t>(offsets[segment + 1]);
+            }
+        }
+        else
+        {
+            // Values before the first segment and after the last one are skipped
+            if(segment < segments && item >= segment_begin)
+            {
+                const ResultType value = input[item];
+                carry.value            = carry.valid ? reduce_op(carry.value, value) : value;
+                carry.valid            = true;
+            }
+            item++;
+        }
+    }
+    ::rocprim::syncthreads();
+
+    carry_type empty;
+    empty.closes = false;
+    empty.valid  = false;
+
+    carry_type prefix;
+    carry_type reduction;
+    scan_type().exclusive_scan(carry,
+                               prefix,
+                               empty,
+                               reduction,
+                               storage.scan,
+                               carry_op_type{reduce_op});
+
+    if(carry.closes)
+    {
+        bool       valid = head_valid;
+        ResultType value = head;
+        if(prefix.valid)
+        {
+            value = valid ? reduce_op(prefix.value, head) : prefix.value;
+            valid = true;
+        }
+        if(head_begin >= storage.tile_item_begin)
+        {
+            output[head_segment] = valid ? reduce_op(initial_value, value) : initial_value;
+        }
+        else
+        {
+            tile_heads[tile_id]      = value;
+            tile_head_valid[tile_id] = valid;
+        }
+    }
+
+    if(flat_id == 0)
+    {
+        // An invalid segment marks tiles without carry-out
+        tile_carry_segments[tile_id] = reduction.valid ? storage.tile_end_segment : segments;
+        tile_carry_values[tile_id]   = reduction.value;
+    }
+}
+
+// Writes segments which span tiles: the carry-outs of the tiles before the tile where a segment
+// ends were reduced by key, and are combined with the segment's partial result from that tile.
+template<unsigned int BlockSize,
+         class OutputIterator,
+         class OffsetIterator,
+         class ResultType,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_reduce_balanced_fixup(OutputIterator      output,
+                                     const unsigned int  segments,
+                                     OffsetIterator      offsets,
+                                     const unsigned int* carry_segments,
+                                     const ResultType*   carry_values,
+                                     const size_t*       carry_count,
+                                     const ResultType*   tile_heads,
+                                     const bool*         tile_head_valid,
+                                     const unsigned int  items_per_tile,
+                                     BinaryFunction      reduce_op,
+                                     ResultType          initial_value)
+{
+    const unsigned int index
+        = ::rocprim::detail::block_id<0>() * BlockSize + ::rocprim::detail::block_thread_id<0>();
+    if(index >= *carry_count)
+    {
+        return;
+    }
+
+    const unsigned int segment = carry_segments[index];
+    if(segment >= segments)
+    {
+        return;
+    }
+
+    const ResultType carry = reduce_op(initial_value, carry_values[index]);
+    // The end of the segment is the merge path item after all previous segment ends and values
+    const size_t tile = (segment + static_cast<size_t>(offsets[segment + 1])) / items_per_tile;
+    output[segment]   = tile_head_valid[tile] ? reduce_op(carry, tile_heads[tile]) : carry;
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
@@ -109,23 +109,22 @@ auto segmented_scan_block_scan(T (&input)[ItemsPerThread],
         );
 }
 
-template<
-    bool Exclusive,
-    class Config,
-    class ResultType,
-    class InputIterator,
-    class OutputIterator,
-    class OffsetIterator,
-    class InitValueType,
-    class BinaryFunction
->
+// Scans input[begin_offset, end_offset) into output[begin_offset, end_offset) with the
+// calling block.
+template<bool Exclusive,
+         class Config,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction>
 ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
-void segmented_scan(InputIterator input,
-                    OutputIterator output,
-                    OffsetIterator begin_offsets,
-                    OffsetIterator end_offsets,
-                    InitValueType initial_value,
-                    BinaryFunction scan_op)
+void segmented_scan_segment(InputIterator      input,
+                            OutputIterator     output,
+                            const unsigned int begin_offset,
+                            const unsigned int end_offset,
+                            InitValueType      initial_value,
+                            BinaryFunction     scan_op)
 {
     static constexpr scan_config_params params = device_params<Config>();
 
@@ -148,10 +147,6 @@ void segmented_scan(InputIterator input,
         typename block_scan_type::storage_type scan;
     } storage;
 
-    const unsigned int segment_id = ::rocprim::detail::block_id<0>();
-    const unsigned int begin_offset = begin_offsets[segment_id];
-    const unsigned int end_offset = end_offsets[segment_id];
-
     // Empty segment
     if(end_offset <= begin_offset)
     {
@@ -225,6 +220,36 @@ void segmented_scan(InputIterator input,
     }
 }
 
+template<
+    bool Exclusive,
+    class Config,
+    class ResultType,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class InitValueType,
+    class BinaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void segmented_scan(InputIterator input,
+                    OutputIterator output,
+                    OffsetIterator begin_offsets,
+                    OffsetIterator end_offsets,
+                    InitValueType initial_value,
+                    BinaryFunction scan_op)
+{
+    const unsigned int segment_id = ::rocprim::detail::block_id<0>();
+    const unsigned int begin_offset = begin_offsets[segment_id];
+    const unsigned int end_offset = end_offsets[segment_id];
+
+    segmented_scan_segment<Exclusive, Config, ResultType>(input,
+                                                          output,
+                                                          begin_offset,
+                                                          end_offset,
+                                                          initial_value,
+                                                          scan_op);
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
@@ -0,0 +1,148 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_SELECT_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_SELECT_HPP_
+
+#include <iterator>
+#include <type_traits>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../block/block_scan.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Compacts the segment of the calling block to output + output_offsets[segment] tile by tile,
+// and stores the number of its selected items to selected_counts[segment]. With Partition the
+// rejected items follow the selected ones in reverse order, with CountOnly only the number of
+// selected items is stored.
+template<bool         Partition,
+         bool         CountOnly,
+         unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator,
+         class OffsetIterator,
+         class OutputOffsetIterator,
+         class UnaryPredicate>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE void
+    segmented_select_segment(InputIterator               input,
+                             OutputIterator              output,
+                             SelectedCountOutputIterator selected_counts,
+                             OffsetIterator              begin_offsets,
+                             OffsetIterator              end_offsets,
+                             OutputOffsetIterator        output_offsets,
+                             UnaryPredicate              predicate)
+{
+    using value_type      = typename std::iterator_traits<InputIterator>::value_type;
+    using block_scan_type = ::rocprim::block_scan<unsigned int, BlockSize>;
+
+    constexpr unsigned int items_per_tile = BlockSize * ItemsPerThread;
+
+    ROCPRIM_SHARED_MEMORY typename block_scan_type::storage_type storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int segment = ::rocprim::detail::block_id<0>();
+
+    const auto   begin_offset = begin_offsets[segment];
+    const auto   end_offset   = end_offsets[segment];
+    const size_t segment_size
+        = end_offset > begin_offset ? static_cast<size_t>(end_offset - begin_offset) : 0;
+    const size_t output_offset = CountOnly ? 0 : static_cast<size_t>(output_offsets[segment]);
+
+    size_t selected_before = 0;
+    for(size_t tile_offset = 0; tile_offset < segment_size; tile_offset += items_per_tile)
+    {
+        const unsigned int valid = static_cast<unsigned int>(
+            ::rocprim::min<size_t>(segment_size - tile_offset, items_per_tile));
+
+        value_type   values[ItemsPerThread];
+        bool         flags[ItemsPerThread];
+        unsigned int thread_selected = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int item = flat_id * ItemsPerThread + i;
+            flags[i]                = false;
+            if(item < valid)
+            {
+                values[i] = input[begin_offset + tile_offset + item];
+                flags[i]  = static_cast<bool>(predicate(values[i]));
+            }
+            thread_selected += flags[i] ? 1 : 0;
+        }
+
+        unsigned int thread_prefix;
+        unsigned int tile_selected;
+        block_scan_type().exclusive_scan(thread_selected,
+                                         thread_prefix,
+                                         0u,
+                                         tile_selected,
+                                         storage,
+                                         ::rocprim::plus<unsigned int>());
+
+        if ROCPRIM_IF_CONSTEXPR(!CountOnly)
+        {
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
+            {
+                const unsigned int item = flat_id * ItemsPerThread + i;
+                if(item >= valid)
+                {
+                    continue;
+                }
+                const size_t selected_rank = selected_before + thread_prefix;
+                if(flags[i])
+                {
+                    output[output_offset + selected_rank] = values[i];
+                    thread_prefix++;
+                }
+                else if(Partition)
+                {
+                    const size_t rejected_rank = tile_offset + item - selected_rank;
+                    output[output_offset + segment_size - 1 - rejected_rank] = values[i];
+                }
+            }
+        }
+
+        selected_before += tile_selected;
+        // The scan storage is reused by the next tile
+        ::rocprim::syncthreads();
+    }
+
+    if(flat_id == 0)
+    {
+        selected_counts[segment] = selected_before;
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SEGMENTED_SELECT_HPP_
@@ -0,0 +1,180 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SELECT_UNORDERED_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SELECT_UNORDERED_HPP_
+
+#include "../../block/block_load.hpp"
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+
+#include "device_config_helper.hpp"
+
+#include <iterator>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Flags the items selected by a predicate.
+template<class UnaryPredicate>
+struct select_unordered_predicate_op
+{
+    template<class T>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const T& item, size_t /*index*/)
+    {
+        return predicate(item);
+    }
+
+    UnaryPredicate predicate;
+};
+
+// Flags the first item of every run of equal items. The preceding item is read from the input
+// again, as the tiles do not depend on each other.
+template<class InputIterator, class EqualityOp>
+struct select_unordered_unique_op
+{
+    template<class T>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool operator()(const T& item, const size_t index)
+    {
+        return index == 0 || !equality_op(input[index - 1], item);
+    }
+
+    InputIterator input;
+    EqualityOp    equality_op;
+};
+
+// Selects the items of a tile without a scan over the tile or a look-back over the preceding
+// tiles. The selected items of a warp are counted with a ballot per item, and the first lane
+// reserves space for all of them in the output with a single atomic. Warps without selected
+// items only evaluate the flags, which makes very sparse selections about as fast as reading
+// the input. If WriteRejected is set, the rejected items are written from the end of the
+// output, with a second counter, like in partition.
+template<class Config,
+         bool WriteRejected,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCount,
+         class FlagOp>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void select_unordered_kernel(InputIterator  input,
+                             const size_t   launch_offset,
+                             const size_t   size,
+                             OutputIterator output,
+                             SelectedCount* counters,
+                             FlagOp         flag_op)
+{
+    constexpr partition_config_params params           = device_params<Config>();
+    constexpr unsigned int            block_size       = params.kernel_config.block_size;
+    constexpr unsigned int            items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int            items_per_block  = block_size * items_per_thread;
+
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    const unsigned int flat_id = block_thread_id<0>();
+    const size_t       block_offset
+        = launch_offset + static_cast<size_t>(block_id<0>()) * items_per_block;
+    const unsigned int valid_count
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    input_type items[items_per_thread];
+    block_load_direct_striped<block_size>(flat_id, input + block_offset, items, valid_count);
+
+    bool           flags[items_per_thread];
+    lane_mask_type masks[items_per_thread];
+    unsigned int   warp_count = 0;
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const unsigned int rank = i * block_size + flat_id;
+        flags[i] = rank < valid_count && flag_op(items[i], block_offset + rank);
+        masks[i] = ::rocprim::ballot(flags[i]);
+        warp_count += ::rocprim::bit_count(masks[i]);
+    }
+
+    // The count is uniform in the warp, so whole warps skip the reservation and the stores.
+    if(warp_count != 0)
+    {
+        SelectedCount warp_offset{};
+        if(::rocprim::lane_id() == 0)
+        {
+            warp_offset = atomic_add(&counters[0], static_cast<SelectedCount>(warp_count));
+        }
+        warp_offset = ::rocprim::warp_shuffle(warp_offset, 0);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; ++i)
+        {
+            if(flags[i])
+            {
+                output[warp_offset + ::rocprim::masked_bit_count(masks[i])] = items[i];
+            }
+            warp_offset += ::rocprim::bit_count(masks[i]);
+        }
+    }
+
+    if ROCPRIM_IF_CONSTEXPR(WriteRejected)
+    {
+        unsigned int rejected_count = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; ++i)
+        {
+            masks[i] = ::rocprim::ballot(!flags[i] && i * block_size + flat_id < valid_count);
+            rejected_count += ::rocprim::bit_count(masks[i]);
+        }
+        if(rejected_count == 0)
+        {
+            return;
+        }
+
+        SelectedCount warp_offset{};
+        if(::rocprim::lane_id() == 0)
+        {
+            warp_offset = atomic_add(&counters[1], static_cast<SelectedCount>(rejected_count));
+        }
+        warp_offset = ::rocprim::warp_shuffle(warp_offset, 0);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; ++i)
+        {
+            if(!flags[i] && i * block_size + flat_id < valid_count)
+            {
+                output[size - 1 - (warp_offset + ::rocprim::masked_bit_count(masks[i]))]
+                    = items[i];
+            }
+            warp_offset += ::rocprim::bit_count(masks[i]);
+        }
+    }
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SELECT_UNORDERED_HPP_
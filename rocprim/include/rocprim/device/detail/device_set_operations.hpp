@@ -0,0 +1,304 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SET_OPERATIONS_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SET_OPERATIONS_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types.hpp"
+
+#include "../../block/block_merge.hpp"
+#include "../../block/block_reduce.hpp"
+#include "../../block/block_scan.hpp"
+#include "../../iterator/counting_iterator.hpp"
+
+#include "device_binary_search.hpp"
+
+#include <iterator>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+enum class set_operation
+{
+    set_union,
+    set_intersection,
+    set_difference,
+    set_symmetric_difference
+};
+
+// Returns whether the key at index of the first (if from_first) or the second sequence is part of
+// the output. Like the standard set operations, the sequences are multisets: if the key is the
+// r-th one of its value in its sequence and the other sequence has cnt keys of that value,
+// intersection keeps the first min(m, cnt) keys of the first sequence, and the other operations
+// keep the keys with r >= cnt (union keeps all keys of the first sequence). The result does not
+// depend on the tile of the key, so the counting and the scattering of a tile agree.
+template<set_operation Operation,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class Key,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+bool set_operation_keep(const bool         from_first,
+                        const unsigned int index,
+                        const Key&         key,
+                        KeysInputIterator1 keys_input1,
+                        KeysInputIterator2 keys_input2,
+                        const unsigned int input1_size,
+                        const unsigned int input2_size,
+                        BinaryFunction     compare_function)
+{
+    if(from_first && Operation == set_operation::set_union)
+    {
+        return true;
+    }
+    if(!from_first
+       && (Operation == set_operation::set_intersection
+           || Operation == set_operation::set_difference))
+    {
+        return false;
+    }
+
+    unsigned int rank;
+    unsigned int count;
+    if(from_first)
+    {
+        rank  = index - lower_bound_n(keys_input1, index, key, compare_function);
+        count = upper_bound_n(keys_input2, input2_size, key, compare_function)
+                - lower_bound_n(keys_input2, input2_size, key, compare_function);
+    }
+    else
+    {
+        rank  = index - lower_bound_n(keys_input2, index, key, compare_function);
+        count = upper_bound_n(keys_input1, input1_size, key, compare_function)
+                - lower_bound_n(keys_input1, input1_size, key, compare_function);
+    }
+    return Operation == set_operation::set_intersection ? rank < count : rank >= count;
+}
+
+// Counts the output keys of the tiles. The merge path of a tile only decides which keys of
+// the inputs belong to it, their order does not matter for the count.
+template<set_operation Operation,
+         unsigned int  BlockSize,
+         unsigned int  ItemsPerThread,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void set_operation_count_kernel_impl(const unsigned int* index,
+                                     KeysInputIterator1  keys_input1,
+                                     KeysInputIterator2  keys_input2,
+                                     size_t*             tile_counts,
+                                     const unsigned int  input1_size,
+                                     const unsigned int  input2_size,
+                                     const unsigned int  partitions,
+                                     BinaryFunction      compare_function)
+{
+    using block_reduce_type = block_reduce<unsigned int, BlockSize>;
+
+    ROCPRIM_SHARED_MEMORY typename block_reduce_type::storage_type storage;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id       = block_thread_id<0>();
+    const unsigned int flat_block_id = block_id<0>();
+
+    const unsigned int diag1  = flat_block_id * items_per_block;
+    const unsigned int diag2  = min(input1_size + input2_size, diag1 + items_per_block);
+    const unsigned int begin1 = index[flat_block_id];
+    const unsigned int end1   = index[flat_block_id + 1];
+    const unsigned int begin2 = diag1 - begin1;
+    const unsigned int size1  = end1 - begin1;
+    const unsigned int count  = diag2 - diag1;
+
+    unsigned int thread_count = 0;
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        const unsigned int item = i * BlockSize + flat_id;
+        if(item < count)
+        {
+            const bool         from_first  = item < size1;
+            const unsigned int input_index = from_first ? begin1 + item : begin2 + item - size1;
+            const bool         keep
+                = from_first ? set_operation_keep<Operation>(true,
+                                                             input_index,
+                                                             keys_input1[input_index],
+                                                             keys_input1,
+                                                             keys_input2,
+                                                             input1_size,
+                                                             input2_size,
+                                                             compare_function)
+                             : set_operation_keep<Operation>(false,
+                                                             input_index,
+                                                             keys_input2[input_index],
+                                                             keys_input1,
+                                                             keys_input2,
+                                                             input1_size,
+                                                             input2_size,
+                                                             compare_function);
+            thread_count += keep ? 1 : 0;
+        }
+    }
+
+    unsigned int tile_count;
+    block_reduce_type().reduce(thread_count, tile_count, storage);
+    if(flat_id == 0)
+    {
+        tile_counts[flat_block_id] = tile_count;
+        // The exclusive scan of the counts also produces the total count
+        if(flat_block_id == partitions - 1)
+        {
+            tile_counts[partitions] = 0;
+        }
+    }
+}
+
+// Merges the keys of a tile and writes the kept ones, in merged order, at the offset of the tile.
+template<set_operation Operation,
+         unsigned int  BlockSize,
+         unsigned int  ItemsPerThread,
+         bool          WithValues,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class ValuesInputIterator1,
+         class ValuesInputIterator2,
+         class ValuesOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void set_operation_scatter_kernel_impl(const unsigned int*  index,
+                                       KeysInputIterator1   keys_input1,
+                                       KeysInputIterator2   keys_input2,
+                                       KeysOutputIterator   keys_output,
+                                       ValuesInputIterator1 values_input1,
+                                       ValuesInputIterator2 values_input2,
+                                       ValuesOutputIterator values_output,
+                                       OutputCountIterator  count_output,
+                                       const size_t*        tile_offsets,
+                                       const unsigned int   input1_size,
+                                       const unsigned int   input2_size,
+                                       const unsigned int   partitions,
+                                       BinaryFunction       compare_function)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator1>::value_type;
+
+    using block_merge_type = block_merge<key_type, BlockSize, ItemsPerThread, unsigned int>;
+    using block_scan_type  = block_scan<unsigned int, BlockSize>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_merge_type::storage_type merge;
+        typename block_scan_type::storage_type  scan;
+    } storage;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_id       = block_thread_id<0>();
+    const unsigned int flat_block_id = block_id<0>();
+
+    const unsigned int diag1  = flat_block_id * items_per_block;
+    const unsigned int diag2  = min(input1_size + input2_size, diag1 + items_per_block);
+    const unsigned int begin1 = index[flat_block_id];
+    const unsigned int end1   = index[flat_block_id + 1];
+    const unsigned int begin2 = diag1 - begin1;
+    const unsigned int size1  = end1 - begin1;
+    const unsigned int count  = diag2 - diag1;
+
+    if(flat_block_id == 0 && flat_id == 0)
+    {
+        *count_output = tile_offsets[partitions];
+    }
+
+    // The values of the merge are the positions of the keys in the tile, so that the source of
+    // every merged key is known.
+    key_type     keys[ItemsPerThread];
+    unsigned int sources[ItemsPerThread];
+    block_merge_type().merge_ranges(keys_input1 + begin1,
+                                    ::rocprim::counting_iterator<unsigned int>(0),
+                                    size1,
+                                    keys_input2 + begin2,
+                                    ::rocprim::counting_iterator<unsigned int>(size1),
+                                    count - size1,
+                                    keys,
+                                    sources,
+                                    storage.merge,
+                                    compare_function);
+
+    bool         from_first[ItemsPerThread];
+    bool         keep[ItemsPerThread];
+    unsigned int thread_count = 0;
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        from_first[i] = false;
+        keep[i]       = false;
+        if(flat_id * ItemsPerThread + i < count)
+        {
+            from_first[i] = sources[i] < size1;
+            sources[i]    = from_first[i] ? begin1 + sources[i] : begin2 + sources[i] - size1;
+            keep[i]       = set_operation_keep<Operation>(from_first[i],
+                                                          sources[i],
+                                                          keys[i],
+                                                          keys_input1,
+                                                          keys_input2,
+                                                          input1_size,
+                                                          input2_size,
+                                                          compare_function);
+        }
+        thread_count += keep[i] ? 1 : 0;
+    }
+
+    // The merge storage is still read by the other threads
+    ::rocprim::syncthreads();
+
+    unsigned int thread_offset;
+    block_scan_type().exclusive_scan(thread_count, thread_offset, 0u, storage.scan);
+
+    size_t offset = tile_offsets[flat_block_id] + thread_offset;
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        if(keep[i])
+        {
+            keys_output[offset] = keys[i];
+            if ROCPRIM_IF_CONSTEXPR(WithValues)
+            {
+                values_output[offset] = from_first[i] ? values_input1[sources[i]]
+                                                      : values_input2[sources[i]];
+            }
+            ++offset;
+        }
+    }
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SET_OPERATIONS_HPP_
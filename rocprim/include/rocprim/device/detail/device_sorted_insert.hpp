@@ -0,0 +1,185 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SORTED_INSERT_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SORTED_INSERT_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+
+#include "lookback_backoff.hpp"
+#include "ordered_block_id.hpp"
+
+#include <iterator>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+constexpr unsigned int sorted_insert_block_size       = 256;
+constexpr unsigned int sorted_insert_items_per_thread = 8;
+constexpr unsigned int sorted_insert_items_per_tile
+    = sorted_insert_block_size * sorted_insert_items_per_thread;
+
+// Number of batch elements inserted before the old element `index`, that is the number of
+// insertion positions not greater than `index`. Only positions[first, last) is searched.
+ROCPRIM_DEVICE ROCPRIM_INLINE size_t sorted_insert_shift(const size_t* positions,
+                                                         size_t        first,
+                                                         size_t        last,
+                                                         const size_t  index)
+{
+    while(first < last)
+    {
+        const size_t mid = first + (last - first) / 2;
+        if(positions[mid] <= index)
+        {
+            first = mid + 1;
+        }
+        else
+        {
+            last = mid;
+        }
+    }
+    return first;
+}
+
+// Moves every old element `i` to `i + shift(i)` in place. The destinations of a tile overlap
+// the sources of the following tiles, so the tiles run from the back: a tile publishes a flag
+// once its elements are in registers, and writes only after all tiles it overwrites have
+// published theirs. The tiles it waits for have received their ids before it, so they are
+// resident and never wait for it.
+template<class KeysIterator>
+ROCPRIM_KERNEL __launch_bounds__(sorted_insert_block_size) void sorted_insert_shift_kernel(
+    KeysIterator                         keys,
+    const size_t                         size,
+    const size_t*                        positions,
+    const size_t                         positions_size,
+    unsigned int*                        loaded_flags,
+    const ordered_block_id<unsigned int> ordered_tile_id)
+{
+    using key_type = typename std::iterator_traits<KeysIterator>::value_type;
+
+    constexpr unsigned int block_size     = sorted_insert_block_size;
+    constexpr unsigned int items_per_tile = sorted_insert_items_per_tile;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename ordered_block_id<unsigned int>::storage_type ordered_id;
+        size_t                                                first_shift;
+        size_t                                                last_shift;
+    } storage;
+
+    const unsigned int flat_id   = block_thread_id<0>();
+    const unsigned int num_tiles = ceiling_div(size, items_per_tile);
+    const unsigned int tile_id
+        = num_tiles - 1 - ordered_tile_id.get(flat_id, storage.ordered_id);
+
+    const size_t tile_begin = static_cast<size_t>(tile_id) * items_per_tile;
+    const size_t tile_end   = ::rocprim::min(size, tile_begin + items_per_tile);
+
+    if(flat_id == 0)
+    {
+        storage.first_shift = sorted_insert_shift(positions, 0, positions_size, tile_begin);
+        storage.last_shift
+            = sorted_insert_shift(positions, storage.first_shift, positions_size, tile_end - 1);
+    }
+    ::rocprim::syncthreads();
+    const size_t first_shift = storage.first_shift;
+    const size_t last_shift  = storage.last_shift;
+
+    // Nothing is inserted before the tile, its elements stay where they are.
+    if(last_shift == 0)
+    {
+        if(flat_id == 0)
+        {
+            ::rocprim::detail::atomic_store(&loaded_flags[tile_id], 1u);
+        }
+        return;
+    }
+
+    key_type items[sorted_insert_items_per_thread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < sorted_insert_items_per_thread; ++i)
+    {
+        const size_t index = tile_begin + i * block_size + flat_id;
+        if(index < tile_end)
+        {
+            items[i] = keys[index];
+        }
+    }
+    ::rocprim::syncthreads();
+
+    if(flat_id == 0)
+    {
+        ::rocprim::detail::memory_fence_device();
+        ::rocprim::detail::atomic_store(&loaded_flags[tile_id], 1u);
+    }
+
+    // The last element moves the farthest, wait for every tile its destination reaches.
+    const unsigned int last_overwritten_tile = static_cast<unsigned int>(
+        ::rocprim::min(size - 1, tile_end - 1 + last_shift) / items_per_tile);
+    for(unsigned int tile = tile_id + 1 + flat_id; tile <= last_overwritten_tile;
+        tile += block_size)
+    {
+        while(::rocprim::detail::atomic_load(&loaded_flags[tile]) == 0)
+        {
+            lookback_sleep(1);
+        }
+    }
+    ::rocprim::syncthreads();
+    ::rocprim::detail::memory_fence_device();
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < sorted_insert_items_per_thread; ++i)
+    {
+        const size_t index = tile_begin + i * block_size + flat_id;
+        if(index < tile_end)
+        {
+            const size_t shift = sorted_insert_shift(positions, first_shift, last_shift, index);
+            keys[index + shift] = items[i];
+        }
+    }
+}
+
+// Writes the sorted batch element `j` to its final position `positions[j] + j`.
+template<class KeysIterator, class BatchIterator>
+ROCPRIM_KERNEL __launch_bounds__(sorted_insert_block_size) void sorted_insert_scatter_kernel(
+    KeysIterator  keys,
+    BatchIterator sorted_batch,
+    const size_t* positions,
+    const size_t  batch_size)
+{
+    const size_t index = static_cast<size_t>(block_id<0>()) * sorted_insert_block_size
+                         + block_thread_id<0>();
+    if(index < batch_size)
+    {
+        keys[positions[index] + index] = sorted_batch[index];
+    }
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SORTED_INSERT_HPP_
@@ -0,0 +1,258 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_SORTED_SEARCH_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_SORTED_SEARCH_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/merge_path.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+
+#include "device_config_helper.hpp"
+
+#include <iterator>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The searches of sorted needles merge the needles with the haystack. precedes() tells whether
+// a haystack item is merged before a needle, and result() computes the output of a needle from
+// the position of the first haystack item that is merged after it.
+struct lower_bound_sorted_search_op
+{
+    using result_type = size_t;
+
+    template<class T, class Value, class CompareOp>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool precedes(const T& item, const Value& value, CompareOp compare_op) const
+    {
+        return compare_op(item, value);
+    }
+
+    template<class T, class Value, class CompareOp>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    result_type result(const size_t position,
+                       const bool /*valid*/,
+                       const T& /*item*/,
+                       const Value& /*value*/,
+                       CompareOp /*compare_op*/) const
+    {
+        return position;
+    }
+};
+
+struct upper_bound_sorted_search_op
+{
+    using result_type = size_t;
+
+    template<class T, class Value, class CompareOp>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool precedes(const T& item, const Value& value, CompareOp compare_op) const
+    {
+        return !compare_op(value, item);
+    }
+
+    template<class T, class Value, class CompareOp>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    result_type result(const size_t position,
+                       const bool /*valid*/,
+                       const T& /*item*/,
+                       const Value& /*value*/,
+                       CompareOp /*compare_op*/) const
+    {
+        return position;
+    }
+};
+
+struct binary_search_sorted_search_op
+{
+    using result_type = bool;
+
+    template<class T, class Value, class CompareOp>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    bool precedes(const T& item, const Value& value, CompareOp compare_op) const
+    {
+        return compare_op(item, value);
+    }
+
+    // item is only valid if the position is in the haystack
+    template<class T, class Value, class CompareOp>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    result_type result(const size_t /*position*/,
+                       const bool   valid,
+                       const T&     item,
+                       const Value& value,
+                       CompareOp    compare_op) const
+    {
+        return valid && !compare_op(value, item);
+    }
+};
+
+// Searches sorted needles in the haystack by splitting the merge path of the needles and the
+// haystack into tiles. The needles and the haystack items of a tile are loaded into shared
+// memory with coalesced loads, and every thread walks its part of the merge path of the tile,
+// so the total work is linear in the sizes of the needles and the haystack. The results are
+// staged in shared memory, so they are stored with coalesced stores too.
+template<class Config,
+         class HaystackIterator,
+         class NeedlesIterator,
+         class OutputIterator,
+         class SearchOp,
+         class CompareFunction>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void sorted_search_kernel(HaystackIterator haystack,
+                          NeedlesIterator  needles,
+                          OutputIterator   output,
+                          const size_t     haystack_size,
+                          const size_t     needles_size,
+                          SearchOp         search_op,
+                          CompareFunction  compare_op)
+{
+    static constexpr merge_config_params params = device_params<Config>();
+
+    constexpr unsigned int block_size       = params.kernel_config.block_size;
+    constexpr unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    using haystack_type = typename std::iterator_traits<HaystackIterator>::value_type;
+    using needle_type   = typename std::iterator_traits<NeedlesIterator>::value_type;
+    using result_type   = typename SearchOp::result_type;
+
+    // The first needles of the tile and of the next tile, and the needles and the haystack items
+    // of the tile, with the first haystack item after the tile.
+    ROCPRIM_SHARED_MEMORY size_t needles_bounds[2];
+    ROCPRIM_SHARED_MEMORY union
+    {
+        ROCPRIM_DETAIL_SUPPRESS_DEPRECATION_WITH_PUSH
+        struct
+        {
+            detail::raw_storage<needle_type[items_per_block]>       needles;
+            detail::raw_storage<haystack_type[items_per_block + 1]> haystack;
+        } keys;
+        detail::raw_storage<result_type[items_per_block]> results;
+        ROCPRIM_DETAIL_SUPPRESS_DEPRECATION_POP
+    } storage;
+
+    const auto precedes = [&](const haystack_type& item, const needle_type& value)
+    { return search_op.precedes(item, value, compare_op); };
+
+    const unsigned int flat_id        = block_thread_id<0>();
+    const size_t       path_size      = haystack_size + needles_size;
+    const size_t       diagonal_begin = size_t(block_id<0>()) * items_per_block;
+    const size_t       diagonal_end   = ::rocprim::min(diagonal_begin + items_per_block, path_size);
+
+    if(flat_id < 2)
+    {
+        needles_bounds[flat_id] = merge_path(needles,
+                                             haystack,
+                                             needles_size,
+                                             haystack_size,
+                                             flat_id == 0 ? diagonal_begin : diagonal_end,
+                                             precedes);
+    }
+    ::rocprim::syncthreads();
+
+    const size_t       needles_begin  = needles_bounds[0];
+    const size_t       haystack_begin = diagonal_begin - needles_begin;
+    const unsigned int tile_size      = static_cast<unsigned int>(diagonal_end - diagonal_begin);
+    const unsigned int tile_needles
+        = static_cast<unsigned int>(needles_bounds[1] - needles_begin);
+    const unsigned int tile_haystack = tile_size - tile_needles;
+    const bool         has_next_item = haystack_begin + tile_haystack < haystack_size;
+
+    needle_type(&needles_shared)[items_per_block]        = storage.keys.needles.get();
+    haystack_type(&haystack_shared)[items_per_block + 1] = storage.keys.haystack.get();
+    for(unsigned int i = flat_id; i < tile_needles; i += block_size)
+    {
+        needles_shared[i] = needles[needles_begin + i];
+    }
+    for(unsigned int i = flat_id; i < tile_haystack + has_next_item; i += block_size)
+    {
+        haystack_shared[i] = haystack[haystack_begin + i];
+    }
+    ::rocprim::syncthreads();
+
+    const unsigned int diagonal = ::rocprim::min(flat_id * items_per_thread, tile_size);
+    unsigned int       needle   = merge_path(needles_shared,
+                                             haystack_shared,
+                                             tile_needles,
+                                             tile_haystack,
+                                             diagonal,
+                                             precedes);
+    unsigned int       item     = diagonal - needle;
+
+    // Every step of the walk either finds the result of a needle or skips a haystack item
+    result_type  results[items_per_thread];
+    unsigned int result_needles[items_per_thread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        result_needles[i] = items_per_block;
+        if(needle + item < tile_size)
+        {
+            if(needle < tile_needles
+               && (item == tile_haystack
+                   || !precedes(haystack_shared[item], needles_shared[needle])))
+            {
+                result_needles[i]     = needle;
+                const size_t position = haystack_begin + item;
+                results[i]            = search_op.result(position,
+                                                         position < haystack_size,
+                                                         haystack_shared[item],
+                                                         needles_shared[needle],
+                                                         compare_op);
+                needle++;
+            }
+            else
+            {
+                item++;
+            }
+        }
+    }
+    ::rocprim::syncthreads();
+
+    result_type(&results_shared)[items_per_block] = storage.results.get();
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        if(result_needles[i] != items_per_block)
+        {
+            results_shared[result_needles[i]] = results[i];
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int i = flat_id; i < tile_needles; i += block_size)
+    {
+        output[needles_begin + i] = results_shared[i];
+    }
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_SORTED_SEARCH_HPP_
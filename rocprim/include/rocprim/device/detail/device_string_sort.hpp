@@ -0,0 +1,146 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_STRING_SORT_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_STRING_SORT_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+constexpr unsigned int string_sort_block_size = 256;
+
+// Number of bytes of a string in every prefix key. The lowest byte of the key holds how many of
+// them the string has, so a shorter string orders before a longer one with the same bytes, even
+// if that one continues with zeros.
+constexpr unsigned int string_sort_chunk_bytes = 7;
+
+template<class CharsIterator, class OffsetsIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE uint64_t string_sort_prefix(CharsIterator      chars,
+                                                          OffsetsIterator    string_offsets,
+                                                          const unsigned int string,
+                                                          const size_t       depth)
+{
+    const size_t begin = static_cast<size_t>(string_offsets[string]) + depth;
+    const size_t end   = static_cast<size_t>(string_offsets[string + 1]);
+    const unsigned int length
+        = begin < end ? static_cast<unsigned int>(
+              ::rocprim::min<size_t>(end - begin, string_sort_chunk_bytes))
+                      : 0;
+
+    uint64_t key = 0;
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < string_sort_chunk_bytes; ++i)
+    {
+        const unsigned char byte = i < length ? static_cast<unsigned char>(chars[begin + i]) : 0;
+        key                      = (key << 8) | byte;
+    }
+    return (key << 8) | length;
+}
+
+// Computes the prefix keys at `depth` of the unresolved strings. Position `i` of the refined
+// range is position `positions[i]` of the permutation, or position `i` in the first round, when
+// `positions` is a null pointer.
+template<class CharsIterator, class OffsetsIterator>
+ROCPRIM_KERNEL __launch_bounds__(string_sort_block_size) void string_sort_prefix_kernel(
+    CharsIterator             chars,
+    OffsetsIterator           string_offsets,
+    const unsigned int* const permutation,
+    const unsigned int* const positions,
+    uint64_t* const           keys,
+    unsigned int* const       strings,
+    const unsigned int        size,
+    const size_t              depth)
+{
+    const unsigned int i = block_id<0>() * string_sort_block_size + block_thread_id<0>();
+    if(i >= size)
+    {
+        return;
+    }
+    const unsigned int string = positions != nullptr ? permutation[positions[i]] : i;
+    keys[i]                   = string_sort_prefix(chars, string_offsets, string, depth);
+    strings[i]                = string;
+}
+
+// Marks the first string of every non-empty segment of the first round.
+template<class SegmentOffsetsIterator>
+ROCPRIM_KERNEL __launch_bounds__(string_sort_block_size) void string_sort_heads_kernel(
+    SegmentOffsetsIterator segment_offsets,
+    unsigned char* const   heads,
+    const unsigned int     segments)
+{
+    const unsigned int segment = block_id<0>() * string_sort_block_size + block_thread_id<0>();
+    if(segment >= segments)
+    {
+        return;
+    }
+    const size_t begin = static_cast<size_t>(segment_offsets[segment]);
+    if(begin < static_cast<size_t>(segment_offsets[segment + 1]))
+    {
+        heads[begin] = 1;
+    }
+}
+
+// Writes the sorted strings of a refined range back to their positions of the permutation, and
+// flags which of them are still tied. A string is tied when another string of its range has the
+// same prefix key, and both continue past it. Every run of tied strings starts a range of the
+// next round, so their starts are flagged in `run_starts`.
+ROCPRIM_KERNEL __launch_bounds__(string_sort_block_size) void string_sort_ties_kernel(
+    const uint64_t* const      keys,
+    const unsigned int* const  strings,
+    const unsigned char* const heads,
+    const unsigned int* const  positions,
+    unsigned int* const        permutation,
+    unsigned char* const       tied,
+    unsigned char* const       run_starts,
+    const unsigned int         size)
+{
+    const unsigned int i = block_id<0>() * string_sort_block_size + block_thread_id<0>();
+    if(i >= size)
+    {
+        return;
+    }
+    if(positions != nullptr)
+    {
+        permutation[positions[i]] = strings[i];
+    }
+
+    const uint64_t key           = keys[i];
+    const bool     same_previous = i > 0 && heads[i] == 0 && keys[i - 1] == key;
+    const bool     same_next     = i + 1 < size && heads[i + 1] == 0 && keys[i + 1] == key;
+    const bool     continues     = (key & 0xff) == string_sort_chunk_bytes;
+
+    tied[i]       = (same_previous || same_next) && continues;
+    run_starts[i] = !same_previous;
+}
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_STRING_SORT_HPP_
@@ -0,0 +1,924 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_TOPK_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_TOPK_HPP_
+
+#include "../../block/block_scan.hpp"
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../thread/radix_key_codec.hpp"
+#include "../../type_traits.hpp"
+#include "../../types.hpp"
+#include "../../warp/warp_merge_sort.hpp"
+
+#include "device_config_helper.hpp"
+
+#include <iterator>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// State of the radix selection. After every digit pass it describes the bucket that contains the
+// k-th selected key: every candidate whose masked bit key equals `prefix` is part of that bucket.
+// `remaining` is the number of keys that still have to be taken from this bucket.
+template<class BitKey>
+struct topk_state
+{
+    BitKey       prefix;
+    BitKey       mask;
+    size_t       remaining;
+    unsigned int done;
+};
+
+template<class Key, bool Descending>
+struct topk_helper
+{
+    // Keys are encoded so that the selected keys are always the ones with the smallest bit keys:
+    // selecting the largest keys uses the descending codec, which inverts the bit keys.
+    using codec        = radix_key_codec<Key, Descending>;
+    using bit_key_type = typename codec::bit_key_type;
+
+    static constexpr unsigned int key_bits = sizeof(bit_key_type) * 8;
+
+    ROCPRIM_HOST_DEVICE static constexpr unsigned int passes(const unsigned int radix_bits)
+    {
+        return ceiling_div(key_bits, radix_bits);
+    }
+
+    // Digits are resolved from the most significant bits downwards.
+    ROCPRIM_HOST_DEVICE static constexpr unsigned int digit_start(const unsigned int pass,
+                                                                  const unsigned int radix_bits)
+    {
+        return key_bits > (pass + 1) * radix_bits ? key_bits - (pass + 1) * radix_bits : 0;
+    }
+
+    ROCPRIM_HOST_DEVICE static constexpr unsigned int digit_width(const unsigned int pass,
+                                                                  const unsigned int radix_bits)
+    {
+        return key_bits - pass * radix_bits - digit_start(pass, radix_bits);
+    }
+
+    ROCPRIM_HOST_DEVICE static constexpr bit_key_type digit_mask(const unsigned int start,
+                                                                 const unsigned int width)
+    {
+        return static_cast<bit_key_type>(static_cast<bit_key_type>((1u << width) - 1u) << start);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE static unsigned int
+        extract_digit(const bit_key_type bit_key, const unsigned int start, const unsigned int width)
+    {
+        return static_cast<unsigned int>(bit_key >> start) & ((1u << width) - 1u);
+    }
+};
+
+// Adds the digits of the candidates among the keys of one tile to the global histogram.
+template<class Config, bool Descending, class KeysInputIterator, class BitKey, class Count>
+ROCPRIM_DEVICE ROCPRIM_INLINE void topk_histogram_tile(KeysInputIterator  keys_input,
+                                                       const unsigned int valid_count,
+                                                       const BitKey       prefix,
+                                                       const BitKey       mask,
+                                                       Count*             histogram,
+                                                       const unsigned int start_bit,
+                                                       const unsigned int current_radix_bits)
+{
+    constexpr topk_config_params params           = device_params<Config>();
+    constexpr unsigned int       block_size       = params.kernel_config.block_size;
+    constexpr unsigned int       items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int       radix_size       = 1u << params.radix_bits;
+
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using helper   = topk_helper<key_type, Descending>;
+
+    ROCPRIM_SHARED_MEMORY unsigned int block_histogram[radix_size];
+
+    // Every thread only resets and flushes its own bin, so consecutive tiles need no barrier.
+    const unsigned int flat_id = block_thread_id<0>();
+    if(flat_id < radix_size)
+    {
+        block_histogram[flat_id] = 0;
+    }
+    syncthreads();
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const unsigned int pos = i * block_size + flat_id;
+        if(pos < valid_count)
+        {
+            const BitKey bit_key = helper::codec::encode(keys_input[pos]);
+            if((bit_key & mask) == prefix)
+            {
+                const unsigned int digit
+                    = helper::extract_digit(bit_key, start_bit, current_radix_bits);
+                atomic_add(&block_histogram[digit], 1u);
+            }
+        }
+    }
+    syncthreads();
+
+    if(flat_id < radix_size)
+    {
+        const unsigned int count = block_histogram[flat_id];
+        if(count != 0)
+        {
+            atomic_add(&histogram[flat_id], static_cast<Count>(count));
+        }
+    }
+}
+
+template<class Config, bool Descending, class KeysInputIterator, class BitKey>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size) void topk_histogram_kernel(
+        KeysInputIterator         keys_input,
+        const size_t              size,
+        const topk_state<BitKey>* state,
+        size_t*                   histogram,
+        const unsigned int        pass,
+        const unsigned int        start_bit,
+        const unsigned int        current_radix_bits)
+{
+    constexpr topk_config_params params = device_params<Config>();
+    constexpr unsigned int       items_per_block
+        = params.kernel_config.block_size * params.kernel_config.items_per_thread;
+
+    BitKey prefix = 0;
+    BitKey mask   = 0;
+    if(pass != 0)
+    {
+        // The previous pass already isolated exactly the remaining keys.
+        if(state->done)
+        {
+            return;
+        }
+        prefix = state->prefix;
+        mask   = state->mask;
+    }
+
+    const size_t       block_offset = static_cast<size_t>(block_id<0>()) * items_per_block;
+    const unsigned int valid_count
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    topk_histogram_tile<Config, Descending>(keys_input + block_offset,
+                                            valid_count,
+                                            prefix,
+                                            mask,
+                                            histogram,
+                                            start_bit,
+                                            current_radix_bits);
+}
+
+// Selects the digit bucket that contains the remaining-th candidate. When FullKey is set, the
+// selection never stops early, so that the final bucket only holds keys equal to the k-th key.
+template<unsigned int RadixSize, bool FullKey, class BitKey>
+ROCPRIM_DEVICE ROCPRIM_INLINE void topk_select_digit(topk_state<BitKey>* state,
+                                                     const size_t*       histogram,
+                                                     const size_t        k,
+                                                     const unsigned int  pass,
+                                                     const BitKey        digit_mask,
+                                                     const unsigned int  start_bit)
+{
+    using block_scan_type = block_scan<size_t, RadixSize>;
+
+    ROCPRIM_SHARED_MEMORY typename block_scan_type::storage_type storage;
+
+    size_t remaining = k;
+    BitKey prefix    = 0;
+    BitKey mask      = 0;
+    if(pass != 0)
+    {
+        if(state->done)
+        {
+            return;
+        }
+        remaining = state->remaining;
+        prefix    = state->prefix;
+        mask      = state->mask;
+    }
+
+    const unsigned int flat_id = block_thread_id<0>();
+    const size_t       count   = histogram[flat_id];
+    size_t             offset;
+    block_scan_type().exclusive_scan(count, offset, size_t(0), storage);
+
+    // Exactly one digit bucket contains the remaining-th smallest candidate.
+    if(offset < remaining && remaining <= offset + count)
+    {
+        remaining        = remaining - offset;
+        state->prefix    = prefix | static_cast<BitKey>(static_cast<BitKey>(flat_id) << start_bit);
+        state->mask      = mask | digit_mask;
+        state->remaining = remaining;
+        state->done      = !FullKey && remaining == count;
+    }
+}
+
+template<class Config, class BitKey>
+ROCPRIM_KERNEL
+    __launch_bounds__(1u << device_params<Config>().radix_bits) void topk_select_digit_kernel(
+        topk_state<BitKey>* state,
+        const size_t*       histogram,
+        const size_t        k,
+        const unsigned int  pass,
+        const BitKey        digit_mask,
+        const unsigned int  start_bit)
+{
+    topk_select_digit<1u << device_params<Config>().radix_bits, false>(state,
+                                                                       histogram,
+                                                                       k,
+                                                                       pass,
+                                                                       digit_mask,
+                                                                       start_bit);
+}
+
+template<bool WithValues,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class Key>
+ROCPRIM_DEVICE ROCPRIM_INLINE void topk_store(KeysOutputIterator   keys_output,
+                                              ValuesInputIterator  values_input,
+                                              ValuesOutputIterator values_output,
+                                              const size_t         input_index,
+                                              const size_t         output_index,
+                                              const Key&           key)
+{
+    keys_output[output_index] = key;
+    if ROCPRIM_IF_CONSTEXPR(WithValues)
+    {
+        values_output[output_index] = values_input[input_index];
+    }
+}
+
+// Writes the selected keys of one tile. Counter 0 counts the keys that are strictly better than
+// the k-th key, counter 1 the ties. With WriteRest the keys that are not selected are written as
+// well: the ties that are not needed directly after the first k output positions, and the worse
+// keys, counted by counter 2, backwards from output_end.
+template<class Config,
+         bool Descending,
+         bool WithValues,
+         bool WriteRest,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class BitKey>
+ROCPRIM_DEVICE ROCPRIM_INLINE void topk_compact_tile(KeysInputIterator    keys_input,
+                                                     ValuesInputIterator  values_input,
+                                                     KeysOutputIterator   keys_output,
+                                                     ValuesOutputIterator values_output,
+                                                     const size_t         input_offset,
+                                                     const unsigned int   valid_count,
+                                                     const size_t         output_offset,
+                                                     const size_t         output_end,
+                                                     const size_t         k,
+                                                     const BitKey         prefix,
+                                                     const BitKey         mask,
+                                                     const size_t         remaining,
+                                                     size_t*              counters)
+{
+    constexpr topk_config_params params           = device_params<Config>();
+    constexpr unsigned int       block_size       = params.kernel_config.block_size;
+    constexpr unsigned int       items_per_thread = params.kernel_config.items_per_thread;
+    constexpr unsigned int       kinds_count      = WriteRest ? 3 : 2;
+
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using helper   = topk_helper<key_type, Descending>;
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        unsigned int count[kinds_count];
+        size_t       base[kinds_count];
+    } storage;
+
+    const size_t better_size = k - remaining;
+
+    const unsigned int flat_id = block_thread_id<0>();
+    if(flat_id < kinds_count)
+    {
+        storage.count[flat_id] = 0;
+    }
+    syncthreads();
+
+    key_type      keys[items_per_thread];
+    unsigned int  ranks[items_per_thread];
+    unsigned char kinds[items_per_thread];
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const unsigned int pos = i * block_size + flat_id;
+        kinds[i]               = 3;
+        if(pos < valid_count)
+        {
+            keys[i]             = keys_input[input_offset + pos];
+            const BitKey masked = helper::codec::encode(keys[i]) & mask;
+            if(masked <= prefix)
+            {
+                kinds[i] = masked == prefix ? 1 : 0;
+                ranks[i] = atomic_add(&storage.count[kinds[i]], 1u);
+            }
+            else if(WriteRest)
+            {
+                kinds[i] = 2;
+                ranks[i] = atomic_add(&storage.count[kinds_count - 1], 1u);
+            }
+        }
+    }
+    syncthreads();
+
+    if(flat_id < kinds_count)
+    {
+        const unsigned int count = storage.count[flat_id];
+        storage.base[flat_id] = count != 0 ? atomic_add(&counters[flat_id], size_t(count)) : 0;
+    }
+    syncthreads();
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const size_t input_index = input_offset + i * block_size + flat_id;
+        if(kinds[i] == 0)
+        {
+            topk_store<WithValues>(keys_output,
+                                   values_input,
+                                   values_output,
+                                   input_index,
+                                   output_offset + storage.base[0] + ranks[i],
+                                   keys[i]);
+        }
+        else if(kinds[i] == 1)
+        {
+            // Only the first `remaining` ties are part of the result.
+            const size_t tie_index = storage.base[1] + ranks[i];
+            if(WriteRest || tie_index < remaining)
+            {
+                topk_store<WithValues>(keys_output,
+                                       values_input,
+                                       values_output,
+                                       input_index,
+                                       output_offset + better_size + tie_index,
+                                       keys[i]);
+            }
+        }
+        else if(WriteRest && kinds[i] == 2)
+        {
+            topk_store<WithValues>(keys_output,
+                                   values_input,
+                                   values_output,
+                                   input_index,
+                                   output_end - 1 - (storage.base[kinds_count - 1] + ranks[i]),
+                                   keys[i]);
+        }
+    }
+}
+
+template<class Config,
+         bool Descending,
+         bool WithValues,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class BitKey>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size) void topk_compact_kernel(
+        KeysInputIterator         keys_input,
+        ValuesInputIterator       values_input,
+        KeysOutputIterator        keys_output,
+        ValuesOutputIterator      values_output,
+        const size_t              size,
+        const size_t              k,
+        const topk_state<BitKey>* state,
+        size_t*                   counters)
+{
+    constexpr topk_config_params params = device_params<Config>();
+    constexpr unsigned int       items_per_block
+        = params.kernel_config.block_size * params.kernel_config.items_per_thread;
+
+    const size_t       block_offset = static_cast<size_t>(block_id<0>()) * items_per_block;
+    const unsigned int valid_count
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    topk_compact_tile<Config, Descending, WithValues, false>(keys_input,
+                                                             values_input,
+                                                             keys_output,
+                                                             values_output,
+                                                             block_offset,
+                                                             valid_count,
+                                                             0,
+                                                             k,
+                                                             k,
+                                                             state->prefix,
+                                                             state->mask,
+                                                             state->remaining,
+                                                             counters);
+}
+
+// Segment sizes of segmented top-k. Segments of at most small_segment_size keys are selected by
+// a logical warp, segments of more than large_segment_size keys by blocks_per_large_segment
+// blocks each and all other segments by one block each. Up to large_segments_per_launch large
+// segments are selected together.
+struct segmented_topk_sizes
+{
+    unsigned int items_per_block;
+    unsigned int warp_size;
+    unsigned int warp_items_per_thread;
+    unsigned int small_segment_size;
+    unsigned int large_segment_size;
+    unsigned int blocks_per_large_segment;
+    unsigned int large_segments_per_launch;
+};
+
+ROCPRIM_HOST_DEVICE constexpr segmented_topk_sizes
+    get_segmented_topk_sizes(const topk_config_params params)
+{
+    const unsigned int block_size       = params.kernel_config.block_size;
+    const unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    // The logical warps use the largest power of two that divides the block size, at most 32.
+    const unsigned int warp_size             = ::rocprim::min(32u, block_size & (~block_size + 1u));
+    const unsigned int warp_items_per_thread = ::rocprim::min(16u, items_per_thread);
+    return segmented_topk_sizes{block_size * items_per_thread,
+                                warp_size,
+                                warp_items_per_thread,
+                                warp_size * warp_items_per_thread,
+                                8 * block_size * items_per_thread,
+                                16,
+                                64};
+}
+
+// Output position of the first key selected from a segment. Partitioned segments are written to
+// their input positions, otherwise every segment gets k output positions.
+template<bool Partition, class OffsetIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE size_t segmented_topk_output_offset(OffsetIterator     begin_offsets,
+                                                                  const unsigned int segment_id,
+                                                                  const unsigned int k)
+{
+    return Partition ? static_cast<size_t>(begin_offsets[segment_id])
+                     : static_cast<size_t>(segment_id) * k;
+}
+
+// Selects the k keys of a small segment by sorting the whole segment in a logical warp. The
+// encoded keys are sorted together with their positions, so the output is sorted as well.
+template<class Config,
+         bool Descending,
+         bool WithValues,
+         bool Partition,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    segmented_topk_warp_kernel(KeysInputIterator    keys_input,
+                               ValuesInputIterator  values_input,
+                               KeysOutputIterator   keys_output,
+                               ValuesOutputIterator values_output,
+                               const unsigned int   segments,
+                               OffsetIterator       begin_offsets,
+                               OffsetIterator       end_offsets,
+                               const unsigned int   k)
+{
+    constexpr topk_config_params   params = device_params<Config>();
+    constexpr segmented_topk_sizes sizes  = get_segmented_topk_sizes(params);
+
+    constexpr unsigned int warp_size        = sizes.warp_size;
+    constexpr unsigned int items_per_thread = sizes.warp_items_per_thread;
+    constexpr unsigned int warps_per_block  = params.kernel_config.block_size / warp_size;
+
+    using key_type     = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using helper       = topk_helper<key_type, Descending>;
+    using bit_key_type = typename helper::bit_key_type;
+    using sort_type = warp_merge_sort<bit_key_type, items_per_thread, warp_size, unsigned int>;
+
+    ROCPRIM_SHARED_MEMORY typename sort_type::storage_type storage[warps_per_block];
+
+    const unsigned int warp_id    = block_thread_id<0>() / warp_size;
+    const unsigned int lane       = logical_lane_id<warp_size>();
+    const unsigned int segment_id = block_id<0>() * warps_per_block + warp_id;
+    if(segment_id >= segments)
+    {
+        return;
+    }
+
+    const size_t begin_offset = begin_offsets[segment_id];
+    const size_t end_offset   = end_offsets[segment_id];
+    if(end_offset <= begin_offset || end_offset - begin_offset > sizes.small_segment_size)
+    {
+        return;
+    }
+    const unsigned int valid_items = static_cast<unsigned int>(end_offset - begin_offset);
+    const unsigned int output_size = Partition ? valid_items : ::rocprim::min(valid_items, k);
+    const size_t       output_offset
+        = segmented_topk_output_offset<Partition>(begin_offsets, segment_id, k);
+
+    bit_key_type bit_keys[items_per_thread];
+    unsigned int positions[items_per_thread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const unsigned int pos = lane * items_per_thread + i;
+        positions[i]           = pos;
+        if(pos < valid_items)
+        {
+            bit_keys[i] = helper::codec::encode(keys_input[begin_offset + pos]);
+        }
+    }
+
+    // The selected keys have the smallest encoded keys.
+    sort_type().sort(bit_keys, positions, storage[warp_id], valid_items);
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const unsigned int pos = lane * items_per_thread + i;
+        if(pos < output_size)
+        {
+            topk_store<WithValues>(keys_output,
+                                   values_input,
+                                   values_output,
+                                   begin_offset + positions[i],
+                                   output_offset + pos,
+                                   helper::codec::decode(bit_keys[i]));
+        }
+    }
+}
+
+// Selects the k keys of a medium segment by one block, which performs the whole radix selection
+// in shared memory.
+template<class Config,
+         bool Descending,
+         bool WithValues,
+         bool Partition,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size) void segmented_topk_kernel(
+        KeysInputIterator    keys_input,
+        ValuesInputIterator  values_input,
+        KeysOutputIterator   keys_output,
+        ValuesOutputIterator values_output,
+        OffsetIterator       begin_offsets,
+        OffsetIterator       end_offsets,
+        const unsigned int   k)
+{
+    constexpr topk_config_params   params     = device_params<Config>();
+    constexpr segmented_topk_sizes sizes      = get_segmented_topk_sizes(params);
+    constexpr unsigned int         block_size = params.kernel_config.block_size;
+    constexpr unsigned int       radix_bits = params.radix_bits;
+    constexpr unsigned int       radix_size = 1u << radix_bits;
+
+    using key_type        = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using helper          = topk_helper<key_type, Descending>;
+    using bit_key_type    = typename helper::bit_key_type;
+    using block_scan_type = block_scan<unsigned int, block_size>;
+
+    constexpr unsigned int passes = helper::passes(radix_bits);
+
+    ROCPRIM_SHARED_MEMORY struct
+    {
+        typename block_scan_type::storage_type scan;
+        unsigned int                           histogram[radix_size];
+        bit_key_type                           prefix;
+        bit_key_type                           mask;
+        unsigned int                           remaining;
+        unsigned int                           done;
+        unsigned int                           count[3];
+    } storage;
+
+    const unsigned int flat_id    = block_thread_id<0>();
+    const unsigned int segment_id = block_id<0>();
+
+    const size_t begin_offset = begin_offsets[segment_id];
+    const size_t end_offset   = end_offsets[segment_id];
+    const size_t output_offset
+        = segmented_topk_output_offset<Partition>(begin_offsets, segment_id, k);
+
+    // Small and large segments are selected by the warp and by the multi-block kernels.
+    const size_t segment_size = end_offset > begin_offset ? end_offset - begin_offset : 0;
+    if(segment_size <= sizes.small_segment_size
+       || (segment_size > sizes.large_segment_size && segment_size > k))
+    {
+        return;
+    }
+
+    // Segments that are not larger than k are selected completely.
+    if(segment_size <= k)
+    {
+        for(size_t i = begin_offset + flat_id; i < end_offset; i += block_size)
+        {
+            topk_store<WithValues>(keys_output,
+                                   values_input,
+                                   values_output,
+                                   i,
+                                   output_offset + (i - begin_offset),
+                                   keys_input[i]);
+        }
+        return;
+    }
+
+    bit_key_type prefix    = 0;
+    bit_key_type mask      = 0;
+    unsigned int remaining = k;
+    for(unsigned int pass = 0; pass < passes; ++pass)
+    {
+        const unsigned int start_bit = helper::digit_start(pass, radix_bits);
+        const unsigned int width     = helper::digit_width(pass, radix_bits);
+
+        if(flat_id < radix_size)
+        {
+            storage.histogram[flat_id] = 0;
+        }
+        syncthreads();
+
+        for(size_t i = begin_offset + flat_id; i < end_offset; i += block_size)
+        {
+            const bit_key_type bit_key = helper::codec::encode(keys_input[i]);
+            if((bit_key & mask) == prefix)
+            {
+                atomic_add(&storage.histogram[helper::extract_digit(bit_key, start_bit, width)],
+                           1u);
+            }
+        }
+        syncthreads();
+
+        const unsigned int count = flat_id < radix_size ? storage.histogram[flat_id] : 0u;
+        unsigned int       offset;
+        block_scan_type().exclusive_scan(count, offset, 0u, storage.scan);
+
+        if(flat_id < radix_size && offset < remaining && remaining <= offset + count)
+        {
+            storage.prefix
+                = prefix | static_cast<bit_key_type>(static_cast<bit_key_type>(flat_id) << start_bit);
+            storage.mask      = mask | helper::digit_mask(start_bit, width);
+            storage.remaining = remaining - offset;
+            storage.done      = remaining - offset == count;
+        }
+        syncthreads();
+
+        prefix    = storage.prefix;
+        mask      = storage.mask;
+        remaining = storage.remaining;
+        // Partitioning needs the k-th key itself, so all digits have to be resolved.
+        if(!Partition && storage.done)
+        {
+            break;
+        }
+    }
+
+    if(flat_id < 3)
+    {
+        storage.count[flat_id] = 0;
+    }
+    syncthreads();
+
+    const unsigned int better_size = k - remaining;
+    for(size_t i = begin_offset + flat_id; i < end_offset; i += block_size)
+    {
+        const key_type     key    = keys_input[i];
+        const bit_key_type masked = helper::codec::encode(key) & mask;
+        if(masked < prefix)
+        {
+            const unsigned int rank = atomic_add(&storage.count[0], 1u);
+            topk_store<WithValues>(keys_output,
+                                   values_input,
+                                   values_output,
+                                   i,
+                                   output_offset + rank,
+                                   key);
+        }
+        else if(masked == prefix)
+        {
+            const unsigned int tie_index = atomic_add(&storage.count[1], 1u);
+            if(Partition || tie_index < remaining)
+            {
+                topk_store<WithValues>(keys_output,
+                                       values_input,
+                                       values_output,
+                                       i,
+                                       output_offset + better_size + tie_index,
+                                       key);
+            }
+        }
+        else if(Partition)
+        {
+            const unsigned int rank = atomic_add(&storage.count[2], 1u);
+            topk_store<WithValues>(keys_output,
+                                   values_input,
+                                   values_output,
+                                   i,
+                                   output_offset + segment_size - 1 - rank,
+                                   key);
+        }
+    }
+}
+
+// Every launch of the large segment kernels processes one batch of large segments, the blocks
+// of one segment share its slot of the histograms, states and counters.
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class OffsetIterator,
+         class BitKey>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    segmented_topk_large_histogram_kernel(KeysInputIterator         keys_input,
+                                          const unsigned int*       segment_indices,
+                                          OffsetIterator            begin_offsets,
+                                          OffsetIterator            end_offsets,
+                                          const topk_state<BitKey>* states,
+                                          size_t*                   histograms,
+                                          const unsigned int        pass,
+                                          const unsigned int        start_bit,
+                                          const unsigned int        current_radix_bits)
+{
+    constexpr topk_config_params params = device_params<Config>();
+    constexpr unsigned int       items_per_block
+        = params.kernel_config.block_size * params.kernel_config.items_per_thread;
+    constexpr unsigned int radix_size = 1u << params.radix_bits;
+
+    const unsigned int        slot  = block_id<0>();
+    const topk_state<BitKey>* state = states + slot;
+
+    BitKey prefix = 0;
+    BitKey mask   = 0;
+    if(pass != 0)
+    {
+        if(state->done)
+        {
+            return;
+        }
+        prefix = state->prefix;
+        mask   = state->mask;
+    }
+
+    const unsigned int segment_id   = segment_indices[slot];
+    const size_t       begin_offset = begin_offsets[segment_id];
+    const size_t       end_offset   = end_offsets[segment_id];
+
+    for(size_t offset = begin_offset + static_cast<size_t>(block_id<1>()) * items_per_block;
+        offset < end_offset;
+        offset += static_cast<size_t>(grid_size<1>()) * items_per_block)
+    {
+        const unsigned int valid_count = static_cast<unsigned int>(
+            ::rocprim::min<size_t>(end_offset - offset, items_per_block));
+        topk_histogram_tile<Config, Descending>(keys_input + offset,
+                                                valid_count,
+                                                prefix,
+                                                mask,
+                                                histograms + slot * radix_size,
+                                                start_bit,
+                                                current_radix_bits);
+    }
+}
+
+template<class Config, bool Partition, class BitKey>
+ROCPRIM_KERNEL __launch_bounds__(1u << device_params<Config>().radix_bits) void
+    segmented_topk_large_select_digit_kernel(topk_state<BitKey>* states,
+                                             const size_t*       histograms,
+                                             const size_t        k,
+                                             const unsigned int  pass,
+                                             const BitKey        digit_mask,
+                                             const unsigned int  start_bit)
+{
+    constexpr unsigned int radix_size = 1u << device_params<Config>().radix_bits;
+
+    const unsigned int slot = block_id<0>();
+    topk_select_digit<radix_size, Partition>(states + slot,
+                                             histograms + slot * radix_size,
+                                             k,
+                                             pass,
+                                             digit_mask,
+                                             start_bit);
+}
+
+template<class Config,
+         bool Descending,
+         bool WithValues,
+         bool Partition,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator,
+         class BitKey>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    segmented_topk_large_compact_kernel(KeysInputIterator         keys_input,
+                                        ValuesInputIterator       values_input,
+                                        KeysOutputIterator        keys_output,
+                                        ValuesOutputIterator      values_output,
+                                        const unsigned int*       segment_indices,
+                                        OffsetIterator            begin_offsets,
+                                        OffsetIterator            end_offsets,
+                                        const unsigned int        k,
+                                        const topk_state<BitKey>* states,
+                                        size_t*                   counters)
+{
+    constexpr topk_config_params params = device_params<Config>();
+    constexpr unsigned int       items_per_block
+        = params.kernel_config.block_size * params.kernel_config.items_per_thread;
+
+    const unsigned int        slot  = block_id<0>();
+    const topk_state<BitKey>* state = states + slot;
+
+    const unsigned int segment_id   = segment_indices[slot];
+    const size_t       begin_offset = begin_offsets[segment_id];
+    const size_t       end_offset   = end_offsets[segment_id];
+    const size_t       output_offset
+        = segmented_topk_output_offset<Partition>(begin_offsets, segment_id, k);
+
+    const BitKey prefix    = state->prefix;
+    const BitKey mask      = state->mask;
+    const size_t remaining = state->remaining;
+
+    for(size_t offset = begin_offset + static_cast<size_t>(block_id<1>()) * items_per_block;
+        offset < end_offset;
+        offset += static_cast<size_t>(grid_size<1>()) * items_per_block)
+    {
+        const unsigned int valid_count = static_cast<unsigned int>(
+            ::rocprim::min<size_t>(end_offset - offset, items_per_block));
+        topk_compact_tile<Config, Descending, WithValues, Partition>(
+            keys_input,
+            values_input,
+            keys_output,
+            values_output,
+            offset,
+            valid_count,
+            output_offset,
+            output_offset + (end_offset - begin_offset),
+            k,
+            prefix,
+            mask,
+            remaining,
+            counters + slot * 3);
+        // The shared counters of the tile are reset by the next one.
+        syncthreads();
+    }
+}
+
+// Selects the segments that are processed by the multi-block kernels.
+template<class Config, class OffsetIterator>
+struct segmented_topk_large_segment_op
+{
+    OffsetIterator begin_offsets;
+    OffsetIterator end_offsets;
+    unsigned int   k;
+
+    ROCPRIM_HOST_DEVICE bool operator()(const unsigned int segment_id) const
+    {
+        const size_t begin_offset = begin_offsets[segment_id];
+        const size_t end_offset   = end_offsets[segment_id];
+        const size_t segment_size = end_offset > begin_offset ? end_offset - begin_offset : 0;
+        return segment_size > get_segmented_topk_sizes(device_params<Config>()).large_segment_size
+               && segment_size > k;
+    }
+};
+
+// Output range of a segment of segmented top-k: i * k to i * k + min(k, segment size).
+template<class OffsetIterator>
+struct segmented_topk_output_range_op
+{
+    OffsetIterator begin_offsets;
+    OffsetIterator end_offsets;
+    unsigned int   k;
+    bool           end;
+
+    ROCPRIM_HOST_DEVICE unsigned int operator()(const unsigned int segment_id) const
+    {
+        const unsigned int begin_offset = begin_offsets[segment_id];
+        const unsigned int end_offset   = end_offsets[segment_id];
+        const unsigned int segment_size = end_offset > begin_offset ? end_offset - begin_offset : 0;
+        return segment_id * k + (end ? ::rocprim::min(segment_size, k) : 0u);
+    }
+};
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_TOPK_HPP_
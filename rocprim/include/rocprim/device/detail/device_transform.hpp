@@ -25,11 +25,14 @@
 #include <iterator>
 
 #include "../../config.hpp"
+#include "../../detail/all_true.hpp"
 #include "../../detail/various.hpp"
 
 #include "../../intrinsics.hpp"
 #include "../../functional.hpp"
 #include "../../types.hpp"
+#include "../../types/integer_sequence.hpp"
+#include "../../types/tuple.hpp"
 
 #include "../../block/block_load.hpp"
 #include "../../block/block_store.hpp"
@@ -67,19 +70,18 @@ private:
     BinaryFunction binary_op_;
 };
 
-template<
-    unsigned int BlockSize,
-    unsigned int ItemsPerThread,
-    class ResultType,
-    class InputIterator,
-    class OutputIterator,
-    class UnaryFunction
->
+// Transforms the valid items of a block starting at input and output
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class UnaryFunction>
 ROCPRIM_DEVICE ROCPRIM_INLINE
-void transform_kernel_impl(InputIterator input,
-                           const size_t input_size,
-                           OutputIterator output,
-                           UnaryFunction transform_op)
+void transform_block_impl(InputIterator      input,
+                          OutputIterator     output,
+                          const unsigned int valid_in_block,
+                          UnaryFunction      transform_op)
 {
     using input_type = typename std::iterator_traits<InputIterator>::value_type;
     using output_type = typename std::iterator_traits<OutputIterator>::value_type;
@@ -91,27 +93,23 @@ void transform_kernel_impl(InputIterator input,
     constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
 
     const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
-    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
-    const unsigned int block_offset = flat_block_id * items_per_block;
-    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
-    const unsigned int valid_in_last_block = input_size - block_offset;
 
     input_type input_values[ItemsPerThread];
     result_type output_values[ItemsPerThread];
 
-    if(flat_block_id == (number_of_blocks - 1)) // last block
+    if(valid_in_block < items_per_block)
     {
         block_load_direct_striped<BlockSize>(
             flat_id,
-            input + block_offset,
+            input,
             input_values,
-            valid_in_last_block
+            valid_in_block
         );
 
         ROCPRIM_UNROLL
         for(unsigned int i = 0; i < ItemsPerThread; i++)
         {
-            if(BlockSize * i + flat_id < valid_in_last_block)
+            if(BlockSize * i + flat_id < valid_in_block)
             {
                 output_values[i] = transform_op(input_values[i]);
             }
@@ -119,16 +117,16 @@ void transform_kernel_impl(InputIterator input,
 
         block_store_direct_striped<BlockSize>(
             flat_id,
-            output + block_offset,
+            output,
             output_values,
-            valid_in_last_block
+            valid_in_block
         );
     }
     else
     {
         block_load_direct_striped<BlockSize>(
             flat_id,
-            input + block_offset,
+            input,
             input_values
         );
 
@@ -140,12 +138,448 @@ void transform_kernel_impl(InputIterator input,
 
         block_store_direct_striped<BlockSize>(
             flat_id,
-            output + block_offset,
+            output,
             output_values
         );
     }
 }
 
+template<
+    unsigned int BlockSize,
+    unsigned int ItemsPerThread,
+    class ResultType,
+    class InputIterator,
+    class OutputIterator,
+    class UnaryFunction
+>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void transform_kernel_impl(InputIterator input,
+                           const size_t input_size,
+                           OutputIterator output,
+                           UnaryFunction transform_op)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const unsigned int flat_block_id = ::rocprim::detail::block_id<0>();
+    const unsigned int block_offset = flat_block_id * items_per_block;
+    const unsigned int number_of_blocks = ::rocprim::detail::grid_size<0>();
+    const unsigned int valid_in_block = flat_block_id == (number_of_blocks - 1)
+                                            ? input_size - block_offset
+                                            : items_per_block;
+
+    transform_block_impl<BlockSize, ItemsPerThread, ResultType>(input + block_offset,
+                                                                output + block_offset,
+                                                                valid_in_block,
+                                                                transform_op);
+}
+
+// Transforms the items of a launch over a part of the most items possible, where the actual
+// number of items is only known on the device. Blocks past the end exit right away.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class UnaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void transform_future_size_kernel_impl(InputIterator  input,
+                                       const size_t   launch_offset,
+                                       const size_t   input_size,
+                                       OutputIterator output,
+                                       UnaryFunction  transform_op)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const size_t block_offset
+        = launch_offset + size_t(::rocprim::detail::block_id<0>()) * items_per_block;
+    if(block_offset >= input_size)
+    {
+        return;
+    }
+    const unsigned int valid_in_block
+        = static_cast<unsigned int>(::rocprim::min<size_t>(input_size - block_offset,
+                                                           items_per_block));
+
+    transform_block_impl<BlockSize, ItemsPerThread, ResultType>(input + block_offset,
+                                                                output + block_offset,
+                                                                valid_in_block,
+                                                                transform_op);
+}
+
+// Transforms the items with a persistent grid, where each block processes the tiles with a
+// stride of the grid size. The loads of the next PrefetchTiles tiles of a block are issued
+// before the current tile is transformed, so that they are in flight during the transformation
+// and the stores of the current tile. The buffers of the tiles rotate through the iterations of
+// an unrolled loop, so they stay in registers. The last tile, if it is partial, is transformed
+// by the block that would have processed it next.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int PrefetchTiles,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class UnaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void transform_prefetch_kernel_impl(InputIterator  input,
+                                    const size_t   input_size,
+                                    OutputIterator output,
+                                    UnaryFunction  transform_op)
+{
+    using input_type  = typename std::iterator_traits<InputIterator>::value_type;
+    using output_type = typename std::iterator_traits<OutputIterator>::value_type;
+    using result_type =
+        typename std::conditional<std::is_void<output_type>::value, ResultType, output_type>::
+            type;
+
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    constexpr unsigned int buffers         = PrefetchTiles + 1;
+
+    const unsigned int flat_id    = ::rocprim::detail::block_thread_id<0>();
+    const size_t       first_tile = ::rocprim::detail::block_id<0>();
+    const size_t       stride     = ::rocprim::detail::grid_size<0>();
+    const size_t       full_tiles = input_size / items_per_block;
+
+    input_type input_values[buffers][ItemsPerThread];
+
+    ROCPRIM_UNROLL
+    for(unsigned int buffer = 0; buffer < PrefetchTiles; buffer++)
+    {
+        const size_t tile = first_tile + buffer * stride;
+        if(tile < full_tiles)
+        {
+            block_load_direct_striped<BlockSize>(flat_id,
+                                                 input + tile * items_per_block,
+                                                 input_values[buffer]);
+        }
+    }
+
+    for(size_t tiles = first_tile; tiles < full_tiles; tiles += buffers * stride)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int buffer = 0; buffer < buffers; buffer++)
+        {
+            const size_t tile = tiles + buffer * stride;
+            if(tile >= full_tiles)
+            {
+                break;
+            }
+            const size_t prefetch_tile = tile + PrefetchTiles * stride;
+            if(prefetch_tile < full_tiles)
+            {
+                block_load_direct_striped<BlockSize>(
+                    flat_id,
+                    input + prefetch_tile * items_per_block,
+                    input_values[(buffer + PrefetchTiles) % buffers]);
+            }
+
+            result_type output_values[ItemsPerThread];
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; i++)
+            {
+                output_values[i] = transform_op(input_values[buffer][i]);
+            }
+            block_store_direct_striped<BlockSize>(flat_id,
+                                                  output + tile * items_per_block,
+                                                  output_values);
+        }
+    }
+
+    const size_t       last_offset   = full_tiles * items_per_block;
+    const unsigned int valid_in_last = static_cast<unsigned int>(input_size - last_offset);
+    if(valid_in_last != 0 && first_tile == full_tiles % stride)
+    {
+        transform_block_impl<BlockSize, ItemsPerThread, ResultType>(input + last_offset,
+                                                                    output + last_offset,
+                                                                    valid_in_last,
+                                                                    transform_op);
+    }
+}
+
+// Multi-input transforms where all inputs and outputs are pointers use a blocked arrangement,
+// so that the items of a thread are loaded and stored with vector accesses. Other iterators
+// use a striped arrangement.
+template<class... Iterators>
+using multi_transform_blocked = all_true<std::is_pointer<Iterators>::value...>;
+
+template<bool Blocked, unsigned int BlockSize, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned int multi_transform_index(const unsigned int flat_id, const unsigned int item)
+{
+    return Blocked ? flat_id * ItemsPerThread + item : item * BlockSize + flat_id;
+}
+
+template<unsigned int BlockSize, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void multi_transform_load(std::true_type /*blocked*/,
+                          const unsigned int flat_id,
+                          T*                 input,
+                          U (&items)[ItemsPerThread],
+                          const unsigned int valid)
+{
+    if(valid == BlockSize * ItemsPerThread)
+    {
+        block_load_direct_blocked_vectorized(flat_id, input, items);
+    }
+    else
+    {
+        block_load_direct_blocked(flat_id, input, items, valid);
+    }
+}
+
+template<unsigned int BlockSize, class InputIterator, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void multi_transform_load(std::false_type /*blocked*/,
+                          const unsigned int flat_id,
+                          InputIterator      input,
+                          U (&items)[ItemsPerThread],
+                          const unsigned int valid)
+{
+    if(valid == BlockSize * ItemsPerThread)
+    {
+        block_load_direct_striped<BlockSize>(flat_id, input, items);
+    }
+    else
+    {
+        block_load_direct_striped<BlockSize>(flat_id, input, items, valid);
+    }
+}
+
+template<unsigned int BlockSize, class T, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void multi_transform_store(std::true_type /*blocked*/,
+                           const unsigned int flat_id,
+                           T*                 output,
+                           U (&items)[ItemsPerThread],
+                           const unsigned int valid)
+{
+    if(valid == BlockSize * ItemsPerThread)
+    {
+        block_store_direct_blocked_vectorized(flat_id, output, items);
+    }
+    else
+    {
+        block_store_direct_blocked(flat_id, output, items, valid);
+    }
+}
+
+template<unsigned int BlockSize, class OutputIterator, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void multi_transform_store(std::false_type /*blocked*/,
+                           const unsigned int flat_id,
+                           OutputIterator     output,
+                           U (&items)[ItemsPerThread],
+                           const unsigned int valid)
+{
+    if(valid == BlockSize * ItemsPerThread)
+    {
+        block_store_direct_striped<BlockSize>(flat_id, output, items);
+    }
+    else
+    {
+        block_store_direct_striped<BlockSize>(flat_id, output, items, valid);
+    }
+}
+
+// Loads one input of a multi-input transform into its element of the tuples of the items
+template<size_t Index,
+         bool         Blocked,
+         unsigned int BlockSize,
+         class InputIterator,
+         class Values,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void multi_transform_load_input(const unsigned int flat_id,
+                                InputIterator      input,
+                                Values (&values)[ItemsPerThread],
+                                const unsigned int valid)
+{
+    using value_type = typename ::rocprim::tuple_element<Index, Values>::type;
+
+    value_type items[ItemsPerThread];
+    multi_transform_load<BlockSize>(std::integral_constant<bool, Blocked>{},
+                                    flat_id,
+                                    input,
+                                    items,
+                                    valid);
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        ::rocprim::get<Index>(values[i]) = items[i];
+    }
+}
+
+// Stores one output of a multi-input transform from its element of the tuples of the results.
+// Masked stores skip the results whose flag is not set.
+template<size_t Index,
+         bool         Blocked,
+         bool         Masked,
+         unsigned int BlockSize,
+         class OutputIterator,
+         class Results,
+         unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void multi_transform_store_output(const unsigned int flat_id,
+                                  OutputIterator     output,
+                                  Results (&results)[ItemsPerThread],
+                                  const bool (&flags)[ItemsPerThread],
+                                  const unsigned int valid)
+{
+    using result_type = typename ::rocprim::tuple_element<Index, Results>::type;
+
+    if ROCPRIM_IF_CONSTEXPR(Masked)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            const unsigned int index
+                = multi_transform_index<Blocked, BlockSize, ItemsPerThread>(flat_id, i);
+            if(index < valid && flags[i])
+            {
+                output[index] = ::rocprim::get<Index>(results[i]);
+            }
+        }
+    }
+    else
+    {
+        result_type items[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+        {
+            items[i] = ::rocprim::get<Index>(results[i]);
+        }
+        multi_transform_store<BlockSize>(std::integral_constant<bool, Blocked>{},
+                                         flat_id,
+                                         output,
+                                         items,
+                                         valid);
+    }
+}
+
+template<class Function, class Values, size_t... Indices>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto multi_transform_apply(Function& function,
+                           const Values& values,
+                           ::rocprim::index_sequence<Indices...>)
+    -> decltype(function(::rocprim::get<Indices>(values)...))
+{
+    return function(::rocprim::get<Indices>(values)...);
+}
+
+// Predicate of the multi-input transforms without masked stores
+struct multi_transform_no_mask
+{
+    template<class... Values>
+    ROCPRIM_HOST_DEVICE bool operator()(const Values&...) const
+    {
+        return true;
+    }
+};
+
+// Transforms a tile of a multi-input transform. Every input is loaded with its own block load,
+// the transform function is called with the items of all inputs and returns a tuple of the items
+// of all outputs, which are stored with their own block stores.
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         bool         Masked,
+         class... InputIterators,
+         class... OutputIterators,
+         class Function,
+         class Predicate,
+         size_t... InputIndices,
+         size_t... OutputIndices>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void multi_transform_tile(const ::rocprim::tuple<InputIterators...>&  inputs,
+                          const ::rocprim::tuple<OutputIterators...>& outputs,
+                          const size_t                                block_offset,
+                          const unsigned int                          valid,
+                          Function                                    transform_op,
+                          Predicate                                   predicate,
+                          ::rocprim::index_sequence<InputIndices...>  input_indices,
+                          ::rocprim::index_sequence<OutputIndices...> /*output_indices*/)
+{
+    constexpr bool blocked
+        = multi_transform_blocked<InputIterators..., OutputIterators...>::value;
+
+    using values_type
+        = ::rocprim::tuple<typename std::iterator_traits<InputIterators>::value_type...>;
+    using results_type = typename ::rocprim::invoke_result<
+        Function,
+        typename std::iterator_traits<InputIterators>::value_type...>::type;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    values_type values[ItemsPerThread];
+    int         load_swallow[] = {
+        (multi_transform_load_input<InputIndices, blocked, BlockSize>(
+             flat_id,
+             ::rocprim::get<InputIndices>(inputs) + block_offset,
+             values,
+             valid),
+         0)...};
+    (void)load_swallow;
+
+    results_type results[ItemsPerThread];
+    bool         flags[ItemsPerThread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        const unsigned int index
+            = multi_transform_index<blocked, BlockSize, ItemsPerThread>(flat_id, i);
+        flags[i] = index < valid;
+        if ROCPRIM_IF_CONSTEXPR(Masked)
+        {
+            flags[i] = flags[i] && multi_transform_apply(predicate, values[i], input_indices);
+        }
+        if(flags[i])
+        {
+            results[i] = multi_transform_apply(transform_op, values[i], input_indices);
+        }
+    }
+
+    int store_swallow[] = {
+        (multi_transform_store_output<OutputIndices, blocked, Masked, BlockSize>(
+             flat_id,
+             ::rocprim::get<OutputIndices>(outputs) + block_offset,
+             results,
+             flags,
+             valid),
+         0)...};
+    (void)store_swallow;
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         bool         Masked,
+         class InputTuple,
+         class OutputTuple,
+         class Function,
+         class Predicate>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void multi_transform_kernel_impl(const InputTuple  inputs,
+                                 const OutputTuple outputs,
+                                 const size_t      launch_offset,
+                                 const size_t      size,
+                                 Function          transform_op,
+                                 Predicate         predicate)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    const size_t block_offset
+        = launch_offset + size_t(::rocprim::detail::block_id<0>()) * items_per_block;
+    const unsigned int valid_in_block
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    multi_transform_tile<BlockSize, ItemsPerThread, Masked>(
+        inputs,
+        outputs,
+        block_offset,
+        valid_in_block,
+        transform_op,
+        predicate,
+        ::rocprim::make_index_sequence<::rocprim::tuple_size<InputTuple>::value>{},
+        ::rocprim::make_index_sequence<::rocprim::tuple_size<OutputTuple>::value>{});
+}
+
 } // end of detail namespace
 
 END_ROCPRIM_NAMESPACE
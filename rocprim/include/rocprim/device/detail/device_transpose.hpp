@@ -0,0 +1,106 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_DEVICE_TRANSPOSE_HPP_
+#define ROCPRIM_DEVICE_DETAIL_DEVICE_TRANSPOSE_HPP_
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+#include "../../intrinsics.hpp"
+#include "../../types/uninitialized_array.hpp"
+
+#include <iterator>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Position of the item (row, column) of a tile in shared memory. The columns of every row are
+// permuted by the row, so both the rows and the columns of the tile map to distinct banks.
+template<unsigned int TileSize>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned int transpose_tile_position(const unsigned int row, const unsigned int column)
+{
+    return row * TileSize + (column ^ row);
+}
+
+// Every block transposes one tile of one matrix: the rows of the tile are loaded with
+// consecutive threads on consecutive columns, and the columns are stored the same way as the
+// rows of the output. The tiles of a matrix are numbered by rows of tiles.
+template<unsigned int TileSize,
+         unsigned int BlockRows,
+         class InputIterator,
+         class OutputIterator>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void transpose_kernel_impl(InputIterator  input,
+                           OutputIterator output,
+                           const size_t   rows,
+                           const size_t   columns,
+                           const size_t   tile_columns,
+                           const size_t   tile_offset,
+                           const size_t   batch_offset)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    ROCPRIM_SHARED_MEMORY uninitialized_array<value_type, TileSize * TileSize> tile_storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int x       = flat_id % TileSize;
+    const unsigned int y       = flat_id / TileSize;
+
+    const size_t tile   = tile_offset + ::rocprim::detail::block_id<0>();
+    const size_t batch  = batch_offset + ::rocprim::detail::block_id<1>();
+    const size_t row    = (tile / tile_columns) * TileSize;
+    const size_t column = (tile % tile_columns) * TileSize;
+
+    input += batch * rows * columns;
+    output += batch * rows * columns;
+
+    const bool full_tile = row + TileSize <= rows && column + TileSize <= columns;
+
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < TileSize; i += BlockRows)
+    {
+        if(full_tile || (row + y + i < rows && column + x < columns))
+        {
+            tile_storage.emplace(transpose_tile_position<TileSize>(y + i, x),
+                                 input[(row + y + i) * columns + column + x]);
+        }
+    }
+    ::rocprim::syncthreads();
+
+    auto& tile_items = tile_storage.get_unsafe_array();
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < TileSize; i += BlockRows)
+    {
+        if(full_tile || (column + y + i < columns && row + x < rows))
+        {
+            output[(column + y + i) * rows + row + x]
+                = tile_items[transpose_tile_position<TileSize>(x, y + i)];
+        }
+    }
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_DEVICE_TRANSPOSE_HPP_
@@ -0,0 +1,76 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_GRID_BARRIER_HPP_
+#define ROCPRIM_DEVICE_DETAIL_GRID_BARRIER_HPP_
+
+#include "../../config.hpp"
+#include "../../intrinsics.hpp"
+
+extern "C" {
+void __builtin_amdgcn_s_sleep(int);
+}
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Device-wide barrier of a grid whose blocks are all resident at once, which only
+// a cooperative launch guarantees. The counter is zero before the first barrier and only
+// grows, so it is not reset between barriers: the arrivals of all barriers of a launch, the
+// number of barriers times the grid size, must fit in it.
+struct grid_barrier
+{
+    static constexpr unsigned int storage_size = sizeof(unsigned int);
+
+    // The barriers passed by the block
+    unsigned int  passed;
+    unsigned int* counter;
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    explicit grid_barrier(unsigned int* counter) : passed(0), counter(counter) {}
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sync()
+    {
+        ::rocprim::syncthreads();
+        passed++;
+        if(::rocprim::flat_block_thread_id() == 0)
+        {
+            const unsigned int arrivals = passed * ::rocprim::detail::grid_size<0>();
+            // Publish the writes of the block, and see those of the other blocks after the wait
+            ::rocprim::detail::memory_fence_device();
+            ::rocprim::detail::atomic_add(counter, 1);
+            while(::rocprim::detail::atomic_load(counter) < arrivals)
+            {
+                __builtin_amdgcn_s_sleep(1);
+            }
+            ::rocprim::detail::memory_fence_device();
+        }
+        ::rocprim::syncthreads();
+    }
+};
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_GRID_BARRIER_HPP_
@@ -0,0 +1,174 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_LOOKBACK_BACKOFF_HPP_
+#define ROCPRIM_DEVICE_DETAIL_LOOKBACK_BACKOFF_HPP_
+
+#include "../../config.hpp"
+#include "../../functional.hpp"
+
+extern "C" {
+void __builtin_amdgcn_s_sleep(int);
+}
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief How the look-back of single-pass scans waits for a preceding tile whose state has not
+/// been published yet.
+enum class lookback_backoff_kind : unsigned int
+{
+    /// Use the default policy of the architecture of the device, which currently polls again
+    /// immediately on all architectures.
+    default_backoff,
+    /// Poll again immediately.
+    none,
+    /// Sleep for a fixed time between polls.
+    fixed,
+    /// Sleep between polls, doubling the time after each poll up to a maximum.
+    exponential,
+    /// Poll immediately a number of times, then sleep for a fixed time between polls.
+    yield_after,
+};
+
+namespace detail
+{
+
+struct lookback_backoff_params
+{
+    lookback_backoff_kind kind = lookback_backoff_kind::default_backoff;
+    // Sleep time, in units of about 64 clock cycles (one s_sleep 1).
+    unsigned int sleep = 1;
+    // Largest sleep time of exponential.
+    unsigned int max_sleep = 1;
+    // Polls without sleeping of yield_after.
+    unsigned int spins = 0;
+};
+
+} // namespace detail
+
+/// \brief Configuration of the backoff of look-back scans.
+///
+/// Sleeping lets other waves on the compute unit, and other kernels on the device, use the
+/// memory bandwidth that tight polling of the look-back state would take, at the cost of
+/// latency when the state becomes available during the sleep.
+///
+/// \tparam Kind - the kind of backoff.
+/// \tparam Sleep - sleep time between polls of \p fixed and \p yield_after, and initial sleep
+/// time of \p exponential, in units of about 64 clock cycles.
+/// \tparam MaxSleep - largest sleep time of \p exponential.
+/// \tparam Spins - number of polls without sleeping of \p yield_after.
+template<lookback_backoff_kind Kind     = lookback_backoff_kind::default_backoff,
+         unsigned int          Sleep    = 1,
+         unsigned int          MaxSleep = Sleep,
+         unsigned int          Spins    = 0>
+struct lookback_backoff_config : detail::lookback_backoff_params
+{
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    static_assert(Kind == lookback_backoff_kind::default_backoff
+                      || Kind == lookback_backoff_kind::none || Sleep > 0,
+                  "A sleeping backoff must sleep for at least one unit.");
+    static_assert(MaxSleep >= Sleep, "MaxSleep must not be less than Sleep.");
+
+    constexpr lookback_backoff_config()
+        : detail::lookback_backoff_params{Kind, Sleep, MaxSleep, Spins} {};
+#endif
+};
+
+/// \brief Look-back backoff that polls again immediately.
+using lookback_backoff_none = lookback_backoff_config<lookback_backoff_kind::none>;
+
+/// \brief Look-back backoff that sleeps for \p Sleep units between polls.
+template<unsigned int Sleep = 1>
+using lookback_backoff_fixed = lookback_backoff_config<lookback_backoff_kind::fixed, Sleep>;
+
+/// \brief Look-back backoff that sleeps for \p Sleep units after the first poll, doubling the
+/// time after each poll up to \p MaxSleep units.
+template<unsigned int Sleep = 1, unsigned int MaxSleep = 32>
+using lookback_backoff_exponential
+    = lookback_backoff_config<lookback_backoff_kind::exponential, Sleep, MaxSleep>;
+
+/// \brief Look-back backoff that polls \p Spins times without sleeping, then sleeps for
+/// \p Sleep units between polls.
+template<unsigned int Spins = 16, unsigned int Sleep = 1>
+using lookback_backoff_yield_after
+    = lookback_backoff_config<lookback_backoff_kind::yield_after, Sleep, Sleep, Spins>;
+
+namespace detail
+{
+
+ROCPRIM_DEVICE ROCPRIM_INLINE void lookback_sleep(const unsigned int units)
+{
+    // s_sleep only takes an immediate operand
+    for(unsigned int i = 0; i < units; ++i)
+    {
+        __builtin_amdgcn_s_sleep(1);
+    }
+}
+
+// The backoff of one loop polling the state of a preceding tile. It is called after each poll
+// that found the state empty, so look-backs that do not wait pay nothing. default_backoff must
+// be resolved on the host (see resolve_lookback_backoff), here it does not sleep.
+class lookback_backoff
+{
+public:
+    ROCPRIM_DEVICE ROCPRIM_INLINE explicit lookback_backoff(const lookback_backoff_params& params)
+        : params_(params), polls_(0), sleep_(params.sleep)
+    {}
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE void operator()()
+    {
+        switch(params_.kind)
+        {
+            case lookback_backoff_kind::fixed: lookback_sleep(params_.sleep); break;
+            case lookback_backoff_kind::exponential:
+                lookback_sleep(sleep_);
+                sleep_ = ::rocprim::min(2 * sleep_, params_.max_sleep);
+                break;
+            case lookback_backoff_kind::yield_after:
+                if(polls_ < params_.spins)
+                {
+                    ++polls_;
+                }
+                else
+                {
+                    lookback_sleep(params_.sleep);
+                }
+                break;
+            default: break;
+        }
+    }
+
+private:
+    lookback_backoff_params params_;
+    unsigned int            polls_;
+    unsigned int            sleep_;
+};
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_DETAIL_LOOKBACK_BACKOFF_HPP_
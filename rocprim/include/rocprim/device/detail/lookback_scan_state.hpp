@@ -37,6 +37,10 @@
 #include "../../detail/various.hpp"
 
 #include "../config_types.hpp"
+#include "../diagnostics.hpp"
+#include "config/lookback_backoff.hpp"
+#include "lookback_backoff.hpp"
+#include "lookback_telemetry.hpp"
 #include "rocprim/config.hpp"
 
 // This version is specific for devices with slow __threadfence ("agent" fence which does
@@ -54,9 +58,6 @@
     #endif
 #endif // ROCPRIM_DETAIL_LOOKBACK_SCAN_STATE_WITHOUT_SLOW_FENCES
 
-extern "C" {
-void __builtin_amdgcn_s_sleep(int);
-}
 BEGIN_ROCPRIM_NAMESPACE
 
 // Single pass prefix scan was implemented based on:
@@ -78,6 +79,18 @@ enum class prefix_flag : uint8_t
     COMPLETE = 2
 };
 
+// Records a lookback_timeout diagnostic when a look-back has polled a tile
+// lookback_timeout_spins times.
+ROCPRIM_DEVICE ROCPRIM_INLINE void record_lookback_timeout(const diagnostics_view& diagnostics,
+                                                           const unsigned int      tile,
+                                                           const unsigned int      spins)
+{
+    if(spins == lookback_timeout_spins)
+    {
+        diagnostics.record(diagnostic_code::lookback_timeout, tile);
+    }
+}
+
 template<typename T>
 struct match_prefix_underlying_type
 {
@@ -107,11 +120,33 @@ enum class lookback_scan_determinism
     default_determinism = nondeterministic,
 };
 
+// How lookback_scan_state stores the flags and the prefixes of the blocks.
+enum class lookback_scan_state_layout
+{
+    // The flag and the prefix are packed into one word of at most 64 bits.
+    packed,
+    // Every 32-bit word of the prefixes is stored together with the flag in a 64-bit word.
+    tagged,
+    // The flags and the prefixes are stored in separate arrays, ordered by fences.
+    separate,
+};
+
+// Values of up to 32 bytes use the tagged layout: the partial and complete prefixes of a block
+// then fit into one 128-byte cache line.
+template<class T>
+constexpr lookback_scan_state_layout default_lookback_scan_state_layout()
+{
+    return sizeof(T) <= 7    ? lookback_scan_state_layout::packed
+           : sizeof(T) <= 32 ? lookback_scan_state_layout::tagged
+                             : lookback_scan_state_layout::separate;
+}
+
 // lookback_scan_state object keeps track of prefixes status for
 // a look-back prefix scan. Initially every prefix can be either
 // invalid (padding values) or empty. One thread in a block should
-// later set it to partial, and later to complete.
-template<class T, bool UseSleep = false, bool IsSmall = (sizeof(T) <= 7)>
+// later set it to partial, and later to complete. The loops waiting for an empty prefix use the
+// backoff given to create().
+template<class T, lookback_scan_state_layout Layout = default_lookback_scan_state_layout<T>()>
 struct lookback_scan_state;
 
 /// Reduce lanes `0-valid_items` and return the result in lane 0.
@@ -177,8 +212,8 @@ ROCPRIM_DEVICE ROCPRIM_INLINE T lookback_reduce_forward(F scan_op, T prefix, T b
 }
 
 // Packed flag and prefix value are loaded/stored in one atomic operation.
-template<class T, bool UseSleep>
-struct lookback_scan_state<T, UseSleep, true>
+template<class T>
+struct lookback_scan_state<T, lookback_scan_state_layout::packed>
 {
 private:
     // Type which is used in store/load operations of block prefix (flag and value).
@@ -198,17 +233,19 @@ public:
     // Type used for flag/flag of block prefix
     using value_type = T;
 
-    static constexpr bool use_sleep = UseSleep;
-
     // temp_storage must point to allocation of get_storage_size(number_of_blocks) bytes
-    ROCPRIM_HOST static inline hipError_t create(lookback_scan_state& state,
-                                                 void*                temp_storage,
-                                                 const unsigned int   number_of_blocks,
-                                                 const hipStream_t /*stream*/)
+    ROCPRIM_HOST static inline hipError_t
+        create(lookback_scan_state&           state,
+               void*                          temp_storage,
+               const unsigned int             number_of_blocks,
+               const hipStream_t              stream,
+               const lookback_backoff_params& backoff = lookback_backoff_config<>())
     {
         (void)number_of_blocks;
-        state.prefixes = reinterpret_cast<prefix_underlying_type*>(temp_storage);
-        return hipSuccess;
+        state.prefixes  = reinterpret_cast<prefix_underlying_type*>(temp_storage);
+        state.telemetry   = lookback_telemetry::current();
+        state.diagnostics = diagnostics_view::current();
+        return resolve_lookback_backoff(stream, backoff, state.backoff);
     }
 
     [[deprecated(
@@ -303,24 +340,21 @@ public:
 
         prefix_type prefix;
 
-        const unsigned int SLEEP_MAX     = 32;
-        unsigned int       times_through = 1;
+        lookback_backoff wait(backoff);
+        unsigned int     spins = 0;
 
         prefix_underlying_type p = ::rocprim::detail::atomic_load(&prefixes[padding + block_id]);
         memcpy(&prefix, &p, sizeof(prefix_type));
         while(prefix.flag == prefix_flag::EMPTY)
         {
-            if ROCPRIM_IF_CONSTEXPR(UseSleep)
-            {
-                for(unsigned int j = 0; j < times_through; j++)
-                    __builtin_amdgcn_s_sleep(1);
-                if(times_through < SLEEP_MAX)
-                    times_through++;
-            }
+            ++spins;
+            record_lookback_timeout(diagnostics, block_id, spins);
+            wait();
             prefix_underlying_type p
                 = ::rocprim::detail::atomic_load(&prefixes[padding + block_id]);
             memcpy(&prefix, &p, sizeof(prefix_type));
         }
+        telemetry.add_wait_spins(block_id, spins);
 
         // return
         flag  = prefix.flag;
@@ -339,6 +373,27 @@ public:
         return prefix.value;
     }
 
+    // Records how far the look-back of block_id went, given the block id checked by each lane
+    // and the lowest lane that found a complete prefix. It must be called by the whole warp, and
+    // does nothing without ROCPRIM_DETAIL_LOOKBACK_TELEMETRY.
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        record_lookback_distance(const unsigned int block_id,
+                                 const unsigned int lookback_block_id,
+                                 const unsigned int complete_lane)
+    {
+#if ROCPRIM_DETAIL_LOOKBACK_TELEMETRY
+        const unsigned int complete_id = warp_shuffle(lookback_block_id, complete_lane);
+        if(::rocprim::lane_id() == 0)
+        {
+            telemetry.record_distance(block_id, block_id - complete_id);
+        }
+#else
+        (void)block_id;
+        (void)lookback_block_id;
+        (void)complete_lane;
+#endif
+    }
+
     template<typename F>
     ROCPRIM_DEVICE ROCPRIM_INLINE T get_prefix_forward(F scan_op, unsigned int block_id_)
     {
@@ -398,6 +453,7 @@ public:
         // offset at the lowest warp number that has prefix_flag::COMPLETE set.
         const auto bits   = ballot(flag == prefix_flag::COMPLETE);
         const auto lowest = ctz(bits);
+        record_lookback_distance(block_id_, lookback_block_id, lowest);
 
         // Now sum all the values from block_prefix that are lower than the current prefix.
         T prefix = lookback_reduce_forward_init(scan_op, block_prefix, lowest);
@@ -426,28 +482,339 @@ private:
     }
 
     prefix_underlying_type* prefixes;
+    lookback_backoff_params backoff;
+    lookback_telemetry      telemetry;
+    diagnostics_view        diagnostics;
+};
+
+// Every 32-bit word of the partial and of the complete prefix is stored together with the flag
+// in a 64-bit word that is loaded/stored in one atomic operation. A prefix is published when all
+// its words carry its flag, so no fences are needed between the stores of the value and of the
+// flag, and the prefixes of a block are next to each other rather than in three arrays.
+template<class T>
+struct lookback_scan_state<T, lookback_scan_state_layout::tagged>
+{
+private:
+    using word_type = unsigned long long;
+
+    static constexpr unsigned int words_no = ceiling_div(sizeof(T), sizeof(unsigned int));
+
+    // Both prefixes are kept, because the look-back of the deterministic scan reads the partial
+    // prefix of a block after it may have been completed.
+    struct prefix_type
+    {
+        word_type partial[words_no];
+        word_type complete[words_no];
+    };
+
+public:
+    using value_type = T;
+
+    // temp_storage must point to allocation of get_storage_size(number_of_blocks) bytes
+    ROCPRIM_HOST static inline hipError_t
+        create(lookback_scan_state&           state,
+               void*                          temp_storage,
+               const unsigned int             number_of_blocks,
+               const hipStream_t              stream,
+               const lookback_backoff_params& backoff = lookback_backoff_config<>())
+    {
+        (void)number_of_blocks;
+        state.prefixes  = reinterpret_cast<prefix_type*>(temp_storage);
+        state.telemetry   = lookback_telemetry::current();
+        state.diagnostics = diagnostics_view::current();
+        return resolve_lookback_backoff(stream, backoff, state.backoff);
+    }
+
+    [[deprecated(
+        "Please use the overload returns an error code, this function assumes the default"
+        " stream and silently ignores errors.")]] ROCPRIM_HOST static inline lookback_scan_state
+        create(void* temp_storage, const unsigned int number_of_blocks)
+    {
+        lookback_scan_state result;
+        (void)create(result, temp_storage, number_of_blocks, /*default stream*/ 0);
+        return result;
+    }
+
+    ROCPRIM_HOST static inline hipError_t get_storage_size(const unsigned int number_of_blocks,
+                                                           const hipStream_t  stream,
+                                                           size_t&            storage_size)
+    {
+        unsigned int warp_size;
+        hipError_t   error = ::rocprim::host_warp_size(stream, warp_size);
+
+        storage_size = sizeof(prefix_type) * (warp_size + number_of_blocks);
+
+        return error;
+    }
+
+    [[deprecated("Please use the overload returns an error code, this function assumes the default"
+                 " stream and silently ignores errors.")]] ROCPRIM_HOST static inline size_t
+        get_storage_size(const unsigned int number_of_blocks)
+    {
+        size_t result;
+        (void)get_storage_size(number_of_blocks, /*default stream*/ 0, result);
+        return result;
+    }
+
+    ROCPRIM_HOST static inline hipError_t
+        get_temp_storage_layout(const unsigned int            number_of_blocks,
+                                const hipStream_t             stream,
+                                detail::temp_storage::layout& layout)
+    {
+        size_t     storage_size = 0;
+        hipError_t error        = get_storage_size(number_of_blocks, stream, storage_size);
+        layout = detail::temp_storage::layout{storage_size, alignof(prefix_type)};
+        return error;
+    }
+
+    [[deprecated("Please use the overload returns an error code, this function assumes the default"
+                 " stream and silently ignores errors.")]] ROCPRIM_HOST static inline detail::
+        temp_storage::layout
+        get_temp_storage_layout(const unsigned int number_of_blocks)
+    {
+        detail::temp_storage::layout result;
+        (void)get_temp_storage_layout(number_of_blocks, /*default stream*/ 0, result);
+        return result;
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE void initialize_prefix(const unsigned int block_id,
+                                                         const unsigned int number_of_blocks)
+    {
+        constexpr unsigned int padding = ::rocprim::device_warp_size();
+
+        // All words are reset, a word left from a previous launch would complete a prefix
+        if(block_id < number_of_blocks)
+        {
+            reset(prefixes[padding + block_id], prefix_flag::EMPTY);
+        }
+        if(block_id < padding)
+        {
+            reset(prefixes[block_id], prefix_flag::INVALID);
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE void set_partial(const unsigned int block_id, const T value)
+    {
+        constexpr unsigned int padding = ::rocprim::device_warp_size();
+        store_words(prefixes[padding + block_id].partial, prefix_flag::PARTIAL, value);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE void set_complete(const unsigned int block_id, const T value)
+    {
+        constexpr unsigned int padding = ::rocprim::device_warp_size();
+        store_words(prefixes[padding + block_id].complete, prefix_flag::COMPLETE, value);
+    }
+
+    // block_id must be > 0
+    ROCPRIM_DEVICE ROCPRIM_INLINE void get(const unsigned int block_id, prefix_flag& flag, T& value)
+    {
+        lookback_backoff wait(backoff);
+        unsigned int     spins = 0;
+
+        flag = load(block_id, value);
+        while(flag == prefix_flag::EMPTY)
+        {
+            ++spins;
+            record_lookback_timeout(diagnostics, block_id, spins);
+            wait();
+            flag = load(block_id, value);
+        }
+        telemetry.add_wait_spins(block_id, spins);
+    }
+
+    /// \brief Gets the prefix value for a block. Should only be called after all
+    /// blocks/prefixes are completed.
+    ROCPRIM_DEVICE ROCPRIM_INLINE T get_complete_value(const unsigned int block_id)
+    {
+        constexpr unsigned int padding = ::rocprim::device_warp_size();
+
+        T value;
+        load_words(prefixes[padding + block_id].complete, value);
+        return value;
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE T get_partial_value(const unsigned int block_id)
+    {
+        constexpr unsigned int padding = ::rocprim::device_warp_size();
+
+        T value;
+        load_words(prefixes[padding + block_id].partial, value);
+        return value;
+    }
+
+    // Records how far the look-back of block_id went, given the block id checked by each lane
+    // and the lowest lane that found a complete prefix. It must be called by the whole warp, and
+    // does nothing without ROCPRIM_DETAIL_LOOKBACK_TELEMETRY.
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        record_lookback_distance(const unsigned int block_id,
+                                 const unsigned int lookback_block_id,
+                                 const unsigned int complete_lane)
+    {
+#if ROCPRIM_DETAIL_LOOKBACK_TELEMETRY
+        const unsigned int complete_id = warp_shuffle(lookback_block_id, complete_lane);
+        if(::rocprim::lane_id() == 0)
+        {
+            telemetry.record_distance(block_id, block_id - complete_id);
+        }
+#else
+        (void)block_id;
+        (void)lookback_block_id;
+        (void)complete_lane;
+#endif
+    }
+
+    template<typename F>
+    ROCPRIM_DEVICE ROCPRIM_INLINE T get_prefix_forward(F scan_op, unsigned int block_id_)
+    {
+        unsigned int lookback_block_id = block_id_ - lane_id() - 1;
+
+        int cache_offset = 0;
+
+        prefix_flag flag;
+        T           block_prefix;
+        this->get(lookback_block_id, flag, block_prefix);
+
+        while(warp_all(flag != prefix_flag::COMPLETE && flag != prefix_flag::INVALID))
+        {
+            ++cache_offset;
+            lookback_block_id -= device_warp_size();
+            this->get(lookback_block_id, flag, block_prefix);
+        }
+
+        // If no flags are complete, some lanes have hit the padding. If all of them have,
+        // we need to go forward one block and pop one invalid item off the cache. Then wait
+        // until any of the flags pointed to by lookback_block_id changes to complete.
+        if(warp_all(flag != prefix_flag::COMPLETE))
+        {
+            if(warp_all(flag == prefix_flag::INVALID))
+            {
+                // All invalid, so we have to move one block back to
+                // get back to known civilization.
+                // Don't forget to pop one item off the cache too.
+                lookback_block_id += device_warp_size();
+                --cache_offset;
+            }
+
+            do
+            {
+                this->get(lookback_block_id, flag, block_prefix);
+            }
+            while(warp_all(flag != prefix_flag::COMPLETE));
+        }
+
+        // Now just sum all these values to get the prefix
+        // Note that the values are striped across the threads.
+        // In the first iteration, the current prefix is at the value cache for the current
+        // offset at the lowest warp number that has prefix_flag::COMPLETE set.
+        const auto bits   = ballot(flag == prefix_flag::COMPLETE);
+        const auto lowest = ctz(bits);
+        record_lookback_distance(block_id_, lookback_block_id, lowest);
+
+        // Now sum all the values from block_prefix that are lower than the current prefix.
+        T prefix = lookback_reduce_forward_init(scan_op, block_prefix, lowest);
+
+        // Now sum all from the prior cache.
+        // These are all guaranteed to be PARTIAL
+        while(cache_offset > 0)
+        {
+            lookback_block_id += device_warp_size();
+            --cache_offset;
+            block_prefix = this->get_partial_value(lookback_block_id);
+            prefix       = lookback_reduce_forward(scan_op, prefix, block_prefix);
+        }
+
+        return warp_readfirstlane(prefix);
+    }
+
+private:
+    ROCPRIM_DEVICE ROCPRIM_INLINE static void reset(prefix_type& prefix, const prefix_flag flag)
+    {
+        const word_type word = static_cast<word_type>(flag) << 32;
+        for(unsigned int i = 0; i < words_no; ++i)
+        {
+            prefix.partial[i]  = word;
+            prefix.complete[i] = word;
+        }
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE static void
+        store_words(word_type* words, const prefix_flag flag, const T value)
+    {
+        unsigned int v[words_no] = {};
+        __builtin_memcpy(v, &value, sizeof(value));
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < words_no; ++i)
+        {
+            ::rocprim::detail::atomic_store(&words[i],
+                                            (static_cast<word_type>(flag) << 32) | v[i]);
+        }
+    }
+
+    // Returns the flag carried by all words, or EMPTY if they do not carry the same flag yet.
+    ROCPRIM_DEVICE ROCPRIM_INLINE static prefix_flag load_words(const word_type* words, T& value)
+    {
+        unsigned int v[words_no];
+        word_type    tag  = 0;
+        bool         same = true;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < words_no; ++i)
+        {
+            const word_type word = ::rocprim::detail::atomic_load(&words[i]);
+            v[i]                 = static_cast<unsigned int>(word);
+            if(i == 0)
+            {
+                tag = word >> 32;
+            }
+            same = same && (word >> 32) == tag;
+        }
+        __builtin_memcpy(&value, v, sizeof(value));
+        return same ? static_cast<prefix_flag>(tag) : prefix_flag::EMPTY;
+    }
+
+    // The complete prefix is preferred, padding blocks have INVALID complete words.
+    ROCPRIM_DEVICE ROCPRIM_INLINE prefix_flag load(const unsigned int block_id, T& value)
+    {
+        constexpr unsigned int padding = ::rocprim::device_warp_size();
+
+        const prefix_type& prefix = prefixes[padding + block_id];
+        const prefix_flag  flag   = load_words(prefix.complete, value);
+        if(flag != prefix_flag::EMPTY)
+        {
+            return flag;
+        }
+        return load_words(prefix.partial, value);
+    }
+
+    prefix_type*            prefixes;
+    lookback_backoff_params backoff;
+    lookback_telemetry      telemetry;
+    diagnostics_view        diagnostics;
 };
 
 // Flag, partial and final prefixes are stored in separate arrays.
 // Consistency ensured by memory fences between flag and prefixes load/store operations.
-template<class T, bool UseSleep>
-struct lookback_scan_state<T, UseSleep, false>
+template<class T>
+struct lookback_scan_state<T, lookback_scan_state_layout::separate>
 {
 
 public:
     using flag_underlying_type = std::underlying_type_t<prefix_flag>;
     using value_type = T;
 
-    static constexpr bool use_sleep = UseSleep;
-
     // temp_storage must point to allocation of get_storage_size(number_of_blocks) bytes
-    ROCPRIM_HOST static inline hipError_t create(lookback_scan_state& state,
-                                                 void*                temp_storage,
-                                                 const unsigned int   number_of_blocks,
-                                                 const hipStream_t    stream)
+    ROCPRIM_HOST static inline hipError_t
+        create(lookback_scan_state&           state,
+               void*                          temp_storage,
+               const unsigned int             number_of_blocks,
+               const hipStream_t              stream,
+               const lookback_backoff_params& backoff = lookback_backoff_config<>())
     {
         unsigned int warp_size;
         hipError_t   error = ::rocprim::host_warp_size(stream, warp_size);
+        if(error == hipSuccess)
+        {
+            error = resolve_lookback_backoff(stream, backoff, state.backoff);
+        }
 
         const auto n = warp_size + number_of_blocks;
 
@@ -460,6 +827,8 @@ public:
         ptr += ::rocprim::detail::align_size(n * sizeof(value_underlying_type));
 
         state.prefixes_flags = reinterpret_cast<flag_underlying_type*>(ptr);
+        state.telemetry      = lookback_telemetry::current();
+        state.diagnostics    = diagnostics_view::current();
 
         return error;
     }
@@ -613,6 +982,27 @@ public:
 #endif
     }
 
+    // Records how far the look-back of block_id went, given the block id checked by each lane
+    // and the lowest lane that found a complete prefix. It must be called by the whole warp, and
+    // does nothing without ROCPRIM_DETAIL_LOOKBACK_TELEMETRY.
+    ROCPRIM_DEVICE ROCPRIM_INLINE void
+        record_lookback_distance(const unsigned int block_id,
+                                 const unsigned int lookback_block_id,
+                                 const unsigned int complete_lane)
+    {
+#if ROCPRIM_DETAIL_LOOKBACK_TELEMETRY
+        const unsigned int complete_id = warp_shuffle(lookback_block_id, complete_lane);
+        if(::rocprim::lane_id() == 0)
+        {
+            telemetry.record_distance(block_id, block_id - complete_id);
+        }
+#else
+        (void)block_id;
+        (void)lookback_block_id;
+        (void)complete_lane;
+#endif
+    }
+
     template<typename F>
     ROCPRIM_DEVICE ROCPRIM_INLINE T get_prefix_forward(F scan_op, unsigned int block_id_)
     {
@@ -662,6 +1052,7 @@ public:
         // offset at the lowest warp number that has prefix_flag::COMPLETE set.
         const auto bits   = ballot(flag == prefix_flag::COMPLETE);
         const auto lowest = ctz(bits);
+        record_lookback_distance(block_id_, lookback_block_id, lowest);
 
         // Now sum all the values from block_prefix that are lower than the current prefix.
         T prefix = lookback_reduce_forward_init(scan_op, block_prefix, lowest);
@@ -684,24 +1075,20 @@ private:
     {
         constexpr unsigned int padding = ::rocprim::device_warp_size();
 
-        const unsigned int SLEEP_MAX     = 32;
-        unsigned int       times_through = 1;
+        lookback_backoff wait(backoff);
+        unsigned int     spins = 0;
 
         prefix_flag flag = static_cast<prefix_flag>(
             ::rocprim::detail::atomic_load(&prefixes_flags[padding + block_id]));
         while(flag == prefix_flag::EMPTY)
         {
-            if(UseSleep)
-            {
-                for(unsigned int j = 0; j < times_through; j++)
-                    __builtin_amdgcn_s_sleep(1);
-                if(times_through < SLEEP_MAX)
-                    times_through++;
-            }
-
+            ++spins;
+            record_lookback_timeout(diagnostics, block_id, spins);
+            wait();
             flag = static_cast<prefix_flag>(
                 ::rocprim::detail::atomic_load(&prefixes_flags[padding + block_id]));
         }
+        telemetry.add_wait_spins(block_id, spins);
         return flag;
     }
 
@@ -742,9 +1129,12 @@ private:
     // We need to separate arrays for partial and final prefixes, because
     // value can be overwritten before flag is changed (flag and value are
     // not stored in single instruction).
-    void* prefixes_partial_values;
-    void* prefixes_complete_values;
-    flag_underlying_type* prefixes_flags;
+    void*                   prefixes_partial_values;
+    void*                   prefixes_complete_values;
+    flag_underlying_type*   prefixes_flags;
+    lookback_backoff_params backoff;
+    lookback_telemetry      telemetry;
+    diagnostics_view        diagnostics;
 };
 
 template<class T,
@@ -806,6 +1196,12 @@ private:
                 reduce_partial_prefixes(previous_block_id, flag, partial_prefix);
                 prefix = scan_op_(partial_prefix, prefix);
             }
+#if ROCPRIM_DETAIL_LOOKBACK_TELEMETRY
+            scan_state_.record_lookback_distance(
+                block_id_,
+                previous_block_id,
+                ::rocprim::ctz(::rocprim::ballot(flag == prefix_flag::COMPLETE)));
+#endif
             return prefix;
         }
         else /* Determinism == lookback_scan_state::deterministic */
@@ -840,49 +1236,6 @@ protected:
     LookbackScanState& scan_state_;
 };
 
-// It is known that early revisions of MI100 (gfx908) hang in the wait loop of
-// lookback_scan_state::get() without sleeping (s_sleep).
-// is_sleep_scan_state_used() checks the architecture/revision of the device on host in runtime,
-// to select the corresponding kernel (with or without sleep). However, since the check is runtime,
-// both versions of the kernel must be compiled for all architectures.
-// is_lookback_kernel_runnable() can be used in device code to prevent compilation of the version
-// with sleep on all device arhitectures except gfx908.
-
-ROCPRIM_HOST ROCPRIM_INLINE hipError_t is_sleep_scan_state_used(const hipStream_t stream,
-                                                                bool&             use_sleep)
-{
-    hipDeviceProp_t prop;
-    int             device_id;
-    if(const hipError_t error = get_device_from_stream(stream, device_id))
-    {
-        return error;
-    }
-    else if(const hipError_t error = hipGetDeviceProperties(&prop, device_id))
-    {
-        return error;
-    }
-#if HIP_VERSION >= 307
-    const int asicRevision = prop.asicRevision;
-#else
-    const int asicRevision = 0;
-#endif
-    use_sleep = std::string(prop.gcnArchName).find("908") != std::string::npos && asicRevision < 2;
-    return hipSuccess;
-}
-
-template<typename LookbackScanState>
-constexpr bool is_lookback_kernel_runnable()
-{
-    if(device_target_arch() == target_arch::gfx908)
-    {
-        // For gfx908 kernels with both version of lookback_scan_state can run: with and without
-        // sleep
-        return true;
-    }
-    // For other GPUs only a kernel without sleep can run
-    return !LookbackScanState::use_sleep;
-}
-
 template<typename T>
 class offset_lookback_scan_factory
 {
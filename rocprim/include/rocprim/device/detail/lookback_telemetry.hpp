@@ -0,0 +1,114 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_LOOKBACK_TELEMETRY_HPP_
+#define ROCPRIM_DEVICE_DETAIL_LOOKBACK_TELEMETRY_HPP_
+
+#include "../../config.hpp"
+#include "../../intrinsics/atomic.hpp"
+
+// Profiling builds define ROCPRIM_DETAIL_LOOKBACK_TELEMETRY to 1 to record how long the tiles of
+// look-back scans wait for each other. It must have the same value in all translation units.
+#ifndef ROCPRIM_DETAIL_LOOKBACK_TELEMETRY
+    #define ROCPRIM_DETAIL_LOOKBACK_TELEMETRY 0
+#endif
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The telemetry of a tile (a block of a look-back scan launch).
+struct lookback_telemetry_record
+{
+    // The number of times later tiles polled the state of this tile while it was still empty.
+    unsigned int wait_spins;
+    // The number of tiles this tile looked back over before it found a complete prefix.
+    unsigned int lookback_distance;
+};
+
+// The device buffer of the records, indexed by tile id. Tiles past the capacity are not
+// recorded. Without ROCPRIM_DETAIL_LOOKBACK_TELEMETRY it is empty and records nothing.
+struct lookback_telemetry
+{
+#if ROCPRIM_DETAIL_LOOKBACK_TELEMETRY
+    lookback_telemetry_record* records  = nullptr;
+    unsigned int               capacity = 0;
+#endif
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE void add_wait_spins(const unsigned int tile,
+                                                      const unsigned int spins) const
+    {
+#if ROCPRIM_DETAIL_LOOKBACK_TELEMETRY
+        if(spins != 0 && tile < capacity)
+        {
+            ::rocprim::detail::atomic_add(&records[tile].wait_spins, spins);
+        }
+#else
+        (void)tile;
+        (void)spins;
+#endif
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE void record_distance(const unsigned int tile,
+                                                       const unsigned int distance) const
+    {
+#if ROCPRIM_DETAIL_LOOKBACK_TELEMETRY
+        if(tile < capacity)
+        {
+            ::rocprim::detail::atomic_max(&records[tile].lookback_distance, distance);
+        }
+#else
+        (void)tile;
+        (void)distance;
+#endif
+    }
+
+    // The buffer set by set_lookback_telemetry_buffer, captured by the look-back states when they
+    // are created on the host.
+    ROCPRIM_HOST static lookback_telemetry& current()
+    {
+        static lookback_telemetry telemetry;
+        return telemetry;
+    }
+};
+
+// Sets the buffer that the following look-back scan launches record into. The buffer must hold
+// `capacity` zero-initialized records. The records of consecutive launches, including the
+// several launches of one algorithm for large inputs, accumulate. Passing nullptr stops
+// recording. It has no effect without ROCPRIM_DETAIL_LOOKBACK_TELEMETRY, and it is not
+// synchronized with concurrent host threads.
+inline void set_lookback_telemetry_buffer(lookback_telemetry_record* records,
+                                          const unsigned int         capacity)
+{
+#if ROCPRIM_DETAIL_LOOKBACK_TELEMETRY
+    lookback_telemetry::current().records  = records;
+    lookback_telemetry::current().capacity = records != nullptr ? capacity : 0;
+#else
+    (void)records;
+    (void)capacity;
+#endif
+}
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_LOOKBACK_TELEMETRY_HPP_
@@ -0,0 +1,93 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DETAIL_TRANSFORM_LOAD_HPP_
+#define ROCPRIM_DEVICE_DETAIL_TRANSFORM_LOAD_HPP_
+
+#include <type_traits>
+
+#include <cstdint>
+
+#include "../../config.hpp"
+#include "../../detail/various.hpp"
+
+#include "../../block/block_load_func.hpp"
+#include "../../iterator/transform_iterator.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Loads a full tile into a blocked arrangement when the input is a transform_iterator over a raw
+// pointer: the raw values are read with vector loads, and transformed after the load, so the
+// width of the load is that of the input type and not that of the transformed type.
+// Returns false without loading when the input can not be loaded this way (other iterators,
+// types that are not vectorizable, or tiles of small vectorizable items that are not aligned),
+// then the caller loads the tile as usual. Items that are loaded as raw bytes are vectorized
+// at any alignment.
+template<class InputIterator, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+bool transform_load_blocked_vectorized(unsigned int /*flat_id*/,
+                                       InputIterator /*block_input*/,
+                                       U (& /*items*/)[ItemsPerThread])
+{
+    return false;
+}
+
+template<class T, class UnaryFunction, class ValueType, class U, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto transform_load_blocked_vectorized(
+    unsigned int                                                flat_id,
+    ::rocprim::transform_iterator<T*, UnaryFunction, ValueType> block_input,
+    U (&items)[ItemsPerThread]) ->
+    typename std::enable_if<
+        is_thread_bytes_vectorizable<typename std::remove_cv<T>::type, ItemsPerThread>::value
+            || is_vectorizable<T, ItemsPerThread>::value,
+        bool>::type
+{
+    using raw_type    = typename std::remove_cv<T>::type;
+    using vector_type = typename match_vector_type<raw_type, ItemsPerThread>::type;
+
+    T* const raw_input = block_input.base();
+    // The alignment is the same for all threads of the block
+    if(!is_thread_bytes_vectorizable<raw_type, ItemsPerThread>::value
+       && reinterpret_cast<uintptr_t>(raw_input) % alignof(vector_type) != 0)
+    {
+        return false;
+    }
+
+    raw_type raw_items[ItemsPerThread];
+    block_load_direct_blocked_vectorized(flat_id, raw_input, raw_items);
+
+    const UnaryFunction transform_op = block_input.functor();
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        items[item] = transform_op(raw_items[item]);
+    }
+    return true;
+}
+
+} // end of detail namespace
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DETAIL_TRANSFORM_LOAD_HPP_
@@ -27,6 +27,7 @@
 
 #include "config_types.hpp"
 #include "device_transform.hpp"
+#include "execution_budget.hpp"
 
 #include "../config.hpp"
 #include "../common.hpp"
@@ -159,7 +160,10 @@ hipError_t adjacent_difference_impl(void* const          temporary_storage,
         }
     }
 
-    const unsigned int size_limit             = params.adjacent_difference_kernel_config.size_limit;
+    const unsigned int size_limit = static_cast<unsigned int>(
+        budgeted_size_limit(stream,
+                            params.adjacent_difference_kernel_config.size_limit,
+                            items_per_block));
     const auto         number_of_blocks_limit = std::max(size_limit / items_per_block, 1u);
     const auto         aligned_size_limit     = number_of_blocks_limit * items_per_block;
 
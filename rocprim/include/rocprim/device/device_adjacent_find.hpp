@@ -66,7 +66,7 @@ hipError_t adjacent_find_impl(void* const       temporary_storage,
     using reduce_op_type = ::rocprim::minimum<index_type>;
 
     // Use dynamic tile id
-    using ordered_tile_id_type = detail::ordered_block_id<unsigned long long>;
+    using ordered_tile_id_type = detail::ordered_block_id<size_t>;
 
     // Kernel launch config
     using config = wrapped_adjacent_find_config<Config, input_type>;
@@ -110,21 +110,9 @@ hipError_t adjacent_find_impl(void* const       temporary_storage,
         return result;
     }
 
-    std::chrono::steady_clock::time_point start;
-    if(debug_synchronous)
-    {
-        start = std::chrono::steady_clock::now();
-    }
-
-    // Launch adjacent_find_impl_kernels::init_adjacent_find
     auto ordered_tile_id = ordered_tile_id_type::create(ordered_tile_id_storage);
-    adjacent_find_kernels::init_adjacent_find<<<1, 1, 0, stream>>>(reduce_output,
-                                                                   ordered_tile_id,
-                                                                   size);
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(
-        "rocprim::detail::adjacent_find::init_adjacent_find",
-        size,
-        start);
+    ROCPRIM_RETURN_ON_ERROR(
+        ordered_find_init(reduce_output, size, ordered_tile_id, stream, debug_synchronous));
 
     if(size > 1)
     {
@@ -136,44 +124,27 @@ hipError_t adjacent_find_impl(void* const       temporary_storage,
         auto transformed_input
             = ::rocprim::make_transform_iterator(wrapped_input, wrapped_equal_op);
 
-        auto adjacent_find_block_reduce_kernel = adjacent_find_kernels::block_reduce_kernel;
-
         target_arch target_arch;
         ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, target_arch));
         const adjacent_find_config_params params     = dispatch_target_arch<config>(target_arch);
         const unsigned int                block_size = params.kernel_config.block_size;
         const unsigned int                items_per_thread = params.kernel_config.items_per_thread;
         const unsigned int                items_per_block  = block_size * items_per_thread;
-        const unsigned int grid_size        = (size + items_per_block - 1) / items_per_block;
-        const unsigned int shared_mem_bytes = 0; /*no dynamic shared mem*/
-
-        // Get grid size for maximum occupancy, as we may not be able to schedule all the blocks
-        // at the same time
-        int min_grid_size      = 0;
-        int optimal_block_size = 0;
-        ROCPRIM_RETURN_ON_ERROR(hipOccupancyMaxPotentialBlockSize(&min_grid_size,
-                                                                  &optimal_block_size,
-                                                                  adjacent_find_block_reduce_kernel,
-                                                                  shared_mem_bytes,
-                                                                  int(block_size)));
-        min_grid_size = std::min(static_cast<unsigned int>(min_grid_size), grid_size);
-
-        if(debug_synchronous)
-        {
-            start = std::chrono::steady_clock::now();
-        }
 
         // Launch adjacent_find_impl_kernels::block_reduce_kernel
-        adjacent_find_block_reduce_kernel<<<min_grid_size, block_size, shared_mem_bytes, stream>>>(
-            transformed_input,
-            reduce_output,
-            size,
-            reduce_op_type{},
-            ordered_tile_id);
-        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(
-            "rocprim::detail::adjacent_find::block_reduce_kernel",
-            size,
-            start);
+        ROCPRIM_RETURN_ON_ERROR(
+            ordered_find_launch(adjacent_find_kernels::block_reduce_kernel,
+                                "rocprim::detail::adjacent_find::block_reduce_kernel",
+                                block_size,
+                                items_per_block,
+                                size - 1,
+                                stream,
+                                debug_synchronous,
+                                transformed_input,
+                                reduce_output,
+                                size,
+                                reduce_op_type{},
+                                ordered_tile_id));
     }
 
     ROCPRIM_RETURN_ON_ERROR(::rocprim::transform(reduce_output,
@@ -0,0 +1,371 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_DEVICE_AFFINE_SCAN_HPP_
+#define ROCPRIM_DEVICE_DEVICE_AFFINE_SCAN_HPP_
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../iterator/transform_output_iterator.hpp"
+#include "../iterator/zip_iterator.hpp"
+#include "../thread/thread_operators.hpp"
+#include "../types.hpp"
+#include "../types/affine_map.hpp"
+
+#include "config_types.hpp"
+#include "device_scan.hpp"
+#include "device_scan_by_key.hpp"
+#include "device_segmented_scan.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+// The 16-bit floating point coefficients are composed in float: the products of a long
+// recurrence quickly lose the few bits of their mantissa.
+template<class T>
+using affine_scan_accumulator_t = typename std::conditional<
+    std::is_same<T, ::rocprim::half>::value || std::is_same<T, ::rocprim::bfloat16>::value,
+    float,
+    T>::type;
+
+template<class T>
+struct affine_scan_map_op
+{
+    template<class Tuple>
+    ROCPRIM_HOST_DEVICE
+    inline ::rocprim::affine_map<T> operator()(const Tuple& coefficients) const
+    {
+        return ::rocprim::affine_map<T>(static_cast<T>(::rocprim::get<0>(coefficients)),
+                                        static_cast<T>(::rocprim::get<1>(coefficients)));
+    }
+};
+
+// The scanned map of an item takes the state before the first item of its sequence to the
+// state after the item.
+template<class T>
+struct affine_scan_apply_op
+{
+    T initial_value;
+
+    ROCPRIM_HOST_DEVICE
+    inline T operator()(const ::rocprim::affine_map<T>& map) const
+    {
+        return map(initial_value);
+    }
+};
+
+template<class AccType, class AInputIterator, class BInputIterator>
+inline auto make_affine_scan_input(AInputIterator a_input, BInputIterator b_input)
+    -> decltype(::rocprim::make_transform_iterator(
+        ::rocprim::make_zip_iterator(::rocprim::make_tuple(a_input, b_input)),
+        affine_scan_map_op<AccType>()))
+{
+    return ::rocprim::make_transform_iterator(
+        ::rocprim::make_zip_iterator(::rocprim::make_tuple(a_input, b_input)),
+        affine_scan_map_op<AccType>());
+}
+
+template<class AccType, class OutputIterator>
+inline auto make_affine_scan_output(OutputIterator output, const AccType initial_value)
+    -> decltype(::rocprim::make_transform_output_iterator(output,
+                                                          affine_scan_apply_op<AccType>{
+                                                              initial_value}))
+{
+    return ::rocprim::make_transform_output_iterator(output,
+                                                     affine_scan_apply_op<AccType>{initial_value});
+}
+
+} // namespace detail
+
+/// \brief Parallel primitive for device level that computes the first-order linear recurrence
+/// <tt>x[i] = a[i] * x[i - 1] + b[i]</tt>.
+///
+/// affine_scan writes every \p x[i] to \p output, starting from <tt>x[-1] = initial_value</tt>.
+/// The recurrence is an inclusive scan of the affine maps <tt>x -> a[i] * x + b[i]</tt> with
+/// \p rocprim::affine_compose, like the selective state updates of state space models.
+///
+/// \par Overview
+/// * The coefficients are loaded from the two ranges and composed as a single
+/// <tt>rocprim::affine_map<AccType></tt> of two values, which the look-back of the scan passes
+/// between the blocks in the layout for its size. The maps are not written to memory.
+/// * \p rocprim::half and \p rocprim::bfloat16 coefficients are composed in \p float by default,
+/// and the results are converted to the \p value_type of \p output when they are written.
+/// * Floating point composition is not associative, so the results may differ from a
+/// sequential evaluation by rounding errors and from run to run.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `scan_config`.
+/// \tparam AInputIterator - random-access iterator type of the factors. It can be a simple
+/// pointer type.
+/// \tparam BInputIterator - random-access iterator type of the offsets. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be a simple
+/// pointer type.
+/// \tparam InitValueType - type of the initial state.
+/// \tparam AccType - the type the maps are composed in. Default type is \p float for 16-bit
+/// floating point offsets, otherwise the \p value_type of \p BInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] a_input - iterator to the first factor <tt>a[0]</tt>.
+/// \param [in] b_input - iterator to the first offset <tt>b[0]</tt>.
+/// \param [out] output - iterator to the first state <tt>x[0]</tt>. It can be the same as
+/// \p a_input or \p b_input.
+/// \param [in] size - number of steps of the recurrence.
+/// \param [in] initial_value - [optional] the state before the first step. Default is \p 0.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;   // e.g., 4
+/// float * a;     // e.g., [2, 1, 0.5, 3]
+/// float * b;     // e.g., [1, 1, 2, 0]
+/// float * x;     // empty array of 4 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::affine_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes, a, b, x, size, 1.0f
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // evaluate the recurrence
+/// rocprim::affine_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes, a, b, x, size, 1.0f
+/// );
+/// // x: [3, 4, 4, 12]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class AInputIterator,
+         class BInputIterator,
+         class OutputIterator,
+         class InitValueType = typename std::iterator_traits<BInputIterator>::value_type,
+         class AccType       = detail::affine_scan_accumulator_t<
+             typename std::iterator_traits<BInputIterator>::value_type>>
+inline hipError_t affine_scan(void*               temporary_storage,
+                              size_t&             storage_size,
+                              AInputIterator      a_input,
+                              BInputIterator      b_input,
+                              OutputIterator      output,
+                              const size_t        size,
+                              const InitValueType initial_value     = InitValueType(),
+                              const hipStream_t   stream            = 0,
+                              bool                debug_synchronous = false)
+{
+    return ::rocprim::inclusive_scan<Config>(
+        temporary_storage,
+        storage_size,
+        detail::make_affine_scan_input<AccType>(a_input, b_input),
+        detail::make_affine_scan_output(output, static_cast<AccType>(initial_value)),
+        size,
+        ::rocprim::affine_compose<AccType>(),
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Load-balanced parallel primitive for device level that computes a first-order linear
+/// recurrence in every segment.
+///
+/// segmented_affine_scan computes the recurrence of \p affine_scan separately in every segment
+/// given by a single sequence of offsets, starting every segment from \p initial_value, like
+/// \p segmented_inclusive_scan_balanced. This evaluates the recurrences of a ragged batch of
+/// sequences in one pass, independent of the distribution of their lengths.
+///
+/// \par Overview
+/// * Segment <tt>i</tt> is the range <tt>[offsets[i], offsets[i + 1])</tt> of the inputs.
+/// \p offsets must have <tt>segments + 1</tt> non-decreasing elements, with
+/// <tt>offsets[0] = 0</tt> and <tt>offsets[segments] = size</tt>.
+/// * The coefficients are composed like in \p affine_scan.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `scan_config`.
+/// \tparam AInputIterator - random-access iterator type of the factors. It can be a simple
+/// pointer type.
+/// \tparam BInputIterator - random-access iterator type of the offsets. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be a simple
+/// pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. It can be a simple
+/// pointer type.
+/// \tparam InitValueType - type of the initial state.
+/// \tparam AccType - the type the maps are composed in, like in \p affine_scan.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] a_input - iterator to the first factor.
+/// \param [in] b_input - iterator to the first offset.
+/// \param [out] output - iterator to the first state.
+/// \param [in] size - number of steps of all recurrences.
+/// \param [in] segments - number of segments.
+/// \param [in] offsets - iterator to the first element in the range of <tt>segments + 1</tt>
+/// offsets.
+/// \param [in] initial_value - [optional] the state before the first step of every segment.
+/// Default is \p 0.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class AInputIterator,
+         class BInputIterator,
+         class OutputIterator,
+         class OffsetIterator,
+         class InitValueType = typename std::iterator_traits<BInputIterator>::value_type,
+         class AccType       = detail::affine_scan_accumulator_t<
+             typename std::iterator_traits<BInputIterator>::value_type>>
+inline hipError_t segmented_affine_scan(void*               temporary_storage,
+                                        size_t&             storage_size,
+                                        AInputIterator      a_input,
+                                        BInputIterator      b_input,
+                                        OutputIterator      output,
+                                        const size_t        size,
+                                        const unsigned int  segments,
+                                        OffsetIterator      offsets,
+                                        const InitValueType initial_value     = InitValueType(),
+                                        const hipStream_t   stream            = 0,
+                                        bool                debug_synchronous = false)
+{
+    return ::rocprim::segmented_inclusive_scan_balanced<Config>(
+        temporary_storage,
+        storage_size,
+        detail::make_affine_scan_input<AccType>(a_input, b_input),
+        detail::make_affine_scan_output(output, static_cast<AccType>(initial_value)),
+        size,
+        segments,
+        offsets,
+        ::rocprim::affine_compose<AccType>(),
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel primitive for device level that computes a first-order linear recurrence
+/// in every run of equal keys.
+///
+/// affine_scan_by_key computes the recurrence of \p affine_scan separately in every run of
+/// consecutive equal keys, starting every run from \p initial_value, like
+/// \p inclusive_scan_by_key.
+///
+/// \par Overview
+/// * The coefficients are composed like in \p affine_scan.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `scan_by_key_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the keys. It can be a simple
+/// pointer type.
+/// \tparam AInputIterator - random-access iterator type of the factors. It can be a simple
+/// pointer type.
+/// \tparam BInputIterator - random-access iterator type of the offsets. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be a simple
+/// pointer type.
+/// \tparam InitValueType - type of the initial state.
+/// \tparam KeyCompareFunction - type of the function object comparing keys for equality.
+/// \tparam AccType - the type the maps are composed in, like in \p affine_scan.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - iterator to the first key.
+/// \param [in] a_input - iterator to the first factor.
+/// \param [in] b_input - iterator to the first offset.
+/// \param [out] output - iterator to the first state.
+/// \param [in] size - number of steps of all recurrences.
+/// \param [in] initial_value - [optional] the state before the first step of every run of keys.
+/// Default is \p 0.
+/// \param [in] key_compare_op - [optional] function object returning whether two keys are equal.
+/// Default is \p KeyCompareFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class AInputIterator,
+         class BInputIterator,
+         class OutputIterator,
+         class InitValueType = typename std::iterator_traits<BInputIterator>::value_type,
+         class KeyCompareFunction
+         = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>,
+         class AccType = detail::affine_scan_accumulator_t<
+             typename std::iterator_traits<BInputIterator>::value_type>>
+inline hipError_t affine_scan_by_key(void*                    temporary_storage,
+                                     size_t&                  storage_size,
+                                     KeysInputIterator        keys_input,
+                                     AInputIterator           a_input,
+                                     BInputIterator           b_input,
+                                     OutputIterator           output,
+                                     const size_t             size,
+                                     const InitValueType      initial_value  = InitValueType(),
+                                     const KeyCompareFunction key_compare_op = KeyCompareFunction(),
+                                     const hipStream_t        stream         = 0,
+                                     bool                     debug_synchronous = false)
+{
+    return ::rocprim::inclusive_scan_by_key<Config>(
+        temporary_storage,
+        storage_size,
+        keys_input,
+        detail::make_affine_scan_input<AccType>(a_input, b_input),
+        detail::make_affine_scan_output(output, static_cast<AccType>(initial_value)),
+        size,
+        ::rocprim::affine_compose<AccType>(),
+        key_compare_op,
+        stream,
+        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_AFFINE_SCAN_HPP_
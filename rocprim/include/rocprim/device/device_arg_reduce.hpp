@@ -0,0 +1,608 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_DEVICE_ARG_REDUCE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_ARG_REDUCE_HPP_
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../iterator/arg_index_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../iterator/transform_output_iterator.hpp"
+#include "../thread/radix_key_codec.hpp"
+#include "../thread/thread_operators.hpp"
+#include "../type_traits.hpp"
+#include "../types/key_value_pair.hpp"
+
+#include "config_types.hpp"
+#include "device_reduce.hpp"
+#include "device_segmented_reduce.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+// Values of at most 32 bits are reduced as a single 64-bit word: the order-preserving encoding
+// of the value in the high half and the index in the low half. The minimum of the words is the
+// first minimum (or, with the descending encoding, the first maximum) of the input, so the
+// reduction moves 8 bytes per item and needs no comparison of the pair members.
+template<class Value>
+using arg_reduce_packable
+    = std::integral_constant<bool,
+                             ::rocprim::is_arithmetic<Value>::value && sizeof(Value) <= 4>;
+
+template<class Value, bool Max>
+struct arg_reduce_pack_op
+{
+    using codec = ::rocprim::radix_key_codec<Value, Max>;
+
+    ROCPRIM_HOST_DEVICE
+    inline unsigned long long
+        operator()(const ::rocprim::key_value_pair<unsigned int, Value>& item) const
+    {
+        const auto bit_key = static_cast<unsigned int>(codec::encode(item.value));
+        return (static_cast<unsigned long long>(bit_key) << 32) | item.key;
+    }
+};
+
+template<class Value, bool Max>
+struct arg_reduce_unpack_op
+{
+    using codec = ::rocprim::radix_key_codec<Value, Max>;
+
+    ROCPRIM_HOST_DEVICE
+    inline ::rocprim::key_value_pair<std::ptrdiff_t, Value>
+        operator()(const unsigned long long packed) const
+    {
+        using bit_key_type = typename codec::bit_key_type;
+        if(packed == ~0ull)
+        {
+            // The identity of the reduction, only the result of an empty segment
+            return ::rocprim::key_value_pair<std::ptrdiff_t, Value>(-1, Value());
+        }
+        return ::rocprim::key_value_pair<std::ptrdiff_t, Value>(
+            static_cast<std::ptrdiff_t>(packed & 0xFFFFFFFFull),
+            codec::decode(static_cast<bit_key_type>(packed >> 32)));
+    }
+};
+
+// Reduces the pairs of segments with an initial value, the pair of an empty segment has a
+// negative index and is the identity of the reduction.
+template<bool Max>
+struct segmented_arg_reduce_pairs_op
+{
+    template<class Value>
+    ROCPRIM_HOST_DEVICE
+    inline ::rocprim::key_value_pair<std::ptrdiff_t, Value>
+        operator()(const ::rocprim::key_value_pair<std::ptrdiff_t, Value>& a,
+                   const ::rocprim::key_value_pair<std::ptrdiff_t, Value>& b) const
+    {
+        using reduce_op =
+            typename std::conditional<Max, ::rocprim::arg_max, ::rocprim::arg_min>::type;
+        return a.key < 0 ? b : b.key < 0 ? a : reduce_op()(a, b);
+    }
+};
+
+template<class Config, bool Max, class InputIterator, class OutputIterator>
+inline hipError_t arg_reduce_pairs(void*             temporary_storage,
+                                   size_t&           storage_size,
+                                   InputIterator     input,
+                                   OutputIterator    output,
+                                   const size_t      size,
+                                   const hipStream_t stream,
+                                   const bool        debug_synchronous)
+{
+    using reduce_op = typename std::conditional<Max, ::rocprim::arg_max, ::rocprim::arg_min>::type;
+    return ::rocprim::reduce<Config>(temporary_storage,
+                                     storage_size,
+                                     ::rocprim::make_arg_index_iterator(input),
+                                     output,
+                                     size,
+                                     reduce_op(),
+                                     stream,
+                                     debug_synchronous);
+}
+
+template<class Config, bool Max, class InputIterator, class OutputIterator>
+inline hipError_t arg_reduce_impl(void*             temporary_storage,
+                                  size_t&           storage_size,
+                                  InputIterator     input,
+                                  OutputIterator    output,
+                                  const size_t      size,
+                                  const hipStream_t stream,
+                                  const bool        debug_synchronous,
+                                  std::false_type /*packable*/)
+{
+    return arg_reduce_pairs<Config, Max>(temporary_storage,
+                                         storage_size,
+                                         input,
+                                         output,
+                                         size,
+                                         stream,
+                                         debug_synchronous);
+}
+
+template<class Config, bool Max, class InputIterator, class OutputIterator>
+inline hipError_t arg_reduce_impl(void*             temporary_storage,
+                                  size_t&           storage_size,
+                                  InputIterator     input,
+                                  OutputIterator    output,
+                                  const size_t      size,
+                                  const hipStream_t stream,
+                                  const bool        debug_synchronous,
+                                  std::true_type /*packable*/)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    // The index must fit into the low half of the word
+    if(size > std::numeric_limits<unsigned int>::max())
+    {
+        return arg_reduce_pairs<Config, Max>(temporary_storage,
+                                             storage_size,
+                                             input,
+                                             output,
+                                             size,
+                                             stream,
+                                             debug_synchronous);
+    }
+
+    return ::rocprim::transform_reduce<Config>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_arg_index_iterator<InputIterator, unsigned int>(input),
+        ::rocprim::make_transform_output_iterator(output,
+                                                  arg_reduce_unpack_op<value_type, Max>()),
+        ~0ull,
+        size,
+        ::rocprim::minimum<unsigned long long>(),
+        arg_reduce_pack_op<value_type, Max>(),
+        stream,
+        debug_synchronous);
+}
+
+template<class Config, bool Max, class InputIterator, class OutputIterator>
+inline hipError_t arg_reduce(void*             temporary_storage,
+                             size_t&           storage_size,
+                             InputIterator     input,
+                             OutputIterator    output,
+                             const size_t      size,
+                             const hipStream_t stream,
+                             const bool        debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    if(temporary_storage != nullptr && size == 0)
+    {
+        // There is no position to report
+        return hipSuccess;
+    }
+    return arg_reduce_impl<Config, Max>(temporary_storage,
+                                        storage_size,
+                                        input,
+                                        output,
+                                        size,
+                                        stream,
+                                        debug_synchronous,
+                                        arg_reduce_packable<value_type>{});
+}
+
+template<class Config, bool Max, class InputIterator, class OutputIterator, class OffsetIterator>
+inline hipError_t segmented_arg_reduce(void*              temporary_storage,
+                                       size_t&            storage_size,
+                                       InputIterator      input,
+                                       OutputIterator     output,
+                                       const size_t       size,
+                                       const unsigned int segments,
+                                       OffsetIterator     offsets,
+                                       const hipStream_t  stream,
+                                       const bool         debug_synchronous,
+                                       std::false_type /*packable*/)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using pair_type  = ::rocprim::key_value_pair<std::ptrdiff_t, value_type>;
+
+    return ::rocprim::segmented_reduce_balanced<Config>(temporary_storage,
+                                                        storage_size,
+                                                        ::rocprim::make_arg_index_iterator(input),
+                                                        output,
+                                                        size,
+                                                        segments,
+                                                        offsets,
+                                                        segmented_arg_reduce_pairs_op<Max>(),
+                                                        pair_type(-1, value_type()),
+                                                        stream,
+                                                        debug_synchronous);
+}
+
+template<class Config, bool Max, class InputIterator, class OutputIterator, class OffsetIterator>
+inline hipError_t segmented_arg_reduce(void*              temporary_storage,
+                                       size_t&            storage_size,
+                                       InputIterator      input,
+                                       OutputIterator     output,
+                                       const size_t       size,
+                                       const unsigned int segments,
+                                       OffsetIterator     offsets,
+                                       const hipStream_t  stream,
+                                       const bool         debug_synchronous,
+                                       std::true_type /*packable*/)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    // The index must fit into the low half of the word
+    if(size > std::numeric_limits<unsigned int>::max())
+    {
+        return segmented_arg_reduce<Config, Max>(temporary_storage,
+                                                 storage_size,
+                                                 input,
+                                                 output,
+                                                 size,
+                                                 segments,
+                                                 offsets,
+                                                 stream,
+                                                 debug_synchronous,
+                                                 std::false_type{});
+    }
+
+    return ::rocprim::segmented_reduce_balanced<Config>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(
+            ::rocprim::make_arg_index_iterator<InputIterator, unsigned int>(input),
+            arg_reduce_pack_op<value_type, Max>()),
+        ::rocprim::make_transform_output_iterator(output,
+                                                  arg_reduce_unpack_op<value_type, Max>()),
+        size,
+        segments,
+        offsets,
+        ::rocprim::minimum<unsigned long long>(),
+        ~0ull,
+        stream,
+        debug_synchronous);
+}
+
+} // namespace detail
+
+/// \brief Parallel primitive for device level that finds the first minimum of a range and
+/// its position.
+///
+/// \par Overview
+/// * The result is written to \p output as a <tt>rocprim::key_value_pair<std::ptrdiff_t, T></tt>,
+/// with the index of the minimum in \p key and the minimum in \p value, where \p T is the
+/// \p value_type of \p InputIterator. Of equal minimums the one with the lowest index is reported,
+/// like reducing an \p arg_index_iterator over \p input with \p rocprim::arg_min.
+/// * Arithmetic types of at most 4 bytes are reduced as a single 64-bit word that packs the
+/// value and its index, which halves the data moved by the reduction compared to the
+/// pair. The words are compared in radix sort order, so \p -0.0 is smaller than \p +0.0 and
+/// NaNs with a cleared sign bit are greater than every other value.
+/// * Other types, and ranges longer than \p UINT_MAX items, are reduced as pairs with
+/// \p rocprim::arg_min.
+/// * Nothing is written to \p output when \p size is \p 0.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `reduce_config`
+/// or a `tuned_config` of these.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to search.
+/// \param [out] output - iterator to the pair of the position and the value of the minimum.
+/// \param [in] size - number of element in the input range.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;                                  // e.g., 6
+/// float * input;                                      // e.g., [4, 2, 7, 2, 9, 3]
+/// rocprim::key_value_pair<std::ptrdiff_t, float> * output; // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::argmin(
+///     temporary_storage_ptr, temporary_storage_size_bytes, input, output, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // find the minimum
+/// rocprim::argmin(
+///     temporary_storage_ptr, temporary_storage_size_bytes, input, output, input_size
+/// );
+/// // output: [{1, 2}]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class InputIterator, class OutputIterator>
+inline hipError_t argmin(void*             temporary_storage,
+                         size_t&           storage_size,
+                         InputIterator     input,
+                         OutputIterator    output,
+                         const size_t      size,
+                         const hipStream_t stream            = 0,
+                         bool              debug_synchronous = false)
+{
+    return detail::arg_reduce<Config, false>(temporary_storage,
+                                             storage_size,
+                                             input,
+                                             output,
+                                             size,
+                                             stream,
+                                             debug_synchronous);
+}
+
+/// \brief Parallel primitive for device level that finds the first maximum of a range and
+/// its position.
+///
+/// \par Overview
+/// * The result is written to \p output as a <tt>rocprim::key_value_pair<std::ptrdiff_t, T></tt>,
+/// with the index of the maximum in \p key and the maximum in \p value, where \p T is the
+/// \p value_type of \p InputIterator. Of equal maximums the one with the lowest index is reported,
+/// like reducing an \p arg_index_iterator over \p input with \p rocprim::arg_max.
+/// * Arithmetic types of at most 4 bytes are reduced as a single 64-bit word like in \p argmin,
+/// in radix sort order, so \p +0.0 is greater than \p -0.0 and NaNs with a cleared sign bit
+/// are greater than every other value.
+/// * Other types, and ranges longer than \p UINT_MAX items, are reduced as pairs with
+/// \p rocprim::arg_max.
+/// * Nothing is written to \p output when \p size is \p 0.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `reduce_config`
+/// or a `tuned_config` of these.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to search.
+/// \param [out] output - iterator to the pair of the position and the value of the maximum.
+/// \param [in] size - number of element in the input range.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config, class InputIterator, class OutputIterator>
+inline hipError_t argmax(void*             temporary_storage,
+                         size_t&           storage_size,
+                         InputIterator     input,
+                         OutputIterator    output,
+                         const size_t      size,
+                         const hipStream_t stream            = 0,
+                         bool              debug_synchronous = false)
+{
+    return detail::arg_reduce<Config, true>(temporary_storage,
+                                            storage_size,
+                                            input,
+                                            output,
+                                            size,
+                                            stream,
+                                            debug_synchronous);
+}
+
+/// \brief Load-balanced parallel primitive for device level that finds the first minimum of every
+/// segment and its position.
+///
+/// segmented_argmin reduces the segments given by a single sequence of offsets like
+/// \p segmented_reduce_balanced, so rows of very different lengths are reduced in one pass.
+///
+/// \par Overview
+/// * Segment <tt>i</tt> is the range <tt>[offsets[i], offsets[i + 1])</tt> of \p input.
+/// \p offsets must have <tt>segments + 1</tt> non-decreasing elements, and
+/// <tt>offsets[segments]</tt> must not be greater than \p size.
+/// * The result of every segment is written to \p output as a
+/// <tt>rocprim::key_value_pair<std::ptrdiff_t, T></tt> like in \p argmin. \p key is the index of
+/// the minimum in \p input, not in its segment, so it can be used to look up other data of the item
+/// (e.g. the column index of a sparse matrix element). The pair of an empty segment is
+/// <tt>{-1, T()}</tt>.
+/// * The values are packed, and ordered, like in \p argmin.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `reduce_config`.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to search.
+/// \param [out] output - iterator to the first element in the range of <tt>segments</tt> pairs.
+/// \param [in] size - number of elements in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] offsets - iterator to the first element in the range of <tt>segments + 1</tt>
+/// offsets.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the position of the minimum of every row of a CSR sparse matrix is found.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;             // e.g., 8
+/// unsigned int segments;   // e.g., 4
+/// float * values;          // e.g., [3, 2, 3, 4, 5, 6, 1, 8]
+/// rocprim::key_value_pair<std::ptrdiff_t, float> * output; // empty array of 4 elements
+/// int * row_offsets;       // e.g. [0, 2, 2, 7, 8]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_argmin(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     values, output, size, segments, row_offsets
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // find the minimums
+/// rocprim::segmented_argmin(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     values, output, size, segments, row_offsets
+/// );
+/// // output: [{1, 2}, {-1, 0}, {6, 1}, {7, 8}]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_argmin(void*              temporary_storage,
+                                   size_t&            storage_size,
+                                   InputIterator      input,
+                                   OutputIterator     output,
+                                   const size_t       size,
+                                   const unsigned int segments,
+                                   OffsetIterator     offsets,
+                                   const hipStream_t  stream            = 0,
+                                   bool               debug_synchronous = false)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    return detail::segmented_arg_reduce<Config, false>(temporary_storage,
+                                                    storage_size,
+                                                    input,
+                                                    output,
+                                                    size,
+                                                    segments,
+                                                    offsets,
+                                                    stream,
+                                                    debug_synchronous,
+                                                    detail::arg_reduce_packable<value_type>{});
+}
+
+/// \brief Load-balanced parallel primitive for device level that finds the first maximum of every
+/// segment and its position.
+///
+/// segmented_argmax reduces the segments given by a single sequence of offsets like
+/// \p segmented_reduce_balanced, so rows of very different lengths are reduced in one pass.
+///
+/// \par Overview
+/// * Segment <tt>i</tt> is the range <tt>[offsets[i], offsets[i + 1])</tt> of \p input.
+/// \p offsets must have <tt>segments + 1</tt> non-decreasing elements, and
+/// <tt>offsets[segments]</tt> must not be greater than \p size.
+/// * The result of every segment is written to \p output as a
+/// <tt>rocprim::key_value_pair<std::ptrdiff_t, T></tt> like in \p argmax. \p key is the index of
+/// the maximum in \p input, not in its segment, so it can be used to look up other data of the item
+/// (e.g. the column index of a sparse matrix element). The pair of an empty segment is
+/// <tt>{-1, T()}</tt>.
+/// * The values are packed, and ordered, like in \p argmax.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `reduce_config`.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to search.
+/// \param [out] output - iterator to the first element in the range of <tt>segments</tt> pairs.
+/// \param [in] size - number of elements in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] offsets - iterator to the first element in the range of <tt>segments + 1</tt>
+/// offsets.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_argmax(void*              temporary_storage,
+                                   size_t&            storage_size,
+                                   InputIterator      input,
+                                   OutputIterator     output,
+                                   const size_t       size,
+                                   const unsigned int segments,
+                                   OffsetIterator     offsets,
+                                   const hipStream_t  stream            = 0,
+                                   bool               debug_synchronous = false)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    return detail::segmented_arg_reduce<Config, true>(temporary_storage,
+                                                      storage_size,
+                                                      input,
+                                                      output,
+                                                      size,
+                                                      segments,
+                                                      offsets,
+                                                      stream,
+                                                      debug_synchronous,
+                                                      detail::arg_reduce_packable<value_type>{});
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_ARG_REDUCE_HPP_
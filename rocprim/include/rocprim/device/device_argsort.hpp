@@ -0,0 +1,657 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_DEVICE_ARGSORT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_ARGSORT_HPP_
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../iterator/counting_iterator.hpp"
+
+#include "config_types.hpp"
+#include "device_merge_sort.hpp"
+#include "device_radix_sort.hpp"
+#include "device_segmented_radix_sort.hpp"
+#include "device_transform.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The index type of the sort: Candidate if it is narrower than the output index type, so that
+// the sort passes move less data, and Index otherwise
+template<class Index, class Candidate>
+using argsort_index_t =
+    typename std::conditional<(sizeof(Candidate) < sizeof(Index)), Candidate, Index>::type;
+
+// Sorted keys go to the output if there is one, and to temporary storage if it is nullptr
+template<class KeysOutputIterator, class Key>
+KeysOutputIterator argsort_keys_output(KeysOutputIterator keys_output, Key*)
+{
+    return keys_output;
+}
+
+template<class Key>
+Key* argsort_keys_output(std::nullptr_t, Key* keys_tmp)
+{
+    return keys_tmp;
+}
+
+template<class KeysOutputIterator>
+size_t argsort_keys_tmp_size(KeysOutputIterator, size_t)
+{
+    return 0;
+}
+
+inline size_t argsort_keys_tmp_size(std::nullptr_t, size_t size)
+{
+    return size;
+}
+
+template<class SortIndex, class Key, class KeysOutputIterator, class Index, class Sort>
+hipError_t argsort_width_impl(void*              temporary_storage,
+                              size_t&            storage_size,
+                              KeysOutputIterator keys_output,
+                              Index*             indices_output,
+                              const size_t       size,
+                              Sort&              sort,
+                              const hipStream_t  stream,
+                              const bool         debug_synchronous)
+{
+    // Indices of a narrower type are sorted in temporary storage and widened afterwards
+    constexpr bool widen = !std::is_same<SortIndex, Index>::value;
+
+    Key*       keys_tmp    = nullptr;
+    SortIndex* indices_tmp = nullptr;
+    const auto indices_input
+        = ::rocprim::make_counting_iterator<SortIndex>(static_cast<SortIndex>(0));
+
+    size_t sort_storage_size;
+    ROCPRIM_RETURN_ON_ERROR(sort(nullptr,
+                                 sort_storage_size,
+                                 argsort_keys_output(keys_output, keys_tmp),
+                                 indices_input,
+                                 indices_tmp));
+
+    void*            sort_storage;
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&keys_tmp,
+                                                    argsort_keys_tmp_size(keys_output, size)),
+            detail::temp_storage::ptr_aligned_array(&indices_tmp, widen ? size : 0),
+            detail::temp_storage::make_partition(&sort_storage, sort_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    // Without widening SortIndex is Index
+    SortIndex* const sorted_indices
+        = widen ? indices_tmp : reinterpret_cast<SortIndex*>(indices_output);
+    ROCPRIM_RETURN_ON_ERROR(sort(sort_storage,
+                                 sort_storage_size,
+                                 argsort_keys_output(keys_output, keys_tmp),
+                                 indices_input,
+                                 sorted_indices));
+    if(!widen)
+    {
+        return hipSuccess;
+    }
+    return ::rocprim::transform(indices_tmp,
+                                indices_output,
+                                size,
+                                ::rocprim::identity<Index>(),
+                                stream,
+                                debug_synchronous);
+}
+
+// Chooses 16-, 32- or 64-bit indices for the sort by the number of keys
+template<class Key, class KeysOutputIterator, class Index, class Sort>
+hipError_t argsort_impl(void*              temporary_storage,
+                        size_t&            storage_size,
+                        KeysOutputIterator keys_output,
+                        Index*             indices_output,
+                        const size_t       size,
+                        Sort               sort,
+                        const hipStream_t  stream,
+                        const bool         debug_synchronous)
+{
+    static_assert(std::is_integral<Index>::value, "Index must be an integral type.");
+    if(size > 0 && size - 1 > static_cast<size_t>(std::numeric_limits<Index>::max()))
+    {
+        // The positions of the keys do not fit in Index
+        return hipErrorInvalidValue;
+    }
+
+    if(size <= (size_t(1) << 16))
+    {
+        return argsort_width_impl<argsort_index_t<Index, unsigned short>, Key>(temporary_storage,
+                                                                              storage_size,
+                                                                              keys_output,
+                                                                              indices_output,
+                                                                              size,
+                                                                              sort,
+                                                                              stream,
+                                                                              debug_synchronous);
+    }
+    if(size <= (size_t(1) << 32))
+    {
+        return argsort_width_impl<argsort_index_t<Index, unsigned int>, Key>(temporary_storage,
+                                                                            storage_size,
+                                                                            keys_output,
+                                                                            indices_output,
+                                                                            size,
+                                                                            sort,
+                                                                            stream,
+                                                                            debug_synchronous);
+    }
+    return argsort_width_impl<Index, Key>(temporary_storage,
+                                          storage_size,
+                                          keys_output,
+                                          indices_output,
+                                          size,
+                                          sort,
+                                          stream,
+                                          debug_synchronous);
+}
+
+template<class Config, bool Descending, class KeysInputIterator>
+struct radix_argsort_sort
+{
+    KeysInputIterator keys_input;
+    size_t            size;
+    unsigned int      begin_bit;
+    unsigned int      end_bit;
+    hipStream_t       stream;
+    bool              debug_synchronous;
+
+    template<class KeysOutputIterator, class IndicesInputIterator, class Index>
+    hipError_t operator()(void*                storage,
+                          size_t&              storage_size,
+                          KeysOutputIterator   keys_output,
+                          IndicesInputIterator indices_input,
+                          Index*               indices_output)
+    {
+        bool ignored;
+        return radix_sort_impl<Config, Descending>(storage,
+                                                   storage_size,
+                                                   keys_input,
+                                                   nullptr,
+                                                   keys_output,
+                                                   indices_input,
+                                                   nullptr,
+                                                   indices_output,
+                                                   size,
+                                                   ignored,
+                                                   identity_decomposer{},
+                                                   begin_bit,
+                                                   end_bit,
+                                                   stream,
+                                                   debug_synchronous);
+    }
+};
+
+template<class Config, class KeysInputIterator, class BinaryFunction>
+struct merge_argsort_sort
+{
+    KeysInputIterator keys_input;
+    size_t            size;
+    BinaryFunction    compare_function;
+    hipStream_t       stream;
+    bool              debug_synchronous;
+
+    template<class KeysOutputIterator, class IndicesInputIterator, class Index>
+    hipError_t operator()(void*                storage,
+                          size_t&              storage_size,
+                          KeysOutputIterator   keys_output,
+                          IndicesInputIterator indices_input,
+                          Index*               indices_output)
+    {
+        return merge_sort_impl<Config>(storage,
+                                       storage_size,
+                                       keys_input,
+                                       keys_output,
+                                       indices_input,
+                                       indices_output,
+                                       size,
+                                       compare_function,
+                                       stream,
+                                       debug_synchronous);
+    }
+};
+
+template<class Config, bool Descending, class KeysInputIterator, class OffsetIterator>
+struct segmented_radix_argsort_sort
+{
+    KeysInputIterator keys_input;
+    unsigned int      size;
+    unsigned int      segments;
+    OffsetIterator    begin_offsets;
+    OffsetIterator    end_offsets;
+    unsigned int      begin_bit;
+    unsigned int      end_bit;
+    hipStream_t       stream;
+    bool              debug_synchronous;
+
+    template<class KeysOutputIterator, class IndicesInputIterator, class Index>
+    hipError_t operator()(void*                storage,
+                          size_t&              storage_size,
+                          KeysOutputIterator   keys_output,
+                          IndicesInputIterator indices_input,
+                          Index*               indices_output)
+    {
+        bool ignored;
+        return segmented_radix_sort_impl<Config, Descending>(storage,
+                                                             storage_size,
+                                                             keys_input,
+                                                             nullptr,
+                                                             keys_output,
+                                                             indices_input,
+                                                             nullptr,
+                                                             indices_output,
+                                                             size,
+                                                             ignored,
+                                                             segments,
+                                                             begin_offsets,
+                                                             end_offsets,
+                                                             begin_bit,
+                                                             end_bit,
+                                                             stream,
+                                                             debug_synchronous);
+    }
+};
+
+} // namespace detail
+
+/// \brief Parallel ascending radix argsort primitive for device level.
+///
+/// \p radix_argsort function writes the permutation that sorts the keys in ascending order:
+/// <tt>keys_input[indices_output[i]]</tt> is the <tt>i</tt>-th smallest key. It is like
+/// \p radix_sort_pairs with a \p counting_iterator as values, but the indices are generated
+/// by the sort itself.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type must be an arithmetic type (that is, an integral type or a floating-point type).
+/// * The sort uses 16-bit indices for at most 2<sup>16</sup> keys and 32-bit indices for
+/// at most 2<sup>32</sup> keys if \p Index is wider, and widens them to \p Index afterwards. With
+/// narrow indices integral keys of up to 32 bits sort as single 64-bit words.
+/// * \p keys_output may be \p nullptr when only the permutation is needed, the sorted keys are
+/// then kept in \p temporary_storage.
+/// * \p hipErrorInvalidValue is returned if the positions of the keys do not fit in \p Index.
+///
+/// \par Stability
+/// \p radix_argsort is \b stable: equal keys are ordered by their positions.
+///
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
+/// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator random-access iterator type of the output range, or \p std::nullptr_t.
+/// \tparam Index integral type of the indices.
+/// \tparam Size integral type that represents the problem size.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input pointer to the first element in the range to sort.
+/// \param [out] keys_output pointer to the first element in the output range of keys, or \p nullptr.
+/// \param [out] indices_output pointer to the first element in the output range of indices.
+/// \param [in] size number of element in the input range.
+/// \param [in] begin_bit [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;          // e.g., 8
+/// unsigned int * keys_input;  // e.g., [6, 3, 5, 4, 1, 8, 1, 7]
+/// size_t * indices_output;    // empty array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::radix_argsort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, nullptr, indices_output, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::radix_argsort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, nullptr, indices_output, input_size
+/// );
+/// // indices_output: [4, 6, 1, 3, 2, 0, 7, 5]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class Index,
+         class Size,
+         class Key = typename std::iterator_traits<KeysInputIterator>::value_type>
+hipError_t radix_argsort(void*              temporary_storage,
+                         size_t&            storage_size,
+                         KeysInputIterator  keys_input,
+                         KeysOutputIterator keys_output,
+                         Index*             indices_output,
+                         Size               size,
+                         unsigned int       begin_bit         = 0,
+                         unsigned int       end_bit           = 8 * sizeof(Key),
+                         hipStream_t        stream            = 0,
+                         bool               debug_synchronous = false)
+{
+    static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
+    return detail::argsort_impl<Key>(
+        temporary_storage,
+        storage_size,
+        keys_output,
+        indices_output,
+        static_cast<size_t>(size),
+        detail::radix_argsort_sort<Config, false, KeysInputIterator>{keys_input,
+                                                                     static_cast<size_t>(size),
+                                                                     begin_bit,
+                                                                     end_bit,
+                                                                     stream,
+                                                                     debug_synchronous},
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel descending radix argsort primitive for device level.
+///
+/// \p radix_argsort_desc function writes the permutation that sorts the keys in descending
+/// order, like \p radix_argsort does for the ascending order. It is \b stable: equal keys are
+/// ordered by their positions.
+///
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
+/// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator random-access iterator type of the output range, or \p std::nullptr_t.
+/// \tparam Index integral type of the indices.
+/// \tparam Size integral type that represents the problem size.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input pointer to the first element in the range to sort.
+/// \param [out] keys_output pointer to the first element in the output range of keys, or \p nullptr.
+/// \param [out] indices_output pointer to the first element in the output range of indices.
+/// \param [in] size number of element in the input range.
+/// \param [in] begin_bit [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// \param [in] end_bit [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class Index,
+         class Size,
+         class Key = typename std::iterator_traits<KeysInputIterator>::value_type>
+hipError_t radix_argsort_desc(void*              temporary_storage,
+                              size_t&            storage_size,
+                              KeysInputIterator  keys_input,
+                              KeysOutputIterator keys_output,
+                              Index*             indices_output,
+                              Size               size,
+                              unsigned int       begin_bit         = 0,
+                              unsigned int       end_bit           = 8 * sizeof(Key),
+                              hipStream_t        stream            = 0,
+                              bool               debug_synchronous = false)
+{
+    static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
+    return detail::argsort_impl<Key>(
+        temporary_storage,
+        storage_size,
+        keys_output,
+        indices_output,
+        static_cast<size_t>(size),
+        detail::radix_argsort_sort<Config, true, KeysInputIterator>{keys_input,
+                                                                    static_cast<size_t>(size),
+                                                                    begin_bit,
+                                                                    end_bit,
+                                                                    stream,
+                                                                    debug_synchronous},
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel merge argsort primitive for device level.
+///
+/// \p merge_argsort function writes the permutation that sorts the keys by \p compare_function:
+/// <tt>keys_input[indices_output[i]]</tt> is the <tt>i</tt>-th key of the sorted sequence. It is
+/// like \p merge_sort with a \p counting_iterator as values, with the index types and the
+/// optional keys output of \p radix_argsort.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * The sort uses 16-bit indices for at most 2<sup>16</sup> keys and 32-bit indices for
+/// at most 2<sup>32</sup> keys if \p Index is wider, and widens them to \p Index afterwards.
+/// * \p keys_output may be \p nullptr when only the permutation is needed, the sorted keys are
+/// then kept in \p temporary_storage.
+/// * \p hipErrorInvalidValue is returned if the positions of the keys do not fit in \p Index.
+///
+/// \par Stability
+/// \p merge_argsort is \b stable: equal keys are ordered by their positions.
+///
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `merge_sort_config`.
+/// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator random-access iterator type of the output range, or \p std::nullptr_t.
+/// \tparam Index integral type of the indices.
+/// \tparam BinaryFunction type of binary function used for sort. Default type
+/// is \p rocprim::less<T>, where \p T is a \p value_type of \p KeysInputIterator.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input pointer to the first element in the range to sort.
+/// \param [out] keys_output pointer to the first element in the output range of keys, or \p nullptr.
+/// \param [out] indices_output pointer to the first element in the output range of indices.
+/// \param [in] size number of element in the input range.
+/// \param [in] compare_function binary operation function object that will be used for comparison.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class Index,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>>
+hipError_t merge_argsort(void*              temporary_storage,
+                         size_t&            storage_size,
+                         KeysInputIterator  keys_input,
+                         KeysOutputIterator keys_output,
+                         Index*             indices_output,
+                         const size_t       size,
+                         BinaryFunction     compare_function  = BinaryFunction(),
+                         const hipStream_t  stream            = 0,
+                         bool               debug_synchronous = false)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+    return detail::argsort_impl<key_type>(
+        temporary_storage,
+        storage_size,
+        keys_output,
+        indices_output,
+        size,
+        detail::merge_argsort_sort<Config, KeysInputIterator, BinaryFunction>{keys_input,
+                                                                              size,
+                                                                              compare_function,
+                                                                              stream,
+                                                                              debug_synchronous},
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel ascending segmented radix argsort primitive for device level.
+///
+/// \p segmented_radix_argsort function writes the permutations that sort non-overlapping
+/// segments of keys in ascending order. Like \p segmented_radix_sort_pairs with a
+/// \p counting_iterator as values, the indices are positions in the whole input range, so
+/// <tt>keys_input[indices_output[i]]</tt> is the key that the sort moves to position \p i.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * The sort uses 16-bit indices for at most 2<sup>16</sup> keys if \p Index is wider, and
+/// widens them to \p Index afterwards.
+/// * \p keys_output may be \p nullptr when only the permutations are needed, the sorted keys
+/// are then kept in \p temporary_storage.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
+/// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
+/// <tt>offsets + 1</tt> for \p end_offsets.
+/// * The values of \p indices_output at positions outside of the segments are unspecified.
+/// * \p hipErrorInvalidValue is returned if the positions of the keys do not fit in \p Index.
+///
+/// \par Stability
+/// \p segmented_radix_argsort is \b stable: equal keys are ordered by their positions.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `segmented_radix_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range, or \p std::nullptr_t.
+/// \tparam Index - integral type of the indices.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range of keys, or \p nullptr.
+/// \param [out] indices_output - pointer to the first element in the output range of indices.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class Index,
+         class OffsetIterator,
+         class Key = typename std::iterator_traits<KeysInputIterator>::value_type>
+hipError_t segmented_radix_argsort(void*              temporary_storage,
+                                   size_t&            storage_size,
+                                   KeysInputIterator  keys_input,
+                                   KeysOutputIterator keys_output,
+                                   Index*             indices_output,
+                                   unsigned int       size,
+                                   unsigned int       segments,
+                                   OffsetIterator     begin_offsets,
+                                   OffsetIterator     end_offsets,
+                                   unsigned int       begin_bit         = 0,
+                                   unsigned int       end_bit           = 8 * sizeof(Key),
+                                   hipStream_t        stream            = 0,
+                                   bool               debug_synchronous = false)
+{
+    return detail::argsort_impl<Key>(temporary_storage,
+                                     storage_size,
+                                     keys_output,
+                                     indices_output,
+                                     size,
+                                     detail::segmented_radix_argsort_sort<Config,
+                                                                          false,
+                                                                          KeysInputIterator,
+                                                                          OffsetIterator>{
+                                         keys_input,
+                                         size,
+                                         segments,
+                                         begin_offsets,
+                                         end_offsets,
+                                         begin_bit,
+                                         end_bit,
+                                         stream,
+                                         debug_synchronous},
+                                     stream,
+                                     debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_ARGSORT_HPP_
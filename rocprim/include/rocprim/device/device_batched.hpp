@@ -0,0 +1,1926 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_BATCHED_HPP_
+#define ROCPRIM_DEVICE_DEVICE_BATCHED_HPP_
+
+#include "detail/device_batched.hpp"
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../iterator/constant_iterator.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../type_traits.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "detail/config/device_reduce.hpp"
+#include "detail/config/device_scan.hpp"
+#include "device_segmented_radix_sort.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<class PointersIterator>
+using batched_value_type = typename std::remove_cv<typename std::iterator_traits<
+    typename std::iterator_traits<PointersIterator>::value_type>::value_type>::type;
+
+template<class Config,
+         class InputPointersIterator,
+         class OutputIterator,
+         class SizesIterator,
+         class InitValueType,
+         class BinaryFunction>
+inline hipError_t batched_reduce_impl(void*                 temporary_storage,
+                                      size_t&               storage_size,
+                                      InputPointersIterator inputs,
+                                      OutputIterator        outputs,
+                                      SizesIterator         sizes,
+                                      const unsigned int    num_problems,
+                                      BinaryFunction        reduce_op,
+                                      InitValueType         initial_value,
+                                      const hipStream_t     stream,
+                                      const bool            debug_synchronous)
+{
+    using input_type = batched_value_type<InputPointersIterator>;
+    using result_type =
+        typename ::rocprim::invoke_result_binary_op<input_type, BinaryFunction>::type;
+
+    using config = wrapped_reduce_config<Config, result_type>;
+
+    detail::target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, target_arch));
+    const reduce_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size = params.reduce_config.block_size;
+
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, because
+        // hipMalloc will return nullptr when size is zero.
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    if(num_problems == 0u)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    batched_reduce_kernel<config>
+        <<<dim3(num_problems), dim3(block_size), 0, stream>>>(
+            inputs,
+            outputs,
+            sizes,
+            reduce_op,
+            static_cast<result_type>(initial_value));
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("batched_reduce_kernel", num_problems, start);
+
+    return hipSuccess;
+}
+
+template<bool Exclusive,
+         class Config,
+         class InputPointersIterator,
+         class OutputPointersIterator,
+         class SizesIterator,
+         class InitValueType,
+         class BinaryFunction>
+inline hipError_t batched_scan_impl(void*                  temporary_storage,
+                                    size_t&                storage_size,
+                                    InputPointersIterator  inputs,
+                                    OutputPointersIterator outputs,
+                                    SizesIterator          sizes,
+                                    const unsigned int     num_problems,
+                                    const InitValueType    initial_value,
+                                    BinaryFunction         scan_op,
+                                    const hipStream_t      stream,
+                                    const bool             debug_synchronous)
+{
+    using input_type  = batched_value_type<InputPointersIterator>;
+    using result_type = typename std::conditional<Exclusive, InitValueType, input_type>::type;
+
+    using config = wrapped_scan_config<Config, input_type>;
+
+    detail::target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, target_arch));
+    const scan_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size = params.kernel_config.block_size;
+
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, because
+        // hipMalloc will return nullptr when size is zero.
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    if(num_problems == 0u)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    batched_scan_kernel<Exclusive, config, result_type>
+        <<<dim3(num_problems), dim3(block_size), 0, stream>>>(inputs,
+                                                              outputs,
+                                                              sizes,
+                                                              initial_value,
+                                                              scan_op);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("batched_scan_kernel", num_problems, start);
+
+    return hipSuccess;
+}
+
+template<class Config,
+         bool Descending,
+         class KeysInputPointersIterator,
+         class KeysOutputPointersIterator,
+         class ValuesInputPointersIterator,
+         class ValuesOutputPointersIterator,
+         class SizesIterator>
+inline hipError_t batched_radix_sort_impl(void*                        temporary_storage,
+                                          size_t&                      storage_size,
+                                          KeysInputPointersIterator    keys_inputs,
+                                          KeysOutputPointersIterator   keys_outputs,
+                                          ValuesInputPointersIterator  values_inputs,
+                                          ValuesOutputPointersIterator values_outputs,
+                                          SizesIterator                sizes,
+                                          const unsigned int           num_problems,
+                                          const unsigned int           begin_bit,
+                                          const unsigned int           end_bit,
+                                          const hipStream_t            stream,
+                                          const bool                   debug_synchronous)
+{
+    using key_type   = batched_value_type<KeysInputPointersIterator>;
+    using value_type = batched_value_type<ValuesInputPointersIterator>;
+
+    using config = default_or_custom_config<Config, kernel_config<256, 16>>;
+
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, because
+        // hipMalloc will return nullptr when size is zero.
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    if(num_problems == 0u)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    batched_radix_sort_kernel<config, Descending, key_type, value_type>
+        <<<dim3(num_problems), dim3(config::block_size), 0, stream>>>(keys_inputs,
+                                                                      keys_outputs,
+                                                                      values_inputs,
+                                                                      values_outputs,
+                                                                      sizes,
+                                                                      begin_bit,
+                                                                      end_bit);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("batched_radix_sort_kernel", num_problems, start);
+
+    return hipSuccess;
+}
+
+// Sorts problems of the same size with the kernels of the segmented radix sort. Since all
+// problems have the same size, the kernel is selected by the size: a logical warp or a block
+// sorts each problem, and the offsets of the problems are computed instead of loaded.
+// problem_stride is the distance between the problems; the items span all problems.
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+inline hipError_t batched_radix_sort_fixed_size_impl(void*                temporary_storage,
+                                                     size_t&              storage_size,
+                                                     KeysInputIterator    keys_input,
+                                                     KeysOutputIterator   keys_output,
+                                                     ValuesInputIterator  values_input,
+                                                     ValuesOutputIterator values_output,
+                                                     const unsigned int   num_problems,
+                                                     const unsigned int   problem_size,
+                                                     const unsigned int   problem_stride,
+                                                     const unsigned int   items,
+                                                     const unsigned int   begin_bit,
+                                                     const unsigned int   end_bit,
+                                                     const hipStream_t    stream,
+                                                     const bool           debug_synchronous)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    using config = wrapped_segmented_radix_sort_config<Config, key_type, value_type>;
+
+    detail::target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, target_arch));
+    const segmented_radix_sort_config_params params = dispatch_target_arch<config>(target_arch);
+
+    constexpr bool     with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+    const bool         warp_sort   = params.warp_sort_config.partitioning_allowed;
+    const unsigned int max_small_problem_size
+        = params.warp_sort_config.items_per_thread_small
+          * params.warp_sort_config.logical_warp_size_small;
+    const unsigned int max_medium_problem_size
+        = params.warp_sort_config.items_per_thread_medium
+          * params.warp_sort_config.logical_warp_size_medium;
+    const unsigned int items_per_block
+        = params.kernel_config.block_size * params.kernel_config.items_per_thread;
+
+    const bool small  = warp_sort && problem_size <= max_small_problem_size;
+    const bool medium = warp_sort && !small && problem_size <= max_medium_problem_size;
+    // Only problems larger than a block are sorted in several passes through a double buffer
+    const bool multi_pass = !small && !medium && problem_size > items_per_block;
+
+    key_type*   keys_tmp;
+    value_type* values_tmp;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&keys_tmp, multi_pass ? items : 0),
+            detail::temp_storage::ptr_aligned_array(&values_tmp,
+                                                    multi_pass && with_values ? items : 0)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(num_problems == 0u || problem_size == 0u)
+    {
+        return hipSuccess;
+    }
+
+    const counting_iterator<unsigned int> problem_indices(0);
+    const auto                            begin_offsets
+        = make_transform_iterator(problem_indices, batched_problem_offset{problem_stride, 0});
+    const auto end_offsets
+        = make_transform_iterator(problem_indices,
+                                  batched_problem_offset{problem_stride, problem_size});
+    const ::rocprim::identity_decomposer decomposer{};
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    if(small || medium)
+    {
+        const unsigned int block_size = small ? params.warp_sort_config.block_size_small
+                                              : params.warp_sort_config.block_size_medium;
+        const unsigned int problems_per_block
+            = block_size
+              / (small ? params.warp_sort_config.logical_warp_size_small
+                       : params.warp_sort_config.logical_warp_size_medium);
+        const unsigned int grid_size = ceiling_div(num_problems, problems_per_block);
+        if(small)
+        {
+            segmented_sort_small_kernel<config, Descending>
+                <<<dim3(grid_size), dim3(block_size), 0, stream>>>(keys_input,
+                                                                   keys_tmp,
+                                                                   keys_output,
+                                                                   values_input,
+                                                                   values_tmp,
+                                                                   values_output,
+                                                                   true,
+                                                                   num_problems,
+                                                                   problem_indices,
+                                                                   begin_offsets,
+                                                                   end_offsets,
+                                                                   begin_bit,
+                                                                   end_bit,
+                                                                   decomposer);
+        }
+        else
+        {
+            segmented_sort_medium_kernel<config, Descending>
+                <<<dim3(grid_size), dim3(block_size), 0, stream>>>(keys_input,
+                                                                   keys_tmp,
+                                                                   keys_output,
+                                                                   values_input,
+                                                                   values_tmp,
+                                                                   values_output,
+                                                                   true,
+                                                                   num_problems,
+                                                                   problem_indices,
+                                                                   begin_offsets,
+                                                                   end_offsets,
+                                                                   begin_bit,
+                                                                   end_bit,
+                                                                   decomposer);
+        }
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("batched_radix_sort_warp_kernel",
+                                                    num_problems,
+                                                    start);
+    }
+    else
+    {
+        // The passes alternate between the buffers, the last one writes to the output
+        const unsigned int iterations = ceiling_div(end_bit - begin_bit, params.long_radix_bits);
+        const bool         to_output  = (iterations - 1) % 2 == 0;
+        segmented_sort_kernel<config, Descending>
+            <<<dim3(num_problems), dim3(params.kernel_config.block_size), 0, stream>>>(
+                keys_input,
+                keys_tmp,
+                keys_output,
+                values_input,
+                values_tmp,
+                values_output,
+                to_output,
+                begin_offsets,
+                end_offsets,
+                iterations,
+                begin_bit,
+                end_bit,
+                decomposer);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("batched_radix_sort_block_kernel",
+                                                    num_problems,
+                                                    start);
+    }
+
+    return hipSuccess;
+}
+
+template<class Config, bool Descending, class Key, class Value>
+inline hipError_t batched_radix_sort_strided_impl(void*              temporary_storage,
+                                                  size_t&            storage_size,
+                                                  const Key*         keys_input,
+                                                  Key*               keys_output,
+                                                  const Value*       values_input,
+                                                  Value*             values_output,
+                                                  const unsigned int num_problems,
+                                                  const unsigned int problem_size,
+                                                  const size_t       problem_stride,
+                                                  const size_t       item_stride,
+                                                  const unsigned int begin_bit,
+                                                  const unsigned int end_bit,
+                                                  const hipStream_t  stream,
+                                                  const bool         debug_synchronous)
+{
+    if(begin_bit >= end_bit || end_bit > 8 * sizeof(Key) || item_stride == 0)
+    {
+        return hipErrorInvalidValue;
+    }
+    if(::rocprim::is_floating_point<Key>::value
+       && ((begin_bit != 0) || (end_bit != sizeof(Key) * 8)))
+    {
+        return hipErrorInvalidValue;
+    }
+
+    // The offsets of the segmented sort are 32-bit
+    constexpr size_t max_items = std::numeric_limits<unsigned int>::max();
+
+    if(item_stride == 1)
+    {
+        // The problems are rows, the segments are addressed by their offsets in the rows
+        if(num_problems > 1 && problem_stride < problem_size)
+        {
+            return hipErrorInvalidValue;
+        }
+        const size_t items
+            = num_problems == 0u ? 0 : (num_problems - size_t(1)) * problem_stride + problem_size;
+        if(items > max_items)
+        {
+            return hipErrorInvalidValue;
+        }
+        return batched_radix_sort_fixed_size_impl<Config, Descending>(
+            temporary_storage,
+            storage_size,
+            keys_input,
+            keys_output,
+            values_input,
+            values_output,
+            num_problems,
+            problem_size,
+            static_cast<unsigned int>(problem_stride),
+            static_cast<unsigned int>(items),
+            begin_bit,
+            end_bit,
+            stream,
+            debug_synchronous);
+    }
+
+    // Other layouts are addressed by the index of the item in the batch
+    const size_t items = size_t(num_problems) * problem_size;
+    if(items > max_items)
+    {
+        return hipErrorInvalidValue;
+    }
+    return batched_radix_sort_fixed_size_impl<Config, Descending>(
+        temporary_storage,
+        storage_size,
+        batched_strided_iterator<const Key>(keys_input, problem_size, problem_stride, item_stride),
+        batched_strided_iterator<Key>(keys_output, problem_size, problem_stride, item_stride),
+        batched_strided_iterator<const Value>(values_input,
+                                              problem_size,
+                                              problem_stride,
+                                              item_stride),
+        batched_strided_iterator<Value>(values_output, problem_size, problem_stride, item_stride),
+        num_problems,
+        problem_size,
+        problem_size,
+        static_cast<unsigned int>(items),
+        begin_bit,
+        end_bit,
+        stream,
+        debug_synchronous);
+}
+
+template<class SamplePointersIterator,
+         class SizesIterator,
+         class HistogramPointersIterator,
+         class SampleToBinOpFactory>
+inline hipError_t batched_histogram_impl(void*                     temporary_storage,
+                                         size_t&                   storage_size,
+                                         SamplePointersIterator    samples,
+                                         SizesIterator             sizes,
+                                         HistogramPointersIterator histograms,
+                                         SampleToBinOpFactory      sample_to_bin_ops,
+                                         const unsigned int        num_problems,
+                                         const hipStream_t         stream,
+                                         const bool                debug_synchronous)
+{
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, because
+        // hipMalloc will return nullptr when size is zero.
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    if(num_problems == 0u)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    batched_histogram_kernel<batched_histogram_block_size>
+        <<<dim3(num_problems), dim3(batched_histogram_block_size), 0, stream>>>(samples,
+                                                                               sizes,
+                                                                               histograms,
+                                                                               sample_to_bin_ops);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("batched_histogram_kernel", num_problems, start);
+
+    return hipSuccess;
+}
+
+template<class ResultType, class InputIterator, class BinaryFunction>
+inline hipError_t column_reduce_chunks(InputIterator      input,
+                                       const size_t       pitch,
+                                       const unsigned int rows,
+                                       const unsigned int columns,
+                                       const unsigned int rows_per_chunk,
+                                       const unsigned int chunks,
+                                       ResultType*        partials,
+                                       BinaryFunction     reduce_op,
+                                       const hipStream_t  stream,
+                                       const bool         debug_synchronous)
+{
+    constexpr unsigned int block_size = column_block_size;
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    column_reduce_chunks_kernel<block_size>
+        <<<dim3(ceiling_div(columns, block_size), chunks), dim3(block_size), 0, stream>>>(
+            input,
+            pitch,
+            rows,
+            columns,
+            rows_per_chunk,
+            partials,
+            reduce_op);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("column_reduce_chunks_kernel",
+                                                size_t(rows) * columns,
+                                                start);
+    return hipSuccess;
+}
+
+template<class InputIterator, class OutputIterator, class BinaryFunction, class InitValueType>
+inline hipError_t column_reduce_impl(void*              temporary_storage,
+                                     size_t&            storage_size,
+                                     InputIterator      input,
+                                     OutputIterator     output,
+                                     const unsigned int rows,
+                                     const unsigned int columns,
+                                     const size_t       pitch,
+                                     BinaryFunction     reduce_op,
+                                     InitValueType      initial_value,
+                                     const hipStream_t  stream,
+                                     const bool         debug_synchronous)
+{
+    using input_type  = typename std::iterator_traits<InputIterator>::value_type;
+    using result_type = ::rocprim::invoke_result_binary_op_t<input_type, BinaryFunction>;
+
+    constexpr unsigned int block_size     = column_block_size;
+    const unsigned int     rows_per_chunk = column_rows_per_chunk(rows, columns);
+    const unsigned int     chunks         = ceiling_div(rows, rows_per_chunk);
+
+    result_type* partials;
+
+    const hipError_t partition_result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::ptr_aligned_array(&partials, size_t(chunks) * columns)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr || columns == 0)
+    {
+        return partition_result;
+    }
+
+    if(chunks > 0)
+    {
+        ROCPRIM_RETURN_ON_ERROR(column_reduce_chunks(input,
+                                                     pitch,
+                                                     rows,
+                                                     columns,
+                                                     rows_per_chunk,
+                                                     chunks,
+                                                     partials,
+                                                     reduce_op,
+                                                     stream,
+                                                     debug_synchronous));
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    column_reduce_kernel<block_size>
+        <<<dim3(ceiling_div(columns, block_size)), dim3(block_size), 0, stream>>>(
+            partials,
+            chunks,
+            columns,
+            output,
+            reduce_op,
+            static_cast<result_type>(initial_value));
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("column_reduce_kernel", columns, start);
+
+    return hipSuccess;
+}
+
+template<bool Exclusive,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction>
+inline hipError_t column_scan_impl(void*              temporary_storage,
+                                   size_t&            storage_size,
+                                   InputIterator      input,
+                                   OutputIterator     output,
+                                   const unsigned int rows,
+                                   const unsigned int columns,
+                                   const size_t       input_pitch,
+                                   const size_t       output_pitch,
+                                   const ResultType   initial_value,
+                                   BinaryFunction     scan_op,
+                                   const hipStream_t  stream,
+                                   const bool         debug_synchronous)
+{
+    constexpr unsigned int block_size     = column_block_size;
+    const unsigned int     rows_per_chunk = column_rows_per_chunk(rows, columns);
+    const unsigned int     chunks         = ceiling_div(rows, rows_per_chunk);
+
+    // Only the chunks before the last one are needed as prefixes
+    ResultType* partials;
+
+    const hipError_t partition_result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(temp_storage::ptr_aligned_array(
+            &partials,
+            size_t(chunks > 1 ? chunks - 1 : 0) * columns)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr || rows == 0
+       || columns == 0)
+    {
+        return partition_result;
+    }
+
+    if(chunks > 1)
+    {
+        ROCPRIM_RETURN_ON_ERROR(column_reduce_chunks(input,
+                                                     input_pitch,
+                                                     (chunks - 1) * rows_per_chunk,
+                                                     columns,
+                                                     rows_per_chunk,
+                                                     chunks - 1,
+                                                     partials,
+                                                     scan_op,
+                                                     stream,
+                                                     debug_synchronous));
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    column_scan_kernel<Exclusive, block_size>
+        <<<dim3(ceiling_div(columns, block_size), chunks), dim3(block_size), 0, stream>>>(
+            input,
+            input_pitch,
+            output,
+            output_pitch,
+            rows,
+            columns,
+            rows_per_chunk,
+            static_cast<const ResultType*>(partials),
+            scan_op,
+            initial_value);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("column_scan_kernel",
+                                                size_t(rows) * columns,
+                                                start);
+
+    return hipSuccess;
+}
+
+} // end of detail namespace
+
+/// \brief Reduces each of many independent arrays with a single launch.
+///
+/// Computes `outputs[i]` as the reduction of `sizes[i]` values starting at `inputs[i]`, with
+/// \p initial_value, for all `i` in [0, \p num_problems). Each array is reduced by one block,
+/// so the arrays do not have to be part of the same allocation.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * This is meant for many small arrays. A single large array is reduced faster by
+/// \p reduce.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `reduce_config`.
+/// \tparam InputPointersIterator - random-access iterator type of the input pointers. The
+/// pointed-to values are read as random-access iterators.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be a
+/// simple pointer type.
+/// \tparam SizesIterator - random-access iterator type of the array sizes.
+/// \tparam BinaryFunction - type of binary function used for reduction.
+/// \tparam InitValueType - type of the initial value.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] inputs - iterator to the pointers of the arrays to reduce.
+/// \param [out] outputs - iterator to the first element of the \p num_problems results.
+/// \param [in] sizes - iterator to the sizes of the arrays.
+/// \param [in] num_problems - number of arrays.
+/// \param [in] reduce_op - binary operation function object that will be used for reduction.
+/// The default value is \p BinaryFunction().
+/// \param [in] initial_value - initial value to start each reduction.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// int*          a;            // e.g., [1, 2, 3]
+/// int*          b;            // e.g., [4, 5]
+/// int**         inputs;       // e.g., [a, b]
+/// unsigned int* sizes;        // e.g., [3, 2]
+/// int*          outputs;      // empty array of 2 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::batched_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     inputs, outputs, sizes, 2
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the reductions
+/// rocprim::batched_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     inputs, outputs, sizes, 2
+/// );
+/// // outputs: [6, 9]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputPointersIterator,
+         class OutputIterator,
+         class SizesIterator,
+         class BinaryFunction
+         = ::rocprim::plus<detail::batched_value_type<InputPointersIterator>>,
+         class InitValueType = detail::batched_value_type<InputPointersIterator>>
+inline hipError_t batched_reduce(void*                 temporary_storage,
+                                 size_t&               storage_size,
+                                 InputPointersIterator inputs,
+                                 OutputIterator        outputs,
+                                 SizesIterator         sizes,
+                                 const unsigned int    num_problems,
+                                 BinaryFunction        reduce_op         = BinaryFunction(),
+                                 InitValueType         initial_value     = InitValueType(),
+                                 const hipStream_t     stream            = 0,
+                                 const bool            debug_synchronous = false)
+{
+    return detail::batched_reduce_impl<Config>(temporary_storage,
+                                               storage_size,
+                                               inputs,
+                                               outputs,
+                                               sizes,
+                                               num_problems,
+                                               reduce_op,
+                                               initial_value,
+                                               stream,
+                                               debug_synchronous);
+}
+
+/// \brief Computes inclusive scans of many independent arrays with a single launch.
+///
+/// Scans `sizes[i]` values starting at `inputs[i]` into the range starting at `outputs[i]`,
+/// for all `i` in [0, \p num_problems). Each array is scanned by one block, so the arrays do
+/// not have to be part of the same allocation.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * This is meant for many small arrays. A single large array is scanned faster by
+/// \p inclusive_scan.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `scan_config`.
+/// \tparam InputPointersIterator - random-access iterator type of the input pointers.
+/// \tparam OutputPointersIterator - random-access iterator type of the output pointers.
+/// \tparam SizesIterator - random-access iterator type of the array sizes.
+/// \tparam BinaryFunction - type of binary function used for scan.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] inputs - iterator to the pointers of the arrays to scan.
+/// \param [in] outputs - iterator to the pointers of the output arrays. An output array may
+/// be the same as its input array.
+/// \param [in] sizes - iterator to the sizes of the arrays.
+/// \param [in] num_problems - number of arrays.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputPointersIterator,
+         class OutputPointersIterator,
+         class SizesIterator,
+         class BinaryFunction
+         = ::rocprim::plus<detail::batched_value_type<InputPointersIterator>>>
+inline hipError_t batched_inclusive_scan(void*                  temporary_storage,
+                                         size_t&                storage_size,
+                                         InputPointersIterator  inputs,
+                                         OutputPointersIterator outputs,
+                                         SizesIterator          sizes,
+                                         const unsigned int     num_problems,
+                                         BinaryFunction         scan_op = BinaryFunction(),
+                                         const hipStream_t      stream  = 0,
+                                         const bool             debug_synchronous = false)
+{
+    using result_type = detail::batched_value_type<InputPointersIterator>;
+
+    return detail::batched_scan_impl<false, Config>(temporary_storage,
+                                                    storage_size,
+                                                    inputs,
+                                                    outputs,
+                                                    sizes,
+                                                    num_problems,
+                                                    result_type(),
+                                                    scan_op,
+                                                    stream,
+                                                    debug_synchronous);
+}
+
+/// \brief Computes exclusive scans of many independent arrays with a single launch.
+///
+/// Scans `sizes[i]` values starting at `inputs[i]` into the range starting at `outputs[i]`,
+/// starting each scan with \p initial_value, for all `i` in [0, \p num_problems). Each array is
+/// scanned by one block, so the arrays do not have to be part of the same allocation.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * This is meant for many small arrays. A single large array is scanned faster by
+/// \p exclusive_scan.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `scan_config`.
+/// \tparam InputPointersIterator - random-access iterator type of the input pointers.
+/// \tparam OutputPointersIterator - random-access iterator type of the output pointers.
+/// \tparam SizesIterator - random-access iterator type of the array sizes.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for scan.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] inputs - iterator to the pointers of the arrays to scan.
+/// \param [in] outputs - iterator to the pointers of the output arrays. An output array may
+/// be the same as its input array.
+/// \param [in] sizes - iterator to the sizes of the arrays.
+/// \param [in] num_problems - number of arrays.
+/// \param [in] initial_value - initial value of each scan.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputPointersIterator,
+         class OutputPointersIterator,
+         class SizesIterator,
+         class InitValueType,
+         class BinaryFunction
+         = ::rocprim::plus<detail::batched_value_type<InputPointersIterator>>>
+inline hipError_t batched_exclusive_scan(void*                  temporary_storage,
+                                         size_t&                storage_size,
+                                         InputPointersIterator  inputs,
+                                         OutputPointersIterator outputs,
+                                         SizesIterator          sizes,
+                                         const unsigned int     num_problems,
+                                         const InitValueType    initial_value,
+                                         BinaryFunction         scan_op = BinaryFunction(),
+                                         const hipStream_t      stream  = 0,
+                                         const bool             debug_synchronous = false)
+{
+    return detail::batched_scan_impl<true, Config>(temporary_storage,
+                                                   storage_size,
+                                                   inputs,
+                                                   outputs,
+                                                   sizes,
+                                                   num_problems,
+                                                   initial_value,
+                                                   scan_op,
+                                                   stream,
+                                                   debug_synchronous);
+}
+
+/// \brief Sorts the keys of many independent arrays in ascending order with a single launch.
+///
+/// Sorts `sizes[i]` keys starting at `keys_inputs[i]` into the range starting at
+/// `keys_outputs[i]`, for all `i` in [0, \p num_problems). Each array is sorted by one block in
+/// shared memory, so the arrays do not have to be part of the same allocation.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * Each array must have at most `block_size * items_per_thread` keys of \p Config
+/// (4096 for the default config). Larger arrays are not sorted; use \p radix_sort_keys or
+/// \p segmented_radix_sort_keys for them.
+/// * The sort is stable and only the <tt>[begin_bit, end_bit)</tt> range of bits is compared.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `kernel_config`.
+/// \tparam KeysInputPointersIterator - random-access iterator type of the input pointers.
+/// \tparam KeysOutputPointersIterator - random-access iterator type of the output pointers.
+/// \tparam SizesIterator - random-access iterator type of the array sizes.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_inputs - iterator to the pointers of the arrays to sort.
+/// \param [in] keys_outputs - iterator to the pointers of the output arrays. An output
+/// array may be the same as its input array.
+/// \param [in] sizes - iterator to the sizes of the arrays.
+/// \param [in] num_problems - number of arrays.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Value of \p begin_bit must be in range <tt>[0; 8 * sizeof(Key))</tt>.
+/// Default value: \p 0.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Value of \p end_bit must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>.
+/// Default value: \p <tt>8 * sizeof(Key)</tt>.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputPointersIterator,
+         class KeysOutputPointersIterator,
+         class SizesIterator,
+         class Key = detail::batched_value_type<KeysInputPointersIterator>>
+inline hipError_t batched_radix_sort_keys(void*                      temporary_storage,
+                                          size_t&                    storage_size,
+                                          KeysInputPointersIterator  keys_inputs,
+                                          KeysOutputPointersIterator keys_outputs,
+                                          SizesIterator              sizes,
+                                          const unsigned int         num_problems,
+                                          const unsigned int         begin_bit = 0,
+                                          const unsigned int end_bit = 8 * sizeof(Key),
+                                          const hipStream_t  stream  = 0,
+                                          const bool         debug_synchronous = false)
+{
+    empty_type** values = nullptr;
+    return detail::batched_radix_sort_impl<Config, false>(temporary_storage,
+                                                          storage_size,
+                                                          keys_inputs,
+                                                          keys_outputs,
+                                                          values,
+                                                          values,
+                                                          sizes,
+                                                          num_problems,
+                                                          begin_bit,
+                                                          end_bit,
+                                                          stream,
+                                                          debug_synchronous);
+}
+
+/// \brief Sorts the keys of many independent arrays in descending order with a single launch.
+///
+/// The same as \p batched_radix_sort_keys, except the keys are sorted in descending order.
+template<class Config = default_config,
+         class KeysInputPointersIterator,
+         class KeysOutputPointersIterator,
+         class SizesIterator,
+         class Key = detail::batched_value_type<KeysInputPointersIterator>>
+inline hipError_t batched_radix_sort_keys_desc(void*                      temporary_storage,
+                                               size_t&                    storage_size,
+                                               KeysInputPointersIterator  keys_inputs,
+                                               KeysOutputPointersIterator keys_outputs,
+                                               SizesIterator              sizes,
+                                               const unsigned int         num_problems,
+                                               const unsigned int         begin_bit = 0,
+                                               const unsigned int end_bit = 8 * sizeof(Key),
+                                               const hipStream_t  stream  = 0,
+                                               const bool         debug_synchronous = false)
+{
+    empty_type** values = nullptr;
+    return detail::batched_radix_sort_impl<Config, true>(temporary_storage,
+                                                         storage_size,
+                                                         keys_inputs,
+                                                         keys_outputs,
+                                                         values,
+                                                         values,
+                                                         sizes,
+                                                         num_problems,
+                                                         begin_bit,
+                                                         end_bit,
+                                                         stream,
+                                                         debug_synchronous);
+}
+
+/// \brief Sorts key-value pairs of many independent arrays in ascending order of the keys with
+/// a single launch.
+///
+/// Sorts `sizes[i]` pairs starting at `keys_inputs[i]` and `values_inputs[i]` into the ranges
+/// starting at `keys_outputs[i]` and `values_outputs[i]`, for all `i` in [0, \p num_problems).
+/// The same limits as for \p batched_radix_sort_keys apply.
+///
+/// \param [in] values_inputs - iterator to the pointers of the value arrays to sort.
+/// \param [in] values_outputs - iterator to the pointers of the output value arrays.
+template<class Config = default_config,
+         class KeysInputPointersIterator,
+         class KeysOutputPointersIterator,
+         class ValuesInputPointersIterator,
+         class ValuesOutputPointersIterator,
+         class SizesIterator,
+         class Key = detail::batched_value_type<KeysInputPointersIterator>>
+inline hipError_t batched_radix_sort_pairs(void*                        temporary_storage,
+                                           size_t&                      storage_size,
+                                           KeysInputPointersIterator    keys_inputs,
+                                           KeysOutputPointersIterator   keys_outputs,
+                                           ValuesInputPointersIterator  values_inputs,
+                                           ValuesOutputPointersIterator values_outputs,
+                                           SizesIterator                sizes,
+                                           const unsigned int           num_problems,
+                                           const unsigned int           begin_bit = 0,
+                                           const unsigned int end_bit = 8 * sizeof(Key),
+                                           const hipStream_t  stream  = 0,
+                                           const bool         debug_synchronous = false)
+{
+    return detail::batched_radix_sort_impl<Config, false>(temporary_storage,
+                                                          storage_size,
+                                                          keys_inputs,
+                                                          keys_outputs,
+                                                          values_inputs,
+                                                          values_outputs,
+                                                          sizes,
+                                                          num_problems,
+                                                          begin_bit,
+                                                          end_bit,
+                                                          stream,
+                                                          debug_synchronous);
+}
+
+/// \brief Sorts key-value pairs of many independent arrays in descending order of the keys
+/// with a single launch.
+///
+/// The same as \p batched_radix_sort_pairs, except the keys are sorted in descending order.
+template<class Config = default_config,
+         class KeysInputPointersIterator,
+         class KeysOutputPointersIterator,
+         class ValuesInputPointersIterator,
+         class ValuesOutputPointersIterator,
+         class SizesIterator,
+         class Key = detail::batched_value_type<KeysInputPointersIterator>>
+inline hipError_t batched_radix_sort_pairs_desc(void*                        temporary_storage,
+                                                size_t&                      storage_size,
+                                                KeysInputPointersIterator    keys_inputs,
+                                                KeysOutputPointersIterator   keys_outputs,
+                                                ValuesInputPointersIterator  values_inputs,
+                                                ValuesOutputPointersIterator values_outputs,
+                                                SizesIterator                sizes,
+                                                const unsigned int           num_problems,
+                                                const unsigned int           begin_bit = 0,
+                                                const unsigned int end_bit = 8 * sizeof(Key),
+                                                const hipStream_t  stream  = 0,
+                                                const bool         debug_synchronous = false)
+{
+    return detail::batched_radix_sort_impl<Config, true>(temporary_storage,
+                                                         storage_size,
+                                                         keys_inputs,
+                                                         keys_outputs,
+                                                         values_inputs,
+                                                         values_outputs,
+                                                         sizes,
+                                                         num_problems,
+                                                         begin_bit,
+                                                         end_bit,
+                                                         stream,
+                                                         debug_synchronous);
+}
+
+/// \brief Sorts the keys of a batch of problems of the same size in ascending order.
+///
+/// Sorts \p num_problems problems of \p problem_size keys each, for example the rows of
+/// a matrix. Item \p j of problem \p i is at <tt>i * problem_stride + j * item_stride</tt> in
+/// \p keys_input and in \p keys_output. Since all problems have the same size, no offsets are
+/// loaded and no partitioning by size is needed: the kernel of the segmented radix sort that
+/// suits \p problem_size sorts one problem by a logical warp or a block.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer. Temporary storage for the keys and values is only
+/// needed when a problem is larger than a block.
+/// * With <tt>item_stride == 1</tt> the problems are rows of \p problem_size keys, which are
+/// \p problem_stride keys apart (<tt>problem_stride >= problem_size</tt>).
+/// * Other layouts address each key by its index in the batch, which costs a division per
+/// access. For example the columns of a row-major matrix with \p columns columns are sorted
+/// with <tt>problem_stride = 1</tt> and <tt>item_stride = columns</tt>.
+/// * The problems must not overlap, and the offsets of all items must fit in 32 bits.
+/// * The sort is stable and only the <tt>[begin_bit, end_bit)</tt> range of bits is compared.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `segmented_radix_sort_config`.
+/// \tparam Key - key type. Must be an arithmetic type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the keys to sort.
+/// \param [out] keys_output - pointer to the sorted keys, with the layout of \p keys_input.
+/// The ranges must not overlap.
+/// \param [in] num_problems - number of problems.
+/// \param [in] problem_size - number of keys of every problem.
+/// \param [in] problem_stride - distance between the first keys of consecutive problems.
+/// \param [in] item_stride - distance between consecutive keys of a problem.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Value of \p begin_bit must be in range <tt>[0; 8 * sizeof(Key))</tt>.
+/// Default value: \p 0.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Value of \p end_bit must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>.
+/// Default value: \p <tt>8 * sizeof(Key)</tt>.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the rows of a row-major matrix of 100000 rows of 1024 keys are sorted.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int   rows    = 100000;
+/// unsigned int   columns = 1024;
+/// unsigned int * input;   // rows * columns keys
+/// unsigned int * output;  // rows * columns keys
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::batched_radix_sort_keys_strided(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, rows, columns, columns, 1
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // sort every row
+/// rocprim::batched_radix_sort_keys_strided(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, rows, columns, columns, 1
+/// );
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class Key>
+inline hipError_t batched_radix_sort_keys_strided(void*              temporary_storage,
+                                                  size_t&            storage_size,
+                                                  const Key*         keys_input,
+                                                  Key*               keys_output,
+                                                  const unsigned int num_problems,
+                                                  const unsigned int problem_size,
+                                                  const size_t       problem_stride,
+                                                  const size_t       item_stride,
+                                                  const unsigned int begin_bit = 0,
+                                                  const unsigned int end_bit = 8 * sizeof(Key),
+                                                  const hipStream_t  stream  = 0,
+                                                  const bool         debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::batched_radix_sort_strided_impl<Config, false>(temporary_storage,
+                                                                  storage_size,
+                                                                  keys_input,
+                                                                  keys_output,
+                                                                  values,
+                                                                  values,
+                                                                  num_problems,
+                                                                  problem_size,
+                                                                  problem_stride,
+                                                                  item_stride,
+                                                                  begin_bit,
+                                                                  end_bit,
+                                                                  stream,
+                                                                  debug_synchronous);
+}
+
+/// \brief Sorts the keys of a batch of problems of the same size in descending order.
+///
+/// The same as \p batched_radix_sort_keys_strided, except the keys are sorted in descending
+/// order.
+template<class Config = default_config, class Key>
+inline hipError_t
+    batched_radix_sort_keys_desc_strided(void*              temporary_storage,
+                                         size_t&            storage_size,
+                                         const Key*         keys_input,
+                                         Key*               keys_output,
+                                         const unsigned int num_problems,
+                                         const unsigned int problem_size,
+                                         const size_t       problem_stride,
+                                         const size_t       item_stride,
+                                         const unsigned int begin_bit         = 0,
+                                         const unsigned int end_bit           = 8 * sizeof(Key),
+                                         const hipStream_t  stream            = 0,
+                                         const bool         debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::batched_radix_sort_strided_impl<Config, true>(temporary_storage,
+                                                                 storage_size,
+                                                                 keys_input,
+                                                                 keys_output,
+                                                                 values,
+                                                                 values,
+                                                                 num_problems,
+                                                                 problem_size,
+                                                                 problem_stride,
+                                                                 item_stride,
+                                                                 begin_bit,
+                                                                 end_bit,
+                                                                 stream,
+                                                                 debug_synchronous);
+}
+
+/// \brief Sorts key-value pairs of a batch of problems of the same size in ascending order of
+/// the keys.
+///
+/// The same as \p batched_radix_sort_keys_strided, except the values are moved with their
+/// keys. The values have the layout of the keys.
+///
+/// \param [in] values_input - pointer to the values to sort.
+/// \param [out] values_output - pointer to the sorted values.
+template<class Config = default_config, class Key, class Value>
+inline hipError_t batched_radix_sort_pairs_strided(void*              temporary_storage,
+                                                   size_t&            storage_size,
+                                                   const Key*         keys_input,
+                                                   Key*               keys_output,
+                                                   const Value*       values_input,
+                                                   Value*             values_output,
+                                                   const unsigned int num_problems,
+                                                   const unsigned int problem_size,
+                                                   const size_t       problem_stride,
+                                                   const size_t       item_stride,
+                                                   const unsigned int begin_bit = 0,
+                                                   const unsigned int end_bit = 8 * sizeof(Key),
+                                                   const hipStream_t  stream  = 0,
+                                                   const bool         debug_synchronous = false)
+{
+    return detail::batched_radix_sort_strided_impl<Config, false>(temporary_storage,
+                                                                  storage_size,
+                                                                  keys_input,
+                                                                  keys_output,
+                                                                  values_input,
+                                                                  values_output,
+                                                                  num_problems,
+                                                                  problem_size,
+                                                                  problem_stride,
+                                                                  item_stride,
+                                                                  begin_bit,
+                                                                  end_bit,
+                                                                  stream,
+                                                                  debug_synchronous);
+}
+
+/// \brief Sorts key-value pairs of a batch of problems of the same size in descending order
+/// of the keys.
+///
+/// The same as \p batched_radix_sort_pairs_strided, except the keys are sorted in descending
+/// order.
+template<class Config = default_config, class Key, class Value>
+inline hipError_t
+    batched_radix_sort_pairs_desc_strided(void*              temporary_storage,
+                                          size_t&            storage_size,
+                                          const Key*         keys_input,
+                                          Key*               keys_output,
+                                          const Value*       values_input,
+                                          Value*             values_output,
+                                          const unsigned int num_problems,
+                                          const unsigned int problem_size,
+                                          const size_t       problem_stride,
+                                          const size_t       item_stride,
+                                          const unsigned int begin_bit         = 0,
+                                          const unsigned int end_bit           = 8 * sizeof(Key),
+                                          const hipStream_t  stream            = 0,
+                                          const bool         debug_synchronous = false)
+{
+    return detail::batched_radix_sort_strided_impl<Config, true>(temporary_storage,
+                                                                 storage_size,
+                                                                 keys_input,
+                                                                 keys_output,
+                                                                 values_input,
+                                                                 values_output,
+                                                                 num_problems,
+                                                                 problem_size,
+                                                                 problem_stride,
+                                                                 item_stride,
+                                                                 begin_bit,
+                                                                 end_bit,
+                                                                 stream,
+                                                                 debug_synchronous);
+}
+
+/// \brief Computes histograms with equal-width bins of many independent arrays with a single
+/// launch.
+///
+/// Computes the histogram of `sizes[i]` samples starting at `samples[i]` into the
+/// `levels[i] - 1` bins starting at `histograms[i]`, for all `i` in [0, \p num_problems). The
+/// bins of problem `i` evenly divide [`lower_levels[i]`, `upper_levels[i]`). Each array is
+/// processed by one block, which also clears its histogram, so a batch costs a single launch
+/// instead of the two launches of \p histogram_even per array.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * Histograms of up to 2048 bins are counted in shared memory, larger ones with global
+/// atomics.
+/// * The histogram of a problem with fewer than 2 levels is left unchanged.
+/// * This is meant for many small arrays. A single large array is processed faster by
+/// \p histogram_even.
+///
+/// \tparam SamplePointersIterator - random-access iterator type of the sample pointers. The
+/// pointed-to values are read as random-access iterators.
+/// \tparam SizesIterator - random-access iterator type of the array sizes.
+/// \tparam HistogramPointersIterator - random-access iterator type of the histogram pointers.
+/// The pointed-to values are pointers to integer bin counters.
+/// \tparam LevelsIterator - random-access iterator type of the numbers of levels.
+/// \tparam LevelIterator - random-access iterator type of the lower and upper levels.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without computing the histograms.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the pointers of the arrays of samples.
+/// \param [in] sizes - iterator to the sizes of the arrays.
+/// \param [out] histograms - iterator to the pointers of the histograms.
+/// \param [in] levels - iterator to the numbers of boundaries (levels) of the histograms.
+/// \param [in] lower_levels - iterator to the lower sample value bounds (inclusive) of the
+/// first bins.
+/// \param [in] upper_levels - iterator to the upper sample value bounds (exclusive) of the
+/// last bins.
+/// \param [in] num_problems - number of arrays.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime
+/// error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// float*         a;             // e.g., [0.5, 1.5, 1.7]
+/// float*         b;             // e.g., [3.0, 9.0]
+/// float**        samples;       // e.g., [a, b]
+/// unsigned int*  sizes;         // e.g., [3, 2]
+/// unsigned int** histograms;    // e.g., pointers to 2 and 5 bins
+/// unsigned int*  levels;        // e.g., [3, 6]
+/// float*         lower_levels;  // e.g., [0.0, 0.0]
+/// float*         upper_levels;  // e.g., [2.0, 10.0]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::batched_histogram_even(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, sizes, histograms, levels, lower_levels, upper_levels, 2
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute the histograms
+/// rocprim::batched_histogram_even(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, sizes, histograms, levels, lower_levels, upper_levels, 2
+/// );
+/// // histograms: [1, 2] and [0, 1, 0, 0, 1]
+/// \endcode
+/// \endparblock
+template<class SamplePointersIterator,
+         class SizesIterator,
+         class HistogramPointersIterator,
+         class LevelsIterator,
+         class LevelIterator>
+inline hipError_t batched_histogram_even(void*                     temporary_storage,
+                                         size_t&                   storage_size,
+                                         SamplePointersIterator    samples,
+                                         SizesIterator             sizes,
+                                         HistogramPointersIterator histograms,
+                                         LevelsIterator            levels,
+                                         LevelIterator             lower_levels,
+                                         LevelIterator             upper_levels,
+                                         const unsigned int        num_problems,
+                                         const hipStream_t         stream            = 0,
+                                         const bool                debug_synchronous = false)
+{
+    return detail::batched_histogram_impl(
+        temporary_storage,
+        storage_size,
+        samples,
+        sizes,
+        histograms,
+        detail::batched_histogram_even_op<LevelsIterator, LevelIterator>{levels,
+                                                                         lower_levels,
+                                                                         upper_levels},
+        num_problems,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Computes histograms with the specified bin boundary levels of many independent arrays
+/// with a single launch.
+///
+/// Computes the histogram of `sizes[i]` samples starting at `samples[i]` into the
+/// `levels[i] - 1` bins starting at `histograms[i]`, for all `i` in [0, \p num_problems). Bin
+/// `j` of problem `i` counts the samples in [`level_values[i][j]`, `level_values[i][j + 1]`).
+/// Each array is processed by one block, which also clears its histogram, so a batch costs a
+/// single launch instead of the two launches of \p histogram_range per array.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * Histograms of up to 2048 bins are counted in shared memory, larger ones with global
+/// atomics.
+/// * The histogram of a problem with fewer than 2 levels is left unchanged.
+/// * This is meant for many small arrays. A single large array is processed faster by
+/// \p histogram_range.
+///
+/// \tparam SamplePointersIterator - random-access iterator type of the sample pointers. The
+/// pointed-to values are read as random-access iterators.
+/// \tparam SizesIterator - random-access iterator type of the array sizes.
+/// \tparam HistogramPointersIterator - random-access iterator type of the histogram pointers.
+/// The pointed-to values are pointers to integer bin counters.
+/// \tparam LevelsIterator - random-access iterator type of the numbers of levels.
+/// \tparam LevelValuesPointersIterator - random-access iterator type of the pointers to the
+/// boundary levels.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without computing the histograms.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the pointers of the arrays of samples.
+/// \param [in] sizes - iterator to the sizes of the arrays.
+/// \param [out] histograms - iterator to the pointers of the histograms.
+/// \param [in] levels - iterator to the numbers of boundaries (levels) of the histograms.
+/// \param [in] level_values - iterator to the pointers to the ascending boundary levels of the
+/// histograms, `levels[i]` values for problem `i`.
+/// \param [in] num_problems - number of arrays.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime
+/// error of type \p hipError_t.
+template<class SamplePointersIterator,
+         class SizesIterator,
+         class HistogramPointersIterator,
+         class LevelsIterator,
+         class LevelValuesPointersIterator>
+inline hipError_t batched_histogram_range(void*                       temporary_storage,
+                                          size_t&                     storage_size,
+                                          SamplePointersIterator      samples,
+                                          SizesIterator               sizes,
+                                          HistogramPointersIterator   histograms,
+                                          LevelsIterator              levels,
+                                          LevelValuesPointersIterator level_values,
+                                          const unsigned int          num_problems,
+                                          const hipStream_t           stream            = 0,
+                                          const bool                  debug_synchronous = false)
+{
+    return detail::batched_histogram_impl(
+        temporary_storage,
+        storage_size,
+        samples,
+        sizes,
+        histograms,
+        detail::batched_histogram_range_op<LevelsIterator, LevelValuesPointersIterator>{
+            levels,
+            level_values},
+        num_problems,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Reduces every row of a pitched 2D array with a single launch.
+///
+/// Computes <tt>output[i]</tt> as the reduction of the \p columns values starting at
+/// <tt>input + i * pitch</tt>, with \p initial_value, for all \p i in <tt>[0, rows)</tt>. This is
+/// \p batched_reduce of the rows, without the arrays of pointers and sizes.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * \p pitch is the distance between the first items of consecutive rows in items, not in
+/// bytes, and must not be smaller than \p columns.
+/// * Every row is reduced by one block. A few very long rows are reduced faster by
+/// \p segmented_reduce_balanced.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `reduce_config`.
+/// \tparam InputIterator - random-access iterator type of the array. It can be a simple pointer
+/// type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be a
+/// simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for reduction.
+/// \tparam InitValueType - type of the initial value.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first item of the array.
+/// \param [out] output - iterator to the first element of the \p rows results.
+/// \param [in] rows - number of rows.
+/// \param [in] columns - number of items of every row.
+/// \param [in] pitch - distance between the rows in items.
+/// \param [in] reduce_op - binary operation function object that will be used for reduction.
+/// The default value is \p BinaryFunction().
+/// \param [in] initial_value - initial value to start each reduction.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+         class InitValueType = typename std::iterator_traits<InputIterator>::value_type>
+inline hipError_t row_reduce(void*              temporary_storage,
+                             size_t&            storage_size,
+                             InputIterator      input,
+                             OutputIterator     output,
+                             const unsigned int rows,
+                             const unsigned int columns,
+                             const size_t       pitch,
+                             BinaryFunction     reduce_op         = BinaryFunction(),
+                             InitValueType      initial_value     = InitValueType(),
+                             const hipStream_t  stream            = 0,
+                             const bool         debug_synchronous = false)
+{
+    return detail::batched_reduce_impl<Config>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(::rocprim::make_counting_iterator(0u),
+                                           detail::pitched_row_op<InputIterator>{input, pitch}),
+        output,
+        ::rocprim::make_constant_iterator(columns),
+        rows,
+        reduce_op,
+        initial_value,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Computes inclusive scans of every row of a pitched 2D array with a single launch.
+///
+/// Scans the \p columns values starting at <tt>input + i * input_pitch</tt> into the range
+/// starting at <tt>output + i * output_pitch</tt>, for all \p i in <tt>[0, rows)</tt>. This is
+/// \p batched_inclusive_scan of the rows, without the arrays of pointers and sizes.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The pitches are the distances between the first items of consecutive rows in items, not
+/// in bytes, and must not be smaller than \p columns. The output may be the input.
+/// * Every row is scanned by one block.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `scan_config`.
+/// \tparam InputIterator - random-access iterator type of the input array.
+/// \tparam OutputIterator - random-access iterator type of the output array.
+/// \tparam BinaryFunction - type of binary function used for scan.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first item of the input array.
+/// \param [out] output - iterator to the first item of the output array.
+/// \param [in] rows - number of rows.
+/// \param [in] columns - number of items of every row.
+/// \param [in] input_pitch - distance between the rows of the input in items.
+/// \param [in] output_pitch - distance between the rows of the output in items.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t row_inclusive_scan(void*              temporary_storage,
+                                     size_t&            storage_size,
+                                     InputIterator      input,
+                                     OutputIterator     output,
+                                     const unsigned int rows,
+                                     const unsigned int columns,
+                                     const size_t       input_pitch,
+                                     const size_t       output_pitch,
+                                     BinaryFunction     scan_op           = BinaryFunction(),
+                                     const hipStream_t  stream            = 0,
+                                     const bool         debug_synchronous = false)
+{
+    using result_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    return detail::batched_scan_impl<false, Config>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(
+            ::rocprim::make_counting_iterator(0u),
+            detail::pitched_row_op<InputIterator>{input, input_pitch}),
+        ::rocprim::make_transform_iterator(
+            ::rocprim::make_counting_iterator(0u),
+            detail::pitched_row_op<OutputIterator>{output, output_pitch}),
+        ::rocprim::make_constant_iterator(columns),
+        rows,
+        result_type(),
+        scan_op,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Computes exclusive scans of every row of a pitched 2D array with a single launch.
+///
+/// The same as \p row_inclusive_scan, except every row is scanned exclusively, starting with
+/// \p initial_value.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t row_exclusive_scan(void*               temporary_storage,
+                                     size_t&             storage_size,
+                                     InputIterator       input,
+                                     OutputIterator      output,
+                                     const unsigned int  rows,
+                                     const unsigned int  columns,
+                                     const size_t        input_pitch,
+                                     const size_t        output_pitch,
+                                     const InitValueType initial_value,
+                                     BinaryFunction      scan_op           = BinaryFunction(),
+                                     const hipStream_t   stream            = 0,
+                                     const bool          debug_synchronous = false)
+{
+    return detail::batched_scan_impl<true, Config>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(
+            ::rocprim::make_counting_iterator(0u),
+            detail::pitched_row_op<InputIterator>{input, input_pitch}),
+        ::rocprim::make_transform_iterator(
+            ::rocprim::make_counting_iterator(0u),
+            detail::pitched_row_op<OutputIterator>{output, output_pitch}),
+        ::rocprim::make_constant_iterator(columns),
+        rows,
+        initial_value,
+        scan_op,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Reduces every column of a pitched 2D array.
+///
+/// Computes <tt>output[j]</tt> as the reduction of the \p rows values
+/// <tt>input[i * pitch + j]</tt>, with \p initial_value, for all \p j in <tt>[0, columns)</tt>.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * \p pitch is the distance between the first items of consecutive rows in items, not in
+/// bytes, and must not be smaller than \p columns.
+/// * Consecutive threads process consecutive columns, so every row is loaded with coalesced
+/// accesses and the array is read once, without a transpose. The rows of a narrow array are
+/// split into chunks, whose results are combined in the order of the rows by a second kernel,
+/// so \p reduce_op only needs to be associative.
+///
+/// \tparam InputIterator - random-access iterator type of the array. It can be a simple pointer
+/// type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be a
+/// simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for reduction.
+/// \tparam InitValueType - type of the initial value.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first item of the array.
+/// \param [out] output - iterator to the first element of the \p columns results.
+/// \param [in] rows - number of rows.
+/// \param [in] columns - number of items of every row.
+/// \param [in] pitch - distance between the rows in items.
+/// \param [in] reduce_op - binary operation function object that will be used for reduction.
+/// The default value is \p BinaryFunction().
+/// \param [in] initial_value - initial value to start each reduction.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int rows;      // e.g., 2
+/// unsigned int columns;   // e.g., 3
+/// size_t pitch;           // e.g., 4
+/// int * input;            // e.g., [1, 2, 3, -, 4, 5, 6, -]
+/// int * output;           // empty array of 3 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::column_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, rows, columns, pitch
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // reduce the columns
+/// rocprim::column_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, rows, columns, pitch
+/// );
+/// // output: [5, 7, 9]
+/// \endcode
+/// \endparblock
+template<class InputIterator,
+         class OutputIterator,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+         class InitValueType = typename std::iterator_traits<InputIterator>::value_type>
+inline hipError_t column_reduce(void*              temporary_storage,
+                                size_t&            storage_size,
+                                InputIterator      input,
+                                OutputIterator     output,
+                                const unsigned int rows,
+                                const unsigned int columns,
+                                const size_t       pitch,
+                                BinaryFunction     reduce_op         = BinaryFunction(),
+                                InitValueType      initial_value     = InitValueType(),
+                                const hipStream_t  stream            = 0,
+                                const bool         debug_synchronous = false)
+{
+    return detail::column_reduce_impl(temporary_storage,
+                                      storage_size,
+                                      input,
+                                      output,
+                                      rows,
+                                      columns,
+                                      pitch,
+                                      reduce_op,
+                                      initial_value,
+                                      stream,
+                                      debug_synchronous);
+}
+
+/// \brief Computes inclusive scans of every column of a pitched 2D array.
+///
+/// Scans the \p rows values <tt>input[i * input_pitch + j]</tt> into
+/// <tt>output[i * output_pitch + j]</tt>, for all \p j in <tt>[0, columns)</tt>. Together with
+/// \p row_inclusive_scan this computes e.g. the integral image of an image.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The pitches are the distances between the first items of consecutive rows in items,
+/// not in bytes, and must not be smaller than \p columns. The output may be the input.
+/// * The columns are processed like in \p column_reduce: the rows of a narrow array are split
+/// into chunks, and every chunk is scanned starting from the reduction of the preceding chunks,
+/// which costs a second read of all rows but the last chunk.
+///
+/// \tparam InputIterator - random-access iterator type of the input array.
+/// \tparam OutputIterator - random-access iterator type of the output array.
+/// \tparam BinaryFunction - type of binary function used for scan.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first item of the input array.
+/// \param [out] output - iterator to the first item of the output array.
+/// \param [in] rows - number of rows.
+/// \param [in] columns - number of items of every row.
+/// \param [in] input_pitch - distance between the rows of the input in items.
+/// \param [in] output_pitch - distance between the rows of the output in items.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class InputIterator,
+         class OutputIterator,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t column_inclusive_scan(void*              temporary_storage,
+                                        size_t&            storage_size,
+                                        InputIterator      input,
+                                        OutputIterator     output,
+                                        const unsigned int rows,
+                                        const unsigned int columns,
+                                        const size_t       input_pitch,
+                                        const size_t       output_pitch,
+                                        BinaryFunction     scan_op           = BinaryFunction(),
+                                        const hipStream_t  stream            = 0,
+                                        const bool         debug_synchronous = false)
+{
+    using result_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    return detail::column_scan_impl<false>(temporary_storage,
+                                           storage_size,
+                                           input,
+                                           output,
+                                           rows,
+                                           columns,
+                                           input_pitch,
+                                           output_pitch,
+                                           result_type(),
+                                           scan_op,
+                                           stream,
+                                           debug_synchronous);
+}
+
+/// \brief Computes exclusive scans of every column of a pitched 2D array.
+///
+/// The same as \p column_inclusive_scan, except every column is scanned exclusively, starting
+/// with \p initial_value.
+template<class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t column_exclusive_scan(void*               temporary_storage,
+                                        size_t&             storage_size,
+                                        InputIterator       input,
+                                        OutputIterator      output,
+                                        const unsigned int  rows,
+                                        const unsigned int  columns,
+                                        const size_t        input_pitch,
+                                        const size_t        output_pitch,
+                                        const InitValueType initial_value,
+                                        BinaryFunction      scan_op           = BinaryFunction(),
+                                        const hipStream_t   stream            = 0,
+                                        const bool          debug_synchronous = false)
+{
+    return detail::column_scan_impl<true>(temporary_storage,
+                                          storage_size,
+                                          input,
+                                          output,
+                                          rows,
+                                          columns,
+                                          input_pitch,
+                                          output_pitch,
+                                          initial_value,
+                                          scan_op,
+                                          stream,
+                                          debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_BATCHED_HPP_
@@ -21,15 +21,23 @@
 #ifndef ROCPRIM_DEVICE_DEVICE_BINARY_SEARCH_HPP_
 #define ROCPRIM_DEVICE_DEVICE_BINARY_SEARCH_HPP_
 
-#include <type_traits>
+#include <chrono>
+#include <iostream>
 #include <iterator>
+#include <type_traits>
 
 #include "../config.hpp"
+#include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
 
 #include "detail/device_binary_search.hpp"
+#include "detail/device_sorted_search.hpp"
 #include "device_binary_search_config.hpp"
+#include "device_merge_config.hpp"
 #include "device_transform.hpp"
+#include "execution_budget.hpp"
 
 /// \addtogroup devicemodule
 /// @{
@@ -70,17 +78,158 @@ hipError_t binary_search(void * temporary_storage,
         return hipSuccess;
     }
 
-    return transform<Config>(
-        needles, output,
-        needles_size,
-        [haystack, haystack_size, search_op, compare_op]
-        ROCPRIM_DEVICE
-        (const value_type& value)
+    return with_streaming_input(
+        stream,
+        needles,
+        [&](auto streamed_needles)
         {
-            return search_op(haystack, haystack_size, value, compare_op);
-        },
-        stream, debug_synchronous
-    );
+            return transform<Config>(
+                streamed_needles,
+                output,
+                needles_size,
+                [haystack, haystack_size, search_op, compare_op] ROCPRIM_DEVICE(
+                    const value_type& value)
+                { return search_op(haystack, haystack_size, value, compare_op); },
+                stream,
+                debug_synchronous);
+        });
+}
+
+// The nodes of a search index are kept in storage that the user owns between the build and the
+// searches. Its layout only depends on the size of the haystack.
+template<class T>
+inline hipError_t search_index_partition(void*                     index_storage,
+                                         size_t&                   index_storage_size,
+                                         const search_index_layout layout,
+                                         T**                       nodes)
+{
+    return temp_storage::partition(
+        index_storage,
+        index_storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::ptr_aligned_array(nodes, (size_t(1) << layout.levels) - 1)));
+}
+
+template<class Config,
+         template<class> class SearchFunction,
+         class HaystackIterator,
+         class NeedlesIterator,
+         class OutputIterator,
+         class CompareFunction>
+inline hipError_t search_index_search(void*            index_storage,
+                                      size_t           index_storage_size,
+                                      HaystackIterator haystack,
+                                      NeedlesIterator  needles,
+                                      OutputIterator   output,
+                                      const size_t     haystack_size,
+                                      const size_t     needles_size,
+                                      CompareFunction  compare_op,
+                                      hipStream_t      stream,
+                                      bool             debug_synchronous)
+{
+    using haystack_type = typename std::iterator_traits<HaystackIterator>::value_type;
+    using value_type    = typename std::iterator_traits<NeedlesIterator>::value_type;
+
+    if(index_storage == nullptr)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    const search_index_layout layout = get_search_index_layout<haystack_type>(haystack_size);
+
+    haystack_type* nodes = nullptr;
+    // Fails if the index was built for a larger haystack or a different value type.
+    ROCPRIM_RETURN_ON_ERROR(
+        search_index_partition(index_storage, index_storage_size, layout, &nodes));
+
+    const SearchFunction<haystack_type> search_op{nodes, layout};
+
+    return with_streaming_input(
+        stream,
+        needles,
+        [&](auto streamed_needles)
+        {
+            return transform<Config>(
+                streamed_needles,
+                output,
+                needles_size,
+                [haystack, haystack_size, search_op, compare_op] ROCPRIM_DEVICE(
+                    const value_type& value)
+                { return search_op(haystack, haystack_size, value, compare_op); },
+                stream,
+                debug_synchronous);
+        });
+}
+
+template<class Config,
+         class HaystackIterator,
+         class NeedlesIterator,
+         class OutputIterator,
+         class SearchOp,
+         class CompareFunction>
+inline hipError_t sorted_search(void*            temporary_storage,
+                                size_t&          storage_size,
+                                HaystackIterator haystack,
+                                NeedlesIterator  needles,
+                                OutputIterator   output,
+                                const size_t     haystack_size,
+                                const size_t     needles_size,
+                                SearchOp         search_op,
+                                CompareFunction  compare_op,
+                                hipStream_t      stream,
+                                bool             debug_synchronous)
+{
+    using haystack_type = typename std::iterator_traits<HaystackIterator>::value_type;
+    using needle_type   = typename std::iterator_traits<NeedlesIterator>::value_type;
+
+    using config = wrapped_merge_config<Config, haystack_type, needle_type>;
+
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, otherwise
+        // user may again pass nullptr as temporary_storage
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, target_arch));
+    const merge_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+    const size_t       path_size       = haystack_size + needles_size;
+
+    if(needles_size == 0)
+    {
+        return hipSuccess;
+    }
+
+    const size_t number_of_blocks = ceiling_div(path_size, items_per_block);
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    sorted_search_kernel<config>
+        <<<dim3(number_of_blocks), dim3(block_size), 0, stream>>>(haystack,
+                                                                  needles,
+                                                                  output,
+                                                                  haystack_size,
+                                                                  needles_size,
+                                                                  search_op,
+                                                                  compare_op);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sorted_search_kernel", path_size, start);
+
+    return hipSuccess;
 }
 
 template<class Config, class Tag>
@@ -502,6 +651,564 @@ hipError_t binary_search(void * temporary_storage,
                                          debug_synchronous);
 }
 
+/// \brief Computes a lower bound in a sorted range for each element of a sorted input.
+///
+/// The results are the same as of \p lower_bound, but instead of a binary search for every
+/// needle, the needles are merged with the haystack. The merge path of both ranges is split into
+/// tiles of equal size, whose needles and haystack items are loaded with coalesced loads and
+/// merged in shared memory. The total work is linear in the sizes of the haystack and the
+/// needles, so it is faster than \p lower_bound when there are many needles, e.g. for the
+/// probe side of a sort-merge join.
+///
+/// \par Overview
+/// * When a null pointer is passed as \p temporary_storage, the required allocation size (in
+///   bytes) is written to \p storage_size and the function returns without performing the
+///   search.
+/// * The needles must be sorted with \p compare_op, the results are unspecified otherwise.
+///
+/// \tparam Config [optional] configuration of the primitive, must be \p default_config or
+///   \p merge_config.
+/// \tparam HaystackIterator [inferred] random-access iterator type of the search range. It can
+///   be a simple pointer type.
+/// \tparam NeedlesIterator [inferred] random-access iterator type of the input range. It can be
+///   a simple pointer type.
+/// \tparam OutputIterator [inferred] random-access iterator type of the output range. It can be
+///   a simple pointer type.
+/// \tparam CompareFunction [inferred] type of binary function that accepts two arguments of the
+///   types pointed by \p HaystackIterator and \p NeedlesIterator, and returns a value
+///   convertible to bool. Default type is \p ::rocprim::less<>.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When a null
+///   pointer is passed, the required allocation size (in bytes) is written to \p storage_size
+///   and function returns without performing the search.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] haystack iterator to the first element in the search range. Elements of this
+///   range must be sorted.
+/// \param [in] needles iterator to the first element in the range of values to search for.
+///   Elements of this range must be sorted with the same order as \p haystack.
+/// \param [out] output iterator to the first element in the output range.
+/// \param [in] haystack_size number of elements in the search range \p haystack.
+/// \param [in] needles_size number of elements in the input range \p needles.
+/// \param [in] compare_op binary operation function object that is used to compare values, the
+///   same as the order of \p haystack and \p needles.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+///   type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t   haystack_size;  // e.g. 6
+/// int *    haystack;       // e.g. {1, 2, 2, 4, 7, 9}
+/// size_t   needles_size;   // e.g. 5
+/// int *    needles;        // e.g. {0, 2, 3, 7, 10}
+/// size_t * output;         // empty array of 5 elements
+///
+/// void * temporary_storage = nullptr;
+/// size_t temporary_storage_bytes;
+/// // Get required size of the temporary storage
+/// rocprim::lower_bound_sorted_needles(temporary_storage,
+///                                     temporary_storage_bytes,
+///                                     haystack,
+///                                     needles,
+///                                     output,
+///                                     haystack_size,
+///                                     needles_size);
+///
+/// // Allocate temporary storage
+/// hipMalloc(&temporary_storage, temporary_storage_bytes);
+///
+/// // Perform the search
+/// rocprim::lower_bound_sorted_needles(temporary_storage,
+///                                     temporary_storage_bytes,
+///                                     haystack,
+///                                     needles,
+///                                     output,
+///                                     haystack_size,
+///                                     needles_size);
+/// // output = {0, 1, 3, 4, 6}
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class HaystackIterator,
+         class NeedlesIterator,
+         class OutputIterator,
+         class CompareFunction = ::rocprim::less<>>
+inline hipError_t lower_bound_sorted_needles(void*            temporary_storage,
+                                             size_t&          storage_size,
+                                             HaystackIterator haystack,
+                                             NeedlesIterator  needles,
+                                             OutputIterator   output,
+                                             const size_t     haystack_size,
+                                             const size_t     needles_size,
+                                             CompareFunction  compare_op = CompareFunction(),
+                                             hipStream_t      stream     = 0,
+                                             bool             debug_synchronous = false)
+{
+    return detail::sorted_search<Config>(temporary_storage,
+                                         storage_size,
+                                         haystack,
+                                         needles,
+                                         output,
+                                         haystack_size,
+                                         needles_size,
+                                         detail::lower_bound_sorted_search_op(),
+                                         compare_op,
+                                         stream,
+                                         debug_synchronous);
+}
+
+/// \brief Computes an upper bound in a sorted range for each element of a sorted input.
+///
+/// The results are the same as of \p upper_bound. See \p lower_bound_sorted_needles for the
+/// algorithm and the requirements on the inputs.
+///
+/// \tparam Config [optional] configuration of the primitive, must be \p default_config or
+///   \p merge_config.
+/// \tparam HaystackIterator [inferred] random-access iterator type of the search range. It can
+///   be a simple pointer type.
+/// \tparam NeedlesIterator [inferred] random-access iterator type of the input range. It can be
+///   a simple pointer type.
+/// \tparam OutputIterator [inferred] random-access iterator type of the output range. It can be
+///   a simple pointer type.
+/// \tparam CompareFunction [inferred] type of binary function that accepts two arguments of the
+///   types pointed by \p HaystackIterator and \p NeedlesIterator, and returns a value
+///   convertible to bool. Default type is \p ::rocprim::less<>.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When a null
+///   pointer is passed, the required allocation size (in bytes) is written to \p storage_size
+///   and function returns without performing the search.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] haystack iterator to the first element in the search range. Elements of this
+///   range must be sorted.
+/// \param [in] needles iterator to the first element in the range of values to search for.
+///   Elements of this range must be sorted with the same order as \p haystack.
+/// \param [out] output iterator to the first element in the output range.
+/// \param [in] haystack_size number of elements in the search range \p haystack.
+/// \param [in] needles_size number of elements in the input range \p needles.
+/// \param [in] compare_op binary operation function object that is used to compare values, the
+///   same as the order of \p haystack and \p needles.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class HaystackIterator,
+         class NeedlesIterator,
+         class OutputIterator,
+         class CompareFunction = ::rocprim::less<>>
+inline hipError_t upper_bound_sorted_needles(void*            temporary_storage,
+                                             size_t&          storage_size,
+                                             HaystackIterator haystack,
+                                             NeedlesIterator  needles,
+                                             OutputIterator   output,
+                                             const size_t     haystack_size,
+                                             const size_t     needles_size,
+                                             CompareFunction  compare_op = CompareFunction(),
+                                             hipStream_t      stream     = 0,
+                                             bool             debug_synchronous = false)
+{
+    return detail::sorted_search<Config>(temporary_storage,
+                                         storage_size,
+                                         haystack,
+                                         needles,
+                                         output,
+                                         haystack_size,
+                                         needles_size,
+                                         detail::upper_bound_sorted_search_op(),
+                                         compare_op,
+                                         stream,
+                                         debug_synchronous);
+}
+
+/// \brief Checks for each element of a sorted input whether it is in a sorted range.
+///
+/// The results are the same as of \p binary_search. See \p lower_bound_sorted_needles for the
+/// algorithm and the requirements on the inputs.
+///
+/// \tparam Config [optional] configuration of the primitive, must be \p default_config or
+///   \p merge_config.
+/// \tparam HaystackIterator [inferred] random-access iterator type of the search range. It can
+///   be a simple pointer type.
+/// \tparam NeedlesIterator [inferred] random-access iterator type of the input range. It can be
+///   a simple pointer type.
+/// \tparam OutputIterator [inferred] random-access iterator type of the output range. It can be
+///   a simple pointer type.
+/// \tparam CompareFunction [inferred] type of binary function that accepts two arguments of the
+///   types pointed by \p HaystackIterator and \p NeedlesIterator, and returns a value
+///   convertible to bool. Default type is \p ::rocprim::less<>.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When a null
+///   pointer is passed, the required allocation size (in bytes) is written to \p storage_size
+///   and function returns without performing the search.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] haystack iterator to the first element in the search range. Elements of this
+///   range must be sorted.
+/// \param [in] needles iterator to the first element in the range of values to search for.
+///   Elements of this range must be sorted with the same order as \p haystack.
+/// \param [out] output iterator to the first element in the output range.
+/// \param [in] haystack_size number of elements in the search range \p haystack.
+/// \param [in] needles_size number of elements in the input range \p needles.
+/// \param [in] compare_op binary operation function object that is used to compare values, the
+///   same as the order of \p haystack and \p needles.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class HaystackIterator,
+         class NeedlesIterator,
+         class OutputIterator,
+         class CompareFunction = ::rocprim::less<>>
+inline hipError_t binary_search_sorted_needles(void*            temporary_storage,
+                                               size_t&          storage_size,
+                                               HaystackIterator haystack,
+                                               NeedlesIterator  needles,
+                                               OutputIterator   output,
+                                               const size_t     haystack_size,
+                                               const size_t     needles_size,
+                                               CompareFunction  compare_op = CompareFunction(),
+                                               hipStream_t      stream     = 0,
+                                               bool             debug_synchronous = false)
+{
+    return detail::sorted_search<Config>(temporary_storage,
+                                         storage_size,
+                                         haystack,
+                                         needles,
+                                         output,
+                                         haystack_size,
+                                         needles_size,
+                                         detail::binary_search_sorted_search_op(),
+                                         compare_op,
+                                         stream,
+                                         debug_synchronous);
+}
+
+/// \brief Builds a search index of a sorted range, which speeds up repeated searches in the range.
+///
+/// The index stores the first items of the groups of 128 bytes of \p haystack in the order of
+/// a breadth-first traversal of a binary search tree (Eytzinger layout). A search walks the
+/// tree, whose first levels are shared by all searches and stay in the caches, and finishes
+/// with a binary search within a single group of \p haystack. This touches far fewer cache
+/// lines than a binary search over the entire range, when the range does not fit in the caches.
+///
+/// The index is stored in \p index_storage, which is owned by the caller and follows the
+/// protocol of temporary storage: when a null pointer is passed, the required size is written to
+/// \p index_storage_size. The index can then be used by any number of
+/// \p search_index_lower_bound, \p search_index_upper_bound and \p search_index_binary_search
+/// calls, until \p haystack is modified or the storage is freed or reused.
+///
+/// \par Overview
+/// * The index stores at most two values per 128 bytes of \p haystack, so its size is at most
+///   about 1/64th of the size of the range.
+/// * Building the index does not compare values, so any order of \p haystack can be searched
+///   with its \p compare_op.
+///
+/// \tparam HaystackIterator [inferred] random-access iterator type of the search range. It can
+///   be a simple pointer type.
+///
+/// \param [in] index_storage pointer to device-accessible storage of the index. When a null
+///   pointer is passed, the required allocation size (in bytes) is written to
+///   \p index_storage_size and function returns without building the index.
+/// \param [in,out] index_storage_size reference to a size (in bytes) of \p index_storage.
+/// \param [in] haystack iterator to the first element in the search range. Elements of this
+///   range must be sorted.
+/// \param [in] haystack_size number of elements in the search range \p haystack.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful build; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class HaystackIterator>
+inline hipError_t search_index_build(void*            index_storage,
+                                     size_t&          index_storage_size,
+                                     HaystackIterator haystack,
+                                     const size_t     haystack_size,
+                                     hipStream_t      stream            = 0,
+                                     bool             debug_synchronous = false)
+{
+    using haystack_type = typename std::iterator_traits<HaystackIterator>::value_type;
+
+    const detail::search_index_layout layout
+        = detail::get_search_index_layout<haystack_type>(haystack_size);
+
+    haystack_type* nodes = nullptr;
+
+    const hipError_t result
+        = detail::search_index_partition(index_storage, index_storage_size, layout, &nodes);
+    if(result != hipSuccess || index_storage == nullptr)
+    {
+        return result;
+    }
+
+    const size_t node_count = (size_t(1) << layout.levels) - 1;
+    if(node_count == 0)
+    {
+        return hipSuccess;
+    }
+
+    // Gathers the first item of the group of every node
+    constexpr size_t group_size = detail::search_index_group_size<haystack_type>();
+    return transform(make_transform_iterator(make_counting_iterator(size_t(0)),
+                                             detail::search_index_node_op{layout}),
+                     nodes,
+                     node_count,
+                     [haystack] ROCPRIM_DEVICE(const size_t group)
+                     { return haystack_type(haystack[group * group_size]); },
+                     stream,
+                     debug_synchronous);
+}
+
+/// \brief Computes a lower bound in a sorted range for each element of a given input, using a
+/// search index of the range built by \p search_index_build.
+///
+/// The results are the same as of \p lower_bound.
+///
+/// \par Overview
+/// * \p haystack and \p haystack_size must be the same as when the index was built.
+///   \p hipErrorInvalidValue is returned if \p index_storage is too small for \p haystack_size.
+/// * The searches do not modify the index, so several searches can run concurrently.
+///
+/// \tparam Config [optional] configuration of the primitive, must be \p default_config or
+///   \p lower_bound_config.
+/// \tparam HaystackIterator [inferred] random-access iterator type of the search range. It can
+///   be a simple pointer type.
+/// \tparam NeedlesIterator [inferred] random-access iterator type of the input range. It can be
+///   a simple pointer type.
+/// \tparam OutputIterator [inferred] random-access iterator type of the output range. It can be
+///   a simple pointer type.
+/// \tparam CompareFunction [inferred] type of binary function that accepts two arguments of the
+///   types pointed by \p HaystackIterator and \p NeedlesIterator, and returns a value
+///   convertible to bool. Default type is \p ::rocprim::less<>.
+///
+/// \param [in] index_storage pointer to the storage of an index built by \p search_index_build.
+/// \param [in] index_storage_size size (in bytes) of \p index_storage.
+/// \param [in] haystack iterator to the first element in the search range.
+/// \param [in] needles iterator to the first element in the range of values to search for.
+/// \param [out] output iterator to the first element in the output range.
+/// \param [in] haystack_size number of elements in the search range \p haystack.
+/// \param [in] needles_size number of elements in the input range \p needles.
+/// \param [in] compare_op binary operation function object that is used to compare values, the
+///   same as the order of \p haystack.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+///   type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the same index is used for two searches.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t   haystack_size;  // e.g. 10
+/// int *    haystack;       // e.g. {0, 1, 2, 3, 4, 5, 6, 7, 8, 9}
+/// size_t   needles_size;   // e.g. 4
+/// int *    needles1;       // e.g. {0, 12, 4, 7}
+/// int *    needles2;       // e.g. {8, 3}
+/// size_t * output1;        // empty array of 4 elements
+/// size_t * output2;        // empty array of 2 elements
+///
+/// size_t index_storage_size;
+/// void * index_storage = nullptr;
+/// // Get required size of the index storage
+/// rocprim::search_index_build(index_storage, index_storage_size, haystack, haystack_size);
+///
+/// // Allocate index storage
+/// hipMalloc(&index_storage, index_storage_size);
+///
+/// // Build the index and search it twice
+/// rocprim::search_index_build(index_storage, index_storage_size, haystack, haystack_size);
+/// rocprim::search_index_lower_bound(
+///     index_storage, index_storage_size, haystack, needles1, output1, haystack_size, 4
+/// );
+/// rocprim::search_index_lower_bound(
+///     index_storage, index_storage_size, haystack, needles2, output2, haystack_size, 2
+/// );
+/// // output1 = {0, 10, 4, 7}
+/// // output2 = {8, 3}
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class HaystackIterator,
+         class NeedlesIterator,
+         class OutputIterator,
+         class CompareFunction = ::rocprim::less<>>
+inline hipError_t search_index_lower_bound(void*            index_storage,
+                                           const size_t     index_storage_size,
+                                           HaystackIterator haystack,
+                                           NeedlesIterator  needles,
+                                           OutputIterator   output,
+                                           const size_t     haystack_size,
+                                           const size_t     needles_size,
+                                           CompareFunction  compare_op = CompareFunction(),
+                                           hipStream_t      stream     = 0,
+                                           bool             debug_synchronous = false)
+{
+    static_assert(detail::is_default_or_has_tag<Config, detail::lower_bound_config_tag>::value,
+                  "Config must be a specialization of struct template lower_bound_config");
+
+    using value_type  = typename std::iterator_traits<NeedlesIterator>::value_type;
+    using output_type = typename std::iterator_traits<OutputIterator>::value_type;
+    using config
+        = std::conditional_t<std::is_same<default_config, Config>::value,
+                             detail::default_config_for_lower_bound<value_type, output_type>,
+                             Config>;
+
+    return detail::search_index_search<config, detail::search_index_lower_bound_op>(
+        index_storage,
+        index_storage_size,
+        haystack,
+        needles,
+        output,
+        haystack_size,
+        needles_size,
+        compare_op,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Computes an upper bound in a sorted range for each element of a given input, using a
+/// search index of the range built by \p search_index_build.
+///
+/// The results are the same as of \p upper_bound. See \p search_index_lower_bound for the
+/// requirements on the index and the arguments.
+///
+/// \tparam Config [optional] configuration of the primitive, must be \p default_config or
+///   \p upper_bound_config.
+///
+/// \param [in] index_storage pointer to the storage of an index built by \p search_index_build.
+/// \param [in] index_storage_size size (in bytes) of \p index_storage.
+/// \param [in] haystack iterator to the first element in the search range.
+/// \param [in] needles iterator to the first element in the range of values to search for.
+/// \param [out] output iterator to the first element in the output range.
+/// \param [in] haystack_size number of elements in the search range \p haystack.
+/// \param [in] needles_size number of elements in the input range \p needles.
+/// \param [in] compare_op binary operation function object that is used to compare values, the
+///   same as the order of \p haystack.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class HaystackIterator,
+         class NeedlesIterator,
+         class OutputIterator,
+         class CompareFunction = ::rocprim::less<>>
+inline hipError_t search_index_upper_bound(void*            index_storage,
+                                           const size_t     index_storage_size,
+                                           HaystackIterator haystack,
+                                           NeedlesIterator  needles,
+                                           OutputIterator   output,
+                                           const size_t     haystack_size,
+                                           const size_t     needles_size,
+                                           CompareFunction  compare_op = CompareFunction(),
+                                           hipStream_t      stream     = 0,
+                                           bool             debug_synchronous = false)
+{
+    static_assert(detail::is_default_or_has_tag<Config, detail::upper_bound_config_tag>::value,
+                  "Config must be a specialization of struct template upper_bound_config");
+
+    using value_type  = typename std::iterator_traits<NeedlesIterator>::value_type;
+    using output_type = typename std::iterator_traits<OutputIterator>::value_type;
+    using config
+        = std::conditional_t<std::is_same<default_config, Config>::value,
+                             detail::default_config_for_upper_bound<value_type, output_type>,
+                             Config>;
+
+    return detail::search_index_search<config, detail::search_index_upper_bound_op>(
+        index_storage,
+        index_storage_size,
+        haystack,
+        needles,
+        output,
+        haystack_size,
+        needles_size,
+        compare_op,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Checks for each element of a given input whether it is in a sorted range, using a
+/// search index of the range built by \p search_index_build.
+///
+/// The results are the same as of \p binary_search. See \p search_index_lower_bound for the
+/// requirements on the index and the arguments.
+///
+/// \tparam Config [optional] configuration of the primitive, must be \p default_config or
+///   \p binary_search_config.
+///
+/// \param [in] index_storage pointer to the storage of an index built by \p search_index_build.
+/// \param [in] index_storage_size size (in bytes) of \p index_storage.
+/// \param [in] haystack iterator to the first element in the search range.
+/// \param [in] needles iterator to the first element in the range of values to search for.
+/// \param [out] output iterator to the first element in the output range.
+/// \param [in] haystack_size number of elements in the search range \p haystack.
+/// \param [in] needles_size number of elements in the input range \p needles.
+/// \param [in] compare_op binary operation function object that is used to compare values, the
+///   same as the order of \p haystack.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class HaystackIterator,
+         class NeedlesIterator,
+         class OutputIterator,
+         class CompareFunction = ::rocprim::less<>>
+inline hipError_t search_index_binary_search(void*            index_storage,
+                                             const size_t     index_storage_size,
+                                             HaystackIterator haystack,
+                                             NeedlesIterator  needles,
+                                             OutputIterator   output,
+                                             const size_t     haystack_size,
+                                             const size_t     needles_size,
+                                             CompareFunction  compare_op = CompareFunction(),
+                                             hipStream_t      stream     = 0,
+                                             bool             debug_synchronous = false)
+{
+    static_assert(detail::is_default_or_has_tag<Config, detail::binary_search_config_tag>::value,
+                  "Config must be a specialization of struct template binary_search_config");
+
+    using value_type  = typename std::iterator_traits<NeedlesIterator>::value_type;
+    using output_type = typename std::iterator_traits<OutputIterator>::value_type;
+    using config
+        = std::conditional_t<std::is_same<default_config, Config>::value,
+                             detail::default_config_for_binary_search<value_type, output_type>,
+                             Config>;
+
+    return detail::search_index_search<config, detail::search_index_binary_search_op>(
+        index_storage,
+        index_storage_size,
+        haystack,
+        needles,
+        output,
+        haystack_size,
+        needles_size,
+        compare_op,
+        stream,
+        debug_synchronous);
+}
+
 END_ROCPRIM_NAMESPACE
 
 /// @}
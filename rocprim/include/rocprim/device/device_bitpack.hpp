@@ -0,0 +1,327 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_BITPACK_HPP_
+#define ROCPRIM_DEVICE_DEVICE_BITPACK_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+
+#include "detail/device_bitpack.hpp"
+#include "device_scan.hpp"
+#include "device_transform.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Number of items of the tiles of \p bitpack_encode. Every tile has its own minimum and
+/// bit width, a range of \p size items has <tt>ceiling_div(size, bitpack_tile_size)</tt> tiles.
+constexpr unsigned int bitpack_tile_size
+    = detail::bitpack_block_size * detail::bitpack_items_per_thread;
+
+namespace detail
+{
+
+template<class InputIterator, class T>
+ROCPRIM_KERNEL __launch_bounds__(bitpack_block_size)
+void bitpack_tile_stats_kernel(InputIterator input,
+                               const size_t  size,
+                               T*            tile_minimums,
+                               unsigned int* tile_bit_widths,
+                               size_t*       tile_words)
+{
+    bitpack_tile_stats_kernel_impl(input, size, tile_minimums, tile_bit_widths, tile_words);
+}
+
+template<class InputIterator, class T>
+ROCPRIM_KERNEL __launch_bounds__(bitpack_block_size)
+void bitpack_pack_kernel(InputIterator       input,
+                         const size_t        size,
+                         const T*            tile_minimums,
+                         const unsigned int* tile_bit_widths,
+                         const size_t*       tile_offsets,
+                         unsigned int*       packed_output)
+{
+    bitpack_pack_kernel_impl(input,
+                             size,
+                             tile_minimums,
+                             tile_bit_widths,
+                             tile_offsets,
+                             packed_output);
+}
+
+} // end of detail namespace
+
+/// \brief Parallel frame-of-reference bit-packing primitive for device level.
+///
+/// bitpack_encode splits the integers of \p input into tiles of \p bitpack_tile_size items.
+/// Every tile stores its minimum, and its items as their offsets from the minimum with the
+/// fewest bits that fit the largest offset of the tile. The offsets are packed into 32-bit
+/// words, the items of a tile in order from the least significant bit of its first word.
+///
+/// \par Overview
+/// * \p tile_offsets_output gets the offsets of the words of the tiles in \p packed_output,
+/// with one more entry for the total number of packed words.
+/// * \p packed_output must have room for <tt>ceiling_div(size * bits, 32)</tt> words, where
+/// \p bits is the number of bits of the input type, in case no tile can be compressed.
+/// * Tiles with equal items have a bit width of 0 and no packed words.
+/// * The packed tiles are decoded by \p bitpack_decode, or lazily by the iterator of
+/// \p make_bitpack_decode_iterator.
+///
+/// \tparam InputIterator - random-access iterator type of the input range, its value type
+/// must be an integral type of at most 8 bytes. It can be a simple pointer type.
+/// \tparam T - type of the minimums of the tiles, the value type of the input.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the encoding.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to encode.
+/// \param [in] size - number of element in the input range.
+/// \param [out] packed_output - pointer to the packed words.
+/// \param [out] tile_offsets_output - pointer to the offsets of the tiles in the packed words,
+/// <tt>ceiling_div(size, bitpack_tile_size) + 1</tt> entries.
+/// \param [out] tile_minimums_output - pointer to the minimums of the tiles.
+/// \param [out] tile_bit_widths_output - pointer to the bit widths of the tiles.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful encoding; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;                  // e.g., 100000
+/// int* input;                   // e.g., [1000, 1003, 1001, ...]
+/// size_t tiles = rocprim::detail::ceiling_div(size, size_t(rocprim::bitpack_tile_size));
+/// unsigned int* packed;          // size words, the worst case for 32-bit items
+/// size_t* tile_offsets;          // tiles + 1 entries
+/// int* tile_minimums;            // tiles entries
+/// unsigned int* tile_bit_widths; // tiles entries
+///
+/// size_t temporary_storage_size_bytes;
+/// void* temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::bitpack_encode(temporary_storage_ptr, temporary_storage_size_bytes,
+///                         input, size, packed, tile_offsets, tile_minimums, tile_bit_widths);
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the encoding
+/// rocprim::bitpack_encode(temporary_storage_ptr, temporary_storage_size_bytes,
+///                         input, size, packed, tile_offsets, tile_minimums, tile_bit_widths);
+/// // tile_offsets[tiles] is the number of packed words
+/// \endcode
+/// \endparblock
+template<class InputIterator, class T>
+inline hipError_t bitpack_encode(void*             temporary_storage,
+                                 size_t&           storage_size,
+                                 InputIterator     input,
+                                 const size_t      size,
+                                 unsigned int*     packed_output,
+                                 size_t*           tile_offsets_output,
+                                 T*                tile_minimums_output,
+                                 unsigned int*     tile_bit_widths_output,
+                                 const hipStream_t stream            = 0,
+                                 bool              debug_synchronous = false)
+{
+    static_assert(std::is_integral<T>::value && sizeof(T) <= sizeof(unsigned long long),
+                  "bitpack_encode supports only integral types of at most 8 bytes");
+
+    const size_t tiles = ::rocprim::detail::ceiling_div(size, size_t(bitpack_tile_size));
+
+    size_t scan_storage_size;
+    ROCPRIM_RETURN_ON_ERROR(::rocprim::exclusive_scan(nullptr,
+                                                      scan_storage_size,
+                                                      static_cast<size_t*>(nullptr),
+                                                      tile_offsets_output,
+                                                      size_t(0),
+                                                      tiles + 1,
+                                                      ::rocprim::plus<size_t>(),
+                                                      stream,
+                                                      debug_synchronous));
+
+    size_t* tile_words;
+    void*   scan_storage;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&tile_words, tiles + 1),
+            detail::temp_storage::make_partition(&scan_storage, scan_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        return hipMemsetAsync(tile_offsets_output, 0, sizeof(size_t), stream);
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "tiles " << tiles << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    detail::bitpack_tile_stats_kernel<<<dim3(static_cast<unsigned int>(tiles)),
+                                        dim3(detail::bitpack_block_size),
+                                        0,
+                                        stream>>>(input,
+                                                  size,
+                                                  tile_minimums_output,
+                                                  tile_bit_widths_output,
+                                                  tile_words);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("bitpack_tile_stats_kernel", size, start);
+
+    ROCPRIM_RETURN_ON_ERROR(::rocprim::exclusive_scan(scan_storage,
+                                                      scan_storage_size,
+                                                      tile_words,
+                                                      tile_offsets_output,
+                                                      size_t(0),
+                                                      tiles + 1,
+                                                      ::rocprim::plus<size_t>(),
+                                                      stream,
+                                                      debug_synchronous));
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    const T*            tile_minimums   = tile_minimums_output;
+    const unsigned int* tile_bit_widths = tile_bit_widths_output;
+    const size_t*       tile_offsets    = tile_offsets_output;
+    detail::bitpack_pack_kernel<<<dim3(static_cast<unsigned int>(tiles)),
+                                  dim3(detail::bitpack_block_size),
+                                  0,
+                                  stream>>>(input,
+                                            size,
+                                            tile_minimums,
+                                            tile_bit_widths,
+                                            tile_offsets,
+                                            packed_output);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("bitpack_pack_kernel", size, start);
+
+    return hipSuccess;
+}
+
+/// \brief Creates an iterator that decodes the tiles of \p bitpack_encode on dereference.
+///
+/// The item \p i of the iterator is the item \p i of the encoded range. Every dereference reads
+/// the header of the tile of the item and at most three packed words, so the iterator can be
+/// the input of other primitives without decoding the range into memory first.
+///
+/// \tparam T - type of the encoded items.
+///
+/// \param [in] packed - pointer to the packed words.
+/// \param [in] tile_offsets - pointer to the offsets of the tiles in the packed words.
+/// \param [in] tile_minimums - pointer to the minimums of the tiles.
+/// \param [in] tile_bit_widths - pointer to the bit widths of the tiles.
+///
+/// \returns A random-access iterator to the first decoded item.
+template<class T>
+ROCPRIM_HOST_DEVICE inline auto make_bitpack_decode_iterator(const unsigned int* packed,
+                                                             const size_t*       tile_offsets,
+                                                             const T*            tile_minimums,
+                                                             const unsigned int* tile_bit_widths)
+    -> ::rocprim::transform_iterator<::rocprim::counting_iterator<size_t>,
+                                     detail::bitpack_unpack_op<T>,
+                                     T>
+{
+    return ::rocprim::transform_iterator<::rocprim::counting_iterator<size_t>,
+                                         detail::bitpack_unpack_op<T>,
+                                         T>(
+        ::rocprim::counting_iterator<size_t>(0),
+        detail::bitpack_unpack_op<T>{packed, tile_offsets, tile_minimums, tile_bit_widths});
+}
+
+/// \brief Parallel frame-of-reference bit-unpacking primitive for device level.
+///
+/// bitpack_decode stores the \p size items of the tiles of \p bitpack_encode in \p output. It is
+/// a \p transform of the iterator of \p make_bitpack_decode_iterator.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config or a class derived from it.
+/// \tparam T - type of the encoded items.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+///
+/// \param [in] packed - pointer to the packed words.
+/// \param [in] tile_offsets - pointer to the offsets of the tiles in the packed words.
+/// \param [in] tile_minimums - pointer to the minimums of the tiles.
+/// \param [in] tile_bit_widths - pointer to the bit widths of the tiles.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] size - number of encoded items.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful decoding; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config, class T, class OutputIterator>
+inline hipError_t bitpack_decode(const unsigned int* packed,
+                                 const size_t*       tile_offsets,
+                                 const T*            tile_minimums,
+                                 const unsigned int* tile_bit_widths,
+                                 OutputIterator      output,
+                                 const size_t        size,
+                                 const hipStream_t   stream            = 0,
+                                 bool                debug_synchronous = false)
+{
+    return ::rocprim::transform<Config>(
+        make_bitpack_decode_iterator(packed, tile_offsets, tile_minimums, tile_bit_widths),
+        output,
+        size,
+        ::rocprim::identity<T>(),
+        stream,
+        debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_BITPACK_HPP_
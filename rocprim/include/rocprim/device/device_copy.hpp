@@ -145,6 +145,63 @@ ROCPRIM_INLINE static hipError_t batch_copy(void*              temporary_storage
             debug_synchronous);
 }
 
+/// \brief Fill `sizes[i]` elements of `destinations[i]` with `values[i]` for all `i` in the range [0, `num_fills`].
+///
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `batch_copy_config`.
+/// \tparam OutputBufferItType type of iterator to destination pointers.
+/// \tparam ValueItType type of iterator to the values of the fills.
+/// \tparam BufferSizeItType type of iterator to sizes.
+///
+/// \param [in] temporary_storage pointer to device-accessible temporary storage.
+/// When a null pointer is passed, the required allocation size in bytes is written to
+/// `storage_size` and the function returns without performing the fill.
+/// \param [in, out] storage_size reference to the size in bytes of `temporary_storage`.
+/// \param [in] destinations iterator of destination pointers.
+/// \param [in] values iterator of the values to fill the ranges with.
+/// \param [in] sizes iterator of range sizes to fill.
+/// \param [in] num_fills number of ranges to fill
+/// \param [in] stream [optional] HIP stream object to enqueue the fill on. Default is `hipStreamDefault`.
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is `false`.
+///
+/// Performs multiple device fills as a single batched operation, it is `batch_copy` with
+/// a constant source per range. Roughly equivalent to
+/// \code{.cpp}
+/// for (auto i = 0; i < num_fills; ++i) {
+///     auto* dst = destinations[i];
+///     for (auto j = 0; j < sizes[i]; ++j)
+///     {
+///         dst[j] = values[i];
+///     }
+/// }
+/// \endcode
+/// except executed on the device in parallel. The iterators are read on the device, so
+/// the ranges can be produced by a previous kernel on the same stream.
+/// Destinations overlapping with other destinations is not allowed, and will result in
+/// undefined behaviour.
+template<class Config_ = default_config,
+         class OutputBufferItType,
+         class ValueItType,
+         class BufferSizeItType>
+ROCPRIM_INLINE static hipError_t batch_fill(void*              temporary_storage,
+                                            size_t&            storage_size,
+                                            OutputBufferItType destinations,
+                                            ValueItType        values,
+                                            BufferSizeItType   sizes,
+                                            uint32_t           num_fills,
+                                            hipStream_t        stream            = hipStreamDefault,
+                                            bool               debug_synchronous = false)
+{
+    return detail::batch_fill_func<Config_>(temporary_storage,
+                                            storage_size,
+                                            destinations,
+                                            values,
+                                            sizes,
+                                            num_fills,
+                                            stream,
+                                            debug_synchronous);
+}
+
 END_ROCPRIM_NAMESPACE
 
 #endif
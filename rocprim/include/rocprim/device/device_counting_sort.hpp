@@ -0,0 +1,295 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_COUNTING_SORT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_COUNTING_SORT_HPP_
+
+#include "../config.hpp"
+#include "../types.hpp"
+
+#include "specialization/device_radix_counting_sort.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+inline hipError_t counting_sort_impl(void*                temporary_storage,
+                                     size_t&              storage_size,
+                                     KeysInputIterator    keys_input,
+                                     KeysOutputIterator   keys_output,
+                                     ValuesInputIterator  values_input,
+                                     ValuesOutputIterator values_output,
+                                     const size_t         size,
+                                     const unsigned int   begin_bit,
+                                     const unsigned int   end_bit,
+                                     const hipStream_t    stream,
+                                     const bool           debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    static_assert(radix_sort_counting_supported<key_type, identity_decomposer>::value,
+                  "The counting sort supports only arithmetic key types");
+
+    return radix_sort_counting_impl<Descending>(temporary_storage,
+                                                storage_size,
+                                                keys_input,
+                                                nullptr,
+                                                keys_output,
+                                                values_input,
+                                                nullptr,
+                                                values_output,
+                                                size,
+                                                begin_bit,
+                                                end_bit,
+                                                stream,
+                                                debug_synchronous);
+}
+
+} // end namespace detail
+
+/// \brief Parallel ascending counting sort primitive for device level.
+///
+/// \par Overview
+/// * Sorts keys whose bit range <tt>[begin_bit; end_bit)</tt> has at most 12 bits, that is keys
+///   of a domain of at most 4096 values, for example identifiers or categories. The bit range is
+///   a single digit: the digits of every chunk of the input are counted, the counts are scanned,
+///   and every chunk is scattered in a single pass.
+/// * \p rocprim::radix_sort_keys and the other radix sorts with the default config use this sort
+///   automatically for large enough inputs with such a bit range.
+/// * The sort is \b stable: it preserves the relative ordering of equivalent keys.
+/// * The contents of the inputs are not altered by the sorting function.
+/// * When \p temporary_storage is a null pointer, the required allocation size (in bytes) is
+///   written to \p storage_size and the function returns without performing the sort.
+///
+/// \tparam KeysInputIterator random-access iterator type of the input range of keys. Its value
+/// type must be an arithmetic type.
+/// \tparam KeysOutputIterator random-access iterator type of the output range of keys.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and the function returns without performing the sort.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range of keys.
+/// \param [out] keys_output iterator to the output range of keys.
+/// \param [in] size number of keys. Must not exceed the range of <tt>unsigned int</tt>.
+/// \param [in] begin_bit index of the first (least significant) bit used in key comparison.
+/// \param [in] end_bit past-the-end index (most significant) bit used in key comparison. Must be
+/// in range <tt>(begin_bit; begin_bit + 12]</tt> and at most <tt>8 * sizeof(Key)</tt>.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; \p hipErrorInvalidValue if the bit range
+/// or the size is not supported; otherwise a HIP runtime error of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;         // e.g., 8
+/// unsigned int * input;      // e.g., [6, 3, 5, 4, 1, 8, 1, 7]
+/// unsigned int * output;     // empty array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage, the keys are in [0; 16)
+/// rocprim::counting_sort_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, 0, 4
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::counting_sort_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, 0, 4
+/// );
+/// // output: [1, 1, 3, 4, 5, 6, 7, 8]
+/// \endcode
+/// \endparblock
+template<class KeysInputIterator, class KeysOutputIterator>
+inline hipError_t counting_sort_keys(void*              temporary_storage,
+                                     size_t&            storage_size,
+                                     KeysInputIterator  keys_input,
+                                     KeysOutputIterator keys_output,
+                                     size_t             size,
+                                     unsigned int       begin_bit,
+                                     unsigned int       end_bit,
+                                     hipStream_t        stream            = 0,
+                                     bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::counting_sort_impl<false>(temporary_storage,
+                                             storage_size,
+                                             keys_input,
+                                             keys_output,
+                                             values,
+                                             values,
+                                             size,
+                                             begin_bit,
+                                             end_bit,
+                                             stream,
+                                             debug_synchronous);
+}
+
+/// \brief Parallel descending counting sort primitive for device level.
+///
+/// Same as \p counting_sort_keys, but sorts the keys in descending order. The sort is
+/// \b stable.
+template<class KeysInputIterator, class KeysOutputIterator>
+inline hipError_t counting_sort_keys_desc(void*              temporary_storage,
+                                          size_t&            storage_size,
+                                          KeysInputIterator  keys_input,
+                                          KeysOutputIterator keys_output,
+                                          size_t             size,
+                                          unsigned int       begin_bit,
+                                          unsigned int       end_bit,
+                                          hipStream_t        stream            = 0,
+                                          bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::counting_sort_impl<true>(temporary_storage,
+                                            storage_size,
+                                            keys_input,
+                                            keys_output,
+                                            values,
+                                            values,
+                                            size,
+                                            begin_bit,
+                                            end_bit,
+                                            stream,
+                                            debug_synchronous);
+}
+
+/// \brief Parallel ascending counting sort-by-key primitive for device level.
+///
+/// Same as \p counting_sort_keys, but also moves the values with their keys. The sort is
+/// \b stable: the values of equivalent keys keep their order.
+///
+/// \tparam KeysInputIterator random-access iterator type of the input range of keys. Its value
+/// type must be an arithmetic type.
+/// \tparam KeysOutputIterator random-access iterator type of the output range of keys.
+/// \tparam ValuesInputIterator random-access iterator type of the input range of values.
+/// \tparam ValuesOutputIterator random-access iterator type of the output range of values.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and the function returns without performing the sort.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range of keys.
+/// \param [out] keys_output iterator to the output range of keys.
+/// \param [in] values_input iterator to the input range of values.
+/// \param [out] values_output iterator to the output range of values.
+/// \param [in] size number of pairs. Must not exceed the range of <tt>unsigned int</tt>.
+/// \param [in] begin_bit index of the first (least significant) bit used in key comparison.
+/// \param [in] end_bit past-the-end index (most significant) bit used in key comparison. Must be
+/// in range <tt>(begin_bit; begin_bit + 12]</tt> and at most <tt>8 * sizeof(Key)</tt>.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; \p hipErrorInvalidValue if the bit range
+/// or the size is not supported; otherwise a HIP runtime error of type \p hipError_t.
+template<class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+inline hipError_t counting_sort_pairs(void*                temporary_storage,
+                                      size_t&              storage_size,
+                                      KeysInputIterator    keys_input,
+                                      KeysOutputIterator   keys_output,
+                                      ValuesInputIterator  values_input,
+                                      ValuesOutputIterator values_output,
+                                      size_t               size,
+                                      unsigned int         begin_bit,
+                                      unsigned int         end_bit,
+                                      hipStream_t          stream            = 0,
+                                      bool                 debug_synchronous = false)
+{
+    return detail::counting_sort_impl<false>(temporary_storage,
+                                             storage_size,
+                                             keys_input,
+                                             keys_output,
+                                             values_input,
+                                             values_output,
+                                             size,
+                                             begin_bit,
+                                             end_bit,
+                                             stream,
+                                             debug_synchronous);
+}
+
+/// \brief Parallel descending counting sort-by-key primitive for device level.
+///
+/// Same as \p counting_sort_pairs, but sorts the pairs in descending order of keys. The sort is
+/// \b stable.
+template<class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+inline hipError_t counting_sort_pairs_desc(void*                temporary_storage,
+                                           size_t&              storage_size,
+                                           KeysInputIterator    keys_input,
+                                           KeysOutputIterator   keys_output,
+                                           ValuesInputIterator  values_input,
+                                           ValuesOutputIterator values_output,
+                                           size_t               size,
+                                           unsigned int         begin_bit,
+                                           unsigned int         end_bit,
+                                           hipStream_t          stream            = 0,
+                                           bool                 debug_synchronous = false)
+{
+    return detail::counting_sort_impl<true>(temporary_storage,
+                                            storage_size,
+                                            keys_input,
+                                            keys_output,
+                                            values_input,
+                                            values_output,
+                                            size,
+                                            begin_bit,
+                                            end_bit,
+                                            stream,
+                                            debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_COUNTING_SORT_HPP_
@@ -0,0 +1,552 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_DEVICE_DELTA_HPP_
+#define ROCPRIM_DEVICE_DEVICE_DELTA_HPP_
+
+#include "detail/device_delta.hpp"
+
+#include "device_adjacent_difference_config.hpp"
+#include "device_scan.hpp"
+
+#include "config_types.hpp"
+#include "execution_budget.hpp"
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../type_traits.hpp"
+
+#include "../detail/various.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../iterator/transform_output_iterator.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+
+#include <cstddef>
+
+/// \file
+///
+/// Device level delta encoding and decoding parallel primitives
+
+BEGIN_ROCPRIM_NAMESPACE
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS // Do not document
+
+namespace detail
+{
+
+template<typename Config,
+         unsigned int Order,
+         typename InputIt,
+         typename OutputIt,
+         typename UnaryFunction>
+void ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().adjacent_difference_kernel_config.block_size)
+        delta_encode_kernel(const InputIt       input,
+                            const OutputIt      output,
+                            const std::size_t   size,
+                            const UnaryFunction epilogue,
+                            const std::size_t   starting_block)
+{
+    delta_encode_kernel_impl<Config, Order>(input, output, size, epilogue, starting_block);
+}
+
+template<typename Config,
+         unsigned int Order,
+         typename InputIt,
+         typename OutputIt,
+         typename UnaryFunction>
+hipError_t delta_encode_impl(void* const         temporary_storage,
+                             std::size_t&        storage_size,
+                             const InputIt       input,
+                             const OutputIt      output,
+                             const std::size_t   size,
+                             const UnaryFunction epilogue,
+                             const hipStream_t   stream,
+                             const bool          debug_synchronous)
+{
+    using value_type  = typename std::iterator_traits<InputIt>::value_type;
+    using output_type = ::rocprim::invoke_result_t<UnaryFunction, value_type>;
+    using larger_type
+        = std::conditional_t<(sizeof(value_type) >= sizeof(output_type)), value_type, output_type>;
+
+    using config = wrapped_adjacent_difference_config<Config, false, larger_type>;
+
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, otherwise
+        // user may again pass nullptr as temporary_storage
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    detail::target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(detail::host_target_arch(stream, target_arch));
+
+    const detail::adjacent_difference_config_params params
+        = detail::dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size       = params.adjacent_difference_kernel_config.block_size;
+    const unsigned int items_per_thread = params.adjacent_difference_kernel_config.items_per_thread;
+    const unsigned int items_per_block  = block_size * items_per_thread;
+
+    const unsigned int size_limit = static_cast<unsigned int>(
+        budgeted_size_limit(stream,
+                            params.adjacent_difference_kernel_config.size_limit,
+                            items_per_block));
+    const auto         number_of_blocks_limit = std::max(size_limit / items_per_block, 1u);
+    const auto         aligned_size_limit     = number_of_blocks_limit * items_per_block;
+
+    const auto number_of_launch = ceiling_div(size, aligned_size_limit);
+
+    if(debug_synchronous)
+    {
+        std::cout << "----------------------------------\n";
+        std::cout << "size:               " << size << '\n';
+        std::cout << "order:              " << Order << '\n';
+        std::cout << "aligned_size_limit: " << aligned_size_limit << '\n';
+        std::cout << "number_of_launch:   " << number_of_launch << '\n';
+        std::cout << "block_size:         " << block_size << '\n';
+        std::cout << "items_per_block:    " << items_per_block << '\n';
+        std::cout << "----------------------------------\n";
+    }
+
+    for(std::size_t i = 0, offset = 0; i < number_of_launch; ++i, offset += aligned_size_limit)
+    {
+        const auto current_size
+            = static_cast<unsigned int>(std::min<std::size_t>(size - offset, aligned_size_limit));
+        const auto current_blocks = ceiling_div(current_size, items_per_block);
+        const auto starting_block = i * number_of_blocks_limit;
+
+        std::chrono::time_point<std::chrono::steady_clock> start;
+        if(debug_synchronous)
+        {
+            std::cout << "index:            " << i << '\n';
+            std::cout << "current_size:     " << current_size << '\n';
+            std::cout << "number of blocks: " << current_blocks << '\n';
+
+            start = std::chrono::steady_clock::now();
+        }
+        delta_encode_kernel<config, Order><<<current_blocks, block_size, 0, stream>>>(
+            input + offset,
+            output + offset,
+            size,
+            epilogue,
+            starting_block);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("delta_encode_kernel", current_size, start);
+    }
+    return hipSuccess;
+}
+
+} // namespace detail
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Parallel primitive for delta encoding a sequence in device accessible memory.
+///
+/// Stores the difference of each item and the previous item, the first item is stored as is.
+/// The epilogue is applied to each difference before it is stored, e.g. a zig-zag encoding of
+/// signed deltas. It computes the result of `adjacent_difference` followed by `transform` in a
+/// single pass over the input. Equivalent to the following code
+/// \code{.cpp}
+/// output[0] = epilogue(input[0]);
+/// for(std::size_t i = 1; i < size; ++i)
+/// {
+///     output[i] = epilogue(input[i] - input[i - 1]);
+/// }
+/// \endcode
+///
+/// \par Overview
+/// * The differences are computed in the value type of the input. For integral types they wrap
+/// around, which is undone by \p delta_decode.
+/// * The result does not depend on the tiling of the input, since the items before each tile are
+/// read from the input by the tile itself.
+///
+/// \tparam Config [optional] configuration of the primitive, must be `default_config` or `adjacent_difference_config`.
+/// \tparam InputIt [inferred] random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIt [inferred] random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam UnaryFunction [inferred] type of the epilogue. The signature of the function should be
+/// equivalent to the following: `U f(const T& delta)`.
+///
+/// \param temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// `storage_size` and function returns without performing the operation
+/// \param storage_size reference to a size (in bytes) of `temporary_storage`
+/// \param input iterator to the input range
+/// \param output iterator to the output range, must not have any overlap with input
+/// \param size number of items in the input
+/// \param epilogue [optional] the operation applied to each delta. Default is `identity`
+/// \param stream [optional] HIP stream object. Default is `0` (the default stream)
+/// \param debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors and extra debugging info is printed to the
+/// standard output. Default value is `false`
+///
+/// \return `hipSuccess` (0) after successful encoding, otherwise the HIP runtime error of
+/// type `hipError_t`
+///
+/// \par Example
+/// \parblock
+/// In this example the timestamps are delta encoded.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp> //or <rocprim/device/device_delta.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// std::size_t size; // e.g., 6
+/// int* input;       // e.g., [100, 110, 120, 125, 135, 135]
+/// int* output;      // empty array of 6 elements
+///
+/// std::size_t temporary_storage_size_bytes;
+/// void* temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::delta_encode(temporary_storage_ptr, temporary_storage_size_bytes,
+///                       input, output, size);
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform delta encoding
+/// rocprim::delta_encode(temporary_storage_ptr, temporary_storage_size_bytes,
+///                       input, output, size);
+/// // output: [100, 10, 10, 5, 10, 0]
+/// \endcode
+/// \endparblock
+template<typename Config = default_config,
+         typename InputIt,
+         typename OutputIt,
+         typename UnaryFunction = ::rocprim::identity<>>
+hipError_t delta_encode(void* const         temporary_storage,
+                        std::size_t&        storage_size,
+                        const InputIt       input,
+                        const OutputIt      output,
+                        const std::size_t   size,
+                        const UnaryFunction epilogue          = UnaryFunction{},
+                        const hipStream_t   stream            = 0,
+                        const bool          debug_synchronous = false)
+{
+    return detail::delta_encode_impl<Config, 1>(temporary_storage,
+                                                storage_size,
+                                                input,
+                                                output,
+                                                size,
+                                                epilogue,
+                                                stream,
+                                                debug_synchronous);
+}
+
+/// \brief Parallel primitive for delta-of-delta encoding a sequence in device accessible memory.
+///
+/// Applies the delta encoding twice in a single pass: the deltas of the first level are encoded
+/// again, so a sequence with a constant stride is encoded to zeros apart from its first two
+/// items. The epilogue is only applied to the result of the second level. Equivalent to the
+/// following code
+/// \code{.cpp}
+/// delta[0] = input[0];
+/// for(std::size_t i = 1; i < size; ++i)
+/// {
+///     delta[i] = input[i] - input[i - 1];
+/// }
+/// output[0] = epilogue(delta[0]);
+/// for(std::size_t i = 1; i < size; ++i)
+/// {
+///     output[i] = epilogue(delta[i] - delta[i - 1]);
+/// }
+/// \endcode
+///
+/// \par Overview
+/// * The differences are computed in the value type of the input. For integral types they wrap
+/// around, which is undone by \p delta_of_delta_decode.
+/// * The result does not depend on the tiling of the input, since the items before each tile are
+/// read from the input by the tile itself.
+///
+/// \tparam Config [optional] configuration of the primitive, must be `default_config` or `adjacent_difference_config`.
+/// \tparam InputIt [inferred] random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIt [inferred] random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam UnaryFunction [inferred] type of the epilogue. The signature of the function should be
+/// equivalent to the following: `U f(const T& delta)`.
+///
+/// \param temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// `storage_size` and function returns without performing the operation
+/// \param storage_size reference to a size (in bytes) of `temporary_storage`
+/// \param input iterator to the input range
+/// \param output iterator to the output range, must not have any overlap with input
+/// \param size number of items in the input
+/// \param epilogue [optional] the operation applied to each delta of the second level. Default
+/// is `identity`
+/// \param stream [optional] HIP stream object. Default is `0` (the default stream)
+/// \param debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors and extra debugging info is printed to the
+/// standard output. Default value is `false`
+///
+/// \return `hipSuccess` (0) after successful encoding, otherwise the HIP runtime error of
+/// type `hipError_t`
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp> //or <rocprim/device/device_delta.hpp>
+///
+/// std::size_t size; // e.g., 6
+/// int* input;       // e.g., [100, 110, 120, 130, 141, 151]
+/// int* output;      // empty array of 6 elements
+///
+/// // Allocate the temporary storage as in delta_encode()
+/// rocprim::delta_of_delta_encode(temporary_storage_ptr, temporary_storage_size_bytes,
+///                                input, output, size);
+/// // output: [100, -90, 0, 0, 1, -1]
+/// \endcode
+/// \endparblock
+template<typename Config = default_config,
+         typename InputIt,
+         typename OutputIt,
+         typename UnaryFunction = ::rocprim::identity<>>
+hipError_t delta_of_delta_encode(void* const         temporary_storage,
+                                 std::size_t&        storage_size,
+                                 const InputIt       input,
+                                 const OutputIt      output,
+                                 const std::size_t   size,
+                                 const UnaryFunction epilogue          = UnaryFunction{},
+                                 const hipStream_t   stream            = 0,
+                                 const bool          debug_synchronous = false)
+{
+    return detail::delta_encode_impl<Config, 2>(temporary_storage,
+                                                storage_size,
+                                                input,
+                                                output,
+                                                size,
+                                                epilogue,
+                                                stream,
+                                                debug_synchronous);
+}
+
+/// \brief Parallel primitive for decoding a delta encoded sequence in device accessible memory.
+///
+/// Applies the prologue to each item, which should be the inverse of the epilogue that the
+/// sequence was encoded with by \p delta_encode, then computes the inclusive prefix sum of the
+/// deltas. The prologue is fused into the loads of a single pass lookback scan. Equivalent to the
+/// following code
+/// \code{.cpp}
+/// output[0] = prologue(input[0]);
+/// for(std::size_t i = 1; i < size; ++i)
+/// {
+///     output[i] = output[i - 1] + prologue(input[i]);
+/// }
+/// \endcode
+///
+/// \tparam Config [optional] configuration of the primitive, must be `default_config` or `scan_config`.
+/// \tparam InputIt [inferred] random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIt [inferred] random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam UnaryFunction [inferred] type of the prologue. The signature of the function should be
+/// equivalent to the following: `T f(const U& encoded)`, the deltas are accumulated in `T`.
+///
+/// \param temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// `storage_size` and function returns without performing the operation
+/// \param storage_size reference to a size (in bytes) of `temporary_storage`
+/// \param input iterator to the input range
+/// \param output iterator to the output range
+/// \param size number of items in the input
+/// \param prologue [optional] the operation applied to each item before it is accumulated.
+/// Default is `identity`
+/// \param stream [optional] HIP stream object. Default is `0` (the default stream)
+/// \param debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors and extra debugging info is printed to the
+/// standard output. Default value is `false`
+///
+/// \return `hipSuccess` (0) after successful decoding, otherwise the HIP runtime error of
+/// type `hipError_t`
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp> //or <rocprim/device/device_delta.hpp>
+///
+/// std::size_t size; // e.g., 6
+/// int* input;       // e.g., [100, 10, 10, 5, 10, 0]
+/// int* output;      // empty array of 6 elements
+///
+/// std::size_t temporary_storage_size_bytes;
+/// void* temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::delta_decode(temporary_storage_ptr, temporary_storage_size_bytes,
+///                       input, output, size);
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform delta decoding
+/// rocprim::delta_decode(temporary_storage_ptr, temporary_storage_size_bytes,
+///                       input, output, size);
+/// // output: [100, 110, 120, 125, 135, 135]
+/// \endcode
+/// \endparblock
+template<typename Config = default_config,
+         typename InputIt,
+         typename OutputIt,
+         typename UnaryFunction = ::rocprim::identity<>>
+hipError_t delta_decode(void* const         temporary_storage,
+                        std::size_t&        storage_size,
+                        const InputIt       input,
+                        const OutputIt      output,
+                        const std::size_t   size,
+                        const UnaryFunction prologue          = UnaryFunction{},
+                        const hipStream_t   stream            = 0,
+                        const bool          debug_synchronous = false)
+{
+    using value_type = typename std::iterator_traits<InputIt>::value_type;
+    using delta_type = ::rocprim::invoke_result_t<UnaryFunction, value_type>;
+
+    const auto deltas = ::rocprim::make_transform_iterator(input, prologue);
+
+    return ::rocprim::inclusive_scan<Config,
+                                     decltype(deltas),
+                                     OutputIt,
+                                     ::rocprim::plus<delta_type>,
+                                     delta_type>(temporary_storage,
+                                                 storage_size,
+                                                 deltas,
+                                                 output,
+                                                 size,
+                                                 ::rocprim::plus<delta_type>{},
+                                                 stream,
+                                                 debug_synchronous);
+}
+
+/// \brief Parallel primitive for decoding a delta-of-delta encoded sequence in device accessible
+/// memory.
+///
+/// Applies the prologue to each item, which should be the inverse of the epilogue that the
+/// sequence was encoded with by \p delta_of_delta_encode, then computes the inclusive prefix sum
+/// of the inclusive prefix sum of the deltas. Both levels are decoded by a single pass lookback
+/// scan, whose prefix holds the number of the items and the sums of both levels. Equivalent to
+/// the following code
+/// \code{.cpp}
+/// T delta = 0;
+/// T value = 0;
+/// for(std::size_t i = 0; i < size; ++i)
+/// {
+///     delta += prologue(input[i]);
+///     value += delta;
+///     output[i] = value;
+/// }
+/// \endcode
+///
+/// \tparam Config [optional] configuration of the primitive, must be `default_config` or `scan_config`.
+/// \tparam InputIt [inferred] random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIt [inferred] random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam UnaryFunction [inferred] type of the prologue. The signature of the function should be
+/// equivalent to the following: `T f(const U& encoded)`, the deltas are accumulated in `T`.
+///
+/// \param temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// `storage_size` and function returns without performing the operation
+/// \param storage_size reference to a size (in bytes) of `temporary_storage`
+/// \param input iterator to the input range
+/// \param output iterator to the output range
+/// \param size number of items in the input
+/// \param prologue [optional] the operation applied to each item before it is accumulated.
+/// Default is `identity`
+/// \param stream [optional] HIP stream object. Default is `0` (the default stream)
+/// \param debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors and extra debugging info is printed to the
+/// standard output. Default value is `false`
+///
+/// \return `hipSuccess` (0) after successful decoding, otherwise the HIP runtime error of
+/// type `hipError_t`
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp> //or <rocprim/device/device_delta.hpp>
+///
+/// std::size_t size; // e.g., 6
+/// int* input;       // e.g., [100, -90, 0, 0, 1, -1]
+/// int* output;      // empty array of 6 elements
+///
+/// // Allocate the temporary storage as in delta_decode()
+/// rocprim::delta_of_delta_decode(temporary_storage_ptr, temporary_storage_size_bytes,
+///                                input, output, size);
+/// // output: [100, 110, 120, 130, 141, 151]
+/// \endcode
+/// \endparblock
+template<typename Config = default_config,
+         typename InputIt,
+         typename OutputIt,
+         typename UnaryFunction = ::rocprim::identity<>>
+hipError_t delta_of_delta_decode(void* const         temporary_storage,
+                                 std::size_t&        storage_size,
+                                 const InputIt       input,
+                                 const OutputIt      output,
+                                 const std::size_t   size,
+                                 const UnaryFunction prologue          = UnaryFunction{},
+                                 const hipStream_t   stream            = 0,
+                                 const bool          debug_synchronous = false)
+{
+    using value_type = typename std::iterator_traits<InputIt>::value_type;
+    using delta_type = ::rocprim::invoke_result_t<UnaryFunction, value_type>;
+    using state_type = detail::delta_of_delta_state<delta_type>;
+    using scan_op    = detail::delta_of_delta_scan_op<delta_type>;
+
+    const auto states = ::rocprim::make_transform_iterator(
+        input,
+        detail::delta_of_delta_state_op<delta_type, UnaryFunction>{prologue});
+    const auto values = ::rocprim::make_transform_output_iterator(
+        output,
+        detail::delta_of_delta_value_op<delta_type>{});
+
+    return ::rocprim::
+        inclusive_scan<Config, decltype(states), decltype(values), scan_op, state_type>(
+            temporary_storage,
+            storage_size,
+            states,
+            values,
+            size,
+            scan_op{},
+            stream,
+            debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_DELTA_HPP_
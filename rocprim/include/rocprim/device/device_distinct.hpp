@@ -0,0 +1,575 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_DISTINCT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_DISTINCT_HPP_
+
+#include "detail/device_distinct.hpp"
+#include "detail/device_hash_table.hpp"
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/discard_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "device_hash_table_config.hpp"
+#include "device_select.hpp"
+#include "device_transform.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class UniqueCountOutputIterator,
+         class Key>
+inline hipError_t distinct_impl(void*                     temporary_storage,
+                                size_t&                   storage_size,
+                                InputIterator             input,
+                                const size_t              size,
+                                OutputIterator            output,
+                                UniqueCountOutputIterator unique_count_output,
+                                const size_t              max_unique_keys,
+                                const Key                 empty_key,
+                                const bool                stable,
+                                const hipStream_t         stream,
+                                const bool                debug_synchronous)
+{
+    static_assert(is_hash_table_word<Key>::value,
+                  "distinct only supports trivially copyable keys of 4 or 8 bytes");
+
+    using config    = wrapped_hash_table_config<Config, Key, size_t>;
+    using bits_type = hash_table_bits_type<Key>;
+    using flag_op   = distinct_first_occurrence_op<config, InputIterator, bits_type>;
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const hash_table_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+    const size_t       capacity        = hash_table_capacity(max_unique_keys);
+
+    bits_type* slots          = nullptr;
+    size_t*    first_indices  = nullptr;
+    size_t*    unique_count   = nullptr;
+    void*      select_storage = nullptr;
+
+    // In the stable mode the table holds the first index of every key, and the first occurrences
+    // are selected from the input in order.
+    const auto flags = make_transform_iterator(make_counting_iterator<size_t>(0), flag_op{});
+
+    size_t select_storage_size = 0;
+    if(stable)
+    {
+        ROCPRIM_RETURN_ON_ERROR(select(nullptr,
+                                       select_storage_size,
+                                       input,
+                                       flags,
+                                       output,
+                                       unique_count_output,
+                                       size,
+                                       stream,
+                                       false));
+    }
+
+    result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::ptr_aligned_array(&slots, capacity),
+            temp_storage::ptr_aligned_array(&first_indices, stable ? capacity : 0),
+            temp_storage::ptr_aligned_array(&unique_count, 1),
+            temp_storage::make_partition(&select_storage, select_storage_size)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    const bits_type empty_bits = bit_cast<bits_type>(empty_key);
+
+    if(debug_synchronous)
+    {
+        std::cout << "size: " << size << '\n';
+        std::cout << "capacity: " << capacity << '\n';
+        std::cout << "block_size: " << block_size << '\n';
+        std::cout << "shared_slots: " << params.shared_slots << '\n';
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(hipMemsetAsync(unique_count, 0, sizeof(*unique_count), stream));
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    if(size != 0)
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hash_table_init_kernel<config>
+            <<<dim3(ceiling_div(capacity, block_size)), dim3(block_size), 0, stream>>>(
+                slots,
+                first_indices,
+                capacity,
+                empty_bits,
+                std::numeric_limits<size_t>::max());
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_table_init_kernel", capacity, start);
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        if(!stable)
+        {
+            distinct_insert_kernel<config>
+                <<<dim3(ceiling_div(size, items_per_block)), dim3(block_size), 0, stream>>>(
+                    input,
+                    size,
+                    slots,
+                    capacity - 1,
+                    empty_bits,
+                    output,
+                    unique_count);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("distinct_insert_kernel", size, start);
+        }
+        else
+        {
+            hash_reduce_by_key_insert_kernel<config>
+                <<<dim3(ceiling_div(size, items_per_block)), dim3(block_size), 0, stream>>>(
+                    input,
+                    make_counting_iterator<size_t>(0),
+                    size,
+                    slots,
+                    first_indices,
+                    capacity - 1,
+                    empty_bits,
+                    std::numeric_limits<size_t>::max(),
+                    ::rocprim::minimum<size_t>());
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_reduce_by_key_insert_kernel",
+                                                        size,
+                                                        start);
+
+            const flag_op op{input, slots, first_indices, capacity - 1, empty_bits};
+            return select(select_storage,
+                          select_storage_size,
+                          input,
+                          make_transform_iterator(make_counting_iterator<size_t>(0), op),
+                          output,
+                          unique_count_output,
+                          size,
+                          stream,
+                          debug_synchronous);
+        }
+    }
+
+    return transform(unique_count,
+                     unique_count_output,
+                     1,
+                     ::rocprim::identity<size_t>(),
+                     stream,
+                     debug_synchronous);
+}
+
+template<class Config, class InputIterator>
+inline hipError_t hyperloglog_sketch_impl(InputIterator      input,
+                                          const size_t       size,
+                                          unsigned int*      registers,
+                                          const unsigned int precision,
+                                          const hipStream_t  stream,
+                                          const bool         debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    static_assert(is_hash_table_word<key_type>::value,
+                  "hyperloglog_sketch only supports trivially copyable keys of 4 or 8 bytes");
+
+    using config = wrapped_hash_table_config<Config, key_type, unsigned int>;
+
+    if(precision < hyperloglog_min_precision || precision > hyperloglog_max_precision)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const hash_table_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "size: " << size << '\n';
+        std::cout << "precision: " << precision << '\n';
+        std::cout << "block_size: " << block_size << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    const dim3 grid_size(ceiling_div(size, items_per_block));
+    if(precision <= hyperloglog_max_shared_precision)
+    {
+        hyperloglog_sketch_kernel<config, true>
+            <<<grid_size, dim3(block_size), 0, stream>>>(input, size, registers, precision);
+    }
+    else
+    {
+        hyperloglog_sketch_kernel<config, false>
+            <<<grid_size, dim3(block_size), 0, stream>>>(input, size, registers, precision);
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hyperloglog_sketch_kernel", size, start);
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Writes the distinct keys of the input, without sorting it.
+///
+/// Every key is inserted into an open-addressing hash table in global memory, and the key that
+/// claims a slot of the table is written to the output. With a \p SharedSlots config parameter
+/// other than 0, every block first inserts its keys into a table in shared memory, so the global
+/// table is only probed for the first occurrence of a key in every block.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * Unlike \p unique, equal keys do not need to be consecutive. By default the distinct keys
+///   are written in an <b>unspecified order</b>. With \p stable, they are written in the order of
+///   their first occurrence in the input: the table then holds the first index of every key, and
+///   the first occurrences are selected from the input in a second pass.
+/// * Keys are compared by their bit representation. Keys must be trivially copyable types of 4
+///   or 8 bytes.
+/// * \p empty_key marks the empty slots of the table, it must not be one of the input keys.
+/// * The number of distinct keys must not exceed \p max_unique_keys. The table has at least twice
+///   as many slots, so the temporary storage grows with \p max_unique_keys.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p hash_table_config.
+/// \tparam InputIterator [inferred] random-access iterator type of the input range. It can be a
+///   simple pointer type.
+/// \tparam OutputIterator [inferred] random-access iterator type of the output range. It can be
+///   a simple pointer type.
+/// \tparam UniqueCountOutputIterator [inferred] random-access iterator type of the output of the
+///   number of distinct keys. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input iterator to the input range.
+/// \param [in] size number of elements in the input range.
+/// \param [out] output iterator to the output range of distinct keys.
+/// \param [out] unique_count_output iterator to the number of distinct keys.
+/// \param [in] max_unique_keys upper bound of the number of distinct keys in the input.
+/// \param [in] empty_key key that does not occur in the input.
+/// \param [in] stable [optional] whether the distinct keys are written in the order of their
+///   first occurrence. Default value is \p false.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+///   type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the distinct keys are written in the order of their first occurrence.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t   input_size;          // e.g., 8
+/// int *    input;               // e.g., [ 3, 1, 3, 2, 1, 3, 7, 2 ]
+/// int *    output;              // empty array of at least 4 elements
+/// size_t * unique_count_output; // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::distinct(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, input_size, output, unique_count_output, 4, -1, true
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // find the distinct keys
+/// rocprim::distinct(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, input_size, output, unique_count_output, 4, -1, true
+/// );
+/// // output:              [ 3, 1, 2, 7 ]
+/// // unique_count_output: [ 4 ]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class UniqueCountOutputIterator>
+inline hipError_t distinct(
+    void*                                                          temporary_storage,
+    size_t&                                                        storage_size,
+    InputIterator                                                  input,
+    const size_t                                                   size,
+    OutputIterator                                                 output,
+    UniqueCountOutputIterator                                      unique_count_output,
+    const size_t                                                   max_unique_keys,
+    const typename std::iterator_traits<InputIterator>::value_type empty_key,
+    const bool                                                     stable            = false,
+    const hipStream_t                                              stream            = 0,
+    const bool                                                     debug_synchronous = false)
+{
+    return detail::distinct_impl<Config>(temporary_storage,
+                                         storage_size,
+                                         input,
+                                         size,
+                                         output,
+                                         unique_count_output,
+                                         max_unique_keys,
+                                         empty_key,
+                                         stable,
+                                         stream,
+                                         debug_synchronous);
+}
+
+/// \brief Counts the distinct keys of the input, without sorting it.
+///
+/// The keys are inserted into a hash table like in \p distinct, and the number of keys that
+/// claim a slot of the table is written to \p unique_count_output.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * Keys are compared by their bit representation. Keys must be trivially copyable types of 4
+///   or 8 bytes.
+/// * \p empty_key marks the empty slots of the table, it must not be one of the input keys.
+/// * The number of distinct keys must not exceed \p max_unique_keys. When an estimate is enough
+///   or no bound is known, \p hyperloglog_sketch counts in a fixed amount of memory.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p hash_table_config.
+/// \tparam InputIterator [inferred] random-access iterator type of the input range. It can be a
+///   simple pointer type.
+/// \tparam UniqueCountOutputIterator [inferred] random-access iterator type of the output of the
+///   number of distinct keys. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input iterator to the input range.
+/// \param [in] size number of elements in the input range.
+/// \param [out] unique_count_output iterator to the number of distinct keys.
+/// \param [in] max_unique_keys upper bound of the number of distinct keys in the input.
+/// \param [in] empty_key key that does not occur in the input.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config, class InputIterator, class UniqueCountOutputIterator>
+inline hipError_t distinct_count(
+    void*                                                          temporary_storage,
+    size_t&                                                        storage_size,
+    InputIterator                                                  input,
+    const size_t                                                   size,
+    UniqueCountOutputIterator                                      unique_count_output,
+    const size_t                                                   max_unique_keys,
+    const typename std::iterator_traits<InputIterator>::value_type empty_key,
+    const hipStream_t                                              stream            = 0,
+    const bool                                                     debug_synchronous = false)
+{
+    return detail::distinct_impl<Config>(temporary_storage,
+                                         storage_size,
+                                         input,
+                                         size,
+                                         make_discard_iterator(),
+                                         unique_count_output,
+                                         max_unique_keys,
+                                         empty_key,
+                                         false,
+                                         stream,
+                                         debug_synchronous);
+}
+
+/// \brief Adds the keys of the input to a HyperLogLog sketch, which estimates the number of
+/// distinct keys.
+///
+/// The sketch has <tt>2^precision</tt> registers. Every key is hashed, the high bits of the hash
+/// select a register and the register keeps the largest position of the first set bit among the
+/// other bits. The lanes of a warp that update the same register take their maximum first, so
+/// every register is updated once per warp. Sketches of up to <tt>2^12</tt> registers are
+/// updated in shared memory by every block and merged into \p registers at the end.
+///
+/// \par Overview
+/// * \p registers must be zeroed before the first call. The registers are only ever increased,
+///   so calls for several inputs add the keys of all of them to the same sketch, and sketches
+///   are merged by taking the maximum of every register.
+/// * The relative standard error of the estimate is about <tt>1.04 / sqrt(2^precision)</tt>,
+///   e.g. 1.6% for a precision of 12.
+/// * \p precision must be between 4 and 18, otherwise \p hipErrorInvalidValue is returned.
+/// * Keys are hashed by their bit representation. Keys must be trivially copyable types of 4
+///   or 8 bytes.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p hash_table_config,
+///   \p SharedSlots and \p ProbeScheme are not used.
+/// \tparam InputIterator [inferred] random-access iterator type of the input range. It can be a
+///   simple pointer type.
+///
+/// \param [in] input iterator to the input range.
+/// \param [in] size number of elements in the input range.
+/// \param [in,out] registers pointer to the <tt>2^precision</tt> registers of the sketch.
+/// \param [in] precision number of bits of the hash that select the register.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+///   type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the number of distinct keys is estimated with 4096 registers.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t         input_size; // e.g., 100000000
+/// int *          input;      // e.g., [ 3, 1, 3, 2, 1, 3, 7, 2, ... ]
+/// unsigned int * registers;  // array of 4096 elements
+/// double *       estimate;   // empty array of 1 element
+///
+/// hipMemset(registers, 0, 4096 * sizeof(unsigned int));
+/// rocprim::hyperloglog_sketch(input, input_size, registers, 12);
+/// rocprim::hyperloglog_estimate(registers, 12, estimate);
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class InputIterator>
+inline hipError_t hyperloglog_sketch(InputIterator      input,
+                                     const size_t       size,
+                                     unsigned int*      registers,
+                                     const unsigned int precision,
+                                     const hipStream_t  stream            = 0,
+                                     const bool         debug_synchronous = false)
+{
+    return detail::hyperloglog_sketch_impl<Config>(input,
+                                                   size,
+                                                   registers,
+                                                   precision,
+                                                   stream,
+                                                   debug_synchronous);
+}
+
+/// \brief Estimates the number of distinct keys from the registers of a HyperLogLog sketch.
+///
+/// The estimate is the normalized harmonic mean of <tt>2^register</tt>. While more than a
+/// fraction of the registers is zero, linear counting of the zero registers is used instead.
+///
+/// \tparam OutputIterator [inferred] random-access iterator type of the output of the estimate.
+///   Its value type should be constructible from \p double. It can be a simple pointer type.
+///
+/// \param [in] registers pointer to the <tt>2^precision</tt> registers of a sketch built by
+///   \p hyperloglog_sketch.
+/// \param [in] precision the precision of the sketch.
+/// \param [out] estimate_output iterator to the estimated number of distinct keys.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class OutputIterator>
+inline hipError_t hyperloglog_estimate(const unsigned int* registers,
+                                       const unsigned int  precision,
+                                       OutputIterator      estimate_output,
+                                       const hipStream_t   stream            = 0,
+                                       const bool          debug_synchronous = false)
+{
+    constexpr unsigned int block_size = 256;
+
+    if(precision < detail::hyperloglog_min_precision
+       || precision > detail::hyperloglog_max_precision)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    detail::hyperloglog_estimate_kernel<block_size>
+        <<<dim3(1), dim3(block_size), 0, stream>>>(registers, precision, estimate_output);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hyperloglog_estimate_kernel",
+                                                size_t(1) << precision,
+                                                start);
+
+    return hipSuccess;
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_DISTINCT_HPP_
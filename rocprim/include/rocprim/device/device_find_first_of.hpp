@@ -24,145 +24,464 @@
 #include "../config.hpp"
 #include "../detail/temp_storage.hpp"
 #include "config_types.hpp"
+#include "detail/device_hash_table.hpp"
+#include "detail/device_ordered_find.hpp"
 #include "detail/ordered_block_id.hpp"
 #include "device_find_first_of_config.hpp"
 #include "device_transform.hpp"
+#include "execution_budget.hpp"
 
 #include <chrono>
 #include <cstddef>
 #include <cstdio>
 #include <iostream>
 #include <iterator>
+#include <limits>
+#include <type_traits>
 
 BEGIN_ROCPRIM_NAMESPACE
 
 namespace detail
 {
 
-template<class Config, class InputIterator1, class InputIterator2, class BinaryFunction>
-struct find_first_of_impl_kernels
-{
-    template<class T>
-    static ROCPRIM_KERNEL
-    void init_find_first_of_kernel(T* output, T size, ordered_block_id<T> ordered_bid)
-    {
-        *output = size;
-        ordered_bid.reset();
-    }
+// Equality searches of integral keys look up the items in a set of the keys instead of comparing
+// them with every key, once there are at least this many keys:
+// * 1-byte and 2-byte keys are looked up in a bitset of their domain, which is copied to the
+//   shared memory of every block.
+// * Wider keys are looked up in a hash table with linear probing.
+constexpr size_t find_first_of_set_min_keys = 32;
 
-    static ROCPRIM_KERNEL
-#ifndef DOXYGEN_DOCUMENTATION_BUILD
-    __launch_bounds__(device_params<Config>().kernel_config.block_size)
-#endif
-void find_first_of_kernel(InputIterator1           input,
-                          InputIterator2           keys,
-                          size_t*                  output,
-                          size_t                   size,
-                          size_t                   keys_size,
-                          ordered_block_id<size_t> ordered_bid,
-                          BinaryFunction           compare_function)
+enum class find_first_of_set_kind
 {
-    constexpr find_first_of_config_params params = device_params<Config>();
+    none,
+    bitset,
+    hash
+};
 
-        constexpr unsigned int block_size       = params.kernel_config.block_size;
-        constexpr unsigned int items_per_thread = params.kernel_config.items_per_thread;
-        constexpr unsigned int items_per_block  = block_size * items_per_thread;
-        constexpr unsigned int identity         = std::numeric_limits<unsigned int>::max();
+template<class T>
+struct is_find_first_of_equality : std::false_type
+{};
 
-        using type =
-            typename std::remove_const_t<typename std::iterator_traits<InputIterator1>::value_type>;
-        using key_type = typename std::iterator_traits<InputIterator2>::value_type;
+template<class T>
+struct is_find_first_of_equality<::rocprim::equal_to<T>>
+    : std::integral_constant<bool, std::is_same<T, void>::value || std::is_integral<T>::value>
+{};
 
-        const unsigned int thread_id = ::rocprim::detail::block_thread_id<0>();
+template<class Type, class KeyType, class BinaryFunction>
+constexpr find_first_of_set_kind get_find_first_of_set_kind()
+{
+    return !std::is_integral<Type>::value || !std::is_same<Type, KeyType>::value
+                   || !is_find_first_of_equality<BinaryFunction>::value
+               ? find_first_of_set_kind::none
+           : sizeof(Type) <= 2 ? find_first_of_set_kind::bitset
+           : sizeof(Type) == 4 || sizeof(Type) == 8 ? find_first_of_set_kind::hash
+                                                    : find_first_of_set_kind::none;
+}
 
-        ROCPRIM_SHARED_MEMORY struct
-        {
-            unsigned int block_first_index;
-            size_t       global_first_index;
+template<class T>
+using find_first_of_bitset_index_type =
+    typename std::conditional<sizeof(T) == 1, unsigned char, unsigned short>::type;
 
-            typename decltype(ordered_bid)::storage_type ordered_bid;
-        } storage;
+template<class T>
+constexpr unsigned int find_first_of_bitset_words()
+{
+    return (sizeof(T) == 1 ? 256u : 65536u) / 32;
+}
 
-        if(thread_id == 0)
-        {
-            storage.block_first_index = identity;
-        }
-        syncthreads();
+// Returns the index of the first item of a thread that is equal to one of the keys.
+template<class InputIterator2, class BinaryFunction>
+struct find_first_of_keys_matcher
+{
+    InputIterator2 keys;
+    size_t         keys_size;
+    BinaryFunction compare_function;
+
+    template<unsigned int BlockSize, bool IsFull, class T, unsigned int ItemsPerThread>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int first_index(const T (&items)[ItemsPerThread],
+                                                           const unsigned int thread_id,
+                                                           const unsigned int valid)
+    {
+        using key_type = typename std::iterator_traits<InputIterator2>::value_type;
 
-        while(true)
+        unsigned int thread_first_index = ordered_find_no_match;
+        for(size_t key_index = 0; key_index < keys_size; ++key_index)
         {
-            if(thread_id == 0)
+            const key_type key = keys[key_index];
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; ++i)
             {
-                storage.global_first_index = atomic_load(output);
-            }
-            const size_t block_id     = ordered_bid.get(thread_id, storage.ordered_bid);
-            const size_t block_offset = block_id * items_per_block;
-            // ordered_bid.get() calls syncthreads(), it is safe to read global_first_index
-
-            // Exit if all input has been processed or one of previous blocks has found a match
-            if(block_offset >= storage.global_first_index)
-            {
-                break;
+                if((IsFull || i * BlockSize + thread_id < valid) && compare_function(key, items[i]))
+                {
+                    thread_first_index = min(thread_first_index, i);
+                }
             }
+        }
+        return thread_first_index;
+    }
+};
 
-            unsigned int thread_first_index = identity;
+// Returns the index of the first item of a thread that is in the set of the keys.
+template<class Set>
+struct find_first_of_set_matcher
+{
+    Set set;
 
-        if(block_offset + items_per_block <= size)
+    template<unsigned int BlockSize, bool IsFull, class T, unsigned int ItemsPerThread>
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int first_index(const T (&items)[ItemsPerThread],
+                                                           const unsigned int thread_id,
+                                                           const unsigned int valid)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
         {
-            type items[items_per_thread];
-            block_load_direct_striped<block_size>(thread_id, input + block_offset, items);
-            for(size_t key_index = 0; key_index < keys_size; ++key_index)
+            if((IsFull || i * BlockSize + thread_id < valid) && set.contains(items[i]))
             {
-                const key_type key = keys[key_index];
-                ROCPRIM_UNROLL
-                for(unsigned int i = 0; i < items_per_thread; ++i)
-                {
-                    if(compare_function(key, items[i]))
-                    {
-                        thread_first_index = min(thread_first_index, i);
-                    }
-                }
+                return i;
             }
         }
-        else
+        return ordered_find_no_match;
+    }
+};
+
+template<class T>
+struct find_first_of_bitset
+{
+    const unsigned int* words;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE bool contains(const T value) const
+    {
+        const unsigned int index = bit_cast<find_first_of_bitset_index_type<T>>(value);
+        return (words[index / 32] >> (index % 32)) & 1u;
+    }
+};
+
+// The slots that hold the bits of the empty key are empty, whether the empty key is one of the
+// keys is stored separately.
+template<class T>
+struct find_first_of_hash_set
+{
+    using bits_type = hash_table_bits_type<T>;
+
+    const bits_type* slots;
+    size_t           mask;
+    bool             has_empty_key;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE bool contains(const T value) const
+    {
+        const bits_type bits = bit_cast<bits_type>(value);
+        if(bits == ~bits_type(0))
         {
-            const unsigned int valid = size - block_offset;
+            return has_empty_key;
+        }
+        return hash_table_find<hash_probe_scheme::linear>(slots, mask, bits, ~bits_type(0))
+               != mask + 1;
+    }
+};
+
+template<class Config, class InputIterator1, class InputIterator2, class BinaryFunction>
+struct find_first_of_impl_kernels
+{
+    using type = typename std::remove_const_t<
+        typename std::iterator_traits<InputIterator1>::value_type>;
+
+    // Loads the tiles taken by ordered_find_loop in a striped arrangement, the matcher returns the
+    // first item of a thread that matches.
+    template<class Matcher>
+    static ROCPRIM_DEVICE ROCPRIM_INLINE
+    void find_first_of_loop(InputIterator1           input,
+                            size_t*                  output,
+                            size_t                   size,
+                            ordered_block_id<size_t> ordered_bid,
+                            Matcher                  matcher)
+    {
+        constexpr find_first_of_config_params params = device_params<Config>();
 
-            type items[items_per_thread];
-            block_load_direct_striped<block_size>(thread_id, input + block_offset, items, valid);
-            for(size_t key_index = 0; key_index < keys_size; ++key_index)
+        constexpr unsigned int block_size       = params.kernel_config.block_size;
+        constexpr unsigned int items_per_thread = params.kernel_config.items_per_thread;
+        constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+        const unsigned int thread_id = ::rocprim::detail::block_thread_id<0>();
+
+        ordered_find_loop<block_size, items_per_block>(
+            output,
+            size,
+            ordered_bid,
+            [&](const size_t block_offset, const unsigned int valid)
             {
-                const key_type key = keys[key_index];
-                ROCPRIM_UNROLL
-                for(unsigned int i = 0; i < items_per_thread; ++i)
+                unsigned int thread_first_index;
+                type         items[items_per_thread];
+                if(valid == items_per_block)
                 {
-                    if(i * block_size + thread_id < valid && compare_function(key, items[i]))
-                    {
-                        thread_first_index = min(thread_first_index, i);
-                    }
+                    block_load_direct_striped<block_size>(thread_id, input + block_offset, items);
+                    thread_first_index
+                        = matcher.template first_index<block_size, true>(items,
+                                                                         thread_id,
+                                                                         items_per_block);
                 }
-            }
+                else
+                {
+                    block_load_direct_striped<block_size>(thread_id,
+                                                          input + block_offset,
+                                                          items,
+                                                          valid);
+                    thread_first_index
+                        = matcher.template first_index<block_size, false>(items,
+                                                                          thread_id,
+                                                                          valid);
+                }
+                return thread_first_index == ordered_find_no_match
+                           ? ordered_find_no_match
+                           : thread_first_index * block_size + thread_id;
+            });
+    }
+
+    static ROCPRIM_KERNEL
+#ifndef DOXYGEN_DOCUMENTATION_BUILD
+    __launch_bounds__(device_params<Config>().kernel_config.block_size)
+#endif
+    void find_first_of_kernel(InputIterator1           input,
+                              InputIterator2           keys,
+                              size_t*                  output,
+                              size_t                   size,
+                              size_t                   keys_size,
+                              ordered_block_id<size_t> ordered_bid,
+                              BinaryFunction           compare_function)
+    {
+        find_first_of_loop(
+            input,
+            output,
+            size,
+            ordered_bid,
+            find_first_of_keys_matcher<InputIterator2, BinaryFunction>{keys,
+                                                                        keys_size,
+                                                                        compare_function});
+    }
+
+    static ROCPRIM_KERNEL
+#ifndef DOXYGEN_DOCUMENTATION_BUILD
+    __launch_bounds__(device_params<Config>().kernel_config.block_size)
+#endif
+    void find_first_of_bitset_build_kernel(InputIterator2 keys,
+                                           size_t         keys_size,
+                                           unsigned int*  words)
+    {
+        constexpr unsigned int block_size = device_params<Config>().kernel_config.block_size;
+
+        const size_t index = static_cast<size_t>(block_id<0>()) * block_size + block_thread_id<0>();
+        if(index < keys_size)
+        {
+            const unsigned int bit = bit_cast<find_first_of_bitset_index_type<type>>(
+                static_cast<type>(keys[index]));
+            ::atomicOr(&words[bit / 32], 1u << (bit % 32));
+        }
+    }
+
+    static ROCPRIM_KERNEL
+#ifndef DOXYGEN_DOCUMENTATION_BUILD
+    __launch_bounds__(device_params<Config>().kernel_config.block_size)
+#endif
+    void find_first_of_bitset_kernel(InputIterator1           input,
+                                     const unsigned int*      words,
+                                     size_t*                  output,
+                                     size_t                   size,
+                                     ordered_block_id<size_t> ordered_bid)
+    {
+        constexpr unsigned int block_size = device_params<Config>().kernel_config.block_size;
+        constexpr unsigned int bitset_words = find_first_of_bitset_words<type>();
+
+        ROCPRIM_SHARED_MEMORY unsigned int shared_words[bitset_words];
+        for(unsigned int i = block_thread_id<0>(); i < bitset_words; i += block_size)
+        {
+            shared_words[i] = words[i];
         }
+        syncthreads();
+
+        find_first_of_loop(input,
+                           output,
+                           size,
+                           ordered_bid,
+                           find_first_of_set_matcher<find_first_of_bitset<type>>{
+                               find_first_of_bitset<type>{shared_words}});
+    }
+
+    static ROCPRIM_KERNEL
+#ifndef DOXYGEN_DOCUMENTATION_BUILD
+    __launch_bounds__(device_params<Config>().kernel_config.block_size)
+#endif
+    void find_first_of_hash_build_kernel(InputIterator2                 keys,
+                                         size_t                         keys_size,
+                                         hash_table_bits_type<type>*    slots,
+                                         size_t                         mask,
+                                         unsigned int*                  has_empty_key)
+    {
+        using bits_type = hash_table_bits_type<type>;
+
+        constexpr unsigned int block_size = device_params<Config>().kernel_config.block_size;
 
-            if(thread_first_index != identity)
+        const size_t index = static_cast<size_t>(block_id<0>()) * block_size + block_thread_id<0>();
+        if(index < keys_size)
+        {
+            const bits_type bits = bit_cast<bits_type>(static_cast<type>(keys[index]));
+            if(bits == ~bits_type(0))
             {
-                // This happens to some blocks rarely so it is not beneficial to avoid atomic conflicts
-                // with block_reduce which needs to be computed even if no threads have a match.
-                atomic_min(&storage.block_first_index, thread_first_index * block_size + thread_id);
+                *has_empty_key = 1;
             }
-            syncthreads();
-            if(storage.block_first_index != identity)
+            else
             {
-                if(thread_id == 0)
-                {
-                    atomic_min(output, block_offset + storage.block_first_index);
-                }
-                break;
+                // The table has at least twice as many slots as keys, so the insertion succeeds
+                hash_table_insert<hash_probe_scheme::linear>(slots,
+                                                             mask,
+                                                             bits,
+                                                             ~bits_type(0),
+                                                             mask + 1);
             }
         }
     }
+
+    static ROCPRIM_KERNEL
+#ifndef DOXYGEN_DOCUMENTATION_BUILD
+    __launch_bounds__(device_params<Config>().kernel_config.block_size)
+#endif
+    void find_first_of_hash_kernel(InputIterator1                    input,
+                                   const hash_table_bits_type<type>* slots,
+                                   size_t                            mask,
+                                   const unsigned int*               has_empty_key,
+                                   size_t*                           output,
+                                   size_t                            size,
+                                   ordered_block_id<size_t>          ordered_bid)
+    {
+        find_first_of_loop(input,
+                           output,
+                           size,
+                           ordered_bid,
+                           find_first_of_set_matcher<find_first_of_hash_set<type>>{
+                               find_first_of_hash_set<type>{slots, mask, *has_empty_key != 0}});
+    }
 };
 
+template<class Kernels, class... Args>
+inline hipError_t find_first_of_set_search(std::integral_constant<find_first_of_set_kind,
+                                                                  find_first_of_set_kind::none>,
+                                           Args...)
+{
+    return hipSuccess;
+}
+
+// The sets of the keys are built by one thread per key.
+template<class Kernels,
+         class InputIterator1,
+         class InputIterator2,
+         class BitsetWord,
+         class Bits,
+         class OrderedBid>
+inline hipError_t find_first_of_set_search(std::integral_constant<find_first_of_set_kind,
+                                                                  find_first_of_set_kind::bitset>,
+                                           InputIterator1     input,
+                                           InputIterator2     keys,
+                                           size_t*            output,
+                                           const size_t       size,
+                                           const size_t       keys_size,
+                                           BitsetWord*        words,
+                                           const size_t       words_count,
+                                           Bits* /*slots*/,
+                                           const size_t /*capacity*/,
+                                           unsigned int* /*has_empty_key*/,
+                                           OrderedBid         ordered_bid,
+                                           const unsigned int block_size,
+                                           const unsigned int items_per_block,
+                                           const hipStream_t  stream,
+                                           const bool         debug_synchronous)
+{
+    std::chrono::steady_clock::time_point start;
+
+    ROCPRIM_RETURN_ON_ERROR(hipMemsetAsync(words, 0, words_count * sizeof(*words), stream));
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    Kernels::find_first_of_bitset_build_kernel<<<ceiling_div(keys_size, block_size),
+                                                 block_size,
+                                                 0,
+                                                 stream>>>(keys, keys_size, words);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("find_first_of_bitset_build_kernel",
+                                                keys_size,
+                                                start);
+
+    return ordered_find_launch(Kernels::find_first_of_bitset_kernel,
+                                "find_first_of_bitset_kernel",
+                                block_size,
+                                items_per_block,
+                                size,
+                                stream,
+                                debug_synchronous,
+                                input,
+                                static_cast<const BitsetWord*>(words),
+                                output,
+                                size,
+                                ordered_bid);
+}
+
+template<class Kernels,
+         class InputIterator1,
+         class InputIterator2,
+         class BitsetWord,
+         class Bits,
+         class OrderedBid>
+inline hipError_t find_first_of_set_search(std::integral_constant<find_first_of_set_kind,
+                                                                  find_first_of_set_kind::hash>,
+                                           InputIterator1 input,
+                                           InputIterator2 keys,
+                                           size_t*        output,
+                                           const size_t   size,
+                                           const size_t   keys_size,
+                                           BitsetWord* /*words*/,
+                                           const size_t /*words_count*/,
+                                           Bits*              slots,
+                                           const size_t       capacity,
+                                           unsigned int*      has_empty_key,
+                                           OrderedBid         ordered_bid,
+                                           const unsigned int block_size,
+                                           const unsigned int items_per_block,
+                                           const hipStream_t  stream,
+                                           const bool         debug_synchronous)
+{
+    std::chrono::steady_clock::time_point start;
+
+    // The empty slots hold the bits of the empty key, which are all ones
+    ROCPRIM_RETURN_ON_ERROR(hipMemsetAsync(slots, 0xFF, capacity * sizeof(*slots), stream));
+    ROCPRIM_RETURN_ON_ERROR(hipMemsetAsync(has_empty_key, 0, sizeof(*has_empty_key), stream));
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    Kernels::find_first_of_hash_build_kernel<<<ceiling_div(keys_size, block_size),
+                                               block_size,
+                                               0,
+                                               stream>>>(keys,
+                                                         keys_size,
+                                                         slots,
+                                                         capacity - 1,
+                                                         has_empty_key);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("find_first_of_hash_build_kernel",
+                                                keys_size,
+                                                start);
+
+    return ordered_find_launch(Kernels::find_first_of_hash_kernel,
+                                "find_first_of_hash_kernel",
+                                block_size,
+                                items_per_block,
+                                size,
+                                stream,
+                                debug_synchronous,
+                                input,
+                                static_cast<const Bits*>(slots),
+                                capacity - 1,
+                                static_cast<const unsigned int*>(has_empty_key),
+                                output,
+                                size,
+                                ordered_bid);
+}
+
 template<class Config,
          class InputIterator1,
          class InputIterator2,
@@ -180,11 +499,20 @@ hipError_t find_first_of_impl(void*          temporary_storage,
                               hipStream_t    stream,
                               bool           debug_synchronous)
 {
-    using type   = typename std::iterator_traits<InputIterator1>::value_type;
-    using config = wrapped_find_first_of_config<Config, type>;
+    using type     = typename std::iterator_traits<InputIterator1>::value_type;
+    using key_type = typename std::iterator_traits<InputIterator2>::value_type;
+    using config   = wrapped_find_first_of_config<Config, type>;
     using find_first_of_kernels
         = find_first_of_impl_kernels<config, InputIterator1, InputIterator2, BinaryFunction>;
 
+    constexpr find_first_of_set_kind supported_set_kind
+        = get_find_first_of_set_kind<typename find_first_of_kernels::type,
+                                     key_type,
+                                     BinaryFunction>();
+    const find_first_of_set_kind set_kind = keys_size >= find_first_of_set_min_keys
+                                                ? supported_set_kind
+                                                : find_first_of_set_kind::none;
+
     target_arch target_arch;
     hipError_t  result = host_target_arch(stream, target_arch);
     if(result != hipSuccess)
@@ -198,11 +526,22 @@ hipError_t find_first_of_impl(void*          temporary_storage,
     const unsigned int items_per_block  = block_size * items_per_thread;
 
     using ordered_bid_type = ordered_block_id<size_t>;
+    using bits_type        = hash_table_bits_type<typename find_first_of_kernels::type>;
+
+    const size_t words_count
+        = set_kind == find_first_of_set_kind::bitset
+              ? find_first_of_bitset_words<typename find_first_of_kernels::type>()
+              : 0;
+    const size_t capacity
+        = set_kind == find_first_of_set_kind::hash ? hash_table_capacity(keys_size) : 0;
 
     // As output can be an arbitrary iterator, we need to use an intermediate buffer to do atomic
     // operations with it
     size_t*                    tmp_output          = nullptr;
     ordered_bid_type::id_type* ordered_bid_storage = nullptr;
+    unsigned int*              words               = nullptr;
+    bits_type*                 slots               = nullptr;
+    unsigned int*              has_empty_key       = nullptr;
 
     // Calculate required temporary storage
     result = temp_storage::partition(
@@ -211,7 +550,11 @@ hipError_t find_first_of_impl(void*          temporary_storage,
         temp_storage::make_linear_partition(
             temp_storage::ptr_aligned_array(&tmp_output, 1),
             temp_storage::make_partition(&ordered_bid_storage,
-                                         ordered_bid_type::get_temp_storage_layout())));
+                                         ordered_bid_type::get_temp_storage_layout()),
+            temp_storage::ptr_aligned_array(&words, words_count),
+            temp_storage::ptr_aligned_array(&slots, capacity),
+            temp_storage::ptr_aligned_array(&has_empty_key,
+                                            set_kind == find_first_of_set_kind::hash ? 1 : 0)));
     if(result != hipSuccess || temporary_storage == nullptr)
     {
         return result;
@@ -219,50 +562,52 @@ hipError_t find_first_of_impl(void*          temporary_storage,
 
     auto ordered_bid = ordered_bid_type::create(ordered_bid_storage);
 
-    std::chrono::steady_clock::time_point start;
-
-    if(debug_synchronous)
-    {
-        start = std::chrono::steady_clock::now();
-    }
-    find_first_of_kernels::init_find_first_of_kernel<<<1, 1, 0, stream>>>(tmp_output,
-                                                                          size,
-                                                                          ordered_bid);
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_find_first_of_kernel", 1, start);
+    ROCPRIM_RETURN_ON_ERROR(
+        ordered_find_init(tmp_output, size, ordered_bid, stream, debug_synchronous));
 
     if(size > 0 && keys_size > 0)
     {
-        auto kernel = find_first_of_kernels::find_first_of_kernel;
-
-        const size_t shared_memory_size = 0;
-
-        // Choose minimum grid size needed to achieve the highest occupancy
-        int min_grid_size, max_block_size;
-        result = hipOccupancyMaxPotentialBlockSize(&min_grid_size,
-                                                   &max_block_size,
-                                                   kernel,
-                                                   shared_memory_size,
-                                                   int(block_size));
-        if(result != hipSuccess)
+        if(set_kind != find_first_of_set_kind::none)
         {
-            return result;
+            result = find_first_of_set_search<find_first_of_kernels>(
+                std::integral_constant<find_first_of_set_kind, supported_set_kind>{},
+                input,
+                keys,
+                tmp_output,
+                size,
+                keys_size,
+                words,
+                words_count,
+                slots,
+                capacity,
+                has_empty_key,
+                ordered_bid,
+                block_size,
+                items_per_block,
+                stream,
+                debug_synchronous);
         }
-
-        const size_t num_blocks
-            = std::min(size_t(min_grid_size), ceiling_div(size, items_per_block));
-
-        if(debug_synchronous)
+        else
         {
-            start = std::chrono::steady_clock::now();
+            result = ordered_find_launch(find_first_of_kernels::find_first_of_kernel,
+                                          "find_first_of_kernel",
+                                          block_size,
+                                          items_per_block,
+                                          size,
+                                          stream,
+                                          debug_synchronous,
+                                          input,
+                                          keys,
+                                          tmp_output,
+                                          size,
+                                          keys_size,
+                                          ordered_bid,
+                                          compare_function);
+        }
+        if(result != hipSuccess)
+        {
+            return result;
         }
-        kernel<<<num_blocks, block_size, shared_memory_size, stream>>>(input,
-                                                                       keys,
-                                                                       tmp_output,
-                                                                       size,
-                                                                       keys_size,
-                                                                       ordered_bid,
-                                                                       compare_function);
-        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("find_first_of_kernel", size, start);
     }
 
     return transform(tmp_output, output, 1, ::rocprim::identity<void>(), stream, debug_synchronous);
@@ -281,6 +626,14 @@ hipError_t find_first_of_impl(void*          temporary_storage,
 /// * Returns the required size of `temporary_storage` in `storage_size` if `temporary_storage` is
 //    a null pointer.
 /// * Accepts custom compare_function.
+/// * When `compare_function` is `rocprim::equal_to`, the input and keys have the same integral
+///   type and there are at least 32 keys, the items are looked up in a set of the keys instead of
+///   being compared with every key. The set is a bitset for 1-byte and 2-byte types and a hash
+///   table for 4-byte and 8-byte types, the latter adds about 16 bytes per key to the temporary
+///   storage.
+/// * With `execution_hint::stream_inputs` on `stream` (see `set_stream_execution_hint`), an input
+///   given as a pointer is loaded with nontemporal loads, so that the keys, or their set, stay in
+///   the L2 cache.
 ///
 /// \tparam Config [optional] configuration of the primitive. It has to be `find_first_of_config`.
 /// \tparam InputIterator1 [inferred] random-access iterator type of the input range. Must meet the
@@ -368,16 +721,22 @@ hipError_t find_first_of(void*          temporary_storage,
                          hipStream_t    stream            = 0,
                          bool           debug_synchronous = false)
 {
-    return detail::find_first_of_impl<Config>(temporary_storage,
-                                              storage_size,
-                                              input,
-                                              keys,
-                                              output,
-                                              size,
-                                              keys_size,
-                                              compare_function,
-                                              stream,
-                                              debug_synchronous);
+    return detail::with_streaming_input(
+        stream,
+        input,
+        [&](auto streamed_input)
+        {
+            return detail::find_first_of_impl<Config>(temporary_storage,
+                                                      storage_size,
+                                                      streamed_input,
+                                                      keys,
+                                                      output,
+                                                      size,
+                                                      keys_size,
+                                                      compare_function,
+                                                      stream,
+                                                      debug_synchronous);
+        });
 }
 
 /// @}
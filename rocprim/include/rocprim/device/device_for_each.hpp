@@ -0,0 +1,351 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_FOR_EACH_HPP_
+#define ROCPRIM_DEVICE_DEVICE_FOR_EACH_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "detail/device_for_each.hpp"
+#include "device_transform_config.hpp"
+#include "execution_budget.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Config, class InputIterator, class Function>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void for_each_kernel(InputIterator input,
+                     const size_t  launch_offset,
+                     const size_t  size,
+                     Function      function)
+{
+    for_each_kernel_impl<device_params<Config>().kernel_config.block_size,
+                         device_params<Config>().kernel_config.items_per_thread>(input,
+                                                                                 launch_offset,
+                                                                                 size,
+                                                                                 function);
+}
+
+template<class Config, class Function>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void for_each_index_kernel(const size_t launch_offset, const size_t size, Function function)
+{
+    for_each_index_kernel_impl<device_params<Config>().kernel_config.block_size,
+                               device_params<Config>().kernel_config.items_per_thread>(
+        launch_offset,
+        size,
+        function);
+}
+
+template<class Config, class InputIterator, class Function>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void for_each_tile_kernel(InputIterator input,
+                          const size_t  launch_offset,
+                          const size_t  size,
+                          Function      function)
+{
+    for_each_tile_kernel_impl<device_params<Config>().kernel_config.block_size,
+                              device_params<Config>().kernel_config.items_per_thread>(
+        input,
+        launch_offset,
+        size,
+        function);
+}
+
+// Launches the tiles of the items with the grid size limit of the config, launch(grid_size,
+// block_size, launch_offset) launches the kernel.
+template<class Config, class Launch>
+inline hipError_t for_each_launch(const size_t      size,
+                                  const char*       name,
+                                  Launch            launch,
+                                  const hipStream_t stream,
+                                  const bool        debug_synchronous)
+{
+    if(size == size_t(0))
+    {
+        return hipSuccess;
+    }
+
+    target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, target_arch));
+    const transform_config_params params = dispatch_target_arch<Config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const auto         items_per_block = block_size * params.kernel_config.items_per_thread;
+
+    const auto size_limit
+        = budgeted_size_limit(stream, params.kernel_config.size_limit, items_per_block);
+    const auto aligned_size_limit
+        = ::rocprim::max<size_t>(size_limit / items_per_block, 1) * items_per_block;
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << ceiling_div(size, items_per_block) << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    for(size_t offset = 0; offset < size; offset += aligned_size_limit)
+    {
+        const size_t current_size = std::min(size - offset, aligned_size_limit);
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        launch(dim3(ceiling_div(current_size, items_per_block)), dim3(block_size), offset);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(name, current_size, start);
+    }
+
+    return hipSuccess;
+}
+
+} // end of detail namespace
+
+/// \brief Parallel for_each primitive for device level.
+///
+/// for_each_n calls \p function for every item of the range, with the reference of the item,
+/// so the function can modify the items in place. Unlike a \p transform into a
+/// \p discard_iterator, nothing is loaded into registers or stored by the kernel except
+/// what the function does.
+///
+/// \par Overview
+/// * The items are visited in an unspecified order, each item exactly once.
+/// * The launch is sized by the config, like the launch of \p transform.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the range. It can be a simple
+/// pointer type.
+/// \tparam Function - type of the function.
+///
+/// \param [in] input - iterator to the first element in the range.
+/// \param [in] size - number of element in the range.
+/// \param [in] function - function object that will be called for every item.
+/// The signature of the function should be equivalent to the following:
+/// <tt>void f(T &a);</tt>, or <tt>void f(const T &a);</tt> when the items are not modified.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto scale =
+///     [] __device__ (float& a)
+///     {
+///         a *= 2.0f;
+///     };
+///
+/// size_t size;     // e.g., 4
+/// float * values;  // e.g., [1, 2, 3, 4]
+///
+/// rocprim::for_each_n(values, size, scale);
+/// // values: [2, 4, 6, 8]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class InputIterator, class Function>
+inline hipError_t for_each_n(InputIterator     input,
+                             const size_t      size,
+                             Function          function,
+                             const hipStream_t stream            = 0,
+                             bool              debug_synchronous = false)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using config     = detail::wrapped_transform_config<Config, value_type>;
+
+    return detail::for_each_launch<config>(
+        size,
+        "for_each_kernel",
+        [&](const dim3 grid_size, const dim3 block_size, const size_t offset)
+        {
+            detail::for_each_kernel<config>
+                <<<grid_size, block_size, 0, stream>>>(input, offset, size, function);
+        },
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel for_each primitive for device level over the range [\p first, \p last).
+///
+/// Same as \p for_each_n with the size <tt>last - first</tt>.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the range. It can be a simple
+/// pointer type.
+/// \tparam Function - type of the function.
+///
+/// \param [in] first - iterator to the first element in the range.
+/// \param [in] last - iterator past the last element in the range.
+/// \param [in] function - function object that will be called for every item.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+template<class Config = default_config, class InputIterator, class Function>
+inline hipError_t for_each(InputIterator     first,
+                           InputIterator     last,
+                           Function          function,
+                           const hipStream_t stream            = 0,
+                           bool              debug_synchronous = false)
+{
+    return for_each_n<Config>(first,
+                              static_cast<size_t>(std::distance(first, last)),
+                              function,
+                              stream,
+                              debug_synchronous);
+}
+
+/// \brief Parallel for_each primitive for device level over indices.
+///
+/// for_each_index calls \p function for every index in [0, \p size), for kernels that do not
+/// map to a single input range.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config or a class derived from it.
+/// \tparam Function - type of the function.
+///
+/// \param [in] size - number of indices.
+/// \param [in] function - function object that will be called for every index.
+/// The signature of the function should be equivalent to the following:
+/// <tt>void f(size_t index);</tt>.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+template<class Config = default_config, class Function>
+inline hipError_t for_each_index(const size_t      size,
+                                 Function          function,
+                                 const hipStream_t stream            = 0,
+                                 bool              debug_synchronous = false)
+{
+    using config = detail::wrapped_transform_config<Config, size_t>;
+
+    return detail::for_each_launch<config>(
+        size,
+        "for_each_index_kernel",
+        [&](const dim3 grid_size, const dim3 block_size, const size_t offset)
+        {
+            detail::for_each_index_kernel<config>
+                <<<grid_size, block_size, 0, stream>>>(offset, size, function);
+        },
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel for_each primitive for device level over the tiles of a range.
+///
+/// for_each_tile loads the tiles of the range and calls \p function in every thread with the
+/// items of the thread, in a blocked arrangement. This gives the load paths and the launch of
+/// rocPRIM to hand-written device code: full tiles of pointers, and of \p transform_iterator
+/// over pointers, are loaded with vector loads.
+///
+/// \par Overview
+/// * The tiles have <tt>block_size * items_per_thread</tt> items of the config. The thread
+/// \p t of a tile gets the items <tt>[t * items_per_thread, (t + 1) * items_per_thread)</tt>
+/// of the tile.
+/// * The threads of the last tile without valid items do not call the function. The items of
+/// a thread past its valid items are uninitialized.
+/// * The function is called by all threads of full tiles, so it can use warp-level
+/// primitives there, but not block-level synchronization.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the range. It can be a simple
+/// pointer type.
+/// \tparam Function - type of the function.
+///
+/// \param [in] input - iterator to the first element in the range.
+/// \param [in] size - number of element in the range.
+/// \param [in] function - function object that will be called for the items of every thread.
+/// The signature of the function should be equivalent to the following:
+/// <tt>void f(T (&items)[ItemsPerThread], size_t offset, unsigned int valid);</tt>, where
+/// \p offset is the index of the first item of the thread in the range, and \p valid is the
+/// number of its valid items.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Counts the items greater than a threshold with one atomic per thread.
+/// struct count_greater
+/// {
+///     unsigned int* count;
+///     float         threshold;
+///
+///     template<unsigned int ItemsPerThread>
+///     __device__ void operator()(float (&items)[ItemsPerThread], size_t, unsigned int valid)
+///     {
+///         unsigned int greater = 0;
+///         for(unsigned int i = 0; i < valid; i++)
+///         {
+///             greater += items[i] > threshold;
+///         }
+///         atomicAdd(count, greater);
+///     }
+/// };
+///
+/// rocprim::for_each_tile(values, size, count_greater{count, 0.5f});
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class InputIterator, class Function>
+inline hipError_t for_each_tile(InputIterator     input,
+                                const size_t      size,
+                                Function          function,
+                                const hipStream_t stream            = 0,
+                                bool              debug_synchronous = false)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using config     = detail::wrapped_transform_config<Config, value_type>;
+
+    return detail::for_each_launch<config>(
+        size,
+        "for_each_tile_kernel",
+        [&](const dim3 grid_size, const dim3 block_size, const size_t offset)
+        {
+            detail::for_each_tile_kernel<config>
+                <<<grid_size, block_size, 0, stream>>>(input, offset, size, function);
+        },
+        stream,
+        debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_FOR_EACH_HPP_
@@ -0,0 +1,374 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_GATHER_SCATTER_HPP_
+#define ROCPRIM_DEVICE_DEVICE_GATHER_SCATTER_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+
+#include "../iterator/constant_iterator.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+
+#include "detail/device_gather_scatter.hpp"
+#include "device_for_each.hpp"
+#include "device_memcpy.hpp"
+#include "device_transform_config.hpp"
+
+#include <iterator>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Config, class InputIterator, class IndexIterator, class OutputIterator>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void gather_kernel(InputIterator  input,
+                   IndexIterator  indices,
+                   OutputIterator output,
+                   const size_t   launch_offset,
+                   const size_t   size)
+{
+    gather_kernel_impl<device_params<Config>().kernel_config.block_size,
+                       device_params<Config>().kernel_config.items_per_thread>(input,
+                                                                               indices,
+                                                                               output,
+                                                                               launch_offset,
+                                                                               size);
+}
+
+template<class Config, class InputIterator, class IndexIterator, class OutputIterator>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void scatter_kernel(InputIterator  input,
+                    IndexIterator  indices,
+                    OutputIterator output,
+                    const size_t   launch_offset,
+                    const size_t   size)
+{
+    scatter_kernel_impl<device_params<Config>().kernel_config.block_size,
+                        device_params<Config>().kernel_config.items_per_thread>(input,
+                                                                                indices,
+                                                                                output,
+                                                                                launch_offset,
+                                                                                size);
+}
+
+template<class Config, class InputIterator, class IndexIterator, class T, class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void scatter_reduce_kernel(InputIterator  input,
+                           IndexIterator  indices,
+                           T*             output,
+                           const size_t   launch_offset,
+                           const size_t   size,
+                           BinaryFunction reduce_op)
+{
+    scatter_reduce_kernel_impl<device_params<Config>().kernel_config.block_size,
+                               device_params<Config>().kernel_config.items_per_thread>(
+        input,
+        indices,
+        output,
+        launch_offset,
+        size,
+        reduce_op);
+}
+
+} // end of detail namespace
+
+/// \brief Parallel gather primitive for device level.
+///
+/// gather copies the items of \p input at the positions of \p indices, so that
+/// <tt>output[i] = input[indices[i]]</tt> for every \p i in [0, \p size).
+///
+/// \par Overview
+/// * The items are loaded in a striped arrangement: runs of consecutive indices, such as the
+/// sorted indices of a permutation, give coalesced loads. Every thread issues the loads of
+/// all its items before the first store, so random indices keep many loads in flight.
+/// * The ranges of \p input and \p output must not overlap.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the gathered range. It can be
+/// a simple pointer type.
+/// \tparam IndexIterator - random-access iterator type of the indices. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+///
+/// \param [in] input - iterator to the first element in the gathered range.
+/// \param [in] indices - iterator to the first index.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] size - number of indices and output elements.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;             // e.g., 4
+/// float* input;            // e.g., [1.0, 2.0, 3.0, 4.0]
+/// unsigned int* indices;   // e.g., [3, 0, 0, 2]
+/// float* output;           // empty array of 4 elements
+///
+/// rocprim::gather(input, indices, output, size);
+/// // output: [4.0, 1.0, 1.0, 3.0]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class IndexIterator,
+         class OutputIterator>
+inline hipError_t gather(InputIterator     input,
+                         IndexIterator     indices,
+                         OutputIterator    output,
+                         const size_t      size,
+                         const hipStream_t stream            = 0,
+                         bool              debug_synchronous = false)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using config     = detail::wrapped_transform_config<Config, value_type>;
+
+    return detail::for_each_launch<config>(
+        size,
+        "gather_kernel",
+        [&](const dim3 grid_size, const dim3 block_size, const size_t offset)
+        {
+            detail::gather_kernel<config>
+                <<<grid_size, block_size, 0, stream>>>(input, indices, output, offset, size);
+        },
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel scatter primitive for device level.
+///
+/// scatter copies the items of \p input to the positions of \p indices, so that
+/// <tt>output[indices[i]] = input[i]</tt> for every \p i in [0, \p size).
+///
+/// \par Overview
+/// * The items are stored in a striped arrangement: runs of consecutive indices give
+/// coalesced stores.
+/// * If an index occurs more than once, it is unspecified which of its items is stored.
+/// Use \p scatter_reduce to combine them.
+/// * The ranges of \p input and \p output must not overlap.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam IndexIterator - random-access iterator type of the indices. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the scattered range. It can be
+/// a simple pointer type.
+///
+/// \param [in] input - iterator to the first element in the input range.
+/// \param [in] indices - iterator to the first index.
+/// \param [out] output - iterator to the first element in the scattered range.
+/// \param [in] size - number of input elements and indices.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;             // e.g., 4
+/// float* input;            // e.g., [1.0, 2.0, 3.0, 4.0]
+/// unsigned int* indices;   // e.g., [3, 0, 1, 2]
+/// float* output;           // empty array of 4 elements
+///
+/// rocprim::scatter(input, indices, output, size);
+/// // output: [2.0, 3.0, 4.0, 1.0]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class IndexIterator,
+         class OutputIterator>
+inline hipError_t scatter(InputIterator     input,
+                          IndexIterator     indices,
+                          OutputIterator    output,
+                          const size_t      size,
+                          const hipStream_t stream            = 0,
+                          bool              debug_synchronous = false)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using config     = detail::wrapped_transform_config<Config, value_type>;
+
+    return detail::for_each_launch<config>(
+        size,
+        "scatter_kernel",
+        [&](const dim3 grid_size, const dim3 block_size, const size_t offset)
+        {
+            detail::scatter_kernel<config>
+                <<<grid_size, block_size, 0, stream>>>(input, indices, output, offset, size);
+        },
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel scatter primitive with reduction for device level.
+///
+/// scatter_reduce combines the items of \p input into the positions of \p indices, so that
+/// <tt>output[indices[i]] = reduce_op(output[indices[i]], input[i])</tt> for every \p i in
+/// [0, \p size). The items of \p output that are not indexed are not modified.
+///
+/// \par Overview
+/// * Every thread reduces the runs of equal indices of its items first and updates the
+/// output once per run, so sorted or clustered indices need few atomic operations.
+/// * Sums of \p int, <tt>unsigned int</tt>, <tt>unsigned long long</tt>, \p float and
+/// \p double use hardware atomic adds. Other operations are applied with compare-and-swap
+/// loops, they need a 4 or 8 byte type.
+/// * \p reduce_op must be associative and commutative, the items are combined in an
+/// unspecified order.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam IndexIterator - random-access iterator type of the indices. It can be a simple
+/// pointer type.
+/// \tparam T - type of the items of the output.
+/// \tparam BinaryFunction - type of binary function used for the reduction.
+///
+/// \param [in] input - iterator to the first element in the input range.
+/// \param [in] indices - iterator to the first index.
+/// \param [in,out] output - pointer to the first element in the reduced range.
+/// \param [in] size - number of input elements and indices.
+/// \param [in] reduce_op - [optional] binary operation function object that will be used
+/// for the reduction. The default is \p rocprim::plus<T>.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;             // e.g., 5
+/// float* input;            // e.g., [1.0, 2.0, 3.0, 4.0, 5.0]
+/// unsigned int* indices;   // e.g., [0, 0, 2, 2, 0]
+/// float* output;           // e.g., [0.0, 0.0, 0.0]
+///
+/// rocprim::scatter_reduce(input, indices, output, size);
+/// // output: [8.0, 0.0, 7.0]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class IndexIterator,
+         class T,
+         class BinaryFunction = ::rocprim::plus<T>>
+inline hipError_t scatter_reduce(InputIterator     input,
+                                 IndexIterator     indices,
+                                 T*                output,
+                                 const size_t      size,
+                                 BinaryFunction    reduce_op         = BinaryFunction(),
+                                 const hipStream_t stream            = 0,
+                                 bool              debug_synchronous = false)
+{
+    using config = detail::wrapped_transform_config<Config, T>;
+
+    return detail::for_each_launch<config>(
+        size,
+        "scatter_reduce_kernel",
+        [&](const dim3 grid_size, const dim3 block_size, const size_t offset)
+        {
+            detail::scatter_reduce_kernel<config>
+                <<<grid_size, block_size, 0, stream>>>(input,
+                                                       indices,
+                                                       output,
+                                                       offset,
+                                                       size,
+                                                       reduce_op);
+        },
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel gather primitive of rows for device level.
+///
+/// gather_rows copies the rows of \p row_size items of \p input at the row indices of
+/// \p indices, so that row \p i of \p output is row <tt>indices[i]</tt> of \p input. The rows
+/// are copied with \p batch_memcpy, which copies large rows with whole warps or blocks.
+///
+/// \tparam IndexIterator - random-access iterator type of the row indices. It can be a simple
+/// pointer type.
+/// \tparam T - type of the items of the rows.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the gather.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - pointer to the first row of the gathered rows.
+/// \param [in] indices - iterator to the first row index.
+/// \param [out] output - pointer to the first row of the output.
+/// \param [in] rows - number of row indices and output rows.
+/// \param [in] row_size - number of items of a row.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful gather; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class IndexIterator, class T>
+inline hipError_t gather_rows(void*              temporary_storage,
+                              size_t&            storage_size,
+                              const T*           input,
+                              IndexIterator      indices,
+                              T*                 output,
+                              const unsigned int rows,
+                              const size_t       row_size,
+                              const hipStream_t  stream            = 0,
+                              bool               debug_synchronous = false)
+{
+    using row_op = detail::gather_row_pointer<T>;
+
+    // batch_memcpy takes mutable source pointers, but it only reads the sources
+    return batch_memcpy(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(indices, row_op{const_cast<T*>(input), row_size}),
+        ::rocprim::make_transform_iterator(::rocprim::counting_iterator<size_t>(0),
+                                           row_op{output, row_size}),
+        ::rocprim::constant_iterator<size_t>(row_size * sizeof(T)),
+        rows,
+        stream,
+        debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_GATHER_SCATTER_HPP_
@@ -0,0 +1,192 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_GRAPH_HPP_
+#define ROCPRIM_DEVICE_DEVICE_GRAPH_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+
+#include <type_traits>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The device-wide algorithms, used to query their properties at compile time.
+enum class device_algorithm
+{
+    adjacent_difference,
+    adjacent_find,
+    batch_memcpy,
+    batched,
+    binary_search,
+    copy,
+    find_end,
+    find_first_of,
+    hash_table,
+    histogram,
+    merge,
+    merge_sort,
+    nth_element,
+    partial_sort,
+    partition,
+    radix_sort,
+    radix_sort_distributed,
+    radix_sort_out_of_core,
+    reduce,
+    reduce_by_key,
+    run_length_encode,
+    scan,
+    scan_by_key,
+    search,
+    search_n,
+    segmented_radix_sort,
+    segmented_reduce,
+    segmented_scan,
+    select,
+    topk,
+    transform
+};
+
+/// \brief Tells if a device-wide algorithm can be captured in a hipGraph.
+///
+/// A graph-safe algorithm does not synchronize with the host and does not branch on values
+/// computed on the device once the size of its temporary storage is known, so every launch
+/// it performs can be recorded by stream capture and replayed. This holds only for calls with
+/// \p debug_synchronous set to \p false.
+///
+/// The segmented radix sort with partitioning, the out-of-core radix sort and the distributed
+/// radix sort read intermediate results on the host to size their later launches, so they must
+/// be called outside of stream capture.
+///
+/// \tparam Algorithm - the device-wide algorithm.
+template<device_algorithm Algorithm>
+struct is_graph_safe : std::true_type
+{};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS // Do not document
+
+template<>
+struct is_graph_safe<device_algorithm::segmented_radix_sort> : std::false_type
+{};
+
+template<>
+struct is_graph_safe<device_algorithm::radix_sort_out_of_core> : std::false_type
+{};
+
+template<>
+struct is_graph_safe<device_algorithm::radix_sort_distributed> : std::false_type
+{};
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// \brief Adds the launches of a device-wide algorithm to a graph as a child graph node.
+///
+/// The algorithm is called once on a stream under capture, and the captured launches become
+/// a node of \p graph that depends on \p dependencies. The node can be instantiated and
+/// launched many times, with the same arguments the algorithm was called with. The temporary
+/// storage of the algorithm must be allocated before calling this function, and must be kept
+/// for as long as the graph is used.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// hipGraph_t graph;
+/// hipGraphCreate(&graph, 0);
+///
+/// hipGraphNode_t scan_node;
+/// rocprim::add_algorithm_node(
+///     &scan_node, graph, nullptr, 0,
+///     [&](hipStream_t stream)
+///     {
+///         return rocprim::inclusive_scan(
+///             temporary_storage_ptr, temporary_storage_size_bytes,
+///             input, output, input_size, rocprim::plus<int>(), stream
+///         );
+///     }
+/// );
+/// \endcode
+/// \endparblock
+///
+/// \tparam Algorithm - type of the callable. It is called with a \p hipStream_t and returns
+/// the \p hipError_t of the algorithm.
+///
+/// \param [out] node - the created node.
+/// \param [in] graph - the graph the node is added to.
+/// \param [in] dependencies - the nodes the new node depends on.
+/// \param [in] num_dependencies - the number of nodes in \p dependencies.
+/// \param [in] algorithm - the callable performing the algorithm on the given stream. It must
+/// call only graph-safe algorithms (see \p is_graph_safe), with \p debug_synchronous set to
+/// \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Algorithm>
+inline hipError_t add_algorithm_node(hipGraphNode_t*       node,
+                                     hipGraph_t            graph,
+                                     const hipGraphNode_t* dependencies,
+                                     size_t                num_dependencies,
+                                     Algorithm&&           algorithm)
+{
+    hipStream_t stream;
+    ROCPRIM_RETURN_ON_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    hipError_t error = hipStreamBeginCapture(stream, hipStreamCaptureModeThreadLocal);
+    if(error != hipSuccess)
+    {
+        (void)hipStreamDestroy(stream);
+        return error;
+    }
+
+    // The capture is always ended, so a failing algorithm leaves the stream usable
+    const hipError_t algorithm_error = algorithm(stream);
+    hipGraph_t       child_graph     = nullptr;
+    error                            = hipStreamEndCapture(stream, &child_graph);
+    if(algorithm_error != hipSuccess)
+    {
+        error = algorithm_error;
+    }
+
+    if(error == hipSuccess)
+    {
+        error = hipGraphAddChildGraphNode(node, graph, dependencies, num_dependencies, child_graph);
+    }
+
+    if(child_graph != nullptr)
+    {
+        const hipError_t destroy_error = hipGraphDestroy(child_graph);
+        error                          = error == hipSuccess ? destroy_error : error;
+    }
+    const hipError_t destroy_error = hipStreamDestroy(stream);
+    return error == hipSuccess ? destroy_error : error;
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_GRAPH_HPP_
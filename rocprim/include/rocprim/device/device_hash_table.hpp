@@ -0,0 +1,666 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_HASH_TABLE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_HASH_TABLE_HPP_
+
+#include "detail/device_hash_table.hpp"
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "device_hash_table_config.hpp"
+#include "device_transform.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class Key,
+         class Value,
+         class BinaryFunction>
+inline hipError_t hash_reduce_by_key_impl(void*                     temporary_storage,
+                                          size_t&                   storage_size,
+                                          KeysInputIterator         keys_input,
+                                          ValuesInputIterator       values_input,
+                                          const size_t              size,
+                                          UniqueOutputIterator      unique_output,
+                                          AggregatesOutputIterator  aggregates_output,
+                                          UniqueCountOutputIterator unique_count_output,
+                                          const size_t              max_unique_keys,
+                                          const Key                 empty_key,
+                                          const Value               initial_value,
+                                          BinaryFunction            reduce_op,
+                                          const hipStream_t         stream,
+                                          const bool                debug_synchronous)
+{
+    static_assert(is_hash_table_word<Key>::value,
+                  "hash_reduce_by_key only supports trivially copyable keys of 4 or 8 bytes");
+    static_assert(is_hash_table_word<Value>::value,
+                  "hash_reduce_by_key only supports trivially copyable values of 4 or 8 bytes");
+
+    using config    = wrapped_hash_table_config<Config, Key, Value>;
+    using bits_type = hash_table_bits_type<Key>;
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const hash_table_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+    const size_t       capacity        = hash_table_capacity(max_unique_keys);
+
+    bits_type* slots        = nullptr;
+    Value*     aggregates   = nullptr;
+    size_t*    unique_count = nullptr;
+
+    result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(temp_storage::ptr_aligned_array(&slots, capacity),
+                                            temp_storage::ptr_aligned_array(&aggregates, capacity),
+                                            temp_storage::ptr_aligned_array(&unique_count, 1)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    const bits_type empty_bits = bit_cast<bits_type>(empty_key);
+
+    if(debug_synchronous)
+    {
+        std::cout << "size: " << size << '\n';
+        std::cout << "capacity: " << capacity << '\n';
+        std::cout << "block_size: " << block_size << '\n';
+        std::cout << "shared_slots: " << params.shared_slots << '\n';
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(hipMemsetAsync(unique_count, 0, sizeof(*unique_count), stream));
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    if(size != 0)
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hash_table_init_kernel<config>
+            <<<dim3(ceiling_div(capacity, block_size)), dim3(block_size), 0, stream>>>(
+                slots,
+                aggregates,
+                capacity,
+                empty_bits,
+                initial_value);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_table_init_kernel", capacity, start);
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hash_reduce_by_key_insert_kernel<config>
+            <<<dim3(ceiling_div(size, items_per_block)), dim3(block_size), 0, stream>>>(
+                keys_input,
+                values_input,
+                size,
+                slots,
+                aggregates,
+                capacity - 1,
+                empty_bits,
+                initial_value,
+                reduce_op);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_reduce_by_key_insert_kernel",
+                                                    size,
+                                                    start);
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hash_reduce_by_key_compact_kernel<config, Key>
+            <<<dim3(ceiling_div(capacity, items_per_block)), dim3(block_size), 0, stream>>>(
+                slots,
+                aggregates,
+                capacity,
+                empty_bits,
+                unique_output,
+                aggregates_output,
+                unique_count);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_reduce_by_key_compact_kernel",
+                                                    capacity,
+                                                    start);
+    }
+
+    return transform(unique_count,
+                     unique_count_output,
+                     1,
+                     ::rocprim::identity<size_t>(),
+                     stream,
+                     debug_synchronous);
+}
+
+// The table of a join is kept in storage that the user owns between the build and the probes. Its
+// layout only depends on the number of build keys.
+template<class Bits, class Value>
+inline hipError_t hash_join_table_partition(void*        table_storage,
+                                            size_t&      table_storage_size,
+                                            const size_t capacity,
+                                            Bits**       slots,
+                                            Value**      values)
+{
+    return temp_storage::partition(
+        table_storage,
+        table_storage_size,
+        temp_storage::make_linear_partition(temp_storage::ptr_aligned_array(slots, capacity),
+                                            temp_storage::ptr_aligned_array(values, capacity)));
+}
+
+template<class Config, class KeysInputIterator, class ValuesInputIterator, class Key>
+inline hipError_t hash_join_build_impl(void*               table_storage,
+                                       size_t&             table_storage_size,
+                                       KeysInputIterator   keys_input,
+                                       ValuesInputIterator values_input,
+                                       const size_t        size,
+                                       const Key           empty_key,
+                                       const hipStream_t   stream,
+                                       const bool          debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    static_assert(is_hash_table_word<Key>::value,
+                  "hash_join_build only supports trivially copyable keys of 4 or 8 bytes");
+
+    using config    = wrapped_hash_table_config<Config, Key, value_type>;
+    using bits_type = hash_table_bits_type<Key>;
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const hash_table_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+    const size_t       capacity        = hash_table_capacity(size);
+
+    bits_type*  slots  = nullptr;
+    value_type* values = nullptr;
+
+    result
+        = hash_join_table_partition(table_storage, table_storage_size, capacity, &slots, &values);
+    if(result != hipSuccess || table_storage == nullptr)
+    {
+        return result;
+    }
+
+    const bits_type empty_bits = bit_cast<bits_type>(empty_key);
+
+    if(debug_synchronous)
+    {
+        std::cout << "size: " << size << '\n';
+        std::cout << "capacity: " << capacity << '\n';
+        std::cout << "block_size: " << block_size << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    hash_table_init_kernel<config>
+        <<<dim3(ceiling_div(capacity, block_size)), dim3(block_size), 0, stream>>>(
+            slots,
+            static_cast<bits_type*>(nullptr),
+            capacity,
+            empty_bits,
+            bits_type(0));
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_table_init_kernel", capacity, start);
+
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    hash_join_build_kernel<config>
+        <<<dim3(ceiling_div(size, items_per_block)), dim3(block_size), 0, stream>>>(keys_input,
+                                                                                    values_input,
+                                                                                    size,
+                                                                                    slots,
+                                                                                    values,
+                                                                                    capacity - 1,
+                                                                                    empty_bits);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_join_build_kernel", size, start);
+
+    return hipSuccess;
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class ValuesOutputIterator,
+         class Key,
+         class Value>
+inline hipError_t hash_join_probe_impl(void*                table_storage,
+                                       size_t               table_storage_size,
+                                       const size_t         build_size,
+                                       KeysInputIterator    keys_input,
+                                       ValuesOutputIterator values_output,
+                                       const size_t         size,
+                                       const Key            empty_key,
+                                       const Value          not_found_value,
+                                       const hipStream_t    stream,
+                                       const bool           debug_synchronous)
+{
+    static_assert(is_hash_table_word<Key>::value,
+                  "hash_join_probe only supports trivially copyable keys of 4 or 8 bytes");
+
+    using config    = wrapped_hash_table_config<Config, Key, Value>;
+    using bits_type = hash_table_bits_type<Key>;
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const hash_table_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+    const size_t       capacity        = hash_table_capacity(build_size);
+
+    if(table_storage == nullptr)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    bits_type* slots  = nullptr;
+    Value*     values = nullptr;
+
+    // Fails if the table was built for a different number of keys or value type.
+    ROCPRIM_RETURN_ON_ERROR(
+        hash_join_table_partition(table_storage, table_storage_size, capacity, &slots, &values));
+
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "size: " << size << '\n';
+        std::cout << "capacity: " << capacity << '\n';
+        std::cout << "block_size: " << block_size << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    hash_join_probe_kernel<config>
+        <<<dim3(ceiling_div(size, items_per_block)), dim3(block_size), 0, stream>>>(
+            slots,
+            values,
+            capacity - 1,
+            bit_cast<bits_type>(empty_key),
+            keys_input,
+            size,
+            values_output,
+            not_found_value);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("hash_join_probe_kernel", size, start);
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Reduces the values of equal keys with a hash table, without sorting the input.
+///
+/// Every key is inserted into an open-addressing hash table in global memory, and its value is
+/// combined into the aggregate of its slot with an atomic operation. With a \p SharedSlots
+/// config parameter other than 0, every block first aggregates its keys in a table in shared
+/// memory, which saves most of the global atomic operations when keys repeat. The occupied slots
+/// are written to the output at the end.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * Unlike \p reduce_by_key, equal keys do not need to be consecutive. The unique keys and their
+///   aggregates are written in an <b>unspecified order</b>.
+/// * Keys are compared by their bit representation. Keys and values must be trivially copyable
+///   types of 4 or 8 bytes.
+/// * \p empty_key marks the empty slots of the table, it must not be one of the input keys.
+/// * The number of unique keys must not exceed \p max_unique_keys. The table has at least twice
+///   as many slots, so the temporary storage grows with \p max_unique_keys.
+/// * \p initial_value is combined with every aggregate, possibly more than once, so it must be an
+///   identity of \p reduce_op (e.g. 0 for \p rocprim::plus).
+/// * \p reduce_op must be commutative and associative, since the order in which values are
+///   combined is unspecified. Floating point aggregates are therefore not deterministic.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p hash_table_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range of keys.
+///   It can be a simple pointer type.
+/// \tparam ValuesInputIterator [inferred] random-access iterator type of the input range of
+///   values. It can be a simple pointer type.
+/// \tparam UniqueOutputIterator [inferred] random-access iterator type of the output range of
+///   unique keys. It can be a simple pointer type.
+/// \tparam AggregatesOutputIterator [inferred] random-access iterator type of the output range
+///   of aggregates. It can be a simple pointer type.
+/// \tparam UniqueCountOutputIterator [inferred] random-access iterator type of the output of the
+///   number of unique keys. It can be a simple pointer type.
+/// \tparam BinaryFunction [inferred] type of the reduction operator.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the reduction.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range of keys.
+/// \param [in] values_input iterator to the input range of values.
+/// \param [in] size number of elements in the input range.
+/// \param [out] unique_output iterator to the output range of unique keys.
+/// \param [out] aggregates_output iterator to the output range of aggregates.
+/// \param [out] unique_count_output iterator to the number of unique keys.
+/// \param [in] max_unique_keys upper bound of the number of unique keys in the input.
+/// \param [in] empty_key key that does not occur in the input.
+/// \param [in] initial_value identity of \p reduce_op.
+/// \param [in] reduce_op binary operation function object that is used to combine the values.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+///   type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the values of equal keys are summed.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t   input_size;      // e.g., 8
+/// int *    keys_input;      // e.g., [ 3, 1, 3, 2, 1, 3, 7, 2 ]
+/// float *  values_input;    // e.g., [ 1, 2, 3, 4, 5, 6, 7, 8 ]
+/// int *    unique_output;   // empty array of at least 4 elements
+/// float *  aggregates_output; // empty array of at least 4 elements
+/// size_t * unique_count_output; // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::hash_reduce_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, values_input, input_size,
+///     unique_output, aggregates_output, unique_count_output,
+///     4, -1, 0.0f, rocprim::plus<float>()
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the reduction
+/// rocprim::hash_reduce_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, values_input, input_size,
+///     unique_output, aggregates_output, unique_count_output,
+///     4, -1, 0.0f, rocprim::plus<float>()
+/// );
+/// // possible unique_output:     [ 1, 7, 2, 3 ]
+/// // possible aggregates_output: [ 7, 7, 12, 10 ]
+/// // unique_count_output:        [ 4 ]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<ValuesInputIterator>::value_type>>
+inline hipError_t hash_reduce_by_key(
+    void*                                                                temporary_storage,
+    size_t&                                                              storage_size,
+    KeysInputIterator                                                    keys_input,
+    ValuesInputIterator                                                  values_input,
+    const size_t                                                         size,
+    UniqueOutputIterator                                                 unique_output,
+    AggregatesOutputIterator                                             aggregates_output,
+    UniqueCountOutputIterator                                            unique_count_output,
+    const size_t                                                         max_unique_keys,
+    const typename std::iterator_traits<KeysInputIterator>::value_type   empty_key,
+    const typename std::iterator_traits<ValuesInputIterator>::value_type initial_value,
+    BinaryFunction    reduce_op         = BinaryFunction(),
+    const hipStream_t stream            = 0,
+    const bool        debug_synchronous = false)
+{
+    return detail::hash_reduce_by_key_impl<Config>(temporary_storage,
+                                                   storage_size,
+                                                   keys_input,
+                                                   values_input,
+                                                   size,
+                                                   unique_output,
+                                                   aggregates_output,
+                                                   unique_count_output,
+                                                   max_unique_keys,
+                                                   empty_key,
+                                                   initial_value,
+                                                   reduce_op,
+                                                   stream,
+                                                   debug_synchronous);
+}
+
+/// \brief Builds the hash table of a join from the keys and values of the build side.
+///
+/// The table is stored in \p table_storage, which is owned by the caller and follows the
+/// protocol of temporary storage: when a null pointer is passed, the required size is written to
+/// \p table_storage_size. The table can then be probed any number of times with
+/// \p hash_join_probe, until the storage is freed or reused.
+///
+/// \par Overview
+/// * Keys are compared by their bit representation. Keys must be trivially copyable types of 4
+///   or 8 bytes.
+/// * \p empty_key marks the empty slots of the table, it must not be one of the build keys.
+/// * If a key occurs more than once, which of its values is stored in the table is unspecified.
+/// * The same \p Config must be used for the build and the probes, since it selects the probe
+///   scheme. The \p SharedSlots parameter of the config is not used by joins.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p hash_table_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the build keys. It can
+///   be a simple pointer type.
+/// \tparam ValuesInputIterator [inferred] random-access iterator type of the build values (e.g.
+///   row indices). It can be a simple pointer type.
+///
+/// \param [in] table_storage pointer to device-accessible storage of the table. When a null
+///   pointer is passed, the required allocation size (in bytes) is written to
+///   \p table_storage_size and function returns without building the table.
+/// \param [in,out] table_storage_size reference to a size (in bytes) of \p table_storage.
+/// \param [in] keys_input iterator to the build keys.
+/// \param [in] values_input iterator to the build values.
+/// \param [in] size number of build keys.
+/// \param [in] empty_key key that does not occur in the build keys.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful build; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config, class KeysInputIterator, class ValuesInputIterator>
+inline hipError_t hash_join_build(
+    void*                                                              table_storage,
+    size_t&                                                            table_storage_size,
+    KeysInputIterator                                                  keys_input,
+    ValuesInputIterator                                                values_input,
+    const size_t                                                       size,
+    const typename std::iterator_traits<KeysInputIterator>::value_type empty_key,
+    const hipStream_t                                                  stream            = 0,
+    const bool                                                         debug_synchronous = false)
+{
+    return detail::hash_join_build_impl<Config>(table_storage,
+                                                table_storage_size,
+                                                keys_input,
+                                                values_input,
+                                                size,
+                                                empty_key,
+                                                stream,
+                                                debug_synchronous);
+}
+
+/// \brief Looks up the probe keys of a join in a table built by \p hash_join_build.
+///
+/// For every probe key, the value stored with the equal build key is written to the output, or
+/// \p not_found_value if there is no such key.
+///
+/// \par Overview
+/// * \p build_size, \p empty_key, \p Config and the value type must be the same as when the
+///   table was built. \p hipErrorInvalidValue is returned if \p table_storage is too small for
+///   \p build_size.
+/// * The probes do not modify the table, so several probes can run concurrently.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p hash_table_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the probe keys. It can
+///   be a simple pointer type.
+/// \tparam ValuesOutputIterator [inferred] random-access iterator type of the output range. It
+///   can be a simple pointer type.
+/// \tparam Value [inferred] type of the build values.
+///
+/// \param [in] table_storage pointer to the storage of a table built by \p hash_join_build.
+/// \param [in] table_storage_size size (in bytes) of \p table_storage.
+/// \param [in] build_size number of keys the table was built from.
+/// \param [in] keys_input iterator to the probe keys.
+/// \param [out] values_output iterator to the output range. Must be able to hold \p size
+///   values.
+/// \param [in] size number of probe keys.
+/// \param [in] empty_key key that marks the empty slots, the same as for the build.
+/// \param [in] not_found_value value written for probe keys that are not in the table.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful probe; otherwise a HIP runtime error of
+///   type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the rows of a dimension table are looked up for the keys of a fact table.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t build_size;   // e.g., 4
+/// int *  build_keys;   // e.g., [ 10, 20, 30, 40 ]
+/// int *  build_rows;   // e.g., [ 0, 1, 2, 3 ]
+/// size_t probe_size;   // e.g., 5
+/// int *  probe_keys;   // e.g., [ 30, 10, 50, 30, 40 ]
+/// int *  matches;      // empty array of 5 elements
+///
+/// size_t table_storage_size;
+/// void * table_storage = nullptr;
+/// // Get required size of the table storage
+/// rocprim::hash_join_build(
+///     table_storage, table_storage_size, build_keys, build_rows, build_size, -1
+/// );
+///
+/// // allocate table storage
+/// hipMalloc(&table_storage, table_storage_size);
+///
+/// // build the table and probe it
+/// rocprim::hash_join_build(
+///     table_storage, table_storage_size, build_keys, build_rows, build_size, -1
+/// );
+/// rocprim::hash_join_probe(
+///     table_storage, table_storage_size, build_size, probe_keys, matches, probe_size, -1, -1
+/// );
+/// // matches: [ 2, 0, -1, 2, 3 ]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class ValuesOutputIterator,
+         class Value>
+inline hipError_t hash_join_probe(
+    void*                                                              table_storage,
+    const size_t                                                       table_storage_size,
+    const size_t                                                       build_size,
+    KeysInputIterator                                                  keys_input,
+    ValuesOutputIterator                                               values_output,
+    const size_t                                                       size,
+    const typename std::iterator_traits<KeysInputIterator>::value_type empty_key,
+    const Value                                                        not_found_value,
+    const hipStream_t                                                  stream            = 0,
+    const bool                                                         debug_synchronous = false)
+{
+    return detail::hash_join_probe_impl<Config>(table_storage,
+                                                table_storage_size,
+                                                build_size,
+                                                keys_input,
+                                                values_output,
+                                                size,
+                                                empty_key,
+                                                not_found_value,
+                                                stream,
+                                                debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_HASH_TABLE_HPP_
@@ -24,15 +24,21 @@
 #include <cmath>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <type_traits>
 
 #include "../config.hpp"
 #include "../common.hpp"
+#include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
 #include "../functional.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
 
 #include "detail/device_histogram.hpp"
 #include "device_histogram_config.hpp"
+#include "execution_budget.hpp"
+#include "tuning_database.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -47,11 +53,12 @@ ROCPRIM_KERNEL __launch_bounds__(
     device_params<Config>()
         .histogram_config
         .block_size) void init_histogram_kernel(fixed_array<Counter*, ActiveChannels>     histogram,
-                                                fixed_array<unsigned int, ActiveChannels> bins)
+                                                fixed_array<unsigned int, ActiveChannels> bins,
+                                                double                                    decay)
 {
     static constexpr histogram_config_params params = device_params<Config>();
 
-    init_histogram<params.histogram_config.block_size, ActiveChannels>(histogram, bins);
+    init_histogram<params.histogram_config.block_size, ActiveChannels>(histogram, bins, decay);
 }
 
 template<class Config,
@@ -124,23 +131,261 @@ ROCPRIM_KERNEL __launch_bounds__(
                                      bins_bits);
 }
 
+template<class Config,
+         unsigned int Channels,
+         unsigned int ActiveChannels,
+         bool         Scatter,
+         class SampleIterator,
+         class SampleToBinOp>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().histogram_config.block_size) void
+    histogram_tiled_partition_kernel(SampleIterator                             samples,
+                                     unsigned int                               columns,
+                                     unsigned int                               row_stride,
+                                     fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
+                                     fixed_array<unsigned int, ActiveChannels>  bin_offsets,
+                                     unsigned int                               tile_bits,
+                                     unsigned int                               num_tiles,
+                                     unsigned int                               num_tiles_bits,
+                                     size_t*                                    tile_counts,
+                                     unsigned int*                              partitioned_bins)
+{
+    static constexpr histogram_config_params params = device_params<Config>();
+
+    histogram_tiled_partition<params.histogram_config.block_size,
+                              params.histogram_config.items_per_thread,
+                              Channels,
+                              ActiveChannels,
+                              Scatter>(samples,
+                                       columns,
+                                       row_stride,
+                                       sample_to_bin_op,
+                                       bin_offsets,
+                                       tile_bits,
+                                       num_tiles,
+                                       num_tiles_bits,
+                                       tile_counts,
+                                       partitioned_bins);
+}
+
+template<class Config>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().histogram_config.block_size) void
+    histogram_tiled_scan_kernel(size_t* tile_counts, size_t* tile_offsets, unsigned int num_tiles)
+{
+    static constexpr histogram_config_params params = device_params<Config>();
+
+    histogram_tiled_scan<params.histogram_config.block_size>(tile_counts, tile_offsets, num_tiles);
+}
+
+template<class Config, unsigned int ActiveChannels, class Counter>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().histogram_config.block_size) void
+    histogram_tiled_tile_kernel(const unsigned int*                       partitioned_bins,
+                                const size_t*                             tile_offsets,
+                                unsigned int                              tile_bits,
+                                fixed_array<Counter*, ActiveChannels>     histogram,
+                                fixed_array<unsigned int, ActiveChannels> bins)
+{
+    static constexpr histogram_config_params params = device_params<Config>();
+
+    // The kernel is instantiated even if the tiled implementation is disabled
+    histogram_tiled_tile<params.histogram_config.block_size,
+                         ::rocprim::max(params.tiled_impl_tile_bins, 1u),
+                         ActiveChannels>(partitioned_bins,
+                                         tile_offsets,
+                                         tile_bits,
+                                         histogram,
+                                         bins);
+}
+
+constexpr unsigned int histogram_range_lut_block_size = 256;
+
+template<unsigned int ActiveChannels, class Level>
+ROCPRIM_KERNEL __launch_bounds__(histogram_range_lut_block_size) void histogram_range_lut_kernel(
+    fixed_array<sample_to_bin_range_lut<Level>, ActiveChannels>                        ops,
+    fixed_array<unsigned int*, ActiveChannels>                                         luts,
+    fixed_array<typename sample_to_bin_range_lut<Level>::scale_type*, ActiveChannels> lut_scales)
+{
+    histogram_range_lut<histogram_range_lut_block_size, ActiveChannels>(ops, luts, lut_scales);
+}
+
+constexpr unsigned int histogram_sorted_block_size = 256;
+
+template<class SampleIterator, class Counter, class SampleToBinOp>
+ROCPRIM_KERNEL __launch_bounds__(histogram_sorted_block_size) void histogram_sorted_search_kernel(
+    SampleIterator samples, unsigned int size, Counter* histogram, SampleToBinOp sample_to_bin_op)
+{
+    histogram_sorted_search<histogram_sorted_block_size>(samples,
+                                                         size,
+                                                         histogram,
+                                                         sample_to_bin_op);
+}
+
+template<class SampleIterator, class Counter, class SampleToBinOp>
+ROCPRIM_KERNEL __launch_bounds__(histogram_sorted_block_size) void histogram_sorted_walk_kernel(
+    SampleIterator samples, unsigned int size, Counter* histogram, SampleToBinOp sample_to_bin_op)
+{
+    histogram_sorted_walk<histogram_sorted_block_size>(samples, size, histogram, sample_to_bin_op);
+}
+
+template<class Config, class WeightIterator>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().histogram_config.block_size) void
+    histogram_weight_max_kernel(WeightIterator      weights,
+                                unsigned int        size,
+                                unsigned long long* max_abs_weight_bits)
+{
+    static constexpr histogram_config_params params = device_params<Config>();
+
+    histogram_weight_max<params.histogram_config.block_size,
+                         params.histogram_config.items_per_thread>(weights,
+                                                                   size,
+                                                                   max_abs_weight_bits);
+}
+
+template<class Config,
+         unsigned int Channels,
+         unsigned int ActiveChannels,
+         class SampleIterator,
+         class WeightIterator,
+         class Accumulator,
+         class SampleToBinOp>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().histogram_config.block_size) void
+    histogram_weighted_shared_kernel(SampleIterator                             samples,
+                                     WeightIterator                             weights,
+                                     unsigned int                               size,
+                                     unsigned int                               shared_histograms,
+                                     fixed_array<Accumulator*, ActiveChannels>  histogram,
+                                     fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
+                                     fixed_array<unsigned int, ActiveChannels>  bins,
+                                     const unsigned long long* max_abs_weight_bits)
+{
+    static constexpr histogram_config_params params = device_params<Config>();
+
+    // Aligned for 8-byte accumulators
+    HIP_DYNAMIC_SHARED(unsigned long long, weighted_block_histogram);
+
+    histogram_weighted_shared<params.histogram_config.block_size,
+                              params.histogram_config.items_per_thread,
+                              Channels,
+                              ActiveChannels>(
+        samples,
+        weights,
+        size,
+        shared_histograms,
+        histogram,
+        sample_to_bin_op,
+        bins,
+        max_abs_weight_bits,
+        reinterpret_cast<Accumulator*>(weighted_block_histogram));
+}
+
+template<class Config,
+         unsigned int Channels,
+         unsigned int ActiveChannels,
+         class SampleIterator,
+         class WeightIterator,
+         class Accumulator,
+         class SampleToBinOp>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().histogram_config.block_size) void
+    histogram_weighted_global_kernel(SampleIterator                             samples,
+                                     WeightIterator                             weights,
+                                     unsigned int                               size,
+                                     fixed_array<Accumulator*, ActiveChannels>  histogram,
+                                     fixed_array<SampleToBinOp, ActiveChannels> sample_to_bin_op,
+                                     const unsigned long long* max_abs_weight_bits)
+{
+    static constexpr histogram_config_params params = device_params<Config>();
+
+    histogram_weighted_global<params.histogram_config.block_size,
+                              params.histogram_config.items_per_thread,
+                              Channels,
+                              ActiveChannels>(samples,
+                                              weights,
+                                              size,
+                                              histogram,
+                                              sample_to_bin_op,
+                                              max_abs_weight_bits);
+}
+
+template<class Config, unsigned int ActiveChannels, class Weight, class Accumulator, class Output>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().histogram_config.block_size) void
+    histogram_weighted_output_kernel(fixed_array<const Accumulator*, ActiveChannels> totals,
+                                     fixed_array<Output*, ActiveChannels>            histogram,
+                                     fixed_array<unsigned int, ActiveChannels>       bins,
+                                     unsigned int                                    size,
+                                     const unsigned long long* max_abs_weight_bits,
+                                     double                    decay)
+{
+    static constexpr histogram_config_params params = device_params<Config>();
+
+    histogram_weighted_output<params.histogram_config.block_size, ActiveChannels, Weight>(
+        totals,
+        histogram,
+        bins,
+        size,
+        max_abs_weight_bits,
+        decay);
+}
+
+// Use up to shared_impl_histograms histograms in shared memory to reduce atomic conflicts
+// for the case of samples concentrated in one bin
+// Limit the number of shared histograms if occupancy drops due to high dynamic shared
+// memory usage, and launch as many blocks as can be resident at once on the device of the
+// stream (limited to max_grid_size and the block budget of the stream)
+template<class Kernel>
+inline hipError_t histogram_shared_occupancy(Kernel                         kernel,
+                                             const histogram_config_params& params,
+                                             size_t                         block_histogram_bytes,
+                                             hipStream_t                    stream,
+                                             unsigned int&                  shared_histograms,
+                                             unsigned int&                  grid_size)
+{
+    const unsigned int block_size = params.histogram_config.block_size;
+
+    int device_id;
+    ROCPRIM_RETURN_ON_ERROR(get_device_from_stream(stream, device_id));
+
+    shared_histograms              = 1;
+    unsigned int max_blocks_per_mp = 0;
+    for(unsigned int n = params.shared_impl_histograms; n >= 1; n--)
+    {
+        unsigned int blocks_per_mp;
+        ROCPRIM_RETURN_ON_ERROR(max_active_blocks_per_multiprocessor(kernel,
+                                                                     block_size,
+                                                                     n * block_histogram_bytes,
+                                                                     device_id,
+                                                                     blocks_per_mp));
+        if(blocks_per_mp > max_blocks_per_mp)
+        {
+            shared_histograms = n;
+            max_blocks_per_mp = blocks_per_mp;
+        }
+    }
+
+    return occupancy_grid_size(kernel,
+                               block_size,
+                               shared_histograms * block_histogram_bytes,
+                               params.max_grid_size,
+                               stream,
+                               grid_size);
+}
+
 template<unsigned int Channels,
          unsigned int ActiveChannels,
          class Config,
          class SampleIterator,
          class Counter,
          class SampleToBinOp>
-inline hipError_t histogram_impl(void*          temporary_storage,
-                                 size_t&        storage_size,
-                                 SampleIterator samples,
-                                 unsigned int   columns,
-                                 unsigned int   rows,
-                                 size_t         row_stride_bytes,
-                                 Counter*       histogram[ActiveChannels],
-                                 unsigned int   levels[ActiveChannels],
-                                 SampleToBinOp  sample_to_bin_op[ActiveChannels],
-                                 hipStream_t    stream,
-                                 bool           debug_synchronous)
+inline hipError_t histogram_config_impl(void*          temporary_storage,
+                                        size_t&        storage_size,
+                                        SampleIterator samples,
+                                        unsigned int   columns,
+                                        unsigned int   rows,
+                                        size_t         row_stride_bytes,
+                                        Counter*       histogram[ActiveChannels],
+                                        unsigned int   levels[ActiveChannels],
+                                        SampleToBinOp  sample_to_bin_op[ActiveChannels],
+                                        hipStream_t    stream,
+                                        bool           debug_synchronous,
+                                        double         decay = 0.0)
 {
     using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
 
@@ -168,7 +413,49 @@ inline hipError_t histogram_impl(void*          temporary_storage,
     const unsigned int blocks_x   = ::rocprim::detail::ceiling_div(columns, items_per_block);
     const unsigned int row_stride = row_stride_bytes / sizeof(sample_type);
 
-    if(temporary_storage == nullptr)
+    unsigned int bins[ActiveChannels];
+    unsigned int bins_bits[ActiveChannels];
+    unsigned int bin_offsets[ActiveChannels];
+    unsigned int total_bins = 0;
+    unsigned int max_bins   = 0;
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        bins[channel] = levels[channel] - 1;
+        bins_bits[channel]
+            = static_cast<unsigned int>(std::log2(detail::next_power_of_two(bins[channel])));
+        bin_offsets[channel] = total_bins;
+        total_bins += bins[channel];
+        max_bins = std::max(max_bins, bins[channel]);
+    }
+
+    // Histograms with too many bins for shared memory are computed per tile of bins when there
+    // are enough samples to pay for partitioning them by tile
+    const unsigned int tile_bins = params.tiled_impl_tile_bins;
+    const unsigned int num_tiles
+        = tile_bins == 0 ? 0 : ::rocprim::detail::ceiling_div(total_bins, tile_bins);
+    const size_t partitioned_size = size_t(columns) * rows * ActiveChannels;
+    const bool   use_tiled_impl   = total_bins > shared_impl_max_bins && tile_bins != 0
+                                && num_tiles <= histogram_tiled_max_tiles
+                                && partitioned_size >= total_bins;
+
+    size_t*       tile_counts      = nullptr;
+    size_t*       tile_offsets     = nullptr;
+    unsigned int* partitioned_bins = nullptr;
+    if(use_tiled_impl)
+    {
+        result = detail::temp_storage::partition(
+            temporary_storage,
+            storage_size,
+            detail::temp_storage::make_linear_partition(
+                detail::temp_storage::ptr_aligned_array(&tile_counts, num_tiles),
+                detail::temp_storage::ptr_aligned_array(&tile_offsets, num_tiles + 1),
+                detail::temp_storage::ptr_aligned_array(&partitioned_bins, partitioned_size)));
+        if(result != hipSuccess || temporary_storage == nullptr)
+        {
+            return result;
+        }
+    }
+    else if(temporary_storage == nullptr)
     {
         // Make sure user won't try to allocate 0 bytes memory, because
         // hipMalloc will return nullptr.
@@ -188,33 +475,25 @@ inline hipError_t histogram_impl(void*          temporary_storage,
         }
     }
 
-    unsigned int bins[ActiveChannels];
-    unsigned int bins_bits[ActiveChannels];
-    unsigned int total_bins = 0;
-    unsigned int max_bins   = 0;
-    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
-    {
-        bins[channel] = levels[channel] - 1;
-        bins_bits[channel]
-            = static_cast<unsigned int>(std::log2(detail::next_power_of_two(bins[channel])));
-        total_bins += bins[channel];
-        max_bins = std::max(max_bins, bins[channel]);
-    }
-
     std::chrono::steady_clock::time_point start;
 
     if(debug_synchronous)
     {
         start = std::chrono::steady_clock::now();
     }
-    hipLaunchKernelGGL(HIP_KERNEL_NAME(init_histogram_kernel<config, ActiveChannels>),
-                       dim3(::rocprim::detail::ceiling_div(max_bins, block_size)),
-                       dim3(block_size),
-                       0,
-                       stream,
-                       fixed_array<Counter*, ActiveChannels>(histogram),
-                       fixed_array<unsigned int, ActiveChannels>(bins));
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_histogram", max_bins, start);
+    // Bins are cleared (decay 0), kept (decay 1) or scaled before the samples are added
+    if(decay != 1.0)
+    {
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(init_histogram_kernel<config, ActiveChannels>),
+                           dim3(::rocprim::detail::ceiling_div(max_bins, block_size)),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           fixed_array<Counter*, ActiveChannels>(histogram),
+                           fixed_array<unsigned int, ActiveChannels>(bins),
+                           decay);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_histogram", max_bins, start);
+    }
 
     if(columns == 0 || rows == 0)
     {
@@ -236,45 +515,14 @@ inline hipError_t histogram_impl(void*          temporary_storage,
 
         const size_t block_histogram_bytes = total_bins * sizeof(unsigned int);
 
-        // Use up to shared_impl_histograms histograms in shared memory to reduce atomic conflicts
-        // for the case of samples concentrated in one bin
-        // Limit the number of shared histograms if occupancy drops due to high dynamic shared
-        // memory usage
-        unsigned int chosen_shared_histograms = 0;
-        int          max_blocks_per_mp        = 0;
-        for(unsigned int n = params.shared_impl_histograms; n >= 1; n--)
-        {
-            int        blocks_per_mp;
-            hipError_t error
-                = hipOccupancyMaxActiveBlocksPerMultiprocessor(&blocks_per_mp,
-                                                               kernel,
-                                                               block_size,
-                                                               n * block_histogram_bytes);
-            if(error != hipSuccess)
-            {
-                return error;
-            }
-            if(blocks_per_mp > max_blocks_per_mp)
-            {
-                chosen_shared_histograms = n;
-                max_blocks_per_mp        = blocks_per_mp;
-            }
-        }
-
-        // Choose minimum grid size needed to achieve the best occupancy
-        int        min_grid_size, max_block_size;
-        hipError_t error
-            = hipOccupancyMaxPotentialBlockSize(&min_grid_size,
-                                                &max_block_size,
-                                                kernel,
-                                                chosen_shared_histograms * block_histogram_bytes,
-                                                int(block_size));
-        if(error != hipSuccess)
-        {
-            return error;
-        }
-        const unsigned int chosen_grid_size
-            = std::min(static_cast<unsigned int>(min_grid_size), params.max_grid_size);
+        unsigned int chosen_shared_histograms;
+        unsigned int chosen_grid_size;
+        ROCPRIM_RETURN_ON_ERROR(histogram_shared_occupancy(kernel,
+                                                           params,
+                                                           block_histogram_bytes,
+                                                           stream,
+                                                           chosen_shared_histograms,
+                                                           chosen_grid_size));
 
         dim3 grid_size;
         grid_size.x = std::min(chosen_grid_size, blocks_x);
@@ -298,6 +546,109 @@ inline hipError_t histogram_impl(void*          temporary_storage,
                                                     grid_size.x * grid_size.y * block_size,
                                                     start);
     }
+    else if(use_tiled_impl)
+    {
+        const unsigned int tile_bits = static_cast<unsigned int>(std::log2(tile_bins));
+        const unsigned int num_tiles_bits
+            = static_cast<unsigned int>(std::log2(detail::next_power_of_two(num_tiles)));
+
+        ROCPRIM_RETURN_ON_ERROR(
+            hipMemsetAsync(tile_counts, 0, num_tiles * sizeof(size_t), stream));
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(
+                histogram_tiled_partition_kernel<config, Channels, ActiveChannels, false>),
+            dim3(blocks_x, rows),
+            dim3(block_size, 1),
+            0,
+            stream,
+            samples,
+            columns,
+            row_stride,
+            fixed_array<SampleToBinOp, ActiveChannels>(sample_to_bin_op),
+            fixed_array<unsigned int, ActiveChannels>(bin_offsets),
+            tile_bits,
+            num_tiles,
+            num_tiles_bits,
+            tile_counts,
+            partitioned_bins);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_tiled_count",
+                                                    blocks_x * block_size * rows,
+                                                    start);
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(histogram_tiled_scan_kernel<config>),
+                           dim3(1),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           tile_counts,
+                           tile_offsets,
+                           num_tiles);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_tiled_scan", num_tiles, start);
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(
+                histogram_tiled_partition_kernel<config, Channels, ActiveChannels, true>),
+            dim3(blocks_x, rows),
+            dim3(block_size, 1),
+            0,
+            stream,
+            samples,
+            columns,
+            row_stride,
+            fixed_array<SampleToBinOp, ActiveChannels>(sample_to_bin_op),
+            fixed_array<unsigned int, ActiveChannels>(bin_offsets),
+            tile_bits,
+            num_tiles,
+            num_tiles_bits,
+            tile_counts,
+            partitioned_bins);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_tiled_scatter",
+                                                    blocks_x * block_size * rows,
+                                                    start);
+
+        // Every tile gets at least one block, the tiles share the blocks that can be resident at
+        // once on the device (up to max_grid_size)
+        auto tile_kernel = HIP_KERNEL_NAME(histogram_tiled_tile_kernel<config, ActiveChannels>);
+        unsigned int tile_grid_size;
+        ROCPRIM_RETURN_ON_ERROR(occupancy_grid_size(tile_kernel,
+                                                    block_size,
+                                                    0,
+                                                    params.max_grid_size,
+                                                    stream,
+                                                    tile_grid_size));
+        const unsigned int blocks_per_tile = std::max(1u, tile_grid_size / num_tiles);
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hipLaunchKernelGGL(
+            tile_kernel,
+            dim3(blocks_per_tile, num_tiles),
+            dim3(block_size, 1),
+            0,
+            stream,
+            partitioned_bins,
+            tile_offsets,
+            tile_bits,
+            fixed_array<Counter*, ActiveChannels>(histogram),
+            fixed_array<unsigned int, ActiveChannels>(bins));
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_tiled_tile",
+                                                    blocks_per_tile * num_tiles * block_size,
+                                                    start);
+    }
     else
     {
         if(debug_synchronous)
@@ -324,6 +675,49 @@ inline hipError_t histogram_impl(void*          temporary_storage,
     return hipSuccess;
 }
 
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config,
+         class SampleIterator,
+         class Counter,
+         class SampleToBinOp>
+inline hipError_t histogram_impl(void*          temporary_storage,
+                                 size_t&        storage_size,
+                                 SampleIterator samples,
+                                 unsigned int   columns,
+                                 unsigned int   rows,
+                                 size_t         row_stride_bytes,
+                                 Counter*       histogram[ActiveChannels],
+                                 unsigned int   levels[ActiveChannels],
+                                 SampleToBinOp  sample_to_bin_op[ActiveChannels],
+                                 hipStream_t    stream,
+                                 bool           debug_synchronous,
+                                 double         decay = 0.0)
+{
+    using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
+
+    return dispatch_tuned_config<Config, sample_type, empty_type>(
+        "histogram",
+        size_t(columns) * rows,
+        stream,
+        [&](auto config)
+        {
+            return histogram_config_impl<Channels, ActiveChannels, typename decltype(config)::type>(
+                temporary_storage,
+                storage_size,
+                samples,
+                columns,
+                rows,
+                row_stride_bytes,
+                histogram,
+                levels,
+                sample_to_bin_op,
+                stream,
+                debug_synchronous,
+                decay);
+        });
+}
+
 template<unsigned int Channels,
          unsigned int ActiveChannels,
          class Config,
@@ -341,7 +735,8 @@ inline hipError_t histogram_even_impl(void*          temporary_storage,
                                       Level          lower_level[ActiveChannels],
                                       Level          upper_level[ActiveChannels],
                                       hipStream_t    stream,
-                                      bool           debug_synchronous)
+                                      bool           debug_synchronous,
+                                      double         decay = 0.0)
 {
     for(unsigned int channel = 0; channel < ActiveChannels; channel++)
     {
@@ -370,7 +765,8 @@ inline hipError_t histogram_even_impl(void*          temporary_storage,
                                                             levels,
                                                             sample_to_bin_op,
                                                             stream,
-                                                            debug_synchronous);
+                                                            debug_synchronous,
+                                                            decay);
 }
 
 template<unsigned int Channels,
@@ -379,27 +775,19 @@ template<unsigned int Channels,
          class SampleIterator,
          class Counter,
          class Level>
-inline hipError_t histogram_range_impl(void*          temporary_storage,
-                                       size_t&        storage_size,
-                                       SampleIterator samples,
-                                       unsigned int   columns,
-                                       unsigned int   rows,
-                                       size_t         row_stride_bytes,
-                                       Counter*       histogram[ActiveChannels],
-                                       unsigned int   levels[ActiveChannels],
-                                       Level*         level_values[ActiveChannels],
-                                       hipStream_t    stream,
-                                       bool           debug_synchronous)
+inline hipError_t histogram_range_search_impl(void*          temporary_storage,
+                                              size_t&        storage_size,
+                                              SampleIterator samples,
+                                              unsigned int   columns,
+                                              unsigned int   rows,
+                                              size_t         row_stride_bytes,
+                                              Counter*       histogram[ActiveChannels],
+                                              unsigned int   levels[ActiveChannels],
+                                              Level*         level_values[ActiveChannels],
+                                              hipStream_t    stream,
+                                              bool           debug_synchronous,
+                                              double         decay)
 {
-    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
-    {
-        if(levels[channel] < 2)
-        {
-            // Histogram must have at least 1 bin
-            return hipErrorInvalidValue;
-        }
-    }
-
     sample_to_bin_range<Level> sample_to_bin_op[ActiveChannels];
     for(unsigned int channel = 0; channel < ActiveChannels; channel++)
     {
@@ -417,23 +805,1315 @@ inline hipError_t histogram_range_impl(void*          temporary_storage,
                                                             levels,
                                                             sample_to_bin_op,
                                                             stream,
-                                                            debug_synchronous);
+                                                            debug_synchronous,
+                                                            decay);
 }
 
+// Levels that are not arithmetic types are always binary searched
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config,
+         class SampleIterator,
+         class Counter,
+         class Level>
+inline hipError_t histogram_range_lut_impl(std::false_type /*arithmetic_levels*/,
+                                           void*          temporary_storage,
+                                           size_t&        storage_size,
+                                           SampleIterator samples,
+                                           unsigned int   columns,
+                                           unsigned int   rows,
+                                           size_t         row_stride_bytes,
+                                           Counter*       histogram[ActiveChannels],
+                                           unsigned int   levels[ActiveChannels],
+                                           Level*         level_values[ActiveChannels],
+                                           hipStream_t    stream,
+                                           bool           debug_synchronous,
+                                           double         decay)
+{
+    return histogram_range_search_impl<Channels, ActiveChannels, Config>(temporary_storage,
+                                                                         storage_size,
+                                                                         samples,
+                                                                         columns,
+                                                                         rows,
+                                                                         row_stride_bytes,
+                                                                         histogram,
+                                                                         levels,
+                                                                         level_values,
+                                                                         stream,
+                                                                         debug_synchronous,
+                                                                         decay);
+}
 
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config,
+         class SampleIterator,
+         class Counter,
+         class Level>
+inline hipError_t histogram_range_lut_impl(std::true_type /*arithmetic_levels*/,
+                                           void*          temporary_storage,
+                                           size_t&        storage_size,
+                                           SampleIterator samples,
+                                           unsigned int   columns,
+                                           unsigned int   rows,
+                                           size_t         row_stride_bytes,
+                                           Counter*       histogram[ActiveChannels],
+                                           unsigned int   levels[ActiveChannels],
+                                           Level*         level_values[ActiveChannels],
+                                           hipStream_t    stream,
+                                           bool           debug_synchronous,
+                                           double         decay)
+{
+    using op_type    = sample_to_bin_range_lut<typename std::remove_cv<Level>::type>;
+    using scale_type = typename op_type::scale_type;
 
-} // namespace detail
-
-/// \brief Computes a histogram from a sequence of samples using equal-width bins.
+    unsigned int max_bins = 0;
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        max_bins = std::max(max_bins, levels[channel] - 1);
+    }
+    if(max_bins < histogram_range_lut_min_bins)
+    {
+        return histogram_range_search_impl<Channels, ActiveChannels, Config>(temporary_storage,
+                                                                             storage_size,
+                                                                             samples,
+                                                                             columns,
+                                                                             rows,
+                                                                             row_stride_bytes,
+                                                                             histogram,
+                                                                             levels,
+                                                                             level_values,
+                                                                             stream,
+                                                                             debug_synchronous,
+                                                                             decay);
+    }
+
+    // Every channel gets a table of the same size, the kernels take one op type for all channels
+    const unsigned int lut_buckets = histogram_range_lut_buckets(max_bins);
+    const size_t       lut_size    = size_t(lut_buckets + 1) * ActiveChannels;
+
+    op_type sample_to_bin_op[ActiveChannels];
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        sample_to_bin_op[channel]
+            = op_type(levels[channel] - 1, level_values[channel], nullptr, nullptr, lut_buckets);
+    }
+
+    // The histogram computation keeps its own temporary storage after the tables
+    size_t           histogram_storage_size;
+    const hipError_t query_result
+        = histogram_impl<Channels, ActiveChannels, Config>(nullptr,
+                                                           histogram_storage_size,
+                                                           samples,
+                                                           columns,
+                                                           rows,
+                                                           row_stride_bytes,
+                                                           histogram,
+                                                           levels,
+                                                           sample_to_bin_op,
+                                                           stream,
+                                                           debug_synchronous,
+                                                           decay);
+    if(query_result != hipSuccess)
+    {
+        return query_result;
+    }
+
+    unsigned int* lut;
+    scale_type*   lut_scale;
+    void*         histogram_storage;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&lut, lut_size),
+            detail::temp_storage::ptr_aligned_array(&lut_scale, 2 * ActiveChannels),
+            detail::temp_storage::make_partition(&histogram_storage, histogram_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    unsigned int* luts[ActiveChannels];
+    scale_type*   lut_scales[ActiveChannels];
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        luts[channel]       = lut + size_t(lut_buckets + 1) * channel;
+        lut_scales[channel] = lut_scale + 2 * channel;
+
+        sample_to_bin_op[channel].lut       = luts[channel];
+        sample_to_bin_op[channel].lut_scale = lut_scales[channel];
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(
+            histogram_range_lut_kernel<ActiveChannels, typename std::remove_cv<Level>::type>),
+        dim3(::rocprim::detail::ceiling_div(lut_buckets + 1, histogram_range_lut_block_size),
+             ActiveChannels),
+        dim3(histogram_range_lut_block_size),
+        0,
+        stream,
+        fixed_array<op_type, ActiveChannels>(sample_to_bin_op),
+        fixed_array<unsigned int*, ActiveChannels>(luts),
+        fixed_array<scale_type*, ActiveChannels>(lut_scales));
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_range_lut",
+                                                (lut_buckets + 1) * ActiveChannels,
+                                                start);
+
+    return histogram_impl<Channels, ActiveChannels, Config>(histogram_storage,
+                                                            histogram_storage_size,
+                                                            samples,
+                                                            columns,
+                                                            rows,
+                                                            row_stride_bytes,
+                                                            histogram,
+                                                            levels,
+                                                            sample_to_bin_op,
+                                                            stream,
+                                                            debug_synchronous,
+                                                            decay);
+}
+
+// Histograms with many bins and arithmetic levels find the bins of samples with a lookup table
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config,
+         class SampleIterator,
+         class Counter,
+         class Level>
+inline hipError_t histogram_range_impl(void*          temporary_storage,
+                                       size_t&        storage_size,
+                                       SampleIterator samples,
+                                       unsigned int   columns,
+                                       unsigned int   rows,
+                                       size_t         row_stride_bytes,
+                                       Counter*       histogram[ActiveChannels],
+                                       unsigned int   levels[ActiveChannels],
+                                       Level*         level_values[ActiveChannels],
+                                       hipStream_t    stream,
+                                       bool           debug_synchronous,
+                                       double         decay = 0.0)
+{
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        if(levels[channel] < 2)
+        {
+            // Histogram must have at least 1 bin
+            return hipErrorInvalidValue;
+        }
+    }
+
+    using arithmetic_levels
+        = std::integral_constant<bool,
+                                 std::is_arithmetic<typename std::remove_cv<Level>::type>::value>;
+
+    return histogram_range_lut_impl<Channels, ActiveChannels, Config>(arithmetic_levels{},
+                                                                      temporary_storage,
+                                                                      storage_size,
+                                                                      samples,
+                                                                      columns,
+                                                                      rows,
+                                                                      row_stride_bytes,
+                                                                      histogram,
+                                                                      levels,
+                                                                      level_values,
+                                                                      stream,
+                                                                      debug_synchronous,
+                                                                      decay);
+}
+
+template<unsigned int Dimensions, class SampleToBinOp>
+inline hipError_t histogram_joint_total_bins(histogram_joint_bins<Dimensions, SampleToBinOp>& joint,
+                                             const unsigned int levels[Dimensions])
+{
+    unsigned long long total_bins = 1;
+    for(unsigned int dimension = 0; dimension < Dimensions; dimension++)
+    {
+        if(levels[dimension] < 2)
+        {
+            // Histogram must have at least 1 bin
+            return hipErrorInvalidValue;
+        }
+        total_bins *= levels[dimension] - 1;
+        if(total_bins >= std::numeric_limits<unsigned int>::max())
+        {
+            // The flattened bins and their number of levels must fit in unsigned int
+            return hipErrorInvalidValue;
+        }
+    }
+    joint.total_bins = static_cast<unsigned int>(total_bins);
+    return hipSuccess;
+}
+
+template<unsigned int Dimensions, class Level>
+inline hipError_t
+    histogram_joint_even_bins(histogram_joint_bins<Dimensions, sample_to_bin_even<Level>>& joint,
+                              const unsigned int levels[Dimensions],
+                              const Level        lower_level[Dimensions],
+                              const Level        upper_level[Dimensions])
+{
+    ROCPRIM_RETURN_ON_ERROR(histogram_joint_total_bins(joint, levels));
+    for(unsigned int dimension = 0; dimension < Dimensions; dimension++)
+    {
+        joint.ops[dimension] = sample_to_bin_even<Level>(levels[dimension] - 1,
+                                                         lower_level[dimension],
+                                                         upper_level[dimension]);
+    }
+    return hipSuccess;
+}
+
+template<unsigned int Dimensions, class Level>
+inline hipError_t
+    histogram_joint_range_bins(histogram_joint_bins<Dimensions, sample_to_bin_range<Level>>& joint,
+                               const unsigned int levels[Dimensions],
+                               Level* const       level_values[Dimensions])
+{
+    ROCPRIM_RETURN_ON_ERROR(histogram_joint_total_bins(joint, levels));
+    for(unsigned int dimension = 0; dimension < Dimensions; dimension++)
+    {
+        joint.ops[dimension]
+            = sample_to_bin_range<Level>(levels[dimension] - 1, level_values[dimension]);
+    }
+    return hipSuccess;
+}
+
+// Joint histograms are single-channel histograms of the flattened bins of the samples, so they
+// are computed by the shared, tiled or global paths of histogram_impl depending on total_bins
+template<class Config, class BinOp, class Counter>
+inline hipError_t histogram_joint_impl(void*        temporary_storage,
+                                       size_t&      storage_size,
+                                       BinOp        bin_op,
+                                       unsigned int size,
+                                       Counter*     histogram,
+                                       hipStream_t  stream,
+                                       bool         debug_synchronous)
+{
+    const unsigned int total_bins = bin_op.joint.total_bins;
+    const auto         bins
+        = ::rocprim::make_transform_iterator(::rocprim::make_counting_iterator(0u), bin_op);
+
+    Counter*            histogram_single[1]        = {histogram};
+    unsigned int        levels_single[1]           = {total_bins + 1};
+    sample_to_bin_joint sample_to_bin_op_single[1] = {sample_to_bin_joint{total_bins}};
+
+    return histogram_impl<1, 1, Config>(temporary_storage,
+                                        storage_size,
+                                        bins,
+                                        size,
+                                        1,
+                                        0,
+                                        histogram_single,
+                                        levels_single,
+                                        sample_to_bin_op_single,
+                                        stream,
+                                        debug_synchronous);
+}
+
+// Sorted samples need no atomics: the bins are differences of the positions of the bin boundaries
+template<class SampleIterator, class Counter, class SampleToBinOp>
+inline hipError_t histogram_sorted_impl(void*          temporary_storage,
+                                        size_t&        storage_size,
+                                        SampleIterator samples,
+                                        unsigned int   size,
+                                        Counter*       histogram,
+                                        SampleToBinOp  sample_to_bin_op,
+                                        hipStream_t    stream,
+                                        bool           debug_synchronous)
+{
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, because
+        // hipMalloc will return nullptr when size is zero.
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    const unsigned int bins = sample_to_bin_op.bins;
+
+    std::chrono::steady_clock::time_point start;
+    if(size < bins)
+    {
+        // Searching every bin would cost more than walking the runs of samples
+        ROCPRIM_RETURN_ON_ERROR(hipMemsetAsync(histogram, 0, sizeof(Counter) * bins, stream));
+        if(size == 0)
+        {
+            return hipSuccess;
+        }
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(histogram_sorted_walk_kernel<SampleIterator, Counter, SampleToBinOp>),
+            dim3(::rocprim::detail::ceiling_div(size, histogram_sorted_block_size)),
+            dim3(histogram_sorted_block_size),
+            0,
+            stream,
+            samples,
+            size,
+            histogram,
+            sample_to_bin_op);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_sorted_walk", size, start);
+        return hipSuccess;
+    }
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(histogram_sorted_search_kernel<SampleIterator, Counter, SampleToBinOp>),
+        dim3(::rocprim::detail::ceiling_div(bins, histogram_sorted_block_size)),
+        dim3(histogram_sorted_block_size),
+        0,
+        stream,
+        samples,
+        size,
+        histogram,
+        sample_to_bin_op);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_sorted_search", bins, start);
+    return hipSuccess;
+}
+
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config,
+         class Accumulator,
+         class SampleIterator,
+         class WeightIterator,
+         class Output,
+         class SampleToBinOp>
+inline hipError_t histogram_weighted_config_impl(void*          temporary_storage,
+                                                 size_t&        storage_size,
+                                                 SampleIterator samples,
+                                                 WeightIterator weights,
+                                                 unsigned int   size,
+                                                 Output*        histogram[ActiveChannels],
+                                                 unsigned int   levels[ActiveChannels],
+                                                 SampleToBinOp  sample_to_bin_op[ActiveChannels],
+                                                 bool           fixed_point,
+                                                 hipStream_t    stream,
+                                                 bool           debug_synchronous,
+                                                 double         decay = 0.0)
+{
+    using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
+    using weight_type = typename std::iterator_traits<WeightIterator>::value_type;
+
+    using config = wrapped_histogram_config<Config, sample_type, Channels, ActiveChannels>;
+
+    detail::target_arch target_arch;
+    hipError_t          result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const histogram_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size       = params.histogram_config.block_size;
+    const unsigned int items_per_thread = params.histogram_config.items_per_thread;
+    const unsigned int items_per_block  = block_size * items_per_thread;
+    const unsigned int blocks = ::rocprim::detail::ceiling_div(size, items_per_block);
+
+    unsigned int bins[ActiveChannels];
+    unsigned int total_bins = 0;
+    unsigned int max_bins   = 0;
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        bins[channel] = levels[channel] - 1;
+        total_bins += bins[channel];
+        max_bins = std::max(max_bins, bins[channel]);
+    }
+
+    // Bin totals are accumulated in temporary storage and converted to Output at the end
+    Accumulator*        totals_start;
+    unsigned long long* max_abs_weight_bits;
+    result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&totals_start, total_bins),
+            detail::temp_storage::ptr_aligned_array(&max_abs_weight_bits, 1)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    Accumulator*       totals[ActiveChannels];
+    const Accumulator* const_totals[ActiveChannels];
+    for(unsigned int channel = 0, offset = 0; channel < ActiveChannels; channel++)
+    {
+        totals[channel]       = totals_start + offset;
+        const_totals[channel] = totals[channel];
+        offset += bins[channel];
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "size " << size << '\n';
+        std::cout << "blocks " << blocks << '\n';
+        hipError_t error = hipStreamSynchronize(stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(
+        hipMemsetAsync(totals_start, 0, total_bins * sizeof(Accumulator), stream));
+    ROCPRIM_RETURN_ON_ERROR(
+        hipMemsetAsync(max_abs_weight_bits, 0, sizeof(unsigned long long), stream));
+
+    // The scale of fixed-point weights depends on the maximum magnitude of weights
+    const unsigned long long* scale_bits = fixed_point ? max_abs_weight_bits : nullptr;
+
+    std::chrono::steady_clock::time_point start;
+
+    if(size > 0 && fixed_point)
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(histogram_weight_max_kernel<config>),
+                           dim3(blocks),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           weights,
+                           size,
+                           max_abs_weight_bits);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_weight_max", size, start);
+    }
+
+    const size_t block_histogram_bytes = total_bins * sizeof(Accumulator);
+    if(size > 0 && block_histogram_bytes <= params.shared_impl_max_bins * sizeof(unsigned int))
+    {
+        auto kernel = HIP_KERNEL_NAME(histogram_weighted_shared_kernel<config,
+                                                                       Channels,
+                                                                       ActiveChannels,
+                                                                       SampleIterator,
+                                                                       WeightIterator,
+                                                                       Accumulator,
+                                                                       SampleToBinOp>);
+
+        unsigned int chosen_shared_histograms;
+        unsigned int chosen_grid_size;
+        ROCPRIM_RETURN_ON_ERROR(histogram_shared_occupancy(kernel,
+                                                           params,
+                                                           block_histogram_bytes,
+                                                           stream,
+                                                           chosen_shared_histograms,
+                                                           chosen_grid_size));
+        const unsigned int grid_size = std::min(chosen_grid_size, blocks);
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hipLaunchKernelGGL(kernel,
+                           dim3(grid_size),
+                           dim3(block_size),
+                           chosen_shared_histograms * block_histogram_bytes,
+                           stream,
+                           samples,
+                           weights,
+                           size,
+                           chosen_shared_histograms,
+                           fixed_array<Accumulator*, ActiveChannels>(totals),
+                           fixed_array<SampleToBinOp, ActiveChannels>(sample_to_bin_op),
+                           fixed_array<unsigned int, ActiveChannels>(bins),
+                           scale_bits);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_weighted_shared",
+                                                    grid_size * block_size,
+                                                    start);
+    }
+    else if(size > 0)
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(histogram_weighted_global_kernel<config, Channels, ActiveChannels>),
+            dim3(blocks),
+            dim3(block_size),
+            0,
+            stream,
+            samples,
+            weights,
+            size,
+            fixed_array<Accumulator*, ActiveChannels>(totals),
+            fixed_array<SampleToBinOp, ActiveChannels>(sample_to_bin_op),
+            scale_bits);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_weighted_global",
+                                                    blocks * block_size,
+                                                    start);
+    }
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(histogram_weighted_output_kernel<config, ActiveChannels, weight_type>),
+        dim3(::rocprim::detail::ceiling_div(max_bins, block_size)),
+        dim3(block_size),
+        0,
+        stream,
+        fixed_array<const Accumulator*, ActiveChannels>(const_totals),
+        fixed_array<Output*, ActiveChannels>(histogram),
+        fixed_array<unsigned int, ActiveChannels>(bins),
+        size,
+        scale_bits,
+        decay);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("histogram_weighted_output", max_bins, start);
+
+    return hipSuccess;
+}
+
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config,
+         class SampleIterator,
+         class WeightIterator,
+         class Output,
+         class SampleToBinOp>
+inline hipError_t histogram_weighted_impl(void*          temporary_storage,
+                                          size_t&        storage_size,
+                                          SampleIterator samples,
+                                          WeightIterator weights,
+                                          unsigned int   size,
+                                          Output*        histogram[ActiveChannels],
+                                          unsigned int   levels[ActiveChannels],
+                                          SampleToBinOp  sample_to_bin_op[ActiveChannels],
+                                          bool           deterministic,
+                                          hipStream_t    stream,
+                                          bool           debug_synchronous,
+                                          double         decay = 0.0)
+{
+    using sample_type = typename std::iterator_traits<SampleIterator>::value_type;
+    using weight_type = typename std::iterator_traits<WeightIterator>::value_type;
+
+    return dispatch_tuned_config<Config, sample_type, weight_type>(
+        "histogram",
+        size,
+        stream,
+        [&](auto config)
+        {
+            using config_type = typename decltype(config)::type;
+            if(deterministic)
+            {
+                // Floating-point weights are accumulated as fixed-point numbers
+                return histogram_weighted_config_impl<
+                    Channels,
+                    ActiveChannels,
+                    config_type,
+                    histogram_weight_accumulator_t<weight_type, true>>(
+                    temporary_storage,
+                    storage_size,
+                    samples,
+                    weights,
+                    size,
+                    histogram,
+                    levels,
+                    sample_to_bin_op,
+                    ::rocprim::is_floating_point<weight_type>::value,
+                    stream,
+                    debug_synchronous,
+                    decay);
+            }
+            return histogram_weighted_config_impl<
+                Channels,
+                ActiveChannels,
+                config_type,
+                histogram_weight_accumulator_t<weight_type, false>>(temporary_storage,
+                                                                    storage_size,
+                                                                    samples,
+                                                                    weights,
+                                                                    size,
+                                                                    histogram,
+                                                                    levels,
+                                                                    sample_to_bin_op,
+                                                                    false,
+                                                                    stream,
+                                                                    debug_synchronous,
+                                                                    decay);
+        });
+}
+
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config,
+         class SampleIterator,
+         class WeightIterator,
+         class Output,
+         class Level>
+inline hipError_t histogram_even_weighted_impl(void*          temporary_storage,
+                                               size_t&        storage_size,
+                                               SampleIterator samples,
+                                               WeightIterator weights,
+                                               unsigned int   size,
+                                               Output*        histogram[ActiveChannels],
+                                               unsigned int   levels[ActiveChannels],
+                                               Level          lower_level[ActiveChannels],
+                                               Level          upper_level[ActiveChannels],
+                                               bool           deterministic,
+                                               hipStream_t    stream,
+                                               bool           debug_synchronous,
+                                               double         decay = 0.0)
+{
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        if(levels[channel] < 2)
+        {
+            // Histogram must have at least 1 bin
+            return hipErrorInvalidValue;
+        }
+    }
+
+    sample_to_bin_even<Level> sample_to_bin_op[ActiveChannels];
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        sample_to_bin_op[channel] = sample_to_bin_even<Level>(levels[channel] - 1,
+                                                              lower_level[channel],
+                                                              upper_level[channel]);
+    }
+
+    return histogram_weighted_impl<Channels, ActiveChannels, Config>(temporary_storage,
+                                                                     storage_size,
+                                                                     samples,
+                                                                     weights,
+                                                                     size,
+                                                                     histogram,
+                                                                     levels,
+                                                                     sample_to_bin_op,
+                                                                     deterministic,
+                                                                     stream,
+                                                                     debug_synchronous,
+                                                                     decay);
+}
+
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config,
+         class SampleIterator,
+         class WeightIterator,
+         class Output,
+         class Level>
+inline hipError_t histogram_range_weighted_impl(void*          temporary_storage,
+                                                size_t&        storage_size,
+                                                SampleIterator samples,
+                                                WeightIterator weights,
+                                                unsigned int   size,
+                                                Output*        histogram[ActiveChannels],
+                                                unsigned int   levels[ActiveChannels],
+                                                Level*         level_values[ActiveChannels],
+                                                bool           deterministic,
+                                                hipStream_t    stream,
+                                                bool           debug_synchronous,
+                                                double         decay = 0.0)
+{
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        if(levels[channel] < 2)
+        {
+            // Histogram must have at least 1 bin
+            return hipErrorInvalidValue;
+        }
+    }
+
+    sample_to_bin_range<Level> sample_to_bin_op[ActiveChannels];
+    for(unsigned int channel = 0; channel < ActiveChannels; channel++)
+    {
+        sample_to_bin_op[channel]
+            = sample_to_bin_range<Level>(levels[channel] - 1, level_values[channel]);
+    }
+
+    return histogram_weighted_impl<Channels, ActiveChannels, Config>(temporary_storage,
+                                                                     storage_size,
+                                                                     samples,
+                                                                     weights,
+                                                                     size,
+                                                                     histogram,
+                                                                     levels,
+                                                                     sample_to_bin_op,
+                                                                     deterministic,
+                                                                     stream,
+                                                                     debug_synchronous,
+                                                                     decay);
+}
+
+} // namespace detail
+
+/// \brief Computes a histogram from a sequence of samples using equal-width bins.
+///
+/// \par
+/// * The number of histogram bins is (\p levels - 1).
+/// * Bins are evenly-segmented and include the same width of sample values:
+/// (\p upper_level - \p lower_level) / (\p levels - 1).
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] size - number of elements in the samples range.
+/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level histogram of 5 bins is computed on an array of float samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int size;        // e.g., 8
+/// float * samples;          // e.g., [-10.0, 0.3, 9.5, 8.1, 1.5, 1.9, 100.0, 5.1]
+/// int * histogram;          // empty array of at least 5 elements
+/// unsigned int levels;      // e.g., 6 (for 5 bins)
+/// float lower_level;        // e.g., 0.0
+/// float upper_level;        // e.g., 10.0
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::histogram_even(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, size,
+///     histogram, levels, lower_level, upper_level
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histogram
+/// rocprim::histogram_even(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, size,
+///     histogram, levels, lower_level, upper_level
+/// );
+/// // histogram: [3, 0, 1, 0, 2]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class SampleIterator, class Counter, class Level>
+inline hipError_t histogram_even(void*          temporary_storage,
+                                 size_t&        storage_size,
+                                 SampleIterator samples,
+                                 unsigned int   size,
+                                 Counter*       histogram,
+                                 unsigned int   levels,
+                                 Level          lower_level,
+                                 Level          upper_level,
+                                 hipStream_t    stream            = 0,
+                                 bool           debug_synchronous = false)
+{
+    Counter*     histogram_single[1]   = {histogram};
+    unsigned int levels_single[1]      = {levels};
+    Level        lower_level_single[1] = {lower_level};
+    Level        upper_level_single[1] = {upper_level};
+
+    return detail::histogram_even_impl<1, 1, Config>(temporary_storage,
+                                                     storage_size,
+                                                     samples,
+                                                     size,
+                                                     1,
+                                                     0,
+                                                     histogram_single,
+                                                     levels_single,
+                                                     lower_level_single,
+                                                     upper_level_single,
+                                                     stream,
+                                                     debug_synchronous);
+}
+
+/// \brief Computes a histogram from a two-dimensional region of samples using equal-width bins.
+///
+/// \par
+/// * The two-dimensional region of interest within \p samples can be specified using the \p columns,
+/// \p rows and \p row_stride_bytes parameters.
+/// * The row stride must be a whole multiple of the sample data type size,
+/// i.e., <tt>(row_stride_bytes % sizeof(std::iterator_traits<SampleIterator>::value_type)) == 0</tt>.
+/// * The number of histogram bins is (\p levels - 1).
+/// * Bins are evenly-segmented and include the same width of sample values:
+/// (\p upper_level - \p lower_level) / (\p levels - 1).
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] columns - number of elements in each row of the region.
+/// \param [in] rows - number of rows of the region.
+/// \param [in] row_stride_bytes - number of bytes between starts of consecutive rows of the region.
+/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level histogram of 5 bins is computed on an array of float samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int columns;     // e.g., 4
+/// unsigned int rows;        // e.g., 2
+/// size_t row_stride_bytes;  // e.g., 6 * sizeof(float)
+/// float * samples;          // e.g., [-10.0, 0.3, 9.5, 8.1, -, -, 1.5, 1.9, 100.0, 5.1, -, -]
+/// int * histogram;          // empty array of at least 5 elements
+/// unsigned int levels;      // e.g., 6 (for 5 bins)
+/// float lower_level;        // e.g., 0.0
+/// float upper_level;        // e.g., 10.0
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::histogram_even(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, columns, rows, row_stride_bytes,
+///     histogram, levels, lower_level, upper_level
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histogram
+/// rocprim::histogram_even(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, columns, rows, row_stride_bytes,
+///     histogram, levels, lower_level, upper_level
+/// );
+/// // histogram: [3, 0, 1, 0, 2]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class SampleIterator, class Counter, class Level>
+inline hipError_t histogram_even(void*          temporary_storage,
+                                 size_t&        storage_size,
+                                 SampleIterator samples,
+                                 unsigned int   columns,
+                                 unsigned int   rows,
+                                 size_t         row_stride_bytes,
+                                 Counter*       histogram,
+                                 unsigned int   levels,
+                                 Level          lower_level,
+                                 Level          upper_level,
+                                 hipStream_t    stream            = 0,
+                                 bool           debug_synchronous = false)
+{
+    Counter*     histogram_single[1]   = {histogram};
+    unsigned int levels_single[1]      = {levels};
+    Level        lower_level_single[1] = {lower_level};
+    Level        upper_level_single[1] = {upper_level};
+
+    return detail::histogram_even_impl<1, 1, Config>(temporary_storage,
+                                                     storage_size,
+                                                     samples,
+                                                     columns,
+                                                     rows,
+                                                     row_stride_bytes,
+                                                     histogram_single,
+                                                     levels_single,
+                                                     lower_level_single,
+                                                     upper_level_single,
+                                                     stream,
+                                                     debug_synchronous);
+}
+
+/// \brief Computes histograms from a sequence of multi-channel samples using equal-width bins.
+///
+/// \par
+/// * The input is a sequence of <em>pixel</em> structures, where each pixel comprises
+/// a record of \p Channels consecutive data samples (e.g., \p Channels = 4 for <em>RGBA</em> samples).
+/// * The first \p ActiveChannels channels of total \p Channels channels will be used for computing histograms
+/// (e.g., \p ActiveChannels = 3 for computing histograms of only <em>RGB</em> from <em>RGBA</em> samples).
+/// * For channel<sub><em>i</em></sub> the number of histogram bins is (\p levels[i] - 1).
+/// * For channel<sub><em>i</em></sub> bins are evenly-segmented and include the same width of sample values:
+/// (\p upper_level[i] - \p lower_level[i]) / (\p levels[i] - 1).
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Channels - number of channels interleaved in the input samples.
+/// \tparam ActiveChannels - number of channels being used for computing histograms.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] size - number of pixels in the samples range.
+/// \param [out] histogram - pointers to the first element in the histogram range, one for each active channel.
+/// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin in each active channel.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin in each active channel.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Notes
+/// * Currently the \p Channels template parameter has no strict restriction on its value. However,
+///   internally a vector type of elements of type \p SampleIterator and length \p Channels is used
+///   to represent the input items, so the amount of local memory available will limit the range of
+///   possible values for this template parameter.
+/// * \p ActiveChannels must be less or equal than \p Channels.
+///
+/// \par Example
+/// \parblock
+/// In this example histograms for 3 channels (RGB) are computed on an array of 8-bit RGBA samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int size;        // e.g., 8
+/// unsigned char * samples;  // e.g., [(3, 1, 5, 255), (3, 1, 5, 255), (4, 2, 6, 127), (3, 2, 6, 127),
+///                           //        (0, 0, 0, 100), (0, 1, 0, 100), (0, 0, 1, 255), (0, 1, 1, 255)]
+/// int * histogram[3];       // 3 empty arrays of at least 256 elements each
+/// unsigned int levels[3];   // e.g., [257, 257, 257] (for 256 bins)
+/// int lower_level[3];       // e.g., [0, 0, 0]
+/// int upper_level[3];       // e.g., [256, 256, 256]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::multi_histogram_even<4, 3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, size,
+///     histogram, levels, lower_level, upper_level
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histograms
+/// rocprim::multi_histogram_even<4, 3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, size,
+///     histogram, levels, lower_level, upper_level
+/// );
+/// // histogram: [[4, 0, 0, 3, 1, 0, 0, ..., 0],
+/// //             [2, 4, 2, 0, 0, 0, 0, ..., 0],
+/// //             [2, 2, 0, 0, 0, 2, 2, ..., 0]]
+/// \endcode
+/// \endparblock
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config = default_config,
+         class SampleIterator,
+         class Counter,
+         class Level>
+inline hipError_t multi_histogram_even(void*          temporary_storage,
+                                       size_t&        storage_size,
+                                       SampleIterator samples,
+                                       unsigned int   size,
+                                       Counter*       histogram[ActiveChannels],
+                                       unsigned int   levels[ActiveChannels],
+                                       Level          lower_level[ActiveChannels],
+                                       Level          upper_level[ActiveChannels],
+                                       hipStream_t    stream            = 0,
+                                       bool           debug_synchronous = false)
+{
+    return detail::histogram_even_impl<Channels, ActiveChannels, Config>(temporary_storage,
+                                                                         storage_size,
+                                                                         samples,
+                                                                         size,
+                                                                         1,
+                                                                         0,
+                                                                         histogram,
+                                                                         levels,
+                                                                         lower_level,
+                                                                         upper_level,
+                                                                         stream,
+                                                                         debug_synchronous);
+}
+
+/// \brief Computes histograms from a two-dimensional region of multi-channel samples using equal-width bins.
+///
+/// \par
+/// * The two-dimensional region of interest within \p samples can be specified using the \p columns,
+/// \p rows and \p row_stride_bytes parameters.
+/// * The row stride must be a whole multiple of the sample data type size,
+/// i.e., <tt>(row_stride_bytes % sizeof(std::iterator_traits<SampleIterator>::value_type)) == 0</tt>.
+/// * The input is a sequence of <em>pixel</em> structures, where each pixel comprises
+/// a record of \p Channels consecutive data samples (e.g., \p Channels = 4 for <em>RGBA</em> samples).
+/// * The first \p ActiveChannels channels of total \p Channels channels will be used for computing histograms
+/// (e.g., \p ActiveChannels = 3 for computing histograms of only <em>RGB</em> from <em>RGBA</em> samples).
+/// * For channel<sub><em>i</em></sub> the number of histogram bins is (\p levels[i] - 1).
+/// * For channel<sub><em>i</em></sub> bins are evenly-segmented and include the same width of sample values:
+/// (\p upper_level[i] - \p lower_level[i]) / (\p levels[i] - 1).
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Channels - number of channels interleaved in the input samples.
+/// \tparam ActiveChannels - number of channels being used for computing histograms.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] columns - number of elements in each row of the region.
+/// \param [in] rows - number of rows of the region.
+/// \param [in] row_stride_bytes - number of bytes between starts of consecutive rows of the region.
+/// \param [out] histogram - pointers to the first element in the histogram range, one for each active channel.
+/// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin in each active channel.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin in each active channel.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Notes
+/// * Currently the \p Channels template parameter has no strict restriction on its value. However,
+///   internally a vector type of elements of type \p SampleIterator and length \p Channels is used
+///   to represent the input items, so the amount of local memory available will limit the range of
+///   possible values for this template parameter.
+/// * \p ActiveChannels must be less or equal than \p Channels.
+///
+/// \par Example
+/// \parblock
+/// In this example histograms for 3 channels (RGB) are computed on an array of 8-bit RGBA samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int columns;     // e.g., 4
+/// unsigned int rows;        // e.g., 2
+/// size_t row_stride_bytes;  // e.g., 5 * sizeof(unsigned char)
+/// unsigned char * samples;  // e.g., [(3, 1, 5, 255), (3, 1, 5, 255), (4, 2, 6, 127), (3, 2, 6, 127), (-, -, -, -),
+///                           //        (0, 0, 0, 100), (0, 1, 0, 100), (0, 0, 1, 255), (0, 1, 1, 255), (-, -, -, -)]
+/// int * histogram[3];       // 3 empty arrays of at least 256 elements each
+/// unsigned int levels[3];   // e.g., [257, 257, 257] (for 256 bins)
+/// int lower_level[3];       // e.g., [0, 0, 0]
+/// int upper_level[3];       // e.g., [256, 256, 256]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::multi_histogram_even<4, 3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, columns, rows, row_stride_bytes,
+///     histogram, levels, lower_level, upper_level
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histograms
+/// rocprim::multi_histogram_even<4, 3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, columns, rows, row_stride_bytes,
+///     histogram, levels, lower_level, upper_level
+/// );
+/// // histogram: [[4, 0, 0, 3, 1, 0, 0, ..., 0],
+/// //             [2, 4, 2, 0, 0, 0, 0, ..., 0],
+/// //             [2, 2, 0, 0, 0, 2, 2, ..., 0]]
+/// \endcode
+/// \endparblock
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config = default_config,
+         class SampleIterator,
+         class Counter,
+         class Level>
+inline hipError_t multi_histogram_even(void*          temporary_storage,
+                                       size_t&        storage_size,
+                                       SampleIterator samples,
+                                       unsigned int   columns,
+                                       unsigned int   rows,
+                                       size_t         row_stride_bytes,
+                                       Counter*       histogram[ActiveChannels],
+                                       unsigned int   levels[ActiveChannels],
+                                       Level          lower_level[ActiveChannels],
+                                       Level          upper_level[ActiveChannels],
+                                       hipStream_t    stream            = 0,
+                                       bool           debug_synchronous = false)
+{
+    return detail::histogram_even_impl<Channels, ActiveChannels, Config>(temporary_storage,
+                                                                         storage_size,
+                                                                         samples,
+                                                                         columns,
+                                                                         rows,
+                                                                         row_stride_bytes,
+                                                                         histogram,
+                                                                         levels,
+                                                                         lower_level,
+                                                                         upper_level,
+                                                                         stream,
+                                                                         debug_synchronous);
+}
+
+/// \brief Computes a histogram from a sequence of samples using the specified bin boundary levels.
+///
+/// \par
+/// * The number of histogram bins is (\p levels - 1).
+/// * The range for bin<sub><em>j</em></sub> is [<tt>level_values[j]</tt>, <tt>level_values[j+1]</tt>).
+/// * With at least 64 bins and levels of an arithmetic type, a lookup table of the levels is
+/// built in \p temporary_storage first, so most samples compare with one or two levels only.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] size - number of elements in the samples range.
+/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] level_values - pointer to the array of bin boundaries.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level histogram of 5 bins is computed on an array of float samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int size;        // e.g., 8
+/// float * samples;          // e.g., [-10.0, 0.3, 9.5, 8.1, 1.5, 1.9, 100.0, 5.1]
+/// int * histogram;          // empty array of at least 5 elements
+/// unsigned int levels;      // e.g., 6 (for 5 bins)
+/// float * level_values;     // e.g., [0.0, 1.0, 5.0, 10.0, 20.0, 50.0]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::histogram_range(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, size,
+///     histogram, levels, level_values
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histogram
+/// rocprim::histogram_range(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, size,
+///     histogram, levels, level_values
+/// );
+/// // histogram: [1, 2, 3, 0, 0]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class SampleIterator, class Counter, class Level>
+inline hipError_t histogram_range(void*          temporary_storage,
+                                  size_t&        storage_size,
+                                  SampleIterator samples,
+                                  unsigned int   size,
+                                  Counter*       histogram,
+                                  unsigned int   levels,
+                                  Level*         level_values,
+                                  hipStream_t    stream            = 0,
+                                  bool           debug_synchronous = false)
+{
+    Counter*     histogram_single[1]    = {histogram};
+    unsigned int levels_single[1]       = {levels};
+    Level*       level_values_single[1] = {level_values};
+
+    return detail::histogram_range_impl<1, 1, Config>(temporary_storage,
+                                                      storage_size,
+                                                      samples,
+                                                      size,
+                                                      1,
+                                                      0,
+                                                      histogram_single,
+                                                      levels_single,
+                                                      level_values_single,
+                                                      stream,
+                                                      debug_synchronous);
+}
+
+/// \brief Computes a histogram from a two-dimensional region of samples using the specified bin boundary levels.
 ///
 /// \par
+/// * The two-dimensional region of interest within \p samples can be specified using the \p columns,
+/// \p rows and \p row_stride_bytes parameters.
+/// * The row stride must be a whole multiple of the sample data type size,
+/// i.e., <tt>(row_stride_bytes % sizeof(std::iterator_traits<SampleIterator>::value_type)) == 0</tt>.
 /// * The number of histogram bins is (\p levels - 1).
-/// * Bins are evenly-segmented and include the same width of sample values:
-/// (\p upper_level - \p lower_level) / (\p levels - 1).
+/// * The range for bin<sub><em>j</em></sub> is [<tt>level_values[j]</tt>, <tt>level_values[j+1]</tt>).
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `histogram_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
 /// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam Counter - integer type for histogram bin counters.
@@ -444,11 +2124,12 @@ inline hipError_t histogram_range_impl(void*          temporary_storage,
 /// \p storage_size and function returns without performing the reduction operation.
 /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
 /// \param [in] samples - iterator to the first element in the range of input samples.
-/// \param [in] size - number of elements in the samples range.
+/// \param [in] columns - number of elements in each row of the region.
+/// \param [in] rows - number of rows of the region.
+/// \param [in] row_stride_bytes - number of bytes between starts of consecutive rows of the region.
 /// \param [out] histogram - pointer to the first element in the histogram range.
 /// \param [in] levels - number of boundaries (levels) for histogram bins.
-/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin.
-/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin.
+/// \param [in] level_values - pointer to the array of bin boundaries.
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
@@ -464,82 +2145,320 @@ inline hipError_t histogram_range_impl(void*          temporary_storage,
 /// #include <rocprim/rocprim.hpp>
 ///
 /// // Prepare input and output (declare pointers, allocate device memory etc.)
-/// unsigned int size;        // e.g., 8
+/// unsigned int columns;     // e.g., 4
+/// unsigned int rows;        // e.g., 2
+/// size_t row_stride_bytes;  // e.g., 6 * sizeof(float)
 /// float * samples;          // e.g., [-10.0, 0.3, 9.5, 8.1, 1.5, 1.9, 100.0, 5.1]
 /// int * histogram;          // empty array of at least 5 elements
 /// unsigned int levels;      // e.g., 6 (for 5 bins)
-/// float lower_level;        // e.g., 0.0
-/// float upper_level;        // e.g., 10.0
+/// float level_values;       // e.g., [0.0, 1.0, 5.0, 10.0, 20.0, 50.0]
 ///
 /// size_t temporary_storage_size_bytes;
 /// void * temporary_storage_ptr = nullptr;
 /// // Get required size of the temporary storage
-/// rocprim::histogram_even(
+/// rocprim::histogram_range(
 ///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, size,
-///     histogram, levels, lower_level, upper_level
+///     samples, columns, rows, row_stride_bytes,
+///     histogram, levels, level_values
 /// );
 ///
 /// // allocate temporary storage
 /// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
 ///
 /// // compute histogram
-/// rocprim::histogram_even(
+/// rocprim::histogram_range(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, columns, rows, row_stride_bytes,
+///     histogram, levels, level_values
+/// );
+/// // histogram: [1, 2, 3, 0, 0]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class SampleIterator, class Counter, class Level>
+inline hipError_t histogram_range(void*          temporary_storage,
+                                  size_t&        storage_size,
+                                  SampleIterator samples,
+                                  unsigned int   columns,
+                                  unsigned int   rows,
+                                  size_t         row_stride_bytes,
+                                  Counter*       histogram,
+                                  unsigned int   levels,
+                                  Level*         level_values,
+                                  hipStream_t    stream            = 0,
+                                  bool           debug_synchronous = false)
+{
+    Counter*     histogram_single[1]    = {histogram};
+    unsigned int levels_single[1]       = {levels};
+    Level*       level_values_single[1] = {level_values};
+
+    return detail::histogram_range_impl<1, 1, Config>(temporary_storage,
+                                                      storage_size,
+                                                      samples,
+                                                      columns,
+                                                      rows,
+                                                      row_stride_bytes,
+                                                      histogram_single,
+                                                      levels_single,
+                                                      level_values_single,
+                                                      stream,
+                                                      debug_synchronous);
+}
+
+/// \brief Computes histograms from a sequence of multi-channel samples using the specified bin boundary levels.
+///
+/// \par
+/// * The input is a sequence of <em>pixel</em> structures, where each pixel comprises
+/// a record of \p Channels consecutive data samples (e.g., \p Channels = 4 for <em>RGBA</em> samples).
+/// * The first \p ActiveChannels channels of total \p Channels channels will be used for computing histograms
+/// (e.g., \p ActiveChannels = 3 for computing histograms of only <em>RGB</em> from <em>RGBA</em> samples).
+/// * For channel<sub><em>i</em></sub> the number of histogram bins is (\p levels[i] - 1).
+/// * For channel<sub><em>i</em></sub> the range for bin<sub><em>j</em></sub> is
+/// [<tt>level_values[i][j]</tt>, <tt>level_values[i][j+1]</tt>).
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Channels - number of channels interleaved in the input samples.
+/// \tparam ActiveChannels - number of channels being used for computing histograms.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] size - number of pixels in the samples range.
+/// \param [out] histogram - pointers to the first element in the histogram range, one for each active channel.
+/// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
+/// \param [in] level_values - pointer to the array of bin boundaries for each active channel.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Notes
+/// * Currently the \p Channels template parameter has no strict restriction on its value. However,
+///   internally a vector type of elements of type \p SampleIterator and length \p Channels is used
+///   to represent the input items, so the amount of local memory available will limit the range of
+///   possible values for this template parameter.
+/// * \p ActiveChannels must be less or equal than \p Channels.
+///
+/// \par Example
+/// \parblock
+/// In this example histograms for 3 channels (RGB) are computed on an array of 8-bit RGBA samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int size;        // e.g., 8
+/// unsigned char * samples;  // e.g., [(0, 0, 80, 255), (120, 0, 80, 255), (123, 0, 82, 127), (10, 1, 83, 127),
+///                           //        (51, 1, 8, 100), (52, 1, 8, 100), (53, 0, 81, 255), (54, 50, 81, 255)]
+/// int * histogram[3];       // 3 empty arrays of at least 256 elements each
+/// unsigned int levels[3];   // e.g., [4, 4, 3]
+/// int * level_values[3];    // e.g., [[0, 50, 100, 200], [0, 20, 40, 60], [0, 10, 100]]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::multi_histogram_range<4, 3>(
 ///     temporary_storage_ptr, temporary_storage_size_bytes,
 ///     samples, size,
-///     histogram, levels, lower_level, upper_level
+///     histogram, levels, level_values
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histograms
+/// rocprim::multi_histogram_range<4, 3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, size,
+///     histogram, levels, level_values
+/// );
+/// // histogram: [[2, 4, 2], [7, 0, 1], [2, 6]]
+/// \endcode
+/// \endparblock
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config = default_config,
+         class SampleIterator,
+         class Counter,
+         class Level>
+inline hipError_t multi_histogram_range(void*          temporary_storage,
+                                        size_t&        storage_size,
+                                        SampleIterator samples,
+                                        unsigned int   size,
+                                        Counter*       histogram[ActiveChannels],
+                                        unsigned int   levels[ActiveChannels],
+                                        Level*         level_values[ActiveChannels],
+                                        hipStream_t    stream            = 0,
+                                        bool           debug_synchronous = false)
+{
+    return detail::histogram_range_impl<Channels, ActiveChannels, Config>(temporary_storage,
+                                                                          storage_size,
+                                                                          samples,
+                                                                          size,
+                                                                          1,
+                                                                          0,
+                                                                          histogram,
+                                                                          levels,
+                                                                          level_values,
+                                                                          stream,
+                                                                          debug_synchronous);
+}
+
+/// \brief Computes histograms from a two-dimensional region of multi-channel samples using the specified bin
+/// boundary levels.
+///
+/// \par
+/// * The two-dimensional region of interest within \p samples can be specified using the \p columns,
+/// \p rows and \p row_stride_bytes parameters.
+/// * The row stride must be a whole multiple of the sample data type size,
+/// i.e., <tt>(row_stride_bytes % sizeof(std::iterator_traits<SampleIterator>::value_type)) == 0</tt>.
+/// * The input is a sequence of <em>pixel</em> structures, where each pixel comprises
+/// a record of \p Channels consecutive data samples (e.g., \p Channels = 4 for <em>RGBA</em> samples).
+/// * The first \p ActiveChannels channels of total \p Channels channels will be used for computing histograms
+/// (e.g., \p ActiveChannels = 3 for computing histograms of only <em>RGB</em> from <em>RGBA</em> samples).
+/// * For channel<sub><em>i</em></sub> the number of histogram bins is (\p levels[i] - 1).
+/// * For channel<sub><em>i</em></sub> the range for bin<sub><em>j</em></sub> is
+/// [<tt>level_values[i][j]</tt>, <tt>level_values[i][j+1]</tt>).
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Channels - number of channels interleaved in the input samples.
+/// \tparam ActiveChannels - number of channels being used for computing histograms.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] columns - number of elements in each row of the region.
+/// \param [in] rows - number of rows of the region.
+/// \param [in] row_stride_bytes - number of bytes between starts of consecutive rows of the region.
+/// \param [out] histogram - pointers to the first element in the histogram range, one for each active channel.
+/// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
+/// \param [in] level_values - pointer to the array of bin boundaries for each active channel.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Notes
+/// * Currently the \p Channels template parameter has no strict restriction on its value. However,
+///   internally a vector type of elements of type \p SampleIterator and length \p Channels is used
+///   to represent the input items, so the amount of local memory available will limit the range of
+///   possible values for this template parameter.
+/// * \p ActiveChannels must be less or equal than \p Channels.
+///
+/// \par Example
+/// \parblock
+/// In this example histograms for 3 channels (RGB) are computed on an array of 8-bit RGBA samples.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int columns;     // e.g., 4
+/// unsigned int rows;        // e.g., 2
+/// size_t row_stride_bytes;  // e.g., 5 * sizeof(unsigned char)
+/// unsigned char * samples;  // e.g., [(0, 0, 80, 0), (120, 0, 80, 0), (123, 0, 82, 0), (10, 1, 83, 0), (-, -, -, -),
+///                           //        (51, 1, 8, 0), (52, 1, 8, 0), (53, 0, 81, 0), (54, 50, 81, 0), (-, -, -, -)]
+/// int * histogram[3];       // 3 empty arrays
+/// unsigned int levels[3];   // e.g., [4, 4, 3]
+/// int * level_values[3];    // e.g., [[0, 50, 100, 200], [0, 20, 40, 60], [0, 10, 100]]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::multi_histogram_range<4, 3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, columns, rows, row_stride_bytes,
+///     histogram, levels, level_values
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute histograms
+/// rocprim::multi_histogram_range<4, 3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     samples, columns, rows, row_stride_bytes,
+///     histogram, levels, level_values
 /// );
-/// // histogram: [3, 0, 1, 0, 2]
+/// // histogram: [[2, 4, 2], [7, 0, 1], [2, 6]]
 /// \endcode
 /// \endparblock
-template<class Config = default_config, class SampleIterator, class Counter, class Level>
-inline hipError_t histogram_even(void*          temporary_storage,
-                                 size_t&        storage_size,
-                                 SampleIterator samples,
-                                 unsigned int   size,
-                                 Counter*       histogram,
-                                 unsigned int   levels,
-                                 Level          lower_level,
-                                 Level          upper_level,
-                                 hipStream_t    stream            = 0,
-                                 bool           debug_synchronous = false)
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config = default_config,
+         class SampleIterator,
+         class Counter,
+         class Level>
+inline hipError_t multi_histogram_range(void*          temporary_storage,
+                                        size_t&        storage_size,
+                                        SampleIterator samples,
+                                        unsigned int   columns,
+                                        unsigned int   rows,
+                                        size_t         row_stride_bytes,
+                                        Counter*       histogram[ActiveChannels],
+                                        unsigned int   levels[ActiveChannels],
+                                        Level*         level_values[ActiveChannels],
+                                        hipStream_t    stream            = 0,
+                                        bool           debug_synchronous = false)
 {
-    Counter*     histogram_single[1]   = {histogram};
-    unsigned int levels_single[1]      = {levels};
-    Level        lower_level_single[1] = {lower_level};
-    Level        upper_level_single[1] = {upper_level};
-
-    return detail::histogram_even_impl<1, 1, Config>(temporary_storage,
-                                                     storage_size,
-                                                     samples,
-                                                     size,
-                                                     1,
-                                                     0,
-                                                     histogram_single,
-                                                     levels_single,
-                                                     lower_level_single,
-                                                     upper_level_single,
-                                                     stream,
-                                                     debug_synchronous);
+    return detail::histogram_range_impl<Channels, ActiveChannels, Config>(temporary_storage,
+                                                                          storage_size,
+                                                                          samples,
+                                                                          columns,
+                                                                          rows,
+                                                                          row_stride_bytes,
+                                                                          histogram,
+                                                                          levels,
+                                                                          level_values,
+                                                                          stream,
+                                                                          debug_synchronous);
 }
 
-/// \brief Computes a histogram from a two-dimensional region of samples using equal-width bins.
+/// \brief Computes a weighted histogram from a sequence of samples using equal-width bins.
 ///
 /// \par
-/// * The two-dimensional region of interest within \p samples can be specified using the \p columns,
-/// \p rows and \p row_stride_bytes parameters.
-/// * The row stride must be a whole multiple of the sample data type size,
-/// i.e., <tt>(row_stride_bytes % sizeof(std::iterator_traits<SampleIterator>::value_type)) == 0</tt>.
 /// * The number of histogram bins is (\p levels - 1).
 /// * Bins are evenly-segmented and include the same width of sample values:
 /// (\p upper_level - \p lower_level) / (\p levels - 1).
+/// * Each bin receives the sum of the weights of its samples.
+/// * Floating-point weights are accumulated in \p float (for weights of up to 4 bytes) or
+/// \p double, integral weights in 64-bit integers. The totals are converted to \p Output.
+/// * Floating-point totals depend on the order of atomic operations. When \p deterministic is
+/// \p true, floating-point weights are rounded to 64-bit fixed-point numbers with a scale chosen
+/// from the maximum magnitude of weights, so totals are reproducible between runs. Each weight
+/// is then rounded to a multiple of 2<sup>-k</sup>, where k is chosen so that the sum of
+/// \p size weights of the maximum magnitude fits into 63 bits. Weights must be finite.
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `histogram_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
 /// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
-/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam WeightIterator - random-access iterator type of the weights range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Output - type of histogram bins, the totals of weights are converted to it.
 /// \tparam Level - type of histogram boundaries (levels)
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
@@ -547,13 +2466,15 @@ inline hipError_t histogram_even(void*          temporary_storage,
 /// \p storage_size and function returns without performing the reduction operation.
 /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
 /// \param [in] samples - iterator to the first element in the range of input samples.
-/// \param [in] columns - number of elements in each row of the region.
-/// \param [in] rows - number of rows of the region.
-/// \param [in] row_stride_bytes - number of bytes between starts of consecutive rows of the region.
+/// \param [in] weights - iterator to the first element in the range of weights of samples.
+/// \param [in] size - number of elements in the samples and weights ranges.
 /// \param [out] histogram - pointer to the first element in the histogram range.
 /// \param [in] levels - number of boundaries (levels) for histogram bins.
 /// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin.
 /// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin.
+/// \param [in] deterministic - [optional] If true, floating-point weights are accumulated as
+/// fixed-point numbers, so the histogram does not depend on the order of operations.
+/// Default value is \p false.
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
@@ -563,17 +2484,17 @@ inline hipError_t histogram_even(void*          temporary_storage,
 ///
 /// \par Example
 /// \parblock
-/// In this example a device-level histogram of 5 bins is computed on an array of float samples.
+/// In this example a device-level weighted histogram of 5 bins is computed on an array of float
+/// samples.
 ///
 /// \code{.cpp}
 /// #include <rocprim/rocprim.hpp>
 ///
 /// // Prepare input and output (declare pointers, allocate device memory etc.)
-/// unsigned int columns;     // e.g., 4
-/// unsigned int rows;        // e.g., 2
-/// size_t row_stride_bytes;  // e.g., 6 * sizeof(float)
-/// float * samples;          // e.g., [-10.0, 0.3, 9.5, 8.1, -, -, 1.5, 1.9, 100.0, 5.1, -, -]
-/// int * histogram;          // empty array of at least 5 elements
+/// unsigned int size;        // e.g., 8
+/// float * samples;          // e.g., [-10.0, 0.3, 9.5, 8.1, 1.5, 1.9, 100.0, 5.1]
+/// double * weights;         // e.g., [1.0, 0.5, 2.0, 1.0, 0.25, 0.25, 3.0, 1.5]
+/// double * histogram;       // empty array of at least 5 elements
 /// unsigned int levels;      // e.g., 6 (for 5 bins)
 /// float lower_level;        // e.g., 0.0
 /// float upper_level;        // e.g., 10.0
@@ -581,9 +2502,9 @@ inline hipError_t histogram_even(void*          temporary_storage,
 /// size_t temporary_storage_size_bytes;
 /// void * temporary_storage_ptr = nullptr;
 /// // Get required size of the temporary storage
-/// rocprim::histogram_even(
+/// rocprim::histogram_even_weighted(
 ///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, columns, rows, row_stride_bytes,
+///     samples, weights, size,
 ///     histogram, levels, lower_level, upper_level
 /// );
 ///
@@ -591,66 +2512,76 @@ inline hipError_t histogram_even(void*          temporary_storage,
 /// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
 ///
 /// // compute histogram
-/// rocprim::histogram_even(
+/// rocprim::histogram_even_weighted(
 ///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, columns, rows, row_stride_bytes,
+///     samples, weights, size,
 ///     histogram, levels, lower_level, upper_level
 /// );
-/// // histogram: [3, 0, 1, 0, 2]
+/// // histogram: [1.0, 0.0, 1.5, 0.0, 3.0]
 /// \endcode
 /// \endparblock
-template<class Config = default_config, class SampleIterator, class Counter, class Level>
-inline hipError_t histogram_even(void*          temporary_storage,
-                                 size_t&        storage_size,
-                                 SampleIterator samples,
-                                 unsigned int   columns,
-                                 unsigned int   rows,
-                                 size_t         row_stride_bytes,
-                                 Counter*       histogram,
-                                 unsigned int   levels,
-                                 Level          lower_level,
-                                 Level          upper_level,
-                                 hipStream_t    stream            = 0,
-                                 bool           debug_synchronous = false)
+template<class Config = default_config,
+         class SampleIterator,
+         class WeightIterator,
+         class Output,
+         class Level>
+inline hipError_t histogram_even_weighted(void*          temporary_storage,
+                                          size_t&        storage_size,
+                                          SampleIterator samples,
+                                          WeightIterator weights,
+                                          unsigned int   size,
+                                          Output*        histogram,
+                                          unsigned int   levels,
+                                          Level          lower_level,
+                                          Level          upper_level,
+                                          bool           deterministic     = false,
+                                          hipStream_t    stream            = 0,
+                                          bool           debug_synchronous = false)
 {
-    Counter*     histogram_single[1]   = {histogram};
+    Output*      histogram_single[1]   = {histogram};
     unsigned int levels_single[1]      = {levels};
     Level        lower_level_single[1] = {lower_level};
     Level        upper_level_single[1] = {upper_level};
 
-    return detail::histogram_even_impl<1, 1, Config>(temporary_storage,
-                                                     storage_size,
-                                                     samples,
-                                                     columns,
-                                                     rows,
-                                                     row_stride_bytes,
-                                                     histogram_single,
-                                                     levels_single,
-                                                     lower_level_single,
-                                                     upper_level_single,
-                                                     stream,
-                                                     debug_synchronous);
+    return detail::histogram_even_weighted_impl<1, 1, Config>(temporary_storage,
+                                                              storage_size,
+                                                              samples,
+                                                              weights,
+                                                              size,
+                                                              histogram_single,
+                                                              levels_single,
+                                                              lower_level_single,
+                                                              upper_level_single,
+                                                              deterministic,
+                                                              stream,
+                                                              debug_synchronous);
 }
 
-/// \brief Computes histograms from a sequence of multi-channel samples using equal-width bins.
+/// \brief Computes weighted histograms from a sequence of multi-channel samples using
+/// equal-width bins.
 ///
 /// \par
 /// * The input is a sequence of <em>pixel</em> structures, where each pixel comprises
 /// a record of \p Channels consecutive data samples (e.g., \p Channels = 4 for <em>RGBA</em> samples).
 /// * The first \p ActiveChannels channels of total \p Channels channels will be used for computing histograms
 /// (e.g., \p ActiveChannels = 3 for computing histograms of only <em>RGB</em> from <em>RGBA</em> samples).
+/// * Each pixel has one weight, which is added to the bins of all its active channels.
 /// * For channel<sub><em>i</em></sub> the number of histogram bins is (\p levels[i] - 1).
 /// * For channel<sub><em>i</em></sub> bins are evenly-segmented and include the same width of sample values:
 /// (\p upper_level[i] - \p lower_level[i]) / (\p levels[i] - 1).
+/// * Weights are accumulated like in \p histogram_even_weighted.
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 ///
 /// \tparam Channels - number of channels interleaved in the input samples.
 /// \tparam ActiveChannels - number of channels being used for computing histograms.
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `histogram_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
 /// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
-/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam WeightIterator - random-access iterator type of the weights range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Output - type of histogram bins, the totals of weights are converted to it.
 /// \tparam Level - type of histogram boundaries (levels)
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
@@ -658,118 +2589,226 @@ inline hipError_t histogram_even(void*          temporary_storage,
 /// \p storage_size and function returns without performing the reduction operation.
 /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
 /// \param [in] samples - iterator to the first element in the range of input samples.
-/// \param [in] size - number of pixels in the samples range.
+/// \param [in] weights - iterator to the first element in the range of weights of pixels.
+/// \param [in] size - number of pixels in the samples range and weights in the weights range.
 /// \param [out] histogram - pointers to the first element in the histogram range, one for each active channel.
 /// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
 /// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin in each active channel.
 /// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin in each active channel.
+/// \param [in] deterministic - [optional] If true, floating-point weights are accumulated as
+/// fixed-point numbers, so the histograms do not depend on the order of operations.
+/// Default value is \p false.
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
 ///
 /// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
 /// type \p hipError_t.
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config = default_config,
+         class SampleIterator,
+         class WeightIterator,
+         class Output,
+         class Level>
+inline hipError_t multi_histogram_even_weighted(void*          temporary_storage,
+                                                size_t&        storage_size,
+                                                SampleIterator samples,
+                                                WeightIterator weights,
+                                                unsigned int   size,
+                                                Output*        histogram[ActiveChannels],
+                                                unsigned int   levels[ActiveChannels],
+                                                Level          lower_level[ActiveChannels],
+                                                Level          upper_level[ActiveChannels],
+                                                bool           deterministic     = false,
+                                                hipStream_t    stream            = 0,
+                                                bool           debug_synchronous = false)
+{
+    return detail::histogram_even_weighted_impl<Channels, ActiveChannels, Config>(
+        temporary_storage,
+        storage_size,
+        samples,
+        weights,
+        size,
+        histogram,
+        levels,
+        lower_level,
+        upper_level,
+        deterministic,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Computes a weighted histogram from a sequence of samples using the specified bin
+/// boundary levels.
 ///
-/// \par Notes
-/// * Currently the \p Channels template parameter has no strict restriction on its value. However,
-///   internally a vector type of elements of type \p SampleIterator and length \p Channels is used
-///   to represent the input items, so the amount of local memory available will limit the range of
-///   possible values for this template parameter.
-/// * \p ActiveChannels must be less or equal than \p Channels.
-///
-/// \par Example
-/// \parblock
-/// In this example histograms for 3 channels (RGB) are computed on an array of 8-bit RGBA samples.
-///
-/// \code{.cpp}
-/// #include <rocprim/rocprim.hpp>
-///
-/// // Prepare input and output (declare pointers, allocate device memory etc.)
-/// unsigned int size;        // e.g., 8
-/// unsigned char * samples;  // e.g., [(3, 1, 5, 255), (3, 1, 5, 255), (4, 2, 6, 127), (3, 2, 6, 127),
-///                           //        (0, 0, 0, 100), (0, 1, 0, 100), (0, 0, 1, 255), (0, 1, 1, 255)]
-/// int * histogram[3];       // 3 empty arrays of at least 256 elements each
-/// unsigned int levels[3];   // e.g., [257, 257, 257] (for 256 bins)
-/// int lower_level[3];       // e.g., [0, 0, 0]
-/// int upper_level[3];       // e.g., [256, 256, 256]
+/// \par
+/// * The number of histogram bins is (\p levels - 1).
+/// * The range for bin<sub><em>j</em></sub> is [<tt>level_values[j]</tt>, <tt>level_values[j+1]</tt>).
+/// * Weights are accumulated like in \p histogram_even_weighted.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
 ///
-/// size_t temporary_storage_size_bytes;
-/// void * temporary_storage_ptr = nullptr;
-/// // Get required size of the temporary storage
-/// rocprim::multi_histogram_even<4, 3>(
-///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, size,
-///     histogram, levels, lower_level, upper_level
-/// );
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam WeightIterator - random-access iterator type of the weights range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Output - type of histogram bins, the totals of weights are converted to it.
+/// \tparam Level - type of histogram boundaries (levels)
 ///
-/// // allocate temporary storage
-/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] weights - iterator to the first element in the range of weights of samples.
+/// \param [in] size - number of elements in the samples and weights ranges.
+/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] level_values - pointer to the array of bin boundaries.
+/// \param [in] deterministic - [optional] If true, floating-point weights are accumulated as
+/// fixed-point numbers, so the histogram does not depend on the order of operations.
+/// Default value is \p false.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
 ///
-/// // compute histograms
-/// rocprim::multi_histogram_even<4, 3>(
-///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, size,
-///     histogram, levels, lower_level, upper_level
-/// );
-/// // histogram: [[4, 0, 0, 3, 1, 0, 0, ..., 0],
-/// //             [2, 4, 2, 0, 0, 0, 0, ..., 0],
-/// //             [2, 2, 0, 0, 0, 2, 2, ..., 0]]
-/// \endcode
-/// \endparblock
-template<unsigned int Channels,
-         unsigned int ActiveChannels,
-         class Config = default_config,
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
          class SampleIterator,
-         class Counter,
+         class WeightIterator,
+         class Output,
          class Level>
-inline hipError_t multi_histogram_even(void*          temporary_storage,
-                                       size_t&        storage_size,
-                                       SampleIterator samples,
-                                       unsigned int   size,
-                                       Counter*       histogram[ActiveChannels],
-                                       unsigned int   levels[ActiveChannels],
-                                       Level          lower_level[ActiveChannels],
-                                       Level          upper_level[ActiveChannels],
-                                       hipStream_t    stream            = 0,
-                                       bool           debug_synchronous = false)
+inline hipError_t histogram_range_weighted(void*          temporary_storage,
+                                           size_t&        storage_size,
+                                           SampleIterator samples,
+                                           WeightIterator weights,
+                                           unsigned int   size,
+                                           Output*        histogram,
+                                           unsigned int   levels,
+                                           Level*         level_values,
+                                           bool           deterministic     = false,
+                                           hipStream_t    stream            = 0,
+                                           bool           debug_synchronous = false)
 {
-    return detail::histogram_even_impl<Channels, ActiveChannels, Config>(temporary_storage,
-                                                                         storage_size,
-                                                                         samples,
-                                                                         size,
-                                                                         1,
-                                                                         0,
-                                                                         histogram,
-                                                                         levels,
-                                                                         lower_level,
-                                                                         upper_level,
-                                                                         stream,
-                                                                         debug_synchronous);
+    Output*      histogram_single[1]    = {histogram};
+    unsigned int levels_single[1]       = {levels};
+    Level*       level_values_single[1] = {level_values};
+
+    return detail::histogram_range_weighted_impl<1, 1, Config>(temporary_storage,
+                                                               storage_size,
+                                                               samples,
+                                                               weights,
+                                                               size,
+                                                               histogram_single,
+                                                               levels_single,
+                                                               level_values_single,
+                                                               deterministic,
+                                                               stream,
+                                                               debug_synchronous);
 }
 
-/// \brief Computes histograms from a two-dimensional region of multi-channel samples using equal-width bins.
+/// \brief Computes weighted histograms from a sequence of multi-channel samples using
+/// the specified bin boundary levels.
 ///
 /// \par
-/// * The two-dimensional region of interest within \p samples can be specified using the \p columns,
-/// \p rows and \p row_stride_bytes parameters.
-/// * The row stride must be a whole multiple of the sample data type size,
-/// i.e., <tt>(row_stride_bytes % sizeof(std::iterator_traits<SampleIterator>::value_type)) == 0</tt>.
 /// * The input is a sequence of <em>pixel</em> structures, where each pixel comprises
 /// a record of \p Channels consecutive data samples (e.g., \p Channels = 4 for <em>RGBA</em> samples).
 /// * The first \p ActiveChannels channels of total \p Channels channels will be used for computing histograms
 /// (e.g., \p ActiveChannels = 3 for computing histograms of only <em>RGB</em> from <em>RGBA</em> samples).
+/// * Each pixel has one weight, which is added to the bins of all its active channels.
 /// * For channel<sub><em>i</em></sub> the number of histogram bins is (\p levels[i] - 1).
-/// * For channel<sub><em>i</em></sub> bins are evenly-segmented and include the same width of sample values:
-/// (\p upper_level[i] - \p lower_level[i]) / (\p levels[i] - 1).
+/// * For channel<sub><em>i</em></sub> the range for bin<sub><em>j</em></sub> is
+/// [<tt>level_values[i][j]</tt>, <tt>level_values[i][j+1]</tt>).
+/// * Weights are accumulated like in \p histogram_even_weighted.
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 ///
 /// \tparam Channels - number of channels interleaved in the input samples.
 /// \tparam ActiveChannels - number of channels being used for computing histograms.
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `histogram_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam WeightIterator - random-access iterator type of the weights range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Output - type of histogram bins, the totals of weights are converted to it.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] weights - iterator to the first element in the range of weights of pixels.
+/// \param [in] size - number of pixels in the samples range and weights in the weights range.
+/// \param [out] histogram - pointers to the first element in the histogram range, one for each active channel.
+/// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
+/// \param [in] level_values - pointer to the array of bin boundaries for each active channel.
+/// \param [in] deterministic - [optional] If true, floating-point weights are accumulated as
+/// fixed-point numbers, so the histograms do not depend on the order of operations.
+/// Default value is \p false.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<unsigned int Channels,
+         unsigned int ActiveChannels,
+         class Config = default_config,
+         class SampleIterator,
+         class WeightIterator,
+         class Output,
+         class Level>
+inline hipError_t multi_histogram_range_weighted(void*          temporary_storage,
+                                                 size_t&        storage_size,
+                                                 SampleIterator samples,
+                                                 WeightIterator weights,
+                                                 unsigned int   size,
+                                                 Output*        histogram[ActiveChannels],
+                                                 unsigned int   levels[ActiveChannels],
+                                                 Level*         level_values[ActiveChannels],
+                                                 bool           deterministic     = false,
+                                                 hipStream_t    stream            = 0,
+                                                 bool           debug_synchronous = false)
+{
+    return detail::histogram_range_weighted_impl<Channels, ActiveChannels, Config>(
+        temporary_storage,
+        storage_size,
+        samples,
+        weights,
+        size,
+        histogram,
+        levels,
+        level_values,
+        deterministic,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Adds a sequence of samples to an existing histogram with equal-width bins, scaling the
+/// existing bins first.
+///
+/// \par
+/// * Unlike \p histogram_even, \p histogram is not cleared: every bin becomes
+/// <tt>histogram[i] * decay</tt> plus the number of new samples in the bin. With the default
+/// \p decay of 1 the new samples are simply added.
+/// * The scaled bins are converted back to \p Counter, so integer bins are truncated toward zero.
+/// * Scaling is done in the kernel that \p histogram_even uses to clear the bins, so updating a
+/// histogram costs the same as recomputing it. No kernel is launched for it if \p decay is 1.
+/// * The other bins parameters are the same as in \p histogram_even.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
 /// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
-/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Counter - type for histogram bin counters.
 /// \tparam Level - type of histogram boundaries (levels)
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
@@ -777,13 +2816,13 @@ inline hipError_t multi_histogram_even(void*          temporary_storage,
 /// \p storage_size and function returns without performing the reduction operation.
 /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
 /// \param [in] samples - iterator to the first element in the range of input samples.
-/// \param [in] columns - number of elements in each row of the region.
-/// \param [in] rows - number of rows of the region.
-/// \param [in] row_stride_bytes - number of bytes between starts of consecutive rows of the region.
-/// \param [out] histogram - pointers to the first element in the histogram range, one for each active channel.
-/// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
-/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin in each active channel.
-/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin in each active channel.
+/// \param [in] size - number of elements in the samples range.
+/// \param [in,out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin.
+/// \param [in] decay - [optional] factor the existing bins are multiplied by before the new
+/// samples are added. \p 0 clears the bins without reading them. Default value is \p 1.
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
@@ -791,99 +2830,91 @@ inline hipError_t multi_histogram_even(void*          temporary_storage,
 /// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
 /// type \p hipError_t.
 ///
-/// \par Notes
-/// * Currently the \p Channels template parameter has no strict restriction on its value. However,
-///   internally a vector type of elements of type \p SampleIterator and length \p Channels is used
-///   to represent the input items, so the amount of local memory available will limit the range of
-///   possible values for this template parameter.
-/// * \p ActiveChannels must be less or equal than \p Channels.
-///
 /// \par Example
 /// \parblock
-/// In this example histograms for 3 channels (RGB) are computed on an array of 8-bit RGBA samples.
+/// In this example new samples are added to a histogram of 5 bins after halving its bins.
 ///
 /// \code{.cpp}
 /// #include <rocprim/rocprim.hpp>
 ///
 /// // Prepare input and output (declare pointers, allocate device memory etc.)
-/// unsigned int columns;     // e.g., 4
-/// unsigned int rows;        // e.g., 2
-/// size_t row_stride_bytes;  // e.g., 5 * sizeof(unsigned char)
-/// unsigned char * samples;  // e.g., [(3, 1, 5, 255), (3, 1, 5, 255), (4, 2, 6, 127), (3, 2, 6, 127), (-, -, -, -),
-///                           //        (0, 0, 0, 100), (0, 1, 0, 100), (0, 0, 1, 255), (0, 1, 1, 255), (-, -, -, -)]
-/// int * histogram[3];       // 3 empty arrays of at least 256 elements each
-/// unsigned int levels[3];   // e.g., [257, 257, 257] (for 256 bins)
-/// int lower_level[3];       // e.g., [0, 0, 0]
-/// int upper_level[3];       // e.g., [256, 256, 256]
+/// unsigned int size;        // e.g., 4
+/// float * samples;          // e.g., [0.3, 9.5, 1.5, 100.0]
+/// int * histogram;          // e.g., [4, 2, 1, 0, 6]
+/// unsigned int levels;      // e.g., 6 (for 5 bins)
+/// float lower_level;        // e.g., 0.0
+/// float upper_level;        // e.g., 10.0
 ///
 /// size_t temporary_storage_size_bytes;
 /// void * temporary_storage_ptr = nullptr;
 /// // Get required size of the temporary storage
-/// rocprim::multi_histogram_even<4, 3>(
+/// rocprim::histogram_even_accumulate(
 ///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, columns, rows, row_stride_bytes,
-///     histogram, levels, lower_level, upper_level
+///     samples, size,
+///     histogram, levels, lower_level, upper_level, 0.5
 /// );
 ///
 /// // allocate temporary storage
 /// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
 ///
-/// // compute histograms
-/// rocprim::multi_histogram_even<4, 3>(
+/// // update histogram
+/// rocprim::histogram_even_accumulate(
 ///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, columns, rows, row_stride_bytes,
-///     histogram, levels, lower_level, upper_level
+///     samples, size,
+///     histogram, levels, lower_level, upper_level, 0.5
 /// );
-/// // histogram: [[4, 0, 0, 3, 1, 0, 0, ..., 0],
-/// //             [2, 4, 2, 0, 0, 0, 0, ..., 0],
-/// //             [2, 2, 0, 0, 0, 2, 2, ..., 0]]
+/// // histogram: [4, 1, 0, 0, 4]
 /// \endcode
 /// \endparblock
-template<unsigned int Channels,
-         unsigned int ActiveChannels,
-         class Config = default_config,
-         class SampleIterator,
-         class Counter,
-         class Level>
-inline hipError_t multi_histogram_even(void*          temporary_storage,
-                                       size_t&        storage_size,
-                                       SampleIterator samples,
-                                       unsigned int   columns,
-                                       unsigned int   rows,
-                                       size_t         row_stride_bytes,
-                                       Counter*       histogram[ActiveChannels],
-                                       unsigned int   levels[ActiveChannels],
-                                       Level          lower_level[ActiveChannels],
-                                       Level          upper_level[ActiveChannels],
-                                       hipStream_t    stream            = 0,
-                                       bool           debug_synchronous = false)
+template<class Config = default_config, class SampleIterator, class Counter, class Level>
+inline hipError_t histogram_even_accumulate(void*          temporary_storage,
+                                            size_t&        storage_size,
+                                            SampleIterator samples,
+                                            unsigned int   size,
+                                            Counter*       histogram,
+                                            unsigned int   levels,
+                                            Level          lower_level,
+                                            Level          upper_level,
+                                            double         decay             = 1.0,
+                                            hipStream_t    stream            = 0,
+                                            bool           debug_synchronous = false)
 {
-    return detail::histogram_even_impl<Channels, ActiveChannels, Config>(temporary_storage,
-                                                                         storage_size,
-                                                                         samples,
-                                                                         columns,
-                                                                         rows,
-                                                                         row_stride_bytes,
-                                                                         histogram,
-                                                                         levels,
-                                                                         lower_level,
-                                                                         upper_level,
-                                                                         stream,
-                                                                         debug_synchronous);
+    Counter*     histogram_single[1]   = {histogram};
+    unsigned int levels_single[1]      = {levels};
+    Level        lower_level_single[1] = {lower_level};
+    Level        upper_level_single[1] = {upper_level};
+
+    return detail::histogram_even_impl<1, 1, Config>(temporary_storage,
+                                                     storage_size,
+                                                     samples,
+                                                     size,
+                                                     1,
+                                                     0,
+                                                     histogram_single,
+                                                     levels_single,
+                                                     lower_level_single,
+                                                     upper_level_single,
+                                                     stream,
+                                                     debug_synchronous,
+                                                     decay);
 }
 
-/// \brief Computes a histogram from a sequence of samples using the specified bin boundary levels.
+/// \brief Adds a sequence of samples to an existing histogram with the specified bin boundary
+/// levels, scaling the existing bins first.
 ///
 /// \par
-/// * The number of histogram bins is (\p levels - 1).
-/// * The range for bin<sub><em>j</em></sub> is [<tt>level_values[j]</tt>, <tt>level_values[j+1]</tt>).
+/// * Unlike \p histogram_range, \p histogram is not cleared: every bin becomes
+/// <tt>histogram[i] * decay</tt> plus the number of new samples in the bin, like in
+/// \p histogram_even_accumulate.
+/// * The other bins parameters are the same as in \p histogram_range.
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `histogram_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
 /// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
-/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Counter - type for histogram bin counters.
 /// \tparam Level - type of histogram boundaries (levels)
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
@@ -892,61 +2923,28 @@ inline hipError_t multi_histogram_even(void*          temporary_storage,
 /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
 /// \param [in] samples - iterator to the first element in the range of input samples.
 /// \param [in] size - number of elements in the samples range.
-/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in,out] histogram - pointer to the first element in the histogram range.
 /// \param [in] levels - number of boundaries (levels) for histogram bins.
 /// \param [in] level_values - pointer to the array of bin boundaries.
+/// \param [in] decay - [optional] factor the existing bins are multiplied by before the new
+/// samples are added. \p 0 clears the bins without reading them. Default value is \p 1.
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
 ///
 /// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
 /// type \p hipError_t.
-///
-/// \par Example
-/// \parblock
-/// In this example a device-level histogram of 5 bins is computed on an array of float samples.
-///
-/// \code{.cpp}
-/// #include <rocprim/rocprim.hpp>
-///
-/// // Prepare input and output (declare pointers, allocate device memory etc.)
-/// unsigned int size;        // e.g., 8
-/// float * samples;          // e.g., [-10.0, 0.3, 9.5, 8.1, 1.5, 1.9, 100.0, 5.1]
-/// int * histogram;          // empty array of at least 5 elements
-/// unsigned int levels;      // e.g., 6 (for 5 bins)
-/// float * level_values;     // e.g., [0.0, 1.0, 5.0, 10.0, 20.0, 50.0]
-///
-/// size_t temporary_storage_size_bytes;
-/// void * temporary_storage_ptr = nullptr;
-/// // Get required size of the temporary storage
-/// rocprim::histogram_range(
-///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, size,
-///     histogram, levels, level_values
-/// );
-///
-/// // allocate temporary storage
-/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
-///
-/// // compute histogram
-/// rocprim::histogram_range(
-///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, size,
-///     histogram, levels, level_values
-/// );
-/// // histogram: [1, 2, 3, 0, 0]
-/// \endcode
-/// \endparblock
 template<class Config = default_config, class SampleIterator, class Counter, class Level>
-inline hipError_t histogram_range(void*          temporary_storage,
-                                  size_t&        storage_size,
-                                  SampleIterator samples,
-                                  unsigned int   size,
-                                  Counter*       histogram,
-                                  unsigned int   levels,
-                                  Level*         level_values,
-                                  hipStream_t    stream            = 0,
-                                  bool           debug_synchronous = false)
+inline hipError_t histogram_range_accumulate(void*          temporary_storage,
+                                             size_t&        storage_size,
+                                             SampleIterator samples,
+                                             unsigned int   size,
+                                             Counter*       histogram,
+                                             unsigned int   levels,
+                                             Level*         level_values,
+                                             double         decay             = 1.0,
+                                             hipStream_t    stream            = 0,
+                                             bool           debug_synchronous = false)
 {
     Counter*     histogram_single[1]    = {histogram};
     unsigned int levels_single[1]       = {levels};
@@ -962,25 +2960,30 @@ inline hipError_t histogram_range(void*          temporary_storage,
                                                       levels_single,
                                                       level_values_single,
                                                       stream,
-                                                      debug_synchronous);
+                                                      debug_synchronous,
+                                                      decay);
 }
 
-/// \brief Computes a histogram from a two-dimensional region of samples using the specified bin boundary levels.
+/// \brief Adds a sequence of weighted samples to an existing histogram with equal-width bins,
+/// scaling the existing bins first.
 ///
 /// \par
-/// * The two-dimensional region of interest within \p samples can be specified using the \p columns,
-/// \p rows and \p row_stride_bytes parameters.
-/// * The row stride must be a whole multiple of the sample data type size,
-/// i.e., <tt>(row_stride_bytes % sizeof(std::iterator_traits<SampleIterator>::value_type)) == 0</tt>.
-/// * The number of histogram bins is (\p levels - 1).
-/// * The range for bin<sub><em>j</em></sub> is [<tt>level_values[j]</tt>, <tt>level_values[j+1]</tt>).
+/// * Unlike \p histogram_even_weighted, \p histogram is not cleared: every bin becomes
+/// <tt>histogram[i] * decay</tt> plus the total weight of the new samples in the bin.
+/// * Scaling is fused into the kernel that converts the totals of weights to \p Output, so an
+/// update launches the same kernels as \p histogram_even_weighted.
+/// * The scaled bins are converted back to \p Output before the new totals are added.
+/// \p deterministic only makes the new totals independent of the order of operations.
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `histogram_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
 /// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
-/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam WeightIterator - random-access iterator type of the weights range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Output - type of histogram bins, the totals of weights are converted to it.
 /// \tparam Level - type of histogram boundaries (levels)
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
@@ -988,104 +2991,153 @@ inline hipError_t histogram_range(void*          temporary_storage,
 /// \p storage_size and function returns without performing the reduction operation.
 /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
 /// \param [in] samples - iterator to the first element in the range of input samples.
-/// \param [in] columns - number of elements in each row of the region.
-/// \param [in] rows - number of rows of the region.
-/// \param [in] row_stride_bytes - number of bytes between starts of consecutive rows of the region.
-/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] weights - iterator to the first element in the range of weights of samples.
+/// \param [in] size - number of elements in the samples and weights ranges.
+/// \param [in,out] histogram - pointer to the first element in the histogram range.
 /// \param [in] levels - number of boundaries (levels) for histogram bins.
-/// \param [in] level_values - pointer to the array of bin boundaries.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin.
+/// \param [in] decay - [optional] factor the existing bins are multiplied by before the new
+/// samples are added. \p 0 clears the bins without reading them. Default value is \p 1.
+/// \param [in] deterministic - [optional] If true, floating-point weights are accumulated as
+/// fixed-point numbers. Default value is \p false.
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
 ///
 /// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
 /// type \p hipError_t.
+template<class Config = default_config,
+         class SampleIterator,
+         class WeightIterator,
+         class Output,
+         class Level>
+inline hipError_t histogram_even_weighted_accumulate(void*          temporary_storage,
+                                                     size_t&        storage_size,
+                                                     SampleIterator samples,
+                                                     WeightIterator weights,
+                                                     unsigned int   size,
+                                                     Output*        histogram,
+                                                     unsigned int   levels,
+                                                     Level          lower_level,
+                                                     Level          upper_level,
+                                                     double         decay             = 1.0,
+                                                     bool           deterministic     = false,
+                                                     hipStream_t    stream            = 0,
+                                                     bool           debug_synchronous = false)
+{
+    Output*      histogram_single[1]   = {histogram};
+    unsigned int levels_single[1]      = {levels};
+    Level        lower_level_single[1] = {lower_level};
+    Level        upper_level_single[1] = {upper_level};
+
+    return detail::histogram_even_weighted_impl<1, 1, Config>(temporary_storage,
+                                                              storage_size,
+                                                              samples,
+                                                              weights,
+                                                              size,
+                                                              histogram_single,
+                                                              levels_single,
+                                                              lower_level_single,
+                                                              upper_level_single,
+                                                              deterministic,
+                                                              stream,
+                                                              debug_synchronous,
+                                                              decay);
+}
+
+/// \brief Adds a sequence of weighted samples to an existing histogram with the specified bin
+/// boundary levels, scaling the existing bins first.
 ///
-/// \par Example
-/// \parblock
-/// In this example a device-level histogram of 5 bins is computed on an array of float samples.
-///
-/// \code{.cpp}
-/// #include <rocprim/rocprim.hpp>
-///
-/// // Prepare input and output (declare pointers, allocate device memory etc.)
-/// unsigned int columns;     // e.g., 4
-/// unsigned int rows;        // e.g., 2
-/// size_t row_stride_bytes;  // e.g., 6 * sizeof(float)
-/// float * samples;          // e.g., [-10.0, 0.3, 9.5, 8.1, 1.5, 1.9, 100.0, 5.1]
-/// int * histogram;          // empty array of at least 5 elements
-/// unsigned int levels;      // e.g., 6 (for 5 bins)
-/// float level_values;       // e.g., [0.0, 1.0, 5.0, 10.0, 20.0, 50.0]
+/// \par
+/// * Unlike \p histogram_range_weighted, \p histogram is not cleared: every bin becomes
+/// <tt>histogram[i] * decay</tt> plus the total weight of the new samples in the bin, like in
+/// \p histogram_even_weighted_accumulate.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
 ///
-/// size_t temporary_storage_size_bytes;
-/// void * temporary_storage_ptr = nullptr;
-/// // Get required size of the temporary storage
-/// rocprim::histogram_range(
-///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, columns, rows, row_stride_bytes,
-///     histogram, levels, level_values
-/// );
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
+/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam WeightIterator - random-access iterator type of the weights range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Output - type of histogram bins, the totals of weights are converted to it.
+/// \tparam Level - type of histogram boundaries (levels)
 ///
-/// // allocate temporary storage
-/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of input samples.
+/// \param [in] weights - iterator to the first element in the range of weights of samples.
+/// \param [in] size - number of elements in the samples and weights ranges.
+/// \param [in,out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] level_values - pointer to the array of bin boundaries.
+/// \param [in] decay - [optional] factor the existing bins are multiplied by before the new
+/// samples are added. \p 0 clears the bins without reading them. Default value is \p 1.
+/// \param [in] deterministic - [optional] If true, floating-point weights are accumulated as
+/// fixed-point numbers. Default value is \p false.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
 ///
-/// // compute histogram
-/// rocprim::histogram_range(
-///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, columns, rows, row_stride_bytes,
-///     histogram, levels, level_values
-/// );
-/// // histogram: [1, 2, 3, 0, 0]
-/// \endcode
-/// \endparblock
-template<class Config = default_config, class SampleIterator, class Counter, class Level>
-inline hipError_t histogram_range(void*          temporary_storage,
-                                  size_t&        storage_size,
-                                  SampleIterator samples,
-                                  unsigned int   columns,
-                                  unsigned int   rows,
-                                  size_t         row_stride_bytes,
-                                  Counter*       histogram,
-                                  unsigned int   levels,
-                                  Level*         level_values,
-                                  hipStream_t    stream            = 0,
-                                  bool           debug_synchronous = false)
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class SampleIterator,
+         class WeightIterator,
+         class Output,
+         class Level>
+inline hipError_t histogram_range_weighted_accumulate(void*          temporary_storage,
+                                                      size_t&        storage_size,
+                                                      SampleIterator samples,
+                                                      WeightIterator weights,
+                                                      unsigned int   size,
+                                                      Output*        histogram,
+                                                      unsigned int   levels,
+                                                      Level*         level_values,
+                                                      double         decay             = 1.0,
+                                                      bool           deterministic     = false,
+                                                      hipStream_t    stream            = 0,
+                                                      bool           debug_synchronous = false)
 {
-    Counter*     histogram_single[1]    = {histogram};
+    Output*      histogram_single[1]    = {histogram};
     unsigned int levels_single[1]       = {levels};
     Level*       level_values_single[1] = {level_values};
 
-    return detail::histogram_range_impl<1, 1, Config>(temporary_storage,
-                                                      storage_size,
-                                                      samples,
-                                                      columns,
-                                                      rows,
-                                                      row_stride_bytes,
-                                                      histogram_single,
-                                                      levels_single,
-                                                      level_values_single,
-                                                      stream,
-                                                      debug_synchronous);
+    return detail::histogram_range_weighted_impl<1, 1, Config>(temporary_storage,
+                                                               storage_size,
+                                                               samples,
+                                                               weights,
+                                                               size,
+                                                               histogram_single,
+                                                               levels_single,
+                                                               level_values_single,
+                                                               deterministic,
+                                                               stream,
+                                                               debug_synchronous,
+                                                               decay);
 }
 
-/// \brief Computes histograms from a sequence of multi-channel samples using the specified bin boundary levels.
+/// \brief Computes a joint histogram of pairs of samples using equal-width bins.
 ///
-/// \par
-/// * The input is a sequence of <em>pixel</em> structures, where each pixel comprises
-/// a record of \p Channels consecutive data samples (e.g., \p Channels = 4 for <em>RGBA</em> samples).
-/// * The first \p ActiveChannels channels of total \p Channels channels will be used for computing histograms
-/// (e.g., \p ActiveChannels = 3 for computing histograms of only <em>RGB</em> from <em>RGBA</em> samples).
-/// * For channel<sub><em>i</em></sub> the number of histogram bins is (\p levels[i] - 1).
-/// * For channel<sub><em>i</em></sub> the range for bin<sub><em>j</em></sub> is
-/// [<tt>level_values[i][j]</tt>, <tt>level_values[i][j+1]</tt>).
+/// \par
+/// * Sample \p i is the pair (<tt>x_samples[i]</tt>, <tt>y_samples[i]</tt>).
+/// * The number of histogram bins is (<tt>levels[0] - 1</tt>) * (<tt>levels[1] - 1</tt>),
+/// the bin of a pair in x bin \p bx and y bin \p by is <tt>bx * (levels[1] - 1) + by</tt>.
+/// * The bins of each dimension are defined like in \p histogram_even. Pairs outside
+/// of the range of either dimension are not counted.
+/// * The bins are privatised in shared memory when they fit, larger histograms use the
+/// tiled and global paths of \p histogram_even.
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 ///
-/// \tparam Channels - number of channels interleaved in the input samples.
-/// \tparam ActiveChannels - number of channels being used for computing histograms.
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `histogram_config`.
-/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
-/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
+/// \tparam SampleIterator1 - random-access iterator type of the x samples.
+/// \tparam SampleIterator2 - random-access iterator type of the y samples.
 /// \tparam Counter - integer type for histogram bin counters.
 /// \tparam Level - type of histogram boundaries (levels)
 ///
@@ -1093,113 +3145,106 @@ inline hipError_t histogram_range(void*          temporary_storage,
 /// a null pointer is passed, the required allocation size (in bytes) is written to
 /// \p storage_size and function returns without performing the reduction operation.
 /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
-/// \param [in] samples - iterator to the first element in the range of input samples.
-/// \param [in] size - number of pixels in the samples range.
-/// \param [out] histogram - pointers to the first element in the histogram range, one for each active channel.
-/// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
-/// \param [in] level_values - pointer to the array of bin boundaries for each active channel.
+/// \param [in] x_samples - iterator to the first element in the range of x samples.
+/// \param [in] y_samples - iterator to the first element in the range of y samples.
+/// \param [in] size - number of pairs of samples.
+/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) of the bins of each dimension.
+/// \param [in] lower_level - lower sample value bound (inclusive) of each dimension.
+/// \param [in] upper_level - upper sample value bound (exclusive) of each dimension.
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
 ///
 /// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
-/// type \p hipError_t.
-///
-/// \par Notes
-/// * Currently the \p Channels template parameter has no strict restriction on its value. However,
-///   internally a vector type of elements of type \p SampleIterator and length \p Channels is used
-///   to represent the input items, so the amount of local memory available will limit the range of
-///   possible values for this template parameter.
-/// * \p ActiveChannels must be less or equal than \p Channels.
+/// type \p hipError_t. \p hipErrorInvalidValue is returned when the number of bins does not
+/// fit in <tt>unsigned int</tt>.
 ///
 /// \par Example
 /// \parblock
-/// In this example histograms for 3 channels (RGB) are computed on an array of 8-bit RGBA samples.
+/// In this example a device-level 2x3 joint histogram is computed on pairs of int samples.
 ///
 /// \code{.cpp}
 /// #include <rocprim/rocprim.hpp>
 ///
 /// // Prepare input and output (declare pointers, allocate device memory etc.)
-/// unsigned int size;        // e.g., 8
-/// unsigned char * samples;  // e.g., [(0, 0, 80, 255), (120, 0, 80, 255), (123, 0, 82, 127), (10, 1, 83, 127),
-///                           //        (51, 1, 8, 100), (52, 1, 8, 100), (53, 0, 81, 255), (54, 50, 81, 255)]
-/// int * histogram[3];       // 3 empty arrays of at least 256 elements each
-/// unsigned int levels[3];   // e.g., [4, 4, 3]
-/// int * level_values[3];    // e.g., [[0, 50, 100, 200], [0, 20, 40, 60], [0, 10, 100]]
+/// unsigned int size;          // e.g., 5
+/// int * x_samples;            // e.g., [0, 1, 1, 3, 2]
+/// int * y_samples;            // e.g., [0, 5, 2, 1, 9]
+/// int * histogram;            // empty array of at least 6 elements
+/// unsigned int levels[2];     // e.g., [3, 4] (for 2x3 bins)
+/// int lower_level[2];         // e.g., [0, 0]
+/// int upper_level[2];         // e.g., [4, 6]
 ///
 /// size_t temporary_storage_size_bytes;
 /// void * temporary_storage_ptr = nullptr;
 /// // Get required size of the temporary storage
-/// rocprim::multi_histogram_range<4, 3>(
+/// rocprim::histogram2d_even(
 ///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, size,
-///     histogram, levels, level_values
+///     x_samples, y_samples, size,
+///     histogram, levels, lower_level, upper_level
 /// );
 ///
 /// // allocate temporary storage
 /// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
 ///
-/// // compute histograms
-/// rocprim::multi_histogram_range<4, 3>(
+/// // compute histogram
+/// rocprim::histogram2d_even(
 ///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, size,
-///     histogram, levels, level_values
+///     x_samples, y_samples, size,
+///     histogram, levels, lower_level, upper_level
 /// );
-/// // histogram: [[2, 4, 2], [7, 0, 1], [2, 6]]
+/// // histogram: [1, 1, 1, 1, 0, 0]
 /// \endcode
 /// \endparblock
-template<unsigned int Channels,
-         unsigned int ActiveChannels,
-         class Config = default_config,
-         class SampleIterator,
+template<class Config = default_config,
+         class SampleIterator1,
+         class SampleIterator2,
          class Counter,
          class Level>
-inline hipError_t multi_histogram_range(void*          temporary_storage,
-                                        size_t&        storage_size,
-                                        SampleIterator samples,
-                                        unsigned int   size,
-                                        Counter*       histogram[ActiveChannels],
-                                        unsigned int   levels[ActiveChannels],
-                                        Level*         level_values[ActiveChannels],
-                                        hipStream_t    stream            = 0,
-                                        bool           debug_synchronous = false)
+inline hipError_t histogram2d_even(void*           temporary_storage,
+                                   size_t&         storage_size,
+                                   SampleIterator1 x_samples,
+                                   SampleIterator2 y_samples,
+                                   unsigned int    size,
+                                   Counter*        histogram,
+                                   unsigned int    levels[2],
+                                   Level           lower_level[2],
+                                   Level           upper_level[2],
+                                   hipStream_t     stream            = 0,
+                                   bool            debug_synchronous = false)
 {
-    return detail::histogram_range_impl<Channels, ActiveChannels, Config>(temporary_storage,
-                                                                          storage_size,
-                                                                          samples,
-                                                                          size,
-                                                                          1,
-                                                                          0,
-                                                                          histogram,
-                                                                          levels,
-                                                                          level_values,
-                                                                          stream,
-                                                                          debug_synchronous);
+    detail::histogram2d_bin_op<SampleIterator1, SampleIterator2, detail::sample_to_bin_even<Level>>
+        bin_op{x_samples, y_samples, {}};
+    ROCPRIM_RETURN_ON_ERROR(
+        detail::histogram_joint_even_bins<2>(bin_op.joint, levels, lower_level, upper_level));
+
+    return detail::histogram_joint_impl<Config>(temporary_storage,
+                                                storage_size,
+                                                bin_op,
+                                                size,
+                                                histogram,
+                                                stream,
+                                                debug_synchronous);
 }
 
-/// \brief Computes histograms from a two-dimensional region of multi-channel samples using the specified bin
-/// boundary levels.
+/// \brief Computes a joint histogram of pairs of samples using the specified bin boundary levels.
 ///
 /// \par
-/// * The two-dimensional region of interest within \p samples can be specified using the \p columns,
-/// \p rows and \p row_stride_bytes parameters.
-/// * The row stride must be a whole multiple of the sample data type size,
-/// i.e., <tt>(row_stride_bytes % sizeof(std::iterator_traits<SampleIterator>::value_type)) == 0</tt>.
-/// * The input is a sequence of <em>pixel</em> structures, where each pixel comprises
-/// a record of \p Channels consecutive data samples (e.g., \p Channels = 4 for <em>RGBA</em> samples).
-/// * The first \p ActiveChannels channels of total \p Channels channels will be used for computing histograms
-/// (e.g., \p ActiveChannels = 3 for computing histograms of only <em>RGB</em> from <em>RGBA</em> samples).
-/// * For channel<sub><em>i</em></sub> the number of histogram bins is (\p levels[i] - 1).
-/// * For channel<sub><em>i</em></sub> the range for bin<sub><em>j</em></sub> is
-/// [<tt>level_values[i][j]</tt>, <tt>level_values[i][j+1]</tt>).
+/// * Sample \p i is the pair (<tt>x_samples[i]</tt>, <tt>y_samples[i]</tt>).
+/// * The number of histogram bins is (<tt>levels[0] - 1</tt>) * (<tt>levels[1] - 1</tt>),
+/// the bin of a pair in x bin \p bx and y bin \p by is <tt>bx * (levels[1] - 1) + by</tt>.
+/// * The bins of each dimension are defined like in \p histogram_range. Pairs outside
+/// of the range of either dimension are not counted.
+/// * The bins are privatised in shared memory when they fit, larger histograms use the
+/// tiled and global paths of \p histogram_range.
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 ///
-/// \tparam Channels - number of channels interleaved in the input samples.
-/// \tparam ActiveChannels - number of channels being used for computing histograms.
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `histogram_config`.
-/// \tparam SampleIterator - random-access iterator type of the input range. Must meet the
-/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
+/// \tparam SampleIterator1 - random-access iterator type of the x samples.
+/// \tparam SampleIterator2 - random-access iterator type of the y samples.
 /// \tparam Counter - integer type for histogram bin counters.
 /// \tparam Level - type of histogram boundaries (levels)
 ///
@@ -1207,94 +3252,313 @@ inline hipError_t multi_histogram_range(void*          temporary_storage,
 /// a null pointer is passed, the required allocation size (in bytes) is written to
 /// \p storage_size and function returns without performing the reduction operation.
 /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
-/// \param [in] samples - iterator to the first element in the range of input samples.
-/// \param [in] columns - number of elements in each row of the region.
-/// \param [in] rows - number of rows of the region.
-/// \param [in] row_stride_bytes - number of bytes between starts of consecutive rows of the region.
-/// \param [out] histogram - pointers to the first element in the histogram range, one for each active channel.
-/// \param [in] levels - number of boundaries (levels) for histogram bins in each active channel.
-/// \param [in] level_values - pointer to the array of bin boundaries for each active channel.
+/// \param [in] x_samples - iterator to the first element in the range of x samples.
+/// \param [in] y_samples - iterator to the first element in the range of y samples.
+/// \param [in] size - number of pairs of samples.
+/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) of the bins of each dimension.
+/// \param [in] level_values - pointers to the arrays of bin boundaries of each dimension.
 /// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
 /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
 /// launch is forced in order to check for errors. Default value is \p false.
 ///
 /// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
-/// type \p hipError_t.
+/// type \p hipError_t. \p hipErrorInvalidValue is returned when the number of bins does not
+/// fit in <tt>unsigned int</tt>.
+template<class Config = default_config,
+         class SampleIterator1,
+         class SampleIterator2,
+         class Counter,
+         class Level>
+inline hipError_t histogram2d_range(void*           temporary_storage,
+                                    size_t&         storage_size,
+                                    SampleIterator1 x_samples,
+                                    SampleIterator2 y_samples,
+                                    unsigned int    size,
+                                    Counter*        histogram,
+                                    unsigned int    levels[2],
+                                    Level*          level_values[2],
+                                    hipStream_t     stream            = 0,
+                                    bool            debug_synchronous = false)
+{
+    detail::histogram2d_bin_op<SampleIterator1, SampleIterator2, detail::sample_to_bin_range<Level>>
+        bin_op{x_samples, y_samples, {}};
+    ROCPRIM_RETURN_ON_ERROR(
+        detail::histogram_joint_range_bins<2>(bin_op.joint, levels, level_values));
+
+    return detail::histogram_joint_impl<Config>(temporary_storage,
+                                                storage_size,
+                                                bin_op,
+                                                size,
+                                                histogram,
+                                                stream,
+                                                debug_synchronous);
+}
+
+/// \brief Computes a joint histogram of samples of several dimensions using equal-width bins.
 ///
-/// \par Notes
-/// * Currently the \p Channels template parameter has no strict restriction on its value. However,
-///   internally a vector type of elements of type \p SampleIterator and length \p Channels is used
-///   to represent the input items, so the amount of local memory available will limit the range of
-///   possible values for this template parameter.
-/// * \p ActiveChannels must be less or equal than \p Channels.
+/// \par
+/// * The \p Dimensions values of sample \p i are interleaved, value \p d is
+/// <tt>samples[i * Dimensions + d]</tt>.
+/// * The number of histogram bins is the product of (<tt>levels[d] - 1</tt>), the bins are
+/// flattened in row-major order so the first dimension varies slowest.
+/// * The bins of each dimension are defined like in \p histogram_even. Samples outside
+/// of the range of any dimension are not counted.
+/// * The bins are privatised in shared memory when they fit, larger histograms use the
+/// tiled and global paths of \p histogram_even.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
 ///
-/// \par Example
-/// \parblock
-/// In this example histograms for 3 channels (RGB) are computed on an array of 8-bit RGBA samples.
+/// \tparam Dimensions - number of values of each sample.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
+/// \tparam SampleIterator - random-access iterator type of the input range. It can be a simple
+/// pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
 ///
-/// \code{.cpp}
-/// #include <rocprim/rocprim.hpp>
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first value of the first sample.
+/// \param [in] size - number of samples, the range has <tt>size * Dimensions</tt> values.
+/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) of the bins of each dimension.
+/// \param [in] lower_level - lower sample value bound (inclusive) of each dimension.
+/// \param [in] upper_level - upper sample value bound (exclusive) of each dimension.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
 ///
-/// // Prepare input and output (declare pointers, allocate device memory etc.)
-/// unsigned int columns;     // e.g., 4
-/// unsigned int rows;        // e.g., 2
-/// size_t row_stride_bytes;  // e.g., 5 * sizeof(unsigned char)
-/// unsigned char * samples;  // e.g., [(0, 0, 80, 0), (120, 0, 80, 0), (123, 0, 82, 0), (10, 1, 83, 0), (-, -, -, -),
-///                           //        (51, 1, 8, 0), (52, 1, 8, 0), (53, 0, 81, 0), (54, 50, 81, 0), (-, -, -, -)]
-/// int * histogram[3];       // 3 empty arrays
-/// unsigned int levels[3];   // e.g., [4, 4, 3]
-/// int * level_values[3];    // e.g., [[0, 50, 100, 200], [0, 20, 40, 60], [0, 10, 100]]
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t. \p hipErrorInvalidValue is returned when the number of bins does not
+/// fit in <tt>unsigned int</tt>.
+template<unsigned int Dimensions,
+         class Config = default_config,
+         class SampleIterator,
+         class Counter,
+         class Level>
+inline hipError_t histogram_nd_even(void*          temporary_storage,
+                                    size_t&        storage_size,
+                                    SampleIterator samples,
+                                    unsigned int   size,
+                                    Counter*       histogram,
+                                    unsigned int   levels[Dimensions],
+                                    Level          lower_level[Dimensions],
+                                    Level          upper_level[Dimensions],
+                                    hipStream_t    stream            = 0,
+                                    bool           debug_synchronous = false)
+{
+    static_assert(Dimensions > 0, "Dimensions must be greater than 0");
+
+    detail::histogram_nd_bin_op<Dimensions, SampleIterator, detail::sample_to_bin_even<Level>>
+        bin_op{samples, {}};
+    ROCPRIM_RETURN_ON_ERROR(detail::histogram_joint_even_bins<Dimensions>(bin_op.joint,
+                                                                          levels,
+                                                                          lower_level,
+                                                                          upper_level));
+
+    return detail::histogram_joint_impl<Config>(temporary_storage,
+                                                storage_size,
+                                                bin_op,
+                                                size,
+                                                histogram,
+                                                stream,
+                                                debug_synchronous);
+}
+
+/// \brief Computes a joint histogram of samples of several dimensions using the specified bin
+/// boundary levels.
 ///
-/// size_t temporary_storage_size_bytes;
-/// void * temporary_storage_ptr = nullptr;
-/// // Get required size of the temporary storage
-/// rocprim::multi_histogram_range<4, 3>(
-///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, columns, rows, row_stride_bytes,
-///     histogram, levels, level_values
-/// );
+/// \par
+/// * The \p Dimensions values of sample \p i are interleaved, value \p d is
+/// <tt>samples[i * Dimensions + d]</tt>.
+/// * The number of histogram bins is the product of (<tt>levels[d] - 1</tt>), the bins are
+/// flattened in row-major order so the first dimension varies slowest.
+/// * The bins of each dimension are defined like in \p histogram_range. Samples outside
+/// of the range of any dimension are not counted.
+/// * The bins are privatised in shared memory when they fit, larger histograms use the
+/// tiled and global paths of \p histogram_range.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
 ///
-/// // allocate temporary storage
-/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+/// \tparam Dimensions - number of values of each sample.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `histogram_config`
+/// or a `tuned_config` of these.
+/// \tparam SampleIterator - random-access iterator type of the input range. It can be a simple
+/// pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
 ///
-/// // compute histograms
-/// rocprim::multi_histogram_range<4, 3>(
-///     temporary_storage_ptr, temporary_storage_size_bytes,
-///     samples, columns, rows, row_stride_bytes,
-///     histogram, levels, level_values
-/// );
-/// // histogram: [[2, 4, 2], [7, 0, 1], [2, 6]]
-/// \endcode
-/// \endparblock
-template<unsigned int Channels,
-         unsigned int ActiveChannels,
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first value of the first sample.
+/// \param [in] size - number of samples, the range has <tt>size * Dimensions</tt> values.
+/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) of the bins of each dimension.
+/// \param [in] level_values - pointers to the arrays of bin boundaries of each dimension.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t. \p hipErrorInvalidValue is returned when the number of bins does not
+/// fit in <tt>unsigned int</tt>.
+template<unsigned int Dimensions,
          class Config = default_config,
          class SampleIterator,
          class Counter,
          class Level>
-inline hipError_t multi_histogram_range(void*          temporary_storage,
+inline hipError_t histogram_nd_range(void*          temporary_storage,
+                                     size_t&        storage_size,
+                                     SampleIterator samples,
+                                     unsigned int   size,
+                                     Counter*       histogram,
+                                     unsigned int   levels[Dimensions],
+                                     Level*         level_values[Dimensions],
+                                     hipStream_t    stream            = 0,
+                                     bool           debug_synchronous = false)
+{
+    static_assert(Dimensions > 0, "Dimensions must be greater than 0");
+
+    detail::histogram_nd_bin_op<Dimensions, SampleIterator, detail::sample_to_bin_range<Level>>
+        bin_op{samples, {}};
+    ROCPRIM_RETURN_ON_ERROR(
+        detail::histogram_joint_range_bins<Dimensions>(bin_op.joint, levels, level_values));
+
+    return detail::histogram_joint_impl<Config>(temporary_storage,
+                                                storage_size,
+                                                bin_op,
+                                                size,
+                                                histogram,
+                                                stream,
+                                                debug_synchronous);
+}
+
+/// \brief Computes a histogram from a sorted sequence of samples using equal-width bins.
+///
+/// \par
+/// * The samples must be sorted in ascending order, for example by \p radix_sort_keys.
+/// * The bins are defined like in \p histogram_even.
+/// * No atomic operations are used and the result is deterministic: every bin is the difference
+/// of the positions of its boundaries, which are found with binary searches. This costs
+/// O(bins * log(size)). For histograms with more bins than samples the runs of samples of the
+/// same bin are walked instead, and the bins without samples are cleared.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam SampleIterator - random-access iterator type of the input range. It can be a simple
+/// pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of sorted input samples.
+/// \param [in] size - number of elements in the samples range.
+/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] lower_level - lower sample value bound (inclusive) for the first histogram bin.
+/// \param [in] upper_level - upper sample value bound (exclusive) for the last histogram bin.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class SampleIterator, class Counter, class Level>
+inline hipError_t histogram_even_sorted(void*          temporary_storage,
                                         size_t&        storage_size,
                                         SampleIterator samples,
-                                        unsigned int   columns,
-                                        unsigned int   rows,
-                                        size_t         row_stride_bytes,
-                                        Counter*       histogram[ActiveChannels],
-                                        unsigned int   levels[ActiveChannels],
-                                        Level*         level_values[ActiveChannels],
+                                        unsigned int   size,
+                                        Counter*       histogram,
+                                        unsigned int   levels,
+                                        Level          lower_level,
+                                        Level          upper_level,
                                         hipStream_t    stream            = 0,
                                         bool           debug_synchronous = false)
 {
-    return detail::histogram_range_impl<Channels, ActiveChannels, Config>(temporary_storage,
-                                                                          storage_size,
-                                                                          samples,
-                                                                          columns,
-                                                                          rows,
-                                                                          row_stride_bytes,
-                                                                          histogram,
-                                                                          levels,
-                                                                          level_values,
-                                                                          stream,
-                                                                          debug_synchronous);
+    if(levels < 2)
+    {
+        // Histogram must have at least 1 bin
+        return hipErrorInvalidValue;
+    }
+
+    return detail::histogram_sorted_impl(
+        temporary_storage,
+        storage_size,
+        samples,
+        size,
+        histogram,
+        detail::sample_to_bin_even<Level>(levels - 1, lower_level, upper_level),
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Computes a histogram from a sorted sequence of samples using the specified bin
+/// boundary levels.
+///
+/// \par
+/// * The samples must be sorted in ascending order, for example by \p radix_sort_keys.
+/// * The bins are defined like in \p histogram_range.
+/// * No atomic operations are used and the result is deterministic: every bin is the difference
+/// of the positions of its boundaries, which are found with binary searches. This costs
+/// O(bins * log(size)). For histograms with more bins than samples the runs of samples of the
+/// same bin are walked instead, and the bins without samples are cleared.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam SampleIterator - random-access iterator type of the input range. It can be a simple
+/// pointer type.
+/// \tparam Counter - integer type for histogram bin counters.
+/// \tparam Level - type of histogram boundaries (levels)
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] samples - iterator to the first element in the range of sorted input samples.
+/// \param [in] size - number of elements in the samples range.
+/// \param [out] histogram - pointer to the first element in the histogram range.
+/// \param [in] levels - number of boundaries (levels) for histogram bins.
+/// \param [in] level_values - pointer to the array of bin boundaries.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful histogram operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class SampleIterator, class Counter, class Level>
+inline hipError_t histogram_range_sorted(void*          temporary_storage,
+                                         size_t&        storage_size,
+                                         SampleIterator samples,
+                                         unsigned int   size,
+                                         Counter*       histogram,
+                                         unsigned int   levels,
+                                         Level*         level_values,
+                                         hipStream_t    stream            = 0,
+                                         bool           debug_synchronous = false)
+{
+    if(levels < 2)
+    {
+        // Histogram must have at least 1 bin
+        return hipErrorInvalidValue;
+    }
+
+    return detail::histogram_sorted_impl(
+        temporary_storage,
+        storage_size,
+        samples,
+        size,
+        histogram,
+        detail::sample_to_bin_range<Level>(levels - 1, level_values),
+        stream,
+        debug_synchronous);
 }
 
 /// @}
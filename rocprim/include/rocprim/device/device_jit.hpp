@@ -0,0 +1,700 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_JIT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_JIT_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "config_types.hpp"
+#include "device_reduce_config.hpp"
+#include "device_transform_config.hpp"
+
+#include <rocprim/rocprim_version.hpp>
+
+#include <hip/hiprtc.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief A type of the just-in-time compiled algorithms, given by its C++ source.
+struct jit_type
+{
+    /// The name of the type in the source, e.g. \p "int" or \p "my_pair".
+    std::string name;
+    /// \p sizeof of the type, it selects the tuned config of the algorithms.
+    size_t size;
+    /// The source that defines the type, empty for built-in types.
+    std::string definition = "";
+};
+
+/// \brief An operator of the just-in-time compiled algorithms, given by its C++ source.
+struct jit_operator
+{
+    /// The name of the function object type in the source.
+    std::string name;
+    /// The source that defines the function object type, whose call operator must be a
+    /// \p __device__ function.
+    std::string definition;
+};
+
+/// \brief The options of the just-in-time compilation of the device algorithms.
+struct jit_options
+{
+    /// The directory where the code objects are cached. If it is empty, the directory in the
+    /// environment variable \p ROCPRIM_JIT_CACHE_DIR is used, and without it the code objects are
+    /// only cached in memory.
+    std::string cache_directory = "";
+    /// The include directories of the compilation, they must contain the rocPRIM headers. If it is
+    /// empty, the directories in the environment variable \p ROCPRIM_JIT_INCLUDE_PATH (separated
+    /// by \p ':') and the directory defined by \p ROCPRIM_JIT_INCLUDE_DIR are used.
+    std::vector<std::string> include_directories = {};
+    /// Additional options of hipRTC, e.g. \p "-O3" or definitions.
+    std::vector<std::string> compile_options = {};
+    /// If it is not null, the log of a failed compilation is written to it.
+    std::string* compile_log = nullptr;
+};
+
+namespace detail
+{
+
+// 64-bit FNV-1a, the key of the code objects in the caches
+inline uint64_t jit_hash(const std::string& text)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for(const char c : text)
+    {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+    }
+    return hash;
+}
+
+inline std::vector<std::string> jit_include_directories(const jit_options& options)
+{
+    if(!options.include_directories.empty())
+    {
+        return options.include_directories;
+    }
+    std::vector<std::string> directories;
+    if(const char* path = std::getenv("ROCPRIM_JIT_INCLUDE_PATH"))
+    {
+        std::stringstream stream(path);
+        std::string       directory;
+        while(std::getline(stream, directory, ':'))
+        {
+            if(!directory.empty())
+            {
+                directories.push_back(directory);
+            }
+        }
+    }
+#ifdef ROCPRIM_JIT_INCLUDE_DIR
+    directories.push_back(ROCPRIM_JIT_INCLUDE_DIR);
+#endif
+    return directories;
+}
+
+inline std::string jit_cache_directory(const jit_options& options)
+{
+    if(!options.cache_directory.empty())
+    {
+        return options.cache_directory;
+    }
+    const char* directory = std::getenv("ROCPRIM_JIT_CACHE_DIR");
+    return directory != nullptr ? directory : "";
+}
+
+// The loaded kernels of the process, by the hash of their source, compile options and device.
+// Modules stay loaded until the process exits.
+class jit_kernel_cache
+{
+public:
+    static jit_kernel_cache& instance()
+    {
+        static jit_kernel_cache cache;
+        return cache;
+    }
+
+    hipError_t get(const std::string& source,
+                   const char*        kernel_name,
+                   const jit_options& options,
+                   const hipStream_t  stream,
+                   hipFunction_t&     function)
+    {
+        int device_id;
+        ROCPRIM_RETURN_ON_ERROR(get_device_from_stream(stream, device_id));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto arch = arch_names_.find(device_id);
+        if(arch == arch_names_.end())
+        {
+            hipDeviceProp_t properties;
+            ROCPRIM_RETURN_ON_ERROR(hipGetDeviceProperties(&properties, device_id));
+            arch = arch_names_.emplace(device_id, std::string(properties.gcnArchName)).first;
+        }
+
+        std::vector<std::string> compile_options{"--gpu-architecture=" + arch->second,
+                                                 "-std=c++14",
+                                                 "-O3"};
+        for(const std::string& directory : jit_include_directories(options))
+        {
+            compile_options.push_back("-I" + directory);
+        }
+        compile_options.insert(compile_options.end(),
+                               options.compile_options.begin(),
+                               options.compile_options.end());
+
+        // The code object depends on the headers of this version of rocPRIM
+        std::string key_text = "rocprim " + std::to_string(ROCPRIM_VERSION) + "\n";
+        for(const std::string& option : compile_options)
+        {
+            key_text += option + "\n";
+        }
+        key_text += source;
+        const uint64_t hash = jit_hash(key_text);
+
+        const auto loaded = functions_.find(std::make_pair(hash, device_id));
+        if(loaded != functions_.end())
+        {
+            function = loaded->second;
+            return hipSuccess;
+        }
+
+        char hash_text[17];
+        std::snprintf(hash_text,
+                      sizeof(hash_text),
+                      "%016llx",
+                      static_cast<unsigned long long>(hash));
+        const std::string directory = jit_cache_directory(options);
+        const std::string path
+            = directory.empty() ? "" : directory + "/rocprim_jit_" + hash_text + ".hsaco";
+
+        std::vector<char> code;
+        if(!path.empty())
+        {
+            std::ifstream file(path, std::ios::binary);
+            code.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+        if(code.empty())
+        {
+            ROCPRIM_RETURN_ON_ERROR(compile(source, compile_options, options.compile_log, code));
+            if(!path.empty())
+            {
+                // Written under a temporary name, so that other processes never read a partial file
+                const std::string temporary_path = path + "." + std::to_string(device_id) + ".tmp";
+                {
+                    std::ofstream file(temporary_path, std::ios::binary);
+                    file.write(code.data(), code.size());
+                }
+                std::rename(temporary_path.c_str(), path.c_str());
+            }
+        }
+
+        hipModule_t module;
+        ROCPRIM_RETURN_ON_ERROR(hipModuleLoadData(&module, code.data()));
+        ROCPRIM_RETURN_ON_ERROR(hipModuleGetFunction(&function, module, kernel_name));
+        functions_.emplace(std::make_pair(hash, device_id), function);
+        return hipSuccess;
+    }
+
+private:
+    struct key_hash
+    {
+        size_t operator()(const std::pair<uint64_t, int>& key) const
+        {
+            return static_cast<size_t>(key.first ^ (uint64_t(key.second) << 32));
+        }
+    };
+
+    jit_kernel_cache() = default;
+
+    static hipError_t compile(const std::string&              source,
+                              const std::vector<std::string>& compile_options,
+                              std::string*                    compile_log,
+                              std::vector<char>&              code)
+    {
+        hiprtcProgram program;
+        if(hiprtcCreateProgram(&program, source.c_str(), "rocprim_jit.hip", 0, nullptr, nullptr)
+           != HIPRTC_SUCCESS)
+        {
+            return hipErrorInvalidValue;
+        }
+
+        std::vector<const char*> option_pointers;
+        for(const std::string& option : compile_options)
+        {
+            option_pointers.push_back(option.c_str());
+        }
+        const hiprtcResult result = hiprtcCompileProgram(program,
+                                                         static_cast<int>(option_pointers.size()),
+                                                         option_pointers.data());
+        if(result != HIPRTC_SUCCESS)
+        {
+            size_t log_size = 0;
+            if(compile_log != nullptr
+               && hiprtcGetProgramLogSize(program, &log_size) == HIPRTC_SUCCESS)
+            {
+                std::vector<char> log(log_size + 1, '\0');
+                hiprtcGetProgramLog(program, log.data());
+                *compile_log = log.data();
+            }
+            hiprtcDestroyProgram(&program);
+            return hipErrorInvalidImage;
+        }
+
+        size_t code_size;
+        hiprtcGetCodeSize(program, &code_size);
+        code.resize(code_size);
+        hiprtcGetCode(program, code.data());
+        hiprtcDestroyProgram(&program);
+        return hipSuccess;
+    }
+
+    std::mutex                                                            mutex_;
+    std::unordered_map<int, std::string>                                  arch_names_;
+    std::unordered_map<std::pair<uint64_t, int>, hipFunction_t, key_hash> functions_;
+};
+
+template<class T>
+using jit_default_transform_config = wrapped_transform_config<default_config, T>;
+
+template<class T>
+using jit_default_reduce_config = wrapped_reduce_config<default_config, T>;
+
+// The tuned configs of the algorithms are selected by the size of the runtime type, as those of
+// the unsigned integer of its size. Larger types use the configs of 8-byte types with
+// proportionally fewer items per thread.
+template<template<class> class Config, class Params>
+inline Params jit_params_for_size(const size_t size, const target_arch arch)
+{
+    switch(size)
+    {
+        case 1: return dispatch_target_arch<Config<uint8_t>>(arch);
+        case 2: return dispatch_target_arch<Config<uint16_t>>(arch);
+        case 4: return dispatch_target_arch<Config<uint32_t>>(arch);
+        case 8: return dispatch_target_arch<Config<uint64_t>>(arch);
+        default: break;
+    }
+    return dispatch_target_arch<Config<uint64_t>>(arch);
+}
+
+inline unsigned int jit_items_per_thread(const kernel_config_params& params, const size_t size)
+{
+    if(size <= 8)
+    {
+        return params.items_per_thread;
+    }
+    return std::max(1u, static_cast<unsigned int>(params.items_per_thread * 8 / size));
+}
+
+inline const char* jit_block_reduce_algorithm_name(const block_reduce_algorithm algorithm)
+{
+    switch(algorithm)
+    {
+        case block_reduce_algorithm::raking_reduce: return "raking_reduce";
+        case block_reduce_algorithm::raking_reduce_commutative_only:
+            return "raking_reduce_commutative_only";
+        default: return "using_warp_reduce";
+    }
+}
+
+inline void jit_append_definitions(std::string& source, const jit_type& type)
+{
+    if(!type.definition.empty())
+    {
+        source += type.definition + "\n";
+    }
+}
+
+inline std::string jit_transform_source(const jit_type&     input_type,
+                                        const jit_type&     output_type,
+                                        const jit_operator& transform_op,
+                                        const unsigned int  block_size,
+                                        const unsigned int  items_per_thread)
+{
+    std::string source = "#include <rocprim/block/block_load_func.hpp>\n"
+                         "#include <rocprim/block/block_store_func.hpp>\n";
+    jit_append_definitions(source, input_type);
+    if(output_type.name != input_type.name)
+    {
+        jit_append_definitions(source, output_type);
+    }
+    source += transform_op.definition + "\n";
+
+    const std::string bs  = std::to_string(block_size);
+    const std::string ipt = std::to_string(items_per_thread);
+    const std::string ipb = std::to_string(block_size * items_per_thread);
+    source += "extern \"C\" __global__ __launch_bounds__(" + bs + ")\n"
+              "void rocprim_jit_transform(const " + input_type.name + "* input, "
+              + output_type.name + "* output, size_t size)\n"
+              "{\n"
+              "    const unsigned int flat_id = threadIdx.x;\n"
+              "    const size_t block_offset = size_t(blockIdx.x) * " + ipb + ";\n"
+              "    const size_t remaining = size - block_offset;\n"
+              "    " + transform_op.name + " op;\n"
+              "    " + input_type.name + " input_values[" + ipt + "];\n"
+              "    " + output_type.name + " output_values[" + ipt + "];\n"
+              "    if(remaining >= " + ipb + ")\n"
+              "    {\n"
+              "        ::rocprim::block_load_direct_striped<" + bs + ">(flat_id,\n"
+              "            input + block_offset, input_values);\n"
+              "        for(unsigned int i = 0; i < " + ipt + "; i++)\n"
+              "        {\n"
+              "            output_values[i] = op(input_values[i]);\n"
+              "        }\n"
+              "        ::rocprim::block_store_direct_striped<" + bs + ">(flat_id,\n"
+              "            output + block_offset, output_values);\n"
+              "    }\n"
+              "    else\n"
+              "    {\n"
+              "        const unsigned int valid = static_cast<unsigned int>(remaining);\n"
+              "        ::rocprim::block_load_direct_striped<" + bs + ">(flat_id,\n"
+              "            input + block_offset, input_values, valid);\n"
+              "        for(unsigned int i = 0; i < " + ipt + "; i++)\n"
+              "        {\n"
+              "            if(flat_id + i * " + bs + " < valid)\n"
+              "            {\n"
+              "                output_values[i] = op(input_values[i]);\n"
+              "            }\n"
+              "        }\n"
+              "        ::rocprim::block_store_direct_striped<" + bs + ">(flat_id,\n"
+              "            output + block_offset, output_values, valid);\n"
+              "    }\n"
+              "}\n";
+    return source;
+}
+
+inline std::string jit_reduce_source(const jit_type&              type,
+                                     const jit_operator&          reduce_op,
+                                     const unsigned int           block_size,
+                                     const unsigned int           items_per_thread,
+                                     const block_reduce_algorithm algorithm)
+{
+    std::string source = "#include <rocprim/block/block_load_func.hpp>\n"
+                         "#include <rocprim/block/block_reduce.hpp>\n";
+    jit_append_definitions(source, type);
+    source += reduce_op.definition + "\n";
+
+    const std::string bs  = std::to_string(block_size);
+    const std::string ipt = std::to_string(items_per_thread);
+    const std::string ipb = std::to_string(block_size * items_per_thread);
+    const std::string& t  = type.name;
+    source += "extern \"C\" __global__ __launch_bounds__(" + bs + ")\n"
+              "void rocprim_jit_reduce(const " + t + "* input, " + t + "* output, size_t size,\n"
+              "                        unsigned int apply_initial, " + t + " initial)\n"
+              "{\n"
+              "    using block_reduce_type = ::rocprim::block_reduce<" + t + ", " + bs + ",\n"
+              "        ::rocprim::block_reduce_algorithm::"
+              + jit_block_reduce_algorithm_name(algorithm) + ">;\n"
+              "    __shared__ typename block_reduce_type::storage_type storage;\n"
+              "    const unsigned int flat_id = threadIdx.x;\n"
+              "    const size_t block_offset = size_t(blockIdx.x) * " + ipb + ";\n"
+              "    const size_t remaining = size - block_offset;\n"
+              "    " + reduce_op.name + " op;\n"
+              "    " + t + " values[" + ipt + "];\n"
+              "    " + t + " result;\n"
+              "    if(remaining >= " + ipb + ")\n"
+              "    {\n"
+              "        ::rocprim::block_load_direct_striped<" + bs + ">(flat_id,\n"
+              "            input + block_offset, values);\n"
+              "        " + t + " thread_value = values[0];\n"
+              "        for(unsigned int i = 1; i < " + ipt + "; i++)\n"
+              "        {\n"
+              "            thread_value = op(thread_value, values[i]);\n"
+              "        }\n"
+              "        block_reduce_type().reduce(thread_value, result, storage, op);\n"
+              "    }\n"
+              "    else\n"
+              "    {\n"
+              "        const unsigned int valid = static_cast<unsigned int>(remaining);\n"
+              "        ::rocprim::block_load_direct_striped<" + bs + ">(flat_id,\n"
+              "            input + block_offset, values, valid);\n"
+              "        " + t + " thread_value = values[0];\n"
+              "        for(unsigned int i = 1; i < " + ipt + "; i++)\n"
+              "        {\n"
+              "            if(flat_id + i * " + bs + " < valid)\n"
+              "            {\n"
+              "                thread_value = op(thread_value, values[i]);\n"
+              "            }\n"
+              "        }\n"
+              "        block_reduce_type().reduce(thread_value, result,\n"
+              "            valid < " + bs + " ? valid : " + bs + ", storage, op);\n"
+              "    }\n"
+              "    if(flat_id == 0)\n"
+              "    {\n"
+              "        output[blockIdx.x] = apply_initial ? op(initial, result) : result;\n"
+              "    }\n"
+              "}\n";
+    return source;
+}
+
+} // namespace detail
+
+/// \brief Transforms the items of \p input with an operator given by its source, which is compiled
+/// at run time with hipRTC.
+///
+/// \par Overview
+/// * The algorithm is for types and operators that are only known at run time, e.g. those of a
+///   query engine: instead of instantiating every combination ahead of time, the kernel is
+///   generated from the given sources, compiled with hipRTC for the device of \p stream and
+///   loaded. The operator is inlined into the kernel.
+/// * The kernel uses the tuned config of \p rocprim::transform for the unsigned integer of the
+///   size of the output type.
+/// * The code objects are cached in memory, and on disk in \p options.cache_directory, keyed by
+///   a hash of the source, the compile options, the architecture and the rocPRIM version. Only the
+///   first call with a new combination pays for the compilation.
+/// * The header is not included by <tt>rocprim/rocprim.hpp</tt>, and code that includes it must
+///   link hipRTC (e.g. the CMake target \p hiprtc::hiprtc). hipRTC must be able to compile the
+///   rocPRIM block headers, i.e. find them and the standard headers they include in the include
+///   directories of \p options.
+///
+/// \param [in] input pointer to the \p size items of \p input_type on the device.
+/// \param [out] output pointer to the \p size items of \p output_type on the device.
+/// \param [in] size the number of items.
+/// \param [in] input_type the type of the input.
+/// \param [in] output_type the type of the output.
+/// \param [in] transform_op the unary function object that converts an input item to an output
+///   item.
+/// \param [in] options the options of the compilation and of the caches.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+///
+/// \returns \p hipSuccess (\p 0) after a successful transform, \p hipErrorInvalidImage if the
+///   compilation fails (see \p options.compile_log); otherwise a HIP runtime error of type
+///   \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// const rocprim::jit_type     int_type{"int", sizeof(int)};
+/// const rocprim::jit_operator square{"square_op",
+///     "struct square_op { __device__ int operator()(int x) const { return x * x; } };"};
+/// rocprim::jit_transform(input, output, size, int_type, int_type, square, {}, stream);
+/// \endcode
+/// \endparblock
+inline hipError_t jit_transform(const void*         input,
+                                void*               output,
+                                const size_t        size,
+                                const jit_type&     input_type,
+                                const jit_type&     output_type,
+                                const jit_operator& transform_op,
+                                const jit_options&  options = jit_options(),
+                                const hipStream_t   stream  = 0)
+{
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    detail::target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(detail::host_target_arch(stream, target_arch));
+    const detail::transform_config_params params
+        = detail::jit_params_for_size<detail::jit_default_transform_config,
+                                      detail::transform_config_params>(output_type.size,
+                                                                       target_arch);
+    const unsigned int block_size = params.kernel_config.block_size;
+    const unsigned int items_per_thread
+        = detail::jit_items_per_thread(params.kernel_config, output_type.size);
+    const unsigned int items_per_block = block_size * items_per_thread;
+
+    hipFunction_t kernel;
+    ROCPRIM_RETURN_ON_ERROR(detail::jit_kernel_cache::instance().get(
+        detail::jit_transform_source(input_type,
+                                     output_type,
+                                     transform_op,
+                                     block_size,
+                                     items_per_thread),
+        "rocprim_jit_transform",
+        options,
+        stream,
+        kernel));
+
+    const size_t size_limit = params.kernel_config.size_limit;
+    const size_t aligned_size_limit
+        = std::max<size_t>(size_limit - size_limit % items_per_block, items_per_block);
+    for(size_t offset = 0; offset < size; offset += aligned_size_limit)
+    {
+        const void*  launch_input  = static_cast<const char*>(input) + offset * input_type.size;
+        void*        launch_output = static_cast<char*>(output) + offset * output_type.size;
+        size_t       launch_size   = std::min(size - offset, aligned_size_limit);
+        void*        arguments[]   = {&launch_input, &launch_output, &launch_size};
+        const size_t grid_size     = detail::ceiling_div(launch_size, items_per_block);
+        ROCPRIM_RETURN_ON_ERROR(hipModuleLaunchKernel(kernel,
+                                                      static_cast<unsigned int>(grid_size),
+                                                      1,
+                                                      1,
+                                                      block_size,
+                                                      1,
+                                                      1,
+                                                      0,
+                                                      stream,
+                                                      arguments,
+                                                      nullptr));
+        detail::notify_kernel_launch("rocprim_jit_transform", launch_size, stream);
+    }
+    return hipGetLastError();
+}
+
+/// \brief Reduces the items of \p input with an operator given by its source, which is compiled
+/// at run time with hipRTC.
+///
+/// \par Overview
+/// * The generation, compilation and caching of the kernel are those of \p jit_transform.
+/// * The kernel uses the tuned config of \p rocprim::reduce for the unsigned integer of the size
+///   of \p type. The blocks reduce their tiles to partial results, which are reduced again by
+///   the same kernel until one block is left.
+/// * \p reduce_op must be associative, and also commutative if the tuned config uses
+///   \p block_reduce_algorithm::raking_reduce_commutative_only.
+/// * Returns the required size of \p temporary_storage in \p storage_size if
+///   \p temporary_storage is a null pointer.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When a null
+///   pointer is passed, the required allocation size (in bytes) is written to \p storage_size and
+///   the function returns without performing the reduction.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input pointer to the \p size items of \p type on the device.
+/// \param [out] output pointer to one item of \p type on the device.
+/// \param [in] initial_value pointer to the initial value of the reduction on the host, an item
+///   of \p type.
+/// \param [in] size the number of items.
+/// \param [in] type the type of the items.
+/// \param [in] reduce_op the binary function object that reduces two items.
+/// \param [in] options the options of the compilation and of the caches.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+///
+/// \returns \p hipSuccess (\p 0) after a successful reduction, \p hipErrorInvalidImage if the
+///   compilation fails (see \p options.compile_log); otherwise a HIP runtime error of type
+///   \p hipError_t.
+inline hipError_t jit_reduce(void*               temporary_storage,
+                             size_t&             storage_size,
+                             const void*         input,
+                             void*               output,
+                             const void*         initial_value,
+                             const size_t        size,
+                             const jit_type&     type,
+                             const jit_operator& reduce_op,
+                             const jit_options&  options = jit_options(),
+                             const hipStream_t   stream  = 0)
+{
+    detail::target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(detail::host_target_arch(stream, target_arch));
+    const detail::reduce_config_params params
+        = detail::jit_params_for_size<detail::jit_default_reduce_config,
+                                      detail::reduce_config_params>(type.size, target_arch);
+    const unsigned int block_size = params.reduce_config.block_size;
+    const unsigned int items_per_thread
+        = detail::jit_items_per_thread(params.reduce_config, type.size);
+    const unsigned int items_per_block = block_size * items_per_thread;
+
+    // The partial results of the first two passes, the later passes reuse them in turns
+    const size_t first_partials  = detail::ceiling_div(size, items_per_block);
+    const size_t second_partials = detail::ceiling_div(first_partials, items_per_block);
+    void*        partials[2]     = {nullptr, nullptr};
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::make_partition(&partials[0],
+                                                 first_partials > 1 ? first_partials * type.size
+                                                                    : 0),
+            detail::temp_storage::make_partition(&partials[1],
+                                                 second_partials > 1 ? second_partials * type.size
+                                                                     : 0)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        return hipMemcpyAsync(output, initial_value, type.size, hipMemcpyHostToDevice, stream);
+    }
+
+    hipFunction_t kernel;
+    ROCPRIM_RETURN_ON_ERROR(detail::jit_kernel_cache::instance().get(
+        detail::jit_reduce_source(type,
+                                  reduce_op,
+                                  block_size,
+                                  items_per_thread,
+                                  params.block_reduce_method),
+        "rocprim_jit_reduce",
+        options,
+        stream,
+        kernel));
+
+    // The initial value is passed by value, as the bytes of the item
+    std::vector<char> initial(static_cast<const char*>(initial_value),
+                              static_cast<const char*>(initial_value) + type.size);
+
+    const void* pass_input = input;
+    size_t      pass_size  = size;
+    for(unsigned int pass = 0;; pass++)
+    {
+        const size_t grid_size     = detail::ceiling_div(pass_size, items_per_block);
+        unsigned int apply_initial = grid_size == 1 ? 1 : 0;
+        void*        pass_output   = apply_initial ? output : partials[pass % 2];
+        void*        arguments[]
+            = {&pass_input, &pass_output, &pass_size, &apply_initial, initial.data()};
+        ROCPRIM_RETURN_ON_ERROR(hipModuleLaunchKernel(kernel,
+                                                      static_cast<unsigned int>(grid_size),
+                                                      1,
+                                                      1,
+                                                      block_size,
+                                                      1,
+                                                      1,
+                                                      0,
+                                                      stream,
+                                                      arguments,
+                                                      nullptr));
+        detail::notify_kernel_launch("rocprim_jit_reduce", pass_size, stream);
+        if(apply_initial)
+        {
+            break;
+        }
+        pass_input = pass_output;
+        pass_size  = grid_size;
+    }
+    return hipGetLastError();
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_JIT_HPP_
@@ -0,0 +1,503 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_LEXICOGRAPHIC_SORT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_LEXICOGRAPHIC_SORT_HPP_
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/permutation_iterator.hpp"
+#include "../thread/radix_key_codec.hpp"
+#include "../types.hpp"
+#include "../types/integer_sequence.hpp"
+#include "../types/tuple.hpp"
+
+#include "config_types.hpp"
+#include "device_adjacent_find.hpp"
+#include "device_radix_sort.hpp"
+#include "device_transform.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Compares the keys by their radix encoding, which is what the sort orders them by. This tells
+// apart, for example, negative and positive zeros.
+template<class Key, bool Equal>
+struct lexicographic_sort_key_compare
+{
+    ROCPRIM_HOST_DEVICE
+    bool operator()(const Key& lhs, const Key& rhs) const
+    {
+        using codec = ::rocprim::radix_key_codec<Key>;
+        return (codec::encode(lhs) == codec::encode(rhs)) == Equal;
+    }
+};
+
+// Sorts one column by its keys at the positions of `permutation`, stably, and writes the
+// sorted keys to its output and the new permutation to `next_permutation`.
+template<class Config, bool Descending>
+struct lexicographic_sort_pass
+{
+    void*               storage;
+    size_t              storage_size;
+    const unsigned int* permutation;
+    unsigned int*       next_permutation;
+    unsigned int        size;
+    hipStream_t         stream;
+    bool                debug_synchronous;
+
+    template<class KeysInputIterator, class KeysOutputIterator>
+    hipError_t operator()(KeysInputIterator keys_input, KeysOutputIterator keys_output)
+    {
+        using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+        bool ignored;
+        return radix_sort_impl<Config, Descending>(
+            storage,
+            storage_size,
+            ::rocprim::make_permutation_iterator(keys_input, permutation),
+            nullptr,
+            keys_output,
+            permutation,
+            nullptr,
+            next_permutation,
+            size,
+            ignored,
+            identity_decomposer{},
+            0,
+            8 * sizeof(key_type),
+            stream,
+            debug_synchronous);
+    }
+};
+
+// Writes to `found` the position of the first key that is equal to (or, if `Equal` is false,
+// differs from) the next one, or the size if there is none.
+template<bool Equal>
+struct lexicographic_sort_find
+{
+    void*       storage;
+    size_t      storage_size;
+    size_t*     found;
+    size_t      size;
+    hipStream_t stream;
+    bool        debug_synchronous;
+
+    template<class KeysInputIterator, class KeysOutputIterator>
+    hipError_t operator()(KeysInputIterator keys_input, KeysOutputIterator)
+    {
+        using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+        return ::rocprim::adjacent_find(storage,
+                                        storage_size,
+                                        keys_input,
+                                        found,
+                                        size,
+                                        lexicographic_sort_key_compare<key_type, Equal>(),
+                                        stream,
+                                        debug_synchronous);
+    }
+};
+
+// Writes the keys of one column at the positions of `permutation` to its output, or copies them
+// if there is no permutation.
+struct lexicographic_sort_gather
+{
+    const unsigned int* permutation;
+    size_t              size;
+    hipStream_t         stream;
+    bool                debug_synchronous;
+
+    template<class KeysInputIterator, class KeysOutputIterator>
+    hipError_t operator()(KeysInputIterator keys_input, KeysOutputIterator keys_output)
+    {
+        using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+        if(permutation == nullptr)
+        {
+            return ::rocprim::transform(keys_input,
+                                        keys_output,
+                                        size,
+                                        ::rocprim::identity<key_type>(),
+                                        stream,
+                                        debug_synchronous);
+        }
+        return ::rocprim::transform(::rocprim::make_permutation_iterator(keys_input, permutation),
+                                    keys_output,
+                                    size,
+                                    ::rocprim::identity<key_type>(),
+                                    stream,
+                                    debug_synchronous);
+    }
+};
+
+// Calls `function(input, output)` with the input and the output of the column `column`.
+template<class... KeysInputIterators,
+         class... KeysOutputIterators,
+         class Function,
+         size_t... Columns>
+hipError_t lexicographic_sort_column(const ::rocprim::tuple<KeysInputIterators...>&  keys_inputs,
+                                     const ::rocprim::tuple<KeysOutputIterators...>& keys_outputs,
+                                     const size_t                                    column,
+                                     Function&                                       function,
+                                     ::rocprim::index_sequence<Columns...>)
+{
+    hipError_t result = hipSuccess;
+    const int  expand[]
+        = {0,
+           (result = Columns == column ? function(::rocprim::get<Columns>(keys_inputs),
+                                                  ::rocprim::get<Columns>(keys_outputs))
+                                       : result,
+            0)...};
+    (void)expand;
+    return result;
+}
+
+template<class Config, bool Descending, class... KeysInputIterators, class... KeysOutputIterators>
+hipError_t
+    lexicographic_sort_impl(void*                                           temporary_storage,
+                            size_t&                                         storage_size,
+                            const ::rocprim::tuple<KeysInputIterators...>&  keys_inputs,
+                            const ::rocprim::tuple<KeysOutputIterators...>& keys_outputs,
+                            const size_t                                    size,
+                            const bool                                      stop_when_unique,
+                            const hipStream_t                               stream,
+                            const bool                                      debug_synchronous)
+{
+    constexpr size_t columns = sizeof...(KeysInputIterators);
+    static_assert(columns != 0, "At least one key column is required.");
+    static_assert(columns == sizeof...(KeysOutputIterators),
+                  "Every key column must have an input and an output.");
+
+    using column_indices = ::rocprim::index_sequence_for<KeysInputIterators...>;
+
+    // The payload of the sort passes is a 32-bit permutation.
+    if(size > std::numeric_limits<unsigned int>::max())
+    {
+        return hipErrorInvalidValue;
+    }
+
+    lexicographic_sort_pass<Config, Descending> pass{nullptr,
+                                                     0,
+                                                     nullptr,
+                                                     nullptr,
+                                                     static_cast<unsigned int>(size),
+                                                     stream,
+                                                     debug_synchronous};
+    lexicographic_sort_find<false> find_change{nullptr,
+                                               0,
+                                               nullptr,
+                                               size,
+                                               stream,
+                                               debug_synchronous};
+    lexicographic_sort_find<true>  find_duplicate{nullptr,
+                                                 0,
+                                                 nullptr,
+                                                 size,
+                                                 stream,
+                                                 debug_synchronous};
+
+    // The nested storage is shared by all steps, so it holds the largest of them.
+    size_t nested_size = 0;
+    for(size_t column = 0; column < columns; ++column)
+    {
+        ROCPRIM_RETURN_ON_ERROR(
+            lexicographic_sort_column(keys_inputs, keys_outputs, column, pass, column_indices{}));
+        ROCPRIM_RETURN_ON_ERROR(lexicographic_sort_column(keys_inputs,
+                                                          keys_outputs,
+                                                          column,
+                                                          find_change,
+                                                          column_indices{}));
+        nested_size = std::max({nested_size, pass.storage_size, find_change.storage_size});
+    }
+    ROCPRIM_RETURN_ON_ERROR(
+        find_duplicate(::rocprim::make_permutation_iterator(::rocprim::get<0>(keys_inputs),
+                                                            pass.permutation),
+                       ::rocprim::get<0>(keys_outputs)));
+    nested_size = std::max(nested_size, find_duplicate.storage_size);
+
+    void*         nested_storage;
+    unsigned int* permutation;
+    unsigned int* next_permutation;
+    size_t*       found;
+
+    const hipError_t partition_result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::make_partition(&nested_storage, nested_size),
+            temp_storage::ptr_aligned_array(&permutation, size),
+            temp_storage::ptr_aligned_array(&next_permutation, size),
+            temp_storage::ptr_aligned_array(&found, columns + 1)));
+
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    pass.storage           = nested_storage;
+    find_change.storage    = nested_storage;
+    find_duplicate.storage = nested_storage;
+
+    // A constant column does not change the order, so it needs no sort pass.
+    std::vector<size_t> changes(columns);
+    for(size_t column = 0; column < columns; ++column)
+    {
+        find_change.storage_size = nested_size;
+        find_change.found        = found + column;
+        ROCPRIM_RETURN_ON_ERROR(lexicographic_sort_column(keys_inputs,
+                                                          keys_outputs,
+                                                          column,
+                                                          find_change,
+                                                          column_indices{}));
+    }
+    ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(changes.data(),
+                                           found,
+                                           sizeof(size_t) * columns,
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+    ROCPRIM_RETURN_ON_ERROR(hipStreamSynchronize(stream));
+
+    ROCPRIM_RETURN_ON_ERROR(::rocprim::transform(counting_iterator<unsigned int>(0),
+                                                 permutation,
+                                                 size,
+                                                 ::rocprim::identity<unsigned int>(),
+                                                 stream,
+                                                 debug_synchronous));
+
+    // The output of the last sorted column already holds its result.
+    size_t     last_sorted = columns;
+    const auto sort_column = [&](const size_t column) -> hipError_t
+    {
+        pass.storage_size     = nested_size;
+        pass.permutation      = permutation;
+        pass.next_permutation = next_permutation;
+        ROCPRIM_RETURN_ON_ERROR(
+            lexicographic_sort_column(keys_inputs, keys_outputs, column, pass, column_indices{}));
+        std::swap(permutation, next_permutation);
+        last_sorted = column;
+        return hipSuccess;
+    };
+
+    // The first column alone decides the order when it has no duplicates. Otherwise its pass is
+    // discarded, and the identity permutation it read is used again.
+    bool sorted = false;
+    if(stop_when_unique && changes[0] != size)
+    {
+        ROCPRIM_RETURN_ON_ERROR(sort_column(0));
+
+        size_t duplicate;
+        find_duplicate.storage_size = nested_size;
+        find_duplicate.found        = found + columns;
+        ROCPRIM_RETURN_ON_ERROR(
+            find_duplicate(::rocprim::make_permutation_iterator(::rocprim::get<0>(keys_inputs),
+                                                                permutation),
+                           ::rocprim::get<0>(keys_outputs)));
+        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(&duplicate,
+                                               found + columns,
+                                               sizeof(size_t),
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+        ROCPRIM_RETURN_ON_ERROR(hipStreamSynchronize(stream));
+
+        sorted = duplicate == size;
+        if(!sorted)
+        {
+            std::swap(permutation, next_permutation);
+            last_sorted = columns;
+        }
+    }
+
+    // Stable passes from the least to the most significant column.
+    for(size_t column = columns; !sorted && column-- > 0;)
+    {
+        if(changes[column] != size)
+        {
+            ROCPRIM_RETURN_ON_ERROR(sort_column(column));
+        }
+    }
+
+    lexicographic_sort_gather gather{nullptr, size, stream, debug_synchronous};
+    for(size_t column = 0; column < columns; ++column)
+    {
+        if(column != last_sorted)
+        {
+            gather.permutation = changes[column] != size ? permutation : nullptr;
+            ROCPRIM_RETURN_ON_ERROR(lexicographic_sort_column(keys_inputs,
+                                                              keys_outputs,
+                                                              column,
+                                                              gather,
+                                                              column_indices{}));
+        }
+    }
+
+    return hipSuccess;
+}
+
+} // end namespace detail
+
+/// \brief Parallel ascending lexicographic sort of several key columns.
+///
+/// \par Overview
+/// * Sorts the rows formed by the items at the same position of every key column, comparing the
+///   first column first, then the second column for equal first keys, and so on. The columns
+///   can have different key types, each ordered like \p radix_sort_keys orders it.
+/// * The rows are ordered by a stable radix sort of every column, from the last to the first,
+///   that carries a 32-bit permutation. The sorted columns are then gathered with it.
+/// * Columns in which all keys are equal need no sort pass and are copied. Finding them
+///   synchronizes \p stream once.
+/// * When \p stop_when_unique is set and the keys of the first column are all different, the
+///   first column alone decides the order, and the sort finishes after its pass. Otherwise that
+///   pass is repeated as the last one. Checking this synchronizes \p stream once more.
+/// * The sort is \b stable: it preserves the relative ordering of equal rows.
+/// * When \p temporary_storage is a null pointer, the required allocation size (in bytes) is
+///   written to \p storage_size and the function returns without performing the sort.
+///
+/// \tparam Config [optional] Configuration of the sort passes. <tt>radix_sort_config</tt> or
+/// <tt>default_config</tt>.
+/// \tparam KeysInputIterators random-access iterator types of the input key columns. Their
+/// value types must be supported by \p radix_sort_keys without a decomposer.
+/// \tparam KeysOutputIterators random-access iterator types of the output key columns.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and the function returns without performing the sort.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_inputs tuple of iterators to the input key columns, the most significant
+/// first.
+/// \param [out] keys_outputs tuple of iterators to the output key columns. The outputs must
+/// not overlap the inputs.
+/// \param [in] size number of keys in every column. Must not exceed the range of
+/// <tt>unsigned int</tt>, otherwise <tt>hipErrorInvalidValue</tt> is returned.
+/// \param [in] stop_when_unique [optional] whether the first column is tried on its own.
+/// Default value is \p false.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example rows of an integer and a floating-point column are sorted.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;       // e.g., 6
+/// int*   ids_input;  // e.g., [2, 1, 2, 1,  2, 0]
+/// float* tag_input;  // e.g., [3, 5, 1, 4, -1, 7]
+/// int*   ids_output; // empty array of 6 elements
+/// float* tag_output; // empty array of 6 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void*  temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::lexicographic_sort(temporary_storage_ptr,
+///                             temporary_storage_size_bytes,
+///                             rocprim::make_tuple(ids_input, tag_input),
+///                             rocprim::make_tuple(ids_output, tag_output),
+///                             size);
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::lexicographic_sort(temporary_storage_ptr,
+///                             temporary_storage_size_bytes,
+///                             rocprim::make_tuple(ids_input, tag_input),
+///                             rocprim::make_tuple(ids_output, tag_output),
+///                             size);
+/// // ids_output: [0, 1, 1,  2, 2, 2]
+/// // tag_output: [7, 4, 5, -1, 1, 3]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class... KeysInputIterators, class... KeysOutputIterators>
+hipError_t
+    lexicographic_sort(void*                                    temporary_storage,
+                       size_t&                                  storage_size,
+                       ::rocprim::tuple<KeysInputIterators...>  keys_inputs,
+                       ::rocprim::tuple<KeysOutputIterators...> keys_outputs,
+                       size_t                                   size,
+                       bool                                     stop_when_unique  = false,
+                       hipStream_t                              stream            = 0,
+                       bool                                     debug_synchronous = false)
+{
+    return detail::lexicographic_sort_impl<Config, false>(temporary_storage,
+                                                          storage_size,
+                                                          keys_inputs,
+                                                          keys_outputs,
+                                                          size,
+                                                          stop_when_unique,
+                                                          stream,
+                                                          debug_synchronous);
+}
+
+/// \brief Parallel descending lexicographic sort of several key columns.
+///
+/// Same as \p lexicographic_sort, but orders every column in descending order. The sort is
+/// \b stable.
+template<class Config = default_config, class... KeysInputIterators, class... KeysOutputIterators>
+hipError_t
+    lexicographic_sort_desc(void*                                    temporary_storage,
+                            size_t&                                  storage_size,
+                            ::rocprim::tuple<KeysInputIterators...>  keys_inputs,
+                            ::rocprim::tuple<KeysOutputIterators...> keys_outputs,
+                            size_t                                   size,
+                            bool                                     stop_when_unique  = false,
+                            hipStream_t                              stream            = 0,
+                            bool                                     debug_synchronous = false)
+{
+    return detail::lexicographic_sort_impl<Config, true>(temporary_storage,
+                                                         storage_size,
+                                                         keys_inputs,
+                                                         keys_outputs,
+                                                         size,
+                                                         stop_when_unique,
+                                                         stream,
+                                                         debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_LEXICOGRAPHIC_SORT_HPP_
@@ -0,0 +1,279 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_DEVICE_LOAD_BALANCING_SEARCH_HPP_
+#define ROCPRIM_DEVICE_DEVICE_LOAD_BALANCING_SEARCH_HPP_
+
+#include "../block/block_load_balancing_search.hpp"
+#include "../config.hpp"
+#include "../intrinsics/thread.hpp"
+#include "../iterator/discard_iterator.hpp"
+
+#include "device_for_each.hpp"
+#include "device_transform_config.hpp"
+
+#include <limits>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Config,
+         class OffsetT,
+         class SegmentOffsetsIterator,
+         class SegmentIdsIterator,
+         class RanksIterator>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void load_balancing_search_kernel(SegmentOffsetsIterator segment_offsets,
+                                  const OffsetT          num_segments,
+                                  const OffsetT          total_work,
+                                  SegmentIdsIterator     segment_ids,
+                                  RanksIterator          ranks,
+                                  const size_t           launch_offset)
+{
+    constexpr kernel_config_params params           = device_params<Config>().kernel_config;
+    constexpr unsigned int         block_size       = params.block_size;
+    constexpr unsigned int         items_per_thread = params.items_per_thread;
+    using search_type = block_load_balancing_search<block_size, items_per_thread, OffsetT>;
+
+    ROCPRIM_SHARED_MEMORY typename search_type::storage_type storage;
+
+    const OffsetT tile_index
+        = static_cast<OffsetT>(launch_offset / search_type::items_per_tile) + blockIdx.x;
+
+    OffsetT       tile_segment_ids[items_per_thread];
+    OffsetT       tile_ranks[items_per_thread];
+    OffsetT       work_begin;
+    const OffsetT work_items = search_type().search(segment_offsets,
+                                                    num_segments,
+                                                    total_work,
+                                                    tile_index,
+                                                    tile_segment_ids,
+                                                    tile_ranks,
+                                                    work_begin,
+                                                    storage);
+
+    const unsigned int flat_id = ::rocprim::flat_block_thread_id();
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < items_per_thread; ++i)
+    {
+        const OffsetT item = flat_id * items_per_thread + i;
+        if(item < work_items)
+        {
+            segment_ids[work_begin + item] = tile_segment_ids[i];
+            ranks[work_begin + item]       = tile_ranks[i];
+        }
+    }
+}
+
+template<class Config,
+         class OffsetT,
+         class SegmentOffsetsIterator,
+         class SegmentIdsIterator,
+         class RanksIterator>
+inline hipError_t load_balancing_search_impl(SegmentOffsetsIterator segment_offsets,
+                                             const size_t           num_segments,
+                                             const size_t           total_work,
+                                             SegmentIdsIterator     segment_ids,
+                                             RanksIterator          ranks,
+                                             const hipStream_t      stream,
+                                             const bool             debug_synchronous)
+{
+    using config = wrapped_transform_config<Config, OffsetT>;
+
+    if(total_work == 0)
+    {
+        return hipSuccess;
+    }
+    return for_each_launch<config>(
+        num_segments + total_work,
+        "load_balancing_search_kernel",
+        [&](const dim3 grid_size, const dim3 block_size, const size_t offset)
+        {
+            load_balancing_search_kernel<config, OffsetT>
+                <<<grid_size, block_size, 0, stream>>>(segment_offsets,
+                                                       static_cast<OffsetT>(num_segments),
+                                                       static_cast<OffsetT>(total_work),
+                                                       segment_ids,
+                                                       ranks,
+                                                       offset);
+        },
+        stream,
+        debug_synchronous);
+}
+
+template<class Config,
+         class SegmentOffsetsIterator,
+         class SegmentIdsIterator,
+         class RanksIterator>
+inline hipError_t load_balancing_search_dispatch(SegmentOffsetsIterator segment_offsets,
+                                                 const size_t           num_segments,
+                                                 const size_t           total_work,
+                                                 SegmentIdsIterator     segment_ids,
+                                                 RanksIterator          ranks,
+                                                 const hipStream_t      stream,
+                                                 const bool             debug_synchronous)
+{
+    // 32-bit offsets halve the shared memory of a tile, if they hold the merged sequence
+    if(num_segments + total_work <= std::numeric_limits<unsigned int>::max())
+    {
+        return load_balancing_search_impl<Config, unsigned int>(segment_offsets,
+                                                                num_segments,
+                                                                total_work,
+                                                                segment_ids,
+                                                                ranks,
+                                                                stream,
+                                                                debug_synchronous);
+    }
+    return load_balancing_search_impl<Config, size_t>(segment_offsets,
+                                                      num_segments,
+                                                      total_work,
+                                                      segment_ids,
+                                                      ranks,
+                                                      stream,
+                                                      debug_synchronous);
+}
+
+} // end of detail namespace
+
+/// \brief Parallel load-balancing search primitive for device level.
+///
+/// load_balancing_search maps every work item to the segment that produces it. The work of the
+/// segments is given by their begin offsets, the exclusive scan of the numbers of work items of
+/// the segments, for example the row offsets of a CSR matrix: the work item \p w belongs to the
+/// last segment whose begin offset is not greater than \p w. This expands segments into their
+/// work items for SpMV, graph frontier expansion or ragged gathers.
+///
+/// \par Overview
+/// * Every block processes one tile of the merged sequence of the segment begins and the work
+/// items, found by a merge-path search, so the blocks are balanced however the work is
+/// distributed over the segments, see \p block_load_balancing_search. No temporary storage is
+/// needed.
+/// * The begin offsets must be non-decreasing and the first must be \p 0.
+/// * The launch is sized by the config, like the launch of \p transform.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config
+/// or a class derived from it.
+/// \tparam SegmentOffsetsIterator - random-access iterator type of the begin offsets of the
+/// segments. It can be a simple pointer type.
+/// \tparam SegmentIdsIterator - random-access iterator type of the output. It can be a simple
+/// pointer type.
+///
+/// \param [in] segment_offsets - iterator to the begin offsets of the segments.
+/// \param [in] num_segments - number of segments.
+/// \param [in] total_work - number of work items of all segments.
+/// \param [out] segment_ids - iterator to the segment of every work item, \p total_work items.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// unsigned int * offsets;     // e.g., [0, 2, 2, 5]
+/// size_t num_segments;        // e.g., 4
+/// size_t total_work;          // e.g., 6
+/// unsigned int * segment_ids; // e.g., empty array of 6 elements
+///
+/// rocprim::load_balancing_search(offsets, num_segments, total_work, segment_ids);
+/// // segment_ids: [0, 0, 2, 2, 2, 3]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class SegmentOffsetsIterator, class SegmentIdsIterator>
+inline hipError_t load_balancing_search(SegmentOffsetsIterator segment_offsets,
+                                        const size_t           num_segments,
+                                        const size_t           total_work,
+                                        SegmentIdsIterator     segment_ids,
+                                        const hipStream_t      stream            = 0,
+                                        bool                   debug_synchronous = false)
+{
+    return detail::load_balancing_search_dispatch<Config>(segment_offsets,
+                                                          num_segments,
+                                                          total_work,
+                                                          segment_ids,
+                                                          discard_iterator(),
+                                                          stream,
+                                                          debug_synchronous);
+}
+
+/// \brief Parallel load-balancing search primitive for device level, which also returns the
+/// rank of every work item within its segment.
+///
+/// Same as \p load_balancing_search, and the rank of the work item \p w in its segment \p s,
+/// <tt>w - segment_offsets[s]</tt>, is written to \p ranks.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config
+/// or a class derived from it.
+/// \tparam SegmentOffsetsIterator - random-access iterator type of the begin offsets of the
+/// segments. It can be a simple pointer type.
+/// \tparam SegmentIdsIterator - random-access iterator type of the segment ids. It can be a
+/// simple pointer type.
+/// \tparam RanksIterator - random-access iterator type of the ranks. It can be a simple
+/// pointer type.
+///
+/// \param [in] segment_offsets - iterator to the begin offsets of the segments.
+/// \param [in] num_segments - number of segments.
+/// \param [in] total_work - number of work items of all segments.
+/// \param [out] segment_ids - iterator to the segment of every work item, \p total_work items.
+/// \param [out] ranks - iterator to the rank of every work item, \p total_work items.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class SegmentOffsetsIterator,
+         class SegmentIdsIterator,
+         class RanksIterator>
+inline hipError_t load_balancing_search_with_ranks(SegmentOffsetsIterator segment_offsets,
+                                                   const size_t           num_segments,
+                                                   const size_t           total_work,
+                                                   SegmentIdsIterator     segment_ids,
+                                                   RanksIterator          ranks,
+                                                   const hipStream_t      stream = 0,
+                                                   bool                   debug_synchronous
+                                                   = false)
+{
+    return detail::load_balancing_search_dispatch<Config>(segment_offsets,
+                                                          num_segments,
+                                                          total_work,
+                                                          segment_ids,
+                                                          ranks,
+                                                          stream,
+                                                          debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_LOAD_BALANCING_SEARCH_HPP_
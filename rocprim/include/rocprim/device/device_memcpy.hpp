@@ -23,6 +23,7 @@
 
 #include "../config.hpp"
 #include "../functional.hpp"
+#include "../iterator/transform_iterator.hpp"
 
 #include "config_types.hpp"
 
@@ -142,6 +143,126 @@ ROCPRIM_INLINE static hipError_t batch_memcpy(void*              temporary_stora
             debug_synchronous);
 }
 
+/// \brief Set `sizes[i]` bytes of `destinations[i]` to `values[i]` for all `i` in the range [0, `num_memsets`].
+///
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `batch_memcpy_config`.
+/// \tparam OutputBufferItType type of iterator to destination pointers.
+/// \tparam ValueItType type of iterator to the byte values.
+/// \tparam BufferSizeItType type of iterator to sizes.
+///
+/// \param [in] temporary_storage pointer to device-accessible temporary storage.
+/// When a null pointer is passed, the required allocation size in bytes is written to
+/// `storage_size` and the function returns without performing the memset.
+/// \param [in, out] storage_size reference to the size in bytes of `temporary_storage`.
+/// \param [in] destinations iterator of destination pointers.
+/// \param [in] values iterator of the byte values to set, converted to `unsigned char`.
+/// \param [in] sizes iterator of range sizes in bytes.
+/// \param [in] num_memsets number of ranges to set
+/// \param [in] stream [optional] HIP stream object to enqueue the memset on. Default is `hipStreamDefault`.
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is `false`.
+///
+/// Performs multiple device memsets as a single batched operation.
+/// Roughly equivalent to
+/// \code{.cpp}
+/// for (auto i = 0; i < num_memsets; ++i) {
+///     hipMemsetAsync(destinations[i], values[i], sizes[i], stream);
+/// }
+/// \endcode
+/// except executed on the device in parallel. The iterators are read on the device, so
+/// the ranges can be produced by a previous kernel on the same stream.
+/// Destinations overlapping with other destinations is not allowed, and will result in
+/// undefined behaviour.
+template<class Config_ = default_config,
+         class OutputBufferItType,
+         class ValueItType,
+         class BufferSizeItType>
+ROCPRIM_INLINE static hipError_t batch_memset(void*              temporary_storage,
+                                              size_t&            storage_size,
+                                              OutputBufferItType destinations,
+                                              ValueItType        values,
+                                              BufferSizeItType   sizes,
+                                              uint32_t           num_memsets,
+                                              hipStream_t        stream = hipStreamDefault,
+                                              bool               debug_synchronous = false)
+{
+    return detail::batch_fill_func<Config_>(
+        temporary_storage,
+        storage_size,
+        make_transform_iterator(destinations, detail::batch_memset_destination_op{}),
+        make_transform_iterator(values, detail::batch_memset_value_op{}),
+        sizes,
+        num_memsets,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Copy `heights[i]` rows of `widths[i]` bytes from `sources[i]` to `destinations[i]`
+/// for all `i` in the range [0, `num_copies`], where the rows of a copy are
+/// `source_pitches[i]` bytes apart in the source and `destination_pitches[i]` bytes apart
+/// in the destination.
+///
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `batch_memcpy_config`.
+/// Only `blev_block_size` is used, the rows of a copy are copied by the warps of a block.
+/// \tparam InputBufferItType type of iterator to source pointers.
+/// \tparam InputPitchItType type of iterator to source pitches.
+/// \tparam OutputBufferItType type of iterator to destination pointers.
+/// \tparam OutputPitchItType type of iterator to destination pitches.
+/// \tparam WidthItType type of iterator to row widths.
+/// \tparam HeightItType type of iterator to row counts.
+///
+/// \param [in] sources iterator of source pointers.
+/// \param [in] source_pitches iterator of the distances in bytes between the source rows.
+/// \param [in] destinations iterator of destination pointers.
+/// \param [in] destination_pitches iterator of the distances in bytes between the destination rows.
+/// \param [in] widths iterator of the widths in bytes of the rows.
+/// \param [in] heights iterator of the numbers of rows.
+/// \param [in] num_copies number of 2D copies
+/// \param [in] stream [optional] HIP stream object to enqueue the copy on. Default is `hipStreamDefault`.
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is `false`.
+///
+/// Performs multiple device to device 2D memory copies as a single kernel launch without
+/// temporary storage. Roughly equivalent to
+/// \code{.cpp}
+/// for (auto i = 0; i < num_copies; ++i) {
+///     hipMemcpy2DAsync(destinations[i], destination_pitches[i],
+///                      sources[i], source_pitches[i],
+///                      widths[i], heights[i], hipMemcpyDeviceToDevice, stream);
+/// }
+/// \endcode
+/// except executed on the device in parallel. The iterators are read on the device, so
+/// the descriptors of the copies can be produced by a previous kernel on the same stream,
+/// e.g. the pages of a gather. Destinations overlapping with sources or other destinations is
+/// not allowed, and will result in undefined behaviour.
+template<class Config_ = default_config,
+         class InputBufferItType,
+         class InputPitchItType,
+         class OutputBufferItType,
+         class OutputPitchItType,
+         class WidthItType,
+         class HeightItType>
+ROCPRIM_INLINE static hipError_t batch_memcpy_2d(InputBufferItType  sources,
+                                                 InputPitchItType   source_pitches,
+                                                 OutputBufferItType destinations,
+                                                 OutputPitchItType  destination_pitches,
+                                                 WidthItType        widths,
+                                                 HeightItType       heights,
+                                                 uint32_t           num_copies,
+                                                 hipStream_t        stream = hipStreamDefault,
+                                                 bool               debug_synchronous = false)
+{
+    return detail::batch_memcpy_2d_func<Config_>(sources,
+                                                 source_pitches,
+                                                 destinations,
+                                                 destination_pitches,
+                                                 widths,
+                                                 heights,
+                                                 num_copies,
+                                                 stream,
+                                                 debug_synchronous);
+}
+
 END_ROCPRIM_NAMESPACE
 
 #endif
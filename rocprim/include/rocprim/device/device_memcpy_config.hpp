@@ -73,6 +73,42 @@ struct batch_memcpy_config
 #endif
 };
 
+/// \brief Configuration of `batch_memcpy` for sources or destinations that are not local to the
+/// device, i.e. in the memory of a peer device (xGMI) or in pinned host memory (PCIe).
+///
+/// Every access of such memory is a transaction over the link, so the copies are routed to the
+/// 16-byte vector loads and stores of the warp-level copy for all but the smallest buffers,
+/// instead of the byte accesses of the thread-level copy. Only large buffers are split over
+/// blocks, in larger tiles, which keeps fewer requests in flight over the link.
+///
+/// The location is a property of the whole batch: the descriptors are read on the device, so
+/// they cannot be classified by memory location on the host. Batches mixing local and remote
+/// buffers are copied correctly with either configuration.
+///
+/// \tparam NonBlevBlockSize - number of threads per block for thread- and warp-level copy.
+/// \tparam NonBlevBuffersPerThreaed - number of buffers processed per thread.
+/// \tparam TlevBytesPerThread - number of bytes per thread for thread-level copy.
+/// \tparam BlevBlockSize - number of thread per block for block-level copy.
+/// \tparam BlevBytesPerThread - number of bytes per thread for block-level copy.
+/// \tparam WlevSizeThreshold - minimum size to use warp-level copy instead of thread-level.
+/// \tparam BlevSizeThreshold - minimum size to use block-level copy instead of warp-level.
+template<unsigned int NonBlevBlockSize         = 256,
+         unsigned int NonBlevBuffersPerThreaed = 2,
+         unsigned int TlevBytesPerThread       = 8,
+         unsigned int BlevBlockSize            = 256,
+         unsigned int BlevBytesPerThread       = 64,
+         unsigned int WlevSizeThreshold        = 16,
+         unsigned int BlevSizeThreshold        = 16384>
+struct batch_memcpy_remote_config
+    : public batch_memcpy_config<NonBlevBlockSize,
+                                 NonBlevBuffersPerThreaed,
+                                 TlevBytesPerThread,
+                                 BlevBlockSize,
+                                 BlevBytesPerThread,
+                                 WlevSizeThreshold,
+                                 BlevSizeThreshold>
+{};
+
 END_ROCPRIM_NAMESPACE
 
 /// @}
@@ -21,6 +21,7 @@
 #ifndef ROCPRIM_DEVICE_DEVICE_MERGE_HPP_
 #define ROCPRIM_DEVICE_DEVICE_MERGE_HPP_
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 #include <type_traits>
@@ -98,6 +99,146 @@ void merge_kernel(IndexIterator        index,
         compare_function);
 }
 
+template<class Config,
+         bool SmallIsFirst,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+__launch_bounds__(device_params<Config>().kernel_config.block_size)
+void merge_unbalanced_rank_kernel(unsigned int*        ranks,
+                                  KeysInputIterator1   small_keys,
+                                  KeysInputIterator2   big_keys,
+                                  KeysOutputIterator   keys_output,
+                                  ValuesInputIterator  small_values,
+                                  ValuesOutputIterator values_output,
+                                  const unsigned int   small_size,
+                                  const unsigned int   big_size,
+                                  BinaryFunction       compare_function)
+{
+    merge_unbalanced_rank_kernel_impl<SmallIsFirst>(ranks,
+                                                    small_keys,
+                                                    big_keys,
+                                                    keys_output,
+                                                    small_values,
+                                                    values_output,
+                                                    small_size,
+                                                    big_size,
+                                                    compare_function);
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+ROCPRIM_KERNEL
+__launch_bounds__(device_params<Config>().kernel_config.block_size)
+void merge_unbalanced_copy_kernel(const unsigned int*  ranks,
+                                  KeysInputIterator    big_keys,
+                                  KeysOutputIterator   keys_output,
+                                  ValuesInputIterator  big_values,
+                                  ValuesOutputIterator values_output,
+                                  const unsigned int   small_size,
+                                  const unsigned int   big_size)
+{
+    static constexpr merge_config_params params = device_params<Config>();
+    merge_unbalanced_copy_kernel_impl<params.kernel_config.block_size,
+                                      params.kernel_config.items_per_thread>(ranks,
+                                                                             big_keys,
+                                                                             keys_output,
+                                                                             big_values,
+                                                                             values_output,
+                                                                             small_size,
+                                                                             big_size);
+}
+
+/// Merges inputs whose sizes differ by at least \p merge_unbalanced_ratio. Every item of the
+/// smaller input gallops to its rank in the larger input and is written out directly, then the
+/// larger input is copied in tiles, each shifted by the number of smaller-input items before it.
+template<class Config,
+         bool SmallIsFirst,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class ValuesInputIterator1,
+         class ValuesInputIterator2,
+         class ValuesOutputIterator,
+         class BinaryFunction>
+inline hipError_t merge_unbalanced_impl(const merge_config_params& params,
+                                        unsigned int*              ranks,
+                                        KeysInputIterator1         small_keys,
+                                        KeysInputIterator2         big_keys,
+                                        KeysOutputIterator         keys_output,
+                                        ValuesInputIterator1       small_values,
+                                        ValuesInputIterator2       big_values,
+                                        ValuesOutputIterator       values_output,
+                                        const unsigned int         small_size,
+                                        const unsigned int         big_size,
+                                        BinaryFunction             compare_function,
+                                        const hipStream_t          stream,
+                                        bool                       debug_synchronous)
+{
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    if(small_size > 0)
+    {
+        const unsigned int rank_blocks = (small_size + block_size - 1) / block_size;
+        if(debug_synchronous)
+        {
+            std::cout << "rank blocks " << rank_blocks << '\n';
+            start = std::chrono::steady_clock::now();
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(detail::merge_unbalanced_rank_kernel<Config, SmallIsFirst>),
+            dim3(rank_blocks),
+            dim3(block_size),
+            0,
+            stream,
+            ranks,
+            small_keys,
+            big_keys,
+            keys_output,
+            small_values,
+            values_output,
+            small_size,
+            big_size,
+            compare_function);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("merge_unbalanced_rank_kernel",
+                                                    small_size,
+                                                    start);
+    }
+
+    const unsigned int copy_blocks = (big_size + items_per_block - 1) / items_per_block;
+    if(debug_synchronous)
+    {
+        std::cout << "copy blocks " << copy_blocks << '\n';
+        start = std::chrono::steady_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(detail::merge_unbalanced_copy_kernel<Config>),
+                       dim3(copy_blocks),
+                       dim3(block_size),
+                       0,
+                       stream,
+                       ranks,
+                       big_keys,
+                       keys_output,
+                       big_values,
+                       values_output,
+                       small_size,
+                       big_size);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("merge_unbalanced_copy_kernel", big_size, start);
+
+    return hipSuccess;
+}
+
 template<
     class Config,
     class KeysInputIterator1,
@@ -145,17 +286,58 @@ hipError_t merge_impl(void * temporary_storage,
     const unsigned int partitions
         = ((input1_size + input2_size) + items_per_block - 1) / items_per_block;
 
+    // Strongly unbalanced inputs store the ranks of the smaller input instead of the partitions.
+    const size_t small_size = std::min(input1_size, input2_size);
+    const size_t big_size   = std::max(input1_size, input2_size);
+    const bool   unbalanced
+        = big_size >= items_per_block && big_size / merge_unbalanced_ratio >= small_size;
+
     unsigned int* index;
 
     const hipError_t partition_result = detail::temp_storage::partition(
         temporary_storage,
         storage_size,
-        detail::temp_storage::ptr_aligned_array(&index, partitions + 1));
+        detail::temp_storage::ptr_aligned_array(&index,
+                                                unbalanced ? std::max(small_size, size_t(1))
+                                                           : partitions + 1));
     if(partition_result != hipSuccess || temporary_storage == nullptr)
     {
         return partition_result;
     }
 
+    if(unbalanced)
+    {
+        if(input1_size <= input2_size)
+        {
+            return merge_unbalanced_impl<config, true>(params,
+                                                       index,
+                                                       keys_input1,
+                                                       keys_input2,
+                                                       keys_output,
+                                                       values_input1,
+                                                       values_input2,
+                                                       values_output,
+                                                       input1_size,
+                                                       input2_size,
+                                                       compare_function,
+                                                       stream,
+                                                       debug_synchronous);
+        }
+        return merge_unbalanced_impl<config, false>(params,
+                                                    index,
+                                                    keys_input2,
+                                                    keys_input1,
+                                                    keys_output,
+                                                    values_input2,
+                                                    values_input1,
+                                                    values_output,
+                                                    input2_size,
+                                                    input1_size,
+                                                    compare_function,
+                                                    stream,
+                                                    debug_synchronous);
+    }
+
     if( partitions == 0u )
         return hipSuccess;
 
@@ -222,6 +404,8 @@ hipError_t merge_impl(void * temporary_storage,
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * Accepts custom compare_functions for merging across the device.
+/// * When one input is at least 256 times larger than the other, the items of the smaller input
+/// are located in the larger one with a galloping search and the larger input is copied in bulk.
 ///
 /// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `merge_config`.
 /// \tparam InputIterator1 - random-access iterator type of the first input range. Must meet the
@@ -326,6 +510,8 @@ hipError_t merge(void * temporary_storage,
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * Accepts custom compare_functions for merging across the device.
+/// * When one input is at least 256 times larger than the other, the items of the smaller input
+/// are located in the larger one with a galloping search and the larger input is copied in bulk.
 ///
 /// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `merge_config`.
 /// \tparam KeysInputIterator1 - random-access iterator type of the first keys input range. Must meet the
@@ -0,0 +1,395 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_MERGE_K_HPP_
+#define ROCPRIM_DEVICE_DEVICE_MERGE_K_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+#include "detail/device_merge_k.hpp"
+#include "device_merge_k_config.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Config, class KeysInputIterator, class OffsetIterator, class BinaryFunction>
+ROCPRIM_KERNEL
+__launch_bounds__(device_params<Config>().kernel_config.block_size)
+void merge_k_partition_kernel(KeysInputIterator  keys_input,
+                              OffsetIterator     begin_offsets,
+                              OffsetIterator     end_offsets,
+                              unsigned int*      splits,
+                              const unsigned int size,
+                              const unsigned int runs,
+                              const unsigned int items_per_tile,
+                              BinaryFunction     compare_function)
+{
+    static constexpr merge_config_params params = device_params<Config>();
+    merge_k_partition_kernel_impl<params.kernel_config.block_size>(keys_input,
+                                                                   begin_offsets,
+                                                                   end_offsets,
+                                                                   splits,
+                                                                   size,
+                                                                   runs,
+                                                                   items_per_tile,
+                                                                   compare_function);
+}
+
+template<class Config,
+         bool WithValues,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+__launch_bounds__(device_params<Config>().kernel_config.block_size)
+void merge_k_kernel(KeysInputIterator    keys_input,
+                    ValuesInputIterator  values_input,
+                    KeysOutputIterator   keys_output,
+                    ValuesOutputIterator values_output,
+                    OffsetIterator       begin_offsets,
+                    const unsigned int*  splits,
+                    const unsigned int   size,
+                    const unsigned int   runs,
+                    BinaryFunction       compare_function)
+{
+    static constexpr merge_config_params params = device_params<Config>();
+    merge_k_kernel_impl<params.kernel_config.block_size,
+                        params.kernel_config.items_per_thread,
+                        WithValues>(keys_input,
+                                    values_input,
+                                    keys_output,
+                                    values_output,
+                                    begin_offsets,
+                                    splits,
+                                    size,
+                                    runs,
+                                    compare_function);
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator,
+         class BinaryFunction>
+inline hipError_t merge_k_impl(void*                temporary_storage,
+                               size_t&              storage_size,
+                               KeysInputIterator    keys_input,
+                               ValuesInputIterator  values_input,
+                               KeysOutputIterator   keys_output,
+                               ValuesOutputIterator values_output,
+                               const size_t         size,
+                               const unsigned int   runs,
+                               OffsetIterator       begin_offsets,
+                               OffsetIterator       end_offsets,
+                               BinaryFunction       compare_function,
+                               const hipStream_t    stream,
+                               const bool           debug_synchronous)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using config     = wrapped_merge_k_config<Config, key_type, value_type>;
+
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    if(runs > merge_k_max_runs || size > std::numeric_limits<unsigned int>::max())
+    {
+        return hipErrorInvalidValue;
+    }
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const merge_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+    const unsigned int tiles
+        = static_cast<unsigned int>(ceiling_div<size_t>(size, items_per_block));
+
+    // The number of keys every run gives to the tiles before each tile boundary
+    unsigned int* splits = nullptr;
+
+    result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::ptr_aligned_array(&splits, size_t(tiles + 1) * runs));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    if(size == 0 || runs == 0)
+    {
+        return hipSuccess;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "size: " << size << '\n';
+        std::cout << "runs: " << runs << '\n';
+        std::cout << "block_size: " << block_size << '\n';
+        std::cout << "items_per_block: " << items_per_block << '\n';
+        std::cout << "tiles: " << tiles << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    merge_k_partition_kernel<config>
+        <<<dim3(tiles + 1), dim3(block_size), 0, stream>>>(keys_input,
+                                                           begin_offsets,
+                                                           end_offsets,
+                                                           splits,
+                                                           static_cast<unsigned int>(size),
+                                                           runs,
+                                                           items_per_block,
+                                                           compare_function);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("merge_k_partition_kernel", tiles + 1, start);
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    merge_k_kernel<config, with_values>
+        <<<dim3(tiles), dim3(block_size), 0, stream>>>(keys_input,
+                                                       values_input,
+                                                       keys_output,
+                                                       values_output,
+                                                       begin_offsets,
+                                                       splits,
+                                                       static_cast<unsigned int>(size),
+                                                       runs,
+                                                       compare_function);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("merge_k_kernel", size, start);
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Parallel multi-way merge primitive for device level.
+///
+/// \p merge_k merges \p runs sorted runs of keys into one sorted range in a single pass over
+/// memory, instead of the <tt>log2(runs)</tt> passes of pairwise merges. The output is split
+/// into tiles, and for every tile boundary the number of keys that every run gives to the tiles
+/// before it is found by a multi-sequence selection. Every tile then loads its keys once and
+/// merges them in shared memory.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The contents of the inputs are not altered by the function.
+/// * Run \p r is <tt>[keys_input + begin_offsets[r], keys_input + end_offsets[r])</tt>. Every run
+///   must be sorted by \p compare_function.
+/// * The merge is stable: equal keys are written in the order of their runs, and in the order of
+///   the run for the keys of the same run.
+/// * At most \p 1024 runs are supported, and \p size must not be larger than the largest
+///   <tt>unsigned int</tt>. Otherwise \p hipErrorInvalidValue is returned.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p merge_config or
+///   \p default_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input keys. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator [inferred] random-access iterator type of the offsets of the runs.
+///   It can be a simple pointer type.
+/// \tparam BinaryFunction [inferred] type of the comparison function object.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the merge.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input keys.
+/// \param [out] keys_output iterator to the output range. Must be able to hold \p size keys.
+/// \param [in] size total number of keys of the runs.
+/// \param [in] runs number of runs.
+/// \param [in] begin_offsets iterator to the offsets of the first keys of the runs.
+/// \param [in] end_offsets iterator to the offsets past the last keys of the runs.
+/// \param [in] compare_function [optional] comparison function object which returns true if
+///   the first argument is ordered before the second. Default is \p rocprim::less.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after a successful merge; otherwise a HIP runtime error of
+///   type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t        size;          // e.g., 8
+/// unsigned int  runs;          // e.g., 3
+/// int*          input;         // e.g., [1, 4, 7, 0, 5, 2, 3, 6]
+/// unsigned int* begin_offsets; // e.g., [0, 3, 5]
+/// unsigned int* end_offsets;   // e.g., [3, 5, 8]
+/// int*          output;        // empty array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void*  temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::merge_k(temporary_storage_ptr,
+///                  temporary_storage_size_bytes,
+///                  input,
+///                  output,
+///                  size,
+///                  runs,
+///                  begin_offsets,
+///                  end_offsets);
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform merge
+/// rocprim::merge_k(temporary_storage_ptr,
+///                  temporary_storage_size_bytes,
+///                  input,
+///                  output,
+///                  size,
+///                  runs,
+///                  begin_offsets,
+///                  end_offsets);
+/// // output: [0, 1, 2, 3, 4, 5, 6, 7]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class OffsetIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t merge_k(void*              temporary_storage,
+                          size_t&            storage_size,
+                          KeysInputIterator  keys_input,
+                          KeysOutputIterator keys_output,
+                          const size_t       size,
+                          const unsigned int runs,
+                          OffsetIterator     begin_offsets,
+                          OffsetIterator     end_offsets,
+                          BinaryFunction     compare_function  = BinaryFunction(),
+                          const hipStream_t  stream            = 0,
+                          const bool         debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::merge_k_impl<Config>(temporary_storage,
+                                        storage_size,
+                                        keys_input,
+                                        values,
+                                        keys_output,
+                                        values,
+                                        size,
+                                        runs,
+                                        begin_offsets,
+                                        end_offsets,
+                                        compare_function,
+                                        stream,
+                                        debug_synchronous);
+}
+
+/// \brief Parallel multi-way merge primitive of (key, value) pairs for device level.
+///
+/// \p merge_k merges \p runs sorted runs of keys and their values into one range sorted by the
+/// keys. The value of a key is at the same offset in \p values_input as the key in
+/// \p keys_input.
+///
+/// \tparam ValuesInputIterator [inferred] random-access iterator type of the input values.
+/// \tparam ValuesOutputIterator [inferred] random-access iterator type of the output values.
+///
+/// \param [in] values_input iterator to the input values.
+/// \param [out] values_output iterator to the output values. Must be able to hold \p size
+///   values.
+///
+/// \see merge_k
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t merge_k(void*                temporary_storage,
+                          size_t&              storage_size,
+                          KeysInputIterator    keys_input,
+                          KeysOutputIterator   keys_output,
+                          ValuesInputIterator  values_input,
+                          ValuesOutputIterator values_output,
+                          const size_t         size,
+                          const unsigned int   runs,
+                          OffsetIterator       begin_offsets,
+                          OffsetIterator       end_offsets,
+                          BinaryFunction       compare_function  = BinaryFunction(),
+                          const hipStream_t    stream            = 0,
+                          const bool           debug_synchronous = false)
+{
+    return detail::merge_k_impl<Config>(temporary_storage,
+                                        storage_size,
+                                        keys_input,
+                                        values_input,
+                                        keys_output,
+                                        values_output,
+                                        size,
+                                        runs,
+                                        begin_offsets,
+                                        end_offsets,
+                                        compare_function,
+                                        stream,
+                                        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_MERGE_K_HPP_
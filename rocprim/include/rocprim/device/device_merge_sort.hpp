@@ -33,9 +33,15 @@
 #include "detail/common.hpp"
 #include "detail/device_merge.hpp"
 #include "detail/device_merge_sort.hpp"
+#include "detail/device_merge_sort_in_place.hpp"
 #include "detail/device_merge_sort_mergepath.hpp"
 #include "device_merge_sort_config.hpp"
+#include "device_select.hpp"
 #include "device_transform.hpp"
+#include "execution_budget.hpp"
+
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_output_iterator.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -161,34 +167,255 @@ void device_block_merge_mergepath_partition_kernel(KeysInputIterator  keys,
         return;
     }
 
-    const unsigned int merged_tiles        = sorted_block_size / items_per_tile;
-    const unsigned int target_merged_tiles = merged_tiles * 2;
-    const unsigned int mask                = target_merged_tiles - 1;
+    merge_partitions[partition_id]
+        = block_merge_mergepath_partition<items_per_tile>(keys,
+                                                          input_size,
+                                                          partition_id,
+                                                          compare_op,
+                                                          sorted_block_size);
+}
+
+template<class Config,
+         class KeysIterator,
+         class ValuesIterator,
+         class OffsetT,
+         class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(
+    device_params<Config>()
+        .merge_mergepath_config
+        .block_size)
+void device_block_merge_persistent_kernel(
+    KeysIterator                                               keys,
+    typename std::iterator_traits<KeysIterator>::value_type*   keys_buffer,
+    ValuesIterator                                             values,
+    typename std::iterator_traits<ValuesIterator>::value_type* values_buffer,
+    const OffsetT                                              input_size,
+    const OffsetT                                              sorted_block_size,
+    const unsigned int                                         num_tiles,
+    BinaryFunction                                             compare_function,
+    OffsetT*                                                   merge_partitions,
+    unsigned int*                                              barrier_counter)
+{
+    static constexpr merge_sort_block_merge_config_params params = device_params<Config>();
+    block_merge_persistent_kernel_impl<params.merge_mergepath_config.block_size,
+                                       params.merge_mergepath_config.items_per_thread>(
+        keys,
+        keys_buffer,
+        values,
+        values_buffer,
+        input_size,
+        sorted_block_size,
+        num_tiles,
+        compare_function,
+        merge_partitions,
+        barrier_counter);
+}
+
+template<class Config, class KeysInputIterator, class OffsetT, class BinaryFunction>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().block_sort_config.block_size)
+void merge_sort_detect_runs_kernel(KeysInputIterator  keys_input,
+                                   const OffsetT      size,
+                                   const unsigned int num_blocks,
+                                   unsigned char*     tile_flags,
+                                   BinaryFunction     compare_function)
+{
+    static constexpr merge_sort_block_sort_config_params params = device_params<Config>();
+    merge_sort_detect_runs_kernel_impl<params.block_sort_config.block_size,
+                                       params.block_sort_config.items_per_thread>(
+        keys_input,
+        size,
+        num_blocks,
+        tile_flags,
+        compare_function);
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetT,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().block_sort_config.block_size)
+void block_sort_adaptive_kernel(KeysInputIterator    keys_input,
+                                KeysOutputIterator   keys_output,
+                                ValuesInputIterator  values_input,
+                                ValuesOutputIterator values_output,
+                                const OffsetT        size,
+                                const unsigned int   num_blocks,
+                                const unsigned char* tile_flags,
+                                BinaryFunction       compare_function)
+{
+    static constexpr merge_sort_block_sort_config_params params = device_params<Config>();
+    block_sort_adaptive_kernel_impl<params.block_sort_config.block_size,
+                                    params.block_sort_config.items_per_thread>(keys_input,
+                                                                               keys_output,
+                                                                               values_input,
+                                                                               values_output,
+                                                                               size,
+                                                                               num_blocks,
+                                                                               tile_flags,
+                                                                               compare_function);
+}
 
-    // id of the first tile in the current tile-group
-    const unsigned int tilegroup_start_id = ~mask & partition_id;
-    // id of the current tile in the current tile-group
-    const unsigned int local_tile_id = mask & partition_id;
+template<typename Config, typename KeysInputIterator, typename OffsetT, typename CompareOpT>
+ROCPRIM_KERNEL __launch_bounds__(
+    device_params<Config>()
+        .merge_mergepath_partition_config
+        .block_size)
+void device_merge_runs_partition_kernel(KeysInputIterator  keys,
+                                        const OffsetT      input_size,
+                                        const unsigned int num_partitions,
+                                        OffsetT*           merge_partitions,
+                                        const CompareOpT   compare_op,
+                                        const OffsetT*     run_offsets,
+                                        const unsigned int num_runs,
+                                        const unsigned int run_stride)
+{
+    static constexpr merge_sort_block_merge_config_params params = device_params<Config>();
+    static constexpr unsigned int                         items_per_tile
+        = params.merge_mergepath_config.block_size * params.merge_mergepath_config.items_per_thread;
 
-    // index of the first item in the current tile-group
-    const OffsetT tilegroup_start = static_cast<OffsetT>(tilegroup_start_id) * items_per_tile;
+    const unsigned int partition_id
+        = blockIdx.x * params.merge_mergepath_partition_config.block_size + threadIdx.x;
 
-    const OffsetT keys1_beg = rocprim::min(input_size, tilegroup_start);
-    const OffsetT keys1_end = rocprim::min(input_size, tilegroup_start + sorted_block_size);
-    const OffsetT keys2_beg = keys1_end;
-    const OffsetT keys2_end = rocprim::min(input_size, keys2_beg + sorted_block_size);
+    if(partition_id >= num_partitions)
+    {
+        return;
+    }
 
     const OffsetT partition_at
-        = rocprim::min(keys2_end - keys1_beg, static_cast<OffsetT>(local_tile_id) * items_per_tile);
-
-    const OffsetT partition_diag = ::rocprim::detail::merge_path(keys + keys1_beg,
-                                                                 keys + keys2_beg,
-                                                                 keys1_end - keys1_beg,
-                                                                 keys2_end - keys2_beg,
-                                                                 partition_at,
+        = rocprim::min(input_size, static_cast<OffsetT>(partition_id) * items_per_tile);
+    const range_t<OffsetT> pair = merge_runs_pair(run_offsets, num_runs, run_stride, partition_at);
+
+    const OffsetT partition_diag = ::rocprim::detail::merge_path(keys + pair.begin1,
+                                                                 keys + pair.begin2,
+                                                                 pair.count1(),
+                                                                 pair.count2(),
+                                                                 partition_at - pair.begin1,
                                                                  compare_op);
 
-    merge_partitions[partition_id] = keys1_beg + partition_diag;
+    merge_partitions[partition_id] = pair.begin1 + partition_diag;
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetT,
+         class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(
+    device_params<Config>()
+        .merge_mergepath_config
+        .block_size)
+void device_block_merge_runs_kernel(KeysInputIterator    keys_input,
+                                    KeysOutputIterator   keys_output,
+                                    ValuesInputIterator  values_input,
+                                    ValuesOutputIterator values_output,
+                                    const OffsetT        input_size,
+                                    const OffsetT*       run_offsets,
+                                    const unsigned int   num_runs,
+                                    const unsigned int   run_stride,
+                                    const unsigned int   num_blocks,
+                                    BinaryFunction       compare_function,
+                                    const OffsetT*       merge_partitions)
+{
+    static constexpr merge_sort_block_merge_config_params params = device_params<Config>();
+    block_merge_runs_kernel<params.merge_mergepath_config.block_size,
+                            params.merge_mergepath_config.items_per_thread>(keys_input,
+                                                                            keys_output,
+                                                                            values_input,
+                                                                            values_output,
+                                                                            input_size,
+                                                                            run_offsets,
+                                                                            num_runs,
+                                                                            run_stride,
+                                                                            num_blocks,
+                                                                            compare_function,
+                                                                            merge_partitions);
+}
+
+template<class Config,
+         unsigned int Step,
+         class KeysIterator,
+         class ValuesIterator,
+         class OffsetT>
+ROCPRIM_KERNEL __launch_bounds__(
+    device_params<Config>()
+        .merge_mergepath_config
+        .block_size)
+void device_merge_in_place_reverse_kernel(KeysIterator       keys,
+                                          ValuesIterator     values,
+                                          const OffsetT      input_size,
+                                          const OffsetT      sorted_block_size,
+                                          const unsigned int pieces_per_range,
+                                          const OffsetT*     merge_partitions)
+{
+    static constexpr merge_sort_block_merge_config_params params = device_params<Config>();
+    merge_in_place_reverse_kernel_impl<params.merge_mergepath_config.block_size,
+                                       params.merge_mergepath_config.block_size
+                                           * params.merge_mergepath_config.items_per_thread,
+                                       Step>(keys,
+                                             values,
+                                             input_size,
+                                             sorted_block_size,
+                                             pieces_per_range,
+                                             merge_partitions);
+}
+
+template<class Config,
+         class KeysIterator,
+         class ValuesIterator,
+         class OffsetT,
+         class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(
+    device_params<Config>()
+        .merge_mergepath_config
+        .block_size)
+void device_block_merge_in_place_kernel(KeysIterator       keys,
+                                        ValuesIterator     values,
+                                        const OffsetT      input_size,
+                                        const OffsetT      sorted_block_size,
+                                        const unsigned int num_blocks,
+                                        BinaryFunction     compare_function,
+                                        const OffsetT*     merge_partitions)
+{
+    static constexpr merge_sort_block_merge_config_params params = device_params<Config>();
+    block_merge_in_place_kernel_impl<params.merge_mergepath_config.block_size,
+                                     params.merge_mergepath_config.items_per_thread>(
+        keys,
+        values,
+        input_size,
+        sorted_block_size,
+        num_blocks,
+        compare_function,
+        merge_partitions);
+}
+
+// Inputs of at most this many items merge all levels of merge_sort_block_merge in one launch
+// when it is possible, as the launches of the levels take a large part of their time.
+constexpr size_t merge_sort_persistent_merge_size_limit = size_t(1) << 24;
+
+// Whether the levels of merge_sort_block_merge can run in one cooperative launch on stream. Graphs
+// do not capture cooperative launches, so the levels are launched one by one during a capture.
+inline hipError_t merge_sort_can_merge_persistent(const hipStream_t stream, bool& can_merge)
+{
+    can_merge = false;
+
+    hipStreamCaptureStatus capture_status;
+    ROCPRIM_RETURN_ON_ERROR(hipStreamIsCapturing(stream, &capture_status));
+    if(capture_status != hipStreamCaptureStatusNone)
+    {
+        return hipSuccess;
+    }
+
+    device_properties properties;
+    ROCPRIM_RETURN_ON_ERROR(get_device_properties(stream, properties));
+    can_merge = properties.cooperative_launch;
+    return hipSuccess;
 }
 
 template<class Config,
@@ -248,9 +475,10 @@ inline hipError_t merge_sort_block_merge(
     const unsigned int merge_partition_number_of_blocks
         = ceiling_div(merge_num_partitions, merge_partition_block_size);
 
-    OffsetT*    d_merge_partitions = nullptr;
-    key_type*   keys_buffer        = nullptr;
-    value_type* values_buffer      = nullptr;
+    OffsetT*      d_merge_partitions = nullptr;
+    unsigned int* d_barrier_counter  = nullptr;
+    key_type*     keys_buffer        = nullptr;
+    value_type*   values_buffer      = nullptr;
 
     hipError_t partition_result;
     if(keys_double_buffer == nullptr)
@@ -262,7 +490,9 @@ inline hipError_t merge_sort_block_merge(
                 detail::temp_storage::ptr_aligned_array(&keys_buffer, size),
                 detail::temp_storage::ptr_aligned_array(&values_buffer, with_values ? size : 0),
                 detail::temp_storage::ptr_aligned_array(&d_merge_partitions,
-                                                        use_mergepath ? merge_num_partitions : 0)));
+                                                        use_mergepath ? merge_num_partitions : 0),
+                detail::temp_storage::ptr_aligned_array(&d_barrier_counter,
+                                                        use_mergepath ? 1 : 0)));
     }
     else
     {
@@ -271,7 +501,9 @@ inline hipError_t merge_sort_block_merge(
             storage_size,
             detail::temp_storage::make_linear_partition(
                 detail::temp_storage::ptr_aligned_array(&d_merge_partitions,
-                                                        use_mergepath ? merge_num_partitions : 0)));
+                                                        use_mergepath ? merge_num_partitions : 0),
+                detail::temp_storage::ptr_aligned_array(&d_barrier_counter,
+                                                        use_mergepath ? 1 : 0)));
         keys_buffer   = keys_double_buffer;
         values_buffer = values_double_buffer;
     }
@@ -312,7 +544,72 @@ inline hipError_t merge_sort_block_merge(
     std::chrono::steady_clock::time_point start;
 
     bool temporary_store = true;
+
+    unsigned int levels = 0;
     for(OffsetT block = sorted_block_size; block < size; block *= 2)
+    {
+        levels++;
+    }
+
+    bool persistent = false;
+    if(use_mergepath && levels > 1
+       && static_cast<size_t>(size) <= merge_sort_persistent_merge_size_limit)
+    {
+        ROCPRIM_RETURN_ON_ERROR(merge_sort_can_merge_persistent(stream, persistent));
+    }
+
+    if(persistent)
+    {
+        // All levels are merged in one launch, with a grid barrier after the partitions and
+        // after the merges of each level.
+        const auto kernel = device_block_merge_persistent_kernel<config,
+                                                                 KeysIterator,
+                                                                 ValuesIterator,
+                                                                 OffsetT,
+                                                                 BinaryFunction>;
+        unsigned int grid_size;
+        ROCPRIM_RETURN_ON_ERROR(
+            persistent_grid_size(kernel, merge_mergepath_block_size, stream, grid_size));
+        grid_size = std::min(grid_size, merge_mergepath_number_of_blocks);
+
+        ROCPRIM_RETURN_ON_ERROR(
+            hipMemsetAsync(d_barrier_counter, 0, sizeof(*d_barrier_counter), stream));
+
+        OffsetT      input_size       = size;
+        OffsetT      first_block_size = sorted_block_size;
+        unsigned int num_tiles        = merge_mergepath_number_of_blocks;
+        void*        kernel_args[]    = {&keys,
+                                         &keys_buffer,
+                                         &values,
+                                         &values_buffer,
+                                         &input_size,
+                                         &first_block_size,
+                                         &num_tiles,
+                                         &compare_function,
+                                         &d_merge_partitions,
+                                         &d_barrier_counter};
+
+        if(debug_synchronous)
+        {
+            std::cout << "persistent_merge_levels: " << levels << '\n';
+            std::cout << "persistent_merge_grid_size: " << grid_size << '\n';
+            start = std::chrono::steady_clock::now();
+        }
+        ROCPRIM_RETURN_ON_ERROR(hipLaunchCooperativeKernel(reinterpret_cast<const void*>(kernel),
+                                                           dim3(grid_size),
+                                                           dim3(merge_mergepath_block_size),
+                                                           kernel_args,
+                                                           0,
+                                                           stream));
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("device_block_merge_persistent_kernel",
+                                                    size,
+                                                    start);
+
+        // The last level wrote to keys_buffer if the number of levels is odd
+        temporary_store = levels % 2 == 0;
+    }
+
+    for(OffsetT block = sorted_block_size; !persistent && block < size; block *= 2)
     {
         temporary_store = !temporary_store;
 
@@ -622,7 +919,438 @@ inline hipError_t merge_sort_impl(
     return hipSuccess;
 }
 
+// Natural merge sort: the tiles of the block sort that are already sorted are copied instead of
+// sorted, and consecutive sorted tiles in order form a single run. The runs, which have uneven
+// lengths, are then merged pairwise until one run is left, so a sorted input takes a single pass.
+template<class Config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class BinaryFunction>
+inline hipError_t merge_sort_adaptive_impl(void*                temporary_storage,
+                                           size_t&              storage_size,
+                                           KeysInputIterator    keys_input,
+                                           KeysOutputIterator   keys_output,
+                                           ValuesInputIterator  values_input,
+                                           ValuesOutputIterator values_output,
+                                           const size_t         size,
+                                           BinaryFunction       compare_function,
+                                           const hipStream_t    stream,
+                                           bool                 debug_synchronous)
+{
+    using key_type             = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type           = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using offset_type          = size_t;
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    static constexpr bool with_custom_config = !std::is_same<Config, default_config>::value;
+
+    using block_sort_config = typename std::
+        conditional<with_custom_config, typename Config::block_sort_config, default_config>::type;
+    using block_merge_config = typename std::
+        conditional<with_custom_config, typename Config::block_merge_config, default_config>::type;
+    using wrapped_bs_config
+        = wrapped_merge_sort_block_sort_config<block_sort_config, key_type, value_type>;
+    using wrapped_bm_config
+        = wrapped_merge_sort_block_merge_config<block_merge_config, key_type, value_type>;
+
+    (void)device_merge_sort_compile_time_verifier<
+        wrapped_bs_config,
+        wrapped_bm_config>; // Some helpful checks during compile-time
+
+    detail::target_arch target_arch;
+    hipError_t          result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const merge_sort_block_sort_config_params bs_params
+        = dispatch_target_arch<wrapped_bs_config>(target_arch);
+    const merge_sort_block_merge_config_params bm_params
+        = dispatch_target_arch<wrapped_bm_config>(target_arch);
+
+    const unsigned int sort_block_size = bs_params.block_sort_config.block_size;
+    const unsigned int sort_items_per_block
+        = sort_block_size * bs_params.block_sort_config.items_per_thread;
+    const unsigned int num_tiles = ceiling_div(size, sort_items_per_block);
+
+    const unsigned int merge_partition_block_size
+        = bm_params.merge_mergepath_partition_config.block_size;
+    const unsigned int merge_block_size = bm_params.merge_mergepath_config.block_size;
+    const unsigned int merge_items_per_block
+        = merge_block_size * bm_params.merge_mergepath_config.items_per_thread;
+    const unsigned int merge_number_of_blocks = ceiling_div(size, merge_items_per_block);
+    const unsigned int merge_partition_number_of_blocks
+        = ceiling_div(merge_number_of_blocks, merge_partition_block_size);
+
+    key_type*      keys_buffer        = nullptr;
+    value_type*    values_buffer      = nullptr;
+    offset_type*   d_merge_partitions = nullptr;
+    unsigned char* d_tile_flags       = nullptr;
+    offset_type*   d_run_offsets      = nullptr;
+    unsigned int*  d_num_runs         = nullptr;
+    void*          select_storage     = nullptr;
+
+    const merge_sort_tile_offset<offset_type> tile_offset{sort_items_per_block, size};
+
+    size_t select_storage_size = 0;
+    ROCPRIM_RETURN_ON_ERROR(
+        ::rocprim::select(nullptr,
+                          select_storage_size,
+                          ::rocprim::make_counting_iterator(0u),
+                          ::rocprim::make_transform_output_iterator(d_run_offsets, tile_offset),
+                          d_num_runs,
+                          num_tiles + 1,
+                          merge_sort_is_run_start{d_tile_flags, num_tiles},
+                          stream));
+
+    ROCPRIM_RETURN_ON_ERROR(detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&keys_buffer, size),
+            detail::temp_storage::ptr_aligned_array(&values_buffer, with_values ? size : 0),
+            detail::temp_storage::ptr_aligned_array(&d_merge_partitions,
+                                                    merge_number_of_blocks + 1),
+            detail::temp_storage::ptr_aligned_array(&d_tile_flags, num_tiles),
+            detail::temp_storage::ptr_aligned_array(&d_run_offsets, num_tiles + 1),
+            detail::temp_storage::ptr_aligned_array(&d_num_runs, 1),
+            detail::temp_storage::make_partition(&select_storage, select_storage_size))));
+
+    if(temporary_storage == nullptr || size == 0)
+    {
+        return hipSuccess;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "-----" << '\n';
+        std::cout << "size: " << size << '\n';
+        std::cout << "sort_items_per_block: " << sort_items_per_block << '\n';
+        std::cout << "num_tiles: " << num_tiles << '\n';
+        std::cout << "merge_mergepath_items_per_block: " << merge_items_per_block << '\n';
+        std::cout << "merge_mergepath_number_of_blocks: " << merge_number_of_blocks << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    if(debug_synchronous)
+        start = std::chrono::steady_clock::now();
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(merge_sort_detect_runs_kernel<wrapped_bs_config>),
+                       calculate_grid_dim(num_tiles, sort_block_size),
+                       dim3(sort_block_size),
+                       0,
+                       stream,
+                       keys_input,
+                       size,
+                       num_tiles,
+                       d_tile_flags,
+                       compare_function);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("merge_sort_detect_runs_kernel", size, start);
+
+    ROCPRIM_RETURN_ON_ERROR(
+        ::rocprim::select(select_storage,
+                          select_storage_size,
+                          ::rocprim::make_counting_iterator(0u),
+                          ::rocprim::make_transform_output_iterator(d_run_offsets, tile_offset),
+                          d_num_runs,
+                          num_tiles + 1,
+                          merge_sort_is_run_start{d_tile_flags, num_tiles},
+                          stream,
+                          debug_synchronous));
+
+    if(debug_synchronous)
+        start = std::chrono::steady_clock::now();
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(block_sort_adaptive_kernel<wrapped_bs_config>),
+                       calculate_grid_dim(num_tiles, sort_block_size),
+                       dim3(sort_block_size),
+                       0,
+                       stream,
+                       keys_input,
+                       keys_output,
+                       values_input,
+                       values_output,
+                       size,
+                       num_tiles,
+                       d_tile_flags,
+                       compare_function);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("block_sort_adaptive_kernel", size, start);
+
+    // The number of merge passes depends on the number of runs, which is only known on the device
+    unsigned int num_run_offsets;
+    ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(&num_run_offsets,
+                                           d_num_runs,
+                                           sizeof(num_run_offsets),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+    ROCPRIM_RETURN_ON_ERROR(hipStreamSynchronize(stream));
+    const unsigned int num_runs = num_run_offsets - 1;
+
+    if(debug_synchronous)
+    {
+        std::cout << "num_runs: " << num_runs << '\n';
+    }
+
+    bool temporary_store = true;
+    for(unsigned int run_stride = 1; run_stride < num_runs; run_stride *= 2)
+    {
+        temporary_store = !temporary_store;
+
+        const auto merge_step = [&](auto keys_input_,
+                                    auto keys_output_,
+                                    auto values_input_,
+                                    auto values_output_) -> hipError_t
+        {
+            if(debug_synchronous)
+                start = std::chrono::steady_clock::now();
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(device_merge_runs_partition_kernel<wrapped_bm_config>),
+                dim3(merge_partition_number_of_blocks),
+                dim3(merge_partition_block_size),
+                0,
+                stream,
+                keys_input_,
+                size,
+                merge_number_of_blocks,
+                d_merge_partitions,
+                compare_function,
+                d_run_offsets,
+                num_runs,
+                run_stride);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("device_merge_runs_partition_kernel",
+                                                        merge_number_of_blocks,
+                                                        start);
+
+            if(debug_synchronous)
+                start = std::chrono::steady_clock::now();
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(device_block_merge_runs_kernel<wrapped_bm_config>),
+                               calculate_grid_dim(merge_number_of_blocks, merge_block_size),
+                               dim3(merge_block_size),
+                               0,
+                               stream,
+                               keys_input_,
+                               keys_output_,
+                               values_input_,
+                               values_output_,
+                               size,
+                               d_run_offsets,
+                               num_runs,
+                               run_stride,
+                               merge_number_of_blocks,
+                               compare_function,
+                               d_merge_partitions);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("device_block_merge_runs_kernel",
+                                                        size,
+                                                        start);
+            return hipSuccess;
+        };
+
+        if(temporary_store)
+        {
+            ROCPRIM_RETURN_ON_ERROR(
+                merge_step(keys_buffer, keys_output, values_buffer, values_output));
+        }
+        else
+        {
+            ROCPRIM_RETURN_ON_ERROR(
+                merge_step(keys_output, keys_buffer, values_output, values_buffer));
+        }
+    }
+
+    if(!temporary_store)
+    {
+        ROCPRIM_RETURN_ON_ERROR(::rocprim::transform(keys_buffer,
+                                                     keys_output,
+                                                     size,
+                                                     ::rocprim::identity<key_type>(),
+                                                     stream,
+                                                     debug_synchronous));
+        if(with_values)
+        {
+            ROCPRIM_RETURN_ON_ERROR(::rocprim::transform(values_buffer,
+                                                         values_output,
+                                                         size,
+                                                         ::rocprim::identity<value_type>(),
+                                                         stream,
+                                                         debug_synchronous));
+        }
+    }
+
+    return hipSuccess;
+}
+
+// Merge sort without a copy of the input in the temporary storage: the tiles are block sorted
+// in place, and the sorted blocks are merged with merge_in_place_reverse_kernel_impl and
+// block_merge_in_place_kernel_impl.
+template<class Config,
+         class KeysIterator,
+         class ValuesIterator,
+         class BinaryFunction>
+inline hipError_t merge_sort_in_place_impl(void*             temporary_storage,
+                                           size_t&           storage_size,
+                                           KeysIterator      keys,
+                                           ValuesIterator    values,
+                                           const size_t      size,
+                                           BinaryFunction    compare_function,
+                                           const hipStream_t stream,
+                                           bool              debug_synchronous)
+{
+    using key_type    = typename std::iterator_traits<KeysIterator>::value_type;
+    using value_type  = typename std::iterator_traits<ValuesIterator>::value_type;
+    using offset_type = size_t;
 
+    static constexpr bool with_custom_config = !std::is_same<Config, default_config>::value;
+
+    using block_sort_config = typename std::
+        conditional<with_custom_config, typename Config::block_sort_config, default_config>::type;
+    using block_merge_config = typename std::
+        conditional<with_custom_config, typename Config::block_merge_config, default_config>::type;
+    using wrapped_bs_config
+        = wrapped_merge_sort_block_sort_config<block_sort_config, key_type, value_type>;
+    using wrapped_bm_config
+        = wrapped_merge_sort_block_merge_config<block_merge_config, key_type, value_type>;
+
+    (void)device_merge_sort_compile_time_verifier<
+        wrapped_bs_config,
+        wrapped_bm_config>; // Some helpful checks during compile-time
+
+    detail::target_arch target_arch;
+    hipError_t          result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const merge_sort_block_merge_config_params params
+        = dispatch_target_arch<wrapped_bm_config>(target_arch);
+
+    const unsigned int merge_partition_block_size
+        = params.merge_mergepath_partition_config.block_size;
+    const unsigned int merge_block_size = params.merge_mergepath_config.block_size;
+    const unsigned int merge_items_per_block
+        = merge_block_size * params.merge_mergepath_config.items_per_thread;
+    const unsigned int merge_number_of_blocks = ceiling_div(size, merge_items_per_block);
+    const unsigned int merge_num_partitions   = merge_number_of_blocks + 1;
+    const unsigned int merge_partition_number_of_blocks
+        = ceiling_div(merge_num_partitions, merge_partition_block_size);
+    const unsigned int reverse_number_of_blocks = ceiling_div(size, merge_block_size);
+
+    offset_type* d_merge_partitions = nullptr;
+    ROCPRIM_RETURN_ON_ERROR(detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&d_merge_partitions, merge_num_partitions))));
+
+    if(temporary_storage == nullptr || size == 0)
+    {
+        return hipSuccess;
+    }
+
+    unsigned int sort_items_per_block = 1; // We will get this from the block_sort algorithm
+    ROCPRIM_RETURN_ON_ERROR(merge_sort_block_sort<block_sort_config>(keys,
+                                                                     keys,
+                                                                     values,
+                                                                     values,
+                                                                     size,
+                                                                     sort_items_per_block,
+                                                                     compare_function,
+                                                                     stream,
+                                                                     debug_synchronous));
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    for(offset_type block = sort_items_per_block; block < size; block *= 2)
+    {
+        if(debug_synchronous)
+        {
+            std::cout << "-----" << '\n';
+            std::cout << "sorted_block_size: " << block << '\n';
+            start = std::chrono::steady_clock::now();
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(device_block_merge_mergepath_partition_kernel<wrapped_bm_config>),
+            dim3(merge_partition_number_of_blocks),
+            dim3(merge_partition_block_size),
+            0,
+            stream,
+            keys,
+            size,
+            merge_num_partitions,
+            d_merge_partitions,
+            compare_function,
+            block);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(
+            "device_block_merge_mergepath_partition_kernel",
+            merge_num_partitions,
+            start);
+
+        // Rearrange the pieces with one level of rotations per halving of the ranges
+        for(unsigned int pieces_per_range = static_cast<unsigned int>(2 * block
+                                                                      / merge_items_per_block);
+            pieces_per_range >= 2;
+            pieces_per_range /= 2)
+        {
+            if(debug_synchronous)
+                start = std::chrono::steady_clock::now();
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(device_merge_in_place_reverse_kernel<wrapped_bm_config, 0>),
+                dim3(reverse_number_of_blocks),
+                dim3(merge_block_size),
+                0,
+                stream,
+                keys,
+                values,
+                size,
+                block,
+                pieces_per_range,
+                d_merge_partitions);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("device_merge_in_place_reverse_kernel",
+                                                        size,
+                                                        start);
+
+            if(debug_synchronous)
+                start = std::chrono::steady_clock::now();
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(device_merge_in_place_reverse_kernel<wrapped_bm_config, 1>),
+                dim3(reverse_number_of_blocks),
+                dim3(merge_block_size),
+                0,
+                stream,
+                keys,
+                values,
+                size,
+                block,
+                pieces_per_range,
+                d_merge_partitions);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("device_merge_in_place_reverse_kernel",
+                                                        size,
+                                                        start);
+        }
+
+        if(debug_synchronous)
+            start = std::chrono::steady_clock::now();
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(device_block_merge_in_place_kernel<wrapped_bm_config>),
+                           calculate_grid_dim(merge_number_of_blocks, merge_block_size),
+                           dim3(merge_block_size),
+                           0,
+                           stream,
+                           keys,
+                           values,
+                           size,
+                           block,
+                           merge_number_of_blocks,
+                           compare_function,
+                           d_merge_partitions);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("device_block_merge_in_place_kernel",
+                                                    size,
+                                                    start);
+    }
+
+    return hipSuccess;
+}
 
 } // end of detail namespace
 
@@ -838,6 +1566,333 @@ hipError_t merge_sort(void * temporary_storage,
     );
 }
 
+/// \brief Parallel adaptive merge sort primitive for device level.
+///
+/// \p merge_sort_adaptive performs a device-wide merge sort of keys like \p merge_sort, which
+/// takes advantage of runs of keys that are already sorted in the input.
+///
+/// \par Overview
+/// * The input is divided into the tiles of the block sort of \p merge_sort. Tiles that are
+/// already sorted are copied instead of sorted, and consecutive sorted tiles whose keys are in
+/// order across the tile boundaries form a single run.
+/// * The runs, which may have different lengths, are merged pairwise until a single run is left.
+/// Therefore an input that is already sorted is sorted in one pass, and an input that is mostly
+/// sorted needs fewer merge passes than with \p merge_sort.
+/// * The number of merge passes is only known after the runs are found, so the function
+/// synchronizes \p stream once. It can not be captured in a hipGraph.
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Accepts custom compare_functions for sorting across the device.
+///
+/// \par Stability
+/// \p merge_sort_adaptive is \b stable: it preserves the relative ordering of equivalent keys.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `merge_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level ascending merge sort is performed on an array of
+/// \p int values that is mostly sorted.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;      // e.g., 8
+/// int * input;            // e.g., [1, 2, 3, 5, 4, 6, 7, 8]
+/// int * output;           // empty array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::merge_sort_adaptive(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::merge_sort_adaptive(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size
+/// );
+/// // keys_output: [1, 2, 3, 4, 5, 6, 7, 8]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t merge_sort_adaptive(void*              temporary_storage,
+                                      size_t&            storage_size,
+                                      KeysInputIterator  keys_input,
+                                      KeysOutputIterator keys_output,
+                                      const size_t       size,
+                                      BinaryFunction     compare_function  = BinaryFunction(),
+                                      const hipStream_t  stream            = 0,
+                                      bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::merge_sort_adaptive_impl<Config>(temporary_storage,
+                                                    storage_size,
+                                                    keys_input,
+                                                    keys_output,
+                                                    values,
+                                                    values,
+                                                    size,
+                                                    compare_function,
+                                                    stream,
+                                                    debug_synchronous);
+}
+
+/// \brief Parallel adaptive merge sort-by-key primitive for device level.
+///
+/// \p merge_sort_adaptive performs a device-wide merge sort of (key, value) pairs like
+/// \p merge_sort, which takes advantage of runs of keys that are already sorted in the input.
+/// See the overload for keys for a description of the algorithm.
+///
+/// \par Stability
+/// \p merge_sort_adaptive is \b stable: it preserves the relative ordering of equivalent keys.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `merge_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range to sort.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t merge_sort_adaptive(void*                temporary_storage,
+                                      size_t&              storage_size,
+                                      KeysInputIterator    keys_input,
+                                      KeysOutputIterator   keys_output,
+                                      ValuesInputIterator  values_input,
+                                      ValuesOutputIterator values_output,
+                                      const size_t         size,
+                                      BinaryFunction       compare_function  = BinaryFunction(),
+                                      const hipStream_t    stream            = 0,
+                                      bool                 debug_synchronous = false)
+{
+    return detail::merge_sort_adaptive_impl<Config>(temporary_storage,
+                                                    storage_size,
+                                                    keys_input,
+                                                    keys_output,
+                                                    values_input,
+                                                    values_output,
+                                                    size,
+                                                    compare_function,
+                                                    stream,
+                                                    debug_synchronous);
+}
+
+/// \brief Parallel in-place merge sort primitive for device level.
+///
+/// \p merge_sort_in_place performs a device-wide merge sort of keys that are sorted in place,
+/// for inputs that do not fit in device memory twice.
+///
+/// \par Overview
+/// * Unlike \p merge_sort, the temporary storage does not hold a copy of the keys. It only holds
+/// the partitions of the merge passes, which is one offset per tile of the merge.
+/// * Two sorted blocks are merged in place by splitting the merged output into tiles with the
+/// merge path, rearranging the parts of the blocks of every tile next to each other with
+/// rotations, and merging every tile on its own.
+/// * The rotations need <tt>log2(2 * sorted_block_size / tile)</tt> extra passes over the keys for
+/// every merge pass, so it is slower than \p merge_sort.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Accepts custom compare_functions for sorting across the device.
+///
+/// \par Stability
+/// \p merge_sort_in_place is \b stable: it preserves the relative ordering of equivalent keys.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `merge_sort_config`.
+/// \tparam KeysIterator - random-access iterator type of the range to sort. Must meet the
+/// requirements of a C++ InputIterator and OutputIterator concepts. It can be a simple pointer
+/// type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in,out] keys - pointer to the first element in the range to sort.
+/// \param [in] size - number of element in the range.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level ascending merge sort is performed in place on an array of
+/// \p float values.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input (declare pointers, allocate device memory etc.)
+/// size_t size;            // e.g., 8
+/// float * keys;           // e.g., [0.6, 0.3, 0.65, 0.4, 0.2, 0.08, 1, 0.7]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::merge_sort_in_place(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys, size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::merge_sort_in_place(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys, size
+/// );
+/// // keys: [0.08, 0.2, 0.3, 0.4, 0.6, 0.65, 0.7, 1]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysIterator>::value_type>>
+inline hipError_t merge_sort_in_place(void*             temporary_storage,
+                                      size_t&           storage_size,
+                                      KeysIterator      keys,
+                                      const size_t      size,
+                                      BinaryFunction    compare_function  = BinaryFunction(),
+                                      const hipStream_t stream            = 0,
+                                      bool              debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::merge_sort_in_place_impl<Config>(temporary_storage,
+                                                    storage_size,
+                                                    keys,
+                                                    values,
+                                                    size,
+                                                    compare_function,
+                                                    stream,
+                                                    debug_synchronous);
+}
+
+/// \brief Parallel in-place merge sort-by-key primitive for device level.
+///
+/// \p merge_sort_in_place performs a device-wide merge sort of (key, value) pairs that are
+/// sorted in place, for inputs that do not fit in device memory twice. See the overload for
+/// keys for a description of the algorithm.
+///
+/// \par Stability
+/// \p merge_sort_in_place is \b stable: it preserves the relative ordering of equivalent keys.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `merge_sort_config`.
+/// \tparam KeysIterator - random-access iterator type of the keys to sort. Must meet the
+/// requirements of a C++ InputIterator and OutputIterator concepts. It can be a simple pointer
+/// type.
+/// \tparam ValuesIterator - random-access iterator type of the values to sort. Must meet the
+/// requirements of a C++ InputIterator and OutputIterator concepts. It can be a simple pointer
+/// type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in,out] keys - pointer to the first key in the range to sort.
+/// \param [in,out] values - pointer to the first value in the range to sort.
+/// \param [in] size - number of element in the range.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysIterator,
+         class ValuesIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysIterator>::value_type>>
+inline hipError_t merge_sort_in_place(void*             temporary_storage,
+                                      size_t&           storage_size,
+                                      KeysIterator      keys,
+                                      ValuesIterator    values,
+                                      const size_t      size,
+                                      BinaryFunction    compare_function  = BinaryFunction(),
+                                      const hipStream_t stream            = 0,
+                                      bool              debug_synchronous = false)
+{
+    return detail::merge_sort_in_place_impl<Config>(temporary_storage,
+                                                    storage_size,
+                                                    keys,
+                                                    values,
+                                                    size,
+                                                    compare_function,
+                                                    stream,
+                                                    debug_synchronous);
+}
+
 /// @}
 // end of group devicemodule
 
@@ -0,0 +1,243 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_DEVICE_MULTI_REDUCE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_MULTI_REDUCE_HPP_
+
+#include "../config.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../thread/thread_operators.hpp"
+#include "../types/reduce_statistics.hpp"
+
+#include "config_types.hpp"
+#include "device_reduce.hpp"
+#include "device_segmented_reduce.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+// The statistics are accumulated in the type of the output's statistics, or in the input type if
+// the output does not name them (e.g. its value_type is void).
+template<class OutputValue, class InputValue>
+struct multi_reduce_accumulator
+{
+    using type = InputValue;
+};
+
+template<class T, class InputValue>
+struct multi_reduce_accumulator<::rocprim::reduce_statistics<T>, InputValue>
+{
+    using type = T;
+};
+
+template<class T>
+struct multi_reduce_transform_op
+{
+    template<class Value>
+    ROCPRIM_HOST_DEVICE
+    inline ::rocprim::reduce_statistics<T> operator()(const Value& value) const
+    {
+        return ::rocprim::reduce_statistics<T>(static_cast<T>(value));
+    }
+};
+
+} // namespace detail
+
+/// \brief Parallel primitive for device level that computes the minimum, the maximum, the sum,
+/// the sum of squares and the number of the items of a range in a single pass.
+///
+/// \par Overview
+/// * The statistics are written to \p output as a <tt>rocprim::reduce_statistics<T></tt>. \p T is
+/// the accumulator type of the statistics named by the \p value_type of \p OutputIterator, or the
+/// \p value_type of \p InputIterator if the output iterator does not name it. For example
+/// <tt>float</tt> values can be summed into <tt>double</tt> statistics by passing a pointer to
+/// <tt>rocprim::reduce_statistics<double></tt>.
+/// * Every item is loaded once and the statistics are reduced together, so the input is read once
+/// instead of once per statistic. The statistics of an empty range (\p count is \p 0) are written
+/// when \p size is \p 0.
+/// * The mean and the variance follow from the statistics, see \p reduce_statistics.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `reduce_config`
+/// or a `tuned_config` of these.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the statistics of the range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;                           // e.g., 4
+/// float * input;                               // e.g., [1, 2, 3, 4]
+/// rocprim::reduce_statistics<double> * output; // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::multi_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes, input, output, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // compute the statistics
+/// rocprim::multi_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes, input, output, input_size
+/// );
+/// // output: [{minimum: 1, maximum: 4, sum: 10, sum_of_squares: 30, count: 4}]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class InputIterator, class OutputIterator>
+inline hipError_t multi_reduce(void*             temporary_storage,
+                               size_t&           storage_size,
+                               InputIterator     input,
+                               OutputIterator    output,
+                               const size_t      size,
+                               const hipStream_t stream            = 0,
+                               bool              debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using acc_type   = typename detail::multi_reduce_accumulator<
+        typename std::iterator_traits<OutputIterator>::value_type,
+        input_type>::type;
+    using statistics_type = ::rocprim::reduce_statistics<acc_type>;
+
+    return ::rocprim::transform_reduce<Config>(temporary_storage,
+                                               storage_size,
+                                               input,
+                                               output,
+                                               statistics_type(),
+                                               size,
+                                               ::rocprim::reduce_statistics_plus<acc_type>(),
+                                               detail::multi_reduce_transform_op<acc_type>(),
+                                               stream,
+                                               debug_synchronous);
+}
+
+/// \brief Load-balanced parallel primitive for device level that computes the minimum, the
+/// maximum, the sum, the sum of squares and the number of the items of every segment in a single
+/// pass.
+///
+/// segmented_multi_reduce reduces the segments given by a single sequence of offsets like
+/// \p segmented_reduce_balanced, so the statistics of the rows of a ragged batch are computed
+/// with one read of the input, independent of the distribution of the row lengths.
+///
+/// \par Overview
+/// * Segment <tt>i</tt> is the range <tt>[offsets[i], offsets[i + 1])</tt> of \p input.
+/// \p offsets must have <tt>segments + 1</tt> non-decreasing elements, and
+/// <tt>offsets[segments]</tt> must not be greater than \p size.
+/// * The statistics of every segment are written to \p output as a
+/// <tt>rocprim::reduce_statistics<T></tt>, with \p T chosen like in \p multi_reduce. The
+/// statistics of an empty segment have a \p count of \p 0.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `reduce_config`.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the first element in the range of <tt>segments</tt>
+/// statistics.
+/// \param [in] size - number of elements in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] offsets - iterator to the first element in the range of <tt>segments + 1</tt>
+/// offsets.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_multi_reduce(void*              temporary_storage,
+                                         size_t&            storage_size,
+                                         InputIterator      input,
+                                         OutputIterator     output,
+                                         const size_t       size,
+                                         const unsigned int segments,
+                                         OffsetIterator     offsets,
+                                         const hipStream_t  stream            = 0,
+                                         bool               debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using acc_type   = typename detail::multi_reduce_accumulator<
+        typename std::iterator_traits<OutputIterator>::value_type,
+        input_type>::type;
+    using statistics_type = ::rocprim::reduce_statistics<acc_type>;
+
+    return ::rocprim::segmented_reduce_balanced<Config>(
+        temporary_storage,
+        storage_size,
+        ::rocprim::make_transform_iterator(input, detail::multi_reduce_transform_op<acc_type>()),
+        output,
+        size,
+        segments,
+        offsets,
+        ::rocprim::reduce_statistics_plus<acc_type>(),
+        statistics_type(),
+        stream,
+        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_MULTI_REDUCE_HPP_
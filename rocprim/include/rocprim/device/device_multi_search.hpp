@@ -0,0 +1,440 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_MULTI_SEARCH_HPP_
+#define ROCPRIM_DEVICE_DEVICE_MULTI_SEARCH_HPP_
+
+#include "detail/device_multi_search.hpp"
+#include "detail/device_scan_common.hpp"
+#include "detail/lookback_scan_state.hpp"
+
+#include "../config.hpp"
+#include "../common.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+
+#include "config_types.hpp"
+#include "device_multi_search_config.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<class Config,
+         class InputIterator,
+         class PositionsOutputIterator,
+         class PatternsOutputIterator,
+         class MatchesCountOutputIterator>
+inline hipError_t multi_search_impl(void*                         temporary_storage,
+                                    size_t&                       storage_size,
+                                    const multi_search_automaton& automaton,
+                                    InputIterator                 input,
+                                    const size_t                  size,
+                                    PositionsOutputIterator       positions_output,
+                                    PatternsOutputIterator        patterns_output,
+                                    MatchesCountOutputIterator    matches_count_output,
+                                    const size_t                  max_matches,
+                                    const hipStream_t             stream,
+                                    const bool                    debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using config     = wrapped_multi_search_config<Config>;
+
+    static_assert(sizeof(input_type) == 1, "multi_search only supports inputs of 1-byte values");
+
+    using scan_state_type = lookback_scan_state<size_t>;
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const multi_search_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+
+    const size_t size_limit
+        = budgeted_size_limit(stream, params.kernel_config.size_limit, items_per_block);
+    const size_t aligned_size_limit
+        = ::rocprim::max<size_t>(size_limit - size_limit % items_per_block, items_per_block);
+    const size_t limited_size = ::rocprim::max<size_t>(1, ::rocprim::min(size, aligned_size_limit));
+    const unsigned int number_of_blocks
+        = static_cast<unsigned int>(ceiling_div(limited_size, items_per_block));
+
+    void*   scan_state_storage;
+    size_t* carry;
+
+    temp_storage::layout layout{};
+    result = scan_state_type::get_temp_storage_layout(number_of_blocks, stream, layout);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(temp_storage::make_partition(&scan_state_storage,
+                                                                         layout),
+                                            temp_storage::ptr_aligned_array(&carry, 1)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    scan_state_type scan_state{};
+    result = scan_state_type::create(scan_state, scan_state_storage, number_of_blocks, stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    // An empty input is processed by one block too, which writes the count of zero matches.
+    const size_t number_of_launches = ::rocprim::max<size_t>(1, ceiling_div(size, limited_size));
+
+    if(debug_synchronous)
+    {
+        std::cout << "size " << size << '\n';
+        std::cout << "aligned_size_limit " << aligned_size_limit << '\n';
+        std::cout << "number_of_launches " << number_of_launches << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    unsigned int previous_blocks = 0;
+    for(size_t launch = 0; launch < number_of_launches; ++launch)
+    {
+        const size_t       offset       = launch * limited_size;
+        const size_t       current_size = ::rocprim::min(size - offset, limited_size);
+        const unsigned int current_number_of_blocks
+            = ::rocprim::max(1u, static_cast<unsigned int>(ceiling_div(current_size,
+                                                                       items_per_block)));
+
+        if(debug_synchronous)
+        {
+            std::cout << "current size " << current_size << '\n';
+            std::cout << "current number of blocks " << current_number_of_blocks << '\n';
+            start = std::chrono::steady_clock::now();
+        }
+
+        // A single block does not look back. Before the state is reset for a following launch,
+        // the complete prefix of the last block of the preceding launch is saved to carry.
+        if(current_number_of_blocks > 1 || offset != 0)
+        {
+            const unsigned int init_block_size = ROCPRIM_DEFAULT_MAX_BLOCK_SIZE;
+            const unsigned int init_grid_size
+                = ceiling_div(current_number_of_blocks, init_block_size);
+            init_lookback_scan_state_kernel<scan_state_type>
+                <<<dim3(init_grid_size), dim3(init_block_size), 0, stream>>>(
+                    scan_state,
+                    current_number_of_blocks,
+                    previous_blocks - 1,
+                    offset != 0 ? carry : nullptr);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel",
+                                                        current_number_of_blocks,
+                                                        start);
+
+            if(debug_synchronous) start = std::chrono::steady_clock::now();
+        }
+
+        multi_search_kernel<config>
+            <<<dim3(current_number_of_blocks), dim3(block_size), 0, stream>>>(
+                input,
+                offset,
+                size,
+                automaton,
+                positions_output,
+                patterns_output,
+                matches_count_output,
+                max_matches,
+                scan_state,
+                carry);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("multi_search_kernel", current_size, start);
+
+        previous_blocks = current_number_of_blocks;
+    }
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \brief Builds the automaton of a device-level multi-pattern search.
+///
+/// The patterns are compiled on the host into an Aho-Corasick automaton with a complete
+/// transition table, which is copied to \p automaton_storage. The storage is owned by the
+/// caller and follows the protocol of temporary storage: when a null pointer is passed, the
+/// required size is written to \p automaton_storage_size. The automaton can then be used by any
+/// number of \p multi_search calls, until the storage is freed or reused.
+///
+/// \par Overview
+/// * The patterns are sequences of bytes, given in host memory. Pattern \p i is
+///   <tt>[patterns + pattern_offsets[i], patterns + pattern_offsets[i + 1])</tt>.
+/// * Bytes that do not occur in the patterns share one column of the transition table, so the
+///   size of the automaton is about the total length of the patterns times the number of
+///   distinct bytes in them, times 4 bytes.
+/// * \p hipErrorInvalidValue is returned if a pattern is empty.
+/// * The function synchronizes \p stream after the copy, so it cannot be captured in a graph.
+///
+/// \tparam PatternsIterator [inferred] random-access iterator type of the bytes of the patterns
+///   in host memory. Its value type must be a 1-byte type, e.g. \p char.
+/// \tparam OffsetsIterator [inferred] random-access iterator type of the offsets of the
+///   patterns in host memory.
+///
+/// \param [in] automaton_storage pointer to device-accessible storage of the automaton. When a
+///   null pointer is passed, the required allocation size (in bytes) is written to
+///   \p automaton_storage_size and function returns without copying the automaton.
+/// \param [in,out] automaton_storage_size reference to a size (in bytes) of
+///   \p automaton_storage.
+/// \param [out] automaton the automaton, which refers to \p automaton_storage.
+/// \param [in] patterns iterator to the bytes of the patterns.
+/// \param [in] pattern_offsets iterator to the <tt>patterns_count + 1</tt> offsets of the
+///   patterns in \p patterns.
+/// \param [in] patterns_count number of patterns.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, prints the size of the automaton.
+///   Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful build; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class PatternsIterator, class OffsetsIterator>
+inline hipError_t multi_search_build(void*                   automaton_storage,
+                                     size_t&                 automaton_storage_size,
+                                     multi_search_automaton& automaton,
+                                     PatternsIterator        patterns,
+                                     OffsetsIterator         pattern_offsets,
+                                     const size_t            patterns_count,
+                                     const hipStream_t       stream            = 0,
+                                     const bool              debug_synchronous = false)
+{
+    using pattern_type = typename std::iterator_traits<PatternsIterator>::value_type;
+    static_assert(sizeof(pattern_type) == 1,
+                  "multi_search_build only supports patterns of 1-byte values");
+
+    detail::multi_search_host_automaton host_automaton;
+    ROCPRIM_RETURN_ON_ERROR(detail::build_multi_search_automaton(patterns,
+                                                                 pattern_offsets,
+                                                                 patterns_count,
+                                                                 host_automaton));
+
+    unsigned char* byte_classes;
+    unsigned int*  transitions;
+    unsigned int*  output_offsets;
+    unsigned int*  outputs;
+    unsigned int*  pattern_lengths;
+
+    const hipError_t result = detail::temp_storage::partition(
+        automaton_storage,
+        automaton_storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&byte_classes,
+                                                    host_automaton.byte_classes.size()),
+            detail::temp_storage::ptr_aligned_array(&transitions,
+                                                    host_automaton.transitions.size()),
+            detail::temp_storage::ptr_aligned_array(&output_offsets,
+                                                    host_automaton.output_offsets.size()),
+            detail::temp_storage::ptr_aligned_array(&outputs, host_automaton.outputs.size()),
+            detail::temp_storage::ptr_aligned_array(&pattern_lengths,
+                                                    host_automaton.pattern_lengths.size())));
+    if(result != hipSuccess || automaton_storage == nullptr)
+    {
+        return result;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "states " << host_automaton.output_offsets.size() - 1 << '\n';
+        std::cout << "classes " << host_automaton.classes << '\n';
+        std::cout << "outputs " << host_automaton.outputs.size() << '\n';
+    }
+
+    const auto copy = [stream](auto* destination, const auto& source)
+    {
+        return hipMemcpyAsync(destination,
+                              source.data(),
+                              source.size() * sizeof(source[0]),
+                              hipMemcpyHostToDevice,
+                              stream);
+    };
+    ROCPRIM_RETURN_ON_ERROR(copy(byte_classes, host_automaton.byte_classes));
+    ROCPRIM_RETURN_ON_ERROR(copy(transitions, host_automaton.transitions));
+    ROCPRIM_RETURN_ON_ERROR(copy(output_offsets, host_automaton.output_offsets));
+    ROCPRIM_RETURN_ON_ERROR(copy(outputs, host_automaton.outputs));
+    ROCPRIM_RETURN_ON_ERROR(copy(pattern_lengths, host_automaton.pattern_lengths));
+    // The host automaton is freed on return
+    ROCPRIM_RETURN_ON_ERROR(hipStreamSynchronize(stream));
+
+    automaton.byte_classes    = byte_classes;
+    automaton.transitions     = transitions;
+    automaton.output_offsets  = output_offsets;
+    automaton.outputs         = outputs;
+    automaton.pattern_lengths = pattern_lengths;
+    automaton.classes         = host_automaton.classes;
+    automaton.max_length      = host_automaton.max_length;
+
+    return hipSuccess;
+}
+
+/// \brief Finds all matches of many patterns in the input with one pass over the input.
+///
+/// The patterns are given by an automaton built by \p multi_search_build. For every match, the
+/// position of its first item in the input is written to \p positions_output and the index of
+/// the pattern to \p patterns_output. The total number of matches is written to
+/// \p matches_count_output.
+///
+/// \par Overview
+/// * The matches are ordered by the position of their last item, and matches that end at the
+///   same item are ordered by decreasing length of the patterns. Overlapping matches and matches
+///   of duplicate patterns are all reported.
+/// * Only the first \p max_matches matches are written, but all of them are counted, so the
+///   outputs can be enlarged and the search repeated if the count is larger.
+/// * Every thread of the search runs the automaton over its items, starting the maximum
+///   pattern length minus one items before them. The number of items of a thread can be
+///   increased with \p multi_search_config for long patterns.
+/// * Returns the required size of \p temporary_storage in \p storage_size if
+///   \p temporary_storage is a null pointer.
+///
+/// \tparam Config [optional] configuration of the primitive, must be \p default_config or
+///   \p multi_search_config.
+/// \tparam InputIterator [inferred] random-access iterator type of the input range. Its value
+///   type must be a 1-byte type, e.g. \p char. It can be a simple pointer type.
+/// \tparam PositionsOutputIterator [inferred] random-access iterator type of the positions
+///   of the matches. It can be a simple pointer type.
+/// \tparam PatternsOutputIterator [inferred] random-access iterator type of the patterns of
+///   the matches. It can be a simple pointer type.
+/// \tparam MatchesCountOutputIterator [inferred] random-access iterator type of the number of
+///   matches. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When a null
+///   pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the search.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] automaton the automaton of the patterns, built by \p multi_search_build.
+/// \param [in] input iterator to the input range.
+/// \param [in] size number of items in the input range.
+/// \param [out] positions_output iterator to the positions of the matches.
+/// \param [out] patterns_output iterator to the patterns of the matches.
+/// \param [out] matches_count_output iterator to the number of matches.
+/// \param [in] max_matches number of matches that fit in \p positions_output and
+///   \p patterns_output.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+///   type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // The patterns in host memory
+/// const char   patterns[]        = "hehishers";     // "he", "his", "hers"
+/// const size_t pattern_offsets[] = {0, 2, 5, 9};
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t         size;              // e.g., 8
+/// char *         input;             // e.g., "ushershe"
+/// size_t *       positions;         // empty array of 8 elements
+/// unsigned int * pattern_indices;   // empty array of 8 elements
+/// size_t *       matches_count;     // empty array of 1 element
+///
+/// rocprim::multi_search_automaton automaton;
+/// size_t automaton_storage_size;
+/// void * automaton_storage = nullptr;
+/// rocprim::multi_search_build(
+///     automaton_storage, automaton_storage_size, automaton, patterns, pattern_offsets, 3
+/// );
+/// hipMalloc(&automaton_storage, automaton_storage_size);
+/// rocprim::multi_search_build(
+///     automaton_storage, automaton_storage_size, automaton, patterns, pattern_offsets, 3
+/// );
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::multi_search(temporary_storage_ptr, temporary_storage_size_bytes, automaton,
+///                       input, size, positions, pattern_indices, matches_count, 8);
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the search
+/// rocprim::multi_search(temporary_storage_ptr, temporary_storage_size_bytes, automaton,
+///                       input, size, positions, pattern_indices, matches_count, 8);
+/// // positions:       [ 2, 1, 6 ]
+/// // pattern_indices: [ 0, 2, 0 ]
+/// // matches_count:   [ 3 ]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class PositionsOutputIterator,
+         class PatternsOutputIterator,
+         class MatchesCountOutputIterator>
+inline hipError_t multi_search(void*                         temporary_storage,
+                               size_t&                       storage_size,
+                               const multi_search_automaton& automaton,
+                               InputIterator                 input,
+                               const size_t                  size,
+                               PositionsOutputIterator       positions_output,
+                               PatternsOutputIterator        patterns_output,
+                               MatchesCountOutputIterator    matches_count_output,
+                               const size_t                  max_matches,
+                               const hipStream_t             stream            = 0,
+                               const bool                    debug_synchronous = false)
+{
+    return detail::multi_search_impl<Config>(temporary_storage,
+                                             storage_size,
+                                             automaton,
+                                             input,
+                                             size,
+                                             positions_output,
+                                             patterns_output,
+                                             matches_count_output,
+                                             max_matches,
+                                             stream,
+                                             debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_MULTI_SEARCH_HPP_
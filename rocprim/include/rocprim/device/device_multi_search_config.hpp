@@ -0,0 +1,70 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_MULTI_SEARCH_CONFIG_HPP_
+#define ROCPRIM_DEVICE_DEVICE_MULTI_SEARCH_CONFIG_HPP_
+
+#include "config_types.hpp"
+
+#include "detail/device_config_helper.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// generic struct that instantiates custom configurations
+template<typename Config>
+struct wrapped_multi_search_config
+{
+    template<target_arch Arch>
+    struct architecture_config
+    {
+        static constexpr multi_search_config_params params = Config{};
+    };
+};
+
+// specialized for rocprim::default_config, which instantiates the default_multi_search_config
+template<>
+struct wrapped_multi_search_config<default_config>
+{
+    template<target_arch Arch>
+    struct architecture_config
+    {
+        static constexpr multi_search_config_params params = multi_search_config<256, 32>();
+    };
+};
+
+#ifndef DOXYGEN_DOCUMENTATION_BUILD
+template<typename Config>
+template<target_arch Arch>
+constexpr multi_search_config_params
+    wrapped_multi_search_config<Config>::architecture_config<Arch>::params;
+
+template<target_arch Arch>
+constexpr multi_search_config_params
+    wrapped_multi_search_config<default_config>::architecture_config<Arch>::params;
+#endif // DOXYGEN_DOCUMENTATION_BUILD
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_MULTI_SEARCH_CONFIG_HPP_
@@ -29,6 +29,7 @@
 
 #include "config_types.hpp"
 #include "device_nth_element_config.hpp"
+#include "device_topk.hpp"
 #include "device_transform.hpp"
 
 #include <iostream>
@@ -81,6 +82,8 @@ hipError_t
     n_th_element_iteration_data*         nth_element_data = nullptr;
     bool*                                equality_buckets = nullptr;
     nth_element_onesweep_lookback_state* lookback_states  = nullptr;
+    nth_element_range_state*             range            = nullptr;
+    unsigned int*                        tile_counter     = nullptr;
 
     key_type* keys_buffer = nullptr;
 
@@ -99,6 +102,8 @@ hipError_t
                                 ptr_aligned_array(&buckets, num_buckets),
                                 ptr_aligned_array(&keys_buffer, size),
                                 ptr_aligned_array(&nth_element_data, 1),
+                                ptr_aligned_array(&range, 1),
+                                ptr_aligned_array(&tile_counter, 1),
                                 ptr_aligned_array(&lookback_states, num_partitions * num_blocks)));
         }
         else
@@ -111,6 +116,8 @@ hipError_t
                                 ptr_aligned_array(&equality_buckets, num_buckets),
                                 ptr_aligned_array(&buckets, num_buckets),
                                 ptr_aligned_array(&nth_element_data, 1),
+                                ptr_aligned_array(&range, 1),
+                                ptr_aligned_array(&tile_counter, 1),
                                 ptr_aligned_array(&lookback_states, num_partitions * num_blocks)));
             keys_buffer = keys_double_buffer;
         }
@@ -154,6 +161,8 @@ hipError_t
                                                          num_threads_per_block,
                                                          num_items_per_threads,
                                                          nth_element_data,
+                                                         range,
+                                                         tile_counter,
                                                          compare_function,
                                                          stream,
                                                          debug_synchronous);
@@ -176,7 +185,7 @@ hipError_t
 /// * Returns the required size of `temporary_storage` in `storage_size`
 /// if `temporary_storage` is a null pointer.
 /// * Accepts custom compare_functions for nth_element across the device.
-/// * Streams in graph capture mode are not supported
+/// * The function does not synchronize with the host, so it can be captured in a hipGraph.
 ///
 /// \par Stability
 /// \p nth_element is <b>not stable</b>: it doesn't necessarily preserve the relative ordering
@@ -280,7 +289,7 @@ ROCPRIM_INLINE hipError_t nth_element(void*          temporary_storage,
 /// * Returns the required size of `temporary_storage` in `storage_size`
 /// if `temporary_storage` is a null pointer.
 /// * Accepts custom compare_functions for nth_element across the device.
-/// * Streams in graph capture mode are not supported
+/// * The function does not synchronize with the host, so it can be captured in a hipGraph.
 ///
 /// \par Stability
 /// \p nth_element is <b>not stable</b>: it doesn't necessarily preserve the relative ordering
@@ -397,6 +406,153 @@ ROCPRIM_INLINE hipError_t nth_element(void*              temporary_storage,
                                debug_synchronous);
 }
 
+/// \brief Rearranges every segment so that the key at position \p nth of the segment is the key
+/// that would be there if the segment was sorted, writing the result to the output range.
+///
+/// The keys of every segment are selected by the radix selection of \p segmented_topk_keys_min,
+/// with the path of the segment chosen by its size, so one call replaces a loop of
+/// \p nth_element calls over the segments.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * Keys are ordered like in \p radix_sort_keys, which for floating point keys places
+///   <tt>-0.0</tt> before <tt>+0.0</tt>.
+/// * After the call, for every segment with more than \p nth keys, no key before position
+///   \p nth of the segment is greater than the key at \p nth, and no key after it is smaller.
+///   Segments with at most \p nth keys are copied in an unspecified order.
+/// * Keys are written to the positions of their segment in \p keys_output, so the output range
+///   must have as many elements as the input range. Keys outside of the segments are not written.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements.
+/// * Segments must hold less than <tt>2^32</tt> keys each.
+/// * The number of large segments is copied to the host, so the function synchronizes with
+///   \p stream once.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p topk_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator [inferred] random-access iterator type of segment offsets. Must meet the
+///   requirements of a C++ InputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the rearrangement.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [out] keys_output iterator to the output range.
+/// \param [in] segments number of segments in the input range.
+/// \param [in] begin_offsets iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets iterator to the first element in the range of ending offsets.
+/// \param [in] nth index of the nth element within every segment.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful rearrangement; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_nth_element_keys(void*              temporary_storage,
+                                             size_t&            storage_size,
+                                             KeysInputIterator  keys_input,
+                                             KeysOutputIterator keys_output,
+                                             unsigned int       segments,
+                                             OffsetIterator     begin_offsets,
+                                             OffsetIterator     end_offsets,
+                                             unsigned int       nth,
+                                             hipStream_t        stream            = 0,
+                                             bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::segmented_topk_impl<Config, false, false, true>(temporary_storage,
+                                                                   storage_size,
+                                                                   keys_input,
+                                                                   values,
+                                                                   keys_output,
+                                                                   values,
+                                                                   segments,
+                                                                   begin_offsets,
+                                                                   end_offsets,
+                                                                   nth + 1,
+                                                                   stream,
+                                                                   debug_synchronous);
+}
+
+/// \brief Rearranges every segment of key-value pairs so that the key at position \p nth of the
+/// segment is the key that would be there if the segment was sorted.
+///
+/// Works like \p segmented_nth_element_keys, and additionally writes the value of every key to
+/// the same position of \p values_output.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p topk_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator [inferred] random-access iterator type of the values input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator [inferred] random-access iterator type of the values output
+///   range. Must meet the requirements of a C++ OutputIterator concept. It can be a simple
+///   pointer type.
+/// \tparam OffsetIterator [inferred] random-access iterator type of segment offsets. Must meet the
+///   requirements of a C++ InputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the rearrangement.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [in] values_input iterator to the values input range.
+/// \param [out] keys_output iterator to the output range.
+/// \param [out] values_output iterator to the values output range.
+/// \param [in] segments number of segments in the input range.
+/// \param [in] begin_offsets iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets iterator to the first element in the range of ending offsets.
+/// \param [in] nth index of the nth element within every segment.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful rearrangement; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_nth_element_pairs(void*                temporary_storage,
+                                              size_t&              storage_size,
+                                              KeysInputIterator    keys_input,
+                                              ValuesInputIterator  values_input,
+                                              KeysOutputIterator   keys_output,
+                                              ValuesOutputIterator values_output,
+                                              unsigned int         segments,
+                                              OffsetIterator       begin_offsets,
+                                              OffsetIterator       end_offsets,
+                                              unsigned int         nth,
+                                              hipStream_t          stream            = 0,
+                                              bool                 debug_synchronous = false)
+{
+    return detail::segmented_topk_impl<Config, false, false, true>(temporary_storage,
+                                                                   storage_size,
+                                                                   keys_input,
+                                                                   values_input,
+                                                                   keys_output,
+                                                                   values_output,
+                                                                   segments,
+                                                                   begin_offsets,
+                                                                   end_offsets,
+                                                                   nth + 1,
+                                                                   stream,
+                                                                   debug_synchronous);
+}
+
 /// @}
 // end of group devicemodule
 
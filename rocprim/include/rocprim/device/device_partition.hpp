@@ -22,8 +22,10 @@
 #define ROCPRIM_DEVICE_DEVICE_PARTITION_HPP_
 
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <type_traits>
 
 #include "../config.hpp"
@@ -31,14 +33,20 @@
 #include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
 #include "../functional.hpp"
+#include "../iterator/counting_iterator.hpp"
 #include "../iterator/reverse_iterator.hpp"
+#include "../iterator/zip_iterator.hpp"
 #include "../type_traits.hpp"
 #include "../types.hpp"
 
 #include "detail/device_partition.hpp"
+#include "detail/device_select_unordered.hpp"
 #include "detail/device_scan_common.hpp"
+#include "detail/device_scan_two_pass.hpp"
 #include "device_partition_config.hpp"
 #include "device_transform.hpp"
+#include "execution_budget.hpp"
+#include "tuning_database.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -90,6 +98,72 @@ ROCPRIM_KERNEL
                                                               predicates...);
 }
 
+template<select_method SelectMethod,
+         class Config,
+         class OffsetT,
+         class KeyIterator,
+         class FlagIterator,
+         class InequalityOp,
+         class... UnaryPredicates>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    partition_two_pass_count_kernel(KeyIterator  keys_input,
+                                    FlagIterator flags,
+                                    InequalityOp inequality_op,
+                                    const size_t tiles_per_partition,
+                                    OffsetT*     partition_counts,
+                                    UnaryPredicates... predicates)
+{
+    partition_two_pass_count_kernel_impl<SelectMethod, Config>(keys_input,
+                                                               flags,
+                                                               inequality_op,
+                                                               tiles_per_partition,
+                                                               partition_counts,
+                                                               predicates...);
+}
+
+template<select_method SelectMethod,
+         bool          OnlySelected,
+         class Config,
+         class OffsetT,
+         class KeyIterator,
+         class ValueIterator,
+         class FlagIterator,
+         class OutputKeyIterator,
+         class OutputValueIterator,
+         class InequalityOp,
+         class... UnaryPredicates>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    partition_two_pass_kernel(KeyIterator         keys_input,
+                              ValueIterator       values_input,
+                              FlagIterator        flags,
+                              OutputKeyIterator   keys_output,
+                              OutputValueIterator values_output,
+                              size_t*             selected_count,
+                              size_t*             prev_selected_count,
+                              const size_t        total_size,
+                              InequalityOp        inequality_op,
+                              const OffsetT*      partition_prefixes,
+                              const size_t        tiles_per_partition,
+                              const unsigned int  number_of_tiles,
+                              UnaryPredicates... predicates)
+{
+    partition_two_pass_kernel_impl<SelectMethod, OnlySelected, Config>(keys_input,
+                                                                       values_input,
+                                                                       flags,
+                                                                       keys_output,
+                                                                       values_output,
+                                                                       selected_count,
+                                                                       prev_selected_count,
+                                                                       total_size,
+                                                                       inequality_op,
+                                                                       partition_prefixes,
+                                                                       tiles_per_partition,
+                                                                       number_of_tiles,
+                                                                       predicates...);
+}
+
 #define ROCPRIM_DETAIL_HIP_SYNC(name, size, start) \
     if(debug_synchronous) \
     { \
@@ -101,6 +175,153 @@ ROCPRIM_KERNEL
         std::cout << " " << d.count() * 1000 << " ms" << '\n'; \
     }
 
+// Partitions at least two tiles without look-back: the selected items of the partitions of tiles
+// are counted, the counts are scanned by a single block, then the partitions are scattered. The
+// counts are plain sums of the selection flags, see two_pass_scan_impl.
+template<select_method Method,
+         bool          OnlySelected,
+         class Config,
+         class OffsetT,
+         class KeyIterator,
+         class ValueIterator,
+         class FlagIterator,
+         class OutputKeyIterator,
+         class OutputValueIterator,
+         class InequalityOp,
+         class SelectedCountOutputIterator,
+         class... UnaryPredicates>
+inline hipError_t partition_two_pass_impl(void*                         temporary_storage,
+                                          size_t&                       storage_size,
+                                          KeyIterator                   keys_input,
+                                          ValueIterator                 values_input,
+                                          FlagIterator                  flags,
+                                          OutputKeyIterator             keys_output,
+                                          OutputValueIterator           values_output,
+                                          SelectedCountOutputIterator   selected_count_output,
+                                          const size_t                  size,
+                                          InequalityOp                  inequality_op,
+                                          const partition_config_params params,
+                                          const hipStream_t             stream,
+                                          bool                          debug_synchronous,
+                                          UnaryPredicates... predicates)
+{
+    using offset_type = OffsetT;
+
+    const unsigned int block_size       = params.kernel_config.block_size;
+    const unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    const auto         items_per_block  = block_size * items_per_thread;
+    const unsigned int number_of_tiles
+        = static_cast<unsigned int>(::rocprim::detail::ceiling_div(size, items_per_block));
+
+    static constexpr const size_t selected_count_size = sizeof...(UnaryPredicates);
+
+    // The partition counts are scanned by one block, so there are at most items_per_block
+    // partitions. The partitions only depend on the size and the config, not on the occupancy.
+    const size_t max_partitions = std::min<size_t>(number_of_tiles, items_per_block);
+    const size_t tiles_per_partition
+        = ::rocprim::detail::ceiling_div(number_of_tiles, max_partitions);
+    const unsigned int number_of_partitions = static_cast<unsigned int>(
+        ::rocprim::detail::ceiling_div(number_of_tiles, tiles_per_partition));
+
+    offset_type* partition_counts;
+    size_t*      selected_count;
+    size_t*      prev_selected_count;
+
+    hipError_t result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&partition_counts, max_partitions),
+            // Allocated continuously, so that they can be initialized simultaneously.
+            detail::temp_storage::ptr_aligned_array(&selected_count, selected_count_size),
+            detail::temp_storage::ptr_aligned_array(&prev_selected_count, selected_count_size)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    // The tiles are scattered in one launch, so there is no count of preceding launches.
+    result = hipMemsetAsync(selected_count,
+                            0,
+                            sizeof(*selected_count) * 2 * selected_count_size,
+                            stream);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    const auto kernel = partition_two_pass_kernel<Method,
+                                                  OnlySelected,
+                                                  Config,
+                                                  offset_type,
+                                                  KeyIterator,
+                                                  ValueIterator,
+                                                  FlagIterator,
+                                                  OutputKeyIterator,
+                                                  OutputValueIterator,
+                                                  InequalityOp,
+                                                  UnaryPredicates...>;
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "size " << size << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of tiles " << number_of_tiles << '\n';
+        std::cout << "number of partitions " << number_of_partitions << '\n';
+        std::cout << "tiles per partition " << tiles_per_partition << '\n';
+    }
+
+    if(number_of_partitions > 1)
+    {
+        if(debug_synchronous) start = std::chrono::steady_clock::now();
+        partition_two_pass_count_kernel<Method, Config>
+            <<<dim3(number_of_partitions - 1), dim3(block_size), 0, stream>>>(
+                keys_input,
+                flags,
+                inequality_op,
+                tiles_per_partition,
+                partition_counts,
+                predicates...);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_two_pass_count_kernel",
+                                                    (number_of_partitions - 1)
+                                                        * tiles_per_partition * items_per_block,
+                                                    start);
+
+        if(debug_synchronous) start = std::chrono::steady_clock::now();
+        two_pass_scan_partitions_kernel<Config>
+            <<<dim3(1), dim3(block_size), 0, stream>>>(partition_counts,
+                                                       number_of_partitions - 1,
+                                                       ::rocprim::plus<offset_type>());
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("two_pass_scan_partitions_kernel",
+                                                    number_of_partitions - 1,
+                                                    start);
+    }
+
+    if(debug_synchronous) start = std::chrono::steady_clock::now();
+    kernel<<<dim3(number_of_partitions), dim3(block_size), 0, stream>>>(keys_input,
+                                                                        values_input,
+                                                                        flags,
+                                                                        keys_output,
+                                                                        values_output,
+                                                                        selected_count,
+                                                                        prev_selected_count,
+                                                                        size,
+                                                                        inequality_op,
+                                                                        partition_counts,
+                                                                        tiles_per_partition,
+                                                                        number_of_tiles,
+                                                                        predicates...);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_two_pass_kernel", size, start);
+
+    return ::rocprim::transform(selected_count,
+                                selected_count_output,
+                                selected_count_size,
+                                ::rocprim::identity<>{},
+                                stream,
+                                debug_synchronous);
+}
 
 template<partition_subalgo SubAlgo,
          class Config,
@@ -113,19 +334,19 @@ template<partition_subalgo SubAlgo,
          class InequalityOp,
          class SelectedCountOutputIterator,
          class... UnaryPredicates>
-inline hipError_t partition_impl(void*                       temporary_storage,
-                                 size_t&                     storage_size,
-                                 KeyIterator                 keys_input,
-                                 ValueIterator               values_input,
-                                 FlagIterator                flags,
-                                 OutputKeyIterator           keys_output,
-                                 OutputValueIterator         values_output,
-                                 SelectedCountOutputIterator selected_count_output,
-                                 const size_t                size,
-                                 InequalityOp                inequality_op,
-                                 const hipStream_t           stream,
-                                 bool                        debug_synchronous,
-                                 UnaryPredicates... predicates)
+inline hipError_t partition_config_impl(void*                       temporary_storage,
+                                        size_t&                     storage_size,
+                                        KeyIterator                 keys_input,
+                                        ValueIterator               values_input,
+                                        FlagIterator                flags,
+                                        OutputKeyIterator           keys_output,
+                                        OutputValueIterator         values_output,
+                                        SelectedCountOutputIterator selected_count_output,
+                                        const size_t                size,
+                                        InequalityOp                inequality_op,
+                                        const hipStream_t           stream,
+                                        bool                        debug_synchronous,
+                                        UnaryPredicates... predicates)
 {
     using offset_type = OffsetT;
     using key_type = typename std::iterator_traits<KeyIterator>::value_type;
@@ -160,16 +381,41 @@ inline hipError_t partition_impl(void*                       temporary_storage,
     const partition_config_params params = dispatch_target_arch<config>(target_arch);
 
     using offset_scan_state_type = detail::lookback_scan_state<offset_type>;
-    using offset_scan_state_with_sleep_type = detail::lookback_scan_state<offset_type, true>;
 
     const unsigned int block_size       = params.kernel_config.block_size;
     const unsigned int items_per_thread = params.kernel_config.items_per_thread;
     const auto         items_per_block  = block_size * items_per_thread;
 
+    // The two-pass partition is used if the config asks for it, as long as the offsets of all
+    // tiles fit in an unsigned int.
+    const size_t number_of_tiles = ::rocprim::detail::ceiling_div(size, items_per_block);
+    const bool   two_pass
+        = params.two_pass && number_of_tiles > 1
+          && number_of_tiles * items_per_block <= std::numeric_limits<unsigned int>::max();
+    if(two_pass)
+    {
+        return partition_two_pass_impl<method, write_only_selected, config, offset_type>(
+            temporary_storage,
+            storage_size,
+            keys_input,
+            values_input,
+            flags,
+            keys_output,
+            values_output,
+            selected_count_output,
+            size,
+            inequality_op,
+            params,
+            stream,
+            debug_synchronous,
+            predicates...);
+    }
+
     static constexpr bool is_three_way = sizeof...(UnaryPredicates) == 2;
     static constexpr const size_t selected_count_size = is_three_way ? 2 : 1;
 
-    const size_t size_limit = params.kernel_config.size_limit;
+    const size_t size_limit
+        = budgeted_size_limit(stream, params.kernel_config.size_limit, items_per_block);
     const size_t aligned_size_limit
         = ::rocprim::max<size_t>(size_limit - (size_limit % items_per_block), items_per_block);
     const size_t limited_size     = std::min<size_t>(size, aligned_size_limit);
@@ -194,7 +440,6 @@ inline hipError_t partition_impl(void*                       temporary_storage,
         temporary_storage,
         storage_size,
         detail::temp_storage::make_linear_partition(
-            // This is valid even with offset_scan_state_with_sleep_type
             detail::temp_storage::make_partition(&offset_scan_state_storage, layout),
             // Note: the following two are to be allocated continuously, so that they can be initialized
             // simultaneously.
@@ -209,48 +454,18 @@ inline hipError_t partition_impl(void*                       temporary_storage,
     // Start point for time measurements
     std::chrono::steady_clock::time_point start;
 
-    bool use_sleep;
-    result = is_sleep_scan_state_used(stream, use_sleep);
-    if(result != hipSuccess)
-    {
-        return result;
-    }
-
     // Create and initialize lookback_scan_state obj
-    offset_scan_state_type offset_scan_state{};
-    result = offset_scan_state_type::create(offset_scan_state,
+    offset_scan_state_type scan_state{};
+    result = offset_scan_state_type::create(scan_state,
                                             offset_scan_state_storage,
                                             number_of_blocks,
-                                            stream);
-    if(result != hipSuccess)
-    {
-        return result;
-    }
-    offset_scan_state_with_sleep_type offset_scan_state_with_sleep{};
-    result = offset_scan_state_with_sleep_type::create(offset_scan_state_with_sleep,
-                                                       offset_scan_state_storage,
-                                                       number_of_blocks,
-                                                       stream);
+                                            stream,
+                                            params.backoff);
     if(result != hipSuccess)
     {
         return result;
     }
 
-    // Call the provided function with either offset_scan_state or offset_scan_state_with_sleep based on
-    // the value of use_sleep
-    auto with_scan_state = [use_sleep, offset_scan_state, offset_scan_state_with_sleep](
-                               auto&& func) mutable -> decltype(auto)
-    {
-        if(use_sleep)
-        {
-            return func(offset_scan_state_with_sleep);
-        }
-        else
-        {
-            return func(offset_scan_state);
-        }
-    };
-
     // Memset selected_count and prev_selected_count at once
     result = hipMemsetAsync(selected_count,
                             0,
@@ -290,41 +505,38 @@ inline hipError_t partition_impl(void*                       temporary_storage,
             start = std::chrono::steady_clock::now();
         }
 
-        with_scan_state(
-            [&](const auto scan_state)
-            {
-                const unsigned int block_size = ROCPRIM_DEFAULT_MAX_BLOCK_SIZE;
-                const unsigned int grid_size
-                    = ::rocprim::detail::ceiling_div(current_number_of_blocks, block_size);
-                init_lookback_scan_state_kernel<decltype(scan_state)>
-                    <<<dim3(grid_size), dim3(block_size), 0, stream>>>(scan_state,
-                                                                       current_number_of_blocks);
-            });
-        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_offset_scan_state_kernel",
-                                                    current_number_of_blocks,
-                                                    start);
-
-        if(debug_synchronous) start = std::chrono::steady_clock::now();
+        // A single block does not look back, so its scan state does not need to be initialized.
+        if(current_number_of_blocks > 1)
+        {
+            const unsigned int init_block_size = ROCPRIM_DEFAULT_MAX_BLOCK_SIZE;
+            const unsigned int init_grid_size
+                = ::rocprim::detail::ceiling_div(current_number_of_blocks, init_block_size);
+            init_lookback_scan_state_kernel<offset_scan_state_type>
+                <<<dim3(init_grid_size), dim3(init_block_size), 0, stream>>>(
+                    scan_state,
+                    current_number_of_blocks);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_offset_scan_state_kernel",
+                                                        current_number_of_blocks,
+                                                        start);
+
+            if(debug_synchronous) start = std::chrono::steady_clock::now();
+        }
 
-        with_scan_state(
-            [&](const auto scan_state)
-            {
-                partition_kernel<method, write_only_selected, config>
-                    <<<dim3(current_number_of_blocks), dim3(block_size), 0, stream>>>(
-                        keys_input + prev_processed,
-                        values_input + prev_processed,
-                        flags + prev_processed,
-                        keys_output,
-                        values_output,
-                        selected_count,
-                        prev_selected_count,
-                        prev_processed,
-                        size,
-                        inequality_op,
-                        scan_state,
-                        current_number_of_blocks,
-                        predicates...);
-            });
+        partition_kernel<method, write_only_selected, config>
+            <<<dim3(current_number_of_blocks), dim3(block_size), 0, stream>>>(
+                keys_input + prev_processed,
+                values_input + prev_processed,
+                flags + prev_processed,
+                keys_output,
+                values_output,
+                selected_count,
+                prev_selected_count,
+                prev_processed,
+                size,
+                inequality_op,
+                scan_state,
+                current_number_of_blocks,
+                predicates...);
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_kernel", size, start);
 
         std::swap(selected_count, prev_selected_count);
@@ -344,9 +556,208 @@ inline hipError_t partition_impl(void*                       temporary_storage,
     return hipSuccess;
 }
 
+template<partition_subalgo SubAlgo,
+         class Config,
+         class OffsetT,
+         class KeyIterator,
+         class ValueIterator, // can be rocprim::empty_type* for key only
+         class FlagIterator,
+         class OutputKeyIterator,
+         class OutputValueIterator, // can be rocprim::empty_type* for key only
+         class InequalityOp,
+         class SelectedCountOutputIterator,
+         class... UnaryPredicates>
+inline hipError_t partition_impl(void*                       temporary_storage,
+                                 size_t&                     storage_size,
+                                 KeyIterator                 keys_input,
+                                 ValueIterator               values_input,
+                                 FlagIterator                flags,
+                                 OutputKeyIterator           keys_output,
+                                 OutputValueIterator         values_output,
+                                 SelectedCountOutputIterator selected_count_output,
+                                 const size_t                size,
+                                 InequalityOp                inequality_op,
+                                 const hipStream_t           stream,
+                                 bool                        debug_synchronous,
+                                 UnaryPredicates... predicates)
+{
+    using key_type   = typename std::iterator_traits<KeyIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValueIterator>::value_type;
+
+    constexpr bool is_select = SubAlgo == partition_subalgo::select_flag
+                               || SubAlgo == partition_subalgo::select_predicate
+                               || SubAlgo == partition_subalgo::select_predicated_flag
+                               || SubAlgo == partition_subalgo::select_unique
+                               || SubAlgo == partition_subalgo::select_unique_by_key;
+
+    return dispatch_tuned_config<Config, key_type, value_type>(
+        is_select ? "select" : "partition",
+        size,
+        stream,
+        [&](auto config)
+        {
+            return partition_config_impl<SubAlgo, typename decltype(config)::type, OffsetT>(
+                temporary_storage,
+                storage_size,
+                keys_input,
+                values_input,
+                flags,
+                keys_output,
+                values_output,
+                selected_count_output,
+                size,
+                inequality_op,
+                stream,
+                debug_synchronous,
+                predicates...);
+        });
+}
 
 #undef ROCPRIM_DETAIL_HIP_SYNC
 
+// Selects or partitions without keeping the order of the items, see select_unordered_kernel.
+// FlagOp flags the selected items, it is called with an item and its index in the input.
+template<partition_subalgo SubAlgo,
+         bool WriteRejected,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator,
+         class FlagOp>
+inline hipError_t partition_unordered_impl(void*                       temporary_storage,
+                                           size_t&                     storage_size,
+                                           InputIterator               input,
+                                           OutputIterator              output,
+                                           SelectedCountOutputIterator selected_count_output,
+                                           const size_t                size,
+                                           FlagOp                      flag_op,
+                                           const hipStream_t           stream,
+                                           const bool                  debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using config = wrapped_partition_config<Config, SubAlgo, input_type, ::rocprim::empty_type>;
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const partition_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+
+    // The selected and the rejected items are counted separately.
+    size_t* counters = nullptr;
+
+    result = temp_storage::partition(temporary_storage,
+                                     storage_size,
+                                     temp_storage::make_linear_partition(
+                                         temp_storage::ptr_aligned_array(&counters, 2)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    const size_t size_limit
+        = budgeted_size_limit(stream, params.kernel_config.size_limit, items_per_block);
+    const size_t aligned_size_limit
+        = ::rocprim::max<size_t>(size_limit - size_limit % items_per_block, items_per_block);
+    const size_t number_of_launches = ceiling_div(size, aligned_size_limit);
+
+    if(debug_synchronous)
+    {
+        std::cout << "size " << size << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+        std::cout << "number_of_launches " << number_of_launches << '\n';
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(hipMemsetAsync(counters, 0, sizeof(*counters) * 2, stream));
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    // The launches all reserve space in the output with the same counters, so they do not need
+    // to pass state between each other.
+    for(size_t offset = 0; offset < size; offset += aligned_size_limit)
+    {
+        const size_t       current_size = ::rocprim::min(size - offset, aligned_size_limit);
+        const unsigned int number_of_blocks
+            = static_cast<unsigned int>(ceiling_div(current_size, items_per_block));
+
+        if(debug_synchronous)
+        {
+            std::cout << "current size " << current_size << '\n';
+            start = std::chrono::steady_clock::now();
+        }
+        select_unordered_kernel<config, WriteRejected>
+            <<<dim3(number_of_blocks), dim3(block_size), 0, stream>>>(input,
+                                                                      offset,
+                                                                      size,
+                                                                      output,
+                                                                      counters,
+                                                                      flag_op);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("select_unordered_kernel",
+                                                    current_size,
+                                                    start);
+    }
+
+    return ::rocprim::transform(counters,
+                                selected_count_output,
+                                1,
+                                ::rocprim::identity<>{},
+                                stream,
+                                debug_synchronous);
+}
+
+// The type of the indices written by the *_with_index algorithms, which is the value type of
+// the index output, or size_t if the output has no value type (e.g. discard_iterator).
+template<class IndexOutputIterator>
+using with_index_type = typename std::conditional<
+    std::is_void<typename std::iterator_traits<IndexOutputIterator>::value_type>::value,
+    size_t,
+    typename std::iterator_traits<IndexOutputIterator>::value_type>::type;
+
+// The items are zipped with their index in the input, so that the index is carried through the
+// selection like a part of the item and written in the same pass.
+template<class IndexOutputIterator, class InputIterator>
+inline auto make_with_index_input(InputIterator input)
+{
+    return ::rocprim::make_zip_iterator(::rocprim::make_tuple(
+        input,
+        ::rocprim::counting_iterator<with_index_type<IndexOutputIterator>>(0)));
+}
+
+template<class OutputIterator, class IndexOutputIterator>
+inline auto make_with_index_output(OutputIterator output, IndexOutputIterator index_output)
+{
+    return ::rocprim::make_zip_iterator(::rocprim::make_tuple(output, index_output));
+}
+
+// Applies the predicate of the *_with_index algorithms to the item of a zipped item and index.
+template<class UnaryPredicate>
+struct with_index_predicate
+{
+    ROCPRIM_HOST_DEVICE inline
+    with_index_predicate() = default;
+
+    ROCPRIM_HOST_DEVICE inline
+    with_index_predicate(UnaryPredicate predicate)
+        : predicate(predicate)
+    {}
+
+    template<class T, class Index>
+    ROCPRIM_HOST_DEVICE inline
+    bool operator()(const ::rocprim::tuple<T, Index>& item_with_index)
+    {
+        return predicate(::rocprim::get<0>(item_with_index));
+    }
+
+    UnaryPredicate predicate;
+};
+
 } // end of detail namespace
 
 /// \brief Two-way parallel select primitive for device level using selection predicate.
@@ -365,7 +776,8 @@ inline hipError_t partition_impl(void*                       temporary_storage,
 /// * Range specified by \p selected_count_output must have at least 1 element.
 /// * Relative order is preserved.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `select_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `select_config`
+/// or a `tuned_config` of these.
 /// \tparam InputIterator - random-access iterator type of the input range. It can be a simple
 /// pointer type.
 /// \tparam SelectedOutputIterator - random-access iterator type of the selected output range. It
@@ -512,7 +924,8 @@ inline hipError_t partition_two_way(void*                       temporary_storag
 /// * Values of \p flag range should be implicitly convertible to `bool` type.
 /// * The relative order of elements in both output ranges matches the input range.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `select_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `select_config`
+/// or a `tuned_config` of these.
 /// \tparam InputIterator - random-access iterator type of the input range. It can be
 /// a simple pointer type.
 /// \tparam FlagIterator - random-access iterator type of the flag range. It can be
@@ -647,7 +1060,8 @@ inline hipError_t partition_two_way(void*                       temporary_storag
 /// * Relative order is preserved for the elements for which the corresponding values from \p flags
 /// are \p true. Other elements are copied in reverse order.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `select_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `select_config`
+/// or a `tuned_config` of these.
 /// \tparam InputIterator - random-access iterator type of the input range. It can be
 /// a simple pointer type.
 /// \tparam FlagIterator - random-access iterator type of the flag range. It can be
@@ -768,7 +1182,8 @@ hipError_t partition(void * temporary_storage,
 /// * Relative order is preserved for the elements for which the \p predicate returns \p true. Other
 /// elements are copied in reverse order.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `select_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `select_config`
+/// or a `tuned_config` of these.
 /// \tparam InputIterator - random-access iterator type of the input range. It can be
 /// a simple pointer type.
 /// \tparam OutputIterator - random-access iterator type of the output range. It can be
@@ -913,7 +1328,8 @@ hipError_t partition(void * temporary_storage,
 /// minus the number of elements written to \p output_first_part minus the number of elements written
 /// to \p output_second_part.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `select_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `select_config`
+/// or a `tuned_config` of these.
 /// \tparam InputIterator - random-access iterator type of the input range. It can be
 /// a simple pointer type.
 /// \tparam FirstOutputIterator - random-access iterator type of the first output range. It can be
@@ -1072,6 +1488,193 @@ hipError_t partition_three_way(void * temporary_storage,
                                                select_second_part_op);
 }
 
+/// \brief Parallel partition primitive for device level using selection predicate, which writes
+/// the items of each part in an unspecified order.
+///
+/// Performs a device-wide partition like \p partition with a predicate: the selected items are
+/// written to the beginning of \p output and the rejected items to its end. Unlike
+/// \p partition, the items are not kept in their order within each part. In return there is no
+/// scan of the flags and no look-back between the tiles: the items of a warp are counted with
+/// ballots, and space for them is reserved in each part with one atomic per warp.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+/// * Range specified by \p selected_count_output must have at least 1 element.
+/// * The order of the items within each part is <b>unspecified</b>, and may differ between
+/// calls with the same input.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`,
+/// `partition_config` or a `tuned_config` of these. Only the block size and the items per
+/// thread are used.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the selected_count_output
+/// value. It can be a simple pointer type.
+/// \tparam UnaryPredicate - type of a unary selection predicate.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the partition operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to partition.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [out] selected_count_output - iterator to the total number of selected values.
+/// \param [in] size - number of elements in the input range.
+/// \param [in] predicate - unary function object which returns \p true if the element should be
+/// ordered before other elements.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator,
+         class UnaryPredicate>
+inline hipError_t partition_unordered(void*                       temporary_storage,
+                                      size_t&                     storage_size,
+                                      InputIterator               input,
+                                      OutputIterator              output,
+                                      SelectedCountOutputIterator selected_count_output,
+                                      const size_t                size,
+                                      UnaryPredicate              predicate,
+                                      const hipStream_t           stream            = 0,
+                                      const bool                  debug_synchronous = false)
+{
+    return detail::partition_unordered_impl<detail::partition_subalgo::partition_predicate,
+                                            true,
+                                            Config>(
+        temporary_storage,
+        storage_size,
+        input,
+        output,
+        selected_count_output,
+        size,
+        detail::select_unordered_predicate_op<UnaryPredicate>{predicate},
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel partition primitive for device level using selection predicate, which also
+/// writes the index in the input of every item.
+///
+/// Same as \p partition with a predicate, except that the index in \p input of every item is
+/// written to \p index_output at the same position as the item is written to \p output. The
+/// items and their indices are written in a single pass, without a second partition of a
+/// \p counting_iterator.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input, \p output and \p index_output must have at least \p size
+/// elements.
+/// * The indices have the value type of \p index_output, or \p size_t if it has none.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`,
+/// `partition_config` or a `tuned_config` of these.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam IndexOutputIterator - random-access iterator type of the output range of the indices.
+/// It can be a simple pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the selected_count_output
+/// value. It can be a simple pointer type.
+/// \tparam UnaryPredicate - type of a unary selection predicate.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the partition operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to partition.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [out] index_output - iterator to the first element in the output range of the indices.
+/// \param [out] selected_count_output - iterator to the total number of selected values.
+/// \param [in] size - number of elements in the input range.
+/// \param [in] predicate - unary function object which returns \p true if the element should be
+/// ordered before other elements.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto predicate =
+///     [] __device__ (int a) -> bool
+///     {
+///         return (a%2) == 0;
+///     };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;     // e.g., 6
+/// int * input;           // e.g., [1, 2, 3, 4, 5, 6]
+/// int * output;          // empty array of 6 elements
+/// size_t * indices;      // empty array of 6 elements
+/// size_t * output_count; // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::partition_with_index(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, indices, output_count,
+///     input_size, predicate
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform partition
+/// rocprim::partition_with_index(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, indices, output_count,
+///     input_size, predicate
+/// );
+/// // output:  [2, 4, 6, 5, 3, 1]
+/// // indices: [1, 3, 5, 4, 2, 0]
+/// // output_count: 3
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class IndexOutputIterator,
+         class SelectedCountOutputIterator,
+         class UnaryPredicate>
+inline hipError_t partition_with_index(void*                       temporary_storage,
+                                       size_t&                     storage_size,
+                                       InputIterator               input,
+                                       OutputIterator              output,
+                                       IndexOutputIterator         index_output,
+                                       SelectedCountOutputIterator selected_count_output,
+                                       const size_t                size,
+                                       UnaryPredicate              predicate,
+                                       const hipStream_t           stream            = 0,
+                                       const bool                  debug_synchronous = false)
+{
+    return partition<Config>(temporary_storage,
+                             storage_size,
+                             detail::make_with_index_input<IndexOutputIterator>(input),
+                             detail::make_with_index_output(output, index_output),
+                             selected_count_output,
+                             size,
+                             detail::with_index_predicate<UnaryPredicate>(predicate),
+                             stream,
+                             debug_synchronous);
+}
+
 /// @}
 // end of group devicemodule
 
@@ -0,0 +1,745 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_PARTITION_N_HPP_
+#define ROCPRIM_DEVICE_DEVICE_PARTITION_N_HPP_
+
+#include "detail/device_partition_n.hpp"
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../functional.hpp"
+#include "../iterator/discard_iterator.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "detail/config/lookback_backoff.hpp"
+#include "device_partition_n_config.hpp"
+#include "device_transform.hpp"
+#include "execution_budget.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The partition of a whole input, without segments.
+struct partition_n_no_segments
+{};
+
+// The segments of a segmented partition: the offsets of their bounds in the input, and the output
+// of the counts of the buckets of every segment.
+template<class SegmentOffsetIterator, class SegmentBucketCountOutputIterator>
+struct partition_n_segments
+{
+    SegmentOffsetIterator            offsets;
+    SegmentBucketCountOutputIterator bucket_counts_output;
+    size_t                           count;
+};
+
+inline size_t partition_n_segment_count(partition_n_no_segments)
+{
+    return 0;
+}
+
+template<class SegmentOffsetIterator, class SegmentBucketCountOutputIterator>
+inline size_t partition_n_segment_count(
+    const partition_n_segments<SegmentOffsetIterator, SegmentBucketCountOutputIterator>& segments)
+{
+    return segments.count;
+}
+
+// A segmented partition strides over the tiles of a segment with at most this many blocks.
+constexpr unsigned int partition_n_max_blocks_per_segment = 256;
+
+template<class Config, unsigned int Buckets, class InputIterator, class BucketOp>
+inline hipError_t partition_n_histogram(partition_n_no_segments,
+                                        InputIterator      input,
+                                        const size_t       size,
+                                        BucketOp           bucket_op,
+                                        size_t*            bucket_counts,
+                                        size_t*            /*segment_bucket_counts*/,
+                                        const unsigned int block_size,
+                                        const size_t       num_blocks,
+                                        const hipStream_t  stream,
+                                        const bool         debug_synchronous)
+{
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    partition_n_histogram_kernel<Config, Buckets>
+        <<<dim3(num_blocks), dim3(block_size), 0, stream>>>(input, size, bucket_op, bucket_counts);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_n_histogram_kernel", size, start);
+
+    return hipSuccess;
+}
+
+template<class Config,
+         unsigned int Buckets,
+         class InputIterator,
+         class SegmentOffsetIterator,
+         class SegmentBucketCountOutputIterator,
+         class BucketOp>
+inline hipError_t partition_n_histogram(
+    const partition_n_segments<SegmentOffsetIterator, SegmentBucketCountOutputIterator>& segments,
+    InputIterator      input,
+    const size_t       size,
+    BucketOp           bucket_op,
+    size_t*            bucket_counts,
+    size_t*            segment_bucket_counts,
+    const unsigned int block_size,
+    const size_t       num_blocks,
+    const hipStream_t  stream,
+    const bool         debug_synchronous)
+{
+    if(segments.count == 0)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(size != 0)
+    {
+        const unsigned int blocks_per_segment = static_cast<unsigned int>(
+            ::rocprim::min<size_t>(ceiling_div(num_blocks, segments.count),
+                                   partition_n_max_blocks_per_segment));
+        if(debug_synchronous)
+        {
+            std::cout << "segments: " << segments.count << '\n';
+            std::cout << "blocks_per_segment: " << blocks_per_segment << '\n';
+            start = std::chrono::steady_clock::now();
+        }
+        const dim3 grid(static_cast<unsigned int>(segments.count), blocks_per_segment);
+        partition_n_segmented_histogram_kernel<Config, Buckets>
+            <<<grid, dim3(block_size), 0, stream>>>(input,
+                                                    segments.offsets,
+                                                    segments.count,
+                                                    bucket_op,
+                                                    bucket_counts,
+                                                    segment_bucket_counts);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_n_segmented_histogram_kernel",
+                                                    size,
+                                                    start);
+    }
+
+    // The counts of the segments are also written for an empty input, as zeros.
+    return ::rocprim::transform(segment_bucket_counts,
+                                segments.bucket_counts_output,
+                                segments.count * Buckets,
+                                ::rocprim::identity<size_t>(),
+                                stream,
+                                debug_synchronous);
+}
+
+template<unsigned int Buckets,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class BucketCountOutputIterator,
+         class BucketOffsetOutputIterator,
+         class Segments,
+         class BucketOp>
+inline hipError_t partition_n_impl(void*                      temporary_storage,
+                                   size_t&                    storage_size,
+                                   InputIterator              input,
+                                   OutputIterator             output,
+                                   BucketCountOutputIterator  bucket_counts_output,
+                                   BucketOffsetOutputIterator bucket_offsets_output,
+                                   const Segments&            segments,
+                                   const size_t               size,
+                                   BucketOp                   bucket_op,
+                                   const hipStream_t          stream,
+                                   const bool                 debug_synchronous)
+{
+    static_assert(Buckets > 0 && Buckets <= 256, "Buckets must be in the range [1, 256]");
+
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using config     = wrapped_partition_n_config<Config, input_type>;
+
+    constexpr unsigned int radix_size = partition_n_radix<Buckets>::size;
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const partition_n_config_params params = dispatch_target_arch<config>(target_arch);
+
+    lookback_backoff_params backoff;
+    result = resolve_lookback_backoff(stream, lookback_backoff_params{}, backoff);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+
+    // The look-back states hold 30-bit counts, so the scatter is split into batches of at most
+    // 2^30 items, like the iterations of the onesweep radix sort.
+    const unsigned int max_items_per_batch
+        = static_cast<unsigned int>(budgeted_size_limit(stream, 1u << 30, items_per_block));
+    const unsigned int items_per_full_batch
+        = ::rocprim::max(max_items_per_batch - max_items_per_batch % items_per_block,
+                         items_per_block);
+    const unsigned int items_per_batch
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size, items_per_full_batch));
+    const unsigned int blocks_per_batch = ceiling_div(items_per_batch, items_per_block);
+
+    size_t*                  bucket_counts         = nullptr;
+    size_t*                  segment_bucket_counts = nullptr;
+    size_t*                  bucket_offsets        = nullptr;
+    onesweep_lookback_state* lookback_states       = nullptr;
+
+    const size_t segment_count = partition_n_segment_count(segments);
+
+    result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::ptr_aligned_array(&bucket_counts, Buckets),
+            temp_storage::ptr_aligned_array(&segment_bucket_counts, segment_count * Buckets),
+            temp_storage::ptr_aligned_array(&bucket_offsets, 2 * radix_size),
+            temp_storage::ptr_aligned_array(&lookback_states,
+                                            radix_size * ::rocprim::max(1u, blocks_per_batch))));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    const size_t num_blocks = ceiling_div(size, items_per_block);
+    const size_t batches    = ceiling_div(size, items_per_full_batch);
+
+    if(debug_synchronous)
+    {
+        std::cout << "size: " << size << '\n';
+        std::cout << "buckets: " << Buckets << '\n';
+        std::cout << "block_size: " << block_size << '\n';
+        std::cout << "num_blocks: " << num_blocks << '\n';
+        std::cout << "items_per_full_batch: " << items_per_full_batch << '\n';
+        std::cout << "batches: " << batches << '\n';
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(
+        hipMemsetAsync(bucket_counts, 0, sizeof(*bucket_counts) * Buckets, stream));
+    if(segment_count != 0)
+    {
+        ROCPRIM_RETURN_ON_ERROR(hipMemsetAsync(segment_bucket_counts,
+                                               0,
+                                               sizeof(*segment_bucket_counts) * segment_count
+                                                   * Buckets,
+                                               stream));
+    }
+
+    ROCPRIM_RETURN_ON_ERROR((partition_n_histogram<config, Buckets>(segments,
+                                                                    input,
+                                                                    size,
+                                                                    bucket_op,
+                                                                    bucket_counts,
+                                                                    segment_bucket_counts,
+                                                                    block_size,
+                                                                    num_blocks,
+                                                                    stream,
+                                                                    debug_synchronous)));
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    // The counts are also written for an empty input, as zeros.
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    partition_n_offsets_kernel<Buckets>
+        <<<dim3(1), dim3(radix_size), 0, stream>>>(bucket_counts,
+                                                   bucket_offsets,
+                                                   bucket_counts_output,
+                                                   bucket_offsets_output);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_n_offsets_kernel", radix_size, start);
+
+    // The items of separate bucket outputs are scattered to their offsets in their buckets.
+    if ROCPRIM_IF_CONSTEXPR(partition_n_relative_offsets<OutputIterator>::value)
+    {
+        ROCPRIM_RETURN_ON_ERROR(
+            hipMemsetAsync(bucket_offsets, 0, sizeof(*bucket_offsets) * radix_size, stream));
+    }
+
+    size_t* bucket_offsets_in  = bucket_offsets;
+    size_t* bucket_offsets_out = bucket_offsets + radix_size;
+
+    onesweep_lookback_epoch lookback_epoch{};
+    for(size_t batch = 0; batch < batches; ++batch)
+    {
+        const size_t       offset = batch * items_per_full_batch;
+        const unsigned int current_batch_size
+            = static_cast<unsigned int>(::rocprim::min<size_t>(size - offset, items_per_batch));
+        const unsigned int blocks = ceiling_div(current_batch_size, items_per_block);
+
+        // Every batch uses a new epoch of the lookback states, so they are cleared only once.
+        ROCPRIM_RETURN_ON_ERROR(
+            lookback_epoch.next(lookback_states, size_t(radix_size) * blocks, stream));
+
+        if(debug_synchronous)
+        {
+            std::cout << "batch: " << batch << '\n';
+            std::cout << "current_batch_size: " << current_batch_size << '\n';
+            start = std::chrono::steady_clock::now();
+        }
+        partition_n_scatter_kernel<config, Buckets>
+            <<<dim3(blocks), dim3(block_size), 0, stream>>>(input + offset,
+                                                            output,
+                                                            current_batch_size,
+                                                            bucket_op,
+                                                            bucket_offsets_in,
+                                                            bucket_offsets_out,
+                                                            lookback_states,
+                                                            lookback_epoch.epoch,
+                                                            backoff);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_n_scatter_kernel",
+                                                    current_batch_size,
+                                                    start);
+
+        std::swap(bucket_offsets_in, bucket_offsets_out);
+    }
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Partitions the input into \p Buckets buckets that are chosen by a bucket function.
+///
+/// The output holds the items of bucket 0, followed by the items of bucket 1 and so on. Within
+/// a bucket the items keep their order in the input, so the partition is stable. A two-way
+/// partition is the special case of two buckets, and a three-way partition (e.g. less than,
+/// equal to and greater than a pivot) is the case of three buckets.
+///
+/// The items are first counted per bucket, then they are scattered to their buckets in a single
+/// pass where every tile ranks its items by bucket and finds the offsets of its buckets
+/// with a decoupled look-back over the counts of all buckets of the preceding tiles.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * \p Buckets must be in the range <tt>[1, 256]</tt>.
+/// * \p bucket_op must return a bucket in the range <tt>[0, Buckets)</tt> for every item.
+/// * Ranges specified by \p input and \p output must have at least \p size elements, and the
+///   range of \p bucket_counts must have at least \p Buckets elements.
+/// * The ranges of \p input and \p output must not overlap.
+///
+/// \tparam Buckets number of buckets of the partition.
+/// \tparam Config [optional] configuration of the primitive. It has to be
+///   \p partition_n_config.
+/// \tparam InputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BucketCountOutputIterator [inferred] random-access iterator type of the output range
+///   of the counts of the buckets. Must meet the requirements of a C++ OutputIterator concept.
+///   It can be a simple pointer type.
+/// \tparam BucketOp [inferred] type of the bucket function. It must be callable with an item
+///   and return an integral bucket, with the signature equivalent to
+///   <tt>unsigned int f(const T &a);</tt>.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the partition.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input iterator to the input range.
+/// \param [out] output iterator to the output range.
+/// \param [out] bucket_counts iterator to the output range of the number of items of every
+///   bucket.
+/// \param [in] size number of elements in the input range.
+/// \param [in] bucket_op the bucket function.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful partition; otherwise a HIP runtime error of
+///   type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the integers are partitioned by their remainder of the division by 3.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// struct mod_3
+/// {
+///     __device__ unsigned int operator()(const int a) const
+///     {
+///         return a % 3;
+///     }
+/// };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t         input_size;    // e.g., 8
+/// int *          input;         // e.g., [ 1, 2, 3, 4, 5, 6, 7, 8 ]
+/// int *          output;        // empty array of 8 elements
+/// unsigned int * bucket_counts; // empty array of 3 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::partition_n<3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, bucket_counts, input_size, mod_3()
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the partition
+/// rocprim::partition_n<3>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, bucket_counts, input_size, mod_3()
+/// );
+/// // output:        [ 3, 6, 1, 4, 7, 2, 5, 8 ]
+/// // bucket_counts: [ 2, 3, 3 ]
+/// \endcode
+/// \endparblock
+template<unsigned int Buckets,
+         class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class BucketCountOutputIterator,
+         class BucketOp>
+inline hipError_t partition_n(void*                     temporary_storage,
+                              size_t&                   storage_size,
+                              InputIterator             input,
+                              OutputIterator            output,
+                              BucketCountOutputIterator bucket_counts,
+                              size_t                    size,
+                              BucketOp                  bucket_op,
+                              hipStream_t               stream            = 0,
+                              bool                      debug_synchronous = false)
+{
+    return detail::partition_n_impl<Buckets, Config>(temporary_storage,
+                                                     storage_size,
+                                                     input,
+                                                     output,
+                                                     bucket_counts,
+                                                     discard_iterator(),
+                                                     detail::partition_n_no_segments{},
+                                                     size,
+                                                     bucket_op,
+                                                     stream,
+                                                     debug_synchronous);
+}
+
+/// \brief Partitions the input into \p Buckets buckets that are chosen by a bucket function, and
+/// counts the items of every bucket in each segment of the input.
+///
+/// This is the local step of a hash-partitioned shuffle, e.g. of a distributed join, where every
+/// device partitions its rows into a bucket for each of its peers. The outputs are laid out for
+/// an all-to-all-v exchange, such as \p ncclAllToAllv of RCCL:
+/// * \p output holds the items of bucket 0, followed by the items of bucket 1 and so on, so it is
+///   the send buffer of the exchange. Like \p partition_n the partition is stable, and as the
+///   segments are consecutive ranges of the input, the items of a bucket are ordered by segment.
+/// * \p bucket_counts and \p bucket_offsets hold the number of items of every bucket and the
+///   offset of every bucket in \p output, i.e. the send counts and displacements of the exchange.
+/// * \p segment_bucket_counts holds the number of items of each bucket in every segment, with the
+///   counts of a bucket in all segments adjacent: the count of bucket \p b in segment \p s is
+///   <tt>segment_bucket_counts[b * segments + s]</tt>. Its rows of \p segments counts are thus
+///   the parts sent to the peers in an all-to-all of the counts, after which every peer knows
+///   the segments of the items that it receives.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * \p Buckets must be in the range <tt>[1, 256]</tt>.
+/// * \p bucket_op must return a bucket in the range <tt>[0, Buckets)</tt> for every item.
+/// * Segment \p s holds the items <tt>[segment_offsets[s], segment_offsets[s + 1])</tt>, so
+///   \p segment_offsets must have <tt>segments + 1</tt> non-decreasing elements, the first one
+///   \p 0 and the last one \p size.
+/// * Ranges specified by \p input and \p output must have at least \p size elements, the ranges
+///   of \p bucket_counts and \p bucket_offsets must have at least \p Buckets elements, and the
+///   range of \p segment_bucket_counts must have at least <tt>Buckets * segments</tt> elements.
+/// * The ranges of \p input and \p output must not overlap.
+///
+/// \tparam Buckets number of buckets of the partition.
+/// \tparam Config [optional] configuration of the primitive. It has to be
+///   \p partition_n_config.
+/// \tparam InputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam SegmentOffsetIterator [inferred] random-access iterator type of the offsets of the
+///   segments. Must meet the requirements of a C++ InputIterator concept. It can be a simple
+///   pointer type.
+/// \tparam SegmentBucketCountOutputIterator [inferred] random-access iterator type of the output
+///   range of the counts of the buckets in every segment. Must meet the requirements of a C++
+///   OutputIterator concept. It can be a simple pointer type.
+/// \tparam BucketCountOutputIterator [inferred] random-access iterator type of the output range
+///   of the counts of the buckets. Must meet the requirements of a C++ OutputIterator concept.
+///   It can be a simple pointer type.
+/// \tparam BucketOffsetOutputIterator [inferred] random-access iterator type of the output range
+///   of the offsets of the buckets. Must meet the requirements of a C++ OutputIterator concept.
+///   It can be a simple pointer type.
+/// \tparam BucketOp [inferred] type of the bucket function. It must be callable with an item
+///   and return an integral bucket, with the signature equivalent to
+///   <tt>unsigned int f(const T &a);</tt>.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the partition.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input iterator to the input range.
+/// \param [out] output iterator to the output range.
+/// \param [in] segment_offsets iterator to the offsets of the bounds of the segments.
+/// \param [out] segment_bucket_counts iterator to the output range of the number of items of
+///   every bucket in each segment.
+/// \param [out] bucket_counts iterator to the output range of the number of items of every
+///   bucket.
+/// \param [out] bucket_offsets iterator to the output range of the offset of every bucket in
+///   \p output.
+/// \param [in] size number of elements in the input range.
+/// \param [in] segments number of segments of the input range.
+/// \param [in] bucket_op the bucket function.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful partition; otherwise a HIP runtime error of
+///   type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the integers of two segments are partitioned by their remainder of the
+/// division by 2.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// struct mod_2
+/// {
+///     __device__ unsigned int operator()(const int a) const
+///     {
+///         return a % 2;
+///     }
+/// };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t   input_size;            // e.g., 8
+/// size_t   segments;              // e.g., 2
+/// int *    input;                 // e.g., [ 1, 2, 3, 4, 5, 6, 7, 8 ]
+/// size_t * segment_offsets;       // e.g., [ 0, 3, 8 ]
+/// int *    output;                // empty array of 8 elements
+/// size_t * segment_bucket_counts; // empty array of 4 elements
+/// size_t * bucket_counts;         // empty array of 2 elements
+/// size_t * bucket_offsets;        // empty array of 2 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_partition_n<2>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, segment_offsets, segment_bucket_counts, bucket_counts, bucket_offsets,
+///     input_size, segments, mod_2()
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the partition
+/// rocprim::segmented_partition_n<2>(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, segment_offsets, segment_bucket_counts, bucket_counts, bucket_offsets,
+///     input_size, segments, mod_2()
+/// );
+/// // output:                [ 2, 4, 6, 8, 1, 3, 5, 7 ]
+/// // segment_bucket_counts: [ 1, 3, 2, 2 ]
+/// // bucket_counts:         [ 4, 4 ]
+/// // bucket_offsets:        [ 0, 4 ]
+/// \endcode
+/// \endparblock
+template<unsigned int Buckets,
+         class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class SegmentOffsetIterator,
+         class SegmentBucketCountOutputIterator,
+         class BucketCountOutputIterator,
+         class BucketOffsetOutputIterator,
+         class BucketOp>
+inline hipError_t segmented_partition_n(void*                            temporary_storage,
+                                        size_t&                          storage_size,
+                                        InputIterator                    input,
+                                        OutputIterator                   output,
+                                        SegmentOffsetIterator            segment_offsets,
+                                        SegmentBucketCountOutputIterator segment_bucket_counts,
+                                        BucketCountOutputIterator        bucket_counts,
+                                        BucketOffsetOutputIterator       bucket_offsets,
+                                        size_t                           size,
+                                        size_t                           segments,
+                                        BucketOp                         bucket_op,
+                                        hipStream_t                      stream = 0,
+                                        bool debug_synchronous                  = false)
+{
+    using segments_type
+        = detail::partition_n_segments<SegmentOffsetIterator, SegmentBucketCountOutputIterator>;
+    return detail::partition_n_impl<Buckets, Config>(
+        temporary_storage,
+        storage_size,
+        input,
+        output,
+        bucket_counts,
+        bucket_offsets,
+        segments_type{segment_offsets, segment_bucket_counts, segments},
+        size,
+        bucket_op,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Partitions the input into \p Buckets buckets that are chosen by a bucket function,
+/// storing every bucket in its own output, and counts the items of every bucket in each segment
+/// of the input.
+///
+/// This is \p segmented_partition_n where the items of bucket \p b are stored from the start of
+/// <tt>bucket_outputs[b]</tt> instead of from its offset in a single output. The outputs may be
+/// the receive buffers of the peers, e.g. registered for peer access over xGMI with
+/// \p hipDeviceEnablePeerAccess, so the items are scattered directly to the peers without
+/// a local send buffer. \p bucket_counts and \p segment_bucket_counts are written as by
+/// \p segmented_partition_n.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * \p Buckets must be in the range <tt>[1, 256]</tt>.
+/// * \p bucket_op must return a bucket in the range <tt>[0, Buckets)</tt> for every item.
+/// * Segment \p s holds the items <tt>[segment_offsets[s], segment_offsets[s + 1])</tt>, so
+///   \p segment_offsets must have <tt>segments + 1</tt> non-decreasing elements, the first one
+///   \p 0 and the last one \p size.
+/// * The range specified by \p input must have at least \p size elements, the range of output
+///   <tt>bucket_outputs[b]</tt> must have at least as many elements as there are items in bucket
+///   \p b, the range of \p bucket_counts must have at least \p Buckets elements, and the range
+///   of \p segment_bucket_counts must have at least <tt>Buckets * segments</tt> elements.
+/// * The ranges of \p input and the outputs must not overlap.
+///
+/// \tparam Buckets number of buckets of the partition.
+/// \tparam Config [optional] configuration of the primitive. It has to be
+///   \p partition_n_config.
+/// \tparam InputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator [inferred] random-access iterator type of the outputs of the buckets.
+///   Must meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam SegmentOffsetIterator [inferred] random-access iterator type of the offsets of the
+///   segments. Must meet the requirements of a C++ InputIterator concept. It can be a simple
+///   pointer type.
+/// \tparam SegmentBucketCountOutputIterator [inferred] random-access iterator type of the output
+///   range of the counts of the buckets in every segment. Must meet the requirements of a C++
+///   OutputIterator concept. It can be a simple pointer type.
+/// \tparam BucketCountOutputIterator [inferred] random-access iterator type of the output range
+///   of the counts of the buckets. Must meet the requirements of a C++ OutputIterator concept.
+///   It can be a simple pointer type.
+/// \tparam BucketOp [inferred] type of the bucket function. It must be callable with an item
+///   and return an integral bucket, with the signature equivalent to
+///   <tt>unsigned int f(const T &a);</tt>.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the partition.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input iterator to the input range.
+/// \param [out] bucket_outputs host array of the iterators to the outputs of the buckets.
+/// \param [in] segment_offsets iterator to the offsets of the bounds of the segments.
+/// \param [out] segment_bucket_counts iterator to the output range of the number of items of
+///   every bucket in each segment.
+/// \param [out] bucket_counts iterator to the output range of the number of items of every
+///   bucket.
+/// \param [in] size number of elements in the input range.
+/// \param [in] segments number of segments of the input range.
+/// \param [in] bucket_op the bucket function.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful partition; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<unsigned int Buckets,
+         class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class SegmentOffsetIterator,
+         class SegmentBucketCountOutputIterator,
+         class BucketCountOutputIterator,
+         class BucketOp>
+inline hipError_t
+    segmented_partition_n_to_buckets(void*                            temporary_storage,
+                                     size_t&                          storage_size,
+                                     InputIterator                    input,
+                                     const OutputIterator             (&bucket_outputs)[Buckets],
+                                     SegmentOffsetIterator            segment_offsets,
+                                     SegmentBucketCountOutputIterator segment_bucket_counts,
+                                     BucketCountOutputIterator        bucket_counts,
+                                     size_t                           size,
+                                     size_t                           segments,
+                                     BucketOp                         bucket_op,
+                                     hipStream_t                      stream            = 0,
+                                     bool                             debug_synchronous = false)
+{
+    using segments_type
+        = detail::partition_n_segments<SegmentOffsetIterator, SegmentBucketCountOutputIterator>;
+    detail::partition_n_bucket_outputs<OutputIterator, Buckets> outputs;
+    for(unsigned int bucket = 0; bucket < Buckets; ++bucket)
+    {
+        outputs.outputs[bucket] = bucket_outputs[bucket];
+    }
+    return detail::partition_n_impl<Buckets, Config>(
+        temporary_storage,
+        storage_size,
+        input,
+        outputs,
+        bucket_counts,
+        discard_iterator(),
+        segments_type{segment_offsets, segment_bucket_counts, segments},
+        size,
+        bucket_op,
+        stream,
+        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_PARTITION_N_HPP_
@@ -0,0 +1,354 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_PIPELINE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_PIPELINE_HPP_
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../iterator/transform_output_iterator.hpp"
+#include "../type_traits.hpp"
+
+#include "device_reduce.hpp"
+#include "device_select.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// An item of a pipeline, valid unless a filter has dropped it. Dropped items stay in place, so
+// the stages after a filter are fused into the same pass as the stages before it
+template<class T>
+struct pipeline_item
+{
+    T    value;
+    bool valid;
+};
+
+struct pipeline_identity_stage
+{
+    template<class T>
+    ROCPRIM_HOST_DEVICE inline pipeline_item<T> operator()(const T& input) const
+    {
+        return pipeline_item<T>{input, true};
+    }
+};
+
+// The functions of later stages are not called for dropped items
+template<class PreviousStage, class UnaryFunction>
+struct pipeline_map_stage
+{
+    PreviousStage previous;
+    UnaryFunction function;
+
+    template<class T>
+    ROCPRIM_HOST_DEVICE inline auto operator()(const T& input) const
+    {
+        const auto item = previous(input);
+        using result_type =
+            typename std::decay<typename ::rocprim::invoke_result<UnaryFunction,
+                                                                  decltype(item.value)>::type>::
+                type;
+        return pipeline_item<result_type>{item.valid ? function(item.value) : result_type{},
+                                          item.valid};
+    }
+};
+
+template<class PreviousStage, class UnaryPredicate>
+struct pipeline_filter_stage
+{
+    PreviousStage  previous;
+    UnaryPredicate predicate;
+
+    template<class T>
+    ROCPRIM_HOST_DEVICE inline auto operator()(const T& input) const
+    {
+        auto item  = previous(input);
+        item.valid = item.valid && static_cast<bool>(predicate(item.value));
+        return item;
+    }
+};
+
+// Dropped items are skipped by the reduction, so it does not need an identity
+template<class BinaryFunction>
+struct pipeline_reduce_op
+{
+    BinaryFunction reduce_op;
+
+    template<class T>
+    ROCPRIM_HOST_DEVICE inline pipeline_item<T> operator()(const pipeline_item<T>& a,
+                                                           const pipeline_item<T>& b) const
+    {
+        if(!a.valid)
+        {
+            return b;
+        }
+        if(!b.valid)
+        {
+            return a;
+        }
+        return pipeline_item<T>{static_cast<T>(reduce_op(a.value, b.value)), true};
+    }
+};
+
+struct pipeline_item_valid
+{
+    template<class T>
+    ROCPRIM_HOST_DEVICE inline bool operator()(const pipeline_item<T>& item) const
+    {
+        return item.valid;
+    }
+};
+
+struct pipeline_item_value
+{
+    template<class T>
+    ROCPRIM_HOST_DEVICE inline T operator()(const pipeline_item<T>& item) const
+    {
+        return item.value;
+    }
+};
+
+} // end of detail namespace
+
+/// \brief A lazy chain of maps and filters over a range, run by a terminal operation.
+///
+/// A pipeline is built by \p rocprim::pipeline and extended by \p map and \p filter, which only
+/// compose the functions on the host. The whole chain runs when a terminal operation is called:
+/// \p reduce runs it inside the tiles of \p rocprim::reduce, and \p copy inside the tiles of
+/// \p rocprim::select, so the chain takes one pass over the input and stores no intermediate
+/// ranges.
+///
+/// \par Overview
+/// * Filters flag the dropped items instead of compacting the range. The stages after a filter
+/// see only the items kept by it, and are fused into the same pass. Only \p copy compacts the
+/// items, with the ordered lookback scan of \p rocprim::select.
+/// * The functions are called once per item and stage. The result types of the map functions
+/// must be default constructible.
+///
+/// \tparam InputIterator - random-access iterator type of the input range.
+/// \tparam Stage - type of the composed functions of the pipeline.
+template<class InputIterator, class Stage>
+class pipeline_expression
+{
+    template<class T>
+    using item_type = decltype(std::declval<Stage>()(std::declval<T>()));
+    using input_type      = typename std::iterator_traits<InputIterator>::value_type;
+    using stage_item_type = item_type<input_type>;
+    using stage_iterator = ::rocprim::transform_iterator<InputIterator, Stage, stage_item_type>;
+
+public:
+    /// The type of the values at the end of the pipeline.
+    using value_type = decltype(std::declval<stage_item_type>().value);
+
+    /// \brief Creates a pipeline, see \p rocprim::pipeline.
+    ///
+    /// \param input - iterator to the first element of the input range.
+    /// \param size - number of elements in the input range.
+    /// \param stage - the composed functions of the pipeline.
+    ROCPRIM_HOST inline pipeline_expression(InputIterator input, size_t size, Stage stage)
+        : input_(input), size_(size), stage_(stage)
+    {}
+
+    /// \brief Appends a stage that replaces every item with the result of \p function.
+    ///
+    /// \param function - unary function applied to the items kept by the previous stages.
+    template<class UnaryFunction>
+    ROCPRIM_HOST inline pipeline_expression<InputIterator,
+                                            detail::pipeline_map_stage<Stage, UnaryFunction>>
+        map(UnaryFunction function) const
+    {
+        using next_stage = detail::pipeline_map_stage<Stage, UnaryFunction>;
+        return pipeline_expression<InputIterator, next_stage>(input_,
+                                                              size_,
+                                                              next_stage{stage_, function});
+    }
+
+    /// \brief Appends a stage that drops the items for which \p predicate returns \p false.
+    ///
+    /// \param predicate - unary predicate applied to the items kept by the previous stages.
+    template<class UnaryPredicate>
+    ROCPRIM_HOST inline pipeline_expression<InputIterator,
+                                            detail::pipeline_filter_stage<Stage, UnaryPredicate>>
+        filter(UnaryPredicate predicate) const
+    {
+        using next_stage = detail::pipeline_filter_stage<Stage, UnaryPredicate>;
+        return pipeline_expression<InputIterator, next_stage>(input_,
+                                                              size_,
+                                                              next_stage{stage_, predicate});
+    }
+
+    /// \brief Runs the pipeline and reduces the kept items and \p initial_value.
+    ///
+    /// \tparam OutputIterator - random-access iterator type of the output.
+    /// \tparam BinaryFunction - type of the reduction operator.
+    ///
+    /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+    /// a null pointer is passed, the required allocation size (in bytes) is written to
+    /// \p storage_size and function returns without running the pipeline.
+    /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+    /// \param [out] output - iterator to the result of the reduction.
+    /// \param [in] initial_value - initial value of the reduction.
+    /// \param [in] reduce_op - associative binary function used for the reduction.
+    /// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+    /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+    /// launch is forced in order to check for errors. The default value is \p false.
+    ///
+    /// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    template<class OutputIterator, class BinaryFunction = ::rocprim::plus<value_type>>
+    ROCPRIM_HOST inline hipError_t reduce(void*             temporary_storage,
+                                          size_t&           storage_size,
+                                          OutputIterator    output,
+                                          const value_type  initial_value,
+                                          BinaryFunction    reduce_op         = BinaryFunction(),
+                                          const hipStream_t stream            = 0,
+                                          bool              debug_synchronous = false) const
+    {
+        using reduce_op_type = detail::pipeline_reduce_op<BinaryFunction>;
+
+        return ::rocprim::reduce<default_config,
+                                 stage_iterator,
+                                 decltype(make_value_output(output)),
+                                 stage_item_type,
+                                 reduce_op_type,
+                                 stage_item_type>(temporary_storage,
+                                                  storage_size,
+                                                  stage_iterator(input_, stage_),
+                                                  make_value_output(output),
+                                                  stage_item_type{initial_value, true},
+                                                  size_,
+                                                  reduce_op_type{reduce_op},
+                                                  stream,
+                                                  debug_synchronous);
+    }
+
+    /// \brief Runs the pipeline and stores the kept items in their order.
+    ///
+    /// \tparam OutputIterator - random-access iterator type of the output range.
+    /// \tparam SelectedCountOutputIterator - random-access iterator type of the number of kept
+    /// items.
+    ///
+    /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+    /// a null pointer is passed, the required allocation size (in bytes) is written to
+    /// \p storage_size and function returns without running the pipeline.
+    /// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+    /// \param [out] output - iterator to the first kept item. The range must have room for all
+    /// items of the input.
+    /// \param [out] selected_count_output - iterator to the number of kept items.
+    /// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+    /// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+    /// launch is forced in order to check for errors. The default value is \p false.
+    ///
+    /// \returns \p hipSuccess (\p 0) after successful copy; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    template<class OutputIterator, class SelectedCountOutputIterator>
+    ROCPRIM_HOST inline hipError_t copy(void*                       temporary_storage,
+                                        size_t&                     storage_size,
+                                        OutputIterator              output,
+                                        SelectedCountOutputIterator selected_count_output,
+                                        const hipStream_t           stream            = 0,
+                                        bool                        debug_synchronous = false) const
+    {
+        return ::rocprim::select(temporary_storage,
+                                 storage_size,
+                                 stage_iterator(input_, stage_),
+                                 make_value_output(output),
+                                 selected_count_output,
+                                 size_,
+                                 detail::pipeline_item_valid{},
+                                 stream,
+                                 debug_synchronous);
+    }
+
+private:
+    template<class OutputIterator>
+    static ROCPRIM_HOST inline ::rocprim::transform_output_iterator<OutputIterator,
+                                                                    detail::pipeline_item_value>
+        make_value_output(OutputIterator output)
+    {
+        return ::rocprim::make_transform_output_iterator(output, detail::pipeline_item_value{});
+    }
+
+    InputIterator input_;
+    size_t        size_;
+    Stage         stage_;
+};
+
+/// \brief Starts a lazy pipeline of maps and filters over the range \p input.
+///
+/// \par Example
+/// \parblock
+/// In this example the squares of the even values are summed in one pass.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;    // e.g., 6
+/// int * input;          // e.g., [1, 2, 3, 4, 5, 6]
+/// int * output;         // empty array of 1 element
+///
+/// auto squares_of_even = rocprim::pipeline(input, input_size)
+///                            .filter([] __device__ (int x) { return x % 2 == 0; })
+///                            .map([] __device__ (int x) { return x * x; });
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// squares_of_even.reduce(temporary_storage_ptr, temporary_storage_size_bytes, output, 0);
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // run the pipeline
+/// squares_of_even.reduce(temporary_storage_ptr, temporary_storage_size_bytes, output, 0);
+/// // output: [56]
+/// \endcode
+/// \endparblock
+///
+/// \param input - iterator to the first element of the input range.
+/// \param size - number of elements in the input range.
+/// \return A pipeline that passes the input through unchanged.
+template<class InputIterator>
+ROCPRIM_HOST inline pipeline_expression<InputIterator, detail::pipeline_identity_stage>
+    pipeline(InputIterator input, size_t size)
+{
+    return pipeline_expression<InputIterator, detail::pipeline_identity_stage>(
+        input,
+        size,
+        detail::pipeline_identity_stage{});
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_PIPELINE_HPP_
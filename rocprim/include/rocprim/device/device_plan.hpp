@@ -0,0 +1,258 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_PLAN_HPP_
+#define ROCPRIM_DEVICE_DEVICE_PLAN_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "device_graph.hpp"
+
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief A device algorithm prepared once and executed many times with its temporary storage.
+///
+/// A plan wraps a device algorithm called as
+/// <tt>function(void* temporary_storage, size_t& storage_size, hipStream_t stream, args...)</tt>,
+/// following the two-phase temporary storage protocol of the device algorithms. \p prepare sizes
+/// the temporary storage once for the largest shape the plan will execute (the largest input
+/// size, number of segments, etc.), and allocates it or binds storage provided by the caller.
+/// \p execute then only calls the algorithm with the bound storage, without a size query or
+/// an allocation.
+///
+/// \par Overview
+/// * \p execute can be called with other arguments than \p prepare, e.g. other pointers or a
+/// smaller size. If the bound storage is too small for them, the algorithm returns
+/// \p hipErrorInvalidValue without launching anything.
+/// * State that must be valid at the start of every run, e.g. the look-back scan states, is
+/// still initialized by the algorithm in every \p execute.
+/// * Storage allocated by \p prepare is owned by the plan and freed by its destructor, which must
+/// run before the HIP runtime is torn down and after the work of the last \p execute.
+/// * \p add_node captures one execution in a hipGraph node.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto plan = rocprim::make_device_plan(
+///     [](void* temporary_storage, size_t& storage_size, hipStream_t stream,
+///        int* keys_input, int* keys_output, float* values_input, float* values_output,
+///        size_t size)
+///     {
+///         return rocprim::radix_sort_pairs(temporary_storage, storage_size,
+///                                          keys_input, keys_output,
+///                                          values_input, values_output,
+///                                          size, 0, 8 * sizeof(int), stream);
+///     });
+///
+/// // Size and allocate the temporary storage once, for the largest input.
+/// plan.prepare(stream, keys_input, keys_output, values_input, values_output, max_size);
+/// for(size_t size : sizes)
+/// {
+///     plan.execute(stream, keys_input, keys_output, values_input, values_output, size);
+/// }
+/// \endcode
+/// \endparblock
+///
+/// \tparam Function - type of the callable performing the algorithm.
+template<class Function>
+class device_plan
+{
+public:
+    /// \brief Creates a plan of \p function, without temporary storage.
+    explicit device_plan(Function function) : function_(std::move(function)) {}
+
+    device_plan(const device_plan&)            = delete;
+    device_plan& operator=(const device_plan&) = delete;
+
+    /// \brief Moves the plan and the ownership of its storage.
+    device_plan(device_plan&& other) noexcept
+        : function_(std::move(other.function_))
+        , storage_(other.storage_)
+        , storage_size_(other.storage_size_)
+        , owns_storage_(other.owns_storage_)
+    {
+        other.storage_      = nullptr;
+        other.storage_size_ = 0;
+        other.owns_storage_ = false;
+    }
+
+    /// \brief Frees the storage allocated by \p prepare.
+    ~device_plan()
+    {
+        (void)reset();
+    }
+
+    /// \brief Sizes the temporary storage for \p args and allocates it with \p hipMalloc.
+    ///
+    /// Storage bound by a previous call is released first.
+    ///
+    /// \param [in] stream the stream passed to the size query of the algorithm.
+    /// \param [in] args the arguments of the largest execution of the plan.
+    /// \returns \p hipSuccess (\p 0) after successful preparation; otherwise a HIP runtime error
+    /// of type \p hipError_t.
+    template<class... Args>
+    hipError_t prepare(const hipStream_t stream, Args&&... args)
+    {
+        ROCPRIM_RETURN_ON_ERROR(reset());
+
+        size_t storage_size = 0;
+        ROCPRIM_RETURN_ON_ERROR(
+            function_(nullptr, storage_size, stream, std::forward<Args>(args)...));
+
+        // A zero-sized request still gets storage, so that the algorithm never sees a null pointer
+        // as a request of the storage size.
+        ROCPRIM_RETURN_ON_ERROR(hipMalloc(&storage_, storage_size == 0 ? 1 : storage_size));
+        storage_size_ = storage_size;
+        owns_storage_ = true;
+        return hipSuccess;
+    }
+
+    /// \brief Binds storage provided by the caller to the plan, after checking that it is large
+    /// enough for \p args.
+    ///
+    /// The storage is not freed by the plan.
+    ///
+    /// \param [in] storage the storage, it must be kept for as long as the plan is executed.
+    /// \param [in] storage_size the size of \p storage in bytes.
+    /// \param [in] stream the stream passed to the size query of the algorithm.
+    /// \param [in] args the arguments of the largest execution of the plan.
+    /// \returns \p hipSuccess (\p 0) after successful preparation, \p hipErrorInvalidValue if
+    /// \p storage is too small; otherwise a HIP runtime error of type \p hipError_t.
+    template<class... Args>
+    hipError_t prepare_with_storage(void* const       storage,
+                                    const size_t      storage_size,
+                                    const hipStream_t stream,
+                                    Args&&... args)
+    {
+        ROCPRIM_RETURN_ON_ERROR(reset());
+
+        size_t required_size = 0;
+        ROCPRIM_RETURN_ON_ERROR(
+            function_(nullptr, required_size, stream, std::forward<Args>(args)...));
+        if(storage == nullptr || storage_size < required_size)
+        {
+            return hipErrorInvalidValue;
+        }
+
+        storage_      = storage;
+        storage_size_ = storage_size;
+        return hipSuccess;
+    }
+
+    /// \brief Executes the algorithm with the bound storage.
+    ///
+    /// \param [in] stream the stream on which the algorithm is executed.
+    /// \param [in] args the arguments of the algorithm.
+    /// \returns the result of the algorithm, or \p hipErrorInvalidValue if the plan is not
+    /// prepared.
+    template<class... Args>
+    hipError_t execute(const hipStream_t stream, Args&&... args)
+    {
+        if(storage_ == nullptr)
+        {
+            return hipErrorInvalidValue;
+        }
+        size_t storage_size = storage_size_;
+        return function_(storage_, storage_size, stream, std::forward<Args>(args)...);
+    }
+
+    /// \brief Adds an execution of the plan to a graph as a child graph node, see
+    /// \p add_algorithm_node.
+    ///
+    /// \param [out] node the created node.
+    /// \param [in] graph the graph the node is added to.
+    /// \param [in] dependencies the nodes the new node depends on.
+    /// \param [in] num_dependencies the number of nodes in \p dependencies.
+    /// \param [in] args the arguments of the algorithm, which must be graph-safe.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    template<class... Args>
+    hipError_t add_node(hipGraphNode_t*       node,
+                        hipGraph_t            graph,
+                        const hipGraphNode_t* dependencies,
+                        const size_t          num_dependencies,
+                        Args&&... args)
+    {
+        return add_algorithm_node(node,
+                                  graph,
+                                  dependencies,
+                                  num_dependencies,
+                                  [&](const hipStream_t stream)
+                                  { return execute(stream, std::forward<Args>(args)...); });
+    }
+
+    /// \brief Releases the bound storage, freeing it if it was allocated by \p prepare.
+    /// \returns \p hipSuccess (\p 0) after successful release; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    hipError_t reset()
+    {
+        hipError_t result = hipSuccess;
+        if(owns_storage_)
+        {
+            result = hipFree(storage_);
+        }
+        storage_      = nullptr;
+        storage_size_ = 0;
+        owns_storage_ = false;
+        return result;
+    }
+
+    /// \brief Returns the bound storage, or \p nullptr if the plan is not prepared.
+    void* storage() const
+    {
+        return storage_;
+    }
+
+    /// \brief Returns the size of the bound storage in bytes.
+    size_t storage_size() const
+    {
+        return storage_size_;
+    }
+
+private:
+    Function function_;
+    void*    storage_      = nullptr;
+    size_t   storage_size_ = 0;
+    bool     owns_storage_ = false;
+};
+
+/// \brief Creates a \p device_plan of \p function, see \p device_plan.
+template<class Function>
+inline device_plan<typename std::decay<Function>::type> make_device_plan(Function&& function)
+{
+    return device_plan<typename std::decay<Function>::type>(std::forward<Function>(function));
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_PLAN_HPP_
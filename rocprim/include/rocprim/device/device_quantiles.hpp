@@ -0,0 +1,480 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_QUANTILES_HPP_
+#define ROCPRIM_DEVICE_DEVICE_QUANTILES_HPP_
+
+#include "detail/device_quantiles.hpp"
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../thread/radix_key_codec.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "device_radix_sort.hpp"
+#include "device_scan.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class KeysInputIterator, class RanksIterator, class OutputIterator>
+inline hipError_t radix_select_impl(void*              temporary_storage,
+                                    size_t&            storage_size,
+                                    KeysInputIterator  keys_input,
+                                    const size_t       size,
+                                    RanksIterator      ranks,
+                                    const unsigned int num_ranks,
+                                    OutputIterator     output,
+                                    const hipStream_t  stream,
+                                    const bool         debug_synchronous)
+{
+    using key_type     = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using bit_key_type = typename radix_key_codec<key_type>::bit_key_type;
+
+    constexpr unsigned int passes = 8 * sizeof(bit_key_type) / radix_select_radix_bits;
+
+    bit_key_type* prefixes        = nullptr;
+    size_t*       remaining_ranks = nullptr;
+    size_t*       histograms      = nullptr;
+
+    const size_t pass_counters = static_cast<size_t>(num_ranks) * radix_select_radix_size;
+
+    const hipError_t partition_result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::ptr_aligned_array(&prefixes, 2 * static_cast<size_t>(num_ranks)),
+            temp_storage::ptr_aligned_array(&remaining_ranks, num_ranks),
+            temp_storage::ptr_aligned_array(&histograms, passes * pass_counters)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0 || num_ranks == 0)
+    {
+        return hipSuccess;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "size: " << size << '\n';
+        std::cout << "num_ranks: " << num_ranks << '\n';
+        std::cout << "passes: " << passes << '\n';
+    }
+
+    // The first pass counts all keys with the empty prefix of the first rank.
+    ROCPRIM_RETURN_ON_ERROR(
+        hipMemsetAsync(prefixes, 0, sizeof(*prefixes) * num_ranks, stream));
+    ROCPRIM_RETURN_ON_ERROR(
+        hipMemsetAsync(histograms, 0, sizeof(*histograms) * passes * pass_counters, stream));
+
+    const bool         shared_counters = num_ranks <= radix_select_max_shared_ranks;
+    const unsigned int num_blocks      = ceiling_div(size, quantiles_items_per_block);
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    for(unsigned int pass = 0; pass < passes; ++pass)
+    {
+        bit_key_type* prefixes_input  = prefixes + (pass % 2) * num_ranks;
+        bit_key_type* prefixes_output = prefixes + ((pass + 1) % 2) * num_ranks;
+        size_t*       pass_histograms = histograms + pass * pass_counters;
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        if(shared_counters)
+        {
+            radix_select_histogram_kernel<true>
+                <<<num_blocks, quantiles_block_size, 0, stream>>>(keys_input,
+                                                                  size,
+                                                                  prefixes_input,
+                                                                  num_ranks,
+                                                                  pass,
+                                                                  pass_histograms);
+        }
+        else
+        {
+            radix_select_histogram_kernel<false>
+                <<<num_blocks, quantiles_block_size, 0, stream>>>(keys_input,
+                                                                  size,
+                                                                  prefixes_input,
+                                                                  num_ranks,
+                                                                  pass,
+                                                                  pass_histograms);
+        }
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_select_histogram_kernel", size, start);
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        radix_select_digits_kernel<<<1, quantiles_block_size, 0, stream>>>(ranks,
+                                                                           num_ranks,
+                                                                           prefixes_input,
+                                                                           prefixes_output,
+                                                                           remaining_ranks,
+                                                                           pass_histograms,
+                                                                           pass,
+                                                                           pass + 1 == passes,
+                                                                           output);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_select_digits_kernel",
+                                                    num_ranks,
+                                                    start);
+    }
+
+    return hipSuccess;
+}
+
+template<class KeysInputIterator, class QuantilesIterator, class OutputIterator>
+inline hipError_t approximate_quantiles_impl(void*              temporary_storage,
+                                             size_t&            storage_size,
+                                             KeysInputIterator  keys_input,
+                                             const size_t       size,
+                                             QuantilesIterator  quantiles,
+                                             const unsigned int num_quantiles,
+                                             OutputIterator     output,
+                                             const unsigned int compaction,
+                                             const hipStream_t  stream,
+                                             const bool         debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    if(compaction == 0 || compaction > quantiles_items_per_block || !is_power_of_two(compaction))
+    {
+        return hipErrorInvalidValue;
+    }
+
+    const size_t full_blocks = size / quantiles_items_per_block;
+    const size_t num_samples
+        = full_blocks * (quantiles_items_per_block / compaction) + size % quantiles_items_per_block;
+
+    key_type*     samples            = nullptr;
+    key_type*     sorted_samples     = nullptr;
+    unsigned int* weights            = nullptr;
+    unsigned int* sorted_weights     = nullptr;
+    size_t*       cumulative_weights = nullptr;
+    void*         nested_storage     = nullptr;
+
+    bool   ignored;
+    size_t sort_storage_size = 0;
+    size_t scan_storage_size = 0;
+    ROCPRIM_RETURN_ON_ERROR(radix_sort_impl<default_config, false>(nullptr,
+                                                                   sort_storage_size,
+                                                                   samples,
+                                                                   nullptr,
+                                                                   sorted_samples,
+                                                                   weights,
+                                                                   nullptr,
+                                                                   sorted_weights,
+                                                                   num_samples,
+                                                                   ignored,
+                                                                   identity_decomposer{},
+                                                                   0,
+                                                                   8 * sizeof(key_type),
+                                                                   stream,
+                                                                   false));
+    ROCPRIM_RETURN_ON_ERROR((inclusive_scan<default_config,
+                                            unsigned int*,
+                                            size_t*,
+                                            ::rocprim::plus<size_t>,
+                                            size_t>(nullptr,
+                                                    scan_storage_size,
+                                                    sorted_weights,
+                                                    cumulative_weights,
+                                                    num_samples,
+                                                    ::rocprim::plus<size_t>(),
+                                                    stream,
+                                                    false)));
+
+    const hipError_t partition_result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::make_partition(&nested_storage,
+                                         std::max(sort_storage_size, scan_storage_size)),
+            temp_storage::ptr_aligned_array(&samples, num_samples),
+            temp_storage::ptr_aligned_array(&sorted_samples, num_samples),
+            temp_storage::ptr_aligned_array(&weights, num_samples),
+            temp_storage::ptr_aligned_array(&sorted_weights, num_samples),
+            temp_storage::ptr_aligned_array(&cumulative_weights, num_samples)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0 || num_quantiles == 0)
+    {
+        return hipSuccess;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "size: " << size << '\n';
+        std::cout << "compaction: " << compaction << '\n';
+        std::cout << "num_samples: " << num_samples << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    quantiles_compact_kernel<<<ceiling_div(size, quantiles_items_per_block),
+                               quantiles_block_size,
+                               0,
+                               stream>>>(keys_input, size, compaction, samples, weights);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("quantiles_compact_kernel", size, start);
+
+    // The sketches of all blocks are merged by sorting their samples.
+    ROCPRIM_RETURN_ON_ERROR(radix_sort_impl<default_config, false>(nested_storage,
+                                                                   sort_storage_size,
+                                                                   samples,
+                                                                   nullptr,
+                                                                   sorted_samples,
+                                                                   weights,
+                                                                   nullptr,
+                                                                   sorted_weights,
+                                                                   num_samples,
+                                                                   ignored,
+                                                                   identity_decomposer{},
+                                                                   0,
+                                                                   8 * sizeof(key_type),
+                                                                   stream,
+                                                                   debug_synchronous));
+    ROCPRIM_RETURN_ON_ERROR((inclusive_scan<default_config,
+                                            unsigned int*,
+                                            size_t*,
+                                            ::rocprim::plus<size_t>,
+                                            size_t>(nested_storage,
+                                                    scan_storage_size,
+                                                    sorted_weights,
+                                                    cumulative_weights,
+                                                    num_samples,
+                                                    ::rocprim::plus<size_t>(),
+                                                    stream,
+                                                    debug_synchronous)));
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    quantiles_lookup_kernel<<<ceiling_div(num_quantiles, quantiles_block_size),
+                              quantiles_block_size,
+                              0,
+                              stream>>>(quantiles,
+                                        num_quantiles,
+                                        sorted_samples,
+                                        cumulative_weights,
+                                        num_samples,
+                                        size,
+                                        output);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("quantiles_lookup_kernel", num_quantiles, start);
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Finds the keys of several ranks of the input, as if it was sorted, without sorting it.
+///
+/// The keys of all ranks are found digit by digit, from the most significant 8 bits of their
+/// radix representation to the least significant ones. Every pass computes one digit histogram
+/// for every distinct prefix found so far, so all ranks share a single pass over the input. The
+/// number of passes is the number of bytes of the key.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * \p ranks must be ascending, and every rank must be less than \p size. The key of rank \p r
+///   is the key at index \p r of the input sorted by \p radix_sort_keys.
+/// * The keys are ordered by their radix representation like in \p radix_sort_keys, for example
+///   <tt>-0.0</tt> orders before <tt>+0.0</tt>.
+/// * Up to 16 ranks are counted in shared memory. The temporary storage holds
+///   <tt>256 * num_ranks</tt> counters for every pass.
+/// * Unlike \p nth_element, the input is not modified, and no keys are moved.
+///
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Its
+///   value type must be a type supported by \p radix_sort_keys. It can be a simple pointer type.
+/// \tparam RanksIterator [inferred] random-access iterator type of the ranks. It can be a simple
+///   pointer type.
+/// \tparam OutputIterator [inferred] random-access iterator type of the output range. Its value
+///   type must be the value type of \p KeysInputIterator. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [in] size number of elements in the input range.
+/// \param [in] ranks iterator to the ascending ranks to find.
+/// \param [in] num_ranks number of ranks.
+/// \param [out] output iterator to the keys of the ranks.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+///   type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the median and the 99th percentile of latencies are found.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t   input_size; // e.g., 1000
+/// float *  input;      // e.g., [ 0.12, 3.5, 0.7, ... ]
+/// size_t * ranks;      // e.g., [ 500, 990 ]
+/// float *  output;     // empty array of 2 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::radix_select(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, input_size, ranks, 2, output
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // find the keys
+/// rocprim::radix_select(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, input_size, ranks, 2, output
+/// );
+/// \endcode
+/// \endparblock
+template<class KeysInputIterator, class RanksIterator, class OutputIterator>
+inline hipError_t radix_select(void*              temporary_storage,
+                               size_t&            storage_size,
+                               KeysInputIterator  keys_input,
+                               const size_t       size,
+                               RanksIterator      ranks,
+                               const unsigned int num_ranks,
+                               OutputIterator     output,
+                               const hipStream_t  stream            = 0,
+                               const bool         debug_synchronous = false)
+{
+    return detail::radix_select_impl(temporary_storage,
+                                     storage_size,
+                                     keys_input,
+                                     size,
+                                     ranks,
+                                     num_ranks,
+                                     output,
+                                     stream,
+                                     debug_synchronous);
+}
+
+/// \brief Estimates quantiles of the input from a mergeable sketch, without sorting the input.
+///
+/// Every block sorts its keys and keeps every \p compaction-th of them, starting at a
+/// pseudo-random offset, as samples of weight \p compaction. This is the compaction step of a
+/// KLL sketch: the rank error of a block is less than \p compaction, and the random offsets make
+/// the errors of the blocks cancel out instead of adding up. The sketches of all blocks are
+/// merged by sorting the samples, and the quantiles are looked up in the cumulative weights.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The key of quantile \p q estimates the key of rank <tt>round(q * (size - 1))</tt> of the
+///   sorted input. Quantiles are clamped to <tt>[0, 1]</tt>.
+/// * \p compaction must be a power of two of at most 2048, otherwise \p hipErrorInvalidValue is
+///   returned. A \p compaction of 1 keeps all keys and the quantiles are exact. The sort that
+///   merges the sketches handles about <tt>size / compaction</tt> samples.
+/// * The estimates are deterministic: the offsets only depend on the index of the block.
+/// * Use \p radix_select for exact keys of several ranks.
+///
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Its
+///   value type must be a type supported by \p radix_sort_keys. It can be a simple pointer type.
+/// \tparam QuantilesIterator [inferred] random-access iterator type of the quantiles. Its value
+///   type must be convertible to \p double. It can be a simple pointer type.
+/// \tparam OutputIterator [inferred] random-access iterator type of the output range. It can be
+///   a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the estimation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [in] size number of elements in the input range.
+/// \param [in] quantiles iterator to the quantiles to estimate, between 0 and 1.
+/// \param [in] num_quantiles number of quantiles.
+/// \param [out] output iterator to the estimated keys of the quantiles.
+/// \param [in] compaction [optional] the weight of every sample. Default value is \p 64.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful estimation; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class KeysInputIterator, class QuantilesIterator, class OutputIterator>
+inline hipError_t approximate_quantiles(void*              temporary_storage,
+                                        size_t&            storage_size,
+                                        KeysInputIterator  keys_input,
+                                        const size_t       size,
+                                        QuantilesIterator  quantiles,
+                                        const unsigned int num_quantiles,
+                                        OutputIterator     output,
+                                        const unsigned int compaction        = 64,
+                                        const hipStream_t  stream            = 0,
+                                        const bool         debug_synchronous = false)
+{
+    return detail::approximate_quantiles_impl(temporary_storage,
+                                              storage_size,
+                                              keys_input,
+                                              size,
+                                              quantiles,
+                                              num_quantiles,
+                                              output,
+                                              compaction,
+                                              stream,
+                                              debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_QUANTILES_HPP_
@@ -23,6 +23,7 @@
 
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <type_traits>
 #include <utility>
 
@@ -36,10 +37,20 @@
 #include "../types.hpp"
 
 #include "../type_traits.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/permutation_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../iterator/zip_iterator.hpp"
 #include "detail/config/device_radix_sort_onesweep.hpp"
+#include "detail/config/lookback_backoff.hpp"
+#include "detail/device_future_size.hpp"
+#include "detail/device_prebuilt.hpp"
 #include "detail/device_radix_sort.hpp"
 #include "device_transform.hpp"
+#include "execution_budget.hpp"
+#include "tuning_database.hpp"
 #include "specialization/device_radix_block_sort.hpp"
+#include "specialization/device_radix_counting_sort.hpp"
 #include "specialization/device_radix_merge_sort.hpp"
 
 /// \addtogroup devicemodule
@@ -74,6 +85,13 @@ struct decomposer_max_bits
                               0>()>
 {};
 
+// The indices sorted in place of large values never alias the output of the sort
+template<class Incrementable, class Difference, class Value>
+inline bool can_iterators_alias(counting_iterator<Incrementable, Difference>, Value*, const size_t)
+{
+    return false;
+}
+
 template<class Size>
 using offset_type_t = std::conditional_t<
     sizeof(Size) <= 4,
@@ -87,10 +105,9 @@ ROCPRIM_KERNEL
         KeysInputIterator  keys_input,
         Offset*            global_digit_counts,
         const Offset       size,
-        const Offset       full_blocks,
-        Decomposer         decomposer,
-        const unsigned int begin_bit,
-        const unsigned int end_bit)
+        const Offset                full_blocks,
+        Decomposer                  decomposer,
+        const onesweep_digit_places digit_places)
 {
     static constexpr radix_sort_onesweep_config_params params = device_params<Config>();
     onesweep_histograms<params.histogram.block_size,
@@ -101,18 +118,39 @@ ROCPRIM_KERNEL
                                     size,
                                     full_blocks,
                                     decomposer,
-                                    begin_bit,
-                                    end_bit);
+                                    digit_places);
 }
 
 template<class Config, class Offset>
-ROCPRIM_KERNEL __launch_bounds__(
-    device_params<Config>()
-        .histogram.block_size) void onesweep_scan_histograms_kernel(Offset* global_digit_offsets)
+ROCPRIM_KERNEL
+__launch_bounds__(device_params<Config>().histogram.block_size)
+void onesweep_scan_histograms_kernel(Offset*       global_digit_offsets,
+                                     const Offset  size,
+                                     unsigned int* trivial_digits)
 {
     static constexpr radix_sort_onesweep_config_params params = device_params<Config>();
     onesweep_scan_histograms<params.histogram.block_size, params.radix_bits_per_place>(
-        global_digit_offsets);
+        global_digit_offsets,
+        size,
+        trivial_digits);
+}
+
+template<class Config, class Offset>
+ROCPRIM_KERNEL
+__launch_bounds__(device_params<Config>().histogram.block_size)
+void onesweep_plan_passes_kernel(Offset*                     global_digit_offsets,
+                                 const Offset                size,
+                                 unsigned int*               trivial_digits,
+                                 onesweep_pass*              passes,
+                                 const onesweep_digit_places digit_places)
+{
+    static constexpr radix_sort_onesweep_config_params params = device_params<Config>();
+    onesweep_plan_passes<params.histogram.block_size, params.radix_bits_per_place>(
+        global_digit_offsets,
+        size,
+        trivial_digits,
+        passes,
+        digit_places);
 }
 
 template<class Config,
@@ -121,16 +159,20 @@ template<class Config,
          class ValuesInputIterator,
          class Offset,
          class Decomposer>
-hipError_t radix_sort_onesweep_global_offsets(KeysInputIterator keys_input,
+hipError_t radix_sort_onesweep_global_offsets(KeysInputIterator        keys_input,
                                               ValuesInputIterator,
-                                              Offset*            global_digit_offsets,
-                                              const Offset       size,
-                                              const unsigned int digit_places,
-                                              Decomposer         decomposer,
-                                              const unsigned     begin_bit,
-                                              const unsigned     end_bit,
-                                              const hipStream_t  stream,
-                                              const bool         debug_synchronous)
+                                              Offset*                  global_digit_offsets,
+                                              unsigned int*            trivial_digits,
+                                              onesweep_pass*           passes,
+                                              type_identity_t<Offset>* digit_counts,
+                                              const bool               digit_counts_valid,
+                                              const Offset             size,
+                                              const unsigned int       digit_places,
+                                              Decomposer               decomposer,
+                                              const unsigned           begin_bit,
+                                              const unsigned           end_bit,
+                                              const hipStream_t        stream,
+                                              const bool               debug_synchronous)
 {
     using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
@@ -150,38 +192,73 @@ hipError_t radix_sort_onesweep_global_offsets(KeysInputIterator keys_input,
     const Offset blocks      = ::rocprim::detail::ceiling_div<Offset>(size, items_per_block);
     const Offset full_blocks = size % items_per_block == 0 ? blocks : blocks - 1;
 
+    const onesweep_digit_places digit_places
+        = make_onesweep_digit_places(begin_bit,
+                                     end_bit,
+                                     params.radix_bits_per_place,
+                                     params.short_radix_bits);
+
     const unsigned int radix_size_per_place = 1u << params.radix_bits_per_place;
-    const unsigned int places = ceiling_div(end_bit - begin_bit, params.radix_bits_per_place);
-    const unsigned int bins   = radix_size_per_place * places;
+    const unsigned int places               = digit_places.count;
+    const unsigned int bins                 = radix_size_per_place * places;
 
-    // Reset the histogram
-    hipError_t error = hipMemsetAsync(global_digit_offsets, 0, sizeof(Offset) * bins, stream);
-    if(error != hipSuccess)
-        return error;
+    // No digit place is trivial until the histograms are scanned
+    if(trivial_digits != nullptr)
+    {
+        ROCPRIM_RETURN_ON_ERROR(
+            hipMemsetAsync(trivial_digits, 0xFF, sizeof(unsigned int) * places, stream));
+    }
 
     std::chrono::steady_clock::time_point start;
 
-    if(debug_synchronous)
+    if(digit_counts != nullptr && digit_counts_valid)
     {
-        std::cout << "blocks " << blocks << '\n';
-        std::cout << "full_blocks " << full_blocks << '\n';
-        start = std::chrono::steady_clock::now();
+        // The histograms are known, the keys are not read
+        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(global_digit_offsets,
+                                               digit_counts,
+                                               sizeof(Offset) * bins,
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
     }
+    else
+    {
+        // Reset the histogram
+        ROCPRIM_RETURN_ON_ERROR(
+            hipMemsetAsync(global_digit_offsets, 0, sizeof(Offset) * bins, stream));
 
-    // Compute a histogram for each digit.
-    hipLaunchKernelGGL(HIP_KERNEL_NAME(onesweep_histograms_kernel<config, Descending>),
-                       dim3(blocks),
-                       dim3(params.histogram.block_size),
-                       0,
-                       stream,
-                       keys_input,
-                       global_digit_offsets,
-                       size,
-                       full_blocks,
-                       decomposer,
-                       begin_bit,
-                       end_bit);
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("compute_global_digit_histograms", size, start);
+        if(debug_synchronous)
+        {
+            std::cout << "blocks " << blocks << '\n';
+            std::cout << "full_blocks " << full_blocks << '\n';
+            start = std::chrono::steady_clock::now();
+        }
+
+        // Compute a histogram for each digit.
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(onesweep_histograms_kernel<config, Descending>),
+                           dim3(blocks),
+                           dim3(params.histogram.block_size),
+                           0,
+                           stream,
+                           keys_input,
+                           global_digit_offsets,
+                           size,
+                           full_blocks,
+                           decomposer,
+                           digit_places);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("compute_global_digit_histograms",
+                                                    size,
+                                                    start);
+
+        // Return the histograms before they are scanned in place
+        if(digit_counts != nullptr)
+        {
+            ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(digit_counts,
+                                                   global_digit_offsets,
+                                                   sizeof(Offset) * bins,
+                                                   hipMemcpyDeviceToDevice,
+                                                   stream));
+        }
+    }
 
     // Scan each histogram separately to get the final offsets.
     if(debug_synchronous)
@@ -194,14 +271,40 @@ hipError_t radix_sort_onesweep_global_offsets(KeysInputIterator keys_input,
                        dim3(params.histogram.block_size),
                        0,
                        stream,
-                       global_digit_offsets);
+                       global_digit_offsets,
+                       size,
+                       trivial_digits);
 
     ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("scan_global_digit_histograms", bins, start);
+
+    // With a single place there is no pass to skip
+    if(passes != nullptr && places > 1)
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(onesweep_plan_passes_kernel<config>),
+                           dim3(1),
+                           dim3(params.histogram.block_size),
+                           0,
+                           stream,
+                           global_digit_offsets,
+                           size,
+                           trivial_digits,
+                           passes,
+                           digit_places);
+
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("plan_onesweep_passes", bins, start);
+    }
     return hipSuccess;
 }
 
+// The short passes sort at most short_radix_bits bits with a kernel compiled for them
 template<class Config,
          bool Descending,
+         bool ShortPass,
          class KeysInputIterator,
          class KeysOutputIterator,
          class ValuesInputIterator,
@@ -210,23 +313,31 @@ template<class Config,
          class Decomposer>
 ROCPRIM_KERNEL
     __launch_bounds__(device_params<Config>().sort.block_size) void onesweep_iteration_kernel(
-        KeysInputIterator        keys_input,
-        KeysOutputIterator       keys_output,
-        ValuesInputIterator      values_input,
-        ValuesOutputIterator     values_output,
-        const unsigned int       size,
-        Offset*                  global_digit_offsets_in,
-        Offset*                  global_digit_offsets_out,
-        onesweep_lookback_state* lookback_states,
-        Decomposer               decomposer,
-        const unsigned int       bit,
-        const unsigned int       current_radix_bits,
-        const unsigned int       full_blocks)
+        KeysInputIterator             keys_input,
+        KeysOutputIterator            keys_output,
+        ValuesInputIterator           values_input,
+        ValuesOutputIterator          values_output,
+        const unsigned int            size,
+        Offset*                       global_digit_offsets_in,
+        Offset*                       global_digit_offsets_out,
+        onesweep_lookback_states      lookback_states,
+        const unsigned int            lookback_epoch,
+        const lookback_telemetry      telemetry,
+        const lookback_backoff_params backoff,
+        const unsigned int*           trivial_digit,
+        const onesweep_pass*          pass,
+        Decomposer                    decomposer,
+        const unsigned int            bit,
+        const unsigned int            current_radix_bits,
+        const unsigned int            full_blocks)
 {
     static constexpr radix_sort_onesweep_config_params params = device_params<Config>();
+    static constexpr unsigned int                      radix_bits
+        = ShortPass && params.short_radix_bits != 0 ? params.short_radix_bits
+                                                    : params.radix_bits_per_place;
     onesweep_iteration<params.sort.block_size,
                        params.sort.items_per_thread,
-                       params.radix_bits_per_place,
+                       radix_bits,
                        Descending,
                        params.radix_rank_algorithm>(keys_input,
                                                     keys_output,
@@ -236,12 +347,89 @@ ROCPRIM_KERNEL
                                                     global_digit_offsets_in,
                                                     global_digit_offsets_out,
                                                     lookback_states,
+                                                    lookback_epoch,
+                                                    telemetry,
+                                                    backoff,
+                                                    trivial_digit,
+                                                    pass,
                                                     decomposer,
                                                     bit,
                                                     current_radix_bits,
                                                     full_blocks);
 }
 
+// Whether the config has short passes for any architecture, otherwise their kernels are not
+// instantiated.
+template<class Config>
+constexpr bool has_onesweep_short_passes()
+{
+    return dispatched_params<Config, target_arch::unknown>().short_radix_bits != 0
+           || dispatched_params<Config, target_arch::gfx803>().short_radix_bits != 0
+           || dispatched_params<Config, target_arch::gfx900>().short_radix_bits != 0
+           || dispatched_params<Config, target_arch::gfx906>().short_radix_bits != 0
+           || dispatched_params<Config, target_arch::gfx908>().short_radix_bits != 0
+           || dispatched_params<Config, target_arch::gfx90a>().short_radix_bits != 0
+           || dispatched_params<Config, target_arch::gfx942>().short_radix_bits != 0
+           || dispatched_params<Config, target_arch::gfx1030>().short_radix_bits != 0
+           || dispatched_params<Config, target_arch::gfx1100>().short_radix_bits != 0
+           || dispatched_params<Config, target_arch::gfx1102>().short_radix_bits != 0;
+}
+
+template<class Config, bool Descending, class... Args>
+void launch_onesweep_iteration_kernel(std::false_type /*has_short_passes*/,
+                                      const bool /*short_pass*/,
+                                      const unsigned int blocks,
+                                      const unsigned int block_size,
+                                      const hipStream_t  stream,
+                                      Args... args)
+{
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(onesweep_iteration_kernel<Config, Descending, false>),
+                       dim3(blocks),
+                       dim3(block_size),
+                       0,
+                       stream,
+                       args...);
+}
+
+template<class Config, bool Descending, class... Args>
+void launch_onesweep_iteration_kernel(std::true_type /*has_short_passes*/,
+                                      const bool         short_pass,
+                                      const unsigned int blocks,
+                                      const unsigned int block_size,
+                                      const hipStream_t  stream,
+                                      Args... args)
+{
+    if(short_pass)
+    {
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(onesweep_iteration_kernel<Config, Descending, true>),
+                           dim3(blocks),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           args...);
+    }
+    else
+    {
+        launch_onesweep_iteration_kernel<Config, Descending>(std::false_type{},
+                                                             false,
+                                                             blocks,
+                                                             block_size,
+                                                             stream,
+                                                             args...);
+    }
+}
+
+// Returns the number of items sorted by one launch of the onesweep iteration kernel. The block
+// budget of the stream makes the batches smaller, so fewer blocks take part in each look-back.
+inline unsigned int onesweep_items_per_full_batch(const hipStream_t  stream,
+                                                  const unsigned int items_per_block)
+{
+    const unsigned int max_items_per_full_batch
+        = static_cast<unsigned int>(budgeted_size_limit(stream, 1u << 30, items_per_block));
+    return ::rocprim::max(max_items_per_full_batch - max_items_per_full_batch % items_per_block,
+                          items_per_block);
+}
+
 template<class Config,
          bool Descending,
          class KeysInputIterator,
@@ -260,7 +448,10 @@ hipError_t radix_sort_onesweep_iteration(
     const Offset                                                    size,
     Offset*                                                         global_digit_offsets_in,
     Offset*                                                         global_digit_offsets_out,
-    onesweep_lookback_state*                                        lookback_states,
+    const onesweep_lookback_states                                  lookback_states,
+    onesweep_lookback_epoch&                                        lookback_epoch,
+    const unsigned int*                                             trivial_digit,
+    const onesweep_pass*                                            pass,
     const bool                                                      from_input,
     const bool                                                      to_output,
     Decomposer                                                      decomposer,
@@ -281,14 +472,23 @@ hipError_t radix_sort_onesweep_iteration(
     }
     const radix_sort_onesweep_config_params params = dispatch_target_arch<config>(target_arch);
 
+    lookback_backoff_params backoff;
+    result = resolve_lookback_backoff(stream, params.backoff, backoff);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
     const unsigned int items_per_block = params.sort.block_size * params.sort.items_per_thread;
     const unsigned int current_radix_bits
         = ::rocprim::min(params.radix_bits_per_place, end_bit - bit);
+    // The passes of places that fit the short digits run the short kernel
+    const bool short_pass
+        = params.short_radix_bits != 0 && current_radix_bits <= params.short_radix_bits;
 
-    const unsigned int radix_size_per_place     = 1u << params.radix_bits_per_place;
-    const unsigned int max_items_per_full_batch = 1u << 30;
+    const unsigned int radix_size_per_place = 1u << params.radix_bits_per_place;
     const unsigned int items_per_full_batch
-        = max_items_per_full_batch - max_items_per_full_batch % items_per_block;
+        = onesweep_items_per_full_batch(stream, items_per_block);
 
     const unsigned int batches = ceiling_div(size, items_per_full_batch);
     const unsigned int items_per_batch
@@ -306,13 +506,9 @@ hipError_t radix_sort_onesweep_iteration(
             = current_batch_size % items_per_block == 0 ? blocks : blocks - 1;
         const unsigned int num_lookback_states = radix_size_per_place * blocks;
 
-        // Reset lookback scan states to zero, indicating empty prefix.
-        hipError_t error = hipMemsetAsync(lookback_states,
-                                          0,
-                                          sizeof(onesweep_lookback_state) * num_lookback_states,
-                                          stream);
-        if(error != hipSuccess)
-            return error;
+        // The launch uses a new epoch, so the states of the previous launch read as empty
+        // prefixes without being reset.
+        ROCPRIM_RETURN_ON_ERROR(lookback_epoch.next(lookback_states, num_lookback_states, stream));
 
         std::chrono::steady_clock::time_point start;
         if(debug_synchronous)
@@ -332,85 +528,48 @@ hipError_t radix_sort_onesweep_iteration(
             start = std::chrono::steady_clock::now();
         }
 
+        const auto launch = [&](auto keys_in, auto keys_out, auto values_in, auto values_out)
+        {
+            launch_onesweep_iteration_kernel<config, Descending>(
+                std::integral_constant<bool, has_onesweep_short_passes<config>()>{},
+                short_pass,
+                blocks,
+                params.sort.block_size,
+                stream,
+                keys_in,
+                keys_out,
+                values_in,
+                values_out,
+                current_batch_size,
+                global_digit_offsets_in,
+                global_digit_offsets_out,
+                lookback_states,
+                lookback_epoch.epoch,
+                lookback_telemetry::current(),
+                backoff,
+                trivial_digit,
+                pass,
+                decomposer,
+                bit,
+                current_radix_bits,
+                full_blocks);
+        };
+
         if(from_input && to_output)
         {
-            hipLaunchKernelGGL(HIP_KERNEL_NAME(onesweep_iteration_kernel<config, Descending>),
-                               dim3(blocks),
-                               dim3(params.sort.block_size),
-                               0,
-                               stream,
-                               keys_input + offset,
-                               keys_output,
-                               values_input + offset,
-                               values_output,
-                               current_batch_size,
-                               global_digit_offsets_in,
-                               global_digit_offsets_out,
-                               lookback_states,
-                               decomposer,
-                               bit,
-                               current_radix_bits,
-                               full_blocks);
+            launch(keys_input + offset, keys_output, values_input + offset, values_output);
         }
         else if(from_input)
         {
-            hipLaunchKernelGGL(HIP_KERNEL_NAME(onesweep_iteration_kernel<config, Descending>),
-                               dim3(blocks),
-                               dim3(params.sort.block_size),
-                               0,
-                               stream,
-                               keys_input + offset,
-                               keys_tmp,
-                               values_input + offset,
-                               values_tmp,
-                               current_batch_size,
-                               global_digit_offsets_in,
-                               global_digit_offsets_out,
-                               lookback_states,
-                               decomposer,
-                               bit,
-                               current_radix_bits,
-                               full_blocks);
+            launch(keys_input + offset, keys_tmp, values_input + offset, values_tmp);
         }
         else if(to_output)
         {
-            hipLaunchKernelGGL(HIP_KERNEL_NAME(onesweep_iteration_kernel<config, Descending>),
-                               dim3(blocks),
-                               dim3(params.sort.block_size),
-                               0,
-                               stream,
-                               keys_tmp + offset,
-                               keys_output,
-                               values_tmp + offset,
-                               values_output,
-                               current_batch_size,
-                               global_digit_offsets_in,
-                               global_digit_offsets_out,
-                               lookback_states,
-                               decomposer,
-                               bit,
-                               current_radix_bits,
-                               full_blocks);
+            launch(keys_tmp + offset, keys_output, values_tmp + offset, values_output);
         }
         else
         {
-            hipLaunchKernelGGL(HIP_KERNEL_NAME(onesweep_iteration_kernel<config, Descending>),
-                               dim3(blocks),
-                               dim3(params.sort.block_size),
-                               0,
-                               stream,
-                               keys_output + offset,
-                               keys_tmp,
-                               values_output + offset,
-                               values_tmp,
-                               current_batch_size,
-                               global_digit_offsets_in,
-                               global_digit_offsets_out,
-                               lookback_states,
-                               decomposer,
-                               bit,
-                               current_radix_bits,
-                               full_blocks);
+            launch(keys_output + offset, keys_tmp, values_output + offset, values_tmp);
         }
 
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("onesweep_iteration", size, start);
@@ -442,6 +601,8 @@ hipError_t radix_sort_onesweep_impl(
     Decomposer                                                      decomposer,
     const unsigned int                                              begin_bit,
     const unsigned int                                              end_bit,
+    offset_type_t<Size>*                                            digit_counts,
+    const bool                                                      digit_counts_valid,
     const hipStream_t                                               stream,
     const bool                                                      debug_synchronous)
 {
@@ -461,25 +622,36 @@ hipError_t radix_sort_onesweep_impl(
 
     const unsigned int sort_items_per_block = params.sort.block_size * params.sort.items_per_thread;
     const unsigned int radix_size_per_place = 1u << params.radix_bits_per_place;
-    const unsigned int max_items_per_full_batch = 1u << 30;
     const unsigned int items_per_full_batch
-        = max_items_per_full_batch - max_items_per_full_batch % sort_items_per_block;
+        = onesweep_items_per_full_batch(stream, sort_items_per_block);
+
+    const onesweep_digit_places digit_places
+        = make_onesweep_digit_places(begin_bit,
+                                     end_bit,
+                                     params.radix_bits_per_place,
+                                     params.short_radix_bits);
 
-    const unsigned int places = ceiling_div(end_bit - begin_bit, params.radix_bits_per_place);
+    const unsigned int places = digit_places.count;
     const unsigned int bins   = radix_size_per_place * places;
     const unsigned int items_per_batch
         = static_cast<unsigned int>(::rocprim::min<size_t>(size, items_per_full_batch));
     const unsigned int num_lookback_states
         = radix_size_per_place * ceiling_div(items_per_batch, sort_items_per_block);
 
+    // Batches of fewer than 2^24 items use the compact lookback states of half the size
+    const bool compact_lookback = onesweep_compact_lookback(items_per_batch);
+
     constexpr bool with_values        = !std::is_same<value_type, ::rocprim::empty_type>::value;
     const bool     with_double_buffer = keys_tmp != nullptr;
 
-    offset_type*             global_digit_offsets;
-    offset_type*             global_digit_offsets_tmp;
-    onesweep_lookback_state* lookback_states;
-    key_type*                keys_tmp_storage;
-    value_type*              values_tmp_storage;
+    offset_type*                     global_digit_offsets;
+    offset_type*                     global_digit_offsets_tmp;
+    unsigned int*                    trivial_digits;
+    onesweep_pass*                   passes;
+    onesweep_lookback_state*         lookback_states;
+    onesweep_compact_lookback_state* compact_lookback_states;
+    key_type*                        keys_tmp_storage;
+    value_type*                      values_tmp_storage;
 
     const hipError_t partition_result = detail::temp_storage::partition(
         temporary_storage,
@@ -488,7 +660,12 @@ hipError_t radix_sort_onesweep_impl(
             detail::temp_storage::ptr_aligned_array(&global_digit_offsets, bins),
             detail::temp_storage::ptr_aligned_array(&global_digit_offsets_tmp,
                                                     radix_size_per_place),
-            detail::temp_storage::ptr_aligned_array(&lookback_states, num_lookback_states),
+            detail::temp_storage::ptr_aligned_array(&trivial_digits, places),
+            detail::temp_storage::ptr_aligned_array(&passes, places),
+            detail::temp_storage::ptr_aligned_array(&lookback_states,
+                                                    compact_lookback ? 0 : num_lookback_states),
+            detail::temp_storage::ptr_aligned_array(&compact_lookback_states,
+                                                    compact_lookback ? num_lookback_states : 0),
             detail::temp_storage::ptr_aligned_array(&keys_tmp_storage,
                                                     !with_double_buffer ? size : 0),
             detail::temp_storage::ptr_aligned_array(&values_tmp_storage,
@@ -509,6 +686,7 @@ hipError_t radix_sort_onesweep_impl(
         std::cout << "digit_places " << places << '\n';
         std::cout << "histograms_size " << bins << '\n';
         std::cout << "num_lookback_states " << num_lookback_states << '\n';
+        std::cout << "compact_lookback " << compact_lookback << '\n';
         hipError_t error = hipStreamSynchronize(stream);
         if(error != hipSuccess)
             return error;
@@ -520,6 +698,10 @@ hipError_t radix_sort_onesweep_impl(
             = radix_sort_onesweep_global_offsets<Config, Descending>(keys_input,
                                                                      values_input,
                                                                      global_digit_offsets,
+                                                                     trivial_digits,
+                                                                     passes,
+                                                                     digit_counts,
+                                                                     digit_counts_valid,
                                                                      static_cast<offset_type>(size),
                                                                      places,
                                                                      decomposer,
@@ -574,11 +756,14 @@ hipError_t radix_sort_onesweep_impl(
         }
     }
 
-    // Sort each digit place iteratively.
-    for(unsigned bit = begin_bit, place = 0; bit < end_bit;
-        bit += params.radix_bits_per_place, ++place)
+    // Sort each digit place iteratively. The iterations share the lookback states, which are
+    // cleared only once. With several places, the passes are planned on the device: the places
+    // in which all keys have the same digit are skipped, and the last passes exit immediately.
+    onesweep_lookback_epoch lookback_epoch{};
+    for(unsigned int place = 0; place < places; ++place)
     {
-        hipError_t error = radix_sort_onesweep_iteration<Config, Descending>(
+        const unsigned int bit = digit_places.bit(place);
+        hipError_t         error = radix_sort_onesweep_iteration<Config, Descending>(
             keys_input,
             keys_tmp,
             keys_output,
@@ -588,12 +773,16 @@ hipError_t radix_sort_onesweep_impl(
             static_cast<offset_type>(size),
             global_digit_offsets + place * radix_size_per_place,
             global_digit_offsets_tmp,
-            lookback_states,
+            compact_lookback ? onesweep_lookback_states(compact_lookback_states)
+                             : onesweep_lookback_states(lookback_states),
+            lookback_epoch,
+            trivial_digits + place,
+            places > 1 ? passes + place : nullptr,
             from_input,
             to_output,
             decomposer,
             bit,
-            end_bit,
+            bit + digit_places.radix_bits(place),
             stream,
             debug_synchronous);
         if(error != hipSuccess)
@@ -607,6 +796,67 @@ hipError_t radix_sort_onesweep_impl(
     return hipSuccess;
 }
 
+template<bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+hipError_t radix_sort_counting(
+    std::true_type /*counting_supported*/,
+    void*                                                           temporary_storage,
+    size_t&                                                         storage_size,
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    size_t                                                          size,
+    unsigned int                                                    begin_bit,
+    unsigned int                                                    end_bit,
+    hipStream_t                                                     stream,
+    bool                                                            debug_synchronous)
+{
+    return radix_sort_counting_impl<Descending>(temporary_storage,
+                                                storage_size,
+                                                keys_input,
+                                                keys_tmp,
+                                                keys_output,
+                                                values_input,
+                                                values_tmp,
+                                                values_output,
+                                                size,
+                                                begin_bit,
+                                                end_bit,
+                                                stream,
+                                                debug_synchronous);
+}
+
+// Keys with a custom decomposer are never sorted by the counting sort.
+template<bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+hipError_t radix_sort_counting(
+    std::false_type /*counting_supported*/,
+    void* /*temporary_storage*/,
+    size_t& /*storage_size*/,
+    KeysInputIterator /*keys_input*/,
+    typename std::iterator_traits<KeysInputIterator>::value_type* /*keys_tmp*/,
+    KeysOutputIterator /*keys_output*/,
+    ValuesInputIterator /*values_input*/,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* /*values_tmp*/,
+    ValuesOutputIterator /*values_output*/,
+    size_t /*size*/,
+    unsigned int /*begin_bit*/,
+    unsigned int /*end_bit*/,
+    hipStream_t /*stream*/,
+    bool /*debug_synchronous*/)
+{
+    return hipErrorInvalidValue;
+}
+
 template<class Config,
          bool Descending,
          class KeysInputIterator,
@@ -615,22 +865,22 @@ template<class Config,
          class ValuesOutputIterator,
          class Size,
          class Decomposer>
-hipError_t
-    radix_sort_impl(void*                                                         temporary_storage,
-                    size_t&                                                       storage_size,
-                    KeysInputIterator                                             keys_input,
-                    typename std::iterator_traits<KeysInputIterator>::value_type* keys_tmp,
-                    KeysOutputIterator                                            keys_output,
-                    ValuesInputIterator                                           values_input,
-                    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
-                    ValuesOutputIterator                                            values_output,
-                    Size                                                            size,
-                    bool&        is_result_in_output,
-                    Decomposer   decomposer,
-                    unsigned int begin_bit,
-                    unsigned int end_bit,
-                    hipStream_t  stream,
-                    bool         debug_synchronous)
+hipError_t radix_sort_config_impl(
+    void*                                                           temporary_storage,
+    size_t&                                                         storage_size,
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    Size                                                            size,
+    bool&                                                           is_result_in_output,
+    Decomposer                                                      decomposer,
+    unsigned int                                                    begin_bit,
+    unsigned int                                                    end_bit,
+    hipStream_t                                                     stream,
+    bool                                                            debug_synchronous)
 {
     using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
@@ -671,6 +921,7 @@ hipError_t
     if(::rocprim::is_floating_point<key_type>::value
        && ((begin_bit != 0) || (end_bit != sizeof(key_type) * 8)))
     {
+        detail::record_diagnostic(diagnostic_code::invalid_bit_range, begin_bit, end_bit);
         return hipErrorInvalidValue;
     }
     unsigned int single_sort_items_per_block
@@ -702,6 +953,29 @@ hipError_t
                                                                     stream,
                                                                     debug_synchronous);
     }
+    // A bit range of a few bits is a single digit, whose keys are counted and scattered once
+    // instead of being sorted by the passes of the onesweep or merge sort. Tuned configs keep
+    // their algorithms.
+    else if(is_default_config && radix_sort_counting_supported<key_type, Decomposer>::value
+            && radix_sort_use_counting<key_type>(static_cast<size_t>(size), begin_bit, end_bit))
+    {
+        is_result_in_output = true;
+        return radix_sort_counting<Descending>(
+            radix_sort_counting_supported<key_type, Decomposer>{},
+            temporary_storage,
+            storage_size,
+            keys_input,
+            keys_tmp,
+            keys_output,
+            values_input,
+            values_tmp,
+            values_output,
+            static_cast<size_t>(size),
+            begin_bit,
+            end_bit,
+            stream,
+            debug_synchronous);
+    }
     // For sizeof(key_type) <= 2, onesweep is 2x/3x faster (also with values) when
     // input_size > 100K, so don't use radix_sort_merge_sort then.
     else if(static_cast<size_t>(size) <= merge_sort_limit
@@ -742,12 +1016,595 @@ hipError_t
                                                                      decomposer,
                                                                      begin_bit,
                                                                      end_bit,
+                                                                     nullptr,
+                                                                     false,
                                                                      stream,
                                                                      debug_synchronous);
     }
 }
 
+// Sorts the pairs with the autotuned config for the key and value types, the values are
+// moved in every pass of the sort.
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class Size,
+         class Decomposer>
+hipError_t radix_sort_direct_impl(
+    void*                                                           temporary_storage,
+    size_t&                                                         storage_size,
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    Size                                                            size,
+    bool&                                                           is_result_in_output,
+    Decomposer                                                      decomposer,
+    unsigned int                                                    begin_bit,
+    unsigned int                                                    end_bit,
+    hipStream_t                                                     stream,
+    bool                                                            debug_synchronous)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    return dispatch_tuned_config<Config, key_type, value_type>(
+        "radix_sort",
+        static_cast<size_t>(size),
+        stream,
+        [&](auto config)
+        {
+            using config_type = typename decltype(config)::type;
+            return radix_sort_config_impl<config_type, Descending>(temporary_storage,
+                                                                   storage_size,
+                                                                   keys_input,
+                                                                   keys_tmp,
+                                                                   keys_output,
+                                                                   values_input,
+                                                                   values_tmp,
+                                                                   values_output,
+                                                                   size,
+                                                                   is_result_in_output,
+                                                                   decomposer,
+                                                                   begin_bit,
+                                                                   end_bit,
+                                                                   stream,
+                                                                   debug_synchronous);
+        });
+}
+
+// Values of more bytes than this are not moved by the passes of the sort, see
+// radix_sort_indirect_impl.
+constexpr size_t radix_sort_indirect_value_bytes = 16;
 
+template<class Value>
+using radix_sort_use_indirect_values
+    = std::integral_constant<bool,
+                             !std::is_same<Value, empty_type>::value
+                                 && (sizeof(Value) > radix_sort_indirect_value_bytes)>;
+
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class Size,
+         class Decomposer>
+hipError_t radix_sort_indirect_impl(
+    std::false_type /*use_indirect_values*/,
+    void*                                                           temporary_storage,
+    size_t&                                                         storage_size,
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    Size                                                            size,
+    bool&                                                           is_result_in_output,
+    Decomposer                                                      decomposer,
+    unsigned int                                                    begin_bit,
+    unsigned int                                                    end_bit,
+    hipStream_t                                                     stream,
+    bool                                                            debug_synchronous)
+{
+    return radix_sort_direct_impl<Config, Descending>(temporary_storage,
+                                                      storage_size,
+                                                      keys_input,
+                                                      keys_tmp,
+                                                      keys_output,
+                                                      values_input,
+                                                      values_tmp,
+                                                      values_output,
+                                                      size,
+                                                      is_result_in_output,
+                                                      decomposer,
+                                                      begin_bit,
+                                                      end_bit,
+                                                      stream,
+                                                      debug_synchronous);
+}
+
+// Sorts pairs of large values without moving them in the passes of the sort: the keys are
+// sorted with the 32-bit indices of their values, then the values are gathered once from
+// values_input in the sorted order of the indices. The traffic of the values drops from a read
+// and a write per pass to a single (gathered) read and write.
+// With a double buffer the values are always gathered to values_output, as the input is in
+// values_tmp, so the sorted keys are copied to keys_output if the sort left them in keys_tmp.
+// Sorts with more items than indices, or whose values_input may alias values_output, move the
+// values directly.
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class Size,
+         class Decomposer>
+hipError_t radix_sort_indirect_impl(
+    std::true_type /*use_indirect_values*/,
+    void*                                                           temporary_storage,
+    size_t&                                                         storage_size,
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    Size                                                            size,
+    bool&                                                           is_result_in_output,
+    Decomposer                                                      decomposer,
+    unsigned int                                                    begin_bit,
+    unsigned int                                                    end_bit,
+    hipStream_t                                                     stream,
+    bool                                                            debug_synchronous)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using index_type = unsigned int;
+
+    const bool with_double_buffer = keys_tmp != nullptr;
+    if(static_cast<size_t>(size) > std::numeric_limits<index_type>::max()
+       || (!with_double_buffer
+           && can_iterators_alias(values_input, values_output, static_cast<size_t>(size))))
+    {
+        return radix_sort_direct_impl<Config, Descending>(temporary_storage,
+                                                          storage_size,
+                                                          keys_input,
+                                                          keys_tmp,
+                                                          keys_output,
+                                                          values_input,
+                                                          values_tmp,
+                                                          values_output,
+                                                          size,
+                                                          is_result_in_output,
+                                                          decomposer,
+                                                          begin_bit,
+                                                          end_bit,
+                                                          stream,
+                                                          debug_synchronous);
+    }
+
+    const auto   indices_input = make_counting_iterator<index_type>(0);
+    index_type*  indices     = nullptr;
+    index_type*  indices_tmp = nullptr;
+    void*        sort_storage;
+    size_t       sort_storage_size = 0;
+    bool         ignored;
+    const size_t indices_size = static_cast<size_t>(size);
+
+    // The storage of the sort is queried without indices_tmp, which does not make it smaller
+    ROCPRIM_RETURN_ON_ERROR(radix_sort_direct_impl<Config, Descending>(nullptr,
+                                                                       sort_storage_size,
+                                                                       keys_input,
+                                                                       keys_tmp,
+                                                                       keys_output,
+                                                                       indices_input,
+                                                                       indices_tmp,
+                                                                       indices,
+                                                                       size,
+                                                                       ignored,
+                                                                       decomposer,
+                                                                       begin_bit,
+                                                                       end_bit,
+                                                                       stream,
+                                                                       debug_synchronous));
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&indices, indices_size),
+            detail::temp_storage::ptr_aligned_array(&indices_tmp,
+                                                    with_double_buffer ? indices_size : 0),
+            detail::temp_storage::make_partition(&sort_storage, sort_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+    if(!with_double_buffer)
+    {
+        indices_tmp = nullptr;
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(radix_sort_direct_impl<Config, Descending>(sort_storage,
+                                                                       sort_storage_size,
+                                                                       keys_input,
+                                                                       keys_tmp,
+                                                                       keys_output,
+                                                                       indices_input,
+                                                                       indices_tmp,
+                                                                       indices,
+                                                                       size,
+                                                                       is_result_in_output,
+                                                                       decomposer,
+                                                                       begin_bit,
+                                                                       end_bit,
+                                                                       stream,
+                                                                       debug_synchronous));
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    const index_type* sorted_indices = is_result_in_output ? indices : indices_tmp;
+    if(!is_result_in_output)
+    {
+        ROCPRIM_RETURN_ON_ERROR(::rocprim::transform(keys_tmp,
+                                                     keys_output,
+                                                     size,
+                                                     ::rocprim::identity<key_type>(),
+                                                     stream,
+                                                     debug_synchronous));
+        is_result_in_output = true;
+    }
+
+    return ::rocprim::transform(::rocprim::make_permutation_iterator(values_input, sorted_indices),
+                                values_output,
+                                size,
+                                ::rocprim::identity<value_type>(),
+                                stream,
+                                debug_synchronous);
+}
+
+// Pairs with an integral key and a value of at most 32 bits are sorted as single 64-bit words,
+// see radix_sort_packed_impl. Floating-point keys are not packed, the sort considers -0.0 and
+// +0.0 equal, which the bits of the packed word do not.
+template<class Config, class Key, class Value, class Decomposer>
+using radix_sort_use_packed_pairs = std::integral_constant<
+    bool,
+    std::is_same<Config, default_config>::value
+        && std::is_same<Decomposer, identity_decomposer>::value
+        && ::rocprim::is_integral<Key>::value && !std::is_same<Key, bool>::value
+        && sizeof(Key) <= 4 && !std::is_same<Value, empty_type>::value
+        && std::is_trivially_copyable<Value>::value
+        && (sizeof(Value) == 1 || sizeof(Value) == 2 || sizeof(Value) == 4)>;
+
+template<class Key, class Value>
+struct radix_sort_packed_pair
+{
+    using packed_type     = unsigned long long;
+    using key_codec       = radix_key_codec<Key>;
+    using value_bits_type = typename std::conditional<
+        sizeof(Value) == 1,
+        unsigned char,
+        typename std::conditional<sizeof(Value) == 2, unsigned short, unsigned int>::type>::type;
+
+    static constexpr unsigned int value_bits = 8 * sizeof(Value);
+
+    // The encoded key is in the high bits, so the value bits never decide between two keys.
+    struct pack_op
+    {
+        template<class Pair>
+        ROCPRIM_HOST_DEVICE
+        packed_type operator()(const Pair& pair) const
+        {
+            const Key   key   = ::rocprim::get<0>(pair);
+            const Value value = ::rocprim::get<1>(pair);
+            return (static_cast<packed_type>(key_codec::encode(key)) << value_bits)
+                   | static_cast<packed_type>(bit_cast<value_bits_type>(value));
+        }
+    };
+
+    struct unpack_op
+    {
+        ROCPRIM_HOST_DEVICE
+        ::rocprim::tuple<Key, Value> operator()(const packed_type packed) const
+        {
+            using bit_key_type = typename key_codec::bit_key_type;
+            return ::rocprim::make_tuple(
+                key_codec::decode(static_cast<bit_key_type>(packed >> value_bits)),
+                bit_cast<Value>(static_cast<value_bits_type>(packed)));
+        }
+    };
+};
+
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class Size,
+         class Decomposer>
+hipError_t radix_sort_packed_impl(
+    std::false_type /*use_packed_pairs*/,
+    void*                                                           temporary_storage,
+    size_t&                                                         storage_size,
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    Size                                                            size,
+    bool&                                                           is_result_in_output,
+    Decomposer                                                      decomposer,
+    unsigned int                                                    begin_bit,
+    unsigned int                                                    end_bit,
+    hipStream_t                                                     stream,
+    bool                                                            debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    return radix_sort_indirect_impl<Config, Descending>(
+        radix_sort_use_indirect_values<value_type>{},
+        temporary_storage,
+        storage_size,
+        keys_input,
+        keys_tmp,
+        keys_output,
+        values_input,
+        values_tmp,
+        values_output,
+        size,
+        is_result_in_output,
+        decomposer,
+        begin_bit,
+        end_bit,
+        stream,
+        debug_synchronous);
+}
+
+// Sorts pairs of small keys and values as keys only: every key is packed with its value into a
+// 64-bit word, the words are sorted by the bits of the keys, and then unpacked to the outputs.
+// A pass of the sort scatters one word per item instead of a key and a value, at the cost of
+// storage for the packed words and an extra pass to unpack them. The sort of the words is
+// stable, so the values of equal keys keep their order.
+// Sorts with a double buffer, whose storage is provided by the caller, and sorts small enough
+// for the merge sort, which does not benefit from fewer scatters, sort the pairs directly.
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class Size,
+         class Decomposer>
+hipError_t radix_sort_packed_impl(
+    std::true_type /*use_packed_pairs*/,
+    void*                                                           temporary_storage,
+    size_t&                                                         storage_size,
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    Size                                                            size,
+    bool&                                                           is_result_in_output,
+    Decomposer                                                      decomposer,
+    unsigned int                                                    begin_bit,
+    unsigned int                                                    end_bit,
+    hipStream_t                                                     stream,
+    bool                                                            debug_synchronous)
+{
+    using key_type    = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type  = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using packed_pair = radix_sort_packed_pair<key_type, value_type>;
+    using packed_type = typename packed_pair::packed_type;
+
+    if(keys_tmp != nullptr || static_cast<size_t>(size) <= radix_sort_config<>::merge_sort_limit
+       || begin_bit >= end_bit || end_bit > 8 * sizeof(key_type))
+    {
+        return radix_sort_packed_impl<Config, Descending>(std::false_type{},
+                                                          temporary_storage,
+                                                          storage_size,
+                                                          keys_input,
+                                                          keys_tmp,
+                                                          keys_output,
+                                                          values_input,
+                                                          values_tmp,
+                                                          values_output,
+                                                          size,
+                                                          is_result_in_output,
+                                                          decomposer,
+                                                          begin_bit,
+                                                          end_bit,
+                                                          stream,
+                                                          debug_synchronous);
+    }
+
+    const auto packed_input = ::rocprim::make_transform_iterator(
+        ::rocprim::make_zip_iterator(::rocprim::make_tuple(keys_input, values_input)),
+        typename packed_pair::pack_op{});
+    const unsigned int packed_begin_bit = begin_bit + packed_pair::value_bits;
+    const unsigned int packed_end_bit   = end_bit + packed_pair::value_bits;
+
+    packed_type* packed = nullptr;
+    empty_type*  values = nullptr;
+    void*        sort_storage;
+    size_t       sort_storage_size = 0;
+    bool         ignored;
+
+    ROCPRIM_RETURN_ON_ERROR(radix_sort_direct_impl<Config, Descending>(nullptr,
+                                                                       sort_storage_size,
+                                                                       packed_input,
+                                                                       nullptr,
+                                                                       packed,
+                                                                       values,
+                                                                       nullptr,
+                                                                       values,
+                                                                       size,
+                                                                       ignored,
+                                                                       identity_decomposer{},
+                                                                       packed_begin_bit,
+                                                                       packed_end_bit,
+                                                                       stream,
+                                                                       debug_synchronous));
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&packed, static_cast<size_t>(size)),
+            detail::temp_storage::make_partition(&sort_storage, sort_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(radix_sort_direct_impl<Config, Descending>(sort_storage,
+                                                                       sort_storage_size,
+                                                                       packed_input,
+                                                                       nullptr,
+                                                                       packed,
+                                                                       values,
+                                                                       nullptr,
+                                                                       values,
+                                                                       size,
+                                                                       ignored,
+                                                                       identity_decomposer{},
+                                                                       packed_begin_bit,
+                                                                       packed_end_bit,
+                                                                       stream,
+                                                                       debug_synchronous));
+
+    is_result_in_output = true;
+    return ::rocprim::transform(
+        packed,
+        ::rocprim::make_zip_iterator(::rocprim::make_tuple(keys_output, values_output)),
+        size,
+        typename packed_pair::unpack_op{},
+        stream,
+        debug_synchronous);
+}
+
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class Size,
+         class Decomposer>
+hipError_t
+    radix_sort_impl(void*                                                         temporary_storage,
+                    size_t&                                                       storage_size,
+                    KeysInputIterator                                             keys_input,
+                    typename std::iterator_traits<KeysInputIterator>::value_type* keys_tmp,
+                    KeysOutputIterator                                            keys_output,
+                    ValuesInputIterator                                           values_input,
+                    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+                    ValuesOutputIterator                                            values_output,
+                    Size                                                            size,
+                    bool&        is_result_in_output,
+                    Decomposer   decomposer,
+                    unsigned int begin_bit,
+                    unsigned int end_bit,
+                    hipStream_t  stream,
+                    bool         debug_synchronous)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    return radix_sort_packed_impl<Config, Descending>(
+        radix_sort_use_packed_pairs<Config, key_type, value_type, Decomposer>{},
+        temporary_storage,
+        storage_size,
+        keys_input,
+        keys_tmp,
+        keys_output,
+        values_input,
+        values_tmp,
+        values_output,
+        size,
+        is_result_in_output,
+        decomposer,
+        begin_bit,
+        end_bit,
+        stream,
+        debug_synchronous);
+}
+
+template<class SizeType, class SizeIterator>
+empty_type* make_future_size_values(empty_type* values, future_value<SizeType, SizeIterator>)
+{
+    return values;
+}
+
+template<class ValuesInputIterator, class SizeType, class SizeIterator>
+future_size_input_iterator<ValuesInputIterator, SizeType, SizeIterator>
+    make_future_size_values(ValuesInputIterator values, future_value<SizeType, SizeIterator> size)
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    return make_future_size_input(values, size, value_type{});
+}
+
+// Sorts max_size keys, where the keys past the size read on the device are replaced by
+// out-of-bounds keys. Those sort after all keys, because the sort is stable, so the first size
+// items of the output are the sorted input.
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class SizeType,
+         class SizeIterator>
+hipError_t radix_sort_future_size_impl(void*                                temporary_storage,
+                                       size_t&                              storage_size,
+                                       KeysInputIterator                    keys_input,
+                                       KeysOutputIterator                   keys_output,
+                                       ValuesInputIterator                  values_input,
+                                       ValuesOutputIterator                 values_output,
+                                       future_value<SizeType, SizeIterator> size,
+                                       const size_t                         max_size,
+                                       unsigned int                         begin_bit,
+                                       unsigned int                         end_bit,
+                                       hipStream_t                          stream,
+                                       bool                                 debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    const auto keys = make_future_size_input(
+        keys_input,
+        size,
+        radix_key_codec<key_type, Descending>::get_out_of_bounds_key());
+    const auto values = make_future_size_values(values_input, size);
+    bool       ignored;
+    return radix_sort_impl<Config, Descending>(temporary_storage,
+                                               storage_size,
+                                               keys,
+                                               nullptr,
+                                               keys_output,
+                                               values,
+                                               nullptr,
+                                               values_output,
+                                               max_size,
+                                               ignored,
+                                               identity_decomposer{},
+                                               begin_bit,
+                                               end_bit,
+                                               stream,
+                                               debug_synchronous);
+}
 
 } // end namespace detail
 
@@ -774,7 +1631,8 @@ hipError_t
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator random-access iterator type of the output range. Must meet the
@@ -868,6 +1726,83 @@ hipError_t radix_sort_keys(void*              temporary_storage,
                                                   debug_synchronous);
 }
 
+/// \brief Parallel ascending radix sort primitive for device level, over a number of keys that
+/// is only known on the device.
+///
+/// \p radix_sort_keys function performs a device-wide radix sort of keys in ascending order,
+/// like the overload with a host-known size. The number of keys is read by the kernels, for
+/// example from the count output of a previous \p select, so a chain of algorithms runs
+/// without synchronizing with the host.
+///
+/// \par Overview
+/// * The sort runs over \p max_size keys, the keys past the actual number of keys are replaced
+/// by keys that are ordered after all other keys.
+/// * \p keys_output must have at least \p max_size elements. Its first \p size elements are
+/// the sorted keys, the other elements are overwritten.
+/// * The input and output ranges must not overlap.
+/// * The actual number of keys must not be greater than \p max_size.
+/// * The temporary storage is sized for \p max_size keys.
+///
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
+/// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam SizeType integral type of the number of keys.
+/// \tparam SizeIterator iterator type pointing at the number of keys.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input pointer to the first element in the range to sort.
+/// \param [out] keys_output pointer to the first element in the output range.
+/// \param [in] size the number of keys, read on the device when the kernels run.
+/// \param [in] max_size the greatest possible number of keys, used to size the launches.
+/// \param [in] begin_bit [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// \param [in] end_bit [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class SizeType,
+         class SizeIterator,
+         class Key = typename std::iterator_traits<KeysInputIterator>::value_type>
+hipError_t radix_sort_keys(void*                                temporary_storage,
+                           size_t&                              storage_size,
+                           KeysInputIterator                    keys_input,
+                           KeysOutputIterator                   keys_output,
+                           future_value<SizeType, SizeIterator> size,
+                           const size_t                         max_size,
+                           unsigned int                         begin_bit         = 0,
+                           unsigned int                         end_bit           = 8 * sizeof(Key),
+                           hipStream_t                          stream            = 0,
+                           bool                                 debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::radix_sort_future_size_impl<Config, false>(temporary_storage,
+                                                              storage_size,
+                                                              keys_input,
+                                                              keys_output,
+                                                              values,
+                                                              values,
+                                                              size,
+                                                              max_size,
+                                                              begin_bit,
+                                                              end_bit,
+                                                              stream,
+                                                              debug_synchronous);
+}
+
 /// \brief Parallel ascending radix sort primitive for device level.
 ///
 /// \p radix_sort_keys function performs a device-wide radix sort
@@ -896,7 +1831,8 @@ hipError_t radix_sort_keys(void*              temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam Key key type. Must be an integral type or a floating-point type.
 /// \tparam Size integral type that represents the problem size.
 ///
@@ -1018,7 +1954,8 @@ hipError_t radix_sort_keys(void*               temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator Random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator Random-access iterator type of the output range. Must meet the
@@ -1157,7 +2094,8 @@ auto radix_sort_keys(void*              temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator Random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator Random-access iterator type of the output range. Must meet the
@@ -1299,7 +2237,8 @@ auto radix_sort_keys(void*              temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam Key key type. Must be an integral type or a floating-point type.
 /// \tparam Size integral type that represents the problem size.
 /// \tparam Decomposer The type of the decomposer functor.
@@ -1440,7 +2379,8 @@ auto radix_sort_keys(void*               temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam Key key type. Must be an integral type or a floating-point type.
 /// \tparam Size integral type that represents the problem size.
 /// \tparam Decomposer The type of the decomposer functor.
@@ -1568,7 +2508,8 @@ auto radix_sort_keys(void*               temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator random-access iterator type of the output range. Must meet the
@@ -1691,7 +2632,8 @@ hipError_t radix_sort_keys_desc(void*              temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam Key key type. Must be an integral type or a floating-point type.
 /// \tparam Size integral type that represents the problem size.
 ///
@@ -1813,7 +2755,8 @@ hipError_t radix_sort_keys_desc(void*               temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator random-access iterator type of the output range. Must meet the
@@ -1952,7 +2895,8 @@ auto radix_sort_keys_desc(void*              temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator random-access iterator type of the output range. Must meet the
@@ -2094,7 +3038,8 @@ auto radix_sort_keys_desc(void*              temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam Key key type. Must be an integral type or a floating-point type.
 /// \tparam Size integral type that represents the problem size.
 /// \tparam Decomposer The type of the decomposer functor.
@@ -2235,7 +3180,8 @@ auto radix_sort_keys_desc(void*               temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam Key key type. Must be an integral type or a floating-point type.
 /// \tparam Size integral type that represents the problem size.
 /// \tparam Decomposer The type of the decomposer functor.
@@ -2364,7 +3310,8 @@ auto radix_sort_keys_desc(void*               temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator random-access iterator type of the output range. Must meet the
@@ -2476,6 +3423,92 @@ hipError_t radix_sort_pairs(void*                temporary_storage,
                                                   debug_synchronous);
 }
 
+/// \brief Parallel ascending radix sort-by-key primitive for device level, over a number of
+/// pairs that is only known on the device.
+///
+/// \p radix_sort_pairs function performs a device-wide radix sort of (key, value) pairs in
+/// ascending order of keys, like the overload with a host-known size. The number of pairs is
+/// read by the kernels, for example from the count output of a previous \p select, so a chain
+/// of algorithms runs without synchronizing with the host.
+///
+/// \par Overview
+/// * The sort runs over \p max_size pairs, the keys past the actual number of pairs are replaced
+/// by keys that are ordered after all other keys, and their values by default-constructed ones.
+/// * \p keys_output and \p values_output must have at least \p max_size elements. Their first
+/// \p size elements are the sorted pairs, the other elements are overwritten.
+/// * The input and output ranges must not overlap.
+/// * The actual number of pairs must not be greater than \p max_size.
+/// * The temporary storage is sized for \p max_size pairs.
+///
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
+/// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam SizeType integral type of the number of pairs.
+/// \tparam SizeIterator iterator type pointing at the number of pairs.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input pointer to the first element in the range to sort.
+/// \param [out] keys_output pointer to the first element in the output range.
+/// \param [in] values_input pointer to the first element in the range to sort.
+/// \param [out] values_output pointer to the first element in the output range.
+/// \param [in] size the number of pairs, read on the device when the kernels run.
+/// \param [in] max_size the greatest possible number of pairs, used to size the launches.
+/// \param [in] begin_bit [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// \param [in] end_bit [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class SizeType,
+         class SizeIterator,
+         class Key = typename std::iterator_traits<KeysInputIterator>::value_type>
+hipError_t radix_sort_pairs(void*                                temporary_storage,
+                            size_t&                              storage_size,
+                            KeysInputIterator                    keys_input,
+                            KeysOutputIterator                   keys_output,
+                            ValuesInputIterator                  values_input,
+                            ValuesOutputIterator                 values_output,
+                            future_value<SizeType, SizeIterator> size,
+                            const size_t                         max_size,
+                            unsigned int                         begin_bit         = 0,
+                            unsigned int                         end_bit           = 8 * sizeof(Key),
+                            hipStream_t                          stream            = 0,
+                            bool                                 debug_synchronous = false)
+{
+    return detail::radix_sort_future_size_impl<Config, false>(temporary_storage,
+                                                              storage_size,
+                                                              keys_input,
+                                                              keys_output,
+                                                              values_input,
+                                                              values_output,
+                                                              size,
+                                                              max_size,
+                                                              begin_bit,
+                                                              end_bit,
+                                                              stream,
+                                                              debug_synchronous);
+}
+
 /// \brief Parallel ascending radix sort-by-key primitive for device level.
 ///
 /// \p radix_sort_pairs function performs a device-wide radix sort
@@ -2504,7 +3537,8 @@ hipError_t radix_sort_pairs(void*                temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam Key key type. Must be an integral type or a floating-point type.
 /// \tparam Value value type.
 /// \tparam Size integral type that represents the problem size.
@@ -2640,7 +3674,8 @@ hipError_t radix_sort_pairs(void*                 temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator random-access iterator type of the output range. Must meet the
@@ -2797,7 +3832,8 @@ auto radix_sort_pairs(void*                temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator random-access iterator type of the output range. Must meet the
@@ -2953,7 +3989,8 @@ auto radix_sort_pairs(void*                temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam Key key type. Must be an integral type or a floating-point type.
 /// \tparam Value value type.
 /// \tparam Size integral type that represents the problem size.
@@ -3106,7 +4143,8 @@ auto radix_sort_pairs(void*                 temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam Key key type. Must be an integral type or a floating-point type.
 /// \tparam Value value type.
 /// \tparam Size integral type that represents the problem size.
@@ -3243,7 +4281,8 @@ auto radix_sort_pairs(void*                 temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator random-access iterator type of the output range. Must meet the
@@ -3379,7 +4418,8 @@ hipError_t radix_sort_pairs_desc(void*                temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam Key key type. Must be an integral type or a floating-point type.
 /// \tparam Value value type.
 /// \tparam Size integral type that represents the problem size.
@@ -3509,7 +4549,8 @@ hipError_t radix_sort_pairs_desc(void*                 temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator random-access iterator type of the output range. Must meet the
@@ -3666,7 +4707,8 @@ auto radix_sort_pairs_desc(void*                temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam KeysOutputIterator random-access iterator type of the output range. Must meet the
@@ -3822,7 +4864,8 @@ auto radix_sort_pairs_desc(void*                temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam Key key type. Must be an integral type or a floating-point type.
 /// \tparam Value value type.
 /// \tparam Size integral type that represents the problem size.
@@ -3975,7 +5018,8 @@ auto radix_sort_pairs_desc(void*                 temporary_storage,
 ///   * op(a, b) and op(b, a) are both false,
 /// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
 ///
-/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config`, `radix_sort_config`
+/// or a `tuned_config` of these.
 /// \tparam Key key type. Must be an integral type or a floating-point type.
 /// \tparam Value value type.
 /// \tparam Size integral type that represents the problem size.
@@ -4088,6 +5132,10 @@ auto radix_sort_pairs_desc(void*                 temporary_storage,
     return error;
 }
 
+#if defined(ROCPRIM_USE_PREBUILT) && !defined(DOXYGEN_SHOULD_SKIP_THIS)
+ROCPRIM_DETAIL_PREBUILT_RADIX_SORT(extern template)
+#endif
+
 END_ROCPRIM_NAMESPACE
 
 /// @}
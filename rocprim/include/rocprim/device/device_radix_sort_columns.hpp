@@ -0,0 +1,294 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_RADIX_SORT_COLUMNS_HPP_
+#define ROCPRIM_DEVICE_DEVICE_RADIX_SORT_COLUMNS_HPP_
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_radix_sort_columns.hpp"
+#include "device_radix_sort.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputsIterator,
+         class ValuesOutputsIterator,
+         class ValueSizesIterator>
+inline hipError_t radix_sort_columns_impl(void*                 temporary_storage,
+                                          size_t&               storage_size,
+                                          KeysInputIterator     keys_input,
+                                          KeysOutputIterator    keys_output,
+                                          ValuesInputsIterator  values_inputs,
+                                          ValuesOutputsIterator values_outputs,
+                                          ValueSizesIterator    value_sizes,
+                                          const unsigned int    num_columns,
+                                          const size_t          size,
+                                          const unsigned int    begin_bit,
+                                          const unsigned int    end_bit,
+                                          const hipStream_t     stream,
+                                          const bool            debug_synchronous)
+{
+    // The payload of the sort is a 32-bit index.
+    if(size > std::numeric_limits<unsigned int>::max())
+    {
+        return hipErrorInvalidValue;
+    }
+
+    const counting_iterator<unsigned int> positions(0);
+    unsigned int* const                   no_indices = nullptr;
+    bool                                  ignored;
+
+    size_t sort_storage_size;
+    ROCPRIM_RETURN_ON_ERROR(radix_sort_impl<Config, Descending>(nullptr,
+                                                                sort_storage_size,
+                                                                keys_input,
+                                                                nullptr,
+                                                                keys_output,
+                                                                positions,
+                                                                no_indices,
+                                                                no_indices,
+                                                                size,
+                                                                ignored,
+                                                                identity_decomposer{},
+                                                                begin_bit,
+                                                                end_bit,
+                                                                stream,
+                                                                false));
+
+    void*         sort_storage;
+    unsigned int* indices;
+
+    const hipError_t partition_result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::make_partition(&sort_storage, sort_storage_size),
+            temp_storage::ptr_aligned_array(&indices, size)));
+
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(radix_sort_impl<Config, Descending>(sort_storage,
+                                                                sort_storage_size,
+                                                                keys_input,
+                                                                nullptr,
+                                                                keys_output,
+                                                                positions,
+                                                                nullptr,
+                                                                indices,
+                                                                size,
+                                                                ignored,
+                                                                identity_decomposer{},
+                                                                begin_bit,
+                                                                end_bit,
+                                                                stream,
+                                                                debug_synchronous));
+
+    if(num_columns == 0)
+    {
+        return hipSuccess;
+    }
+
+    constexpr unsigned int items_per_block
+        = radix_sort_columns_block_size * radix_sort_columns_items_per_thread;
+    const size_t grid_size = ceiling_div(size, items_per_block);
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    radix_sort_columns_kernel<<<grid_size, radix_sort_columns_block_size, 0, stream>>>(
+        indices,
+        size,
+        values_inputs,
+        values_outputs,
+        value_sizes,
+        num_columns);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_sort_columns_kernel", size, start);
+
+    return hipSuccess;
+}
+
+} // end namespace detail
+
+/// \brief Parallel ascending radix sort of keys that permutes several value columns.
+///
+/// \par Overview
+/// * Sorts the keys and applies the same permutation to \p num_columns value columns, which
+///   may all have a different item width. Column \p c is the array of \p size items of
+///   <tt>value_sizes[c]</tt> bytes at <tt>values_inputs[c]</tt>, and is written to
+///   <tt>values_outputs[c]</tt>.
+/// * The keys are sorted with a 32-bit index as the value, and a single kernel then gathers
+///   every column with the sorted indices. This avoids zipping the columns into one value,
+///   and loads the indices once for all columns.
+/// * Columns whose width is 1, 2, 4, 8 or 16 bytes, and whose input and output are aligned to
+///   it, are copied with loads of that width. The others are copied byte by byte.
+/// * The sort is \b stable: it preserves the relative ordering of equivalent keys.
+/// * When \p temporary_storage is a null pointer, the required allocation size (in bytes) is
+///   written to \p storage_size and the function returns without performing the sort.
+///
+/// \tparam Config [optional] Configuration of the sort of the keys. <tt>radix_sort_config</tt>
+/// or <tt>default_config</tt>.
+/// \tparam KeysInputIterator random-access iterator type of the input range of keys.
+/// \tparam KeysOutputIterator random-access iterator type of the output range of keys.
+/// \tparam ValuesInputsIterator random-access iterator type of the column inputs. Its value
+/// type must be convertible to <tt>const void*</tt>, and it must be accessible on the device.
+/// \tparam ValuesOutputsIterator random-access iterator type of the column outputs. Its value
+/// type must be convertible to <tt>void*</tt>, and it must be accessible on the device.
+/// \tparam ValueSizesIterator random-access iterator type of the item widths of the columns.
+/// Its value type must be convertible to <tt>size_t</tt>, and it must be accessible on the
+/// device.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and the function returns without performing the sort.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range of keys.
+/// \param [out] keys_output iterator to the output range of keys.
+/// \param [in] values_inputs iterator to the input pointers of the columns.
+/// \param [in] values_outputs iterator to the output pointers of the columns. The outputs must
+/// not overlap the inputs.
+/// \param [in] value_sizes iterator to the item widths (in bytes) of the columns.
+/// \param [in] num_columns number of value columns.
+/// \param [in] size number of keys and of items of every column. Must not exceed the range of
+/// <tt>unsigned int</tt>, otherwise <tt>hipErrorInvalidValue</tt> is returned.
+/// \param [in] begin_bit [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// \param [in] end_bit [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default value:
+/// <tt>8 * sizeof(Key)</tt>.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputsIterator,
+         class ValuesOutputsIterator,
+         class ValueSizesIterator,
+         class Key = typename std::iterator_traits<KeysInputIterator>::value_type>
+hipError_t radix_sort_columns(void*                 temporary_storage,
+                              size_t&               storage_size,
+                              KeysInputIterator     keys_input,
+                              KeysOutputIterator    keys_output,
+                              ValuesInputsIterator  values_inputs,
+                              ValuesOutputsIterator values_outputs,
+                              ValueSizesIterator    value_sizes,
+                              unsigned int          num_columns,
+                              size_t                size,
+                              unsigned int          begin_bit         = 0,
+                              unsigned int          end_bit           = 8 * sizeof(Key),
+                              hipStream_t           stream            = 0,
+                              bool                  debug_synchronous = false)
+{
+    return detail::radix_sort_columns_impl<Config, false>(temporary_storage,
+                                                          storage_size,
+                                                          keys_input,
+                                                          keys_output,
+                                                          values_inputs,
+                                                          values_outputs,
+                                                          value_sizes,
+                                                          num_columns,
+                                                          size,
+                                                          begin_bit,
+                                                          end_bit,
+                                                          stream,
+                                                          debug_synchronous);
+}
+
+/// \brief Parallel descending radix sort of keys that permutes several value columns.
+///
+/// Same as \p radix_sort_columns, but sorts the keys in descending order. The sort is
+/// \b stable.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputsIterator,
+         class ValuesOutputsIterator,
+         class ValueSizesIterator,
+         class Key = typename std::iterator_traits<KeysInputIterator>::value_type>
+hipError_t radix_sort_columns_desc(void*                 temporary_storage,
+                                   size_t&               storage_size,
+                                   KeysInputIterator     keys_input,
+                                   KeysOutputIterator    keys_output,
+                                   ValuesInputsIterator  values_inputs,
+                                   ValuesOutputsIterator values_outputs,
+                                   ValueSizesIterator    value_sizes,
+                                   unsigned int          num_columns,
+                                   size_t                size,
+                                   unsigned int          begin_bit         = 0,
+                                   unsigned int          end_bit           = 8 * sizeof(Key),
+                                   hipStream_t           stream            = 0,
+                                   bool                  debug_synchronous = false)
+{
+    return detail::radix_sort_columns_impl<Config, true>(temporary_storage,
+                                                         storage_size,
+                                                         keys_input,
+                                                         keys_output,
+                                                         values_inputs,
+                                                         values_outputs,
+                                                         value_sizes,
+                                                         num_columns,
+                                                         size,
+                                                         begin_bit,
+                                                         end_bit,
+                                                         stream,
+                                                         debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_RADIX_SORT_COLUMNS_HPP_
@@ -25,6 +25,8 @@
 #include "detail/config/device_radix_sort_block_sort.hpp"
 #include "detail/device_config_helper.hpp"
 
+#include <type_traits>
+
 /// \addtogroup primitivesmodule_deviceconfigs
 /// @{
 
@@ -82,8 +84,14 @@ struct wrapped_radix_sort_onesweep_config<default_config, Key, Value>
     template<target_arch Arch>
     struct architecture_config
     {
-        static constexpr radix_sort_onesweep_config_params params
-            = default_radix_sort_onesweep_config<static_cast<unsigned int>(Arch), Key, Value>();
+        // RDNA3 has no tuned onesweep configurations yet, and the generic fallback is shaped for
+        // wave64 devices. Until they are tuned, use the configuration shaped for wave32.
+        using type = std::conditional_t<
+            Arch == target_arch::gfx1100 || Arch == target_arch::gfx1102,
+            typename radix_sort_onesweep_wave32_config_base<Key, Value>::type,
+            default_radix_sort_onesweep_config<static_cast<unsigned int>(Arch), Key, Value>>;
+
+        static constexpr radix_sort_onesweep_config_params params = type();
     };
 };
 
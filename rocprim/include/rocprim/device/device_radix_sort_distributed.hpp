@@ -0,0 +1,785 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_RADIX_SORT_DISTRIBUTED_HPP_
+#define ROCPRIM_DEVICE_DEVICE_RADIX_SORT_DISTRIBUTED_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../type_traits.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "detail/config/device_radix_sort_onesweep.hpp"
+#include "detail/device_radix_sort.hpp"
+#include "device_radix_sort.hpp"
+
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Describes the part of a distributed radix sort that is owned by a single device.
+///
+/// \tparam Key type of the sorted keys.
+/// \tparam Value type of the values associated with the keys. \p empty_type when only keys
+/// are sorted.
+template<class Key, class Value = ::rocprim::empty_type>
+struct radix_sort_distributed_shard
+{
+    /// HIP device ordinal of the device that owns the buffers of this shard.
+    int device;
+    /// Stream on \p device. All work of the shard is enqueued on this stream.
+    hipStream_t stream;
+
+    /// Keys that are stored on the device before sorting.
+    const Key* keys_input;
+    /// Values that are stored on the device before sorting. Ignored when sorting keys only.
+    const Value* values_input;
+    /// Number of keys in \p keys_input.
+    size_t size;
+
+    /// Buffer that receives the slice of the globally sorted keys owned by this device.
+    Key* keys_output;
+    /// Buffer that receives the values of the keys in \p keys_output. Ignored when sorting
+    /// keys only.
+    Value* values_output;
+    /// Number of elements that fit into \p keys_output and \p values_output.
+    size_t capacity;
+
+    /// [out] Number of keys written to \p keys_output by the sort.
+    size_t output_size;
+
+    /// Device-accessible temporary storage on \p device.
+    void* temporary_storage;
+    /// [in,out] Size of \p temporary_storage in bytes.
+    size_t storage_size;
+};
+
+/// \brief Describes a single copy of the all-to-all key exchange of a distributed radix sort.
+struct radix_sort_distributed_transfer
+{
+    /// Source buffer, allocated on \p source_device.
+    const void* source;
+    /// HIP device ordinal of the device that sends the data.
+    int source_device;
+    /// Stream of the shard that sends the data.
+    hipStream_t source_stream;
+    /// Destination buffer, allocated on \p destination_device.
+    void* destination;
+    /// HIP device ordinal of the device that receives the data.
+    int destination_device;
+    /// Stream of the shard that receives the data.
+    hipStream_t destination_stream;
+    /// Number of bytes to copy.
+    size_t bytes;
+};
+
+/// \brief Default transport of the distributed radix sort, which exchanges keys using
+/// peer-to-peer copies.
+///
+/// A transport is any type with the following member functions:
+/// * <tt>hipError_t begin()</tt>, called before the first transfer of an exchange,
+/// * <tt>hipError_t transfer(const radix_sort_distributed_transfer&)</tt>, which enqueues
+///   a single copy. The copy must be ordered after the previous work on
+///   \p source_stream and before the subsequent work on \p destination_stream,
+/// * <tt>hipError_t end()</tt>, called after the last transfer of an exchange.
+///
+/// For example, an RCCL-based transport calls \p ncclGroupStart in \p begin, issues a
+/// matching \p ncclSend on \p source_stream and \p ncclRecv on \p destination_stream in
+/// \p transfer, and calls \p ncclGroupEnd in \p end.
+///
+/// \note Peer access between the devices should be enabled with \p hipDeviceEnablePeerAccess
+/// for the copies to go directly over the device interconnect.
+struct radix_sort_peer_transport
+{
+    /// Called before the first transfer of an exchange.
+    hipError_t begin()
+    {
+        return hipSuccess;
+    }
+
+    /// Enqueues a peer-to-peer copy on the stream of the sending device.
+    hipError_t transfer(const radix_sort_distributed_transfer& t)
+    {
+        return hipMemcpyPeerAsync(t.destination,
+                                  t.destination_device,
+                                  t.source,
+                                  t.source_device,
+                                  t.bytes,
+                                  t.source_stream);
+    }
+
+    /// Called after the last transfer of an exchange.
+    hipError_t end()
+    {
+        return hipSuccess;
+    }
+};
+
+namespace detail
+{
+
+// Restores the current device of the calling host thread when leaving the scope.
+struct current_device_guard
+{
+    int  device;
+    bool valid;
+
+    current_device_guard() : device(0), valid(hipGetDevice(&device) == hipSuccess) {}
+
+    ~current_device_guard()
+    {
+        if(valid)
+        {
+            (void)hipSetDevice(device);
+        }
+    }
+};
+
+template<class Key, class Value>
+struct radix_sort_distributed_storage
+{
+    size_t*                  digit_offsets;
+    size_t*                  digit_offsets_tmp;
+    onesweep_lookback_state* lookback_states;
+    Key*                     keys_exchange;
+    Value*                   values_exchange;
+    Key*                     keys_receive;
+    Value*                   values_receive;
+    void*                    local_storage;
+    size_t                   local_storage_size;
+};
+
+template<class Config, bool Descending, class Key, class Value>
+hipError_t radix_sort_distributed_local_sort(void*              storage,
+                                             size_t&            storage_size,
+                                             Key*               keys_input,
+                                             Key*               keys_output,
+                                             Value*             values_input,
+                                             Value*             values_output,
+                                             const size_t       size,
+                                             bool&              is_result_in_output,
+                                             const unsigned int begin_bit,
+                                             const unsigned int end_bit,
+                                             const hipStream_t  stream,
+                                             const bool         debug_synchronous)
+{
+    // The receive buffer is used as the double buffer of the sort, so the storage only
+    // holds the histograms and the look-back states, and grows monotonically with the size.
+    return radix_sort_onesweep_impl<Config, Descending>(storage,
+                                                        storage_size,
+                                                        keys_input,
+                                                        keys_input,
+                                                        keys_output,
+                                                        values_input,
+                                                        values_input,
+                                                        values_output,
+                                                        size,
+                                                        is_result_in_output,
+                                                        ::rocprim::identity_decomposer{},
+                                                        begin_bit,
+                                                        end_bit,
+                                                        nullptr,
+                                                        false,
+                                                        stream,
+                                                        debug_synchronous);
+}
+
+template<class Config, bool Descending, class Key, class Value>
+hipError_t
+    radix_sort_distributed_partition(radix_sort_distributed_shard<Key, Value>& shard,
+                                     radix_sort_distributed_storage<Key, Value>& storage,
+                                     const unsigned int                         begin_bit,
+                                     const unsigned int                         end_bit,
+                                     onesweep_digit_places&                     digit_places)
+{
+    using config = wrapped_radix_sort_onesweep_config<Config, Key, Value>;
+
+    constexpr bool with_values = !std::is_same<Value, ::rocprim::empty_type>::value;
+
+    detail::target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(host_target_arch(shard.stream, target_arch));
+    const radix_sort_onesweep_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int sort_items_per_block = params.sort.block_size * params.sort.items_per_thread;
+    const unsigned int radix_size_per_place = 1u << params.radix_bits_per_place;
+    const unsigned int max_items_per_full_batch = 1u << 30;
+    const unsigned int items_per_full_batch
+        = max_items_per_full_batch - max_items_per_full_batch % sort_items_per_block;
+
+    digit_places = make_onesweep_digit_places(begin_bit,
+                                              end_bit,
+                                              params.radix_bits_per_place,
+                                              params.short_radix_bits);
+
+    const unsigned int places = digit_places.count;
+    const unsigned int bins   = radix_size_per_place * places;
+    const unsigned int items_per_batch
+        = static_cast<unsigned int>(::rocprim::min<size_t>(shard.size, items_per_full_batch));
+    const unsigned int num_lookback_states
+        = radix_size_per_place * ceiling_div(items_per_batch, sort_items_per_block);
+
+    // Only the size of the local sort's storage is needed here. The output buffer stands in for
+    // the receive buffer, which is not known yet; it just has to be a non-null pointer.
+    bool ignored;
+    ROCPRIM_RETURN_ON_ERROR(
+        radix_sort_distributed_local_sort<Config, Descending>(nullptr,
+                                                              storage.local_storage_size,
+                                                              shard.keys_output,
+                                                              shard.keys_output,
+                                                              shard.values_output,
+                                                              shard.values_output,
+                                                              shard.capacity,
+                                                              ignored,
+                                                              begin_bit,
+                                                              end_bit,
+                                                              shard.stream,
+                                                              false));
+
+    return detail::temp_storage::partition(
+        shard.temporary_storage,
+        shard.storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&storage.digit_offsets, bins),
+            detail::temp_storage::ptr_aligned_array(&storage.digit_offsets_tmp,
+                                                    radix_size_per_place),
+            detail::temp_storage::ptr_aligned_array(&storage.lookback_states, num_lookback_states),
+            detail::temp_storage::ptr_aligned_array(&storage.keys_exchange, shard.size),
+            detail::temp_storage::ptr_aligned_array(&storage.values_exchange,
+                                                    with_values ? shard.size : 0),
+            detail::temp_storage::ptr_aligned_array(&storage.keys_receive, shard.capacity),
+            detail::temp_storage::ptr_aligned_array(&storage.values_receive,
+                                                    with_values ? shard.capacity : 0),
+            detail::temp_storage::make_partition(&storage.local_storage,
+                                                 storage.local_storage_size)));
+}
+
+// Splits the digits of the most significant place into contiguous ranges, one for each shard,
+// such that each range holds approximately the same number of keys.
+inline void radix_sort_distributed_split_digits(const std::vector<size_t>& global_prefix,
+                                                const unsigned int         num_shards,
+                                                std::vector<unsigned int>& digit_begin)
+{
+    const unsigned int radix_size = static_cast<unsigned int>(global_prefix.size() - 1);
+    const size_t       total_size = global_prefix[radix_size];
+
+    digit_begin.assign(num_shards + 1, 0);
+    digit_begin[num_shards] = radix_size;
+    for(unsigned int shard = 1; shard < num_shards; ++shard)
+    {
+        const size_t target = total_size / num_shards * shard
+                              + total_size % num_shards * shard / num_shards;
+
+        unsigned int digit = digit_begin[shard - 1];
+        while(digit < radix_size && global_prefix[digit + 1] <= target)
+        {
+            ++digit;
+        }
+        // Move the boundary past the digit if that is closer to the ideal split.
+        if(digit < radix_size
+           && global_prefix[digit + 1] - target < target - global_prefix[digit])
+        {
+            ++digit;
+        }
+        digit_begin[shard] = digit;
+    }
+}
+
+template<class Config, bool Descending, class Key, class Value, class Transport>
+hipError_t radix_sort_distributed_impl(radix_sort_distributed_shard<Key, Value>* shards,
+                                       const unsigned int                        num_shards,
+                                       Transport&                                transport,
+                                       const unsigned int                        begin_bit,
+                                       const unsigned int                        end_bit,
+                                       const bool                                debug_synchronous)
+{
+    using onesweep_config = typename Config::onesweep_config;
+    using storage_type    = radix_sort_distributed_storage<Key, Value>;
+
+    constexpr bool with_values = !std::is_same<Value, ::rocprim::empty_type>::value;
+
+    if(num_shards == 0 || begin_bit >= end_bit || end_bit > 8 * sizeof(Key))
+    {
+        return hipErrorInvalidValue;
+    }
+    if(::rocprim::is_floating_point<Key>::value
+       && ((begin_bit != 0) || (end_bit != sizeof(Key) * 8)))
+    {
+        return hipErrorInvalidValue;
+    }
+
+    current_device_guard device_guard;
+    if(!device_guard.valid)
+    {
+        return hipErrorInvalidDevice;
+    }
+
+    // Partition the temporary storage of every shard. If any of the shards has no storage yet,
+    // only the required sizes are computed.
+    bool                      query_only = false;
+    std::vector<storage_type> storages(num_shards);
+    onesweep_digit_places     digit_places{};
+    for(unsigned int s = 0; s < num_shards; ++s)
+    {
+        query_only = query_only || shards[s].temporary_storage == nullptr;
+    }
+    for(unsigned int s = 0; s < num_shards; ++s)
+    {
+        radix_sort_distributed_shard<Key, Value> shard = shards[s];
+        if(query_only)
+        {
+            shard.temporary_storage = nullptr;
+        }
+
+        onesweep_digit_places shard_digit_places;
+        ROCPRIM_RETURN_ON_ERROR(hipSetDevice(shard.device));
+        ROCPRIM_RETURN_ON_ERROR(
+            radix_sort_distributed_partition<onesweep_config, Descending>(shard,
+                                                                          storages[s],
+                                                                          begin_bit,
+                                                                          end_bit,
+                                                                          shard_digit_places));
+        shards[s].storage_size = shard.storage_size;
+
+        // The keys are exchanged by their most significant digit, which must mean the same on
+        // every device.
+        if(s != 0
+           && (shard_digit_places.long_bits != digit_places.long_bits
+               || shard_digit_places.short_bits != digit_places.short_bits
+               || shard_digit_places.long_places != digit_places.long_places))
+        {
+            return hipErrorInvalidValue;
+        }
+        digit_places = shard_digit_places;
+    }
+    if(query_only)
+    {
+        return hipSuccess;
+    }
+
+    const unsigned int places     = digit_places.count;
+    const unsigned int radix_size = 1u << digit_places.long_bits;
+    const unsigned int msd_place  = places - 1;
+    const unsigned int msd_bit    = digit_places.bit(msd_place);
+
+    const ::rocprim::identity_decomposer decomposer{};
+
+    // Compute the digit offsets of every shard and group its keys by the most significant digit.
+    std::vector<size_t> local_prefix(static_cast<size_t>(num_shards) * (radix_size + 1), 0);
+    for(unsigned int s = 0; s < num_shards; ++s)
+    {
+        const radix_sort_distributed_shard<Key, Value>& shard   = shards[s];
+        const storage_type&                             storage = storages[s];
+        if(shard.size == 0)
+        {
+            continue;
+        }
+
+        ROCPRIM_RETURN_ON_ERROR(hipSetDevice(shard.device));
+        ROCPRIM_RETURN_ON_ERROR(
+            radix_sort_onesweep_global_offsets<onesweep_config, Descending>(shard.keys_input,
+                                                                            shard.values_input,
+                                                                            storage.digit_offsets,
+                                                                            nullptr,
+                                                                            nullptr,
+                                                                            nullptr,
+                                                                            false,
+                                                                            shard.size,
+                                                                            places,
+                                                                            decomposer,
+                                                                            begin_bit,
+                                                                            end_bit,
+                                                                            shard.stream,
+                                                                            debug_synchronous));
+
+        size_t* msd_offsets = storage.digit_offsets + msd_place * radix_size;
+        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(&local_prefix[s * (radix_size + 1)],
+                                               msd_offsets,
+                                               sizeof(size_t) * radix_size,
+                                               hipMemcpyDeviceToHost,
+                                               shard.stream));
+
+        onesweep_lookback_epoch lookback_epoch{};
+        ROCPRIM_RETURN_ON_ERROR(
+            radix_sort_onesweep_iteration<onesweep_config, Descending>(shard.keys_input,
+                                                                       storage.keys_exchange,
+                                                                       storage.keys_exchange,
+                                                                       shard.values_input,
+                                                                       storage.values_exchange,
+                                                                       storage.values_exchange,
+                                                                       shard.size,
+                                                                       msd_offsets,
+                                                                       storage.digit_offsets_tmp,
+                                                                       storage.lookback_states,
+                                                                       lookback_epoch,
+                                                                       nullptr,
+                                                                       nullptr,
+                                                                       true,
+                                                                       true,
+                                                                       decomposer,
+                                                                       msd_bit,
+                                                                       end_bit,
+                                                                       shard.stream,
+                                                                       debug_synchronous));
+    }
+
+    // All-reduce the histograms of the most significant digit. They are small (one counter per
+    // digit and shard), so they are reduced on the host, which needs them to plan the exchange.
+    std::vector<size_t> global_prefix(radix_size + 1, 0);
+    for(unsigned int s = 0; s < num_shards; ++s)
+    {
+        ROCPRIM_RETURN_ON_ERROR(hipSetDevice(shards[s].device));
+        ROCPRIM_RETURN_ON_ERROR(hipStreamSynchronize(shards[s].stream));
+
+        size_t* prefix     = &local_prefix[s * (radix_size + 1)];
+        prefix[radix_size] = shards[s].size;
+        for(unsigned int digit = 0; digit < radix_size; ++digit)
+        {
+            global_prefix[digit + 1] += prefix[digit + 1] - prefix[digit];
+        }
+    }
+    for(unsigned int digit = 0; digit < radix_size; ++digit)
+    {
+        global_prefix[digit + 1] += global_prefix[digit];
+    }
+
+    std::vector<unsigned int> digit_begin;
+    radix_sort_distributed_split_digits(global_prefix, num_shards, digit_begin);
+
+    for(unsigned int p = 0; p < num_shards; ++p)
+    {
+        shards[p].output_size
+            = global_prefix[digit_begin[p + 1]] - global_prefix[digit_begin[p]];
+        if(shards[p].output_size > shards[p].capacity)
+        {
+            return hipErrorInvalidValue;
+        }
+        if(debug_synchronous)
+        {
+            std::cout << "shard " << p << " digits [" << digit_begin[p] << ", "
+                      << digit_begin[p + 1] << ") keys " << shards[p].output_size << '\n';
+        }
+    }
+
+    // Exchange the keys all-to-all: shard `s` sends its keys with the most significant digits
+    // of shard `p` to `p`. The received keys are ordered by their source shard, which keeps the
+    // sort stable.
+    std::vector<size_t> receive_offsets(num_shards, 0);
+    ROCPRIM_RETURN_ON_ERROR(transport.begin());
+    for(unsigned int s = 0; s < num_shards; ++s)
+    {
+        const size_t* prefix = &local_prefix[s * (radix_size + 1)];
+        for(unsigned int p = 0; p < num_shards; ++p)
+        {
+            const size_t send_offset = prefix[digit_begin[p]];
+            const size_t count       = prefix[digit_begin[p + 1]] - send_offset;
+            if(count == 0)
+            {
+                continue;
+            }
+
+            ROCPRIM_RETURN_ON_ERROR(transport.transfer(
+                radix_sort_distributed_transfer{storages[s].keys_exchange + send_offset,
+                                                shards[s].device,
+                                                shards[s].stream,
+                                                storages[p].keys_receive + receive_offsets[p],
+                                                shards[p].device,
+                                                shards[p].stream,
+                                                sizeof(Key) * count}));
+            if(with_values)
+            {
+                ROCPRIM_RETURN_ON_ERROR(transport.transfer(
+                    radix_sort_distributed_transfer{storages[s].values_exchange + send_offset,
+                                                    shards[s].device,
+                                                    shards[s].stream,
+                                                    storages[p].values_receive
+                                                        + receive_offsets[p],
+                                                    shards[p].device,
+                                                    shards[p].stream,
+                                                    sizeof(Value) * count}));
+            }
+            receive_offsets[p] += count;
+        }
+    }
+    ROCPRIM_RETURN_ON_ERROR(transport.end());
+
+    // Make every shard wait for the data sent by the other shards.
+    std::vector<hipEvent_t> events(num_shards, nullptr);
+    hipError_t              error = hipSuccess;
+    for(unsigned int s = 0; s < num_shards && error == hipSuccess; ++s)
+    {
+        error = hipSetDevice(shards[s].device);
+        if(error == hipSuccess)
+        {
+            error = hipEventCreateWithFlags(&events[s], hipEventDisableTiming);
+        }
+        if(error == hipSuccess)
+        {
+            error = hipEventRecord(events[s], shards[s].stream);
+        }
+    }
+    for(unsigned int p = 0; p < num_shards && error == hipSuccess; ++p)
+    {
+        error = hipSetDevice(shards[p].device);
+        for(unsigned int s = 0; s < num_shards && error == hipSuccess; ++s)
+        {
+            if(shards[s].stream != shards[p].stream || shards[s].device != shards[p].device)
+            {
+                error = hipStreamWaitEvent(shards[p].stream, events[s], 0);
+            }
+        }
+    }
+    for(unsigned int s = 0; s < num_shards; ++s)
+    {
+        if(events[s] != nullptr)
+        {
+            const hipError_t destroy_error = hipEventDestroy(events[s]);
+            error = error != hipSuccess ? error : destroy_error;
+        }
+    }
+    ROCPRIM_RETURN_ON_ERROR(error);
+
+    // Finish the sort locally on every device.
+    for(unsigned int p = 0; p < num_shards; ++p)
+    {
+        radix_sort_distributed_shard<Key, Value>& shard   = shards[p];
+        storage_type&                             storage = storages[p];
+        if(shard.output_size == 0)
+        {
+            continue;
+        }
+
+        ROCPRIM_RETURN_ON_ERROR(hipSetDevice(shard.device));
+        bool is_result_in_output = true;
+        ROCPRIM_RETURN_ON_ERROR(
+            radix_sort_distributed_local_sort<onesweep_config, Descending>(
+                storage.local_storage,
+                storage.local_storage_size,
+                storage.keys_receive,
+                shard.keys_output,
+                storage.values_receive,
+                shard.values_output,
+                shard.output_size,
+                is_result_in_output,
+                begin_bit,
+                end_bit,
+                shard.stream,
+                debug_synchronous));
+
+        if(!is_result_in_output)
+        {
+            ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(shard.keys_output,
+                                                   storage.keys_receive,
+                                                   sizeof(Key) * shard.output_size,
+                                                   hipMemcpyDeviceToDevice,
+                                                   shard.stream));
+            if(with_values)
+            {
+                ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(shard.values_output,
+                                                       storage.values_receive,
+                                                       sizeof(Value) * shard.output_size,
+                                                       hipMemcpyDeviceToDevice,
+                                                       shard.stream));
+            }
+        }
+    }
+
+    return hipSuccess;
+}
+
+} // end namespace detail
+
+/// \brief Ascending radix sort of keys distributed over several devices.
+///
+/// \p radix_sort_keys_distributed sorts keys that are spread over the memory of several
+/// devices. Every shard first groups its keys by the most significant digit with a onesweep
+/// pass, the digit histograms of all shards are reduced, and the digits are split into one
+/// contiguous range per shard such that every shard receives approximately the same number
+/// of keys. The keys are then exchanged all-to-all using \p transport, and every device sorts
+/// the keys it received with the onesweep radix sort.
+///
+/// \par Overview
+/// * After the sort, shard \p i holds the slice of the sorted sequence that precedes the
+/// slice of shard <tt>i + 1</tt>. Its length is written to \p output_size of the shard.
+/// * The balance between the shards is at the granularity of the most significant digit:
+/// all keys that share this digit end up on the same device. \p capacity of every shard must
+/// be large enough for the keys assigned to it, otherwise \p hipErrorInvalidValue is returned.
+/// The sum of all input sizes is always sufficient.
+/// * Returns the required storage size of every shard in its \p storage_size if the
+/// \p temporary_storage of any shard is a null pointer. Each shard's \p temporary_storage
+/// must be allocated on its \p device.
+/// * The function synchronizes with the host once, after the digit histograms are computed,
+/// to plan the exchange. The remaining work is asynchronous with respect to the host;
+/// synchronize the streams of all shards before reading the results.
+/// * The current device of the calling thread is restored before returning.
+/// * The sort is \b stable when the shards are read in order as one input sequence.
+///
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or
+/// `radix_sort_config`. Its onesweep configuration is used for all passes.
+/// \tparam Key key type. Must be an arithmetic type.
+/// \tparam Transport [optional] type of the transport used to exchange the keys. See
+/// \p radix_sort_peer_transport for the required interface.
+///
+/// \param [in,out] shards pointer to a host array describing the part of the input and the
+/// output owned by each device.
+/// \param [in] num_shards number of elements in \p shards.
+/// \param [in] transport [optional] transport used for the all-to-all exchange. Default is
+/// a peer-to-peer transport based on \p hipMemcpyPeerAsync.
+/// \param [in] begin_bit [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the keys of two devices are sorted together.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare the input of every device (allocate device memory, create streams etc.)
+/// rocprim::radix_sort_distributed_shard<unsigned int> shards[2];
+/// // shards[i].device, .stream, .keys_input, .size, .keys_output, .capacity
+///
+/// // Get required size of the temporary storage of every shard
+/// for(auto& shard : shards) shard.temporary_storage = nullptr;
+/// rocprim::radix_sort_keys_distributed(shards, 2);
+///
+/// // allocate temporary storage
+/// for(auto& shard : shards)
+/// {
+///     hipSetDevice(shard.device);
+///     hipMalloc(&shard.temporary_storage, shard.storage_size);
+/// }
+///
+/// // perform sort
+/// rocprim::radix_sort_keys_distributed(shards, 2);
+/// // shards[0].keys_output holds the smallest shards[0].output_size keys,
+/// // shards[1].keys_output holds the remaining keys
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class Key,
+         class Transport = radix_sort_peer_transport>
+hipError_t radix_sort_keys_distributed(radix_sort_distributed_shard<Key>* shards,
+                                       unsigned int                       num_shards,
+                                       Transport                          transport = Transport(),
+                                       unsigned int                       begin_bit = 0,
+                                       unsigned int                       end_bit = 8 * sizeof(Key),
+                                       bool debug_synchronous = false)
+{
+    return detail::radix_sort_distributed_impl<Config, false>(shards,
+                                                              num_shards,
+                                                              transport,
+                                                              begin_bit,
+                                                              end_bit,
+                                                              debug_synchronous);
+}
+
+/// \brief Descending radix sort of keys distributed over several devices.
+///
+/// Same as \p radix_sort_keys_distributed, except that the keys are sorted in descending
+/// order: shard \p 0 receives the largest keys.
+template<class Config = default_config,
+         class Key,
+         class Transport = radix_sort_peer_transport>
+hipError_t radix_sort_keys_desc_distributed(radix_sort_distributed_shard<Key>* shards,
+                                            unsigned int                       num_shards,
+                                            Transport transport = Transport(),
+                                            unsigned int begin_bit = 0,
+                                            unsigned int end_bit   = 8 * sizeof(Key),
+                                            bool         debug_synchronous = false)
+{
+    return detail::radix_sort_distributed_impl<Config, true>(shards,
+                                                             num_shards,
+                                                             transport,
+                                                             begin_bit,
+                                                             end_bit,
+                                                             debug_synchronous);
+}
+
+/// \brief Ascending radix sort of (key, value) pairs distributed over several devices.
+///
+/// Same as \p radix_sort_keys_distributed, except that the values of every shard are
+/// exchanged and reordered together with their keys.
+template<class Config = default_config,
+         class Key,
+         class Value,
+         class Transport = radix_sort_peer_transport>
+hipError_t radix_sort_pairs_distributed(radix_sort_distributed_shard<Key, Value>* shards,
+                                        unsigned int                              num_shards,
+                                        Transport    transport         = Transport(),
+                                        unsigned int begin_bit         = 0,
+                                        unsigned int end_bit           = 8 * sizeof(Key),
+                                        bool         debug_synchronous = false)
+{
+    return detail::radix_sort_distributed_impl<Config, false>(shards,
+                                                              num_shards,
+                                                              transport,
+                                                              begin_bit,
+                                                              end_bit,
+                                                              debug_synchronous);
+}
+
+/// \brief Descending radix sort of (key, value) pairs distributed over several devices.
+///
+/// Same as \p radix_sort_pairs_distributed, except that the pairs are sorted in descending
+/// order of their keys: shard \p 0 receives the largest keys.
+template<class Config = default_config,
+         class Key,
+         class Value,
+         class Transport = radix_sort_peer_transport>
+hipError_t radix_sort_pairs_desc_distributed(radix_sort_distributed_shard<Key, Value>* shards,
+                                             unsigned int                              num_shards,
+                                             Transport    transport         = Transport(),
+                                             unsigned int begin_bit         = 0,
+                                             unsigned int end_bit           = 8 * sizeof(Key),
+                                             bool         debug_synchronous = false)
+{
+    return detail::radix_sort_distributed_impl<Config, true>(shards,
+                                                             num_shards,
+                                                             transport,
+                                                             begin_bit,
+                                                             end_bit,
+                                                             debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_RADIX_SORT_DISTRIBUTED_HPP_
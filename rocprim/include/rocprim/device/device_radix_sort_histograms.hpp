@@ -0,0 +1,450 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_DEVICE_RADIX_SORT_HISTOGRAMS_HPP_
+#define ROCPRIM_DEVICE_DEVICE_RADIX_SORT_HISTOGRAMS_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../thread/radix_key_codec.hpp"
+#include "../type_traits.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "detail/config/device_radix_sort_onesweep.hpp"
+#include "detail/device_radix_sort.hpp"
+#include "device_radix_sort.hpp"
+
+#include <type_traits>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Type of the counters of the digit histograms of a radix sort of \p Size keys:
+/// \p unsigned \p int when \p Size has at most 32 bits, \p size_t otherwise.
+template<class Size>
+using radix_sort_histogram_counter_t = detail::offset_type_t<Size>;
+
+/// \brief Describes the digit histograms of a radix sort, see
+/// \p get_radix_sort_histograms_layout.
+///
+/// The keys are split into \p places digit places, place \p 0 holds the least significant bits.
+/// The histograms are an array of \p bins counters: the number of keys whose digit at place
+/// \p p is \p d is stored at <tt>p * radix_size + d</tt>.
+struct radix_sort_histograms_layout
+{
+    /// Number of counters of every digit place. Places with fewer bits use only the first
+    /// <tt>2^radix_bits(p)</tt> counters, the others are zero.
+    unsigned int radix_size;
+    /// Number of digit places.
+    unsigned int places;
+    /// Number of counters of all histograms, <tt>radix_size * places</tt>.
+    unsigned int bins;
+
+    /// \brief Returns the first bit of digit place \p place.
+    ROCPRIM_HOST_DEVICE
+    unsigned int bit(const unsigned int place) const
+    {
+        return digit_places.bit(place);
+    }
+
+    /// \brief Returns the number of bits of digit place \p place.
+    ROCPRIM_HOST_DEVICE
+    unsigned int radix_bits(const unsigned int place) const
+    {
+        return digit_places.radix_bits(place);
+    }
+
+    /// \brief Returns the digit of \p key at place \p place, that is the counter of the key
+    /// in the histogram of the place.
+    ///
+    /// \tparam Descending whether the histograms are those of a descending sort, whose digits
+    /// are taken from the inverted keys.
+    /// \tparam Key key type.
+    template<bool Descending = false, class Key>
+    ROCPRIM_HOST_DEVICE
+    unsigned int digit(const Key key, const unsigned int place) const
+    {
+        using codec = ::rocprim::radix_key_codec<Key, Descending>;
+        return codec::extract_digit(codec::encode(key), bit(place), radix_bits(place));
+    }
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    detail::onesweep_digit_places digit_places;
+#endif
+};
+
+/// \brief Returns the layout of the digit histograms of a radix sort.
+///
+/// The layout depends on the configuration, the key and value types, the bit range and the
+/// device of \p stream. The histograms of a sort with other parameters are not interchangeable.
+///
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or
+/// `radix_sort_config`.
+/// \tparam Key key type.
+/// \tparam Value [optional] value type, \p empty_type when only keys are sorted.
+///
+/// \param [out] layout the layout of the histograms.
+/// \param [in] begin_bit [optional] index of the first (least significant) bit used in
+/// key comparison. Default value: \p 0.
+/// \param [in] end_bit [optional] past-the-end index (most significant) bit used in
+/// key comparison. Default value: \p <tt>8 * sizeof(Key)</tt>.
+/// \param [in] stream [optional] HIP stream object, selects the device. Default is \p 0.
+///
+/// \returns \p hipSuccess (\p 0) after success; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config, class Key, class Value = ::rocprim::empty_type>
+hipError_t get_radix_sort_histograms_layout(radix_sort_histograms_layout& layout,
+                                            unsigned int                  begin_bit = 0,
+                                            unsigned int end_bit = 8 * sizeof(Key),
+                                            hipStream_t  stream  = 0)
+{
+    using config
+        = detail::wrapped_radix_sort_onesweep_config<typename Config::onesweep_config, Key, Value>;
+
+    if(begin_bit >= end_bit || end_bit > 8 * sizeof(Key))
+    {
+        detail::record_diagnostic(diagnostic_code::invalid_bit_range, begin_bit, end_bit);
+        return hipErrorInvalidValue;
+    }
+
+    detail::target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(detail::host_target_arch(stream, target_arch));
+    const detail::radix_sort_onesweep_config_params params
+        = detail::dispatch_target_arch<config>(target_arch);
+
+    layout.digit_places = detail::make_onesweep_digit_places(begin_bit,
+                                                             end_bit,
+                                                             params.radix_bits_per_place,
+                                                             params.short_radix_bits);
+    layout.radix_size   = 1u << params.radix_bits_per_place;
+    layout.places       = layout.digit_places.count;
+    layout.bins         = layout.radix_size * layout.places;
+    return hipSuccess;
+}
+
+namespace detail
+{
+
+template<class Config, bool Descending, class Key, class Value, class Size>
+hipError_t radix_sort_histograms_impl(void*                                 temporary_storage,
+                                      size_t&                               storage_size,
+                                      const Key*                            keys_input,
+                                      Key*                                  keys_output,
+                                      const Value*                          values_input,
+                                      Value*                                values_output,
+                                      const Size                            size,
+                                      radix_sort_histogram_counter_t<Size>* digit_counts,
+                                      const bool                            digit_counts_valid,
+                                      const unsigned int                    begin_bit,
+                                      const unsigned int                    end_bit,
+                                      const hipStream_t                     stream,
+                                      const bool                            debug_synchronous)
+{
+    static_assert(std::is_integral<Size>::value, "Size must be an integral type.");
+
+    if(begin_bit >= end_bit || end_bit > 8 * sizeof(Key))
+    {
+        detail::record_diagnostic(diagnostic_code::invalid_bit_range, begin_bit, end_bit);
+        return hipErrorInvalidValue;
+    }
+    if(::rocprim::is_floating_point<Key>::value
+       && ((begin_bit != 0) || (end_bit != sizeof(Key) * 8)))
+    {
+        detail::record_diagnostic(diagnostic_code::invalid_bit_range, begin_bit, end_bit);
+        return hipErrorInvalidValue;
+    }
+
+    // The sort computes no histograms without keys
+    if(temporary_storage != nullptr && size == 0 && digit_counts != nullptr
+       && !digit_counts_valid)
+    {
+        radix_sort_histograms_layout layout;
+        ROCPRIM_RETURN_ON_ERROR(
+            get_radix_sort_histograms_layout<Config, Key, Value>(layout,
+                                                                 begin_bit,
+                                                                 end_bit,
+                                                                 stream));
+        ROCPRIM_RETURN_ON_ERROR(
+            hipMemsetAsync(digit_counts, 0, sizeof(*digit_counts) * layout.bins, stream));
+    }
+
+    // The histograms are those of the onesweep sort, which is used for all sizes
+    bool ignored;
+    return radix_sort_onesweep_impl<typename Config::onesweep_config, Descending>(
+        temporary_storage,
+        storage_size,
+        keys_input,
+        nullptr,
+        keys_output,
+        values_input,
+        nullptr,
+        values_output,
+        size,
+        ignored,
+        ::rocprim::identity_decomposer{},
+        begin_bit,
+        end_bit,
+        digit_counts,
+        digit_counts_valid,
+        stream,
+        debug_synchronous);
+}
+
+} // end namespace detail
+
+/// \brief Ascending radix sort of keys that returns or reuses the digit histograms.
+///
+/// \p radix_sort_keys_with_histograms sorts the keys like \p radix_sort_keys with the onesweep
+/// radix sort, which counts the digits of every place in one read of the keys before sorting.
+/// Iterative algorithms often sort keys whose digit histograms are known or barely change, e.g.
+/// when the same keys are sorted again in another order, or when the caller updates the
+/// histograms of the keys it modifies. If \p digit_counts_valid is \p true, the histograms in
+/// \p digit_counts are used and the keys are not read to count the digits. Otherwise the
+/// histograms are computed and written to \p digit_counts.
+///
+/// \par Overview
+/// * \p digit_counts must have \p bins counters of the layout returned by
+/// \p get_radix_sort_histograms_layout for the same \p Config, key type, bit range and device.
+/// * Valid histograms must be exact: every counter must be the number of keys of \p keys_input
+/// with this digit, otherwise the output is undefined.
+/// * \p digit_counts can be a null pointer, then the histograms are computed and not returned.
+/// * The onesweep sort is used for all sizes, even for sizes that \p radix_sort_keys sorts with
+/// a single block or with merge sort.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The input and output ranges must not overlap.
+///
+/// \par Stability
+/// \p radix_sort_keys_with_histograms is \b stable: it preserves the relative ordering of
+/// equivalent keys.
+///
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or
+/// `radix_sort_config`.
+/// \tparam Key key type. Must be an arithmetic type.
+/// \tparam Size integral type that represents the problem size.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input pointer to the first element in the range to sort.
+/// \param [out] keys_output pointer to the first element in the output range.
+/// \param [in] size number of element in the input range.
+/// \param [in,out] digit_counts device-accessible digit histograms of the keys.
+/// \param [in] digit_counts_valid whether \p digit_counts holds the histograms of the keys.
+/// \param [in] begin_bit [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the keys are sorted twice, the second sort reuses the histograms.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int   input_size;  // e.g., 2^24
+/// unsigned int * input;       // input_size elements
+/// unsigned int * output;      // input_size elements
+///
+/// rocprim::radix_sort_histograms_layout layout;
+/// rocprim::get_radix_sort_histograms_layout<rocprim::default_config, unsigned int>(layout);
+/// unsigned int * digit_counts;  // layout.bins elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::radix_sort_keys_with_histograms(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, digit_counts, false
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // sort and compute the histograms
+/// rocprim::radix_sort_keys_with_histograms(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, digit_counts, false
+/// );
+///
+/// // shuffle the keys of input ...
+///
+/// // sort the same keys again without counting the digits
+/// rocprim::radix_sort_keys_with_histograms(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, digit_counts, true
+/// );
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class Key, class Size>
+hipError_t radix_sort_keys_with_histograms(void*                                 temporary_storage,
+                                           size_t&                               storage_size,
+                                           const Key*                            keys_input,
+                                           Key*                                  keys_output,
+                                           Size                                  size,
+                                           radix_sort_histogram_counter_t<Size>* digit_counts,
+                                           bool         digit_counts_valid,
+                                           unsigned int begin_bit         = 0,
+                                           unsigned int end_bit           = 8 * sizeof(Key),
+                                           hipStream_t  stream            = 0,
+                                           bool         debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::radix_sort_histograms_impl<Config, false>(temporary_storage,
+                                                             storage_size,
+                                                             keys_input,
+                                                             keys_output,
+                                                             values,
+                                                             values,
+                                                             size,
+                                                             digit_counts,
+                                                             digit_counts_valid,
+                                                             begin_bit,
+                                                             end_bit,
+                                                             stream,
+                                                             debug_synchronous);
+}
+
+/// \brief Descending radix sort of keys that returns or reuses the digit histograms.
+///
+/// Same as \p radix_sort_keys_with_histograms, except that the keys are sorted in descending
+/// order. The histograms count the digits of the inverted keys, see
+/// \p radix_sort_histograms_layout::digit.
+template<class Config = default_config, class Key, class Size>
+hipError_t
+    radix_sort_keys_desc_with_histograms(void*                                 temporary_storage,
+                                         size_t&                               storage_size,
+                                         const Key*                            keys_input,
+                                         Key*                                  keys_output,
+                                         Size                                  size,
+                                         radix_sort_histogram_counter_t<Size>* digit_counts,
+                                         bool         digit_counts_valid,
+                                         unsigned int begin_bit         = 0,
+                                         unsigned int end_bit           = 8 * sizeof(Key),
+                                         hipStream_t  stream            = 0,
+                                         bool         debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::radix_sort_histograms_impl<Config, true>(temporary_storage,
+                                                            storage_size,
+                                                            keys_input,
+                                                            keys_output,
+                                                            values,
+                                                            values,
+                                                            size,
+                                                            digit_counts,
+                                                            digit_counts_valid,
+                                                            begin_bit,
+                                                            end_bit,
+                                                            stream,
+                                                            debug_synchronous);
+}
+
+/// \brief Ascending radix sort of key-value pairs that returns or reuses the digit histograms.
+///
+/// Same as \p radix_sort_keys_with_histograms, except that the values are moved with their
+/// keys. The layout of the histograms is that of \p get_radix_sort_histograms_layout with
+/// \p Value.
+template<class Config = default_config, class Key, class Value, class Size>
+hipError_t radix_sort_pairs_with_histograms(void*                                 temporary_storage,
+                                            size_t&                               storage_size,
+                                            const Key*                            keys_input,
+                                            Key*                                  keys_output,
+                                            const Value*                          values_input,
+                                            Value*                                values_output,
+                                            Size                                  size,
+                                            radix_sort_histogram_counter_t<Size>* digit_counts,
+                                            bool         digit_counts_valid,
+                                            unsigned int begin_bit         = 0,
+                                            unsigned int end_bit           = 8 * sizeof(Key),
+                                            hipStream_t  stream            = 0,
+                                            bool         debug_synchronous = false)
+{
+    return detail::radix_sort_histograms_impl<Config, false>(temporary_storage,
+                                                             storage_size,
+                                                             keys_input,
+                                                             keys_output,
+                                                             values_input,
+                                                             values_output,
+                                                             size,
+                                                             digit_counts,
+                                                             digit_counts_valid,
+                                                             begin_bit,
+                                                             end_bit,
+                                                             stream,
+                                                             debug_synchronous);
+}
+
+/// \brief Descending radix sort of key-value pairs that returns or reuses the digit histograms.
+///
+/// Same as \p radix_sort_pairs_with_histograms, except that the pairs are sorted in descending
+/// order of the keys.
+template<class Config = default_config, class Key, class Value, class Size>
+hipError_t
+    radix_sort_pairs_desc_with_histograms(void*                                 temporary_storage,
+                                          size_t&                               storage_size,
+                                          const Key*                            keys_input,
+                                          Key*                                  keys_output,
+                                          const Value*                          values_input,
+                                          Value*                                values_output,
+                                          Size                                  size,
+                                          radix_sort_histogram_counter_t<Size>* digit_counts,
+                                          bool         digit_counts_valid,
+                                          unsigned int begin_bit         = 0,
+                                          unsigned int end_bit           = 8 * sizeof(Key),
+                                          hipStream_t  stream            = 0,
+                                          bool         debug_synchronous = false)
+{
+    return detail::radix_sort_histograms_impl<Config, true>(temporary_storage,
+                                                            storage_size,
+                                                            keys_input,
+                                                            keys_output,
+                                                            values_input,
+                                                            values_output,
+                                                            size,
+                                                            digit_counts,
+                                                            digit_counts_valid,
+                                                            begin_bit,
+                                                            end_bit,
+                                                            stream,
+                                                            debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_RADIX_SORT_HISTOGRAMS_HPP_
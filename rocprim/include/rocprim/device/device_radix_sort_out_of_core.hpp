@@ -0,0 +1,677 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_RADIX_SORT_OUT_OF_CORE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_RADIX_SORT_OUT_OF_CORE_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../type_traits.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_radix_sort.hpp"
+#include "detail/device_radix_sort_out_of_core.hpp"
+#include "device_merge_k.hpp"
+#include "device_radix_sort.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Owns the helper stream and the events used to overlap the copies with the sorting.
+struct out_of_core_streams
+{
+    hipStream_t copy_stream = nullptr;
+    hipEvent_t  copied[2]   = {nullptr, nullptr};
+    hipEvent_t  consumed[2] = {nullptr, nullptr};
+
+    hipError_t create()
+    {
+        ROCPRIM_RETURN_ON_ERROR(hipStreamCreateWithFlags(&copy_stream, hipStreamNonBlocking));
+        for(unsigned int slot = 0; slot < 2; ++slot)
+        {
+            ROCPRIM_RETURN_ON_ERROR(
+                hipEventCreateWithFlags(&copied[slot], hipEventDisableTiming));
+            ROCPRIM_RETURN_ON_ERROR(
+                hipEventCreateWithFlags(&consumed[slot], hipEventDisableTiming));
+        }
+        return hipSuccess;
+    }
+
+    ~out_of_core_streams()
+    {
+        for(unsigned int slot = 0; slot < 2; ++slot)
+        {
+            if(copied[slot] != nullptr)
+            {
+                (void)hipEventDestroy(copied[slot]);
+            }
+            if(consumed[slot] != nullptr)
+            {
+                (void)hipEventDestroy(consumed[slot]);
+            }
+        }
+        if(copy_stream != nullptr)
+        {
+            (void)hipStreamDestroy(copy_stream);
+        }
+    }
+};
+
+// Merges `runs` sorted runs of host memory `keys_input` (run `r` is [bounds[r], bounds[r + 1]))
+// into `keys_output`. Every run streams through a window of device memory; each step moves the
+// next (at most) `window_capacity` merged keys to the host.
+template<class Key, class BinaryFunction>
+hipError_t out_of_core_merge_runs(void*              merge_storage,
+                                  size_t             merge_storage_size,
+                                  Key*               buffers,
+                                  const size_t       buffers_size,
+                                  size_t*            d_lengths,
+                                  size_t*            d_counts,
+                                  const Key*         keys_input,
+                                  Key*               keys_output,
+                                  const size_t*      bounds,
+                                  const unsigned int runs,
+                                  BinaryFunction     compare_function,
+                                  const hipStream_t  stream,
+                                  const bool         debug_synchronous)
+{
+    // The device memory holds a window for every run, the merged keys and a scratch buffer. The
+    // merge of one step is limited to 32-bit sizes.
+    const size_t window_capacity = std::min<size_t>(buffers_size / (runs + 2),
+                                                    std::numeric_limits<unsigned int>::max());
+    Key* const   windows         = buffers;
+    Key* const   merged          = buffers + runs * window_capacity;
+    Key* const   scratch         = merged + window_capacity;
+
+    std::vector<size_t> loaded(bounds, bounds + runs);
+    std::vector<size_t> lengths(runs, 0);
+    std::vector<size_t> counts(runs, 0);
+
+    const size_t size   = bounds[runs] - bounds[0];
+    size_t       output = 0;
+    while(output < size)
+    {
+        // Refill the windows.
+        for(unsigned int r = 0; r < runs; ++r)
+        {
+            const size_t count
+                = std::min(window_capacity - lengths[r], bounds[r + 1] - loaded[r]);
+            if(count != 0)
+            {
+                ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(windows + r * window_capacity + lengths[r],
+                                                       keys_input + loaded[r],
+                                                       sizeof(Key) * count,
+                                                       hipMemcpyHostToDevice,
+                                                       stream));
+                lengths[r] += count;
+                loaded[r] += count;
+            }
+        }
+
+        // Find how many keys every window contributes to the next step.
+        const size_t step_size = std::min(window_capacity, size - output);
+        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(d_lengths,
+                                               lengths.data(),
+                                               sizeof(size_t) * runs,
+                                               hipMemcpyHostToDevice,
+                                               stream));
+
+        std::chrono::steady_clock::time_point start;
+        if(debug_synchronous)
+        {
+            std::cout << "output " << output << '\n';
+            std::cout << "step_size " << step_size << '\n';
+            start = std::chrono::steady_clock::now();
+        }
+        out_of_core_corank_kernel<<<ceiling_div(runs, out_of_core_corank_block_size),
+                                    out_of_core_corank_block_size,
+                                    0,
+                                    stream>>>(windows,
+                                              window_capacity,
+                                              d_lengths,
+                                              d_counts,
+                                              runs,
+                                              step_size,
+                                              compare_function);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("out_of_core_corank_kernel", runs, start);
+
+        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(counts.data(),
+                                               d_counts,
+                                               sizeof(size_t) * runs,
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+        ROCPRIM_RETURN_ON_ERROR(hipStreamSynchronize(stream));
+
+        // Merge the contributions in one pass. The runs are in the order of the windows, which
+        // keeps the merge stable.
+        const counting_iterator<unsigned int> run_ids(0);
+        ROCPRIM_RETURN_ON_ERROR(::rocprim::merge_k(
+            merge_storage,
+            merge_storage_size,
+            windows,
+            merged,
+            step_size,
+            runs,
+            make_transform_iterator(run_ids, out_of_core_window_offset{window_capacity, nullptr}),
+            make_transform_iterator(run_ids, out_of_core_window_offset{window_capacity, d_counts}),
+            compare_function,
+            stream,
+            debug_synchronous));
+
+        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(keys_output + bounds[0] + output,
+                                               merged,
+                                               sizeof(Key) * step_size,
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+        output += step_size;
+
+        // Move the remaining keys of every window to its front.
+        for(unsigned int r = 0; r < runs; ++r)
+        {
+            Key* const   window    = windows + r * window_capacity;
+            const size_t remaining = lengths[r] - counts[r];
+            if(counts[r] != 0 && remaining != 0)
+            {
+                ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(scratch,
+                                                       window + counts[r],
+                                                       sizeof(Key) * remaining,
+                                                       hipMemcpyDeviceToDevice,
+                                                       stream));
+                ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(window,
+                                                       scratch,
+                                                       sizeof(Key) * remaining,
+                                                       hipMemcpyDeviceToDevice,
+                                                       stream));
+            }
+            lengths[r] = remaining;
+        }
+    }
+    return hipSuccess;
+}
+
+template<class Config, bool Descending, class Key, class BinaryFunction>
+hipError_t radix_sort_out_of_core_impl(void* const        temporary_storage,
+                                       size_t&            storage_size,
+                                       const Key* const   keys_input,
+                                       Key* const         keys_output,
+                                       Key* const         keys_buffer,
+                                       const size_t       size,
+                                       size_t             chunk_size,
+                                       BinaryFunction     compare_function,
+                                       const unsigned int begin_bit,
+                                       const unsigned int end_bit,
+                                       const hipStream_t  stream,
+                                       const bool         debug_synchronous)
+{
+    if(chunk_size == 0)
+    {
+        return hipErrorInvalidValue;
+    }
+    if(::rocprim::is_floating_point<Key>::value
+       && ((begin_bit != 0) || (end_bit != sizeof(Key) * 8)))
+    {
+        return hipErrorInvalidValue;
+    }
+
+    chunk_size                   = std::max<size_t>(std::min(chunk_size, size), 1);
+    const size_t chunks          = ceiling_div(size, chunk_size);
+    const size_t last_chunk_size = size - (std::max<size_t>(chunks, 1) - 1) * chunk_size;
+
+    // Two staging buffers, so the next chunk can be copied while the current one is sorted, and
+    // the double buffer of the sort. The merge reuses the same memory for its windows, which
+    // must hold at least one key each.
+    const size_t buffers_size = std::max<size_t>(3 * chunk_size, out_of_core_max_fan_in + 2);
+
+    empty_type* values = nullptr;
+    bool        ignored;
+
+    // The storage of the sort depends on the size, so it is computed for both chunk sizes. The
+    // output stands in for the double buffer, which only has to be a non-null pointer here.
+    size_t sort_storage_size = 0;
+    for(const size_t sort_size : {chunk_size, last_chunk_size})
+    {
+        size_t bytes;
+        ROCPRIM_RETURN_ON_ERROR(radix_sort_impl<Config, Descending>(nullptr,
+                                                                    bytes,
+                                                                    keys_output,
+                                                                    keys_output,
+                                                                    keys_output,
+                                                                    values,
+                                                                    values,
+                                                                    values,
+                                                                    sort_size,
+                                                                    ignored,
+                                                                    identity_decomposer{},
+                                                                    begin_bit,
+                                                                    end_bit,
+                                                                    stream,
+                                                                    false));
+        sort_storage_size = std::max(sort_storage_size, bytes);
+    }
+
+    // Two runs have the largest windows, and every merge step produces at most one window. The
+    // storage of the merge grows with both, so the largest of each bounds it.
+    const size_t merge_size
+        = std::min<size_t>(buffers_size / 4, std::numeric_limits<unsigned int>::max());
+    const auto window_offsets = make_transform_iterator(counting_iterator<unsigned int>(0),
+                                                        out_of_core_window_offset{merge_size,
+                                                                                  nullptr});
+    size_t merge_storage_size;
+    ROCPRIM_RETURN_ON_ERROR(::rocprim::merge_k(nullptr,
+                                               merge_storage_size,
+                                               keys_output,
+                                               keys_output,
+                                               merge_size,
+                                               out_of_core_max_fan_in,
+                                               window_offsets,
+                                               window_offsets,
+                                               compare_function,
+                                               stream,
+                                               false));
+
+    Key*    buffers;
+    void*   sort_storage;
+    void*   merge_storage;
+    size_t* d_lengths;
+    size_t* d_counts;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&buffers, buffers_size),
+            detail::temp_storage::make_partition(&sort_storage, sort_storage_size),
+            detail::temp_storage::make_partition(&merge_storage, merge_storage_size),
+            detail::temp_storage::ptr_aligned_array(&d_lengths, out_of_core_max_fan_in),
+            detail::temp_storage::ptr_aligned_array(&d_counts, out_of_core_max_fan_in)));
+
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    // The runs are merged in passes that alternate between the buffer and the output, so the runs
+    // are written where the last pass finishes in the output.
+    unsigned int passes = 0;
+    for(size_t runs = chunks; runs > 1; runs = ceiling_div(runs, size_t(out_of_core_max_fan_in)))
+    {
+        ++passes;
+    }
+    if(passes != 0 && keys_buffer == nullptr)
+    {
+        return hipErrorInvalidValue;
+    }
+    Key* runs_output = passes % 2 == 0 ? keys_output : keys_buffer;
+
+    if(debug_synchronous)
+    {
+        std::cout << "chunk_size " << chunk_size << '\n';
+        std::cout << "chunks " << chunks << '\n';
+        std::cout << "merge_passes " << passes << '\n';
+    }
+
+    out_of_core_streams streams;
+    ROCPRIM_RETURN_ON_ERROR(streams.create());
+
+    // Sort every chunk into a run. The chunk after the current one is copied to the device on the
+    // helper stream while the current one is sorted and copied back.
+    for(size_t chunk = 0; chunk < chunks; ++chunk)
+    {
+        const unsigned int slot     = chunk % 2;
+        const size_t       offset   = chunk * chunk_size;
+        const size_t       count    = chunk + 1 == chunks ? last_chunk_size : chunk_size;
+        Key* const         keys     = buffers + slot * chunk_size;
+        Key* const         keys_alt = buffers + 2 * chunk_size;
+
+        if(chunk >= 2)
+        {
+            ROCPRIM_RETURN_ON_ERROR(
+                hipStreamWaitEvent(streams.copy_stream, streams.consumed[slot], 0));
+        }
+        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(keys,
+                                               keys_input + offset,
+                                               sizeof(Key) * count,
+                                               hipMemcpyHostToDevice,
+                                               streams.copy_stream));
+        ROCPRIM_RETURN_ON_ERROR(hipEventRecord(streams.copied[slot], streams.copy_stream));
+        ROCPRIM_RETURN_ON_ERROR(hipStreamWaitEvent(stream, streams.copied[slot], 0));
+
+        bool is_result_in_output;
+        ROCPRIM_RETURN_ON_ERROR(radix_sort_impl<Config, Descending>(sort_storage,
+                                                                    sort_storage_size,
+                                                                    keys,
+                                                                    keys,
+                                                                    keys_alt,
+                                                                    values,
+                                                                    values,
+                                                                    values,
+                                                                    count,
+                                                                    is_result_in_output,
+                                                                    identity_decomposer{},
+                                                                    begin_bit,
+                                                                    end_bit,
+                                                                    stream,
+                                                                    debug_synchronous));
+
+        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(runs_output + offset,
+                                               is_result_in_output ? keys_alt : keys,
+                                               sizeof(Key) * count,
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+        ROCPRIM_RETURN_ON_ERROR(hipEventRecord(streams.consumed[slot], stream));
+    }
+
+    // Merge the runs, at most `out_of_core_max_fan_in` at a time.
+    std::vector<size_t> bounds(chunks + 1);
+    for(size_t run = 0; run < chunks; ++run)
+    {
+        bounds[run] = run * chunk_size;
+    }
+    bounds[chunks] = size;
+
+    Key* merge_input = runs_output;
+    for(unsigned int pass = 0; pass < passes; ++pass)
+    {
+        Key* const   merge_output = merge_input == keys_output ? keys_buffer : keys_output;
+        const size_t runs         = bounds.size() - 1;
+
+        std::vector<size_t> next_bounds;
+        for(size_t run = 0; run < runs; run += out_of_core_max_fan_in)
+        {
+            const unsigned int group_runs = static_cast<unsigned int>(
+                std::min<size_t>(out_of_core_max_fan_in, runs - run));
+            next_bounds.push_back(bounds[run]);
+
+            if(group_runs == 1)
+            {
+                ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(merge_output + bounds[run],
+                                                       merge_input + bounds[run],
+                                                       sizeof(Key) * (bounds[run + 1] - bounds[run]),
+                                                       hipMemcpyHostToHost,
+                                                       stream));
+                continue;
+            }
+
+            ROCPRIM_RETURN_ON_ERROR(out_of_core_merge_runs(merge_storage,
+                                                           merge_storage_size,
+                                                           buffers,
+                                                           buffers_size,
+                                                           d_lengths,
+                                                           d_counts,
+                                                           merge_input,
+                                                           merge_output,
+                                                           &bounds[run],
+                                                           group_runs,
+                                                           compare_function,
+                                                           stream,
+                                                           debug_synchronous));
+        }
+        next_bounds.push_back(size);
+
+        bounds      = std::move(next_bounds);
+        merge_input = merge_output;
+    }
+
+    return hipStreamSynchronize(stream);
+}
+
+template<class Config, bool Descending, class Key>
+auto radix_sort_out_of_core_dispatch(void* const        temporary_storage,
+                                     size_t&            storage_size,
+                                     const Key* const   keys_input,
+                                     Key* const         keys_output,
+                                     Key* const         keys_buffer,
+                                     const size_t       size,
+                                     const size_t       chunk_size,
+                                     const unsigned int begin_bit,
+                                     const unsigned int end_bit,
+                                     const hipStream_t  stream,
+                                     const bool         debug_synchronous)
+    -> std::enable_if_t<is_integral<Key>::value, hipError_t>
+{
+    if(begin_bit == 0 && end_bit == 8 * sizeof(Key))
+    {
+        return radix_sort_out_of_core_impl<Config, Descending>(
+            temporary_storage,
+            storage_size,
+            keys_input,
+            keys_output,
+            keys_buffer,
+            size,
+            chunk_size,
+            radix_merge_compare<Descending, false, Key>(),
+            begin_bit,
+            end_bit,
+            stream,
+            debug_synchronous);
+    }
+    return radix_sort_out_of_core_impl<Config, Descending>(
+        temporary_storage,
+        storage_size,
+        keys_input,
+        keys_output,
+        keys_buffer,
+        size,
+        chunk_size,
+        radix_merge_compare<Descending, true, Key>(begin_bit, end_bit - begin_bit),
+        begin_bit,
+        end_bit,
+        stream,
+        debug_synchronous);
+}
+
+template<class Config, bool Descending, class Key>
+auto radix_sort_out_of_core_dispatch(void* const        temporary_storage,
+                                     size_t&            storage_size,
+                                     const Key* const   keys_input,
+                                     Key* const         keys_output,
+                                     Key* const         keys_buffer,
+                                     const size_t       size,
+                                     const size_t       chunk_size,
+                                     const unsigned int begin_bit,
+                                     const unsigned int end_bit,
+                                     const hipStream_t  stream,
+                                     const bool         debug_synchronous)
+    -> std::enable_if_t<!is_integral<Key>::value, hipError_t>
+{
+    return radix_sort_out_of_core_impl<Config, Descending>(
+        temporary_storage,
+        storage_size,
+        keys_input,
+        keys_output,
+        keys_buffer,
+        size,
+        chunk_size,
+        radix_merge_compare<Descending, false, Key>(),
+        begin_bit,
+        end_bit,
+        stream,
+        debug_synchronous);
+}
+
+} // end namespace detail
+
+/// \brief Ascending radix sort of keys that do not fit into device memory.
+///
+/// \p radix_sort_keys_out_of_core sorts keys stored in host memory, streaming them through the
+/// device in chunks. Every chunk is sorted on the device with the radix sort (onesweep for large
+/// chunks) while the next chunk is copied to the device on a second stream, and written back as a
+/// sorted run. The runs are then combined by a k-way merge, which streams a window of every run
+/// through the device and merges them with \p rocprim::merge.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer. The temporary storage is about
+/// <tt>3 * chunk_size * sizeof(Key)</tt> bytes plus the temporary storage of sorting a chunk,
+/// so \p chunk_size should be chosen to fill the available device memory.
+/// * \p keys_input, \p keys_output and \p keys_buffer must be accessible by the host and the
+/// device with \p hipMemcpyAsync. Page-locked (pinned) or mapped host memory is required for the
+/// copies to overlap with the sorting.
+/// * \p keys_buffer must have at least \p size elements. It is used to hold the sorted runs, and
+/// can be a null pointer when <tt>size <= chunk_size</tt>.
+/// * Up to 16 runs are merged at once; more runs are merged in several passes over the keys.
+/// * The function blocks until the sort is complete.
+///
+/// \par Stability
+/// \p radix_sort_keys_out_of_core is \b stable: it preserves the relative ordering of equivalent keys.
+///
+/// \tparam Config [optional] Configuration of the primitive, must be `default_config` or `radix_sort_config`.
+/// \tparam Key key type. Must be an arithmetic type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input pointer to the first element in the range to sort.
+/// \param [out] keys_output pointer to the first element in the output range.
+/// \param [in] keys_buffer host-accessible buffer of at least \p size elements for the sorted runs.
+/// \param [in] size number of element in the input range.
+/// \param [in] chunk_size number of keys sorted on the device at once.
+/// \param [in] begin_bit [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example keys in pinned host memory are sorted with chunks of 2^28 keys.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate pinned host memory etc.)
+/// size_t input_size;      // e.g., 2^33
+/// unsigned long long * input;   // pinned host memory of input_size elements
+/// unsigned long long * output;  // pinned host memory of input_size elements
+/// unsigned long long * buffer;  // pinned host memory of input_size elements
+/// size_t chunk_size = size_t(1) << 28;
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::radix_sort_keys_out_of_core(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, buffer, input_size, chunk_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::radix_sort_keys_out_of_core(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, buffer, input_size, chunk_size
+/// );
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class Key>
+hipError_t radix_sort_keys_out_of_core(void*        temporary_storage,
+                                       size_t&      storage_size,
+                                       const Key*   keys_input,
+                                       Key*         keys_output,
+                                       Key*         keys_buffer,
+                                       size_t       size,
+                                       size_t       chunk_size,
+                                       unsigned int begin_bit         = 0,
+                                       unsigned int end_bit           = 8 * sizeof(Key),
+                                       hipStream_t  stream            = 0,
+                                       bool         debug_synchronous = false)
+{
+    return detail::radix_sort_out_of_core_dispatch<Config, false>(temporary_storage,
+                                                                  storage_size,
+                                                                  keys_input,
+                                                                  keys_output,
+                                                                  keys_buffer,
+                                                                  size,
+                                                                  chunk_size,
+                                                                  begin_bit,
+                                                                  end_bit,
+                                                                  stream,
+                                                                  debug_synchronous);
+}
+
+/// \brief Descending radix sort of keys that do not fit into device memory.
+///
+/// Same as \p radix_sort_keys_out_of_core, except that the keys are sorted in descending order.
+template<class Config = default_config, class Key>
+hipError_t radix_sort_keys_desc_out_of_core(void*        temporary_storage,
+                                            size_t&      storage_size,
+                                            const Key*   keys_input,
+                                            Key*         keys_output,
+                                            Key*         keys_buffer,
+                                            size_t       size,
+                                            size_t       chunk_size,
+                                            unsigned int begin_bit         = 0,
+                                            unsigned int end_bit           = 8 * sizeof(Key),
+                                            hipStream_t  stream            = 0,
+                                            bool         debug_synchronous = false)
+{
+    return detail::radix_sort_out_of_core_dispatch<Config, true>(temporary_storage,
+                                                                 storage_size,
+                                                                 keys_input,
+                                                                 keys_output,
+                                                                 keys_buffer,
+                                                                 size,
+                                                                 chunk_size,
+                                                                 begin_bit,
+                                                                 end_bit,
+                                                                 stream,
+                                                                 debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_RADIX_SORT_OUT_OF_CORE_HPP_
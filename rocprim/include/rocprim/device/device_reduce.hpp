@@ -32,10 +32,18 @@
 #include "../common.hpp"
 #include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../types/future_value.hpp"
 
 #include "detail/device_config_helper.hpp"
+#include "detail/device_future_size.hpp"
+#include "detail/device_prebuilt.hpp"
 #include "detail/device_reduce.hpp"
 #include "device_reduce_config.hpp"
+#include "device_transform.hpp"
+#include "execution_budget.hpp"
+#include "tuning_database.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -70,6 +78,40 @@ void block_reduce_kernel(InputIterator  input,
         reduce_op);
 }
 
+template<bool WithInitialValue,
+         class Config,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().reduce_config.block_size)
+void single_pass_reduce_kernel(InputIterator       input,
+                               const size_t        size,
+                               ResultType* const   block_partials,
+                               unsigned int* const retired_blocks,
+                               OutputIterator      output,
+                               InitValueType       initial_value,
+                               BinaryFunction      reduce_op)
+{
+    single_pass_reduce_kernel_impl<WithInitialValue, Config, ResultType>(input,
+                                                                         size,
+                                                                         block_partials,
+                                                                         retired_blocks,
+                                                                         output,
+                                                                         initial_value,
+                                                                         reduce_op);
+}
+
+// The value type of the tuning database entries of reduce: the accumulator type when it is not
+// the one derived from the operator, so that (input, accumulator) pairs can be tuned separately.
+template<class InputType, class BinaryFunction, class AccType>
+using reduce_tuning_value_t = typename std::conditional<
+    std::is_same<AccType, ::rocprim::invoke_result_binary_op_t<InputType, BinaryFunction>>::value,
+    empty_type,
+    AccType>::type;
+
 #define ROCPRIM_DETAIL_HIP_SYNC(name, size, start) \
     if(debug_synchronous) \
     { \
@@ -103,6 +145,8 @@ void block_reduce_kernel(InputIterator  input,
 template<
     bool WithInitialValue, // true when inital_value should be used in reduction
     class Config,
+    class TuningType = void, // type to select the default config for, the result type if void
+    class AccType = void, // type of the accumulator, derived from the operator if void
     class InputIterator,
     class OutputIterator,
     class InitValueType,
@@ -120,10 +164,14 @@ hipError_t reduce_impl(void * temporary_storage,
                        bool debug_synchronous)
 {
     using input_type = typename std::iterator_traits<InputIterator>::value_type;
-    using result_type =
-        typename ::rocprim::invoke_result_binary_op<input_type, BinaryFunction>::type;
+    using result_type = typename std::conditional<
+        std::is_void<AccType>::value,
+        typename ::rocprim::invoke_result_binary_op<input_type, BinaryFunction>::type,
+        AccType>::type;
 
-    using config = wrapped_reduce_config<Config, result_type>;
+    using tuning_type = typename std::
+        conditional<std::is_void<TuningType>::value, result_type, TuningType>::type;
+    using config = wrapped_reduce_config<Config, tuning_type>;
 
     detail::target_arch target_arch;
     ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, target_arch));
@@ -137,23 +185,34 @@ hipError_t reduce_impl(void * temporary_storage,
     const size_t number_of_blocks  = (size + items_per_block - 1) / items_per_block;
     const size_t block_prefix_size = size <= items_per_block ? 0 : number_of_blocks;
 
+    const auto size_limit
+        = budgeted_size_limit(stream, params.reduce_config.size_limit, items_per_block);
+    const auto number_of_blocks_limit = ::rocprim::max<size_t>(size_limit / items_per_block, 1);
+
+    // Inputs that need more than 16 blocks, but whose block partials fit in a single block, are
+    // reduced by a single launch: the last block to finish reduces the partials.
+    const bool single_pass = number_of_blocks > 16 && number_of_blocks <= items_per_block
+                             && number_of_blocks <= number_of_blocks_limit;
+
     // Pointer to array with block_prefixes
-    result_type* block_prefixes{};
-    void*        nested_temp_storage{};
+    result_type*  block_prefixes{};
+    unsigned int* retired_blocks{};
+    void*         nested_temp_storage{};
 
     size_t nested_temp_storage_size = 0;
-    if(number_of_blocks > 1)
+    if(number_of_blocks > 1 && !single_pass)
     {
         ROCPRIM_RETURN_ON_ERROR(
-            reduce_impl<WithInitialValue, Config>(nullptr,
-                                                  nested_temp_storage_size,
-                                                  block_prefixes, // input
-                                                  output, // output
-                                                  initial_value,
-                                                  number_of_blocks, // input size
-                                                  reduce_op,
-                                                  stream,
-                                                  debug_synchronous));
+            reduce_impl<WithInitialValue, Config, void, result_type>(
+                nullptr,
+                nested_temp_storage_size,
+                block_prefixes, // input
+                output, // output
+                initial_value,
+                number_of_blocks, // input size
+                reduce_op,
+                stream,
+                debug_synchronous));
     }
 
     const hipError_t partition_result = detail::temp_storage::partition(
@@ -161,6 +220,7 @@ hipError_t reduce_impl(void * temporary_storage,
         storage_size,
         detail::temp_storage::make_linear_partition(
             detail::temp_storage::ptr_aligned_array(&block_prefixes, block_prefix_size),
+            detail::temp_storage::ptr_aligned_array(&retired_blocks, single_pass ? 1 : 0),
             detail::temp_storage::make_partition(&nested_temp_storage,
                                                  nested_temp_storage_size,
                                                  alignof(result_type))));
@@ -172,15 +232,34 @@ hipError_t reduce_impl(void * temporary_storage,
     // Start point for time measurements
     std::chrono::steady_clock::time_point start;
 
-    const auto size_limit             = params.reduce_config.size_limit;
-    const auto number_of_blocks_limit = ::rocprim::max<size_t>(size_limit / items_per_block, 1);
-
     if(debug_synchronous)
     {
         std::cout << "block_size " << block_size << '\n';
         std::cout << "number of blocks " << number_of_blocks << '\n';
         std::cout << "number of blocks limit " << number_of_blocks_limit << '\n';
         std::cout << "items_per_block " << items_per_block << '\n';
+        std::cout << "single pass " << single_pass << '\n';
+    }
+
+    if(single_pass)
+    {
+        ROCPRIM_RETURN_ON_ERROR(
+            hipMemsetAsync(retired_blocks, 0, sizeof(*retired_blocks), stream));
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        single_pass_reduce_kernel<WithInitialValue, config>
+            <<<dim3(number_of_blocks), dim3(block_size), 0, stream>>>(input,
+                                                                      size,
+                                                                      block_prefixes,
+                                                                      retired_blocks,
+                                                                      output,
+                                                                      initial_value,
+                                                                      reduce_op);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("single_pass_reduce_kernel", size, start);
+        return hipSuccess;
     }
 
     // We increase the items per thread with a maximum of 16.
@@ -217,15 +296,16 @@ hipError_t reduce_impl(void * temporary_storage,
         }
 
         ROCPRIM_RETURN_ON_ERROR(
-            reduce_impl<WithInitialValue, Config>(nested_temp_storage,
-                                                  nested_temp_storage_size,
-                                                  block_prefixes, // input
-                                                  output, // output
-                                                  initial_value,
-                                                  number_of_blocks, // input size
-                                                  reduce_op,
-                                                  stream,
-                                                  debug_synchronous));
+            reduce_impl<WithInitialValue, Config, void, result_type>(
+                nested_temp_storage,
+                nested_temp_storage_size,
+                block_prefixes, // input
+                output, // output
+                initial_value,
+                number_of_blocks, // input size
+                reduce_op,
+                stream,
+                debug_synchronous));
 
         ROCPRIM_DETAIL_HIP_SYNC("nested_device_reduce", number_of_blocks, start);
     }
@@ -301,6 +381,9 @@ hipError_t reduce_impl(void * temporary_storage,
 /// * Does not support non-commutative reduction operators. Reduction operator should also be
 /// associative. When used with non-associative functions the results may be non-deterministic
 /// and/or vary in precision.
+/// * The partial results are combined in an order that only depends on \p size and the
+/// configuration, not on the scheduling of the kernels. Repeated calls with the same input
+/// on the same device therefore give bitwise identical results, also for floating-point types.
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * Ranges specified by \p input must have at least \p size elements, while \p output
@@ -308,7 +391,8 @@ hipError_t reduce_impl(void * temporary_storage,
 /// * By default, the input type is used for accumulation. A custom type
 /// can be specified using <tt>rocprim::transform_iterator</tt>, see the example below.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `reduce_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `reduce_config`
+/// or a `tuned_config` of these.
 /// \tparam InputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
@@ -316,6 +400,10 @@ hipError_t reduce_impl(void * temporary_storage,
 /// \tparam InitValueType - type of the initial value.
 /// \tparam BinaryFunction - type of binary function used for reduction. Default type
 /// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccType - accumulator type of the reduction. The values are loaded as the input
+/// type and converted to \p AccType, so the reduction of a narrow input, e.g. \p rocprim::half,
+/// can be computed in a wider type such as \p float. \p reduce_op must accept and return
+/// \p AccType. Default type is the result type of \p reduce_op for the input values.
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
 /// a null pointer is passed, the required allocation size (in bytes) is written to
@@ -419,26 +507,41 @@ template<class Config = default_config,
          class OutputIterator,
          class InitValueType,
          class BinaryFunction
-         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
-inline hipError_t reduce(void*               temporary_storage,
-                         size_t&             storage_size,
-                         InputIterator       input,
-                         OutputIterator      output,
-                         const InitValueType initial_value,
-                         const size_t        size,
-                         BinaryFunction      reduce_op         = BinaryFunction(),
-                         const hipStream_t   stream            = 0,
-                         bool                debug_synchronous = false)
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+         class AccType = ::rocprim::invoke_result_binary_op_t<
+             typename std::iterator_traits<InputIterator>::value_type,
+             BinaryFunction>>
+hipError_t reduce(void*               temporary_storage,
+                  size_t&             storage_size,
+                  InputIterator       input,
+                  OutputIterator      output,
+                  const InitValueType initial_value,
+                  const size_t        size,
+                  BinaryFunction      reduce_op         = BinaryFunction(),
+                  const hipStream_t   stream            = 0,
+                  bool                debug_synchronous = false)
 {
-    return detail::reduce_impl<true, Config>(temporary_storage,
-                                             storage_size,
-                                             input,
-                                             output,
-                                             initial_value,
-                                             size,
-                                             reduce_op,
-                                             stream,
-                                             debug_synchronous);
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+
+    using tuning_value_type = detail::reduce_tuning_value_t<input_type, BinaryFunction, AccType>;
+
+    return detail::dispatch_tuned_config<Config, input_type, tuning_value_type>(
+        "reduce",
+        size,
+        stream,
+        [&](auto config)
+        {
+            return detail::reduce_impl<true, typename decltype(config)::type, void, AccType>(
+                temporary_storage,
+                storage_size,
+                input,
+                output,
+                initial_value,
+                size,
+                reduce_op,
+                stream,
+                debug_synchronous);
+        });
 }
 
 /// \brief Parallel reduce primitive for device level.
@@ -450,6 +553,9 @@ inline hipError_t reduce(void*               temporary_storage,
 /// * Does not support non-commutative reduction operators. Reduction operator should also be
 /// associative. When used with non-associative functions the results may be non-deterministic
 /// and/or vary in precision.
+/// * The partial results are combined in an order that only depends on \p size and the
+/// configuration, not on the scheduling of the kernels. Repeated calls with the same input
+/// on the same device therefore give bitwise identical results, also for floating-point types.
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
 /// * Ranges specified by \p input must have at least \p size elements, while \p output
@@ -457,13 +563,18 @@ inline hipError_t reduce(void*               temporary_storage,
 /// * By default, the input type is used for accumulation. A custom type
 /// can be specified using <tt>rocprim::transform_iterator</tt>, see the example below.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `reduce_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `reduce_config`
+/// or a `tuned_config` of these.
 /// \tparam InputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
 /// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
 /// \tparam BinaryFunction - type of binary function used for reduction. Default type
 /// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccType - accumulator type of the reduction. The values are loaded as the input
+/// type and converted to \p AccType, so the reduction of a narrow input, e.g. \p rocprim::half,
+/// can be computed in a wider type such as \p float. \p reduce_op must accept and return
+/// \p AccType. Default type is the result type of \p reduce_op for the input values.
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
 /// a null pointer is passed, the required allocation size (in bytes) is written to
@@ -550,7 +661,10 @@ template<class Config = default_config,
          class InputIterator,
          class OutputIterator,
          class BinaryFunction
-         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+         class AccType = ::rocprim::invoke_result_binary_op_t<
+             typename std::iterator_traits<InputIterator>::value_type,
+             BinaryFunction>>
 inline hipError_t reduce(void*             temporary_storage,
                          size_t&           storage_size,
                          InputIterator     input,
@@ -562,17 +676,291 @@ inline hipError_t reduce(void*             temporary_storage,
 {
     using input_type = typename std::iterator_traits<InputIterator>::value_type;
 
-    return detail::reduce_impl<false, Config>(temporary_storage,
-                                              storage_size,
-                                              input,
-                                              output,
-                                              input_type(),
-                                              size,
-                                              reduce_op,
-                                              stream,
-                                              debug_synchronous);
+    using tuning_value_type = detail::reduce_tuning_value_t<input_type, BinaryFunction, AccType>;
+
+    return detail::dispatch_tuned_config<Config, input_type, tuning_value_type>(
+        "reduce",
+        size,
+        stream,
+        [&](auto config)
+        {
+            return detail::reduce_impl<false, typename decltype(config)::type, void, AccType>(
+                temporary_storage,
+                storage_size,
+                input,
+                output,
+                AccType(),
+                size,
+                reduce_op,
+                stream,
+                debug_synchronous);
+        });
 }
 
+/// \brief Parallel reduction primitive for device level, over a number of items that is only
+/// known on the device.
+///
+/// reduce function performs a device-wide reduction operation using binary \p reduce_op
+/// operator, like the overload with a host-known size. The number of items is read by the
+/// kernels, for example from the count output of a previous \p select, so a chain of algorithms
+/// runs without synchronizing with the host.
+///
+/// \par Overview
+/// * The launches cover \p max_size items. The items past the actual number of items are
+/// skipped by the reduction, so \p reduce_op needs no identity value.
+/// * The actual number of items must not be greater than \p max_size.
+/// * The temporary storage is sized for \p max_size items.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `reduce_config`
+/// or a `tuned_config` of these.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam SizeType - integral type of the number of items.
+/// \tparam SizeIterator - iterator type pointing at the number of items.
+/// \tparam BinaryFunction - type of binary function used for reduction.
+/// \tparam AccType - accumulator type of the reduction. The values are loaded as the input
+/// type and converted to \p AccType, so the reduction of a narrow input, e.g. \p rocprim::half,
+/// can be computed in a wider type such as \p float. \p reduce_op must accept and return
+/// \p AccType. Default type is the result type of \p reduce_op for the input values.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the first element in the output range. It can be
+/// same as \p input.
+/// \param [in] initial_value - initial value to start the reduction.
+/// \param [in] size - the number of items, read on the device when the kernels run.
+/// \param [in] max_size - the greatest possible number of items, used to size the launches.
+/// \param [in] reduce_op - binary operation function object that will be used for reduction.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class SizeType,
+         class SizeIterator,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+         class AccType = ::rocprim::invoke_result_binary_op_t<
+             typename std::iterator_traits<InputIterator>::value_type,
+             BinaryFunction>>
+inline hipError_t reduce(void*                                temporary_storage,
+                         size_t&                              storage_size,
+                         InputIterator                        input,
+                         OutputIterator                       output,
+                         const InitValueType                  initial_value,
+                         future_value<SizeType, SizeIterator> size,
+                         const size_t                         max_size,
+                         BinaryFunction                       reduce_op         = BinaryFunction(),
+                         const hipStream_t                    stream            = 0,
+                         bool                                 debug_synchronous = false)
+{
+    using input_type        = typename std::iterator_traits<InputIterator>::value_type;
+    using result_type       = AccType;
+    using item_type         = detail::future_size_reduce_item<result_type>;
+    using tuning_value_type = detail::reduce_tuning_value_t<input_type, BinaryFunction, AccType>;
+
+    const auto items = ::rocprim::make_transform_iterator(
+        ::rocprim::make_counting_iterator<size_t>(0),
+        detail::future_size_reduce_input_op<InputIterator, SizeType, SizeIterator, result_type>{
+            input,
+            size});
+    const item_type initial_item{static_cast<result_type>(initial_value), true};
+    const detail::future_size_reduce_op<result_type, BinaryFunction> item_op{reduce_op};
+
+    // The reduction of the items is written to temporary storage first, to unpack its value
+    const auto reduce_items = [&](void* storage, size_t& bytes, item_type* item_output)
+    {
+        return detail::dispatch_tuned_config<Config, input_type, tuning_value_type>(
+            "reduce",
+            max_size,
+            stream,
+            [&](auto config)
+            {
+                return detail::reduce_impl<true, typename decltype(config)::type, result_type>(
+                    storage,
+                    bytes,
+                    items,
+                    item_output,
+                    initial_item,
+                    max_size,
+                    item_op,
+                    stream,
+                    debug_synchronous);
+            });
+    };
+
+    size_t reduce_bytes;
+    ROCPRIM_RETURN_ON_ERROR(reduce_items(nullptr, reduce_bytes, nullptr));
+
+    void*      reduce_storage;
+    item_type* reduction;
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::make_partition(&reduce_storage, reduce_bytes),
+            detail::temp_storage::ptr_aligned_array(&reduction, 1)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(reduce_items(reduce_storage, reduce_bytes, reduction));
+    return ::rocprim::transform(reduction,
+                                output,
+                                1,
+                                detail::future_size_reduce_value_op<result_type>{},
+                                stream,
+                                debug_synchronous);
+}
+
+/// \brief Parallel transform-reduce primitive for device level.
+///
+/// transform_reduce function applies \p transform_op to every element of \p input and performs
+/// a device-wide reduction of the results using binary \p reduce_op operator. The transformed
+/// values are not stored in memory. This is equivalent to calling reduce with a
+/// <tt>rocprim::transform_iterator</tt>, except that the default configuration is selected
+/// for the input type instead of the transformed type. When \p input is a pointer, its values
+/// are read with vector loads of the input type and transformed after loading.
+///
+/// \par Overview
+/// * Does not support non-commutative reduction operators. Reduction operator should also be
+/// associative. When used with non-associative functions the results may be non-deterministic
+/// and/or vary in precision.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input must have at least \p size elements, while \p output
+/// only needs one element.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `reduce_config`
+/// or a `tuned_config` of these.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for reduction.
+/// \tparam UnaryFunction - type of unary function applied to the input values.
+/// \tparam AccType - accumulator type of the reduction, \p reduce_op must accept and return it.
+/// Default type is the result type of \p reduce_op for the transformed values.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] initial_value - initial value to start the reduction.
+/// \param [in] size - number of element in the input range.
+/// \param [in] reduce_op - binary operation function object that will be used for reduction.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// \param [in] transform_op - unary operation function object applied to every input value.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const U &a);</tt>, where \p U is the \p value_type of \p InputIterator.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the sum of squares of an array of <tt>unsigned char</tt> values is
+/// computed into an <tt>unsigned int</tt>.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;       // e.g., 4
+/// unsigned char * input;   // e.g., [1, 2, 3, 4]
+/// unsigned int * output;   // empty array of 1 element
+///
+/// auto square = [] __device__ (unsigned char x) -> unsigned int { return x * x; };
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::transform_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, 0u, input_size, rocprim::plus<unsigned int>(), square
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform transform-reduce
+/// rocprim::transform_reduce(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, 0u, input_size, rocprim::plus<unsigned int>(), square
+/// );
+/// // output: [30]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction,
+         class UnaryFunction,
+         class AccType = ::rocprim::invoke_result_binary_op_t<
+             ::rocprim::invoke_result_t<UnaryFunction,
+                                        typename std::iterator_traits<InputIterator>::value_type>,
+             BinaryFunction>>
+inline hipError_t transform_reduce(void*               temporary_storage,
+                                   size_t&             storage_size,
+                                   InputIterator       input,
+                                   OutputIterator      output,
+                                   const InitValueType initial_value,
+                                   const size_t        size,
+                                   BinaryFunction      reduce_op,
+                                   UnaryFunction       transform_op,
+                                   const hipStream_t   stream            = 0,
+                                   bool                debug_synchronous = false)
+{
+    using input_type       = typename std::iterator_traits<InputIterator>::value_type;
+    using transformed_type = ::rocprim::invoke_result_t<UnaryFunction, input_type>;
+    using tuning_value_type
+        = detail::reduce_tuning_value_t<transformed_type, BinaryFunction, AccType>;
+
+    return detail::dispatch_tuned_config<Config, input_type, tuning_value_type>(
+        "reduce",
+        size,
+        stream,
+        [&](auto config)
+        {
+            using config_type = typename decltype(config)::type;
+            return detail::reduce_impl<true, config_type, input_type, AccType>(
+                temporary_storage,
+                storage_size,
+                ::rocprim::make_transform_iterator(input, transform_op),
+                output,
+                initial_value,
+                size,
+                reduce_op,
+                stream,
+                debug_synchronous);
+        });
+}
+
+#if defined(ROCPRIM_USE_PREBUILT) && !defined(DOXYGEN_SHOULD_SKIP_THIS)
+ROCPRIM_DETAIL_PREBUILT_REDUCE(extern template)
+#endif
+
 /// @}
 // end of group devicemodule
 
@@ -24,6 +24,8 @@
 #include "config_types.hpp"
 #include "device_reduce_by_key_config.hpp"
 #include "device_transform.hpp"
+#include "execution_budget.hpp"
+#include "tuning_database.hpp"
 
 #include "detail/device_config_helper.hpp"
 #include "detail/device_reduce_by_key.hpp"
@@ -37,10 +39,12 @@
 #include "../functional.hpp"
 #include "../intrinsics/thread.hpp"
 #include "../iterator/constant_iterator.hpp"
+#include "../iterator/discard_iterator.hpp"
 
 #include <chrono>
 #include <iostream>
 #include <iterator>
+#include <type_traits>
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -119,7 +123,11 @@ ROCPRIM_KERNEL
         const std::size_t                    size,
         const std::size_t* const             global_head_count,
         const AccumulatorType* const         previous_accumulated,
-        const std::size_t                    number_of_tiles_launch)
+        const std::size_t                    number_of_tiles_launch,
+        const reduce_by_key::stream_state<reduce_by_key::value_type_t<KeyIterator>,
+                                          AccumulatorType>* const stream_carry_in,
+        reduce_by_key::stream_state<reduce_by_key::value_type_t<KeyIterator>,
+                                    AccumulatorType>* const stream_carry_out)
 {
     reduce_by_key::kernel_impl<Determinism, Config>(keys_input,
                                                     values_input,
@@ -135,11 +143,222 @@ ROCPRIM_KERNEL
                                                     size,
                                                     global_head_count,
                                                     previous_accumulated,
-                                                    number_of_tiles_launch);
+                                                    number_of_tiles_launch,
+                                                    stream_carry_in,
+                                                    stream_carry_out);
+}
+
+template<typename Config,
+         typename AccumulatorType,
+         typename KeyIterator,
+         typename ValueIterator,
+         typename KeyType,
+         typename CompareFunction,
+         typename BinaryOp>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    reduce_by_key_long_runs_kernel(
+        const KeyIterator                                       keys_input,
+        const ValueIterator                                     values_input,
+        KeyType* const                                          staged_keys,
+        AccumulatorType* const                                  staged_reductions,
+        reduce_by_key::long_runs_chunk<AccumulatorType>* const chunks,
+        const BinaryOp                                          reduce_op,
+        const CompareFunction                                   compare,
+        const std::size_t                                       tiles_per_chunk,
+        const std::size_t                                       size)
+{
+    reduce_by_key::long_runs_kernel_impl<Config>(keys_input,
+                                                 values_input,
+                                                 staged_keys,
+                                                 staged_reductions,
+                                                 chunks,
+                                                 reduce_op,
+                                                 compare,
+                                                 tiles_per_chunk,
+                                                 size);
+}
+
+template<typename AccumulatorType, typename UniqueCountIterator>
+ROCPRIM_KERNEL __launch_bounds__(reduce_by_key::long_runs_scan_block_size) void
+    reduce_by_key_long_runs_scan_kernel(
+        reduce_by_key::long_runs_chunk<AccumulatorType>* const chunks,
+        const unsigned int                                      number_of_chunks,
+        const UniqueCountIterator                               unique_count)
+{
+    reduce_by_key::long_runs_scan_kernel_impl(chunks, number_of_chunks, unique_count);
+}
+
+template<typename Config,
+         typename AccumulatorType,
+         typename KeyIterator,
+         typename ValueIterator,
+         typename KeyType,
+         typename UniqueIterator,
+         typename ReductionIterator,
+         typename CompareFunction,
+         typename BinaryOp>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    reduce_by_key_long_runs_merge_kernel(
+        const KeyIterator                                             keys_input,
+        const ValueIterator                                           values_input,
+        const KeyType* const                                          staged_keys,
+        const AccumulatorType* const                                  staged_reductions,
+        const reduce_by_key::long_runs_chunk<AccumulatorType>* const chunks,
+        const unsigned int                                            number_of_chunks,
+        const UniqueIterator                                          unique_keys,
+        const ReductionIterator                                       reductions,
+        const BinaryOp                                                reduce_op,
+        const CompareFunction                                         compare,
+        const std::size_t                                             tiles_per_chunk,
+        const std::size_t                                             size)
+{
+    reduce_by_key::long_runs_merge_kernel_impl<Config>(keys_input,
+                                                       values_input,
+                                                       staged_keys,
+                                                       staged_reductions,
+                                                       chunks,
+                                                       number_of_chunks,
+                                                       unique_keys,
+                                                       reductions,
+                                                       reduce_op,
+                                                       compare,
+                                                       tiles_per_chunk,
+                                                       size);
+}
+
+// The long-runs mode of reduce_by_key_config. The input is split into at most
+// long_runs_max_chunks chunks of whole tiles, one block each. A block reduces its chunk tile by
+// tile with a running carry instead of a look-back, and stages the few segments it finds. A
+// scan of the segment counts of the chunks gives their output offsets, then the staged segments
+// are copied to the output and the segments that cross chunks are finished. Chunks with more
+// segments than can be staged are reduced again straight into the output.
+//
+// The chunks only depend on the size, so the results are deterministic.
+template<class Config,
+         class AccumulatorType,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class BinaryFunction,
+         class KeyCompareFunction>
+hipError_t reduce_by_key_long_runs_impl(void*                              temporary_storage,
+                                        size_t&                            storage_size,
+                                        KeysInputIterator                  keys_input,
+                                        ValuesInputIterator                values_input,
+                                        const size_t                       size,
+                                        UniqueOutputIterator               unique_output,
+                                        AggregatesOutputIterator           aggregates_output,
+                                        UniqueCountOutputIterator          unique_count_output,
+                                        BinaryFunction                     reduce_op,
+                                        KeyCompareFunction                 key_compare_op,
+                                        const hipStream_t                  stream,
+                                        const bool                         debug_synchronous,
+                                        const reduce_by_key_config_params& params)
+{
+    using key_type         = reduce_by_key::value_type_t<KeysInputIterator>;
+    using accumulator_type = AccumulatorType;
+    using chunk_type       = reduce_by_key::long_runs_chunk<accumulator_type>;
+
+    const unsigned int block_size     = params.kernel_config.block_size;
+    const unsigned int items_per_tile = block_size * params.kernel_config.items_per_thread;
+
+    const std::size_t number_of_tiles = ceiling_div(size, items_per_tile);
+    const std::size_t tiles_per_chunk = ::rocprim::max<std::size_t>(
+        1,
+        ceiling_div(number_of_tiles, reduce_by_key::long_runs_max_chunks));
+    const unsigned int number_of_chunks
+        = static_cast<unsigned int>(ceiling_div(number_of_tiles, tiles_per_chunk));
+
+    chunk_type*       d_chunks            = nullptr;
+    key_type*         d_staged_keys       = nullptr;
+    accumulator_type* d_staged_reductions = nullptr;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&d_chunks, number_of_chunks),
+            detail::temp_storage::ptr_aligned_array(
+                &d_staged_keys,
+                std::size_t{number_of_chunks} * reduce_by_key::long_runs_staged_heads),
+            detail::temp_storage::ptr_aligned_array(
+                &d_staged_reductions,
+                std::size_t{number_of_chunks} * reduce_by_key::long_runs_staged_heads)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        // Fill out unique_count_output with zero
+        return rocprim::transform(rocprim::constant_iterator<std::size_t>(0),
+                                  unique_count_output,
+                                  1,
+                                  rocprim::identity<std::size_t>{},
+                                  stream,
+                                  debug_synchronous);
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        std::cout << "size:             " << size << '\n';
+        std::cout << "block_size:       " << block_size << '\n';
+        std::cout << "number_of_tiles:  " << number_of_tiles << '\n';
+        std::cout << "tiles_per_chunk:  " << tiles_per_chunk << '\n';
+        std::cout << "number_of_chunks: " << number_of_chunks << '\n';
+        start = std::chrono::steady_clock::now();
+    }
+
+    reduce_by_key_long_runs_kernel<Config>
+        <<<dim3(number_of_chunks), dim3(block_size), 0, stream>>>(keys_input,
+                                                                  values_input,
+                                                                  d_staged_keys,
+                                                                  d_staged_reductions,
+                                                                  d_chunks,
+                                                                  reduce_op,
+                                                                  key_compare_op,
+                                                                  tiles_per_chunk,
+                                                                  size);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("reduce_by_key_long_runs_kernel", size, start);
+
+    reduce_by_key_long_runs_scan_kernel<<<dim3(1),
+                                          dim3(reduce_by_key::long_runs_scan_block_size),
+                                          0,
+                                          stream>>>(d_chunks,
+                                                    number_of_chunks,
+                                                    unique_count_output);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("reduce_by_key_long_runs_scan_kernel",
+                                                number_of_chunks,
+                                                start);
+
+    reduce_by_key_long_runs_merge_kernel<Config>
+        <<<dim3(number_of_chunks), dim3(block_size), 0, stream>>>(keys_input,
+                                                                  values_input,
+                                                                  d_staged_keys,
+                                                                  d_staged_reductions,
+                                                                  d_chunks,
+                                                                  number_of_chunks,
+                                                                  unique_output,
+                                                                  aggregates_output,
+                                                                  reduce_op,
+                                                                  key_compare_op,
+                                                                  tiles_per_chunk,
+                                                                  size);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("reduce_by_key_long_runs_merge_kernel",
+                                                number_of_chunks,
+                                                start);
+
+    return hipSuccess;
 }
 
 template<lookback_scan_determinism Determinism,
          class Config,
+         class AccumulatorType,
          class KeysInputIterator,
          class ValuesInputIterator,
          class UniqueOutputIterator,
@@ -147,21 +366,26 @@ template<lookback_scan_determinism Determinism,
          class UniqueCountOutputIterator,
          class BinaryFunction,
          class KeyCompareFunction>
-hipError_t reduce_by_key_impl(void*                     temporary_storage,
-                              size_t&                   storage_size,
-                              KeysInputIterator         keys_input,
-                              ValuesInputIterator       values_input,
-                              const size_t              size,
-                              UniqueOutputIterator      unique_output,
-                              AggregatesOutputIterator  aggregates_output,
-                              UniqueCountOutputIterator unique_count_output,
-                              BinaryFunction            reduce_op,
-                              KeyCompareFunction        key_compare_op,
-                              const hipStream_t         stream,
-                              const bool                debug_synchronous)
+hipError_t reduce_by_key_config_impl(
+    void*                     temporary_storage,
+    size_t&                   storage_size,
+    KeysInputIterator         keys_input,
+    ValuesInputIterator       values_input,
+    const size_t              size,
+    UniqueOutputIterator      unique_output,
+    AggregatesOutputIterator  aggregates_output,
+    UniqueCountOutputIterator unique_count_output,
+    BinaryFunction            reduce_op,
+    KeyCompareFunction        key_compare_op,
+    const hipStream_t         stream,
+    const bool                debug_synchronous,
+    reduce_by_key::stream_state<reduce_by_key::value_type_t<KeysInputIterator>, AccumulatorType>*
+        stream_state
+    = nullptr)
 {
-    using key_type         = reduce_by_key::value_type_t<KeysInputIterator>;
-    using accumulator_type = reduce_by_key::accumulator_type_t<ValuesInputIterator, BinaryFunction>;
+    using key_type          = reduce_by_key::value_type_t<KeysInputIterator>;
+    using accumulator_type  = AccumulatorType;
+    using stream_state_type = reduce_by_key::stream_state<key_type, accumulator_type>;
 
     using config = wrapped_reduce_by_key_config<Config, key_type, accumulator_type, BinaryFunction>;
 
@@ -173,10 +397,25 @@ hipError_t reduce_by_key_impl(void*                     temporary_storage,
     }
     const reduce_by_key_config_params params = dispatch_target_arch<config>(target_arch);
 
-    using scan_state_type
-        = reduce_by_key::lookback_scan_state_t<accumulator_type, /*UseSleep=*/false>;
-    using scan_state_with_sleep_type
-        = reduce_by_key::lookback_scan_state_t<accumulator_type, /*UseSleep=*/true>;
+    // The long-runs mode does not carry the open run across chunks.
+    if(params.long_runs && stream_state == nullptr)
+    {
+        return reduce_by_key_long_runs_impl<config, accumulator_type>(temporary_storage,
+                                                                      storage_size,
+                                                                      keys_input,
+                                                                      values_input,
+                                                                      size,
+                                                                      unique_output,
+                                                                      aggregates_output,
+                                                                      unique_count_output,
+                                                                      reduce_op,
+                                                                      key_compare_op,
+                                                                      stream,
+                                                                      debug_synchronous,
+                                                                      params);
+    }
+
+    using scan_state_type = reduce_by_key::lookback_scan_state_t<accumulator_type>;
 
     using ordered_tile_id_type = detail::ordered_block_id<unsigned int>;
 
@@ -185,7 +424,8 @@ hipError_t reduce_by_key_impl(void*                     temporary_storage,
     const unsigned int items_per_tile  = block_size * params.kernel_config.items_per_thread;
     const unsigned int items_per_block = items_per_tile * tiles_per_block;
 
-    const size_t size_limit = params.kernel_config.size_limit;
+    const size_t size_limit
+        = budgeted_size_limit(stream, params.kernel_config.size_limit, items_per_block);
     const size_t aligned_size_limit
         = ::rocprim::max<size_t>(size_limit - size_limit % items_per_block, items_per_block);
 
@@ -203,6 +443,9 @@ hipError_t reduce_by_key_impl(void*                     temporary_storage,
     std::size_t* d_global_head_count = nullptr;
     // The running accumulation across the launch boundary.
     accumulator_type* d_previous_accumulated = nullptr;
+    // The open run of the preceding chunks, copied so that the last tile can overwrite
+    // stream_state.
+    stream_state_type* d_stream_carry_in = nullptr;
 
     detail::temp_storage::layout layout{};
     result = scan_state_type::get_temp_storage_layout(number_of_tiles, stream, layout);
@@ -215,53 +458,30 @@ hipError_t reduce_by_key_impl(void*                     temporary_storage,
         temporary_storage,
         storage_size,
         detail::temp_storage::make_linear_partition(
-            // This is valid even with scan_state_with_sleep_type
             detail::temp_storage::make_partition(&scan_state_storage, layout),
             detail::temp_storage::make_partition(&ordered_bid_storage,
                                                  ordered_tile_id_type::get_temp_storage_layout()),
             detail::temp_storage::ptr_aligned_array(&d_global_head_count, use_limited_size ? 1 : 0),
             detail::temp_storage::ptr_aligned_array(&d_previous_accumulated,
-                                                    use_limited_size ? 1 : 0)));
+                                                    use_limited_size ? 1 : 0),
+            detail::temp_storage::ptr_aligned_array(&d_stream_carry_in,
+                                                    stream_state != nullptr ? 1 : 0)));
     if(result != hipSuccess || temporary_storage == nullptr)
     {
         return result;
     }
 
-    bool use_sleep;
-    result = detail::is_sleep_scan_state_used(stream, use_sleep);
-    if(result != hipSuccess)
-    {
-        return result;
-    }
     scan_state_type scan_state{};
-    result = scan_state_type::create(scan_state, scan_state_storage, number_of_tiles, stream);
-    if(result != hipSuccess)
-    {
-        return result;
-    }
-    scan_state_with_sleep_type scan_state_with_sleep{};
-    result = scan_state_with_sleep_type::create(scan_state_with_sleep,
-                                                scan_state_storage,
-                                                number_of_tiles,
-                                                stream);
+    result = scan_state_type::create(scan_state,
+                                     scan_state_storage,
+                                     number_of_tiles,
+                                     stream,
+                                     params.backoff);
     if(result != hipSuccess)
     {
         return result;
     }
 
-    auto with_scan_state
-        = [use_sleep, scan_state, scan_state_with_sleep](auto&& func) mutable -> decltype(auto)
-    {
-        if(use_sleep)
-        {
-            return func(scan_state_with_sleep);
-        }
-        else
-        {
-            return func(scan_state);
-        }
-    };
-
     auto ordered_bid = ordered_tile_id_type::create(ordered_bid_storage);
 
     if(size == 0)
@@ -275,6 +495,15 @@ hipError_t reduce_by_key_impl(void*                     temporary_storage,
                                   debug_synchronous);
     }
 
+    if(stream_state != nullptr)
+    {
+        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(d_stream_carry_in,
+                                               stream_state,
+                                               sizeof(*stream_state),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+    }
+
     // Total number of tiles in all launches
     const std::size_t total_number_of_tiles = ceiling_div(size, items_per_tile);
     const std::size_t number_of_launch      = ceiling_div(size, limited_size);
@@ -311,53 +540,102 @@ hipError_t reduce_by_key_impl(void*                     temporary_storage,
             start = std::chrono::steady_clock::now();
         }
 
-        with_scan_state(
-            [&](const auto scan_state)
-            {
-                const unsigned int block_size = ROCPRIM_DEFAULT_MAX_BLOCK_SIZE;
-                const std::size_t  grid_size
-                    = detail::ceiling_div(number_of_tiles_launch, block_size);
-
-                reduce_by_key_init_kernel<<<dim3(grid_size), dim3(block_size), 0, stream>>>(
-                    scan_state,
-                    number_of_tiles_launch,
-                    ordered_bid,
-                    i == 0,
-                    number_of_tiles - 1,
-                    d_global_head_count,
-                    d_previous_accumulated);
-            });
+        const unsigned int init_block_size = ROCPRIM_DEFAULT_MAX_BLOCK_SIZE;
+        const std::size_t  init_grid_size
+            = detail::ceiling_div(number_of_tiles_launch, init_block_size);
+
+        reduce_by_key_init_kernel<<<dim3(init_grid_size), dim3(init_block_size), 0, stream>>>(
+            scan_state,
+            number_of_tiles_launch,
+            ordered_bid,
+            i == 0,
+            number_of_tiles - 1,
+            d_global_head_count,
+            d_previous_accumulated);
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("reduce_by_key_init_kernel",
                                                     number_of_tiles_launch,
                                                     start);
 
-        with_scan_state(
-            [&](const auto scan_state)
-            {
-                reduce_by_key_kernel<Determinism, config>
-                    <<<dim3(number_of_blocks_launch), dim3(block_size), 0, stream>>>(
-                        keys_input + offset,
-                        values_input + offset,
-                        unique_output,
-                        aggregates_output,
-                        unique_count_output,
-                        reduce_op,
-                        key_compare_op,
-                        scan_state,
-                        ordered_bid,
-                        i * number_of_tiles,
-                        total_number_of_tiles,
-                        size,
-                        i > 0 ? d_global_head_count : nullptr,
-                        i > 0 ? d_previous_accumulated : nullptr,
-                        number_of_tiles_launch);
-            });
+        reduce_by_key_kernel<Determinism, config>
+            <<<dim3(number_of_blocks_launch), dim3(block_size), 0, stream>>>(
+                keys_input + offset,
+                values_input + offset,
+                unique_output,
+                aggregates_output,
+                unique_count_output,
+                reduce_op,
+                key_compare_op,
+                scan_state,
+                ordered_bid,
+                i * number_of_tiles,
+                total_number_of_tiles,
+                size,
+                i > 0 ? d_global_head_count : nullptr,
+                i > 0 ? d_previous_accumulated : nullptr,
+                number_of_tiles_launch,
+                d_stream_carry_in,
+                i + 1 == number_of_launch ? stream_state : nullptr);
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("reduce_by_key_kernel", current_size, start);
     }
 
     return hipSuccess;
 }
 
+template<lookback_scan_determinism Determinism,
+         class Config,
+         class AccumulatorType,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class BinaryFunction,
+         class KeyCompareFunction>
+hipError_t reduce_by_key_impl(
+    void*                     temporary_storage,
+    size_t&                   storage_size,
+    KeysInputIterator         keys_input,
+    ValuesInputIterator       values_input,
+    const size_t              size,
+    UniqueOutputIterator      unique_output,
+    AggregatesOutputIterator  aggregates_output,
+    UniqueCountOutputIterator unique_count_output,
+    BinaryFunction            reduce_op,
+    KeyCompareFunction        key_compare_op,
+    const hipStream_t         stream,
+    const bool                debug_synchronous,
+    reduce_by_key::stream_state<reduce_by_key::value_type_t<KeysInputIterator>, AccumulatorType>*
+        stream_state
+    = nullptr)
+{
+    using key_type         = reduce_by_key::value_type_t<KeysInputIterator>;
+    using accumulator_type = AccumulatorType;
+
+    return dispatch_tuned_config<Config, key_type, accumulator_type>(
+        "reduce_by_key",
+        size,
+        stream,
+        [&](auto config)
+        {
+            return reduce_by_key_config_impl<Determinism,
+                                             typename decltype(config)::type,
+                                             accumulator_type>(
+                temporary_storage,
+                storage_size,
+                keys_input,
+                values_input,
+                size,
+                unique_output,
+                aggregates_output,
+                unique_count_output,
+                reduce_op,
+                key_compare_op,
+                stream,
+                debug_synchronous,
+                stream_state);
+        });
+}
+
 
 
 } // namespace detail
@@ -385,7 +663,8 @@ hipError_t reduce_by_key_impl(void*                     temporary_storage,
 /// * Ranges specified by \p unique_output and \p aggregates_output must have at least
 /// <tt>*unique_count_output</tt> (i.e. the number of unique keys) elements.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `reduce_by_key_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `reduce_by_key_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
@@ -400,6 +679,11 @@ hipError_t reduce_by_key_impl(void*                     temporary_storage,
 /// is \p rocprim::plus<T>, where \p T is a \p value_type of \p ValuesInputIterator.
 /// \tparam KeyCompareFunction - type of binary function used to determine keys equality. Default type
 /// is \p rocprim::equal_to<T>, where \p T is a \p value_type of \p KeysInputIterator.
+/// \tparam AccType - accumulator type of the reductions, also used in the look-back state and
+/// the partial reductions in temporary storage. The values are loaded as their input type and
+/// converted to \p AccType, so e.g. \p rocprim::half values can be reduced in \p float.
+/// \p reduce_op must accept and return \p AccType. Default type is the result type of
+/// \p reduce_op for the input values.
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
 /// a null pointer is passed, the required allocation size (in bytes) is written to
@@ -478,7 +762,10 @@ template<class Config = default_config,
          class BinaryFunction
          = ::rocprim::plus<typename std::iterator_traits<ValuesInputIterator>::value_type>,
          class KeyCompareFunction
-         = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>>
+         = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>,
+         class AccType = ::rocprim::invoke_result_binary_op_t<
+             typename std::iterator_traits<ValuesInputIterator>::value_type,
+             BinaryFunction>>
 inline hipError_t reduce_by_key(void*                     temporary_storage,
                                 size_t&                   storage_size,
                                 KeysInputIterator         keys_input,
@@ -493,18 +780,19 @@ inline hipError_t reduce_by_key(void*                     temporary_storage,
                                 bool                      debug_synchronous = false)
 {
     return detail::reduce_by_key_impl<detail::lookback_scan_determinism::default_determinism,
-                                      Config>(temporary_storage,
-                                              storage_size,
-                                              keys_input,
-                                              values_input,
-                                              size,
-                                              unique_output,
-                                              aggregates_output,
-                                              unique_count_output,
-                                              reduce_op,
-                                              key_compare_op,
-                                              stream,
-                                              debug_synchronous);
+                                      Config,
+                                      AccType>(temporary_storage,
+                                               storage_size,
+                                               keys_input,
+                                               values_input,
+                                               size,
+                                               unique_output,
+                                               aggregates_output,
+                                               unique_count_output,
+                                               reduce_op,
+                                               key_compare_op,
+                                               stream,
+                                               debug_synchronous);
 }
 
 /// \brief Bitwise-reproducible parallel reduce-by-key primitive for device level.
@@ -523,7 +811,10 @@ template<class Config = default_config,
          class BinaryFunction
          = ::rocprim::plus<typename std::iterator_traits<ValuesInputIterator>::value_type>,
          class KeyCompareFunction
-         = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>>
+         = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>,
+         class AccType = ::rocprim::invoke_result_binary_op_t<
+             typename std::iterator_traits<ValuesInputIterator>::value_type,
+             BinaryFunction>>
 inline hipError_t deterministic_reduce_by_key(void*                     temporary_storage,
                                               size_t&                   storage_size,
                                               KeysInputIterator         keys_input,
@@ -538,7 +829,9 @@ inline hipError_t deterministic_reduce_by_key(void*                     temporar
                                               hipStream_t stream            = 0,
                                               bool        debug_synchronous = false)
 {
-    return detail::reduce_by_key_impl<detail::lookback_scan_determinism::deterministic, Config>(
+    return detail::reduce_by_key_impl<detail::lookback_scan_determinism::deterministic,
+                                      Config,
+                                      AccType>(
         temporary_storage,
         storage_size,
         keys_input,
@@ -553,6 +846,292 @@ inline hipError_t deterministic_reduce_by_key(void*                     temporar
         debug_synchronous);
 }
 
+/// \brief The open run of a reduce-by-key over a stream of chunks, see
+/// \p streaming_reduce_by_key.
+///
+/// It lives in device memory and must be zeroed, e.g. with \p hipMemsetAsync, before the first
+/// chunk. \p key is the last key and \p aggregate the reduction of the run that the last
+/// reduced chunk ends with, \p has_open_run is nonzero once a chunk has been reduced.
+///
+/// \tparam Key - type of the keys.
+/// \tparam AccType - accumulator type of the reductions.
+template<class Key, class AccType>
+using reduce_by_key_stream_state = detail::reduce_by_key::stream_state<Key, AccType>;
+
+/// \brief Parallel reduce-by-key of one chunk of a stream for device level.
+///
+/// \p streaming_reduce_by_key reduces the chunks of an input that arrives piece by piece as one
+/// input. The run of equal keys that a chunk ends with may continue in the next chunk, so it is
+/// not written but kept open in \p state. The next chunk reads \p state when it is reduced, like
+/// a \p rocprim::future_value, and continues the open run with its first keys or writes it as
+/// its first group. The chunks can be enqueued back to back on \p stream without synchronizing
+/// the host and without additional passes over the outputs.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p state must be zeroed before the first chunk.
+/// * The outputs of a chunk are the groups that end in the chunk: the open run of the preceding
+/// chunks if it does not continue, and the groups of the chunk except the last one.
+/// \p unique_count_output is their number.
+/// * \p unique_output and \p aggregates_output must have room for \p size + 1 groups. After
+/// the groups that end in the chunk, \p unique_output may hold the first key of the open run.
+/// * After the last chunk the last group is the open run in \p state. Its key is the last key of
+/// the run, which is also the key written for a group that continues across chunks.
+/// * Chunks with the same \p state must be reduced in order, e.g. on the same \p stream.
+/// * An empty chunk leaves \p state unchanged.
+/// * The long-runs mode of \p reduce_by_key_config is not used.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `reduce_by_key_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam UniqueOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam AggregatesOutputIterator - random-access iterator type of the output range. Must meet
+/// the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam UniqueCountOutputIterator - random-access iterator type of the output range. Must
+/// meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam Key - type of the keys, must be the value type of \p KeysInputIterator.
+/// \tparam AccType - accumulator type of the reductions, deduced from \p state.
+/// \tparam BinaryFunction - type of binary function used for reduction. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p ValuesInputIterator.
+/// \tparam KeyCompareFunction - type of binary function used to determine keys equality.
+/// Default type is \p rocprim::equal_to<T>, where \p T is a \p value_type of
+/// \p KeysInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - iterator to the first key of the chunk.
+/// \param [in] values_input - iterator to the first value of the chunk.
+/// \param [in] size - number of elements in the chunk.
+/// \param [out] unique_output - iterator to the first element in the output range of unique
+/// keys of the chunk.
+/// \param [out] aggregates_output - iterator to the first element in the output range of
+/// reductions of the chunk.
+/// \param [out] unique_count_output - iterator to the number of groups that end in the chunk.
+/// \param [in,out] state - pointer to the open run of the stream in device memory.
+/// \param [in] reduce_op - binary operation function object that will be used for reduction.
+/// Default is BinaryFunction().
+/// \param [in] key_compare_op - binary operation function object that will be used to
+/// determine key equality. Default is KeyCompareFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a stream of two chunks is reduced.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// int * keys0;       // e.g., [1, 1, 2, 3]
+/// int * values0;     // e.g., [1, 2, 3, 4]
+/// int * keys1;       // e.g., [3, 3, 5]
+/// int * values1;     // e.g., [5, 6, 7]
+/// int * unique0;     // empty array of 5 elements
+/// int * aggregates0; // empty array of 5 elements
+/// int * unique1;     // empty array of 4 elements
+/// int * aggregates1; // empty array of 4 elements
+/// size_t * count0;   // empty array of 1 element
+/// size_t * count1;   // empty array of 1 element
+/// rocprim::reduce_by_key_stream_state<int, int> * state; // device memory
+/// hipMemset(state, 0, sizeof(*state));
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::streaming_reduce_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys0, values0, 4, unique0, aggregates0, count0, state
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // reduce the chunks
+/// rocprim::streaming_reduce_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys0, values0, 4, unique0, aggregates0, count0, state
+/// );
+/// rocprim::streaming_reduce_by_key(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys1, values1, 3, unique1, aggregates1, count1, state
+/// );
+/// // unique0: [1, 2], aggregates0: [3, 3], count0: [2]
+/// // unique1: [3],    aggregates1: [15],   count1: [1]
+/// // state: key 5, aggregate 7
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class UniqueOutputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class Key,
+         class AccType,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<ValuesInputIterator>::value_type>,
+         class KeyCompareFunction
+         = ::rocprim::equal_to<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t
+    streaming_reduce_by_key(void*                                     temporary_storage,
+                            size_t&                                   storage_size,
+                            KeysInputIterator                         keys_input,
+                            ValuesInputIterator                       values_input,
+                            const size_t                              size,
+                            UniqueOutputIterator                      unique_output,
+                            AggregatesOutputIterator                  aggregates_output,
+                            UniqueCountOutputIterator                 unique_count_output,
+                            reduce_by_key_stream_state<Key, AccType>* state,
+                            BinaryFunction     reduce_op         = BinaryFunction(),
+                            KeyCompareFunction key_compare_op    = KeyCompareFunction(),
+                            hipStream_t        stream            = 0,
+                            bool               debug_synchronous = false)
+{
+    static_assert(
+        std::is_same<Key, typename std::iterator_traits<KeysInputIterator>::value_type>::value,
+        "The key type of the stream state must be the value type of KeysInputIterator");
+    return detail::reduce_by_key_impl<detail::lookback_scan_determinism::default_determinism,
+                                      Config,
+                                      AccType>(temporary_storage,
+                                               storage_size,
+                                               keys_input,
+                                               values_input,
+                                               size,
+                                               unique_output,
+                                               aggregates_output,
+                                               unique_count_output,
+                                               reduce_op,
+                                               key_compare_op,
+                                               stream,
+                                               debug_synchronous,
+                                               state);
+}
+
+/// \brief Parallel reduce primitive over segments given by head flags.
+///
+/// \p reduce_by_head_flags is \p reduce_by_key whose keys are replaced by head flags: every item
+/// whose flag is set starts a new segment, the flag of the first item is ignored. Kernels load
+/// the flags instead of the keys, so with wide keys and flags known in advance (for example from
+/// \p run_length_encode) much less data is read. Packed flags with one bit per item can be read
+/// through <tt>rocprim::packed_bits_iterator<1></tt>. There are no unique keys to write, only
+/// the aggregates and the number of segments are written.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `reduce_by_key_config`.
+/// \tparam HeadFlagsInputIterator - random-access iterator type of the input range of head flags.
+/// Its value type must be convertible to \p bool. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam AggregatesOutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam UniqueCountOutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for reduction. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p ValuesInputIterator.
+/// \tparam AccType - accumulator type used to propagate the reduced values. Default type
+/// is the result of invoking \p BinaryFunction with the value type of \p ValuesInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] head_flags_input - iterator to the first element in the range of head flags.
+/// \param [in] values_input - iterator to the first element in the range of values.
+/// \param [in] size - number of element in the input range.
+/// \param [out] aggregates_output - iterator to the first element in the output range of
+/// the reductions of the segments.
+/// \param [out] unique_count_output - iterator to the total number of segments.
+/// \param [in] reduce_op - binary operation function object that will be used for reduction.
+/// Default is BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;          // e.g., 8
+/// unsigned char * flags;      // e.g., [1, 0, 0, 1, 0, 1, 0, 1]
+/// int * values_input;         // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// int * aggregates_output;    // empty array of at least 4 elements
+/// int * unique_count_output;  // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::reduce_by_head_flags(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     flags, values_input, input_size,
+///     aggregates_output, unique_count_output
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform reduction
+/// rocprim::reduce_by_head_flags(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     flags, values_input, input_size,
+///     aggregates_output, unique_count_output
+/// );
+/// // aggregates_output:   [6, 9, 13, 8]
+/// // unique_count_output: [4]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class HeadFlagsInputIterator,
+         class ValuesInputIterator,
+         class AggregatesOutputIterator,
+         class UniqueCountOutputIterator,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<ValuesInputIterator>::value_type>,
+         class AccType = ::rocprim::invoke_result_binary_op_t<
+             typename std::iterator_traits<ValuesInputIterator>::value_type,
+             BinaryFunction>>
+inline hipError_t reduce_by_head_flags(void*                     temporary_storage,
+                                       size_t&                   storage_size,
+                                       HeadFlagsInputIterator    head_flags_input,
+                                       ValuesInputIterator       values_input,
+                                       const size_t              size,
+                                       AggregatesOutputIterator  aggregates_output,
+                                       UniqueCountOutputIterator unique_count_output,
+                                       BinaryFunction            reduce_op = BinaryFunction(),
+                                       hipStream_t               stream    = 0,
+                                       bool                      debug_synchronous = false)
+{
+    return detail::reduce_by_key_impl<detail::lookback_scan_determinism::default_determinism,
+                                      Config,
+                                      AccType>(temporary_storage,
+                                               storage_size,
+                                               head_flags_input,
+                                               values_input,
+                                               size,
+                                               ::rocprim::make_discard_iterator(),
+                                               aggregates_output,
+                                               unique_count_output,
+                                               reduce_op,
+                                               detail::head_flag_compare{},
+                                               stream,
+                                               debug_synchronous);
+}
+
 /// @}
 // end of group devicemodule
 
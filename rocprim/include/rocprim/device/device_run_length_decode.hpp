@@ -0,0 +1,312 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_RUN_LENGTH_DECODE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_RUN_LENGTH_DECODE_HPP_
+
+#include "detail/device_run_length_decode.hpp"
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../functional.hpp"
+#include "../iterator/discard_iterator.hpp"
+
+#include "config_types.hpp"
+#include "device_run_length_decode_config.hpp"
+#include "device_scan.hpp"
+#include "execution_budget.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Config,
+         class ValuesInputIterator,
+         class LengthsInputIterator,
+         class OutputIterator,
+         class RelativeOffsetsOutputIterator>
+inline hipError_t run_length_decode_impl(void*                         temporary_storage,
+                                         size_t&                       storage_size,
+                                         ValuesInputIterator           values_input,
+                                         LengthsInputIterator          lengths_input,
+                                         const size_t                  num_runs,
+                                         OutputIterator                output,
+                                         RelativeOffsetsOutputIterator relative_offsets_output,
+                                         const hipStream_t             stream,
+                                         const bool                    debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using config     = wrapped_run_length_decode_config<Config, value_type>;
+
+    target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, target_arch));
+    const run_length_decode_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size = params.kernel_config.block_size;
+
+    // The ends of the runs are the inclusive scan of their lengths.
+    size_t scan_storage_size = 0;
+    ROCPRIM_RETURN_ON_ERROR(::rocprim::inclusive_scan(nullptr,
+                                                      scan_storage_size,
+                                                      lengths_input,
+                                                      static_cast<size_t*>(nullptr),
+                                                      num_runs,
+                                                      ::rocprim::plus<size_t>(),
+                                                      stream));
+
+    void*   scan_storage;
+    size_t* run_ends;
+
+    const hipError_t result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::make_partition(&scan_storage, scan_storage_size),
+            temp_storage::ptr_aligned_array(&run_ends, num_runs)));
+    if(result != hipSuccess || temporary_storage == nullptr || num_runs == 0)
+    {
+        return result;
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(::rocprim::inclusive_scan(scan_storage,
+                                                      scan_storage_size,
+                                                      lengths_input,
+                                                      run_ends,
+                                                      num_runs,
+                                                      ::rocprim::plus<size_t>(),
+                                                      stream,
+                                                      debug_synchronous));
+
+    // The number of output items is only known on the device, so the tiles are processed by
+    // a persistent grid.
+    const auto kernel = run_length_decode_kernel<config,
+                                                 ValuesInputIterator,
+                                                 OutputIterator,
+                                                 RelativeOffsetsOutputIterator>;
+    unsigned int grid_size;
+    ROCPRIM_RETURN_ON_ERROR(persistent_grid_size(kernel, block_size, stream, grid_size));
+
+    if(debug_synchronous)
+    {
+        std::cout << "num_runs " << num_runs << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "grid_size " << grid_size << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    kernel<<<dim3(grid_size), dim3(block_size), 0, stream>>>(values_input,
+                                                             run_ends,
+                                                             num_runs,
+                                                             output,
+                                                             relative_offsets_output);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("run_length_decode_kernel", num_runs, start);
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Parallel run-length decoding for device level.
+///
+/// run_length_decode function expands runs of values: the value of every run is written
+/// to \p output as many times as the length of the run, in the order of the runs. It is the
+/// inverse of \p run_length_encode, and can also repeat items by counts.
+///
+/// The work is balanced with a merge path over the ends of the runs and the output items: every
+/// block processes the same number of runs and output items together, so a mix of very long and
+/// very short (or empty) runs is decoded as fast as runs of equal length.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p values_input and \p lengths_input must have at least \p num_runs
+/// elements.
+/// * Range specified by \p output must have at least as many elements as the sum of the lengths.
+/// * Runs with a length of zero are allowed, they write no items.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `run_length_decode_config`.
+/// \tparam ValuesInputIterator - random-access iterator type of the values of the runs. It can
+/// be a simple pointer type.
+/// \tparam LengthsInputIterator - random-access iterator type of the lengths of the runs. It can
+/// be a simple pointer type. The lengths must be non-negative integers.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be a simple
+/// pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] values_input - iterator to the value of the first run.
+/// \param [in] lengths_input - iterator to the length of the first run.
+/// \param [in] num_runs - number of runs.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t num_runs;    // e.g., 4
+/// int * values;       // e.g., [1, 2, 10, 88]
+/// int * lengths;      // e.g., [3, 1, 0, 2]
+/// int * output;       // empty array of at least 6 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::run_length_decode(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     values, lengths, num_runs, output
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform decoding
+/// rocprim::run_length_decode(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     values, lengths, num_runs, output
+/// );
+/// // output: [1, 1, 1, 2, 88, 88]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class ValuesInputIterator,
+         class LengthsInputIterator,
+         class OutputIterator>
+inline hipError_t run_length_decode(void*                temporary_storage,
+                                    size_t&              storage_size,
+                                    ValuesInputIterator  values_input,
+                                    LengthsInputIterator lengths_input,
+                                    const size_t         num_runs,
+                                    OutputIterator       output,
+                                    const hipStream_t    stream            = 0,
+                                    const bool           debug_synchronous = false)
+{
+    return detail::run_length_decode_impl<Config>(temporary_storage,
+                                                  storage_size,
+                                                  values_input,
+                                                  lengths_input,
+                                                  num_runs,
+                                                  output,
+                                                  ::rocprim::make_discard_iterator(),
+                                                  stream,
+                                                  debug_synchronous);
+}
+
+/// \brief Parallel run-length decoding with the offsets of the items in their runs for device
+/// level.
+///
+/// Expands the runs like \p run_length_decode, and also writes the offset of every output item
+/// relative to the beginning of its run to \p relative_offsets_output, i.e. the output items of
+/// a run of length \p n get the relative offsets <tt>0, 1, ..., n - 1</tt>.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p values_input and \p lengths_input must have at least \p num_runs
+/// elements.
+/// * Ranges specified by \p output and \p relative_offsets_output must have at least as many
+/// elements as the sum of the lengths.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `run_length_decode_config`.
+/// \tparam ValuesInputIterator - random-access iterator type of the values of the runs. It can
+/// be a simple pointer type.
+/// \tparam LengthsInputIterator - random-access iterator type of the lengths of the runs. It can
+/// be a simple pointer type. The lengths must be non-negative integers.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be a simple
+/// pointer type.
+/// \tparam RelativeOffsetsOutputIterator - random-access iterator type of the relative offsets
+/// output range. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] values_input - iterator to the value of the first run.
+/// \param [in] lengths_input - iterator to the length of the first run.
+/// \param [in] num_runs - number of runs.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [out] relative_offsets_output - iterator to the first element in the output range of
+/// the offsets of the items in their runs.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class ValuesInputIterator,
+         class LengthsInputIterator,
+         class OutputIterator,
+         class RelativeOffsetsOutputIterator>
+inline hipError_t
+    run_length_decode_with_relative_offsets(void*                         temporary_storage,
+                                            size_t&                       storage_size,
+                                            ValuesInputIterator           values_input,
+                                            LengthsInputIterator          lengths_input,
+                                            const size_t                  num_runs,
+                                            OutputIterator                output,
+                                            RelativeOffsetsOutputIterator relative_offsets_output,
+                                            const hipStream_t             stream            = 0,
+                                            const bool                    debug_synchronous = false)
+{
+    return detail::run_length_decode_impl<Config>(temporary_storage,
+                                                  storage_size,
+                                                  values_input,
+                                                  lengths_input,
+                                                  num_runs,
+                                                  output,
+                                                  relative_offsets_output,
+                                                  stream,
+                                                  debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_RUN_LENGTH_DECODE_HPP_
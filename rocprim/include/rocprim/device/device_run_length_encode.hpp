@@ -21,6 +21,7 @@
 #ifndef ROCPRIM_DEVICE_DEVICE_RUN_LENGTH_ENCODE_HPP_
 #define ROCPRIM_DEVICE_DEVICE_RUN_LENGTH_ENCODE_HPP_
 
+#include <chrono>
 #include <iostream>
 #include <iterator>
 #include <type_traits>
@@ -35,12 +36,183 @@
 #include "../iterator/zip_iterator.hpp"
 
 #include "detail/device_config_helper.hpp"
+#include "detail/device_run_length_encode.hpp"
+#include "detail/device_scan_common.hpp"
 #include "device_reduce_by_key.hpp"
 #include "device_run_length_encode_config.hpp"
 #include "device_select.hpp"
+#include "device_transform.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
+namespace detail
+{
+
+// Encodes the runs in a single pass over the input, see run_length_encode_kernel. The kernel is
+// configured by the select config of Config, it is tuned like unique on the input type.
+template<bool NonTrivialOnly,
+         class Config,
+         class InputIterator,
+         class UniqueOutputIterator,
+         class OffsetsOutputIterator,
+         class CountsOutputIterator,
+         class RunsCountOutputIterator>
+inline hipError_t run_length_encode_single_pass_impl(void*                   temporary_storage,
+                                                     size_t&                 storage_size,
+                                                     InputIterator           input,
+                                                     const unsigned int      size,
+                                                     UniqueOutputIterator    unique_output,
+                                                     OffsetsOutputIterator   offsets_output,
+                                                     CountsOutputIterator    counts_output,
+                                                     RunsCountOutputIterator runs_count_output,
+                                                     const hipStream_t       stream,
+                                                     const bool              debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using rle_config = default_or_custom_config<Config,
+                                                run_length_encode_config<default_config,
+                                                                         default_config>>;
+    using config     = wrapped_partition_config<typename rle_config::select,
+                                                partition_subalgo::select_unique,
+                                                input_type,
+                                                ::rocprim::empty_type>;
+
+    using scan_state_type = lookback_scan_state<run_length_encode_prefix>;
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const partition_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+
+    const size_t size_limit
+        = budgeted_size_limit(stream, params.kernel_config.size_limit, items_per_block);
+    const size_t aligned_size_limit
+        = ::rocprim::max<size_t>(size_limit - size_limit % items_per_block, items_per_block);
+    const unsigned int limited_size
+        = static_cast<unsigned int>(::rocprim::min<size_t>(size, aligned_size_limit));
+    const unsigned int number_of_blocks = ceiling_div(limited_size, items_per_block);
+
+    void*                     scan_state_storage;
+    run_length_encode_prefix* carry;
+
+    temp_storage::layout layout{};
+    result = scan_state_type::get_temp_storage_layout(number_of_blocks, stream, layout);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(temp_storage::make_partition(&scan_state_storage,
+                                                                         layout),
+                                            temp_storage::ptr_aligned_array(&carry, 1)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    if(size == 0)
+    {
+        return ::rocprim::transform(constant_iterator<unsigned int>(0),
+                                    runs_count_output,
+                                    1,
+                                    ::rocprim::identity<unsigned int>{},
+                                    stream,
+                                    debug_synchronous);
+    }
+
+    scan_state_type scan_state{};
+    result = scan_state_type::create(scan_state,
+                                     scan_state_storage,
+                                     number_of_blocks,
+                                     stream,
+                                     params.backoff);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+
+    const size_t number_of_launches = ceiling_div(size, limited_size);
+
+    if(debug_synchronous)
+    {
+        std::cout << "size " << size << '\n';
+        std::cout << "aligned_size_limit " << aligned_size_limit << '\n';
+        std::cout << "number_of_launches " << number_of_launches << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << number_of_blocks << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    unsigned int previous_blocks = 0;
+    for(size_t offset = 0; offset < size; offset += limited_size)
+    {
+        const unsigned int current_size
+            = static_cast<unsigned int>(::rocprim::min<size_t>(size - offset, limited_size));
+        const unsigned int current_number_of_blocks = ceiling_div(current_size, items_per_block);
+
+        if(debug_synchronous)
+        {
+            std::cout << "current size " << current_size << '\n';
+            std::cout << "current number of blocks " << current_number_of_blocks << '\n';
+            start = std::chrono::steady_clock::now();
+        }
+
+        // A single block does not look back. Before the state is reset for a following launch,
+        // the complete prefix of the last block of the preceding launch is saved to carry.
+        if(current_number_of_blocks > 1 || offset != 0)
+        {
+            const unsigned int init_block_size = ROCPRIM_DEFAULT_MAX_BLOCK_SIZE;
+            const unsigned int init_grid_size
+                = ceiling_div(current_number_of_blocks, init_block_size);
+            init_lookback_scan_state_kernel<scan_state_type>
+                <<<dim3(init_grid_size), dim3(init_block_size), 0, stream>>>(
+                    scan_state,
+                    current_number_of_blocks,
+                    previous_blocks - 1,
+                    offset != 0 ? carry : nullptr);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel",
+                                                        current_number_of_blocks,
+                                                        start);
+
+            if(debug_synchronous) start = std::chrono::steady_clock::now();
+        }
+
+        run_length_encode_kernel<NonTrivialOnly, config>
+            <<<dim3(current_number_of_blocks), dim3(block_size), 0, stream>>>(
+                input,
+                static_cast<unsigned int>(offset),
+                size,
+                unique_output,
+                offsets_output,
+                counts_output,
+                runs_count_output,
+                ::rocprim::equal_to<input_type>(),
+                scan_state,
+                carry);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("run_length_encode_kernel",
+                                                    current_size,
+                                                    start);
+
+        previous_blocks = current_number_of_blocks;
+    }
+
+    return hipSuccess;
+}
+
+} // end of detail namespace
+
 /// \addtogroup devicemodule
 /// @{
 
@@ -169,6 +341,9 @@ hipError_t run_length_encode(void * temporary_storage,
 /// the length of the run (the count of elements) is written to \p counts_output.
 /// The total number of non-trivial runs is written to \p runs_count_output.
 ///
+/// The runs are encoded in a single pass over the input, which finds the non-trivial runs
+/// without encoding all runs first.
+///
 /// \par Overview
 /// * Returns the required size of \p temporary_storage in \p storage_size
 /// if \p temporary_storage in a null pointer.
@@ -177,7 +352,8 @@ hipError_t run_length_encode(void * temporary_storage,
 /// * Ranges specified by \p offsets_output and \p counts_output must have at least
 /// <tt>*runs_count_output</tt> (i.e. the number of non-trivial runs) elements.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `run_length_encode_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `run_length_encode_config`. Only its select configuration is used.
 /// \tparam InputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam OffsetsOutputIterator - random-access iterator type of the output range. Must meet the
@@ -259,134 +435,253 @@ hipError_t run_length_encode_non_trivial_runs(void * temporary_storage,
                                               hipStream_t stream = 0,
                                               bool debug_synchronous = false)
 {
-    using input_type = typename std::iterator_traits<InputIterator>::value_type;
-    using offset_type = unsigned int;
-    using count_type = unsigned int;
-    using offset_count_pair = typename ::rocprim::tuple<offset_type, count_type>;
-
-    using config = detail::default_or_custom_config<
-        Config,
-        detail::default_run_length_encode_config<tuple<offset_type, count_type>>>;
-
-    hipError_t error;
-
-    auto reduce_op = [] __device__ (const offset_count_pair& a, const offset_count_pair& b)
-    {
-        return offset_count_pair(
-            ::rocprim::get<0>(a), // Always use offset of the first item of the run
-            ::rocprim::get<1>(a) + ::rocprim::get<1>(b) // Number of items in the run
-        );
-    };
-    auto non_trivial_runs_select_op = [] __device__ (const offset_count_pair& a)
-    {
-        return ::rocprim::get<1>(a) > 1;
-    };
-
-    offset_type * offsets_tmp = nullptr;
-    count_type * counts_tmp = nullptr;
-    count_type * all_runs_count_tmp = nullptr;
-
-    // Calculate size of temporary storage for reduce_by_key operation
-    size_t reduce_by_key_bytes;
-    error = ::rocprim::reduce_by_key<typename config::reduce_by_key>(
-        nullptr, reduce_by_key_bytes,
+    return detail::run_length_encode_single_pass_impl<true, Config>(
+        temporary_storage,
+        storage_size,
         input,
-        ::rocprim::make_zip_iterator(
-            ::rocprim::make_tuple(
-                ::rocprim::make_counting_iterator<offset_type>(0),
-                ::rocprim::make_constant_iterator<count_type>(1)
-            )
-        ),
         size,
         ::rocprim::make_discard_iterator(),
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_tmp, counts_tmp)),
-        all_runs_count_tmp,
-        reduce_op, ::rocprim::equal_to<input_type>(),
-        stream, debug_synchronous
-    );
-    if(error != hipSuccess) return error;
-    reduce_by_key_bytes = ::rocprim::detail::align_size(reduce_by_key_bytes);
-
-    // Calculate size of temporary storage for select operation
-    size_t select_bytes;
-    error = ::rocprim::select<typename config::select>(
-        nullptr, select_bytes,
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_tmp, counts_tmp)),
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_output, counts_output)),
+        offsets_output,
+        counts_output,
         runs_count_output,
-        size,
-        non_trivial_runs_select_op,
-        stream, debug_synchronous
-    );
-    if(error != hipSuccess) return error;
-    select_bytes = ::rocprim::detail::align_size(select_bytes);
-
-    const size_t offsets_tmp_bytes = ::rocprim::detail::align_size(size * sizeof(offset_type));
-    const size_t counts_tmp_bytes = ::rocprim::detail::align_size(size * sizeof(count_type));
-    const size_t all_runs_count_tmp_bytes = sizeof(count_type);
-    if(temporary_storage == nullptr)
-    {
-        storage_size = ::rocprim::max(reduce_by_key_bytes, select_bytes) +
-            offsets_tmp_bytes + counts_tmp_bytes + all_runs_count_tmp_bytes;
-        return hipSuccess;
-    }
-
-    char * ptr = reinterpret_cast<char *>(temporary_storage);
-    ptr += ::rocprim::max(reduce_by_key_bytes, select_bytes);
-    offsets_tmp = reinterpret_cast<offset_type *>(ptr);
-    ptr += offsets_tmp_bytes;
-    counts_tmp = reinterpret_cast<count_type *>(ptr);
-    ptr += counts_tmp_bytes;
-    all_runs_count_tmp = reinterpret_cast<count_type *>(ptr);
-
-    std::chrono::steady_clock::time_point start;
+        stream,
+        debug_synchronous);
+}
 
-    if(debug_synchronous) start = std::chrono::steady_clock::now();
-    error = ::rocprim::reduce_by_key<typename config::reduce_by_key>(
-        temporary_storage, reduce_by_key_bytes,
+/// \brief Parallel run-length encoding with the offsets of the runs for device level.
+///
+/// run_length_encode_with_offsets function performs a device-wide run-length encoding of runs
+/// (groups) of consecutive values like \p run_length_encode, and also writes the offset of the
+/// first value of each run to \p offsets_output. The first value of each run is copied to
+/// \p unique_output and the length of the run is written to \p counts_output. The total number
+/// of runs is written to \p runs_count_output.
+///
+/// All outputs are written in a single pass over the input, so finding the offsets of the runs
+/// does not take another scan over the lengths.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Range specified by \p input must have at least \p size elements.
+/// * Range specified by \p runs_count_output must have at least 1 element.
+/// * Ranges specified by \p unique_output, \p offsets_output and \p counts_output must have
+/// at least <tt>*runs_count_output</tt> (i.e. the number of runs) elements.
+/// * Any of the outputs can be a \p discard_iterator.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `run_length_encode_config`. Only its select configuration is used.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam UniqueOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetsOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam CountsOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam RunsCountOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range of values.
+/// \param [in] size - number of element in the input range.
+/// \param [out] unique_output - iterator to the first element in the output range of unique values.
+/// \param [out] offsets_output - iterator to the first element in the output range of offsets.
+/// \param [out] counts_output - iterator to the first element in the output range of lenghts.
+/// \param [out] runs_count_output - iterator to total number of runs.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;          // e.g., 8
+/// int * input;                // e.g., [1, 1, 1, 2, 10, 10, 10, 88]
+/// int * unique_output;        // empty array of at least 4 elements
+/// int * offsets_output;       // empty array of at least 4 elements
+/// int * counts_output;        // empty array of at least 4 elements
+/// int * runs_count_output;    // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::run_length_encode_with_offsets(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, input_size,
+///     unique_output, offsets_output, counts_output, runs_count_output
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform encoding
+/// rocprim::run_length_encode_with_offsets(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, input_size,
+///     unique_output, offsets_output, counts_output, runs_count_output
+/// );
+/// // unique_output:     [1, 2, 10, 88]
+/// // offsets_output:    [0, 3,  4,  7]
+/// // counts_output:     [3, 1,  3,  1]
+/// // runs_count_output: [4]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class UniqueOutputIterator,
+         class OffsetsOutputIterator,
+         class CountsOutputIterator,
+         class RunsCountOutputIterator>
+inline hipError_t run_length_encode_with_offsets(void*                   temporary_storage,
+                                                 size_t&                 storage_size,
+                                                 InputIterator           input,
+                                                 unsigned int            size,
+                                                 UniqueOutputIterator    unique_output,
+                                                 OffsetsOutputIterator   offsets_output,
+                                                 CountsOutputIterator    counts_output,
+                                                 RunsCountOutputIterator runs_count_output,
+                                                 hipStream_t             stream            = 0,
+                                                 bool                    debug_synchronous = false)
+{
+    return detail::run_length_encode_single_pass_impl<false, Config>(
+        temporary_storage,
+        storage_size,
         input,
-        ::rocprim::make_zip_iterator(
-            ::rocprim::make_tuple(
-                ::rocprim::make_counting_iterator<offset_type>(0),
-                ::rocprim::make_constant_iterator<count_type>(1)
-            )
-        ),
         size,
-        ::rocprim::make_discard_iterator(), // Ignore unique output
-        ::rocprim::make_zip_iterator(rocprim::make_tuple(offsets_tmp, counts_tmp)),
-        all_runs_count_tmp,
-        reduce_op, ::rocprim::equal_to<input_type>(),
-        stream, debug_synchronous
-    );
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("rocprim::reduce_by_key", size, start);
-
-    // Read count of all runs (including trivial runs)
-    count_type all_runs_count;
-    error = detail::memcpy_and_sync(&all_runs_count,
-                                    all_runs_count_tmp,
-                                    sizeof(count_type),
-                                    hipMemcpyDeviceToHost,
-                                    stream);
-    if(error != hipSuccess)
-        return error;
-
-    // Select non-trivial runs
-    if(debug_synchronous) start = std::chrono::steady_clock::now();
-    error = ::rocprim::select<typename config::select>(
-        temporary_storage, select_bytes,
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_tmp, counts_tmp)),
-        ::rocprim::make_zip_iterator(::rocprim::make_tuple(offsets_output, counts_output)),
+        unique_output,
+        offsets_output,
+        counts_output,
         runs_count_output,
-        all_runs_count,
-        non_trivial_runs_select_op,
-        stream, debug_synchronous
-    );
-    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("rocprim::select", all_runs_count, start);
-
-    return hipSuccess;
+        stream,
+        debug_synchronous);
 }
 
-
+/// \brief Parallel run-length encoding of non-trivial runs with their values for device level.
+///
+/// run_length_encode_non_trivial_runs_with_values function performs a device-wide run-length
+/// encoding of non-trivial runs (groups of more than one element) like
+/// \p run_length_encode_non_trivial_runs, and also copies the first value of each non-trivial
+/// run to \p unique_output. The offset of the first value of each non-trivial run is written to
+/// \p offsets_output and the length of the run to \p counts_output. The total number of
+/// non-trivial runs is written to \p runs_count_output.
+///
+/// All outputs are written in a single pass over the input.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Range specified by \p input must have at least \p size elements.
+/// * Range specified by \p runs_count_output must have at least 1 element.
+/// * Ranges specified by \p unique_output, \p offsets_output and \p counts_output must have
+/// at least <tt>*runs_count_output</tt> (i.e. the number of non-trivial runs) elements.
+/// * Any of the outputs can be a \p discard_iterator.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `run_length_encode_config`. Only its select configuration is used.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam UniqueOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetsOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam CountsOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam RunsCountOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range of values.
+/// \param [in] size - number of element in the input range.
+/// \param [out] unique_output - iterator to the first element in the output range of unique values.
+/// \param [out] offsets_output - iterator to the first element in the output range of offsets.
+/// \param [out] counts_output - iterator to the first element in the output range of lenghts.
+/// \param [out] runs_count_output - iterator to total number of non-trivial runs.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;          // e.g., 8
+/// int * input;                // e.g., [1, 1, 1, 2, 10, 10, 10, 88]
+/// int * unique_output;        // empty array of at least 2 elements
+/// int * offsets_output;       // empty array of at least 2 elements
+/// int * counts_output;        // empty array of at least 2 elements
+/// int * runs_count_output;    // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::run_length_encode_non_trivial_runs_with_values(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, input_size,
+///     unique_output, offsets_output, counts_output, runs_count_output
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform encoding
+/// rocprim::run_length_encode_non_trivial_runs_with_values(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, input_size,
+///     unique_output, offsets_output, counts_output, runs_count_output
+/// );
+/// // unique_output:     [1, 10]
+/// // offsets_output:    [0,  4]
+/// // counts_output:     [3,  3]
+/// // runs_count_output: [2]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class UniqueOutputIterator,
+         class OffsetsOutputIterator,
+         class CountsOutputIterator,
+         class RunsCountOutputIterator>
+inline hipError_t
+    run_length_encode_non_trivial_runs_with_values(void*                   temporary_storage,
+                                                   size_t&                 storage_size,
+                                                   InputIterator           input,
+                                                   unsigned int            size,
+                                                   UniqueOutputIterator    unique_output,
+                                                   OffsetsOutputIterator   offsets_output,
+                                                   CountsOutputIterator    counts_output,
+                                                   RunsCountOutputIterator runs_count_output,
+                                                   hipStream_t             stream = 0,
+                                                   bool debug_synchronous         = false)
+{
+    return detail::run_length_encode_single_pass_impl<true, Config>(
+        temporary_storage,
+        storage_size,
+        input,
+        size,
+        unique_output,
+        offsets_output,
+        counts_output,
+        runs_count_output,
+        stream,
+        debug_synchronous);
+}
 
 /// @}
 // end of group devicemodule
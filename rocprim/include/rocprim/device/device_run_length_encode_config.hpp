@@ -38,7 +38,9 @@ BEGIN_ROCPRIM_NAMESPACE
 ///
 /// \tparam ReduceByKeyConfig - configuration of device-level reduce-by-key operation.
 /// Must be \p reduce_by_key_config or \p default_config.
-/// \tparam SelectConfig - configuration of device-level select operation.
+/// \tparam SelectConfig - configuration of device-level select operation, which also configures
+/// the single-pass encoding of \p run_length_encode_non_trivial_runs,
+/// \p run_length_encode_with_offsets and \p run_length_encode_non_trivial_runs_with_values.
 /// Must be \p select_config or \p default_config.
 template<
     class ReduceByKeyConfig,
@@ -52,18 +54,6 @@ struct run_length_encode_config
     using select = SelectConfig;
 };
 
-namespace detail
-{
-
-// The problem size for the selection is the number of runs, which may be much smaller than the
-//   total problem size. The tuning assumption of reasonably large inputs does therefore not hold.
-template<typename T>
-using default_run_length_encode_config
-    = run_length_encode_config<default_config,
-                               typename default_partition_config_base<T, false>::type>;
-
-} // end namespace detail
-
 END_ROCPRIM_NAMESPACE
 
 /// @}
@@ -0,0 +1,573 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SAMPLE_SORT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SAMPLE_SORT_HPP_
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_sample_sort.hpp"
+#include "device_merge_sort.hpp"
+#include "device_nth_element_config.hpp"
+#include "device_segmented_merge_sort.hpp"
+#include "device_transform.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Iterator>
+Iterator sample_sort_advance(Iterator iterator, const size_t offset)
+{
+    return iterator + offset;
+}
+
+inline empty_type* sample_sort_advance(empty_type* iterator, size_t)
+{
+    return iterator;
+}
+
+template<class InputIterator, class OutputIterator>
+hipError_t sample_sort_copy(InputIterator     input,
+                            OutputIterator    output,
+                            const size_t      size,
+                            const hipStream_t stream,
+                            const bool        debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    return ::rocprim::transform(input,
+                                output,
+                                size,
+                                ::rocprim::identity<value_type>(),
+                                stream,
+                                debug_synchronous);
+}
+
+inline hipError_t sample_sort_copy(empty_type*, empty_type*, size_t, hipStream_t, bool)
+{
+    return hipSuccess;
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class BinaryFunction>
+inline hipError_t sample_sort_impl(void*                temporary_storage,
+                                   size_t&              storage_size,
+                                   KeysInputIterator    keys_input,
+                                   KeysOutputIterator   keys_output,
+                                   ValuesInputIterator  values_input,
+                                   ValuesOutputIterator values_output,
+                                   const size_t         size,
+                                   BinaryFunction       compare_function,
+                                   const hipStream_t    stream,
+                                   const bool           debug_synchronous)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using config     = wrapped_nth_element_config<Config, key_type>;
+
+    constexpr bool with_values = !std::is_same<value_type, empty_type>::value;
+
+    // The buckets are sorted by the segmented sort, which is limited to 32-bit sizes.
+    if(size > std::numeric_limits<unsigned int>::max())
+    {
+        return hipErrorInvalidValue;
+    }
+
+    target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, target_arch));
+    const nth_element_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int num_buckets         = params.number_of_buckets;
+    const unsigned int num_splitters       = num_buckets - 1;
+    const unsigned int block_size          = params.kernel_config.block_size;
+    const unsigned int num_items_per_block = block_size * params.kernel_config.items_per_thread;
+
+    // Inputs that fit in one segment are merge sorted directly.
+    const bool bucketed = size > sample_sort_max_segment_size;
+
+    key_type*     splitters        = nullptr;
+    bool*         equality_buckets = nullptr;
+    size_t*       bucket_offsets   = nullptr;
+    unsigned int* segment_offsets  = nullptr;
+    key_type*     keys_tmp         = nullptr;
+    value_type*   values_tmp       = nullptr;
+    void*         nested_storage   = nullptr;
+
+    size_t direct_bytes  = 0;
+    size_t bucket_bytes  = 0;
+    size_t segment_bytes = 0;
+    ROCPRIM_RETURN_ON_ERROR(merge_sort_impl<default_config>(nullptr,
+                                                            direct_bytes,
+                                                            keys_input,
+                                                            keys_output,
+                                                            values_input,
+                                                            values_output,
+                                                            size,
+                                                            compare_function,
+                                                            stream,
+                                                            false));
+    if(bucketed)
+    {
+        // A bucket can hold all keys, and every bucket can be a segment.
+        ROCPRIM_RETURN_ON_ERROR(merge_sort_impl<default_config>(nullptr,
+                                                                bucket_bytes,
+                                                                keys_tmp,
+                                                                keys_output,
+                                                                values_tmp,
+                                                                values_output,
+                                                                size,
+                                                                compare_function,
+                                                                stream,
+                                                                false));
+        ROCPRIM_RETURN_ON_ERROR(
+            segmented_merge_sort_impl<default_config>(nullptr,
+                                                      segment_bytes,
+                                                      keys_tmp,
+                                                      keys_output,
+                                                      values_tmp,
+                                                      values_output,
+                                                      static_cast<unsigned int>(size),
+                                                      num_buckets,
+                                                      segment_offsets,
+                                                      segment_offsets + num_buckets,
+                                                      compare_function,
+                                                      stream,
+                                                      false));
+    }
+    const size_t nested_size = bucketed ? std::max(bucket_bytes, segment_bytes) : direct_bytes;
+
+    const hipError_t partition_result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::make_partition(&nested_storage, nested_size),
+            temp_storage::ptr_aligned_array(&splitters, bucketed ? num_splitters : 0),
+            temp_storage::ptr_aligned_array(&equality_buckets, bucketed ? num_buckets : 0),
+            temp_storage::ptr_aligned_array(&bucket_offsets, bucketed ? num_buckets : 0),
+            temp_storage::ptr_aligned_array(&segment_offsets, bucketed ? 2 * num_buckets : 0),
+            temp_storage::ptr_aligned_array(&keys_tmp, bucketed ? size : 0),
+            temp_storage::ptr_aligned_array(&values_tmp, bucketed && with_values ? size : 0)));
+
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    if(!bucketed)
+    {
+        return merge_sort_impl<default_config>(nested_storage,
+                                               direct_bytes,
+                                               keys_input,
+                                               keys_output,
+                                               values_input,
+                                               values_output,
+                                               size,
+                                               compare_function,
+                                               stream,
+                                               debug_synchronous);
+    }
+
+    std::chrono::steady_clock::time_point start;
+
+    const auto start_timer = [&start, debug_synchronous]()
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+    };
+
+    const unsigned int num_blocks = ceiling_div(size, num_items_per_block);
+
+    ROCPRIM_RETURN_ON_ERROR(
+        hipMemsetAsync(equality_buckets, 0, sizeof(*equality_buckets) * num_buckets, stream));
+    ROCPRIM_RETURN_ON_ERROR(
+        hipMemsetAsync(bucket_offsets, 0, sizeof(*bucket_offsets) * num_buckets, stream));
+
+    start_timer();
+    sample_sort_find_splitters_kernel<config>
+        <<<1, num_splitters, 0, stream>>>(keys_input,
+                                          splitters,
+                                          equality_buckets,
+                                          size,
+                                          compare_function);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sample_sort_find_splitters_kernel", size, start);
+
+    start_timer();
+    sample_sort_count_kernel<config>
+        <<<num_blocks, block_size, 0, stream>>>(keys_input,
+                                                splitters,
+                                                equality_buckets,
+                                                bucket_offsets,
+                                                size,
+                                                compare_function);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sample_sort_count_kernel", size, start);
+
+    // The sizes of the buckets decide how every bucket is sorted.
+    std::vector<size_t>     bucket_sizes(num_buckets);
+    std::unique_ptr<bool[]> equality(new bool[num_buckets]);
+    ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(bucket_sizes.data(),
+                                           bucket_offsets,
+                                           sizeof(size_t) * num_buckets,
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+    ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(equality.get(),
+                                           equality_buckets,
+                                           sizeof(bool) * num_buckets,
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+    ROCPRIM_RETURN_ON_ERROR(hipStreamSynchronize(stream));
+
+    std::vector<size_t>       offsets(num_buckets);
+    std::vector<unsigned int> segment_bounds(2 * num_buckets);
+    unsigned int              segments = 0;
+    size_t                    offset   = 0;
+    for(unsigned int bucket = 0; bucket < num_buckets; ++bucket)
+    {
+        offsets[bucket] = offset;
+        if(!equality[bucket] && bucket_sizes[bucket] > 1
+           && bucket_sizes[bucket] <= sample_sort_max_segment_size)
+        {
+            const size_t end = offset + bucket_sizes[bucket];
+            segment_bounds[segments]               = static_cast<unsigned int>(offset);
+            segment_bounds[num_buckets + segments] = static_cast<unsigned int>(end);
+            ++segments;
+        }
+        offset += bucket_sizes[bucket];
+    }
+    ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(bucket_offsets,
+                                           offsets.data(),
+                                           sizeof(size_t) * num_buckets,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+    ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(segment_offsets,
+                                           segment_bounds.data(),
+                                           sizeof(unsigned int) * 2 * num_buckets,
+                                           hipMemcpyHostToDevice,
+                                           stream));
+
+    start_timer();
+    sample_sort_scatter_kernel<config>
+        <<<num_blocks, block_size, 0, stream>>>(keys_input,
+                                                values_input,
+                                                splitters,
+                                                equality_buckets,
+                                                bucket_offsets,
+                                                keys_tmp,
+                                                values_tmp,
+                                                size,
+                                                compare_function);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sample_sort_scatter_kernel", size, start);
+
+    // The small buckets are sorted together, and the large ones on their own. The keys of an
+    // equality bucket are all equivalent, and a bucket of one key is sorted, so they are copied.
+    if(segments > 0)
+    {
+        size_t bytes = nested_size;
+        ROCPRIM_RETURN_ON_ERROR(
+            segmented_merge_sort_impl<default_config>(nested_storage,
+                                                      bytes,
+                                                      keys_tmp,
+                                                      keys_output,
+                                                      values_tmp,
+                                                      values_output,
+                                                      static_cast<unsigned int>(size),
+                                                      segments,
+                                                      segment_offsets,
+                                                      segment_offsets + num_buckets,
+                                                      compare_function,
+                                                      stream,
+                                                      debug_synchronous));
+    }
+    for(unsigned int bucket = 0; bucket < num_buckets; ++bucket)
+    {
+        const size_t begin = offsets[bucket];
+        const size_t count = bucket_sizes[bucket];
+        if(count == 0)
+        {
+            continue;
+        }
+        if(equality[bucket] || count == 1)
+        {
+            ROCPRIM_RETURN_ON_ERROR(sample_sort_copy(keys_tmp + begin,
+                                                     keys_output + begin,
+                                                     count,
+                                                     stream,
+                                                     debug_synchronous));
+            ROCPRIM_RETURN_ON_ERROR(sample_sort_copy(sample_sort_advance(values_tmp, begin),
+                                                     sample_sort_advance(values_output, begin),
+                                                     count,
+                                                     stream,
+                                                     debug_synchronous));
+        }
+        else if(count > sample_sort_max_segment_size)
+        {
+            size_t bytes = nested_size;
+            ROCPRIM_RETURN_ON_ERROR(
+                merge_sort_impl<default_config>(nested_storage,
+                                                bytes,
+                                                keys_tmp + begin,
+                                                keys_output + begin,
+                                                sample_sort_advance(values_tmp, begin),
+                                                sample_sort_advance(values_output, begin),
+                                                count,
+                                                compare_function,
+                                                stream,
+                                                debug_synchronous));
+        }
+    }
+
+    return hipSuccess;
+}
+
+} // end namespace detail
+
+/// \brief Parallel sample sort primitive for device level.
+///
+/// \p sample_sort function performs a device-wide sort of keys that only provide a
+/// comparison function. The keys are partitioned into buckets by splitters sampled from the
+/// input, every key is moved to its bucket once, and the buckets are sorted independently:
+/// small buckets together by a segmented merge sort, large buckets on their own.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Keys are only compared with \p compare_function, so they need no radix representation,
+/// no \p operator== and no conversion from \p 0.
+/// * The sort is \b not stable: equivalent keys may be reordered.
+/// * Inputs of at most 65536 keys are sorted by \p merge_sort directly.
+/// * The sizes of the buckets are copied to the host, so the function synchronizes \p stream
+/// once for larger inputs.
+/// * \p size must be smaller than 2^32, otherwise \p hipErrorInvalidValue is returned.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `nth_element_config`. The number of buckets and the bucketing kernels are taken from it.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for sort. Default type
+/// is \p rocprim::less<T>, where \p T is a \p value_type of \p KeysInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level sample sort is performed on points ordered by their
+/// distance from the origin.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// struct point { float x; float y; };
+/// struct closer
+/// {
+///     __device__ bool operator()(const point& a, const point& b) const
+///     {
+///         return a.x * a.x + a.y * a.y < b.x * b.x + b.y * b.y;
+///     }
+/// };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t  input_size;     // e.g., 1000000
+/// point * input;          // e.g., [{3, 4}, {1, 0}, {0, 2}, ...]
+/// point * output;         // empty array of input_size elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::sample_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, closer()
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::sample_sort(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, closer()
+/// );
+/// // output: [{1, 0}, {0, 2}, {3, 4}, ...]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t sample_sort(void*              temporary_storage,
+                              size_t&            storage_size,
+                              KeysInputIterator  keys_input,
+                              KeysOutputIterator keys_output,
+                              const size_t       size,
+                              BinaryFunction     compare_function  = BinaryFunction(),
+                              const hipStream_t  stream            = 0,
+                              const bool         debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::sample_sort_impl<Config>(temporary_storage,
+                                            storage_size,
+                                            keys_input,
+                                            keys_output,
+                                            values,
+                                            values,
+                                            size,
+                                            compare_function,
+                                            stream,
+                                            debug_synchronous);
+}
+
+/// \brief Parallel sample sort-by-key primitive for device level.
+///
+/// \p sample_sort function performs a device-wide sort of (key, value) pairs whose keys only
+/// provide a comparison function. The pairs are partitioned into buckets by splitters sampled
+/// from the keys, every pair is moved to its bucket once, and the buckets are sorted
+/// independently.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Keys are only compared with \p compare_function, so they need no radix representation,
+/// no \p operator== and no conversion from \p 0.
+/// * The sort is \b not stable: pairs with equivalent keys may be reordered.
+/// * Inputs of at most 65536 pairs are sorted by \p merge_sort directly.
+/// * The sizes of the buckets are copied to the host, so the function synchronizes \p stream
+/// once for larger inputs.
+/// * \p size must be smaller than 2^32, otherwise \p hipErrorInvalidValue is returned.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `nth_element_config`. The number of buckets and the bucketing kernels are taken from it.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet
+/// the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for sort. Default type
+/// is \p rocprim::less<T>, where \p T is a \p value_type of \p KeysInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range to sort.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t sample_sort(void*                temporary_storage,
+                              size_t&              storage_size,
+                              KeysInputIterator    keys_input,
+                              KeysOutputIterator   keys_output,
+                              ValuesInputIterator  values_input,
+                              ValuesOutputIterator values_output,
+                              const size_t         size,
+                              BinaryFunction       compare_function  = BinaryFunction(),
+                              const hipStream_t    stream            = 0,
+                              const bool           debug_synchronous = false)
+{
+    return detail::sample_sort_impl<Config>(temporary_storage,
+                                            storage_size,
+                                            keys_input,
+                                            keys_output,
+                                            values_input,
+                                            values_output,
+                                            size,
+                                            compare_function,
+                                            stream,
+                                            debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_SAMPLE_SORT_HPP_
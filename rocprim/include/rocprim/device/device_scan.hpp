@@ -23,6 +23,7 @@
 
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <type_traits>
 
 #include "../config.hpp"
@@ -30,13 +31,19 @@
 #include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
 #include "../functional.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
 #include "../type_traits.hpp"
 #include "../types/future_value.hpp"
 #include "detail/config/device_scan.hpp"
+#include "detail/device_prebuilt.hpp"
 #include "detail/device_scan.hpp"
 #include "detail/device_scan_common.hpp"
+#include "detail/device_scan_two_pass.hpp"
 #include "device_scan_config.hpp"
 #include "device_transform.hpp"
+#include "execution_budget.hpp"
+#include "tuning_database.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -128,17 +135,19 @@ template<lookback_scan_determinism Determinism,
          class LookBackScanState>
 ROCPRIM_KERNEL
     __launch_bounds__(device_params<Config>().kernel_config.block_size) void lookback_scan_kernel(
-        InputIterator       input,
-        OutputIterator      output,
-        const size_t        size,
-        const InitValueType initial_value,
-        BinaryFunction      scan_op,
-        LookBackScanState   lookback_scan_state,
-        const unsigned int  number_of_blocks,
-        AccType*            previous_last_element = nullptr,
-        AccType*            new_last_element      = nullptr,
-        bool                override_first_value  = false,
-        bool                save_last_value       = false)
+        InputIterator                     input,
+        OutputIterator                    output,
+        const size_t                      size,
+        const InitValueType               initial_value,
+        BinaryFunction                    scan_op,
+        LookBackScanState                 lookback_scan_state,
+        const unsigned int                number_of_blocks,
+        AccType*                          previous_last_element = nullptr,
+        AccType*                          new_last_element      = nullptr,
+        bool                              override_first_value  = false,
+        bool                              save_last_value       = false,
+        const scan_stream_state<AccType>* stream_carry_in       = nullptr,
+        scan_stream_state<AccType>*       stream_carry_out      = nullptr)
 {
     lookback_scan_kernel_impl<Determinism, Exclusive, Config>(
         input,
@@ -151,7 +160,89 @@ ROCPRIM_KERNEL
         previous_last_element,
         new_last_element,
         override_first_value,
-        save_last_value);
+        save_last_value,
+        stream_carry_in,
+        stream_carry_out);
+}
+
+template<lookback_scan_determinism Determinism,
+         bool                      Exclusive,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction,
+         class InitValueType,
+         class AccType,
+         class LookBackScanState>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    persistent_lookback_scan_kernel(InputIterator                     input,
+                                    OutputIterator                    output,
+                                    const size_t                      size,
+                                    const InitValueType               initial_value,
+                                    BinaryFunction                    scan_op,
+                                    LookBackScanState                 lookback_scan_state,
+                                    ordered_block_id<unsigned int>    ordered_tile_id,
+                                    const unsigned int                number_of_tiles,
+                                    const scan_stream_state<AccType>* stream_carry_in,
+                                    scan_stream_state<AccType>*       stream_carry_out)
+{
+    persistent_lookback_scan_kernel_impl<Determinism, Exclusive, Config>(
+        input,
+        output,
+        size,
+        static_cast<AccType>(get_input_value(initial_value)),
+        scan_op,
+        lookback_scan_state,
+        ordered_tile_id,
+        number_of_tiles,
+        stream_carry_in,
+        stream_carry_out);
+}
+
+// Two-pass kernels
+
+template<class Config, class InputIterator, class BinaryFunction, class AccType>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size) void
+    two_pass_scan_reduce_kernel(InputIterator  input,
+                                const size_t   tiles_per_partition,
+                                BinaryFunction scan_op,
+                                AccType*       partition_reductions)
+{
+    two_pass_scan_reduce_kernel_impl<Config>(input,
+                                             tiles_per_partition,
+                                             scan_op,
+                                             partition_reductions);
+}
+
+template<bool Exclusive,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction,
+         class InitValueType,
+         class AccType>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().kernel_config.block_size) void two_pass_scan_kernel(
+        InputIterator       input,
+        OutputIterator      output,
+        const size_t        size,
+        const InitValueType initial_value,
+        BinaryFunction      scan_op,
+        const AccType*      partition_prefixes,
+        const size_t        tiles_per_partition,
+        const size_t        number_of_tiles)
+{
+    two_pass_scan_kernel_impl<Exclusive, Config>(
+        input,
+        output,
+        size,
+        static_cast<AccType>(get_input_value(initial_value)),
+        scan_op,
+        partition_prefixes,
+        tiles_per_partition,
+        number_of_tiles);
 }
 
 #define ROCPRIM_DETAIL_HIP_SYNC(name, size, start) \
@@ -165,6 +256,115 @@ ROCPRIM_KERNEL
         std::cout << " " << d.count() * 1000 << " ms" << '\n'; \
     }
 
+// Scans at least two tiles without look-back: the partitions of tiles are reduced, their
+// reductions are scanned by a single block, then the partitions are scanned.
+template<bool Exclusive,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction,
+         class AccType>
+inline hipError_t two_pass_scan_impl(void*                    temporary_storage,
+                                     size_t&                  storage_size,
+                                     InputIterator            input,
+                                     OutputIterator           output,
+                                     const InitValueType      initial_value,
+                                     const size_t             size,
+                                     BinaryFunction           scan_op,
+                                     const scan_config_params params,
+                                     const hipStream_t        stream,
+                                     bool                     debug_synchronous)
+{
+    const unsigned int block_size       = params.kernel_config.block_size;
+    const unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    const auto         items_per_block  = block_size * items_per_thread;
+    const size_t       number_of_tiles  = ceiling_div(size, items_per_block);
+
+    // The partition reductions are scanned by one block, so there are at most items_per_block
+    // partitions. The partitions only depend on the size and the config, not on the occupancy,
+    // so that deterministic scans give the same result on every stream.
+    const size_t max_partitions = std::min<size_t>(number_of_tiles, items_per_block);
+    const size_t tiles_per_partition = ceiling_div(number_of_tiles, max_partitions);
+    const unsigned int number_of_partitions
+        = static_cast<unsigned int>(ceiling_div(number_of_tiles, tiles_per_partition));
+
+    AccType* partition_reductions;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&partition_reductions, max_partitions)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "size " << size << '\n';
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of tiles " << number_of_tiles << '\n';
+        std::cout << "number of partitions " << number_of_partitions << '\n';
+        std::cout << "tiles per partition " << tiles_per_partition << '\n';
+    }
+
+    if(number_of_partitions > 1)
+    {
+        if(debug_synchronous) start = std::chrono::steady_clock::now();
+        two_pass_scan_reduce_kernel<Config>
+            <<<dim3(number_of_partitions - 1), dim3(block_size), 0, stream>>>(
+                input,
+                tiles_per_partition,
+                scan_op,
+                partition_reductions);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("two_pass_scan_reduce_kernel",
+                                                    (number_of_partitions - 1)
+                                                        * tiles_per_partition * items_per_block,
+                                                    start);
+
+        if(debug_synchronous) start = std::chrono::steady_clock::now();
+        single_scan_kernel<false,
+                           Config,
+                           AccType*,
+                           AccType*,
+                           BinaryFunction,
+                           InitValueType,
+                           AccType>
+            <<<dim3(1), dim3(block_size), 0, stream>>>(partition_reductions,
+                                                       number_of_partitions - 1,
+                                                       initial_value,
+                                                       partition_reductions,
+                                                       scan_op);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("single_scan_kernel",
+                                                    number_of_partitions - 1,
+                                                    start);
+    }
+
+    if(debug_synchronous) start = std::chrono::steady_clock::now();
+    two_pass_scan_kernel<Exclusive,
+                         Config,
+                         InputIterator,
+                         OutputIterator,
+                         BinaryFunction,
+                         InitValueType,
+                         AccType>
+        <<<dim3(number_of_partitions), dim3(block_size), 0, stream>>>(input,
+                                                                      output,
+                                                                      size,
+                                                                      initial_value,
+                                                                      scan_op,
+                                                                      partition_reductions,
+                                                                      tiles_per_partition,
+                                                                      number_of_tiles);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("two_pass_scan_kernel", size, start);
+    return hipSuccess;
+}
+
 template<lookback_scan_determinism Determinism,
          bool                      Exclusive,
          class Config,
@@ -172,18 +372,20 @@ template<lookback_scan_determinism Determinism,
          class OutputIterator,
          class InitValueType,
          class BinaryFunction,
-         class AccType>
-inline auto scan_impl(void*               temporary_storage,
-                      size_t&             storage_size,
-                      InputIterator       input,
-                      OutputIterator      output,
-                      const InitValueType initial_value,
-                      const size_t        size,
-                      BinaryFunction      scan_op,
-                      const hipStream_t   stream,
-                      bool                debug_synchronous)
+         class AccType,
+         class TuningType = AccType>
+inline auto scan_config_impl(void*                       temporary_storage,
+                             size_t&                     storage_size,
+                             InputIterator               input,
+                             OutputIterator              output,
+                             const InitValueType         initial_value,
+                             const size_t                size,
+                             BinaryFunction              scan_op,
+                             const hipStream_t           stream,
+                             bool                        debug_synchronous,
+                             scan_stream_state<AccType>* stream_state = nullptr)
 {
-    using config = wrapped_scan_config<Config, AccType>;
+    using config = wrapped_scan_config<Config, TuningType>;
 
     detail::target_arch target_arch;
     hipError_t          result = host_target_arch(stream, target_arch);
@@ -193,25 +395,71 @@ inline auto scan_impl(void*               temporary_storage,
     }
     const scan_config_params params = dispatch_target_arch<config>(target_arch);
 
-    using scan_state_type            = detail::lookback_scan_state<AccType>;
-    using scan_state_with_sleep_type = detail::lookback_scan_state<AccType, true>;
+    using scan_state_type = detail::lookback_scan_state<AccType>;
 
     const unsigned int block_size       = params.kernel_config.block_size;
     const unsigned int items_per_thread = params.kernel_config.items_per_thread;
     const auto         items_per_block  = block_size * items_per_thread;
 
-    const size_t size_limit = params.kernel_config.size_limit;
-    const size_t aligned_size_limit
-        = ::rocprim::max<size_t>(size_limit - size_limit % items_per_block, items_per_block);
-    size_t limited_size = std::min<size_t>(size, aligned_size_limit);
-    const bool use_limited_size = limited_size == aligned_size_limit;
+    const size_t launch_size_limit
+        = budgeted_size_limit(stream, params.kernel_config.size_limit, items_per_block);
+    const size_t aligned_launch_size_limit = ::rocprim::max<size_t>(
+        launch_size_limit - launch_size_limit % items_per_block,
+        items_per_block);
+
+    // A persistent grid scans all tiles in one launch, as long as the tile ids fit the scan state.
+    // It is used if the config asks for it, and for inputs that would need several launches of
+    // at most size_limit items, each waiting for the previous one and carrying its last value.
+    // Its scan state holds all tiles, so streams that minimize memory use the launches.
+    const size_t number_of_tiles = ceiling_div(size, items_per_block);
+    const bool   persistent
+        = (params.persistent || size > aligned_launch_size_limit) && !minimizes_memory(stream)
+          && number_of_tiles > 1 && number_of_tiles <= std::numeric_limits<unsigned int>::max();
+
+    // The two-pass scan is used if the config asks for it, by deterministic scans of up to
+    // two_pass_scan_max_auto_tiles tiles, where it is faster than the deterministic look-back,
+    // and by scans of accumulators larger than two_pass_scan_min_large_value_size bytes.
+    // It does not continue the scan of preceding chunks.
+    const bool two_pass
+        = (params.two_pass
+           || (Determinism == lookback_scan_determinism::deterministic
+               && number_of_tiles <= two_pass_scan_max_auto_tiles)
+           || sizeof(AccType) > two_pass_scan_min_large_value_size)
+          && number_of_tiles > 1 && stream_state == nullptr;
+    if(two_pass)
+    {
+        return two_pass_scan_impl<Exclusive,
+                                  config,
+                                  InputIterator,
+                                  OutputIterator,
+                                  InitValueType,
+                                  BinaryFunction,
+                                  AccType>(temporary_storage,
+                                           storage_size,
+                                           input,
+                                           output,
+                                           initial_value,
+                                           size,
+                                           scan_op,
+                                           params,
+                                           stream,
+                                           debug_synchronous);
+    }
+
+    const size_t aligned_size_limit = persistent ? size : aligned_launch_size_limit;
+    size_t       limited_size       = std::min<size_t>(size, aligned_size_limit);
+    const bool use_limited_size = !persistent && limited_size == aligned_size_limit;
 
-    unsigned int number_of_blocks = (limited_size + items_per_block - 1)/items_per_block;
+    unsigned int number_of_blocks = static_cast<unsigned int>(
+        persistent ? number_of_tiles : ceiling_div(limited_size, items_per_block));
 
     // Pointer to array with block_prefixes
-    void*    scan_state_storage;
-    AccType* previous_last_element;
-    AccType* new_last_element;
+    void*         scan_state_storage;
+    unsigned int* ordered_tile_id_storage;
+    AccType*      previous_last_element;
+    AccType*      new_last_element;
+    // The carry of the preceding chunks, copied so that the last tile can overwrite stream_state
+    scan_stream_state<AccType>* stream_carry_in;
 
     detail::temp_storage::layout layout{};
     hipError_t                   layout_result
@@ -225,11 +473,14 @@ inline auto scan_impl(void*               temporary_storage,
         temporary_storage,
         storage_size,
         detail::temp_storage::make_linear_partition(
-            // This is valid even with offset_scan_state_with_sleep_type
             detail::temp_storage::make_partition(&scan_state_storage, layout),
+            detail::temp_storage::ptr_aligned_array(&ordered_tile_id_storage,
+                                                    persistent ? 1 : 0),
             detail::temp_storage::ptr_aligned_array(&previous_last_element,
                                                     use_limited_size ? 1 : 0),
-            detail::temp_storage::ptr_aligned_array(&new_last_element, use_limited_size ? 1 : 0)));
+            detail::temp_storage::ptr_aligned_array(&new_last_element, use_limited_size ? 1 : 0),
+            detail::temp_storage::ptr_aligned_array(&stream_carry_in,
+                                                    stream_state != nullptr ? 1 : 0)));
     if(partition_result != hipSuccess || temporary_storage == nullptr)
     {
         return partition_result;
@@ -241,42 +492,90 @@ inline auto scan_impl(void*               temporary_storage,
     if( number_of_blocks == 0u )
         return hipSuccess;
 
-    if(number_of_blocks > 1 || use_limited_size)
+    if(stream_state != nullptr)
     {
-        bool use_sleep;
-        if(const hipError_t error = is_sleep_scan_state_used(stream, use_sleep))
-        {
-            return error;
-        }
+        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(stream_carry_in,
+                                               stream_state,
+                                               sizeof(*stream_state),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+    }
 
+    // The single block kernel does not carry the scan across chunks.
+    if(number_of_blocks > 1 || use_limited_size || stream_state != nullptr)
+    {
         // Create and initialize lookback_scan_state obj
         scan_state_type scan_state{};
-        hipError_t      result
-            = scan_state_type::create(scan_state, scan_state_storage, number_of_blocks, stream);
-        scan_state_with_sleep_type scan_state_with_sleep{};
-        result = scan_state_with_sleep_type::create(scan_state_with_sleep,
-                                                    scan_state_storage,
-                                                    number_of_blocks,
-                                                    stream);
-        if(result != hipSuccess)
-        {
-            return result;
-        }
+        ROCPRIM_RETURN_ON_ERROR(scan_state_type::create(scan_state,
+                                                        scan_state_storage,
+                                                        number_of_blocks,
+                                                        stream,
+                                                        params.backoff));
 
-        // Call the provided function with either scan_state or scan_state_with_sleep based on
-        // the value of use_sleep
-        auto with_scan_state
-            = [use_sleep, scan_state, scan_state_with_sleep](auto&& func) mutable -> decltype(auto)
+        if(persistent)
         {
-            if(use_sleep)
-            {
-                return func(scan_state_with_sleep);
-            }
-            else
+            const auto ordered_tile_id
+                = ordered_block_id<unsigned int>::create(ordered_tile_id_storage);
+
+            if(debug_synchronous) start = std::chrono::steady_clock::now();
+            const unsigned int init_grid_size = ceiling_div(number_of_blocks, block_size);
+            init_lookback_scan_state_kernel<<<dim3(init_grid_size),
+                                              dim3(block_size),
+                                              0,
+                                              stream>>>(scan_state,
+                                                        number_of_blocks,
+                                                        ordered_tile_id);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel",
+                                                        number_of_blocks,
+                                                        start);
+            const auto kernel = persistent_lookback_scan_kernel<Determinism,
+                                                                Exclusive,
+                                                                config,
+                                                                InputIterator,
+                                                                OutputIterator,
+                                                                BinaryFunction,
+                                                                InitValueType,
+                                                                AccType,
+                                                                scan_state_type>;
+            unsigned int grid_size;
+            ROCPRIM_RETURN_ON_ERROR(
+                persistent_grid_size(kernel, block_size, stream, grid_size));
+            grid_size = std::min(grid_size, number_of_blocks);
+
+            if(debug_synchronous)
             {
-                return func(scan_state);
+                std::cout << "persistent " << persistent << '\n';
+                std::cout << "size " << size << '\n';
+                std::cout << "block_size " << block_size << '\n';
+                std::cout << "number of tiles " << number_of_blocks << '\n';
+                std::cout << "grid_size " << grid_size << '\n';
+                std::cout << "items_per_block " << items_per_block << '\n';
+                start = std::chrono::steady_clock::now();
             }
-        };
+
+            persistent_lookback_scan_kernel<Determinism,
+                                            Exclusive,
+                                            config,
+                                            InputIterator,
+                                            OutputIterator,
+                                            BinaryFunction,
+                                            InitValueType,
+                                            AccType>
+                <<<dim3(grid_size), dim3(block_size), 0, stream>>>(input,
+                                                                   output,
+                                                                   size,
+                                                                   initial_value,
+                                                                   scan_op,
+                                                                   scan_state,
+                                                                   ordered_tile_id,
+                                                                   number_of_blocks,
+                                                                   stream_carry_in,
+                                                                   stream_state);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("persistent_lookback_scan_kernel",
+                                                        size,
+                                                        start);
+            return hipSuccess;
+        }
 
         if(debug_synchronous) start = std::chrono::steady_clock::now();
 
@@ -299,14 +598,10 @@ inline auto scan_impl(void*               temporary_storage,
                 std::cout << "items_per_block " << items_per_block << '\n';
             }
 
-            with_scan_state(
-                [&](const auto scan_state)
-                {
-                    init_lookback_scan_state_kernel<<<dim3(grid_size),
-                                                      dim3(block_size),
-                                                      0,
-                                                      stream>>>(scan_state, number_of_blocks);
-                });
+            init_lookback_scan_state_kernel<<<dim3(grid_size),
+                                              dim3(block_size),
+                                              0,
+                                              stream>>>(scan_state, number_of_blocks);
             ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel",
                                                         number_of_blocks,
                                                         start);
@@ -324,29 +619,30 @@ inline auto scan_impl(void*               temporary_storage,
                 std::cout << "items_per_block " << items_per_block << '\n';
             }
 
-            with_scan_state(
-                [&](const auto scan_state)
-                {
-                    lookback_scan_kernel<Determinism,
-                                         Exclusive,
-                                         config,
-                                         InputIterator,
-                                         OutputIterator,
-                                         BinaryFunction,
-                                         InitValueType,
-                                         AccType>
-                        <<<dim3(grid_size), dim3(block_size), 0, stream>>>(input + offset,
-                                                                           output + offset,
-                                                                           current_size,
-                                                                           initial_value,
-                                                                           scan_op,
-                                                                           scan_state,
-                                                                           number_of_blocks,
-                                                                           previous_last_element,
-                                                                           new_last_element,
-                                                                           i != size_t(0),
-                                                                           number_of_launch > 1);
-                });
+            lookback_scan_kernel<Determinism,
+                                 Exclusive,
+                                 config,
+                                 InputIterator,
+                                 OutputIterator,
+                                 BinaryFunction,
+                                 InitValueType,
+                                 AccType>
+                <<<dim3(grid_size), dim3(block_size), 0, stream>>>(input + offset,
+                                                                   output + offset,
+                                                                   current_size,
+                                                                   initial_value,
+                                                                   scan_op,
+                                                                   scan_state,
+                                                                   number_of_blocks,
+                                                                   previous_last_element,
+                                                                   new_last_element,
+                                                                   i != size_t(0),
+                                                                   number_of_launch > 1,
+                                                                   i == 0 ? stream_carry_in
+                                                                          : nullptr,
+                                                                   i + 1 == number_of_launch
+                                                                       ? stream_state
+                                                                       : nullptr);
             ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("lookback_scan_kernel", current_size, start);
 
             // Swap the last_elements
@@ -386,6 +682,186 @@ inline auto scan_impl(void*               temporary_storage,
     return hipSuccess;
 }
 
+template<lookback_scan_determinism Determinism,
+         bool                      Exclusive,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction,
+         class AccType,
+         class TuningType = AccType>
+inline hipError_t scan_impl(void*                       temporary_storage,
+                            size_t&                     storage_size,
+                            InputIterator               input,
+                            OutputIterator              output,
+                            const InitValueType         initial_value,
+                            const size_t                size,
+                            BinaryFunction              scan_op,
+                            const hipStream_t           stream,
+                            bool                        debug_synchronous,
+                            scan_stream_state<AccType>* stream_state = nullptr)
+{
+    return dispatch_tuned_config<Config, TuningType, empty_type>(
+        "scan",
+        size,
+        stream,
+        [&](auto config)
+        {
+            return scan_config_impl<Determinism,
+                                    Exclusive,
+                                    typename decltype(config)::type,
+                                    InputIterator,
+                                    OutputIterator,
+                                    InitValueType,
+                                    BinaryFunction,
+                                    AccType,
+                                    TuningType>(temporary_storage,
+                                             storage_size,
+                                             input,
+                                             output,
+                                             initial_value,
+                                             size,
+                                             scan_op,
+                                             stream,
+                                             debug_synchronous,
+                                             stream_state);
+        });
+}
+
+// The input of inclusive_exclusive_scan: the initial value followed by the input values, so the
+// inclusive scan of the size + 1 items gives the exclusive results followed by the total.
+template<class InputIterator, class InitValueType, class AccType>
+struct inclusive_exclusive_scan_input_op
+{
+    InputIterator input;
+    InitValueType initial_value;
+
+    ROCPRIM_HOST_DEVICE inline AccType operator()(const size_t index) const
+    {
+        return index == 0 ? static_cast<AccType>(get_input_value(initial_value))
+                          : static_cast<AccType>(input[index - 1]);
+    }
+};
+
+// Stores the item of the combined scan at index to the exclusive output at index, to the
+// inclusive output at index - 1 and, for the last item, to the total.
+template<class ExclusiveOutputIterator, class InclusiveOutputIterator, class TotalOutputIterator>
+class inclusive_exclusive_scan_output_reference
+{
+public:
+    ROCPRIM_HOST_DEVICE inline inclusive_exclusive_scan_output_reference(
+        ExclusiveOutputIterator exclusive_output,
+        InclusiveOutputIterator inclusive_output,
+        TotalOutputIterator     total_output,
+        size_t                  index,
+        size_t                  size)
+        : exclusive_output_(exclusive_output)
+        , inclusive_output_(inclusive_output)
+        , total_output_(total_output)
+        , index_(index)
+        , size_(size)
+    {}
+
+    template<class V>
+    ROCPRIM_HOST_DEVICE inline inclusive_exclusive_scan_output_reference&
+        operator=(const V& value)
+    {
+        if(index_ < size_)
+        {
+            exclusive_output_[index_] = value;
+        }
+        else
+        {
+            *total_output_ = value;
+        }
+        if(index_ > 0)
+        {
+            inclusive_output_[index_ - 1] = value;
+        }
+        return *this;
+    }
+
+private:
+    ExclusiveOutputIterator exclusive_output_;
+    InclusiveOutputIterator inclusive_output_;
+    TotalOutputIterator     total_output_;
+    size_t                  index_;
+    size_t                  size_;
+};
+
+template<class ExclusiveOutputIterator, class InclusiveOutputIterator, class TotalOutputIterator>
+class inclusive_exclusive_scan_output_iterator
+{
+public:
+    using value_type        = void;
+    using reference         = inclusive_exclusive_scan_output_reference<ExclusiveOutputIterator,
+                                                                        InclusiveOutputIterator,
+                                                                        TotalOutputIterator>;
+    using pointer           = void;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    ROCPRIM_HOST_DEVICE inline inclusive_exclusive_scan_output_iterator(
+        ExclusiveOutputIterator exclusive_output,
+        InclusiveOutputIterator inclusive_output,
+        TotalOutputIterator     total_output,
+        size_t                  size,
+        size_t                  index = 0)
+        : exclusive_output_(exclusive_output)
+        , inclusive_output_(inclusive_output)
+        , total_output_(total_output)
+        , size_(size)
+        , index_(index)
+    {}
+
+    ROCPRIM_HOST_DEVICE inline reference operator*() const
+    {
+        return reference(exclusive_output_, inclusive_output_, total_output_, index_, size_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline reference operator[](difference_type distance) const
+    {
+        return *(*this + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline inclusive_exclusive_scan_output_iterator
+        operator+(difference_type distance) const
+    {
+        return inclusive_exclusive_scan_output_iterator(exclusive_output_,
+                                                        inclusive_output_,
+                                                        total_output_,
+                                                        size_,
+                                                        index_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline inclusive_exclusive_scan_output_iterator&
+        operator+=(difference_type distance)
+    {
+        index_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline inclusive_exclusive_scan_output_iterator& operator++()
+    {
+        index_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline difference_type
+        operator-(inclusive_exclusive_scan_output_iterator other) const
+    {
+        return static_cast<difference_type>(index_ - other.index_);
+    }
+
+private:
+    ExclusiveOutputIterator exclusive_output_;
+    InclusiveOutputIterator inclusive_output_;
+    TotalOutputIterator     total_output_;
+    size_t                  size_;
+    size_t                  index_;
+};
+
 
 #undef ROCPRIM_DETAIL_HIP_SYNC
 
@@ -411,7 +887,8 @@ inline auto scan_impl(void*               temporary_storage,
 /// * By default, the input type is used for accumulation. A custom type
 /// can be specified using the \p AccType type parameter, see the example below.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `scan_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `scan_config`
+/// or a `tuned_config` of these.
 /// \tparam InputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
@@ -511,14 +988,14 @@ template<class Config = default_config,
          class BinaryFunction
          = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
          class AccType = typename std::iterator_traits<InputIterator>::value_type>
-inline hipError_t inclusive_scan(void*             temporary_storage,
-                                 size_t&           storage_size,
-                                 InputIterator     input,
-                                 OutputIterator    output,
-                                 const size_t      size,
-                                 BinaryFunction    scan_op           = BinaryFunction(),
-                                 const hipStream_t stream            = 0,
-                                 bool              debug_synchronous = false)
+hipError_t inclusive_scan(void*             temporary_storage,
+                          size_t&           storage_size,
+                          InputIterator     input,
+                          OutputIterator    output,
+                          const size_t      size,
+                          BinaryFunction    scan_op           = BinaryFunction(),
+                          const hipStream_t stream            = 0,
+                          bool              debug_synchronous = false)
 {
     // input_type() is a dummy initial value (not used)
     return detail::scan_impl<detail::lookback_scan_determinism::default_determinism,
@@ -545,7 +1022,8 @@ inline hipError_t inclusive_scan(void*             temporary_storage,
 /// <tt>inclusive_scan()</tt>, it provides run-to-run deterministic behavior for
 /// non-associative scan operators like floating point arithmetic operations.
 /// Refer to the documentation for \link inclusive_scan() rocprim::inclusive_scan \endlink
-/// for a detailed description of this function.
+/// for a detailed description of this function. Inputs of a moderate number of tiles are
+/// scanned in two passes without look-back, see the \p TwoPass parameter of \p scan_config.
 template<class Config = default_config,
          class InputIterator,
          class OutputIterator,
@@ -597,7 +1075,8 @@ inline hipError_t deterministic_inclusive_scan(void*             temporary_stora
 /// if \p temporary_storage in a null pointer.
 /// * Ranges specified by \p input and \p output must have at least \p size elements.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `scan_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `scan_config`
+/// or a `tuned_config` of these.
 /// \tparam InputIterator - random-access iterator type of the input range. Must meet the
 /// requirements of a C++ InputIterator concept. It can be a simple pointer type.
 /// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
@@ -677,15 +1156,15 @@ template<class Config = default_config,
          class BinaryFunction
          = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
          class AccType = detail::input_type_t<InitValueType>>
-inline hipError_t exclusive_scan(void*               temporary_storage,
-                                 size_t&             storage_size,
-                                 InputIterator       input,
-                                 OutputIterator      output,
-                                 const InitValueType initial_value,
-                                 const size_t        size,
-                                 BinaryFunction      scan_op           = BinaryFunction(),
-                                 const hipStream_t   stream            = 0,
-                                 bool                debug_synchronous = false)
+hipError_t exclusive_scan(void*               temporary_storage,
+                          size_t&             storage_size,
+                          InputIterator       input,
+                          OutputIterator      output,
+                          const InitValueType initial_value,
+                          const size_t        size,
+                          BinaryFunction      scan_op           = BinaryFunction(),
+                          const hipStream_t   stream            = 0,
+                          bool                debug_synchronous = false)
 {
     return detail::scan_impl<detail::lookback_scan_determinism::default_determinism,
                              true,
@@ -711,7 +1190,8 @@ inline hipError_t exclusive_scan(void*               temporary_storage,
 /// <tt>exclusive_scan()</tt>, it provides run-to-run deterministic behavior for
 /// non-associative scan operators like floating point arithmetic operations.
 /// Refer to the documentation for \link exclusive_scan() rocprim::exclusive_scan \endlink
-/// for a detailed description of this function.
+/// for a detailed description of this function. Inputs of a moderate number of tiles are
+/// scanned in two passes without look-back, see the \p TwoPass parameter of \p scan_config.
 template<class Config = default_config,
          class InputIterator,
          class OutputIterator,
@@ -747,6 +1227,568 @@ inline hipError_t deterministic_exclusive_scan(void*               temporary_sto
                                       debug_synchronous);
 }
 
+/// \brief The carry of a scan over a stream of chunks, see \p streaming_inclusive_scan.
+///
+/// It lives in device memory and must be zeroed, e.g. with \p hipMemsetAsync, before the first
+/// chunk. \p carry is the reduction of all scanned chunks, \p has_carry is nonzero once a chunk
+/// has been scanned.
+///
+/// \tparam T - accumulator type of the scan.
+template<class T>
+using scan_stream_state = detail::scan_stream_state<T>;
+
+/// \brief Parallel inclusive scan of one chunk of a stream for device level.
+///
+/// \p streaming_inclusive_scan scans the chunks of an input that arrives piece by piece as one
+/// input: the outputs of a chunk include the reduction of all preceding chunks. The reduction is
+/// kept in \p state, which is read when the chunk is scanned, like a \p rocprim::future_value,
+/// and updated with the reduction of the chunk. The chunks can be enqueued back to back on
+/// \p stream without synchronizing the host and without additional passes over the outputs.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p state must be zeroed before the first chunk. The first chunk is scanned like by
+/// \p inclusive_scan.
+/// * Chunks with the same \p state must be scanned in order, e.g. on the same \p stream.
+/// * An empty chunk leaves \p state unchanged.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p scan_config
+/// or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccType - accumulator type of the scan, deduced from \p state.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element of the chunk.
+/// \param [out] output - iterator to the first element in the output range of the chunk.
+/// \param [in] size - number of elements in the chunk.
+/// \param [in,out] state - pointer to the carry of the stream in device memory.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// Default is BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a stream of two chunks is scanned.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// int * chunk0;   // e.g., [1, 2, 3]
+/// int * chunk1;   // e.g., [4, 5]
+/// int * output0;  // empty array of 3 elements
+/// int * output1;  // empty array of 2 elements
+/// rocprim::scan_stream_state<int> * state; // device memory
+/// hipMemset(state, 0, sizeof(*state));
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::streaming_inclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes, chunk0, output0, 3, state
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // scan the chunks
+/// rocprim::streaming_inclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes, chunk0, output0, 3, state
+/// );
+/// rocprim::streaming_inclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes, chunk1, output1, 2, state
+/// );
+/// // output0: [1, 3, 6]
+/// // output1: [10, 15]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class AccType,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t streaming_inclusive_scan(void*                       temporary_storage,
+                                           size_t&                     storage_size,
+                                           InputIterator               input,
+                                           OutputIterator              output,
+                                           const size_t                size,
+                                           scan_stream_state<AccType>* state,
+                                           BinaryFunction              scan_op = BinaryFunction(),
+                                           const hipStream_t           stream  = 0,
+                                           bool                        debug_synchronous = false)
+{
+    return detail::scan_impl<detail::lookback_scan_determinism::default_determinism,
+                             false,
+                             Config,
+                             InputIterator,
+                             OutputIterator,
+                             AccType,
+                             BinaryFunction,
+                             AccType>(temporary_storage,
+                                      storage_size,
+                                      input,
+                                      output,
+                                      AccType{},
+                                      size,
+                                      scan_op,
+                                      stream,
+                                      debug_synchronous,
+                                      state);
+}
+
+/// \brief Parallel exclusive scan of one chunk of a stream for device level.
+///
+/// The same as \p streaming_inclusive_scan, except that the outputs are exclusive and
+/// \p initial_value is the initial value of the first chunk. The carry in \p state is the
+/// reduction of \p initial_value and of all inputs of the preceding chunks, so the next
+/// chunk starts with the last output of this chunk combined with its last input.
+///
+/// \param [in] initial_value - initial value of the scan of the first chunk, i.e. of a zeroed
+/// \p state. It is ignored for the following chunks. A \p rocprim::future_value may be passed
+/// to use a value that will be later computed.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class AccType,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t streaming_exclusive_scan(void*                       temporary_storage,
+                                           size_t&                     storage_size,
+                                           InputIterator               input,
+                                           OutputIterator              output,
+                                           const InitValueType         initial_value,
+                                           const size_t                size,
+                                           scan_stream_state<AccType>* state,
+                                           BinaryFunction              scan_op = BinaryFunction(),
+                                           const hipStream_t           stream  = 0,
+                                           bool                        debug_synchronous = false)
+{
+    return detail::scan_impl<detail::lookback_scan_determinism::default_determinism,
+                             true,
+                             Config,
+                             InputIterator,
+                             OutputIterator,
+                             InitValueType,
+                             BinaryFunction,
+                             AccType>(temporary_storage,
+                                      storage_size,
+                                      input,
+                                      output,
+                                      initial_value,
+                                      size,
+                                      scan_op,
+                                      stream,
+                                      debug_synchronous,
+                                      state);
+}
+
+/// \brief Parallel transform-inclusive scan primitive for device level.
+///
+/// transform_inclusive_scan function applies \p transform_op to every element of \p input and
+/// performs a device-wide inclusive prefix scan of the results using binary \p scan_op operator.
+/// The transformed values are not stored in memory. This is equivalent to calling inclusive_scan
+/// with a <tt>rocprim::transform_iterator</tt>, except that the default configuration is
+/// selected for the input type instead of the transformed type. When \p input is a pointer, its
+/// values are read with vector loads of the input type and transformed after loading.
+///
+/// \par Overview
+/// * Supports non-commutative scan operators. However, a scan operator should be
+/// associative.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+/// * The result of \p transform_op is used for accumulation.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `scan_config`
+/// or a `tuned_config` of these.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for scan.
+/// \tparam UnaryFunction - type of unary function applied to the input values.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to scan.
+/// \param [out] output - iterator to the first element in the output range. It can be
+/// same as \p input.
+/// \param [in] size - number of element in the input range.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// \param [in] transform_op - unary operation function object applied to every input value.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const U &a);</tt>, where \p U is the \p value_type of \p InputIterator.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the running count of non-zero <tt>unsigned char</tt> values is computed.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;       // e.g., 6
+/// unsigned char * input;   // e.g., [3, 0, 7, 1, 0, 2]
+/// unsigned int * output;   // empty array of 6 elements
+///
+/// auto non_zero = [] __device__ (unsigned char x) -> unsigned int { return x != 0; };
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::transform_inclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, rocprim::plus<unsigned int>(), non_zero
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform scan
+/// rocprim::transform_inclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size, rocprim::plus<unsigned int>(), non_zero
+/// );
+/// // output: [1, 1, 2, 3, 3, 4]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction,
+         class UnaryFunction>
+inline hipError_t transform_inclusive_scan(void*             temporary_storage,
+                                           size_t&           storage_size,
+                                           InputIterator     input,
+                                           OutputIterator    output,
+                                           const size_t      size,
+                                           BinaryFunction    scan_op,
+                                           UnaryFunction     transform_op,
+                                           const hipStream_t stream            = 0,
+                                           bool              debug_synchronous = false)
+{
+    using input_type     = typename std::iterator_traits<InputIterator>::value_type;
+    using transform_type = ::rocprim::transform_iterator<InputIterator, UnaryFunction>;
+    using acc_type       = typename std::iterator_traits<transform_type>::value_type;
+
+    return detail::scan_impl<detail::lookback_scan_determinism::default_determinism,
+                             false,
+                             Config,
+                             transform_type,
+                             OutputIterator,
+                             acc_type,
+                             BinaryFunction,
+                             acc_type,
+                             input_type>(temporary_storage,
+                                         storage_size,
+                                         transform_type(input, transform_op),
+                                         output,
+                                         acc_type{},
+                                         size,
+                                         scan_op,
+                                         stream,
+                                         debug_synchronous);
+}
+
+/// \brief Parallel transform-exclusive scan primitive for device level.
+///
+/// transform_exclusive_scan function applies \p transform_op to every element of \p input and
+/// performs a device-wide exclusive prefix scan of the results using binary \p scan_op operator.
+/// The transformed values are not stored in memory. This is equivalent to calling exclusive_scan
+/// with a <tt>rocprim::transform_iterator</tt>, except that the default configuration is
+/// selected for the input type instead of the transformed type. When \p input is a pointer, its
+/// values are read with vector loads of the input type and transformed after loading.
+///
+/// \par Overview
+/// * Supports non-commutative scan operators. However, a scan operator should be
+/// associative.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+/// * By default, the type of \p initial_value is used for accumulation.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `scan_config`
+/// or a `tuned_config` of these.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for scan.
+/// \tparam UnaryFunction - type of unary function applied to the input values.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to scan.
+/// \param [out] output - iterator to the first element in the output range. It can be
+/// same as \p input.
+/// \param [in] initial_value - initial value to start the scan.
+/// \param [in] size - number of element in the input range.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// \param [in] transform_op - unary operation function object applied to every input value.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const U &a);</tt>, where \p U is the \p value_type of \p InputIterator.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the output offsets of the non-zero <tt>unsigned char</tt> values are computed.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;       // e.g., 6
+/// unsigned char * input;   // e.g., [3, 0, 7, 1, 0, 2]
+/// unsigned int * output;   // empty array of 6 elements
+///
+/// auto non_zero = [] __device__ (unsigned char x) -> unsigned int { return x != 0; };
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::transform_exclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, 0u, input_size, rocprim::plus<unsigned int>(), non_zero
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform scan
+/// rocprim::transform_exclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, 0u, input_size, rocprim::plus<unsigned int>(), non_zero
+/// );
+/// // output: [0, 1, 1, 2, 3, 3]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction,
+         class UnaryFunction>
+inline hipError_t transform_exclusive_scan(void*               temporary_storage,
+                                           size_t&             storage_size,
+                                           InputIterator       input,
+                                           OutputIterator      output,
+                                           const InitValueType initial_value,
+                                           const size_t        size,
+                                           BinaryFunction      scan_op,
+                                           UnaryFunction       transform_op,
+                                           const hipStream_t   stream            = 0,
+                                           bool                debug_synchronous = false)
+{
+    using input_type     = typename std::iterator_traits<InputIterator>::value_type;
+    using transform_type = ::rocprim::transform_iterator<InputIterator, UnaryFunction>;
+    using acc_type       = detail::input_type_t<InitValueType>;
+
+    return detail::scan_impl<detail::lookback_scan_determinism::default_determinism,
+                             true,
+                             Config,
+                             transform_type,
+                             OutputIterator,
+                             InitValueType,
+                             BinaryFunction,
+                             acc_type,
+                             input_type>(temporary_storage,
+                                         storage_size,
+                                         transform_type(input, transform_op),
+                                         output,
+                                         initial_value,
+                                         size,
+                                         scan_op,
+                                         stream,
+                                         debug_synchronous);
+}
+
+/// \brief Parallel scan primitive for device level that stores the inclusive results, the
+/// exclusive results and the total of the scan in one pass.
+///
+/// The result is the same as of an exclusive scan of \p input starting with \p initial_value
+/// into \p exclusive_output, an inclusive scan starting with \p initial_value into
+/// \p inclusive_output and a reduction of all values and \p initial_value into
+/// \p total_output. Offsets and ends of buckets, e.g. of counting and scatter pipelines, are
+/// computed by one call instead of two scans or a scan and a reduction.
+///
+/// \par Overview
+/// * Supports non-commutative scan operators. However, a scan operator should be
+/// associative.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input, \p exclusive_output and \p inclusive_output must have at
+/// least \p size elements. The initial value followed by the input is scanned by one lookback
+/// scan of <tt>size + 1</tt> items, and every scanned item is stored to both outputs.
+/// * The outputs must not overlap \p input.
+/// * \p total_output is written even if \p size is \p 0, then it is \p initial_value. It can be
+/// read by following calls through a \p rocprim::future_value.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `scan_config`
+/// or a `tuned_config` of these.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ExclusiveOutputIterator - random-access iterator type of the exclusive output range.
+/// \tparam InclusiveOutputIterator - random-access iterator type of the inclusive output range.
+/// \tparam TotalOutputIterator - random-access iterator type of the output of the total.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccType - accumulator type used to propagate the scanned values. Default type
+/// is 'InitValueType', unless it's 'rocprim::future_value'. Then it will be the wrapped input type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to scan.
+/// \param [out] exclusive_output - iterator to the first element of the exclusive results.
+/// \param [out] inclusive_output - iterator to the first element of the inclusive results.
+/// \param [out] total_output - iterator to the reduction of \p initial_value and all values.
+/// \param [in] initial_value - initial value to start the scan.
+/// A rocpim::future_value may be passed to use a value that will be later computed.
+/// \param [in] size - number of element in the input range.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;          // e.g., 5
+/// unsigned int * counts;      // e.g., [3, 0, 2, 4, 1]
+/// unsigned int * begins;      // empty array of 5 elements
+/// unsigned int * ends;        // empty array of 5 elements
+/// unsigned int * total;       // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::inclusive_exclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     counts, begins, ends, total, 0u, input_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform scan
+/// rocprim::inclusive_exclusive_scan(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     counts, begins, ends, total, 0u, input_size
+/// );
+/// // begins: [0, 3, 3, 5, 9]
+/// // ends:   [3, 3, 5, 9, 10]
+/// // total:  [10]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class ExclusiveOutputIterator,
+         class InclusiveOutputIterator,
+         class TotalOutputIterator,
+         class InitValueType,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+         class AccType = detail::input_type_t<InitValueType>>
+inline hipError_t inclusive_exclusive_scan(void*                   temporary_storage,
+                                           size_t&                 storage_size,
+                                           InputIterator           input,
+                                           ExclusiveOutputIterator exclusive_output,
+                                           InclusiveOutputIterator inclusive_output,
+                                           TotalOutputIterator     total_output,
+                                           const InitValueType     initial_value,
+                                           const size_t            size,
+                                           BinaryFunction          scan_op = BinaryFunction(),
+                                           const hipStream_t       stream  = 0,
+                                           bool                    debug_synchronous = false)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using input_op
+        = detail::inclusive_exclusive_scan_input_op<InputIterator, InitValueType, AccType>;
+    using combined_input_type
+        = ::rocprim::transform_iterator<::rocprim::counting_iterator<size_t>, input_op, AccType>;
+    using combined_output_type
+        = detail::inclusive_exclusive_scan_output_iterator<ExclusiveOutputIterator,
+                                                           InclusiveOutputIterator,
+                                                           TotalOutputIterator>;
+
+    return detail::scan_impl<detail::lookback_scan_determinism::default_determinism,
+                             false,
+                             Config,
+                             combined_input_type,
+                             combined_output_type,
+                             AccType,
+                             BinaryFunction,
+                             AccType,
+                             input_type>(
+        temporary_storage,
+        storage_size,
+        combined_input_type(::rocprim::counting_iterator<size_t>(0),
+                            input_op{input, initial_value}),
+        combined_output_type(exclusive_output, inclusive_output, total_output, size),
+        AccType{},
+        size + 1,
+        scan_op,
+        stream,
+        debug_synchronous);
+}
+
+#if defined(ROCPRIM_USE_PREBUILT) && !defined(DOXYGEN_SHOULD_SKIP_THIS)
+ROCPRIM_DETAIL_PREBUILT_SCAN(extern template)
+#endif
+
 /// @}
 // end of group devicemodule
 
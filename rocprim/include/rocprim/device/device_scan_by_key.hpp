@@ -32,13 +32,18 @@
 #include "detail/config/device_scan_by_key.hpp"
 #include "detail/device_config_helper.hpp"
 #include "detail/device_scan_by_key.hpp"
+#include "detail/device_scan_two_pass.hpp"
 #include "detail/lookback_scan_state.hpp"
 #include "device_scan_by_key_config.hpp"
+#include "execution_budget.hpp"
+#include "tuning_database.hpp"
 
 #include <hip/hip_runtime.h>
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <type_traits>
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -84,9 +89,111 @@ void __global__ __launch_bounds__(device_params<Config>().kernel_config.block_si
         previous_last_value);
 }
 
-
 template<lookback_scan_determinism Determinism,
          bool                      Exclusive,
+         typename Config,
+         typename KeyInputIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename InitialValueType,
+         typename CompareFunction,
+         typename BinaryFunction,
+         typename LookbackScanState,
+         typename AccType>
+void __global__ __launch_bounds__(device_params<Config>().kernel_config.block_size)
+    persistent_device_scan_by_key_kernel(const KeyInputIterator         keys,
+                                         const InputIterator            values,
+                                         const OutputIterator           output,
+                                         const InitialValueType         initial_value,
+                                         const CompareFunction          compare,
+                                         const BinaryFunction           scan_op,
+                                         const LookbackScanState        scan_state,
+                                         ordered_block_id<unsigned int> ordered_tile_id,
+                                         const size_t                   size,
+                                         const unsigned int             number_of_tiles)
+{
+    persistent_device_scan_by_key_kernel_impl<Determinism, Exclusive, Config>(
+        keys,
+        values,
+        output,
+        static_cast<AccType>(get_input_value(initial_value)),
+        compare,
+        scan_op,
+        scan_state,
+        ordered_tile_id,
+        size,
+        number_of_tiles);
+}
+
+template<bool Exclusive,
+         typename Config,
+         typename KeyInputIterator,
+         typename InputIterator,
+         typename InitialValueType,
+         typename CompareFunction,
+         typename BinaryFunction,
+         typename AccType>
+void __global__ __launch_bounds__(device_params<Config>().kernel_config.block_size)
+    two_pass_scan_by_key_reduce_kernel(const KeyInputIterator           keys,
+                                       const InputIterator              values,
+                                       const InitialValueType           initial_value,
+                                       const CompareFunction            compare,
+                                       const BinaryFunction             scan_op,
+                                       const size_t                     size,
+                                       const size_t                     tiles_per_partition,
+                                       const size_t                     number_of_tiles,
+                                       ::rocprim::tuple<AccType, bool>* partition_reductions)
+{
+    two_pass_scan_by_key_reduce_kernel_impl<Exclusive, Config>(
+        keys,
+        values,
+        static_cast<AccType>(get_input_value(initial_value)),
+        compare,
+        scan_op,
+        size,
+        tiles_per_partition,
+        number_of_tiles,
+        partition_reductions);
+}
+
+template<bool Exclusive,
+         typename Config,
+         typename KeyInputIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename InitialValueType,
+         typename CompareFunction,
+         typename BinaryFunction,
+         typename AccType>
+void __global__ __launch_bounds__(device_params<Config>().kernel_config.block_size)
+    two_pass_scan_by_key_kernel(const KeyInputIterator                       keys,
+                                const InputIterator                          values,
+                                const OutputIterator                         output,
+                                const InitialValueType                       initial_value,
+                                const CompareFunction                        compare,
+                                const BinaryFunction                         scan_op,
+                                const ::rocprim::tuple<AccType, bool>* const partition_prefixes,
+                                const size_t                                 size,
+                                const size_t                                 tiles_per_partition,
+                                const size_t                                 number_of_tiles)
+{
+    two_pass_scan_by_key_kernel_impl<Exclusive, Config>(
+        keys,
+        values,
+        output,
+        static_cast<AccType>(get_input_value(initial_value)),
+        compare,
+        scan_op,
+        partition_prefixes,
+        size,
+        tiles_per_partition,
+        number_of_tiles);
+}
+
+// Scans at least two tiles by key without look-back, see two_pass_scan_impl. The segment flags
+// make the scan of the (value, flag) pairs associative, so the flagged partition reductions are
+// scanned like the values of a scan.
+template<bool Exclusive,
          typename Config,
          typename KeysInputIterator,
          typename InputIterator,
@@ -95,17 +202,160 @@ template<lookback_scan_determinism Determinism,
          typename BinaryFunction,
          typename CompareFunction,
          typename AccType>
-inline hipError_t scan_by_key_impl(void* const           temporary_storage,
-                                   size_t&               storage_size,
-                                   KeysInputIterator     keys,
-                                   InputIterator         input,
-                                   OutputIterator        output,
-                                   const InitValueType   initial_value,
-                                   const size_t          size,
-                                   const BinaryFunction  scan_op,
-                                   const CompareFunction compare,
-                                   const hipStream_t     stream,
-                                   const bool            debug_synchronous)
+inline hipError_t two_pass_scan_by_key_impl(void* const                     temporary_storage,
+                                            size_t&                         storage_size,
+                                            KeysInputIterator               keys,
+                                            InputIterator                   input,
+                                            OutputIterator                  output,
+                                            const InitValueType             initial_value,
+                                            const size_t                    size,
+                                            const BinaryFunction            scan_op,
+                                            const CompareFunction           compare,
+                                            const scan_by_key_config_params params,
+                                            const hipStream_t               stream,
+                                            const bool                      debug_synchronous)
+{
+    using wrapped_type = ::rocprim::tuple<AccType, bool>;
+
+    const unsigned int block_size       = params.kernel_config.block_size;
+    const unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    const unsigned int items_per_block  = block_size * items_per_thread;
+    const size_t       number_of_tiles  = ceiling_div(size, items_per_block);
+
+    // The partition reductions are scanned by one block, so there are at most items_per_block
+    // partitions. The partitions only depend on the size and the config, not on the occupancy,
+    // so that deterministic scans give the same result on every stream.
+    const size_t max_partitions = std::min<size_t>(number_of_tiles, items_per_block);
+    const size_t tiles_per_partition = ceiling_div(number_of_tiles, max_partitions);
+    const unsigned int number_of_partitions
+        = static_cast<unsigned int>(ceiling_div(number_of_tiles, tiles_per_partition));
+
+    wrapped_type* partition_reductions;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&partition_reductions, max_partitions)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    const auto kernel = two_pass_scan_by_key_kernel<Exclusive,
+                                                    Config,
+                                                    KeysInputIterator,
+                                                    InputIterator,
+                                                    OutputIterator,
+                                                    InitValueType,
+                                                    CompareFunction,
+                                                    BinaryFunction,
+                                                    AccType>;
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        std::cout << "----------------------------------\n";
+        std::cout << "size:                 " << size << '\n';
+        std::cout << "number of tiles:      " << number_of_tiles << '\n';
+        std::cout << "number of partitions: " << number_of_partitions << '\n';
+        std::cout << "tiles per partition:  " << tiles_per_partition << '\n';
+        std::cout << "block_size:           " << block_size << '\n';
+        std::cout << "items_per_block:      " << items_per_block << '\n';
+        std::cout << "----------------------------------\n";
+    }
+
+    if(number_of_partitions > 1)
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(two_pass_scan_by_key_reduce_kernel<Exclusive, Config>),
+            dim3(number_of_partitions - 1),
+            dim3(block_size),
+            0,
+            stream,
+            keys,
+            input,
+            initial_value,
+            compare,
+            scan_op,
+            size,
+            tiles_per_partition,
+            number_of_tiles,
+            partition_reductions);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("two_pass_scan_by_key_reduce_kernel",
+                                                    (number_of_partitions - 1)
+                                                        * tiles_per_partition * items_per_block,
+                                                    start);
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(two_pass_scan_partitions_kernel<Config>),
+                           dim3(1),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           partition_reductions,
+                           number_of_partitions - 1,
+                           headflag_scan_op_wrapper<AccType, bool, BinaryFunction>{scan_op});
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("two_pass_scan_partitions_kernel",
+                                                    number_of_partitions - 1,
+                                                    start);
+    }
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    hipLaunchKernelGGL(kernel,
+                       dim3(number_of_partitions),
+                       dim3(block_size),
+                       0,
+                       stream,
+                       keys,
+                       input,
+                       output,
+                       initial_value,
+                       compare,
+                       scan_op,
+                       as_const_ptr(partition_reductions),
+                       size,
+                       tiles_per_partition,
+                       number_of_tiles);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("two_pass_scan_by_key_kernel", size, start);
+    return hipSuccess;
+}
+
+
+template<lookback_scan_determinism Determinism,
+         bool                      Exclusive,
+         typename Config,
+         typename KeysInputIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename InitValueType,
+         typename BinaryFunction,
+         typename CompareFunction,
+         typename AccType,
+         lookback_scan_state_layout Layout
+         = default_lookback_scan_state_layout<::rocprim::tuple<AccType, bool>>()>
+inline hipError_t scan_by_key_config_impl(void* const           temporary_storage,
+                                          size_t&               storage_size,
+                                          KeysInputIterator     keys,
+                                          InputIterator         input,
+                                          OutputIterator        output,
+                                          const InitValueType   initial_value,
+                                          const size_t          size,
+                                          const BinaryFunction  scan_op,
+                                          const CompareFunction compare,
+                                          const hipStream_t     stream,
+                                          const bool            debug_synchronous)
 {
     using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
 
@@ -121,25 +371,67 @@ inline hipError_t scan_by_key_impl(void* const           temporary_storage,
 
     using wrapped_type = ::rocprim::tuple<AccType, bool>;
 
-    using scan_state_type            = detail::lookback_scan_state<wrapped_type>;
-    using scan_state_with_sleep_type = detail::lookback_scan_state<wrapped_type, true>;
+    using scan_state_type = detail::lookback_scan_state<wrapped_type, Layout>;
 
     const unsigned int block_size       = params.kernel_config.block_size;
     const unsigned int items_per_thread = params.kernel_config.items_per_thread;
     const unsigned int items_per_block  = block_size * items_per_thread;
 
-    const unsigned int size_limit = params.kernel_config.size_limit;
+    const unsigned int size_limit = static_cast<unsigned int>(
+        budgeted_size_limit(stream, params.kernel_config.size_limit, items_per_block));
     const unsigned int aligned_size_limit
         = std::max(size_limit - size_limit % items_per_block, items_per_block);
 
     const unsigned int limited_size
         = static_cast<unsigned int>(std::min<size_t>(size, aligned_size_limit));
-    const bool use_limited_size = limited_size == aligned_size_limit;
+
+    // A persistent grid scans all tiles in one launch, as long as the tile ids fit the scan state.
+    // It is used if the config asks for it, and for inputs that would need several launches of
+    // at most size_limit items, each waiting for the previous one and carrying its last value.
+    // Its scan state holds all tiles, so streams that minimize memory use the launches.
+    const size_t number_of_tiles = ceiling_div(size, items_per_block);
+    const bool   persistent
+        = (params.persistent || size > aligned_size_limit) && !minimizes_memory(stream)
+          && number_of_tiles > 1 && number_of_tiles <= std::numeric_limits<unsigned int>::max();
+    const bool use_limited_size = !persistent && limited_size == aligned_size_limit;
+
+    // The two-pass scan is used if the config asks for it and by deterministic scans of up to
+    // two_pass_scan_max_auto_tiles tiles, where it is faster than the deterministic look-back.
+    const bool two_pass
+        = (params.two_pass
+           || (Determinism == lookback_scan_determinism::deterministic
+               && number_of_tiles <= two_pass_scan_max_auto_tiles))
+          && number_of_tiles > 1 && number_of_tiles <= std::numeric_limits<unsigned int>::max();
+    if(two_pass)
+    {
+        return two_pass_scan_by_key_impl<Exclusive,
+                                         config,
+                                         KeysInputIterator,
+                                         InputIterator,
+                                         OutputIterator,
+                                         InitValueType,
+                                         BinaryFunction,
+                                         CompareFunction,
+                                         AccType>(temporary_storage,
+                                                  storage_size,
+                                                  keys,
+                                                  input,
+                                                  output,
+                                                  initial_value,
+                                                  size,
+                                                  scan_op,
+                                                  compare,
+                                                  params,
+                                                  stream,
+                                                  debug_synchronous);
+    }
 
     // Number of blocks in a single launch (or the only launch if it fits)
-    const unsigned int number_of_blocks = ceiling_div(limited_size, items_per_block);
+    const unsigned int number_of_blocks = persistent ? static_cast<unsigned int>(number_of_tiles)
+                                                     : ceiling_div(limited_size, items_per_block);
 
     void*         scan_state_storage;
+    unsigned int* ordered_tile_id_storage;
     wrapped_type* previous_last_value;
 
     detail::temp_storage::layout layout{};
@@ -154,8 +446,9 @@ inline hipError_t scan_by_key_impl(void* const           temporary_storage,
         temporary_storage,
         storage_size,
         detail::temp_storage::make_linear_partition(
-            // This is valid even with offset_scan_state_with_sleep_type
             detail::temp_storage::make_partition(&scan_state_storage, layout),
+            detail::temp_storage::ptr_aligned_array(&ordered_tile_id_storage,
+                                                    persistent ? 1 : 0),
             detail::temp_storage::ptr_aligned_array(&previous_last_value,
                                                     use_limited_size ? 1 : 0)));
     if(partition_result != hipSuccess || temporary_storage == nullptr)
@@ -168,39 +461,86 @@ inline hipError_t scan_by_key_impl(void* const           temporary_storage,
         return hipSuccess;
     }
 
-    bool use_sleep;
-    if(const hipError_t error = is_sleep_scan_state_used(stream, use_sleep))
-    {
-        return error;
-    }
-
     scan_state_type scan_state{};
-    hipError_t      scan_state_result
-        = scan_state_type::create(scan_state, scan_state_storage, number_of_blocks, stream);
-    scan_state_with_sleep_type scan_state_with_sleep{};
-    scan_state_result = scan_state_with_sleep_type::create(scan_state_with_sleep,
-                                                           scan_state_storage,
-                                                           number_of_blocks,
-                                                           stream);
-    if(scan_state_result != hipSuccess)
-    {
-        return scan_state_result;
-    }
+    ROCPRIM_RETURN_ON_ERROR(scan_state_type::create(scan_state,
+                                                    scan_state_storage,
+                                                    number_of_blocks,
+                                                    stream,
+                                                    params.backoff));
 
-    // Call the provided function with either scan_state or scan_state_with_sleep based on
-    // the value of use_sleep
-    auto with_scan_state
-        = [use_sleep, scan_state, scan_state_with_sleep](auto&& func) mutable -> decltype(auto)
+    if(persistent)
     {
-        if(use_sleep)
+        const auto ordered_tile_id
+            = ordered_block_id<unsigned int>::create(ordered_tile_id_storage);
+
+        // Start point for time measurements
+        std::chrono::steady_clock::time_point start;
+        if(debug_synchronous)
         {
-            return func(scan_state_with_sleep);
+            start = std::chrono::steady_clock::now();
         }
-        else
+
+        const unsigned int init_grid_size = ceiling_div(number_of_blocks, block_size);
+        hipLaunchKernelGGL(init_lookback_scan_state_kernel,
+                           dim3(init_grid_size),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           scan_state,
+                           number_of_blocks,
+                           ordered_tile_id);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel",
+                                                    number_of_blocks,
+                                                    start);
+        const auto kernel = persistent_device_scan_by_key_kernel<Determinism,
+                                                                 Exclusive,
+                                                                 config,
+                                                                 KeysInputIterator,
+                                                                 InputIterator,
+                                                                 OutputIterator,
+                                                                 InitValueType,
+                                                                 CompareFunction,
+                                                                 BinaryFunction,
+                                                                 scan_state_type,
+                                                                 AccType>;
+        unsigned int grid_size;
+        ROCPRIM_RETURN_ON_ERROR(
+            persistent_grid_size(kernel, block_size, stream, grid_size));
+        grid_size = std::min(grid_size, number_of_blocks);
+
+        if(debug_synchronous)
         {
-            return func(scan_state);
+            std::cout << "----------------------------------\n";
+            std::cout << "size:               " << size << '\n';
+            std::cout << "persistent:         " << std::boolalpha << persistent << '\n';
+            std::cout << "number of tiles:    " << number_of_blocks << '\n';
+            std::cout << "grid_size:          " << grid_size << '\n';
+            std::cout << "block_size:         " << block_size << '\n';
+            std::cout << "items_per_block:    " << items_per_block << '\n';
+            std::cout << "----------------------------------\n";
+            start = std::chrono::steady_clock::now();
         }
-    };
+
+        hipLaunchKernelGGL(kernel,
+                           dim3(grid_size),
+                           dim3(block_size),
+                           0,
+                           stream,
+                           keys,
+                           input,
+                           output,
+                           initial_value,
+                           compare,
+                           scan_op,
+                           scan_state,
+                           ordered_tile_id,
+                           size,
+                           number_of_blocks);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("persistent_device_scan_by_key_kernel",
+                                                    size,
+                                                    start);
+        return hipSuccess;
+    }
 
     // Total number of blocks in all launches
     const auto   total_number_of_blocks = ceiling_div(size, items_per_block);
@@ -239,48 +579,45 @@ inline hipError_t scan_by_key_impl(void* const           temporary_storage,
             start = std::chrono::steady_clock::now();
         }
 
-        with_scan_state(
-            [&](const auto scan_state)
-            {
-                hipLaunchKernelGGL(init_lookback_scan_state_kernel,
-                                   dim3(init_grid_size),
-                                   dim3(block_size),
-                                   0,
-                                   stream,
-                                   scan_state,
-                                   scan_blocks,
-                                   number_of_blocks - 1,
-                                   i > 0 ? previous_last_value : nullptr);
-            });
-        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel",
-                                                    scan_blocks,
-                                                    start);
+        // A single block does not look back, so the scan state of the first launch only has to be
+        // initialized if it has more blocks.
+        if(scan_blocks > 1 || i > 0)
+        {
+            hipLaunchKernelGGL(init_lookback_scan_state_kernel,
+                               dim3(init_grid_size),
+                               dim3(block_size),
+                               0,
+                               stream,
+                               scan_state,
+                               scan_blocks,
+                               number_of_blocks - 1,
+                               i > 0 ? previous_last_value : nullptr);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("init_lookback_scan_state_kernel",
+                                                        scan_blocks,
+                                                        start);
+        }
 
         if(debug_synchronous)
         {
             start = std::chrono::steady_clock::now();
         }
-        with_scan_state(
-            [&](auto& scan_state)
-            {
-                hipLaunchKernelGGL(
-                    HIP_KERNEL_NAME(device_scan_by_key_kernel<Determinism, Exclusive, config>),
-                    dim3(scan_blocks),
-                    dim3(block_size),
-                    0,
-                    stream,
-                    keys + offset,
-                    input + offset,
-                    output + offset,
-                    initial_value,
-                    compare,
-                    scan_op,
-                    scan_state,
-                    size,
-                    i * number_of_blocks,
-                    total_number_of_blocks,
-                    i > 0 ? as_const_ptr(previous_last_value) : nullptr);
-            });
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(device_scan_by_key_kernel<Determinism, Exclusive, config>),
+            dim3(scan_blocks),
+            dim3(block_size),
+            0,
+            stream,
+            keys + offset,
+            input + offset,
+            output + offset,
+            initial_value,
+            compare,
+            scan_op,
+            scan_state,
+            size,
+            i * number_of_blocks,
+            total_number_of_blocks,
+            i > 0 ? as_const_ptr(previous_last_value) : nullptr);
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("device_scan_by_key_kernel",
                                                     current_size,
                                                     start);
@@ -288,6 +625,59 @@ inline hipError_t scan_by_key_impl(void* const           temporary_storage,
     return hipSuccess;
 }
 
+template<lookback_scan_determinism Determinism,
+         bool                      Exclusive,
+         typename Config,
+         typename KeysInputIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename InitValueType,
+         typename BinaryFunction,
+         typename CompareFunction,
+         typename AccType>
+inline hipError_t scan_by_key_impl(void* const           temporary_storage,
+                                   size_t&               storage_size,
+                                   KeysInputIterator     keys,
+                                   InputIterator         input,
+                                   OutputIterator        output,
+                                   const InitValueType   initial_value,
+                                   const size_t          size,
+                                   const BinaryFunction  scan_op,
+                                   const CompareFunction compare,
+                                   const hipStream_t     stream,
+                                   const bool            debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    return dispatch_tuned_config<Config, key_type, AccType>(
+        "scan_by_key",
+        size,
+        stream,
+        [&](auto config)
+        {
+            return scan_by_key_config_impl<Determinism,
+                                           Exclusive,
+                                           typename decltype(config)::type,
+                                           KeysInputIterator,
+                                           InputIterator,
+                                           OutputIterator,
+                                           InitValueType,
+                                           BinaryFunction,
+                                           CompareFunction,
+                                           AccType>(temporary_storage,
+                                                    storage_size,
+                                                    keys,
+                                                    input,
+                                                    output,
+                                                    initial_value,
+                                                    size,
+                                                    scan_op,
+                                                    compare,
+                                                    stream,
+                                                    debug_synchronous);
+        });
+}
+
 
 }
 
@@ -313,7 +703,8 @@ inline hipError_t scan_by_key_impl(void* const           temporary_storage,
 /// * Ranges specified by \p keys_input, \p values_input, and \p values_output must have
 /// at least \p size elements.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `scan_by_key_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `scan_by_key_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator - random-access iterator type of the input range. It can be
 /// a simple pointer type.
 /// \tparam ValuesInputIterator - random-access iterator type of the input range. It can be
@@ -505,7 +896,8 @@ inline hipError_t deterministic_inclusive_scan_by_key(void* const
 /// * Ranges specified by \p keys_input, \p values_input, and \p values_output must have
 /// at least \p size elements.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `scan_by_key_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `scan_by_key_config`
+/// or a `tuned_config` of these.
 /// \tparam KeysInputIterator - random-access iterator type of the input range. It can be
 /// a simple pointer type.
 /// \tparam ValuesInputIterator - random-access iterator type of the input range. It can be
@@ -684,6 +1076,191 @@ inline hipError_t deterministic_exclusive_scan_by_key(void* const
                                              debug_synchronous);
 }
 
+/// \brief Parallel inclusive scan primitive over segments given by head flags.
+///
+/// \p inclusive_scan_by_head_flags is \p inclusive_scan_by_key whose keys are replaced by head
+/// flags: the scan restarts at every item whose flag is set, the flag of the first item is
+/// ignored. Kernels load the flags instead of the keys, so with wide keys and flags known in
+/// advance (for example from \p run_length_encode) much less data is read. Packed flags with
+/// one bit per item can be read through <tt>rocprim::packed_bits_iterator<1></tt>.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `scan_by_key_config`.
+/// \tparam HeadFlagsInputIterator - random-access iterator type of the input range of head flags.
+/// Its value type must be convertible to \p bool. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccType - accumulator type used to propagate the scanned values. Default type
+/// is value type of the input iterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] head_flags_input - iterator to the first element in the range of head flags.
+/// \param [in] values_input - iterator to the first element in the range of values to scan.
+/// \param [out] values_output - iterator to the first element in the output value range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] scan_op - binary operation function object that will be used for scanning
+/// input values. Default is BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;               // e.g., 8
+/// unsigned char * flags;     // e.g., [1, 0, 1, 0, 1, 0, 0, 1]
+/// int *   values_input;      // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// int *   values_output;     // empty array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::inclusive_scan_by_head_flags(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     flags, values_input, values_output, size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform scan
+/// rocprim::inclusive_scan_by_head_flags(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     flags, values_input, values_output, size
+/// );
+/// // values_output: [1, 3, 3, 7, 5, 11, 18, 8]
+/// \endcode
+/// \endparblock
+template<typename Config = default_config,
+         typename HeadFlagsInputIterator,
+         typename ValuesInputIterator,
+         typename ValuesOutputIterator,
+         typename BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<ValuesInputIterator>::value_type>,
+         typename AccType = typename std::iterator_traits<ValuesInputIterator>::value_type>
+inline hipError_t inclusive_scan_by_head_flags(void* const                  temporary_storage,
+                                               size_t&                      storage_size,
+                                               const HeadFlagsInputIterator head_flags_input,
+                                               const ValuesInputIterator    values_input,
+                                               const ValuesOutputIterator   values_output,
+                                               const size_t                 size,
+                                               const BinaryFunction scan_op = BinaryFunction(),
+                                               const hipStream_t    stream  = 0,
+                                               const bool           debug_synchronous = false)
+{
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    return detail::scan_by_key_impl<detail::lookback_scan_determinism::default_determinism,
+                                    false,
+                                    Config,
+                                    HeadFlagsInputIterator,
+                                    ValuesInputIterator,
+                                    ValuesOutputIterator,
+                                    value_type,
+                                    BinaryFunction,
+                                    detail::head_flag_compare,
+                                    AccType>(temporary_storage,
+                                             storage_size,
+                                             head_flags_input,
+                                             values_input,
+                                             values_output,
+                                             value_type(),
+                                             size,
+                                             scan_op,
+                                             detail::head_flag_compare{},
+                                             stream,
+                                             debug_synchronous);
+}
+
+/// \brief Parallel exclusive scan primitive over segments given by head flags.
+///
+/// \p exclusive_scan_by_head_flags is \p exclusive_scan_by_key whose keys are replaced by head
+/// flags: every item whose flag is set starts a segment whose first output is \p initial_value,
+/// the flag of the first item is ignored. Kernels load the flags instead of the keys. Packed
+/// flags with one bit per item can be read through <tt>rocprim::packed_bits_iterator<1></tt>.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `scan_by_key_config`.
+/// \tparam HeadFlagsInputIterator - random-access iterator type of the input range of head flags.
+/// Its value type must be convertible to \p bool. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam InitialValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccType - accumulator type used to propagate the scanned values. Default type
+/// is 'InitialValueType', unless it's 'rocprim::future_value'. Then it will be the wrapped input type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] head_flags_input - iterator to the first element in the range of head flags.
+/// \param [in] values_input - iterator to the first element in the range of values to scan.
+/// \param [out] values_output - iterator to the first element in the output value range.
+/// \param [in] initial_value - initial value of every segment.
+/// \param [in] size - number of element in the input range.
+/// \param [in] scan_op - binary operation function object that will be used for scanning
+/// input values. Default is BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<typename Config = default_config,
+         typename HeadFlagsInputIterator,
+         typename ValuesInputIterator,
+         typename ValuesOutputIterator,
+         typename InitialValueType,
+         typename BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<ValuesInputIterator>::value_type>,
+         typename AccType = detail::input_type_t<InitialValueType>>
+inline hipError_t exclusive_scan_by_head_flags(void* const                  temporary_storage,
+                                               size_t&                      storage_size,
+                                               const HeadFlagsInputIterator head_flags_input,
+                                               const ValuesInputIterator    values_input,
+                                               const ValuesOutputIterator   values_output,
+                                               const InitialValueType       initial_value,
+                                               const size_t                 size,
+                                               const BinaryFunction scan_op = BinaryFunction(),
+                                               const hipStream_t    stream  = 0,
+                                               const bool           debug_synchronous = false)
+{
+    return detail::scan_by_key_impl<detail::lookback_scan_determinism::default_determinism,
+                                    true,
+                                    Config,
+                                    HeadFlagsInputIterator,
+                                    ValuesInputIterator,
+                                    ValuesOutputIterator,
+                                    InitialValueType,
+                                    BinaryFunction,
+                                    detail::head_flag_compare,
+                                    AccType>(temporary_storage,
+                                             storage_size,
+                                             head_flags_input,
+                                             values_input,
+                                             values_output,
+                                             initial_value,
+                                             size,
+                                             scan_op,
+                                             detail::head_flag_compare{},
+                                             stream,
+                                             debug_synchronous);
+}
+
 /// @}
 // end of group devicemodule
 
@@ -0,0 +1,683 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SCAN_DISTRIBUTED_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SCAN_DISTRIBUTED_HPP_
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../functional.hpp"
+#include "../type_traits.hpp"
+
+#include "config_types.hpp"
+#include "device_radix_sort_distributed.hpp"
+#include "device_reduce.hpp"
+#include "device_scan.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Describes the part of a distributed scan that is owned by a single device.
+///
+/// \tparam InputIterator random-access iterator type of the input of the shard.
+/// \tparam OutputIterator random-access iterator type of the output of the shard.
+template<class InputIterator, class OutputIterator>
+struct scan_distributed_shard
+{
+    /// HIP device ordinal of the device that owns the input and the output of this shard.
+    int device;
+    /// Stream on \p device. All work of the shard is enqueued on this stream.
+    hipStream_t stream;
+
+    /// Slice of the input that is stored on the device.
+    InputIterator input;
+    /// Slice of the output that is stored on the device.
+    OutputIterator output;
+    /// Number of elements in \p input and \p output.
+    size_t size;
+
+    /// Device-accessible temporary storage on \p device.
+    void* temporary_storage;
+    /// [in,out] Size of \p temporary_storage in bytes.
+    size_t storage_size;
+};
+
+/// \brief Describes the part of a distributed reduction that is owned by a single device.
+///
+/// \tparam InputIterator random-access iterator type of the input of the shard.
+template<class InputIterator>
+struct reduce_distributed_shard
+{
+    /// HIP device ordinal of the device that owns the input of this shard.
+    int device;
+    /// Stream on \p device. All work of the shard is enqueued on this stream.
+    hipStream_t stream;
+
+    /// Slice of the input that is stored on the device.
+    InputIterator input;
+    /// Number of elements in \p input.
+    size_t size;
+
+    /// Device-accessible temporary storage on \p device.
+    void* temporary_storage;
+    /// [in,out] Size of \p temporary_storage in bytes.
+    size_t storage_size;
+};
+
+namespace detail
+{
+
+template<class AccType>
+struct distributed_aggregate_storage
+{
+    // Aggregates of the preceding non-empty shards, written by their devices
+    AccType*                    aggregates;
+    AccType*                    local_aggregate;
+    scan_stream_state<AccType>* carry;
+    void*                       local_storage;
+    size_t                      local_storage_size;
+};
+
+// Folds the aggregates received from the preceding shards into the carry-in of the shard
+template<class AccType, class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(1)
+void scan_distributed_carry_kernel(const AccType*              aggregates,
+                                   const unsigned int          count,
+                                   scan_stream_state<AccType>* carry,
+                                   BinaryFunction              scan_op)
+{
+    AccType value = aggregates[0];
+    for(unsigned int i = 1; i < count; i++)
+    {
+        value = scan_op(value, aggregates[i]);
+    }
+    carry->carry     = value;
+    carry->has_carry = 1;
+}
+
+template<class AccType, class OutputIterator, class InitValueType, class BinaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(1)
+void reduce_distributed_output_kernel(const AccType*      aggregates,
+                                      const unsigned int  count,
+                                      OutputIterator      output,
+                                      const InitValueType initial_value,
+                                      BinaryFunction      reduce_op)
+{
+    AccType value = initial_value;
+    for(unsigned int i = 0; i < count; i++)
+    {
+        value = reduce_op(value, aggregates[i]);
+    }
+    *output = value;
+}
+
+// Makes the stream of every shard `p` wait for the work enqueued so far on the stream of every
+// shard `s` for which `waits_for(p, s)` is true.
+template<class Shard, class WaitsFor>
+hipError_t distributed_wait_for_shards(const Shard*       shards,
+                                       const unsigned int num_shards,
+                                       WaitsFor           waits_for)
+{
+    std::vector<hipEvent_t> events(num_shards, nullptr);
+    hipError_t              error = hipSuccess;
+    for(unsigned int s = 0; s < num_shards && error == hipSuccess; ++s)
+    {
+        error = hipSetDevice(shards[s].device);
+        if(error == hipSuccess)
+        {
+            error = hipEventCreateWithFlags(&events[s], hipEventDisableTiming);
+        }
+        if(error == hipSuccess)
+        {
+            error = hipEventRecord(events[s], shards[s].stream);
+        }
+    }
+    for(unsigned int p = 0; p < num_shards && error == hipSuccess; ++p)
+    {
+        error = hipSetDevice(shards[p].device);
+        for(unsigned int s = 0; s < num_shards && error == hipSuccess; ++s)
+        {
+            if(waits_for(p, s)
+               && (shards[s].stream != shards[p].stream || shards[s].device != shards[p].device))
+            {
+                error = hipStreamWaitEvent(shards[p].stream, events[s], 0);
+            }
+        }
+    }
+    for(unsigned int s = 0; s < num_shards; ++s)
+    {
+        if(events[s] != nullptr)
+        {
+            const hipError_t destroy_error = hipEventDestroy(events[s]);
+            error = error != hipSuccess ? error : destroy_error;
+        }
+    }
+    return error;
+}
+
+// Computes the aggregates of the shards `s` for which `sends(s)` is true with `reduce`, and
+// copies them with `transport` to slot `rank[s]` of the aggregates of every shard `p` for which
+// `receives(p, s)` is true. `rank[s]` is the number of non-empty shards before `s`.
+template<class Shard, class AccType, class Transport, class Sends, class Receives, class Reduce>
+hipError_t
+    distributed_exchange_aggregates(const Shard*                                         shards,
+                                    const unsigned int                                   num_shards,
+                                    std::vector<distributed_aggregate_storage<AccType>>& storages,
+                                    const std::vector<unsigned int>&                     rank,
+                                    Transport&                                           transport,
+                                    Sends                                                sends,
+                                    Receives                                             receives,
+                                    Reduce                                               reduce)
+{
+    // The slots of a shard may still be read by the previous call with the same storage
+    ROCPRIM_RETURN_ON_ERROR(distributed_wait_for_shards(shards,
+                                                        num_shards,
+                                                        [&](unsigned int s, unsigned int p)
+                                                        { return sends(s) && receives(p, s); }));
+
+    for(unsigned int s = 0; s < num_shards; ++s)
+    {
+        if(!sends(s))
+        {
+            continue;
+        }
+        ROCPRIM_RETURN_ON_ERROR(hipSetDevice(shards[s].device));
+        ROCPRIM_RETURN_ON_ERROR(reduce(s, storages[s].local_aggregate));
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(transport.begin());
+    for(unsigned int s = 0; s < num_shards; ++s)
+    {
+        for(unsigned int p = 0; p < num_shards && sends(s); ++p)
+        {
+            if(!receives(p, s))
+            {
+                continue;
+            }
+            ROCPRIM_RETURN_ON_ERROR(
+                transport.transfer(radix_sort_distributed_transfer{storages[s].local_aggregate,
+                                                                   shards[s].device,
+                                                                   shards[s].stream,
+                                                                   storages[p].aggregates
+                                                                       + rank[s],
+                                                                   shards[p].device,
+                                                                   shards[p].stream,
+                                                                   sizeof(AccType)}));
+        }
+    }
+    ROCPRIM_RETURN_ON_ERROR(transport.end());
+
+    return distributed_wait_for_shards(shards,
+                                       num_shards,
+                                       [&](unsigned int p, unsigned int s)
+                                       { return sends(s) && receives(p, s); });
+}
+
+// Partitions the temporary storage of every shard. Returns true in `query_only` if any of the
+// shards has no storage yet, then only the required sizes are computed.
+template<class Shard, class AccType, class LocalStorageSize>
+hipError_t distributed_partition(Shard*                                               shards,
+                                 const unsigned int                                   num_shards,
+                                 std::vector<distributed_aggregate_storage<AccType>>& storages,
+                                 bool&                                                query_only,
+                                 LocalStorageSize local_storage_size)
+{
+    query_only = false;
+    for(unsigned int s = 0; s < num_shards; ++s)
+    {
+        query_only = query_only || shards[s].temporary_storage == nullptr;
+    }
+    storages.resize(num_shards);
+    for(unsigned int s = 0; s < num_shards; ++s)
+    {
+        distributed_aggregate_storage<AccType>& storage = storages[s];
+        ROCPRIM_RETURN_ON_ERROR(hipSetDevice(shards[s].device));
+        ROCPRIM_RETURN_ON_ERROR(local_storage_size(s, storage.local_storage_size));
+        void* temporary_storage = query_only ? nullptr : shards[s].temporary_storage;
+        ROCPRIM_RETURN_ON_ERROR(detail::temp_storage::partition(
+            temporary_storage,
+            shards[s].storage_size,
+            detail::temp_storage::make_linear_partition(
+                detail::temp_storage::ptr_aligned_array(&storage.aggregates, num_shards),
+                detail::temp_storage::ptr_aligned_array(&storage.local_aggregate, 1),
+                detail::temp_storage::ptr_aligned_array(&storage.carry, 1),
+                detail::temp_storage::make_partition(&storage.local_storage,
+                                                     storage.local_storage_size))));
+    }
+    return hipSuccess;
+}
+
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction,
+         class Transport>
+hipError_t
+    inclusive_scan_distributed_impl(scan_distributed_shard<InputIterator, OutputIterator>* shards,
+                                    const unsigned int num_shards,
+                                    BinaryFunction     scan_op,
+                                    Transport&         transport,
+                                    const bool         debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using acc_type   = ::rocprim::invoke_result_binary_op_t<input_type, BinaryFunction>;
+
+    if(num_shards == 0)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    current_device_guard device_guard;
+    if(!device_guard.valid)
+    {
+        return hipErrorInvalidDevice;
+    }
+
+    bool                                                 query_only;
+    std::vector<distributed_aggregate_storage<acc_type>> storages;
+    ROCPRIM_RETURN_ON_ERROR(distributed_partition(
+        shards,
+        num_shards,
+        storages,
+        query_only,
+        [&](unsigned int s, size_t& local_storage_size)
+        {
+            const auto& shard = shards[s];
+            // Only the presence of a state changes the storage of the streaming scan
+            scan_stream_state<acc_type> state_placeholder;
+            size_t                      reduce_bytes = 0;
+            size_t                      scan_bytes   = 0;
+            ROCPRIM_RETURN_ON_ERROR(::rocprim::reduce(nullptr,
+                                                      reduce_bytes,
+                                                      shard.input,
+                                                      static_cast<acc_type*>(nullptr),
+                                                      shard.size,
+                                                      scan_op,
+                                                      shard.stream));
+            ROCPRIM_RETURN_ON_ERROR(::rocprim::streaming_inclusive_scan<Config>(nullptr,
+                                                                                scan_bytes,
+                                                                                shard.input,
+                                                                                shard.output,
+                                                                                shard.size,
+                                                                                &state_placeholder,
+                                                                                scan_op,
+                                                                                shard.stream));
+            local_storage_size = std::max(reduce_bytes, scan_bytes);
+            return hipSuccess;
+        }));
+    if(query_only)
+    {
+        return hipSuccess;
+    }
+
+    std::vector<unsigned int> rank(num_shards);
+    for(unsigned int s = 0, non_empty = 0; s < num_shards; ++s)
+    {
+        rank[s] = non_empty;
+        non_empty += shards[s].size > 0 ? 1 : 0;
+    }
+
+    // Every non-empty shard except the last one sends its aggregate to all following shards.
+    // The aggregates are computed with a reduction, which reads the input, but does not write
+    // a partial scan that would have to be fixed up later.
+    unsigned int last_non_empty = num_shards;
+    for(unsigned int s = 0; s < num_shards; ++s)
+    {
+        last_non_empty = shards[s].size > 0 ? s : last_non_empty;
+    }
+    ROCPRIM_RETURN_ON_ERROR(distributed_exchange_aggregates(
+        shards,
+        num_shards,
+        storages,
+        rank,
+        transport,
+        [&](unsigned int s) { return shards[s].size > 0 && s != last_non_empty; },
+        [&](unsigned int p, unsigned int s) { return p > s && shards[p].size > 0; },
+        [&](unsigned int s, acc_type* aggregate)
+        {
+            return ::rocprim::reduce(storages[s].local_storage,
+                                     storages[s].local_storage_size,
+                                     shards[s].input,
+                                     aggregate,
+                                     shards[s].size,
+                                     scan_op,
+                                     shards[s].stream,
+                                     debug_synchronous);
+        }));
+
+    // Scan every shard with the aggregates of the preceding shards as its carry-in
+    for(unsigned int p = 0; p < num_shards; ++p)
+    {
+        auto&                                    shard   = shards[p];
+        distributed_aggregate_storage<acc_type>& storage = storages[p];
+        if(shard.size == 0)
+        {
+            continue;
+        }
+        ROCPRIM_RETURN_ON_ERROR(hipSetDevice(shard.device));
+        if(rank[p] == 0)
+        {
+            ROCPRIM_RETURN_ON_ERROR(
+                hipMemsetAsync(storage.carry, 0, sizeof(*storage.carry), shard.stream));
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(scan_distributed_carry_kernel<acc_type, BinaryFunction>),
+                dim3(1),
+                dim3(1),
+                0,
+                shard.stream,
+                storage.aggregates,
+                rank[p],
+                storage.carry,
+                scan_op);
+            ROCPRIM_RETURN_ON_ERROR(hipGetLastError());
+        }
+        ROCPRIM_RETURN_ON_ERROR(
+            ::rocprim::streaming_inclusive_scan<Config>(storage.local_storage,
+                                                        storage.local_storage_size,
+                                                        shard.input,
+                                                        shard.output,
+                                                        shard.size,
+                                                        storage.carry,
+                                                        scan_op,
+                                                        shard.stream,
+                                                        debug_synchronous));
+    }
+
+    return hipSuccess;
+}
+
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction,
+         class Transport>
+hipError_t reduce_distributed_impl(reduce_distributed_shard<InputIterator>* shards,
+                                   const unsigned int                       num_shards,
+                                   OutputIterator                           output,
+                                   const InitValueType                      initial_value,
+                                   BinaryFunction                           reduce_op,
+                                   Transport&                               transport,
+                                   const bool                               debug_synchronous)
+{
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using acc_type   = ::rocprim::invoke_result_binary_op_t<input_type, BinaryFunction>;
+
+    if(num_shards == 0)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    current_device_guard device_guard;
+    if(!device_guard.valid)
+    {
+        return hipErrorInvalidDevice;
+    }
+
+    bool                                                 query_only;
+    std::vector<distributed_aggregate_storage<acc_type>> storages;
+    ROCPRIM_RETURN_ON_ERROR(distributed_partition(
+        shards,
+        num_shards,
+        storages,
+        query_only,
+        [&](unsigned int s, size_t& local_storage_size)
+        {
+            return ::rocprim::reduce<Config>(nullptr,
+                                             local_storage_size,
+                                             shards[s].input,
+                                             static_cast<acc_type*>(nullptr),
+                                             shards[s].size,
+                                             reduce_op,
+                                             shards[s].stream);
+        }));
+    if(query_only)
+    {
+        return hipSuccess;
+    }
+
+    std::vector<unsigned int> rank(num_shards);
+    unsigned int              non_empty = 0;
+    for(unsigned int s = 0; s < num_shards; ++s)
+    {
+        rank[s] = non_empty;
+        non_empty += shards[s].size > 0 ? 1 : 0;
+    }
+
+    // Every non-empty shard sends its aggregate to the first shard, which owns the output
+    ROCPRIM_RETURN_ON_ERROR(distributed_exchange_aggregates(
+        shards,
+        num_shards,
+        storages,
+        rank,
+        transport,
+        [&](unsigned int s) { return shards[s].size > 0; },
+        [&](unsigned int p, unsigned int /*s*/) { return p == 0; },
+        [&](unsigned int s, acc_type* aggregate)
+        {
+            return ::rocprim::reduce<Config>(storages[s].local_storage,
+                                             storages[s].local_storage_size,
+                                             shards[s].input,
+                                             aggregate,
+                                             shards[s].size,
+                                             reduce_op,
+                                             shards[s].stream,
+                                             debug_synchronous);
+        }));
+
+    ROCPRIM_RETURN_ON_ERROR(hipSetDevice(shards[0].device));
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(reduce_distributed_output_kernel<acc_type,
+                                                                        OutputIterator,
+                                                                        InitValueType,
+                                                                        BinaryFunction>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       shards[0].stream,
+                       storages[0].aggregates,
+                       non_empty,
+                       output,
+                       initial_value,
+                       reduce_op);
+    ROCPRIM_RETURN_ON_ERROR(hipGetLastError());
+    if(debug_synchronous)
+    {
+        ROCPRIM_RETURN_ON_ERROR(hipStreamSynchronize(shards[0].stream));
+    }
+
+    return hipSuccess;
+}
+
+} // end namespace detail
+
+/// \brief Inclusive scan of a sequence distributed over several devices.
+///
+/// \p inclusive_scan_distributed scans the slices of an input that is spread over the memory of
+/// several devices as one sequence: shard \p i is the slice that precedes shard <tt>i + 1</tt>.
+/// Every shard except the last one first reduces its slice, and the aggregate is copied with
+/// \p transport into the temporary storage of all following shards. Every shard then folds the
+/// aggregates it received into a carry-in and scans its slice like
+/// \p streaming_inclusive_scan, which applies the carry-in inside the scan pass.
+///
+/// \par Overview
+/// * Every input element is read twice and every output element is written once. The
+/// aggregates are exchanged between the devices without synchronizing with the host and
+/// without a fix-up pass over the outputs.
+/// * Returns the required storage size of every shard in its \p storage_size if the
+/// \p temporary_storage of any shard is a null pointer. Each shard's \p temporary_storage
+/// must be allocated on its \p device.
+/// * The function is asynchronous with respect to the host; synchronize the streams of all
+/// shards before reading the results.
+/// * The current device of the calling thread is restored before returning.
+/// * Shards can be empty. Several shards can share a device.
+///
+/// \tparam Config [optional] configuration of the scan pass, must be `default_config` or
+/// `scan_config`.
+/// \tparam InputIterator random-access iterator type of the input of every shard.
+/// \tparam OutputIterator random-access iterator type of the output of every shard.
+/// \tparam BinaryFunction [optional] type of binary function used for scan. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam Transport [optional] type of the transport used to exchange the aggregates. See
+/// \p radix_sort_peer_transport for the required interface.
+///
+/// \param [in,out] shards pointer to a host array describing the part of the input and the
+/// output owned by each device.
+/// \param [in] num_shards number of elements in \p shards.
+/// \param [in] scan_op [optional] binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. Default is BinaryFunction().
+/// \param [in] transport [optional] transport used to exchange the aggregates. Default is
+/// a peer-to-peer transport based on \p hipMemcpyPeerAsync.
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example an input spread over two devices is scanned.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare the input of every device (allocate device memory, create streams etc.)
+/// rocprim::scan_distributed_shard<int*, int*> shards[2];
+/// // shards[i].device, .stream, .input, .output, .size
+/// // e.g., shards[0].input: [1, 2, 3], shards[1].input: [4, 5]
+///
+/// // Get required size of the temporary storage of every shard
+/// for(auto& shard : shards) shard.temporary_storage = nullptr;
+/// rocprim::inclusive_scan_distributed(shards, 2);
+///
+/// // allocate temporary storage
+/// for(auto& shard : shards)
+/// {
+///     hipSetDevice(shard.device);
+///     hipMalloc(&shard.temporary_storage, shard.storage_size);
+/// }
+///
+/// // perform scan
+/// rocprim::inclusive_scan_distributed(shards, 2);
+/// // shards[0].output: [1, 3, 6], shards[1].output: [10, 15]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+         class Transport = radix_sort_peer_transport>
+hipError_t
+    inclusive_scan_distributed(scan_distributed_shard<InputIterator, OutputIterator>* shards,
+                               unsigned int   num_shards,
+                               BinaryFunction scan_op           = BinaryFunction(),
+                               Transport      transport         = Transport(),
+                               bool           debug_synchronous = false)
+{
+    return detail::inclusive_scan_distributed_impl<Config>(shards,
+                                                           num_shards,
+                                                           scan_op,
+                                                           transport,
+                                                           debug_synchronous);
+}
+
+/// \brief Reduction of a sequence distributed over several devices.
+///
+/// \p reduce_distributed reduces the slices of an input that is spread over the memory of
+/// several devices as one sequence: shard \p i is the slice that precedes shard <tt>i + 1</tt>.
+/// Every shard reduces its slice, the aggregates are copied with \p transport into the
+/// temporary storage of the first shard, and the first device combines them with
+/// \p initial_value in shard order and writes the result to \p output.
+///
+/// \par Overview
+/// * Returns the required storage size of every shard in its \p storage_size if the
+/// \p temporary_storage of any shard is a null pointer. Each shard's \p temporary_storage
+/// must be allocated on its \p device.
+/// * \p output must be accessible on the device of the first shard. The result is written on
+/// its stream.
+/// * The function is asynchronous with respect to the host and the current device of the
+/// calling thread is restored before returning.
+///
+/// \tparam Config [optional] configuration of the reduction of every shard, must be
+/// `default_config` or `reduce_config`.
+/// \tparam InputIterator random-access iterator type of the input of every shard.
+/// \tparam OutputIterator random-access iterator type of the output.
+/// \tparam InitValueType type of the initial value.
+/// \tparam BinaryFunction [optional] type of binary function used for reduction. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam Transport [optional] type of the transport used to exchange the aggregates. See
+/// \p radix_sort_peer_transport for the required interface.
+///
+/// \param [in,out] shards pointer to a host array describing the part of the input owned by
+/// each device.
+/// \param [in] num_shards number of elements in \p shards.
+/// \param [out] output iterator to the result of the reduction.
+/// \param [in] initial_value initial value of the reduction.
+/// \param [in] reduce_op [optional] binary operation function object that will be used for
+/// reduction. Default is BinaryFunction().
+/// \param [in] transport [optional] transport used to exchange the aggregates. Default is
+/// a peer-to-peer transport based on \p hipMemcpyPeerAsync.
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+         class Transport = radix_sort_peer_transport>
+hipError_t reduce_distributed(reduce_distributed_shard<InputIterator>* shards,
+                              unsigned int                             num_shards,
+                              OutputIterator                           output,
+                              InitValueType                            initial_value,
+                              BinaryFunction                           reduce_op = BinaryFunction(),
+                              Transport                                transport = Transport(),
+                              bool debug_synchronous = false)
+{
+    return detail::reduce_distributed_impl<Config>(shards,
+                                                   num_shards,
+                                                   output,
+                                                   initial_value,
+                                                   reduce_op,
+                                                   transport,
+                                                   debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_SCAN_DISTRIBUTED_HPP_
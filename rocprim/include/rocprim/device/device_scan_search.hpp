@@ -0,0 +1,427 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SCAN_SEARCH_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SCAN_SEARCH_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../intrinsics/thread.hpp"
+#include "../warp/warp_reduce.hpp"
+#include "../warp/warp_scan.hpp"
+
+#include "device_scan.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Tiles are scanned by logical warps of 32 threads, so that their size does not depend on the
+// warp size of the device
+constexpr unsigned int scan_search_block_size       = 256;
+constexpr unsigned int scan_search_warp_size        = 32;
+constexpr unsigned int scan_search_items_per_thread = 16;
+constexpr unsigned int scan_search_warps_per_block
+    = scan_search_block_size / scan_search_warp_size;
+constexpr unsigned int scan_search_items_per_tile
+    = scan_search_warp_size * scan_search_items_per_thread;
+
+// Every logical warp sums one tile of the weights
+template<class WeightsIterator, class AccType>
+ROCPRIM_KERNEL __launch_bounds__(scan_search_block_size) void scan_search_tile_reduce_kernel(
+    WeightsIterator weights, size_t size, AccType* tile_sums, size_t tiles)
+{
+    using warp_reduce_type = ::rocprim::warp_reduce<AccType, scan_search_warp_size>;
+
+    ROCPRIM_SHARED_MEMORY
+    typename warp_reduce_type::storage_type storage[scan_search_warps_per_block];
+
+    const unsigned int warp_id = ::rocprim::detail::logical_warp_id<scan_search_warp_size>();
+    const unsigned int lane_id = ::rocprim::detail::logical_lane_id<scan_search_warp_size>();
+    const size_t tile = size_t(blockIdx.x) * scan_search_warps_per_block + warp_id;
+    if(tile >= tiles)
+    {
+        return;
+    }
+
+    // Striped, so that the loads of the warp are coalesced
+    const size_t tile_offset = tile * scan_search_items_per_tile;
+    AccType      thread_sum{};
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < scan_search_items_per_thread; i++)
+    {
+        const size_t index = tile_offset + i * scan_search_warp_size + lane_id;
+        if(index < size)
+        {
+            thread_sum = thread_sum + static_cast<AccType>(weights[index]);
+        }
+    }
+
+    AccType tile_sum;
+    warp_reduce_type().reduce(thread_sum, tile_sum, storage[warp_id]);
+    if(lane_id == 0)
+    {
+        tile_sums[tile] = tile_sum;
+    }
+}
+
+// Every logical warp finds the tile of one threshold among the scanned tile sums, and the item
+// within it by a scan of the tile
+template<class WeightsIterator,
+         class ThresholdsIterator,
+         class OutputIterator,
+         class CompareFunction,
+         class AccType>
+ROCPRIM_KERNEL __launch_bounds__(scan_search_block_size) void scan_search_kernel(
+    WeightsIterator    weights,
+    size_t             size,
+    ThresholdsIterator thresholds,
+    OutputIterator     output,
+    size_t             thresholds_size,
+    const AccType*     tile_prefixes,
+    size_t             tiles,
+    CompareFunction    compare_op)
+{
+    using warp_scan_type   = ::rocprim::warp_scan<AccType, scan_search_warp_size>;
+    using warp_reduce_type = ::rocprim::warp_reduce<unsigned int, scan_search_warp_size>;
+    using output_type      = typename std::iterator_traits<OutputIterator>::value_type;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename warp_scan_type::storage_type   scan;
+        typename warp_reduce_type::storage_type reduce;
+    } storage[scan_search_warps_per_block];
+
+    const unsigned int warp_id = ::rocprim::detail::logical_warp_id<scan_search_warp_size>();
+    const unsigned int lane_id = ::rocprim::detail::logical_lane_id<scan_search_warp_size>();
+    const size_t threshold_index = size_t(blockIdx.x) * scan_search_warps_per_block + warp_id;
+    if(threshold_index >= thresholds_size)
+    {
+        return;
+    }
+    const auto threshold = thresholds[threshold_index];
+
+    // The first tile whose inclusive prefix is not less than the threshold
+    size_t first = 0;
+    size_t count = tiles;
+    while(count > 0)
+    {
+        const size_t step = count / 2;
+        if(compare_op(tile_prefixes[first + step], threshold))
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+    if(first == tiles)
+    {
+        if(lane_id == 0)
+        {
+            output[threshold_index] = static_cast<output_type>(size);
+        }
+        return;
+    }
+
+    const size_t tile_offset = first * scan_search_items_per_tile;
+    const size_t item_offset = tile_offset + lane_id * scan_search_items_per_thread;
+    AccType      values[scan_search_items_per_thread];
+    AccType      thread_sum{};
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < scan_search_items_per_thread; i++)
+    {
+        values[i]  = item_offset + i < size ? static_cast<AccType>(weights[item_offset + i])
+                                            : AccType{};
+        thread_sum = thread_sum + values[i];
+    }
+
+    const AccType tile_prefix = first > 0 ? tile_prefixes[first - 1] : AccType{};
+    AccType       running;
+    warp_scan_type().exclusive_scan(thread_sum, running, tile_prefix, storage[warp_id].scan);
+
+    unsigned int found = scan_search_items_per_tile;
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < scan_search_items_per_thread; i++)
+    {
+        running = running + values[i];
+        if(found == scan_search_items_per_tile && item_offset + i < size
+           && !compare_op(running, threshold))
+        {
+            found = lane_id * scan_search_items_per_thread + i;
+        }
+    }
+    ::rocprim::wave_barrier();
+
+    unsigned int tile_found;
+    warp_reduce_type().reduce(found,
+                              tile_found,
+                              storage[warp_id].reduce,
+                              ::rocprim::minimum<unsigned int>());
+    if(lane_id == 0)
+    {
+        // Rounding of floating-point weights may put the crossing right after the tile
+        output[threshold_index]
+            = static_cast<output_type>(::rocprim::min(tile_offset + tile_found, size));
+    }
+}
+
+template<class WeightsIterator,
+         class ThresholdsIterator,
+         class OutputIterator,
+         class CompareFunction,
+         class AccType>
+inline hipError_t scan_lower_bound_impl(void*              temporary_storage,
+                                        size_t&            storage_size,
+                                        WeightsIterator    weights,
+                                        ThresholdsIterator thresholds,
+                                        OutputIterator     output,
+                                        size_t             size,
+                                        size_t             thresholds_size,
+                                        CompareFunction    compare_op,
+                                        hipStream_t        stream,
+                                        bool               debug_synchronous)
+{
+    const size_t tiles = ceiling_div(size, scan_search_items_per_tile);
+
+    // The tile sums are scanned in place
+    size_t scan_storage_size = 0;
+    if(tiles > 0)
+    {
+        ROCPRIM_RETURN_ON_ERROR(::rocprim::inclusive_scan(nullptr,
+                                                          scan_storage_size,
+                                                          static_cast<AccType*>(nullptr),
+                                                          static_cast<AccType*>(nullptr),
+                                                          tiles,
+                                                          ::rocprim::plus<AccType>(),
+                                                          stream,
+                                                          debug_synchronous));
+    }
+
+    AccType* tile_sums;
+    void*    scan_storage;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&tile_sums, tiles),
+            detail::temp_storage::make_partition(&scan_storage, scan_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(thresholds_size == 0)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(tiles > 0)
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(scan_search_tile_reduce_kernel<WeightsIterator, AccType>),
+            dim3(ceiling_div(tiles, scan_search_warps_per_block)),
+            dim3(scan_search_block_size),
+            0,
+            stream,
+            weights,
+            size,
+            tile_sums,
+            tiles);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("scan_search_tile_reduce_kernel", size, start);
+
+        ROCPRIM_RETURN_ON_ERROR(::rocprim::inclusive_scan(scan_storage,
+                                                          scan_storage_size,
+                                                          tile_sums,
+                                                          tile_sums,
+                                                          tiles,
+                                                          ::rocprim::plus<AccType>(),
+                                                          stream,
+                                                          debug_synchronous));
+    }
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(scan_search_kernel<WeightsIterator,
+                                                          ThresholdsIterator,
+                                                          OutputIterator,
+                                                          CompareFunction,
+                                                          AccType>),
+                       dim3(ceiling_div(thresholds_size, scan_search_warps_per_block)),
+                       dim3(scan_search_block_size),
+                       0,
+                       stream,
+                       weights,
+                       size,
+                       thresholds,
+                       output,
+                       thresholds_size,
+                       tile_sums,
+                       tiles,
+                       compare_op);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("scan_search_kernel", thresholds_size, start);
+
+    return hipSuccess;
+}
+
+} // end of detail namespace
+
+/// \brief Parallel search of thresholds in the running total of an array.
+///
+/// scan_lower_bound finds for every threshold the first index whose inclusive prefix sum of
+/// \p weights is not less than the threshold. The result is the same as of an inclusive scan of
+/// \p weights followed by \p rocprim::lower_bound of the thresholds in the scanned array, e.g.
+/// for weighted sampling or load balancing, but the prefix sums are not stored in memory.
+///
+/// \par Overview
+/// * The weights are summed per tile of 512 items. The tile sums are scanned, every threshold is
+/// searched in the scanned tile sums and the tile of the threshold is scanned again to find the
+/// item within it. Only the tile sums are kept in temporary storage, and only the indices are
+/// written.
+/// * The weights must not be negative, so that the prefix sums are sorted.
+/// * Thresholds greater than the sum of all weights give \p size.
+/// * The prefix sums of floating-point weights are rounded in a different order than by a
+/// sequential scan, thresholds very close to a prefix sum may give the neighbouring index.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+///
+/// \tparam WeightsIterator - random-access iterator type of the weights. It can be a simple
+/// pointer type.
+/// \tparam ThresholdsIterator - random-access iterator type of the thresholds. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output indices. It can be a simple
+/// pointer type.
+/// \tparam CompareFunction - type of the function that compares prefix sums to thresholds.
+/// Default type is \p rocprim::less<>.
+/// \tparam AccType - type of the prefix sums. Default type is the value type of
+/// \p WeightsIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the search.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] weights - iterator to the first weight.
+/// \param [in] thresholds - iterator to the first threshold.
+/// \param [out] output - iterator to the index of the first threshold.
+/// \param [in] size - number of weights.
+/// \param [in] thresholds_size - number of thresholds.
+/// \param [in] compare_op - binary function that returns \p true if the prefix sum passed as its
+/// first argument is ordered before the threshold passed as its second argument. Default is
+/// \p CompareFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful search; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;                // e.g., 5
+/// unsigned int * weights;     // e.g., [3, 0, 2, 4, 1]
+/// size_t thresholds_size;     // e.g., 4
+/// unsigned int * thresholds;  // e.g., [1, 4, 9, 11]
+/// size_t * output;            // empty array of 4 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::scan_lower_bound(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     weights, thresholds, output, size, thresholds_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform search
+/// rocprim::scan_lower_bound(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     weights, thresholds, output, size, thresholds_size
+/// );
+/// // prefix sums: [3, 3, 5, 9, 10]
+/// // output: [0, 2, 3, 5]
+/// \endcode
+/// \endparblock
+template<class WeightsIterator,
+         class ThresholdsIterator,
+         class OutputIterator,
+         class CompareFunction = ::rocprim::less<>,
+         class AccType         = typename std::iterator_traits<WeightsIterator>::value_type>
+inline hipError_t scan_lower_bound(void*              temporary_storage,
+                                   size_t&            storage_size,
+                                   WeightsIterator    weights,
+                                   ThresholdsIterator thresholds,
+                                   OutputIterator     output,
+                                   size_t             size,
+                                   size_t             thresholds_size,
+                                   CompareFunction    compare_op        = CompareFunction(),
+                                   hipStream_t        stream            = 0,
+                                   bool               debug_synchronous = false)
+{
+    return detail::scan_lower_bound_impl<WeightsIterator,
+                                         ThresholdsIterator,
+                                         OutputIterator,
+                                         CompareFunction,
+                                         AccType>(temporary_storage,
+                                                  storage_size,
+                                                  weights,
+                                                  thresholds,
+                                                  output,
+                                                  size,
+                                                  thresholds_size,
+                                                  compare_op,
+                                                  stream,
+                                                  debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_SCAN_SEARCH_HPP_
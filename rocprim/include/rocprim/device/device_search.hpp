@@ -48,6 +48,9 @@ BEGIN_ROCPRIM_NAMESPACE
 /// if `temporary_storage` is a null pointer.
 /// * Accepts custom compare_functions for search across the device.
 /// * Streams in graph capture mode are supported
+/// * Keys of at least 1024 integers compared with `rocprim::equal_to` are searched by their
+///   rolling hash, the positions are compared item by item only if their hash matches. This
+///   takes temporary storage for 8 bytes per item of the input and the keys.
 ///
 /// \tparam Config [optional] configuration of the primitive, must be `default_config` or `search_config`.
 /// \tparam InputIterator1 [inferred] random-access iterator type of the input range. Must meet the
@@ -0,0 +1,733 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_segmented_merge_sort.hpp"
+#include "device_segmented_merge_sort_config.hpp"
+#include "device_segmented_radix_sort.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// When there are enough segments, they are partitioned like in segmented radix sort: the small
+// and medium segments are sorted by logical warps, the large ones by a block each. Otherwise all
+// segments are sorted by the block kernel, which also handles segments that fit in a single tile.
+template<class Config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator,
+         class BinaryFunction>
+inline hipError_t segmented_merge_sort_impl(void*                temporary_storage,
+                                            size_t&              storage_size,
+                                            KeysInputIterator    keys_input,
+                                            KeysOutputIterator   keys_output,
+                                            ValuesInputIterator  values_input,
+                                            ValuesOutputIterator values_output,
+                                            const unsigned int   size,
+                                            const unsigned int   segments,
+                                            OffsetIterator       begin_offsets,
+                                            OffsetIterator       end_offsets,
+                                            BinaryFunction       compare_function,
+                                            const hipStream_t    stream,
+                                            const bool           debug_synchronous)
+{
+    using key_type               = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type             = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using segment_index_type     = unsigned int;
+    using segment_index_iterator = counting_iterator<segment_index_type>;
+
+    static_assert(
+        std::is_same<key_type,
+                     typename std::iterator_traits<KeysOutputIterator>::value_type>::value,
+        "KeysInputIterator and KeysOutputIterator must have the same value_type");
+    static_assert(
+        std::is_same<value_type,
+                     typename std::iterator_traits<ValuesOutputIterator>::value_type>::value,
+        "ValuesInputIterator and ValuesOutputIterator must have the same value_type");
+
+    using config = wrapped_segmented_merge_sort_config<Config, key_type, value_type>;
+
+    detail::target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, target_arch));
+    const segmented_merge_sort_config_params params = dispatch_target_arch<config>(target_arch);
+
+    constexpr bool     with_values = !std::is_same<value_type, empty_type>::value;
+    const unsigned int items_per_block
+        = params.kernel_config.block_size * params.kernel_config.items_per_thread;
+    const bool         partitioning_allowed = params.warp_sort_config.partitioning_allowed;
+    const unsigned int max_small_segment_length
+        = params.warp_sort_config.items_per_thread_small
+          * params.warp_sort_config.logical_warp_size_small;
+    const unsigned int small_segments_per_block
+        = params.warp_sort_config.block_size_small
+          / params.warp_sort_config.logical_warp_size_small;
+    const unsigned int max_medium_segment_length
+        = params.warp_sort_config.items_per_thread_medium
+          * params.warp_sort_config.logical_warp_size_medium;
+    const unsigned int medium_segments_per_block
+        = params.warp_sort_config.block_size_medium
+          / params.warp_sort_config.logical_warp_size_medium;
+
+    const bool  three_way_partitioning = max_small_segment_length < max_medium_segment_length;
+    Partitioner partitioner(three_way_partitioning);
+
+    const auto large_segment_selector = [=](const unsigned int segment_index) mutable -> bool
+    {
+        const unsigned int segment_length
+            = end_offsets[segment_index] - begin_offsets[segment_index];
+        return segment_length > max_medium_segment_length;
+    };
+    const auto medium_segment_selector = [=](const unsigned int segment_index) mutable -> bool
+    {
+        const unsigned int segment_length
+            = end_offsets[segment_index] - begin_offsets[segment_index];
+        return segment_length > max_small_segment_length;
+    };
+
+    const bool do_partitioning
+        = partitioning_allowed && segments >= params.warp_sort_config.partitioning_threshold;
+    // The keys are only merged through the temporary buffers if a segment is larger than a tile
+    const bool with_tmp = size > items_per_block;
+
+    const size_t medium_segment_indices_size = three_way_partitioning ? segments : 0;
+    const size_t segment_count_output_size   = three_way_partitioning ? 2 : 1;
+
+    segment_index_type* large_segment_indices_output{};
+    // The large and small indices fill the same buffer from both directions
+    auto small_segment_indices_output
+        = make_reverse_iterator(large_segment_indices_output + segments);
+    segment_index_type* medium_segment_indices_output{};
+    segment_index_type* segment_count_output{};
+    size_t              partition_storage_size{};
+    void*               partition_temporary_storage{};
+    key_type*           keys_tmp{};
+    value_type*         values_tmp{};
+
+    ROCPRIM_RETURN_ON_ERROR(partitioner(nullptr,
+                                        partition_storage_size,
+                                        segment_index_iterator{},
+                                        large_segment_indices_output,
+                                        medium_segment_indices_output,
+                                        small_segment_indices_output,
+                                        segment_count_output,
+                                        segments,
+                                        large_segment_selector,
+                                        medium_segment_selector,
+                                        stream,
+                                        debug_synchronous));
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&large_segment_indices_output,
+                                                    do_partitioning ? segments : 0),
+            detail::temp_storage::ptr_aligned_array(&medium_segment_indices_output,
+                                                    do_partitioning ? medium_segment_indices_size
+                                                                    : 0),
+            detail::temp_storage::ptr_aligned_array(&segment_count_output,
+                                                    segment_count_output_size),
+            detail::temp_storage::make_partition(&partition_temporary_storage,
+                                                 do_partitioning ? partition_storage_size : 0),
+            detail::temp_storage::ptr_aligned_array(&keys_tmp, with_tmp ? size : 0),
+            detail::temp_storage::ptr_aligned_array(&values_tmp,
+                                                    with_tmp && with_values ? size : 0)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(segments == 0u)
+    {
+        return hipSuccess;
+    }
+    if(debug_synchronous)
+    {
+        std::cout << "segments " << segments << '\n';
+        std::cout << "storage_size " << storage_size << '\n';
+        std::cout << "do_partitioning " << do_partitioning << '\n';
+        std::cout << "params.kernel_config.block_size: " << params.kernel_config.block_size
+                  << '\n';
+        std::cout << "params.kernel_config.items_per_thread: "
+                  << params.kernel_config.items_per_thread << '\n';
+        ROCPRIM_RETURN_ON_ERROR(hipStreamSynchronize(stream));
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(!do_partitioning)
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        segmented_merge_sort_block_kernel<config>
+            <<<dim3(segments), dim3(params.kernel_config.block_size), 0, stream>>>(
+                keys_input,
+                keys_tmp,
+                keys_output,
+                values_input,
+                values_tmp,
+                values_output,
+                segment_index_iterator{},
+                begin_offsets,
+                end_offsets,
+                compare_function);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_merge_sort", segments, start);
+        return hipSuccess;
+    }
+
+    small_segment_indices_output = make_reverse_iterator(large_segment_indices_output + segments);
+    ROCPRIM_RETURN_ON_ERROR(partitioner(partition_temporary_storage,
+                                        partition_storage_size,
+                                        segment_index_iterator{},
+                                        large_segment_indices_output,
+                                        medium_segment_indices_output,
+                                        small_segment_indices_output,
+                                        segment_count_output,
+                                        segments,
+                                        large_segment_selector,
+                                        medium_segment_selector,
+                                        stream,
+                                        debug_synchronous));
+    std::vector<segment_index_type> segment_counts(segment_count_output_size);
+    ROCPRIM_RETURN_ON_ERROR(
+        detail::memcpy_and_sync(segment_counts.data(),
+                                segment_count_output,
+                                segment_count_output_size * sizeof(segment_index_type),
+                                hipMemcpyDeviceToHost,
+                                stream));
+    const segment_index_type large_segment_count  = segment_counts[0];
+    const segment_index_type medium_segment_count = three_way_partitioning ? segment_counts[1] : 0;
+    const segment_index_type small_segment_count
+        = segments - large_segment_count - medium_segment_count;
+    if(debug_synchronous)
+    {
+        std::cout << "large_segment_count " << large_segment_count << '\n';
+        std::cout << "medium_segment_count " << medium_segment_count << '\n';
+        std::cout << "small_segment_count " << small_segment_count << '\n';
+    }
+
+    if(large_segment_count > 0)
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        segmented_merge_sort_block_kernel<config>
+            <<<dim3(large_segment_count), dim3(params.kernel_config.block_size), 0, stream>>>(
+                keys_input,
+                keys_tmp,
+                keys_output,
+                values_input,
+                values_tmp,
+                values_output,
+                large_segment_indices_output,
+                begin_offsets,
+                end_offsets,
+                compare_function);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_merge_sort:large_segments",
+                                                    large_segment_count,
+                                                    start);
+    }
+    if(medium_segment_count > 0)
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        segmented_merge_sort_medium_kernel<config>
+            <<<dim3(ceiling_div(medium_segment_count, medium_segments_per_block)),
+               dim3(params.warp_sort_config.block_size_medium),
+               0,
+               stream>>>(keys_input,
+                         keys_output,
+                         values_input,
+                         values_output,
+                         medium_segment_count,
+                         medium_segment_indices_output,
+                         begin_offsets,
+                         end_offsets,
+                         compare_function);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_merge_sort:medium_segments",
+                                                    medium_segment_count,
+                                                    start);
+    }
+    if(small_segment_count > 0)
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        segmented_merge_sort_small_kernel<config>
+            <<<dim3(ceiling_div(small_segment_count, small_segments_per_block)),
+               dim3(params.warp_sort_config.block_size_small),
+               0,
+               stream>>>(keys_input,
+                         keys_output,
+                         values_input,
+                         values_output,
+                         small_segment_count,
+                         small_segment_indices_output,
+                         begin_offsets,
+                         end_offsets,
+                         compare_function);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_merge_sort:small_segments",
+                                                    small_segment_count,
+                                                    start);
+    }
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \brief Parallel merge sort primitive for device level, which sorts each segment of keys by a
+/// comparison function.
+///
+/// \p segmented_merge_sort_keys function performs a device-wide merge sort across multiple,
+/// non-overlapping sequences of keys. Unlike \p segmented_radix_sort_keys, the keys are ordered
+/// by \p compare_function, so any key type with a strict weak ordering can be sorted, for
+/// example tuples in lexicographic order or floats in a custom order.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p keys_input and \p keys_output must have at least \p size elements.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
+/// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
+/// <tt>offsets + 1</tt> for \p end_offsets.
+/// * If there are at least \p partitioning_threshold segments (see \p WarpSortConfig), the
+/// segments are partitioned by size: small and medium segments are sorted by logical warps,
+/// large segments by one block each, which sorts the tiles of the segment and merges them
+/// pairwise. Otherwise every segment is sorted by a block.
+/// * \p keys_output is also used as a buffer of the pairwise merge of segments larger than a
+/// tile, so its iterator must be readable.
+///
+/// \par Stability
+/// \p segmented_merge_sort_keys is not guaranteed to be stable, see
+/// \p segmented_stable_merge_sort_keys for a stable sort. The current implementation sorts all
+/// segments by stable algorithms, but this may change.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `segmented_merge_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for sort. Default type is
+/// \p rocprim::less<T>, where \p T is a \p value_type of \p KeysInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the segments of an array of pairs are sorted in lexicographic order.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// struct lexicographic_less
+/// {
+///     __device__ bool operator()(const rocprim::tuple<int, int>& a,
+///                                const rocprim::tuple<int, int>& b) const
+///     {
+///         return rocprim::get<0>(a) != rocprim::get<0>(b)
+///                    ? rocprim::get<0>(a) < rocprim::get<0>(b)
+///                    : rocprim::get<1>(a) < rocprim::get<1>(b);
+///     }
+/// };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;                       // e.g., 5
+/// rocprim::tuple<int, int> * input;        // e.g., [(1, 2), (0, 5), (0, 1), (2, 0), (1, 1)]
+/// rocprim::tuple<int, int> * output;       // empty array of 5 elements
+/// unsigned int segments;                   // e.g., 2
+/// int * offsets;                           // e.g. [0, 3, 5]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_merge_sort_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size,
+///     segments, offsets, offsets + 1, lexicographic_less{}
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::segmented_merge_sort_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size,
+///     segments, offsets, offsets + 1, lexicographic_less{}
+/// );
+/// // keys_output: [(0, 1), (0, 5), (1, 2), (1, 1), (2, 0)]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class OffsetIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t segmented_merge_sort_keys(void*              temporary_storage,
+                                            size_t&            storage_size,
+                                            KeysInputIterator  keys_input,
+                                            KeysOutputIterator keys_output,
+                                            unsigned int       size,
+                                            unsigned int       segments,
+                                            OffsetIterator     begin_offsets,
+                                            OffsetIterator     end_offsets,
+                                            BinaryFunction     compare_function = BinaryFunction(),
+                                            hipStream_t        stream           = 0,
+                                            bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::segmented_merge_sort_impl<Config>(temporary_storage,
+                                                     storage_size,
+                                                     keys_input,
+                                                     keys_output,
+                                                     values,
+                                                     values,
+                                                     size,
+                                                     segments,
+                                                     begin_offsets,
+                                                     end_offsets,
+                                                     compare_function,
+                                                     stream,
+                                                     debug_synchronous);
+}
+
+/// \brief Parallel merge sort-by-key primitive for device level, which sorts each segment of
+/// (key, value) pairs by a comparison function of the keys.
+///
+/// \p segmented_merge_sort_pairs function performs a device-wide merge sort across multiple,
+/// non-overlapping sequences of (key, value) pairs, see \p segmented_merge_sort_keys.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p keys_input, \p keys_output, \p values_input and \p values_output must
+/// have at least \p size elements.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
+/// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
+/// <tt>offsets + 1</tt> for \p end_offsets.
+/// * \p keys_output and \p values_output are also used as buffers of the pairwise merge of
+/// segments larger than a tile, so their iterators must be readable.
+///
+/// \par Stability
+/// \p segmented_merge_sort_pairs is not guaranteed to be stable, see
+/// \p segmented_stable_merge_sort_pairs for a stable sort.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `segmented_merge_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for sort. Default type is
+/// \p rocprim::less<T>, where \p T is a \p value_type of \p KeysInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in range of values.
+/// \param [out] values_output - pointer to the first element in the output range of values.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison of the keys. The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t segmented_merge_sort_pairs(void*                temporary_storage,
+                                             size_t&              storage_size,
+                                             KeysInputIterator    keys_input,
+                                             KeysOutputIterator   keys_output,
+                                             ValuesInputIterator  values_input,
+                                             ValuesOutputIterator values_output,
+                                             unsigned int         size,
+                                             unsigned int         segments,
+                                             OffsetIterator       begin_offsets,
+                                             OffsetIterator       end_offsets,
+                                             BinaryFunction compare_function  = BinaryFunction(),
+                                             hipStream_t    stream            = 0,
+                                             bool           debug_synchronous = false)
+{
+    return detail::segmented_merge_sort_impl<Config>(temporary_storage,
+                                                     storage_size,
+                                                     keys_input,
+                                                     keys_output,
+                                                     values_input,
+                                                     values_output,
+                                                     size,
+                                                     segments,
+                                                     begin_offsets,
+                                                     end_offsets,
+                                                     compare_function,
+                                                     stream,
+                                                     debug_synchronous);
+}
+
+/// \brief Parallel stable merge sort primitive for device level, which sorts each segment of
+/// keys by a comparison function.
+///
+/// \p segmented_stable_merge_sort_keys function is the stable variant of
+/// \p segmented_merge_sort_keys and takes the same arguments.
+///
+/// \par Stability
+/// \p segmented_stable_merge_sort_keys is \b stable: it preserves the relative ordering of
+/// equivalent keys. That is, given two keys \p a and \p b and a binary boolean operation \p op
+/// such that:
+///   * \p a precedes \p b in the input keys, and
+///   * op(a, b) and op(b, a) are both false,
+/// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `segmented_merge_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for sort. Default type is
+/// \p rocprim::less<T>, where \p T is a \p value_type of \p KeysInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class OffsetIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t segmented_stable_merge_sort_keys(void*              temporary_storage,
+                                                   size_t&            storage_size,
+                                                   KeysInputIterator  keys_input,
+                                                   KeysOutputIterator keys_output,
+                                                   unsigned int       size,
+                                                   unsigned int       segments,
+                                                   OffsetIterator     begin_offsets,
+                                                   OffsetIterator     end_offsets,
+                                                   BinaryFunction     compare_function
+                                                   = BinaryFunction(),
+                                                   hipStream_t stream            = 0,
+                                                   bool        debug_synchronous = false)
+{
+    // The warp and block merge sorts are stable
+    return segmented_merge_sort_keys<Config>(temporary_storage,
+                                             storage_size,
+                                             keys_input,
+                                             keys_output,
+                                             size,
+                                             segments,
+                                             begin_offsets,
+                                             end_offsets,
+                                             compare_function,
+                                             stream,
+                                             debug_synchronous);
+}
+
+/// \brief Parallel stable merge sort-by-key primitive for device level, which sorts each segment
+/// of (key, value) pairs by a comparison function of the keys.
+///
+/// \p segmented_stable_merge_sort_pairs function is the stable variant of
+/// \p segmented_merge_sort_pairs and takes the same arguments.
+///
+/// \par Stability
+/// \p segmented_stable_merge_sort_pairs is \b stable: it preserves the relative ordering of
+/// equivalent keys and their values. That is, given two keys \p a and \p b and a binary boolean
+/// operation \p op such that:
+///   * \p a precedes \p b in the input keys, and
+///   * op(a, b) and op(b, a) are both false,
+/// then it is \b guaranteed that \p a will precede \p b as well in the output (ordered) keys.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or
+/// `segmented_merge_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for sort. Default type is
+/// \p rocprim::less<T>, where \p T is a \p value_type of \p KeysInputIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in range of values.
+/// \param [out] values_output - pointer to the first element in the output range of values.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison of the keys. The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator>::value_type>>
+inline hipError_t segmented_stable_merge_sort_pairs(void*                temporary_storage,
+                                                    size_t&              storage_size,
+                                                    KeysInputIterator    keys_input,
+                                                    KeysOutputIterator   keys_output,
+                                                    ValuesInputIterator  values_input,
+                                                    ValuesOutputIterator values_output,
+                                                    unsigned int         size,
+                                                    unsigned int         segments,
+                                                    OffsetIterator       begin_offsets,
+                                                    OffsetIterator       end_offsets,
+                                                    BinaryFunction       compare_function
+                                                    = BinaryFunction(),
+                                                    hipStream_t stream            = 0,
+                                                    bool        debug_synchronous = false)
+{
+    // The warp and block merge sorts are stable
+    return segmented_merge_sort_pairs<Config>(temporary_storage,
+                                              storage_size,
+                                              keys_input,
+                                              keys_output,
+                                              values_input,
+                                              values_output,
+                                              size,
+                                              segments,
+                                              begin_offsets,
+                                              end_offsets,
+                                              compare_function,
+                                              stream,
+                                              debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_SEGMENTED_MERGE_SORT_HPP_
@@ -29,6 +29,7 @@
 
 #include "../config.hpp"
 #include "../common.hpp"
+#include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
 #include "config_types.hpp"
 
@@ -42,6 +43,7 @@
 #include "../thread/radix_key_codec.hpp"
 #include "detail/device_segmented_radix_sort.hpp"
 #include "device_partition.hpp"
+#include "device_radix_sort.hpp"
 #include "device_segmented_radix_sort_config.hpp"
 
 /// \addtogroup devicemodule
@@ -58,7 +60,8 @@ template<class Config,
          class KeysOutputIterator,
          class ValuesInputIterator,
          class ValuesOutputIterator,
-         class OffsetIterator>
+         class OffsetIterator,
+         class Decomposer>
 ROCPRIM_KERNEL
     __launch_bounds__(device_params<Config>().kernel_config.block_size)
 void segmented_sort_kernel(
@@ -73,7 +76,8 @@ void segmented_sort_kernel(
     OffsetIterator                                                  end_offsets,
     unsigned int                                                    iterations,
     unsigned int                                                    begin_bit,
-    unsigned int                                                    end_bit)
+    unsigned int                                                    end_bit,
+    Decomposer                                                      decomposer)
 {
     segmented_sort<Config, Descending>(keys_input,
                                        keys_tmp,
@@ -86,7 +90,8 @@ void segmented_sort_kernel(
                                        end_offsets,
                                        iterations,
                                        begin_bit,
-                                       end_bit);
+                                       end_bit,
+                                       decomposer);
 }
 
 template<class Config,
@@ -96,7 +101,8 @@ template<class Config,
          class ValuesInputIterator,
          class ValuesOutputIterator,
          class SegmentIndexIterator,
-         class OffsetIterator>
+         class OffsetIterator,
+         class Decomposer>
 ROCPRIM_KERNEL __launch_bounds__(
     device_params<Config>()
         .kernel_config
@@ -114,7 +120,8 @@ void segmented_sort_large_kernel(
     OffsetIterator                                                  end_offsets,
     unsigned int                                                    iterations,
     unsigned int                                                    begin_bit,
-    unsigned int                                                    end_bit)
+    unsigned int                                                    end_bit,
+    Decomposer                                                      decomposer)
 {
     segmented_sort_large<Config, Descending>(keys_input,
                                              keys_tmp,
@@ -128,7 +135,8 @@ void segmented_sort_large_kernel(
                                              end_offsets,
                                              iterations,
                                              begin_bit,
-                                             end_bit);
+                                             end_bit,
+                                             decomposer);
 }
 
 template<class Config,
@@ -138,7 +146,8 @@ template<class Config,
          class ValuesInputIterator,
          class ValuesOutputIterator,
          class SegmentIndexIterator,
-         class OffsetIterator>
+         class OffsetIterator,
+         class Decomposer>
 ROCPRIM_KERNEL __launch_bounds__(
     device_params<Config>()
         .warp_sort_config
@@ -158,13 +167,14 @@ ROCPRIM_KERNEL __launch_bounds__(
                                                             OffsetIterator       begin_offsets,
                                                             OffsetIterator       end_offsets,
                                                             unsigned int         begin_bit,
-                                                            unsigned int         end_bit)
+                                                            unsigned int         end_bit,
+                                                            Decomposer           decomposer)
 {
     segmented_sort_small<Config, Descending>(
         keys_input, keys_tmp, keys_output, values_input, values_tmp, values_output,
         to_output, num_segments, segment_indices,
         begin_offsets, end_offsets,
-        begin_bit, end_bit
+        begin_bit, end_bit, decomposer
     );
 }
 
@@ -175,7 +185,8 @@ template<class Config,
          class ValuesInputIterator,
          class ValuesOutputIterator,
          class SegmentIndexIterator,
-         class OffsetIterator>
+         class OffsetIterator,
+         class Decomposer>
 ROCPRIM_KERNEL __launch_bounds__(
     device_params<Config>()
         .warp_sort_config
@@ -195,7 +206,8 @@ ROCPRIM_KERNEL __launch_bounds__(
                                                               OffsetIterator       begin_offsets,
                                                               OffsetIterator       end_offsets,
                                                               unsigned int         begin_bit,
-                                                              unsigned int         end_bit)
+                                                              unsigned int         end_bit,
+                                                              Decomposer           decomposer)
 {
     segmented_sort_medium<Config, Descending>(keys_input,
                                               keys_tmp,
@@ -209,7 +221,186 @@ ROCPRIM_KERNEL __launch_bounds__(
                                               begin_offsets,
                                               end_offsets,
                                               begin_bit,
-                                              end_bit);
+                                              end_bit,
+                                              decomposer);
+}
+
+template<class SegmentIndexIterator, class OffsetIterator>
+ROCPRIM_KERNEL
+    __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE) void segmented_sort_gather_bounds_kernel(
+        SegmentIndexIterator segment_indices,
+        OffsetIterator       begin_offsets,
+        OffsetIterator       end_offsets,
+        unsigned int*        segment_bounds,
+        unsigned int         num_segments)
+{
+    const unsigned int index
+        = ::rocprim::detail::block_id<0>() * ROCPRIM_DEFAULT_MAX_BLOCK_SIZE
+          + ::rocprim::detail::block_thread_id<0>();
+    if(index < num_segments)
+    {
+        const unsigned int segment_index = segment_indices[index];
+        segment_bounds[2 * index]        = begin_offsets[segment_index];
+        segment_bounds[2 * index + 1]    = end_offsets[segment_index];
+    }
+}
+
+// Sorts a single segment with the device-wide onesweep radix sort. The result is stored in
+// keys_output if result_in_output is true, otherwise in keys_tmp, so that the segment ends up
+// in the same buffer as the segments that are sorted by the block and warp level kernels.
+template<bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class Decomposer>
+hipError_t segmented_sort_onesweep_segment(
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* values_tmp,
+    ValuesOutputIterator                                            values_output,
+    const bool                                                      with_double_buffer,
+    const bool                                                      result_in_output,
+    const unsigned int                                              segment_begin,
+    const unsigned int                                              segment_length,
+    unsigned int*                                                   global_digit_offsets,
+    unsigned int*                                                   global_digit_offsets_tmp,
+    unsigned int*                                                   trivial_digits,
+    onesweep_lookback_state*                                        lookback_states,
+    const unsigned int                                              begin_bit,
+    const unsigned int                                              end_bit,
+    Decomposer                                                      decomposer,
+    const hipStream_t                                               stream,
+    const bool                                                      debug_synchronous)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using config     = wrapped_radix_sort_onesweep_config<default_config, key_type, value_type>;
+
+    static constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, target_arch));
+    const radix_sort_onesweep_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int radix_size_per_place = 1u << params.radix_bits_per_place;
+    const unsigned int places = ceiling_div(end_bit - begin_bit, params.radix_bits_per_place);
+
+    auto segment_keys_input    = keys_input + segment_begin;
+    auto segment_keys_tmp      = keys_tmp + segment_begin;
+    auto segment_keys_output   = keys_output + segment_begin;
+    auto segment_values_input  = values_input + segment_begin;
+    auto segment_values_tmp    = values_tmp + segment_begin;
+    auto segment_values_output = values_output + segment_begin;
+
+    ROCPRIM_RETURN_ON_ERROR(
+        radix_sort_onesweep_global_offsets<default_config, Descending>(segment_keys_input,
+                                                                       segment_values_input,
+                                                                       global_digit_offsets,
+                                                                       trivial_digits,
+                                                                       nullptr,
+                                                                       nullptr,
+                                                                       false,
+                                                                       segment_length,
+                                                                       places,
+                                                                       decomposer,
+                                                                       begin_bit,
+                                                                       end_bit,
+                                                                       stream,
+                                                                       debug_synchronous));
+
+    // Choose the destination of the first place so that the last place writes to the buffer
+    // selected by result_in_output.
+    bool to_output  = result_in_output == ((places - 1) % 2 == 0);
+    bool from_input = true;
+
+    // The onesweep iteration can not scatter into the range that it reads from. With a double
+    // buffer keys_tmp aliases keys_input, otherwise keys_output may alias keys_input (in-place sort).
+    const bool first_place_aliases
+        = to_output ? !with_double_buffer
+                          && (::rocprim::detail::can_iterators_alias(segment_keys_input,
+                                                                     segment_keys_output,
+                                                                     segment_length)
+                              || (with_values
+                                  && ::rocprim::detail::can_iterators_alias(segment_values_input,
+                                                                            segment_values_output,
+                                                                            segment_length)))
+                    : with_double_buffer;
+    if(first_place_aliases)
+    {
+        // Move the segment to the buffer that the first place reads when it does not read the input.
+        if(to_output)
+        {
+            ROCPRIM_RETURN_ON_ERROR(::rocprim::transform(segment_keys_input,
+                                                         segment_keys_tmp,
+                                                         segment_length,
+                                                         ::rocprim::identity<key_type>(),
+                                                         stream,
+                                                         debug_synchronous));
+            if(with_values)
+            {
+                ROCPRIM_RETURN_ON_ERROR(::rocprim::transform(segment_values_input,
+                                                             segment_values_tmp,
+                                                             segment_length,
+                                                             ::rocprim::identity<value_type>(),
+                                                             stream,
+                                                             debug_synchronous));
+            }
+        }
+        else
+        {
+            ROCPRIM_RETURN_ON_ERROR(::rocprim::transform(segment_keys_input,
+                                                         segment_keys_output,
+                                                         segment_length,
+                                                         ::rocprim::identity<key_type>(),
+                                                         stream,
+                                                         debug_synchronous));
+            if(with_values)
+            {
+                ROCPRIM_RETURN_ON_ERROR(::rocprim::transform(segment_values_input,
+                                                             segment_values_output,
+                                                             segment_length,
+                                                             ::rocprim::identity<value_type>(),
+                                                             stream,
+                                                             debug_synchronous));
+            }
+        }
+        from_input = false;
+    }
+
+    onesweep_lookback_epoch lookback_epoch{};
+    for(unsigned int bit = begin_bit, place = 0; bit < end_bit;
+        bit += params.radix_bits_per_place, ++place)
+    {
+        ROCPRIM_RETURN_ON_ERROR(radix_sort_onesweep_iteration<default_config, Descending>(
+            segment_keys_input,
+            segment_keys_tmp,
+            segment_keys_output,
+            segment_values_input,
+            segment_values_tmp,
+            segment_values_output,
+            segment_length,
+            global_digit_offsets + place * radix_size_per_place,
+            global_digit_offsets_tmp,
+            lookback_states,
+            lookback_epoch,
+            trivial_digits + place,
+            nullptr,
+            from_input,
+            to_output,
+            decomposer,
+            bit,
+            end_bit,
+            stream,
+            debug_synchronous));
+
+        from_input = false;
+        to_output  = !to_output;
+    }
+
+    return hipSuccess;
 }
 
 struct Partitioner
@@ -278,7 +469,8 @@ template<
     class KeysOutputIterator,
     class ValuesInputIterator,
     class ValuesOutputIterator,
-    class OffsetIterator
+    class OffsetIterator,
+    class Decomposer = ::rocprim::identity_decomposer
 >
 inline
 hipError_t segmented_radix_sort_impl(void * temporary_storage,
@@ -297,7 +489,8 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
                                      unsigned int begin_bit,
                                      unsigned int end_bit,
                                      hipStream_t stream,
-                                     bool debug_synchronous)
+                                     bool debug_synchronous,
+                                     Decomposer decomposer = {})
 {
     using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
     using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
@@ -361,6 +554,46 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
     const bool         do_partitioning
         = partitioning_allowed && segments >= params.warp_sort_config.partitioning_threshold;
 
+    // Segments with at least onesweep_segment_threshold items are sorted one after the other by the
+    // device-wide onesweep radix sort. Since each of those segments has at least that many items,
+    // there can be at most size / onesweep_segment_threshold of them.
+    const unsigned int onesweep_segment_threshold = params.onesweep_segment_threshold;
+    const bool         onesweep_allowed
+        = partitioning_allowed && onesweep_segment_threshold > max_medium_segment_length
+          && size >= onesweep_segment_threshold;
+    const size_t max_onesweep_segments = onesweep_allowed ? size / onesweep_segment_threshold : 0;
+
+    using onesweep_config = wrapped_radix_sort_onesweep_config<default_config, key_type, value_type>;
+    const radix_sort_onesweep_config_params onesweep_params
+        = dispatch_target_arch<onesweep_config>(target_arch);
+    const unsigned int onesweep_items_per_block
+        = onesweep_params.sort.block_size * onesweep_params.sort.items_per_thread;
+    const unsigned int onesweep_radix_size = 1u << onesweep_params.radix_bits_per_place;
+    const unsigned int onesweep_places
+        = ::rocprim::detail::ceiling_div(bits, onesweep_params.radix_bits_per_place);
+    const unsigned int onesweep_max_items_per_full_batch = 1u << 30;
+    const unsigned int onesweep_items_per_batch
+        = ::rocprim::min(size,
+                         onesweep_max_items_per_full_batch
+                             - onesweep_max_items_per_full_batch % onesweep_items_per_block);
+
+    const size_t onesweep_segment_indices_size = onesweep_allowed ? segments : 0;
+    const size_t onesweep_bins_size = onesweep_allowed ? onesweep_radix_size * onesweep_places : 0;
+    const size_t onesweep_bins_tmp_size = onesweep_allowed ? onesweep_radix_size : 0;
+    const size_t onesweep_trivial_digits_size = onesweep_allowed ? onesweep_places : 0;
+    const size_t onesweep_lookback_states_size
+        = onesweep_allowed ? onesweep_radix_size
+                                 * ::rocprim::detail::ceiling_div(onesweep_items_per_batch,
+                                                                  onesweep_items_per_block)
+                           : 0;
+    const auto onesweep_segment_selector = [=](const unsigned int segment_index) mutable -> bool
+    {
+        const unsigned int segment_length
+            = end_offsets[segment_index] - begin_offsets[segment_index];
+        return segment_length >= onesweep_segment_threshold;
+    };
+    Partitioner onesweep_partitioner(false);
+
     const size_t medium_segment_indices_size = three_way_partitioning ? segments : 0;
     const size_t segment_count_output_size   = three_way_partitioning ? 2 : 1;
     const size_t segment_count_output_bytes
@@ -377,6 +610,12 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
     segment_index_type* segment_count_output{};
     size_t              partition_storage_size{};
     void*               partition_temporary_storage{};
+    segment_index_type* onesweep_segment_indices_output{};
+    unsigned int*       onesweep_segment_bounds{};
+    unsigned int*       onesweep_digit_offsets{};
+    unsigned int*       onesweep_digit_offsets_tmp{};
+    unsigned int*       onesweep_trivial_digits{};
+    onesweep_lookback_state* onesweep_lookback_states{};
 
     const auto partitioner_result = partitioner(nullptr,
                                                 partition_storage_size,
@@ -394,6 +633,29 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
     {
         return partitioner_result;
     }
+    if(onesweep_allowed)
+    {
+        // The large segments are split into onesweep and block-sorted segments by another partitioning.
+        size_t           onesweep_partition_storage_size{};
+        const hipError_t onesweep_partitioner_result
+            = onesweep_partitioner(nullptr,
+                                   onesweep_partition_storage_size,
+                                   large_segment_indices_output,
+                                   onesweep_segment_indices_output,
+                                   onesweep_segment_indices_output,
+                                   onesweep_segment_indices_output,
+                                   segment_count_output,
+                                   segments,
+                                   onesweep_segment_selector,
+                                   onesweep_segment_selector,
+                                   stream,
+                                   debug_synchronous);
+        if(hipSuccess != onesweep_partitioner_result)
+        {
+            return onesweep_partitioner_result;
+        }
+        partition_storage_size = std::max(partition_storage_size, onesweep_partition_storage_size);
+    }
 
     const hipError_t partition_result = detail::temp_storage::partition(
         temporary_storage,
@@ -405,6 +667,18 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
                                                     medium_segment_indices_size),
             detail::temp_storage::ptr_aligned_array(&segment_count_output,
                                                     segment_count_output_size),
+            // These are only required when segments may be sorted by onesweep.
+            detail::temp_storage::ptr_aligned_array(&onesweep_segment_indices_output,
+                                                    onesweep_segment_indices_size),
+            detail::temp_storage::ptr_aligned_array(&onesweep_segment_bounds,
+                                                    2 * max_onesweep_segments),
+            detail::temp_storage::ptr_aligned_array(&onesweep_digit_offsets, onesweep_bins_size),
+            detail::temp_storage::ptr_aligned_array(&onesweep_digit_offsets_tmp,
+                                                    onesweep_bins_tmp_size),
+            detail::temp_storage::ptr_aligned_array(&onesweep_trivial_digits,
+                                                    onesweep_trivial_digits_size),
+            detail::temp_storage::ptr_aligned_array(&onesweep_lookback_states,
+                                                    onesweep_lookback_states_size),
             detail::temp_storage::make_union_partition(
                 // Partition temporary storage only needed by partitioning.
                 detail::temp_storage::make_partition(&partition_temporary_storage,
@@ -434,6 +708,7 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
         std::cout << "storage_size " << storage_size << '\n';
         std::cout << "iterations " << iterations << '\n';
         std::cout << "do_partitioning " << do_partitioning << '\n';
+        std::cout << "onesweep_allowed " << onesweep_allowed << '\n';
         std::cout << "params.kernel_config.block_size: " << params.kernel_config.block_size << '\n';
         std::cout << "params.kernel_config.items_per_thread: "
                   << params.kernel_config.items_per_thread << '\n';
@@ -489,12 +764,86 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
             std::cout << "medium_segment_count " << medium_segment_count << '\n';
             std::cout << "small_segment_count " << small_segment_count << '\n';
         }
-        if(large_segment_count > 0)
+        // Split off the segments that are sorted by the device-wide onesweep radix sort. They are
+        // selected to the front of onesweep_segment_indices_output and the remaining large
+        // segments are written to the back.
+        segment_index_type  onesweep_segment_count      = 0;
+        segment_index_type  block_segment_count         = large_segment_count;
+        segment_index_type* block_segment_indices_input = large_segment_indices_output;
+        std::vector<unsigned int> onesweep_bounds;
+        if(onesweep_allowed && large_segment_count > 0)
+        {
+            result = onesweep_partitioner(partition_temporary_storage,
+                                          partition_storage_size,
+                                          large_segment_indices_output,
+                                          onesweep_segment_indices_output,
+                                          onesweep_segment_indices_output,
+                                          onesweep_segment_indices_output,
+                                          segment_count_output,
+                                          large_segment_count,
+                                          onesweep_segment_selector,
+                                          onesweep_segment_selector,
+                                          stream,
+                                          debug_synchronous);
+            if(hipSuccess != result)
+            {
+                return result;
+            }
+            result = detail::memcpy_and_sync(&onesweep_segment_count,
+                                             segment_count_output,
+                                             sizeof(segment_index_type),
+                                             hipMemcpyDeviceToHost,
+                                             stream);
+            if(hipSuccess != result)
+            {
+                return result;
+            }
+            block_segment_count         = large_segment_count - onesweep_segment_count;
+            block_segment_indices_input = onesweep_segment_indices_output + onesweep_segment_count;
+            if(debug_synchronous)
+            {
+                std::cout << "onesweep_segment_count " << onesweep_segment_count << '\n';
+            }
+
+            if(onesweep_segment_count > 0)
+            {
+                std::chrono::steady_clock::time_point start;
+                if(debug_synchronous)
+                    start = std::chrono::steady_clock::now();
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(segmented_sort_gather_bounds_kernel),
+                    dim3(::rocprim::detail::ceiling_div(onesweep_segment_count,
+                                                        ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)),
+                    dim3(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE),
+                    0,
+                    stream,
+                    onesweep_segment_indices_output,
+                    begin_offsets,
+                    end_offsets,
+                    onesweep_segment_bounds,
+                    onesweep_segment_count);
+                ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_sort:gather_bounds",
+                                                            onesweep_segment_count,
+                                                            start);
+
+                onesweep_bounds.resize(2 * onesweep_segment_count);
+                result = detail::memcpy_and_sync(onesweep_bounds.data(),
+                                                 onesweep_segment_bounds,
+                                                 onesweep_bounds.size() * sizeof(unsigned int),
+                                                 hipMemcpyDeviceToHost,
+                                                 stream);
+                if(hipSuccess != result)
+                {
+                    return result;
+                }
+            }
+        }
+        if(block_segment_count > 0)
         {
             std::chrono::steady_clock::time_point start;
             if(debug_synchronous) start = std::chrono::steady_clock::now();
             hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_sort_large_kernel<config, Descending>),
-                               dim3(large_segment_count),
+                               dim3(block_segment_count),
                                dim3(params.kernel_config.block_size),
                                0,
                                stream,
@@ -505,14 +854,15 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
                                values_tmp,
                                values_output,
                                to_output,
-                               large_segment_indices_output,
+                               block_segment_indices_input,
                                begin_offsets,
                                end_offsets,
                                iterations,
                                begin_bit,
-                               end_bit);
+                               end_bit,
+                               decomposer);
             ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_sort:large_segments",
-                                                        large_segment_count,
+                                                        block_segment_count,
                                                         start);
         }
         if(three_way_partitioning && medium_segment_count > 0)
@@ -539,7 +889,8 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
                                begin_offsets,
                                end_offsets,
                                begin_bit,
-                               end_bit);
+                               end_bit,
+                               decomposer);
             ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_sort:medium_segments",
                                                         medium_segment_count,
                                                         start);
@@ -567,11 +918,41 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
                                begin_offsets,
                                end_offsets,
                                begin_bit,
-                               end_bit);
+                               end_bit,
+                               decomposer);
             ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_sort:small_segments",
                                                         small_segment_count,
                                                         start);
         }
+        // The huge segments are sorted last, each one using the whole device.
+        for(segment_index_type i = 0; i < onesweep_segment_count; ++i)
+        {
+            const unsigned int segment_begin = onesweep_bounds[2 * i];
+            const unsigned int segment_end   = onesweep_bounds[2 * i + 1];
+            result = segmented_sort_onesweep_segment<Descending>(keys_input,
+                                                                 keys_tmp,
+                                                                 keys_output,
+                                                                 values_input,
+                                                                 values_tmp,
+                                                                 values_output,
+                                                                 with_double_buffer,
+                                                                 is_result_in_output,
+                                                                 segment_begin,
+                                                                 segment_end - segment_begin,
+                                                                 onesweep_digit_offsets,
+                                                                 onesweep_digit_offsets_tmp,
+                                                                 onesweep_trivial_digits,
+                                                                 onesweep_lookback_states,
+                                                                 begin_bit,
+                                                                 end_bit,
+                                                                 decomposer,
+                                                                 stream,
+                                                                 debug_synchronous);
+            if(hipSuccess != result)
+            {
+                return result;
+            }
+        }
     }
     else
     {
@@ -593,13 +974,173 @@ hipError_t segmented_radix_sort_impl(void * temporary_storage,
                            end_offsets,
                            iterations,
                            begin_bit,
-                           end_bit);
+                           end_bit,
+                           decomposer);
         ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_sort", segments, start);
     }
     return hipSuccess;
 }
 
+// Maps a key to the key of the opposite order: the ascending order of the reversed keys is the
+// descending order of the keys, in all of their bits. Reversing a reversed key restores it.
+template<class Key>
+ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+Key segmented_radix_sort_reverse_key(const Key key)
+{
+    return radix_key_codec<Key>::decode(radix_key_codec<Key, true>::encode(key));
+}
+
+template<class KeysInputIterator,
+         class KeysOutputIterator,
+         class OffsetIterator,
+         class DescendingIterator>
+ROCPRIM_KERNEL
+    __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE) void segmented_sort_reverse_keys_kernel(
+        KeysInputIterator  keys_input,
+        KeysOutputIterator keys_output,
+        OffsetIterator     begin_offsets,
+        OffsetIterator     end_offsets,
+        DescendingIterator descending)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    const unsigned int segment_index = ::rocprim::detail::block_id<0>();
+    const unsigned int begin         = begin_offsets[segment_index];
+    const unsigned int end           = end_offsets[segment_index];
+    const bool         reverse       = descending[segment_index];
+    for(unsigned int i = begin + ::rocprim::detail::block_thread_id<0>(); i < end;
+        i += ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
+    {
+        const key_type key = keys_input[i];
+        keys_output[i]     = reverse ? segmented_radix_sort_reverse_key(key) : key;
+    }
+}
+
+// Sorts every segment in the direction given by descending: the keys of the descending segments
+// are reversed while they are copied to the temporary storage, all segments are sorted in
+// ascending order, and the keys of the descending segments are reversed again while they are
+// copied to keys_output. Since the order of the reversed keys is the descending order of the
+// keys, the sort stays stable in both directions.
+template<class Config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator,
+         class DescendingIterator>
+inline hipError_t segmented_radix_sort_directions_impl(void*                temporary_storage,
+                                                       size_t&              storage_size,
+                                                       KeysInputIterator    keys_input,
+                                                       KeysOutputIterator   keys_output,
+                                                       ValuesInputIterator  values_input,
+                                                       ValuesOutputIterator values_output,
+                                                       unsigned int         size,
+                                                       unsigned int         segments,
+                                                       OffsetIterator       begin_offsets,
+                                                       OffsetIterator       end_offsets,
+                                                       DescendingIterator   descending,
+                                                       unsigned int         begin_bit,
+                                                       unsigned int         end_bit,
+                                                       hipStream_t          stream,
+                                                       bool                 debug_synchronous)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    static_assert(radix_key_fundamental<key_type>::value && !std::is_same<key_type, bool>::value,
+                  "Sorts with a direction per segment support only arithmetic key types");
+
+    key_type* keys_reversed = nullptr;
+    key_type* keys_sorted   = nullptr;
+    void*     sort_storage;
+    size_t    sort_storage_size = 0;
+    bool      ignored;
+
+    ROCPRIM_RETURN_ON_ERROR(segmented_radix_sort_impl<Config, false>(nullptr,
+                                                                     sort_storage_size,
+                                                                     keys_reversed,
+                                                                     nullptr,
+                                                                     keys_sorted,
+                                                                     values_input,
+                                                                     nullptr,
+                                                                     values_output,
+                                                                     size,
+                                                                     ignored,
+                                                                     segments,
+                                                                     begin_offsets,
+                                                                     end_offsets,
+                                                                     begin_bit,
+                                                                     end_bit,
+                                                                     stream,
+                                                                     debug_synchronous));
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&keys_reversed, size),
+            detail::temp_storage::ptr_aligned_array(&keys_sorted, size),
+            detail::temp_storage::make_partition(&sort_storage, sort_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+    if(size == 0u || segments == 0u)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_sort_reverse_keys_kernel),
+                       dim3(segments),
+                       dim3(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE),
+                       0,
+                       stream,
+                       keys_input,
+                       keys_reversed,
+                       begin_offsets,
+                       end_offsets,
+                       descending);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_sort:reverse_input", segments, start);
+
+    ROCPRIM_RETURN_ON_ERROR(segmented_radix_sort_impl<Config, false>(sort_storage,
+                                                                     sort_storage_size,
+                                                                     keys_reversed,
+                                                                     nullptr,
+                                                                     keys_sorted,
+                                                                     values_input,
+                                                                     nullptr,
+                                                                     values_output,
+                                                                     size,
+                                                                     ignored,
+                                                                     segments,
+                                                                     begin_offsets,
+                                                                     end_offsets,
+                                                                     begin_bit,
+                                                                     end_bit,
+                                                                     stream,
+                                                                     debug_synchronous));
 
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_sort_reverse_keys_kernel),
+                       dim3(segments),
+                       dim3(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE),
+                       0,
+                       stream,
+                       keys_sorted,
+                       keys_output,
+                       begin_offsets,
+                       end_offsets,
+                       descending);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_sort:reverse_output", segments, start);
+    return hipSuccess;
+}
 
 } // end namespace detail
 
@@ -1712,6 +2253,959 @@ hipError_t segmented_radix_sort_pairs_desc(void * temporary_storage,
     return error;
 }
 
+/// \brief Parallel ascending radix sort primitive for device level, for keys of a custom type.
+///
+/// \p segmented_radix_sort_keys function performs a device-wide radix sort across multiple,
+/// non-overlapping sequences of keys. Function sorts input keys in ascending order.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) can be any
+/// trivially copyable type.
+/// * \p decomposer must be a functor that implements `operator()(Key&) const`. This operator
+/// must return a \p rocprim::tuple that contains one or more reference to value(s) of arithmetic
+/// types. These references must point to member variables of `Key`, however not every member
+/// variable has to be exposed this way.
+/// * The bit range [begin_bit, end_bit) refers to the bits of the tuple elements, where the
+/// first element of the tuple is the most significant one. The default range covers all bits.
+/// * Ranges specified by \p keys_input and \p keys_output must have at least \p size elements.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements. They may use the same sequence <tt>offsets</tt> of at least
+/// <tt>segments + 1</tt> elements: <tt>offsets</tt> for \p begin_offsets and
+/// <tt>offsets + 1</tt> for \p end_offsets.
+///
+/// \par Stability
+/// \p segmented_radix_sort_keys is \b stable: it preserves the relative ordering of equivalent keys.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `segmented_radix_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam Decomposer - the type of the decomposer functor.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] decomposer - decomposer functor that produces a tuple of references from the
+/// input key type.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Default value: \p 0.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Default value: the total number of bits of the tuple elements.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level ascending radix sort is performed on segments of
+/// values of a custom type, using a custom decomposer.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// struct custom_type
+/// {
+///     int i;
+///     double d;
+/// };
+///
+/// struct custom_type_decomposer
+/// {
+///     rocprim::tuple<int&, double&> operator()(custom_type& key) const
+///     {
+///         return rocprim::tuple<int&, double&>(key.i, key.d);
+///     }
+/// };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;       // e.g., 6
+/// custom_type * input;     // e.g., [{2, 0.6}, {-3, 0.3}, {2, 0.65}, {0, 0.4}, {0, 0.2}, {-1, 0.7}]
+/// custom_type * output;    // empty array of 6 elements
+/// unsigned int segments;   // e.g., 2
+/// int * offsets;           // e.g. [0, 3, 6]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_radix_sort_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size,
+///     segments, offsets, offsets + 1, custom_type_decomposer{}
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::segmented_radix_sort_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size,
+///     segments, offsets, offsets + 1, custom_type_decomposer{}
+/// );
+/// // keys_output: [{-3, 0.3}, {2, 0.6}, {2, 0.65}, {-1, 0.7}, {0, 0.2}, {0, 0.4}]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class OffsetIterator,
+    class Decomposer,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+auto segmented_radix_sort_keys(void * temporary_storage,
+                               size_t& storage_size,
+                               KeysInputIterator keys_input,
+                               KeysOutputIterator keys_output,
+                               unsigned int size,
+                               unsigned int segments,
+                               OffsetIterator begin_offsets,
+                               OffsetIterator end_offsets,
+                               Decomposer decomposer,
+                               unsigned int begin_bit = 0,
+                               unsigned int end_bit
+                                   = detail::decomposer_max_bits<Decomposer, Key>::value,
+                               hipStream_t stream = 0,
+                               bool debug_synchronous = false)
+    -> std::enable_if_t<!std::is_convertible<Decomposer, unsigned int>::value, hipError_t>
+{
+    empty_type * values = nullptr;
+    bool ignored;
+    return detail::segmented_radix_sort_impl<Config, false>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        values, nullptr, values,
+        size, ignored,
+        segments, begin_offsets, end_offsets,
+        begin_bit, end_bit,
+        stream, debug_synchronous,
+        decomposer
+    );
+}
+
+/// \brief Parallel descending radix sort primitive for device level, for keys of a custom type.
+///
+/// \p segmented_radix_sort_keys_desc function performs a device-wide radix sort across multiple,
+/// non-overlapping sequences of keys. Function sorts input keys in descending order.
+/// The keys are decomposed by \p decomposer, see the ascending overload of
+/// \p segmented_radix_sort_keys that takes a decomposer for the requirements.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `segmented_radix_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets.
+/// \tparam Decomposer - the type of the decomposer functor.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] decomposer - decomposer functor that produces a tuple of references from the
+/// input key type.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Default value: \p 0.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Default value: the total number of bits of the tuple elements.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class OffsetIterator,
+    class Decomposer,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+auto segmented_radix_sort_keys_desc(void * temporary_storage,
+                                    size_t& storage_size,
+                                    KeysInputIterator keys_input,
+                                    KeysOutputIterator keys_output,
+                                    unsigned int size,
+                                    unsigned int segments,
+                                    OffsetIterator begin_offsets,
+                                    OffsetIterator end_offsets,
+                                    Decomposer decomposer,
+                                    unsigned int begin_bit = 0,
+                                    unsigned int end_bit
+                                        = detail::decomposer_max_bits<Decomposer, Key>::value,
+                                    hipStream_t stream = 0,
+                                    bool debug_synchronous = false)
+    -> std::enable_if_t<!std::is_convertible<Decomposer, unsigned int>::value, hipError_t>
+{
+    empty_type * values = nullptr;
+    bool ignored;
+    return detail::segmented_radix_sort_impl<Config, true>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        values, nullptr, values,
+        size, ignored,
+        segments, begin_offsets, end_offsets,
+        begin_bit, end_bit,
+        stream, debug_synchronous,
+        decomposer
+    );
+}
+
+/// \brief Parallel ascending radix sort-by-key primitive for device level, for keys of a
+/// custom type.
+///
+/// \p segmented_radix_sort_pairs function performs a device-wide radix sort across multiple,
+/// non-overlapping sequences of (key, value) pairs. Function sorts input pairs in ascending order of keys.
+/// The keys are decomposed by \p decomposer, see the overload of \p segmented_radix_sort_keys
+/// that takes a decomposer for the requirements.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `segmented_radix_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets.
+/// \tparam Decomposer - the type of the decomposer functor.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range to sort.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] decomposer - decomposer functor that produces a tuple of references from the
+/// input key type.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Default value: \p 0.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Default value: the total number of bits of the tuple elements.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator,
+    class Decomposer,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+auto segmented_radix_sort_pairs(void * temporary_storage,
+                                size_t& storage_size,
+                                KeysInputIterator keys_input,
+                                KeysOutputIterator keys_output,
+                                ValuesInputIterator values_input,
+                                ValuesOutputIterator values_output,
+                                unsigned int size,
+                                unsigned int segments,
+                                OffsetIterator begin_offsets,
+                                OffsetIterator end_offsets,
+                                Decomposer decomposer,
+                                unsigned int begin_bit = 0,
+                                unsigned int end_bit
+                                    = detail::decomposer_max_bits<Decomposer, Key>::value,
+                                hipStream_t stream = 0,
+                                bool debug_synchronous = false)
+    -> std::enable_if_t<!std::is_convertible<Decomposer, unsigned int>::value, hipError_t>
+{
+    bool ignored;
+    return detail::segmented_radix_sort_impl<Config, false>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        values_input, nullptr, values_output,
+        size, ignored,
+        segments, begin_offsets, end_offsets,
+        begin_bit, end_bit,
+        stream, debug_synchronous,
+        decomposer
+    );
+}
+
+/// \brief Parallel descending radix sort-by-key primitive for device level, for keys of a
+/// custom type.
+///
+/// \p segmented_radix_sort_pairs_desc function performs a device-wide radix sort across multiple,
+/// non-overlapping sequences of (key, value) pairs. Function sorts input pairs in descending order of keys.
+/// The keys are decomposed by \p decomposer, see the overload of \p segmented_radix_sort_keys
+/// that takes a decomposer for the requirements.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `segmented_radix_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets.
+/// \tparam Decomposer - the type of the decomposer functor.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range to sort.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] decomposer - decomposer functor that produces a tuple of references from the
+/// input key type.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Default value: \p 0.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Default value: the total number of bits of the tuple elements.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class KeysInputIterator,
+    class KeysOutputIterator,
+    class ValuesInputIterator,
+    class ValuesOutputIterator,
+    class OffsetIterator,
+    class Decomposer,
+    class Key = typename std::iterator_traits<KeysInputIterator>::value_type
+>
+inline
+auto segmented_radix_sort_pairs_desc(void * temporary_storage,
+                                     size_t& storage_size,
+                                     KeysInputIterator keys_input,
+                                     KeysOutputIterator keys_output,
+                                     ValuesInputIterator values_input,
+                                     ValuesOutputIterator values_output,
+                                     unsigned int size,
+                                     unsigned int segments,
+                                     OffsetIterator begin_offsets,
+                                     OffsetIterator end_offsets,
+                                     Decomposer decomposer,
+                                     unsigned int begin_bit = 0,
+                                     unsigned int end_bit
+                                         = detail::decomposer_max_bits<Decomposer, Key>::value,
+                                     hipStream_t stream = 0,
+                                     bool debug_synchronous = false)
+    -> std::enable_if_t<!std::is_convertible<Decomposer, unsigned int>::value, hipError_t>
+{
+    bool ignored;
+    return detail::segmented_radix_sort_impl<Config, true>(
+        temporary_storage, storage_size,
+        keys_input, nullptr, keys_output,
+        values_input, nullptr, values_output,
+        size, ignored,
+        segments, begin_offsets, end_offsets,
+        begin_bit, end_bit,
+        stream, debug_synchronous,
+        decomposer
+    );
+}
+
+/// \brief Parallel ascending radix sort primitive for device level, for keys of a custom type.
+///
+/// \p segmented_radix_sort_keys function performs a device-wide radix sort across multiple,
+/// non-overlapping sequences of keys. Function sorts input keys in ascending order.
+/// The keys are decomposed by \p decomposer, see the overload of \p segmented_radix_sort_keys
+/// that takes iterators and a decomposer for the requirements.
+///
+/// \par Overview
+/// * The contents of both buffers of \p keys may be altered by the sorting function.
+/// * \p current() of \p keys is used as the input.
+/// * The function will update \p current() of \p keys to point to the buffer
+/// that contains the output range.
+/// * The function requires small \p temporary_storage as it does not need
+/// a temporary buffer of \p size elements.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `segmented_radix_sort_config`.
+/// \tparam Key - key type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets.
+/// \tparam Decomposer - the type of the decomposer functor.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in,out] keys - reference to the double-buffer of keys, its \p current()
+/// contains the input range and will be updated to point to the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] decomposer - decomposer functor that produces a tuple of references from the
+/// input key type.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Default value: \p 0.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Default value: the total number of bits of the tuple elements.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class Key,
+    class OffsetIterator,
+    class Decomposer
+>
+inline
+auto segmented_radix_sort_keys(void * temporary_storage,
+                               size_t& storage_size,
+                               double_buffer<Key>& keys,
+                               unsigned int size,
+                               unsigned int segments,
+                               OffsetIterator begin_offsets,
+                               OffsetIterator end_offsets,
+                               Decomposer decomposer,
+                               unsigned int begin_bit = 0,
+                               unsigned int end_bit
+                                   = detail::decomposer_max_bits<Decomposer, Key>::value,
+                               hipStream_t stream = 0,
+                               bool debug_synchronous = false)
+    -> std::enable_if_t<!std::is_convertible<Decomposer, unsigned int>::value, hipError_t>
+{
+    empty_type * values = nullptr;
+    bool is_result_in_output;
+    hipError_t error = detail::segmented_radix_sort_impl<Config, false>(
+        temporary_storage, storage_size,
+        keys.current(), keys.current(), keys.alternate(),
+        values, values, values,
+        size, is_result_in_output,
+        segments, begin_offsets, end_offsets,
+        begin_bit, end_bit,
+        stream, debug_synchronous,
+        decomposer
+    );
+    if(temporary_storage != nullptr && is_result_in_output)
+    {
+        keys.swap();
+    }
+    return error;
+}
+
+/// \brief Parallel descending radix sort primitive for device level, for keys of a custom type.
+///
+/// \p segmented_radix_sort_keys_desc function performs a device-wide radix sort across multiple,
+/// non-overlapping sequences of keys. Function sorts input keys in descending order.
+/// The keys are decomposed by \p decomposer, see the overload of \p segmented_radix_sort_keys
+/// that takes iterators and a decomposer for the requirements.
+///
+/// \par Overview
+/// * The contents of both buffers of \p keys may be altered by the sorting function.
+/// * \p current() of \p keys is used as the input.
+/// * The function will update \p current() of \p keys to point to the buffer
+/// that contains the output range.
+/// * The function requires small \p temporary_storage as it does not need
+/// a temporary buffer of \p size elements.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `segmented_radix_sort_config`.
+/// \tparam Key - key type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets.
+/// \tparam Decomposer - the type of the decomposer functor.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in,out] keys - reference to the double-buffer of keys, its \p current()
+/// contains the input range and will be updated to point to the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] decomposer - decomposer functor that produces a tuple of references from the
+/// input key type.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Default value: \p 0.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Default value: the total number of bits of the tuple elements.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class Key,
+    class OffsetIterator,
+    class Decomposer
+>
+inline
+auto segmented_radix_sort_keys_desc(void * temporary_storage,
+                                    size_t& storage_size,
+                                    double_buffer<Key>& keys,
+                                    unsigned int size,
+                                    unsigned int segments,
+                                    OffsetIterator begin_offsets,
+                                    OffsetIterator end_offsets,
+                                    Decomposer decomposer,
+                                    unsigned int begin_bit = 0,
+                                    unsigned int end_bit
+                                        = detail::decomposer_max_bits<Decomposer, Key>::value,
+                                    hipStream_t stream = 0,
+                                    bool debug_synchronous = false)
+    -> std::enable_if_t<!std::is_convertible<Decomposer, unsigned int>::value, hipError_t>
+{
+    empty_type * values = nullptr;
+    bool is_result_in_output;
+    hipError_t error = detail::segmented_radix_sort_impl<Config, true>(
+        temporary_storage, storage_size,
+        keys.current(), keys.current(), keys.alternate(),
+        values, values, values,
+        size, is_result_in_output,
+        segments, begin_offsets, end_offsets,
+        begin_bit, end_bit,
+        stream, debug_synchronous,
+        decomposer
+    );
+    if(temporary_storage != nullptr && is_result_in_output)
+    {
+        keys.swap();
+    }
+    return error;
+}
+
+/// \brief Parallel ascending radix sort-by-key primitive for device level, for keys of a
+/// custom type.
+///
+/// \p segmented_radix_sort_pairs function performs a device-wide radix sort across multiple,
+/// non-overlapping sequences of (key, value) pairs. Function sorts input pairs in ascending order of keys.
+/// The keys are decomposed by \p decomposer, see the overload of \p segmented_radix_sort_keys
+/// that takes iterators and a decomposer for the requirements.
+///
+/// \par Overview
+/// * The contents of both buffers of \p keys and \p values may be altered by the sorting function.
+/// * \p current() of \p keys and \p values are used as the input.
+/// * The function will update \p current() of \p keys and \p values to point to buffers
+/// that contains the output range.
+/// * The function requires small \p temporary_storage as it does not need
+/// a temporary buffer of \p size elements.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `segmented_radix_sort_config`.
+/// \tparam Key - key type.
+/// \tparam Value - value type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets.
+/// \tparam Decomposer - the type of the decomposer functor.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in,out] keys - reference to the double-buffer of keys, its \p current()
+/// contains the input range and will be updated to point to the output range.
+/// \param [in,out] values - reference to the double-buffer of values, its \p current()
+/// contains the input range and will be updated to point to the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] decomposer - decomposer functor that produces a tuple of references from the
+/// input key type.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Default value: \p 0.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Default value: the total number of bits of the tuple elements.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class Key,
+    class Value,
+    class OffsetIterator,
+    class Decomposer
+>
+inline
+auto segmented_radix_sort_pairs(void * temporary_storage,
+                                size_t& storage_size,
+                                double_buffer<Key>& keys,
+                                double_buffer<Value>& values,
+                                unsigned int size,
+                                unsigned int segments,
+                                OffsetIterator begin_offsets,
+                                OffsetIterator end_offsets,
+                                Decomposer decomposer,
+                                unsigned int begin_bit = 0,
+                                unsigned int end_bit
+                                    = detail::decomposer_max_bits<Decomposer, Key>::value,
+                                hipStream_t stream = 0,
+                                bool debug_synchronous = false)
+    -> std::enable_if_t<!std::is_convertible<Decomposer, unsigned int>::value, hipError_t>
+{
+    bool is_result_in_output;
+    hipError_t error = detail::segmented_radix_sort_impl<Config, false>(
+        temporary_storage, storage_size,
+        keys.current(), keys.current(), keys.alternate(),
+        values.current(), values.current(), values.alternate(),
+        size, is_result_in_output,
+        segments, begin_offsets, end_offsets,
+        begin_bit, end_bit,
+        stream, debug_synchronous,
+        decomposer
+    );
+    if(temporary_storage != nullptr && is_result_in_output)
+    {
+        keys.swap();
+        values.swap();
+    }
+    return error;
+}
+
+/// \brief Parallel descending radix sort-by-key primitive for device level, for keys of a
+/// custom type.
+///
+/// \p segmented_radix_sort_pairs_desc function performs a device-wide radix sort across multiple,
+/// non-overlapping sequences of (key, value) pairs. Function sorts input pairs in descending order of keys.
+/// The keys are decomposed by \p decomposer, see the overload of \p segmented_radix_sort_keys
+/// that takes iterators and a decomposer for the requirements.
+///
+/// \par Overview
+/// * The contents of both buffers of \p keys and \p values may be altered by the sorting function.
+/// * \p current() of \p keys and \p values are used as the input.
+/// * The function will update \p current() of \p keys and \p values to point to buffers
+/// that contains the output range.
+/// * The function requires small \p temporary_storage as it does not need
+/// a temporary buffer of \p size elements.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `segmented_radix_sort_config`.
+/// \tparam Key - key type.
+/// \tparam Value - value type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets.
+/// \tparam Decomposer - the type of the decomposer functor.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in,out] keys - reference to the double-buffer of keys, its \p current()
+/// contains the input range and will be updated to point to the output range.
+/// \param [in,out] values - reference to the double-buffer of values, its \p current()
+/// contains the input range and will be updated to point to the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] decomposer - decomposer functor that produces a tuple of references from the
+/// input key type.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Default value: \p 0.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Default value: the total number of bits of the tuple elements.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<
+    class Config = default_config,
+    class Key,
+    class Value,
+    class OffsetIterator,
+    class Decomposer
+>
+inline
+auto segmented_radix_sort_pairs_desc(void * temporary_storage,
+                                     size_t& storage_size,
+                                     double_buffer<Key>& keys,
+                                     double_buffer<Value>& values,
+                                     unsigned int size,
+                                     unsigned int segments,
+                                     OffsetIterator begin_offsets,
+                                     OffsetIterator end_offsets,
+                                     Decomposer decomposer,
+                                     unsigned int begin_bit = 0,
+                                     unsigned int end_bit
+                                         = detail::decomposer_max_bits<Decomposer, Key>::value,
+                                     hipStream_t stream = 0,
+                                     bool debug_synchronous = false)
+    -> std::enable_if_t<!std::is_convertible<Decomposer, unsigned int>::value, hipError_t>
+{
+    bool is_result_in_output;
+    hipError_t error = detail::segmented_radix_sort_impl<Config, true>(
+        temporary_storage, storage_size,
+        keys.current(), keys.current(), keys.alternate(),
+        values.current(), values.current(), values.alternate(),
+        size, is_result_in_output,
+        segments, begin_offsets, end_offsets,
+        begin_bit, end_bit,
+        stream, debug_synchronous,
+        decomposer
+    );
+    if(temporary_storage != nullptr && is_result_in_output)
+    {
+        keys.swap();
+        values.swap();
+    }
+    return error;
+}
+
+/// \brief Parallel radix sort primitive for device level, which sorts every segment in its own
+/// direction.
+///
+/// \p segmented_radix_sort_keys_with_directions function performs a device-wide radix sort across
+/// multiple, non-overlapping sequences of keys. Segment \p i is sorted in descending order if
+/// <tt>descending[i]</tt> is \p true, and in ascending order otherwise, so that segments of both
+/// directions are sorted by a single call.
+///
+/// \par Overview
+/// * The contents of the inputs are not altered by the sorting function.
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p Key type (a \p value_type of \p KeysInputIterator and \p KeysOutputIterator) must be
+/// an arithmetic type (that is, an integral type or a floating-point type), other than \p bool.
+/// * Ranges specified by \p keys_input and \p keys_output must have at least \p size elements.
+/// * Ranges specified by \p begin_offsets, \p end_offsets and \p descending must have
+/// at least \p segments elements.
+/// * The keys of the descending segments are reversed while they are loaded and stored, which
+/// needs two additional passes over the keys and temporary storage for two copies of the keys.
+/// The bits selected by \p begin_bit and \p end_bit are compared in both directions.
+///
+/// \par Stability
+/// \p segmented_radix_sort_keys_with_directions is \b stable: it preserves the relative ordering
+/// of equivalent keys in both directions.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `segmented_radix_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam DescendingIterator - random-access iterator type of the segment directions, its
+/// \p value_type must be convertible to \p bool. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] descending - iterator to the first element in the range of segment directions.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;        // e.g., 8
+/// int * input;              // e.g., [6, 3, 5, 4, 1, 8, 1, 7]
+/// int * output;             // empty array of 8 elements
+/// unsigned int segments;    // e.g., 3
+/// int * offsets;            // e.g. [0, 2, 3, 8]
+/// bool * descending;        // e.g. [true, false, true]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_radix_sort_keys_with_directions(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size,
+///     segments, offsets, offsets + 1, descending
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::segmented_radix_sort_keys_with_directions(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, input_size,
+///     segments, offsets, offsets + 1, descending
+/// );
+/// // output: [6, 3, 5, 8, 7, 4, 1, 1]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class OffsetIterator,
+         class DescendingIterator,
+         class Key = typename std::iterator_traits<KeysInputIterator>::value_type>
+inline hipError_t segmented_radix_sort_keys_with_directions(void*              temporary_storage,
+                                                            size_t&            storage_size,
+                                                            KeysInputIterator  keys_input,
+                                                            KeysOutputIterator keys_output,
+                                                            unsigned int       size,
+                                                            unsigned int       segments,
+                                                            OffsetIterator     begin_offsets,
+                                                            OffsetIterator     end_offsets,
+                                                            DescendingIterator descending,
+                                                            unsigned int       begin_bit = 0,
+                                                            unsigned int end_bit = 8 * sizeof(Key),
+                                                            hipStream_t  stream  = 0,
+                                                            bool debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::segmented_radix_sort_directions_impl<Config>(temporary_storage,
+                                                                storage_size,
+                                                                keys_input,
+                                                                keys_output,
+                                                                values,
+                                                                values,
+                                                                size,
+                                                                segments,
+                                                                begin_offsets,
+                                                                end_offsets,
+                                                                descending,
+                                                                begin_bit,
+                                                                end_bit,
+                                                                stream,
+                                                                debug_synchronous);
+}
+
+/// \brief Parallel radix sort-by-key primitive for device level, which sorts every segment in
+/// its own direction.
+///
+/// \p segmented_radix_sort_pairs_with_directions function performs a device-wide radix sort
+/// across multiple, non-overlapping sequences of (key, value) pairs. Segment \p i is sorted in
+/// descending order of keys if <tt>descending[i]</tt> is \p true, and in ascending order
+/// otherwise. See \p segmented_radix_sort_keys_with_directions for the requirements on the keys
+/// and the directions.
+///
+/// \par Stability
+/// \p segmented_radix_sort_pairs_with_directions is \b stable: it preserves the relative ordering
+/// of equivalent keys in both directions.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `segmented_radix_sort_config`.
+/// \tparam KeysInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam DescendingIterator - random-access iterator type of the segment directions, its
+/// \p value_type must be convertible to \p bool. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the sort operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - pointer to the first element in the range to sort.
+/// \param [out] keys_output - pointer to the first element in the output range.
+/// \param [in] values_input - pointer to the first element in the range to sort.
+/// \param [out] values_output - pointer to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] begin_offsets - iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets - iterator to the first element in the range of ending offsets.
+/// \param [in] descending - iterator to the first element in the range of segment directions.
+/// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+/// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+/// Non-default value not supported for floating-point key-types.
+/// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+/// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+/// value: \p <tt>8 * sizeof(Key)</tt>. Non-default value not supported for floating-point key-types.
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator,
+         class DescendingIterator,
+         class Key = typename std::iterator_traits<KeysInputIterator>::value_type>
+inline hipError_t segmented_radix_sort_pairs_with_directions(void*                temporary_storage,
+                                                             size_t&              storage_size,
+                                                             KeysInputIterator    keys_input,
+                                                             KeysOutputIterator   keys_output,
+                                                             ValuesInputIterator  values_input,
+                                                             ValuesOutputIterator values_output,
+                                                             unsigned int         size,
+                                                             unsigned int         segments,
+                                                             OffsetIterator       begin_offsets,
+                                                             OffsetIterator       end_offsets,
+                                                             DescendingIterator   descending,
+                                                             unsigned int         begin_bit = 0,
+                                                             unsigned int end_bit = 8 * sizeof(Key),
+                                                             hipStream_t  stream  = 0,
+                                                             bool debug_synchronous = false)
+{
+    return detail::segmented_radix_sort_directions_impl<Config>(temporary_storage,
+                                                                storage_size,
+                                                                keys_input,
+                                                                keys_output,
+                                                                values_input,
+                                                                values_output,
+                                                                size,
+                                                                segments,
+                                                                begin_offsets,
+                                                                end_offsets,
+                                                                descending,
+                                                                begin_bit,
+                                                                end_bit,
+                                                                stream,
+                                                                debug_synchronous);
+}
+
 END_ROCPRIM_NAMESPACE
 
 /// @}
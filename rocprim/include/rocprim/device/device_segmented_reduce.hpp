@@ -27,11 +27,13 @@
 
 #include "../config.hpp"
 #include "../common.hpp"
+#include "../detail/temp_storage.hpp"
 #include "../detail/various.hpp"
 #include "../functional.hpp"
 
 #include "detail/config/device_reduce.hpp"
 #include "detail/device_segmented_reduce.hpp"
+#include "device_reduce_by_key.hpp"
 #include "rocprim/type_traits.hpp"
 
 BEGIN_ROCPRIM_NAMESPACE
@@ -66,6 +68,7 @@ ROCPRIM_KERNEL __launch_bounds__(
 
 template<
     class Config,
+    class AccType,
     class InputIterator,
     class OutputIterator,
     class OffsetIterator,
@@ -85,9 +88,7 @@ hipError_t segmented_reduce_impl(void * temporary_storage,
                                  hipStream_t stream,
                                  bool debug_synchronous)
 {
-    using input_type = typename std::iterator_traits<InputIterator>::value_type;
-    using result_type =
-        typename ::rocprim::invoke_result_binary_op<input_type, BinaryFunction>::type;
+    using result_type = AccType;
 
     using config = wrapped_reduce_config<Config, result_type>;
 
@@ -129,6 +130,228 @@ hipError_t segmented_reduce_impl(void * temporary_storage,
 
 
 
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class OffsetIterator,
+         class ResultType,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+    __launch_bounds__(device_params<Config>().reduce_config.block_size) void
+    segmented_reduce_balanced_kernel(InputIterator      input,
+                                     OutputIterator     output,
+                                     const size_t       size,
+                                     const unsigned int segments,
+                                     OffsetIterator     offsets,
+                                     unsigned int*      tile_carry_segments,
+                                     ResultType*        tile_carry_values,
+                                     ResultType*        tile_heads,
+                                     bool*              tile_head_valid,
+                                     BinaryFunction     reduce_op,
+                                     ResultType         initial_value)
+{
+    segmented_reduce_balanced_tile<Config>(input,
+                                           output,
+                                           size,
+                                           segments,
+                                           offsets,
+                                           tile_carry_segments,
+                                           tile_carry_values,
+                                           tile_heads,
+                                           tile_head_valid,
+                                           reduce_op,
+                                           initial_value);
+}
+
+template<unsigned int BlockSize,
+         class OutputIterator,
+         class OffsetIterator,
+         class ResultType,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+    __launch_bounds__(BlockSize) void
+    segmented_reduce_balanced_fixup_kernel(OutputIterator      output,
+                                           const unsigned int  segments,
+                                           OffsetIterator      offsets,
+                                           const unsigned int* carry_segments,
+                                           const ResultType*   carry_values,
+                                           const size_t*       carry_count,
+                                           const ResultType*   tile_heads,
+                                           const bool*         tile_head_valid,
+                                           const unsigned int  items_per_tile,
+                                           BinaryFunction      reduce_op,
+                                           ResultType          initial_value)
+{
+    segmented_reduce_balanced_fixup<BlockSize>(output,
+                                               segments,
+                                               offsets,
+                                               carry_segments,
+                                               carry_values,
+                                               carry_count,
+                                               tile_heads,
+                                               tile_head_valid,
+                                               items_per_tile,
+                                               reduce_op,
+                                               initial_value);
+}
+
+template<class Config,
+         class AccType,
+         class InputIterator,
+         class OutputIterator,
+         class OffsetIterator,
+         class InitValueType,
+         class BinaryFunction>
+inline hipError_t segmented_reduce_balanced_impl(void*              temporary_storage,
+                                                 size_t&            storage_size,
+                                                 InputIterator      input,
+                                                 OutputIterator     output,
+                                                 const size_t       size,
+                                                 const unsigned int segments,
+                                                 OffsetIterator     offsets,
+                                                 BinaryFunction     reduce_op,
+                                                 InitValueType      initial_value,
+                                                 hipStream_t        stream,
+                                                 bool               debug_synchronous)
+{
+    using result_type = AccType;
+
+    using config = wrapped_reduce_config<Config, result_type>;
+
+    detail::target_arch target_arch;
+    hipError_t          result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const reduce_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size     = params.reduce_config.block_size;
+    const unsigned int items_per_tile = block_size * params.reduce_config.items_per_thread;
+    const size_t       num_tiles      = ceiling_div(size + segments, items_per_tile);
+
+    constexpr unsigned int fixup_block_size = 256;
+
+    // Segments which span tiles are combined from the carry-outs of the tiles
+    size_t reduce_by_key_storage_size;
+    ROCPRIM_RETURN_ON_ERROR(
+        (reduce_by_key_impl<lookback_scan_determinism::default_determinism,
+                            default_config,
+                            result_type>(
+            nullptr,
+            reduce_by_key_storage_size,
+            static_cast<unsigned int*>(nullptr),
+            static_cast<result_type*>(nullptr),
+            num_tiles,
+            static_cast<unsigned int*>(nullptr),
+            static_cast<result_type*>(nullptr),
+            static_cast<size_t*>(nullptr),
+            reduce_op,
+            ::rocprim::equal_to<unsigned int>(),
+            stream,
+            false)));
+
+    unsigned int* tile_carry_segments;
+    result_type*  tile_carry_values;
+    result_type*  tile_heads;
+    bool*         tile_head_valid;
+    unsigned int* carry_segments;
+    result_type*  carry_values;
+    size_t*       carry_count;
+    void*         reduce_by_key_storage;
+
+    result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&tile_carry_segments, num_tiles),
+            detail::temp_storage::ptr_aligned_array(&tile_carry_values, num_tiles),
+            detail::temp_storage::ptr_aligned_array(&tile_heads, num_tiles),
+            detail::temp_storage::ptr_aligned_array(&tile_head_valid, num_tiles),
+            detail::temp_storage::ptr_aligned_array(&carry_segments, num_tiles),
+            detail::temp_storage::ptr_aligned_array(&carry_values, num_tiles),
+            detail::temp_storage::ptr_aligned_array(&carry_count, 1),
+            detail::temp_storage::make_partition(&reduce_by_key_storage,
+                                                 reduce_by_key_storage_size)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    if(segments == 0u)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::steady_clock::time_point start;
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    segmented_reduce_balanced_kernel<config>
+        <<<dim3(num_tiles), dim3(block_size), 0, stream>>>(input,
+                                                           output,
+                                                           size,
+                                                           segments,
+                                                           offsets,
+                                                           tile_carry_segments,
+                                                           tile_carry_values,
+                                                           tile_heads,
+                                                           tile_head_valid,
+                                                           reduce_op,
+                                                           static_cast<result_type>(initial_value));
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_reduce_balanced_kernel",
+                                                size + segments,
+                                                start);
+
+    // A single tile has no segments to combine
+    if(num_tiles <= 1)
+    {
+        return hipSuccess;
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(
+        (reduce_by_key_impl<lookback_scan_determinism::default_determinism,
+                            default_config,
+                            result_type>(
+            reduce_by_key_storage,
+            reduce_by_key_storage_size,
+            tile_carry_segments,
+            tile_carry_values,
+            num_tiles,
+            carry_segments,
+            carry_values,
+            carry_count,
+            reduce_op,
+            ::rocprim::equal_to<unsigned int>(),
+            stream,
+            debug_synchronous)));
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    segmented_reduce_balanced_fixup_kernel<fixup_block_size>
+        <<<dim3(ceiling_div(num_tiles, fixup_block_size)), dim3(fixup_block_size), 0, stream>>>(
+            output,
+            segments,
+            offsets,
+            carry_segments,
+            carry_values,
+            carry_count,
+            tile_heads,
+            tile_head_valid,
+            items_per_tile,
+            reduce_op,
+            static_cast<result_type>(initial_value));
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_reduce_balanced_fixup_kernel",
+                                                num_tiles,
+                                                start);
+
+    return hipSuccess;
+}
+
 } // end of detail namespace
 
 /// \brief Parallel segmented reduction primitive for device level.
@@ -156,6 +379,10 @@ hipError_t segmented_reduce_impl(void * temporary_storage,
 /// \tparam BinaryFunction - type of binary function used for reduction. Default type
 /// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
 /// \tparam InitValueType - type of the initial value.
+/// \tparam AccType - accumulator type of the reductions. The values are loaded as the input type
+/// and converted to \p AccType, so e.g. \p rocprim::half values can be reduced in \p float.
+/// \p reduce_op must accept and return \p AccType. Default type is the result type of
+/// \p reduce_op for the input values.
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
 /// a null pointer is passed, the required allocation size (in bytes) is written to
@@ -230,7 +457,10 @@ template<
     class OutputIterator,
     class OffsetIterator,
     class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
-    class InitValueType = typename std::iterator_traits<InputIterator>::value_type
+    class InitValueType = typename std::iterator_traits<InputIterator>::value_type,
+    class AccType = ::rocprim::invoke_result_binary_op_t<
+        typename std::iterator_traits<InputIterator>::value_type,
+        BinaryFunction>
 >
 inline
 hipError_t segmented_reduce(void * temporary_storage,
@@ -245,7 +475,7 @@ hipError_t segmented_reduce(void * temporary_storage,
                             hipStream_t stream = 0,
                             bool debug_synchronous = false)
 {
-    return detail::segmented_reduce_impl<Config>(
+    return detail::segmented_reduce_impl<Config, AccType>(
         temporary_storage, storage_size,
         input, output,
         segments, begin_offsets, end_offsets,
@@ -254,6 +484,135 @@ hipError_t segmented_reduce(void * temporary_storage,
     );
 }
 
+/// \brief Load-balanced parallel segmented reduction primitive for device level.
+///
+/// segmented_reduce_balanced function performs the same reduction as segmented_reduce for
+/// segments given by a single sequence of offsets (for example, the row offsets of a CSR sparse
+/// matrix or of a ragged tensor). Instead of a block per segment, every block reduces the same
+/// number of values and segment ends, so the run time does not depend on the distribution of
+/// segment lengths: many empty or short segments and a few very long ones are handled alike.
+/// Segments spanning several blocks are combined by an additional reduce-by-key pass
+/// over the partial results of the blocks.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Segment <tt>i</tt> is the range <tt>[offsets[i], offsets[i + 1])</tt> of \p input.
+/// \p offsets must have <tt>segments + 1</tt> non-decreasing elements, and
+/// <tt>offsets[segments]</tt> must not be greater than \p size.
+/// * \p output must have \p segments elements. Empty segments are set to \p initial_value.
+/// * \p reduce_op must be associative, it does not need to be commutative.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `reduce_config`.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for reduction. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam AccType - accumulator type of the reductions. The values are loaded as the input type
+/// and converted to \p AccType, so e.g. \p rocprim::half values can be reduced in \p float.
+/// \p reduce_op must accept and return \p AccType. Default type is the result type of
+/// \p reduce_op for the input values.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the reduction operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to reduce.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] size - number of elements in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] offsets - iterator to the first element in the range of <tt>segments + 1</tt>
+/// offsets.
+/// \param [in] reduce_op - binary operation function object that will be used for reduction.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] initial_value - initial value to start the reduction.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful reduction; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the sums of the rows of a CSR sparse matrix are computed.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;             // e.g., 8
+/// unsigned int segments;   // e.g., 4
+/// float * values;          // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// float * output;          // empty array of 4 elements
+/// int * row_offsets;       // e.g. [0, 2, 2, 7, 8]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_reduce_balanced(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     values, output, size,
+///     segments, row_offsets,
+///     rocprim::plus<float>(), 0.0f
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform segmented reduction
+/// rocprim::segmented_reduce_balanced(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     values, output, size,
+///     segments, row_offsets,
+///     rocprim::plus<float>(), 0.0f
+/// );
+/// // output: [3, 0, 25, 8]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+    class InitValueType = typename std::iterator_traits<InputIterator>::value_type,
+    class AccType       = ::rocprim::invoke_result_binary_op_t<
+        typename std::iterator_traits<InputIterator>::value_type,
+        BinaryFunction>>
+inline hipError_t segmented_reduce_balanced(void*          temporary_storage,
+                                            size_t&        storage_size,
+                                            InputIterator  input,
+                                            OutputIterator output,
+                                            size_t         size,
+                                            unsigned int   segments,
+                                            OffsetIterator offsets,
+                                            BinaryFunction reduce_op         = BinaryFunction(),
+                                            InitValueType  initial_value     = InitValueType(),
+                                            hipStream_t    stream            = 0,
+                                            bool           debug_synchronous = false)
+{
+    return detail::segmented_reduce_balanced_impl<Config, AccType>(temporary_storage,
+                                                                   storage_size,
+                                                                   input,
+                                                                   output,
+                                                                   size,
+                                                                   segments,
+                                                                   offsets,
+                                                                   reduce_op,
+                                                                   initial_value,
+                                                                   stream,
+                                                                   debug_synchronous);
+}
+
 /// @}
 // end of group devicemodule
 
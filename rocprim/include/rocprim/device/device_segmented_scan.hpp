@@ -33,6 +33,7 @@
 #include "../iterator/discard_iterator.hpp"
 #include "../iterator/transform_iterator.hpp"
 #include "../iterator/counting_iterator.hpp"
+#include "../thread/thread_search.hpp"
 #include "../types/tuple.hpp"
 
 #include "detail/config/device_scan.hpp"
@@ -72,6 +73,48 @@ struct transform_op_t
     }
 };
 
+// Derives the head flags of a segmented scan from the beginnings of the segments, an item is the
+// head of a segment if it is one of offsets[0, segments). Exclusive scans flag the last item of
+// each segment as the next segment's head and use initial_value as its value (see transform_op_t).
+template<bool Exclusive, class InputIterator, class OffsetIterator, class ResultType>
+struct offsets_transform_op_t
+{
+    InputIterator  input;
+    OffsetIterator offsets;
+    unsigned int   segments;
+    ResultType     initial_value_converted;
+    size_t         size;
+
+    ROCPRIM_DEVICE
+    bool is_head(const size_t i) const
+    {
+        using offset_type = typename std::iterator_traits<OffsetIterator>::value_type;
+
+        const offset_type  offset  = static_cast<offset_type>(i);
+        const unsigned int segment = ::rocprim::lower_bound(offsets, segments, offset);
+        return segment < segments && offsets[segment] == offset;
+    }
+
+    ROCPRIM_DEVICE
+    auto operator()(const size_t i) const
+    {
+        if ROCPRIM_IF_CONSTEXPR(Exclusive)
+        {
+            const bool flag  = i + 1 < size && is_head(i + 1);
+            ResultType value = initial_value_converted;
+            if(!flag)
+            {
+                value = input[i];
+            }
+            return rocprim::make_tuple(value, flag);
+        }
+        else
+        {
+            return rocprim::make_tuple(static_cast<ResultType>(input[i]), is_head(i));
+        }
+    }
+};
+
 template<
     bool Exclusive,
     class Config,
@@ -120,7 +163,8 @@ hipError_t segmented_scan_impl(void * temporary_storage,
                                bool debug_synchronous)
 {
     using input_type = typename std::iterator_traits<InputIterator>::value_type;
-    using result_type = typename std::conditional<Exclusive, InitValueType, input_type>::type;
+    // Inclusive scans pass a value of their accumulator type as the (unused) initial value
+    using result_type = InitValueType;
 
     using config = wrapped_scan_config<Config, input_type>;
 
@@ -185,6 +229,9 @@ hipError_t segmented_scan_impl(void * temporary_storage,
 /// requirements of a C++ RandomAccessIterator concept. It can be a simple pointer type.
 /// \tparam BinaryFunction - type of binary function used for scan operation. Default type
 /// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccType - accumulator type used to propagate the scanned values. The values are
+/// converted to \p AccType when they are loaded, so e.g. \p rocprim::half values can be scanned
+/// in \p float. Default type is value type of the input iterator.
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
 /// a null pointer is passed, the required allocation size (in bytes) is written to
@@ -252,7 +299,8 @@ template<
     class InputIterator,
     class OutputIterator,
     class OffsetIterator,
-    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+    class AccType = typename std::iterator_traits<InputIterator>::value_type
 >
 inline
 hipError_t segmented_inclusive_scan(void * temporary_storage,
@@ -266,8 +314,7 @@ hipError_t segmented_inclusive_scan(void * temporary_storage,
                                     hipStream_t stream = 0,
                                     bool debug_synchronous = false)
 {
-    using input_type = typename std::iterator_traits<InputIterator>::value_type;
-    using result_type = input_type;
+    using result_type = AccType;
 
     return detail::segmented_scan_impl<false, Config>(
         temporary_storage, storage_size,
@@ -300,6 +347,9 @@ hipError_t segmented_inclusive_scan(void * temporary_storage,
 /// \tparam InitValueType - type of the initial value.
 /// \tparam BinaryFunction - type of binary function used for scan operation. Default type
 /// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccType - accumulator type used to propagate the scanned values. The values are
+/// converted to \p AccType when they are loaded, so e.g. \p rocprim::half values can be scanned
+/// in \p float. Default type is \p InitValueType.
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
 /// a null pointer is passed, the required allocation size (in bytes) is written to
@@ -372,7 +422,8 @@ template<
     class OutputIterator,
     class OffsetIterator,
     class InitValueType,
-    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+    class AccType = InitValueType
 >
 inline
 hipError_t segmented_exclusive_scan(void * temporary_storage,
@@ -389,7 +440,7 @@ hipError_t segmented_exclusive_scan(void * temporary_storage,
 {
     return detail::segmented_scan_impl<true, Config>(
         temporary_storage, storage_size,
-        input, output, segments, begin_offsets, end_offsets, initial_value,
+        input, output, segments, begin_offsets, end_offsets, static_cast<AccType>(initial_value),
         scan_op, stream, debug_synchronous
     );
 }
@@ -416,6 +467,9 @@ hipError_t segmented_exclusive_scan(void * temporary_storage,
 /// requirements of a C++ RandomAccessIterator concept. It can be a simple pointer type.
 /// \tparam BinaryFunction - type of binary function used for scan operation. Default type
 /// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccType - accumulator type used to propagate the scanned values. The values are
+/// converted to \p AccType when they are loaded, so e.g. \p rocprim::half values can be scanned
+/// in \p float. Default type is value type of the input iterator.
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
 /// a null pointer is passed, the required allocation size (in bytes) is written to
@@ -476,7 +530,8 @@ template<
     class InputIterator,
     class OutputIterator,
     class HeadFlagIterator,
-    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+    class AccType = typename std::iterator_traits<InputIterator>::value_type
 >
 inline
 hipError_t segmented_inclusive_scan(void * temporary_storage,
@@ -489,18 +544,25 @@ hipError_t segmented_inclusive_scan(void * temporary_storage,
                                     hipStream_t stream = 0,
                                     bool debug_synchronous = false)
 {
-    using input_type = typename std::iterator_traits<InputIterator>::value_type;
-    using result_type = input_type;
+    using result_type = AccType;
     using flag_type = typename std::iterator_traits<HeadFlagIterator>::value_type;
     using headflag_scan_op_wrapper_type =
         detail::headflag_scan_op_wrapper<
             result_type, flag_type, BinaryFunction
         >;
 
-    return inclusive_scan<Config>(
+    const auto flagged_input = rocprim::make_zip_iterator(rocprim::make_tuple(input, head_flags));
+    const auto flagged_output
+        = rocprim::make_zip_iterator(rocprim::make_tuple(output, rocprim::make_discard_iterator()));
+
+    // The values are converted to the accumulator type when the zipped items are loaded
+    return inclusive_scan<Config,
+                          decltype(flagged_input),
+                          decltype(flagged_output),
+                          headflag_scan_op_wrapper_type,
+                          rocprim::tuple<result_type, flag_type>>(
         temporary_storage, storage_size,
-        rocprim::make_zip_iterator(rocprim::make_tuple(input, head_flags)),
-        rocprim::make_zip_iterator(rocprim::make_tuple(output, rocprim::make_discard_iterator())),
+        flagged_input, flagged_output,
         size, headflag_scan_op_wrapper_type(scan_op),
         stream, debug_synchronous
     );
@@ -529,6 +591,9 @@ hipError_t segmented_inclusive_scan(void * temporary_storage,
 /// \tparam InitValueType - type of the initial value.
 /// \tparam BinaryFunction - type of binary function used for scan operation. Default type
 /// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccType - accumulator type used to propagate the scanned values. The values are
+/// converted to \p AccType when they are loaded, so e.g. \p rocprim::half values can be scanned
+/// in \p float. Default type is \p InitValueType.
 ///
 /// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
 /// a null pointer is passed, the required allocation size (in bytes) is written to
@@ -592,7 +657,8 @@ template<
     class OutputIterator,
     class InitValueType,
     class HeadFlagIterator,
-    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+    class AccType = InitValueType
 >
 inline
 hipError_t segmented_exclusive_scan(void * temporary_storage,
@@ -606,7 +672,7 @@ hipError_t segmented_exclusive_scan(void * temporary_storage,
                                     hipStream_t stream = 0,
                                     bool debug_synchronous = false)
 {
-    using result_type = InitValueType;
+    using result_type = AccType;
     using flag_type = typename std::iterator_traits<HeadFlagIterator>::value_type;
     using headflag_scan_op_wrapper_type =
         detail::headflag_scan_op_wrapper<
@@ -634,6 +700,261 @@ hipError_t segmented_exclusive_scan(void * temporary_storage,
         debug_synchronous);
 }
 
+/// \brief Load-balanced parallel segmented inclusive scan primitive for device level.
+///
+/// segmented_inclusive_scan_balanced function performs a device-wide inclusive scan operation
+/// across multiple sequences from \p input using binary \p scan_op operator. The sequences are
+/// given by a single range of offsets, like the rows of a CSR matrix or of a ragged batch. Unlike
+/// the variant with begin and end offsets, which scans each segment with one block, the input is
+/// split into tiles of equal size, and the values of segments spanning tiles are passed between
+/// blocks with decoupled look-back, so the load does not depend on the lengths of the segments.
+/// Unlike the variant with head flags, no flags are stored: the first item of each segment is
+/// found by a binary search over \p offsets.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+/// * Segment <tt>i</tt> is the range <tt>[offsets[i], offsets[i + 1])</tt>. \p offsets must have
+/// <tt>segments + 1</tt> non-decreasing elements, with <tt>offsets[0] = 0</tt> and
+/// <tt>offsets[segments] = size</tt>.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `scan_config`.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ RandomAccessIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ RandomAccessIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ RandomAccessIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for scan operation. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccType - accumulator type used to propagate the scanned values. The values are
+/// converted to \p AccType when they are loaded, so e.g. \p rocprim::half values can be scanned
+/// in \p float. Default type is value type of the input iterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to scan.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] offsets - iterator to the first element in the range of <tt>segments + 1</tt>
+/// offsets.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level segmented inclusive sum operation is performed on
+/// an array of integer values.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;             // e.g., 8
+/// unsigned int segments;   // e.g., 4
+/// int * input;             // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// int * offsets;           // e.g., [0, 3, 3, 5, 8]
+/// int * output;            // empty array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_inclusive_scan_balanced(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, size, segments, offsets, ::rocprim::plus<int>()
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform scan
+/// rocprim::segmented_inclusive_scan_balanced(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, size, segments, offsets, ::rocprim::plus<int>()
+/// );
+/// // output: [1, 3, 6, 4, 9, 6, 13, 21]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+    class AccType        = typename std::iterator_traits<InputIterator>::value_type>
+inline hipError_t segmented_inclusive_scan_balanced(void*          temporary_storage,
+                                                    size_t&        storage_size,
+                                                    InputIterator  input,
+                                                    OutputIterator output,
+                                                    size_t         size,
+                                                    unsigned int   segments,
+                                                    OffsetIterator offsets,
+                                                    BinaryFunction scan_op = BinaryFunction(),
+                                                    hipStream_t    stream  = 0,
+                                                    bool debug_synchronous = false)
+{
+    using result_type = AccType;
+    using headflag_scan_op_wrapper_type
+        = detail::headflag_scan_op_wrapper<result_type, bool, BinaryFunction>;
+    using transform_op
+        = detail::offsets_transform_op_t<false, InputIterator, OffsetIterator, result_type>;
+
+    return inclusive_scan<Config>(
+        temporary_storage,
+        storage_size,
+        rocprim::make_transform_iterator(
+            rocprim::make_counting_iterator<size_t>(0),
+            transform_op{input, offsets, segments, result_type(), size}),
+        rocprim::make_zip_iterator(rocprim::make_tuple(output, rocprim::make_discard_iterator())),
+        size,
+        headflag_scan_op_wrapper_type(scan_op),
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Load-balanced parallel segmented exclusive scan primitive for device level.
+///
+/// segmented_exclusive_scan_balanced function performs a device-wide exclusive scan operation
+/// across multiple sequences from \p input using binary \p scan_op operator. The sequences are
+/// given by a single range of offsets. See segmented_inclusive_scan_balanced for how the work is
+/// split between blocks.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p output must have at least \p size elements.
+/// * Segment <tt>i</tt> is the range <tt>[offsets[i], offsets[i + 1])</tt>. \p offsets must have
+/// <tt>segments + 1</tt> non-decreasing elements, with <tt>offsets[0] = 0</tt> and
+/// <tt>offsets[segments] = size</tt>.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `scan_config`.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ RandomAccessIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ RandomAccessIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of segment offsets. Must meet the
+/// requirements of a C++ RandomAccessIterator concept. It can be a simple pointer type.
+/// \tparam InitValueType - type of the initial value.
+/// \tparam BinaryFunction - type of binary function used for scan operation. Default type
+/// is \p rocprim::plus<T>, where \p T is a \p value_type of \p InputIterator.
+/// \tparam AccType - accumulator type used to propagate the scanned values. The values are
+/// converted to \p AccType when they are loaded, so e.g. \p rocprim::half values can be scanned
+/// in \p float. Default type is \p InitValueType.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the scan operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to scan.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] size - number of element in the input range.
+/// \param [in] segments - number of segments in the input range.
+/// \param [in] offsets - iterator to the first element in the range of <tt>segments + 1</tt>
+/// offsets.
+/// \param [in] initial_value - initial value to start the scan of each segment.
+/// \param [in] scan_op - binary operation function object that will be used for scan.
+/// The signature of the function should be equivalent to the following:
+/// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a device-level segmented exclusive sum operation is performed on
+/// an array of integer values.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;             // e.g., 8
+/// unsigned int segments;   // e.g., 4
+/// int * input;             // e.g., [1, 2, 3, 4, 5, 6, 7, 8]
+/// int * offsets;           // e.g., [0, 3, 3, 5, 8]
+/// int init;                // e.g., 9
+/// int * output;            // empty array of 8 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_exclusive_scan_balanced(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, size, segments, offsets, init, ::rocprim::plus<int>()
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform scan
+/// rocprim::segmented_exclusive_scan_balanced(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, size, segments, offsets, init, ::rocprim::plus<int>()
+/// );
+/// // output: [9, 10, 12, 9, 13, 9, 15, 22]
+/// \endcode
+/// \endparblock
+template<
+    class Config = default_config,
+    class InputIterator,
+    class OutputIterator,
+    class OffsetIterator,
+    class InitValueType,
+    class BinaryFunction = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+    class AccType        = InitValueType>
+inline hipError_t segmented_exclusive_scan_balanced(void*               temporary_storage,
+                                                    size_t&             storage_size,
+                                                    InputIterator       input,
+                                                    OutputIterator      output,
+                                                    size_t              size,
+                                                    unsigned int        segments,
+                                                    OffsetIterator      offsets,
+                                                    const InitValueType initial_value,
+                                                    BinaryFunction      scan_op = BinaryFunction(),
+                                                    hipStream_t         stream  = 0,
+                                                    bool debug_synchronous      = false)
+{
+    using result_type = AccType;
+    using headflag_scan_op_wrapper_type
+        = detail::headflag_scan_op_wrapper<result_type, bool, BinaryFunction>;
+    using transform_op
+        = detail::offsets_transform_op_t<true, InputIterator, OffsetIterator, result_type>;
+
+    const result_type initial_value_converted = static_cast<result_type>(initial_value);
+
+    return exclusive_scan<Config>(
+        temporary_storage,
+        storage_size,
+        rocprim::make_transform_iterator(
+            rocprim::make_counting_iterator<size_t>(0),
+            transform_op{input, offsets, segments, initial_value_converted, size}),
+        rocprim::make_zip_iterator(rocprim::make_tuple(output, rocprim::make_discard_iterator())),
+        rocprim::make_tuple(initial_value_converted,
+                            true), // init value is a head of the first segment
+        size,
+        headflag_scan_op_wrapper_type(scan_op),
+        stream,
+        debug_synchronous);
+}
+
 /// @}
 // end of group devicemodule
 
@@ -0,0 +1,551 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SEGMENTED_SELECT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SEGMENTED_SELECT_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../iterator/discard_iterator.hpp"
+#include "../iterator/tee_iterator.hpp"
+
+#include "detail/device_segmented_select.hpp"
+#include "device_scan.hpp"
+#include "device_transform_config.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \addtogroup devicemodule
+/// @{
+
+namespace detail
+{
+
+template<bool Partition,
+         bool CountOnly,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator,
+         class OffsetIterator,
+         class OutputOffsetIterator,
+         class UnaryPredicate>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void segmented_select_kernel(InputIterator               input,
+                             OutputIterator              output,
+                             SelectedCountOutputIterator selected_counts,
+                             OffsetIterator              begin_offsets,
+                             OffsetIterator              end_offsets,
+                             OutputOffsetIterator        output_offsets,
+                             UnaryPredicate              predicate)
+{
+    constexpr kernel_config_params params = device_params<Config>().kernel_config;
+    segmented_select_segment<Partition, CountOnly, params.block_size, params.items_per_thread>(
+        input,
+        output,
+        selected_counts,
+        begin_offsets,
+        end_offsets,
+        output_offsets,
+        predicate);
+}
+
+template<bool Partition,
+         bool CountOnly,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator,
+         class OffsetIterator,
+         class OutputOffsetIterator,
+         class UnaryPredicate>
+inline hipError_t segmented_select_launch(InputIterator               input,
+                                          OutputIterator              output,
+                                          SelectedCountOutputIterator selected_counts,
+                                          unsigned int                segments,
+                                          OffsetIterator              begin_offsets,
+                                          OffsetIterator              end_offsets,
+                                          OutputOffsetIterator        output_offsets,
+                                          UnaryPredicate              predicate,
+                                          hipStream_t                 stream,
+                                          bool                        debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using config     = wrapped_transform_config<Config, value_type>;
+
+    detail::target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, target_arch));
+    const transform_config_params params = dispatch_target_arch<config>(target_arch);
+
+    if(segments == 0u)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_select_kernel<Partition,
+                                                               CountOnly,
+                                                               config,
+                                                               InputIterator,
+                                                               OutputIterator,
+                                                               SelectedCountOutputIterator,
+                                                               OffsetIterator,
+                                                               OutputOffsetIterator,
+                                                               UnaryPredicate>),
+                       dim3(segments),
+                       dim3(params.kernel_config.block_size),
+                       0,
+                       stream,
+                       input,
+                       output,
+                       selected_counts,
+                       begin_offsets,
+                       end_offsets,
+                       output_offsets,
+                       predicate);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_select_kernel", segments, start);
+
+    return hipSuccess;
+}
+
+template<bool Partition,
+         class Config,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator,
+         class OffsetIterator,
+         class UnaryPredicate>
+inline hipError_t segmented_select_impl(void*                       temporary_storage,
+                                        size_t&                     storage_size,
+                                        InputIterator               input,
+                                        OutputIterator              output,
+                                        SelectedCountOutputIterator selected_counts_output,
+                                        unsigned int                segments,
+                                        OffsetIterator              begin_offsets,
+                                        OffsetIterator              end_offsets,
+                                        UnaryPredicate              predicate,
+                                        hipStream_t                 stream,
+                                        bool                        debug_synchronous)
+{
+    if(temporary_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, because
+        // hipMalloc will return nullptr when size is zero.
+        storage_size = 4;
+        return hipSuccess;
+    }
+
+    // Every segment is compacted within its own range of the output
+    return segmented_select_launch<Partition, false, Config>(input,
+                                                             output,
+                                                             selected_counts_output,
+                                                             segments,
+                                                             begin_offsets,
+                                                             end_offsets,
+                                                             begin_offsets,
+                                                             predicate,
+                                                             stream,
+                                                             debug_synchronous);
+}
+
+template<class Config,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator,
+         class OutputOffsetIterator,
+         class OffsetIterator,
+         class UnaryPredicate>
+inline hipError_t segmented_select_packed_impl(void*                       temporary_storage,
+                                               size_t&                     storage_size,
+                                               InputIterator               input,
+                                               OutputIterator              output,
+                                               SelectedCountOutputIterator selected_counts_output,
+                                               OutputOffsetIterator        output_offsets,
+                                               unsigned int                segments,
+                                               OffsetIterator              begin_offsets,
+                                               OffsetIterator              end_offsets,
+                                               UnaryPredicate              predicate,
+                                               hipStream_t                 stream,
+                                               bool                        debug_synchronous)
+{
+    // The offsets are scanned to temporary storage, which the compaction reads, and to the output
+    using offsets_output_type = ::rocprim::tee_iterator<size_t*, OutputOffsetIterator>;
+
+    size_t scan_storage_size;
+    ROCPRIM_RETURN_ON_ERROR(
+        ::rocprim::inclusive_exclusive_scan(nullptr,
+                                            scan_storage_size,
+                                            static_cast<size_t*>(nullptr),
+                                            offsets_output_type(nullptr, output_offsets),
+                                            ::rocprim::make_discard_iterator(),
+                                            offsets_output_type(nullptr, output_offsets),
+                                            size_t(0),
+                                            segments,
+                                            ::rocprim::plus<size_t>(),
+                                            stream,
+                                            debug_synchronous));
+
+    size_t* counts;
+    size_t* offsets;
+    void*   scan_storage;
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&counts, segments),
+            detail::temp_storage::ptr_aligned_array(&offsets, size_t(segments) + 1),
+            detail::temp_storage::make_partition(&scan_storage, scan_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    ROCPRIM_RETURN_ON_ERROR((segmented_select_launch<false, true, Config>(
+        input,
+        ::rocprim::make_discard_iterator(),
+        counts,
+        segments,
+        begin_offsets,
+        end_offsets,
+        offsets,
+        predicate,
+        stream,
+        debug_synchronous)));
+
+    ROCPRIM_RETURN_ON_ERROR(::rocprim::inclusive_exclusive_scan(
+        scan_storage,
+        scan_storage_size,
+        counts,
+        offsets_output_type(offsets, output_offsets),
+        ::rocprim::make_discard_iterator(),
+        offsets_output_type(offsets + segments, output_offsets + segments),
+        size_t(0),
+        segments,
+        ::rocprim::plus<size_t>(),
+        stream,
+        debug_synchronous));
+
+    return segmented_select_launch<false, false, Config>(input,
+                                                         output,
+                                                         selected_counts_output,
+                                                         segments,
+                                                         begin_offsets,
+                                                         end_offsets,
+                                                         offsets,
+                                                         predicate,
+                                                         stream,
+                                                         debug_synchronous);
+}
+
+} // end of detail namespace
+
+
+/// \brief Parallel select primitive for device level that compacts every segment separately.
+///
+/// segmented_select copies the items of every segment for which \p predicate returns \p true
+/// to the beginning of the range of the segment in \p output, i.e. to
+/// <tt>output + begin_offsets[s]</tt>, in their order, and stores their number to
+/// <tt>selected_counts_output[s]</tt>. Items of \p output after the selected items of a
+/// segment are left unchanged. E.g. padding tokens are removed from every sequence of a batch.
+///
+/// \par Overview
+/// * Every segment is compacted by one block in one pass, tile by tile, so the counts are stored
+/// in the same pass and no temporary storage is needed.
+/// * Segments given by begin offsets not less than their end offsets are empty.
+/// * \p output must not overlap \p input.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config
+/// or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be a simple
+/// pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the numbers of selected
+/// items of the segments. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of the offsets of the segments. It can be
+/// a simple pointer type.
+/// \tparam UnaryPredicate - type of the predicate that selects the items.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element of the input range.
+/// \param [out] output - iterator to the first element of the output range.
+/// \param [out] selected_counts_output - iterator to the number of selected items of the first
+/// segment.
+/// \param [in] segments - number of segments.
+/// \param [in] begin_offsets - iterator to the first element of the begin offsets of the
+/// segments.
+/// \param [in] end_offsets - iterator to the first element of the end offsets of the segments.
+/// \param [in] predicate - unary function that returns \p true for the items to select.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto not_padding = [] __device__ (int token) { return token != 0; };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// unsigned int segments;       // e.g., 2
+/// int * input;                 // e.g., [5, 0, 7, 0, 3, 0, 0, 6]
+/// int * offsets;               // e.g., [0, 4, 8]
+/// int * output;                // empty array of 8 elements
+/// unsigned int * counts;       // empty array of 2 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::segmented_select(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, counts, segments, offsets, offsets + 1, not_padding
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the selection
+/// rocprim::segmented_select(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, counts, segments, offsets, offsets + 1, not_padding
+/// );
+/// // output: [5, 7, -, -, 3, 6, -, -]
+/// // counts: [2, 2]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator,
+         class OffsetIterator,
+         class UnaryPredicate>
+inline hipError_t segmented_select(void*                       temporary_storage,
+                                   size_t&                     storage_size,
+                                   InputIterator               input,
+                                   OutputIterator              output,
+                                   SelectedCountOutputIterator selected_counts_output,
+                                   unsigned int                segments,
+                                   OffsetIterator              begin_offsets,
+                                   OffsetIterator              end_offsets,
+                                   UnaryPredicate              predicate,
+                                   hipStream_t                 stream            = 0,
+                                   bool                        debug_synchronous = false)
+{
+    return detail::segmented_select_impl<false, Config>(temporary_storage,
+                                                        storage_size,
+                                                        input,
+                                                        output,
+                                                        selected_counts_output,
+                                                        segments,
+                                                        begin_offsets,
+                                                        end_offsets,
+                                                        predicate,
+                                                        stream,
+                                                        debug_synchronous);
+}
+
+/// \brief Parallel partition primitive for device level that partitions every segment
+/// separately.
+///
+/// segmented_partition copies the items of every segment for which \p predicate returns
+/// \p true to the beginning of the range of the segment in \p output in their order, and the
+/// other items of the segment after them in reverse order, like \p rocprim::partition. The number
+/// of the selected items of the segment \p s is stored to <tt>selected_counts_output[s]</tt>.
+///
+/// \par Overview
+/// * Every segment is partitioned by one block in one pass, tile by tile, so the counts are
+/// stored in the same pass and no temporary storage is needed.
+/// * Segments given by begin offsets not less than their end offsets are empty.
+/// * \p output must not overlap \p input.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config
+/// or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be a simple
+/// pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the numbers of selected
+/// items of the segments. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of the offsets of the segments. It can be
+/// a simple pointer type.
+/// \tparam UnaryPredicate - type of the predicate that selects the items.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element of the input range.
+/// \param [out] output - iterator to the first element of the output range.
+/// \param [out] selected_counts_output - iterator to the number of selected items of the first
+/// segment.
+/// \param [in] segments - number of segments.
+/// \param [in] begin_offsets - iterator to the first element of the begin offsets of the
+/// segments.
+/// \param [in] end_offsets - iterator to the first element of the end offsets of the segments.
+/// \param [in] predicate - unary function that returns \p true for the items to select.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator,
+         class OffsetIterator,
+         class UnaryPredicate>
+inline hipError_t segmented_partition(void*                       temporary_storage,
+                                      size_t&                     storage_size,
+                                      InputIterator               input,
+                                      OutputIterator              output,
+                                      SelectedCountOutputIterator selected_counts_output,
+                                      unsigned int                segments,
+                                      OffsetIterator              begin_offsets,
+                                      OffsetIterator              end_offsets,
+                                      UnaryPredicate              predicate,
+                                      hipStream_t                 stream            = 0,
+                                      bool                        debug_synchronous = false)
+{
+    return detail::segmented_select_impl<true, Config>(temporary_storage,
+                                                       storage_size,
+                                                       input,
+                                                       output,
+                                                       selected_counts_output,
+                                                       segments,
+                                                       begin_offsets,
+                                                       end_offsets,
+                                                       predicate,
+                                                       stream,
+                                                       debug_synchronous);
+}
+
+/// \brief Parallel select primitive for device level that compacts every segment separately
+/// into a packed output.
+///
+/// segmented_select_packed copies the items of every segment for which \p predicate returns
+/// \p true to \p output in their order, the selected items of every segment right after the
+/// selected items of the previous segment. The number of the selected items of the segment \p s
+/// is stored to <tt>selected_counts_output[s]</tt> and the offset of its first selected item in
+/// \p output to <tt>output_offsets[s]</tt>. <tt>output_offsets[segments]</tt> is the number of
+/// all selected items.
+///
+/// \par Overview
+/// * The selected items of the segments are counted first, the counts are scanned into the
+/// offsets by \p rocprim::inclusive_exclusive_scan, and the segments are compacted to their
+/// offsets, so \p predicate is called twice for every item.
+/// * Segments given by begin offsets not less than their end offsets are empty.
+/// * \p output must not overlap \p input.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config
+/// or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be a simple
+/// pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be a simple
+/// pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the numbers of selected
+/// items of the segments. It can be a simple pointer type.
+/// \tparam OutputOffsetIterator - random-access iterator type of the offsets of the segments in
+/// the output. It can be a simple pointer type.
+/// \tparam OffsetIterator - random-access iterator type of the offsets of the segments. It can be
+/// a simple pointer type.
+/// \tparam UnaryPredicate - type of the predicate that selects the items.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element of the input range.
+/// \param [out] output - iterator to the first element of the output range.
+/// \param [out] selected_counts_output - iterator to the number of selected items of the first
+/// segment.
+/// \param [out] output_offsets - iterator to the offsets of the selected items of the segments
+/// in \p output, <tt>segments + 1</tt> elements.
+/// \param [in] segments - number of segments.
+/// \param [in] begin_offsets - iterator to the first element of the begin offsets of the
+/// segments.
+/// \param [in] end_offsets - iterator to the first element of the end offsets of the segments.
+/// \param [in] predicate - unary function that returns \p true for the items to select.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator,
+         class OutputOffsetIterator,
+         class OffsetIterator,
+         class UnaryPredicate>
+inline hipError_t segmented_select_packed(void*                       temporary_storage,
+                                          size_t&                     storage_size,
+                                          InputIterator               input,
+                                          OutputIterator              output,
+                                          SelectedCountOutputIterator selected_counts_output,
+                                          OutputOffsetIterator        output_offsets,
+                                          unsigned int                segments,
+                                          OffsetIterator              begin_offsets,
+                                          OffsetIterator              end_offsets,
+                                          UnaryPredicate              predicate,
+                                          hipStream_t                 stream            = 0,
+                                          bool                        debug_synchronous = false)
+{
+    return detail::segmented_select_packed_impl<Config>(temporary_storage,
+                                                        storage_size,
+                                                        input,
+                                                        output,
+                                                        selected_counts_output,
+                                                        output_offsets,
+                                                        segments,
+                                                        begin_offsets,
+                                                        end_offsets,
+                                                        predicate,
+                                                        stream,
+                                                        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_SEGMENTED_SELECT_HPP_
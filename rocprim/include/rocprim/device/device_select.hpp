@@ -58,7 +58,8 @@ namespace detail
 /// * Range specified by \p selected_count_output must have at least 1 element.
 /// * Values of \p flag range should be implicitly convertible to `bool` type.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `select_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `select_config`
+/// or a `tuned_config` of these.
 /// \tparam InputIterator - random-access iterator type of the input range. It can be
 /// a simple pointer type.
 /// \tparam FlagIterator - random-access iterator type of the flag range. It can be
@@ -181,7 +182,8 @@ hipError_t select(void * temporary_storage,
 /// values can be copied into it.
 /// * Range specified by \p selected_count_output must have at least 1 element.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `select_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `select_config`
+/// or a `tuned_config` of these.
 /// \tparam InputIterator - random-access iterator type of the input range. It can be
 /// a simple pointer type.
 /// \tparam OutputIterator - random-access iterator type of the output range. It can be
@@ -316,7 +318,8 @@ hipError_t select(void * temporary_storage,
 /// values can be copied into it.
 /// * Range specified by \p selected_count_output must have at least 1 element.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `select_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `select_config`
+/// or a `tuned_config` of these.
 /// \tparam InputIterator - random-access iterator type of the input range. It can be
 /// a simple pointer type.
 /// \tparam FlagIterator - random-access iterator type of the flag range. It can be
@@ -436,6 +439,346 @@ inline hipError_t select(void*                       temporary_storage,
                                                predicate);
 }
 
+/// \brief Parallel select primitive for device level using range of flags, which also writes
+/// the index in the input of every selected value.
+///
+/// Same as \p select with flags, except that the index in \p input of every selected value is
+/// written to \p index_output at the same position as the value is written to \p output. The
+/// values and their indices are selected in a single pass, without a second selection of a
+/// \p counting_iterator.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p flags must have at least \p size elements.
+/// * Ranges specified by \p output and \p index_output must have at least so many elements,
+/// that all positively flagged values can be copied into them.
+/// * The indices have the value type of \p index_output, or \p size_t if it has none.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`,
+/// `select_config` or a `tuned_config` of these.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam FlagIterator - random-access iterator type of the flag range. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam IndexOutputIterator - random-access iterator type of the output range of the indices.
+/// It can be a simple pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the selected_count_output
+/// value. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the select operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to select values from.
+/// \param [in] flags - iterator to the selection flag corresponding to the first element from \p input range.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [out] index_output - iterator to the first element in the output range of the indices.
+/// \param [out] selected_count_output - iterator to the total number of selected values (length of \p output).
+/// \param [in] size - number of element in the input range.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+template<class Config = default_config,
+         class InputIterator,
+         class FlagIterator,
+         class OutputIterator,
+         class IndexOutputIterator,
+         class SelectedCountOutputIterator>
+inline hipError_t select_with_index(void*                       temporary_storage,
+                                    size_t&                     storage_size,
+                                    InputIterator               input,
+                                    FlagIterator                flags,
+                                    OutputIterator              output,
+                                    IndexOutputIterator         index_output,
+                                    SelectedCountOutputIterator selected_count_output,
+                                    const size_t                size,
+                                    const hipStream_t           stream            = 0,
+                                    const bool                  debug_synchronous = false)
+{
+    return select<Config>(temporary_storage,
+                          storage_size,
+                          detail::make_with_index_input<IndexOutputIterator>(input),
+                          flags,
+                          detail::make_with_index_output(output, index_output),
+                          selected_count_output,
+                          size,
+                          stream,
+                          debug_synchronous);
+}
+
+/// \brief Parallel select primitive for device level using selection predicate, which also
+/// writes the index in the input of every selected value.
+///
+/// Same as \p select with a predicate, except that the index in \p input of every selected
+/// value is written to \p index_output at the same position as the value is written to
+/// \p output. This replaces a selection of the values followed by a selection of a
+/// \p counting_iterator with the same predicate.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Range specified by \p input must have at least \p size elements.
+/// * Ranges specified by \p output and \p index_output must have at least so many elements,
+/// that all selected values can be copied into them.
+/// * The indices have the value type of \p index_output, or \p size_t if it has none.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`,
+/// `select_config` or a `tuned_config` of these.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam IndexOutputIterator - random-access iterator type of the output range of the indices.
+/// It can be a simple pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the selected_count_output
+/// value. It can be a simple pointer type.
+/// \tparam UnaryPredicate - type of a unary selection predicate.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the select operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to select values from.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [out] index_output - iterator to the first element in the output range of the indices.
+/// \param [out] selected_count_output - iterator to the total number of selected values (length of \p output).
+/// \param [in] size - number of element in the input range.
+/// \param [in] predicate - unary function object that will be used for selecting values.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// In this example the values less than 4 and their indices are selected.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto predicate =
+///     [] __device__ (int a) -> bool
+///     {
+///         return a < 4;
+///     };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;     // e.g., 8
+/// int * input;           // e.g., [7, 1, 5, 3, 8, 2, 6, 4]
+/// int * output;          // empty array of 8 elements
+/// size_t * indices;      // empty array of 8 elements
+/// size_t * output_count; // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::select_with_index(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, indices, output_count,
+///     input_size, predicate
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform selection
+/// rocprim::select_with_index(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     input, output, indices, output_count,
+///     input_size, predicate
+/// );
+/// // output:  [1, 3, 2]
+/// // indices: [1, 3, 5]
+/// // output_count: 3
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class IndexOutputIterator,
+         class SelectedCountOutputIterator,
+         class UnaryPredicate>
+inline hipError_t select_with_index(void*                       temporary_storage,
+                                    size_t&                     storage_size,
+                                    InputIterator               input,
+                                    OutputIterator              output,
+                                    IndexOutputIterator         index_output,
+                                    SelectedCountOutputIterator selected_count_output,
+                                    const size_t                size,
+                                    UnaryPredicate              predicate,
+                                    const hipStream_t           stream            = 0,
+                                    const bool                  debug_synchronous = false)
+{
+    return select<Config>(temporary_storage,
+                          storage_size,
+                          detail::make_with_index_input<IndexOutputIterator>(input),
+                          detail::make_with_index_output(output, index_output),
+                          selected_count_output,
+                          size,
+                          detail::with_index_predicate<UnaryPredicate>(predicate),
+                          stream,
+                          debug_synchronous);
+}
+
+/// \brief Parallel select primitive for device level using a range of flags to which a
+/// predicate is applied, which also writes the index in the input of every selected value.
+///
+/// Same as \p select with flags and a predicate, except that the index in \p input of every
+/// selected value is written to \p index_output at the same position as the value is written to
+/// \p output. The predicate is applied to the flags while they are loaded, so a stencil can be
+/// selected on without materializing an array of flags.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Ranges specified by \p input and \p flags must have at least \p size elements.
+/// * Ranges specified by \p output and \p index_output must have at least so many elements,
+/// that all selected values can be copied into them.
+/// * The indices have the value type of \p index_output, or \p size_t if it has none.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`,
+/// `select_config` or a `tuned_config` of these.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam FlagIterator - random-access iterator type of the flag range. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam IndexOutputIterator - random-access iterator type of the output range of the indices.
+/// It can be a simple pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the selected_count_output
+/// value. It can be a simple pointer type.
+/// \tparam UnaryPredicate - type of a unary selection predicate.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the select operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to select values from.
+/// \param [in] flags - iterator to the flag (stencil) corresponding to the first element from
+/// \p input range.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [out] index_output - iterator to the first element in the output range of the indices.
+/// \param [out] selected_count_output - iterator to the total number of selected values (length of \p output).
+/// \param [in] size - number of element in the input range.
+/// \param [in] predicate - unary function object that is applied to the flags for selecting
+/// values. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+template<class Config = default_config,
+         class InputIterator,
+         class FlagIterator,
+         class OutputIterator,
+         class IndexOutputIterator,
+         class SelectedCountOutputIterator,
+         class UnaryPredicate>
+inline hipError_t select_with_index(void*                       temporary_storage,
+                                    size_t&                     storage_size,
+                                    InputIterator               input,
+                                    FlagIterator                flags,
+                                    OutputIterator              output,
+                                    IndexOutputIterator         index_output,
+                                    SelectedCountOutputIterator selected_count_output,
+                                    const size_t                size,
+                                    UnaryPredicate              predicate,
+                                    const hipStream_t           stream            = 0,
+                                    const bool                  debug_synchronous = false)
+{
+    return select<Config>(temporary_storage,
+                          storage_size,
+                          detail::make_with_index_input<IndexOutputIterator>(input),
+                          flags,
+                          detail::make_with_index_output(output, index_output),
+                          selected_count_output,
+                          size,
+                          predicate,
+                          stream,
+                          debug_synchronous);
+}
+
+/// \brief Parallel select primitive for device level using selection predicate, which writes
+/// the selected values in an unspecified order.
+///
+/// Performs a device-wide selection like \p select with a predicate, except that the selected
+/// values are not kept in their order in the input. In return there is no scan of the flags and
+/// no look-back between the tiles: the selected values of a warp are counted with ballots, and
+/// space for them is reserved in \p output with one atomic per warp. Warps that select nothing
+/// only read their input, so this is much faster than \p select for sparse selections (e.g.
+/// filters that keep a small fraction of the input) where the order does not matter.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * Range specified by \p input must have at least \p size elements.
+/// * Range specified by \p output must have at least so many elements, that all selected
+/// values can be copied into it.
+/// * Range specified by \p selected_count_output must have at least 1 element.
+/// * The selected values are written in an <b>unspecified order</b>, which may differ between
+/// calls with the same input.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`,
+/// `select_config` or a `tuned_config` of these. Only the block size and the items per thread
+/// are used.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam SelectedCountOutputIterator - random-access iterator type of the selected_count_output
+/// value. It can be a simple pointer type.
+/// \tparam UnaryPredicate - type of a unary selection predicate.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the select operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to select values from.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [out] selected_count_output - iterator to the total number of selected values (length of \p output).
+/// \param [in] size - number of element in the input range.
+/// \param [in] predicate - unary function object that will be used for selecting values.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class SelectedCountOutputIterator,
+         class UnaryPredicate>
+inline hipError_t select_unordered(void*                       temporary_storage,
+                                   size_t&                     storage_size,
+                                   InputIterator               input,
+                                   OutputIterator              output,
+                                   SelectedCountOutputIterator selected_count_output,
+                                   const size_t                size,
+                                   UnaryPredicate              predicate,
+                                   const hipStream_t           stream            = 0,
+                                   const bool                  debug_synchronous = false)
+{
+    return detail::partition_unordered_impl<detail::partition_subalgo::select_predicate,
+                                            false,
+                                            Config>(
+        temporary_storage,
+        storage_size,
+        input,
+        output,
+        selected_count_output,
+        size,
+        detail::select_unordered_predicate_op<UnaryPredicate>{predicate},
+        stream,
+        debug_synchronous);
+}
+
 /// \brief Device-level parallel unique primitive.
 ///
 /// From given \p input range unique primitive eliminates all but the first element from every
@@ -451,7 +794,8 @@ inline hipError_t select(void*                       temporary_storage,
 /// * By default <tt>InputIterator::value_type</tt>'s equality operator is used to check
 /// if elements are equivalent.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `select_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `select_config`
+/// or a `tuned_config` of these.
 /// \tparam InputIterator - random-access iterator type of the input range. It can be
 /// a simple pointer type.
 /// \tparam OutputIterator - random-access iterator type of the output range. It can be
@@ -562,6 +906,80 @@ hipError_t unique(void * temporary_storage,
         unary_predicate_type());
 }
 
+/// \brief Device-level parallel unique primitive, which writes the unique values in an
+/// unspecified order.
+///
+/// Same as \p unique, except that the first values of the groups of equivalent values are not
+/// kept in their order in the input. Every item is compared to the preceding item read again from
+/// \p input, and the values are written with the atomic reservation of \p select_unordered, so
+/// the tiles do not look back at each other.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * Range specified by \p input must have at least \p size elements.
+/// * Range specified by \p output must have at least so many elements, that all selected
+/// values can be copied into it.
+/// * Range specified by \p unique_count_output must have at least 1 element.
+/// * The unique values are written in an <b>unspecified order</b>, which may differ between
+/// calls with the same input.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`,
+/// `select_config` or a `tuned_config` of these. Only the block size and the items per thread
+/// are used.
+/// \tparam InputIterator - random-access iterator type of the input range. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. It can be
+/// a simple pointer type.
+/// \tparam UniqueCountOutputIterator - random-access iterator type of the unique_count_output
+/// value used to return number of unique values. It can be a simple pointer type.
+/// \tparam EqualityOp - type of an binary operator used to compare values for equality.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the unique operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] input - iterator to the first element in the range to select values from.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [out] unique_count_output - iterator to the total number of selected values (length of \p output).
+/// \param [in] size - number of element in the input range.
+/// \param [in] equality_op - [optional] binary function object used to compare input values for equality.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool equal_to(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class UniqueCountOutputIterator,
+         class EqualityOp
+         = ::rocprim::equal_to<typename std::iterator_traits<InputIterator>::value_type>>
+inline hipError_t unique_unordered(void*                     temporary_storage,
+                                   size_t&                   storage_size,
+                                   InputIterator             input,
+                                   OutputIterator            output,
+                                   UniqueCountOutputIterator unique_count_output,
+                                   const size_t              size,
+                                   EqualityOp                equality_op       = EqualityOp(),
+                                   const hipStream_t         stream            = 0,
+                                   const bool                debug_synchronous = false)
+{
+    return detail::partition_unordered_impl<detail::partition_subalgo::select_unique,
+                                            false,
+                                            Config>(
+        temporary_storage,
+        storage_size,
+        input,
+        output,
+        unique_count_output,
+        size,
+        detail::select_unordered_unique_op<InputIterator, EqualityOp>{input, equality_op},
+        stream,
+        debug_synchronous);
+}
+
 /// \brief Device-level parallel unique by key primitive.
 ///
 /// From given \p input range unique primitive eliminates all but the first element from every
@@ -578,7 +996,8 @@ hipError_t unique(void * temporary_storage,
 /// * By default <tt>InputIterator::value_type</tt>'s equality operator is used to check
 /// if elements are equivalent.
 ///
-/// \tparam Config - [optional] Configuration of the primitive, must be `default_config` or `select_config`.
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`, `select_config`
+/// or a `tuned_config` of these.
 /// \tparam KeyIterator - random-access iterator type of the input key range. It can be
 /// a simple pointer type.
 /// \tparam ValueIterator - random-access iterator type of the input value range. It can be
@@ -660,6 +1079,92 @@ inline hipError_t unique_by_key(void*                           temporary_storag
                                                no_predicate);
 }
 
+/// \brief Device-level parallel unique by key primitive, which also writes the index in the
+/// input of every selected key.
+///
+/// Same as \p unique_by_key, except that the index in \p keys_input of every selected key is
+/// written to \p index_output at the same position as the key is written to \p keys_output. The
+/// keys, values and indices are selected in a single pass.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * Ranges specified by \p keys_input and value_input must have at least \p size elements each.
+/// * Ranges specified by \p keys_output, \p values_output and \p index_output each must have at
+/// least so many elements, that all selected values can be copied into them.
+/// * Range specified by \p unique_count_output must have at least 1 element.
+/// * The indices have the value type of \p index_output, or \p size_t if it has none.
+///
+/// \tparam Config - [optional] Configuration of the primitive, must be `default_config`,
+/// `select_config` or a `tuned_config` of these.
+/// \tparam KeyIterator - random-access iterator type of the input key range. It can be
+/// a simple pointer type.
+/// \tparam ValueIterator - random-access iterator type of the input value range. It can be
+/// a simple pointer type.
+/// \tparam OutputKeyIterator - random-access iterator type of the output key range. It can be
+/// a simple pointer type.
+/// \tparam OutputValueIterator - random-access iterator type of the output value range. It can be
+/// a simple pointer type.
+/// \tparam IndexOutputIterator - random-access iterator type of the output range of the indices.
+/// It can be a simple pointer type.
+/// \tparam UniqueCountOutputIterator - random-access iterator type of the unique_count_output
+/// value used to return number of unique keys and values. It can be a simple pointer type.
+/// \tparam EqualityOp - type of an binary operator used to compare keys for equality.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the unique operation.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input - iterator to the first element in the range to select keys from.
+/// \param [in] values_input - iterator to the first element in the range of values corresponding to keys
+/// \param [out] keys_output - iterator to the first element in the output key range.
+/// \param [out] values_output - iterator to the first element in the output value range.
+/// \param [out] index_output - iterator to the first element in the output range of the indices.
+/// \param [out] unique_count_output - iterator to the total number of selected values (length of \p output).
+/// \param [in] size - number of element in the input range.
+/// \param [in] equality_op - [optional] binary function object used to compare input values for equality.
+/// The signature of the function should be equivalent to the following:
+/// <tt>bool equal_to(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+template<typename Config = default_config,
+         typename KeyIterator,
+         typename ValueIterator,
+         typename OutputKeyIterator,
+         typename OutputValueIterator,
+         typename IndexOutputIterator,
+         typename UniqueCountOutputIterator,
+         typename EqualityOp
+         = ::rocprim::equal_to<typename std::iterator_traits<KeyIterator>::value_type>>
+inline hipError_t unique_by_key_with_index(void*                           temporary_storage,
+                                           size_t&                         storage_size,
+                                           const KeyIterator               keys_input,
+                                           const ValueIterator             values_input,
+                                           const OutputKeyIterator         keys_output,
+                                           const OutputValueIterator       values_output,
+                                           const IndexOutputIterator       index_output,
+                                           const UniqueCountOutputIterator unique_count_output,
+                                           const size_t                    size,
+                                           const EqualityOp  equality_op       = EqualityOp(),
+                                           const hipStream_t stream            = 0,
+                                           const bool        debug_synchronous = false)
+{
+    // The indices are carried with the values, the keys are compared as they are.
+    return unique_by_key<Config>(temporary_storage,
+                                 storage_size,
+                                 keys_input,
+                                 detail::make_with_index_input<IndexOutputIterator>(values_input),
+                                 keys_output,
+                                 detail::make_with_index_output(values_output, index_output),
+                                 unique_count_output,
+                                 size,
+                                 equality_op,
+                                 stream,
+                                 debug_synchronous);
+}
+
 /// @}
 // end of group devicemodule
 
@@ -0,0 +1,1069 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SET_OPERATIONS_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SET_OPERATIONS_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../iterator/constant_iterator.hpp"
+#include "../types.hpp"
+
+#include "detail/device_set_operations.hpp"
+#include "device_merge.hpp"
+#include "device_scan.hpp"
+#include "device_set_operations_config.hpp"
+#include "device_transform.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Config,
+         set_operation Operation,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+__launch_bounds__(device_params<Config>().kernel_config.block_size)
+void set_operation_count_kernel(const unsigned int* index,
+                                KeysInputIterator1  keys_input1,
+                                KeysInputIterator2  keys_input2,
+                                size_t*             tile_counts,
+                                const unsigned int  input1_size,
+                                const unsigned int  input2_size,
+                                const unsigned int  partitions,
+                                BinaryFunction      compare_function)
+{
+    static constexpr merge_config_params params = device_params<Config>();
+    set_operation_count_kernel_impl<Operation,
+                                    params.kernel_config.block_size,
+                                    params.kernel_config.items_per_thread>(index,
+                                                                           keys_input1,
+                                                                           keys_input2,
+                                                                           tile_counts,
+                                                                           input1_size,
+                                                                           input2_size,
+                                                                           partitions,
+                                                                           compare_function);
+}
+
+template<class Config,
+         set_operation Operation,
+         bool          WithValues,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class ValuesInputIterator1,
+         class ValuesInputIterator2,
+         class ValuesOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction>
+ROCPRIM_KERNEL
+__launch_bounds__(device_params<Config>().kernel_config.block_size)
+void set_operation_scatter_kernel(const unsigned int*  index,
+                                  KeysInputIterator1   keys_input1,
+                                  KeysInputIterator2   keys_input2,
+                                  KeysOutputIterator   keys_output,
+                                  ValuesInputIterator1 values_input1,
+                                  ValuesInputIterator2 values_input2,
+                                  ValuesOutputIterator values_output,
+                                  OutputCountIterator  count_output,
+                                  const size_t*        tile_offsets,
+                                  const unsigned int   input1_size,
+                                  const unsigned int   input2_size,
+                                  const unsigned int   partitions,
+                                  BinaryFunction       compare_function)
+{
+    static constexpr merge_config_params params = device_params<Config>();
+    set_operation_scatter_kernel_impl<Operation,
+                                      params.kernel_config.block_size,
+                                      params.kernel_config.items_per_thread,
+                                      WithValues>(index,
+                                                  keys_input1,
+                                                  keys_input2,
+                                                  keys_output,
+                                                  values_input1,
+                                                  values_input2,
+                                                  values_output,
+                                                  count_output,
+                                                  tile_offsets,
+                                                  input1_size,
+                                                  input2_size,
+                                                  partitions,
+                                                  compare_function);
+}
+
+template<set_operation Operation,
+         class Config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class ValuesInputIterator1,
+         class ValuesInputIterator2,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction>
+inline hipError_t set_operation_impl(void*                temporary_storage,
+                                     size_t&              storage_size,
+                                     KeysInputIterator1   keys_input1,
+                                     KeysInputIterator2   keys_input2,
+                                     ValuesInputIterator1 values_input1,
+                                     ValuesInputIterator2 values_input2,
+                                     KeysOutputIterator   keys_output,
+                                     ValuesOutputIterator values_output,
+                                     OutputCountIterator  count_output,
+                                     const size_t         input1_size,
+                                     const size_t         input2_size,
+                                     BinaryFunction       compare_function,
+                                     const hipStream_t    stream,
+                                     const bool           debug_synchronous)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator1>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator1>::value_type;
+    using config     = wrapped_set_operations_config<Config, key_type, value_type>;
+
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const merge_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int half_block      = block_size / 2;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+    const unsigned int partitions      = static_cast<unsigned int>(
+        ceiling_div<size_t>(input1_size + input2_size, items_per_block));
+
+    unsigned int* index        = nullptr;
+    size_t*       tile_counts  = nullptr;
+    size_t*       tile_offsets = nullptr;
+    void*         scan_storage = nullptr;
+
+    // The offsets of the tiles are the exclusive scan of their counts, its last item is the
+    // number of output keys.
+    size_t scan_bytes = 0;
+    ROCPRIM_RETURN_ON_ERROR(::rocprim::exclusive_scan(nullptr,
+                                                      scan_bytes,
+                                                      tile_counts,
+                                                      tile_offsets,
+                                                      size_t(0),
+                                                      partitions + 1,
+                                                      ::rocprim::plus<size_t>(),
+                                                      stream,
+                                                      debug_synchronous));
+
+    result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::ptr_aligned_array(&index, partitions + 1),
+            temp_storage::ptr_aligned_array(&tile_counts, partitions + 1),
+            temp_storage::ptr_aligned_array(&tile_offsets, partitions + 1),
+            temp_storage::make_partition(&scan_storage, scan_bytes)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    if(partitions == 0)
+    {
+        return ::rocprim::transform(::rocprim::constant_iterator<size_t>(0),
+                                    count_output,
+                                    1,
+                                    ::rocprim::identity<size_t>(),
+                                    stream,
+                                    debug_synchronous);
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "input1_size: " << input1_size << '\n';
+        std::cout << "input2_size: " << input2_size << '\n';
+        std::cout << "block_size: " << block_size << '\n';
+        std::cout << "items_per_block: " << items_per_block << '\n';
+        std::cout << "partitions: " << partitions << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    const unsigned int partition_blocks = ceiling_div(partitions + 1, half_block);
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    partition_kernel<config>
+        <<<dim3(partition_blocks), dim3(half_block), 0, stream>>>(index,
+                                                                  keys_input1,
+                                                                  keys_input2,
+                                                                  input1_size,
+                                                                  input2_size,
+                                                                  items_per_block,
+                                                                  compare_function);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("partition_kernel", partitions + 1, start);
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    set_operation_count_kernel<config, Operation>
+        <<<dim3(partitions), dim3(block_size), 0, stream>>>(index,
+                                                            keys_input1,
+                                                            keys_input2,
+                                                            tile_counts,
+                                                            input1_size,
+                                                            input2_size,
+                                                            partitions,
+                                                            compare_function);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("set_operation_count_kernel",
+                                                input1_size + input2_size,
+                                                start);
+
+    ROCPRIM_RETURN_ON_ERROR(::rocprim::exclusive_scan(scan_storage,
+                                                      scan_bytes,
+                                                      tile_counts,
+                                                      tile_offsets,
+                                                      size_t(0),
+                                                      partitions + 1,
+                                                      ::rocprim::plus<size_t>(),
+                                                      stream,
+                                                      debug_synchronous));
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    set_operation_scatter_kernel<config, Operation, with_values>
+        <<<dim3(partitions), dim3(block_size), 0, stream>>>(index,
+                                                            keys_input1,
+                                                            keys_input2,
+                                                            keys_output,
+                                                            values_input1,
+                                                            values_input2,
+                                                            values_output,
+                                                            count_output,
+                                                            tile_offsets,
+                                                            input1_size,
+                                                            input2_size,
+                                                            partitions,
+                                                            compare_function);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("set_operation_scatter_kernel",
+                                                input1_size + input2_size,
+                                                start);
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Parallel union primitive of sorted ranges for device level.
+///
+/// \p set_union writes the keys that are in the first or in the second range to \p keys_output,
+/// in ascending order. The ranges are multisets: if a key occurs \p m times in the first range
+/// and \p n times in the second range, all \p m keys of the first range are written, followed by
+/// the last <tt>max(n - m, 0)</tt> keys of the second range.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The contents of the inputs are not altered by the function.
+/// * Both ranges must be sorted by \p compare_function.
+/// * The number of written keys is written to \p count_output, which stays on the device, so
+///   the function does not synchronize with the host. At most <tt>input1_size + input2_size</tt>
+///   keys are written.
+/// * The two ranges are partitioned into tiles along the merge path. The output keys of every
+///   tile are counted first, then the tiles are merged again and their output keys written at the
+///   exclusive scan of the counts.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p merge_config or
+///   \p default_config, which uses the configuration of merge tuned for the architecture.
+/// \tparam KeysInputIterator1 [inferred] random-access iterator type of the first input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysInputIterator2 [inferred] random-access iterator type of the second input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputCountIterator [inferred] random-access iterator type of the number of output
+///   keys. It can be a simple pointer type.
+/// \tparam BinaryFunction [inferred] type of the comparison function object.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input1 iterator to the first key of the first range.
+/// \param [in] keys_input2 iterator to the first key of the second range.
+/// \param [out] keys_output iterator to the output range.
+/// \param [out] count_output iterator to the number of output keys.
+/// \param [in] input1_size number of keys in the first range.
+/// \param [in] input2_size number of keys in the second range.
+/// \param [in] compare_function [optional] comparison function object which returns true if
+///   the first argument is ordered before the second. Default is \p rocprim::less.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after a successful operation; otherwise a HIP runtime error
+///   of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t  input1_size; // e.g., 5
+/// size_t  input2_size; // e.g., 5
+/// int*    input1;      // e.g., [0, 1, 2, 2, 4]
+/// int*    input2;      // e.g., [2, 3, 4, 5, 6]
+/// int*    output;      // empty array of 10 elements
+/// size_t* count;       // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void*  temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::set_union(temporary_storage_ptr,
+///                    temporary_storage_size_bytes,
+///                    input1,
+///                    input2,
+///                    output,
+///                    count,
+///                    input1_size,
+///                    input2_size);
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the operation
+/// rocprim::set_union(temporary_storage_ptr,
+///                    temporary_storage_size_bytes,
+///                    input1,
+///                    input2,
+///                    output,
+///                    count,
+///                    input1_size,
+///                    input2_size);
+/// // output: [0, 1, 2, 2, 3, 4, 5, 6]
+/// // count:  [8]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t set_union(void*               temporary_storage,
+                            size_t&             storage_size,
+                            KeysInputIterator1  keys_input1,
+                            KeysInputIterator2  keys_input2,
+                            KeysOutputIterator  keys_output,
+                            OutputCountIterator count_output,
+                            const size_t        input1_size,
+                            const size_t        input2_size,
+                            BinaryFunction      compare_function  = BinaryFunction(),
+                            const hipStream_t   stream            = 0,
+                            const bool          debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::set_operation_impl<detail::set_operation::set_union, Config>(
+        temporary_storage,
+        storage_size,
+        keys_input1,
+        keys_input2,
+        values,
+        values,
+        keys_output,
+        values,
+        count_output,
+        input1_size,
+        input2_size,
+        compare_function,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel union primitive of sorted ranges of key-value pairs for device level.
+///
+/// \p set_union_by_key writes the keys of \p set_union and their values. Since every output key
+/// is taken from one of the input ranges, the value of every output key is the value of the same
+/// key of its input range.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The contents of the inputs are not altered by the function.
+/// * The number of written pairs is written to \p count_output.
+///
+/// \tparam ValuesInputIterator1 [inferred] random-access iterator type of the values of the
+///   first input range.
+/// \tparam ValuesInputIterator2 [inferred] random-access iterator type of the values of the
+///   second input range.
+/// \tparam ValuesOutputIterator [inferred] random-access iterator type of the output values.
+///
+/// \param [in] values_input1 iterator to the first value of the first range.
+/// \param [in] values_input2 iterator to the first value of the second range.
+/// \param [out] values_output iterator to the output values.
+///
+/// \see set_union
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class ValuesInputIterator1,
+         class ValuesInputIterator2,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t set_union_by_key(void*                temporary_storage,
+                                   size_t&              storage_size,
+                                   KeysInputIterator1   keys_input1,
+                                   KeysInputIterator2   keys_input2,
+                                   ValuesInputIterator1 values_input1,
+                                   ValuesInputIterator2 values_input2,
+                                   KeysOutputIterator   keys_output,
+                                   ValuesOutputIterator values_output,
+                                   OutputCountIterator  count_output,
+                                   const size_t         input1_size,
+                                   const size_t         input2_size,
+                                   BinaryFunction       compare_function  = BinaryFunction(),
+                                   const hipStream_t    stream            = 0,
+                                   const bool           debug_synchronous = false)
+{
+    return detail::set_operation_impl<detail::set_operation::set_union, Config>(
+        temporary_storage,
+        storage_size,
+        keys_input1,
+        keys_input2,
+        values_input1,
+        values_input2,
+        keys_output,
+        values_output,
+        count_output,
+        input1_size,
+        input2_size,
+        compare_function,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel intersection primitive of sorted ranges for device level.
+///
+/// \p set_intersection writes the keys that are in both ranges to \p keys_output, in ascending
+/// order. The ranges are multisets: if a key occurs \p m times in the first range and \p n times in
+/// the second range, the first <tt>min(m, n)</tt> keys of the first range are written.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The contents of the inputs are not altered by the function.
+/// * Both ranges must be sorted by \p compare_function.
+/// * The number of written keys is written to \p count_output, which stays on the device, so
+///   the function does not synchronize with the host. At most
+///   <tt>min(input1_size, input2_size)</tt> keys are written.
+/// * The two ranges are partitioned into tiles along the merge path. The output keys of every
+///   tile are counted first, then the tiles are merged again and their output keys written at the
+///   exclusive scan of the counts.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p merge_config or
+///   \p default_config, which uses the configuration of merge tuned for the architecture.
+/// \tparam KeysInputIterator1 [inferred] random-access iterator type of the first input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysInputIterator2 [inferred] random-access iterator type of the second input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputCountIterator [inferred] random-access iterator type of the number of output
+///   keys. It can be a simple pointer type.
+/// \tparam BinaryFunction [inferred] type of the comparison function object.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input1 iterator to the first key of the first range.
+/// \param [in] keys_input2 iterator to the first key of the second range.
+/// \param [out] keys_output iterator to the output range.
+/// \param [out] count_output iterator to the number of output keys.
+/// \param [in] input1_size number of keys in the first range.
+/// \param [in] input2_size number of keys in the second range.
+/// \param [in] compare_function [optional] comparison function object which returns true if
+///   the first argument is ordered before the second. Default is \p rocprim::less.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after a successful operation; otherwise a HIP runtime error
+///   of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t  input1_size; // e.g., 5
+/// size_t  input2_size; // e.g., 5
+/// int*    input1;      // e.g., [0, 1, 2, 2, 4]
+/// int*    input2;      // e.g., [2, 3, 4, 5, 6]
+/// int*    output;      // empty array of 5 elements
+/// size_t* count;       // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void*  temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::set_intersection(temporary_storage_ptr,
+///                           temporary_storage_size_bytes,
+///                           input1,
+///                           input2,
+///                           output,
+///                           count,
+///                           input1_size,
+///                           input2_size);
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the operation
+/// rocprim::set_intersection(temporary_storage_ptr,
+///                           temporary_storage_size_bytes,
+///                           input1,
+///                           input2,
+///                           output,
+///                           count,
+///                           input1_size,
+///                           input2_size);
+/// // output: [2, 4]
+/// // count:  [2]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t set_intersection(void*               temporary_storage,
+                                   size_t&             storage_size,
+                                   KeysInputIterator1  keys_input1,
+                                   KeysInputIterator2  keys_input2,
+                                   KeysOutputIterator  keys_output,
+                                   OutputCountIterator count_output,
+                                   const size_t        input1_size,
+                                   const size_t        input2_size,
+                                   BinaryFunction      compare_function  = BinaryFunction(),
+                                   const hipStream_t   stream            = 0,
+                                   const bool          debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::set_operation_impl<detail::set_operation::set_intersection, Config>(
+        temporary_storage,
+        storage_size,
+        keys_input1,
+        keys_input2,
+        values,
+        values,
+        keys_output,
+        values,
+        count_output,
+        input1_size,
+        input2_size,
+        compare_function,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel intersection primitive of sorted ranges of key-value pairs for device level.
+///
+/// \p set_intersection_by_key writes the keys of \p set_intersection and their values. Since every
+/// output key is taken from one of the input ranges, the value of every output key is the value of
+/// the same key of the first range.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The contents of the inputs are not altered by the function.
+/// * The number of written pairs is written to \p count_output.
+///
+/// \tparam ValuesInputIterator1 [inferred] random-access iterator type of the values of the
+///   first input range.
+/// \tparam ValuesOutputIterator [inferred] random-access iterator type of the output values.
+///
+/// \param [in] values_input1 iterator to the first value of the first range.
+/// \param [out] values_output iterator to the output values.
+///
+/// \see set_intersection
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class ValuesInputIterator1,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t set_intersection_by_key(void*                temporary_storage,
+                                          size_t&              storage_size,
+                                          KeysInputIterator1   keys_input1,
+                                          KeysInputIterator2   keys_input2,
+                                          ValuesInputIterator1 values_input1,
+                                          KeysOutputIterator   keys_output,
+                                          ValuesOutputIterator values_output,
+                                          OutputCountIterator  count_output,
+                                          const size_t         input1_size,
+                                          const size_t         input2_size,
+                                          BinaryFunction       compare_function  = BinaryFunction(),
+                                          const hipStream_t    stream            = 0,
+                                          const bool           debug_synchronous = false)
+{
+    return detail::set_operation_impl<detail::set_operation::set_intersection, Config>(
+        temporary_storage,
+        storage_size,
+        keys_input1,
+        keys_input2,
+        values_input1,
+        values_input1,
+        keys_output,
+        values_output,
+        count_output,
+        input1_size,
+        input2_size,
+        compare_function,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel difference primitive of sorted ranges for device level.
+///
+/// \p set_difference writes the keys of the first range that are not in the second range to
+/// \p keys_output, in ascending order. The ranges are multisets: if a key occurs \p m times in the
+/// first range and \p n times in the second range, the last <tt>max(m - n, 0)</tt> keys of the
+/// first range are written.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The contents of the inputs are not altered by the function.
+/// * Both ranges must be sorted by \p compare_function.
+/// * The number of written keys is written to \p count_output, which stays on the device, so
+///   the function does not synchronize with the host. At most <tt>input1_size</tt>
+///   keys are written.
+/// * The two ranges are partitioned into tiles along the merge path. The output keys of every
+///   tile are counted first, then the tiles are merged again and their output keys written at the
+///   exclusive scan of the counts.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p merge_config or
+///   \p default_config, which uses the configuration of merge tuned for the architecture.
+/// \tparam KeysInputIterator1 [inferred] random-access iterator type of the first input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysInputIterator2 [inferred] random-access iterator type of the second input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputCountIterator [inferred] random-access iterator type of the number of output
+///   keys. It can be a simple pointer type.
+/// \tparam BinaryFunction [inferred] type of the comparison function object.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input1 iterator to the first key of the first range.
+/// \param [in] keys_input2 iterator to the first key of the second range.
+/// \param [out] keys_output iterator to the output range.
+/// \param [out] count_output iterator to the number of output keys.
+/// \param [in] input1_size number of keys in the first range.
+/// \param [in] input2_size number of keys in the second range.
+/// \param [in] compare_function [optional] comparison function object which returns true if
+///   the first argument is ordered before the second. Default is \p rocprim::less.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after a successful operation; otherwise a HIP runtime error
+///   of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t  input1_size; // e.g., 5
+/// size_t  input2_size; // e.g., 5
+/// int*    input1;      // e.g., [0, 1, 2, 2, 4]
+/// int*    input2;      // e.g., [2, 3, 4, 5, 6]
+/// int*    output;      // empty array of 5 elements
+/// size_t* count;       // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void*  temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::set_difference(temporary_storage_ptr,
+///                         temporary_storage_size_bytes,
+///                         input1,
+///                         input2,
+///                         output,
+///                         count,
+///                         input1_size,
+///                         input2_size);
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the operation
+/// rocprim::set_difference(temporary_storage_ptr,
+///                         temporary_storage_size_bytes,
+///                         input1,
+///                         input2,
+///                         output,
+///                         count,
+///                         input1_size,
+///                         input2_size);
+/// // output: [0, 1, 2]
+/// // count:  [3]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t set_difference(void*               temporary_storage,
+                                 size_t&             storage_size,
+                                 KeysInputIterator1  keys_input1,
+                                 KeysInputIterator2  keys_input2,
+                                 KeysOutputIterator  keys_output,
+                                 OutputCountIterator count_output,
+                                 const size_t        input1_size,
+                                 const size_t        input2_size,
+                                 BinaryFunction      compare_function  = BinaryFunction(),
+                                 const hipStream_t   stream            = 0,
+                                 const bool          debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::set_operation_impl<detail::set_operation::set_difference, Config>(
+        temporary_storage,
+        storage_size,
+        keys_input1,
+        keys_input2,
+        values,
+        values,
+        keys_output,
+        values,
+        count_output,
+        input1_size,
+        input2_size,
+        compare_function,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel difference primitive of sorted ranges of key-value pairs for device level.
+///
+/// \p set_difference_by_key writes the keys of \p set_difference and their values. Since every
+/// output key is taken from one of the input ranges, the value of every output key is the value of
+/// the same key of its input range.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The contents of the inputs are not altered by the function.
+/// * The number of written pairs is written to \p count_output.
+///
+/// \tparam ValuesInputIterator1 [inferred] random-access iterator type of the values of the
+///   first input range.
+/// \tparam ValuesInputIterator2 [inferred] random-access iterator type of the values of the
+///   second input range.
+/// \tparam ValuesOutputIterator [inferred] random-access iterator type of the output values.
+///
+/// \param [in] values_input1 iterator to the first value of the first range.
+/// \param [in] values_input2 iterator to the first value of the second range.
+/// \param [out] values_output iterator to the output values.
+///
+/// \see set_difference
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class ValuesInputIterator1,
+         class ValuesInputIterator2,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t set_difference_by_key(void*                temporary_storage,
+                                        size_t&              storage_size,
+                                        KeysInputIterator1   keys_input1,
+                                        KeysInputIterator2   keys_input2,
+                                        ValuesInputIterator1 values_input1,
+                                        ValuesInputIterator2 values_input2,
+                                        KeysOutputIterator   keys_output,
+                                        ValuesOutputIterator values_output,
+                                        OutputCountIterator  count_output,
+                                        const size_t         input1_size,
+                                        const size_t         input2_size,
+                                        BinaryFunction       compare_function  = BinaryFunction(),
+                                        const hipStream_t    stream            = 0,
+                                        const bool           debug_synchronous = false)
+{
+    return detail::set_operation_impl<detail::set_operation::set_difference, Config>(
+        temporary_storage,
+        storage_size,
+        keys_input1,
+        keys_input2,
+        values_input1,
+        values_input2,
+        keys_output,
+        values_output,
+        count_output,
+        input1_size,
+        input2_size,
+        compare_function,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel symmetric difference primitive of sorted ranges for device level.
+///
+/// \p set_symmetric_difference writes the keys that are in one of the ranges but not in the other
+/// to \p keys_output, in ascending order. The ranges are multisets: if a key occurs \p m times in
+/// the first range and \p n times in the second range, the last <tt>max(m - n, 0)</tt> keys of the
+/// first range or the last <tt>max(n - m, 0)</tt> keys of the second range are written.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The contents of the inputs are not altered by the function.
+/// * Both ranges must be sorted by \p compare_function.
+/// * The number of written keys is written to \p count_output, which stays on the device, so
+///   the function does not synchronize with the host. At most <tt>input1_size + input2_size</tt>
+///   keys are written.
+/// * The two ranges are partitioned into tiles along the merge path. The output keys of every
+///   tile are counted first, then the tiles are merged again and their output keys written at the
+///   exclusive scan of the counts.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p merge_config or
+///   \p default_config, which uses the configuration of merge tuned for the architecture.
+/// \tparam KeysInputIterator1 [inferred] random-access iterator type of the first input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysInputIterator2 [inferred] random-access iterator type of the second input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OutputCountIterator [inferred] random-access iterator type of the number of output
+///   keys. It can be a simple pointer type.
+/// \tparam BinaryFunction [inferred] type of the comparison function object.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the operation.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input1 iterator to the first key of the first range.
+/// \param [in] keys_input2 iterator to the first key of the second range.
+/// \param [out] keys_output iterator to the output range.
+/// \param [out] count_output iterator to the number of output keys.
+/// \param [in] input1_size number of keys in the first range.
+/// \param [in] input2_size number of keys in the second range.
+/// \param [in] compare_function [optional] comparison function object which returns true if
+///   the first argument is ordered before the second. Default is \p rocprim::less.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after a successful operation; otherwise a HIP runtime error
+///   of type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t  input1_size; // e.g., 5
+/// size_t  input2_size; // e.g., 5
+/// int*    input1;      // e.g., [0, 1, 2, 2, 4]
+/// int*    input2;      // e.g., [2, 3, 4, 5, 6]
+/// int*    output;      // empty array of 10 elements
+/// size_t* count;       // empty array of 1 element
+///
+/// size_t temporary_storage_size_bytes;
+/// void*  temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::set_symmetric_difference(temporary_storage_ptr,
+///                                   temporary_storage_size_bytes,
+///                                   input1,
+///                                   input2,
+///                                   output,
+///                                   count,
+///                                   input1_size,
+///                                   input2_size);
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the operation
+/// rocprim::set_symmetric_difference(temporary_storage_ptr,
+///                                   temporary_storage_size_bytes,
+///                                   input1,
+///                                   input2,
+///                                   output,
+///                                   count,
+///                                   input1_size,
+///                                   input2_size);
+/// // output: [0, 1, 2, 3, 5, 6]
+/// // count:  [6]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class KeysOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t set_symmetric_difference(void*               temporary_storage,
+                                           size_t&             storage_size,
+                                           KeysInputIterator1  keys_input1,
+                                           KeysInputIterator2  keys_input2,
+                                           KeysOutputIterator  keys_output,
+                                           OutputCountIterator count_output,
+                                           const size_t        input1_size,
+                                           const size_t        input2_size,
+                                           BinaryFunction      compare_function  = BinaryFunction(),
+                                           const hipStream_t   stream            = 0,
+                                           const bool          debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::set_operation_impl<detail::set_operation::set_symmetric_difference, Config>(
+        temporary_storage,
+        storage_size,
+        keys_input1,
+        keys_input2,
+        values,
+        values,
+        keys_output,
+        values,
+        count_output,
+        input1_size,
+        input2_size,
+        compare_function,
+        stream,
+        debug_synchronous);
+}
+
+/// \brief Parallel symmetric difference primitive of sorted ranges of key-value pairs for device
+/// level.
+///
+/// \p set_symmetric_difference_by_key writes the keys of \p set_symmetric_difference and their
+/// values. Since every output key is taken from one of the input ranges, the value of every output
+/// key is the value of the same key of its input range.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The contents of the inputs are not altered by the function.
+/// * The number of written pairs is written to \p count_output.
+///
+/// \tparam ValuesInputIterator1 [inferred] random-access iterator type of the values of the
+///   first input range.
+/// \tparam ValuesInputIterator2 [inferred] random-access iterator type of the values of the
+///   second input range.
+/// \tparam ValuesOutputIterator [inferred] random-access iterator type of the output values.
+///
+/// \param [in] values_input1 iterator to the first value of the first range.
+/// \param [in] values_input2 iterator to the first value of the second range.
+/// \param [out] values_output iterator to the output values.
+///
+/// \see set_symmetric_difference
+template<class Config = default_config,
+         class KeysInputIterator1,
+         class KeysInputIterator2,
+         class ValuesInputIterator1,
+         class ValuesInputIterator2,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OutputCountIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysInputIterator1>::value_type>>
+inline hipError_t
+    set_symmetric_difference_by_key(void*                temporary_storage,
+                                    size_t&              storage_size,
+                                    KeysInputIterator1   keys_input1,
+                                    KeysInputIterator2   keys_input2,
+                                    ValuesInputIterator1 values_input1,
+                                    ValuesInputIterator2 values_input2,
+                                    KeysOutputIterator   keys_output,
+                                    ValuesOutputIterator values_output,
+                                    OutputCountIterator  count_output,
+                                    const size_t         input1_size,
+                                    const size_t         input2_size,
+                                    BinaryFunction       compare_function  = BinaryFunction(),
+                                    const hipStream_t    stream            = 0,
+                                    const bool           debug_synchronous = false)
+{
+    return detail::set_operation_impl<detail::set_operation::set_symmetric_difference, Config>(
+        temporary_storage,
+        storage_size,
+        keys_input1,
+        keys_input2,
+        values_input1,
+        values_input2,
+        keys_output,
+        values_output,
+        count_output,
+        input1_size,
+        input2_size,
+        compare_function,
+        stream,
+        debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_SET_OPERATIONS_HPP_
@@ -0,0 +1,296 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_SORTED_INSERT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_SORTED_INSERT_HPP_
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_sorted_insert.hpp"
+#include "detail/ordered_block_id.hpp"
+#include "device_binary_search.hpp"
+#include "device_merge_sort.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class KeysIterator, class BatchIterator, class BinaryFunction>
+inline hipError_t sorted_insert_impl(void*             temporary_storage,
+                                     size_t&           storage_size,
+                                     KeysIterator      keys,
+                                     const size_t      size,
+                                     BatchIterator     batch_input,
+                                     const size_t      batch_size,
+                                     BinaryFunction    compare_function,
+                                     const hipStream_t stream,
+                                     const bool        debug_synchronous)
+{
+    using key_type             = typename std::iterator_traits<KeysIterator>::value_type;
+    using ordered_tile_id_type = ordered_block_id<unsigned int>;
+
+    const size_t num_tiles = ceiling_div(size, sorted_insert_items_per_tile);
+
+    key_type*                      sorted_batch    = nullptr;
+    size_t*                        positions       = nullptr;
+    unsigned int*                  loaded_flags    = nullptr;
+    ordered_tile_id_type::id_type* ordered_tile_id = nullptr;
+    void*                          nested_storage  = nullptr;
+
+    empty_type* values            = nullptr;
+    size_t      sort_storage_size = 0;
+    ROCPRIM_RETURN_ON_ERROR(merge_sort_impl<default_config>(nullptr,
+                                                            sort_storage_size,
+                                                            batch_input,
+                                                            sorted_batch,
+                                                            values,
+                                                            values,
+                                                            batch_size,
+                                                            compare_function,
+                                                            stream,
+                                                            false));
+    size_t search_storage_size = 0;
+    ROCPRIM_RETURN_ON_ERROR(upper_bound_sorted_needles(nullptr,
+                                                       search_storage_size,
+                                                       keys,
+                                                       sorted_batch,
+                                                       positions,
+                                                       size,
+                                                       batch_size,
+                                                       compare_function,
+                                                       stream,
+                                                       false));
+
+    const hipError_t partition_result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::ptr_aligned_array(&sorted_batch, batch_size),
+            temp_storage::ptr_aligned_array(&positions, batch_size),
+            temp_storage::ptr_aligned_array(&loaded_flags, num_tiles),
+            temp_storage::make_partition(&ordered_tile_id,
+                                         ordered_tile_id_type::get_temp_storage_layout()),
+            temp_storage::make_partition(&nested_storage,
+                                         std::max(sort_storage_size, search_storage_size))));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(batch_size == 0)
+    {
+        return hipSuccess;
+    }
+
+    if(debug_synchronous)
+    {
+        std::cout << "size: " << size << '\n';
+        std::cout << "batch_size: " << batch_size << '\n';
+        std::cout << "num_tiles: " << num_tiles << '\n';
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(merge_sort_impl<default_config>(nested_storage,
+                                                            sort_storage_size,
+                                                            batch_input,
+                                                            sorted_batch,
+                                                            values,
+                                                            values,
+                                                            batch_size,
+                                                            compare_function,
+                                                            stream,
+                                                            debug_synchronous));
+    ROCPRIM_RETURN_ON_ERROR(upper_bound_sorted_needles(nested_storage,
+                                                       search_storage_size,
+                                                       keys,
+                                                       sorted_batch,
+                                                       positions,
+                                                       size,
+                                                       batch_size,
+                                                       compare_function,
+                                                       stream,
+                                                       debug_synchronous));
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    if(num_tiles > 0)
+    {
+        ROCPRIM_RETURN_ON_ERROR(
+            hipMemsetAsync(loaded_flags, 0, sizeof(*loaded_flags) * num_tiles, stream));
+        ROCPRIM_RETURN_ON_ERROR(
+            hipMemsetAsync(ordered_tile_id, 0, sizeof(*ordered_tile_id), stream));
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        sorted_insert_shift_kernel<<<num_tiles, sorted_insert_block_size, 0, stream>>>(
+            keys,
+            size,
+            positions,
+            batch_size,
+            loaded_flags,
+            ordered_tile_id_type::create(ordered_tile_id));
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sorted_insert_shift_kernel", size, start);
+    }
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    sorted_insert_scatter_kernel<<<ceiling_div(batch_size, sorted_insert_block_size),
+                                   sorted_insert_block_size,
+                                   0,
+                                   stream>>>(keys, sorted_batch, positions, batch_size);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("sorted_insert_scatter_kernel",
+                                                batch_size,
+                                                start);
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \brief Inserts a batch of keys into a sorted range in place.
+///
+/// \p sorted_insert sorts the batch, finds the insertion point of every batch key in the
+/// sorted range with a merge-path search, and moves the keys of the range that come after an
+/// insertion point back by the number of batch keys inserted before them. The range is then
+/// sorted and holds <tt>size + batch_size</tt> keys.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage in a null pointer.
+/// * \p keys must have room for <tt>size + batch_size</tt> keys, its first \p size keys must
+/// be sorted with \p compare_function.
+/// * Only the keys after the first insertion point are moved, each one once and in whole
+/// tiles, so no second buffer of the range is needed. The temporary storage grows with
+/// \p batch_size only.
+/// * Batch keys are inserted after the equivalent keys of the range and keep their relative
+/// order.
+/// * The contents of \p batch_input are not altered.
+///
+/// \tparam KeysIterator - random-access iterator type of the sorted range. Must meet the
+/// requirements of a C++ InputIterator and OutputIterator concepts. It can be a simple
+/// pointer type.
+/// \tparam BatchIterator - random-access iterator type of the batch. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam BinaryFunction - type of binary function used for comparison. Default type
+/// is \p rocprim::less<T>, where \p T is a \p value_type of \p KeysIterator.
+///
+/// \param [in] temporary_storage - pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and function returns without performing the insertion.
+/// \param [in,out] storage_size - reference to a size (in bytes) of \p temporary_storage.
+/// \param [in,out] keys - iterator to the first key of the sorted range.
+/// \param [in] size - number of sorted keys in \p keys.
+/// \param [in] batch_input - iterator to the first key to insert.
+/// \param [in] batch_size - number of keys to insert.
+/// \param [in] compare_function - binary operation function object that will be used for
+/// comparison. The signature of the function should be equivalent to the following:
+/// <tt>bool f(const T &a, const T &b);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the objects passed to it.
+/// The default value is \p BinaryFunction().
+/// \param [in] stream - [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful insertion; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example a batch of keys is inserted into a sorted array.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input (declare pointers, allocate device memory etc.)
+/// size_t size;        // e.g., 6
+/// size_t batch_size;  // e.g., 3
+/// int *  keys;        // e.g., [1, 3, 5, 7, 9, 11, -, -, -]
+/// int *  batch;       // e.g., [8, 0, 5]
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::sorted_insert(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys, size, batch, batch_size
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the insertion
+/// rocprim::sorted_insert(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys, size, batch, batch_size
+/// );
+/// // keys: [0, 1, 3, 5, 5, 7, 8, 9, 11]
+/// \endcode
+/// \endparblock
+template<class KeysIterator,
+         class BatchIterator,
+         class BinaryFunction
+         = ::rocprim::less<typename std::iterator_traits<KeysIterator>::value_type>>
+inline hipError_t sorted_insert(void*             temporary_storage,
+                                size_t&           storage_size,
+                                KeysIterator      keys,
+                                const size_t      size,
+                                BatchIterator     batch_input,
+                                const size_t      batch_size,
+                                BinaryFunction    compare_function  = BinaryFunction(),
+                                const hipStream_t stream            = 0,
+                                const bool        debug_synchronous = false)
+{
+    return detail::sorted_insert_impl(temporary_storage,
+                                      storage_size,
+                                      keys,
+                                      size,
+                                      batch_input,
+                                      batch_size,
+                                      compare_function,
+                                      stream,
+                                      debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_SORTED_INSERT_HPP_
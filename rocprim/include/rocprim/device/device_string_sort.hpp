@@ -0,0 +1,599 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_STRING_SORT_HPP_
+#define ROCPRIM_DEVICE_DEVICE_STRING_SORT_HPP_
+
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/zip_iterator.hpp"
+#include "../types.hpp"
+#include "../types/tuple.hpp"
+
+#include "config_types.hpp"
+#include "detail/device_string_sort.hpp"
+#include "device_radix_sort.hpp"
+#include "device_segmented_radix_sort.hpp"
+#include "device_select.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The first round sorts all strings at once.
+template<class SegmentOffsetsIterator>
+hipError_t string_sort_first_round(std::false_type /*segmented*/,
+                                   void*                  storage,
+                                   size_t&                storage_size,
+                                   const uint64_t*        keys,
+                                   uint64_t*              sorted_keys,
+                                   const unsigned int*    strings,
+                                   unsigned int*          permutation,
+                                   unsigned char*         heads,
+                                   const unsigned int     size,
+                                   const unsigned int     /*segments*/,
+                                   SegmentOffsetsIterator /*segment_offsets*/,
+                                   const hipStream_t      stream,
+                                   const bool             debug_synchronous)
+{
+    bool ignored;
+    ROCPRIM_RETURN_ON_ERROR(radix_sort_impl<default_config, false>(storage,
+                                                                   storage_size,
+                                                                   keys,
+                                                                   nullptr,
+                                                                   sorted_keys,
+                                                                   strings,
+                                                                   nullptr,
+                                                                   permutation,
+                                                                   size,
+                                                                   ignored,
+                                                                   identity_decomposer{},
+                                                                   0,
+                                                                   8 * sizeof(uint64_t),
+                                                                   stream,
+                                                                   debug_synchronous));
+    if(storage == nullptr)
+    {
+        return hipSuccess;
+    }
+    ROCPRIM_RETURN_ON_ERROR(hipMemsetAsync(heads, 0, size, stream));
+    return hipMemsetAsync(heads, 1, 1, stream);
+}
+
+// The first round of the segmented sort sorts every segment on its own.
+template<class SegmentOffsetsIterator>
+hipError_t string_sort_first_round(std::true_type /*segmented*/,
+                                   void*                  storage,
+                                   size_t&                storage_size,
+                                   const uint64_t*        keys,
+                                   uint64_t*              sorted_keys,
+                                   const unsigned int*    strings,
+                                   unsigned int*          permutation,
+                                   unsigned char*         heads,
+                                   const unsigned int     size,
+                                   const unsigned int     segments,
+                                   SegmentOffsetsIterator segment_offsets,
+                                   const hipStream_t      stream,
+                                   const bool             debug_synchronous)
+{
+    ROCPRIM_RETURN_ON_ERROR(segmented_radix_sort_pairs(storage,
+                                                       storage_size,
+                                                       keys,
+                                                       sorted_keys,
+                                                       strings,
+                                                       permutation,
+                                                       size,
+                                                       segments,
+                                                       segment_offsets,
+                                                       segment_offsets + 1,
+                                                       0,
+                                                       8 * sizeof(uint64_t),
+                                                       stream,
+                                                       debug_synchronous));
+    if(storage == nullptr)
+    {
+        return hipSuccess;
+    }
+    ROCPRIM_RETURN_ON_ERROR(hipMemsetAsync(heads, 0, size, stream));
+    if(segments == 0)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    string_sort_heads_kernel<<<ceiling_div(segments, string_sort_block_size),
+                               string_sort_block_size,
+                               0,
+                               stream>>>(segment_offsets, heads, segments);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("string_sort_heads_kernel", segments, start);
+    return hipSuccess;
+}
+
+template<bool Segmented, class CharsIterator, class OffsetsIterator, class SegmentOffsetsIterator>
+hipError_t string_sort_impl(void* const            temporary_storage,
+                            size_t&                storage_size,
+                            CharsIterator          chars,
+                            OffsetsIterator        string_offsets,
+                            unsigned int* const    permutation,
+                            const size_t           size,
+                            const unsigned int     segments,
+                            SegmentOffsetsIterator segment_offsets,
+                            const hipStream_t      stream,
+                            const bool             debug_synchronous)
+{
+    // The strings are tracked by 32-bit indices.
+    if(size > std::numeric_limits<unsigned int>::max())
+    {
+        return hipErrorInvalidValue;
+    }
+
+    using segmented = std::integral_constant<bool, Segmented>;
+
+    const unsigned int                    count = static_cast<unsigned int>(size);
+    const counting_iterator<unsigned int> indices(0);
+
+    uint64_t*      keys           = nullptr;
+    uint64_t*      sorted_keys    = nullptr;
+    unsigned int*  strings        = nullptr;
+    unsigned int*  sorted_strings = nullptr;
+    unsigned int*  positions      = nullptr;
+    unsigned int*  next_positions = nullptr;
+    unsigned int*  range_offsets  = nullptr;
+    unsigned char* heads          = nullptr;
+    unsigned char* next_heads     = nullptr;
+    unsigned char* run_starts     = nullptr;
+    unsigned char* tied           = nullptr;
+    unsigned int*  counts         = nullptr;
+
+    // The selection of the tied strings carries their positions and whether they start a range.
+    const auto first_tied_input = make_zip_iterator(::rocprim::make_tuple(indices, run_starts));
+    const auto tied_input       = make_zip_iterator(::rocprim::make_tuple(positions, run_starts));
+    const auto tied_output
+        = make_zip_iterator(::rocprim::make_tuple(next_positions, next_heads));
+
+    // The nested storage is shared by all steps, so it holds the largest of them.
+    size_t first_bytes;
+    size_t refine_bytes;
+    size_t first_tied_bytes;
+    size_t tied_bytes;
+    size_t ranges_bytes;
+    ROCPRIM_RETURN_ON_ERROR(string_sort_first_round(segmented{},
+                                                    nullptr,
+                                                    first_bytes,
+                                                    keys,
+                                                    sorted_keys,
+                                                    strings,
+                                                    permutation,
+                                                    heads,
+                                                    count,
+                                                    segments,
+                                                    segment_offsets,
+                                                    stream,
+                                                    false));
+    ROCPRIM_RETURN_ON_ERROR(segmented_radix_sort_pairs(nullptr,
+                                                       refine_bytes,
+                                                       keys,
+                                                       sorted_keys,
+                                                       strings,
+                                                       sorted_strings,
+                                                       count,
+                                                       count,
+                                                       range_offsets,
+                                                       range_offsets + 1,
+                                                       0,
+                                                       8 * sizeof(uint64_t),
+                                                       stream,
+                                                       false));
+    ROCPRIM_RETURN_ON_ERROR(::rocprim::select(nullptr,
+                                              first_tied_bytes,
+                                              first_tied_input,
+                                              tied,
+                                              tied_output,
+                                              counts,
+                                              size,
+                                              stream,
+                                              false));
+    ROCPRIM_RETURN_ON_ERROR(::rocprim::select(nullptr,
+                                              tied_bytes,
+                                              tied_input,
+                                              tied,
+                                              tied_output,
+                                              counts,
+                                              size,
+                                              stream,
+                                              false));
+    ROCPRIM_RETURN_ON_ERROR(::rocprim::select(nullptr,
+                                              ranges_bytes,
+                                              indices,
+                                              heads,
+                                              range_offsets,
+                                              counts + 1,
+                                              size,
+                                              stream,
+                                              false));
+    const size_t nested_size
+        = std::max({first_bytes, refine_bytes, first_tied_bytes, tied_bytes, ranges_bytes});
+
+    void* nested_storage;
+
+    const hipError_t partition_result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::make_partition(&nested_storage, nested_size),
+            temp_storage::ptr_aligned_array(&keys, size),
+            temp_storage::ptr_aligned_array(&sorted_keys, size),
+            temp_storage::ptr_aligned_array(&strings, size),
+            temp_storage::ptr_aligned_array(&sorted_strings, size),
+            temp_storage::ptr_aligned_array(&positions, size),
+            temp_storage::ptr_aligned_array(&next_positions, size),
+            temp_storage::ptr_aligned_array(&range_offsets, size + 1),
+            temp_storage::ptr_aligned_array(&heads, size),
+            temp_storage::ptr_aligned_array(&next_heads, size),
+            temp_storage::ptr_aligned_array(&run_starts, size),
+            temp_storage::ptr_aligned_array(&tied, size),
+            temp_storage::ptr_aligned_array(&counts, 2)));
+
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::steady_clock::time_point start;
+
+    // Sorts the strings of the current ranges by their prefix keys at `depth`, and selects the
+    // ones that are still tied.
+    const auto refine = [&](const unsigned int  refined,
+                            const unsigned int  ranges,
+                            const size_t        depth,
+                            const unsigned int* refined_positions) -> hipError_t
+    {
+        if(debug_synchronous)
+        {
+            std::cout << "depth " << depth << '\n';
+            std::cout << "refined " << refined << '\n';
+            start = std::chrono::steady_clock::now();
+        }
+        string_sort_prefix_kernel<<<ceiling_div(refined, string_sort_block_size),
+                                    string_sort_block_size,
+                                    0,
+                                    stream>>>(chars,
+                                              string_offsets,
+                                              permutation,
+                                              refined_positions,
+                                              keys,
+                                              strings,
+                                              refined,
+                                              depth);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("string_sort_prefix_kernel", refined, start);
+
+        size_t bytes = nested_size;
+        if(refined_positions == nullptr)
+        {
+            ROCPRIM_RETURN_ON_ERROR(string_sort_first_round(segmented{},
+                                                            nested_storage,
+                                                            bytes,
+                                                            keys,
+                                                            sorted_keys,
+                                                            strings,
+                                                            permutation,
+                                                            heads,
+                                                            count,
+                                                            segments,
+                                                            segment_offsets,
+                                                            stream,
+                                                            debug_synchronous));
+        }
+        else
+        {
+            ROCPRIM_RETURN_ON_ERROR(segmented_radix_sort_pairs(nested_storage,
+                                                               bytes,
+                                                               keys,
+                                                               sorted_keys,
+                                                               strings,
+                                                               sorted_strings,
+                                                               refined,
+                                                               ranges,
+                                                               range_offsets,
+                                                               range_offsets + 1,
+                                                               0,
+                                                               8 * sizeof(uint64_t),
+                                                               stream,
+                                                               debug_synchronous));
+        }
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        string_sort_ties_kernel<<<ceiling_div(refined, string_sort_block_size),
+                                  string_sort_block_size,
+                                  0,
+                                  stream>>>(sorted_keys,
+                                            sorted_strings,
+                                            heads,
+                                            refined_positions,
+                                            permutation,
+                                            tied,
+                                            run_starts,
+                                            refined);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("string_sort_ties_kernel", refined, start);
+
+        bytes = nested_size;
+        if(refined_positions == nullptr)
+        {
+            return ::rocprim::select(nested_storage,
+                                     bytes,
+                                     make_zip_iterator(::rocprim::make_tuple(indices, run_starts)),
+                                     tied,
+                                     make_zip_iterator(
+                                         ::rocprim::make_tuple(next_positions, next_heads)),
+                                     counts,
+                                     refined,
+                                     stream,
+                                     debug_synchronous);
+        }
+        return ::rocprim::select(nested_storage,
+                                 bytes,
+                                 make_zip_iterator(::rocprim::make_tuple(positions, run_starts)),
+                                 tied,
+                                 make_zip_iterator(
+                                     ::rocprim::make_tuple(next_positions, next_heads)),
+                                 counts,
+                                 refined,
+                                 stream,
+                                 debug_synchronous);
+    };
+
+    ROCPRIM_RETURN_ON_ERROR(refine(count, segments, 0, nullptr));
+
+    // Every round moves the tied strings 7 bytes deeper, until no strings are tied.
+    for(size_t depth = string_sort_chunk_bytes;; depth += string_sort_chunk_bytes)
+    {
+        unsigned int refined;
+        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(&refined,
+                                               counts,
+                                               sizeof(unsigned int),
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+        ROCPRIM_RETURN_ON_ERROR(hipStreamSynchronize(stream));
+        if(refined == 0)
+        {
+            break;
+        }
+        std::swap(positions, next_positions);
+        std::swap(heads, next_heads);
+
+        // The ranges start at the flagged heads, and the last one ends after the tied strings.
+        size_t bytes = nested_size;
+        ROCPRIM_RETURN_ON_ERROR(::rocprim::select(nested_storage,
+                                                  bytes,
+                                                  indices,
+                                                  heads,
+                                                  range_offsets,
+                                                  counts + 1,
+                                                  refined,
+                                                  stream,
+                                                  debug_synchronous));
+        unsigned int ranges;
+        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(&ranges,
+                                               counts + 1,
+                                               sizeof(unsigned int),
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+        ROCPRIM_RETURN_ON_ERROR(hipStreamSynchronize(stream));
+        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(range_offsets + ranges,
+                                               counts,
+                                               sizeof(unsigned int),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+
+        ROCPRIM_RETURN_ON_ERROR(refine(refined, ranges, depth, positions));
+    }
+
+    return hipSuccess;
+}
+
+} // end namespace detail
+
+/// \brief Parallel sort of variable-length strings.
+///
+/// \par Overview
+/// * Sorts \p size strings in lexicographical order of their bytes, compared as unsigned
+///   characters. String \p i is made of the characters
+///   <tt>[chars + string_offsets[i], chars + string_offsets[i + 1])</tt>, and a string that is the
+///   prefix of another one orders before it.
+/// * The result is a permutation: \p permutation is set to the indices of the strings in sorted
+///   order. The characters do not move.
+/// * The strings are first sorted by their first bytes, packed into 64-bit keys, with a radix
+///   sort. The runs of strings with equal keys are then refined by the next bytes, with
+///   segmented radix sorts that only touch the tied strings, until no ties are left. Every
+///   round synchronizes \p stream to find the tied strings.
+/// * The sort is \b stable: equal strings keep their relative ordering.
+/// * When \p temporary_storage is a null pointer, the required allocation size (in bytes) is
+///   written to \p storage_size and the function returns without performing the sort.
+///
+/// \tparam CharsIterator random-access iterator type of the characters. Its value type must be
+/// convertible to <tt>unsigned char</tt>.
+/// \tparam OffsetsIterator random-access iterator type of the string offsets. Its value type
+/// must be an integral type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and the function returns without performing the sort.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] chars iterator to the characters of all strings.
+/// \param [in] string_offsets iterator to the <tt>size + 1</tt> offsets of the strings in
+/// \p chars.
+/// \param [out] permutation pointer to the \p size indices of the sorted strings.
+/// \param [in] size number of strings. Must not exceed the range of <tt>unsigned int</tt>,
+/// otherwise <tt>hipErrorInvalidValue</tt> is returned.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t        size;           // e.g., 4
+/// char*         chars;          // e.g., "pearpeachpeapeach"
+/// size_t*       string_offsets; // e.g., [0, 4, 9, 12, 17]
+/// unsigned int* permutation;    // empty array of 4 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void*  temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::string_sort(temporary_storage_ptr,
+///                      temporary_storage_size_bytes,
+///                      chars,
+///                      string_offsets,
+///                      permutation,
+///                      size);
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform sort
+/// rocprim::string_sort(temporary_storage_ptr,
+///                      temporary_storage_size_bytes,
+///                      chars,
+///                      string_offsets,
+///                      permutation,
+///                      size);
+/// // permutation: [2, 1, 3, 0]
+/// \endcode
+/// \endparblock
+template<class CharsIterator, class OffsetsIterator>
+hipError_t string_sort(void*           temporary_storage,
+                       size_t&         storage_size,
+                       CharsIterator   chars,
+                       OffsetsIterator string_offsets,
+                       unsigned int*   permutation,
+                       size_t          size,
+                       hipStream_t     stream            = 0,
+                       bool            debug_synchronous = false)
+{
+    return detail::string_sort_impl<false>(temporary_storage,
+                                           storage_size,
+                                           chars,
+                                           string_offsets,
+                                           permutation,
+                                           size,
+                                           1,
+                                           static_cast<const size_t*>(nullptr),
+                                           stream,
+                                           debug_synchronous);
+}
+
+/// \brief Parallel sort of variable-length strings within segments.
+///
+/// \par Overview
+/// * Same as \p string_sort, but sorts the strings of every segment on their own. Segment
+///   \p s is made of the strings <tt>[segment_offsets[s], segment_offsets[s + 1])</tt>, and
+///   \p permutation holds the indices of its strings in sorted order at those positions.
+/// * The segments must cover all strings in order: <tt>segment_offsets[0]</tt> is \p 0 and
+///   <tt>segment_offsets[segments]</tt> is \p size.
+///
+/// \tparam CharsIterator random-access iterator type of the characters. Its value type must be
+/// convertible to <tt>unsigned char</tt>.
+/// \tparam OffsetsIterator random-access iterator type of the string offsets. Its value type
+/// must be an integral type.
+/// \tparam SegmentOffsetsIterator random-access iterator type of the segment offsets. Its value
+/// type must be an integral type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+/// a null pointer is passed, the required allocation size (in bytes) is written to
+/// \p storage_size and the function returns without performing the sort.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] chars iterator to the characters of all strings.
+/// \param [in] string_offsets iterator to the <tt>size + 1</tt> offsets of the strings in
+/// \p chars.
+/// \param [out] permutation pointer to the \p size indices of the sorted strings.
+/// \param [in] size number of strings. Must not exceed the range of <tt>unsigned int</tt>,
+/// otherwise <tt>hipErrorInvalidValue</tt> is returned.
+/// \param [in] segments number of segments.
+/// \param [in] segment_offsets iterator to the <tt>segments + 1</tt> offsets of the segments.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful sort; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class CharsIterator, class OffsetsIterator, class SegmentOffsetsIterator>
+hipError_t segmented_string_sort(void*                  temporary_storage,
+                                 size_t&                storage_size,
+                                 CharsIterator          chars,
+                                 OffsetsIterator        string_offsets,
+                                 unsigned int*          permutation,
+                                 size_t                 size,
+                                 unsigned int           segments,
+                                 SegmentOffsetsIterator segment_offsets,
+                                 hipStream_t            stream            = 0,
+                                 bool                   debug_synchronous = false)
+{
+    return detail::string_sort_impl<true>(temporary_storage,
+                                          storage_size,
+                                          chars,
+                                          string_offsets,
+                                          permutation,
+                                          size,
+                                          segments,
+                                          segment_offsets,
+                                          stream,
+                                          debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_STRING_SORT_HPP_
@@ -0,0 +1,1420 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_TOPK_HPP_
+#define ROCPRIM_DEVICE_DEVICE_TOPK_HPP_
+
+#include "detail/device_topk.hpp"
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../detail/various.hpp"
+#include "../functional.hpp"
+#include "../iterator/counting_iterator.hpp"
+#include "../iterator/transform_iterator.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "device_segmented_radix_sort.hpp"
+#include "device_select.hpp"
+#include "device_topk_config.hpp"
+#include "device_transform.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Config,
+         bool Descending,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator>
+inline hipError_t topk_impl(void*                temporary_storage,
+                            size_t&              storage_size,
+                            KeysInputIterator    keys_input,
+                            ValuesInputIterator  values_input,
+                            KeysOutputIterator   keys_output,
+                            ValuesOutputIterator values_output,
+                            const size_t         size,
+                            const size_t         k,
+                            const hipStream_t    stream,
+                            const bool           debug_synchronous)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using config     = wrapped_topk_config<Config, key_type>;
+
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    using helper       = topk_helper<key_type, Descending>;
+    using bit_key_type = typename helper::bit_key_type;
+    using state_type   = topk_state<bit_key_type>;
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const topk_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int items_per_block = block_size * params.kernel_config.items_per_thread;
+    const unsigned int radix_bits      = params.radix_bits;
+    const unsigned int radix_size      = 1u << radix_bits;
+    const unsigned int passes          = helper::passes(radix_bits);
+
+    state_type* state      = nullptr;
+    size_t*     histograms = nullptr;
+    size_t*     counters   = nullptr;
+
+    result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::ptr_aligned_array(&state, 1),
+            temp_storage::ptr_aligned_array(&histograms, passes * radix_size),
+            temp_storage::ptr_aligned_array(&counters, 2)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    if(size == 0 || k == 0)
+    {
+        return hipSuccess;
+    }
+
+    // Every key is selected, there is nothing to narrow down.
+    if(k >= size)
+    {
+        ROCPRIM_RETURN_ON_ERROR(transform(keys_input,
+                                          keys_output,
+                                          size,
+                                          ::rocprim::identity<key_type>(),
+                                          stream,
+                                          debug_synchronous));
+        if ROCPRIM_IF_CONSTEXPR(with_values)
+        {
+            ROCPRIM_RETURN_ON_ERROR(transform(values_input,
+                                              values_output,
+                                              size,
+                                              ::rocprim::identity<value_type>(),
+                                              stream,
+                                              debug_synchronous));
+        }
+        return hipSuccess;
+    }
+
+    const size_t num_blocks = ceiling_div(size, items_per_block);
+
+    if(debug_synchronous)
+    {
+        std::cout << "size: " << size << '\n';
+        std::cout << "k: " << k << '\n';
+        std::cout << "block_size: " << block_size << '\n';
+        std::cout << "num_blocks: " << num_blocks << '\n';
+        std::cout << "radix_bits: " << radix_bits << '\n';
+        std::cout << "passes: " << passes << '\n';
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(
+        hipMemsetAsync(histograms, 0, sizeof(*histograms) * passes * radix_size, stream));
+    ROCPRIM_RETURN_ON_ERROR(hipMemsetAsync(counters, 0, sizeof(*counters) * 2, stream));
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    // Every pass narrows the bucket containing the k-th key down by one digit. The state stays
+    // on the device, so no synchronization with the host is required between the passes.
+    for(unsigned int pass = 0; pass < passes; ++pass)
+    {
+        const unsigned int start_bit          = helper::digit_start(pass, radix_bits);
+        const unsigned int current_radix_bits = helper::digit_width(pass, radix_bits);
+        size_t*            histogram          = histograms + pass * radix_size;
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        topk_histogram_kernel<config, Descending>
+            <<<dim3(num_blocks), dim3(block_size), 0, stream>>>(keys_input,
+                                                                size,
+                                                                state,
+                                                                histogram,
+                                                                pass,
+                                                                start_bit,
+                                                                current_radix_bits);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("topk_histogram_kernel", size, start);
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        topk_select_digit_kernel<config><<<dim3(1), dim3(radix_size), 0, stream>>>(
+            state,
+            histogram,
+            k,
+            pass,
+            helper::digit_mask(start_bit, current_radix_bits),
+            start_bit);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("topk_select_digit_kernel", radix_size, start);
+    }
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    topk_compact_kernel<config, Descending, with_values>
+        <<<dim3(num_blocks), dim3(block_size), 0, stream>>>(keys_input,
+                                                            values_input,
+                                                            keys_output,
+                                                            values_output,
+                                                            size,
+                                                            k,
+                                                            state,
+                                                            counters);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("topk_compact_kernel", size, start);
+
+    return hipSuccess;
+}
+
+template<class Buffer, class Output>
+Buffer segmented_topk_selection_output(std::true_type /*sorted*/, Buffer buffer, Output)
+{
+    return buffer;
+}
+
+template<class Buffer, class Output>
+Output segmented_topk_selection_output(std::false_type /*sorted*/, Buffer, Output output)
+{
+    return output;
+}
+
+// Nothing has to be sorted when the output order is unspecified.
+template<bool Descending, class... Args>
+inline hipError_t segmented_topk_sort(std::false_type /*sorted*/, Args&&...)
+{
+    return hipSuccess;
+}
+
+template<bool Descending, class Key, class KeysOutputIterator, class OffsetIterator>
+inline hipError_t segmented_topk_sort(std::true_type /*sorted*/,
+                                      void*              temporary_storage,
+                                      size_t&            storage_size,
+                                      Key*               keys_input,
+                                      KeysOutputIterator keys_output,
+                                      empty_type*        /*values_input*/,
+                                      empty_type*        /*values_output*/,
+                                      const unsigned int size,
+                                      const unsigned int segments,
+                                      OffsetIterator     begin_offsets,
+                                      OffsetIterator     end_offsets,
+                                      const hipStream_t  stream,
+                                      const bool         debug_synchronous)
+{
+    constexpr unsigned int end_bit = 8 * sizeof(Key);
+    return Descending ? segmented_radix_sort_keys_desc(temporary_storage,
+                                                       storage_size,
+                                                       keys_input,
+                                                       keys_output,
+                                                       size,
+                                                       segments,
+                                                       begin_offsets,
+                                                       end_offsets,
+                                                       0,
+                                                       end_bit,
+                                                       stream,
+                                                       debug_synchronous)
+                      : segmented_radix_sort_keys(temporary_storage,
+                                                  storage_size,
+                                                  keys_input,
+                                                  keys_output,
+                                                  size,
+                                                  segments,
+                                                  begin_offsets,
+                                                  end_offsets,
+                                                  0,
+                                                  end_bit,
+                                                  stream,
+                                                  debug_synchronous);
+}
+
+template<bool Descending,
+         class Key,
+         class KeysOutputIterator,
+         class Value,
+         class ValuesOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_topk_sort(std::true_type /*sorted*/,
+                                      void*                temporary_storage,
+                                      size_t&              storage_size,
+                                      Key*                 keys_input,
+                                      KeysOutputIterator   keys_output,
+                                      Value*               values_input,
+                                      ValuesOutputIterator values_output,
+                                      const unsigned int   size,
+                                      const unsigned int   segments,
+                                      OffsetIterator       begin_offsets,
+                                      OffsetIterator       end_offsets,
+                                      const hipStream_t    stream,
+                                      const bool           debug_synchronous)
+{
+    constexpr unsigned int end_bit = 8 * sizeof(Key);
+    return Descending ? segmented_radix_sort_pairs_desc(temporary_storage,
+                                                        storage_size,
+                                                        keys_input,
+                                                        keys_output,
+                                                        values_input,
+                                                        values_output,
+                                                        size,
+                                                        segments,
+                                                        begin_offsets,
+                                                        end_offsets,
+                                                        0,
+                                                        end_bit,
+                                                        stream,
+                                                        debug_synchronous)
+                      : segmented_radix_sort_pairs(temporary_storage,
+                                                   storage_size,
+                                                   keys_input,
+                                                   keys_output,
+                                                   values_input,
+                                                   values_output,
+                                                   size,
+                                                   segments,
+                                                   begin_offsets,
+                                                   end_offsets,
+                                                   0,
+                                                   end_bit,
+                                                   stream,
+                                                   debug_synchronous);
+}
+
+// Selects the k keys of every segment. Small segments are selected by the logical warps of
+// segmented_topk_warp_kernel, medium ones by a block each. The large segments are first gathered
+// by a selection, whose count is copied to the host, and then processed in batches by several
+// blocks each.
+// When Sorted is set, the selected keys are written to a temporary buffer and sorted into the
+// output by segmented radix sort. When Partition is set, every segment is reordered in place of
+// its input range like std::nth_element, with the k-th key at position k - 1.
+template<class Config,
+         bool Descending,
+         bool Sorted,
+         bool Partition,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_topk_impl(void*                temporary_storage,
+                                      size_t&              storage_size,
+                                      KeysInputIterator    keys_input,
+                                      ValuesInputIterator  values_input,
+                                      KeysOutputIterator   keys_output,
+                                      ValuesOutputIterator values_output,
+                                      const unsigned int   segments,
+                                      OffsetIterator       begin_offsets,
+                                      OffsetIterator       end_offsets,
+                                      const unsigned int   k,
+                                      const hipStream_t    stream,
+                                      const bool           debug_synchronous)
+{
+    static_assert(!(Sorted && Partition), "Partitioned segments cannot be sorted");
+
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+    using config     = wrapped_topk_config<Config, key_type>;
+
+    constexpr bool with_values = !std::is_same<value_type, ::rocprim::empty_type>::value;
+
+    using helper                 = topk_helper<key_type, Descending>;
+    using bit_key_type           = typename helper::bit_key_type;
+    using state_type             = topk_state<bit_key_type>;
+    using segment_index_iterator = counting_iterator<unsigned int>;
+    using large_segment_op       = segmented_topk_large_segment_op<config, OffsetIterator>;
+    using output_range_op        = segmented_topk_output_range_op<OffsetIterator>;
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const topk_config_params   params = dispatch_target_arch<config>(target_arch);
+    const segmented_topk_sizes sizes  = get_segmented_topk_sizes(params);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const unsigned int radix_bits      = params.radix_bits;
+    const unsigned int radix_size      = 1u << radix_bits;
+    const unsigned int passes          = helper::passes(radix_bits);
+    const unsigned int warps_per_block = block_size / sizes.warp_size;
+    const unsigned int batch_size = ::rocprim::min(segments, sizes.large_segments_per_launch);
+    const size_t       sorted_size = Sorted ? static_cast<size_t>(segments) * k : 0;
+
+    const large_segment_op large_segment_selector{begin_offsets, end_offsets, k};
+    const auto             sort_begin_offsets = make_transform_iterator(
+        segment_index_iterator(0),
+        output_range_op{begin_offsets, end_offsets, k, false});
+    const auto sort_end_offsets
+        = make_transform_iterator(segment_index_iterator(0),
+                                  output_range_op{begin_offsets, end_offsets, k, true});
+
+    const std::integral_constant<bool, Sorted> sorted_tag{};
+
+    unsigned int* large_segment_indices = nullptr;
+    unsigned int* large_segment_count   = nullptr;
+    void*         select_storage        = nullptr;
+    size_t        select_storage_size   = 0;
+    state_type*   states                = nullptr;
+    size_t*       histograms            = nullptr;
+    size_t*       counters              = nullptr;
+    key_type*     keys_buffer           = nullptr;
+    value_type*   values_buffer         = nullptr;
+    void*         sort_storage          = nullptr;
+    size_t        sort_storage_size     = 0;
+
+    ROCPRIM_RETURN_ON_ERROR(select(nullptr,
+                                   select_storage_size,
+                                   segment_index_iterator(0),
+                                   large_segment_indices,
+                                   large_segment_count,
+                                   segments,
+                                   large_segment_selector,
+                                   stream,
+                                   debug_synchronous));
+    ROCPRIM_RETURN_ON_ERROR(segmented_topk_sort<Descending>(sorted_tag,
+                                                            nullptr,
+                                                            sort_storage_size,
+                                                            keys_buffer,
+                                                            keys_output,
+                                                            values_buffer,
+                                                            values_output,
+                                                            static_cast<unsigned int>(sorted_size),
+                                                            segments,
+                                                            sort_begin_offsets,
+                                                            sort_end_offsets,
+                                                            stream,
+                                                            debug_synchronous));
+
+    result = temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        temp_storage::make_linear_partition(
+            temp_storage::ptr_aligned_array(&large_segment_indices, segments),
+            temp_storage::ptr_aligned_array(&large_segment_count, 1),
+            temp_storage::make_partition(&select_storage, select_storage_size),
+            temp_storage::ptr_aligned_array(&states, batch_size),
+            temp_storage::ptr_aligned_array(&histograms, batch_size * passes * radix_size),
+            temp_storage::ptr_aligned_array(&counters, batch_size * 3),
+            temp_storage::ptr_aligned_array(&keys_buffer, sorted_size),
+            temp_storage::ptr_aligned_array(&values_buffer, with_values ? sorted_size : 0),
+            temp_storage::make_partition(&sort_storage, sort_storage_size)));
+    if(result != hipSuccess || temporary_storage == nullptr)
+    {
+        return result;
+    }
+
+    if(segments == 0u || k == 0u)
+    {
+        return hipSuccess;
+    }
+
+    const auto selected_keys
+        = segmented_topk_selection_output(sorted_tag, keys_buffer, keys_output);
+    const auto selected_values
+        = segmented_topk_selection_output(sorted_tag, values_buffer, values_output);
+
+    if(debug_synchronous)
+    {
+        std::cout << "segments: " << segments << '\n';
+        std::cout << "k: " << k << '\n';
+        std::cout << "small_segment_size: " << sizes.small_segment_size << '\n';
+        std::cout << "large_segment_size: " << sizes.large_segment_size << '\n';
+    }
+
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    segmented_topk_warp_kernel<config, Descending, with_values, Partition>
+        <<<dim3(ceiling_div(segments, warps_per_block)), dim3(block_size), 0, stream>>>(
+            keys_input,
+            values_input,
+            selected_keys,
+            selected_values,
+            segments,
+            begin_offsets,
+            end_offsets,
+            k);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_topk_warp_kernel", segments, start);
+
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    segmented_topk_kernel<config, Descending, with_values, Partition>
+        <<<dim3(segments), dim3(block_size), 0, stream>>>(keys_input,
+                                                          values_input,
+                                                          selected_keys,
+                                                          selected_values,
+                                                          begin_offsets,
+                                                          end_offsets,
+                                                          k);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_topk_kernel", segments, start);
+
+    ROCPRIM_RETURN_ON_ERROR(select(select_storage,
+                                   select_storage_size,
+                                   segment_index_iterator(0),
+                                   large_segment_indices,
+                                   large_segment_count,
+                                   segments,
+                                   large_segment_selector,
+                                   stream,
+                                   debug_synchronous));
+    unsigned int large_segments;
+    ROCPRIM_RETURN_ON_ERROR(memcpy_and_sync(&large_segments,
+                                            large_segment_count,
+                                            sizeof(large_segments),
+                                            hipMemcpyDeviceToHost,
+                                            stream));
+    if(debug_synchronous)
+    {
+        std::cout << "large_segments: " << large_segments << '\n';
+    }
+
+    for(unsigned int batch_offset = 0; batch_offset < large_segments; batch_offset += batch_size)
+    {
+        const unsigned int  batch   = ::rocprim::min(batch_size, large_segments - batch_offset);
+        const unsigned int* indices = large_segment_indices + batch_offset;
+        const dim3          grid(batch, sizes.blocks_per_large_segment);
+
+        ROCPRIM_RETURN_ON_ERROR(hipMemsetAsync(histograms,
+                                               0,
+                                               sizeof(*histograms) * batch * passes * radix_size,
+                                               stream));
+        ROCPRIM_RETURN_ON_ERROR(
+            hipMemsetAsync(counters, 0, sizeof(*counters) * batch * 3, stream));
+
+        for(unsigned int pass = 0; pass < passes; ++pass)
+        {
+            const unsigned int start_bit          = helper::digit_start(pass, radix_bits);
+            const unsigned int current_radix_bits = helper::digit_width(pass, radix_bits);
+            size_t*            pass_histograms    = histograms + pass * batch * radix_size;
+
+            if(debug_synchronous)
+            {
+                start = std::chrono::steady_clock::now();
+            }
+            segmented_topk_large_histogram_kernel<config, Descending>
+                <<<grid, dim3(block_size), 0, stream>>>(keys_input,
+                                                        indices,
+                                                        begin_offsets,
+                                                        end_offsets,
+                                                        states,
+                                                        pass_histograms,
+                                                        pass,
+                                                        start_bit,
+                                                        current_radix_bits);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_topk_large_histogram_kernel",
+                                                        batch,
+                                                        start);
+
+            if(debug_synchronous)
+            {
+                start = std::chrono::steady_clock::now();
+            }
+            segmented_topk_large_select_digit_kernel<config, Partition>
+                <<<dim3(batch), dim3(radix_size), 0, stream>>>(
+                    states,
+                    pass_histograms,
+                    k,
+                    pass,
+                    helper::digit_mask(start_bit, current_radix_bits),
+                    start_bit);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR(
+                "segmented_topk_large_select_digit_kernel",
+                batch,
+                start);
+        }
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        segmented_topk_large_compact_kernel<config, Descending, with_values, Partition>
+            <<<grid, dim3(block_size), 0, stream>>>(keys_input,
+                                                    values_input,
+                                                    selected_keys,
+                                                    selected_values,
+                                                    indices,
+                                                    begin_offsets,
+                                                    end_offsets,
+                                                    k,
+                                                    states,
+                                                    counters);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_topk_large_compact_kernel",
+                                                    batch,
+                                                    start);
+    }
+
+    ROCPRIM_RETURN_ON_ERROR(segmented_topk_sort<Descending>(sorted_tag,
+                                                            sort_storage,
+                                                            sort_storage_size,
+                                                            keys_buffer,
+                                                            keys_output,
+                                                            values_buffer,
+                                                            values_output,
+                                                            static_cast<unsigned int>(sorted_size),
+                                                            segments,
+                                                            sort_begin_offsets,
+                                                            sort_end_offsets,
+                                                            stream,
+                                                            debug_synchronous));
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \addtogroup devicemodule
+/// @{
+
+/// \brief Selects the \p k largest keys of the input range.
+///
+/// The keys are selected by a radix selection: every pass histograms one digit of the keys that
+/// are still candidates and narrows down the digit of the k-th largest key, until only the keys
+/// belonging to the result are left. Only those keys are then written to the output. The state of
+/// the selection is kept on the device, so the function does not synchronize with the host.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The contents of the input are not altered by the function.
+/// * Exactly <tt>min(k, size)</tt> keys are written to \p keys_output.
+/// * The selected keys are written in an <b>unspecified order</b>. Use a sort on the \p k
+///   selected keys if they are needed in order.
+/// * If several keys are equal to the k-th largest key, which of them are selected is unspecified.
+/// * Only arithmetic types and \p rocprim::half and \p rocprim::bfloat16 are supported as keys.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p topk_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [out] keys_output iterator to the output range. Must be able to hold \p k keys.
+/// \param [in] size number of elements in the input range.
+/// \param [in] k number of keys to select.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+///   type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// In this example the 3 largest keys of an array of integers are selected.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t input_size;  // e.g., 8
+/// size_t k;           // e.g., 3
+/// int *  keys_input;  // e.g., [ 6, 3, 5, 4, 1, 8, 2, 7 ]
+/// int *  keys_output; // empty array of 3 elements
+///
+/// size_t temporary_storage_size_bytes;
+/// void * temporary_storage_ptr = nullptr;
+/// // Get required size of the temporary storage
+/// rocprim::topk_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, input_size, k
+/// );
+///
+/// // allocate temporary storage
+/// hipMalloc(&temporary_storage_ptr, temporary_storage_size_bytes);
+///
+/// // perform the selection
+/// rocprim::topk_keys(
+///     temporary_storage_ptr, temporary_storage_size_bytes,
+///     keys_input, keys_output, input_size, k
+/// );
+/// // possible keys_output: [ 8, 6, 7 ]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class KeysInputIterator, class KeysOutputIterator>
+inline hipError_t topk_keys(void*              temporary_storage,
+                            size_t&            storage_size,
+                            KeysInputIterator  keys_input,
+                            KeysOutputIterator keys_output,
+                            size_t             size,
+                            size_t             k,
+                            hipStream_t        stream            = 0,
+                            bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::topk_impl<Config, true>(temporary_storage,
+                                           storage_size,
+                                           keys_input,
+                                           values,
+                                           keys_output,
+                                           values,
+                                           size,
+                                           k,
+                                           stream,
+                                           debug_synchronous);
+}
+
+/// \brief Selects the \p k smallest keys of the input range.
+///
+/// Same as \p topk_keys, except that the \p k smallest keys are selected.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p topk_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [out] keys_output iterator to the output range. Must be able to hold \p k keys.
+/// \param [in] size number of elements in the input range.
+/// \param [in] k number of keys to select.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config, class KeysInputIterator, class KeysOutputIterator>
+inline hipError_t topk_keys_min(void*              temporary_storage,
+                                size_t&            storage_size,
+                                KeysInputIterator  keys_input,
+                                KeysOutputIterator keys_output,
+                                size_t             size,
+                                size_t             k,
+                                hipStream_t        stream            = 0,
+                                bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::topk_impl<Config, false>(temporary_storage,
+                                            storage_size,
+                                            keys_input,
+                                            values,
+                                            keys_output,
+                                            values,
+                                            size,
+                                            k,
+                                            stream,
+                                            debug_synchronous);
+}
+
+/// \brief Selects the \p k key-value pairs with the largest keys of the input range.
+///
+/// Works like \p topk_keys, and additionally writes the value of every selected key to the same
+/// position of \p values_output. Values are only read for the selected keys.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p topk_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator [inferred] random-access iterator type of the values input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator [inferred] random-access iterator type of the values output
+///   range. Must meet the requirements of a C++ OutputIterator concept. It can be a simple
+///   pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [in] values_input iterator to the values input range.
+/// \param [out] keys_output iterator to the output range. Must be able to hold \p k keys.
+/// \param [out] values_output iterator to the values output range. Must be able to hold \p k
+///   values.
+/// \param [in] size number of elements in the input range.
+/// \param [in] k number of pairs to select.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator>
+inline hipError_t topk_pairs(void*                temporary_storage,
+                             size_t&              storage_size,
+                             KeysInputIterator    keys_input,
+                             ValuesInputIterator  values_input,
+                             KeysOutputIterator   keys_output,
+                             ValuesOutputIterator values_output,
+                             size_t               size,
+                             size_t               k,
+                             hipStream_t          stream            = 0,
+                             bool                 debug_synchronous = false)
+{
+    return detail::topk_impl<Config, true>(temporary_storage,
+                                           storage_size,
+                                           keys_input,
+                                           values_input,
+                                           keys_output,
+                                           values_output,
+                                           size,
+                                           k,
+                                           stream,
+                                           debug_synchronous);
+}
+
+/// \brief Selects the \p k key-value pairs with the smallest keys of the input range.
+///
+/// Same as \p topk_pairs, except that the pairs with the \p k smallest keys are selected.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p topk_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator [inferred] random-access iterator type of the values input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator [inferred] random-access iterator type of the values output
+///   range. Must meet the requirements of a C++ OutputIterator concept. It can be a simple
+///   pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [in] values_input iterator to the values input range.
+/// \param [out] keys_output iterator to the output range. Must be able to hold \p k keys.
+/// \param [out] values_output iterator to the values output range. Must be able to hold \p k
+///   values.
+/// \param [in] size number of elements in the input range.
+/// \param [in] k number of pairs to select.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator>
+inline hipError_t topk_pairs_min(void*                temporary_storage,
+                                 size_t&              storage_size,
+                                 KeysInputIterator    keys_input,
+                                 ValuesInputIterator  values_input,
+                                 KeysOutputIterator   keys_output,
+                                 ValuesOutputIterator values_output,
+                                 size_t               size,
+                                 size_t               k,
+                                 hipStream_t          stream            = 0,
+                                 bool                 debug_synchronous = false)
+{
+    return detail::topk_impl<Config, false>(temporary_storage,
+                                            storage_size,
+                                            keys_input,
+                                            values_input,
+                                            keys_output,
+                                            values_output,
+                                            size,
+                                            k,
+                                            stream,
+                                            debug_synchronous);
+}
+
+/// \brief Selects the \p k largest keys of every segment.
+///
+/// The path of every segment is chosen by its size: small segments are sorted by a logical warp,
+/// medium segments are selected by a single block which performs the whole radix selection in
+/// shared memory, and large segments are selected by several blocks each. All segments are
+/// selected by the same few launches, so the function is intended for batches of many
+/// selections, like one selection per query of a batch.
+///
+/// \par Overview
+/// * Returns the required size of \p temporary_storage in \p storage_size
+/// if \p temporary_storage is a null pointer.
+/// * The number of large segments is copied to the host, so the function synchronizes with
+///   \p stream once.
+/// * The keys selected from segment \p i are written to
+///   <tt>[keys_output + i * k, keys_output + i * k + min(k, segment_size))</tt> in an unspecified
+///   order. Output positions of segments smaller than \p k after their keys are not written.
+/// * Ranges specified by \p begin_offsets and \p end_offsets must have
+/// at least \p segments elements.
+/// * Segments must hold less than <tt>2^32</tt> keys each.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p topk_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator [inferred] random-access iterator type of segment offsets. Must meet the
+///   requirements of a C++ InputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [out] keys_output iterator to the output range. Must be able to hold
+///   <tt>segments * k</tt> keys.
+/// \param [in] segments number of segments in the input range.
+/// \param [in] begin_offsets iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets iterator to the first element in the range of ending offsets.
+/// \param [in] k number of keys to select from every segment.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_topk_keys(void*              temporary_storage,
+                                      size_t&            storage_size,
+                                      KeysInputIterator  keys_input,
+                                      KeysOutputIterator keys_output,
+                                      unsigned int       segments,
+                                      OffsetIterator     begin_offsets,
+                                      OffsetIterator     end_offsets,
+                                      unsigned int       k,
+                                      hipStream_t        stream            = 0,
+                                      bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::segmented_topk_impl<Config, true, false, false>(temporary_storage,
+                                                                   storage_size,
+                                                                   keys_input,
+                                                                   values,
+                                                                   keys_output,
+                                                                   values,
+                                                                   segments,
+                                                                   begin_offsets,
+                                                                   end_offsets,
+                                                                   k,
+                                                                   stream,
+                                                                   debug_synchronous);
+}
+
+/// \brief Selects the \p k smallest keys of every segment.
+///
+/// Same as \p segmented_topk_keys, except that the \p k smallest keys of every segment are
+/// selected.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p topk_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator [inferred] random-access iterator type of segment offsets. Must meet the
+///   requirements of a C++ InputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [out] keys_output iterator to the output range. Must be able to hold
+///   <tt>segments * k</tt> keys.
+/// \param [in] segments number of segments in the input range.
+/// \param [in] begin_offsets iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets iterator to the first element in the range of ending offsets.
+/// \param [in] k number of keys to select from every segment.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_topk_keys_min(void*              temporary_storage,
+                                          size_t&            storage_size,
+                                          KeysInputIterator  keys_input,
+                                          KeysOutputIterator keys_output,
+                                          unsigned int       segments,
+                                          OffsetIterator     begin_offsets,
+                                          OffsetIterator     end_offsets,
+                                          unsigned int       k,
+                                          hipStream_t        stream            = 0,
+                                          bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::segmented_topk_impl<Config, false, false, false>(temporary_storage,
+                                                                    storage_size,
+                                                                    keys_input,
+                                                                    values,
+                                                                    keys_output,
+                                                                    values,
+                                                                    segments,
+                                                                    begin_offsets,
+                                                                    end_offsets,
+                                                                    k,
+                                                                    stream,
+                                                                    debug_synchronous);
+}
+
+/// \brief Selects the \p k key-value pairs with the largest keys of every segment.
+///
+/// Works like \p segmented_topk_keys, and additionally writes the value of every selected key to
+/// the same position of \p values_output.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p topk_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator [inferred] random-access iterator type of the values input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator [inferred] random-access iterator type of the values output
+///   range. Must meet the requirements of a C++ OutputIterator concept. It can be a simple
+///   pointer type.
+/// \tparam OffsetIterator [inferred] random-access iterator type of segment offsets. Must meet the
+///   requirements of a C++ InputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [in] values_input iterator to the values input range.
+/// \param [out] keys_output iterator to the output range. Must be able to hold
+///   <tt>segments * k</tt> keys.
+/// \param [out] values_output iterator to the values output range. Must be able to hold
+///   <tt>segments * k</tt> values.
+/// \param [in] segments number of segments in the input range.
+/// \param [in] begin_offsets iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets iterator to the first element in the range of ending offsets.
+/// \param [in] k number of pairs to select from every segment.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_topk_pairs(void*                temporary_storage,
+                                       size_t&              storage_size,
+                                       KeysInputIterator    keys_input,
+                                       ValuesInputIterator  values_input,
+                                       KeysOutputIterator   keys_output,
+                                       ValuesOutputIterator values_output,
+                                       unsigned int         segments,
+                                       OffsetIterator       begin_offsets,
+                                       OffsetIterator       end_offsets,
+                                       unsigned int         k,
+                                       hipStream_t          stream            = 0,
+                                       bool                 debug_synchronous = false)
+{
+    return detail::segmented_topk_impl<Config, true, false, false>(temporary_storage,
+                                                                   storage_size,
+                                                                   keys_input,
+                                                                   values_input,
+                                                                   keys_output,
+                                                                   values_output,
+                                                                   segments,
+                                                                   begin_offsets,
+                                                                   end_offsets,
+                                                                   k,
+                                                                   stream,
+                                                                   debug_synchronous);
+}
+
+/// \brief Selects the \p k key-value pairs with the smallest keys of every segment.
+///
+/// Same as \p segmented_topk_pairs, except that the pairs with the \p k smallest keys of every
+/// segment are selected.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p topk_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator [inferred] random-access iterator type of the values input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator [inferred] random-access iterator type of the values output
+///   range. Must meet the requirements of a C++ OutputIterator concept. It can be a simple
+///   pointer type.
+/// \tparam OffsetIterator [inferred] random-access iterator type of segment offsets. Must meet the
+///   requirements of a C++ InputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [in] values_input iterator to the values input range.
+/// \param [out] keys_output iterator to the output range. Must be able to hold
+///   <tt>segments * k</tt> keys.
+/// \param [out] values_output iterator to the values output range. Must be able to hold
+///   <tt>segments * k</tt> values.
+/// \param [in] segments number of segments in the input range.
+/// \param [in] begin_offsets iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets iterator to the first element in the range of ending offsets.
+/// \param [in] k number of pairs to select from every segment.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_topk_pairs_min(void*                temporary_storage,
+                                           size_t&              storage_size,
+                                           KeysInputIterator    keys_input,
+                                           ValuesInputIterator  values_input,
+                                           KeysOutputIterator   keys_output,
+                                           ValuesOutputIterator values_output,
+                                           unsigned int         segments,
+                                           OffsetIterator       begin_offsets,
+                                           OffsetIterator       end_offsets,
+                                           unsigned int         k,
+                                           hipStream_t          stream            = 0,
+                                           bool                 debug_synchronous = false)
+{
+    return detail::segmented_topk_impl<Config, false, false, false>(temporary_storage,
+                                                                    storage_size,
+                                                                    keys_input,
+                                                                    values_input,
+                                                                    keys_output,
+                                                                    values_output,
+                                                                    segments,
+                                                                    begin_offsets,
+                                                                    end_offsets,
+                                                                    k,
+                                                                    stream,
+                                                                    debug_synchronous);
+}
+
+/// \brief Selects the \p k largest keys of every segment and sorts them.
+///
+/// Same as \p segmented_topk_keys, except that the keys selected from every segment are written
+/// in descending order. The selected keys are sorted by segmented radix sort, so
+/// <tt>segments * k</tt> keys of temporary storage are needed in addition, and
+/// <tt>segments * k</tt> must be less than <tt>2^32</tt>.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p topk_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator [inferred] random-access iterator type of segment offsets. Must meet the
+///   requirements of a C++ InputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [out] keys_output iterator to the output range. Must be able to hold
+///   <tt>segments * k</tt> keys.
+/// \param [in] segments number of segments in the input range.
+/// \param [in] begin_offsets iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets iterator to the first element in the range of ending offsets.
+/// \param [in] k number of keys to select from every segment.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_sorted_topk_keys(void*              temporary_storage,
+                                             size_t&            storage_size,
+                                             KeysInputIterator  keys_input,
+                                             KeysOutputIterator keys_output,
+                                             unsigned int       segments,
+                                             OffsetIterator     begin_offsets,
+                                             OffsetIterator     end_offsets,
+                                             unsigned int       k,
+                                             hipStream_t        stream            = 0,
+                                             bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::segmented_topk_impl<Config, true, true, false>(temporary_storage,
+                                                                  storage_size,
+                                                                  keys_input,
+                                                                  values,
+                                                                  keys_output,
+                                                                  values,
+                                                                  segments,
+                                                                  begin_offsets,
+                                                                  end_offsets,
+                                                                  k,
+                                                                  stream,
+                                                                  debug_synchronous);
+}
+
+/// \brief Selects the \p k smallest keys of every segment and sorts them.
+///
+/// Same as \p segmented_topk_keys_min, except that the keys selected from every segment are
+/// written in ascending order, see \p segmented_sorted_topk_keys.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p topk_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam OffsetIterator [inferred] random-access iterator type of segment offsets. Must meet the
+///   requirements of a C++ InputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [out] keys_output iterator to the output range. Must be able to hold
+///   <tt>segments * k</tt> keys.
+/// \param [in] segments number of segments in the input range.
+/// \param [in] begin_offsets iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets iterator to the first element in the range of ending offsets.
+/// \param [in] k number of keys to select from every segment.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_sorted_topk_keys_min(void*              temporary_storage,
+                                                 size_t&            storage_size,
+                                                 KeysInputIterator  keys_input,
+                                                 KeysOutputIterator keys_output,
+                                                 unsigned int       segments,
+                                                 OffsetIterator     begin_offsets,
+                                                 OffsetIterator     end_offsets,
+                                                 unsigned int       k,
+                                                 hipStream_t        stream            = 0,
+                                                 bool               debug_synchronous = false)
+{
+    empty_type* values = nullptr;
+    return detail::segmented_topk_impl<Config, false, true, false>(temporary_storage,
+                                                                   storage_size,
+                                                                   keys_input,
+                                                                   values,
+                                                                   keys_output,
+                                                                   values,
+                                                                   segments,
+                                                                   begin_offsets,
+                                                                   end_offsets,
+                                                                   k,
+                                                                   stream,
+                                                                   debug_synchronous);
+}
+
+/// \brief Selects the \p k key-value pairs with the largest keys of every segment and sorts
+/// them by key.
+///
+/// Same as \p segmented_topk_pairs, except that the pairs selected from every segment are
+/// written in descending order of their keys, see \p segmented_sorted_topk_keys.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p topk_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator [inferred] random-access iterator type of the values input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator [inferred] random-access iterator type of the values output
+///   range. Must meet the requirements of a C++ OutputIterator concept. It can be a simple
+///   pointer type.
+/// \tparam OffsetIterator [inferred] random-access iterator type of segment offsets. Must meet the
+///   requirements of a C++ InputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [in] values_input iterator to the values input range.
+/// \param [out] keys_output iterator to the output range. Must be able to hold
+///   <tt>segments * k</tt> keys.
+/// \param [out] values_output iterator to the values output range. Must be able to hold
+///   <tt>segments * k</tt> values.
+/// \param [in] segments number of segments in the input range.
+/// \param [in] begin_offsets iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets iterator to the first element in the range of ending offsets.
+/// \param [in] k number of keys to select from every segment.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_sorted_topk_pairs(void*                temporary_storage,
+                                              size_t&              storage_size,
+                                              KeysInputIterator    keys_input,
+                                              ValuesInputIterator  values_input,
+                                              KeysOutputIterator   keys_output,
+                                              ValuesOutputIterator values_output,
+                                              unsigned int         segments,
+                                              OffsetIterator       begin_offsets,
+                                              OffsetIterator       end_offsets,
+                                              unsigned int         k,
+                                              hipStream_t          stream            = 0,
+                                              bool                 debug_synchronous = false)
+{
+    return detail::segmented_topk_impl<Config, true, true, false>(temporary_storage,
+                                                                  storage_size,
+                                                                  keys_input,
+                                                                  values_input,
+                                                                  keys_output,
+                                                                  values_output,
+                                                                  segments,
+                                                                  begin_offsets,
+                                                                  end_offsets,
+                                                                  k,
+                                                                  stream,
+                                                                  debug_synchronous);
+}
+
+/// \brief Selects the \p k key-value pairs with the smallest keys of every segment and sorts
+/// them by key.
+///
+/// Same as \p segmented_topk_pairs_min, except that the pairs selected from every segment are
+/// written in ascending order of their keys, see \p segmented_sorted_topk_keys.
+///
+/// \tparam Config [optional] configuration of the primitive. It has to be \p topk_config.
+/// \tparam KeysInputIterator [inferred] random-access iterator type of the input range. Must meet
+///   the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesInputIterator [inferred] random-access iterator type of the values input range.
+///   Must meet the requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam KeysOutputIterator [inferred] random-access iterator type of the output range. Must
+///   meet the requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam ValuesOutputIterator [inferred] random-access iterator type of the values output
+///   range. Must meet the requirements of a C++ OutputIterator concept. It can be a simple
+///   pointer type.
+/// \tparam OffsetIterator [inferred] random-access iterator type of segment offsets. Must meet the
+///   requirements of a C++ InputIterator concept. It can be a simple pointer type.
+///
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage. When
+///   a null pointer is passed, the required allocation size (in bytes) is written to
+///   \p storage_size and function returns without performing the selection.
+/// \param [in,out] storage_size reference to a size (in bytes) of \p temporary_storage.
+/// \param [in] keys_input iterator to the input range.
+/// \param [in] values_input iterator to the values input range.
+/// \param [out] keys_output iterator to the output range. Must be able to hold
+///   <tt>segments * k</tt> keys.
+/// \param [out] values_output iterator to the values output range. Must be able to hold
+///   <tt>segments * k</tt> values.
+/// \param [in] segments number of segments in the input range.
+/// \param [in] begin_offsets iterator to the first element in the range of beginning offsets.
+/// \param [in] end_offsets iterator to the first element in the range of ending offsets.
+/// \param [in] k number of keys to select from every segment.
+/// \param [in] stream [optional] HIP stream object. Default is \p 0 (default stream).
+/// \param [in] debug_synchronous [optional] If true, synchronization after every kernel
+///   launch is forced in order to check for errors. Default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful selection; otherwise a HIP runtime error of
+///   type \p hipError_t.
+template<class Config = default_config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class OffsetIterator>
+inline hipError_t segmented_sorted_topk_pairs_min(void*                temporary_storage,
+                                                  size_t&              storage_size,
+                                                  KeysInputIterator    keys_input,
+                                                  ValuesInputIterator  values_input,
+                                                  KeysOutputIterator   keys_output,
+                                                  ValuesOutputIterator values_output,
+                                                  unsigned int         segments,
+                                                  OffsetIterator       begin_offsets,
+                                                  OffsetIterator       end_offsets,
+                                                  unsigned int         k,
+                                                  hipStream_t          stream            = 0,
+                                                  bool                 debug_synchronous = false)
+{
+    return detail::segmented_topk_impl<Config, false, true, false>(temporary_storage,
+                                                                   storage_size,
+                                                                   keys_input,
+                                                                   values_input,
+                                                                   keys_output,
+                                                                   values_output,
+                                                                   segments,
+                                                                   begin_offsets,
+                                                                   end_offsets,
+                                                                   k,
+                                                                   stream,
+                                                                   debug_synchronous);
+}
+
+/// @}
+// end of group devicemodule
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_TOPK_HPP_
@@ -0,0 +1,75 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_TOPK_CONFIG_HPP_
+#define ROCPRIM_DEVICE_DEVICE_TOPK_CONFIG_HPP_
+
+#include "config_types.hpp"
+
+#include "detail/device_config_helper.hpp"
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// generic struct that instantiates custom configurations
+template<typename Config, typename>
+struct wrapped_topk_config
+{
+    template<target_arch Arch>
+    struct architecture_config
+    {
+        static constexpr topk_config_params params = Config{};
+    };
+};
+
+// specialized for rocprim::default_config, which instantiates the default_topk_config
+template<typename Type>
+struct wrapped_topk_config<default_config, Type>
+{
+    template<target_arch Arch>
+    struct architecture_config
+    {
+        static constexpr unsigned int item_scale
+            = ::rocprim::detail::ceiling_div<unsigned int>(sizeof(Type), sizeof(int));
+
+        static constexpr topk_config_params params
+            = topk_config<256, ::rocprim::max(1u, 16u / item_scale), 8>();
+    };
+};
+
+#ifndef DOXYGEN_DOCUMENTATION_BUILD
+template<typename Config, typename Type>
+template<target_arch Arch>
+constexpr topk_config_params
+    wrapped_topk_config<Config, Type>::architecture_config<Arch>::params;
+
+template<typename Type>
+template<target_arch Arch>
+constexpr topk_config_params
+    wrapped_topk_config<default_config, Type>::architecture_config<Arch>::params;
+#endif // DOXYGEN_DOCUMENTATION_BUILD
+
+} // namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_DEVICE_TOPK_CONFIG_HPP_
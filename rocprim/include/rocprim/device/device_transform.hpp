@@ -30,9 +30,11 @@
 #include "../common.hpp"
 #include "../detail/various.hpp"
 #include "../iterator/zip_iterator.hpp"
+#include "../types/future_value.hpp"
 #include "../types/tuple.hpp"
 
 #include "device_transform_config.hpp"
+#include "execution_budget.hpp"
 #include "detail/device_transform.hpp"
 
 /// \addtogroup devicemodule
@@ -57,6 +59,153 @@ ROCPRIM_KERNEL
                           ResultType>(input, size, output, transform_op);
 }
 
+template<class Config,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class UnaryFunction,
+         class SizeType,
+         class SizeIterator>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void transform_future_size_kernel(InputIterator                        input,
+                                  const size_t                         launch_offset,
+                                  future_value<SizeType, SizeIterator> size,
+                                  OutputIterator                       output,
+                                  UnaryFunction                        transform_op)
+{
+    transform_future_size_kernel_impl<device_params<Config>().kernel_config.block_size,
+                                      device_params<Config>().kernel_config.items_per_thread,
+                                      ResultType>(input,
+                                                  launch_offset,
+                                                  static_cast<size_t>(size),
+                                                  output,
+                                                  transform_op);
+}
+
+
+template<class Config,
+         class ResultType,
+         class InputIterator,
+         class OutputIterator,
+         class UnaryFunction>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void transform_prefetch_kernel(InputIterator  input,
+                               const size_t   size,
+                               OutputIterator output,
+                               UnaryFunction  transform_op)
+{
+    // The kernel is only launched for configs with a prefetch pipeline
+    if ROCPRIM_IF_CONSTEXPR(device_params<Config>().kernel_config.prefetch_tiles != 0)
+    {
+        transform_prefetch_kernel_impl<device_params<Config>().kernel_config.block_size,
+                                       device_params<Config>().kernel_config.items_per_thread,
+                                       device_params<Config>().kernel_config.prefetch_tiles,
+                                       ResultType>(input, size, output, transform_op);
+    }
+}
+
+template<class Config,
+         bool Masked,
+         class InputTuple,
+         class OutputTuple,
+         class Function,
+         class Predicate>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void multi_transform_kernel(InputTuple   inputs,
+                            OutputTuple  outputs,
+                            const size_t launch_offset,
+                            const size_t size,
+                            Function     transform_op,
+                            Predicate    predicate)
+{
+    multi_transform_kernel_impl<device_params<Config>().kernel_config.block_size,
+                                device_params<Config>().kernel_config.items_per_thread,
+                                Masked>(inputs,
+                                        outputs,
+                                        launch_offset,
+                                        size,
+                                        transform_op,
+                                        predicate);
+}
+
+template<class Config,
+         bool Masked,
+         class... InputIterators,
+         class... OutputIterators,
+         class Function,
+         class Predicate>
+inline hipError_t multi_transform_impl(const ::rocprim::tuple<InputIterators...>  inputs,
+                                       const ::rocprim::tuple<OutputIterators...> outputs,
+                                       const size_t                               size,
+                                       Function                                   transform_op,
+                                       Predicate                                  predicate,
+                                       const hipStream_t                          stream,
+                                       const bool debug_synchronous)
+{
+    static_assert(sizeof...(InputIterators) > 0 && sizeof...(OutputIterators) > 0,
+                  "transform needs at least one input and one output");
+
+    using results_type = typename ::rocprim::invoke_result<
+        Function,
+        typename std::iterator_traits<InputIterators>::value_type...>::type;
+    static_assert(::rocprim::tuple_size<results_type>::value == sizeof...(OutputIterators),
+                  "transform_op must return a tuple with one result per output");
+    using result_type = typename ::rocprim::tuple_element<0, results_type>::type;
+
+    using config = wrapped_transform_config<Config, result_type>;
+
+    if(size == size_t(0))
+    {
+        return hipSuccess;
+    }
+
+    target_arch target_arch;
+    hipError_t  result = host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const transform_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size      = params.kernel_config.block_size;
+    const auto         items_per_block = block_size * params.kernel_config.items_per_thread;
+
+    const auto size_limit
+        = budgeted_size_limit(stream, params.kernel_config.size_limit, items_per_block);
+    const auto aligned_size_limit
+        = ::rocprim::max<size_t>(size_limit / items_per_block, 1) * items_per_block;
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "number of blocks " << ceiling_div(size, items_per_block) << '\n';
+        std::cout << "items_per_block " << items_per_block << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    for(size_t offset = 0; offset < size; offset += aligned_size_limit)
+    {
+        const size_t current_size   = std::min(size - offset, aligned_size_limit);
+        const size_t current_blocks = ceiling_div(current_size, items_per_block);
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        multi_transform_kernel<config, Masked>
+            <<<dim3(current_blocks), dim3(block_size), 0, stream>>>(inputs,
+                                                                    outputs,
+                                                                    offset,
+                                                                    size,
+                                                                    transform_op,
+                                                                    predicate);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("multi_transform_kernel", current_size, start);
+    }
+
+    return hipSuccess;
+}
+
 } // end of detail namespace
 
 /// \brief Parallel transform primitive for device level.
@@ -66,6 +215,8 @@ ROCPRIM_KERNEL
 ///
 /// \par Overview
 /// * Ranges specified by \p input and \p output must have at least \p size elements.
+/// * If the \p PrefetchTiles of the config is not 0, a single launch of a persistent grid
+/// transforms the items, and each block loads its next tiles while it transforms the current.
 ///
 /// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config or a class derived from it.
 /// \tparam InputIterator - random-access iterator type of the input range. Must meet the
@@ -147,7 +298,34 @@ inline hipError_t transform(InputIterator     input,
     // Start point for time measurements
     std::chrono::steady_clock::time_point start;
 
-    const auto size_limit             = params.kernel_config.size_limit;
+    if(params.kernel_config.prefetch_tiles != 0)
+    {
+        const auto kernel = detail::transform_prefetch_kernel<config,
+                                                              result_type,
+                                                              InputIterator,
+                                                              OutputIterator,
+                                                              UnaryFunction>;
+        unsigned int grid_size;
+        ROCPRIM_RETURN_ON_ERROR(
+            detail::persistent_grid_size(kernel, block_size, stream, grid_size));
+        grid_size = static_cast<unsigned int>(
+            std::min<size_t>(grid_size, ::rocprim::detail::ceiling_div(size, items_per_block)));
+        if(debug_synchronous)
+        {
+            std::cout << "block_size " << block_size << '\n';
+            std::cout << "prefetch_tiles " << params.kernel_config.prefetch_tiles << '\n';
+            std::cout << "grid_size " << grid_size << '\n';
+            std::cout << "items_per_block " << items_per_block << '\n';
+            start = std::chrono::steady_clock::now();
+        }
+        detail::transform_prefetch_kernel<config, result_type>
+            <<<dim3(grid_size), dim3(block_size), 0, stream>>>(input, size, output, transform_op);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("transform_prefetch_kernel", size, start);
+        return hipSuccess;
+    }
+
+    const auto size_limit
+        = detail::budgeted_size_limit(stream, params.kernel_config.size_limit, items_per_block);
     const auto number_of_blocks_limit = ::rocprim::max<size_t>(size_limit / items_per_block, 1);
 
     auto number_of_blocks = (size + items_per_block - 1)/items_per_block;
@@ -184,6 +362,125 @@ inline hipError_t transform(InputIterator     input,
     return hipSuccess;
 }
 
+/// \brief Parallel transform primitive for device level, over a number of items that is only
+/// known on the device.
+///
+/// transform function performs a device-wide transformation operation using unary
+/// \p transform_op operator, like the overload with a host-known size. The number of items is
+/// read by the kernel, for example from the count output of a previous \p select, so a chain of
+/// algorithms runs without synchronizing with the host.
+///
+/// \par Overview
+/// * The launch covers \p max_size items. The blocks past the actual number of items exit
+/// right away.
+/// * The actual number of items must not be greater than \p max_size.
+/// * Ranges specified by \p input and \p output must have at least as many elements as the
+/// actual number of items.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the input range. Must meet the
+/// requirements of a C++ InputIterator concept. It can be a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output range. Must meet the
+/// requirements of a C++ OutputIterator concept. It can be a simple pointer type.
+/// \tparam SizeType - integral type of the number of items.
+/// \tparam SizeIterator - iterator type pointing at the number of items.
+/// \tparam UnaryFunction - type of unary function used for transform.
+///
+/// \param [in] input - iterator to the first element in the range to transform.
+/// \param [out] output - iterator to the first element in the output range.
+/// \param [in] size - the number of items, read on the device when the kernel runs.
+/// \param [in] max_size - the greatest possible number of items, used to size the launch.
+/// \param [in] transform_op - unary operation function object that will be used for transform.
+/// The signature of the function should be equivalent to the following:
+/// <tt>U f(const T &a);</tt>. The signature does not need to have
+/// <tt>const &</tt>, but function object must not modify the object passed to it.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Select the positive values, then transform only the selected ones
+/// rocprim::select(temporary_storage_ptr, temporary_storage_size_bytes,
+///                 input, selected, selected_count, input_size, is_positive);
+/// rocprim::transform(selected, output, rocprim::future_value<unsigned int>{selected_count},
+///                    input_size, transform_op);
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class SizeType,
+         class SizeIterator,
+         class UnaryFunction>
+inline hipError_t transform(InputIterator                        input,
+                            OutputIterator                       output,
+                            future_value<SizeType, SizeIterator> size,
+                            const size_t                         max_size,
+                            UnaryFunction                        transform_op,
+                            const hipStream_t                    stream            = 0,
+                            bool                                 debug_synchronous = false)
+{
+    if(max_size == size_t(0))
+        return hipSuccess;
+
+    using input_type = typename std::iterator_traits<InputIterator>::value_type;
+    using result_type = typename ::rocprim::invoke_result<UnaryFunction, input_type>::type;
+
+    using config = detail::wrapped_transform_config<Config, result_type>;
+
+    detail::target_arch target_arch;
+    hipError_t          result = detail::host_target_arch(stream, target_arch);
+    if(result != hipSuccess)
+    {
+        return result;
+    }
+    const detail::transform_config_params params
+        = detail::dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size       = params.kernel_config.block_size;
+    const unsigned int items_per_thread = params.kernel_config.items_per_thread;
+    const auto         items_per_block  = block_size * items_per_thread;
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    const auto size_limit
+        = detail::budgeted_size_limit(stream, params.kernel_config.size_limit, items_per_block);
+    const auto number_of_blocks_limit = ::rocprim::max<size_t>(size_limit / items_per_block, 1);
+    const auto aligned_size_limit     = number_of_blocks_limit * items_per_block;
+
+    // The launches cover max_size items, each kernel reads the actual size
+    const auto number_of_launch = (max_size + aligned_size_limit - 1) / aligned_size_limit;
+    for(size_t i = 0, offset = 0; i < number_of_launch; ++i, offset += aligned_size_limit)
+    {
+        const auto current_size   = std::min(max_size - offset, aligned_size_limit);
+        const auto current_blocks = (current_size + items_per_block - 1) / items_per_block;
+
+        if(debug_synchronous)
+            start = std::chrono::steady_clock::now();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(detail::transform_future_size_kernel<config, result_type>),
+            dim3(current_blocks),
+            dim3(block_size),
+            0,
+            stream,
+            input,
+            offset,
+            size,
+            output,
+            transform_op);
+        ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("transform_future_size_kernel",
+                                                    current_size,
+                                                    start);
+    }
+
+    return hipSuccess;
+}
+
 /// \brief Parallel device-level transform primitive for two inputs.
 ///
 /// transform function performs a device-wide transformation operation
@@ -267,6 +564,128 @@ hipError_t transform(InputIterator1 input1,
 }
 
 
+/// \brief Parallel transform primitive for device level with any number of inputs and outputs.
+///
+/// transform function performs a device-wide transformation operation of the items of
+/// all \p inputs into the items of all \p outputs using \p transform_op.
+///
+/// \par Overview
+/// * Ranges specified by \p inputs and \p outputs must have at least \p size elements.
+/// * Every input is loaded with its own block load and every output stored with its own
+/// block store, unlike a \p zip_iterator, which loads the elements of a tuple one at a time.
+/// When all inputs and outputs are pointers, the items of a thread are loaded and stored with
+/// vector accesses.
+/// * The prefetch pipeline of the config (\p PrefetchTiles) is not used.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config or a class derived from it.
+/// \tparam InputIterators - random-access iterator types of the input ranges.
+/// \tparam OutputIterators - random-access iterator types of the output ranges.
+/// \tparam Function - type of the function used for transform.
+///
+/// \param [in] inputs - tuple of iterators to the first elements of the ranges to transform.
+/// \param [out] outputs - tuple of iterators to the first elements of the output ranges.
+/// \param [in] size - number of element in the input ranges.
+/// \param [in] transform_op - function object that is called with one item of every input and
+/// returns a \p rocprim::tuple with one result for every output. The signature of the function
+/// should be equivalent to the following:
+/// <tt>rocprim::tuple<U1, ..., UM> f(const T1 &a1, ..., const TN &aN);</tt>.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \par Example
+/// \parblock
+/// In this example a fused AXPY with a norm of the terms is performed on three arrays.
+///
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// auto transform_op =
+///     [] __device__ (float x, float y, float a) -> rocprim::tuple<float, float>
+///     {
+///         return rocprim::make_tuple(a * x + y, x * x);
+///     };
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t size;    // e.g., 4
+/// float * x;      // e.g., [1, 2, 3, 4]
+/// float * y;      // e.g., [1, 1, 1, 1]
+/// float * a;      // e.g., [2, 2, 2, 2]
+/// float * z;      // empty array of 4 elements
+/// float * x2;     // empty array of 4 elements
+///
+/// rocprim::transform(
+///     rocprim::make_tuple(x, y, a), rocprim::make_tuple(z, x2), size, transform_op
+/// );
+/// // z:  [3, 5, 7, 9]
+/// // x2: [1, 4, 9, 16]
+/// \endcode
+/// \endparblock
+template<class Config = default_config,
+         class... InputIterators,
+         class... OutputIterators,
+         class Function>
+inline hipError_t transform(const ::rocprim::tuple<InputIterators...>  inputs,
+                            const ::rocprim::tuple<OutputIterators...> outputs,
+                            const size_t                               size,
+                            Function                                   transform_op,
+                            const hipStream_t                          stream            = 0,
+                            bool                                       debug_synchronous = false)
+{
+    return detail::multi_transform_impl<Config, false>(inputs,
+                                                       outputs,
+                                                       size,
+                                                       transform_op,
+                                                       detail::multi_transform_no_mask{},
+                                                       stream,
+                                                       debug_synchronous);
+}
+
+/// \brief Parallel transform primitive for device level with any number of inputs and outputs,
+/// which stores only the results of the items that satisfy a predicate.
+///
+/// Same as the \p transform with tuples of inputs and outputs, except that the results of an
+/// item are stored to all outputs only if \p predicate returns \p true for the items of the
+/// inputs. The elements of the outputs at the other positions are left unchanged.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transform_config or a class derived from it.
+/// \tparam InputIterators - random-access iterator types of the input ranges.
+/// \tparam OutputIterators - random-access iterator types of the output ranges.
+/// \tparam Function - type of the function used for transform.
+/// \tparam Predicate - type of the predicate of the stores.
+///
+/// \param [in] inputs - tuple of iterators to the first elements of the ranges to transform.
+/// \param [out] outputs - tuple of iterators to the first elements of the output ranges.
+/// \param [in] size - number of element in the input ranges.
+/// \param [in] transform_op - function object that is called with one item of every input and
+/// returns a \p rocprim::tuple with one result for every output.
+/// \param [in] predicate - function object that is called with one item of every input and
+/// returns whether the results of the item are stored. The signature of the function
+/// should be equivalent to the following: <tt>bool f(const T1 &a1, ..., const TN &aN);</tt>.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+template<class Config = default_config,
+         class... InputIterators,
+         class... OutputIterators,
+         class Function,
+         class Predicate>
+inline hipError_t transform_if(const ::rocprim::tuple<InputIterators...>  inputs,
+                               const ::rocprim::tuple<OutputIterators...> outputs,
+                               const size_t                               size,
+                               Function                                   transform_op,
+                               Predicate                                  predicate,
+                               const hipStream_t                          stream            = 0,
+                               bool                                       debug_synchronous = false)
+{
+    return detail::multi_transform_impl<Config, true>(inputs,
+                                                      outputs,
+                                                      size,
+                                                      transform_op,
+                                                      predicate,
+                                                      stream,
+                                                      debug_synchronous);
+}
 
 END_ROCPRIM_NAMESPACE
 
@@ -0,0 +1,314 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_DEVICE_TRANSPOSE_HPP_
+#define ROCPRIM_DEVICE_DEVICE_TRANSPOSE_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "detail/device_transpose.hpp"
+#include "device_transpose_config.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+template<class Config, class InputIterator, class OutputIterator>
+ROCPRIM_KERNEL __launch_bounds__(device_params<Config>().kernel_config.block_size)
+void transpose_kernel(InputIterator  input,
+                      OutputIterator output,
+                      const size_t   rows,
+                      const size_t   columns,
+                      const size_t   tile_columns,
+                      const size_t   tile_offset,
+                      const size_t   batch_offset)
+{
+    constexpr transpose_config_params params = device_params<Config>();
+    transpose_kernel_impl<params.tile_size, params.kernel_config.block_size / params.tile_size>(
+        input,
+        output,
+        rows,
+        columns,
+        tile_columns,
+        tile_offset,
+        batch_offset);
+}
+
+template<class Config, class InputIterator, class OutputIterator>
+inline hipError_t transpose_impl(InputIterator     input,
+                                 OutputIterator    output,
+                                 const size_t      rows,
+                                 const size_t      columns,
+                                 const size_t      batches,
+                                 const hipStream_t stream,
+                                 const bool        debug_synchronous)
+{
+    using value_type = typename std::iterator_traits<InputIterator>::value_type;
+    using config     = wrapped_transpose_config<Config, value_type>;
+
+    if(rows == 0 || columns == 0 || batches == 0)
+    {
+        return hipSuccess;
+    }
+
+    target_arch target_arch;
+    ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, target_arch));
+    const transpose_config_params params = dispatch_target_arch<config>(target_arch);
+
+    const unsigned int block_size   = params.kernel_config.block_size;
+    const unsigned int tile_size    = params.tile_size;
+    const size_t       tile_columns = ceiling_div(columns, tile_size);
+    const size_t       tiles        = ceiling_div(rows, tile_size) * tile_columns;
+
+    // The tiles of a matrix are launched along x, the matrices of a batch along y
+    const size_t max_tiles = ::rocprim::max<size_t>(
+        params.kernel_config.size_limit / (size_t(tile_size) * tile_size), 1);
+    constexpr size_t max_batches = 65535;
+
+    if(debug_synchronous)
+    {
+        std::cout << "block_size " << block_size << '\n';
+        std::cout << "tile_size " << tile_size << '\n';
+        std::cout << "tiles per matrix " << tiles << '\n';
+    }
+
+    // Start point for time measurements
+    std::chrono::steady_clock::time_point start;
+
+    for(size_t batch_offset = 0; batch_offset < batches; batch_offset += max_batches)
+    {
+        const size_t current_batches = std::min(batches - batch_offset, max_batches);
+        for(size_t tile_offset = 0; tile_offset < tiles; tile_offset += max_tiles)
+        {
+            const size_t current_tiles = std::min(tiles - tile_offset, max_tiles);
+
+            if(debug_synchronous)
+            {
+                start = std::chrono::steady_clock::now();
+            }
+            const dim3 grid_size(static_cast<unsigned int>(current_tiles),
+                                 static_cast<unsigned int>(current_batches));
+            transpose_kernel<config><<<grid_size, dim3(block_size), 0, stream>>>(input,
+                                                                                 output,
+                                                                                 rows,
+                                                                                 columns,
+                                                                                 tile_columns,
+                                                                                 tile_offset,
+                                                                                 batch_offset);
+            ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("transpose_kernel",
+                                                        current_tiles * current_batches,
+                                                        start);
+        }
+    }
+
+    return hipSuccess;
+}
+
+} // end of detail namespace
+
+/// \brief Parallel transpose primitive for device level.
+///
+/// transpose stores the transpose of the row-major matrix of \p rows rows and \p columns
+/// columns of \p input in \p output, so that <tt>output[c * rows + r]</tt> is
+/// <tt>input[r * columns + c]</tt>.
+///
+/// \par Overview
+/// * Every block stages a square tile of the matrix in shared memory. The rows of the tile are
+/// loaded and the columns stored with consecutive threads on consecutive items, so both sides
+/// are coalesced, and the positions of the tile are permuted to avoid bank conflicts.
+/// * The ranges of \p input and \p output must not overlap.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transpose_config or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the input matrix. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output matrix. It can be
+/// a simple pointer type.
+///
+/// \param [in] input - iterator to the first element of the input matrix.
+/// \param [out] output - iterator to the first element of the transposed matrix.
+/// \param [in] rows - number of rows of the input matrix.
+/// \param [in] columns - number of columns of the input matrix.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful transpose; otherwise a HIP runtime error of
+/// type \p hipError_t.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // Prepare input and output (declare pointers, allocate device memory etc.)
+/// size_t rows;     // e.g., 2
+/// size_t columns;  // e.g., 3
+/// int* input;      // e.g., [1, 2, 3,
+///                  //        4, 5, 6]
+/// int* output;     // empty array of 6 elements
+///
+/// rocprim::transpose(input, output, rows, columns);
+/// // output: [1, 4,
+/// //          2, 5,
+/// //          3, 6]
+/// \endcode
+/// \endparblock
+template<class Config = default_config, class InputIterator, class OutputIterator>
+inline hipError_t transpose(InputIterator     input,
+                            OutputIterator    output,
+                            const size_t      rows,
+                            const size_t      columns,
+                            const hipStream_t stream            = 0,
+                            bool              debug_synchronous = false)
+{
+    return detail::transpose_impl<Config>(input,
+                                          output,
+                                          rows,
+                                          columns,
+                                          1,
+                                          stream,
+                                          debug_synchronous);
+}
+
+/// \brief Parallel batched transpose primitive for device level.
+///
+/// batched_transpose transposes \p batches row-major matrices of \p rows rows and \p columns
+/// columns that are stored one after the other, in a single launch. The matrix \p b starts at
+/// <tt>b * rows * columns</tt> in both \p input and \p output.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transpose_config or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the input matrices. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the output matrices. It can be
+/// a simple pointer type.
+///
+/// \param [in] input - iterator to the first element of the input matrices.
+/// \param [out] output - iterator to the first element of the transposed matrices.
+/// \param [in] rows - number of rows of every input matrix.
+/// \param [in] columns - number of columns of every input matrix.
+/// \param [in] batches - number of matrices.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful transpose; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config, class InputIterator, class OutputIterator>
+inline hipError_t batched_transpose(InputIterator     input,
+                                    OutputIterator    output,
+                                    const size_t      rows,
+                                    const size_t      columns,
+                                    const size_t      batches,
+                                    const hipStream_t stream            = 0,
+                                    bool              debug_synchronous = false)
+{
+    return detail::transpose_impl<Config>(input,
+                                          output,
+                                          rows,
+                                          columns,
+                                          batches,
+                                          stream,
+                                          debug_synchronous);
+}
+
+/// \brief Converts an array of structures to a structure of arrays.
+///
+/// aos_to_soa splits the \p size structures of \p fields items of \p input into \p fields
+/// arrays of \p size items in \p output, so that <tt>output[f * size + i]</tt> is
+/// <tt>input[i * fields + f]</tt>. This is the transpose of a matrix of \p size rows and
+/// \p fields columns.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transpose_config or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the structures. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the arrays. It can be
+/// a simple pointer type.
+///
+/// \param [in] input - iterator to the first item of the first structure.
+/// \param [out] output - iterator to the first item of the first array.
+/// \param [in] size - number of structures.
+/// \param [in] fields - number of items of a structure.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful conversion; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config, class InputIterator, class OutputIterator>
+inline hipError_t aos_to_soa(InputIterator     input,
+                             OutputIterator    output,
+                             const size_t      size,
+                             const size_t      fields,
+                             const hipStream_t stream            = 0,
+                             bool              debug_synchronous = false)
+{
+    return transpose<Config>(input, output, size, fields, stream, debug_synchronous);
+}
+
+/// \brief Converts a structure of arrays to an array of structures.
+///
+/// soa_to_aos interleaves the \p fields arrays of \p size items of \p input into \p size
+/// structures of \p fields items in \p output, so that <tt>output[i * fields + f]</tt> is
+/// <tt>input[f * size + i]</tt>. This is the inverse of \p aos_to_soa.
+///
+/// \tparam Config - [optional] configuration of the primitive. It has to be \p transpose_config or a class derived from it.
+/// \tparam InputIterator - random-access iterator type of the arrays. It can be
+/// a simple pointer type.
+/// \tparam OutputIterator - random-access iterator type of the structures. It can be
+/// a simple pointer type.
+///
+/// \param [in] input - iterator to the first item of the first array.
+/// \param [out] output - iterator to the first item of the first structure.
+/// \param [in] size - number of structures.
+/// \param [in] fields - number of items of a structure.
+/// \param [in] stream - [optional] HIP stream object. The default is \p 0 (default stream).
+/// \param [in] debug_synchronous - [optional] If true, synchronization after every kernel
+/// launch is forced in order to check for errors. The default value is \p false.
+///
+/// \returns \p hipSuccess (\p 0) after successful conversion; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config, class InputIterator, class OutputIterator>
+inline hipError_t soa_to_aos(InputIterator     input,
+                             OutputIterator    output,
+                             const size_t      size,
+                             const size_t      fields,
+                             const hipStream_t stream            = 0,
+                             bool              debug_synchronous = false)
+{
+    return transpose<Config>(input, output, fields, size, stream, debug_synchronous);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_DEVICE_TRANSPOSE_HPP_
@@ -0,0 +1,433 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_DIAGNOSTICS_HPP_
+#define ROCPRIM_DEVICE_DIAGNOSTICS_HPP_
+
+#include "../config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include <cstddef>
+#include <cstring>
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The kind of a \p diagnostic_record.
+enum class diagnostic_code : unsigned int
+{
+    /// Not a diagnostic, the code of records that are not completely written yet.
+    none = 0,
+    /// The temporary storage passed to an algorithm is smaller than it requires, the algorithm
+    /// returned \p hipErrorInvalidValue. \p values[0] is the required size, \p values[1] the size
+    /// passed, in bytes.
+    temporary_storage_too_small,
+    /// The bit range of a radix sort is not valid for its keys, the algorithm returned
+    /// \p hipErrorInvalidValue. \p values[0] is the begin bit, \p values[1] the end bit.
+    invalid_bit_range,
+    /// A tile of a look-back scan polled the state of a preceding tile
+    /// \p lookback_timeout_spins times without finding it published, which points to a
+    /// preceding tile that is not scheduled (for example under co-tenancy). The scan keeps
+    /// waiting. \p values[0] is the id of the preceding tile.
+    lookback_timeout
+};
+
+/// \brief Where a \p diagnostic_record was written.
+enum class diagnostic_source : unsigned int
+{
+    /// By the host part of an algorithm, before any kernel was launched.
+    host,
+    /// By a kernel.
+    device
+};
+
+/// \brief A diagnostic of a device algorithm, see \p diagnostics_buffer.
+struct diagnostic_record
+{
+    /// The kind of the diagnostic.
+    diagnostic_code code;
+    /// Where the diagnostic was written.
+    diagnostic_source source;
+    /// The time the diagnostic was written: nanoseconds of \p std::chrono::steady_clock for host
+    /// records, and the device wall clock (\p wall_clock64, which ticks at
+    /// \p hipDeviceAttributeWallClockRate kHz) for device records.
+    unsigned long long timestamp;
+    /// The details of the diagnostic, see \p diagnostic_code.
+    unsigned long long values[2];
+};
+
+/// \brief The number of polls after which a look-back records a
+/// \p diagnostic_code::lookback_timeout.
+constexpr unsigned int lookback_timeout_spins = 1u << 20;
+
+namespace detail
+{
+
+// The part of a diagnostics buffer in coherent host memory: the number of records the kernels
+// have taken, followed by the records.
+struct diagnostics_header
+{
+    unsigned int count;
+};
+
+// The view of the installed buffer captured by kernel arguments. Without a buffer it has no
+// records, and recording only checks the pointer.
+struct diagnostics_view
+{
+    diagnostics_header* header   = nullptr;
+    diagnostic_record*  records  = nullptr;
+    unsigned int        capacity = 0;
+
+    ROCPRIM_DEVICE ROCPRIM_INLINE void record(const diagnostic_code    code,
+                                              const unsigned long long value0,
+                                              const unsigned long long value1 = 0) const
+    {
+        if(header == nullptr)
+        {
+            return;
+        }
+        const unsigned int slot = __hip_atomic_fetch_add(&header->count,
+                                                         1u,
+                                                         __ATOMIC_RELAXED,
+                                                         __HIP_MEMORY_SCOPE_SYSTEM);
+        if(slot >= capacity)
+        {
+            return;
+        }
+        diagnostic_record& record = records[slot];
+        record.source             = diagnostic_source::device;
+        record.timestamp          = wall_clock64();
+        record.values[0]          = value0;
+        record.values[1]          = value1;
+        // The code is written last, so the host only reads complete records.
+        __hip_atomic_store(reinterpret_cast<unsigned int*>(&record.code),
+                           static_cast<unsigned int>(code),
+                           __ATOMIC_RELEASE,
+                           __HIP_MEMORY_SCOPE_SYSTEM);
+    }
+
+    // The view of the buffer set by set_diagnostics_buffer, captured by the look-back states
+    // when they are created on the host.
+    ROCPRIM_HOST static diagnostics_view& current()
+    {
+        static diagnostics_view view;
+        return view;
+    }
+};
+
+} // namespace detail
+
+/// \brief Collects the diagnostics of device algorithms without synchronizing them.
+///
+/// Unlike \p debug_synchronous, which synchronizes and prints after every kernel, a diagnostics
+/// buffer is cheap enough to stay installed in production: the host parts of the algorithms
+/// record invalid arguments next to the error they return, and kernels write their records to
+/// coherent host memory, so reading them needs neither a copy nor a synchronization. The
+/// records of kernels that are still running become visible as they complete.
+///
+/// The buffer is installed for all device algorithms with \p set_diagnostics_buffer. The new
+/// records are read with \p poll, on demand, or by the callback of \p set_diagnostics_buffer
+/// after each following kernel launch. Device records past the capacity are dropped and
+/// counted, see \p dropped.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// rocprim::diagnostics_buffer diagnostics;
+/// diagnostics.create(1024);
+/// rocprim::set_diagnostics_buffer(&diagnostics);
+///
+/// // ... device algorithms ...
+///
+/// std::vector<rocprim::diagnostic_record> records;
+/// diagnostics.poll(records);
+/// for(const auto& record : records)
+/// {
+///     std::cout << static_cast<unsigned int>(record.code) << " " << record.values[0] << "\n";
+/// }
+/// rocprim::set_diagnostics_buffer(nullptr);
+/// \endcode
+/// \endparblock
+class diagnostics_buffer
+{
+public:
+    diagnostics_buffer() = default;
+
+    diagnostics_buffer(const diagnostics_buffer&)            = delete;
+    diagnostics_buffer& operator=(const diagnostics_buffer&) = delete;
+
+    /// \brief Frees the buffer. It must not be installed anymore.
+    ~diagnostics_buffer()
+    {
+        (void)destroy();
+    }
+
+    /// \brief Allocates room for \p capacity device records in coherent host memory.
+    /// \param [in] capacity the largest number of device records kept until \p reset.
+    /// \returns \p hipSuccess (\p 0) after the allocation; otherwise a HIP runtime error of type
+    /// \p hipError_t.
+    hipError_t create(const unsigned int capacity)
+    {
+        hipError_t error = destroy();
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        void*        memory;
+        const size_t bytes = sizeof(diagnostic_record) * (size_t(capacity) + 1);
+        error              = hipHostMalloc(&memory, bytes, hipHostMallocCoherent);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        std::memset(memory, 0, bytes);
+        // The header takes the place of the first record, which keeps the records aligned.
+        header_   = static_cast<detail::diagnostics_header*>(memory);
+        records_  = static_cast<diagnostic_record*>(memory) + 1;
+        capacity_ = capacity;
+        polled_   = 0;
+        return hipSuccess;
+    }
+
+    /// \brief Frees the memory of the buffer.
+    /// \returns \p hipSuccess (\p 0) after the memory is freed; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    hipError_t destroy()
+    {
+        if(header_ == nullptr)
+        {
+            return hipSuccess;
+        }
+        const hipError_t error = hipHostFree(header_);
+        header_                = nullptr;
+        records_               = nullptr;
+        capacity_              = 0;
+        return error;
+    }
+
+    /// \brief Appends the records written since the previous call to \p records, first those
+    /// of the host and then those of the kernels, in the order they took their slots.
+    /// \param [in,out] records the vector the new records are appended to.
+    /// \returns the number of records appended.
+    size_t poll(std::vector<diagnostic_record>& records)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const size_t                size = records.size();
+        records.insert(records.end(), host_records_.begin(), host_records_.end());
+        host_records_.clear();
+
+        if(header_ != nullptr)
+        {
+            const unsigned int count
+                = std::min(__atomic_load_n(&header_->count, __ATOMIC_RELAXED), capacity_);
+            for(; polled_ < count; ++polled_)
+            {
+                diagnostic_record& record = records_[polled_];
+                // A kernel has taken the slot but not finished writing it.
+                const unsigned int code
+                    = __atomic_load_n(reinterpret_cast<unsigned int*>(&record.code),
+                                      __ATOMIC_ACQUIRE);
+                if(code == static_cast<unsigned int>(diagnostic_code::none))
+                {
+                    break;
+                }
+                records.push_back(record);
+            }
+        }
+        return records.size() - size;
+    }
+
+    /// \brief Returns the number of device records that did not fit into the buffer.
+    size_t dropped() const
+    {
+        if(header_ == nullptr)
+        {
+            return 0;
+        }
+        const unsigned int count = __atomic_load_n(&header_->count, __ATOMIC_RELAXED);
+        return count > capacity_ ? count - capacity_ : 0;
+    }
+
+    /// \brief Empties the buffer. No kernel that records into it may be running.
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        host_records_.clear();
+        if(header_ != nullptr)
+        {
+            std::memset(static_cast<void*>(header_),
+                        0,
+                        sizeof(diagnostic_record) * (size_t(capacity_) + 1));
+        }
+        polled_ = 0;
+    }
+
+    /// \brief Records a diagnostic of the host.
+    /// \param [in] code the kind of the diagnostic.
+    /// \param [in] value0 the first detail, see \p diagnostic_code.
+    /// \param [in] value1 the second detail, see \p diagnostic_code.
+    void record(const diagnostic_code    code,
+                const unsigned long long value0,
+                const unsigned long long value1 = 0)
+    {
+        const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch());
+        std::lock_guard<std::mutex> lock(mutex_);
+        host_records_.push_back(
+            diagnostic_record{code,
+                              diagnostic_source::host,
+                              static_cast<unsigned long long>(timestamp.count()),
+                              {value0, value1}});
+    }
+
+    /// \brief Returns the view of the buffer captured by the kernels.
+    detail::diagnostics_view view() const
+    {
+        return detail::diagnostics_view{header_, records_, capacity_};
+    }
+
+private:
+    detail::diagnostics_header*    header_   = nullptr;
+    diagnostic_record*             records_  = nullptr;
+    unsigned int                   capacity_ = 0;
+    unsigned int                   polled_   = 0;
+    std::vector<diagnostic_record> host_records_;
+    std::mutex                     mutex_;
+};
+
+/// \brief The type of the callbacks set by \p set_diagnostics_buffer.
+using diagnostics_callback = void (*)(const diagnostic_record& record, void* user_data);
+
+namespace detail
+{
+
+// The process-wide diagnostics buffer. Algorithms without a buffer only load an atomic flag.
+class diagnostics_hook
+{
+public:
+    static diagnostics_hook& instance()
+    {
+        static diagnostics_hook hook;
+        return hook;
+    }
+
+    void set(diagnostics_buffer* const  buffer,
+             const diagnostics_callback callback,
+             void* const                user_data)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffer_                     = buffer;
+        callback_                   = callback;
+        user_data_                  = user_data;
+        diagnostics_view::current() = buffer != nullptr ? buffer->view() : diagnostics_view{};
+        active_.store(buffer != nullptr, std::memory_order_relaxed);
+    }
+
+    void record(const diagnostic_code    code,
+                const unsigned long long value0,
+                const unsigned long long value1)
+    {
+        if(!active_.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if(buffer_ != nullptr)
+        {
+            buffer_->record(code, value0, value1);
+        }
+    }
+
+    // Passes the new records to the callback, after each kernel launch.
+    void check()
+    {
+        if(!active_.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        std::vector<diagnostic_record> records;
+        diagnostics_callback           callback;
+        void*                          user_data;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if(buffer_ == nullptr || callback_ == nullptr)
+            {
+                return;
+            }
+            buffer_->poll(records);
+            callback  = callback_;
+            user_data = user_data_;
+        }
+        for(const diagnostic_record& record : records)
+        {
+            callback(record, user_data);
+        }
+    }
+
+private:
+    diagnostics_hook() = default;
+
+    std::mutex           mutex_;
+    diagnostics_buffer*  buffer_    = nullptr;
+    diagnostics_callback callback_  = nullptr;
+    void*                user_data_ = nullptr;
+    std::atomic<bool>    active_{false};
+};
+
+// Records a diagnostic of the host part of an algorithm into the installed buffer, if any.
+inline void record_diagnostic(const diagnostic_code    code,
+                              const unsigned long long value0,
+                              const unsigned long long value1 = 0)
+{
+    diagnostics_hook::instance().record(code, value0, value1);
+}
+
+} // namespace detail
+
+/// \brief Installs the buffer that device algorithms record their diagnostics into.
+///
+/// The host parts of the algorithms record into \p buffer right away, kernels record into it if
+/// they are launched after this call. If \p callback is not null, it is called on the host
+/// with each new record after each kernel launch of a device algorithm, which reads the records
+/// of the kernels that have completed by then without waiting for the others. It must not
+/// launch device algorithms itself.
+///
+/// \param [in] buffer the buffer to record into, \p nullptr stops recording.
+/// \param [in] callback the function called with the new records, or \p nullptr.
+/// \param [in] user_data a pointer passed to each call of \p callback.
+inline void set_diagnostics_buffer(diagnostics_buffer* const  buffer,
+                                   const diagnostics_callback callback  = nullptr,
+                                   void* const                user_data = nullptr)
+{
+    detail::diagnostics_hook::instance().set(buffer, callback, user_data);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_DIAGNOSTICS_HPP_
@@ -0,0 +1,450 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_EXECUTION_BUDGET_HPP_
+#define ROCPRIM_DEVICE_EXECUTION_BUDGET_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../iterator/cache_modified_input_iterator.hpp"
+#include "config_types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Hints how the device algorithms launched on a stream trade throughput for other
+/// resources, see \p set_stream_execution_hint. Hints can be combined with \p operator|.
+enum class execution_hint : unsigned int
+{
+    /// The algorithms are tuned for throughput.
+    none = 0,
+    /// The algorithms choose the variants with the smallest temporary storage.
+    minimize_memory = 1,
+    /// The searches load their streamed input with nontemporal loads, so that the data they look
+    /// up repeatedly keeps its place in the L2 cache.
+    stream_inputs = 2,
+};
+
+/// \brief Combines two execution hints.
+constexpr execution_hint operator|(const execution_hint lhs, const execution_hint rhs)
+{
+    return static_cast<execution_hint>(static_cast<unsigned int>(lhs)
+                                       | static_cast<unsigned int>(rhs));
+}
+
+/// \brief Returns the hints that are in both \p lhs and \p rhs.
+constexpr execution_hint operator&(const execution_hint lhs, const execution_hint rhs)
+{
+    return static_cast<execution_hint>(static_cast<unsigned int>(lhs)
+                                       & static_cast<unsigned int>(rhs));
+}
+
+/// \brief The largest number of items processed by one launch of the algorithms on a stream
+/// with \p execution_hint::minimize_memory.
+constexpr size_t minimize_memory_size_limit = size_t(1) << 22;
+
+namespace detail
+{
+
+// A process-wide table of per-stream budgets, one instance per `Tag`. Streams without an entry
+// are not limited, and the table is only locked while some stream has a budget.
+template<class Tag, class Value>
+class stream_budget_table
+{
+public:
+    static stream_budget_table& instance()
+    {
+        static stream_budget_table budgets;
+        return budgets;
+    }
+
+    void set(const hipStream_t stream, const Value budget)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if(budget == Value{})
+        {
+            budgets_.erase(stream);
+        }
+        else
+        {
+            budgets_[stream] = budget;
+        }
+        active_.store(!budgets_.empty(), std::memory_order_relaxed);
+    }
+
+    // Returns the budget of the stream, 0 if it is not limited.
+    Value get(const hipStream_t stream)
+    {
+        if(!active_.load(std::memory_order_relaxed))
+        {
+            return Value{};
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = budgets_.find(stream);
+        return it != budgets_.end() ? it->second : Value{};
+    }
+
+private:
+    stream_budget_table() = default;
+
+    std::mutex                             mutex_;
+    std::unordered_map<hipStream_t, Value> budgets_;
+    std::atomic<bool>                      active_{false};
+};
+
+struct block_budget_tag
+{};
+
+struct shared_memory_budget_tag
+{};
+
+struct execution_hint_tag
+{};
+
+// The largest number of blocks of each launch on a stream.
+using stream_block_budgets = stream_budget_table<block_budget_tag, unsigned int>;
+
+// The largest number of bytes of shared memory per block of the configs selected for a stream.
+using stream_shared_memory_budgets = stream_budget_table<shared_memory_budget_tag, size_t>;
+
+// The execution hint of a stream.
+using stream_execution_hints = stream_budget_table<execution_hint_tag, execution_hint>;
+
+inline bool has_execution_hint(const hipStream_t stream, const execution_hint hint)
+{
+    return (stream_execution_hints::instance().get(stream) & hint) != execution_hint::none;
+}
+
+inline bool minimizes_memory(const hipStream_t stream)
+{
+    return has_execution_hint(stream, execution_hint::minimize_memory);
+}
+
+// Calls `function` with the streamed input of a search, wrapped in a load_cs
+// cache_modified_input_iterator if the stream has execution_hint::stream_inputs. Only pointers are
+// wrapped, the loads of other iterators are not known. The temporary storage of the searches must
+// not depend on the type of their input, since both calls of an algorithm check the hint.
+template<class Iterator, class Function>
+inline hipError_t with_streaming_input(std::false_type /*is_pointer*/,
+                                       const hipStream_t /*stream*/,
+                                       Iterator   input,
+                                       Function&& function)
+{
+    return function(input);
+}
+
+template<class Iterator, class Function>
+inline hipError_t with_streaming_input(std::true_type /*is_pointer*/,
+                                       const hipStream_t stream,
+                                       Iterator          input,
+                                       Function&&        function)
+{
+    if(has_execution_hint(stream, execution_hint::stream_inputs))
+    {
+        return function(make_cache_modified_input_iterator<load_cs>(input));
+    }
+    return function(input);
+}
+
+template<class Iterator, class Function>
+inline hipError_t
+    with_streaming_input(const hipStream_t stream, Iterator input, Function&& function)
+{
+    return with_streaming_input(std::is_pointer<Iterator>{},
+                                stream,
+                                input,
+                                std::forward<Function>(function));
+}
+
+// Limits the number of items processed by one launch, given as the size_limit of a kernel
+// config, to the block budget of the stream. The temporary storage of look-back scans grows with
+// the items of a launch, so streams that minimize memory also limit it.
+inline size_t budgeted_size_limit(const hipStream_t  stream,
+                                  size_t             size_limit,
+                                  const unsigned int items_per_block)
+{
+    if(minimizes_memory(stream))
+    {
+        size_limit
+            = std::min(size_limit, std::max<size_t>(minimize_memory_size_limit, items_per_block));
+    }
+    const unsigned int max_blocks = stream_block_budgets::instance().get(stream);
+    if(max_blocks == 0)
+    {
+        return size_limit;
+    }
+    return std::min(size_limit, size_t(max_blocks) * items_per_block);
+}
+
+// Limits the number of blocks of a launch to the block budget of the stream.
+inline unsigned int budgeted_grid_size(const hipStream_t stream, const unsigned int grid_size)
+{
+    const unsigned int max_blocks = stream_block_budgets::instance().get(stream);
+    return max_blocks == 0 ? grid_size : std::min(grid_size, max_blocks);
+}
+
+// Returns the grid size of a grid-stride launch of `kernel` on `stream`: the number of blocks
+// with `block_size` threads and `dynamic_shared_memory` bytes of dynamic shared memory that can
+// be resident at once on the device, limited to `max_grid_size` (if it is not 0) and to the block
+// budget of `stream`. The grid has at least one block.
+template<class Kernel>
+inline hipError_t occupancy_grid_size(Kernel             kernel,
+                                      const unsigned int block_size,
+                                      const size_t       dynamic_shared_memory,
+                                      const unsigned int max_grid_size,
+                                      const hipStream_t  stream,
+                                      unsigned int&      grid_size)
+{
+    int device_id;
+    ROCPRIM_RETURN_ON_ERROR(get_device_from_stream(stream, device_id));
+    device_properties properties;
+    ROCPRIM_RETURN_ON_ERROR(get_device_properties(device_id, properties));
+
+    unsigned int blocks_per_multiprocessor;
+    ROCPRIM_RETURN_ON_ERROR(max_active_blocks_per_multiprocessor(kernel,
+                                                                 block_size,
+                                                                 dynamic_shared_memory,
+                                                                 device_id,
+                                                                 blocks_per_multiprocessor));
+
+    grid_size = std::max(blocks_per_multiprocessor, 1u) * properties.multiprocessor_count;
+    if(max_grid_size != 0)
+    {
+        grid_size = std::min(grid_size, max_grid_size);
+    }
+    grid_size = std::max(budgeted_grid_size(stream, grid_size), 1u);
+    return hipSuccess;
+}
+
+// Returns the number of blocks of `kernel` that can be resident at once on the device of
+// `stream`, the grid size of a persistent kernel, limited to the block budget of `stream`.
+template<class Kernel>
+inline hipError_t persistent_grid_size(Kernel             kernel,
+                                       const unsigned int block_size,
+                                       const hipStream_t  stream,
+                                       unsigned int&      grid_size)
+{
+    return occupancy_grid_size(kernel, block_size, 0, 0, stream, grid_size);
+}
+
+} // namespace detail
+
+/// \brief Limits the number of blocks that each kernel launched by a device algorithm on
+/// \p stream may have.
+///
+/// Device algorithms size their grids for the whole device, so independent algorithms running
+/// concurrently on several streams compete for all compute units, and the blocks of their
+/// look-back scans (for example those of the onesweep radix sort) interleave. With a budget, the
+/// algorithms split their input into several launches of at most \p max_blocks blocks, as they
+/// do for inputs larger than the \p size_limit of their config, and persistent grids have at
+/// most \p max_blocks blocks. Together with a compute unit mask (see
+/// \p create_stream_with_compute_units) this lets concurrent algorithms share the device
+/// predictably.
+///
+/// The budget is honoured by \p reduce, \p transform, \p adjacent_difference, \p scan,
+/// \p scan_by_key, \p reduce_by_key, \p select, \p unique, \p partition and the onesweep
+/// radix sort. The grid-stride kernels of \p histogram_even, \p histogram_range (and their
+/// multi-channel and weighted variants) and \p batch_memcpy are sized by their occupancy and
+/// limited to the budget. Launches of at most 16 blocks and auxiliary kernels that are smaller
+/// than the main passes are not split further.
+///
+/// The budget must not be changed between the two calls of an algorithm (the one that queries
+/// the temporary storage size and the one that runs it), and it should be removed before the
+/// stream is destroyed, as a new stream may get the same handle.
+///
+/// \param [in] stream the stream to limit, it may be the default stream.
+/// \param [in] max_blocks the largest number of blocks of each launch, \p 0 removes the budget.
+/// \returns \p hipSuccess (\p 0).
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// hipStream_t streams[4];
+/// for(hipStream_t& stream : streams)
+/// {
+///     hipStreamCreateWithFlags(&stream, hipStreamNonBlocking);
+///     // Each sort uses about a quarter of a device that runs 1024 blocks at a time
+///     rocprim::set_stream_block_budget(stream, 256);
+/// }
+/// \endcode
+/// \endparblock
+inline hipError_t set_stream_block_budget(const hipStream_t stream, const unsigned int max_blocks)
+{
+    detail::stream_block_budgets::instance().set(stream, max_blocks);
+    return hipSuccess;
+}
+
+/// \brief Returns the block budget of \p stream set by \p set_stream_block_budget, \p 0 if the
+/// stream is not limited.
+inline unsigned int get_stream_block_budget(const hipStream_t stream)
+{
+    return detail::stream_block_budgets::instance().get(stream);
+}
+
+/// \brief Limits the shared memory (LDS) per block of the configs that device algorithms select
+/// at run time for \p stream.
+///
+/// Configs with many items per thread let a block of radix sort or merge sort use nearly all
+/// shared memory of a compute unit. Kernels of other streams then cannot run on that compute
+/// unit until the block finishes. With a budget, the algorithms called with a \p tuned_config
+/// select the best candidate recorded in the tuning database whose shared memory does not exceed
+/// \p max_shared_memory (see the \p shared_memory field of \p load_tuning_database), so their
+/// blocks leave room for other kernels. Algorithms called with other configs are not affected,
+/// since their config is fixed at compile time.
+///
+/// The budget must not be changed between the two calls of an algorithm (the one that queries
+/// the temporary storage size and the one that runs it), and it should be removed before the
+/// stream is destroyed, as a new stream may get the same handle.
+///
+/// \param [in] stream the stream to limit, it may be the default stream.
+/// \param [in] max_shared_memory the largest number of bytes of shared memory per block of the
+/// selected configs, \p 0 removes the budget.
+/// \returns \p hipSuccess (\p 0).
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// // tuning.txt:
+/// // radix_sort gfx942 int - 0 0 shared_memory=16384
+/// // radix_sort gfx942 int - 0 1 shared_memory=61440
+/// rocprim::load_tuning_database("tuning.txt");
+///
+/// // Candidate 1 is used on other streams, candidate 0 on `stream`
+/// rocprim::set_stream_shared_memory_budget(stream, 32768);
+/// rocprim::radix_sort_keys<config>(temporary_storage, storage_size, input, output, size,
+///                                  0, 32, stream);
+/// \endcode
+/// \endparblock
+inline hipError_t set_stream_shared_memory_budget(const hipStream_t stream,
+                                                  const size_t      max_shared_memory)
+{
+    detail::stream_shared_memory_budgets::instance().set(stream, max_shared_memory);
+    return hipSuccess;
+}
+
+/// \brief Returns the shared memory budget of \p stream set by
+/// \p set_stream_shared_memory_budget, \p 0 if the stream is not limited.
+inline size_t get_stream_shared_memory_budget(const hipStream_t stream)
+{
+    return detail::stream_shared_memory_budgets::instance().get(stream);
+}
+
+/// \brief Sets the execution hint of the device algorithms launched on \p stream.
+///
+/// With \p execution_hint::minimize_memory, the algorithms that honour the block budget (see
+/// \p set_stream_block_budget) process at most \p minimize_memory_size_limit items per launch.
+/// Their look-back scan states, and the look-back slots of the onesweep radix sort, are sized for
+/// one launch, so their temporary storage stops growing with the input. Each launch still fills
+/// the device, so larger inputs only lose the time of the additional launches. Buffers of the size
+/// of the input, such as the double buffers of \p radix_sort_pairs and \p merge_sort, are not
+/// affected; the \p double_buffer overloads of radix sort avoid them.
+///
+/// With \p execution_hint::stream_inputs, the searches that look up a table for each item of a
+/// streamed input load that input with nontemporal loads (see \p cache_modified_input_iterator
+/// with \p load_cs), so that under the pressure of the stream the table keeps its place in the
+/// L2 cache:
+/// * \p lower_bound, \p upper_bound and \p binary_search (also with a search index) stream
+///   the needles and look up the haystack.
+/// * \p find_first_of streams the input and looks up the keys, or the set of the keys.
+///
+/// Only inputs given as pointers are streamed. The algorithms instantiate their kernels for both
+/// kinds of loads.
+///
+/// The hint must not be changed between the two calls of an algorithm (the one that queries the
+/// temporary storage size and the one that runs it), and it should be removed before the stream
+/// is destroyed, as a new stream may get the same handle.
+///
+/// \param [in] stream the stream, it may be the default stream.
+/// \param [in] hint the execution hints, combined with \p operator|, \p execution_hint::none
+/// removes the hints.
+/// \returns \p hipSuccess (\p 0).
+inline hipError_t set_stream_execution_hint(const hipStream_t stream, const execution_hint hint)
+{
+    detail::stream_execution_hints::instance().set(stream, hint);
+    return hipSuccess;
+}
+
+/// \brief Returns the execution hint of \p stream set by \p set_stream_execution_hint.
+inline execution_hint get_stream_execution_hint(const hipStream_t stream)
+{
+    return detail::stream_execution_hints::instance().get(stream);
+}
+
+#if defined(__HIP_PLATFORM_AMD__) || defined(DOXYGEN_DOCUMENTATION_BUILD)
+
+/// \brief Creates a stream whose kernels only run on \p compute_unit_count
+/// compute units starting at \p first_compute_unit, and sets its block budget.
+///
+/// \param [out] stream the created stream. Destroy it with \p hipStreamDestroy after removing
+/// its budget with <tt>set_stream_block_budget(stream, 0)</tt>.
+/// \param [in] first_compute_unit the index of the first compute unit of the stream.
+/// \param [in] compute_unit_count the number of compute units of the stream.
+/// \param [in] max_blocks the block budget of the stream, see \p set_stream_block_budget.
+/// \p 0 sets no budget.
+/// \returns \p hipSuccess (\p 0) after successful creation, \p hipErrorInvalidValue if the
+/// compute units are not on the current device; otherwise a HIP runtime error of type
+/// \p hipError_t.
+inline hipError_t create_stream_with_compute_units(hipStream_t*       stream,
+                                                   const unsigned int first_compute_unit,
+                                                   const unsigned int compute_unit_count,
+                                                   const unsigned int max_blocks = 0)
+{
+    int device_id;
+    ROCPRIM_RETURN_ON_ERROR(hipGetDevice(&device_id));
+    detail::device_properties properties;
+    ROCPRIM_RETURN_ON_ERROR(detail::get_device_properties(device_id, properties));
+    const unsigned int multiprocessor_count = properties.multiprocessor_count;
+    if(compute_unit_count == 0
+       || size_t(first_compute_unit) + compute_unit_count > size_t(multiprocessor_count))
+    {
+        return hipErrorInvalidValue;
+    }
+
+    std::vector<uint32_t> mask((multiprocessor_count + 31) / 32, 0);
+    for(unsigned int cu = first_compute_unit; cu < first_compute_unit + compute_unit_count; ++cu)
+    {
+        mask[cu / 32] |= uint32_t(1) << (cu % 32);
+    }
+    ROCPRIM_RETURN_ON_ERROR(
+        hipExtStreamCreateWithCUMask(stream, static_cast<uint32_t>(mask.size()), mask.data()));
+    return set_stream_block_budget(*stream, max_blocks);
+}
+
+#endif // defined(__HIP_PLATFORM_AMD__) || defined(DOXYGEN_DOCUMENTATION_BUILD)
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_EXECUTION_BUDGET_HPP_
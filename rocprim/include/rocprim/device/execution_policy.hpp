@@ -0,0 +1,496 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_EXECUTION_POLICY_HPP_
+#define ROCPRIM_DEVICE_EXECUTION_POLICY_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../type_traits.hpp"
+#include "../types/future_value.hpp"
+
+#include "device_reduce.hpp"
+#include "device_scan.hpp"
+#include "managed_memory.hpp"
+
+#include <iostream>
+#include <iterator>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Where the algorithms taking an \p execution_policy run.
+enum class execution_policy
+{
+    /// The algorithm runs on the device of the stream, like the overloads without a policy.
+    device,
+    /// The algorithm runs on the calling thread after the stream has been synchronized. All
+    /// iterators, the initial value and the operator must be usable on the host.
+    host,
+    /// The algorithm runs on the host if the input has at most \p host_execution_size_limit
+    /// items, all iterators are host-accessible pointers (see \p is_host_accessible), the
+    /// initial value is not a \p future_value and the stream is not being captured. Otherwise
+    /// it runs on the device.
+    automatic
+};
+
+/// \brief Largest input for which \p execution_policy::automatic runs an algorithm on the host.
+/// Up to this size, the host finishes before a kernel launch and stream synchronization would.
+constexpr size_t host_execution_size_limit = 4096;
+
+/// \brief Returns in \p accessible whether the host can read and write \p ptr without
+/// migrating memory: pageable or pinned host memory, and managed memory of devices that share
+/// their memory with the host (see \p is_host_coherent_device).
+///
+/// \param [in] ptr the pointer to check.
+/// \param [in] device the device that would otherwise access \p ptr.
+/// \param [out] accessible whether the host accesses \p ptr directly.
+inline hipError_t is_host_accessible(const void* ptr, const int device, bool& accessible)
+{
+    hipPointerAttribute_t attributes;
+    if(hipPointerGetAttributes(&attributes, ptr) != hipSuccess)
+    {
+        // Pageable host memory is unknown to some versions of the runtime
+        (void)hipGetLastError();
+        accessible = true;
+        return hipSuccess;
+    }
+    if(attributes.isManaged)
+    {
+        return is_host_coherent_device(device, accessible);
+    }
+    accessible = attributes.type != hipMemoryTypeDevice && attributes.type != hipMemoryTypeArray;
+    return hipSuccess;
+}
+
+namespace detail
+{
+
+// Only raw pointers are known to be host-accessible, other iterators may wrap device memory.
+template<class Iterator>
+inline hipError_t
+    host_accessible_iterators(const int /*device*/, bool& accessible, Iterator /*iterator*/)
+{
+    accessible = false;
+    return hipSuccess;
+}
+
+template<class T>
+inline hipError_t host_accessible_iterators(const int device, bool& accessible, T* iterator)
+{
+    return is_host_accessible(iterator, device, accessible);
+}
+
+template<class Iterator, class... Iterators>
+inline hipError_t host_accessible_iterators(const int device,
+                                            bool&     accessible,
+                                            Iterator  iterator,
+                                            Iterators... iterators)
+{
+    ROCPRIM_RETURN_ON_ERROR(host_accessible_iterators(device, accessible, iterator));
+    if(!accessible)
+    {
+        return hipSuccess;
+    }
+    return host_accessible_iterators(device, accessible, iterators...);
+}
+
+template<class T>
+constexpr bool host_accessible_value(const T& /*value*/)
+{
+    return true;
+}
+
+template<class T, class Iter>
+constexpr bool host_accessible_value(const ::rocprim::future_value<T, Iter>& /*value*/)
+{
+    return false;
+}
+
+// Sets use_host to whether the algorithm runs on the host under the given policy.
+template<class InitValueType, class... Iterators>
+inline hipError_t resolve_execution_policy(const execution_policy policy,
+                                           const size_t           size,
+                                           const InitValueType&   initial_value,
+                                           const hipStream_t      stream,
+                                           bool&                  use_host,
+                                           Iterators... iterators)
+{
+    use_host = policy == execution_policy::host;
+    if(policy != execution_policy::automatic)
+    {
+        return hipSuccess;
+    }
+    if(size > host_execution_size_limit || !host_accessible_value(initial_value))
+    {
+        return hipSuccess;
+    }
+
+    // The host work could not be part of a captured graph.
+    hipStreamCaptureStatus capture_status;
+    ROCPRIM_RETURN_ON_ERROR(hipStreamIsCapturing(stream, &capture_status));
+    if(capture_status != hipStreamCaptureStatusNone)
+    {
+        return hipSuccess;
+    }
+
+    int device;
+    ROCPRIM_RETURN_ON_ERROR(get_device_from_stream(stream, device));
+    return host_accessible_iterators(device, use_host, iterators...);
+}
+
+// The host algorithms are called instead of the device algorithm with the same arguments, after
+// the temporary storage size query: they need none.
+inline hipError_t begin_host_execution(void*             temporary_storage,
+                                       size_t&           storage_size,
+                                       const char*       name,
+                                       const size_t      size,
+                                       const hipStream_t stream,
+                                       const bool        debug_synchronous,
+                                       bool&             run)
+{
+    run = temporary_storage != nullptr;
+    if(!run)
+    {
+        // Make sure user won't try to allocate 0 bytes memory, otherwise
+        // user may again pass nullptr as temporary_storage
+        storage_size = 4;
+        return hipSuccess;
+    }
+    if(debug_synchronous)
+    {
+        std::cout << name << "(" << size << ")" << '\n';
+    }
+    // The inputs may be written by work enqueued before.
+    return hipStreamSynchronize(stream);
+}
+
+template<class AccType,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction>
+inline void host_reduce(InputIterator       input,
+                        OutputIterator      output,
+                        const InitValueType initial_value,
+                        const size_t        size,
+                        BinaryFunction      reduce_op)
+{
+    AccType reduction = static_cast<AccType>(get_input_value(initial_value));
+    for(size_t i = 0; i < size; i++)
+    {
+        reduction = reduce_op(reduction, static_cast<AccType>(input[i]));
+    }
+    *output = reduction;
+}
+
+template<class AccType, class InputIterator, class OutputIterator, class BinaryFunction>
+inline void host_inclusive_scan(InputIterator  input,
+                                OutputIterator output,
+                                const size_t   size,
+                                BinaryFunction scan_op)
+{
+    if(size == 0)
+    {
+        return;
+    }
+    AccType prefix = static_cast<AccType>(input[0]);
+    output[0]      = prefix;
+    for(size_t i = 1; i < size; i++)
+    {
+        prefix    = scan_op(prefix, static_cast<AccType>(input[i]));
+        output[i] = prefix;
+    }
+}
+
+template<class AccType,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction>
+inline void host_exclusive_scan(InputIterator       input,
+                                OutputIterator      output,
+                                const InitValueType initial_value,
+                                const size_t        size,
+                                BinaryFunction      scan_op)
+{
+    AccType prefix = static_cast<AccType>(get_input_value(initial_value));
+    for(size_t i = 0; i < size; i++)
+    {
+        // Read before writing, the scan may be in place.
+        const AccType value = static_cast<AccType>(input[i]);
+        output[i]           = prefix;
+        prefix              = scan_op(prefix, value);
+    }
+}
+
+} // namespace detail
+
+/// \brief Parallel reduction primitive for device level, which runs on the host for small
+/// inputs.
+///
+/// With \p execution_policy::device this function is the same as \p reduce without a policy.
+/// Otherwise it may reduce the input on the host, see \p execution_policy, in which case:
+/// * The temporary storage is not used, but a non-null \p temporary_storage must still be
+/// passed after the size query.
+/// * \p stream is synchronized before the input is read, and the output is written when the
+/// function returns.
+/// * The input is reduced in order from \p initial_value, with \p AccType as accumulator.
+///
+/// \param [in] policy where the reduction runs.
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage, or null to
+/// query its size.
+/// \param [in,out] storage_size reference to the size (in bytes) of \p temporary_storage.
+/// \param [in] input iterator to the first element in the range to reduce.
+/// \param [out] output iterator to the first element in the output range.
+/// \param [in] initial_value initial value to start the reduction.
+/// \param [in] size number of elements in the input range.
+/// \param [in] reduce_op binary operation function object that will be used for reduction.
+/// \param [in] stream the HIP stream.
+/// \param [in] debug_synchronous if true, synchronization after every kernel launch is forced.
+/// \returns \p hipSuccess (\p 0) after a successful reduction; otherwise a HIP runtime error
+/// of type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+         class AccType = ::rocprim::invoke_result_binary_op_t<
+             typename std::iterator_traits<InputIterator>::value_type,
+             BinaryFunction>>
+inline hipError_t reduce(const execution_policy policy,
+                         void*                  temporary_storage,
+                         size_t&                storage_size,
+                         InputIterator          input,
+                         OutputIterator         output,
+                         const InitValueType    initial_value,
+                         const size_t           size,
+                         BinaryFunction         reduce_op         = BinaryFunction(),
+                         const hipStream_t      stream            = 0,
+                         bool                   debug_synchronous = false)
+{
+    bool use_host;
+    ROCPRIM_RETURN_ON_ERROR(detail::resolve_execution_policy(policy,
+                                                             size,
+                                                             initial_value,
+                                                             stream,
+                                                             use_host,
+                                                             input,
+                                                             output));
+    if(!use_host)
+    {
+        return reduce<Config,
+                      InputIterator,
+                      OutputIterator,
+                      InitValueType,
+                      BinaryFunction,
+                      AccType>(temporary_storage,
+                               storage_size,
+                               input,
+                               output,
+                               initial_value,
+                               size,
+                               reduce_op,
+                               stream,
+                               debug_synchronous);
+    }
+
+    bool run;
+    ROCPRIM_RETURN_ON_ERROR(detail::begin_host_execution(temporary_storage,
+                                                         storage_size,
+                                                         "host_reduce",
+                                                         size,
+                                                         stream,
+                                                         debug_synchronous,
+                                                         run));
+    if(run)
+    {
+        detail::host_reduce<AccType>(input, output, initial_value, size, reduce_op);
+    }
+    return hipSuccess;
+}
+
+/// \brief Parallel inclusive scan primitive for device level, which runs on the host for
+/// small inputs.
+///
+/// With \p execution_policy::device this function is the same as \p inclusive_scan without a
+/// policy. Otherwise it may scan the input on the host, see \p execution_policy, in which case:
+/// * The temporary storage is not used, but a non-null \p temporary_storage must still be
+/// passed after the size query.
+/// * \p stream is synchronized before the input is read, and the output is written when the
+/// function returns.
+///
+/// \param [in] policy where the scan runs.
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage, or null to
+/// query its size.
+/// \param [in,out] storage_size reference to the size (in bytes) of \p temporary_storage.
+/// \param [in] input iterator to the first element in the range to scan.
+/// \param [out] output iterator to the first element in the output range.
+/// \param [in] size number of elements in the input range.
+/// \param [in] scan_op binary operation function object that will be used for scan.
+/// \param [in] stream the HIP stream.
+/// \param [in] debug_synchronous if true, synchronization after every kernel launch is forced.
+/// \returns \p hipSuccess (\p 0) after a successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+         class AccType = typename std::iterator_traits<InputIterator>::value_type>
+inline hipError_t inclusive_scan(const execution_policy policy,
+                                 void*                  temporary_storage,
+                                 size_t&                storage_size,
+                                 InputIterator          input,
+                                 OutputIterator         output,
+                                 const size_t           size,
+                                 BinaryFunction         scan_op           = BinaryFunction(),
+                                 const hipStream_t      stream            = 0,
+                                 bool                   debug_synchronous = false)
+{
+    bool use_host;
+    ROCPRIM_RETURN_ON_ERROR(detail::resolve_execution_policy(policy,
+                                                             size,
+                                                             empty_type{},
+                                                             stream,
+                                                             use_host,
+                                                             input,
+                                                             output));
+    if(!use_host)
+    {
+        return inclusive_scan<Config, InputIterator, OutputIterator, BinaryFunction, AccType>(
+            temporary_storage,
+            storage_size,
+            input,
+            output,
+            size,
+            scan_op,
+            stream,
+            debug_synchronous);
+    }
+
+    bool run;
+    ROCPRIM_RETURN_ON_ERROR(detail::begin_host_execution(temporary_storage,
+                                                         storage_size,
+                                                         "host_inclusive_scan",
+                                                         size,
+                                                         stream,
+                                                         debug_synchronous,
+                                                         run));
+    if(run)
+    {
+        detail::host_inclusive_scan<AccType>(input, output, size, scan_op);
+    }
+    return hipSuccess;
+}
+
+/// \brief Parallel exclusive scan primitive for device level, which runs on the host for
+/// small inputs.
+///
+/// With \p execution_policy::device this function is the same as \p exclusive_scan without a
+/// policy. Otherwise it may scan the input on the host, see \p execution_policy, in which case:
+/// * The temporary storage is not used, but a non-null \p temporary_storage must still be
+/// passed after the size query.
+/// * \p stream is synchronized before the input is read, and the output is written when the
+/// function returns.
+///
+/// \param [in] policy where the scan runs.
+/// \param [in] temporary_storage pointer to a device-accessible temporary storage, or null to
+/// query its size.
+/// \param [in,out] storage_size reference to the size (in bytes) of \p temporary_storage.
+/// \param [in] input iterator to the first element in the range to scan.
+/// \param [out] output iterator to the first element in the output range.
+/// \param [in] initial_value initial value to start the scan.
+/// \param [in] size number of elements in the input range.
+/// \param [in] scan_op binary operation function object that will be used for scan.
+/// \param [in] stream the HIP stream.
+/// \param [in] debug_synchronous if true, synchronization after every kernel launch is forced.
+/// \returns \p hipSuccess (\p 0) after a successful scan; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Config = default_config,
+         class InputIterator,
+         class OutputIterator,
+         class InitValueType,
+         class BinaryFunction
+         = ::rocprim::plus<typename std::iterator_traits<InputIterator>::value_type>,
+         class AccType = detail::input_type_t<InitValueType>>
+inline hipError_t exclusive_scan(const execution_policy policy,
+                                 void*                  temporary_storage,
+                                 size_t&                storage_size,
+                                 InputIterator          input,
+                                 OutputIterator         output,
+                                 const InitValueType    initial_value,
+                                 const size_t           size,
+                                 BinaryFunction         scan_op           = BinaryFunction(),
+                                 const hipStream_t      stream            = 0,
+                                 bool                   debug_synchronous = false)
+{
+    bool use_host;
+    ROCPRIM_RETURN_ON_ERROR(detail::resolve_execution_policy(policy,
+                                                             size,
+                                                             initial_value,
+                                                             stream,
+                                                             use_host,
+                                                             input,
+                                                             output));
+    if(!use_host)
+    {
+        return exclusive_scan<Config,
+                              InputIterator,
+                              OutputIterator,
+                              InitValueType,
+                              BinaryFunction,
+                              AccType>(temporary_storage,
+                                       storage_size,
+                                       input,
+                                       output,
+                                       initial_value,
+                                       size,
+                                       scan_op,
+                                       stream,
+                                       debug_synchronous);
+    }
+
+    bool run;
+    ROCPRIM_RETURN_ON_ERROR(detail::begin_host_execution(temporary_storage,
+                                                         storage_size,
+                                                         "host_exclusive_scan",
+                                                         size,
+                                                         stream,
+                                                         debug_synchronous,
+                                                         run));
+    if(run)
+    {
+        detail::host_exclusive_scan<AccType>(input, output, initial_value, size, scan_op);
+    }
+    return hipSuccess;
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_EXECUTION_POLICY_HPP_
@@ -0,0 +1,310 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_INSTRUMENTATION_HPP_
+#define ROCPRIM_DEVICE_INSTRUMENTATION_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+
+#include "diagnostics.hpp"
+
+#ifdef ROCPRIM_INSTRUMENTATION_ROCTX
+    #include <roctracer/roctx.h>
+#endif
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Describes a kernel launched by a device algorithm.
+struct kernel_launch_info
+{
+    /// The name of the kernel or pass, for example \p onesweep_iteration or
+    /// \p init_lookback_scan_state_kernel.
+    const char* name;
+    /// The number of items processed by the launch (or blocks, segments or problems, for kernels
+    /// that do not process the items of the input).
+    size_t size;
+    /// The stream the kernel was launched on.
+    hipStream_t stream;
+};
+
+/// \brief The type of the callbacks set by \p set_kernel_launch_callback.
+using kernel_launch_callback = void (*)(const kernel_launch_info& info, void* user_data);
+
+namespace detail
+{
+
+// The process-wide kernel launch callback. The callback is only read under the lock while one
+// is set, so launches without instrumentation only load an atomic flag. It is called under a
+// shared lock, so \p set waits for the calls of the previous callback in other threads to return
+// before the caller can destroy its user data.
+class kernel_launch_hook
+{
+public:
+    static kernel_launch_hook& instance()
+    {
+        static kernel_launch_hook hook;
+        return hook;
+    }
+
+    void set(const kernel_launch_callback callback, void* const user_data)
+    {
+        std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+        callback_  = callback;
+        user_data_ = user_data;
+        active_.store(callback != nullptr, std::memory_order_relaxed);
+    }
+
+    void notify(const char* const name, const size_t size, const hipStream_t stream)
+    {
+        if(!active_.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        if(callback_ != nullptr)
+        {
+            callback_(kernel_launch_info{name, size, stream}, user_data_);
+        }
+    }
+
+private:
+    kernel_launch_hook() = default;
+
+    std::shared_timed_mutex mutex_;
+    kernel_launch_callback  callback_  = nullptr;
+    void*                   user_data_ = nullptr;
+    std::atomic<bool>       active_{false};
+};
+
+// Called after each kernel launch of the device algorithms, see
+// ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR.
+inline void
+    notify_kernel_launch(const char* const name, const size_t size, const hipStream_t stream)
+{
+#ifdef ROCPRIM_INSTRUMENTATION_ROCTX
+    roctxMarkA(name);
+#endif
+    kernel_launch_hook::instance().notify(name, size, stream);
+    diagnostics_hook::instance().check();
+}
+
+} // namespace detail
+
+/// \brief Sets a function called on the host after each kernel launched by a device algorithm.
+///
+/// The callback is called right after the kernel is enqueued, before the algorithm returns, with
+/// the name of the kernel, the number of items it processes and its stream. It is called for
+/// every internal pass, such as the histogram, scan and iteration kernels of the onesweep radix
+/// sort and the look-back state initialization of scans, so the time of an algorithm can be
+/// attributed to its passes without \p debug_synchronous and its synchronizations. A callback
+/// may record an event on the stream, as \p kernel_timer does, but it must not synchronize it.
+///
+/// When \p ROCPRIM_INSTRUMENTATION_ROCTX is defined before including rocPRIM, each launch also
+/// emits a roctx mark with the name of the kernel.
+///
+/// The callback may be called concurrently from several host threads, and it must not launch
+/// device algorithms or set the callback itself. Launches without a callback only check an
+/// atomic flag. This function waits for the running calls of the previous callback to return,
+/// so its \p user_data can be destroyed once the callback is replaced or removed.
+///
+/// \param [in] callback the function to call, \p nullptr removes the callback.
+/// \param [in] user_data a pointer passed to each call of \p callback.
+inline void set_kernel_launch_callback(const kernel_launch_callback callback,
+                                       void* const                  user_data = nullptr)
+{
+    detail::kernel_launch_hook::instance().set(callback, user_data);
+}
+
+/// \brief Measures the device time of each kernel launched by device algorithms on a stream,
+/// without synchronizing between the launches.
+///
+/// \p start records an event on the stream and sets a kernel launch callback that records an
+/// event after each kernel launched on the stream. \p stop removes the callback, waits for the
+/// last event and computes the time of each kernel as the time between its event and the
+/// previous one. Only one \p kernel_timer can be started at a time, and it replaces any callback
+/// set by \p set_kernel_launch_callback. Work enqueued on the stream between the device
+/// algorithms, such as copies, is included in the time of the next kernel.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// rocprim::kernel_timer timer;
+/// timer.start(stream);
+/// rocprim::radix_sort_keys(temporary_storage, storage_size, input, output, size,
+///                          0, 8 * sizeof(key_type), stream);
+/// std::vector<rocprim::kernel_timer::entry> entries;
+/// timer.stop(entries);
+/// for(const auto& entry : entries)
+/// {
+///     std::cout << entry.name << " " << entry.size << " " << entry.milliseconds << " ms\n";
+/// }
+/// \endcode
+/// \endparblock
+class kernel_timer
+{
+public:
+    /// \brief The time of a kernel.
+    struct entry
+    {
+        /// The name of the kernel, see \p kernel_launch_info.
+        std::string name;
+        /// The number of items processed by the kernel, see \p kernel_launch_info.
+        size_t size;
+        /// The time between the end of the previous kernel and the end of this one.
+        float milliseconds;
+    };
+
+    kernel_timer() = default;
+
+    kernel_timer(const kernel_timer&)            = delete;
+    kernel_timer& operator=(const kernel_timer&) = delete;
+
+    /// \brief Stops the timer if it is running and destroys its events.
+    ~kernel_timer()
+    {
+        if(running_)
+        {
+            set_kernel_launch_callback(nullptr);
+        }
+        (void)destroy_events();
+    }
+
+    /// \brief Starts timing the kernels launched on \p stream.
+    /// \param [in] stream the stream of the device algorithms to measure.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error
+    /// of type \p hipError_t.
+    hipError_t start(const hipStream_t stream)
+    {
+        if(running_)
+        {
+            return hipErrorInvalidValue;
+        }
+        ROCPRIM_RETURN_ON_ERROR(destroy_events());
+
+        hipEvent_t begin;
+        ROCPRIM_RETURN_ON_ERROR(hipEventCreate(&begin));
+        launches_.push_back(launch{std::string(), 0, begin});
+        ROCPRIM_RETURN_ON_ERROR(hipEventRecord(begin, stream));
+
+        stream_  = stream;
+        error_   = hipSuccess;
+        running_ = true;
+        set_kernel_launch_callback(&kernel_timer::on_launch, this);
+        return hipSuccess;
+    }
+
+    /// \brief Stops the timer, waits for the measured kernels and returns their times in launch
+    /// order.
+    /// \param [out] entries the times of the kernels launched since \p start.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise the first HIP runtime
+    /// error of type \p hipError_t, including errors of recording the events.
+    hipError_t stop(std::vector<entry>& entries)
+    {
+        if(!running_)
+        {
+            return hipErrorInvalidValue;
+        }
+        set_kernel_launch_callback(nullptr);
+        running_ = false;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        ROCPRIM_RETURN_ON_ERROR(error_);
+        ROCPRIM_RETURN_ON_ERROR(hipEventSynchronize(launches_.back().event));
+
+        entries.clear();
+        entries.reserve(launches_.size() - 1);
+        for(size_t i = 1; i < launches_.size(); ++i)
+        {
+            float milliseconds;
+            ROCPRIM_RETURN_ON_ERROR(
+                hipEventElapsedTime(&milliseconds, launches_[i - 1].event, launches_[i].event));
+            entries.push_back(entry{launches_[i].name, launches_[i].size, milliseconds});
+        }
+        return hipSuccess;
+    }
+
+private:
+    struct launch
+    {
+        std::string name;
+        size_t      size;
+        hipEvent_t  event;
+    };
+
+    static void on_launch(const kernel_launch_info& info, void* const user_data)
+    {
+        kernel_timer& timer = *static_cast<kernel_timer*>(user_data);
+        if(info.stream != timer.stream_)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(timer.mutex_);
+        if(timer.error_ != hipSuccess)
+        {
+            return;
+        }
+        hipEvent_t event;
+        timer.error_ = hipEventCreate(&event);
+        if(timer.error_ != hipSuccess)
+        {
+            return;
+        }
+        timer.launches_.push_back(launch{info.name, info.size, event});
+        timer.error_ = hipEventRecord(event, info.stream);
+    }
+
+    hipError_t destroy_events()
+    {
+        hipError_t error = hipSuccess;
+        for(const launch& l : launches_)
+        {
+            const hipError_t destroy_error = hipEventDestroy(l.event);
+            error                          = error == hipSuccess ? destroy_error : error;
+        }
+        launches_.clear();
+        return error;
+    }
+
+    std::mutex          mutex_;
+    std::vector<launch> launches_;
+    hipStream_t         stream_  = 0;
+    hipError_t          error_   = hipSuccess;
+    bool                running_ = false;
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_INSTRUMENTATION_HPP_
@@ -0,0 +1,198 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_MANAGED_MEMORY_HPP_
+#define ROCPRIM_DEVICE_MANAGED_MEMORY_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+
+#include "config_types.hpp"
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief How a device algorithm accesses a \p managed_memory_range.
+enum class managed_memory_access
+{
+    /// The range is only read, e.g. the input of an algorithm.
+    read,
+    /// The range is written, and possibly read, e.g. an output or temporary storage.
+    read_write
+};
+
+/// \brief A range of memory that a device algorithm accesses, passed to
+/// \p advise_managed_memory.
+struct managed_memory_range
+{
+    /// Pointer to the first byte of the range.
+    const void* ptr;
+    /// Size of the range in bytes.
+    size_t bytes;
+    /// How the algorithm accesses the range.
+    managed_memory_access access;
+};
+
+/// \brief Returns a \p managed_memory_range of \p count elements that are only read.
+template<class T>
+managed_memory_range make_managed_read_range(const T* ptr, const size_t count)
+{
+    return managed_memory_range{ptr, count * sizeof(T), managed_memory_access::read};
+}
+
+/// \brief Returns a \p managed_memory_range of \p count elements that are written.
+template<class T>
+managed_memory_range make_managed_read_write_range(T* ptr, const size_t count)
+{
+    return managed_memory_range{ptr, count * sizeof(T), managed_memory_access::read_write};
+}
+
+/// \brief Returns in \p coherent whether \p device shares its physical memory with the host,
+/// like the APUs, so managed memory does not have to migrate to the device.
+inline hipError_t is_host_coherent_device(const int device, bool& coherent)
+{
+    int integrated = 0;
+    ROCPRIM_RETURN_ON_ERROR(
+        hipDeviceGetAttribute(&integrated, hipDeviceAttributeIntegrated, device));
+    coherent = integrated != 0;
+    return hipSuccess;
+}
+
+/// \brief Prepares managed memory for the device algorithms enqueued next on \p stream.
+///
+/// Managed (\p hipMallocManaged) memory is migrated to the device lazily, page by page, when
+/// a kernel first touches it. Algorithms with several passes over their data, like the onesweep
+/// radix sort, then stall on page faults, and migrate the pages back and forth if the host
+/// touches them in between. \p advise_managed_memory migrates the ranges up front instead.
+///
+/// \par Overview
+/// * Ranges that are not managed memory (device memory, pinned or pageable host memory) are
+/// skipped, so all ranges of an algorithm can be passed regardless of how they were allocated.
+/// * On devices with separate memory, the device of \p stream becomes the preferred location
+/// of every range, read-only ranges are marked as read mostly so the host can keep reading
+/// its copy of them, and the ranges are prefetched to the device on \p stream.
+/// * On devices that share the physical memory with the host (see \p is_host_coherent_device)
+/// no memory is migrated: the ranges are only prefetched on \p stream, which maps their pages
+/// for the device before the algorithm runs.
+/// * The advice stays with the memory after the algorithm has finished.
+///
+/// \param [in] ranges pointer to a host array of the ranges accessed by the algorithm.
+/// \param [in] num_ranges number of elements in \p ranges.
+/// \param [in] stream the stream on which the algorithm is enqueued.
+///
+/// \returns \p hipSuccess (\p 0) after the advice is given and the prefetches are enqueued;
+/// otherwise a HIP runtime error of type \p hipError_t.
+inline hipError_t advise_managed_memory(const managed_memory_range* ranges,
+                                        const size_t                num_ranges,
+                                        const hipStream_t           stream)
+{
+    int device;
+    ROCPRIM_RETURN_ON_ERROR(detail::get_device_from_stream(stream, device));
+    bool coherent;
+    ROCPRIM_RETURN_ON_ERROR(is_host_coherent_device(device, coherent));
+
+    for(size_t i = 0; i < num_ranges; ++i)
+    {
+        const managed_memory_range& range = ranges[i];
+        if(range.ptr == nullptr || range.bytes == 0)
+        {
+            continue;
+        }
+
+        hipPointerAttribute_t attributes;
+        if(hipPointerGetAttributes(&attributes, range.ptr) != hipSuccess)
+        {
+            // Pageable host memory is unknown to some versions of the runtime
+            (void)hipGetLastError();
+            continue;
+        }
+        if(!attributes.isManaged)
+        {
+            continue;
+        }
+
+        if(!coherent)
+        {
+            ROCPRIM_RETURN_ON_ERROR(
+                hipMemAdvise(range.ptr, range.bytes, hipMemAdviseSetPreferredLocation, device));
+            if(range.access == managed_memory_access::read)
+            {
+                ROCPRIM_RETURN_ON_ERROR(
+                    hipMemAdvise(range.ptr, range.bytes, hipMemAdviseSetReadMostly, device));
+            }
+        }
+        ROCPRIM_RETURN_ON_ERROR(hipMemPrefetchAsync(range.ptr, range.bytes, device, stream));
+    }
+    return hipSuccess;
+}
+
+/// \brief Runs a device algorithm after preparing the managed memory it accesses.
+///
+/// \p function is called without arguments after \p advise_managed_memory has been applied to
+/// \p ranges, which should cover the inputs, outputs and temporary storage of the algorithm.
+///
+/// \param [in] ranges pointer to a host array of the ranges accessed by the algorithm.
+/// \param [in] num_ranges number of elements in \p ranges.
+/// \param [in] stream the stream on which \p function enqueues its work.
+/// \param [in] function the algorithm invocation.
+/// \returns the result of \p function, or a HIP runtime error of type \p hipError_t if the
+/// memory could not be advised.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// // keys_input, keys_output and temporary_storage are allocated with hipMallocManaged
+/// const rocprim::managed_memory_range ranges[] = {
+///     rocprim::make_managed_read_range(keys_input, size),
+///     rocprim::make_managed_read_write_range(keys_output, size),
+///     rocprim::make_managed_read_write_range(static_cast<char*>(temporary_storage),
+///                                            storage_size)};
+/// rocprim::invoke_with_managed_memory_advice(
+///     ranges, 3, stream,
+///     [&]
+///     {
+///         return rocprim::radix_sort_keys(temporary_storage, storage_size,
+///                                         keys_input, keys_output, size,
+///                                         0, 8 * sizeof(key_type), stream);
+///     });
+/// \endcode
+/// \endparblock
+template<class Function>
+hipError_t invoke_with_managed_memory_advice(const managed_memory_range* ranges,
+                                             const size_t                num_ranges,
+                                             const hipStream_t           stream,
+                                             Function&&                  function)
+{
+    ROCPRIM_RETURN_ON_ERROR(advise_managed_memory(ranges, num_ranges, stream));
+    return function();
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_MANAGED_MEMORY_HPP_
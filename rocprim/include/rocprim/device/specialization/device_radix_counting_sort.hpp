@@ -0,0 +1,500 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_SPECIALIZATION_DEVICE_RADIX_COUNTING_SORT_HPP_
+#define ROCPRIM_DEVICE_SPECIALIZATION_DEVICE_RADIX_COUNTING_SORT_HPP_
+
+#include "../../block/block_discontinuity.hpp"
+#include "../../block/block_load_func.hpp"
+#include "../../block/block_radix_sort.hpp"
+#include "../../config.hpp"
+#include "../../detail/temp_storage.hpp"
+#include "../../detail/various.hpp"
+#include "../../functional.hpp"
+#include "../../intrinsics.hpp"
+#include "../../thread/radix_key_codec.hpp"
+#include "../../types.hpp"
+#include "../device_scan.hpp"
+#include "../device_transform.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+#include <cstddef>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+constexpr unsigned int radix_sort_counting_block_size       = 256;
+constexpr unsigned int radix_sort_counting_items_per_thread = 8;
+constexpr unsigned int radix_sort_counting_items_per_tile
+    = radix_sort_counting_block_size * radix_sort_counting_items_per_thread;
+// The digits of the counting sort are the whole bit range, so the range is limited by the
+// digit counters of a block in shared memory.
+constexpr unsigned int radix_sort_counting_max_bits = 12;
+// Every block counts and scatters a contiguous chunk of tiles. The counts of all digits of all
+// blocks are scanned, so the number of blocks is limited to keep that scan smaller than a pass
+// over the keys. The radix sort only uses the counting sort when at least min_blocks can be used.
+constexpr unsigned int radix_sort_counting_max_blocks = 1024;
+constexpr unsigned int radix_sort_counting_min_blocks = 64;
+
+// Number of blocks for size items with a digit of bits bits, which keeps the number of digit
+// counts at most half of size when there are enough tiles.
+inline unsigned int radix_sort_counting_blocks(const size_t size, const unsigned int bits)
+{
+    const size_t tiles       = ceiling_div(size, radix_sort_counting_items_per_tile);
+    const size_t count_limit = size / (size_t(2) << bits);
+    const size_t blocks      = ::rocprim::min<size_t>(
+        ::rocprim::min<size_t>(tiles, radix_sort_counting_max_blocks),
+        ::rocprim::max<size_t>(count_limit, radix_sort_counting_min_blocks));
+    return static_cast<unsigned int>(::rocprim::max<size_t>(blocks, 1));
+}
+
+// Whether the radix sort sorts size keys over the bit range with the counting sort.
+template<class Key>
+inline bool radix_sort_use_counting(const size_t       size,
+                                    const unsigned int begin_bit,
+                                    const unsigned int end_bit)
+{
+    if(begin_bit >= end_bit || end_bit - begin_bit > radix_sort_counting_max_bits
+       || end_bit > 8 * sizeof(Key) || size > std::numeric_limits<unsigned int>::max())
+    {
+        return false;
+    }
+    const unsigned int bits = end_bit - begin_bit;
+    return size / (size_t(2) << bits) >= radix_sort_counting_min_blocks
+           && ceiling_div(size, radix_sort_counting_items_per_tile)
+                  >= radix_sort_counting_min_blocks;
+}
+
+// The keys with a decomposer have no single digit of the bit range.
+template<class Key, class Decomposer>
+using radix_sort_counting_supported
+    = std::integral_constant<bool,
+                             std::is_same<Decomposer, identity_decomposer>::value
+                                 && radix_key_fundamental<Key>::value
+                                 && !std::is_same<Key, bool>::value>;
+
+template<bool Descending, class Key>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+unsigned int radix_sort_counting_digit(const Key          key,
+                                       const unsigned int begin_bit,
+                                       const unsigned int bits)
+{
+    using codec = radix_key_codec<Key, Descending>;
+    return codec::extract_digit(codec::encode(key), begin_bit, bits);
+}
+
+// The chunk of tiles of a block, the blocks have the same number of tiles except the last ones.
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void radix_sort_counting_tiles(const unsigned int block_index,
+                               const unsigned int blocks,
+                               const unsigned int size,
+                               unsigned int&      tile_begin,
+                               unsigned int&      tile_end)
+{
+    const unsigned int tiles           = ceiling_div(size, radix_sort_counting_items_per_tile);
+    const unsigned int tiles_per_block = ceiling_div(tiles, blocks);
+    tile_begin = ::rocprim::min(block_index * tiles_per_block, tiles);
+    tile_end   = ::rocprim::min(tile_begin + tiles_per_block, tiles);
+}
+
+// Counts the digits of the chunk of tiles of the block in shared memory, and stores the counts
+// digit-major, so that an exclusive scan of them gives the first output position of every digit
+// of every block.
+template<bool Descending, class KeysInputIterator>
+ROCPRIM_KERNEL __launch_bounds__(radix_sort_counting_block_size)
+void radix_sort_counting_histogram_kernel(KeysInputIterator  keys_input,
+                                          unsigned int*      digit_counts,
+                                          const unsigned int size,
+                                          const unsigned int blocks,
+                                          const unsigned int begin_bit,
+                                          const unsigned int bits)
+{
+    using key_type = typename std::iterator_traits<KeysInputIterator>::value_type;
+
+    ROCPRIM_SHARED_MEMORY unsigned int counts[1u << radix_sort_counting_max_bits];
+
+    const unsigned int flat_id     = block_thread_id<0>();
+    const unsigned int block_index = block_id<0>();
+    const unsigned int digits      = 1u << bits;
+    for(unsigned int digit = flat_id; digit < digits; digit += radix_sort_counting_block_size)
+    {
+        counts[digit] = 0;
+    }
+    ::rocprim::syncthreads();
+
+    unsigned int tile_begin;
+    unsigned int tile_end;
+    radix_sort_counting_tiles(block_index, blocks, size, tile_begin, tile_end);
+    const unsigned int end = ::rocprim::min(tile_end * radix_sort_counting_items_per_tile, size);
+    for(unsigned int i = tile_begin * radix_sort_counting_items_per_tile + flat_id; i < end;
+        i += radix_sort_counting_block_size)
+    {
+        const unsigned int digit
+            = radix_sort_counting_digit<Descending>(static_cast<key_type>(keys_input[i]),
+                                                    begin_bit,
+                                                    bits);
+        ::rocprim::detail::atomic_add(&counts[digit], 1u);
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int digit = flat_id; digit < digits; digit += radix_sort_counting_block_size)
+    {
+        digit_counts[digit * blocks + block_index] = counts[digit];
+    }
+}
+
+template<bool Descending, class Sort, class Key, class Value, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void radix_sort_counting_block_sort(Key (&keys)[ItemsPerThread],
+                                    Value (&values)[ItemsPerThread],
+                                    typename Sort::storage_type& storage,
+                                    const unsigned int           begin_bit,
+                                    const unsigned int           end_bit)
+{
+    if ROCPRIM_IF_CONSTEXPR(Descending)
+    {
+        Sort().sort_desc(keys, values, storage, begin_bit, end_bit);
+    }
+    else
+    {
+        Sort().sort(keys, values, storage, begin_bit, end_bit);
+    }
+}
+
+template<bool Descending, class Sort, class Key, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void radix_sort_counting_block_sort(Key (&keys)[ItemsPerThread],
+                                    empty_type (&)[ItemsPerThread],
+                                    typename Sort::storage_type& storage,
+                                    const unsigned int           begin_bit,
+                                    const unsigned int           end_bit)
+{
+    if ROCPRIM_IF_CONSTEXPR(Descending)
+    {
+        Sort().sort_desc(keys, storage, begin_bit, end_bit);
+    }
+    else
+    {
+        Sort().sort(keys, storage, begin_bit, end_bit);
+    }
+}
+
+// Scatters the chunk of tiles of the block, tile after tile. Every tile is sorted in shared
+// memory by the bit range, which is its digit, so the items of a digit are contiguous in the
+// sorted tile and keep their order. An item at sorted position p of the run of its digit starting
+// at position h goes to the next output position of the digit plus p - h, and each run then
+// advances the output position of its digit by its length.
+template<bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+ROCPRIM_KERNEL __launch_bounds__(radix_sort_counting_block_size)
+void radix_sort_counting_scatter_kernel(KeysInputIterator    keys_input,
+                                        KeysOutputIterator   keys_output,
+                                        ValuesInputIterator  values_input,
+                                        ValuesOutputIterator values_output,
+                                        const unsigned int*  digit_offsets,
+                                        const unsigned int   size,
+                                        const unsigned int   blocks,
+                                        const unsigned int   begin_bit,
+                                        const unsigned int   bits)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    constexpr unsigned int block_size       = radix_sort_counting_block_size;
+    constexpr unsigned int items_per_thread = radix_sort_counting_items_per_thread;
+    constexpr unsigned int items_per_tile   = radix_sort_counting_items_per_tile;
+    constexpr bool         with_values      = !std::is_same<value_type, empty_type>::value;
+
+    using sort_type          = block_radix_sort<key_type, block_size, items_per_thread, value_type>;
+    using discontinuity_type = block_discontinuity<unsigned int, block_size>;
+
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename sort_type::storage_type          sort;
+        typename discontinuity_type::storage_type discontinuity;
+    } storage;
+    ROCPRIM_SHARED_MEMORY unsigned int offsets[1u << radix_sort_counting_max_bits];
+
+    const unsigned int flat_id     = block_thread_id<0>();
+    const unsigned int block_index = block_id<0>();
+    const unsigned int digits      = 1u << bits;
+    for(unsigned int digit = flat_id; digit < digits; digit += block_size)
+    {
+        offsets[digit] = digit_offsets[digit * blocks + block_index];
+    }
+
+    unsigned int tile_begin;
+    unsigned int tile_end;
+    radix_sort_counting_tiles(block_index, blocks, size, tile_begin, tile_end);
+    for(unsigned int tile = tile_begin; tile < tile_end; ++tile)
+    {
+        const unsigned int tile_offset = tile * items_per_tile;
+        const unsigned int valid       = ::rocprim::min(size - tile_offset, items_per_tile);
+
+        // The out-of-bounds keys are sorted after the valid keys
+        key_type   keys[items_per_thread];
+        value_type values[items_per_thread];
+        block_load_direct_blocked(flat_id,
+                                  keys_input + tile_offset,
+                                  keys,
+                                  valid,
+                                  radix_key_codec<key_type, Descending>::get_out_of_bounds_key());
+        if(with_values)
+        {
+            block_load_direct_blocked(flat_id, values_input + tile_offset, values, valid);
+        }
+
+        // Also orders the loads of offsets and the updates of the previous tile before the heads
+        ::rocprim::syncthreads();
+        radix_sort_counting_block_sort<Descending, sort_type>(keys,
+                                                              values,
+                                                              storage.sort,
+                                                              begin_bit,
+                                                              begin_bit + bits);
+
+        unsigned int digit_values[items_per_thread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; ++i)
+        {
+            digit_values[i] = radix_sort_counting_digit<Descending>(keys[i], begin_bit, bits);
+        }
+        bool heads[items_per_thread];
+        bool tails[items_per_thread];
+        ::rocprim::syncthreads();
+        discontinuity_type().flag_heads_and_tails(heads,
+                                                  tails,
+                                                  digit_values,
+                                                  ::rocprim::not_equal_to<unsigned int>(),
+                                                  storage.discontinuity);
+
+        // The output position of an item is offsets[digit] - head + position
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; ++i)
+        {
+            const unsigned int position = flat_id * items_per_thread + i;
+            if(position < valid && heads[i])
+            {
+                offsets[digit_values[i]] -= position;
+            }
+        }
+        ::rocprim::syncthreads();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; ++i)
+        {
+            const unsigned int position = flat_id * items_per_thread + i;
+            if(position < valid)
+            {
+                const unsigned int output_position = offsets[digit_values[i]] + position;
+                keys_output[output_position]       = keys[i];
+                if(with_values)
+                {
+                    values_output[output_position] = values[i];
+                }
+            }
+        }
+        ::rocprim::syncthreads();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < items_per_thread; ++i)
+        {
+            const unsigned int position = flat_id * items_per_thread + i;
+            if(position < valid && (tails[i] || position + 1 == valid))
+            {
+                offsets[digit_values[i]] += position + 1;
+            }
+        }
+    }
+}
+
+// Sorts the keys over a bit range of at most radix_sort_counting_max_bits bits with a counting
+// sort: the digits of every chunk of tiles are counted, the counts are scanned, and every chunk
+// is scattered in a single pass. Without a double buffer, inputs that may alias the outputs are
+// first copied to the temporary storage, with one the inputs and outputs are distinct buffers.
+template<bool Descending,
+         class KeysInputIterator,
+         class KeysOutputIterator,
+         class ValuesInputIterator,
+         class ValuesOutputIterator>
+inline hipError_t radix_sort_counting_impl(
+    void*                                                           temporary_storage,
+    size_t&                                                         storage_size,
+    KeysInputIterator                                               keys_input,
+    typename std::iterator_traits<KeysInputIterator>::value_type*   keys_tmp,
+    KeysOutputIterator                                              keys_output,
+    ValuesInputIterator                                             values_input,
+    typename std::iterator_traits<ValuesInputIterator>::value_type* /*values_tmp*/,
+    ValuesOutputIterator                                            values_output,
+    const size_t                                                    size,
+    const unsigned int                                              begin_bit,
+    const unsigned int                                              end_bit,
+    const hipStream_t                                               stream,
+    const bool                                                      debug_synchronous)
+{
+    using key_type   = typename std::iterator_traits<KeysInputIterator>::value_type;
+    using value_type = typename std::iterator_traits<ValuesInputIterator>::value_type;
+
+    constexpr bool with_values = !std::is_same<value_type, empty_type>::value;
+
+    if(begin_bit >= end_bit || end_bit - begin_bit > radix_sort_counting_max_bits
+       || end_bit > 8 * sizeof(key_type) || size > std::numeric_limits<unsigned int>::max())
+    {
+        return hipErrorInvalidValue;
+    }
+
+    const unsigned int bits               = end_bit - begin_bit;
+    const unsigned int blocks             = radix_sort_counting_blocks(size, bits);
+    const size_t       counts_size        = static_cast<size_t>(blocks) << bits;
+    const bool         with_double_buffer = keys_tmp != nullptr;
+    const unsigned int items              = static_cast<unsigned int>(size);
+
+    unsigned int* digit_counts  = nullptr;
+    unsigned int* digit_offsets = nullptr;
+    key_type*     keys_copy     = nullptr;
+    value_type*   values_copy   = nullptr;
+    void*         scan_storage;
+    size_t        scan_storage_size = 0;
+    ROCPRIM_RETURN_ON_ERROR(::rocprim::exclusive_scan(nullptr,
+                                                      scan_storage_size,
+                                                      digit_counts,
+                                                      digit_offsets,
+                                                      0u,
+                                                      counts_size,
+                                                      ::rocprim::plus<unsigned int>(),
+                                                      stream,
+                                                      debug_synchronous));
+
+    const hipError_t partition_result = detail::temp_storage::partition(
+        temporary_storage,
+        storage_size,
+        detail::temp_storage::make_linear_partition(
+            detail::temp_storage::ptr_aligned_array(&digit_counts, counts_size),
+            detail::temp_storage::ptr_aligned_array(&digit_offsets, counts_size),
+            detail::temp_storage::ptr_aligned_array(&keys_copy, with_double_buffer ? 0 : size),
+            detail::temp_storage::ptr_aligned_array(&values_copy,
+                                                    with_double_buffer || !with_values ? 0 : size),
+            detail::temp_storage::make_partition(&scan_storage, scan_storage_size)));
+    if(partition_result != hipSuccess || temporary_storage == nullptr)
+    {
+        return partition_result;
+    }
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+    std::chrono::steady_clock::time_point start;
+    if(debug_synchronous)
+    {
+        start = std::chrono::steady_clock::now();
+    }
+    radix_sort_counting_histogram_kernel<Descending>
+        <<<blocks, radix_sort_counting_block_size, 0, stream>>>(keys_input,
+                                                                 digit_counts,
+                                                                 items,
+                                                                 blocks,
+                                                                 begin_bit,
+                                                                 bits);
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_sort_counting_histogram_kernel",
+                                                size,
+                                                start);
+
+    ROCPRIM_RETURN_ON_ERROR(::rocprim::exclusive_scan(scan_storage,
+                                                      scan_storage_size,
+                                                      digit_counts,
+                                                      digit_offsets,
+                                                      0u,
+                                                      counts_size,
+                                                      ::rocprim::plus<unsigned int>(),
+                                                      stream,
+                                                      debug_synchronous));
+
+    const bool keys_alias = can_iterators_alias(keys_input, keys_output, size);
+    const bool values_alias
+        = with_values && can_iterators_alias(values_input, values_output, size);
+    if(!with_double_buffer && (keys_alias || values_alias))
+    {
+        ROCPRIM_RETURN_ON_ERROR(::rocprim::transform(keys_input,
+                                                     keys_copy,
+                                                     size,
+                                                     ::rocprim::identity<key_type>(),
+                                                     stream,
+                                                     debug_synchronous));
+        if(with_values)
+        {
+            ROCPRIM_RETURN_ON_ERROR(::rocprim::transform(values_input,
+                                                         values_copy,
+                                                         size,
+                                                         ::rocprim::identity<value_type>(),
+                                                         stream,
+                                                         debug_synchronous));
+        }
+
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        radix_sort_counting_scatter_kernel<Descending>
+            <<<blocks, radix_sort_counting_block_size, 0, stream>>>(keys_copy,
+                                                                     keys_output,
+                                                                     values_copy,
+                                                                     values_output,
+                                                                     digit_offsets,
+                                                                     items,
+                                                                     blocks,
+                                                                     begin_bit,
+                                                                     bits);
+    }
+    else
+    {
+        if(debug_synchronous)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+        radix_sort_counting_scatter_kernel<Descending>
+            <<<blocks, radix_sort_counting_block_size, 0, stream>>>(keys_input,
+                                                                     keys_output,
+                                                                     values_input,
+                                                                     values_output,
+                                                                     digit_offsets,
+                                                                     items,
+                                                                     blocks,
+                                                                     begin_bit,
+                                                                     bits);
+    }
+    ROCPRIM_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_sort_counting_scatter_kernel", size, start);
+
+    return hipSuccess;
+}
+
+} // end namespace detail
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_DEVICE_SPECIALIZATION_DEVICE_RADIX_COUNTING_SORT_HPP_
@@ -0,0 +1,332 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_TEMP_STORAGE_ARENA_HPP_
+#define ROCPRIM_DEVICE_TEMP_STORAGE_ARENA_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+
+#include <limits>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief A stream-ordered caching allocator for the temporary storage of device algorithms.
+///
+/// The arena serves the temporary storage of device-wide algorithms without a \p hipMalloc and
+/// \p hipFree pair per call. The requested sizes are rounded up to a power of two (a size class),
+/// and released blocks are kept in a cache to serve later requests of the same size class.
+/// Memory is allocated with \p hipMallocAsync, falling back to \p hipMalloc on devices without
+/// stream-ordered allocation support.
+///
+/// \par Overview
+/// * Allocation and deallocation are stream-ordered: a block released on a stream can be reused
+/// right away by later work on the same stream. When a block is reused on another stream, that
+/// stream first waits until the work that used the block on the previous stream is complete.
+/// * Blocks are cached per device, the one current when they were allocated.
+/// * The arena is thread-safe, so a single arena can be shared by a pipeline of calls.
+/// * Cached blocks are freed by \p release and by the destructor. The destructor must run
+/// before the HIP runtime is torn down.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// rocprim::temp_storage_arena arena;
+///
+/// // Size the temporary storage, allocate it from the arena, run the algorithm and
+/// // return the storage to the arena, all in one call.
+/// rocprim::invoke_with_temp_storage_arena(
+///     arena,
+///     stream,
+///     [&](void* temporary_storage, size_t& storage_size)
+///     {
+///         return rocprim::reduce(temporary_storage, storage_size,
+///                                input, output, input_size,
+///                                rocprim::plus<int>(), stream);
+///     });
+/// \endcode
+/// \endparblock
+class temp_storage_arena
+{
+public:
+    /// \brief Creates an empty arena.
+    /// \param max_cached_bytes [optional] upper bound on the total size of the cached blocks.
+    /// Blocks released beyond this bound are freed instead of cached. Default is no bound.
+    explicit temp_storage_arena(size_t max_cached_bytes = std::numeric_limits<size_t>::max())
+        : max_cached_bytes_(max_cached_bytes)
+    {}
+
+    temp_storage_arena(const temp_storage_arena&)            = delete;
+    temp_storage_arena& operator=(const temp_storage_arena&) = delete;
+
+    /// \brief Frees the cached blocks. Blocks that are still allocated are not freed.
+    ~temp_storage_arena()
+    {
+        (void)release();
+    }
+
+    /// \brief Allocates a block of temporary storage described by \p storage_layout.
+    ///
+    /// \param [out] storage the allocated storage.
+    /// \param [in] storage_layout the required size and alignment.
+    /// \param [in] stream the stream on which the storage will be used.
+    /// \returns \p hipSuccess (\p 0) after successful allocation; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    hipError_t allocate(void**                             storage,
+                        const detail::temp_storage::layout storage_layout,
+                        const hipStream_t                  stream)
+    {
+        const size_t alignment = storage_layout.alignment < detail::temp_storage::default_alignment
+                                     ? detail::temp_storage::default_alignment
+                                     : storage_layout.alignment;
+        // hipMalloc already aligns to the default alignment, larger alignments need padding.
+        const size_t padding = alignment - detail::temp_storage::default_alignment;
+        const size_t bytes   = size_class(storage_layout.size + padding);
+
+        int device;
+        ROCPRIM_RETURN_ON_ERROR(hipGetDevice(&device));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        block b;
+        if(!take_cached(device, bytes, stream, b))
+        {
+            b.bytes  = bytes;
+            b.device = device;
+            b.async  = use_async_;
+            if(b.async)
+            {
+                const hipError_t error = hipMallocAsync(&b.base, bytes, stream);
+                if(error == hipErrorNotSupported)
+                {
+                    // Clear the error state and use the synchronous allocator from now on.
+                    (void)hipGetLastError();
+                    use_async_ = false;
+                    b.async    = false;
+                }
+                else if(error != hipSuccess)
+                {
+                    return error;
+                }
+            }
+            if(!b.async)
+            {
+                ROCPRIM_RETURN_ON_ERROR(hipMalloc(&b.base, bytes));
+            }
+        }
+        b.stream = stream;
+
+        const uintptr_t base    = reinterpret_cast<uintptr_t>(b.base);
+        void* const     aligned = reinterpret_cast<void*>((base + alignment - 1) / alignment
+                                                      * alignment);
+        live_.emplace(aligned, b);
+        *storage = aligned;
+        return hipSuccess;
+    }
+
+    /// \brief Returns a block of temporary storage to the arena.
+    ///
+    /// \param [in] storage storage returned by \p allocate.
+    /// \param [in] stream the stream of the last work that uses the storage. The block is reused
+    /// only after this work.
+    /// \returns \p hipSuccess (\p 0) after successful deallocation; otherwise a HIP runtime error
+    /// of type \p hipError_t.
+    hipError_t deallocate(void* storage, const hipStream_t stream)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        const auto it = live_.find(storage);
+        if(it == live_.end())
+        {
+            return hipErrorInvalidValue;
+        }
+        block b = it->second;
+        live_.erase(it);
+        b.stream = stream;
+
+        if(cached_bytes_ + b.bytes > max_cached_bytes_)
+        {
+            return free_block(b);
+        }
+
+        // Remember when the last work on the block is done, to reuse it on other streams.
+        if(b.ready == nullptr)
+        {
+            ROCPRIM_RETURN_ON_ERROR(hipEventCreateWithFlags(&b.ready, hipEventDisableTiming));
+        }
+        ROCPRIM_RETURN_ON_ERROR(hipEventRecord(b.ready, stream));
+
+        cached_bytes_ += b.bytes;
+        cached_.emplace(b.bytes, b);
+        return hipSuccess;
+    }
+
+    /// \brief Frees all cached blocks.
+    /// \returns \p hipSuccess (\p 0) after successful release; otherwise the first HIP runtime
+    /// error of type \p hipError_t.
+    hipError_t release()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        hipError_t result = hipSuccess;
+        for(auto& entry : cached_)
+        {
+            const hipError_t error = free_block(entry.second);
+            result                 = result != hipSuccess ? result : error;
+        }
+        cached_.clear();
+        cached_bytes_ = 0;
+        return result;
+    }
+
+    /// \brief Returns the total size of the cached blocks, in bytes.
+    size_t cached_bytes() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return cached_bytes_;
+    }
+
+private:
+    struct block
+    {
+        void*       base   = nullptr;
+        size_t      bytes  = 0;
+        int         device = 0;
+        hipStream_t stream = 0;
+        hipEvent_t  ready  = nullptr;
+        bool        async  = true;
+    };
+
+    static size_t size_class(const size_t size)
+    {
+        size_t bytes = detail::temp_storage::default_alignment;
+        while(bytes < size)
+        {
+            bytes *= 2;
+        }
+        return bytes;
+    }
+
+    // Takes a cached block of the size class, preferring one last used on the same stream.
+    bool take_cached(const int device, const size_t bytes, const hipStream_t stream, block& b)
+    {
+        const auto range = cached_.equal_range(bytes);
+        auto       found = cached_.end();
+        for(auto it = range.first; it != range.second; ++it)
+        {
+            if(it->second.device != device)
+            {
+                continue;
+            }
+            if(it->second.stream == stream)
+            {
+                found = it;
+                break;
+            }
+            if(found == cached_.end())
+            {
+                found = it;
+            }
+        }
+        if(found == cached_.end())
+        {
+            return false;
+        }
+
+        b = found->second;
+        cached_.erase(found);
+        cached_bytes_ -= b.bytes;
+        if(b.stream != stream && hipStreamWaitEvent(stream, b.ready, 0) != hipSuccess)
+        {
+            // The block cannot be ordered after its previous use, so it is not reused.
+            (void)free_block(b);
+            return false;
+        }
+        return true;
+    }
+
+    hipError_t free_block(block& b)
+    {
+        hipError_t result = hipSuccess;
+        if(b.ready != nullptr)
+        {
+            result  = hipEventDestroy(b.ready);
+            b.ready = nullptr;
+        }
+        const hipError_t error = b.async ? hipFreeAsync(b.base, b.stream) : hipFree(b.base);
+        return result != hipSuccess ? result : error;
+    }
+
+    mutable std::mutex               mutex_;
+    std::multimap<size_t, block>     cached_;
+    std::unordered_map<void*, block> live_;
+    size_t                           cached_bytes_ = 0;
+    size_t                           max_cached_bytes_;
+    bool                             use_async_ = true;
+};
+
+/// \brief Runs a device algorithm with temporary storage from a \p temp_storage_arena.
+///
+/// \p function is called as <tt>function(void* temporary_storage, size_t& storage_size)</tt>,
+/// following the two-phase temporary storage protocol of the device algorithms: first with a null
+/// pointer to query the size, and then with storage of that size taken from \p arena. The storage
+/// is returned to \p arena on \p stream afterwards, so it can be reused by the next call.
+///
+/// \param [in] arena the arena that provides the storage.
+/// \param [in] stream the stream on which \p function enqueues its work.
+/// \param [in] function the algorithm invocation.
+/// \returns the result of \p function, or a HIP runtime error of type \p hipError_t if the
+/// storage could not be allocated.
+template<class Function>
+hipError_t invoke_with_temp_storage_arena(temp_storage_arena& arena,
+                                          const hipStream_t   stream,
+                                          Function&&          function)
+{
+    size_t storage_size = 0;
+    ROCPRIM_RETURN_ON_ERROR(function(static_cast<void*>(nullptr), storage_size));
+
+    void* storage;
+    ROCPRIM_RETURN_ON_ERROR(
+        arena.allocate(&storage, detail::temp_storage::layout{storage_size}, stream));
+
+    const hipError_t result        = function(storage, storage_size);
+    const hipError_t release_error = arena.deallocate(storage, stream);
+    return result != hipSuccess ? result : release_error;
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_TEMP_STORAGE_ARENA_HPP_
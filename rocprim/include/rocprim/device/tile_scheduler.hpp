@@ -0,0 +1,503 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_TILE_SCHEDULER_HPP_
+#define ROCPRIM_DEVICE_TILE_SCHEDULER_HPP_
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+#include "../intrinsics.hpp"
+
+#include "config_types.hpp"
+#include "detail/grid_barrier.hpp"
+#include "execution_budget.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Hands out the tiles of a persistent kernel to its blocks in increasing order, one tile
+/// per atomic operation.
+///
+/// A persistent kernel is launched with only as many blocks as can be resident on the device at
+/// once (see \p get_persistent_grid_size), and every block loops over tiles until the scheduler
+/// runs out of them. The tiles are handed out in the order the blocks ask for them, so a tile is
+/// only started after all preceding tiles have been started, which is the order a decoupled
+/// look-back needs to make progress.
+///
+/// \par Overview
+/// * On the host, \p get_temp_storage_size gives the size of the storage, \p create binds the
+/// storage, and \p initialize resets the counter on a stream before every launch of the kernel.
+/// * In the kernel, all threads of a block call \p next, which returns \p false once all tiles
+/// have been handed out. \p next keeps the state of the block in the object, so the object is
+/// passed to the kernel by value and must be an lvalue that is not copied between the calls.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// __global__ void kernel(rocprim::ordered_tile_scheduler scheduler)
+/// {
+///     __shared__ rocprim::ordered_tile_scheduler::storage_type storage;
+///     unsigned int tile;
+///     while(scheduler.next(tile, storage))
+///     {
+///         // process the tile
+///     }
+/// }
+///
+/// // Host
+/// size_t storage_size = rocprim::ordered_tile_scheduler::get_temp_storage_size();
+/// hipMalloc(&storage, storage_size);
+///
+/// rocprim::ordered_tile_scheduler scheduler;
+/// rocprim::ordered_tile_scheduler::create(scheduler, storage, storage_size, tiles);
+/// scheduler.initialize(stream);
+/// kernel<<<grid_size, 256, 0, stream>>>(scheduler);
+/// \endcode
+/// \endparblock
+class ordered_tile_scheduler
+{
+public:
+    /// The shared memory storage of \p next.
+    struct storage_type
+    {
+        /// The tile of the block, in two slots, so a slot is only written again after all
+        /// threads of the block have read it.
+        unsigned int tile[2];
+    };
+
+    /// \brief Returns the size of the temporary storage in bytes.
+    ROCPRIM_HOST static size_t get_temp_storage_size()
+    {
+        return sizeof(unsigned int);
+    }
+
+    /// \brief Binds temporary storage to a scheduler of \p number_of_tiles tiles.
+    ///
+    /// \param [out] scheduler the created scheduler.
+    /// \param [in] temporary_storage the storage, of at least the size given by
+    /// \p get_temp_storage_size.
+    /// \param [in] storage_size the size of \p temporary_storage in bytes.
+    /// \param [in] number_of_tiles the number of tiles of a launch.
+    /// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if the
+    /// storage is too small.
+    ROCPRIM_HOST static hipError_t create(ordered_tile_scheduler& scheduler,
+                                          void* const             temporary_storage,
+                                          const size_t            storage_size,
+                                          const unsigned int      number_of_tiles)
+    {
+        if(temporary_storage == nullptr || storage_size < get_temp_storage_size())
+        {
+            return hipErrorInvalidValue;
+        }
+        scheduler.counter_         = static_cast<unsigned int*>(temporary_storage);
+        scheduler.number_of_tiles_ = number_of_tiles;
+        scheduler.parity_          = 0;
+        return hipSuccess;
+    }
+
+    /// \brief Resets the counter on \p stream. It must be called before every launch of a kernel
+    /// that uses the scheduler.
+    ///
+    /// \param [in] stream the stream of the kernel that uses the scheduler.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    ROCPRIM_HOST hipError_t initialize(const hipStream_t stream) const
+    {
+        return hipMemsetAsync(counter_, 0, sizeof(unsigned int), stream);
+    }
+
+    /// \brief Gets the next tile of the calling block. It must be called by all threads of the
+    /// block, and synchronizes them.
+    ///
+    /// \param [out] tile the id of the tile, if there is one.
+    /// \param [in] storage the shared memory storage.
+    /// \returns \p false if all tiles have been handed out.
+    ROCPRIM_DEVICE ROCPRIM_INLINE bool next(unsigned int& tile, storage_type& storage)
+    {
+        if(::rocprim::flat_block_thread_id() == 0)
+        {
+            storage.tile[parity_] = ::rocprim::detail::atomic_add(counter_, 1);
+        }
+        ::rocprim::syncthreads();
+        tile = storage.tile[parity_];
+        parity_ ^= 1;
+        return tile < number_of_tiles_;
+    }
+
+    /// \brief Returns the number of tiles of the scheduler.
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE unsigned int number_of_tiles() const
+    {
+        return number_of_tiles_;
+    }
+
+private:
+    unsigned int* counter_         = nullptr;
+    unsigned int  number_of_tiles_ = 0;
+    unsigned int  parity_          = 0;
+};
+
+/// \brief Hands out the tiles of a persistent kernel to its blocks in chunks of \p ChunkSize
+/// consecutive tiles, one atomic operation per chunk.
+///
+/// With small tiles, the atomic operation of every tile of \p ordered_tile_scheduler becomes a
+/// point of contention. Taking \p ChunkSize tiles at once divides the number of atomic
+/// operations by \p ChunkSize, at the cost of a coarser balance of the last tiles. A block
+/// processes the tiles of its chunk in increasing order, and the chunks are handed out in
+/// increasing order, so the preceding tiles of a tile are always started or owned by a running
+/// block, and a decoupled look-back still makes progress.
+///
+/// It is used the same way as \p ordered_tile_scheduler.
+///
+/// \tparam ChunkSize - the number of tiles taken by one atomic operation.
+template<unsigned int ChunkSize>
+class chunked_tile_scheduler
+{
+    static_assert(ChunkSize > 0, "ChunkSize must be greater than 0");
+
+public:
+    /// The number of tiles taken by one atomic operation.
+    static constexpr unsigned int chunk_size = ChunkSize;
+
+    /// The shared memory storage of \p next.
+    using storage_type = ordered_tile_scheduler::storage_type;
+
+    /// \brief Returns the size of the temporary storage in bytes.
+    ROCPRIM_HOST static size_t get_temp_storage_size()
+    {
+        return sizeof(unsigned int);
+    }
+
+    /// \brief Binds temporary storage to a scheduler of \p number_of_tiles tiles.
+    ///
+    /// \param [out] scheduler the created scheduler.
+    /// \param [in] temporary_storage the storage, of at least the size given by
+    /// \p get_temp_storage_size.
+    /// \param [in] storage_size the size of \p temporary_storage in bytes.
+    /// \param [in] number_of_tiles the number of tiles of a launch.
+    /// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if the
+    /// storage is too small.
+    ROCPRIM_HOST static hipError_t create(chunked_tile_scheduler& scheduler,
+                                          void* const             temporary_storage,
+                                          const size_t            storage_size,
+                                          const unsigned int      number_of_tiles)
+    {
+        if(temporary_storage == nullptr || storage_size < get_temp_storage_size())
+        {
+            return hipErrorInvalidValue;
+        }
+        scheduler.counter_         = static_cast<unsigned int*>(temporary_storage);
+        scheduler.number_of_tiles_ = number_of_tiles;
+        scheduler.current_         = 0;
+        scheduler.end_             = 0;
+        scheduler.parity_          = 0;
+        return hipSuccess;
+    }
+
+    /// \brief Resets the counter on \p stream. It must be called before every launch of a kernel
+    /// that uses the scheduler.
+    ///
+    /// \param [in] stream the stream of the kernel that uses the scheduler.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    ROCPRIM_HOST hipError_t initialize(const hipStream_t stream) const
+    {
+        return hipMemsetAsync(counter_, 0, sizeof(unsigned int), stream);
+    }
+
+    /// \brief Gets the next tile of the calling block. It must be called by all threads of the
+    /// block, and synchronizes them when the block takes a new chunk.
+    ///
+    /// \param [out] tile the id of the tile, if there is one.
+    /// \param [in] storage the shared memory storage.
+    /// \returns \p false if all tiles have been handed out.
+    ROCPRIM_DEVICE ROCPRIM_INLINE bool next(unsigned int& tile, storage_type& storage)
+    {
+        if(current_ == end_)
+        {
+            if(::rocprim::flat_block_thread_id() == 0)
+            {
+                storage.tile[parity_] = ::rocprim::detail::atomic_add(counter_, ChunkSize);
+            }
+            ::rocprim::syncthreads();
+            current_ = storage.tile[parity_];
+            parity_ ^= 1;
+            // Once the counter is past the tiles the block stops, the end is never reached
+            end_ = current_ < number_of_tiles_ ? ::rocprim::min(current_ + ChunkSize,
+                                                                number_of_tiles_)
+                                               : current_ + 1;
+        }
+        tile = current_++;
+        return tile < number_of_tiles_;
+    }
+
+    /// \brief Returns the number of tiles of the scheduler.
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE unsigned int number_of_tiles() const
+    {
+        return number_of_tiles_;
+    }
+
+private:
+    unsigned int* counter_         = nullptr;
+    unsigned int  number_of_tiles_ = 0;
+    // The remaining tiles of the chunk of the block
+    unsigned int current_ = 0;
+    unsigned int end_     = 0;
+    unsigned int parity_  = 0;
+};
+
+/// \brief Hands out the tiles of a persistent kernel from one queue per block, where a block
+/// whose queue is empty steals tiles from the queues of other blocks.
+///
+/// The tiles are split into one range of consecutive tiles per block of the grid. A block takes
+/// the tiles of its own range first, which keeps its atomic operations on its own counter and
+/// the tiles of a block contiguous in memory, and then takes the tiles left in the ranges of
+/// the other blocks. This balances tiles of irregular cost, for example the segments of a
+/// segmented algorithm, with little contention.
+///
+/// The tiles are not handed out in increasing order, so the scheduler is not suitable for a
+/// decoupled look-back. The kernel must be launched with the grid size given to \p create,
+/// otherwise it is used the same way as \p ordered_tile_scheduler.
+class work_stealing_tile_scheduler
+{
+public:
+    /// The shared memory storage of \p next.
+    using storage_type = ordered_tile_scheduler::storage_type;
+
+    /// \brief Returns the size of the temporary storage in bytes for a grid of \p grid_size
+    /// blocks.
+    ///
+    /// \param [in] grid_size the number of blocks of the launch.
+    ROCPRIM_HOST static size_t get_temp_storage_size(const unsigned int grid_size)
+    {
+        return sizeof(unsigned int) * grid_size;
+    }
+
+    /// \brief Binds temporary storage to a scheduler of \p number_of_tiles tiles for a grid of
+    /// \p grid_size blocks.
+    ///
+    /// \param [out] scheduler the created scheduler.
+    /// \param [in] temporary_storage the storage, of at least the size given by
+    /// \p get_temp_storage_size.
+    /// \param [in] storage_size the size of \p temporary_storage in bytes.
+    /// \param [in] number_of_tiles the number of tiles of a launch.
+    /// \param [in] grid_size the number of blocks of the launch.
+    /// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if the
+    /// storage is too small or \p grid_size is \p 0.
+    ROCPRIM_HOST static hipError_t create(work_stealing_tile_scheduler& scheduler,
+                                          void* const                   temporary_storage,
+                                          const size_t                  storage_size,
+                                          const unsigned int            number_of_tiles,
+                                          const unsigned int            grid_size)
+    {
+        if(temporary_storage == nullptr || grid_size == 0
+           || storage_size < get_temp_storage_size(grid_size))
+        {
+            return hipErrorInvalidValue;
+        }
+        scheduler.counters_        = static_cast<unsigned int*>(temporary_storage);
+        scheduler.number_of_tiles_ = number_of_tiles;
+        scheduler.grid_size_       = grid_size;
+        scheduler.victim_          = 0;
+        scheduler.parity_          = 0;
+        return hipSuccess;
+    }
+
+    /// \brief Resets the queues on \p stream. It must be called before every launch of a kernel
+    /// that uses the scheduler.
+    ///
+    /// \param [in] stream the stream of the kernel that uses the scheduler.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    ROCPRIM_HOST hipError_t initialize(const hipStream_t stream) const
+    {
+        return hipMemsetAsync(counters_, 0, get_temp_storage_size(grid_size_), stream);
+    }
+
+    /// \brief Gets the next tile of the calling block. It must be called by all threads of the
+    /// block, and synchronizes them.
+    ///
+    /// \param [out] tile the id of the tile, if there is one.
+    /// \param [in] storage the shared memory storage.
+    /// \returns \p false if all tiles have been handed out.
+    ROCPRIM_DEVICE ROCPRIM_INLINE bool next(unsigned int& tile, storage_type& storage)
+    {
+        if(::rocprim::flat_block_thread_id() == 0)
+        {
+            storage.tile[parity_] = take(::rocprim::detail::block_id<0>());
+        }
+        ::rocprim::syncthreads();
+        tile = storage.tile[parity_];
+        parity_ ^= 1;
+        return tile < number_of_tiles_;
+    }
+
+    /// \brief Returns the number of tiles of the scheduler.
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE unsigned int number_of_tiles() const
+    {
+        return number_of_tiles_;
+    }
+
+private:
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int queue_begin(const unsigned int queue) const
+    {
+        return static_cast<unsigned int>(static_cast<unsigned long long>(number_of_tiles_)
+                                         * queue / grid_size_);
+    }
+
+    // Takes a tile of the queue of the block, or else of the following queues. A queue that
+    // is empty stays empty, so the block skips it in the later calls.
+    ROCPRIM_DEVICE ROCPRIM_INLINE unsigned int take(const unsigned int block)
+    {
+        for(; victim_ < grid_size_; ++victim_)
+        {
+            const unsigned int queue
+                = block + victim_ < grid_size_ ? block + victim_ : block + victim_ - grid_size_;
+            const unsigned int begin = queue_begin(queue);
+            const unsigned int size  = queue_begin(queue + 1) - begin;
+            // Check before the atomic operation, so the empty queues are not contended
+            if(::rocprim::detail::atomic_load(&counters_[queue]) >= size)
+            {
+                continue;
+            }
+            const unsigned int taken = ::rocprim::detail::atomic_add(&counters_[queue], 1);
+            if(taken < size)
+            {
+                return begin + taken;
+            }
+        }
+        return number_of_tiles_;
+    }
+
+    unsigned int* counters_        = nullptr;
+    unsigned int  number_of_tiles_ = 0;
+    unsigned int  grid_size_       = 0;
+    // The queue, relative to the one of the block, the block takes its tiles from
+    unsigned int victim_ = 0;
+    unsigned int parity_ = 0;
+};
+
+/// \brief A barrier of all blocks of a grid, for cooperative launches.
+///
+/// The barrier is only correct if all blocks of the grid are resident at once, which
+/// \p hipLaunchCooperativeKernel guarantees on devices for which
+/// \p is_cooperative_launch_supported is \p true, with a grid of at most the size given by
+/// \p get_persistent_grid_size.
+///
+/// \par Overview
+/// * On the host, \p create binds \p storage_size bytes of storage, and \p initialize resets
+/// it on a stream before every launch of the kernel.
+/// * In the kernel, all threads of all blocks call \p sync. The object is passed to the kernel
+/// by value and must be an lvalue that is not copied between the calls, since it counts the
+/// barriers the block has passed. The arrivals of all barriers of a launch, the number of
+/// barriers times the grid size, must fit in an <tt>unsigned int</tt>.
+class grid_barrier
+{
+public:
+    /// The size of the temporary storage of a barrier in bytes.
+    static constexpr size_t storage_size = detail::grid_barrier::storage_size;
+
+    /// \brief Creates a barrier without storage, which must be bound by \p create before use.
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE grid_barrier() : barrier_(nullptr) {}
+
+    /// \brief Binds temporary storage to a barrier.
+    ///
+    /// \param [out] barrier the created barrier.
+    /// \param [in] temporary_storage the storage, of at least \p storage_size bytes.
+    /// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if
+    /// \p temporary_storage is \p nullptr.
+    ROCPRIM_HOST static hipError_t create(grid_barrier& barrier, void* const temporary_storage)
+    {
+        if(temporary_storage == nullptr)
+        {
+            return hipErrorInvalidValue;
+        }
+        barrier.barrier_ = detail::grid_barrier(static_cast<unsigned int*>(temporary_storage));
+        return hipSuccess;
+    }
+
+    /// \brief Resets the barrier on \p stream. It must be called before every launch of a kernel
+    /// that uses the barrier.
+    ///
+    /// \param [in] stream the stream of the kernel that uses the barrier.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    ROCPRIM_HOST hipError_t initialize(const hipStream_t stream) const
+    {
+        return hipMemsetAsync(barrier_.counter, 0, storage_size, stream);
+    }
+
+    /// \brief Waits until all threads of the grid have reached the barrier. The writes to global
+    /// memory before the barrier are visible to all threads of the grid after it.
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sync()
+    {
+        barrier_.sync();
+    }
+
+private:
+    detail::grid_barrier barrier_;
+};
+
+/// \brief Returns whether the device of \p stream supports cooperative launches, which
+/// \p grid_barrier requires.
+///
+/// \param [in] stream the stream of the launches.
+/// \param [out] supported whether \p hipLaunchCooperativeKernel can be used.
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+inline hipError_t is_cooperative_launch_supported(const hipStream_t stream, bool& supported)
+{
+    detail::device_properties properties;
+    ROCPRIM_RETURN_ON_ERROR(detail::get_device_properties(stream, properties));
+    supported = properties.cooperative_launch;
+    return hipSuccess;
+}
+
+/// \brief Returns the grid size of a persistent kernel: the number of blocks of \p kernel
+/// that can be resident at once on the device of \p stream, limited to the block budget of
+/// \p stream (see \p set_stream_block_budget).
+///
+/// \param [in] kernel the kernel.
+/// \param [in] block_size the number of threads of a block of the launch.
+/// \param [in] stream the stream of the launch.
+/// \param [out] grid_size the number of blocks.
+/// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+/// type \p hipError_t.
+template<class Kernel>
+inline hipError_t get_persistent_grid_size(Kernel             kernel,
+                                           const unsigned int block_size,
+                                           const hipStream_t  stream,
+                                           unsigned int&      grid_size)
+{
+    return detail::persistent_grid_size(kernel, block_size, stream, grid_size);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_TILE_SCHEDULER_HPP_
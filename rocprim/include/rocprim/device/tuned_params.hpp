@@ -0,0 +1,331 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_TUNED_PARAMS_HPP_
+#define ROCPRIM_DEVICE_TUNED_PARAMS_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../type_traits.hpp"
+#include "../types.hpp"
+
+#include "config_types.hpp"
+#include "device_merge_sort_config.hpp"
+#include "device_radix_sort_config.hpp"
+#include "device_reduce_config.hpp"
+#include "device_scan_config.hpp"
+#include "device_transform_config.hpp"
+
+#include <hip/hip_runtime.h>
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief Tags of the device algorithms whose tuned parameters \p tuned_params queries.
+namespace tuned
+{
+
+/// \brief The kernel of \p transform.
+struct transform
+{};
+
+/// \brief The reduction kernel of \p reduce.
+struct reduce
+{};
+
+/// \brief The kernel of \p inclusive_scan and \p exclusive_scan.
+struct scan
+{};
+
+/// \brief The kernel of \p radix_sort_keys and \p radix_sort_pairs that sorts single blocks.
+/// \tparam Value - the type of the values, \p empty_type when only keys are sorted.
+template<class Value = empty_type>
+struct radix_sort_block_sort
+{};
+
+/// \brief The onesweep sorting kernel of \p radix_sort_keys and \p radix_sort_pairs.
+/// \tparam Value - the type of the values, \p empty_type when only keys are sorted.
+template<class Value = empty_type>
+struct radix_sort_onesweep
+{};
+
+/// \brief The block sort kernel of \p merge_sort.
+/// \tparam Value - the type of the values, \p empty_type when only keys are sorted.
+template<class Value = empty_type>
+struct merge_sort_block_sort
+{};
+
+} // namespace tuned
+
+namespace detail
+{
+
+// The architecture of a ROCPRIM_TARGET_ARCH value, the architectures without tuned configs
+// (including 0) take the configs of target_arch::unknown.
+constexpr target_arch tuned_target_arch(const unsigned int arch)
+{
+    constexpr target_arch tuned_architectures[] = {target_arch::gfx803,
+                                                   target_arch::gfx900,
+                                                   target_arch::gfx906,
+                                                   target_arch::gfx908,
+                                                   target_arch::gfx90a,
+                                                   target_arch::gfx942,
+                                                   target_arch::gfx1030,
+                                                   target_arch::gfx1100,
+                                                   target_arch::gfx1102};
+    for(const target_arch tuned_arch : tuned_architectures)
+    {
+        if(static_cast<unsigned int>(tuned_arch) == arch)
+        {
+            return dispatched_target_arch(tuned_arch);
+        }
+    }
+    return target_arch::unknown;
+}
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+struct tuned_tile_params
+{
+    static constexpr unsigned int block_size       = BlockSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+    static constexpr unsigned int items_per_block  = BlockSize * ItemsPerThread;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+constexpr unsigned int tuned_tile_params<BlockSize, ItemsPerThread>::block_size;
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+constexpr unsigned int tuned_tile_params<BlockSize, ItemsPerThread>::items_per_thread;
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+constexpr unsigned int tuned_tile_params<BlockSize, ItemsPerThread>::items_per_block;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+template<class Algorithm, class T, target_arch Arch>
+struct tuned_algorithm_params;
+
+template<class T, target_arch Arch>
+struct tuned_algorithm_params<tuned::transform, T, Arch>
+    : tuned_tile_params<
+          wrapped_transform_config<default_config,
+                                   T>::template architecture_config<Arch>::params.kernel_config
+              .block_size,
+          wrapped_transform_config<default_config,
+                                   T>::template architecture_config<Arch>::params.kernel_config
+              .items_per_thread>
+{};
+
+template<class T, target_arch Arch>
+struct tuned_algorithm_params<tuned::reduce, T, Arch>
+    : tuned_tile_params<
+          wrapped_reduce_config<default_config,
+                                T>::template architecture_config<Arch>::params.reduce_config
+              .block_size,
+          wrapped_reduce_config<default_config,
+                                T>::template architecture_config<Arch>::params.reduce_config
+              .items_per_thread>
+{
+    static constexpr block_reduce_algorithm block_reduce_method
+        = wrapped_reduce_config<default_config,
+                                T>::template architecture_config<Arch>::params.block_reduce_method;
+};
+
+template<class T, target_arch Arch>
+struct tuned_algorithm_params<tuned::scan, T, Arch>
+    : tuned_tile_params<
+          wrapped_scan_config<default_config,
+                              T>::template architecture_config<Arch>::params.kernel_config
+              .block_size,
+          wrapped_scan_config<default_config,
+                              T>::template architecture_config<Arch>::params.kernel_config
+              .items_per_thread>
+{
+    using config = typename wrapped_scan_config<default_config,
+                                                T>::template architecture_config<Arch>;
+
+    static constexpr ::rocprim::block_load_method  block_load_method
+        = config::params.block_load_method;
+    static constexpr ::rocprim::block_store_method block_store_method
+        = config::params.block_store_method;
+    static constexpr ::rocprim::block_scan_algorithm block_scan_method
+        = config::params.block_scan_method;
+};
+
+template<class Value, class Key, target_arch Arch>
+struct tuned_algorithm_params<tuned::radix_sort_block_sort<Value>, Key, Arch>
+    : tuned_tile_params<wrapped_radix_sort_block_sort_config<default_config, Key, Value>::
+                            template architecture_config<Arch>::params.block_size,
+                        wrapped_radix_sort_block_sort_config<default_config, Key, Value>::
+                            template architecture_config<Arch>::params.items_per_thread>
+{};
+
+template<class Value, class Key, target_arch Arch>
+struct tuned_algorithm_params<tuned::radix_sort_onesweep<Value>, Key, Arch>
+    : tuned_tile_params<wrapped_radix_sort_onesweep_config<default_config, Key, Value>::
+                            template architecture_config<Arch>::params.sort.block_size,
+                        wrapped_radix_sort_onesweep_config<default_config, Key, Value>::
+                            template architecture_config<Arch>::params.sort.items_per_thread>
+{
+    using config = typename wrapped_radix_sort_onesweep_config<default_config, Key, Value>::
+        template architecture_config<Arch>;
+
+    static constexpr unsigned int radix_bits_per_place = config::params.radix_bits_per_place;
+    static constexpr block_radix_rank_algorithm radix_rank_algorithm
+        = config::params.radix_rank_algorithm;
+};
+
+template<class Value, class Key, target_arch Arch>
+struct tuned_algorithm_params<tuned::merge_sort_block_sort<Value>, Key, Arch>
+    : tuned_tile_params<wrapped_merge_sort_block_sort_config<default_config, Key, Value>::
+                            template architecture_config<Arch>::params.block_sort_config
+                                .block_size,
+                        wrapped_merge_sort_block_sort_config<default_config, Key, Value>::
+                            template architecture_config<Arch>::params.block_sort_config
+                                .items_per_thread>
+{};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class T, target_arch Arch>
+constexpr block_reduce_algorithm
+    tuned_algorithm_params<tuned::reduce, T, Arch>::block_reduce_method;
+template<class T, target_arch Arch>
+constexpr ::rocprim::block_load_method
+    tuned_algorithm_params<tuned::scan, T, Arch>::block_load_method;
+template<class T, target_arch Arch>
+constexpr ::rocprim::block_store_method
+    tuned_algorithm_params<tuned::scan, T, Arch>::block_store_method;
+template<class T, target_arch Arch>
+constexpr ::rocprim::block_scan_algorithm
+    tuned_algorithm_params<tuned::scan, T, Arch>::block_scan_method;
+template<class Value, class Key, target_arch Arch>
+constexpr unsigned int
+    tuned_algorithm_params<tuned::radix_sort_onesweep<Value>, Key, Arch>::radix_bits_per_place;
+template<class Value, class Key, target_arch Arch>
+constexpr block_radix_rank_algorithm
+    tuned_algorithm_params<tuned::radix_sort_onesweep<Value>, Key, Arch>::radix_rank_algorithm;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+// The tile shapes of tuned_algorithm_params for dispatch_target_arch.
+template<class Algorithm, class T>
+struct tuned_launch_config
+{
+    template<target_arch Arch>
+    struct architecture_config
+    {
+        static constexpr kernel_config_params params
+            = {tuned_algorithm_params<Algorithm, T, Arch>::block_size,
+               tuned_algorithm_params<Algorithm, T, Arch>::items_per_thread};
+    };
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class Algorithm, class T>
+template<target_arch Arch>
+constexpr kernel_config_params
+    tuned_launch_config<Algorithm, T>::architecture_config<Arch>::params;
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+} // namespace detail
+
+/// \brief The tuned parameters of a device algorithm, for custom kernels built of block-level
+/// primitives that use the tile shapes rocPRIM tunes for the architecture.
+///
+/// The parameters are the ones of \p default_config of the algorithm for the type \p T, so they
+/// follow the tuning of new rocPRIM releases. Every specialization has the members
+/// * \p block_size - the number of threads in a block,
+/// * \p items_per_thread - the number of items processed by every thread,
+/// * \p items_per_block - <tt>block_size * items_per_thread</tt>,
+///
+/// and the methods of the block-level primitives the algorithm uses:
+/// * \p tuned::reduce - \p block_reduce_method,
+/// * \p tuned::scan - \p block_load_method, \p block_store_method and \p block_scan_method,
+/// * \p tuned::radix_sort_onesweep - \p radix_bits_per_place and \p radix_rank_algorithm.
+///
+/// \par Host and device compilation
+/// \p Arch defaults to \p ROCPRIM_TARGET_ARCH, which is the architecture being compiled for in
+/// the device compilation and 0 on the host, where the parameters are the generic ones of
+/// architectures without tuned configs. Kernels use the parameters of the default \p Arch, and
+/// their launches on the host query the same parameters of the device with
+/// \p get_tuned_launch_params(). When the program is only compiled for one architecture, \p Arch
+/// can also be given explicitly to use the same parameters in both compilations.
+///
+/// \tparam Algorithm - the algorithm, one of the tags of namespace \p tuned.
+/// \tparam T - the type of the values (or of the keys of sorts) the kernel processes.
+/// \tparam Arch - the \p ROCPRIM_TARGET_ARCH value of the architecture.
+///
+/// \par Example
+/// \code{.cpp}
+/// using params = rocprim::tuned_params<rocprim::tuned::scan, float>;
+///
+/// __global__ __launch_bounds__(params::block_size) void kernel(float* data)
+/// {
+///     using block_scan
+///         = rocprim::block_scan<float, params::block_size, params::block_scan_method>;
+///     float values[params::items_per_thread];
+///     // ...
+/// }
+/// \endcode
+template<class Algorithm, class T, unsigned int Arch = ROCPRIM_TARGET_ARCH>
+struct tuned_params
+    : detail::tuned_algorithm_params<Algorithm, T, detail::tuned_target_arch(Arch)>
+{};
+
+/// \brief The tile shape of \p tuned_params of a device, for the launches of kernels that use
+/// \p tuned_params.
+struct tuned_launch_params
+{
+    /// \brief Number of threads in a block.
+    unsigned int block_size;
+    /// \brief Number of items processed by each thread.
+    unsigned int items_per_thread;
+};
+
+/// \brief Queries the tile shape of \p tuned_params of the device of \p stream on the host.
+///
+/// The shape is the one of <tt>tuned_params<Algorithm, T></tt> in the device compilation for the
+/// architecture of the device, so the launches match the kernels using \p tuned_params.
+///
+/// \tparam Algorithm - the algorithm, one of the tags of namespace \p tuned.
+/// \tparam T - the type of the values (or of the keys of sorts) the kernel processes.
+///
+/// \param [out] params - the tile shape of the device.
+/// \param [in] stream - the stream whose device is queried.
+///
+/// \returns \p hipSuccess (\p 0) after a successful query, otherwise the HIP error of querying
+/// the device.
+template<class Algorithm, class T>
+inline hipError_t get_tuned_launch_params(tuned_launch_params& params,
+                                          const hipStream_t    stream = 0)
+{
+    detail::target_arch arch;
+    ROCPRIM_RETURN_ON_ERROR(detail::host_target_arch(stream, arch));
+    const detail::kernel_config_params config
+        = detail::dispatch_target_arch<detail::tuned_launch_config<Algorithm, T>>(arch);
+    params.block_size       = config.block_size;
+    params.items_per_thread = config.items_per_thread;
+    return hipSuccess;
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_TUNED_PARAMS_HPP_
@@ -0,0 +1,495 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_DEVICE_TUNING_DATABASE_HPP_
+#define ROCPRIM_DEVICE_TUNING_DATABASE_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../types.hpp"
+#include "config_types.hpp"
+#include "execution_budget.hpp"
+
+#include <fstream>
+#include <initializer_list>
+#include <istream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdlib>
+
+/// \addtogroup primitivesmodule_deviceconfigs
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief A kernel config that selects one of its \p Candidates at run time.
+///
+/// All candidates are compiled in. On each call, the candidate is looked up in the tuning
+/// database (see \p load_tuning_database) by algorithm, device architecture, key and value
+/// type and input size. The first candidate is used when the database has no matching entry.
+///
+/// \tparam Candidates the configs to choose from, for example \p reduce_config or
+/// \p default_config.
+template<class... Candidates>
+struct tuned_config
+{
+    static_assert(sizeof...(Candidates) > 0, "tuned_config needs at least one candidate");
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    static constexpr size_t candidate_count = sizeof...(Candidates);
+#endif
+};
+
+/// \brief A kernel config that selects one of two configs at compile time by input size.
+///
+/// Calls with at most \p MaxSmallSize items use \p SmallConfig, larger calls use
+/// \p LargeConfig. Both configs are compiled in, and either of them can be another
+/// \p size_bucketed_config, which makes up more buckets, e.g. tiny, medium and huge inputs. Unlike
+/// \p tuned_config it needs no tuning database. It is accepted by every algorithm that accepts
+/// a \p tuned_config, and the configs of its buckets may be \p tuned_config.
+///
+/// \tparam MaxSmallSize the largest input size that uses \p SmallConfig.
+/// \tparam SmallConfig the config of small inputs, for example \p scan_config or
+/// \p default_config.
+/// \tparam LargeConfig the config of large inputs.
+template<size_t MaxSmallSize, class SmallConfig, class LargeConfig>
+struct size_bucketed_config
+{
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    static constexpr size_t max_small_size = MaxSmallSize;
+    using small_config                     = SmallConfig;
+    using large_config                     = LargeConfig;
+#endif
+};
+
+namespace detail
+{
+
+template<class Config>
+struct is_tuned_config : std::false_type
+{};
+
+template<class Config>
+struct is_size_bucketed_config : std::false_type
+{};
+
+template<size_t MaxSmallSize, class SmallConfig, class LargeConfig>
+struct is_size_bucketed_config<size_bucketed_config<MaxSmallSize, SmallConfig, LargeConfig>>
+    : std::true_type
+{};
+
+template<class... Candidates>
+struct is_tuned_config<tuned_config<Candidates...>> : std::true_type
+{};
+
+template<class Config>
+struct config_tag
+{
+    using type = Config;
+};
+
+// The names of the types in the tuning database, these follow the names used by the tuning
+// scripts. Types without a name only match wildcard entries.
+template<class T, class Enable = void>
+struct tuning_type_name
+{
+    static const char* get()
+    {
+        return nullptr;
+    }
+};
+
+template<>
+struct tuning_type_name<empty_type>
+{
+    static const char* get()
+    {
+        return "-";
+    }
+};
+
+template<class T>
+struct tuning_type_name<T, std::enable_if_t<std::is_integral<T>::value>>
+{
+    static const char* get()
+    {
+        if(std::is_signed<T>::value)
+        {
+            return sizeof(T) == 1   ? "int8_t"
+                   : sizeof(T) == 2 ? "short"
+                   : sizeof(T) == 4 ? "int"
+                   : sizeof(T) == 8 ? "int64_t"
+                                    : nullptr;
+        }
+        return sizeof(T) == 1   ? "uint8_t"
+               : sizeof(T) == 2 ? "uint16_t"
+               : sizeof(T) == 4 ? "uint32_t"
+               : sizeof(T) == 8 ? "uint64_t"
+                                : nullptr;
+    }
+};
+
+#define ROCPRIM_DETAIL_TUNING_TYPE_NAME(type, name) \
+    template<>                                      \
+    struct tuning_type_name<type>                   \
+    {                                               \
+        static const char* get()                    \
+        {                                           \
+            return name;                            \
+        }                                           \
+    }
+
+ROCPRIM_DETAIL_TUNING_TYPE_NAME(float, "float");
+ROCPRIM_DETAIL_TUNING_TYPE_NAME(double, "double");
+ROCPRIM_DETAIL_TUNING_TYPE_NAME(::rocprim::half, "rocprim::half");
+ROCPRIM_DETAIL_TUNING_TYPE_NAME(::rocprim::bfloat16, "rocprim::bfloat16");
+ROCPRIM_DETAIL_TUNING_TYPE_NAME(::rocprim::fp8_e4m3, "rocprim::fp8_e4m3");
+ROCPRIM_DETAIL_TUNING_TYPE_NAME(::rocprim::fp8_e5m2, "rocprim::fp8_e5m2");
+
+#undef ROCPRIM_DETAIL_TUNING_TYPE_NAME
+
+/// \brief The process-wide table that maps algorithm invocations to tuned config candidates.
+///
+/// Each non-empty line of the database holds one entry of six fields separated by whitespace,
+/// and \p # starts a comment:
+///
+/// <tt>algorithm arch key_type value_type min_size candidate</tt>
+///
+/// \p arch, \p key_type and \p value_type may be \p * to match anything, and \p value_type is
+/// \p - for algorithms without values. An optional seventh field <tt>shared_memory=bytes</tt>
+/// records the shared memory per block of the candidate, entries without it fit any shared
+/// memory budget. Among the matching entries with \p min_size at most the input size and
+/// \p shared_memory within the budget, the entry with the largest \p min_size is chosen, then
+/// the one with the largest \p shared_memory, and later entries take precedence over earlier
+/// ones.
+class tuning_database
+{
+public:
+    static tuning_database& instance()
+    {
+        static tuning_database database;
+        return database;
+    }
+
+    hipError_t load(const char* filename)
+    {
+        std::vector<entry> entries;
+        ROCPRIM_RETURN_ON_ERROR(read_file(filename, entries));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_ = std::move(entries);
+        loaded_  = true;
+        return hipSuccess;
+    }
+
+    hipError_t parse(std::istream& stream)
+    {
+        std::vector<entry> entries;
+        ROCPRIM_RETURN_ON_ERROR(parse_entries(stream, entries));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_ = std::move(entries);
+        loaded_  = true;
+        return hipSuccess;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+        loaded_ = true;
+    }
+
+    // Returns the index of the candidate for the invocation, in [0, candidate_count).
+    // `max_shared_memory` is the shared memory budget of the invocation, 0 if it is not limited.
+    size_t select(const char*       algorithm,
+                  const target_arch arch,
+                  const char*       key_type,
+                  const char*       value_type,
+                  const size_t      size,
+                  const size_t      candidate_count,
+                  const size_t      max_shared_memory = 0)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if(!loaded_)
+        {
+            // The database named by the environment is loaded on first use. If it cannot be
+            // read, the default candidates are used.
+            loaded_                  = true;
+            const char* const source = std::getenv("ROCPRIM_TUNING_DATABASE");
+            if(source != nullptr)
+            {
+                (void)read_file(source, entries_);
+            }
+        }
+
+        const entry* best = nullptr;
+        for(const entry& e : entries_)
+        {
+            if(e.algorithm == algorithm && (e.any_arch || e.arch == arch)
+               && matches(e.key_type, key_type) && matches(e.value_type, value_type)
+               && e.min_size <= size
+               && (max_shared_memory == 0 || e.shared_memory <= max_shared_memory)
+               && (best == nullptr || e.min_size > best->min_size
+                   || (e.min_size == best->min_size && e.shared_memory >= best->shared_memory)))
+            {
+                best = &e;
+            }
+        }
+        return best != nullptr && best->candidate < candidate_count ? best->candidate : 0;
+    }
+
+private:
+    struct entry
+    {
+        std::string algorithm;
+        target_arch arch;
+        bool        any_arch;
+        std::string key_type;
+        std::string value_type;
+        size_t      min_size;
+        size_t      candidate;
+        // The shared memory per block of the candidate, 0 if it is not known.
+        size_t      shared_memory;
+    };
+
+    tuning_database() = default;
+
+    static bool matches(const std::string& pattern, const char* name)
+    {
+        return pattern == "*" || (name != nullptr && pattern == name);
+    }
+
+    static hipError_t read_file(const char* filename, std::vector<entry>& entries)
+    {
+        std::ifstream file(filename);
+        if(!file)
+        {
+            return hipErrorFileNotFound;
+        }
+        return parse_entries(file, entries);
+    }
+
+    static hipError_t parse_entries(std::istream& stream, std::vector<entry>& entries)
+    {
+        std::vector<entry> result;
+        std::string        line;
+        while(std::getline(stream, line))
+        {
+            line = line.substr(0, line.find('#'));
+
+            std::istringstream fields(line);
+            std::string        arch;
+            entry              e;
+            if(!(fields >> e.algorithm))
+            {
+                // Empty line
+                continue;
+            }
+            if(!(fields >> arch >> e.key_type >> e.value_type >> e.min_size >> e.candidate))
+            {
+                return hipErrorInvalidValue;
+            }
+            e.shared_memory = 0;
+            std::string rest;
+            if(fields >> rest)
+            {
+                static constexpr const char prefix[]    = "shared_memory=";
+                constexpr size_t            prefix_size = sizeof(prefix) - 1;
+                std::istringstream          value(rest.substr(prefix_size));
+                if(rest.compare(0, prefix_size, prefix) != 0 || !(value >> e.shared_memory)
+                   || !value.eof() || fields >> rest)
+                {
+                    return hipErrorInvalidValue;
+                }
+            }
+
+            e.any_arch = arch == "*";
+            e.arch     = get_target_arch_from_name(arch.c_str(), arch.size());
+            if(!e.any_arch && e.arch == target_arch::unknown)
+            {
+                // Entries for architectures unknown to this version never match.
+                continue;
+            }
+            result.push_back(std::move(e));
+        }
+        if(stream.bad())
+        {
+            return hipErrorInvalidValue;
+        }
+        entries = std::move(result);
+        return hipSuccess;
+    }
+
+    std::mutex         mutex_;
+    std::vector<entry> entries_;
+    bool               loaded_ = false;
+};
+
+template<class Function, class... Candidates, size_t... Indices>
+hipError_t invoke_tuned_candidate(tuned_config<Candidates...>,
+                                  std::index_sequence<Indices...>,
+                                  const size_t candidate,
+                                  Function&    function)
+{
+    hipError_t result = hipErrorInvalidValue;
+    (void)std::initializer_list<int>{
+        (candidate == Indices ? (result = function(config_tag<Candidates>{}), 0) : 0)...};
+    return result;
+}
+
+/// \brief Calls \p function with the \p config_tag of the config to use for an invocation.
+///
+/// For a \p size_bucketed_config the config of the bucket of \p size is dispatched. For
+/// a \p tuned_config the candidate is selected from the tuning database, within the shared
+/// memory budget of \p stream, any other config is passed through. The selection only depends on
+/// its arguments and the budget, so the calls that query the temporary storage size and that run
+/// the algorithm use the same candidate.
+template<class Config, class Key, class Value, class Function>
+auto dispatch_tuned_config(const char*, const size_t, const hipStream_t, Function&& function)
+    -> std::enable_if_t<!is_tuned_config<Config>::value && !is_size_bucketed_config<Config>::value,
+                        hipError_t>
+{
+    return function(config_tag<Config>{});
+}
+
+template<class Config, class Key, class Value, class Function>
+auto dispatch_tuned_config(const char*       algorithm,
+                           const size_t      size,
+                           const hipStream_t stream,
+                           Function&&        function)
+    -> std::enable_if_t<is_tuned_config<Config>::value, hipError_t>
+{
+    target_arch arch;
+    ROCPRIM_RETURN_ON_ERROR(host_target_arch(stream, arch));
+
+    const size_t candidate = tuning_database::instance().select(
+        algorithm,
+        arch,
+        tuning_type_name<Key>::get(),
+        tuning_type_name<Value>::get(),
+        size,
+        Config::candidate_count,
+        stream_shared_memory_budgets::instance().get(stream));
+    return invoke_tuned_candidate(Config{},
+                                  std::make_index_sequence<Config::candidate_count>{},
+                                  candidate,
+                                  function);
+}
+
+template<class Config, class Key, class Value, class Function>
+auto dispatch_tuned_config(const char*       algorithm,
+                           const size_t      size,
+                           const hipStream_t stream,
+                           Function&&        function)
+    -> std::enable_if_t<is_size_bucketed_config<Config>::value, hipError_t>
+{
+    if(size <= Config::max_small_size)
+    {
+        return dispatch_tuned_config<typename Config::small_config, Key, Value>(
+            algorithm,
+            size,
+            stream,
+            std::forward<Function>(function));
+    }
+    return dispatch_tuned_config<typename Config::large_config, Key, Value>(
+        algorithm,
+        size,
+        stream,
+        std::forward<Function>(function));
+}
+
+} // namespace detail
+
+/// \brief Loads the tuning database used to select the candidates of \p tuned_config.
+///
+/// The database replaces the previously loaded one. Without a call to this function, the
+/// database is loaded from the file named by the \p ROCPRIM_TUNING_DATABASE environment
+/// variable, if set, when a \p tuned_config is first used.
+///
+/// The database is a text file with one entry per line:
+///
+/// <tt>algorithm arch key_type value_type min_size candidate [shared_memory=bytes]</tt>
+///
+/// * \p algorithm is the name of the algorithm: \p reduce, \p scan, \p scan_by_key,
+///   \p reduce_by_key, \p select, \p partition, \p histogram or \p radix_sort.
+/// * \p arch is the device architecture, such as \p gfx942.
+/// * \p key_type and \p value_type are the type names used by the tuning scripts, such as \p int,
+///   \p int64_t or \p rocprim::half. \p value_type is \p - for algorithms without values.
+///   For \p reduce, \p value_type is the accumulator type if it is given and differs from the
+///   result type of the operator, so that e.g. \p rocprim::half reduced in \p float can be tuned
+///   separately, and \p - otherwise.
+/// * \p min_size is the smallest input size for the entry, so entries with increasing
+///   \p min_size define size buckets.
+/// * \p candidate is the zero-based index of the candidate config to use.
+/// * \p shared_memory, which is optional, is the number of bytes of shared memory per block that
+///   the kernels of the candidate use. Entries of one size bucket may record the best candidates
+///   at several shared memory budgets: on a stream with a budget (see
+///   \p set_stream_shared_memory_budget) the entries whose \p shared_memory exceeds the budget
+///   are skipped, and among the others the one with the largest \p shared_memory is used. If no
+///   entry fits, the first candidate is used. Entries without the field fit any budget.
+///
+/// \p arch, \p key_type and \p value_type may be \p * to match anything, and \p # starts a
+/// comment. For each invocation, the matching entry with the largest \p min_size is used.
+///
+/// The database must not be changed between the two calls of an algorithm (the one that queries
+/// the temporary storage size and the one that runs it).
+///
+/// \param [in] filename the path of the database.
+/// \returns \p hipSuccess (\p 0) after successful loading, \p hipErrorFileNotFound if the file
+/// cannot be opened and \p hipErrorInvalidValue if it is malformed. The previous database is kept
+/// on error.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// // tuning.txt:
+/// // reduce gfx942 float - 0       0
+/// // reduce gfx942 float - 1048576 1
+/// rocprim::load_tuning_database("tuning.txt");
+///
+/// using config = rocprim::tuned_config<rocprim::reduce_config<256, 4>,
+///                                      rocprim::reduce_config<256, 16>>;
+/// rocprim::reduce<config>(temporary_storage, storage_size, input, output, size);
+/// \endcode
+/// \endparblock
+inline hipError_t load_tuning_database(const char* filename)
+{
+    return detail::tuning_database::instance().load(filename);
+}
+
+/// \brief Removes all entries from the tuning database, so the first candidate of each
+/// \p tuned_config is used.
+inline void clear_tuning_database()
+{
+    detail::tuning_database::instance().clear();
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group primitivesmodule_deviceconfigs
+
+#endif // ROCPRIM_DEVICE_TUNING_DATABASE_HPP_
@@ -0,0 +1,371 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_DEVICE_WORK_QUEUE_HPP_
+#define ROCPRIM_DEVICE_WORK_QUEUE_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "../detail/temp_storage.hpp"
+#include "../intrinsics.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <cstddef>
+
+/// \addtogroup devicemodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The counters of a work queue
+enum work_queue_counter : unsigned int
+{
+    work_queue_head,
+    work_queue_tail,
+    work_queue_pending,
+    work_queue_overflow,
+    work_queue_counters
+};
+
+ROCPRIM_KERNEL
+__launch_bounds__(1)
+void init_work_queue_kernel(unsigned int* counters, const unsigned int initial_items)
+{
+    counters[work_queue_head]     = 0;
+    counters[work_queue_tail]     = initial_items;
+    counters[work_queue_pending]  = initial_items;
+    counters[work_queue_overflow] = 0;
+}
+
+} // namespace detail
+
+/// \brief The result of \p work_queue::pop.
+enum class work_queue_status
+{
+    /// An item was popped.
+    success,
+    /// No item is available yet, but items may still be pushed. The lane must call \p pop again.
+    empty,
+    /// All items have been processed and no item will be pushed anymore.
+    drained
+};
+
+/// \brief A device-scope queue of work items, for persistent kernels whose work is only known
+/// at run time, for example the frontiers of a graph traversal.
+///
+/// The items of the queue are processed by the lanes of a persistent kernel (see
+/// \p get_persistent_grid_size), where processing an item may push new items. A lane pops an
+/// item, processes it, pushes the items it produces and then marks the item complete. The queue
+/// tracks the items that are pushed but not complete, so \p pop reports that the queue is
+/// drained once no lane is processing an item and no item is left.
+///
+/// \par Overview
+/// * Pushes and pops are aggregated over the active lanes of a warp, so a warp pushes or claims
+/// its items with one atomic operation per counter.
+/// * A pop claims a slot of the queue, and returns \p work_queue_status::empty while the item of
+/// the slot is not pushed yet, rather than waiting for it. The lanes of a warp therefore never
+/// wait for each other, and a lane keeps its slot for the next call.
+/// * The queue is bounded: \p capacity is the number of items pushed during a launch, including
+/// the initial items. Pushes beyond it are dropped, and the queue reports the overflow.
+/// * On the host, \p get_temp_storage_size gives the size of the storage, \p create binds the
+/// storage, and \p initialize resets the queue with its initial items before every launch.
+/// \p initialize only resets the counters of the queue, the slots are tagged with the launch.
+/// * The object is passed to the kernel by value and must be an lvalue that is not copied
+/// between the calls of \p pop, since it keeps the slots the lanes claimed.
+///
+/// \par Example
+/// \parblock
+/// \code{.cpp}
+/// #include <rocprim/rocprim.hpp>
+///
+/// __global__ void traverse(rocprim::work_queue<unsigned int> queue)
+/// {
+///     unsigned int vertex;
+///     rocprim::work_queue_status status;
+///     while((status = queue.pop(vertex)) != rocprim::work_queue_status::drained)
+///     {
+///         if(status == rocprim::work_queue_status::success)
+///         {
+///             // visit the vertex and push its unvisited neighbours with queue.push
+///             queue.complete();
+///         }
+///     }
+/// }
+///
+/// // Host
+/// size_t storage_size = rocprim::work_queue<unsigned int>::get_temp_storage_size(capacity);
+/// hipMalloc(&storage, storage_size);
+///
+/// rocprim::work_queue<unsigned int> queue;
+/// rocprim::work_queue<unsigned int>::create(queue, storage, storage_size, capacity);
+/// queue.initialize(d_sources, sources, stream);
+/// traverse<<<grid_size, 256, 0, stream>>>(queue);
+/// \endcode
+/// \endparblock
+///
+/// \tparam T - type of the work items, it must be trivially copyable.
+template<class T>
+class work_queue
+{
+    static constexpr unsigned int no_slot = static_cast<unsigned int>(-1);
+
+public:
+    /// The type of the work items.
+    using value_type = T;
+
+    /// \brief Returns the size of the temporary storage of a queue of \p capacity items.
+    ///
+    /// \param [in] capacity the number of items pushed during a launch, including the initial
+    /// items.
+    /// \param [out] storage_size the size of the storage in bytes.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    ROCPRIM_HOST static hipError_t get_temp_storage_size(const unsigned int capacity,
+                                                         size_t&            storage_size)
+    {
+        storage_size = 0;
+        unsigned int* counters;
+        unsigned int* flags;
+        T*            items;
+        return partition_storage(nullptr, storage_size, capacity, counters, flags, items);
+    }
+
+    /// \brief Binds temporary storage to a queue of \p capacity items.
+    ///
+    /// \param [out] queue the created queue.
+    /// \param [in] temporary_storage the storage, of at least the size given by
+    /// \p get_temp_storage_size.
+    /// \param [in] storage_size the size of \p temporary_storage in bytes.
+    /// \param [in] capacity the number of items pushed during a launch, including the initial
+    /// items.
+    /// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if the
+    /// storage is too small; otherwise a HIP runtime error of type \p hipError_t.
+    ROCPRIM_HOST static hipError_t create(work_queue&        queue,
+                                          void* const        temporary_storage,
+                                          size_t             storage_size,
+                                          const unsigned int capacity)
+    {
+        if(temporary_storage == nullptr)
+        {
+            return hipErrorInvalidValue;
+        }
+        ROCPRIM_RETURN_ON_ERROR(partition_storage(temporary_storage,
+                                                  storage_size,
+                                                  capacity,
+                                                  queue.counters_,
+                                                  queue.flags_,
+                                                  queue.items_));
+        queue.capacity_ = capacity;
+        queue.initial_  = 0;
+        queue.epoch_    = 0;
+        queue.claimed_  = no_slot;
+        return hipSuccess;
+    }
+
+    /// \brief Resets the queue on \p stream, with \p initial_items items copied from
+    /// \p d_initial_items. It must be called before every launch of a kernel that uses the queue.
+    ///
+    /// The slots of the queue are tagged with the launch, so they are only cleared when the
+    /// queue is initialized for the first time, and after every 2^32 - 1 launches.
+    ///
+    /// \param [in] d_initial_items the initial items, in device memory.
+    /// \param [in] initial_items the number of initial items.
+    /// \param [in] stream the stream of the kernel that uses the queue.
+    /// \returns \p hipSuccess (\p 0) after successful operation, \p hipErrorInvalidValue if
+    /// \p initial_items exceeds the capacity; otherwise a HIP runtime error of type
+    /// \p hipError_t.
+    ROCPRIM_HOST hipError_t initialize(const T* const     d_initial_items,
+                                       const unsigned int initial_items,
+                                       const hipStream_t  stream)
+    {
+        if(initial_items > capacity_)
+        {
+            return hipErrorInvalidValue;
+        }
+        // The flags of the slots hold the epoch of the launch that pushed their items, 0 is
+        // never an epoch
+        if(++epoch_ == 1 || epoch_ == 0)
+        {
+            epoch_ = 1;
+            ROCPRIM_RETURN_ON_ERROR(
+                hipMemsetAsync(flags_, 0, sizeof(unsigned int) * capacity_, stream));
+        }
+        if(initial_items != 0)
+        {
+            ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(items_,
+                                                   d_initial_items,
+                                                   sizeof(T) * initial_items,
+                                                   hipMemcpyDeviceToDevice,
+                                                   stream));
+        }
+        initial_ = initial_items;
+        claimed_ = no_slot;
+        detail::init_work_queue_kernel<<<1, 1, 0, stream>>>(counters_, initial_items);
+        ROCPRIM_RETURN_ON_ERROR(hipGetLastError());
+        detail::notify_kernel_launch("init_work_queue_kernel", initial_items, stream);
+        return hipSuccess;
+    }
+
+    /// \brief Returns on the host whether items were dropped because the queue was full, in the
+    /// last launch on \p stream. Synchronizes \p stream.
+    ///
+    /// \param [in] stream the stream of the kernel that used the queue.
+    /// \param [out] overflow whether items were dropped.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error of
+    /// type \p hipError_t.
+    ROCPRIM_HOST hipError_t get_overflow(const hipStream_t stream, bool& overflow) const
+    {
+        unsigned int value;
+        ROCPRIM_RETURN_ON_ERROR(hipMemcpyAsync(&value,
+                                               counters_ + detail::work_queue_overflow,
+                                               sizeof(value),
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+        ROCPRIM_RETURN_ON_ERROR(hipStreamSynchronize(stream));
+        overflow = value != 0;
+        return hipSuccess;
+    }
+
+    /// \brief Pushes \p item if \p valid is \p true. The pushes of the active lanes of a warp are
+    /// aggregated, so it must be called by all lanes that may push, also those that do not.
+    ///
+    /// A lane that pushes while processing an item must push before it marks the item complete.
+    ///
+    /// \param [in] item the item.
+    /// \param [in] valid whether the lane pushes \p item.
+    /// \returns \p false if the item was dropped because the queue is full.
+    ROCPRIM_DEVICE ROCPRIM_INLINE bool push(const T& item, const bool valid = true)
+    {
+        const lane_mask_type pushing = ::rocprim::ballot(valid);
+        const lane_mask_type group   = valid ? pushing : 0;
+        // The item is pending before it is visible, so the queue is not drained in between
+        ::rocprim::warp_aggregated_atomic_add(&counters_[detail::work_queue_pending], 1u, group);
+        const unsigned int slot = ::rocprim::warp_aggregated_atomic_add(
+            &counters_[detail::work_queue_tail], 1u, group);
+        if(!valid)
+        {
+            return true;
+        }
+        if(slot >= capacity_)
+        {
+            ::rocprim::detail::atomic_add(&counters_[detail::work_queue_pending], no_slot);
+            ::rocprim::detail::atomic_store(&counters_[detail::work_queue_overflow], 1u);
+            return false;
+        }
+        items_[slot] = item;
+        // Publish the item before its flag
+        ::rocprim::detail::memory_fence_device();
+        ::rocprim::detail::atomic_store(&flags_[slot], epoch_);
+        return true;
+    }
+
+    /// \brief Pops an item. The pops of the active lanes of a warp are aggregated.
+    ///
+    /// \param [out] item the item, if one was popped.
+    /// \returns \p work_queue_status::success if an item was popped, it must be marked complete
+    /// with \p complete after it is processed. \p work_queue_status::empty if no item is
+    /// available yet, \p work_queue_status::drained if the queue is drained.
+    ROCPRIM_DEVICE ROCPRIM_INLINE work_queue_status pop(T& item)
+    {
+        const bool           claiming = claimed_ == no_slot;
+        const lane_mask_type claimers = ::rocprim::ballot(claiming);
+        const lane_mask_type group    = claiming ? claimers : 0;
+        const unsigned int   slot     = ::rocprim::warp_aggregated_atomic_add(
+            &counters_[detail::work_queue_head], 1u, group);
+        if(claiming)
+        {
+            claimed_ = slot;
+        }
+
+        if(claimed_ < initial_
+           || (claimed_ < capacity_
+               && ::rocprim::detail::atomic_load(&flags_[claimed_]) == epoch_))
+        {
+            // See the item published before its flag
+            ::rocprim::detail::memory_fence_device();
+            item     = items_[claimed_];
+            claimed_ = no_slot;
+            return work_queue_status::success;
+        }
+        // The item of the slot is pending from before it is pushed until it is complete, so if
+        // nothing is pending the slot will never get an item
+        return ::rocprim::detail::atomic_load(&counters_[detail::work_queue_pending]) == 0
+                   ? work_queue_status::drained
+                   : work_queue_status::empty;
+    }
+
+    /// \brief Marks a popped item complete, after it is processed and the items it produced are
+    /// pushed. The completions of the active lanes of a warp are aggregated.
+    ROCPRIM_DEVICE ROCPRIM_INLINE void complete()
+    {
+        ::rocprim::warp_aggregated_atomic_add(&counters_[detail::work_queue_pending],
+                                              no_slot,
+                                              ::rocprim::ballot(true));
+    }
+
+    /// \brief Returns whether items were dropped because the queue was full.
+    ROCPRIM_DEVICE ROCPRIM_INLINE bool overflowed() const
+    {
+        return ::rocprim::detail::atomic_load(&counters_[detail::work_queue_overflow]) != 0;
+    }
+
+    /// \brief Returns the capacity of the queue.
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE unsigned int capacity() const
+    {
+        return capacity_;
+    }
+
+private:
+    ROCPRIM_HOST static hipError_t partition_storage(void* const        temporary_storage,
+                                                     size_t&            storage_size,
+                                                     const unsigned int capacity,
+                                                     unsigned int*&     counters,
+                                                     unsigned int*&     flags,
+                                                     T*&                items)
+    {
+        return detail::temp_storage::partition(
+            temporary_storage,
+            storage_size,
+            detail::temp_storage::make_linear_partition(
+                detail::temp_storage::ptr_aligned_array(&counters, detail::work_queue_counters),
+                detail::temp_storage::ptr_aligned_array(&flags, capacity),
+                detail::temp_storage::ptr_aligned_array(&items, capacity)));
+    }
+
+    unsigned int* counters_ = nullptr;
+    unsigned int* flags_    = nullptr;
+    T*            items_    = nullptr;
+    unsigned int  capacity_ = 0;
+    // The items copied by initialize, which have no flags
+    unsigned int initial_ = 0;
+    unsigned int epoch_   = 0;
+    // The slot claimed by the lane, whose item is not pushed yet
+    unsigned int claimed_ = no_slot;
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group devicemodule
+
+#endif // ROCPRIM_DEVICE_WORK_QUEUE_HPP_
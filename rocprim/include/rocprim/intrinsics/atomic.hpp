@@ -22,6 +22,14 @@
 #define ROCPRIM_INTRINSICS_ATOMIC_HPP_
 
 #include "../config.hpp"
+#include "../types.hpp"
+
+#include "bit.hpp"
+#include "thread.hpp"
+#include "warp.hpp"
+#include "warp_shuffle.hpp"
+
+#include <stdint.h>
 
 BEGIN_ROCPRIM_NAMESPACE
 
@@ -220,8 +228,122 @@ namespace detail
     {
         __builtin_amdgcn_fence(__ATOMIC_ACQUIRE, "workgroup");
     }
+
+    // Groups the active lanes that pass the same address. Each iteration takes the address of
+    // the lowest lane that is not grouped yet, so it runs once per distinct address.
+    ROCPRIM_DEVICE ROCPRIM_INLINE lane_mask_type match_address(const void* address)
+    {
+        const uintptr_t key       = reinterpret_cast<uintptr_t>(address);
+        lane_mask_type  remaining = ::rocprim::ballot(true);
+        while(true)
+        {
+            const uintptr_t leader_key
+                = ::rocprim::warp_shuffle(key, static_cast<int>(::rocprim::ctz(remaining)));
+            const lane_mask_type same = ::rocprim::ballot(key == leader_key);
+            if(key == leader_key)
+            {
+                return same;
+            }
+            remaining &= ~same;
+        }
+    }
 }
 
+/// \addtogroup intrinsicsmodule
+/// @{
+
+/// \brief Warp-aggregated atomic addition for a group of lanes
+///
+/// Instead of one atomic per lane, the first lane of each group (elected by its rank
+/// in the group, see \p masked_bit_count) adds \p value times the size of the group with a
+/// single atomic, and broadcasts the previous value to the other lanes of the group. This
+/// reduces the contention of atomics to the same address by up to the warp size.
+///
+/// \tparam T - type of the value, one of the types supported by atomic additions:
+/// \p int, \p unsigned \p int, \p unsigned \p long, \p unsigned \p long \p long, \p float
+/// and \p double.
+///
+/// \param [in] address - address to add to, must be the same for all lanes of the group.
+/// \param [in] value - value added by each lane, must be the same for all lanes of the group.
+/// \param [in] group - bit mask of the lanes in the same group as the calling lane, for example
+/// the result of \p match_any. Lanes passing 0 do not add anything.
+///
+/// \return The value at \p address as if the lanes of the group had added \p value one
+/// after another in lane order, for example the offset of the calling lane when the atomic
+/// allocates space. Lanes passing 0 as \p group receive <tt>T()</tt>.
+///
+/// \pre The groups must be consistent between lanes, see \p group_elect.
+template<class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE T warp_aggregated_atomic_add(T*                   address,
+                                                           const T              value,
+                                                           const lane_mask_type group)
+{
+    const unsigned int rank = ::rocprim::masked_bit_count(group);
+
+    T previous{};
+    if(::rocprim::group_elect(group))
+    {
+        previous
+            = detail::atomic_add(address, value * static_cast<T>(::rocprim::bit_count(group)));
+    }
+    const unsigned int leader = group != 0 ? ::rocprim::ctz(group) : ::rocprim::lane_id();
+    previous = ::rocprim::warp_shuffle(previous, static_cast<int>(leader));
+
+    return group != 0 ? previous + value * static_cast<T>(rank) : T();
+}
+
+/// \brief Warp-aggregated atomic addition, grouping the lanes that add to the same address
+///
+/// The active lanes are grouped by \p address, and each group adds with a single atomic as in
+/// the overload taking a group mask. When all lanes add to the same address, as for the counters
+/// of select and partition kernels, one leader is elected at the cost of a ballot and a shuffle.
+/// Grouping takes one ballot and one shuffle per distinct address in the warp.
+///
+/// \param [in] address - address to add to.
+/// \param [in] value - value added by each lane, must be the same for all lanes that add to
+/// the same address.
+///
+/// \return The value at \p address as if the lanes adding to it had added \p value one
+/// after another in lane order.
+template<class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE T warp_aggregated_atomic_add(T* address, const T value)
+{
+    return warp_aggregated_atomic_add(address, value, detail::match_address(address));
+}
+
+/// \brief Warp-aggregated atomic addition to <tt>base[label]</tt>, grouping the lanes by
+/// \p label
+///
+/// The lanes are grouped with \p match_any, so labels are compared bit by bit with
+/// \p LabelBits ballots, independently of the number of distinct labels. This is the
+/// aggregation of histograms, where \p label is the bin.
+///
+/// \tparam LabelBits - number of bits of \p label, labels must be less than
+/// <tt>2^LabelBits</tt>.
+///
+/// \param [in] base - the array to add to.
+/// \param [in] label - the index of the element of \p base to add to.
+/// \param [in] value - value added by each lane, must be the same for all lanes with the
+/// same label.
+/// \param [in] valid - lanes passing <tt>false</tt> do not add anything.
+///
+/// \return The value at <tt>base[label]</tt> as if the lanes with the same label had added
+/// \p value one after another in lane order. Lanes passing <tt>false</tt> as \p valid receive
+/// <tt>T()</tt>.
+template<unsigned int LabelBits, class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE T warp_aggregated_atomic_add(T*                 base,
+                                                           const unsigned int label,
+                                                           const T            value,
+                                                           const bool         valid = true)
+{
+    return warp_aggregated_atomic_add(base + label,
+                                      value,
+                                      ::rocprim::match_any<LabelBits>(label, valid));
+}
+
+/// @}
+// end of group intrinsicsmodule
+
 END_ROCPRIM_NAMESPACE
 
 #endif // ROCPRIM_INTRINSICS_ATOMIC_HPP_
@@ -306,6 +306,22 @@ namespace detail
         return lane_id();
     }
 
+    // Return the mask of the lanes of the calling "logical warp" within the hardware warp.
+    template<unsigned int LogicalWarpSize>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    lane_mask_type logical_warp_lane_mask()
+    {
+        if ROCPRIM_IF_CONSTEXPR(LogicalWarpSize >= device_warp_size())
+        {
+            return ~lane_mask_type(0);
+        }
+        else
+        {
+            const unsigned int first_lane = lane_id() & ~(LogicalWarpSize - 1);
+            return ((lane_mask_type(1) << LogicalWarpSize) - 1) << first_lane;
+        }
+    }
+
     // Return id of "logical warp" in a block
     template<unsigned int LogicalWarpSize>
     ROCPRIM_DEVICE ROCPRIM_INLINE
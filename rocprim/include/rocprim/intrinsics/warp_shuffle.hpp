@@ -114,6 +114,23 @@ T warp_swizzle(const T& input)
     );
 }
 
+/// \brief Cross-row permute for any data type.
+///
+/// Each thread in a row of 16 lanes obtains \p input from a lane of the other row of the same
+/// 32 lanes. The source lane of lane \p i of the row is the <tt>i</tt>-th 4-bit field of
+/// <tt>SelectHigh:SelectLow</tt>. Unlike \p warp_swizzle it does not go through the LDS.
+///
+/// \param input - input to pass to other threads
+template<class T, unsigned int SelectLow, unsigned int SelectHigh>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+T warp_permlanex16(const T& input)
+{
+    return detail::warp_shuffle_op(
+        input,
+        [=](int v) -> int
+        { return ::__builtin_amdgcn_permlanex16(v, v, SelectLow, SelectHigh, false, false); });
+}
+
 } // end namespace detail
 
 /// \brief Shuffle for any data type.
@@ -25,12 +25,22 @@
 #include "config.hpp"
 
 #include "iterator/arg_index_iterator.hpp"
+#include "iterator/bitmask_output_iterator.hpp"
+#include "iterator/cache_modified_input_iterator.hpp"
+#include "iterator/cache_modified_output_iterator.hpp"
 #include "iterator/constant_iterator.hpp"
 #include "iterator/counting_iterator.hpp"
 #include "iterator/discard_iterator.hpp"
+#include "iterator/launch_descriptor_iterator.hpp"
+#include "iterator/packed_bits_iterator.hpp"
+#include "iterator/permutation_iterator.hpp"
 #include "iterator/predicate_iterator.hpp"
+#include "iterator/scalar_broadcast_iterator.hpp"
+#include "iterator/scatter_output_iterator.hpp"
+#include "iterator/tee_iterator.hpp"
 #include "iterator/texture_cache_iterator.hpp"
 #include "iterator/transform_iterator.hpp"
+#include "iterator/transform_output_iterator.hpp"
 #include "iterator/zip_iterator.hpp"
 
 #endif // ROCPRIM_ITERATOR_HPP_
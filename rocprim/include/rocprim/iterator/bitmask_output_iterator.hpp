@@ -0,0 +1,280 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_BITMASK_OUTPUT_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_BITMASK_OUTPUT_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The reference of bitmask_output_iterator, which sets or clears its bit. The words are shared
+// by the items of several threads, so the bits are updated with atomic operations.
+class bitmask_reference
+{
+public:
+    ROCPRIM_HOST_DEVICE inline bitmask_reference(unsigned int* words, const size_t index)
+        : word_(words + index / 32), bit_(1u << (index % 32))
+    {}
+
+    template<class V>
+    ROCPRIM_HOST_DEVICE inline
+    bitmask_reference& operator=(const V& value)
+    {
+        #ifndef __HIP_DEVICE_COMPILE__
+        *word_ = static_cast<bool>(value) ? *word_ | bit_ : *word_ & ~bit_;
+        #else
+        if(static_cast<bool>(value))
+        {
+            ::atomicOr(word_, bit_);
+        }
+        else
+        {
+            ::atomicAnd(word_, ~bit_);
+        }
+        #endif
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitmask_reference& operator=(const bitmask_reference& other)
+    {
+        return *this = static_cast<bool>(other);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    operator bool() const
+    {
+        return (*word_ & bit_) != 0;
+    }
+
+private:
+    unsigned int* word_;
+    unsigned int  bit_;
+};
+
+} // end namespace detail
+
+/// \class bitmask_output_iterator
+/// \brief A random-access output iterator for storing flags as the bits of an array of 32-bit
+/// words.
+///
+/// \par Overview
+/// * Assigning a value to the dereferenced iterator at position \p i sets bit \p i of the
+/// words (starting with the least significant bit of the first word) if the value converts to
+/// \p true, and clears it otherwise.
+/// * Use it to store the flags produced by an algorithm, e.g. by transform for select and
+/// partition, with 32 times fewer bytes than an array of \p unsigned \p int. The bitmask is read
+/// back with \p bitmask_iterator.
+/// * The bits are updated with atomic operations on the words, since the bits of a word are
+/// usually written by different threads.
+///
+/// \tparam Difference - a type used for identify distance between iterators.
+template<class Difference = std::ptrdiff_t>
+class bitmask_output_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = bool;
+    /// A reference type of the type iterated over, which sets or clears its bit.
+    using reference = detail::bitmask_reference;
+    /// A pointer type of the type iterated over (\p value_type).
+    using pointer = void;
+    /// A type used for identify distance between iterators.
+    using difference_type = Difference;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// \brief Creates a new bitmask_output_iterator.
+    ///
+    /// \param words - pointer to the words of the bitmask on the device.
+    /// \param index - optional index of the first bit of the iterator in the words.
+    ROCPRIM_HOST_DEVICE inline explicit bitmask_output_iterator(unsigned int* words = nullptr,
+                                                                const size_t  index = 0)
+        : words_(words), index_(index)
+    {}
+
+    /// \brief Returns the pointer to the words of the bitmask.
+    ROCPRIM_HOST_DEVICE inline
+    unsigned int* words() const
+    {
+        return words_;
+    }
+
+    /// \brief Returns the index of the current bit in the words.
+    ROCPRIM_HOST_DEVICE inline
+    size_t index() const
+    {
+        return index_;
+    }
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    bitmask_output_iterator& operator++()
+    {
+        index_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitmask_output_iterator operator++(int)
+    {
+        bitmask_output_iterator old = *this;
+        index_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitmask_output_iterator& operator--()
+    {
+        index_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitmask_output_iterator operator--(int)
+    {
+        bitmask_output_iterator old = *this;
+        index_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference(words_, index_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return reference(words_, index_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitmask_output_iterator operator+(difference_type distance) const
+    {
+        return bitmask_output_iterator(words_, index_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitmask_output_iterator& operator+=(difference_type distance)
+    {
+        index_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitmask_output_iterator operator-(difference_type distance) const
+    {
+        return bitmask_output_iterator(words_, index_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bitmask_output_iterator& operator-=(difference_type distance)
+    {
+        index_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(bitmask_output_iterator other) const
+    {
+        return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(bitmask_output_iterator other) const
+    {
+        return words_ == other.words_ && index_ == other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(bitmask_output_iterator other) const
+    {
+        return !(*this == other);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(bitmask_output_iterator other) const
+    {
+        return index_ < other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(bitmask_output_iterator other) const
+    {
+        return index_ <= other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(bitmask_output_iterator other) const
+    {
+        return index_ > other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(bitmask_output_iterator other) const
+    {
+        return index_ >= other.index_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    unsigned int* words_;
+    size_t        index_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class Difference>
+ROCPRIM_HOST_DEVICE inline bitmask_output_iterator<Difference>
+    operator+(Difference distance, const bitmask_output_iterator<Difference>& iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_bitmask_output_iterator creates a \p bitmask_output_iterator over \p words.
+///
+/// \param words - pointer to the words of the bitmask on the device.
+/// \param index - optional index of the first bit of the iterator in the words.
+/// \return A \p bitmask_output_iterator which stores flags as bits.
+ROCPRIM_HOST_DEVICE inline bitmask_output_iterator<>
+    make_bitmask_output_iterator(unsigned int* words, const size_t index = 0)
+{
+    return bitmask_output_iterator<>(words, index);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_BITMASK_OUTPUT_ITERATOR_HPP_
@@ -0,0 +1,238 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_CACHE_MODIFIED_INPUT_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_CACHE_MODIFIED_INPUT_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../thread/thread_load.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class cache_modified_input_iterator
+/// \brief A random-access input (read-only) iterator adaptor for dereferencing array values
+/// with a cache load modifier.
+///
+/// \par Overview
+/// * A cache_modified_input_iterator wraps a device pointer of type T, where values are
+/// obtained by loads with the caching behaviour of \p Modifier.
+/// * With \p load_cs the values are loaded with nontemporal (streaming) loads, which do not keep
+/// the input in the caches where the architecture allows. Use it for input that an algorithm
+/// reads only once, so that it does not evict data that is reused, for example the data
+/// of other kernels running concurrently.
+/// * With \p load_ldg or \p load_ca the values are read through the caches without a bound
+/// texture object, which makes it a replacement of \p texture_cache_iterator for read-only
+/// gathers, e.g. lookup tables or the haystack of \p binary_search.
+/// * Block loads of the vectorized method load through the wrapped pointer, keeping the
+/// nontemporal hint of \p load_cs.
+/// * Can be exchanged and manipulated within and between host and device functions, it is
+/// dereferenced without modifier in host functions.
+///
+/// \tparam T - type of value that can be obtained by dereferencing the iterator.
+/// \tparam Modifier - the cache load modifier of the loads.
+/// \tparam Difference - a type used for identify distance between iterators.
+template<class T, cache_load_modifier Modifier = load_cs, class Difference = std::ptrdiff_t>
+class cache_modified_input_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::remove_const<T>::type;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    /// It's `const` since cache_modified_input_iterator is a read-only iterator.
+    using reference = const value_type&;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    /// It's `const` since cache_modified_input_iterator is a read-only iterator.
+    using pointer = const value_type*;
+    /// A type used for identify distance between iterators.
+    using difference_type = Difference;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// \brief Creates a new cache_modified_input_iterator.
+    ///
+    /// \param ptr - pointer to the values on the device.
+    ROCPRIM_HOST_DEVICE inline explicit cache_modified_input_iterator(const T* ptr = nullptr)
+        : ptr_(ptr)
+    {}
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    const T* base() const
+    {
+        return ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator++()
+    {
+        ptr_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator++(int)
+    {
+        cache_modified_input_iterator old = *this;
+        ptr_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator--()
+    {
+        ptr_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator--(int)
+    {
+        cache_modified_input_iterator old = *this;
+        ptr_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator*() const
+    {
+        #ifndef __HIP_DEVICE_COMPILE__
+        return *ptr_;
+        #else
+        return detail::cache_modified_load<Modifier>(ptr_);
+        #endif
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator[](difference_type distance) const
+    {
+        cache_modified_input_iterator i = (*this) + distance;
+        return *i;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator+(difference_type distance) const
+    {
+        return cache_modified_input_iterator(ptr_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator+=(difference_type distance)
+    {
+        ptr_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator operator-(difference_type distance) const
+    {
+        return cache_modified_input_iterator(ptr_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_input_iterator& operator-=(difference_type distance)
+    {
+        ptr_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(cache_modified_input_iterator other) const
+    {
+        return ptr_ - other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(cache_modified_input_iterator other) const
+    {
+        return ptr_ == other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(cache_modified_input_iterator other) const
+    {
+        return ptr_ != other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(cache_modified_input_iterator other) const
+    {
+        return ptr_ < other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(cache_modified_input_iterator other) const
+    {
+        return ptr_ <= other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(cache_modified_input_iterator other) const
+    {
+        return ptr_ > other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(cache_modified_input_iterator other) const
+    {
+        return ptr_ >= other.ptr_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    const T* ptr_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class T, cache_load_modifier Modifier, class Difference>
+ROCPRIM_HOST_DEVICE inline cache_modified_input_iterator<T, Modifier, Difference>
+    operator+(Difference                                                    distance,
+              const cache_modified_input_iterator<T, Modifier, Difference>& iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_cache_modified_input_iterator creates a \p cache_modified_input_iterator over \p ptr.
+///
+/// \tparam Modifier - the cache load modifier of the loads.
+/// \tparam T - type of the values.
+///
+/// \param ptr - pointer to the values on the device.
+/// \return A \p cache_modified_input_iterator that loads the values with \p Modifier.
+template<cache_load_modifier Modifier = load_cs, class T>
+ROCPRIM_HOST_DEVICE inline cache_modified_input_iterator<T, Modifier>
+    make_cache_modified_input_iterator(const T* ptr)
+{
+    return cache_modified_input_iterator<T, Modifier>(ptr);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_CACHE_MODIFIED_INPUT_ITERATOR_HPP_
@@ -0,0 +1,269 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_CACHE_MODIFIED_OUTPUT_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_CACHE_MODIFIED_OUTPUT_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../thread/thread_store.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The reference of cache_modified_output_iterator, which stores the values assigned to it
+// with the cache store modifier.
+template<class T, cache_store_modifier Modifier>
+class cache_modified_store_reference
+{
+public:
+    ROCPRIM_HOST_DEVICE inline explicit cache_modified_store_reference(T* ptr) : ptr_(ptr) {}
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_store_reference& operator=(const T& value)
+    {
+        #ifndef __HIP_DEVICE_COMPILE__
+        *ptr_ = value;
+        #else
+        cache_modified_store<Modifier>(ptr_, value);
+        #endif
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_store_reference& operator=(const cache_modified_store_reference& other)
+    {
+        return *this = static_cast<T>(other);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    operator T() const
+    {
+        return *ptr_;
+    }
+
+private:
+    T* ptr_;
+};
+
+} // end namespace detail
+
+/// \class cache_modified_output_iterator
+/// \brief A random-access output (write-only) iterator adaptor for storing array values
+/// with a cache store modifier.
+///
+/// \par Overview
+/// * A cache_modified_output_iterator wraps a device pointer of type T, where the values
+/// assigned to the dereferenced iterator are stored with the caching behaviour of \p Modifier.
+/// * With \p store_cs the values are stored with nontemporal (streaming) stores, which do not
+/// keep the output in the caches where the architecture allows. Use it for output that is not
+/// read again soon, so that it does not evict data that is reused, for example the data of
+/// other kernels running concurrently.
+/// * Block stores of the vectorized method store through the wrapped pointer, keeping the
+/// nontemporal hint of \p store_cs.
+/// * Can be exchanged and manipulated within and between host and device functions, it is
+/// dereferenced without modifier in host functions.
+///
+/// \tparam T - type of the values stored through the iterator.
+/// \tparam Modifier - the cache store modifier of the stores.
+/// \tparam Difference - a type used for identify distance between iterators.
+template<class T, cache_store_modifier Modifier = store_cs, class Difference = std::ptrdiff_t>
+class cache_modified_output_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = T;
+    /// \brief A reference type of the type iterated over, which stores the values assigned
+    /// to it with \p Modifier.
+    using reference = detail::cache_modified_store_reference<T, Modifier>;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    using pointer = T*;
+    /// A type used for identify distance between iterators.
+    using difference_type = Difference;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// \brief Creates a new cache_modified_output_iterator.
+    ///
+    /// \param ptr - pointer to the values on the device.
+    ROCPRIM_HOST_DEVICE inline explicit cache_modified_output_iterator(T* ptr = nullptr)
+        : ptr_(ptr)
+    {}
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    T* base() const
+    {
+        return ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator& operator++()
+    {
+        ptr_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator operator++(int)
+    {
+        cache_modified_output_iterator old = *this;
+        ptr_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator& operator--()
+    {
+        ptr_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator operator--(int)
+    {
+        cache_modified_output_iterator old = *this;
+        ptr_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference(ptr_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return reference(ptr_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator operator+(difference_type distance) const
+    {
+        return cache_modified_output_iterator(ptr_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator& operator+=(difference_type distance)
+    {
+        ptr_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator operator-(difference_type distance) const
+    {
+        return cache_modified_output_iterator(ptr_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    cache_modified_output_iterator& operator-=(difference_type distance)
+    {
+        ptr_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(cache_modified_output_iterator other) const
+    {
+        return ptr_ - other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(cache_modified_output_iterator other) const
+    {
+        return ptr_ == other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(cache_modified_output_iterator other) const
+    {
+        return ptr_ != other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(cache_modified_output_iterator other) const
+    {
+        return ptr_ < other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(cache_modified_output_iterator other) const
+    {
+        return ptr_ <= other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(cache_modified_output_iterator other) const
+    {
+        return ptr_ > other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(cache_modified_output_iterator other) const
+    {
+        return ptr_ >= other.ptr_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    T* ptr_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class T, cache_store_modifier Modifier, class Difference>
+ROCPRIM_HOST_DEVICE inline cache_modified_output_iterator<T, Modifier, Difference>
+    operator+(Difference                                                     distance,
+              const cache_modified_output_iterator<T, Modifier, Difference>& iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_cache_modified_output_iterator creates a \p cache_modified_output_iterator over \p ptr.
+///
+/// \tparam Modifier - the cache store modifier of the stores.
+/// \tparam T - type of the values.
+///
+/// \param ptr - pointer to the values on the device.
+/// \return A \p cache_modified_output_iterator that stores the values with \p Modifier.
+template<cache_store_modifier Modifier = store_cs, class T>
+ROCPRIM_HOST_DEVICE inline cache_modified_output_iterator<T, Modifier>
+    make_cache_modified_output_iterator(T* ptr)
+{
+    return cache_modified_output_iterator<T, Modifier>(ptr);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_CACHE_MODIFIED_OUTPUT_ITERATOR_HPP_
@@ -0,0 +1,203 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_LAUNCH_DESCRIPTOR_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_LAUNCH_DESCRIPTOR_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The number of items computed by a device algorithm, with the grid to launch over them.
+struct launch_descriptor
+{
+    /// The number of items.
+    size_t size;
+    /// The number of blocks processing \p items_per_block items each needed for \p size items.
+    dim3 grid_size;
+    /// The number of items processed by a block, the one given to the iterator.
+    unsigned int items_per_block;
+};
+
+/// \class launch_descriptor_iterator
+/// \brief An output iterator that writes a \p launch_descriptor for each count assigned to it.
+///
+/// \par Overview
+/// * It can be used as the count output of \p select, \p unique, \p partition,
+/// \p reduce_by_key and \p run_length_encode, so a later kernel can read the grid needed for the
+/// selected items from device memory, without a copy to the host.
+/// * HIP has no indirect launch, so the later kernel is launched with a grid for the most items
+/// possible, and its blocks past \p launch_descriptor::grid_size exit right away. Device
+/// algorithms taking a \p future_value size, like \p transform, do this internally.
+/// * The grid size is limited to <tt>2^31 - 1</tt> blocks in the x dimension, counts needing
+/// more blocks saturate to that limit.
+///
+/// \code
+/// rocprim::launch_descriptor* descriptor; // 1 element in device memory
+/// rocprim::select(temporary_storage,
+///                 storage_size,
+///                 input,
+///                 output,
+///                 rocprim::make_launch_descriptor_iterator(descriptor, 256),
+///                 size,
+///                 predicate,
+///                 stream);
+/// // descriptor->size is the number of selected items, descriptor->grid_size.x is the
+/// // number of blocks of 256 items needed for them.
+/// \endcode
+class launch_descriptor_iterator
+{
+public:
+#ifndef DOXYGEN_SHOULD_SKIP_THIS // Skip internal implementation details.
+    struct descriptor_reference
+    {
+        launch_descriptor* descriptor;
+        unsigned int       items_per_block;
+
+        template<class T>
+        ROCPRIM_HOST_DEVICE inline
+        descriptor_reference& operator=(const T& count)
+        {
+            constexpr size_t max_grid_size = (size_t(1) << 31) - 1;
+
+            const size_t size   = static_cast<size_t>(count);
+            const size_t blocks = (size + items_per_block - 1) / items_per_block;
+
+            descriptor->size            = size;
+            descriptor->grid_size
+                = dim3(static_cast<unsigned int>(blocks < max_grid_size ? blocks : max_grid_size));
+            descriptor->items_per_block = items_per_block;
+            return *this;
+        }
+    };
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    /// The iterator is write-only, like the OutputIterator concept.
+    using value_type = void;
+    /// \brief A reference type of the type iterated over.
+    using reference = descriptor_reference;
+    /// \brief A pointer type of the type iterated over.
+    using pointer = void;
+    /// A type used for identify distance between iterators.
+    using difference_type = std::ptrdiff_t;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// \brief Creates a new launch_descriptor_iterator.
+    ///
+    /// \param descriptors - the descriptors written, one for each assigned count.
+    /// \param items_per_block - the number of items processed by a block of the later kernel.
+    ROCPRIM_HOST_DEVICE inline
+    launch_descriptor_iterator(launch_descriptor* descriptors, unsigned int items_per_block)
+        : descriptors_(descriptors), items_per_block_(items_per_block)
+    {
+    }
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    launch_descriptor_iterator& operator++()
+    {
+        descriptors_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    launch_descriptor_iterator operator++(int)
+    {
+        launch_descriptor_iterator old = *this;
+        descriptors_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference{descriptors_, items_per_block_};
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return reference{descriptors_ + distance, items_per_block_};
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    launch_descriptor_iterator operator+(difference_type distance) const
+    {
+        return launch_descriptor_iterator(descriptors_ + distance, items_per_block_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    launch_descriptor_iterator& operator+=(difference_type distance)
+    {
+        descriptors_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(launch_descriptor_iterator other) const
+    {
+        return descriptors_ - other.descriptors_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(launch_descriptor_iterator other) const
+    {
+        return descriptors_ == other.descriptors_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(launch_descriptor_iterator other) const
+    {
+        return descriptors_ != other.descriptors_;
+    }
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    launch_descriptor* descriptors_;
+    unsigned int       items_per_block_;
+};
+
+/// make_launch_descriptor_iterator creates a launch_descriptor_iterator writing to
+/// \p descriptors.
+///
+/// \param descriptors - the descriptors written, one for each assigned count.
+/// \param items_per_block - the number of items processed by a block of the later kernel.
+/// \return A new launch_descriptor_iterator object.
+ROCPRIM_HOST_DEVICE inline
+launch_descriptor_iterator make_launch_descriptor_iterator(launch_descriptor* descriptors,
+                                                           unsigned int       items_per_block)
+{
+    return launch_descriptor_iterator(descriptors, items_per_block);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_LAUNCH_DESCRIPTOR_ITERATOR_HPP_
@@ -0,0 +1,348 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_PACKED_BITS_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_PACKED_BITS_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace detail
+{
+
+template<unsigned int Bits>
+ROCPRIM_HOST_DEVICE constexpr unsigned int packed_bits_mask()
+{
+    return Bits == 32 ? ~0u : (1u << Bits) - 1u;
+}
+
+// Item i is stored in bits [i * Bits, (i + 1) * Bits) of the little-endian sequence of words
+template<unsigned int Bits>
+ROCPRIM_HOST_DEVICE inline
+unsigned int packed_bits_extract(const unsigned int* words, const size_t index)
+{
+    const size_t       bit   = index * Bits;
+    const size_t       word  = bit / 32;
+    const unsigned int shift = bit % 32;
+
+    unsigned int value = words[word] >> shift;
+    if(shift + Bits > 32)
+    {
+        value |= words[word + 1] << (32 - shift);
+    }
+    return value & packed_bits_mask<Bits>();
+}
+
+// Decodes items [first, first + count) into registers from full words. The words are shifted
+// into place first, so that all further indices are known at compile time and the words stay
+// in registers.
+template<unsigned int Bits, class ValueType, class T, unsigned int ItemsPerThread>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void packed_bits_load(const unsigned int* words,
+                      const size_t        first,
+                      const unsigned int  count,
+                      T (&items)[ItemsPerThread])
+{
+    constexpr unsigned int aligned_words = (Bits * ItemsPerThread + 31) / 32;
+
+    if(count == 0)
+    {
+        return;
+    }
+
+    const size_t       first_bit  = first * Bits;
+    const size_t       first_word = first_bit / 32;
+    const size_t       last_word  = (first_bit + count * Bits - 1) / 32;
+    const unsigned int shift      = first_bit % 32;
+
+    unsigned int loaded[aligned_words + 1];
+    ROCPRIM_UNROLL
+    for(unsigned int word = 0; word < aligned_words + 1; word++)
+    {
+        loaded[word] = first_word + word <= last_word ? words[first_word + word] : 0u;
+    }
+
+    unsigned int aligned[aligned_words];
+    ROCPRIM_UNROLL
+    for(unsigned int word = 0; word < aligned_words; word++)
+    {
+        // A shift by 32 is undefined
+        aligned[word] = shift == 0 ? loaded[word]
+                                   : (loaded[word] >> shift) | (loaded[word + 1] << (32 - shift));
+    }
+
+    ROCPRIM_UNROLL
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        const unsigned int bit        = item * Bits;
+        const unsigned int word       = bit / 32;
+        const unsigned int item_shift = bit % 32;
+        unsigned int       value      = aligned[word] >> item_shift;
+        if(item_shift + Bits > 32)
+        {
+            value |= aligned[word + 1] << (32 - item_shift);
+        }
+        if(item < count)
+        {
+            items[item] = static_cast<ValueType>(value & packed_bits_mask<Bits>());
+        }
+    }
+}
+
+} // namespace detail
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// \class packed_bits_iterator
+/// \brief A random-access input (read-only) iterator for values of \p Bits bits which are
+/// packed into an array of 32-bit words.
+///
+/// \par Overview
+/// * Item \p i is stored in the bits <tt>[i * Bits, (i + 1) * Bits)</tt> of the words, starting
+/// with the least significant bit of the first word. Items may span two words, so any width from
+/// 1 to 32 bits is supported, e.g. 4-bit quantized values or 12-bit sensor data.
+/// * Using it instead of an array of expanded values saves memory capacity and bandwidth in
+/// bandwidth-bound algorithms such as reduce, scan or histogram.
+/// * block_load_direct_blocked (and therefore the \p block_load_direct and
+/// \p block_load_vectorize methods of block_load) loads the full words that hold the items of a
+/// thread and decodes the items in registers. The other arrangements decode every item on its
+/// own; the consecutive items of a warp still share their words.
+///
+/// \tparam Bits - the number of bits of an item, from 1 to 32.
+/// \tparam ValueType - type of value that can be obtained by dereferencing the iterator.
+/// \tparam Difference - a type used for identify distance between iterators.
+template<unsigned int Bits, class ValueType = unsigned int, class Difference = std::ptrdiff_t>
+class packed_bits_iterator
+{
+    static_assert(Bits >= 1 && Bits <= 32, "Bits must be in [1, 32]");
+
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = ValueType;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    /// It's same as \p value_type since packed_bits_iterator is a read-only iterator.
+    using reference = value_type;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    /// It's `const` since packed_bits_iterator is a read-only iterator.
+    using pointer = const value_type*;
+    /// A type used for identify distance between iterators.
+    using difference_type = Difference;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+    /// The number of bits of an item.
+    static constexpr unsigned int bits = Bits;
+
+    /// \brief Creates a new packed_bits_iterator.
+    ///
+    /// \param words - pointer to the packed words on the device.
+    /// \param index - optional index of the first item of the iterator in the words.
+    ROCPRIM_HOST_DEVICE inline explicit packed_bits_iterator(const unsigned int* words = nullptr,
+                                                             const size_t        index = 0)
+        : words_(words), index_(index)
+    {}
+
+    /// \brief Returns the pointer to the packed words.
+    ROCPRIM_HOST_DEVICE inline
+    const unsigned int* words() const
+    {
+        return words_;
+    }
+
+    /// \brief Returns the index of the current item in the words.
+    ROCPRIM_HOST_DEVICE inline
+    size_t index() const
+    {
+        return index_;
+    }
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    packed_bits_iterator& operator++()
+    {
+        index_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    packed_bits_iterator operator++(int)
+    {
+        packed_bits_iterator old = *this;
+        index_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    packed_bits_iterator& operator--()
+    {
+        index_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    packed_bits_iterator operator--(int)
+    {
+        packed_bits_iterator old = *this;
+        index_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator*() const
+    {
+        return static_cast<value_type>(detail::packed_bits_extract<Bits>(words_, index_));
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator[](difference_type distance) const
+    {
+        return static_cast<value_type>(
+            detail::packed_bits_extract<Bits>(words_, index_ + distance));
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    packed_bits_iterator operator+(difference_type distance) const
+    {
+        return packed_bits_iterator(words_, index_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    packed_bits_iterator& operator+=(difference_type distance)
+    {
+        index_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    packed_bits_iterator operator-(difference_type distance) const
+    {
+        return packed_bits_iterator(words_, index_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    packed_bits_iterator& operator-=(difference_type distance)
+    {
+        index_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(packed_bits_iterator other) const
+    {
+        return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(packed_bits_iterator other) const
+    {
+        return words_ == other.words_ && index_ == other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(packed_bits_iterator other) const
+    {
+        return !(*this == other);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(packed_bits_iterator other) const
+    {
+        return index_ < other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(packed_bits_iterator other) const
+    {
+        return index_ <= other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(packed_bits_iterator other) const
+    {
+        return index_ > other.index_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(packed_bits_iterator other) const
+    {
+        return index_ >= other.index_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    const unsigned int* words_;
+    size_t              index_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<unsigned int Bits, class ValueType, class Difference>
+ROCPRIM_HOST_DEVICE inline packed_bits_iterator<Bits, ValueType, Difference>
+    operator+(Difference                                              distance,
+              const packed_bits_iterator<Bits, ValueType, Difference>& iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// \brief An iterator over a bitmask, which obtains every bit as a \p bool.
+///
+/// Use it for the flags of select and partition, or for scans and reductions of masks.
+template<class Difference = std::ptrdiff_t>
+using bitmask_iterator = packed_bits_iterator<1, bool, Difference>;
+
+/// make_packed_bits_iterator creates a \p packed_bits_iterator over \p words.
+///
+/// \tparam Bits - the number of bits of an item, from 1 to 32.
+/// \tparam ValueType - type of value that can be obtained by dereferencing the iterator.
+///
+/// \param words - pointer to the packed words on the device.
+/// \param index - optional index of the first item of the iterator in the words.
+/// \return A \p packed_bits_iterator which decodes the items of \p Bits bits.
+template<unsigned int Bits, class ValueType = unsigned int>
+ROCPRIM_HOST_DEVICE inline packed_bits_iterator<Bits, ValueType>
+    make_packed_bits_iterator(const unsigned int* words, const size_t index = 0)
+{
+    return packed_bits_iterator<Bits, ValueType>(words, index);
+}
+
+/// make_bitmask_iterator creates a \p bitmask_iterator over \p words.
+///
+/// \param words - pointer to the words of the bitmask on the device.
+/// \param index - optional index of the first bit of the iterator in the words.
+/// \return A \p bitmask_iterator which obtains the bits as \p bool.
+ROCPRIM_HOST_DEVICE inline bitmask_iterator<> make_bitmask_iterator(const unsigned int* words,
+                                                                    const size_t index = 0)
+{
+    return bitmask_iterator<>(words, index);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_PACKED_BITS_ITERATOR_HPP_
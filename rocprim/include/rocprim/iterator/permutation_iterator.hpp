@@ -0,0 +1,240 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_PERMUTATION_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_PERMUTATION_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class permutation_iterator
+/// \brief A random-access input (read-only) iterator adaptor for gathering values through a
+/// sequence of indices.
+///
+/// \par Overview
+/// * A permutation_iterator represents the sequence <tt>values[indices[i]]</tt>, it is advanced
+/// over the indices while the values are accessed at random positions.
+/// * The block load functions (and therefore block_load) recognise it: they first load the
+/// indices of all items of a thread and then issue all the gathers back to back, so that the
+/// loads of the values are in flight at the same time instead of every load of a value waiting
+/// for the load of its index.
+/// * Use it to gather values by a permutation, for example to apply the indices sorted by
+/// radix_sort_pairs to other arrays.
+///
+/// \tparam ValueIterator - type of the random-access iterator to the values.
+/// \tparam IndexIterator - type of the random-access iterator to the indices of the values.
+template<class ValueIterator, class IndexIterator>
+class permutation_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::iterator_traits<ValueIterator>::value_type;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    /// It's `const` since permutation_iterator is a read-only iterator.
+    using reference = const value_type&;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    /// It's `const` since permutation_iterator is a read-only iterator.
+    using pointer = const value_type*;
+    /// A type used for identify distance between iterators.
+    using difference_type = typename std::iterator_traits<IndexIterator>::difference_type;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+    /// The type of the indices.
+    using index_type = typename std::iterator_traits<IndexIterator>::value_type;
+
+    /// \brief Creates a new permutation_iterator.
+    ///
+    /// \param values - iterator to the values, which are accessed at the indices.
+    /// \param indices - iterator to the indices of the values.
+    ROCPRIM_HOST_DEVICE inline permutation_iterator(ValueIterator values, IndexIterator indices)
+        : values_(values), indices_(indices)
+    {}
+
+    /// \brief Returns the iterator to the values.
+    ROCPRIM_HOST_DEVICE inline
+    ValueIterator values() const
+    {
+        return values_;
+    }
+
+    /// \brief Returns the iterator to the indices, which is the current position.
+    ROCPRIM_HOST_DEVICE inline
+    IndexIterator base() const
+    {
+        return indices_;
+    }
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator& operator++()
+    {
+        indices_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator operator++(int)
+    {
+        permutation_iterator old = *this;
+        indices_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator& operator--()
+    {
+        indices_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator operator--(int)
+    {
+        permutation_iterator old = *this;
+        indices_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator*() const
+    {
+        return values_[*indices_];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator[](difference_type distance) const
+    {
+        return values_[indices_[distance]];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator operator+(difference_type distance) const
+    {
+        return permutation_iterator(values_, indices_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator& operator+=(difference_type distance)
+    {
+        indices_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator operator-(difference_type distance) const
+    {
+        return permutation_iterator(values_, indices_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    permutation_iterator& operator-=(difference_type distance)
+    {
+        indices_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(permutation_iterator other) const
+    {
+        return indices_ - other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(permutation_iterator other) const
+    {
+        return indices_ == other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(permutation_iterator other) const
+    {
+        return indices_ != other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(permutation_iterator other) const
+    {
+        return indices_ < other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(permutation_iterator other) const
+    {
+        return indices_ <= other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(permutation_iterator other) const
+    {
+        return indices_ > other.indices_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(permutation_iterator other) const
+    {
+        return indices_ >= other.indices_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    ValueIterator values_;
+    IndexIterator indices_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class ValueIterator, class IndexIterator>
+ROCPRIM_HOST_DEVICE inline permutation_iterator<ValueIterator, IndexIterator> operator+(
+    typename permutation_iterator<ValueIterator, IndexIterator>::difference_type distance,
+    const permutation_iterator<ValueIterator, IndexIterator>&                    iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_permutation_iterator creates a \p permutation_iterator which gathers \p values
+/// at \p indices.
+///
+/// \tparam ValueIterator - type of the random-access iterator to the values.
+/// \tparam IndexIterator - type of the random-access iterator to the indices of the values.
+///
+/// \param values - iterator to the values, which are accessed at the indices.
+/// \param indices - iterator to the indices of the values.
+/// \return A new permutation_iterator that represents <tt>values[indices[i]]</tt>.
+template<class ValueIterator, class IndexIterator>
+ROCPRIM_HOST_DEVICE inline permutation_iterator<ValueIterator, IndexIterator>
+    make_permutation_iterator(ValueIterator values, IndexIterator indices)
+{
+    return permutation_iterator<ValueIterator, IndexIterator>(values, indices);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_PERMUTATION_ITERATOR_HPP_
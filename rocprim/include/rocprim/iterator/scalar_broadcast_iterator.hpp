@@ -0,0 +1,265 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_SCALAR_BROADCAST_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_SCALAR_BROADCAST_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+#include "../intrinsics/warp_shuffle.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace detail
+{
+
+// Loads the value at the address of the first active lane for all lanes of the warp. The address
+// is uniform after readfirstlane, so the load through the constant address space is emitted as a
+// scalar load (s_load) that goes through the scalar cache instead of the vector memory path.
+template<class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto scalar_broadcast_load(const T* ptr) ->
+    typename std::enable_if<sizeof(T) % sizeof(int) == 0 && alignof(T) >= alignof(int), T>::type
+{
+    const T* uniform_ptr = warp_readfirstlane(ptr);
+    return *(const __attribute__((address_space(4))) T*)uniform_ptr;
+}
+
+// Scalar loads work on dwords, other types are loaded from the uniform address with a vector load
+template<class T>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+auto scalar_broadcast_load(const T* ptr) ->
+    typename std::enable_if<!(sizeof(T) % sizeof(int) == 0 && alignof(T) >= alignof(int)),
+                            T>::type
+{
+    return *warp_readfirstlane(ptr);
+}
+
+} // namespace detail
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// \class scalar_broadcast_iterator
+/// \brief A random-access input (read-only) iterator adaptor for warp-uniform reads of array
+/// values.
+///
+/// \par Overview
+/// * A scalar_broadcast_iterator wraps a device pointer of type T. Dereferencing it in a device
+/// function loads the value at the position of the first active lane of the warp and broadcasts
+/// it to all lanes.
+/// * The load is a scalar memory load (\p s_load), which is served by the scalar cache and does
+/// not occupy the vector memory pipeline, when the size of T is a multiple of 4 bytes.
+/// * Use it for reads that are the same for all lanes of a warp, for example the parameters of
+/// a segment processed by a whole warp or a lookup table indexed by a warp-uniform value.
+/// * The values must not be written during the kernel that reads them, since the scalar cache
+/// is not coherent with the vector memory writes.
+/// * Can be exchanged and manipulated within and between host and device functions, it is
+/// dereferenced with a plain load in host functions.
+///
+/// \par Precondition
+/// The iterator and the dereferenced position must be the same for all active lanes of the warp,
+/// otherwise all lanes obtain the value of the first active lane.
+///
+/// \tparam T - type of value that can be obtained by dereferencing the iterator.
+/// \tparam Difference - a type used for identify distance between iterators.
+template<class T, class Difference = std::ptrdiff_t>
+class scalar_broadcast_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::remove_const<T>::type;
+    /// \brief A reference type of the type iterated over (\p value_type).
+    /// It's `const` since scalar_broadcast_iterator is a read-only iterator.
+    using reference = const value_type&;
+    /// \brief A pointer type of the type iterated over (\p value_type).
+    /// It's `const` since scalar_broadcast_iterator is a read-only iterator.
+    using pointer = const value_type*;
+    /// A type used for identify distance between iterators.
+    using difference_type = Difference;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// \brief Creates a new scalar_broadcast_iterator.
+    ///
+    /// \param ptr - pointer to the values on the device.
+    ROCPRIM_HOST_DEVICE inline explicit scalar_broadcast_iterator(const T* ptr = nullptr)
+        : ptr_(ptr)
+    {}
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    const T* base() const
+    {
+        return ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scalar_broadcast_iterator& operator++()
+    {
+        ptr_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scalar_broadcast_iterator operator++(int)
+    {
+        scalar_broadcast_iterator old = *this;
+        ptr_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scalar_broadcast_iterator& operator--()
+    {
+        ptr_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scalar_broadcast_iterator operator--(int)
+    {
+        scalar_broadcast_iterator old = *this;
+        ptr_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator*() const
+    {
+        #ifndef __HIP_DEVICE_COMPILE__
+        return *ptr_;
+        #else
+        return detail::scalar_broadcast_load(ptr_);
+        #endif
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    value_type operator[](difference_type distance) const
+    {
+        scalar_broadcast_iterator i = (*this) + distance;
+        return *i;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scalar_broadcast_iterator operator+(difference_type distance) const
+    {
+        return scalar_broadcast_iterator(ptr_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scalar_broadcast_iterator& operator+=(difference_type distance)
+    {
+        ptr_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scalar_broadcast_iterator operator-(difference_type distance) const
+    {
+        return scalar_broadcast_iterator(ptr_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scalar_broadcast_iterator& operator-=(difference_type distance)
+    {
+        ptr_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(scalar_broadcast_iterator other) const
+    {
+        return ptr_ - other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(scalar_broadcast_iterator other) const
+    {
+        return ptr_ == other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(scalar_broadcast_iterator other) const
+    {
+        return ptr_ != other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(scalar_broadcast_iterator other) const
+    {
+        return ptr_ < other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(scalar_broadcast_iterator other) const
+    {
+        return ptr_ <= other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(scalar_broadcast_iterator other) const
+    {
+        return ptr_ > other.ptr_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(scalar_broadcast_iterator other) const
+    {
+        return ptr_ >= other.ptr_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    const T* ptr_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class T, class Difference>
+ROCPRIM_HOST_DEVICE inline scalar_broadcast_iterator<T, Difference>
+    operator+(Difference distance, const scalar_broadcast_iterator<T, Difference>& iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_scalar_broadcast_iterator creates a \p scalar_broadcast_iterator over \p ptr.
+///
+/// \tparam T - type of the values.
+///
+/// \param ptr - pointer to the values on the device.
+/// \return A \p scalar_broadcast_iterator that loads the values with warp-uniform scalar loads.
+template<class T>
+ROCPRIM_HOST_DEVICE inline scalar_broadcast_iterator<T> make_scalar_broadcast_iterator(const T* ptr)
+{
+    return scalar_broadcast_iterator<T>(ptr);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_SCALAR_BROADCAST_ITERATOR_HPP_
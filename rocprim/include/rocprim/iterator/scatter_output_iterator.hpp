@@ -0,0 +1,234 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_SCATTER_OUTPUT_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_SCATTER_OUTPUT_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \class scatter_output_iterator
+/// \brief A random-access output iterator adaptor for scattering the values assigned to it
+/// by a map.
+///
+/// \par Overview
+/// * A scatter_output_iterator represents the sequence <tt>output[map[i]]</tt>, it is advanced
+/// over the map while the values are stored at random positions of the output.
+/// * Use it to store the output of an algorithm in a permuted order in the same pass, for example
+/// back to the original order of sorted items.
+/// * When the map is not injective, which of the values assigned to the same position is stored
+/// is unspecified.
+///
+/// \tparam OutputIterator - type of the random-access iterator to the output.
+/// \tparam MapIterator - type of the random-access iterator to the positions in the output.
+template<class OutputIterator, class MapIterator>
+class scatter_output_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = typename std::iterator_traits<OutputIterator>::value_type;
+    /// A reference type of the type iterated over, the reference of the output.
+    using reference = typename std::iterator_traits<OutputIterator>::reference;
+    /// A pointer type of the type iterated over (\p value_type).
+    using pointer = typename std::iterator_traits<OutputIterator>::pointer;
+    /// A type used for identify distance between iterators.
+    using difference_type = typename std::iterator_traits<MapIterator>::difference_type;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// \brief Creates a new scatter_output_iterator.
+    ///
+    /// \param output - iterator to the output, which is accessed at the positions of the map.
+    /// \param map - iterator to the positions in the output.
+    ROCPRIM_HOST_DEVICE inline scatter_output_iterator(OutputIterator output, MapIterator map)
+        : output_(output), map_(map)
+    {}
+
+    /// \brief Returns the iterator to the output.
+    ROCPRIM_HOST_DEVICE inline
+    OutputIterator output() const
+    {
+        return output_;
+    }
+
+    /// \brief Returns the iterator to the map, which is the current position.
+    ROCPRIM_HOST_DEVICE inline
+    MapIterator base() const
+    {
+        return map_;
+    }
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    scatter_output_iterator& operator++()
+    {
+        map_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scatter_output_iterator operator++(int)
+    {
+        scatter_output_iterator old = *this;
+        map_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scatter_output_iterator& operator--()
+    {
+        map_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scatter_output_iterator operator--(int)
+    {
+        scatter_output_iterator old = *this;
+        map_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return output_[*map_];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return output_[map_[distance]];
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scatter_output_iterator operator+(difference_type distance) const
+    {
+        return scatter_output_iterator(output_, map_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scatter_output_iterator& operator+=(difference_type distance)
+    {
+        map_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scatter_output_iterator operator-(difference_type distance) const
+    {
+        return scatter_output_iterator(output_, map_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    scatter_output_iterator& operator-=(difference_type distance)
+    {
+        map_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(scatter_output_iterator other) const
+    {
+        return map_ - other.map_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(scatter_output_iterator other) const
+    {
+        return map_ == other.map_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(scatter_output_iterator other) const
+    {
+        return map_ != other.map_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(scatter_output_iterator other) const
+    {
+        return map_ < other.map_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(scatter_output_iterator other) const
+    {
+        return map_ <= other.map_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(scatter_output_iterator other) const
+    {
+        return map_ > other.map_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(scatter_output_iterator other) const
+    {
+        return map_ >= other.map_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    OutputIterator output_;
+    MapIterator    map_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class OutputIterator, class MapIterator>
+ROCPRIM_HOST_DEVICE inline scatter_output_iterator<OutputIterator, MapIterator> operator+(
+    typename scatter_output_iterator<OutputIterator, MapIterator>::difference_type distance,
+    const scatter_output_iterator<OutputIterator, MapIterator>&                    iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_scatter_output_iterator creates a scatter_output_iterator which stores the values
+/// assigned to it to \p output at the positions of \p map.
+///
+/// \tparam OutputIterator - type of the random-access iterator to the output.
+/// \tparam MapIterator - type of the random-access iterator to the positions in the output.
+///
+/// \param output - iterator to the output, which is accessed at the positions of the map.
+/// \param map - iterator to the positions in the output.
+/// \return A new scatter_output_iterator that represents <tt>output[map[i]]</tt>.
+template<class OutputIterator, class MapIterator>
+ROCPRIM_HOST_DEVICE inline scatter_output_iterator<OutputIterator, MapIterator>
+    make_scatter_output_iterator(OutputIterator output, MapIterator map)
+{
+    return scatter_output_iterator<OutputIterator, MapIterator>(output, map);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_SCATTER_OUTPUT_ITERATOR_HPP_
@@ -0,0 +1,268 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_TEE_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_TEE_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The reference of tee_iterator, which stores the values assigned to it through both iterators
+template<class OutputIterator1, class OutputIterator2>
+class tee_reference
+{
+public:
+    ROCPRIM_HOST_DEVICE inline tee_reference(OutputIterator1 first, OutputIterator2 second)
+        : first_(first), second_(second)
+    {}
+
+    template<class V>
+    ROCPRIM_HOST_DEVICE inline
+    tee_reference& operator=(const V& value)
+    {
+        *first_  = value;
+        *second_ = value;
+        return *this;
+    }
+
+private:
+    OutputIterator1 first_;
+    OutputIterator2 second_;
+};
+
+} // end namespace detail
+
+/// \class tee_iterator
+/// \brief A random-access output (write-only) iterator adaptor for storing the values assigned
+/// to it to two outputs.
+///
+/// \par Overview
+/// * A tee_iterator stores every value assigned to the dereferenced iterator through both
+/// underlying iterators, at the same position.
+/// * Use it to write the output of an algorithm to two buffers in the same pass, combined with
+/// transform_output_iterator the two outputs can hold different post-processed values.
+/// * Block stores of the vectorized method store the items to both outputs with vectorized
+/// stores when the underlying iterators are pointers.
+/// * Its \p value_type is \p void as for standard output iterators, so algorithms that deduce
+/// the type of the results from the output iterator use the type of their results instead.
+///
+/// \tparam OutputIterator1 - type of the first random-access output iterator.
+/// \tparam OutputIterator2 - type of the second random-access output iterator.
+template<class OutputIterator1, class OutputIterator2>
+class tee_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = void;
+    /// A reference type of the type iterated over, which stores the values to both outputs.
+    using reference = detail::tee_reference<OutputIterator1, OutputIterator2>;
+    /// A pointer type of the type iterated over (\p value_type).
+    using pointer = void;
+    /// A type used for identify distance between iterators.
+    using difference_type = typename std::iterator_traits<OutputIterator1>::difference_type;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+
+    /// \brief Creates a new tee_iterator.
+    ///
+    /// \param first - the first output iterator.
+    /// \param second - the second output iterator.
+    ROCPRIM_HOST_DEVICE inline tee_iterator(OutputIterator1 first, OutputIterator2 second)
+        : first_(first), second_(second)
+    {}
+
+    /// \brief Returns the first output iterator.
+    ROCPRIM_HOST_DEVICE inline
+    OutputIterator1 first() const
+    {
+        return first_;
+    }
+
+    /// \brief Returns the second output iterator.
+    ROCPRIM_HOST_DEVICE inline
+    OutputIterator2 second() const
+    {
+        return second_;
+    }
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    tee_iterator& operator++()
+    {
+        first_++;
+        second_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tee_iterator operator++(int)
+    {
+        tee_iterator old = *this;
+        ++(*this);
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tee_iterator& operator--()
+    {
+        first_--;
+        second_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tee_iterator operator--(int)
+    {
+        tee_iterator old = *this;
+        --(*this);
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference(first_, second_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return reference(first_ + distance, second_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tee_iterator operator+(difference_type distance) const
+    {
+        return tee_iterator(first_ + distance, second_ + distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tee_iterator& operator+=(difference_type distance)
+    {
+        first_ += distance;
+        second_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tee_iterator operator-(difference_type distance) const
+    {
+        return tee_iterator(first_ - distance, second_ - distance);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    tee_iterator& operator-=(difference_type distance)
+    {
+        first_ -= distance;
+        second_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(tee_iterator other) const
+    {
+        return first_ - other.first_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(tee_iterator other) const
+    {
+        return first_ == other.first_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(tee_iterator other) const
+    {
+        return first_ != other.first_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(tee_iterator other) const
+    {
+        return first_ < other.first_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(tee_iterator other) const
+    {
+        return first_ <= other.first_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(tee_iterator other) const
+    {
+        return first_ > other.first_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(tee_iterator other) const
+    {
+        return first_ >= other.first_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    OutputIterator1 first_;
+    OutputIterator2 second_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class OutputIterator1, class OutputIterator2>
+ROCPRIM_HOST_DEVICE inline tee_iterator<OutputIterator1, OutputIterator2>
+    operator+(typename tee_iterator<OutputIterator1, OutputIterator2>::difference_type distance,
+              const tee_iterator<OutputIterator1, OutputIterator2>&                    iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_tee_iterator creates a tee_iterator which stores the values assigned to it through
+/// both \p first and \p second.
+///
+/// \tparam OutputIterator1 - type of the first random-access output iterator.
+/// \tparam OutputIterator2 - type of the second random-access output iterator.
+///
+/// \param first - the first output iterator.
+/// \param second - the second output iterator.
+/// \return A new tee_iterator object.
+template<class OutputIterator1, class OutputIterator2>
+ROCPRIM_HOST_DEVICE inline tee_iterator<OutputIterator1, OutputIterator2>
+    make_tee_iterator(OutputIterator1 first, OutputIterator2 second)
+{
+    return tee_iterator<OutputIterator1, OutputIterator2>(first, second);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_TEE_ITERATOR_HPP_
@@ -88,6 +88,20 @@ public:
     {
     }
 
+    /// \brief Returns the underlying iterator.
+    ROCPRIM_HOST_DEVICE inline
+    InputIterator base() const
+    {
+        return iterator_;
+    }
+
+    /// \brief Returns the unary function used to transform values.
+    ROCPRIM_HOST_DEVICE inline
+    UnaryFunction functor() const
+    {
+        return transform_;
+    }
+
     #ifndef DOXYGEN_SHOULD_SKIP_THIS
     ROCPRIM_HOST_DEVICE inline
     transform_iterator& operator++()
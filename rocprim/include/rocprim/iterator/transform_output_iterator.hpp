@@ -0,0 +1,267 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_ITERATOR_TRANSFORM_OUTPUT_ITERATOR_HPP_
+#define ROCPRIM_ITERATOR_TRANSFORM_OUTPUT_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "../config.hpp"
+
+/// \addtogroup iteratormodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// The reference of transform_output_iterator, which stores the transformed values assigned to it
+template<class OutputIterator, class UnaryFunction>
+class transform_output_reference
+{
+public:
+    ROCPRIM_HOST_DEVICE inline transform_output_reference(OutputIterator iterator,
+                                                          UnaryFunction  transform)
+        : iterator_(iterator), transform_(transform)
+    {}
+
+    template<class V>
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_reference& operator=(const V& value)
+    {
+        *iterator_ = transform_(value);
+        return *this;
+    }
+
+private:
+    OutputIterator iterator_;
+    UnaryFunction  transform_;
+};
+
+} // end namespace detail
+
+/// \class transform_output_iterator
+/// \brief A random-access output (write-only) iterator adaptor for transforming the values
+/// assigned to it before they are stored.
+///
+/// \par Overview
+/// * A transform_output_iterator applies a functor of type \p UnaryFunction to every value
+/// assigned to the dereferenced iterator, and stores the result through the underlying iterator.
+/// * Use it to fuse the post-processing of the output of an algorithm (scale, cast, etc.)
+/// into the algorithm, which saves a full pass over the output.
+/// * Block stores of the vectorized method transform the items in registers and store them
+/// with vectorized stores when the underlying iterator is a pointer.
+/// * Its \p value_type is \p void as for standard output iterators, so algorithms that deduce
+/// the type of the results from the output iterator use the type of their results instead.
+///
+/// \tparam OutputIterator - type of the underlying random-access output iterator.
+/// \tparam UnaryFunction - type of the transform functor.
+template<class OutputIterator, class UnaryFunction>
+class transform_output_iterator
+{
+public:
+    /// The type of the value that can be obtained by dereferencing the iterator.
+    using value_type = void;
+    /// A reference type of the type iterated over, which stores the transformed values.
+    using reference = detail::transform_output_reference<OutputIterator, UnaryFunction>;
+    /// A pointer type of the type iterated over (\p value_type).
+    using pointer = void;
+    /// A type used for identify distance between iterators.
+    using difference_type = typename std::iterator_traits<OutputIterator>::difference_type;
+    /// The category of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+    /// The type of unary function used to transform the values.
+    using unary_function = UnaryFunction;
+
+    /// \brief Creates a new transform_output_iterator.
+    ///
+    /// \param iterator - output iterator to store the transformed values to.
+    /// \param transform - unary function used to transform the values assigned to the iterator.
+    ROCPRIM_HOST_DEVICE inline transform_output_iterator(OutputIterator iterator,
+                                                         UnaryFunction  transform)
+        : iterator_(iterator), transform_(transform)
+    {}
+
+    /// \brief Returns the underlying iterator.
+    ROCPRIM_HOST_DEVICE inline
+    OutputIterator base() const
+    {
+        return iterator_;
+    }
+
+    /// \brief Returns the unary function used to transform values.
+    ROCPRIM_HOST_DEVICE inline
+    UnaryFunction functor() const
+    {
+        return transform_;
+    }
+
+    #ifndef DOXYGEN_SHOULD_SKIP_THIS
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator& operator++()
+    {
+        iterator_++;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator operator++(int)
+    {
+        transform_output_iterator old = *this;
+        iterator_++;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator& operator--()
+    {
+        iterator_--;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator operator--(int)
+    {
+        transform_output_iterator old = *this;
+        iterator_--;
+        return old;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator*() const
+    {
+        return reference(iterator_, transform_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    reference operator[](difference_type distance) const
+    {
+        return reference(iterator_ + distance, transform_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator operator+(difference_type distance) const
+    {
+        return transform_output_iterator(iterator_ + distance, transform_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator& operator+=(difference_type distance)
+    {
+        iterator_ += distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator operator-(difference_type distance) const
+    {
+        return transform_output_iterator(iterator_ - distance, transform_);
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    transform_output_iterator& operator-=(difference_type distance)
+    {
+        iterator_ -= distance;
+        return *this;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    difference_type operator-(transform_output_iterator other) const
+    {
+        return iterator_ - other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator==(transform_output_iterator other) const
+    {
+        return iterator_ == other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator!=(transform_output_iterator other) const
+    {
+        return iterator_ != other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<(transform_output_iterator other) const
+    {
+        return iterator_ < other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator<=(transform_output_iterator other) const
+    {
+        return iterator_ <= other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>(transform_output_iterator other) const
+    {
+        return iterator_ > other.iterator_;
+    }
+
+    ROCPRIM_HOST_DEVICE inline
+    bool operator>=(transform_output_iterator other) const
+    {
+        return iterator_ >= other.iterator_;
+    }
+    #endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private:
+    OutputIterator iterator_;
+    UnaryFunction  transform_;
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template<class OutputIterator, class UnaryFunction>
+ROCPRIM_HOST_DEVICE inline transform_output_iterator<OutputIterator, UnaryFunction> operator+(
+    typename transform_output_iterator<OutputIterator, UnaryFunction>::difference_type distance,
+    const transform_output_iterator<OutputIterator, UnaryFunction>&                    iterator)
+{
+    return iterator + distance;
+}
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+/// make_transform_output_iterator creates a transform_output_iterator which stores the values
+/// assigned to it through \p iterator after transforming them with \p transform.
+///
+/// \tparam OutputIterator - type of the underlying random-access output iterator.
+/// \tparam UnaryFunction - type of the transform functor.
+///
+/// \param iterator - output iterator to store the transformed values to.
+/// \param transform - transform functor to use in created transform_output_iterator.
+/// \return A new transform_output_iterator object.
+template<class OutputIterator, class UnaryFunction>
+ROCPRIM_HOST_DEVICE inline transform_output_iterator<OutputIterator, UnaryFunction>
+    make_transform_output_iterator(OutputIterator iterator, UnaryFunction transform)
+{
+    return transform_output_iterator<OutputIterator, UnaryFunction>(iterator, transform);
+}
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group iteratormodule
+
+#endif // ROCPRIM_ITERATOR_TRANSFORM_OUTPUT_ITERATOR_HPP_
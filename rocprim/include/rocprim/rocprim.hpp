@@ -42,9 +42,15 @@
 #include "thread/thread_reduce.hpp"
 #include "thread/thread_scan.hpp"
 #include "thread/thread_search.hpp"
+#include "thread/thread_sort.hpp"
 #include "thread/thread_store.hpp"
 
+#include "warp/warp_discontinuity.hpp"
+#include "warp/warp_histogram.hpp"
+#include "warp/warp_merge_sort.hpp"
+#include "warp/warp_radix_sort.hpp"
 #include "warp/warp_reduce.hpp"
+#include "warp/warp_reduce_by_key.hpp"
 #include "warp/warp_scan.hpp"
 #include "warp/warp_sort.hpp"
 
@@ -52,39 +58,89 @@
 #include "block/block_exchange.hpp"
 #include "block/block_histogram.hpp"
 #include "block/block_load.hpp"
+#include "block/block_load_balancing_search.hpp"
+#include "block/block_merge.hpp"
 #include "block/block_radix_sort.hpp"
+#include "block/block_reduce_by_key.hpp"
 #include "block/block_run_length_decode.hpp"
 #include "block/block_scan.hpp"
 #include "block/block_sort.hpp"
 #include "block/block_store.hpp"
 #include "block/config.hpp"
 
+#include "device/decoupled_lookback.hpp"
 #include "device/device_adjacent_difference.hpp"
 #include "device/device_adjacent_find.hpp"
+#include "device/device_affine_scan.hpp"
+#include "device/device_arg_reduce.hpp"
+#include "device/device_argsort.hpp"
+#include "device/device_batched.hpp"
 #include "device/device_binary_search.hpp"
+#include "device/device_bitpack.hpp"
 #include "device/device_copy.hpp"
+#include "device/device_counting_sort.hpp"
+#include "device/device_delta.hpp"
+#include "device/device_distinct.hpp"
 #include "device/device_find_end.hpp"
 #include "device/device_find_first_of.hpp"
+#include "device/device_for_each.hpp"
+#include "device/device_gather_scatter.hpp"
+#include "device/device_graph.hpp"
+#include "device/device_hash_table.hpp"
 #include "device/device_histogram.hpp"
+#include "device/device_lexicographic_sort.hpp"
+#include "device/device_load_balancing_search.hpp"
 #include "device/device_memcpy.hpp"
 #include "device/device_merge.hpp"
+#include "device/device_merge_k.hpp"
 #include "device/device_merge_sort.hpp"
+#include "device/device_multi_reduce.hpp"
+#include "device/device_multi_search.hpp"
 #include "device/device_nth_element.hpp"
 #include "device/device_partial_sort.hpp"
 #include "device/device_partition.hpp"
+#include "device/device_partition_n.hpp"
+#include "device/device_pipeline.hpp"
+#include "device/device_quantiles.hpp"
+#include "device/device_plan.hpp"
 #include "device/device_radix_sort.hpp"
+#include "device/device_radix_sort_columns.hpp"
+#include "device/device_radix_sort_distributed.hpp"
+#include "device/device_radix_sort_histograms.hpp"
+#include "device/device_radix_sort_out_of_core.hpp"
 #include "device/device_reduce.hpp"
 #include "device/device_reduce_by_key.hpp"
+#include "device/device_run_length_decode.hpp"
 #include "device/device_run_length_encode.hpp"
+#include "device/device_sample_sort.hpp"
 #include "device/device_scan.hpp"
 #include "device/device_scan_by_key.hpp"
+#include "device/device_scan_distributed.hpp"
+#include "device/device_scan_search.hpp"
 #include "device/device_search.hpp"
 #include "device/device_search_n.hpp"
+#include "device/device_segmented_merge_sort.hpp"
 #include "device/device_segmented_radix_sort.hpp"
 #include "device/device_segmented_reduce.hpp"
 #include "device/device_segmented_scan.hpp"
+#include "device/device_segmented_select.hpp"
 #include "device/device_select.hpp"
+#include "device/device_set_operations.hpp"
+#include "device/device_sorted_insert.hpp"
+#include "device/device_string_sort.hpp"
+#include "device/device_topk.hpp"
 #include "device/device_transform.hpp"
+#include "device/device_transpose.hpp"
+#include "device/diagnostics.hpp"
+#include "device/execution_budget.hpp"
+#include "device/execution_policy.hpp"
+#include "device/instrumentation.hpp"
+#include "device/managed_memory.hpp"
+#include "device/temp_storage_arena.hpp"
+#include "device/tile_scheduler.hpp"
+#include "device/tuned_params.hpp"
+#include "device/tuning_database.hpp"
+#include "device/work_queue.hpp"
 
 /// \brief The top level rocPRIM namespace.
 BEGIN_ROCPRIM_NAMESPACE
@@ -202,6 +202,16 @@ struct radix_key_codec_base<::rocprim::bfloat16>
     : radix_key_codec_floating<::rocprim::bfloat16, unsigned short>
 {};
 
+template<>
+struct radix_key_codec_base<::rocprim::fp8_e4m3>
+    : radix_key_codec_floating<::rocprim::fp8_e4m3, unsigned char>
+{};
+
+template<>
+struct radix_key_codec_base<::rocprim::fp8_e5m2>
+    : radix_key_codec_floating<::rocprim::fp8_e5m2, unsigned char>
+{};
+
 template<>
 struct radix_key_codec_base<float> : radix_key_codec_floating<float, unsigned int>
 {};
@@ -33,6 +33,8 @@
 #include "../config.hpp"
 #include "../detail/various.hpp"
 
+#include <type_traits>
+
 BEGIN_ROCPRIM_NAMESPACE
 
 /// \defgroup thread_load Thread Load Functions
@@ -125,10 +127,30 @@ ROCPRIM_ASM_THREAD_LOAD_GROUP(load_volatile, "glc", "s_waitcnt", "vmcnt");
 
 // TODO find correct modifiers to match these
 ROCPRIM_ASM_THREAD_LOAD_GROUP(load_ldg, "", "s_waitcnt", "");
-ROCPRIM_ASM_THREAD_LOAD_GROUP(load_cs, "", "s_waitcnt", "");
 
 #endif
 
+// Loads a value with the caching behaviour of MODIFIER. load_cs of arithmetic types is a
+// nontemporal load, which does not keep the line in the caches where the architecture allows,
+// other types and modifiers are loaded by AsmThreadLoad.
+template<cache_load_modifier MODIFIER, typename T>
+ROCPRIM_DEVICE ROCPRIM_INLINE auto cache_modified_load(const T* ptr) ->
+    typename std::enable_if<MODIFIER == load_cs && std::is_arithmetic<T>::value
+                                && !std::is_same<T, bool>::value,
+                            T>::type
+{
+    return __builtin_nontemporal_load(ptr);
+}
+
+template<cache_load_modifier MODIFIER, typename T>
+ROCPRIM_DEVICE ROCPRIM_INLINE auto cache_modified_load(const T* ptr) ->
+    typename std::enable_if<!(MODIFIER == load_cs && std::is_arithmetic<T>::value
+                              && !std::is_same<T, bool>::value),
+                            T>::type
+{
+    return AsmThreadLoad<MODIFIER, T>(const_cast<T*>(ptr));
+}
+
 }
 
 /// \addtogroup thread_load
@@ -157,7 +179,7 @@ template<cache_load_modifier MODIFIER = load_default, typename InputIteratorT>
 template<cache_load_modifier MODIFIER = load_default, typename T>
 [[deprecated("Use a dereference instead.")]] ROCPRIM_DEVICE ROCPRIM_INLINE T thread_load(T* ptr)
 {
-    return detail::AsmThreadLoad<MODIFIER, T>(ptr);
+    return detail::cache_modified_load<MODIFIER>(ptr);
 }
 
 /// @}
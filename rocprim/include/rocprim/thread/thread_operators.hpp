@@ -167,6 +167,75 @@ struct arg_min
     }
 };
 
+/// \brief Functor that adds two \p compensated_sum values and keeps the rounding error.
+///
+/// The rounding error of adding the two sums is computed exactly (the TwoSum algorithm of
+/// Knuth, without branches) and added to their compensations, so the result does not depend on
+/// the magnitudes of the operands and the order of the additions in a tree reduction or scan
+/// only affects the compensation. The error terms are lost when the code is compiled with
+/// reassociating floating point optimizations such as \p -ffast-math. The sums must not
+/// overflow, since the compensation of an infinite sum is not a number.
+///
+/// \tparam T - the floating point type of the sums, e.g. \p float.
+template<class T>
+struct compensated_plus
+{
+    /// \brief Invocation operator
+    ROCPRIM_HOST_DEVICE inline
+    constexpr compensated_sum<T> operator()(const compensated_sum<T>& a,
+                                            const compensated_sum<T>& b) const
+    {
+        const T sum     = a.sum + b.sum;
+        const T b_part  = sum - a.sum;
+        const T a_error = a.sum - (sum - b_part);
+        const T b_error = b.sum - b_part;
+        return compensated_sum<T>(sum, (a.compensation + b.compensation) + (a_error + b_error));
+    }
+};
+
+/// \brief Functor that composes two \p affine_map values, applying \p first before \p second.
+///
+/// The composition is associative but not commutative, so it can be the operator of scans and
+/// reductions, which keep the order of their operands.
+///
+/// \tparam T - the type the maps are composed in.
+template<class T>
+struct affine_compose
+{
+    /// \brief Invocation operator
+    ROCPRIM_HOST_DEVICE inline
+    constexpr affine_map<T> operator()(const affine_map<T>& first,
+                                       const affine_map<T>& second) const
+    {
+        return affine_map<T>(second.a * first.a, second.a * first.b + second.b);
+    }
+};
+
+/// \brief Functor that combines the \p reduce_statistics of two sets of values.
+///
+/// The statistics of an empty set are the identity, so they can be the initial value of a
+/// reduction or scan.
+///
+/// \tparam T - the type the statistics are accumulated in.
+template<class T>
+struct reduce_statistics_plus
+{
+    /// \brief Invocation operator
+    ROCPRIM_HOST_DEVICE inline
+    constexpr reduce_statistics<T> operator()(const reduce_statistics<T>& a,
+                                              const reduce_statistics<T>& b) const
+    {
+        return a.count == 0 ? b
+               : b.count == 0
+                   ? a
+                   : reduce_statistics<T>(b.minimum < a.minimum ? b.minimum : a.minimum,
+                                          a.maximum < b.maximum ? b.maximum : a.maximum,
+                                          a.sum + b.sum,
+                                          a.sum_of_squares + b.sum_of_squares,
+                                          a.count + b.count);
+    }
+};
+
 /// @}
 // end group thread_operators
 
@@ -0,0 +1,297 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_THREAD_THREAD_SORT_HPP_
+#define ROCPRIM_THREAD_THREAD_SORT_HPP_
+
+#include "../config.hpp"
+#include "../functional.hpp"
+#include "../types.hpp"
+
+#include <type_traits>
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Applies Batcher's odd-even merge sort network of Size inputs, which is defined for any Size.
+// The loops only depend on Size, so they are unrolled completely and every comparator indexes
+// the items with constants, which keeps the items in registers.
+template<unsigned int Size, class CompareExchange>
+ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+void batcher_sort_network(CompareExchange& compare_exchange)
+{
+    ROCPRIM_UNROLL
+    for(unsigned int p = 1; p < Size; p <<= 1)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int k = p; k >= 1; k >>= 1)
+        {
+            ROCPRIM_UNROLL
+            for(unsigned int j = k % p; j + k < Size; j += 2 * k)
+            {
+                ROCPRIM_UNROLL
+                for(unsigned int i = 0; i < k && i + j + k < Size; i++)
+                {
+                    if((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                    {
+                        compare_exchange(i + j, i + j + k);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template<class Key, unsigned int ItemsPerThread, class BinaryFunction>
+struct thread_sort_keys_exchange
+{
+    Key (&keys)[ItemsPerThread];
+    BinaryFunction& compare_function;
+
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void operator()(const unsigned int i, const unsigned int j)
+    {
+        if(compare_function(keys[j], keys[i]))
+        {
+            ::rocprim::swap(keys[i], keys[j]);
+        }
+    }
+};
+
+template<class Key, class Value, unsigned int ItemsPerThread, class BinaryFunction>
+struct thread_sort_pairs_exchange
+{
+    Key (&keys)[ItemsPerThread];
+    Value (&values)[ItemsPerThread];
+    BinaryFunction& compare_function;
+
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void operator()(const unsigned int i, const unsigned int j)
+    {
+        if(compare_function(keys[j], keys[i]))
+        {
+            ::rocprim::swap(keys[i], keys[j]);
+            ::rocprim::swap(values[i], values[j]);
+        }
+    }
+};
+
+// Makes the network stable by breaking ties with the original positions of the items. Items
+// at positions of at least valid compare greater than all valid items, and among each other by
+// position, so they end up where they started.
+template<class Key, class Value, unsigned int ItemsPerThread, class BinaryFunction>
+struct thread_sort_stable_exchange
+{
+    static constexpr bool with_values = !std::is_same<Value, ::rocprim::empty_type>::value;
+
+    Key (&keys)[ItemsPerThread];
+    Value* values;
+    unsigned int (&ranks)[ItemsPerThread];
+    BinaryFunction&    compare_function;
+    const unsigned int valid;
+
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    bool less(const unsigned int a, const unsigned int b)
+    {
+        if(ranks[a] >= valid || ranks[b] >= valid)
+        {
+            return ranks[b] >= valid && (ranks[a] < valid || ranks[a] < ranks[b]);
+        }
+        return compare_function(keys[a], keys[b])
+               || (!compare_function(keys[b], keys[a]) && ranks[a] < ranks[b]);
+    }
+
+    ROCPRIM_DEVICE ROCPRIM_FORCE_INLINE
+    void operator()(const unsigned int i, const unsigned int j)
+    {
+        if(less(j, i))
+        {
+            ::rocprim::swap(keys[i], keys[j]);
+            ::rocprim::swap(ranks[i], ranks[j]);
+            if ROCPRIM_IF_CONSTEXPR(with_values)
+            {
+                ::rocprim::swap(values[i], values[j]);
+            }
+        }
+    }
+};
+
+// Odd-even transposition sort, which is stable by itself. It needs more comparators than the
+// network, but no ranks and only one comparison per comparator, so it is faster for a few items.
+template<class Key, class Value, unsigned int ItemsPerThread, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void thread_sort_transposition(Key (&keys)[ItemsPerThread],
+                               Value*             values,
+                               BinaryFunction&    compare_function,
+                               const unsigned int valid)
+{
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int j = i & 1u; j + 1 < ItemsPerThread; j += 2u)
+        {
+            if(j + 1 < valid && compare_function(keys[j + 1], keys[j]))
+            {
+                ::rocprim::swap(keys[j + 1], keys[j]);
+                if ROCPRIM_IF_CONSTEXPR(!std::is_same<Value, ::rocprim::empty_type>::value)
+                {
+                    ::rocprim::swap(values[j + 1], values[j]);
+                }
+            }
+        }
+    }
+}
+
+// The number of items up to which odd-even transposition sort is used for stable sorts.
+constexpr unsigned int thread_sort_transposition_max_items = 4;
+
+template<class Key, class Value, unsigned int ItemsPerThread, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void thread_sort_stable_impl(Key (&keys)[ItemsPerThread],
+                             Value*             values,
+                             BinaryFunction&    compare_function,
+                             const unsigned int valid)
+{
+    if ROCPRIM_IF_CONSTEXPR(ItemsPerThread <= thread_sort_transposition_max_items)
+    {
+        thread_sort_transposition(keys, values, compare_function, valid);
+    }
+    else
+    {
+        unsigned int ranks[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            ranks[i] = i;
+        }
+        thread_sort_stable_exchange<Key, Value, ItemsPerThread, BinaryFunction> exchange{
+            keys,
+            values,
+            ranks,
+            compare_function,
+            valid};
+        batcher_sort_network<ItemsPerThread>(exchange);
+    }
+}
+
+} // end namespace detail
+
+/// \defgroup thread_sort Thread Sort Functions
+/// \ingroup threadmodule
+
+/// \addtogroup thread_sort
+/// @{
+
+/// \brief Sorts the items of a thread in registers with a sorting network.
+///
+/// The items are sorted with Batcher's odd-even merge sort network, which is generated at
+/// compile time for \p ItemsPerThread items and indexes the items only with constants, so the
+/// items stay in registers. The sort is not stable.
+///
+/// \tparam Key - [inferred] the key type.
+/// \tparam ItemsPerThread - [inferred] the number of items of the thread.
+/// \tparam BinaryFunction - [inferred] the type of the comparison function.
+///
+/// \param [in,out] keys - the keys to sort.
+/// \param [in] compare_function - comparison function object which returns \p true if the
+/// first argument is ordered before the second.
+template<class Key, unsigned int ItemsPerThread, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void thread_sort(Key (&keys)[ItemsPerThread], BinaryFunction compare_function)
+{
+    detail::thread_sort_keys_exchange<Key, ItemsPerThread, BinaryFunction> exchange{
+        keys,
+        compare_function};
+    detail::batcher_sort_network<ItemsPerThread>(exchange);
+}
+
+/// \brief Sorts the key-value pairs of a thread in registers with a sorting network.
+///
+/// Same as the keys-only \p thread_sort, the values are moved with their keys.
+///
+/// \param [in,out] keys - the keys to sort.
+/// \param [in,out] values - the values of the keys.
+/// \param [in] compare_function - comparison function object which returns \p true if the
+/// first argument is ordered before the second.
+template<class Key, class Value, unsigned int ItemsPerThread, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void thread_sort(Key (&keys)[ItemsPerThread],
+                 Value (&values)[ItemsPerThread],
+                 BinaryFunction compare_function)
+{
+    detail::thread_sort_pairs_exchange<Key, Value, ItemsPerThread, BinaryFunction> exchange{
+        keys,
+        values,
+        compare_function};
+    detail::batcher_sort_network<ItemsPerThread>(exchange);
+}
+
+/// \brief Stably sorts the items of a thread in registers.
+///
+/// Items that compare equal keep their order. Up to 4 items are sorted with odd-even
+/// transposition sort, more items with the network of \p thread_sort, which breaks ties with
+/// the original positions of the items kept in additional registers.
+///
+/// \param [in,out] keys - the keys to sort.
+/// \param [in] compare_function - comparison function object which returns \p true if the
+/// first argument is ordered before the second.
+/// \param [in] valid - optional number of valid items, the items from \p valid on are not
+/// compared and left in place.
+template<class Key, unsigned int ItemsPerThread, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void thread_sort_stable(Key (&keys)[ItemsPerThread],
+                        BinaryFunction     compare_function,
+                        const unsigned int valid = ItemsPerThread)
+{
+    detail::thread_sort_stable_impl(keys,
+                                    static_cast<::rocprim::empty_type*>(nullptr),
+                                    compare_function,
+                                    valid);
+}
+
+/// \brief Stably sorts the key-value pairs of a thread in registers.
+///
+/// Same as the keys-only \p thread_sort_stable, the values are moved with their keys.
+///
+/// \param [in,out] keys - the keys to sort.
+/// \param [in,out] values - the values of the keys.
+/// \param [in] compare_function - comparison function object which returns \p true if the
+/// first argument is ordered before the second.
+/// \param [in] valid - optional number of valid items, the items from \p valid on are not
+/// compared and left in place.
+template<class Key, class Value, unsigned int ItemsPerThread, class BinaryFunction>
+ROCPRIM_DEVICE ROCPRIM_INLINE
+void thread_sort_stable(Key (&keys)[ItemsPerThread],
+                        Value (&values)[ItemsPerThread],
+                        BinaryFunction     compare_function,
+                        const unsigned int valid = ItemsPerThread)
+{
+    detail::thread_sort_stable_impl(keys, values, compare_function, valid);
+}
+
+/// @}
+// end of group thread_sort
+
+END_ROCPRIM_NAMESPACE
+
+#endif // ROCPRIM_THREAD_THREAD_SORT_HPP_
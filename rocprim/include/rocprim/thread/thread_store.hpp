@@ -34,6 +34,8 @@
 #include "../config.hpp"
 #include "../detail/various.hpp"
 
+#include <type_traits>
+
 BEGIN_ROCPRIM_NAMESPACE
 
 /// \defgroup thread_store Thread Store Functions
@@ -124,11 +126,28 @@ ROCPRIM_ASM_THREAD_STORE_GROUP(store_cg, "glc slc", "s_waitcnt", "");
 ROCPRIM_ASM_THREAD_STORE_GROUP(store_wt, "glc", "s_waitcnt", "vmcnt");
 ROCPRIM_ASM_THREAD_STORE_GROUP(store_volatile, "glc", "s_waitcnt", "vmcnt");
 #endif
-// TODO find correct modifiers to match these
-ROCPRIM_ASM_THREAD_STORE_GROUP(store_cs, "", "s_waitcnt", "");
 
 #endif
 
+// Stores a value with the caching behaviour of MODIFIER. store_cs of arithmetic types is a
+// nontemporal store, which does not keep the line in the caches where the architecture allows,
+// other types and modifiers are stored by AsmThreadStore.
+template<cache_store_modifier MODIFIER, typename T>
+ROCPRIM_DEVICE ROCPRIM_INLINE auto cache_modified_store(T* ptr, T val) ->
+    typename std::enable_if<MODIFIER == store_cs && std::is_arithmetic<T>::value
+                            && !std::is_same<T, bool>::value>::type
+{
+    __builtin_nontemporal_store(val, ptr);
+}
+
+template<cache_store_modifier MODIFIER, typename T>
+ROCPRIM_DEVICE ROCPRIM_INLINE auto cache_modified_store(T* ptr, T val) ->
+    typename std::enable_if<!(MODIFIER == store_cs && std::is_arithmetic<T>::value
+                              && !std::is_same<T, bool>::value)>::type
+{
+    AsmThreadStore<MODIFIER, T>(ptr, val);
+}
+
 }
 
 /// \addtogroup thread_store
@@ -156,7 +175,7 @@ template<cache_store_modifier MODIFIER = store_default, typename T>
 [[deprecated("Use a dereference instead.")]] ROCPRIM_DEVICE ROCPRIM_INLINE void thread_store(T* ptr,
                                                                                              T  val)
 {
-    detail::AsmThreadStore<MODIFIER, T>(ptr, val);
+    detail::cache_modified_store<MODIFIER>(ptr, val);
 }
 
 /// @}
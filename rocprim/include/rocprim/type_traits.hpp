@@ -36,14 +36,16 @@
 
 BEGIN_ROCPRIM_NAMESPACE
 
-/// \brief Extension of `std::is_floating_point`, which includes support for \ref rocprim::half and \ref rocprim::bfloat16.
+/// \brief Extension of `std::is_floating_point`, which includes support for \ref rocprim::half, \ref rocprim::bfloat16 and the 8-bit floating point types.
 template<class T>
 struct is_floating_point
     : std::integral_constant<
         bool,
         std::is_floating_point<T>::value ||
         std::is_same<::rocprim::half, typename std::remove_cv<T>::type>::value ||
-        std::is_same<::rocprim::bfloat16, typename std::remove_cv<T>::type>::value
+        std::is_same<::rocprim::bfloat16, typename std::remove_cv<T>::type>::value ||
+        std::is_same<::rocprim::fp8_e4m3, typename std::remove_cv<T>::type>::value ||
+        std::is_same<::rocprim::fp8_e5m2, typename std::remove_cv<T>::type>::value
     > {};
 
 /// \brief Extension of `std::is_integral`, which includes support for 128-bit integers.
@@ -56,7 +58,7 @@ struct is_integral
               || std::is_same<::rocprim::uint128_t, typename std::remove_cv<T>::type>::value>
 {};
 
-/// \brief Extension of `std::is_arithmetic`, which includes support for \ref rocprim::half , \ref rocprim::bfloat16 and 128-bit integers.
+/// \brief Extension of `std::is_arithmetic`, which includes support for \ref rocprim::half , \ref rocprim::bfloat16 , the 8-bit floating point types and 128-bit integers.
 template<class T>
 struct is_arithmetic
     : std::integral_constant<
@@ -64,11 +66,13 @@ struct is_arithmetic
           std::is_arithmetic<T>::value
               || std::is_same<::rocprim::half, typename std::remove_cv<T>::type>::value
               || std::is_same<::rocprim::bfloat16, typename std::remove_cv<T>::type>::value
+              || std::is_same<::rocprim::fp8_e4m3, typename std::remove_cv<T>::type>::value
+              || std::is_same<::rocprim::fp8_e5m2, typename std::remove_cv<T>::type>::value
               || std::is_same<::rocprim::int128_t, typename std::remove_cv<T>::type>::value
               || std::is_same<::rocprim::uint128_t, typename std::remove_cv<T>::type>::value>
 {};
 
-/// \brief Extension of `std::is_fundamental`, which includes support for \ref rocprim::half , \ref rocprim::bfloat16 and 128-bit integers.
+/// \brief Extension of `std::is_fundamental`, which includes support for \ref rocprim::half , \ref rocprim::bfloat16 , the 8-bit floating point types and 128-bit integers.
 template<class T>
 struct is_fundamental
     : std::integral_constant<
@@ -76,6 +80,8 @@ struct is_fundamental
           std::is_fundamental<T>::value
               || std::is_same<::rocprim::half, typename std::remove_cv<T>::type>::value
               || std::is_same<::rocprim::bfloat16, typename std::remove_cv<T>::type>::value
+              || std::is_same<::rocprim::fp8_e4m3, typename std::remove_cv<T>::type>::value
+              || std::is_same<::rocprim::fp8_e5m2, typename std::remove_cv<T>::type>::value
               || std::is_same<::rocprim::int128_t, typename std::remove_cv<T>::type>::value
               || std::is_same<::rocprim::uint128_t, typename std::remove_cv<T>::type>::value>
 {};
@@ -89,7 +95,7 @@ struct is_unsigned
               || std::is_same<::rocprim::uint128_t, typename std::remove_cv<T>::type>::value>
 {};
 
-/// \brief Extension of `std::is_signed`, which includes support for \ref rocprim::half , \ref rocprim::bfloat16 and 128-bit integers.
+/// \brief Extension of `std::is_signed`, which includes support for \ref rocprim::half , \ref rocprim::bfloat16 , the 8-bit floating point types and 128-bit integers.
 template<class T>
 struct is_signed
     : std::integral_constant<
@@ -97,10 +103,12 @@ struct is_signed
           std::is_signed<T>::value
               || std::is_same<::rocprim::half, typename std::remove_cv<T>::type>::value
               || std::is_same<::rocprim::bfloat16, typename std::remove_cv<T>::type>::value
+              || std::is_same<::rocprim::fp8_e4m3, typename std::remove_cv<T>::type>::value
+              || std::is_same<::rocprim::fp8_e5m2, typename std::remove_cv<T>::type>::value
               || std::is_same<::rocprim::int128_t, typename std::remove_cv<T>::type>::value>
 {};
 
-/// \brief Extension of `std::is_scalar`, which includes support for \ref rocprim::half , \ref rocprim::bfloat16 and 128-bit integers.
+/// \brief Extension of `std::is_scalar`, which includes support for \ref rocprim::half , \ref rocprim::bfloat16 , the 8-bit floating point types and 128-bit integers.
 template<class T>
 struct is_scalar
     : std::integral_constant<
@@ -108,6 +116,8 @@ struct is_scalar
           std::is_scalar<T>::value
               || std::is_same<::rocprim::half, typename std::remove_cv<T>::type>::value
               || std::is_same<::rocprim::bfloat16, typename std::remove_cv<T>::type>::value
+              || std::is_same<::rocprim::fp8_e4m3, typename std::remove_cv<T>::type>::value
+              || std::is_same<::rocprim::fp8_e5m2, typename std::remove_cv<T>::type>::value
               || std::is_same<::rocprim::int128_t, typename std::remove_cv<T>::type>::value
               || std::is_same<::rocprim::uint128_t, typename std::remove_cv<T>::type>::value>
 {};
@@ -134,7 +144,7 @@ struct make_unsigned<::rocprim::uint128_t>
 static_assert(std::is_same<make_unsigned<::rocprim::int128_t>::type, ::rocprim::uint128_t>::value,
               "'rocprim::int128_t' needs to implement 'make_unsigned' trait.");
 
-/// \brief Extension of `std::is_compound`, which includes support for \ref rocprim::half , \ref rocprim::bfloat16 and 128-bit integers.
+/// \brief Extension of `std::is_compound`, which includes support for \ref rocprim::half , \ref rocprim::bfloat16 , the 8-bit floating point types and 128-bit integers.
 template<class T>
 struct is_compound
     : std::integral_constant<
@@ -192,6 +202,63 @@ struct numeric_limits<rocprim::int128_t> : std::numeric_limits<int>
     }
 };
 
+template<unsigned int ExponentBits, unsigned int MantissaBits, bool HasInfinity>
+struct numeric_limits<detail::basic_fp8<ExponentBits, MantissaBits, HasInfinity>>
+{
+private:
+    using type   = detail::basic_fp8<ExponentBits, MantissaBits, HasInfinity>;
+    using format = detail::fp8_format<ExponentBits, MantissaBits, HasInfinity>;
+
+public:
+    static constexpr bool is_specialized    = true;
+    static constexpr bool is_signed         = true;
+    static constexpr bool is_integer        = false;
+    static constexpr bool is_exact          = false;
+    static constexpr bool has_infinity      = HasInfinity;
+    static constexpr bool has_quiet_NaN     = true;
+    static constexpr bool has_signaling_NaN = false;
+    static constexpr int  radix             = 2;
+    static constexpr int  digits            = MantissaBits + 1;
+    static constexpr int  min_exponent      = 2 - static_cast<int>(format::bias);
+    static constexpr int  max_exponent
+        = static_cast<int>(format::max_finite >> MantissaBits) - static_cast<int>(format::bias) + 1;
+
+    static constexpr type min()
+    {
+        return type::from_bits(1u << MantissaBits);
+    }
+
+    static constexpr type max()
+    {
+        return type::from_bits(format::max_finite);
+    }
+
+    static constexpr type lowest()
+    {
+        return type::from_bits(0x80u | format::max_finite);
+    }
+
+    static constexpr type epsilon()
+    {
+        return type::from_bits((format::bias - MantissaBits) << MantissaBits);
+    }
+
+    static constexpr type infinity()
+    {
+        return type::from_bits(HasInfinity ? format::infinity : 0);
+    }
+
+    static constexpr type quiet_NaN()
+    {
+        return type::from_bits(format::quiet_nan);
+    }
+
+    static constexpr type denorm_min()
+    {
+        return type::from_bits(1);
+    }
+};
+
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
 /// \brief Used to retrieve a type that can be treated as unsigned version of the template parameter.
@@ -436,6 +503,24 @@ struct float_bit_mask<rocprim::half>
     using bit_type                     = uint16_t;
 };
 
+template<>
+struct float_bit_mask<rocprim::fp8_e4m3>
+{
+    static constexpr uint8_t sign_bit = 0x80;
+    static constexpr uint8_t exponent = 0x78;
+    static constexpr uint8_t mantissa = 0x07;
+    using bit_type                    = uint8_t;
+};
+
+template<>
+struct float_bit_mask<rocprim::fp8_e5m2>
+{
+    static constexpr uint8_t sign_bit = 0x80;
+    static constexpr uint8_t exponent = 0x7C;
+    static constexpr uint8_t mantissa = 0x03;
+    using bit_type                    = uint8_t;
+};
+
 template<class...>
 using void_t = void;
 
@@ -28,10 +28,15 @@
 // Meta configuration for rocPRIM
 #include "config.hpp"
 
+#include "types/affine_map.hpp"
+#include "types/async_result.hpp"
+#include "types/compensated_sum.hpp"
 #include "types/double_buffer.hpp"
+#include "types/fp8.hpp"
 #include "types/future_value.hpp"
 #include "types/integer_sequence.hpp"
 #include "types/key_value_pair.hpp"
+#include "types/reduce_statistics.hpp"
 #include "types/tuple.hpp"
 #include "types/uninitialized_array.hpp"
 
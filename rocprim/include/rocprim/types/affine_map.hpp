@@ -0,0 +1,70 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_TYPES_AFFINE_MAP_HPP_
+#define ROCPRIM_TYPES_AFFINE_MAP_HPP_
+
+#include "../config.hpp"
+
+/// \addtogroup utilsmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The affine map <tt>x -> a * x + b</tt>, a step of a first-order linear recurrence.
+///
+/// Composing the maps of the steps with \p rocprim::affine_compose is associative, so the
+/// recurrence <tt>x[i] = a[i] * x[i - 1] + b[i]</tt> is a scan over the maps, see
+/// \p affine_scan. The default constructed map is the identity.
+///
+/// \tparam T - the type the maps are composed in, e.g. \p float.
+template<class T>
+struct affine_map
+{
+    using value_type = T; ///< the type of the coefficients
+
+    value_type a; ///< the factor
+    value_type b; ///< the offset
+
+    /// \brief Constructs the identity map.
+    ROCPRIM_HOST_DEVICE inline
+    constexpr affine_map() : a(1), b(0)
+    {
+    }
+
+    /// \brief Constructs the map <tt>x -> a * x + b</tt>.
+    ROCPRIM_HOST_DEVICE inline
+    constexpr affine_map(const value_type a, const value_type b) : a(a), b(b)
+    {
+    }
+
+    /// \brief Applies the map to \p x.
+    ROCPRIM_HOST_DEVICE inline
+    constexpr value_type operator()(const value_type x) const
+    {
+        return a * x + b;
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group utilsmodule
+
+#endif // ROCPRIM_TYPES_AFFINE_MAP_HPP_
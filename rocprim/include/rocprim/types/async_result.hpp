@@ -0,0 +1,213 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_TYPES_ASYNC_RESULT_HPP_
+#define ROCPRIM_TYPES_ASYNC_RESULT_HPP_
+
+#include "../common.hpp"
+#include "../config.hpp"
+#include "future_value.hpp"
+
+#include <utility>
+
+/// \addtogroup utilsmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief A scalar result of a device algorithm that is written directly to host memory.
+///
+/// The value is stored in pinned host memory that is mapped into the address space of the
+/// device. Passing \p output() as the output of an algorithm makes its final kernel write the
+/// value to the host, so reading it takes no separate copy. The value can be read once the
+/// work on the stream is complete, which is tracked by an event recorded with \p record().
+/// It is the mirror image of \p future_value, which passes values not yet known at launch time
+/// as inputs.
+///
+/// The scalar outputs of \p find_first_of, \p adjacent_find, \p find_end, \p search,
+/// \p search_n, \p reduce and the number of selected items of \p select, \p unique and
+/// \p partition can be written to an \p async_result.
+///
+/// \code
+/// rocprim::async_result<size_t> index;
+/// index.allocate();
+/// rocprim::find_first_of(temporary_storage,
+///                        storage_size,
+///                        input,
+///                        keys,
+///                        index.output(),
+///                        size,
+///                        keys_size,
+///                        rocprim::equal_to<int>(),
+///                        stream);
+/// index.record(stream);
+/// // Do other work on the host, then check the result
+/// if(index.poll() == hipSuccess && index.get() < size)
+/// {
+///     // ...
+/// }
+/// \endcode
+/// \tparam T - the type of the result. It must be trivially copyable.
+template<class T>
+class async_result
+{
+public:
+    using value_type = T; ///< The type of the result.
+
+    /// \brief Constructs an empty result. No memory is allocated until \p allocate() is called.
+    async_result() = default;
+
+    async_result(const async_result&)            = delete;
+    async_result& operator=(const async_result&) = delete;
+
+    /// \brief Moves the memory and the event of another result into this one.
+    async_result(async_result&& other) noexcept
+        : host_ptr_(other.host_ptr_), device_ptr_(other.device_ptr_), event_(other.event_)
+    {
+        other.host_ptr_   = nullptr;
+        other.device_ptr_ = nullptr;
+        other.event_      = nullptr;
+    }
+
+    /// \brief Releases the memory and the event of this result, and moves those of another
+    /// result into it.
+    async_result& operator=(async_result&& other) noexcept
+    {
+        if(this != &other)
+        {
+            (void)release();
+            std::swap(host_ptr_, other.host_ptr_);
+            std::swap(device_ptr_, other.device_ptr_);
+            std::swap(event_, other.event_);
+        }
+        return *this;
+    }
+
+    /// \brief Releases the memory and the event of this result.
+    ~async_result()
+    {
+        (void)release();
+    }
+
+    /// \brief Allocates the mapped host memory and the event of this result.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error
+    /// of type \p hipError_t.
+    hipError_t allocate()
+    {
+        ROCPRIM_RETURN_ON_ERROR(release());
+
+        void* host_ptr;
+        ROCPRIM_RETURN_ON_ERROR(hipHostMalloc(&host_ptr, sizeof(T), hipHostMallocMapped));
+        host_ptr_ = static_cast<T*>(host_ptr);
+
+        void* device_ptr;
+        hipError_t error = hipHostGetDevicePointer(&device_ptr, host_ptr, 0);
+        if(error == hipSuccess)
+        {
+            device_ptr_ = static_cast<T*>(device_ptr);
+            error       = hipEventCreateWithFlags(&event_, hipEventDisableTiming);
+        }
+        if(error != hipSuccess)
+        {
+            event_ = nullptr;
+            (void)release();
+        }
+        return error;
+    }
+
+    /// \brief Frees the memory and the event of this result.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error
+    /// of type \p hipError_t.
+    hipError_t release()
+    {
+        hipError_t error = hipSuccess;
+        if(event_ != nullptr)
+        {
+            error  = hipEventDestroy(event_);
+            event_ = nullptr;
+        }
+        if(host_ptr_ != nullptr)
+        {
+            const hipError_t free_error = hipHostFree(host_ptr_);
+            error                       = error == hipSuccess ? free_error : error;
+            host_ptr_                   = nullptr;
+            device_ptr_                 = nullptr;
+        }
+        return error;
+    }
+
+    /// \brief Returns the device pointer to pass as the output of a device algorithm.
+    T* output() const
+    {
+        return device_ptr_;
+    }
+
+    /// \brief Returns a \p future_value reading this result, to pass it as an input to a later
+    /// device algorithm without a round trip through the host.
+    future_value<T> as_future() const
+    {
+        return future_value<T>{device_ptr_};
+    }
+
+    /// \brief Records when the algorithms enqueued on \p stream so far are complete. Call this
+    /// after the algorithm writing the result.
+    /// \param stream - the stream the algorithm writing the result was enqueued on.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error
+    /// of type \p hipError_t.
+    hipError_t record(const hipStream_t stream)
+    {
+        return hipEventRecord(event_, stream);
+    }
+
+    /// \brief Checks without blocking if the result is available.
+    /// \returns \p hipSuccess (\p 0) if the result is available, \p hipErrorNotReady if it is
+    /// not yet available; otherwise a HIP runtime error of type \p hipError_t.
+    hipError_t poll() const
+    {
+        return hipEventQuery(event_);
+    }
+
+    /// \brief Blocks until the result is available.
+    /// \returns \p hipSuccess (\p 0) after successful operation; otherwise a HIP runtime error
+    /// of type \p hipError_t.
+    hipError_t wait() const
+    {
+        return hipEventSynchronize(event_);
+    }
+
+    /// \brief Returns the result.
+    /// \note The result must be available, see \p poll() and \p wait().
+    T get() const
+    {
+        return *host_ptr_;
+    }
+
+private:
+    T*         host_ptr_   = nullptr;
+    T*         device_ptr_ = nullptr;
+    hipEvent_t event_      = nullptr;
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group utilsmodule
+
+#endif // ROCPRIM_TYPES_ASYNC_RESULT_HPP_
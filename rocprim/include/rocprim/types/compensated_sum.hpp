@@ -0,0 +1,84 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_TYPES_COMPENSATED_SUM_HPP_
+#define ROCPRIM_TYPES_COMPENSATED_SUM_HPP_
+
+#include "../config.hpp"
+
+/// \addtogroup utilsmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief A floating point sum together with the rounding error of its additions.
+///
+/// Adding values with \p rocprim::compensated_plus carries the rounding error of every addition
+/// in \p compensation (Neumaier's variant of Kahan summation), so the sum of many values is about
+/// as accurate as if it had been computed with twice the precision of \p T. It is used as the
+/// accumulator type of \p reduce, \p segmented_reduce and the scans, while the input is loaded
+/// and the output is written as \p T.
+///
+/// \tparam T - the floating point type of the sum, e.g. \p float.
+template<class T>
+struct compensated_sum
+{
+    using value_type = T; ///< the type of the sum
+
+    value_type sum; ///< the rounded sum
+    value_type compensation; ///< the accumulated rounding error of \p sum
+
+    ROCPRIM_HOST_DEVICE inline
+    compensated_sum() = default;
+
+    /// \brief Constructs the sum of a single value, which has no rounding error.
+    ROCPRIM_HOST_DEVICE inline
+    constexpr compensated_sum(const value_type value) : sum(value), compensation(0)
+    {
+    }
+
+    /// \brief Constructs a sum from its rounded value and its rounding error.
+    ROCPRIM_HOST_DEVICE inline
+    constexpr compensated_sum(const value_type sum, const value_type compensation)
+        : sum(sum), compensation(compensation)
+    {
+    }
+
+    /// \brief Returns the sum corrected by its rounding error.
+    ROCPRIM_HOST_DEVICE inline
+    constexpr value_type value() const
+    {
+        return sum + compensation;
+    }
+
+    /// \brief Converts to the corrected sum, so the sums can be written to an output of \p T.
+    ROCPRIM_HOST_DEVICE inline
+    constexpr operator value_type() const
+    {
+        return value();
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group utilsmodule
+
+#endif // ROCPRIM_TYPES_COMPENSATED_SUM_HPP_
@@ -0,0 +1,203 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_TYPES_FP8_HPP_
+#define ROCPRIM_TYPES_FP8_HPP_
+
+#include "../config.hpp"
+
+/// \addtogroup utilsmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+namespace detail
+{
+
+// Software conversions of the OCP 8-bit floating point formats, which are the same on the host
+// and the device. The encodings are contiguous for finite values, so rounding may carry from the
+// mantissa into the exponent.
+template<unsigned int ExponentBits, unsigned int MantissaBits, bool HasInfinity>
+struct fp8_format
+{
+    static constexpr unsigned int bias          = (1u << (ExponentBits - 1)) - 1;
+    static constexpr unsigned int exponent_mask = ((1u << ExponentBits) - 1) << MantissaBits;
+    static constexpr unsigned int mantissa_mask = (1u << MantissaBits) - 1;
+    // Without infinities only the all ones encoding is NaN, otherwise the all ones exponent is
+    // reserved for infinities and NaNs
+    static constexpr unsigned int max_finite = HasInfinity ? exponent_mask - 1 : 0x7E;
+    static constexpr unsigned int infinity   = exponent_mask;
+    static constexpr unsigned int quiet_nan  = 0x7F;
+
+    // Rounds to nearest even. Finite values out of range saturate to the largest finite value,
+    // infinities are kept if the format has them and saturate otherwise, NaNs are kept.
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    static unsigned char from_float(const float value)
+    {
+        const unsigned int bits     = __builtin_bit_cast(unsigned int, value);
+        const unsigned int sign     = (bits >> 24) & 0x80u;
+        const unsigned int abs      = bits & 0x7FFFFFFFu;
+        const unsigned int mantissa = abs & 0x7FFFFFu;
+        if(abs > 0x7F800000u)
+        {
+            return static_cast<unsigned char>(sign | quiet_nan);
+        }
+        if(abs == 0x7F800000u)
+        {
+            return static_cast<unsigned char>(sign | (HasInfinity ? infinity : max_finite));
+        }
+
+        const int exponent = static_cast<int>(abs >> 23) - 127 + static_cast<int>(bias);
+
+        unsigned int base;
+        unsigned int significand;
+        unsigned int shift;
+        if(exponent >= 1)
+        {
+            base        = static_cast<unsigned int>(exponent) << MantissaBits;
+            significand = mantissa;
+            shift       = 23 - MantissaBits;
+        }
+        else
+        {
+            // Subnormal result, the implicit bit is shifted into the mantissa
+            shift = static_cast<unsigned int>(23 - static_cast<int>(MantissaBits) + 1 - exponent);
+            if(shift > 24)
+            {
+                // Less than half of the smallest subnormal
+                return static_cast<unsigned char>(sign);
+            }
+            base        = 0;
+            significand = mantissa | 0x800000u;
+        }
+
+        unsigned int       result    = base + (significand >> shift);
+        const unsigned int remainder = significand & ((1u << shift) - 1);
+        const unsigned int halfway   = 1u << (shift - 1);
+        if(remainder > halfway || (remainder == halfway && (result & 1u) != 0))
+        {
+            ++result;
+        }
+        result = result > max_finite ? max_finite : result;
+        return static_cast<unsigned char>(sign | result);
+    }
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    static float to_float(const unsigned char value)
+    {
+        const unsigned int sign     = (value & 0x80u) << 24;
+        const unsigned int exponent = (value & exponent_mask) >> MantissaBits;
+        unsigned int       mantissa = value & mantissa_mask;
+        if(exponent == (exponent_mask >> MantissaBits)
+           && (HasInfinity || mantissa == mantissa_mask))
+        {
+            const unsigned int special = HasInfinity && mantissa == 0 ? 0x7F800000u : 0x7FC00000u;
+            return __builtin_bit_cast(float, sign | special);
+        }
+        if(exponent == 0)
+        {
+            if(mantissa == 0)
+            {
+                return __builtin_bit_cast(float, sign);
+            }
+            // Subnormal, normalize it as float has the range for it
+            int normalized_exponent = 1 - static_cast<int>(bias);
+            while((mantissa & (1u << MantissaBits)) == 0)
+            {
+                mantissa <<= 1;
+                --normalized_exponent;
+            }
+            return __builtin_bit_cast(
+                float,
+                sign | static_cast<unsigned int>(normalized_exponent + 127) << 23
+                    | (mantissa & mantissa_mask) << (23 - MantissaBits));
+        }
+        return __builtin_bit_cast(float,
+                                  sign | (exponent - bias + 127) << 23
+                                      | mantissa << (23 - MantissaBits));
+    }
+};
+
+/// \brief An 8-bit floating point type, stored as its encoding. Arithmetic and comparisons are
+/// performed on \p float through the implicit conversions.
+template<unsigned int ExponentBits, unsigned int MantissaBits, bool HasInfinity>
+class basic_fp8
+{
+    using format = fp8_format<ExponentBits, MantissaBits, HasInfinity>;
+
+public:
+    basic_fp8() = default;
+
+    /// \brief Converts \p value with rounding to nearest even, finite values out of range
+    /// saturate to the largest finite value.
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    basic_fp8(const float value) : bits_(format::from_float(value))
+    {}
+
+    /// \brief Converts to \p float, which represents every value exactly.
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    operator float() const
+    {
+        return format::to_float(bits_);
+    }
+
+    /// \brief Creates the value of the encoding \p bits.
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    static constexpr basic_fp8 from_bits(const unsigned char bits)
+    {
+        return basic_fp8(bits, from_bits_tag{});
+    }
+
+    /// \brief Returns the encoding of the value.
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    constexpr unsigned char bits() const
+    {
+        return bits_;
+    }
+
+private:
+    struct from_bits_tag
+    {};
+
+    ROCPRIM_HOST_DEVICE ROCPRIM_INLINE
+    constexpr basic_fp8(const unsigned char bits, from_bits_tag) : bits_(bits)
+    {}
+
+    unsigned char bits_;
+};
+
+} // namespace detail
+
+/// \brief 8-bit floating point type with 4 exponent and 3 mantissa bits (OCP E4M3).
+///
+/// It has no infinities, the largest finite value is 448 and the encodings with all exponent and
+/// mantissa bits set are NaN.
+using fp8_e4m3 = detail::basic_fp8<4, 3, false>;
+
+/// \brief 8-bit floating point type with 5 exponent and 2 mantissa bits (OCP E5M2).
+///
+/// It follows IEEE-754 with infinities and NaNs, the largest finite value is 57344.
+using fp8_e5m2 = detail::basic_fp8<5, 2, true>;
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group utilsmodule
+
+#endif // ROCPRIM_TYPES_FP8_HPP_
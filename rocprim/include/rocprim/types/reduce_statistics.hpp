@@ -0,0 +1,103 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCPRIM_TYPES_REDUCE_STATISTICS_HPP_
+#define ROCPRIM_TYPES_REDUCE_STATISTICS_HPP_
+
+#include "../config.hpp"
+
+#include <cstddef>
+
+/// \addtogroup utilsmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The minimum, maximum, sum, sum of squares and number of a set of values.
+///
+/// The statistics of two sets are combined with \p rocprim::reduce_statistics_plus, so all of
+/// them are computed by a single reduction over the values, see \p multi_reduce. The statistics of
+/// an empty set (\p count is \p 0) are the identity of the combination, the other members of
+/// an empty set are not meaningful.
+///
+/// \tparam T - the type the statistics are accumulated in, e.g. \p float or \p double.
+template<class T>
+struct reduce_statistics
+{
+    using value_type = T; ///< the type of the statistics
+
+    value_type minimum; ///< the smallest value
+    value_type maximum; ///< the greatest value
+    value_type sum; ///< the sum of the values
+    value_type sum_of_squares; ///< the sum of the squares of the values
+    size_t     count; ///< the number of values
+
+    /// \brief Constructs the statistics of an empty set.
+    ROCPRIM_HOST_DEVICE inline
+    constexpr reduce_statistics()
+        : minimum(), maximum(), sum(), sum_of_squares(), count(0)
+    {
+    }
+
+    /// \brief Constructs the statistics of a single value.
+    ROCPRIM_HOST_DEVICE inline
+    constexpr reduce_statistics(const value_type value)
+        : minimum(value), maximum(value), sum(value), sum_of_squares(value * value), count(1)
+    {
+    }
+
+    /// \brief Constructs the statistics from their members.
+    ROCPRIM_HOST_DEVICE inline
+    constexpr reduce_statistics(const value_type minimum,
+                                const value_type maximum,
+                                const value_type sum,
+                                const value_type sum_of_squares,
+                                const size_t     count)
+        : minimum(minimum)
+        , maximum(maximum)
+        , sum(sum)
+        , sum_of_squares(sum_of_squares)
+        , count(count)
+    {
+    }
+
+    /// \brief Returns the mean of the values, the set must not be empty.
+    ROCPRIM_HOST_DEVICE inline
+    constexpr value_type mean() const
+    {
+        return sum / static_cast<value_type>(count);
+    }
+
+    /// \brief Returns the population variance of the values, the set must not be empty.
+    ///
+    /// It is computed from the sums, so it loses precision when the mean is large compared to the
+    /// spread of the values.
+    ROCPRIM_HOST_DEVICE inline
+    constexpr value_type variance() const
+    {
+        return sum_of_squares / static_cast<value_type>(count) - mean() * mean();
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group utilsmodule
+
+#endif // ROCPRIM_TYPES_REDUCE_STATISTICS_HPP_
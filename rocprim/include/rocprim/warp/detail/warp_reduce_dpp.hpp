@@ -89,6 +89,13 @@ public:
             output = reduce_op(warp_move_dpp<T, 0x143>(output), output);
         }
         static_assert(WarpSize <= 64, "WarpSize > 64 is not supported");
+#elif defined(ROCPRIM_DETAIL_HAS_PERMLANEX16)
+        if(WarpSize > 16)
+        {
+            // Every lane reads lane 15 of the other row
+            output = reduce_op(warp_permlanex16<T, 0xffffffff, 0xffffffff>(output), output);
+        }
+        static_assert(WarpSize <= 32, "WarpSize > 32 is not supported without DPP broadcasts");
 #else
         if(WarpSize > 16)
         {
@@ -98,7 +105,12 @@ public:
         static_assert(WarpSize <= 32, "WarpSize > 32 is not supported without DPP broadcasts");
 #endif
         // Read the result from the last lane of the logical warp
+#ifdef ROCPRIM_DETAIL_HAS_PERMLANEX16
+        // The logical warp is the full wave32, a scalar v_readlane is enough
+        output = warp_readlane(output, WarpSize - 1);
+#else
         output = warp_shuffle(output, WarpSize - 1, WarpSize);
+#endif
     }
 
     template<class BinaryFunction>
@@ -86,6 +86,15 @@ public:
             if(lane_id >= 32) output = t;
         }
         static_assert(WarpSize <= 64, "WarpSize > 64 is not supported");
+#elif defined(ROCPRIM_DETAIL_HAS_PERMLANEX16)
+        if(WarpSize > 16)
+        {
+            // Every lane reads lane 15 of the other row
+            T t = scan_op(warp_permlanex16<T, 0xffffffff, 0xffffffff>(output), output);
+            if(lane_id % 32 >= 16)
+                output = t;
+        }
+        static_assert(WarpSize <= 32, "WarpSize > 32 is not supported without DPP broadcasts");
 #else
         if(WarpSize > 16)
         {
@@ -113,7 +122,7 @@ public:
     {
         inclusive_scan(input, output, scan_op);
         // Broadcast value from the last thread in warp
-        reduction = warp_shuffle(output, WarpSize-1, WarpSize);
+        reduction = broadcast_last(output);
     }
 
     template<class BinaryFunction>
@@ -160,7 +169,7 @@ public:
     {
         inclusive_scan(input, output, scan_op);
         // Broadcast value from the last thread in warp
-        reduction = warp_shuffle(output, WarpSize - 1, WarpSize);
+        reduction = broadcast_last(output);
         // Convert inclusive scan result to exclusive
         to_exclusive(output, output);
     }
@@ -171,7 +180,7 @@ public:
     {
         inclusive_scan(input, output, scan_op);
         // Broadcast value from the last thread in warp
-        reduction = warp_shuffle(output, WarpSize-1, WarpSize);
+        reduction = broadcast_last(output);
         // Convert inclusive scan result to exclusive
         to_exclusive(output, output, init, scan_op);
     }
@@ -222,7 +231,7 @@ public:
     {
         inclusive_scan(input, inclusive_output, scan_op);
         // Broadcast value from the last thread in warp
-        reduction = warp_shuffle(inclusive_output, WarpSize-1, WarpSize);
+        reduction = broadcast_last(inclusive_output);
         // Convert inclusive scan result to exclusive
         to_exclusive(inclusive_output, exclusive_output, init, scan_op);
     }
@@ -251,6 +260,21 @@ protected:
         return to_exclusive(inclusive_input, exclusive_output);
     }
 
+private:
+    // Broadcasts the value of the last lane of the logical warp
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    T broadcast_last(T input)
+    {
+#ifdef ROCPRIM_DETAIL_HAS_PERMLANEX16
+        // A logical warp of the full wave32 can read the lane with a scalar v_readlane
+        if ROCPRIM_IF_CONSTEXPR(WarpSize == ::rocprim::device_warp_size())
+        {
+            return warp_readlane(input, WarpSize - 1);
+        }
+#endif
+        return warp_shuffle(input, WarpSize - 1, WarpSize);
+    }
+
 private:
     // Changes inclusive scan results to exclusive scan results
     template<class BinaryFunction>
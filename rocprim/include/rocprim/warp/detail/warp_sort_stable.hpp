@@ -29,6 +29,7 @@
 
 #include "../../functional.hpp"
 #include "../../intrinsics.hpp"
+#include "../../thread/thread_sort.hpp"
 
 #include "../../detail/merge_path.hpp"
 
@@ -71,19 +72,11 @@ private:
         const auto thread_offset     = rocprim::flat_block_thread_id() * ItemsPerThread;
         const auto thread_input_size = thread_offset > input_size ? 0 : input_size - thread_offset;
 
-        ROCPRIM_UNROLL
-        for(auto i = 0u; i < ItemsPerThread; ++i)
-        {
-            ROCPRIM_UNROLL
-            for(auto j = i & 1u; j < ItemsPerThread - 1u; j += 2u)
-            {
-                if(j + 1 < thread_input_size
-                   && compare_function(thread_keys[j + 1], thread_keys[j]))
-                {
-                    ::rocprim::swap(thread_keys[j + 1], thread_keys[j]);
-                }
-            }
-        }
+        ::rocprim::thread_sort_stable(thread_keys,
+                                      compare_function,
+                                      is_incomplete ? ::rocprim::min(thread_input_size,
+                                                                     ItemsPerThread)
+                                                    : ItemsPerThread);
     }
 
     /// Sort the keys and values of each thread separately.
@@ -96,20 +89,12 @@ private:
         const auto thread_offset     = rocprim::flat_block_thread_id() * ItemsPerThread;
         const auto thread_input_size = thread_offset > input_size ? 0 : input_size - thread_offset;
 
-        ROCPRIM_UNROLL
-        for(auto i = 0u; i < ItemsPerThread; ++i)
-        {
-            ROCPRIM_UNROLL
-            for(auto j = i & 1u; j < ItemsPerThread - 1u; j += 2u)
-            {
-                if(j + 1 < thread_input_size
-                   && compare_function(thread_keys[j + 1], thread_keys[j]))
-                {
-                    ::rocprim::swap(thread_keys[j + 1], thread_keys[j]);
-                    ::rocprim::swap(thread_values[j + 1], thread_values[j]);
-                }
-            }
-        }
+        ::rocprim::thread_sort_stable(thread_keys,
+                                      thread_values,
+                                      compare_function,
+                                      is_incomplete ? ::rocprim::min(thread_input_size,
+                                                                     ItemsPerThread)
+                                                    : ItemsPerThread);
     }
 
     template<bool is_incomplete, class BinaryFunction>
@@ -0,0 +1,286 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_WARP_WARP_DISCONTINUITY_HPP_
+#define ROCPRIM_WARP_WARP_DISCONTINUITY_HPP_
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "../block/detail/block_adjacent_difference_impl.hpp"
+#include "../intrinsics.hpp"
+#include "../types.hpp"
+
+/// \addtogroup warpmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The \p warp_discontinuity class is a warp level parallel primitive which provides
+/// methods for flagging items that are discontinued within an ordered set of items across
+/// the threads of a warp.
+///
+/// \tparam T - the input type.
+/// \tparam WarpSize - the number of threads in a warp, a power of two not larger than the
+/// hardware warp size.
+///
+/// \par Overview
+/// * The items are in a blocked arrangement across the warp, and the flags are computed as by
+/// \p block_discontinuity with the warp as the block.
+/// * The neighbouring items of the other lanes are exchanged with warp shuffles only, so no
+/// shared memory and no barriers are needed.
+/// * The index passed to a flag operation taking three arguments is the index of the second
+/// item within the warp.
+/// * Both wave32 and wave64 hardware warps are supported, and logical warps smaller than the
+/// hardware warp.
+///
+/// \par Examples
+/// \parblock
+/// In the example the heads of the runs of equal items are flagged for a warp of 16 threads,
+/// using type \p int with 4 items per thread.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     using warp_discontinuity_int = rocprim::warp_discontinuity<int, 16>;
+///
+///     int input[4];
+///     ...
+///     int head_flags[4];
+///     warp_discontinuity_int w_discontinuity;
+///     w_discontinuity.flag_heads(head_flags, input, rocprim::not_equal_to<int>());
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class T, unsigned int WarpSize = ::rocprim::device_warp_size()>
+class warp_discontinuity
+{
+    static_assert(::rocprim::detail::is_power_of_two(WarpSize),
+                  "Logical warp size must be a power of two.");
+    ROCPRIM_DETAIL_DEVICE_STATIC_ASSERT(
+        WarpSize <= ::rocprim::device_warp_size(),
+        "Logical warp size cannot be larger than physical warp size.");
+
+public:
+    /// \brief The warp discontinuity needs no temporary storage.
+    using storage_type = ::rocprim::detail::empty_storage_type;
+
+    /// \brief Tags \p head_flags that indicate discontinuities between items partitioned
+    /// across the warp, where the first item has no reference and is always flagged.
+    ///
+    /// \tparam ItemsPerThread - [inferred] the number of items to be processed by
+    /// each thread.
+    /// \tparam Flag - [inferred] the flag type.
+    /// \tparam FlagOp - [inferred] type of binary function used for flagging.
+    ///
+    /// \param [out] head_flags - array that contains the head flags.
+    /// \param [in] input - array that data is loaded from.
+    /// \param [in] flag_op - binary operation function object that will be used for flagging.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>bool f(const T &a, const T &b);</tt> or
+    /// <tt>bool (const T& a, const T& b, unsigned int b_index);</tt>.
+    template<unsigned int ItemsPerThread, class Flag, class FlagOp>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void flag_heads(Flag (&head_flags)[ItemsPerThread],
+                    const T (&input)[ItemsPerThread],
+                    FlagOp flag_op)
+    {
+        flag_heads_impl<false>(head_flags, input[0], input, flag_op);
+    }
+
+    /// \brief Tags \p head_flags that indicate discontinuities between items partitioned
+    /// across the warp, where the first item of the first thread is compared against
+    /// a \p tile_predecessor_item.
+    ///
+    /// \param [out] head_flags - array that contains the head flags.
+    /// \param [in] tile_predecessor_item - the item before the items of the warp, only used by
+    /// the first thread of the warp.
+    /// \param [in] input - array that data is loaded from.
+    /// \param [in] flag_op - binary operation function object that will be used for flagging.
+    template<unsigned int ItemsPerThread, class Flag, class FlagOp>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void flag_heads(Flag (&head_flags)[ItemsPerThread],
+                    T tile_predecessor_item,
+                    const T (&input)[ItemsPerThread],
+                    FlagOp flag_op)
+    {
+        flag_heads_impl<true>(head_flags, tile_predecessor_item, input, flag_op);
+    }
+
+    /// \brief Tags \p tail_flags that indicate discontinuities between items partitioned
+    /// across the warp, where the last item has no reference and is always flagged.
+    ///
+    /// \param [out] tail_flags - array that contains the tail flags.
+    /// \param [in] input - array that data is loaded from.
+    /// \param [in] flag_op - binary operation function object that will be used for flagging.
+    template<unsigned int ItemsPerThread, class Flag, class FlagOp>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void flag_tails(Flag (&tail_flags)[ItemsPerThread],
+                    const T (&input)[ItemsPerThread],
+                    FlagOp flag_op)
+    {
+        flag_tails_impl<false>(tail_flags, input[0], input, flag_op);
+    }
+
+    /// \brief Tags \p tail_flags that indicate discontinuities between items partitioned
+    /// across the warp, where the last item of the last thread is compared against
+    /// a \p tile_successor_item.
+    ///
+    /// \param [out] tail_flags - array that contains the tail flags.
+    /// \param [in] tile_successor_item - the item after the items of the warp, only used by
+    /// the last thread of the warp.
+    /// \param [in] input - array that data is loaded from.
+    /// \param [in] flag_op - binary operation function object that will be used for flagging.
+    template<unsigned int ItemsPerThread, class Flag, class FlagOp>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void flag_tails(Flag (&tail_flags)[ItemsPerThread],
+                    T tile_successor_item,
+                    const T (&input)[ItemsPerThread],
+                    FlagOp flag_op)
+    {
+        flag_tails_impl<true>(tail_flags, tile_successor_item, input, flag_op);
+    }
+
+    /// \brief Tags both \p head_flags and \p tail_flags that indicate discontinuities
+    /// between items partitioned across the warp.
+    ///
+    /// \param [out] head_flags - array that contains the head flags.
+    /// \param [out] tail_flags - array that contains the tail flags.
+    /// \param [in] input - array that data is loaded from.
+    /// \param [in] flag_op - binary operation function object that will be used for flagging.
+    template<unsigned int ItemsPerThread, class Flag, class FlagOp>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void flag_heads_and_tails(Flag (&head_flags)[ItemsPerThread],
+                              Flag (&tail_flags)[ItemsPerThread],
+                              const T (&input)[ItemsPerThread],
+                              FlagOp flag_op)
+    {
+        // Copy items in case head_flags is aliased with input
+        T items[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            items[i] = input[i];
+        }
+        flag_heads_impl<false>(head_flags, items[0], items, flag_op);
+        flag_tails_impl<false>(tail_flags, items[0], items, flag_op);
+    }
+
+private:
+    template<bool WithTilePredecessor, unsigned int ItemsPerThread, class Flag, class FlagOp>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void flag_heads_impl(Flag (&head_flags)[ItemsPerThread],
+                         const T tile_predecessor_item,
+                         const T (&input)[ItemsPerThread],
+                         FlagOp  flag_op)
+    {
+        static constexpr auto as_flags = bool_constant<true>{};
+        static constexpr auto reversed = bool_constant<false>{};
+
+        const unsigned int lane = ::rocprim::detail::logical_lane_id<WarpSize>();
+        const T predecessor = ::rocprim::warp_shuffle_up(input[ItemsPerThread - 1], 1, WarpSize);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = ItemsPerThread - 1; i > 0; --i)
+        {
+            head_flags[i] = detail::apply(flag_op,
+                                          input[i - 1],
+                                          input[i],
+                                          lane * ItemsPerThread + i,
+                                          as_flags,
+                                          reversed);
+        }
+
+        if(lane != 0)
+        {
+            head_flags[0] = detail::apply(flag_op,
+                                          predecessor,
+                                          input[0],
+                                          lane * ItemsPerThread,
+                                          as_flags,
+                                          reversed);
+        }
+        else
+        {
+            head_flags[0] = WithTilePredecessor ? Flag(detail::apply(flag_op,
+                                                                     tile_predecessor_item,
+                                                                     input[0],
+                                                                     0,
+                                                                     as_flags,
+                                                                     reversed))
+                                                : Flag(1);
+        }
+    }
+
+    template<bool WithTileSuccessor, unsigned int ItemsPerThread, class Flag, class FlagOp>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void flag_tails_impl(Flag (&tail_flags)[ItemsPerThread],
+                         const T tile_successor_item,
+                         const T (&input)[ItemsPerThread],
+                         FlagOp  flag_op)
+    {
+        static constexpr auto as_flags = bool_constant<true>{};
+        static constexpr auto reversed = bool_constant<false>{};
+
+        const unsigned int lane      = ::rocprim::detail::logical_lane_id<WarpSize>();
+        const T            successor = ::rocprim::warp_shuffle_down(input[0], 1, WarpSize);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread - 1; ++i)
+        {
+            tail_flags[i] = detail::apply(flag_op,
+                                          input[i],
+                                          input[i + 1],
+                                          lane * ItemsPerThread + i + 1,
+                                          as_flags,
+                                          reversed);
+        }
+
+        const unsigned int last_index = lane * ItemsPerThread + ItemsPerThread;
+        if(lane != WarpSize - 1)
+        {
+            tail_flags[ItemsPerThread - 1] = detail::apply(flag_op,
+                                                           input[ItemsPerThread - 1],
+                                                           successor,
+                                                           last_index,
+                                                           as_flags,
+                                                           reversed);
+        }
+        else
+        {
+            tail_flags[ItemsPerThread - 1]
+                = WithTileSuccessor ? Flag(detail::apply(flag_op,
+                                                         input[ItemsPerThread - 1],
+                                                         tile_successor_item,
+                                                         last_index,
+                                                         as_flags,
+                                                         reversed))
+                                    : Flag(1);
+        }
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group warpmodule
+
+#endif // ROCPRIM_WARP_WARP_DISCONTINUITY_HPP_
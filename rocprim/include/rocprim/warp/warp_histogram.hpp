@@ -0,0 +1,178 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_WARP_WARP_HISTOGRAM_HPP_
+#define ROCPRIM_WARP_WARP_HISTOGRAM_HPP_
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "../functional.hpp"
+#include "../intrinsics.hpp"
+
+#include <type_traits>
+
+/// \addtogroup warpmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The \p warp_histogram class is a warp level parallel primitive which provides
+/// methods for computing the histogram of the items partitioned across the threads of a warp.
+///
+/// \tparam T - the input type, convertible to \p unsigned \p int.
+/// \tparam ItemsPerThread - the number of items contributed by each thread.
+/// \tparam Bins - the number of bins of the histogram.
+/// \tparam WarpSize - the number of threads in a warp, a power of two not larger than the
+/// hardware warp size.
+///
+/// \par Overview
+/// * Every warp counts into its own slice of \p Bins counters in shared memory, passed as
+/// \p hist, so no block-level barriers are needed and the warps of a block can compute
+/// independent histograms, for example one per small segment.
+/// * The lanes of the warp with the same bin add their count with a single atomic, see
+/// \p warp_aggregated_atomic_add.
+/// * Both wave32 and wave64 hardware warps are supported, and logical warps smaller than the
+/// hardware warp.
+///
+/// \par Examples
+/// \parblock
+/// In the example histograms of 64 bins are computed by warps of 32 threads, using type
+/// \p unsigned \p char with 4 items per thread.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     constexpr unsigned int threads_per_block = 128;
+///     constexpr unsigned int threads_per_warp  =  32;
+///     constexpr unsigned int warps_per_block   = threads_per_block / threads_per_warp;
+///     const unsigned int warp_id = hipThreadIdx_x / threads_per_warp;
+///     using warp_histogram_type
+///         = rocprim::warp_histogram<unsigned char, 4, 64, threads_per_warp>;
+///     // the slice of counters of every warp in shared memory
+///     __shared__ unsigned int hist[warps_per_block][64];
+///
+///     unsigned char items[4];
+///     ...
+///     warp_histogram_type w_histogram;
+///     w_histogram.histogram(items, hist[warp_id]);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class T,
+         unsigned int ItemsPerThread,
+         unsigned int Bins,
+         unsigned int WarpSize = ::rocprim::device_warp_size()>
+class warp_histogram
+{
+    static_assert(::rocprim::detail::is_power_of_two(WarpSize),
+                  "Logical warp size must be a power of two.");
+    ROCPRIM_DETAIL_DEVICE_STATIC_ASSERT(
+        WarpSize <= ::rocprim::device_warp_size(),
+        "Logical warp size cannot be larger than physical warp size.");
+    static_assert(std::is_convertible<T, unsigned int>::value,
+                  "T must be convertible to unsigned int");
+
+    static constexpr unsigned int bin_bits = ::rocprim::Log2<Bins>::VALUE;
+    // The lanes of different logical warps of a hardware warp add to different slices, so the
+    // logical warp is part of the label that groups the lanes.
+    static constexpr unsigned int warp_bits
+        = ::rocprim::Log2<::rocprim::device_warp_size() / WarpSize>::VALUE;
+
+public:
+    /// \brief The warp histogram needs no temporary storage besides the counters.
+    using storage_type = ::rocprim::detail::empty_storage_type;
+
+    /// \brief Sets the counters of the warp to zero.
+    ///
+    /// \tparam Counter - [inferred] the counter type.
+    ///
+    /// \param [out] hist - the \p Bins counters of the warp in shared memory.
+    template<class Counter>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void init_histogram(Counter hist[Bins])
+    {
+        const unsigned int lane = ::rocprim::detail::logical_lane_id<WarpSize>();
+
+        ROCPRIM_UNROLL
+        for(unsigned int offset = 0; offset < Bins; offset += WarpSize)
+        {
+            if(offset + lane < Bins)
+            {
+                hist[offset + lane] = Counter();
+            }
+        }
+    }
+
+    /// \brief Adds the items of the warp to the counters of the warp.
+    ///
+    /// \tparam Counter - [inferred] the counter type, one of the types supported by atomics:
+    /// \p int, \p unsigned \p int, \p unsigned \p long \p long and \p float.
+    ///
+    /// \param [in] input - the items of the thread, which must be less than \p Bins.
+    /// \param [in, out] hist - the \p Bins counters of the warp in shared memory. The counters
+    /// are complete for all lanes of the warp when the call returns.
+    template<class Counter>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void composite(T (&input)[ItemsPerThread], Counter hist[Bins])
+    {
+        static_assert(std::is_same<Counter, unsigned int>::value
+                          || std::is_same<Counter, int>::value
+                          || std::is_same<Counter, float>::value
+                          || std::is_same<Counter, unsigned long long>::value,
+                      "Counter must be type that is supported by atomics (float, int, unsigned "
+                      "int, unsigned long long)");
+
+        const unsigned int warp = ::rocprim::lane_id() / WarpSize;
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int bin = static_cast<unsigned int>(input[i]);
+            const lane_mask_type group
+                = ::rocprim::match_any<bin_bits + warp_bits>(bin | (warp << bin_bits));
+            ::rocprim::warp_aggregated_atomic_add(hist + bin, Counter(1), group);
+        }
+        ::rocprim::wave_barrier();
+    }
+
+    /// \brief Computes the histogram of the items of the warp.
+    ///
+    /// Same as \p init_histogram followed by \p composite.
+    ///
+    /// \param [in] input - the items of the thread, which must be less than \p Bins.
+    /// \param [out] hist - the \p Bins counters of the warp in shared memory.
+    template<class Counter>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void histogram(T (&input)[ItemsPerThread], Counter hist[Bins])
+    {
+        init_histogram(hist);
+        ::rocprim::wave_barrier();
+        composite(input, hist);
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group warpmodule
+
+#endif // ROCPRIM_WARP_WARP_HISTOGRAM_HPP_
@@ -0,0 +1,349 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_WARP_WARP_MERGE_SORT_HPP_
+#define ROCPRIM_WARP_WARP_MERGE_SORT_HPP_
+
+#include "../config.hpp"
+#include "../detail/merge_path.hpp"
+#include "../detail/various.hpp"
+
+#include "../functional.hpp"
+#include "../intrinsics.hpp"
+#include "../types.hpp"
+#include "../types/uninitialized_array.hpp"
+
+#include <type_traits>
+
+/// \addtogroup warpmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The \p warp_merge_sort class is a warp level parallel primitive which provides methods
+/// for stably sorting keys, or key-value pairs, blocked across the threads of a warp.
+///
+/// \tparam Key - the key type.
+/// \tparam ItemsPerThread - the number of items contributed by each thread, at most 16.
+/// \tparam WarpSize - the number of threads in the warp. It must be a power of two not larger
+/// than the hardware warp size, and a divisor of the kernel block size.
+/// \tparam Value - the value type. Default type empty_type indicates
+/// a keys-only sort.
+///
+/// \par Overview
+/// * The items are sorted with a merge sort: each thread sorts its own items, then sorted runs
+/// are merged in shared memory by merge path partitioning, doubling the run length until the
+/// whole warp is sorted. The sort is stable, the order of keys that compare equal is kept.
+/// * Any strict weak ordering can be used as comparator, unlike with \p warp_sort there are no
+/// requirements on the key type or on the number of items per thread.
+/// * The overloads taking \p valid_items sort only the first \p valid_items items of the warp
+/// (in blocked arrangement). The other items are never compared or read from shared memory, so
+/// no padding keys are needed. After the sort their positions hold unspecified keys and values.
+/// * The warp synchronizes with \p wave_barrier only, so the warps of a block sort independently
+/// and the sort may be called under warp-uniform control flow.
+/// * Each logical warp requires its own \p storage_type. A barrier must be placed before
+/// \p storage is reused.
+///
+/// \par Example:
+/// \parblock
+/// In the example rows of 256 keys are sorted by warps of 32 threads, with 8 items per thread.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     constexpr unsigned int threads_per_block = 128;
+///     constexpr unsigned int threads_per_warp  =  32;
+///     constexpr unsigned int items_per_thread  =   8;
+///     constexpr unsigned int warps_per_block   = threads_per_block / threads_per_warp;
+///     const unsigned int warp_id = threadIdx.x / threads_per_warp;
+///
+///     using warp_sort_int = rocprim::warp_merge_sort<int, items_per_thread, threads_per_warp>;
+///     // allocate storage in shared memory
+///     __shared__ warp_sort_int::storage_type storage[warps_per_block];
+///
+///     int keys[items_per_thread];
+///     ...
+///     warp_sort_int().sort(keys, storage[warp_id]);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class Key,
+         unsigned int ItemsPerThread,
+         unsigned int WarpSize = ::rocprim::device_warp_size(),
+         class Value           = empty_type>
+class warp_merge_sort
+{
+    static_assert(::rocprim::detail::is_power_of_two(WarpSize),
+                  "Logical warp size must be a power of two.");
+    ROCPRIM_DETAIL_DEVICE_STATIC_ASSERT(
+        WarpSize <= ::rocprim::device_warp_size(),
+        "Logical warp size cannot be larger than physical warp size.");
+    static_assert(ItemsPerThread > 0 && ItemsPerThread <= 16,
+                  "ItemsPerThread must be between 1 and 16.");
+
+    static constexpr unsigned int items_per_warp = WarpSize * ItemsPerThread;
+    static constexpr bool with_values = !std::is_same<Value, empty_type>::value;
+
+    struct storage_type_keys
+    {
+        uninitialized_array<Key, items_per_warp> keys;
+    };
+
+    struct storage_type_keys_values
+    {
+        uninitialized_array<Key, items_per_warp>   keys;
+        uninitialized_array<Value, items_per_warp> values;
+    };
+
+    using storage_type_
+        = std::conditional_t<with_values, storage_type_keys_values, storage_type_keys>;
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by the related parallel primitive.
+    ///
+    /// Depending on the implementation the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    using storage_type = storage_type_;
+
+    /// \brief Warp merge sort for any data type.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for sort. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to keys provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is is ordered before the second.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>bool f(const Key &a, const Key &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort(Key (&thread_keys)[ItemsPerThread],
+                                            storage_type&  storage,
+                                            BinaryFunction compare_function = BinaryFunction())
+    {
+        sort(thread_keys, storage, items_per_warp, compare_function);
+    }
+
+    /// \brief Warp merge sort for any data type. This function sorts the first
+    /// \p valid_items items blocked across the threads of the warp.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for sort. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to keys provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] valid_items - number of items of the warp to be sorted.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is is ordered before the second.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>bool f(const Key &a, const Key &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort(Key (&thread_keys)[ItemsPerThread],
+                                            storage_type&      storage,
+                                            const unsigned int valid_items,
+                                            BinaryFunction     compare_function = BinaryFunction())
+    {
+        const unsigned int lane         = ::rocprim::detail::logical_lane_id<WarpSize>();
+        const unsigned int thread_valid = thread_valid_items(lane, valid_items);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            ROCPRIM_UNROLL
+            for(unsigned int j = i & 1u; j + 1 < ItemsPerThread; j += 2u)
+            {
+                if(j + 1 < thread_valid && compare_function(thread_keys[j + 1], thread_keys[j]))
+                {
+                    ::rocprim::swap(thread_keys[j + 1], thread_keys[j]);
+                }
+            }
+        }
+
+        ROCPRIM_UNROLL
+        for(unsigned int partition_size = 1; partition_size < WarpSize; partition_size <<= 1u)
+        {
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; ++i)
+            {
+                storage.keys.emplace(lane * ItemsPerThread + i, thread_keys[i]);
+            }
+            ::rocprim::wave_barrier();
+
+            Key* shared_keys = storage.keys.get_unsafe_array();
+            if(thread_valid != 0)
+            {
+                ::rocprim::detail::serial_merge<false>(
+                    shared_keys,
+                    thread_keys,
+                    merge_range(lane, partition_size, shared_keys, valid_items, compare_function),
+                    compare_function);
+            }
+            ::rocprim::wave_barrier();
+        }
+    }
+
+    /// \brief Warp merge sort by key for any data type.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for sort. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to keys provided by a thread.
+    /// \param [in, out] thread_values - reference to values provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is is ordered before the second.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>bool f(const Key &a, const Key &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort(Key (&thread_keys)[ItemsPerThread],
+                                            Value (&thread_values)[ItemsPerThread],
+                                            storage_type&  storage,
+                                            BinaryFunction compare_function = BinaryFunction())
+    {
+        sort(thread_keys, thread_values, storage, items_per_warp, compare_function);
+    }
+
+    /// \brief Warp merge sort by key for any data type. This function sorts the first
+    /// \p valid_items pairs blocked across the threads of the warp.
+    ///
+    /// \tparam BinaryFunction - type of binary function used for sort. Default type
+    /// is rocprim::less<Key>.
+    ///
+    /// \param [in, out] thread_keys - reference to keys provided by a thread.
+    /// \param [in, out] thread_values - reference to values provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] valid_items - number of pairs of the warp to be sorted.
+    /// \param [in] compare_function - comparison function object which returns true if the
+    /// first argument is is ordered before the second.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>bool f(const Key &a, const Key &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    template<class BinaryFunction = ::rocprim::less<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE void sort(Key (&thread_keys)[ItemsPerThread],
+                                            Value (&thread_values)[ItemsPerThread],
+                                            storage_type&      storage,
+                                            const unsigned int valid_items,
+                                            BinaryFunction     compare_function = BinaryFunction())
+    {
+        static_assert(with_values, "Sorting values requires a Value type other than empty_type.");
+
+        const unsigned int lane         = ::rocprim::detail::logical_lane_id<WarpSize>();
+        const unsigned int thread_valid = thread_valid_items(lane, valid_items);
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            ROCPRIM_UNROLL
+            for(unsigned int j = i & 1u; j + 1 < ItemsPerThread; j += 2u)
+            {
+                if(j + 1 < thread_valid && compare_function(thread_keys[j + 1], thread_keys[j]))
+                {
+                    ::rocprim::swap(thread_keys[j + 1], thread_keys[j]);
+                    ::rocprim::swap(thread_values[j + 1], thread_values[j]);
+                }
+            }
+        }
+
+        ROCPRIM_UNROLL
+        for(unsigned int partition_size = 1; partition_size < WarpSize; partition_size <<= 1u)
+        {
+            ROCPRIM_UNROLL
+            for(unsigned int i = 0; i < ItemsPerThread; ++i)
+            {
+                storage.keys.emplace(lane * ItemsPerThread + i, thread_keys[i]);
+                storage.values.emplace(lane * ItemsPerThread + i, thread_values[i]);
+            }
+            ::rocprim::wave_barrier();
+
+            Key*   shared_keys   = storage.keys.get_unsafe_array();
+            Value* shared_values = storage.values.get_unsafe_array();
+            if(thread_valid != 0)
+            {
+                ::rocprim::detail::serial_merge<false>(
+                    shared_keys,
+                    thread_keys,
+                    shared_values,
+                    thread_values,
+                    merge_range(lane, partition_size, shared_keys, valid_items, compare_function),
+                    compare_function);
+            }
+            ::rocprim::wave_barrier();
+        }
+    }
+
+private:
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static unsigned int thread_valid_items(const unsigned int lane, const unsigned int valid_items)
+    {
+        const unsigned int thread_offset = lane * ItemsPerThread;
+        return thread_offset < valid_items ? valid_items - thread_offset : 0;
+    }
+
+    // The ranges merged by a thread when runs of partition_size threads are merged in pairs.
+    // Both runs are clamped to the valid items, so only valid keys are compared.
+    template<class BinaryFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    static ::rocprim::detail::range_t<> merge_range(const unsigned int lane,
+                                                    const unsigned int partition_size,
+                                                    const Key*         shared_keys,
+                                                    const unsigned int valid_items,
+                                                    BinaryFunction     compare_function)
+    {
+        const unsigned int mask        = partition_size * 2 - 1;
+        const unsigned int keys1_begin = ::rocprim::min((lane & ~mask) * ItemsPerThread,
+                                                        valid_items);
+        const unsigned int keys1_end
+            = ::rocprim::min(keys1_begin + partition_size * ItemsPerThread, valid_items);
+        const unsigned int keys2_begin = keys1_end;
+        const unsigned int keys2_end
+            = ::rocprim::min(keys2_begin + partition_size * ItemsPerThread, valid_items);
+
+        const unsigned int count1 = keys1_end - keys1_begin;
+        const unsigned int count2 = keys2_end - keys2_begin;
+        const unsigned int diag   = ::rocprim::min((lane & mask) * ItemsPerThread, count1 + count2);
+
+        const unsigned int partition = ::rocprim::detail::merge_path(shared_keys + keys1_begin,
+                                                                     shared_keys + keys2_begin,
+                                                                     count1,
+                                                                     count2,
+                                                                     diag,
+                                                                     compare_function);
+
+        return ::rocprim::detail::range_t<>{keys1_begin + partition,
+                                            keys1_end,
+                                            keys2_begin + diag - partition,
+                                            keys2_end};
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group warpmodule
+
+#endif // ROCPRIM_WARP_WARP_MERGE_SORT_HPP_
@@ -0,0 +1,366 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_WARP_WARP_RADIX_SORT_HPP_
+#define ROCPRIM_WARP_WARP_RADIX_SORT_HPP_
+
+#include "../config.hpp"
+#include "../detail/various.hpp"
+
+#include "../functional.hpp"
+#include "../intrinsics.hpp"
+#include "../thread/radix_key_codec.hpp"
+#include "../types.hpp"
+
+#include "warp_scan.hpp"
+
+#include <type_traits>
+
+/// \addtogroup warpmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The \p warp_radix_sort class is a warp level parallel primitive which provides
+/// methods for sorting items partitioned across the threads of a warp with a stable
+/// least-significant-digit radix sort.
+///
+/// \tparam Key - the key type.
+/// \tparam ItemsPerThread - the number of items contributed by each thread.
+/// \tparam WarpSize - the number of threads in a warp, a power of two not larger than the
+/// hardware warp size.
+/// \tparam Value - the value type. Default type empty_type indicates
+/// a keys-only sort.
+/// \tparam RadixBitsPerPass - the number of bits sorted by each pass, from 1 to 8.
+///
+/// \par Overview
+/// * The digits of a pass are ranked with \p match_any, which groups the lanes with the same
+/// digit with one ballot per bit, and per-warp digit counters in shared memory, as in the match
+/// rank of \p block_radix_sort. Only the lanes of the warp take part, so no block-level
+/// barriers are needed and every warp of a block can sort independently, for example one
+/// small segment per warp.
+/// * Both wave32 and wave64 hardware warps are supported, and logical warps smaller than the
+/// hardware warp.
+/// * The keys and values are given and returned in a blocked arrangement.
+/// * Only fundamental key types are supported.
+///
+/// \par Examples
+/// \parblock
+/// In the example a sort is performed on a warp of 16 threads, using type \p int with 4 items
+/// per thread.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     constexpr unsigned int threads_per_block = 128;
+///     constexpr unsigned int threads_per_warp  =  16;
+///     constexpr unsigned int items_per_thread  =   4;
+///     constexpr unsigned int warps_per_block   = threads_per_block / threads_per_warp;
+///     const unsigned int warp_id = hipThreadIdx_x / threads_per_warp;
+///     // specialize warp_radix_sort for int, 4 items per thread and a warp of 16 threads
+///     using warp_sort_int = rocprim::warp_radix_sort<int, items_per_thread, threads_per_warp>;
+///     // allocate storage in shared memory
+///     __shared__ warp_sort_int::storage_type storage[warps_per_block];
+///
+///     int keys[items_per_thread];
+///     ...
+///     warp_sort_int w_sort;
+///     w_sort.sort(keys, storage[warp_id]);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class Key,
+         unsigned int ItemsPerThread,
+         unsigned int WarpSize         = ::rocprim::device_warp_size(),
+         class Value                   = empty_type,
+         unsigned int RadixBitsPerPass = 4>
+class warp_radix_sort
+{
+    static_assert(::rocprim::detail::is_power_of_two(WarpSize),
+                  "Logical warp size must be a power of two.");
+    ROCPRIM_DETAIL_DEVICE_STATIC_ASSERT(
+        WarpSize <= ::rocprim::device_warp_size(),
+        "Logical warp size cannot be larger than physical warp size.");
+    static_assert(RadixBitsPerPass > 0 && RadixBitsPerPass <= 8,
+                  "RadixBitsPerPass must be between 1 and 8.");
+
+    static constexpr bool         with_values     = !std::is_same<Value, empty_type>::value;
+    static constexpr unsigned int items_per_warp  = WarpSize * ItemsPerThread;
+    static constexpr unsigned int radix_digits    = 1u << RadixBitsPerPass;
+    static constexpr unsigned int digits_per_lane = ceiling_div(radix_digits, WarpSize);
+
+    using bit_key_type   = typename ::rocprim::radix_key_codec<Key>::bit_key_type;
+    using warp_scan_type = ::rocprim::warp_scan<unsigned int, WarpSize>;
+
+    struct storage_type_
+    {
+        uninitialized_array<bit_key_type, items_per_warp>            keys;
+        uninitialized_array<Value, with_values ? items_per_warp : 1> values;
+        unsigned int                          counters[digits_per_lane * WarpSize];
+        typename warp_scan_type::storage_type scan;
+    };
+
+public:
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by the related parallel primitive.
+    ///
+    /// Depending on the implementation the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    using storage_type = storage_type_;
+
+    /// \brief Sorts the keys of the warp in ascending order.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Must be in range <tt>[0; 8 * sizeof(Key))</tt>. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Must be in range <tt>(begin_bit; 8 * sizeof(Key)]</tt>. Default
+    /// value: \p <tt>8 * sizeof(Key)</tt>.
+    ///
+    /// \par Storage reusage
+    /// A \p rocprim::wave_barrier() should be placed before \p storage is reused
+    /// or repurposed.
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(Key (&keys)[ItemsPerThread],
+              storage_type& storage,
+              unsigned int  begin_bit = 0,
+              unsigned int  end_bit   = 8 * sizeof(Key))
+    {
+        empty_type values[ItemsPerThread];
+        sort_impl<false>(keys, values, storage, begin_bit, end_bit);
+    }
+
+    /// \brief Sorts the keys of the warp in descending order.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Default value: \p <tt>8 * sizeof(Key)</tt>.
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_desc(Key (&keys)[ItemsPerThread],
+                   storage_type& storage,
+                   unsigned int  begin_bit = 0,
+                   unsigned int  end_bit   = 8 * sizeof(Key))
+    {
+        empty_type values[ItemsPerThread];
+        sort_impl<true>(keys, values, storage, begin_bit, end_bit);
+    }
+
+    /// \brief Sorts the key-value pairs of the warp in ascending order of the keys.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Default value: \p <tt>8 * sizeof(Key)</tt>.
+    template<bool WithValues = with_values>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort(Key (&keys)[ItemsPerThread],
+              typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+              storage_type& storage,
+              unsigned int  begin_bit = 0,
+              unsigned int  end_bit   = 8 * sizeof(Key))
+    {
+        sort_impl<false>(keys, values, storage, begin_bit, end_bit);
+    }
+
+    /// \brief Sorts the key-value pairs of the warp in descending order of the keys.
+    ///
+    /// \param [in, out] keys - reference to an array of keys provided by a thread.
+    /// \param [in, out] values - reference to an array of values provided by a thread.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] begin_bit - [optional] index of the first (least significant) bit used in
+    /// key comparison. Default value: \p 0.
+    /// \param [in] end_bit - [optional] past-the-end index (most significant) bit used in
+    /// key comparison. Default value: \p <tt>8 * sizeof(Key)</tt>.
+    template<bool WithValues = with_values>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_desc(Key (&keys)[ItemsPerThread],
+                   typename std::enable_if<WithValues, Value>::type (&values)[ItemsPerThread],
+                   storage_type& storage,
+                   unsigned int  begin_bit = 0,
+                   unsigned int  end_bit   = 8 * sizeof(Key))
+    {
+        sort_impl<true>(keys, values, storage, begin_bit, end_bit);
+    }
+
+private:
+    // Ranks the digits of the items, which are in a striped arrangement. The ranks follow the
+    // order of the items within each digit, so the sort is stable.
+    template<class KeyCodec>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void rank(const bit_key_type (&bit_keys)[ItemsPerThread],
+              unsigned int (&ranks)[ItemsPerThread],
+              storage_type&      storage,
+              const unsigned int bit,
+              const unsigned int pass_bits)
+    {
+        const unsigned int   lane      = ::rocprim::detail::logical_lane_id<WarpSize>();
+        const lane_mask_type warp_mask = detail::logical_warp_lane_mask<WarpSize>();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < digits_per_lane; ++i)
+        {
+            storage.counters[lane * digits_per_lane + i] = 0;
+        }
+        ::rocprim::wave_barrier();
+
+        unsigned int digits[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            digits[i] = KeyCodec::extract_digit(bit_keys[i], bit, pass_bits);
+
+            const unsigned int warp_digit_prefix = i == 0 ? 0u : storage.counters[digits[i]];
+            const lane_mask_type peer_mask
+                = ::rocprim::match_any<RadixBitsPerPass>(digits[i]) & warp_mask;
+            ::rocprim::wave_barrier();
+
+            if(::rocprim::group_elect(peer_mask))
+            {
+                storage.counters[digits[i]] = warp_digit_prefix + ::rocprim::bit_count(peer_mask);
+            }
+            ::rocprim::wave_barrier();
+
+            ranks[i] = warp_digit_prefix + ::rocprim::masked_bit_count(peer_mask);
+        }
+
+        // Scan the counters of the digits to the offset of every digit.
+        unsigned int counts[digits_per_lane];
+        unsigned int lane_count = 0;
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < digits_per_lane; ++i)
+        {
+            counts[i] = storage.counters[lane * digits_per_lane + i];
+            lane_count += counts[i];
+        }
+        unsigned int lane_offset;
+        warp_scan_type().exclusive_scan(lane_count, lane_offset, 0u, storage.scan);
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < digits_per_lane; ++i)
+        {
+            storage.counters[lane * digits_per_lane + i] = lane_offset;
+            lane_offset += counts[i];
+        }
+        ::rocprim::wave_barrier();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            ranks[i] += storage.counters[digits[i]];
+        }
+    }
+
+    template<class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void exchange(bit_key_type (&bit_keys)[ItemsPerThread],
+                  V (&values)[ItemsPerThread],
+                  const unsigned int (&ranks)[ItemsPerThread],
+                  const bool         to_blocked,
+                  storage_type&      storage)
+    {
+        const unsigned int lane = ::rocprim::detail::logical_lane_id<WarpSize>();
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            storage.keys.emplace(ranks[i], bit_keys[i]);
+            if ROCPRIM_IF_CONSTEXPR(with_values)
+            {
+                storage.values.emplace(ranks[i], values[i]);
+            }
+        }
+        ::rocprim::wave_barrier();
+
+        const auto& shared_keys   = storage.keys.get_unsafe_array();
+        const auto& shared_values = storage.values.get_unsafe_array();
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const unsigned int index = to_blocked ? lane * ItemsPerThread + i : i * WarpSize + lane;
+            bit_keys[i]              = shared_keys[index];
+            if ROCPRIM_IF_CONSTEXPR(with_values)
+            {
+                values[i] = shared_values[index];
+            }
+        }
+        ::rocprim::wave_barrier();
+    }
+
+    template<bool Descending, class V>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void sort_impl(Key (&keys)[ItemsPerThread],
+                   V (&values)[ItemsPerThread],
+                   storage_type& storage,
+                   unsigned int  begin_bit,
+                   unsigned int  end_bit)
+    {
+        using key_codec = ::rocprim::radix_key_codec<Key, Descending>;
+
+        if(begin_bit >= end_bit)
+        {
+            return;
+        }
+
+        const unsigned int lane = ::rocprim::detail::logical_lane_id<WarpSize>();
+
+        bit_key_type bit_keys[ItemsPerThread];
+        unsigned int ranks[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            bit_keys[i] = key_codec::encode(keys[i]);
+            ranks[i]    = lane * ItemsPerThread + i;
+        }
+
+        // The items are ranked in a striped arrangement, in which the order of the items of a
+        // thread and the order of the lanes together give the order of the input.
+        exchange(bit_keys, values, ranks, false, storage);
+
+        for(unsigned int bit = begin_bit; bit < end_bit; bit += RadixBitsPerPass)
+        {
+            const unsigned int pass_bits = ::rocprim::min(RadixBitsPerPass, end_bit - bit);
+            rank<key_codec>(bit_keys, ranks, storage, bit, pass_bits);
+            exchange(bit_keys, values, ranks, bit + pass_bits >= end_bit, storage);
+        }
+
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            keys[i] = key_codec::decode(bit_keys[i]);
+        }
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group warpmodule
+
+#endif // ROCPRIM_WARP_WARP_RADIX_SORT_HPP_
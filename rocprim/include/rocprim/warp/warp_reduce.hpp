@@ -358,6 +358,43 @@ public:
         ROCPRIM_PRINT_ERROR_ONCE("Specified warp size exceeds current hardware supported warp size. Aborting warp sort.");
         return;
     }
+
+    /// \brief Performs \p N independent reductions across threads in a logical warp.
+    ///
+    /// The k-th values of all threads are reduced into the k-th output. The reductions
+    /// are independent, so their cross-lane operations can be interleaved by the compiler.
+    ///
+    /// \tparam N - number of independent values.
+    /// \tparam BinaryFunction - type of binary function used for reduce. Default type
+    /// is rocprim::plus<T>.
+    ///
+    /// \param [in] input - reference to an array containing the thread input values, one
+    /// for every reduction.
+    /// \param [out] output - reference to an array of thread output values. May be aliased
+    /// with \p input.
+    /// \param [in] storage - reference to an array of temporary storage objects, one for every
+    /// reduction.
+    /// \param [in] reduce_op - binary operation function object that will be used for reduce.
+    /// The signature of the function should be equivalent to the following:
+    /// <tt>T f(const T &a, const T &b);</tt>. The signature does not need to have
+    /// <tt>const &</tt>, but function object must not modify the objects passed to it.
+    ///
+    /// \par Storage reusage
+    /// Synchronization barrier should be placed before \p storage is reused
+    /// or repurposed: \p __syncthreads() or \p rocprim::syncthreads().
+    template<unsigned int N, class BinaryFunction = ::rocprim::plus<T>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void multi_reduce(const T (&input)[N],
+                      T (&output)[N],
+                      storage_type (&storage)[N],
+                      BinaryFunction reduce_op = BinaryFunction())
+    {
+        ROCPRIM_UNROLL
+        for(unsigned int k = 0; k < N; k++)
+        {
+            this->reduce(input[k], output[k], storage[k], reduce_op);
+        }
+    }
 };
 
 END_ROCPRIM_NAMESPACE
@@ -0,0 +1,455 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCPRIM_WARP_WARP_REDUCE_BY_KEY_HPP_
+#define ROCPRIM_WARP_WARP_REDUCE_BY_KEY_HPP_
+
+#include "../config.hpp"
+#include "../detail/binary_op_wrappers.hpp"
+#include "../detail/various.hpp"
+
+#include "../block/block_reduce_by_key.hpp"
+#include "../functional.hpp"
+#include "../intrinsics.hpp"
+#include "../types.hpp"
+
+#include "warp_discontinuity.hpp"
+#include "warp_scan.hpp"
+
+/// \addtogroup warpmodule
+/// @{
+
+BEGIN_ROCPRIM_NAMESPACE
+
+/// \brief The \p warp_reduce_by_key class is a warp level parallel primitive which reduces
+/// the values of runs of consecutive equal keys partitioned across the threads of a warp.
+///
+/// \tparam Key - the key type.
+/// \tparam Value - the value type, which is also the type of the aggregates.
+/// \tparam WarpSize - the number of threads in a warp, a power of two not larger than the
+/// hardware warp size.
+///
+/// \par Overview
+/// * The warp version of \p block_reduce_by_key, with the same interface. The items are in a
+/// blocked arrangement over the warp, and the first key and the aggregate of every run are
+/// written at the index of the run to the output iterators.
+/// * The heads of the runs are flagged with \p warp_discontinuity and the runs are reduced
+/// with a single \p warp_scan, and the carried run is exchanged with shuffles, so no block
+/// level synchronization is needed.
+///
+/// \par Examples
+/// \parblock
+/// In the example the runs of 8 \p int keys and \p float values per thread are reduced by
+/// warps of 32 threads.
+///
+/// \code{.cpp}
+/// __global__ void example_kernel(...)
+/// {
+///     constexpr unsigned int threads_per_block = 128;
+///     constexpr unsigned int threads_per_warp  =  32;
+///     constexpr unsigned int warps_per_block   = threads_per_block / threads_per_warp;
+///     const unsigned int warp_id = hipThreadIdx_x / threads_per_warp;
+///     using warp_reduce_by_key_type
+///         = rocprim::warp_reduce_by_key<int, float, threads_per_warp>;
+///     // allocate storage in shared memory
+///     __shared__ warp_reduce_by_key_type::storage_type storage[warps_per_block];
+///
+///     int keys[8];
+///     float values[8];
+///     ...
+///     unsigned int run_count;
+///     warp_reduce_by_key_type().reduce(keys, values, unique_keys, aggregates, run_count,
+///                                      storage[warp_id]);
+///     ...
+/// }
+/// \endcode
+/// \endparblock
+template<class Key, class Value, unsigned int WarpSize = ::rocprim::device_warp_size()>
+class warp_reduce_by_key
+{
+    static_assert(::rocprim::detail::is_power_of_two(WarpSize),
+                  "Logical warp size must be a power of two.");
+    ROCPRIM_DETAIL_DEVICE_STATIC_ASSERT(
+        WarpSize <= ::rocprim::device_warp_size(),
+        "Logical warp size cannot be larger than physical warp size.");
+
+    using wrapped_type = ::rocprim::tuple<unsigned int, Value>;
+    using flags_type   = warp_discontinuity<Key, WarpSize>;
+    using scan_type    = warp_scan<wrapped_type, WarpSize>;
+
+public:
+    /// \brief The type of the open run carried from tile to tile.
+    using carry_type = reduce_by_key_carry<Key, Value>;
+
+    /// \brief Struct used to allocate a temporary memory that is required for thread
+    /// communication during operations provided by the related parallel primitive.
+    ///
+    /// Depending on the implementation the operations exposed by parallel primitive may
+    /// require a temporary storage for thread communication. The storage should be allocated
+    /// using keywords <tt>__shared__</tt>. It can be aliased to
+    /// an externally allocated memory, or be a part of a union type with other storage types
+    /// to increase shared memory reusability.
+    using storage_type = typename scan_type::storage_type;
+
+    /// \brief Reduces the runs of the items of the warp.
+    ///
+    /// \param [in] keys - the keys of the thread, in a blocked arrangement.
+    /// \param [in] values - the values of the thread, in a blocked arrangement.
+    /// \param [out] unique_output - iterator to the first keys of the runs, which must have
+    /// room for <tt>WarpSize * ItemsPerThread</tt> runs.
+    /// \param [out] aggregates_output - iterator to the aggregates of the runs, which must
+    /// have room for <tt>WarpSize * ItemsPerThread</tt> runs.
+    /// \param [out] run_count - the number of runs, same for all threads of the warp.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] reduce_op - binary operation function object that is used to reduce the
+    /// values of a run. Default is \p rocprim::plus<Value>.
+    /// \param [in] key_compare_op - binary function object that returns \p true if two keys
+    /// belong to the same run. Default is \p rocprim::equal_to<Key>.
+    ///
+    /// \par Storage reusage
+    /// A \p rocprim::wave_barrier() should be placed before \p storage is reused
+    /// or repurposed.
+    template<unsigned int ItemsPerThread,
+             class UniqueOutputIterator,
+             class AggregatesOutputIterator,
+             class BinaryFunction     = ::rocprim::plus<Value>,
+             class KeyCompareFunction = ::rocprim::equal_to<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reduce(const Key (&keys)[ItemsPerThread],
+                const Value (&values)[ItemsPerThread],
+                UniqueOutputIterator     unique_output,
+                AggregatesOutputIterator aggregates_output,
+                unsigned int&            run_count,
+                storage_type&            storage,
+                BinaryFunction           reduce_op      = BinaryFunction(),
+                KeyCompareFunction       key_compare_op = KeyCompareFunction())
+    {
+        carry_type carry{};
+        reduce_impl<false>(keys,
+                           values,
+                           WarpSize * ItemsPerThread,
+                           unique_output,
+                           aggregates_output,
+                           run_count,
+                           carry,
+                           storage,
+                           reduce_op,
+                           key_compare_op);
+    }
+
+    /// \brief Reduces the runs of the first \p valid_items items of the warp.
+    ///
+    /// \param [in] keys - the keys of the thread, in a blocked arrangement.
+    /// \param [in] values - the values of the thread, in a blocked arrangement.
+    /// \param [in] valid_items - the number of valid items in the warp, the other items are
+    /// ignored.
+    /// \param [out] unique_output - iterator to the first keys of the runs.
+    /// \param [out] aggregates_output - iterator to the aggregates of the runs.
+    /// \param [out] run_count - the number of runs, same for all threads of the warp.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] reduce_op - binary operation function object that is used to reduce the
+    /// values of a run.
+    /// \param [in] key_compare_op - binary function object that returns \p true if two keys
+    /// belong to the same run.
+    template<unsigned int ItemsPerThread,
+             class UniqueOutputIterator,
+             class AggregatesOutputIterator,
+             class BinaryFunction     = ::rocprim::plus<Value>,
+             class KeyCompareFunction = ::rocprim::equal_to<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reduce(const Key (&keys)[ItemsPerThread],
+                const Value (&values)[ItemsPerThread],
+                unsigned int             valid_items,
+                UniqueOutputIterator     unique_output,
+                AggregatesOutputIterator aggregates_output,
+                unsigned int&            run_count,
+                storage_type&            storage,
+                BinaryFunction           reduce_op      = BinaryFunction(),
+                KeyCompareFunction       key_compare_op = KeyCompareFunction())
+    {
+        carry_type carry{};
+        reduce_impl<false>(keys,
+                           values,
+                           valid_items,
+                           unique_output,
+                           aggregates_output,
+                           run_count,
+                           carry,
+                           storage,
+                           reduce_op,
+                           key_compare_op);
+    }
+
+    /// \brief Reduces the runs of the items of the warp, continuing the open run of the
+    /// preceding tile and carrying the last run of the warp out to the next tile.
+    ///
+    /// If \p carry is open, it is run 0 of the warp, and the leading items of the warp are
+    /// reduced into it when their keys are equal to its key. The last run is not written, but
+    /// returned in \p carry, so all written runs are complete.
+    ///
+    /// \param [in] keys - the keys of the thread, in a blocked arrangement.
+    /// \param [in] values - the values of the thread, in a blocked arrangement.
+    /// \param [out] unique_output - iterator to the first keys of the runs.
+    /// \param [out] aggregates_output - iterator to the aggregates of the runs.
+    /// \param [out] run_count - the number of runs written, same for all threads of the warp.
+    /// \param [in, out] carry - the open run of the preceding tile on input, same for all
+    /// threads of the warp, and the open run of this warp on output. It must not be open
+    /// before the first tile.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] reduce_op - binary operation function object that is used to reduce the
+    /// values of a run.
+    /// \param [in] key_compare_op - binary function object that returns \p true if two keys
+    /// belong to the same run.
+    template<unsigned int ItemsPerThread,
+             class UniqueOutputIterator,
+             class AggregatesOutputIterator,
+             class BinaryFunction     = ::rocprim::plus<Value>,
+             class KeyCompareFunction = ::rocprim::equal_to<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reduce(const Key (&keys)[ItemsPerThread],
+                const Value (&values)[ItemsPerThread],
+                UniqueOutputIterator     unique_output,
+                AggregatesOutputIterator aggregates_output,
+                unsigned int&            run_count,
+                carry_type&              carry,
+                storage_type&            storage,
+                BinaryFunction           reduce_op      = BinaryFunction(),
+                KeyCompareFunction       key_compare_op = KeyCompareFunction())
+    {
+        reduce_impl<true>(keys,
+                          values,
+                          WarpSize * ItemsPerThread,
+                          unique_output,
+                          aggregates_output,
+                          run_count,
+                          carry,
+                          storage,
+                          reduce_op,
+                          key_compare_op);
+    }
+
+    /// \brief Reduces the runs of the first \p valid_items items of the warp, continuing the
+    /// open run of the preceding tile and carrying the last run out to the next tile.
+    ///
+    /// \param [in] keys - the keys of the thread, in a blocked arrangement.
+    /// \param [in] values - the values of the thread, in a blocked arrangement.
+    /// \param [in] valid_items - the number of valid items in the warp, the other items are
+    /// ignored. If it is zero, \p carry is not changed.
+    /// \param [out] unique_output - iterator to the first keys of the runs.
+    /// \param [out] aggregates_output - iterator to the aggregates of the runs.
+    /// \param [out] run_count - the number of runs written, same for all threads of the warp.
+    /// \param [in, out] carry - the open run of the preceding tile on input, same for all
+    /// threads of the warp, and the open run of this warp on output.
+    /// \param [in] storage - reference to a temporary storage object of type storage_type.
+    /// \param [in] reduce_op - binary operation function object that is used to reduce the
+    /// values of a run.
+    /// \param [in] key_compare_op - binary function object that returns \p true if two keys
+    /// belong to the same run.
+    template<unsigned int ItemsPerThread,
+             class UniqueOutputIterator,
+             class AggregatesOutputIterator,
+             class BinaryFunction     = ::rocprim::plus<Value>,
+             class KeyCompareFunction = ::rocprim::equal_to<Key>>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reduce(const Key (&keys)[ItemsPerThread],
+                const Value (&values)[ItemsPerThread],
+                unsigned int             valid_items,
+                UniqueOutputIterator     unique_output,
+                AggregatesOutputIterator aggregates_output,
+                unsigned int&            run_count,
+                carry_type&              carry,
+                storage_type&            storage,
+                BinaryFunction           reduce_op      = BinaryFunction(),
+                KeyCompareFunction       key_compare_op = KeyCompareFunction())
+    {
+        reduce_impl<true>(keys,
+                          values,
+                          valid_items,
+                          unique_output,
+                          aggregates_output,
+                          run_count,
+                          carry,
+                          storage,
+                          reduce_op,
+                          key_compare_op);
+    }
+
+private:
+    template<bool WithCarry,
+             unsigned int ItemsPerThread,
+             class UniqueOutputIterator,
+             class AggregatesOutputIterator,
+             class BinaryFunction,
+             class KeyCompareFunction>
+    ROCPRIM_DEVICE ROCPRIM_INLINE
+    void reduce_impl(const Key (&keys)[ItemsPerThread],
+                     const Value (&values)[ItemsPerThread],
+                     const unsigned int       valid_items,
+                     UniqueOutputIterator     unique_output,
+                     AggregatesOutputIterator aggregates_output,
+                     unsigned int&            run_count,
+                     carry_type&              carry,
+                     storage_type&            storage,
+                     BinaryFunction           reduce_op,
+                     KeyCompareFunction       key_compare_op)
+    {
+        static constexpr unsigned int items_per_warp = WarpSize * ItemsPerThread;
+
+        run_count = 0;
+        if(valid_items == 0)
+        {
+            return;
+        }
+
+        const unsigned int lane     = ::rocprim::detail::logical_lane_id<WarpSize>();
+        const unsigned int offset   = lane * ItemsPerThread;
+        const bool         carry_in = WithCarry && carry.is_open;
+        const bool         is_full  = valid_items >= items_per_warp;
+
+        // The carried run is compared with the first key, so it is the predecessor of the tile.
+        const auto flag_op
+            = detail::guarded_inequality_op<KeyCompareFunction>{key_compare_op, valid_items};
+        unsigned int head_flags[ItemsPerThread];
+        if(carry_in)
+        {
+            flags_type{}.flag_heads(head_flags, carry.key, keys, flag_op);
+        }
+        else
+        {
+            flags_type{}.flag_heads(head_flags, keys, flag_op);
+        }
+
+        // The first invalid item is flagged too, so the exclusive scan yields the aggregate of
+        // the last run at that item.
+        wrapped_type wrapped[ItemsPerThread];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            rocprim::get<0>(wrapped[i]) = head_flags[i] | (offset + i == valid_items);
+            rocprim::get<1>(wrapped[i]) = values[i];
+        }
+
+        // The aggregate of the carried run is the prefix of the items that continue it, the
+        // initial value is ignored otherwise.
+        const wrapped_type init
+            = ::rocprim::make_tuple(0u, carry_in ? carry.aggregate : values[0]);
+        auto wrapped_op = detail::run_count_scan_op_wrapper<Value, BinaryFunction>{reduce_op};
+
+        wrapped_type thread_reduction = wrapped[0];
+        ROCPRIM_UNROLL
+        for(unsigned int i = 1; i < ItemsPerThread; ++i)
+        {
+            thread_reduction = wrapped_op(thread_reduction, wrapped[i]);
+        }
+        wrapped_type prefix;
+        wrapped_type reduction;
+        scan_type{}.exclusive_scan(thread_reduction, prefix, init, reduction, storage, wrapped_op);
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const wrapped_type item = wrapped[i];
+            wrapped[i]              = prefix;
+            prefix                  = wrapped_op(prefix, item);
+        }
+
+        // Run 0 of the warp is the carried run, if any.
+        const unsigned int first_run = carry_in ? 1 : 0;
+        const unsigned int total_runs
+            = rocprim::get<0>(reduction) - (is_full ? 0 : 1) + first_run;
+        // The last run is carried out instead of being written.
+        const unsigned int written_runs = WithCarry ? total_runs - 1 : total_runs;
+
+        bool  owns_last_key = false;
+        Key   last_key      = carry.key;
+        Value last_aggregate{};
+        if(carry_in && lane == 0 && written_runs > 0)
+        {
+            unique_output[0] = carry.key;
+        }
+        ROCPRIM_UNROLL
+        for(unsigned int i = 0; i < ItemsPerThread; ++i)
+        {
+            const bool is_first_invalid = offset + i == valid_items;
+            if(!head_flags[i] && !is_first_invalid)
+            {
+                continue;
+            }
+            // The first invalid item starts the run past the last one.
+            const unsigned int run = rocprim::get<0>(wrapped[i]) + first_run;
+            // The exclusive scan at a head is the aggregate of the preceding run.
+            if(run > 0 && run - 1 < written_runs)
+            {
+                aggregates_output[run - 1] = rocprim::get<1>(wrapped[i]);
+            }
+            else if(is_first_invalid)
+            {
+                last_aggregate = rocprim::get<1>(wrapped[i]);
+            }
+            if(!is_first_invalid)
+            {
+                if(run < written_runs)
+                {
+                    unique_output[run] = keys[i];
+                }
+                else
+                {
+                    owns_last_key = true;
+                    last_key      = keys[i];
+                }
+            }
+        }
+
+        // In a full warp the last run ends with the warp.
+        if(is_full)
+        {
+            last_aggregate = rocprim::get<1>(wrapped_op(init, reduction));
+            if(!WithCarry && lane == WarpSize - 1)
+            {
+                aggregates_output[total_runs - 1] = last_aggregate;
+            }
+        }
+
+        if(WithCarry)
+        {
+            // Without a head in the warp the carried run stays open.
+            const lane_mask_type key_owner = ::rocprim::ballot(owns_last_key)
+                                             & detail::logical_warp_lane_mask<WarpSize>();
+            if(key_owner != 0)
+            {
+                carry.key = ::rocprim::warp_shuffle(last_key, ::rocprim::ctz(key_owner), WarpSize);
+            }
+            if(!is_full)
+            {
+                const unsigned int src_lane = valid_items / ItemsPerThread;
+                last_aggregate = ::rocprim::warp_shuffle(last_aggregate, src_lane, WarpSize);
+            }
+            carry.aggregate = last_aggregate;
+            carry.is_open   = true;
+        }
+        run_count = written_runs;
+    }
+};
+
+END_ROCPRIM_NAMESPACE
+
+/// @}
+// end of group warpmodule
+
+#endif // ROCPRIM_WARP_WARP_REDUCE_BY_KEY_HPP_
@@ -1,19 +1,22 @@
 #!/usr/bin/env python3
 
-from typing import Union, List
+from typing import Union, List, Tuple
 import argparse
 import glob
 import itertools
 import json
 import logging
+import math
 import multiprocessing as mp
 import os
+import random
 import pathos.multiprocessing as pamp
 import rich.logging
 import rich.progress
 import scipy.optimize
 import shutil
 import subprocess
+import sys
 
 parameter_spaces = {
     "device_segmented_radix_sort_keys": {
@@ -76,18 +79,58 @@ parameter_spaces = {
     },
 }
 
-def get_result_from_json(filename: os.PathLike) -> Union[float, int]:
+def get_benchmark_result(benchmark: dict, objective: str, power_cap: Union[float, None]) -> Tuple[float, float, float]:
     '''
-    Get the result from the benchmark json.
+    Get the result of a single benchmark of the json and the bounds of its 95% confidence interval.
+    The result is the throughput, or the items per joule when optimizing for energy, and 0 when the
+    average power of the benchmark is above the power cap. The benchmarks report the interval of
+    the mean iteration time as the counters 'ci95_low_ms' and 'ci95_high_ms', and the throughput is
+    inversely proportional to the time. Benchmarks without the counters, and the energy, give an
+    empty interval at their result.
+    '''
+    if power_cap is not None or objective == 'energy':
+        if 'average_power_w' not in benchmark:
+            raise ValueError('no energy counters in JSON, build the benchmarks with BENCHMARK_ENERGY')
+        if power_cap is not None and float(benchmark['average_power_w']) > power_cap:
+            return (0.0, 0.0, 0.0)
+    if objective == 'energy':
+        joules_per_item = float(benchmark['joules_per_item'])
+        result = 1.0 / joules_per_item if joules_per_item > 0.0 else 0.0
+        return (result, result, result)
+
+    result = float(benchmark['bytes_per_second'])
+    if result <= 0.0 or 'mean_ms' not in benchmark or 'ci95_high_ms' not in benchmark or 'ci95_low_ms' not in benchmark:
+        return (result, result, result)
+    mean = float(benchmark['mean_ms'])
+    low = result * mean / float(benchmark['ci95_high_ms'])
+    ci_low = float(benchmark['ci95_low_ms'])
+    high = result * mean / ci_low if ci_low > 0.0 else math.inf
+    return (low, result, high)
+
+def get_results_from_json(filename: os.PathLike, objective: str, power_cap: Union[float, None]) -> Tuple[float, float, float]:
+    '''
+    Get the result from the benchmark json and its confidence interval. When the json holds several
+    benchmarks, e.g. one per segment distribution, the result and the bounds are the geometric
+    means of those of the benchmarks, so that a config has to do well on all of them.
     '''
     with open(filename, 'r') as file:
         data = json.load(file)
         try:
-            return float(data['benchmarks'][0]['bytes_per_second'])
+            results = [get_benchmark_result(benchmark, objective, power_cap) for benchmark in data['benchmarks']]
+            if not results:
+                raise ValueError('no benchmarks in JSON')
         except Exception as e:
-            log.error('Could not extract \'bytes_per_second\' from JSON!')
+            log.error(f'Could not extract the {objective} result from JSON!')
             raise e
 
+    def geometric_mean(values: List[float]) -> float:
+        if min(values) <= 0.0:
+            return 0.0
+        if math.inf in values:
+            return math.inf
+        return math.exp(sum(math.log(value) for value in values) / len(values))
+    return tuple(geometric_mean([result[i] for result in results]) for i in range(3))
+
 def merge_jsons(source_filenames: List[os.PathLike], target_filename: os.PathLike) -> None:
     '''
     Merges benchmark JSONs. This is used to collect the singular results generated from the various
@@ -130,13 +173,36 @@ def combine(alg_name: str, arch: str):
         os.path.join(result_dir, f'{arch}_{build_target}.json'),
     )
 
-def tune_alg(alg_name: str, arch: str, max_samples: int, num_workers: int, size: int, trials: int) -> None:
+def emit(alg_name: str, arch: str, out_basedir: os.PathLike) -> None:
+    '''
+    Generates the config headers from the combined result of an algorithm with
+    scripts/autotune/create_optimization.py.
+    '''
+    script_dir = os.path.dirname(os.path.realpath(__file__))
+    result_dir = os.path.join(script_dir, 'artifacts')
+    build_target = parameter_spaces[alg_name]['benchmark']
+
+    log.info(f'Writing the configs of {alg_name} to {out_basedir}')
+    subprocess.check_call(
+        [
+            sys.executable,
+            os.path.join(script_dir, '../autotune/create_optimization.py'),
+            '--benchmark_files',
+            os.path.join(result_dir, f'{arch}_{build_target}.json'),
+            '--out_basedir',
+            out_basedir,
+        ]
+    )
+
+def tune_alg(alg_name: str, arch: str, max_samples: int, num_workers: int, size: int, trials: int, distribution: str, segment_distribution: str, strategy: str, halving_factor: int, min_halving_size: int, objective: str, power_cap: Union[float, None]) -> None:
     '''
     The core tuning procedure. This tunes a single algorithm for multiple types.
     '''
 
     # get the context of the tuning run
     alg_space = parameter_spaces[alg_name]
+    # the energy counters of the benchmarks need rocm_smi
+    use_energy = objective == 'energy' or power_cap is not None
     build_target = alg_space['benchmark']
 
     # types to tune, this can be a product of multiple types
@@ -172,8 +238,31 @@ def tune_alg(alg_name: str, arch: str, max_samples: int, num_workers: int, size:
 
     def tune_type(type: str) -> None:
         cache = {}
+        # confidence interval of the accepted config of the type
+        accepted = {}
+
+        def config_from_normalized(xs: List[float]) -> dict:
+            return dict(
+                (
+                    (name, param_from_normalized(name, val))
+                    for name, val in zip(alg_space['params'], xs)
+                )
+            )
+
+        def result_id_from_normalized(xs: List[float]) -> str:
+            return '_'.join(list(type.values()) + list(config_from_normalized(xs).values()))
+
+        def build(xs: List[float]) -> Union[str, None]:
+            '''
+            Builds the benchmark for a config and returns the path of its executable, or None when
+            the config does not configure or compile. The executable is kept in the artifacts so
+            that it can be run again at other sizes.
+            '''
+            result_id = result_id_from_normalized(xs)
+            executable = os.path.join(bin_dir, f'{build_target}_{result_id}')
+            if os.path.exists(executable):
+                return executable
 
-        def sample(xs: List[float]) -> Union[float, int]:
             # each worker should get their own build dir
             build_dir = os.path.join(source_dir, f'build/tune-{worker_id}')
 
@@ -185,21 +274,10 @@ def tune_alg(alg_name: str, arch: str, max_samples: int, num_workers: int, size:
                 # if the tree doesn't exist we don't have to remove it :)
                 pass
 
-            tune_param_names = list(type.keys()) + list(alg_space['params'])
-            tune_param_vals = list(type.values()) + [
-                param_from_normalized(name, value)
-                for (name, value) in zip(alg_space['params'].keys(), xs)
-            ]
-
-            result_id = '_'.join(tune_param_vals)
-            if result_id in cache:
-                log.info(f'[{worker_id}] Skipped already computed result!')
-                return cache[result_id]
-
-            result_filename = f'{arch}_{build_target}_{result_id}.json'
-
-            tune_param_names = ';'.join(tune_param_names)
-            tune_param_vals = ';'.join(tune_param_vals)
+            tune_param_names = ';'.join(list(type.keys()) + list(alg_space['params']))
+            tune_param_vals = ';'.join(
+                list(type.values()) + list(config_from_normalized(xs).values())
+            )
 
             # CMake configure
             log.info(f'[{worker_id}] Configuring: {result_id}')
@@ -217,6 +295,7 @@ def tune_alg(alg_name: str, arch: str, max_samples: int, num_workers: int, size:
                     f'-DAMDGPU_TARGETS={arch}',
                     f'-DBENCHMARK_TUNE_PARAM_NAMES={tune_param_names}',
                     f'-DBENCHMARK_TUNE_PARAMS={tune_param_vals}',
+                    f'-DBENCHMARK_ENERGY={"ON" if use_energy else "OFF"}',
                 ],
                 cwd=source_dir,
                 stdout=subprocess.DEVNULL,
@@ -224,8 +303,7 @@ def tune_alg(alg_name: str, arch: str, max_samples: int, num_workers: int, size:
             )
 
             if configure != 0:
-                cache[result_id] = 0.0
-                return 0.0
+                return None
 
             # Build target
             log.info(f'[{worker_id}] Building: {result_id}')
@@ -237,68 +315,157 @@ def tune_alg(alg_name: str, arch: str, max_samples: int, num_workers: int, size:
             )
 
             if build != 0:
-                cache[result_id] = 0.0
-                result_context = {
-                    'config': dict(
-                        (
-                            (name, param_from_normalized(name, val))
-                            for name, val in zip(alg_space['params'], xs)
-                        )
-                    )
-                }
-                log.debug(json.dumps(result_context, indent=2))
-                return 0.0
+                log.debug(json.dumps({'config': config_from_normalized(xs)}, indent=2))
+                return None
+
+            shutil.copy2(os.path.join(build_dir, 'benchmark', build_target), executable)
+            return executable
+
+        def run(executable: str, xs: List[float], run_size: int, run_trials: int, run_dir: str) -> float:
+            '''
+            Runs the benchmark of a config and returns its result, the throughput or the items per
+            joule, or 0 when it fails.
+            '''
+            result_id = result_id_from_normalized(xs)
+            result_filename = f'{arch}_{build_target}_{result_id}.json'
 
-            # Run benchmark
             gpu_lock.acquire()
             try:
-                log.info(f'[{worker_id}] Benchmarking: {result_id}')
+                log.info(f'[{worker_id}] Benchmarking: {result_id} with size {run_size}')
                 bench = subprocess.call(
                     [
-                        os.path.join(build_dir, 'benchmark', build_target),
+                        executable,
                         '--name_format',
                         'json',
                         '--seed',
                         'random',  # Random is better... I think? Otherwise we might overfit.
                         '--size',
-                        f'{size}',
+                        f'{run_size}',
                         '--trials',
-                        f'{trials}',
+                        f'{run_trials}',
+                        '--distribution',
+                        distribution,
+                        '--segment_distribution',
+                        segment_distribution,
                         '--benchmark_out_format=json',
                         f'--benchmark_out={result_filename}',
                     ],
-                    cwd=result_dir,
+                    cwd=run_dir,
                     stdout=subprocess.DEVNULL,
                     stderr=subprocess.DEVNULL,
                     timeout=120,
                 )
 
                 if bench != 0:
-                    cache[result_id] = 0.0
                     return 0.0
-                result_value = get_result_from_json(
-                    os.path.join(result_dir, result_filename)
+                _, result_value, _ = get_results_from_json(
+                    os.path.join(run_dir, result_filename), objective, power_cap
                 )
-                log.info(f'[{worker_id}] Completed: {result_id} @ {result_value / 1e9:.3f} GB/s')
+                if objective == 'energy':
+                    log.info(f'[{worker_id}] Completed: {result_id} @ {result_value / 1e9:.3f} G items/J')
+                else:
+                    log.info(f'[{worker_id}] Completed: {result_id} @ {result_value / 1e9:.3f} GB/s')
+            except subprocess.TimeoutExpired:
+                return 0.0
             finally:
                 gpu_lock.release()
 
             result_context = {
-                'config': dict(
-                    (
-                        (name, param_from_normalized(name, val))
-                        for name, val in zip(alg_space['params'], xs)
-                    )
-                ),
-                'bytes_per_second': result_value,
+                'config': config_from_normalized(xs),
+                'size': run_size,
+                objective: result_value,
             }
             log.debug(json.dumps(result_context, indent=2))
+            return result_value
+
+        def accept(xs: List[float], run_dir: str) -> None:
+            '''
+            Makes the result of a config the tuning result of the type, but only when it wins with
+            statistical significance: the lower bound of the confidence interval of its throughput
+            has to be above the upper bound of the accepted config. Otherwise the run to run noise
+            of small configs, often 10%, decides between configs that are equally fast.
+            '''
+            result_id = result_id_from_normalized(xs)
+            result_filename = os.path.join(run_dir, f'{arch}_{build_target}_{result_id}.json')
+            low, _, high = get_results_from_json(result_filename, objective, power_cap)
+            if accepted and low <= accepted['high']:
+                log.info(f'[{worker_id}] Not significantly faster: {result_id}')
+                return
+            log.info(f'[{worker_id}] Accepted: {result_id}')
+            accepted.update(low=low, high=high)
+            type_id = '_'.join(type.values())
+            shutil.copy2(
+                result_filename,
+                os.path.join(result_dir, f'{arch}_{build_target}_{type_id}.json'),
+            )
+
+        def sample(xs: List[float]) -> Union[float, int]:
+            result_id = result_id_from_normalized(xs)
+            if result_id in cache:
+                log.info(f'[{worker_id}] Skipped already computed result!')
+                return cache[result_id]
 
+            executable = build(xs)
+            result_value = 0.0
+            if executable is not None:
+                result_value = run(executable, xs, size, trials, candidate_dir)
+            if result_value > 0.0:
+                accept(xs, candidate_dir)
             cache[result_id] = -result_value
 
             # scipy.optimize does minimization, negate result for maximize
             return -result_value
 
+        def successive_halving() -> None:
+            '''
+            Successive halving, see 'Non-stochastic Best Arm Identification and Hyperparameter
+            Optimization' by Jamieson and Talwalkar, 2016. 'max_samples' distinct configs are drawn
+            at random and run with the smallest size. Only the best 1/'halving_factor' of them are
+            run again on a 'halving_factor' times larger size, until the last round runs the
+            remaining configs on the full size with all trials, of which only significant wins are
+            accepted. Configs that do not compile drop out
+            of the first round, so most of the time is spent on the compilation of candidates and
+            not on long runs of bad ones.
+            '''
+            rng = random.Random()
+            candidates = {}
+            # the space may be smaller than the number of samples
+            for _ in range(max_samples * 10):
+                if len(candidates) >= max_samples:
+                    break
+                xs = [rng.random() for _ in alg_space['params']]
+                candidates.setdefault(result_id_from_normalized(xs), xs)
+            candidates = [xs for xs in candidates.values() if build(xs) is not None]
+
+            rounds = max(1, math.ceil(math.log(max(len(candidates), 1), halving_factor)))
+            for round_index in range(rounds):
+                last_round = round_index == rounds - 1
+                round_size = max(size // halving_factor ** (rounds - 1 - round_index), min_halving_size)
+                # only the results of the last round can end up in the tuning result
+                round_dir = candidate_dir if last_round else halving_dir
+                round_trials = trials if last_round else 1
+                log.info(f'[{worker_id}] Round {round_index}: {len(candidates)} configs with size {round_size}')
+
+                results = [
+                    (run(os.path.join(bin_dir, f'{build_target}_{result_id_from_normalized(xs)}'),
+                         xs, round_size, round_trials, round_dir), xs)
+                    for xs in candidates
+                ]
+                results.sort(key=lambda result: result[0], reverse=True)
+                if last_round:
+                    for (value, xs) in results:
+                        if value > 0.0:
+                            accept(xs, candidate_dir)
+                keep = max(1, math.ceil(len(results) / halving_factor))
+                candidates = [xs for (value, xs) in results[:keep] if value > 0.0]
+                if not candidates:
+                    log.warning(f'[{worker_id}] No config of {type} completed round {round_index}')
+                    return
+
+        if strategy == 'halving':
+            successive_halving()
+            return
+
         # Dual annealing is very good for tuning. See:
         # - 'Benchmarking optimization algorithms for auto-tuning GPU kernels' by Schoonhoven et al, 2022.
         # - 'A methodology for comparing optimization algorithms for auto-tuning' by Willemsen et al, 2024.
@@ -309,8 +476,14 @@ def tune_alg(alg_name: str, arch: str, max_samples: int, num_workers: int, size:
     script_dir = os.path.dirname(os.path.realpath(__file__))
     source_dir = os.path.join(script_dir, '../..')
     result_dir = os.path.join(script_dir, 'artifacts')
+    bin_dir = os.path.join(result_dir, 'bin')
+    halving_dir = os.path.join(result_dir, 'halving')
+    candidate_dir = os.path.join(result_dir, 'candidates')
 
     os.makedirs(result_dir, exist_ok=True)
+    os.makedirs(bin_dir, exist_ok=True)
+    os.makedirs(halving_dir, exist_ok=True)
+    os.makedirs(candidate_dir, exist_ok=True)
 
     def pool_init(worker_ids, lock):
         global worker_id, gpu_lock
@@ -349,7 +522,15 @@ parser.add_argument('-n', '--evals', default=200, help='maximum number of config
 parser.add_argument('-v', '--verbose', action='store_true', help='verbose output')
 parser.add_argument('-w', '--workers', default=8, help='number of workers')
 parser.add_argument('-s', '--size', default=33554432, help='input size to use for tuning')
-parser.add_argument('-t', '--trials', default=3, help='number of trials per config to test')
+parser.add_argument('-t', '--trials', default=10, help='number of trials per config to test, which give the confidence interval of its result')
+parser.add_argument('-d', '--distribution', default='uniform', help='distribution of the input keys of sort, select, histogram and run-length encode benchmarks, e.g. zipf:1.2')
+parser.add_argument('-g', '--segment-distribution', default='all', help='segment length distribution(s) of segmented benchmarks, e.g. power_law:1.5,many_empty; "all" tunes for all of them')
+parser.add_argument('-S', '--strategy', default='annealing', choices=['annealing', 'halving'], help='search strategy: dual annealing over the full size, or successive halving which prunes configs with short runs on reduced sizes')
+parser.add_argument('--halving-factor', default=3, help='successive halving keeps the best 1/factor configs per round and multiplies the size by factor')
+parser.add_argument('--min-halving-size', default=1048576, help='smallest input size of successive halving')
+parser.add_argument('-o', '--objective', default='throughput', choices=['throughput', 'energy'], help='optimize the throughput, or the items per joule, which builds the benchmarks with BENCHMARK_ENERGY (needs rocm_smi)')
+parser.add_argument('-p', '--power-cap', metavar='WATTS', help='reject configs whose average power is above WATTS, which builds the benchmarks with BENCHMARK_ENERGY (needs rocm_smi)')
+parser.add_argument('-e', '--emit', metavar='DIR', help='write the tuned configs to DIR (e.g. rocprim/include/rocprim/device/detail/config) with scripts/autotune/create_optimization.py')
 parser.add_argument('-c', '--combine', action='store_true', help='skip tuning and combine the results of a previous run for the given targets and architecture')
 parser.add_argument('-l', '--list', action='store_true', help='list available targets')
 
@@ -373,6 +554,8 @@ log = logging.getLogger('rich')
 if args.combine:
     for target in args.targets:
         combine(alg_name=target, arch=args.arch)
+        if args.emit:
+            emit(alg_name=target, arch=args.arch, out_basedir=args.emit)
     quit()
 
 for target in args.targets:
@@ -383,5 +566,14 @@ for target in args.targets:
         max_samples=int(args.evals),
         num_workers=int(args.workers),
         size=int(args.size),
-        trials=int(args.trials)
+        trials=int(args.trials),
+        distribution=args.distribution,
+        segment_distribution=args.segment_distribution,
+        strategy=args.strategy,
+        halving_factor=int(args.halving_factor),
+        min_halving_size=int(args.min_halving_size),
+        objective=args.objective,
+        power_cap=float(args.power_cap) if args.power_cap is not None else None,
     )
+    if args.emit:
+        emit(alg_name=target, arch=args.arch, out_basedir=args.emit)
@@ -0,0 +1,279 @@
+#!/usr/bin/env python3
+
+# MIT License
+#
+# Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Compares two runs of the rocPRIM benchmarks and reports the speedups and regressions.
+
+The inputs are the JSON outputs of Google Benchmark (--benchmark_out=<file>.json), for example of
+two ROCm versions, or of the tuned and the default configs. The benchmarks are matched by the
+fields of their names (--name_format json or txt), human names are matched as they are. Fields
+listed with --ignore, e.g. cfg, are left out of the match.
+
+The speedup of a benchmark is the ratio of the throughputs (bytes_per_second, or the inverse of
+the time without it) of the candidate and the baseline. It is significant when the 95% confidence
+intervals of the two results do not overlap. The intervals come from the ci95 counters of the
+benchmarks, or from the repetitions of --benchmark_repetitions. Benchmarks with a single
+measurement and no counters are significant when the change is larger than the threshold.
+The speedups are also summarized as geometric means per algorithm, per type and per size.
+
+The exit code is 1 when there are significant regressions beyond the threshold, so the script
+can gate an upgrade in CI.
+
+Example:
+    benchmark_compare.py baseline.json candidate.json
+    benchmark_compare.py --ignore cfg --threshold 0.03 default.json tuned.json
+"""
+
+import argparse
+import collections
+import json
+import math
+import re
+import sys
+
+ALGORITHM_FIELDS = ("lvl", "algo", "subalgo")
+SIZE_FIELDS = ("size", "bytes", "segments", "segment_count")
+
+# Two-sided 95% quantiles of Student's t distribution by degrees of freedom
+T_QUANTILES = {
+    1: 12.706, 2: 4.303, 3: 3.182, 4: 2.776, 5: 2.571, 6: 2.447, 7: 2.365, 8: 2.306, 9: 2.262,
+    10: 2.228, 11: 2.201, 12: 2.179, 13: 2.160, 14: 2.145, 15: 2.131, 16: 2.120, 17: 2.110,
+    18: 2.101, 19: 2.093, 20: 2.086, 21: 2.080, 22: 2.074, 23: 2.069, 24: 2.064, 25: 2.060,
+    26: 2.056, 27: 2.052, 28: 2.048, 29: 2.045, 30: 2.042,
+}
+
+
+def parse_name(name):
+    """Returns the fields of a benchmark name as a dict, or {"name": name} for human names."""
+    # Google Benchmark postfixes the names, e.g. with /manual_time
+    match = re.match(r"{.*}", name)
+    if match:
+        try:
+            return json.loads(match.group(0))
+        except json.JSONDecodeError:
+            fields = re.findall(r"(\w+):\s*((?:custom_type<[\w,]*>)|[\w:().<>\s]*)",
+                                match.group(0))
+            if fields:
+                return {key: value.strip() for key, value in fields}
+    return {"name": name.split("/")[0]}
+
+
+def flatten(fields, prefix=""):
+    """Flattens nested fields, e.g. the config of a benchmark, into dotted keys."""
+    result = {}
+    for key, value in fields.items():
+        if isinstance(value, dict):
+            result.update(flatten(value, f"{prefix}{key}."))
+        else:
+            result[prefix + key] = str(value)
+    return result
+
+
+def throughput(benchmark):
+    """Returns the throughput of a benchmark and the bounds of its 95% confidence interval."""
+    if "bytes_per_second" in benchmark:
+        result = float(benchmark["bytes_per_second"])
+    else:
+        result = 1.0 / float(benchmark["real_time"]) if float(benchmark["real_time"]) > 0 else 0.0
+    if result <= 0.0 or not all(key in benchmark for key in
+                                ("mean_ms", "ci95_low_ms", "ci95_high_ms")):
+        return result, None, None
+    # The throughput is inversely proportional to the mean iteration time
+    mean = float(benchmark["mean_ms"])
+    ci_low = float(benchmark["ci95_low_ms"])
+    low = result * mean / float(benchmark["ci95_high_ms"])
+    high = result * mean / ci_low if ci_low > 0.0 else math.inf
+    return result, low, high
+
+
+class Result:
+    """The measurements of one benchmark in one run."""
+
+    def __init__(self, fields):
+        self.fields = fields
+        self.values = []
+        self.intervals = []
+
+    def add(self, benchmark):
+        value, low, high = throughput(benchmark)
+        self.values.append(value)
+        if low is not None:
+            self.intervals.append((low, high))
+
+    @property
+    def value(self):
+        return sum(self.values) / len(self.values)
+
+    def interval(self):
+        """The 95% confidence interval of the throughput, or None when it is unknown."""
+        count = len(self.values)
+        if count > 1:
+            mean = self.value
+            stddev = math.sqrt(sum((v - mean) ** 2 for v in self.values) / (count - 1))
+            half_width = T_QUANTILES.get(count - 1, 1.96) * stddev / math.sqrt(count)
+            return mean - half_width, mean + half_width
+        if self.intervals:
+            return self.intervals[0]
+        return None
+
+
+def load_run(filename, ignored_fields):
+    """Returns the context of a run and its results keyed by the matched fields."""
+    with open(filename, "r") as file:
+        data = json.load(file)
+    context = data.get("context", {})
+    results = {}
+    for benchmark in data.get("benchmarks", []):
+        # Skip the aggregates of repetitions (mean, median, stddev), the repetitions are used
+        if benchmark.get("run_type") == "aggregate" or benchmark.get("error_occurred"):
+            continue
+        fields = flatten(parse_name(benchmark["name"]))
+        if "size" not in fields and "bytes" in context:
+            fields["bytes"] = str(context["bytes"])
+        key = tuple(sorted((k, v) for k, v in fields.items()
+                           if k.split(".")[0] not in ignored_fields))
+        results.setdefault(key, Result(fields)).add(benchmark)
+    return context, results
+
+
+def algorithm_of(fields):
+    if "name" in fields:
+        return fields["name"].split("<")[0]
+    return "_".join(fields[key] for key in ALGORITHM_FIELDS if key in fields)
+
+
+def type_of(fields):
+    types = [f"{key}:{value}" for key, value in sorted(fields.items()) if key.endswith("type")]
+    return ",".join(types) if types else "-"
+
+
+def size_of(fields):
+    sizes = [f"{key}:{fields[key]}" for key in SIZE_FIELDS if key in fields]
+    return ",".join(sizes) if sizes else "-"
+
+
+def compare(baseline, candidate, threshold):
+    """Returns one comparison per benchmark found in both runs."""
+    comparisons = []
+    for key in sorted(baseline.keys() & candidate.keys()):
+        base, cand = baseline[key], candidate[key]
+        speedup = cand.value / base.value if base.value > 0.0 else math.inf
+        base_interval, cand_interval = base.interval(), cand.interval()
+        if base_interval is not None and cand_interval is not None:
+            significant = cand_interval[0] > base_interval[1] or cand_interval[1] < base_interval[0]
+        else:
+            significant = abs(speedup - 1.0) > threshold
+        comparisons.append({
+            "benchmark": ",".join(f"{k}:{v}" for k, v in key),
+            "algorithm": algorithm_of(base.fields),
+            "type": type_of(base.fields),
+            "size": size_of(base.fields),
+            "baseline": base.value,
+            "candidate": cand.value,
+            "speedup": speedup,
+            "significant": significant,
+            "regression": significant and speedup < 1.0 - threshold,
+        })
+    return comparisons
+
+
+def geometric_mean(values):
+    values = [value for value in values if 0.0 < value < math.inf]
+    if not values:
+        return math.nan
+    return math.exp(sum(math.log(value) for value in values) / len(values))
+
+
+def summarize(comparisons, group):
+    speedups = collections.defaultdict(list)
+    for comparison in comparisons:
+        speedups[comparison[group]].append(comparison["speedup"])
+    return {name: geometric_mean(values) for name, values in sorted(speedups.items())}
+
+
+def print_report(comparisons, summaries, unmatched, regressions_only):
+    print(f"{'speedup':>9}  {'sig':>3}  benchmark")
+    for comparison in comparisons:
+        if regressions_only and not comparison["regression"]:
+            continue
+        flag = "REGRESSION" if comparison["regression"] else ""
+        print(f"{comparison['speedup']:>9.3f}  {'yes' if comparison['significant'] else 'no':>3}"
+              f"  {comparison['benchmark']}  {flag}".rstrip())
+    for group, summary in summaries.items():
+        print(f"\nGeometric mean speedup per {group}:")
+        for name, speedup in summary.items():
+            print(f"{speedup:>9.3f}  {name}")
+    for run, keys in unmatched.items():
+        if keys:
+            print(f"\n{len(keys)} benchmarks only in the {run} run", file=sys.stderr)
+    regressions = sum(1 for comparison in comparisons if comparison["regression"])
+    print(f"\n{len(comparisons)} benchmarks compared, {regressions} significant regressions, "
+          f"overall speedup {geometric_mean([c['speedup'] for c in comparisons]):.3f}")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compares the throughput of two rocPRIM benchmark runs and flags regressions.")
+    parser.add_argument("baseline", help="Google Benchmark JSON output of the baseline")
+    parser.add_argument("candidate", help="Google Benchmark JSON output of the candidate")
+    parser.add_argument(
+        "--ignore",
+        action="append",
+        default=[],
+        help="name field left out of the match, e.g. cfg to compare different configs, "
+        "can be repeated")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.05,
+        help="relative slowdown of a significant regression (default: 0.05)")
+    parser.add_argument("--regressions-only", action="store_true",
+                        help="only list the regressed benchmarks")
+    parser.add_argument("--json", help="also write the comparison to this JSON file")
+    args = parser.parse_args()
+
+    baseline_context, baseline = load_run(args.baseline, args.ignore)
+    candidate_context, candidate = load_run(args.candidate, args.ignore)
+    for key in ("hdp_gcn_arch_name", "hdp_name"):
+        if key in baseline_context and baseline_context.get(key) != candidate_context.get(key):
+            print(f"WARNING: the runs differ in {key}: {baseline_context[key]} and "
+                  f"{candidate_context.get(key)}", file=sys.stderr)
+
+    comparisons = compare(baseline, candidate, args.threshold)
+    if not comparisons:
+        print("ERROR: no benchmarks are in both runs", file=sys.stderr)
+        return 2
+    summaries = {group: summarize(comparisons, group) for group in ("algorithm", "type", "size")}
+    unmatched = {"baseline": baseline.keys() - candidate.keys(),
+                 "candidate": candidate.keys() - baseline.keys()}
+    print_report(comparisons, summaries, unmatched, args.regressions_only)
+
+    if args.json:
+        with open(args.json, "w") as file:
+            json.dump({"benchmarks": comparisons, "summary": summaries}, file, indent=2)
+
+    return 1 if any(comparison["regression"] for comparison in comparisons) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
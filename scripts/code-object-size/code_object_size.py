@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+
+# MIT License
+#
+# Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Reports the size of the device code of rocPRIM kernels in executables and libraries.
+
+The code objects of every offload architecture are extracted with roc-obj, the sizes of their
+kernels are read with llvm-nm and summed per kernel name, e.g. radix_sort_onesweep_kernel, which
+identifies the algorithm. Kernels outside of rocPRIM are reported as "(other)".
+
+Example:
+    code_object_size.py build/test/rocprim/test_device_radix_sort
+    code_object_size.py --json sizes.json libmy_service.so
+"""
+
+import argparse
+import collections
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+KERNEL_NAME = re.compile(r"^rocprim::(?:\w+::)*(\w+)[<(]")
+TARGET_NAME = re.compile(r"gfx[0-9a-f]+")
+
+
+def kernel_group(symbol):
+    """Returns the name of the rocPRIM kernel without namespaces and template arguments."""
+    match = KERNEL_NAME.match(symbol)
+    return match.group(1) if match else "(other)"
+
+
+def parse_nm(output):
+    """Sums the sizes of the function symbols of llvm-nm --print-size output by kernel name."""
+    sizes = collections.Counter()
+    counts = collections.Counter()
+    for line in output.splitlines():
+        fields = line.split(None, 3)
+        if len(fields) != 4 or fields[2] not in ("T", "t"):
+            continue
+        group = kernel_group(fields[3])
+        sizes[group] += int(fields[1], 16)
+        counts[group] += 1
+    return sizes, counts
+
+
+def extract_code_objects(binary, output_dir, rocm_path):
+    roc_obj = os.path.join(rocm_path, "bin", "roc-obj")
+    subprocess.run([roc_obj, "-o", output_dir, binary], check=True, stdout=subprocess.DEVNULL)
+    return sorted(
+        os.path.join(output_dir, name)
+        for name in os.listdir(output_dir)
+        if TARGET_NAME.search(name))
+
+
+def code_object_sizes(binary, rocm_path):
+    """Returns {target: {kernel: (bytes, instantiations)}} of the code objects of binary."""
+    llvm_nm = os.path.join(rocm_path, "llvm", "bin", "llvm-nm")
+    result = {}
+    with tempfile.TemporaryDirectory() as output_dir:
+        for code_object in extract_code_objects(binary, output_dir, rocm_path):
+            target = TARGET_NAME.search(os.path.basename(code_object)).group(0)
+            nm = subprocess.run(
+                [llvm_nm, "--print-size", "--demangle", "--defined-only", code_object],
+                check=True,
+                capture_output=True,
+                text=True)
+            sizes, counts = parse_nm(nm.stdout)
+            kernels = result.setdefault(target, {})
+            for group, size in sizes.items():
+                previous_size, previous_count = kernels.get(group, (0, 0))
+                kernels[group] = (previous_size + size, previous_count + counts[group])
+    return result
+
+
+def print_report(binary, sizes):
+    print(binary)
+    for target in sorted(sizes):
+        kernels = sizes[target]
+        total = sum(size for size, _ in kernels.values())
+        print(f"  {target}: {total} bytes")
+        for group, (size, count) in sorted(kernels.items(), key=lambda item: -item[1][0]):
+            print(f"    {size:>12} {count:>6}  {group}")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Reports the device code size of rocPRIM kernels per architecture.")
+    parser.add_argument("binaries", nargs="+", help="executables or shared libraries")
+    parser.add_argument(
+        "--rocm-path",
+        default=os.environ.get("ROCM_PATH", "/opt/rocm"),
+        help="ROCm installation with roc-obj and llvm-nm (default: $ROCM_PATH or /opt/rocm)")
+    parser.add_argument("--json", help="also write the sizes to this JSON file")
+    args = parser.parse_args()
+
+    report = {}
+    for binary in args.binaries:
+        sizes = code_object_sizes(binary, args.rocm_path)
+        if not sizes:
+            print(f"{binary}: no code objects found", file=sys.stderr)
+        print_report(binary, sizes)
+        report[binary] = {
+            target: {group: {"bytes": size, "kernels": count}
+                     for group, (size, count) in kernels.items()}
+            for target, kernels in sizes.items()
+        }
+
+    if args.json:
+        with open(args.json, "w") as file:
+            json.dump(report, file, indent=2)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,188 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_find_first_of.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_select.hpp>
+#include <rocprim/types/async_result.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+TEST(RocprimAsyncResultTests, Lifetime)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    rocprim::async_result<int> first;
+    ASSERT_EQ(first.output(), nullptr);
+    HIP_CHECK(first.allocate());
+    ASSERT_NE(first.output(), nullptr);
+
+    int* const output = first.output();
+    rocprim::async_result<int> second(std::move(first));
+    ASSERT_EQ(first.output(), nullptr);
+    ASSERT_EQ(second.output(), output);
+
+    HIP_CHECK(second.release());
+    ASSERT_EQ(second.output(), nullptr);
+    // Releasing twice is allowed
+    HIP_CHECK(second.release());
+}
+
+TEST(RocprimAsyncResultTests, Algorithms)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    rocprim::async_result<T>            sum;
+    rocprim::async_result<unsigned int> selected_count;
+    rocprim::async_result<size_t>       first_index;
+    HIP_CHECK(sum.allocate());
+    HIP_CHECK(selected_count.allocate());
+    HIP_CHECK(first_index.allocate());
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+            const std::vector<T> keys  = {97, 98, 99};
+
+            const auto is_even = [](const T value) { return value % 2 == 0; };
+            const T    expected_sum = std::accumulate(input.begin(), input.end(), T(0));
+            const auto expected_selected_count
+                = static_cast<unsigned int>(std::count_if(input.begin(), input.end(), is_even));
+            const auto expected_first_index = static_cast<size_t>(
+                std::find_first_of(input.begin(), input.end(), keys.begin(), keys.end())
+                - input.begin());
+
+            T* d_input;
+            T* d_keys;
+            T* d_selected;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, keys.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(
+                hipMemcpy(d_keys, keys.data(), keys.size() * sizeof(T), hipMemcpyHostToDevice));
+
+            const auto reduce = [&](void* storage, size_t& storage_size)
+            {
+                return rocprim::reduce(storage,
+                                       storage_size,
+                                       d_input,
+                                       sum.output(),
+                                       T(0),
+                                       size,
+                                       rocprim::plus<T>(),
+                                       stream);
+            };
+            const auto select = [&](void* storage, size_t& storage_size)
+            {
+                return rocprim::select(storage,
+                                       storage_size,
+                                       d_input,
+                                       d_selected,
+                                       selected_count.output(),
+                                       size,
+                                       [] __device__(const T value) { return value % 2 == 0; },
+                                       stream);
+            };
+            const auto find_first_of = [&](void* storage, size_t& storage_size)
+            {
+                return rocprim::find_first_of(storage,
+                                              storage_size,
+                                              d_input,
+                                              d_keys,
+                                              first_index.output(),
+                                              size,
+                                              keys.size(),
+                                              rocprim::equal_to<T>(),
+                                              stream);
+            };
+
+            size_t reduce_bytes;
+            size_t select_bytes;
+            size_t find_first_of_bytes;
+            HIP_CHECK(reduce(nullptr, reduce_bytes));
+            HIP_CHECK(select(nullptr, select_bytes));
+            HIP_CHECK(find_first_of(nullptr, find_first_of_bytes));
+            const size_t storage_bytes
+                = std::max({reduce_bytes, select_bytes, find_first_of_bytes, size_t(1)});
+
+            void* d_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_bytes));
+
+            HIP_CHECK(reduce(d_storage, reduce_bytes));
+            HIP_CHECK(sum.record(stream));
+            HIP_CHECK(select(d_storage, select_bytes));
+            HIP_CHECK(selected_count.record(stream));
+            HIP_CHECK(find_first_of(d_storage, find_first_of_bytes));
+            HIP_CHECK(first_index.record(stream));
+
+            // The results are read without copies once their events are complete
+            HIP_CHECK(sum.wait());
+            ASSERT_EQ(sum.get(), expected_sum);
+            HIP_CHECK(selected_count.wait());
+            ASSERT_EQ(selected_count.get(), expected_selected_count);
+            while(first_index.poll() == hipErrorNotReady)
+            {}
+            HIP_CHECK(first_index.poll());
+            ASSERT_EQ(first_index.get(), expected_first_index);
+
+            HIP_CHECK(hipFree(d_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_selected));
+        }
+    }
+
+    HIP_CHECK(hipStreamDestroy(stream));
+}
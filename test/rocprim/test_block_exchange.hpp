@@ -77,3 +77,18 @@ typed_test_def(suite_name, name_suffix, ScatterToStriped)
 
     static_for<0, 4, type, output_type, 5, block_size>::run();
 }
+
+typed_test_def(suite_name, name_suffix, XorSwizzle)
+{
+    using type = typename TestFixture::params::input_type;
+    using output_type = typename TestFixture::params::output_type;
+    constexpr size_t block_size = TestFixture::params::block_size;
+    constexpr auto   swizzle    = rocprim::block_padding_hint::xor_swizzle;
+
+    static_for<0, 4, type, output_type, 0, block_size, swizzle>::run();
+    static_for<0, 4, type, output_type, 1, block_size, swizzle>::run();
+    static_for<0, 4, type, output_type, 2, block_size, swizzle>::run();
+    static_for<0, 4, type, output_type, 3, block_size, swizzle>::run();
+    static_for<0, 4, type, output_type, 4, block_size, swizzle>::run();
+    static_for<0, 4, type, output_type, 5, block_size, swizzle>::run();
+}
@@ -27,7 +27,8 @@ template<
     class Type,
     class OutputType,
     unsigned int ItemsPerBlock,
-    unsigned int ItemsPerThread
+    unsigned int ItemsPerThread,
+    rocprim::block_padding_hint PaddingHint
 >
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
@@ -41,7 +42,7 @@ void blocked_to_striped_kernel(Type* device_input, OutputType* device_output)
     OutputType output[ItemsPerThread];
     rocprim::block_load_direct_blocked(lid, device_input + block_offset, input);
 
-    rocprim::block_exchange<Type, block_size, ItemsPerThread> exchange;
+    rocprim::block_exchange<Type, block_size, ItemsPerThread, 1, 1, PaddingHint> exchange;
     exchange.blocked_to_striped(input, output);
 
     rocprim::block_store_direct_blocked(lid, device_output + block_offset, output);
@@ -51,7 +52,8 @@ template<
     class Type,
     class OutputType,
     unsigned int ItemsPerBlock,
-    unsigned int ItemsPerThread
+    unsigned int ItemsPerThread,
+    rocprim::block_padding_hint PaddingHint
 >
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
@@ -65,7 +67,7 @@ void striped_to_blocked_kernel(Type* device_input, OutputType* device_output)
     OutputType output[ItemsPerThread];
     rocprim::block_load_direct_blocked(lid, device_input + block_offset, input);
 
-    rocprim::block_exchange<Type, block_size, ItemsPerThread> exchange;
+    rocprim::block_exchange<Type, block_size, ItemsPerThread, 1, 1, PaddingHint> exchange;
     exchange.striped_to_blocked(input, output);
 
     rocprim::block_store_direct_blocked(lid, device_output + block_offset, output);
@@ -75,7 +77,8 @@ template<
     class Type,
     class OutputType,
     unsigned int ItemsPerBlock,
-    unsigned int ItemsPerThread
+    unsigned int ItemsPerThread,
+    rocprim::block_padding_hint PaddingHint
 >
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
@@ -89,7 +92,7 @@ void blocked_to_warp_striped_kernel(Type* device_input, OutputType* device_outpu
     OutputType output[ItemsPerThread];
     rocprim::block_load_direct_blocked(lid, device_input + block_offset, input);
 
-    rocprim::block_exchange<Type, block_size, ItemsPerThread> exchange;
+    rocprim::block_exchange<Type, block_size, ItemsPerThread, 1, 1, PaddingHint> exchange;
     exchange.blocked_to_warp_striped(input, output);
 
     rocprim::block_store_direct_blocked(lid, device_output + block_offset, output);
@@ -99,7 +102,8 @@ template<
     class Type,
     class OutputType,
     unsigned int ItemsPerBlock,
-    unsigned int ItemsPerThread
+    unsigned int ItemsPerThread,
+    rocprim::block_padding_hint PaddingHint
 >
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
@@ -113,7 +117,7 @@ void warp_striped_to_blocked_kernel(Type* device_input, OutputType* device_outpu
     OutputType output[ItemsPerThread];
     rocprim::block_load_direct_blocked(lid, device_input + block_offset, input);
 
-    rocprim::block_exchange<Type, block_size, ItemsPerThread> exchange;
+    rocprim::block_exchange<Type, block_size, ItemsPerThread, 1, 1, PaddingHint> exchange;
     exchange.warp_striped_to_blocked(input, output);
 
     rocprim::block_store_direct_blocked(lid, device_output + block_offset, output);
@@ -123,7 +127,8 @@ template<
     class Type,
     class OutputType,
     unsigned int ItemsPerBlock,
-    unsigned int ItemsPerThread
+    unsigned int ItemsPerThread,
+    rocprim::block_padding_hint PaddingHint
 >
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
@@ -139,7 +144,7 @@ void scatter_to_blocked_kernel(Type* device_input, OutputType* device_output, un
     rocprim::block_load_direct_blocked(lid, device_input + block_offset, input);
     rocprim::block_load_direct_blocked(lid, device_ranks + block_offset, ranks);
 
-    rocprim::block_exchange<Type, block_size, ItemsPerThread> exchange;
+    rocprim::block_exchange<Type, block_size, ItemsPerThread, 1, 1, PaddingHint> exchange;
     exchange.scatter_to_blocked(input, output, ranks);
 
     rocprim::block_store_direct_blocked(lid, device_output + block_offset, output);
@@ -149,7 +154,8 @@ template<
     class Type,
     class OutputType,
     unsigned int ItemsPerBlock,
-    unsigned int ItemsPerThread
+    unsigned int ItemsPerThread,
+    rocprim::block_padding_hint PaddingHint
 >
 __global__
 __launch_bounds__(ROCPRIM_DEFAULT_MAX_BLOCK_SIZE)
@@ -165,7 +171,7 @@ void scatter_to_striped_kernel(Type* device_input, OutputType* device_output, un
     rocprim::block_load_direct_blocked(lid, device_input + block_offset, input);
     rocprim::block_load_direct_blocked(lid, device_ranks + block_offset, ranks);
 
-    rocprim::block_exchange<Type, block_size, ItemsPerThread> exchange;
+    rocprim::block_exchange<Type, block_size, ItemsPerThread, 1, 1, PaddingHint> exchange;
     exchange.scatter_to_striped(input, output, ranks);
 
     rocprim::block_store_direct_blocked(lid, device_output + block_offset, output);
@@ -176,7 +182,8 @@ template<class T,
          class U,
          int          Method,
          unsigned int BlockSize      = 256U,
-         unsigned int ItemsPerThread = 1U>
+         unsigned int ItemsPerThread = 1U,
+         rocprim::block_padding_hint PaddingHint = rocprim::block_padding_hint::avoid_conflicts>
 auto test_block_exchange(int /*device_id*/) -> typename std::enable_if<Method == 0>::type
 {
     using type = T;
@@ -239,7 +246,7 @@ auto test_block_exchange(int /*device_id*/) -> typename std::enable_if<Method ==
     // Running kernel
     constexpr unsigned int grid_size = (size / items_per_block);
     hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(blocked_to_striped_kernel<type, output_type, items_per_block, items_per_thread>),
+        HIP_KERNEL_NAME(blocked_to_striped_kernel<type, output_type, items_per_block, items_per_thread, PaddingHint>),
         dim3(grid_size), dim3(block_size), 0, 0,
         device_input, device_output
     );
@@ -265,7 +272,8 @@ template<class T,
          class U,
          int          Method,
          unsigned int BlockSize      = 256U,
-         unsigned int ItemsPerThread = 1U>
+         unsigned int ItemsPerThread = 1U,
+         rocprim::block_padding_hint PaddingHint = rocprim::block_padding_hint::avoid_conflicts>
 auto test_block_exchange(int /*device_id*/) -> typename std::enable_if<Method == 1>::type
 {
     using type = T;
@@ -328,7 +336,7 @@ auto test_block_exchange(int /*device_id*/) -> typename std::enable_if<Method ==
     // Running kernel
     constexpr unsigned int grid_size = (size / items_per_block);
     hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(striped_to_blocked_kernel<type, output_type, items_per_block, items_per_thread>),
+        HIP_KERNEL_NAME(striped_to_blocked_kernel<type, output_type, items_per_block, items_per_thread, PaddingHint>),
         dim3(grid_size), dim3(block_size), 0, 0,
         device_input, device_output
     );
@@ -354,7 +362,8 @@ template<class T,
          class U,
          int          Method,
          unsigned int BlockSize      = 256U,
-         unsigned int ItemsPerThread = 1U>
+         unsigned int ItemsPerThread = 1U,
+         rocprim::block_padding_hint PaddingHint = rocprim::block_padding_hint::avoid_conflicts>
 auto test_block_exchange(int device_id) -> typename std::enable_if<Method == 2>::type
 {
     using type = T;
@@ -431,7 +440,7 @@ auto test_block_exchange(int device_id) -> typename std::enable_if<Method == 2>:
     constexpr unsigned int grid_size = (size / items_per_block);
     hipLaunchKernelGGL(
         HIP_KERNEL_NAME(blocked_to_warp_striped_kernel<
-                type, output_type, items_per_block, items_per_thread
+                type, output_type, items_per_block, items_per_thread, PaddingHint
         >),
         dim3(grid_size), dim3(block_size), 0, 0,
         device_input, device_output
@@ -458,7 +467,8 @@ template<class T,
          class U,
          int          Method,
          unsigned int BlockSize      = 256U,
-         unsigned int ItemsPerThread = 1U>
+         unsigned int ItemsPerThread = 1U,
+         rocprim::block_padding_hint PaddingHint = rocprim::block_padding_hint::avoid_conflicts>
 auto test_block_exchange(int device_id) -> typename std::enable_if<Method == 3>::type
 {
     using type = T;
@@ -534,7 +544,7 @@ auto test_block_exchange(int device_id) -> typename std::enable_if<Method == 3>:
     // Running kernel
     constexpr unsigned int grid_size = (size / items_per_block);
     hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(warp_striped_to_blocked_kernel<type, output_type, items_per_block, items_per_thread>),
+        HIP_KERNEL_NAME(warp_striped_to_blocked_kernel<type, output_type, items_per_block, items_per_thread, PaddingHint>),
         dim3(grid_size), dim3(block_size), 0, 0,
         device_input, device_output
     );
@@ -560,7 +570,8 @@ template<class T,
          class U,
          int          Method,
          unsigned int BlockSize      = 256U,
-         unsigned int ItemsPerThread = 1U>
+         unsigned int ItemsPerThread = 1U,
+         rocprim::block_padding_hint PaddingHint = rocprim::block_padding_hint::avoid_conflicts>
 auto test_block_exchange(int /*device_id*/) -> typename std::enable_if<Method == 4>::type
 {
     using type = T;
@@ -641,7 +652,7 @@ auto test_block_exchange(int /*device_id*/) -> typename std::enable_if<Method ==
     // Running kernel
     constexpr unsigned int grid_size = (size / items_per_block);
     hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(scatter_to_blocked_kernel<type, output_type, items_per_block, items_per_thread>),
+        HIP_KERNEL_NAME(scatter_to_blocked_kernel<type, output_type, items_per_block, items_per_thread, PaddingHint>),
         dim3(grid_size), dim3(block_size), 0, 0,
         device_input, device_output, device_ranks
     );
@@ -668,7 +679,8 @@ template<class T,
          class U,
          int          Method,
          unsigned int BlockSize      = 256U,
-         unsigned int ItemsPerThread = 1U>
+         unsigned int ItemsPerThread = 1U,
+         rocprim::block_padding_hint PaddingHint = rocprim::block_padding_hint::avoid_conflicts>
 auto test_block_exchange(int /*device_id*/) -> typename std::enable_if<Method == 5>::type
 {
     using type = T;
@@ -751,7 +763,7 @@ auto test_block_exchange(int /*device_id*/) -> typename std::enable_if<Method ==
     // Running kernel
     constexpr unsigned int grid_size = (size / items_per_block);
     hipLaunchKernelGGL(
-        HIP_KERNEL_NAME(scatter_to_striped_kernel<type, output_type, items_per_block, items_per_thread>),
+        HIP_KERNEL_NAME(scatter_to_striped_kernel<type, output_type, items_per_block, items_per_thread, PaddingHint>),
         dim3(grid_size), dim3(block_size), 0, 0,
         device_input, device_output, device_ranks
     );
@@ -780,7 +792,8 @@ template<unsigned int First,
          class T,
          class U,
          int          Method,
-         unsigned int BlockSize = 256U>
+         unsigned int BlockSize = 256U,
+         rocprim::block_padding_hint PaddingHint = rocprim::block_padding_hint::avoid_conflicts>
 struct static_for
 {
     static void run()
@@ -791,14 +804,19 @@ struct static_for
             SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
             HIP_CHECK(hipSetDevice(device_id));
 
-            test_block_exchange<T, U, Method, BlockSize, items[First]>(device_id);
+            test_block_exchange<T, U, Method, BlockSize, items[First], PaddingHint>(device_id);
         }
-        static_for<First + 1, Last, T, U, Method, BlockSize>::run();
+        static_for<First + 1, Last, T, U, Method, BlockSize, PaddingHint>::run();
     }
 };
 
-template<unsigned int N, class T, class U, int Method, unsigned int BlockSize>
-struct static_for<N, N, T, U, Method, BlockSize>
+template<unsigned int                N,
+         class                       T,
+         class                       U,
+         int                         Method,
+         unsigned int                BlockSize,
+         rocprim::block_padding_hint PaddingHint>
+struct static_for<N, N, T, U, Method, BlockSize, PaddingHint>
 {
     static void run() {}
 };
@@ -33,6 +33,10 @@
 // kernel definitions
 #include "test_block_load_store.kernels.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 template<class Params>
 class RocprimVectorizationTests : public ::testing::Test {
 public:
@@ -60,6 +64,245 @@ TYPED_TEST(RocprimVectorizationTests, MatchVectorType)
     ASSERT_TRUE(input);
 }
 
+template<class Params>
+class RocprimBlockLoadStoreVectorizedTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+TYPED_TEST_SUITE(RocprimBlockLoadStoreVectorizedTests, VectorizedParams);
+
+// The items are loaded and stored at every offset from a 16-byte boundary that the alignment of
+// the type allows, and the bytes around the stored items must not be written.
+template<class Type, unsigned int BlockSize, unsigned int ItemsPerThread, bool NonTemporal>
+void test_load_store_vectorized()
+{
+    constexpr size_t  items_per_block = BlockSize * ItemsPerThread;
+    constexpr size_t  grid_size       = 37;
+    constexpr size_t  bytes           = items_per_block * grid_size * sizeof(Type);
+    constexpr size_t  padding         = 16;
+    constexpr uint8_t untouched       = 0xAB;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const std::vector<uint8_t> input
+            = test_utils::get_random_data<uint8_t>(bytes + 2 * padding, 0, 255, seed_value);
+
+        uint8_t* device_input;
+        uint8_t* device_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_input, input.size()));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_output, input.size()));
+        HIP_CHECK(hipMemcpy(device_input, input.data(), input.size(), hipMemcpyHostToDevice));
+
+        for(size_t misalignment = 0; misalignment < padding; misalignment += alignof(Type))
+        {
+            SCOPED_TRACE(testing::Message() << "with misalignment = " << misalignment);
+
+            HIP_CHECK(hipMemset(device_output, untouched, input.size()));
+
+            load_store_vectorized_kernel<Type, BlockSize, ItemsPerThread, NonTemporal>
+                <<<dim3(grid_size), dim3(BlockSize), 0, 0>>>(
+                    reinterpret_cast<Type*>(device_input + misalignment),
+                    reinterpret_cast<Type*>(device_output + misalignment));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<uint8_t> output(input.size());
+            HIP_CHECK(
+                hipMemcpy(output.data(), device_output, output.size(), hipMemcpyDeviceToHost));
+
+            std::vector<uint8_t> expected(input.size(), untouched);
+            std::copy(input.begin() + misalignment,
+                      input.begin() + misalignment + bytes,
+                      expected.begin() + misalignment);
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+        }
+
+        HIP_CHECK(hipFree(device_input));
+        HIP_CHECK(hipFree(device_output));
+    }
+}
+
+TYPED_TEST(RocprimBlockLoadStoreVectorizedTests, LoadStoreVectorized)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using params = typename TestFixture::params;
+    test_load_store_vectorized<typename params::type,
+                               params::block_size,
+                               params::items_per_thread,
+                               false>();
+}
+
+TYPED_TEST(RocprimBlockLoadStoreVectorizedTests, LoadStoreNontemporal)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using params = typename TestFixture::params;
+    test_load_store_vectorized<typename params::type,
+                               params::block_size,
+                               params::items_per_thread,
+                               true>();
+}
+
+template<class Params>
+class RocprimBlockLoadStoreMaskedTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+TYPED_TEST_SUITE(RocprimBlockLoadStoreMaskedTests, MaskedParams);
+
+// The offset of item i of thread flat_id in the arrangement of the method.
+template<rocprim::block_load_method LoadMethod>
+size_t masked_item_offset(size_t block_size,
+                          size_t items_per_thread,
+                          size_t flat_id,
+                          size_t item)
+{
+    return LoadMethod == rocprim::block_load_method::block_load_striped
+               ? item * block_size + flat_id
+               : flat_id * items_per_thread + item;
+}
+
+// Only the selected items are loaded and stored, the unselected outputs keep their value.
+template<class Params, bool Flagged>
+void test_load_store_masked()
+{
+    using Type                              = typename Params::type;
+    constexpr auto         load_method      = Params::load_method;
+    constexpr auto         store_method     = Params::store_method;
+    constexpr unsigned int block_size       = Params::block_size;
+    constexpr unsigned int items_per_thread = Params::items_per_thread;
+    constexpr size_t       items_per_block  = block_size * items_per_thread;
+    constexpr size_t       grid_size        = 37;
+    constexpr size_t       size             = items_per_block * grid_size;
+    const Type             untouched        = Type(0);
+
+    if(block_size > test_utils::get_max_block_size())
+    {
+        return;
+    }
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const std::vector<Type> input = test_utils::get_random_data<Type>(size, 1, 100, seed_value);
+        const std::vector<unsigned int> bits
+            = test_utils::get_random_data<unsigned int>((size + 31) / 32,
+                                                        0,
+                                                        std::numeric_limits<unsigned int>::max(),
+                                                        seed_value);
+
+        std::vector<Type> expected(size, untouched);
+        for(size_t block = 0; block < grid_size; block++)
+        {
+            for(size_t flat_id = 0; flat_id < block_size; flat_id++)
+            {
+                const unsigned int mask
+                    = test_item_mask<items_per_thread>(block, flat_id, seed_value);
+                for(size_t item = 0; item < items_per_thread; item++)
+                {
+                    const size_t index
+                        = block * items_per_block
+                          + masked_item_offset<load_method>(block_size,
+                                                            items_per_thread,
+                                                            flat_id,
+                                                            item);
+                    const bool selected = Flagged ? (bits[index / 32] >> (index % 32)) & 1u
+                                                  : (mask >> item) & 1u;
+                    if(selected)
+                    {
+                        expected[index] = input[index];
+                    }
+                }
+            }
+        }
+
+        Type*         device_input;
+        Type*         device_output;
+        unsigned int* device_bits;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_input, size * sizeof(Type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_output, size * sizeof(Type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_bits,
+                                                     bits.size() * sizeof(unsigned int)));
+        HIP_CHECK(
+            hipMemcpy(device_input, input.data(), size * sizeof(Type), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(device_bits,
+                            bits.data(),
+                            bits.size() * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+        const std::vector<Type> output_init(size, untouched);
+        HIP_CHECK(hipMemcpy(device_output,
+                            output_init.data(),
+                            size * sizeof(Type),
+                            hipMemcpyHostToDevice));
+
+        if(Flagged)
+        {
+            load_store_flagged_kernel<Type,
+                                      load_method,
+                                      store_method,
+                                      block_size,
+                                      items_per_thread>
+                <<<dim3(grid_size), dim3(block_size), 0, 0>>>(device_input,
+                                                              device_output,
+                                                              device_bits);
+        }
+        else
+        {
+            load_store_masked_kernel<Type,
+                                     load_method,
+                                     store_method,
+                                     block_size,
+                                     items_per_thread>
+                <<<dim3(grid_size), dim3(block_size), 0, 0>>>(device_input,
+                                                              device_output,
+                                                              seed_value);
+        }
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<Type> output(size);
+        HIP_CHECK(
+            hipMemcpy(output.data(), device_output, size * sizeof(Type), hipMemcpyDeviceToHost));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+        HIP_CHECK(hipFree(device_input));
+        HIP_CHECK(hipFree(device_output));
+        HIP_CHECK(hipFree(device_bits));
+    }
+}
+
+TYPED_TEST(RocprimBlockLoadStoreMaskedTests, LoadStoreMasked)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    test_load_store_masked<typename TestFixture::params, false>();
+}
+
+TYPED_TEST(RocprimBlockLoadStoreMaskedTests, LoadStoreFlagged)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    test_load_store_masked<typename TestFixture::params, true>();
+}
+
 // Start stamping out tests
 struct RocprimBlockLoadStoreClassTests;
 
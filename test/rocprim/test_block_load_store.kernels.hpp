@@ -420,7 +420,34 @@ typedef ::testing::Types<
                  rocprim::block_load_method::block_load_warp_transpose,
                  rocprim::block_store_method::block_store_warp_transpose,
                  64U,
-                 4>
+                 4>,
+
+    // direct to lds
+    class_params<int,
+                 rocprim::block_load_method::block_load_direct_to_lds,
+                 rocprim::block_store_method::block_store_transpose,
+                 64U,
+                 4>,
+    class_params<int,
+                 rocprim::block_load_method::block_load_direct_to_lds,
+                 rocprim::block_store_method::block_store_transpose,
+                 256U,
+                 7>,
+    class_params<char,
+                 rocprim::block_load_method::block_load_direct_to_lds,
+                 rocprim::block_store_method::block_store_transpose,
+                 256U,
+                 4>,
+    class_params<double,
+                 rocprim::block_load_method::block_load_direct_to_lds,
+                 rocprim::block_store_method::block_store_transpose,
+                 128U,
+                 3>,
+    class_params<test_utils::custom_test_type<double>,
+                 rocprim::block_load_method::block_load_direct_to_lds,
+                 rocprim::block_store_method::block_store_transpose,
+                 256U,
+                 2>
 
     >
     ClassParamsThirdPart;
@@ -475,6 +502,56 @@ typedef ::testing::Types<vector_params<int, int, 3, false>,
                          vector_params<char4, int4, 16, true>>
     VectorParams;
 
+// A packed type of Size bytes that is only byte-aligned
+template<unsigned int Size>
+struct packed_bytes
+{
+    unsigned char bytes[Size];
+};
+
+template<class Type, unsigned int BlockSize, unsigned int ItemsPerThread>
+struct vectorized_params
+{
+    using type                                     = Type;
+    static constexpr unsigned int block_size       = BlockSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+typedef ::testing::Types<vectorized_params<int, 256, 4>,
+                         vectorized_params<int, 64, 3>,
+                         vectorized_params<rocprim::half, 128, 3>,
+                         vectorized_params<rocprim::half, 64, 8>,
+                         vectorized_params<uint8_t, 256, 2>,
+                         vectorized_params<uint8_t, 64, 7>,
+                         vectorized_params<double, 128, 2>,
+                         vectorized_params<packed_bytes<6>, 128, 1>,
+                         vectorized_params<packed_bytes<6>, 64, 2>,
+                         vectorized_params<packed_bytes<12>, 256, 4>,
+                         vectorized_params<test_utils::custom_test_type<int>, 64, 5>>
+    VectorizedParams;
+
+template<class Type, unsigned int BlockSize, unsigned int ItemsPerThread, bool NonTemporal>
+__global__ __launch_bounds__(BlockSize) void load_store_vectorized_kernel(Type* device_input,
+                                                                          Type* device_output)
+{
+    Type       items[ItemsPerThread];
+    const auto offset = blockIdx.x * BlockSize * ItemsPerThread;
+    if(NonTemporal)
+    {
+        rocprim::block_load_direct_blocked_nontemporal(threadIdx.x, device_input + offset, items);
+        rocprim::block_store_direct_blocked_nontemporal(threadIdx.x,
+                                                        device_output + offset,
+                                                        items);
+    }
+    else
+    {
+        rocprim::block_load_direct_blocked_vectorized(threadIdx.x, device_input + offset, items);
+        rocprim::block_store_direct_blocked_vectorized(threadIdx.x,
+                                                       device_output + offset,
+                                                       items);
+    }
+}
+
 template<rocprim::block_load_method  LoadMethod,
          rocprim::block_store_method StoreMethod,
          unsigned int                BlockSize>
@@ -579,4 +656,116 @@ void load_store_valid_default_kernel(Type* device_input, Type* device_output, si
     store.store(device_output + offset, _items);
 }
 
+template<class Type,
+         rocprim::block_load_method  LoadMethod,
+         rocprim::block_store_method StoreMethod,
+         unsigned int                BlockSize,
+         unsigned int                ItemsPerThread>
+struct masked_params
+{
+    using type                                                    = Type;
+    static constexpr rocprim::block_load_method  load_method      = LoadMethod;
+    static constexpr rocprim::block_store_method store_method     = StoreMethod;
+    static constexpr unsigned int                block_size       = BlockSize;
+    static constexpr unsigned int                items_per_thread = ItemsPerThread;
+};
+
+typedef ::testing::Types<
+    masked_params<int,
+                  rocprim::block_load_method::block_load_direct,
+                  rocprim::block_store_method::block_store_direct,
+                  256,
+                  4>,
+    masked_params<double,
+                  rocprim::block_load_method::block_load_direct,
+                  rocprim::block_store_method::block_store_direct,
+                  64,
+                  32>,
+    masked_params<int,
+                  rocprim::block_load_method::block_load_striped,
+                  rocprim::block_store_method::block_store_striped,
+                  128,
+                  7>,
+    masked_params<uint8_t,
+                  rocprim::block_load_method::block_load_striped,
+                  rocprim::block_store_method::block_store_striped,
+                  64,
+                  16>,
+    masked_params<int,
+                  rocprim::block_load_method::block_load_vectorize,
+                  rocprim::block_store_method::block_store_vectorize,
+                  256,
+                  8>,
+    masked_params<rocprim::half,
+                  rocprim::block_load_method::block_load_vectorize,
+                  rocprim::block_store_method::block_store_vectorize,
+                  128,
+                  3>,
+    masked_params<test_utils::custom_test_type<int>,
+                  rocprim::block_load_method::block_load_vectorize,
+                  rocprim::block_store_method::block_store_vectorize,
+                  64,
+                  5>>
+    MaskedParams;
+
+// The mask of the items of a thread: every 8th thread selects all items, the other threads
+// a pseudo-random subset, so both the dense and the sparse paths are taken.
+template<unsigned int ItemsPerThread>
+__host__ __device__ inline unsigned int
+    test_item_mask(unsigned int block_id, unsigned int flat_id, unsigned int seed)
+{
+    const unsigned int full = rocprim::detail::full_item_mask<ItemsPerThread>();
+    if(flat_id % 8 == 0)
+    {
+        return full;
+    }
+    return ((block_id * 0x85EBCA6Bu + flat_id) * 0x9E3779B9u ^ seed) & full;
+}
+
+template<class Type,
+         rocprim::block_load_method  LoadMethod,
+         rocprim::block_store_method StoreMethod,
+         unsigned int                BlockSize,
+         unsigned int                ItemsPerThread>
+__global__ __launch_bounds__(BlockSize) void load_store_masked_kernel(Type*        device_input,
+                                                                      Type*        device_output,
+                                                                      unsigned int seed)
+{
+    Type _items[ItemsPerThread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        _items[i] = Type(0);
+    }
+    const auto         offset = blockIdx.x * BlockSize * ItemsPerThread;
+    const unsigned int mask   = test_item_mask<ItemsPerThread>(blockIdx.x, threadIdx.x, seed);
+    rocprim::block_load<Type, BlockSize, ItemsPerThread, LoadMethod>   load;
+    rocprim::block_store<Type, BlockSize, ItemsPerThread, StoreMethod> store;
+    load.load_masked(device_input + offset, _items, mask);
+    store.store_masked(device_output + offset, _items, mask);
+}
+
+template<class Type,
+         rocprim::block_load_method  LoadMethod,
+         rocprim::block_store_method StoreMethod,
+         unsigned int                BlockSize,
+         unsigned int                ItemsPerThread>
+__global__ __launch_bounds__(BlockSize) void load_store_flagged_kernel(Type* device_input,
+                                                                       Type* device_output,
+                                                                       const unsigned int* bits)
+{
+    Type _items[ItemsPerThread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        _items[i] = Type(0);
+    }
+    const auto offset = blockIdx.x * BlockSize * ItemsPerThread;
+    const auto flags  = rocprim::make_bitmask_iterator(bits, offset);
+    rocprim::block_load<Type, BlockSize, ItemsPerThread, LoadMethod>   load;
+    rocprim::block_store<Type, BlockSize, ItemsPerThread, StoreMethod> store;
+    load.load_masked(device_input + offset, _items, flags);
+    store.store_masked(device_output + offset, _items, flags);
+}
+
 #endif // TEST_BLOCK_LOAD_STORE_KERNELS_HPP_
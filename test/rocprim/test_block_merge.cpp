@@ -0,0 +1,255 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/block/block_merge.hpp>
+#include <rocprim/block/block_store_func.hpp>
+
+// required test headers
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <vector>
+
+template<class Key, class Value, unsigned int BlockSize, unsigned int ItemsPerThread>
+struct Params
+{
+    using key_type                                 = Key;
+    using value_type                               = Value;
+    static constexpr unsigned int block_size       = BlockSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimBlockMergeTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using RocprimBlockMergeTestsParams = ::testing::Types<Params<int, int, 256, 4>,
+                                                      Params<int, int, 64, 1>,
+                                                      Params<uint8_t, int, 128, 7>,
+                                                      Params<long long, short, 256, 2>,
+                                                      Params<float, int, 192, 3>,
+                                                      Params<double, int, 512, 8>>;
+
+TYPED_TEST_SUITE(RocprimBlockMergeTests, RocprimBlockMergeTestsParams);
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class Key, class Value>
+__global__ __launch_bounds__(BlockSize) void merge_kernel(Key*                keys,
+                                                          Value*              values,
+                                                          const unsigned int* sizes1,
+                                                          const unsigned int* sizes2,
+                                                          bool                from_ranges)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     lid             = threadIdx.x;
+    const unsigned int     block_offset    = blockIdx.x * items_per_block;
+    const unsigned int     size1           = sizes1[blockIdx.x];
+    const unsigned int     size2           = sizes2[blockIdx.x];
+
+    using block_merge_type = rocprim::block_merge<Key, BlockSize, ItemsPerThread, Value>;
+    ROCPRIM_SHARED_MEMORY typename block_merge_type::storage_type storage;
+
+    Key   thread_keys[ItemsPerThread];
+    Value thread_values[ItemsPerThread];
+    if(from_ranges)
+    {
+        block_merge_type().merge_ranges(keys + block_offset,
+                                        values + block_offset,
+                                        size1,
+                                        keys + block_offset + size1,
+                                        values + block_offset + size1,
+                                        size2,
+                                        thread_keys,
+                                        thread_values,
+                                        storage);
+        // All threads must have read their input before it is overwritten
+        rocprim::syncthreads();
+    }
+    else
+    {
+        rocprim::block_load_direct_blocked(lid, keys + block_offset, thread_keys);
+        rocprim::block_load_direct_blocked(lid, values + block_offset, thread_values);
+        block_merge_type().merge(thread_keys, thread_values, size1, size2, storage);
+    }
+
+    rocprim::block_store_direct_blocked(lid, keys + block_offset, thread_keys, size1 + size2);
+    rocprim::block_store_direct_blocked(lid, values + block_offset, thread_values, size1 + size2);
+}
+
+template<class Params>
+void test_block_merge(const bool from_ranges)
+{
+    using key_type                          = typename Params::key_type;
+    using value_type                        = typename Params::value_type;
+    constexpr unsigned int block_size       = Params::block_size;
+    constexpr unsigned int items_per_thread = Params::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int grid_size        = 37;
+    constexpr size_t       size             = items_per_block * grid_size;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Few distinct keys, so that the stability is checked
+        std::vector<key_type> keys
+            = test_utils::get_random_data<key_type>(size, 0, 50, seed_value);
+        std::vector<value_type> values(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            values[i] = static_cast<value_type>(i % items_per_block);
+        }
+
+        // The first blocks cover the empty and full edge cases
+        std::vector<unsigned int> sizes1
+            = test_utils::get_random_data<unsigned int>(grid_size, 0, items_per_block, seed_value);
+        std::vector<unsigned int> sizes2(grid_size);
+        engine_type               rng_engine(seed_value);
+        for(unsigned int block = 0; block < grid_size; block++)
+        {
+            if(block < 4)
+            {
+                sizes1[block] = block % 2 == 0 ? 0 : items_per_block;
+            }
+            const unsigned int left = items_per_block - sizes1[block];
+            sizes2[block] = block < 2 ? left
+                                      : std::uniform_int_distribution<unsigned int>(0, left)(
+                                          rng_engine);
+        }
+
+        std::vector<key_type>   expected_keys(keys);
+        std::vector<value_type> expected_values(values);
+        for(unsigned int block = 0; block < grid_size; block++)
+        {
+            const size_t offset = block * items_per_block;
+            const size_t mid    = offset + sizes1[block];
+            const size_t end    = mid + sizes2[block];
+            std::sort(keys.begin() + offset, keys.begin() + mid);
+            std::sort(keys.begin() + mid, keys.begin() + end);
+
+            std::vector<std::pair<key_type, value_type>> first, second;
+            for(size_t i = offset; i < mid; i++)
+            {
+                first.emplace_back(keys[i], values[i]);
+            }
+            for(size_t i = mid; i < end; i++)
+            {
+                second.emplace_back(keys[i], values[i]);
+            }
+            std::vector<std::pair<key_type, value_type>> merged(end - offset);
+            std::merge(first.begin(),
+                       first.end(),
+                       second.begin(),
+                       second.end(),
+                       merged.begin(),
+                       [](const std::pair<key_type, value_type>& a,
+                          const std::pair<key_type, value_type>& b) { return a.first < b.first; });
+            for(size_t i = 0; i < merged.size(); i++)
+            {
+                expected_keys[offset + i]   = merged[i].first;
+                expected_values[offset + i] = merged[i].second;
+            }
+            // Items after the merged ones are not written
+            for(size_t i = end; i < offset + items_per_block; i++)
+            {
+                expected_keys[i] = keys[i];
+            }
+        }
+
+        key_type*     d_keys;
+        value_type*   d_values;
+        unsigned int* d_sizes1;
+        unsigned int* d_sizes2;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(value_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_sizes1, grid_size * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_sizes2, grid_size * sizeof(unsigned int)));
+        HIP_CHECK(
+            hipMemcpy(d_keys, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+        HIP_CHECK(
+            hipMemcpy(d_values, values.data(), size * sizeof(value_type), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_sizes1,
+                            sizes1.data(),
+                            grid_size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_sizes2,
+                            sizes2.data(),
+                            grid_size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        merge_kernel<block_size, items_per_thread>
+            <<<dim3(grid_size), dim3(block_size), 0, 0>>>(d_keys,
+                                                          d_values,
+                                                          d_sizes1,
+                                                          d_sizes2,
+                                                          from_ranges);
+        HIP_CHECK(hipGetLastError());
+
+        HIP_CHECK(
+            hipMemcpy(keys.data(), d_keys, size * sizeof(key_type), hipMemcpyDeviceToHost));
+        HIP_CHECK(
+            hipMemcpy(values.data(), d_values, size * sizeof(value_type), hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys, expected_keys));
+        for(unsigned int block = 0; block < grid_size; block++)
+        {
+            const size_t offset = block * items_per_block;
+            const size_t end    = offset + sizes1[block] + sizes2[block];
+            for(size_t i = offset; i < end; i++)
+            {
+                ASSERT_EQ(values[i], expected_values[i]) << "with index = " << i;
+            }
+        }
+
+        HIP_CHECK(hipFree(d_keys));
+        HIP_CHECK(hipFree(d_values));
+        HIP_CHECK(hipFree(d_sizes1));
+        HIP_CHECK(hipFree(d_sizes2));
+    }
+}
+
+TYPED_TEST(RocprimBlockMergeTests, MergeRegisters)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    test_block_merge<typename TestFixture::params>(false);
+}
+
+TYPED_TEST(RocprimBlockMergeTests, MergeRanges)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    test_block_merge<typename TestFixture::params>(true);
+}
@@ -153,6 +153,86 @@ __global__ __launch_bounds__(BlockSize) void sort_key_value_kernel(key_type*   d
     }
 }
 
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int RadixBitsPerPass,
+         class key_type,
+         class value_type>
+__global__ __launch_bounds__(BlockSize) void sort_to_ranks_kernel(key_type*   device_keys_output,
+                                                                  value_type* device_values_output,
+                                                                  bool        descending,
+                                                                  unsigned int start_bit,
+                                                                  unsigned int end_bit)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int lid = threadIdx.x;
+    const unsigned int block_offset = blockIdx.x * items_per_block;
+
+    key_type keys[ItemsPerThread];
+    value_type values[ItemsPerThread];
+    rocprim::block_load_direct_blocked(lid, device_keys_output + block_offset, keys);
+    rocprim::block_load_direct_blocked(lid, device_values_output + block_offset, values);
+
+    using block_sort_type = rocprim::
+        block_radix_sort<key_type, BlockSize, ItemsPerThread, value_type, 1, 1, RadixBitsPerPass>;
+    test_utils::select_decomposer_t<key_type> decomposer{};
+
+    unsigned int ranks[ItemsPerThread];
+    if(descending)
+    {
+        block_sort_type().sort_desc_to_ranks(keys, values, ranks, start_bit, end_bit, decomposer);
+    }
+    else
+    {
+        block_sort_type().sort_to_ranks(keys, values, ranks, start_bit, end_bit, decomposer);
+    }
+
+    // All threads must have read their input before it is overwritten
+    rocprim::syncthreads();
+    block_sort_type::scatter_by_rank(keys, ranks, device_keys_output + block_offset);
+    block_sort_type::scatter_by_rank(values, ranks, device_values_output + block_offset);
+}
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int RadixBitsPerPass,
+         class key_type,
+         class value_type>
+__global__ __launch_bounds__(BlockSize) void sort_segmented_kernel(key_type*   device_keys_output,
+                                                                   value_type* device_values_output,
+                                                                   const unsigned char* device_heads,
+                                                                   bool                 descending,
+                                                                   unsigned int         start_bit,
+                                                                   unsigned int         end_bit)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int lid = threadIdx.x;
+    const unsigned int block_offset = blockIdx.x * items_per_block;
+
+    key_type      keys[ItemsPerThread];
+    value_type    values[ItemsPerThread];
+    unsigned char heads[ItemsPerThread];
+    rocprim::block_load_direct_blocked(lid, device_keys_output + block_offset, keys);
+    rocprim::block_load_direct_blocked(lid, device_values_output + block_offset, values);
+    rocprim::block_load_direct_blocked(lid, device_heads + block_offset, heads);
+
+    rocprim::
+        block_radix_sort<key_type, BlockSize, ItemsPerThread, value_type, 1, 1, RadixBitsPerPass>
+                                              bsort;
+    test_utils::select_decomposer_t<key_type> decomposer{};
+    if(descending)
+    {
+        bsort.sort_desc_segmented(keys, values, heads, start_bit, end_bit, decomposer);
+    }
+    else
+    {
+        bsort.sort_segmented(keys, values, heads, start_bit, end_bit, decomposer);
+    }
+
+    rocprim::block_store_direct_blocked(lid, device_keys_output + block_offset, keys);
+    rocprim::block_store_direct_blocked(lid, device_values_output + block_offset, values);
+}
+
 // Test for radix sort with keys only
 template<class Key,
          class Value,
@@ -249,7 +329,8 @@ auto test_block_radix_sort() -> typename std::enable_if<Method == 0>::type
 
 }
 
-// Test for radix_sort with keys and values. Also ensures that (block) radix_sort is stable
+// Test for radix_sort with keys and values. Also ensures that (block) radix_sort is stable.
+// Method 3 sorts to ranks and scatters the items to them.
 template<class Key,
          class Value,
          unsigned int Method,
@@ -260,7 +341,7 @@ template<class Key,
          bool         ToStriped  = false,
          unsigned int StartBit   = 0,
          unsigned int EndBit     = sizeof(Key) * 8>
-auto test_block_radix_sort() -> typename std::enable_if<Method == 1>::type
+auto test_block_radix_sort() -> typename std::enable_if<Method == 1 || Method == 3>::type
 {
     using key_type                                    = Key;
     using value_type                                  = Value;
@@ -351,14 +432,188 @@ auto test_block_radix_sort() -> typename std::enable_if<Method == 1>::type
         );
 
         // Running kernel
-        sort_key_value_kernel<block_size,
+        if(Method == 3)
+        {
+            sort_to_ranks_kernel<block_size,
+                                 items_per_thread,
+                                 radix_bits_per_pass,
+                                 key_type,
+                                 value_type>
+                <<<dim3(grid_size), dim3(block_size), 0, 0>>>(device_keys_output,
+                                                              device_values_output,
+                                                              descending,
+                                                              start_bit,
+                                                              end_bit);
+        }
+        else
+        {
+            sort_key_value_kernel<block_size,
+                                  items_per_thread,
+                                  radix_bits_per_pass,
+                                  key_type,
+                                  value_type>
+                <<<dim3(grid_size), dim3(block_size), 0, 0>>>(device_keys_output,
+                                                              device_values_output,
+                                                              to_striped,
+                                                              descending,
+                                                              start_bit,
+                                                              end_bit);
+        }
+        HIP_CHECK(hipGetLastError());
+
+        // Getting results to host
+        HIP_CHECK(hipMemcpy(keys_output.get(),
+                            device_keys_output,
+                            size * sizeof(keys_output[0]),
+                            hipMemcpyDeviceToHost));
+
+        HIP_CHECK(
+            hipMemcpy(
+                values_output.data(), device_values_output,
+                values_output.size() * sizeof(typename decltype(values_output)::value_type),
+                hipMemcpyDeviceToHost
+            )
+        );
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output.get(),
+                                                      keys_output.get() + size,
+                                                      keys_expected.begin(),
+                                                      keys_expected.end()));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+
+        HIP_CHECK(hipFree(device_keys_output));
+        HIP_CHECK(hipFree(device_values_output));
+    }
+
+}
+
+// Test for the segmented radix sort with keys and values. The values are the input positions, so
+// checking them also ensures that the sort is stable and that no item leaves its segment.
+template<class Key,
+         class Value,
+         unsigned int Method,
+         unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         unsigned int RadixBitsPerPass,
+         bool         Descending = false,
+         bool         ToStriped  = false,
+         unsigned int StartBit   = 0,
+         unsigned int EndBit     = sizeof(Key) * 8>
+auto test_block_radix_sort() -> typename std::enable_if<Method == 2>::type
+{
+    using key_type                                    = Key;
+    using value_type                                  = Value;
+    static constexpr size_t       block_size          = BlockSize;
+    static constexpr size_t       items_per_thread    = ItemsPerThread;
+    static constexpr unsigned     radix_bits_per_pass = RadixBitsPerPass;
+    static constexpr bool         descending          = Descending;
+    static constexpr unsigned int start_bit
+        = (rocprim::is_unsigned<Key>::value == false) ? 0 : StartBit;
+    static constexpr unsigned int end_bit
+        = (rocprim::is_unsigned<Key>::value == false) ? sizeof(Key) * 8 : EndBit;
+    static constexpr size_t items_per_block = block_size * items_per_thread;
+
+    // Given block size not supported
+    if(block_size > test_utils::get_max_block_size())
+    {
+        return;
+    }
+
+    const size_t size = items_per_block * 19;
+    const size_t grid_size = size / items_per_block;
+
+    SCOPED_TRACE(testing::Message() << "with items_per_block = " << items_per_block);
+    SCOPED_TRACE(testing::Message() << "with size = " << size);
+    SCOPED_TRACE(testing::Message() << "with grid_size = " << grid_size);
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        seed_type seed_value = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        engine_type rng_engine(seed_value);
+
+        // Generate data
+        auto keys_output = std::make_unique<key_type[]>(size);
+        test_utils::generate_random_data_n(keys_output.get(),
+                                           size,
+                                           test_utils::generate_limits<key_type>::min(),
+                                           test_utils::generate_limits<key_type>::max(),
+                                           rng_engine);
+
+        std::vector<value_type> values_output(size);
+        std::iota(values_output.begin(), values_output.end(), 0u);
+
+        // Segments of about 16 items on average, later blocks have few long segments
+        std::vector<unsigned char> heads(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            const size_t block = i / items_per_block;
+            const size_t mean_length = block < grid_size / 2 ? 16 : items_per_block / 2;
+            heads[i] = std::uniform_int_distribution<size_t>(0, mean_length - 1)(rng_engine) == 0;
+        }
+
+        using key_value = std::pair<key_type, value_type>;
+
+        // Calculate expected results on host
+        std::vector<key_value> expected(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            expected[i] = key_value(keys_output[i], values_output[i]);
+        }
+
+        for(size_t begin = 0; begin < size;)
+        {
+            size_t end = begin + 1;
+            while(end < size && end % items_per_block != 0 && !heads[end])
+            {
+                end++;
+            }
+            std::stable_sort(
+                expected.begin() + begin,
+                expected.begin() + end,
+                test_utils::key_value_comparator<key_type, value_type, descending, start_bit, end_bit>()
+            );
+            begin = end;
+        }
+
+        std::vector<key_type> keys_expected(size);
+        std::vector<value_type> values_expected(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            keys_expected[i] = expected[i].first;
+            values_expected[i] = expected[i].second;
+        }
+
+        key_type* device_keys_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_keys_output, size * sizeof(key_type)));
+        value_type* device_values_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_values_output, size * sizeof(value_type)));
+        unsigned char* device_heads;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_heads, size * sizeof(unsigned char)));
+
+        HIP_CHECK(hipMemcpy(device_keys_output,
+                            keys_output.get(),
+                            size * sizeof(keys_output[0]),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(device_values_output,
+                            values_output.data(),
+                            size * sizeof(value_type),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(device_heads,
+                            heads.data(),
+                            size * sizeof(unsigned char),
+                            hipMemcpyHostToDevice));
+
+        // Running kernel
+        sort_segmented_kernel<block_size,
                               items_per_thread,
                               radix_bits_per_pass,
                               key_type,
                               value_type>
             <<<dim3(grid_size), dim3(block_size), 0, 0>>>(device_keys_output,
                                                           device_values_output,
-                                                          to_striped,
+                                                          device_heads,
                                                           descending,
                                                           start_bit,
                                                           end_bit);
@@ -369,14 +624,10 @@ auto test_block_radix_sort() -> typename std::enable_if<Method == 1>::type
                             device_keys_output,
                             size * sizeof(keys_output[0]),
                             hipMemcpyDeviceToHost));
-
-        HIP_CHECK(
-            hipMemcpy(
-                values_output.data(), device_values_output,
-                values_output.size() * sizeof(typename decltype(values_output)::value_type),
-                hipMemcpyDeviceToHost
-            )
-        );
+        HIP_CHECK(hipMemcpy(values_output.data(),
+                            device_values_output,
+                            size * sizeof(value_type),
+                            hipMemcpyDeviceToHost));
 
         ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output.get(),
                                                       keys_output.get() + size,
@@ -386,6 +637,7 @@ auto test_block_radix_sort() -> typename std::enable_if<Method == 1>::type
 
         HIP_CHECK(hipFree(device_keys_output));
         HIP_CHECK(hipFree(device_values_output));
+        HIP_CHECK(hipFree(device_heads));
     }
 
 }
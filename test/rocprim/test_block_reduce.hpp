@@ -326,6 +326,82 @@ typed_test_def(suite_name_single, name_suffix, ReduceValid)
     }
 }
 
+typed_test_def(suite_name_single, name_suffix, MultiReduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    // maximum is exact for every type, so the results can be compared directly
+    using binary_op_type = rocprim::maximum<T>;
+
+    constexpr size_t       block_size = TestFixture::block_size;
+    constexpr unsigned int n          = 3;
+
+    // Given block size not supported
+    if(block_size > test_utils::get_max_block_size())
+    {
+        return;
+    }
+
+    const size_t grid_size = 58;
+    const size_t size      = block_size * grid_size * n;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Generate data
+        std::vector<T> output = test_utils::get_random_data<T>(size, T(0), T(100), seed_value);
+
+        // Calculate expected results on host, the k-th value of every thread is reduced
+        // into the k-th reduction of the block
+        std::vector<T> expected_reductions(grid_size * n);
+        binary_op_type binary_op;
+        for(size_t i = 0; i < grid_size; i++)
+        {
+            for(size_t k = 0; k < n; k++)
+            {
+                T value = output[i * block_size * n + k];
+                for(size_t j = 1; j < block_size; j++)
+                {
+                    value = binary_op(value, output[(i * block_size + j) * n + k]);
+                }
+                expected_reductions[i * n + k] = value;
+            }
+        }
+
+        // Preparing device
+        T* device_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_output, output.size() * sizeof(T)));
+        T* device_output_reductions;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_output_reductions,
+                                                     expected_reductions.size() * sizeof(T)));
+
+        using bra = rocprim::block_reduce_algorithm;
+        static_run_multi<T, block_size, n, bra::using_warp_reduce, binary_op_type>::run(
+            output,
+            expected_reductions,
+            device_output,
+            device_output_reductions,
+            grid_size);
+        static_run_multi<T, block_size, n, bra::raking_reduce, binary_op_type>::run(
+            output,
+            expected_reductions,
+            device_output,
+            device_output_reductions,
+            grid_size);
+        static_run_multi<T, block_size, n, bra::raking_reduce_commutative_only, binary_op_type>::
+            run(output, expected_reductions, device_output, device_output_reductions, grid_size);
+
+        HIP_CHECK(hipFree(device_output));
+        HIP_CHECK(hipFree(device_output_reductions));
+    }
+}
+
 typed_test_def(suite_name_array, name_suffix, Reduce)
 {
     int device_id = test_common_utils::obtain_device_from_ctest();
@@ -347,4 +347,72 @@ struct static_for_input_array<N, N, T, BlockSize, Algorithm>
     }
 };
 
+template<unsigned int                    BlockSize,
+         unsigned int                    N,
+         rocprim::block_reduce_algorithm Algorithm,
+         class T,
+         class BinaryOp>
+__global__ __launch_bounds__(BlockSize)
+void multi_reduce_kernel(T* device_output, T* device_output_reductions)
+{
+    using block_reduce_type = rocprim::block_reduce<T, BlockSize, Algorithm>;
+    __shared__ typename block_reduce_type::storage_type storage[N];
+
+    const unsigned int index = ((blockIdx.x * BlockSize) + threadIdx.x) * N;
+    T                  values[N];
+    for(unsigned int k = 0; k < N; k++)
+    {
+        values[k] = device_output[index + k];
+    }
+    block_reduce_type().multi_reduce(values, values, storage, BinaryOp());
+    if(threadIdx.x == 0)
+    {
+        for(unsigned int k = 0; k < N; k++)
+        {
+            device_output_reductions[blockIdx.x * N + k] = values[k];
+        }
+    }
+}
+
+template<class T,
+         unsigned int                    BlockSize,
+         unsigned int                    N,
+         rocprim::block_reduce_algorithm Algorithm,
+         class BinaryOp>
+struct static_run_multi
+{
+    static void run(const std::vector<T>& output,
+                    const std::vector<T>& expected_reductions,
+                    T*                    device_output,
+                    T*                    device_output_reductions,
+                    size_t                grid_size)
+    {
+        HIP_CHECK(hipMemcpy(device_output,
+                            output.data(),
+                            output.size() * sizeof(T),
+                            hipMemcpyHostToDevice));
+
+        // Running kernel
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(multi_reduce_kernel<BlockSize, N, Algorithm, T, BinaryOp>),
+            dim3(grid_size),
+            dim3(BlockSize),
+            0,
+            0,
+            device_output,
+            device_output_reductions);
+        HIP_CHECK(hipGetLastError());
+
+        // Reading results back
+        std::vector<T> output_reductions(expected_reductions.size());
+        HIP_CHECK(hipMemcpy(output_reductions.data(),
+                            device_output_reductions,
+                            output_reductions.size() * sizeof(T),
+                            hipMemcpyDeviceToHost));
+
+        // Verifying results
+        test_utils::assert_eq(output_reductions, expected_reductions);
+    }
+};
+
 #endif // TEST_BLOCK_REDUCE_KERNELS_HPP_
@@ -0,0 +1,310 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/block/block_reduce_by_key.hpp>
+
+// required test headers
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <vector>
+
+template<class Key, class Value, unsigned int BlockSize, unsigned int ItemsPerThread>
+struct Params
+{
+    using key_type                                 = Key;
+    using value_type                               = Value;
+    static constexpr unsigned int block_size       = BlockSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimBlockReduceByKeyTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using RocprimBlockReduceByKeyTestsParams = ::testing::Types<Params<int, int, 256, 4>,
+                                                            Params<int, int, 64, 1>,
+                                                            Params<uint8_t, int, 128, 7>,
+                                                            Params<long long, short, 256, 2>,
+                                                            Params<float, float, 192, 3>,
+                                                            Params<int, double, 512, 8>>;
+
+TYPED_TEST_SUITE(RocprimBlockReduceByKeyTests, RocprimBlockReduceByKeyTestsParams);
+
+// Every block reduces its items in this many tiles.
+constexpr unsigned int reduce_by_key_tiles = 3;
+
+template<unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         bool         WithCarry,
+         class Key,
+         class Value>
+__global__ __launch_bounds__(BlockSize) void reduce_by_key_kernel(const Key*          keys,
+                                                                  const Value*        values,
+                                                                  const unsigned int* sizes,
+                                                                  Key*                unique,
+                                                                  Value*              aggregates,
+                                                                  unsigned int*       run_counts)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     lid             = threadIdx.x;
+    const unsigned int     block_offset    = blockIdx.x * items_per_block * reduce_by_key_tiles;
+    const unsigned int     size            = sizes[blockIdx.x];
+
+    using block_reduce_by_key_type = rocprim::block_reduce_by_key<Key, Value, BlockSize>;
+    ROCPRIM_SHARED_MEMORY typename block_reduce_by_key_type::storage_type storage;
+
+    typename block_reduce_by_key_type::carry_type carry{};
+    unsigned int                                  runs  = 0;
+    const unsigned int                            tiles = WithCarry ? reduce_by_key_tiles : 1;
+    for(unsigned int tile = 0; tile < tiles; tile++)
+    {
+        const unsigned int tile_offset = tile * items_per_block;
+        const unsigned int valid_items
+            = size > tile_offset ? rocprim::min(size - tile_offset, items_per_block) : 0;
+
+        Key   thread_keys[ItemsPerThread];
+        Value thread_values[ItemsPerThread];
+        rocprim::block_load_direct_blocked(lid,
+                                           keys + block_offset + tile_offset,
+                                           thread_keys,
+                                           valid_items);
+        rocprim::block_load_direct_blocked(lid,
+                                           values + block_offset + tile_offset,
+                                           thread_values,
+                                           valid_items);
+
+        Key*         tile_unique     = unique + block_offset + runs;
+        Value*       tile_aggregates = aggregates + block_offset + runs;
+        unsigned int run_count;
+        if(WithCarry && valid_items == items_per_block)
+        {
+            block_reduce_by_key_type().reduce(thread_keys,
+                                              thread_values,
+                                              tile_unique,
+                                              tile_aggregates,
+                                              run_count,
+                                              carry,
+                                              storage);
+        }
+        else if(WithCarry)
+        {
+            block_reduce_by_key_type().reduce(thread_keys,
+                                              thread_values,
+                                              valid_items,
+                                              tile_unique,
+                                              tile_aggregates,
+                                              run_count,
+                                              carry,
+                                              storage);
+        }
+        else if(valid_items == items_per_block)
+        {
+            block_reduce_by_key_type().reduce(thread_keys,
+                                              thread_values,
+                                              tile_unique,
+                                              tile_aggregates,
+                                              run_count,
+                                              storage);
+        }
+        else
+        {
+            block_reduce_by_key_type().reduce(thread_keys,
+                                              thread_values,
+                                              valid_items,
+                                              tile_unique,
+                                              tile_aggregates,
+                                              run_count,
+                                              storage);
+        }
+        runs += run_count;
+        rocprim::syncthreads();
+    }
+
+    if(lid == 0)
+    {
+        if(carry.is_open)
+        {
+            unique[block_offset + runs]     = carry.key;
+            aggregates[block_offset + runs] = carry.aggregate;
+            runs++;
+        }
+        run_counts[blockIdx.x] = runs;
+    }
+}
+
+template<class Params, bool WithCarry>
+void test_block_reduce_by_key()
+{
+    using key_type                          = typename Params::key_type;
+    using value_type                        = typename Params::value_type;
+    constexpr unsigned int block_size       = Params::block_size;
+    constexpr unsigned int items_per_thread = Params::items_per_thread;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+    constexpr unsigned int items_per_slice  = items_per_block * reduce_by_key_tiles;
+    constexpr unsigned int max_block_size   = WithCarry ? items_per_slice : items_per_block;
+    constexpr unsigned int grid_size        = 37;
+    constexpr size_t       size             = size_t{items_per_slice} * grid_size;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // The first blocks cover the empty and full edge cases, and runs that span all tiles.
+        std::vector<unsigned int> sizes
+            = test_utils::get_random_data<unsigned int>(grid_size, 0, max_block_size, seed_value);
+        sizes[0] = 0;
+        sizes[1] = max_block_size;
+        sizes[2] = max_block_size;
+        sizes[3] = items_per_block;
+
+        // Small integral values, so that the aggregates do not depend on the order of the
+        // reduction.
+        const std::vector<int>  small_values
+            = test_utils::get_random_data<int>(size, 0, 10, seed_value);
+        std::vector<key_type>   keys(size);
+        std::vector<value_type> values(small_values.begin(), small_values.end());
+        engine_type                                 rng_engine(seed_value);
+        std::uniform_int_distribution<unsigned int> distribution(0, 99);
+        for(unsigned int block = 0; block < grid_size; block++)
+        {
+            // The probability of a new run differs between the blocks.
+            const unsigned int new_run_percent = block == 2 ? 0 : block % 5 * 10 + 1;
+            key_type           key             = key_type(0);
+            for(unsigned int i = 0; i < items_per_slice; i++)
+            {
+                if(distribution(rng_engine) < new_run_percent)
+                {
+                    key = static_cast<key_type>(key + 1);
+                }
+                keys[block * items_per_slice + i] = key;
+            }
+        }
+
+        std::vector<key_type>     expected_unique(size);
+        std::vector<value_type>   expected_aggregates(size);
+        std::vector<unsigned int> expected_run_counts(grid_size, 0);
+        for(unsigned int block = 0; block < grid_size; block++)
+        {
+            const size_t offset = block * items_per_slice;
+            unsigned int runs   = 0;
+            for(size_t i = offset; i < offset + sizes[block]; i++)
+            {
+                if(i == offset || keys[i] != keys[i - 1])
+                {
+                    expected_unique[offset + runs]     = keys[i];
+                    expected_aggregates[offset + runs] = values[i];
+                    runs++;
+                }
+                else
+                {
+                    expected_aggregates[offset + runs - 1] += values[i];
+                }
+            }
+            expected_run_counts[block] = runs;
+        }
+
+        key_type*     d_keys;
+        value_type*   d_values;
+        unsigned int* d_sizes;
+        key_type*     d_unique;
+        value_type*   d_aggregates;
+        unsigned int* d_run_counts;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(value_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_sizes, grid_size * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique, size * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_aggregates, size * sizeof(value_type)));
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_run_counts, grid_size * sizeof(unsigned int)));
+        HIP_CHECK(
+            hipMemcpy(d_keys, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+        HIP_CHECK(
+            hipMemcpy(d_values, values.data(), size * sizeof(value_type), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_sizes,
+                            sizes.data(),
+                            grid_size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        reduce_by_key_kernel<block_size, items_per_thread, WithCarry>
+            <<<dim3(grid_size), dim3(block_size), 0, 0>>>(d_keys,
+                                                          d_values,
+                                                          d_sizes,
+                                                          d_unique,
+                                                          d_aggregates,
+                                                          d_run_counts);
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<key_type>     unique(size);
+        std::vector<value_type>   aggregates(size);
+        std::vector<unsigned int> run_counts(grid_size);
+        HIP_CHECK(
+            hipMemcpy(unique.data(), d_unique, size * sizeof(key_type), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(aggregates.data(),
+                            d_aggregates,
+                            size * sizeof(value_type),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(run_counts.data(),
+                            d_run_counts,
+                            grid_size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(run_counts, expected_run_counts));
+        for(unsigned int block = 0; block < grid_size; block++)
+        {
+            const size_t offset = block * items_per_slice;
+            for(size_t i = offset; i < offset + run_counts[block]; i++)
+            {
+                ASSERT_EQ(unique[i], expected_unique[i]) << "with index = " << i;
+                ASSERT_EQ(aggregates[i], expected_aggregates[i]) << "with index = " << i;
+            }
+        }
+
+        HIP_CHECK(hipFree(d_keys));
+        HIP_CHECK(hipFree(d_values));
+        HIP_CHECK(hipFree(d_sizes));
+        HIP_CHECK(hipFree(d_unique));
+        HIP_CHECK(hipFree(d_aggregates));
+        HIP_CHECK(hipFree(d_run_counts));
+    }
+}
+
+TYPED_TEST(RocprimBlockReduceByKeyTests, ReduceByKey)
+{
+    test_block_reduce_by_key<typename TestFixture::params, false>();
+}
+
+TYPED_TEST(RocprimBlockReduceByKeyTests, ReduceByKeyCarry)
+{
+    test_block_reduce_by_key<typename TestFixture::params, true>();
+}
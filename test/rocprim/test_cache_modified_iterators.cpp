@@ -0,0 +1,308 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/block/block_store.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/iterator/cache_modified_input_iterator.hpp>
+#include <rocprim/iterator/cache_modified_output_iterator.hpp>
+
+// required test headers
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+template<class T,
+         rocprim::cache_load_modifier  LoadModifier,
+         rocprim::cache_store_modifier StoreModifier>
+struct RocprimCacheModifiedIteratorParams
+{
+    using type                                                   = T;
+    static constexpr rocprim::cache_load_modifier  load_modifier  = LoadModifier;
+    static constexpr rocprim::cache_store_modifier store_modifier = StoreModifier;
+};
+
+template<class Params>
+class RocprimCacheModifiedIteratorTests : public ::testing::Test
+{
+public:
+    using type                                                   = typename Params::type;
+    static constexpr rocprim::cache_load_modifier  load_modifier  = Params::load_modifier;
+    static constexpr rocprim::cache_store_modifier store_modifier = Params::store_modifier;
+    const bool                                     debug_synchronous = false;
+};
+
+using RocprimCacheModifiedIteratorTestsParams = ::testing::Types<
+    RocprimCacheModifiedIteratorParams<int, rocprim::load_cs, rocprim::store_cs>,
+    RocprimCacheModifiedIteratorParams<unsigned char, rocprim::load_cs, rocprim::store_cs>,
+    RocprimCacheModifiedIteratorParams<float, rocprim::load_cs, rocprim::store_default>,
+    RocprimCacheModifiedIteratorParams<double, rocprim::load_default, rocprim::store_cs>,
+    RocprimCacheModifiedIteratorParams<unsigned long long, rocprim::load_cg, rocprim::store_cg>,
+    RocprimCacheModifiedIteratorParams<int, rocprim::load_ldg, rocprim::store_default>,
+    RocprimCacheModifiedIteratorParams<double, rocprim::load_ca, rocprim::store_default>,
+    RocprimCacheModifiedIteratorParams<test_utils::custom_test_type<int>,
+                                       rocprim::load_cs,
+                                       rocprim::store_cs>>;
+
+TYPED_TEST_SUITE(RocprimCacheModifiedIteratorTests, RocprimCacheModifiedIteratorTestsParams);
+
+template<class T>
+struct transform
+{
+    __device__ __host__
+    constexpr T operator()(const T& a) const
+    {
+        return a + 5;
+    }
+};
+
+TYPED_TEST(RocprimCacheModifiedIteratorTests, HostIterator)
+{
+    using T = typename TestFixture::type;
+    static constexpr size_t size = 5;
+
+    std::vector<T> data(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        data[i] = T(i);
+    }
+
+    auto input = rocprim::make_cache_modified_input_iterator<TestFixture::load_modifier>(
+        static_cast<const T*>(data.data()));
+    ASSERT_EQ(data[0], *input);
+    ASSERT_EQ(data[3], input[3]);
+    ASSERT_EQ(data[2], *(input + 2));
+    ASSERT_EQ(data[2], *(2 + input));
+    ASSERT_EQ(static_cast<std::ptrdiff_t>(size), (input + size) - input);
+    ASSERT_LT(input, input + 1);
+    const auto next = input + 1;
+    ASSERT_EQ(next, ++input);
+    ASSERT_EQ(data[1], *input);
+
+    auto output
+        = rocprim::make_cache_modified_output_iterator<TestFixture::store_modifier>(data.data());
+    *output       = T(10);
+    output[4]     = T(14);
+    *(output + 2) = T(12);
+    ASSERT_EQ(T(10), data[0]);
+    ASSERT_EQ(T(12), data[2]);
+    ASSERT_EQ(T(14), data[4]);
+    ASSERT_EQ(data.data() + size, (output + size).base());
+}
+
+TYPED_TEST(RocprimCacheModifiedIteratorTests, Transform)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = typename TestFixture::type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            std::vector<T> expected(size);
+            std::transform(input.begin(), input.end(), expected.begin(), transform<T>());
+
+            HIP_CHECK(rocprim::transform(
+                rocprim::make_cache_modified_input_iterator<TestFixture::load_modifier>(
+                    static_cast<const T*>(d_input)),
+                rocprim::make_cache_modified_output_iterator<TestFixture::store_modifier>(
+                    d_output),
+                size,
+                transform<T>(),
+                stream,
+                debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TYPED_TEST(RocprimCacheModifiedIteratorTests, InclusiveScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = typename TestFixture::type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Small integral values, so that the sums of floating-point types are exact
+            const std::vector<int> values
+                = test_utils::get_random_data<int>(size, 0, 3, seed_value);
+            std::vector<T>         input(values.begin(), values.end());
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            std::vector<T> expected(size);
+            std::partial_sum(input.begin(), input.end(), expected.begin(), rocprim::plus<T>());
+
+            const auto input_it = rocprim::make_cache_modified_input_iterator<
+                TestFixture::load_modifier>(static_cast<const T*>(d_input));
+            const auto output_it
+                = rocprim::make_cache_modified_output_iterator<TestFixture::store_modifier>(
+                    d_output);
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::inclusive_scan(nullptr,
+                                              temp_storage_size_bytes,
+                                              input_it,
+                                              output_it,
+                                              size,
+                                              rocprim::plus<T>(),
+                                              stream,
+                                              debug_synchronous));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::inclusive_scan(d_temp_storage,
+                                              temp_storage_size_bytes,
+                                              input_it,
+                                              output_it,
+                                              size,
+                                              rocprim::plus<T>(),
+                                              stream,
+                                              debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+template<unsigned int                  BlockSize,
+         unsigned int                  ItemsPerThread,
+         rocprim::cache_load_modifier  LoadModifier,
+         rocprim::cache_store_modifier StoreModifier,
+         class T>
+__global__ __launch_bounds__(BlockSize) void block_load_store_vectorize_kernel(const T* input,
+                                                                               T*       output)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     block_offset    = blockIdx.x * items_per_block;
+
+    T items[ItemsPerThread];
+    rocprim::block_load<T, BlockSize, ItemsPerThread, rocprim::block_load_vectorize>().load(
+        rocprim::make_cache_modified_input_iterator<LoadModifier>(input + block_offset),
+        items);
+    rocprim::block_store<T, BlockSize, ItemsPerThread, rocprim::block_store_vectorize>().store(
+        rocprim::make_cache_modified_output_iterator<StoreModifier>(output + block_offset),
+        items);
+}
+
+TYPED_TEST(RocprimCacheModifiedIteratorTests, BlockLoadStoreVectorize)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                                 = typename TestFixture::type;
+    constexpr unsigned int block_size       = 256;
+    constexpr unsigned int items_per_thread = 4;
+    constexpr unsigned int grid_size        = 13;
+    constexpr size_t       size             = block_size * items_per_thread * grid_size;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+        T* d_input;
+        T* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        block_load_store_vectorize_kernel<block_size,
+                                          items_per_thread,
+                                          TestFixture::load_modifier,
+                                          TestFixture::store_modifier>
+            <<<dim3(grid_size), dim3(block_size), 0, 0>>>(d_input, d_output);
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<T> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, input));
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
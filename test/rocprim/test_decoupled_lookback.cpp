@@ -0,0 +1,196 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/block/block_scan.hpp>
+#include <rocprim/block/block_store.hpp>
+#include <rocprim/device/decoupled_lookback.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <cstddef>
+
+template<class T, bool Deterministic>
+struct DecoupledLookbackParams
+{
+    using type                          = T;
+    static constexpr bool deterministic = Deterministic;
+};
+
+template<class Params>
+class RocprimDecoupledLookbackTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using RocprimDecoupledLookbackTestsParams
+    = ::testing::Types<DecoupledLookbackParams<int, false>,
+                       DecoupledLookbackParams<int, true>,
+                       DecoupledLookbackParams<size_t, false>,
+                       DecoupledLookbackParams<test_utils::custom_test_type<int>, false>>;
+
+TYPED_TEST_SUITE(RocprimDecoupledLookbackTests, RocprimDecoupledLookbackTestsParams);
+
+constexpr unsigned int lookback_block_size       = 256;
+constexpr unsigned int lookback_items_per_thread = 4;
+constexpr unsigned int lookback_items_per_block
+    = lookback_block_size * lookback_items_per_thread;
+
+// An inclusive scan written as a custom single-pass kernel
+template<class T, class Lookback>
+__global__ __launch_bounds__(lookback_block_size) void lookback_scan_kernel(const T*     input,
+                                                                             T*           output,
+                                                                             const size_t size,
+                                                                             Lookback     lookback)
+{
+    using block_load_type  = rocprim::block_load<T,
+                                                 lookback_block_size,
+                                                 lookback_items_per_thread,
+                                                 rocprim::block_load_method::block_load_transpose>;
+    using block_store_type
+        = rocprim::block_store<T,
+                               lookback_block_size,
+                               lookback_items_per_thread,
+                               rocprim::block_store_method::block_store_transpose>;
+    using block_scan_type = rocprim::block_scan<T, lookback_block_size>;
+
+    __shared__ typename Lookback::storage_type lookback_storage;
+    __shared__ union
+    {
+        typename block_load_type::storage_type  load;
+        typename block_store_type::storage_type store;
+        typename block_scan_type::storage_type  scan;
+    } storage;
+
+    const unsigned int tile_id     = lookback.get_block_id(lookback_storage);
+    const size_t       tile_offset = size_t(tile_id) * lookback_items_per_block;
+    const unsigned int valid
+        = static_cast<unsigned int>(std::min<size_t>(size - tile_offset, lookback_items_per_block));
+
+    T values[lookback_items_per_thread];
+    block_load_type().load(input + tile_offset, values, valid, T(0), storage.load);
+    rocprim::syncthreads();
+
+    if(tile_id == 0)
+    {
+        T reduction;
+        block_scan_type().inclusive_scan(values, values, reduction, storage.scan);
+        if(threadIdx.x == 0)
+        {
+            lookback.set_complete(0, reduction);
+        }
+    }
+    else
+    {
+        auto prefix_op = lookback.prefix_callback(tile_id);
+        block_scan_type()
+            .inclusive_scan(values, values, storage.scan, prefix_op, rocprim::plus<T>());
+    }
+    rocprim::syncthreads();
+
+    block_store_type().store(output + tile_offset, values, valid, storage.store);
+}
+
+TYPED_TEST(RocprimDecoupledLookbackTests, InclusiveScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T             = typename TestFixture::params::type;
+    using lookback_type = rocprim::
+        decoupled_lookback<T, rocprim::plus<T>, TestFixture::params::deterministic>;
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 10, seed_value);
+            std::vector<T>       expected(size);
+            std::partial_sum(input.begin(), input.end(), expected.begin(), rocprim::plus<T>());
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            const unsigned int tiles
+                = static_cast<unsigned int>((size + lookback_items_per_block - 1)
+                                            / lookback_items_per_block);
+
+            size_t storage_size;
+            HIP_CHECK(lookback_type::get_temp_storage_size(tiles, stream, storage_size));
+            void* d_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_size));
+
+            lookback_type lookback;
+            ASSERT_EQ(lookback_type::create(lookback, d_storage, storage_size - 1, tiles, stream),
+                      hipErrorInvalidValue);
+            HIP_CHECK(lookback_type::create(lookback, d_storage, storage_size, tiles, stream));
+            ASSERT_EQ(lookback.number_of_blocks(), tiles);
+
+            // The look-back is initialized before every launch
+            for(int run = 0; run < 2; ++run)
+            {
+                HIP_CHECK(lookback.initialize(stream));
+                lookback_scan_kernel<<<tiles, lookback_block_size, 0, stream>>>(d_input,
+                                                                               d_output,
+                                                                               size,
+                                                                               lookback);
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<T> output(size);
+                HIP_CHECK(
+                    hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_storage));
+        }
+    }
+}
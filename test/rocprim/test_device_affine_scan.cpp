@@ -0,0 +1,231 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_affine_scan.hpp>
+#include <rocprim/types/affine_map.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Every run of keys is a segment with the same recurrence
+template<class T>
+void run_affine_scan_test()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using U           = float;
+    using key_type    = int;
+    using offset_type = unsigned int;
+
+    const U           initial_value     = 1;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::default_random_engine            gen(seed_value);
+        std::uniform_int_distribution<size_t> length_dis(1, 3000);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Factors of -1, 0 and 1 and small offsets keep the states exact integers
+            const std::vector<int> a_ints
+                = test_utils::get_random_data<int>(size, -1, 1, seed_value);
+            const std::vector<int> b_ints
+                = test_utils::get_random_data<int>(size, -3, 3, seed_value + 1);
+            std::vector<T> a(size);
+            std::vector<T> b(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                a[i] = static_cast<T>(static_cast<float>(a_ints[i]));
+                b[i] = static_cast<T>(static_cast<float>(b_ints[i]));
+            }
+
+            std::vector<offset_type> offsets;
+            std::vector<key_type>    keys(size);
+            std::vector<U>           expected(size);
+            std::vector<U>           expected_segmented(size);
+            U                        x = initial_value;
+            for(size_t i = 0; i < size; i++)
+            {
+                x           = a_ints[i] * x + b_ints[i];
+                expected[i] = x;
+            }
+            for(size_t offset = 0; offset < size;)
+            {
+                offsets.push_back(offset);
+                const size_t end = std::min(size, offset + length_dis(gen));
+                x                = initial_value;
+                for(size_t i = offset; i < end; i++)
+                {
+                    keys[i]               = static_cast<key_type>(offsets.size());
+                    x                     = a_ints[i] * x + b_ints[i];
+                    expected_segmented[i] = x;
+                }
+                offset = end;
+            }
+            offsets.push_back(size);
+            const unsigned int segments = static_cast<unsigned int>(offsets.size() - 1);
+
+            T*           d_a;
+            T*           d_b;
+            key_type*    d_keys;
+            offset_type* d_offsets;
+            U*           d_output;
+            const size_t allocated = std::max<size_t>(size, 1);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_a, allocated * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_b, allocated * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, allocated * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(offset_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, 3 * allocated * sizeof(U)));
+            HIP_CHECK(hipMemcpy(d_a, a.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_b, b.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(
+                hipMemcpy(d_keys, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            size_t scan_storage_bytes;
+            size_t segmented_storage_bytes;
+            size_t by_key_storage_bytes;
+            HIP_CHECK(rocprim::affine_scan(nullptr,
+                                           scan_storage_bytes,
+                                           d_a,
+                                           d_b,
+                                           d_output,
+                                           size,
+                                           initial_value,
+                                           stream,
+                                           debug_synchronous));
+            HIP_CHECK(rocprim::segmented_affine_scan(nullptr,
+                                                     segmented_storage_bytes,
+                                                     d_a,
+                                                     d_b,
+                                                     d_output + allocated,
+                                                     size,
+                                                     segments,
+                                                     d_offsets,
+                                                     initial_value,
+                                                     stream,
+                                                     debug_synchronous));
+            HIP_CHECK(rocprim::affine_scan_by_key(nullptr,
+                                                  by_key_storage_bytes,
+                                                  d_keys,
+                                                  d_a,
+                                                  d_b,
+                                                  d_output + 2 * allocated,
+                                                  size,
+                                                  initial_value,
+                                                  rocprim::equal_to<key_type>(),
+                                                  stream,
+                                                  debug_synchronous));
+
+            size_t temp_storage_bytes
+                = std::max({scan_storage_bytes, segmented_storage_bytes, by_key_storage_bytes});
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_bytes));
+
+            HIP_CHECK(rocprim::affine_scan(d_temp_storage,
+                                           temp_storage_bytes,
+                                           d_a,
+                                           d_b,
+                                           d_output,
+                                           size,
+                                           initial_value,
+                                           stream,
+                                           debug_synchronous));
+            HIP_CHECK(rocprim::segmented_affine_scan(d_temp_storage,
+                                                     temp_storage_bytes,
+                                                     d_a,
+                                                     d_b,
+                                                     d_output + allocated,
+                                                     size,
+                                                     segments,
+                                                     d_offsets,
+                                                     initial_value,
+                                                     stream,
+                                                     debug_synchronous));
+            HIP_CHECK(rocprim::affine_scan_by_key(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  d_keys,
+                                                  d_a,
+                                                  d_b,
+                                                  d_output + 2 * allocated,
+                                                  size,
+                                                  initial_value,
+                                                  rocprim::equal_to<key_type>(),
+                                                  stream,
+                                                  debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<U> output(3 * allocated);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(U),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_a));
+            HIP_CHECK(hipFree(d_b));
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_output));
+
+            for(size_t i = 0; i < size; i++)
+            {
+                SCOPED_TRACE(testing::Message() << "with index = " << i);
+                ASSERT_EQ(output[i], expected[i]);
+                ASSERT_EQ(output[allocated + i], expected_segmented[i]);
+                ASSERT_EQ(output[2 * allocated + i], expected_segmented[i]);
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceAffineScanTests, AffineScanFloat)
+{
+    run_affine_scan_test<float>();
+}
+
+// 16-bit coefficients are composed in float
+TEST(RocprimDeviceAffineScanTests, AffineScanHalf)
+{
+    run_affine_scan_test<rocprim::half>();
+}
@@ -0,0 +1,386 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+#include <rocprim/device/device_argsort.hpp>
+#include <rocprim/functional.hpp>
+
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <cstddef>
+
+template<bool Descending, class... Args>
+hipError_t invoke_radix_argsort(Args&&... args)
+{
+    return Descending ? rocprim::radix_argsort_desc(std::forward<Args>(args)...)
+                      : rocprim::radix_argsort(std::forward<Args>(args)...);
+}
+
+// Stable permutation of the keys, the reference of every argsort
+template<bool Descending, class Key, class Index>
+std::vector<Index> get_expected_permutation(const std::vector<Key>& keys, size_t begin, size_t end)
+{
+    std::vector<Index> permutation(end - begin);
+    std::iota(permutation.begin(), permutation.end(), static_cast<Index>(begin));
+    std::stable_sort(permutation.begin(),
+                     permutation.end(),
+                     [&](const Index lhs, const Index rhs)
+                     { return Descending ? keys[rhs] < keys[lhs] : keys[lhs] < keys[rhs]; });
+    return permutation;
+}
+
+// Few distinct keys, so the stability decides most of the permutation
+template<bool Descending, class Index, bool WithKeys>
+void run_radix_argsort_test()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = int;
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<key_type> keys
+                = test_utils::get_random_data<key_type>(size, -100, 100, seed_value);
+            const std::vector<Index> expected_indices
+                = get_expected_permutation<Descending, key_type, Index>(keys, 0, size);
+
+            key_type* d_keys;
+            key_type* d_keys_output;
+            Index*    d_indices_output;
+            const size_t allocated = std::max<size_t>(size, 1);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, allocated * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_keys_output, allocated * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_indices_output, allocated * sizeof(Index)));
+            HIP_CHECK(
+                hipMemcpy(d_keys, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+
+            auto run = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+            {
+                if(WithKeys)
+                {
+                    return invoke_radix_argsort<Descending>(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            d_keys,
+                                                            d_keys_output,
+                                                            d_indices_output,
+                                                            size,
+                                                            0,
+                                                            8 * sizeof(key_type),
+                                                            stream,
+                                                            debug_synchronous);
+                }
+                return invoke_radix_argsort<Descending>(d_temp_storage,
+                                                        temp_storage_size_bytes,
+                                                        d_keys,
+                                                        nullptr,
+                                                        d_indices_output,
+                                                        size,
+                                                        0,
+                                                        8 * sizeof(key_type),
+                                                        stream,
+                                                        debug_synchronous);
+            };
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(run(nullptr, temp_storage_size_bytes));
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(run(d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<Index> indices_output(size);
+            HIP_CHECK(hipMemcpy(indices_output.data(),
+                                d_indices_output,
+                                size * sizeof(Index),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(indices_output, expected_indices));
+
+            if(WithKeys)
+            {
+                std::vector<key_type> expected_keys(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected_keys[i] = keys[expected_indices[i]];
+                }
+                std::vector<key_type> keys_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+            }
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_indices_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceArgsortTests, RadixArgsort)
+{
+    run_radix_argsort_test<false, unsigned int, true>();
+}
+
+TEST(RocprimDeviceArgsortTests, RadixArgsortIndicesOnly)
+{
+    run_radix_argsort_test<false, size_t, false>();
+}
+
+TEST(RocprimDeviceArgsortTests, RadixArgsortDesc)
+{
+    run_radix_argsort_test<true, int, false>();
+}
+
+TEST(RocprimDeviceArgsortTests, MergeArgsort)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = double;
+    using index_type = unsigned long long;
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<key_type> keys
+                = test_utils::get_random_data<key_type>(size, -10.0, 10.0, seed_value);
+            // Ties are ordered by the positions of the keys
+            for(auto& key : keys)
+            {
+                key = static_cast<key_type>(static_cast<int>(key));
+            }
+            const std::vector<index_type> expected_indices
+                = get_expected_permutation<true, key_type, index_type>(keys, 0, size);
+
+            key_type*   d_keys;
+            index_type* d_indices_output;
+            const size_t allocated = std::max<size_t>(size, 1);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, allocated * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices_output,
+                                                         allocated * sizeof(index_type)));
+            HIP_CHECK(
+                hipMemcpy(d_keys, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::merge_argsort(nullptr,
+                                             temp_storage_size_bytes,
+                                             d_keys,
+                                             nullptr,
+                                             d_indices_output,
+                                             size,
+                                             rocprim::greater<key_type>(),
+                                             stream,
+                                             debug_synchronous));
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::merge_argsort(d_temp_storage,
+                                             temp_storage_size_bytes,
+                                             d_keys,
+                                             nullptr,
+                                             d_indices_output,
+                                             size,
+                                             rocprim::greater<key_type>(),
+                                             stream,
+                                             debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<index_type> indices_output(size);
+            HIP_CHECK(hipMemcpy(indices_output.data(),
+                                d_indices_output,
+                                size * sizeof(index_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(indices_output, expected_indices));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_indices_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceArgsortTests, SegmentedRadixArgsort)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type    = unsigned short;
+    using index_type  = unsigned int;
+    using offset_type = unsigned int;
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<key_type> keys
+                = test_utils::get_random_data<key_type>(size, 0, 1000, seed_value);
+
+            // Segments of random lengths that cover the whole input
+            std::vector<offset_type> offsets = {0};
+            const std::vector<offset_type> lengths
+                = test_utils::get_random_data<offset_type>(size / 100 + 1, 1, 300, seed_value);
+            for(size_t i = 0; offsets.back() < size; i++)
+            {
+                const offset_type length = lengths[i % lengths.size()];
+                offsets.push_back(std::min<offset_type>(offsets.back() + length,
+                                                        static_cast<offset_type>(size)));
+            }
+            const unsigned int segments = static_cast<unsigned int>(offsets.size() - 1);
+
+            std::vector<index_type> expected_indices;
+            for(unsigned int segment = 0; segment < segments; segment++)
+            {
+                const std::vector<index_type> segment_indices
+                    = get_expected_permutation<false, key_type, index_type>(keys,
+                                                                            offsets[segment],
+                                                                            offsets[segment + 1]);
+                expected_indices.insert(expected_indices.end(),
+                                        segment_indices.begin(),
+                                        segment_indices.end());
+            }
+
+            key_type*    d_keys;
+            key_type*    d_keys_output;
+            index_type*  d_indices_output;
+            offset_type* d_offsets;
+            const size_t allocated = std::max<size_t>(size, 1);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, allocated * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_keys_output, allocated * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices_output,
+                                                         allocated * sizeof(index_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(offset_type)));
+            HIP_CHECK(
+                hipMemcpy(d_keys, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::segmented_radix_argsort(nullptr,
+                                                       temp_storage_size_bytes,
+                                                       d_keys,
+                                                       d_keys_output,
+                                                       d_indices_output,
+                                                       static_cast<unsigned int>(size),
+                                                       segments,
+                                                       d_offsets,
+                                                       d_offsets + 1,
+                                                       0,
+                                                       8 * sizeof(key_type),
+                                                       stream,
+                                                       debug_synchronous));
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::segmented_radix_argsort(d_temp_storage,
+                                                       temp_storage_size_bytes,
+                                                       d_keys,
+                                                       d_keys_output,
+                                                       d_indices_output,
+                                                       static_cast<unsigned int>(size),
+                                                       segments,
+                                                       d_offsets,
+                                                       d_offsets + 1,
+                                                       0,
+                                                       8 * sizeof(key_type),
+                                                       stream,
+                                                       debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<index_type> indices_output(size);
+            HIP_CHECK(hipMemcpy(indices_output.data(),
+                                d_indices_output,
+                                size * sizeof(index_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(indices_output, expected_indices));
+
+            std::vector<key_type> expected_keys(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected_keys[i] = keys[expected_indices[i]];
+            }
+            std::vector<key_type> keys_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_indices_output));
+            HIP_CHECK(hipFree(d_offsets));
+        }
+    }
+}
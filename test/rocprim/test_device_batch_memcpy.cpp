@@ -648,3 +648,360 @@ TEST(RocprimDeviceBatchMemcpyTests, IteratorTest)
     HIP_CHECK(hipFree(d_data_out));
     HIP_CHECK(hipFree(d_offsets));
 }
+
+TEST(RocprimDeviceBatchMemcpyTests, BatchFill)
+{
+    using value_type = int;
+
+    constexpr unsigned int num_fills = 300;
+    constexpr unsigned int max_size  = 2048;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; ++seed_index)
+    {
+        seed_type seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+        std::mt19937_64 rng{seed_value};
+
+        // Sizes of all size classes, including empty fills
+        std::vector<unsigned int> h_sizes(num_fills);
+        test_utils::generate_random_data_n(h_sizes.begin(), num_fills, 0, max_size, rng);
+        std::vector<value_type> h_values(num_fills);
+        test_utils::generate_random_data_n(h_values.begin(), num_fills, -1000, 1000, rng);
+
+        std::vector<size_t> h_offsets(num_fills + 1, 0);
+        std::partial_sum(h_sizes.begin(), h_sizes.end(), h_offsets.begin() + 1);
+        const size_t total_size = h_offsets.back();
+
+        value_type*   d_output;
+        value_type**  d_destinations;
+        value_type*   d_values;
+        unsigned int* d_sizes;
+        HIP_CHECK(hipMalloc(&d_output, (total_size + 1) * sizeof(value_type)));
+        HIP_CHECK(hipMalloc(&d_destinations, num_fills * sizeof(value_type*)));
+        HIP_CHECK(hipMalloc(&d_values, num_fills * sizeof(value_type)));
+        HIP_CHECK(hipMalloc(&d_sizes, num_fills * sizeof(unsigned int)));
+
+        std::vector<value_type*> h_destinations(num_fills);
+        for(unsigned int i = 0; i < num_fills; ++i)
+        {
+            h_destinations[i] = d_output + h_offsets[i];
+        }
+        HIP_CHECK(hipMemcpy(d_destinations,
+                            h_destinations.data(),
+                            num_fills * sizeof(value_type*),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_values,
+                            h_values.data(),
+                            num_fills * sizeof(value_type),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_sizes,
+                            h_sizes.data(),
+                            num_fills * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        size_t temp_storage_bytes = 0;
+        HIP_CHECK(rocprim::batch_fill(nullptr,
+                                      temp_storage_bytes,
+                                      d_destinations,
+                                      d_values,
+                                      d_sizes,
+                                      num_fills));
+        void* d_temp_storage;
+        HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_bytes));
+        HIP_CHECK(rocprim::batch_fill(d_temp_storage,
+                                      temp_storage_bytes,
+                                      d_destinations,
+                                      d_values,
+                                      d_sizes,
+                                      num_fills));
+
+        std::vector<value_type> h_output(total_size);
+        HIP_CHECK(hipMemcpy(h_output.data(),
+                            d_output,
+                            total_size * sizeof(value_type),
+                            hipMemcpyDeviceToHost));
+
+        std::vector<value_type> expected(total_size);
+        for(unsigned int i = 0; i < num_fills; ++i)
+        {
+            std::fill(expected.begin() + h_offsets[i],
+                      expected.begin() + h_offsets[i + 1],
+                      h_values[i]);
+        }
+        test_utils::assert_eq(h_output, expected);
+
+        HIP_CHECK(hipFree(d_temp_storage));
+        HIP_CHECK(hipFree(d_sizes));
+        HIP_CHECK(hipFree(d_values));
+        HIP_CHECK(hipFree(d_destinations));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
+TEST(RocprimDeviceBatchMemcpyTests, BatchMemset)
+{
+    // Unaligned byte ranges of all size classes, every other one is left untouched
+    const unsigned int        num_memsets = 5;
+    std::vector<size_t>       h_offsets   = {0, 3, 40, 1040, 1101, 9000, 9001};
+    std::vector<unsigned int> h_sizes     = {3, 37, 1000, 61, 7899};
+    std::vector<int>          h_values    = {1, 0x7f, 0xff, 0x100 + 2, 3};
+    const size_t              total_bytes = h_offsets.back();
+
+    unsigned char*  d_output;
+    unsigned char** d_destinations;
+    int*            d_values;
+    unsigned int*   d_sizes;
+    HIP_CHECK(hipMalloc(&d_output, total_bytes));
+    HIP_CHECK(hipMalloc(&d_destinations, num_memsets * sizeof(unsigned char*)));
+    HIP_CHECK(hipMalloc(&d_values, num_memsets * sizeof(int)));
+    HIP_CHECK(hipMalloc(&d_sizes, num_memsets * sizeof(unsigned int)));
+    HIP_CHECK(hipMemset(d_output, 0xAA, total_bytes));
+
+    std::vector<unsigned char*> h_destinations(num_memsets);
+    for(unsigned int i = 0; i < num_memsets; ++i)
+    {
+        h_destinations[i] = d_output + h_offsets[i];
+    }
+    HIP_CHECK(hipMemcpy(d_destinations,
+                        h_destinations.data(),
+                        num_memsets * sizeof(unsigned char*),
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(
+        hipMemcpy(d_values, h_values.data(), num_memsets * sizeof(int), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_sizes,
+                        h_sizes.data(),
+                        num_memsets * sizeof(unsigned int),
+                        hipMemcpyHostToDevice));
+
+    size_t temp_storage_bytes = 0;
+    HIP_CHECK(rocprim::batch_memset(nullptr,
+                                    temp_storage_bytes,
+                                    d_destinations,
+                                    d_values,
+                                    d_sizes,
+                                    num_memsets));
+    void* d_temp_storage;
+    HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_bytes));
+    HIP_CHECK(rocprim::batch_memset(d_temp_storage,
+                                    temp_storage_bytes,
+                                    d_destinations,
+                                    d_values,
+                                    d_sizes,
+                                    num_memsets));
+
+    std::vector<unsigned char> h_output(total_bytes);
+    HIP_CHECK(hipMemcpy(h_output.data(), d_output, total_bytes, hipMemcpyDeviceToHost));
+
+    std::vector<unsigned char> expected(total_bytes, 0xAA);
+    for(unsigned int i = 0; i < num_memsets; ++i)
+    {
+        std::fill(expected.begin() + h_offsets[i],
+                  expected.begin() + h_offsets[i] + h_sizes[i],
+                  static_cast<unsigned char>(h_values[i]));
+    }
+    test_utils::assert_eq(h_output, expected);
+
+    HIP_CHECK(hipFree(d_temp_storage));
+    HIP_CHECK(hipFree(d_sizes));
+    HIP_CHECK(hipFree(d_values));
+    HIP_CHECK(hipFree(d_destinations));
+    HIP_CHECK(hipFree(d_output));
+}
+
+struct GetPage
+{
+    __host__ __device__ __forceinline__
+    unsigned char* operator()(unsigned int index) const
+    {
+        return d_pages + d_page_ids[index] * page_bytes;
+    }
+    unsigned char* d_pages;
+    unsigned int*  d_page_ids;
+    size_t         page_bytes;
+};
+
+TEST(RocprimDeviceBatchMemcpyTests, BatchMemcpy2D)
+{
+    const bool debug_synchronous = false;
+
+    // Gathers a column block of pages into rows of the output, the page of every row is read
+    // on the device.
+    const unsigned int num_pages  = 64;
+    const size_t       rows       = 13;
+    const size_t       page_pitch = 1029;
+    const size_t       page_bytes = rows * page_pitch;
+    const size_t       column     = 5;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; ++seed_index)
+    {
+        seed_type seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+        std::mt19937_64 rng{seed_value};
+
+        const unsigned int num_copies = std::uniform_int_distribution<unsigned int>(1, 200)(rng);
+        const size_t       width      = std::uniform_int_distribution<size_t>(1, 1000)(rng);
+        const size_t       out_pitch  = width + 3;
+
+        std::vector<unsigned char> h_pages(num_pages * page_bytes);
+        test_utils::generate_random_data_n(h_pages.begin(), h_pages.size(), 0, 255, rng);
+        std::vector<unsigned int> h_page_ids(num_copies);
+        test_utils::generate_random_data_n(h_page_ids.begin(),
+                                           num_copies,
+                                           0,
+                                           num_pages - 1,
+                                           rng);
+
+        unsigned char* d_pages;
+        unsigned char* d_output;
+        unsigned int*  d_page_ids;
+        const size_t   output_bytes = num_copies * rows * out_pitch;
+        HIP_CHECK(hipMalloc(&d_pages, h_pages.size()));
+        HIP_CHECK(hipMalloc(&d_output, output_bytes));
+        HIP_CHECK(hipMalloc(&d_page_ids, num_copies * sizeof(unsigned int)));
+        HIP_CHECK(hipMemcpy(d_pages, h_pages.data(), h_pages.size(), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_page_ids,
+                            h_page_ids.data(),
+                            num_copies * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemset(d_output, 0, output_bytes));
+
+        rocprim::counting_iterator<unsigned int> iota(0);
+        auto sources = rocprim::make_transform_iterator(
+            iota,
+            GetPage{d_pages + column, d_page_ids, page_bytes});
+
+        std::vector<unsigned char*> h_destinations(num_copies);
+        for(unsigned int i = 0; i < num_copies; ++i)
+        {
+            h_destinations[i] = d_output + i * rows * out_pitch;
+        }
+        unsigned char** d_destinations;
+        HIP_CHECK(hipMalloc(&d_destinations, num_copies * sizeof(unsigned char*)));
+        HIP_CHECK(hipMemcpy(d_destinations,
+                            h_destinations.data(),
+                            num_copies * sizeof(unsigned char*),
+                            hipMemcpyHostToDevice));
+
+        HIP_CHECK(rocprim::batch_memcpy_2d(sources,
+                                           rocprim::make_constant_iterator(page_pitch),
+                                           d_destinations,
+                                           rocprim::make_constant_iterator(out_pitch),
+                                           rocprim::make_constant_iterator(width),
+                                           rocprim::make_constant_iterator(rows),
+                                           num_copies,
+                                           hipStreamDefault,
+                                           debug_synchronous));
+
+        std::vector<unsigned char> h_output(output_bytes);
+        HIP_CHECK(hipMemcpy(h_output.data(), d_output, output_bytes, hipMemcpyDeviceToHost));
+
+        std::vector<unsigned char> expected(output_bytes, 0);
+        for(unsigned int i = 0; i < num_copies; ++i)
+        {
+            for(size_t row = 0; row < rows; ++row)
+            {
+                const size_t source = h_page_ids[i] * page_bytes + row * page_pitch + column;
+                std::copy(h_pages.begin() + source,
+                          h_pages.begin() + source + width,
+                          expected.begin() + (i * rows + row) * out_pitch);
+            }
+        }
+        test_utils::assert_eq(h_output, expected);
+
+        HIP_CHECK(hipFree(d_destinations));
+        HIP_CHECK(hipFree(d_page_ids));
+        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(d_pages));
+    }
+}
+
+TEST(RocprimDeviceBatchMemcpyTests, RemoteConfigToPinnedHost)
+{
+    using config = rocprim::batch_memcpy_remote_config<>;
+
+    // Sizes around the thresholds of the remote configuration
+    const std::vector<unsigned int> h_sizes
+        = {1, 15, 16, 17, 100, 4000, 16383, 16384, 16385, 70001, 0, 3};
+    const unsigned int num_copies = h_sizes.size();
+
+    std::vector<size_t> h_offsets(num_copies + 1, 0);
+    std::partial_sum(h_sizes.begin(), h_sizes.end(), h_offsets.begin() + 1);
+    const size_t total_bytes = h_offsets.back();
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; ++seed_index)
+    {
+        seed_type seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+        std::mt19937_64 rng{seed_value};
+
+        std::vector<unsigned char> h_input(total_bytes);
+        test_utils::generate_random_data_n(h_input.begin(), total_bytes, 0, 255, rng);
+
+        // The destinations are in pinned host memory, accessed by the kernels over the link
+        unsigned char* h_output;
+        unsigned char* h_output_device;
+        HIP_CHECK(hipHostMalloc(&h_output, total_bytes, hipHostMallocMapped));
+        HIP_CHECK(hipHostGetDevicePointer(reinterpret_cast<void**>(&h_output_device), h_output, 0));
+        std::fill(h_output, h_output + total_bytes, 0);
+
+        unsigned char*  d_input;
+        unsigned char** d_sources;
+        unsigned char** d_destinations;
+        unsigned int*   d_sizes;
+        HIP_CHECK(hipMalloc(&d_input, total_bytes));
+        HIP_CHECK(hipMalloc(&d_sources, num_copies * sizeof(unsigned char*)));
+        HIP_CHECK(hipMalloc(&d_destinations, num_copies * sizeof(unsigned char*)));
+        HIP_CHECK(hipMalloc(&d_sizes, num_copies * sizeof(unsigned int)));
+        HIP_CHECK(hipMemcpy(d_input, h_input.data(), total_bytes, hipMemcpyHostToDevice));
+
+        std::vector<unsigned char*> h_sources(num_copies);
+        std::vector<unsigned char*> h_destinations(num_copies);
+        for(unsigned int i = 0; i < num_copies; ++i)
+        {
+            h_sources[i]      = d_input + h_offsets[i];
+            h_destinations[i] = h_output_device + h_offsets[i];
+        }
+        HIP_CHECK(hipMemcpy(d_sources,
+                            h_sources.data(),
+                            num_copies * sizeof(unsigned char*),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_destinations,
+                            h_destinations.data(),
+                            num_copies * sizeof(unsigned char*),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_sizes,
+                            h_sizes.data(),
+                            num_copies * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        size_t temp_storage_bytes = 0;
+        HIP_CHECK(rocprim::batch_memcpy<config>(nullptr,
+                                                temp_storage_bytes,
+                                                d_sources,
+                                                d_destinations,
+                                                d_sizes,
+                                                num_copies));
+        void* d_temp_storage;
+        HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_bytes));
+        HIP_CHECK(rocprim::batch_memcpy<config>(d_temp_storage,
+                                                temp_storage_bytes,
+                                                d_sources,
+                                                d_destinations,
+                                                d_sizes,
+                                                num_copies));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        const std::vector<unsigned char> output(h_output, h_output + total_bytes);
+        test_utils::assert_eq(output, h_input);
+
+        HIP_CHECK(hipFree(d_temp_storage));
+        HIP_CHECK(hipFree(d_sizes));
+        HIP_CHECK(hipFree(d_destinations));
+        HIP_CHECK(hipFree(d_sources));
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipHostFree(h_output));
+    }
+}
@@ -0,0 +1,986 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_batched.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+
+// Problems are stored in one buffer with gaps between them, so they are not contiguous.
+template<class T>
+struct batch
+{
+    std::vector<T>            data;
+    std::vector<size_t>       offsets;
+    std::vector<unsigned int> sizes;
+
+    static constexpr size_t gap = 7;
+
+    batch(const unsigned int num_problems,
+          const unsigned int max_size,
+          const unsigned int seed_value)
+    {
+        sizes = test_utils::get_random_data<unsigned int>(num_problems, 0, max_size, seed_value);
+        size_t offset = 0;
+        for(const unsigned int size : sizes)
+        {
+            offsets.push_back(offset);
+            offset += size + gap;
+        }
+        data = test_utils::get_random_data<T>(offset, 0, 100, seed_value + 1);
+    }
+
+    typename std::vector<T>::iterator begin(const size_t problem)
+    {
+        return data.begin() + offsets[problem];
+    }
+
+    typename std::vector<T>::iterator end(const size_t problem)
+    {
+        return begin(problem) + sizes[problem];
+    }
+
+    template<class U>
+    std::vector<U*> device_pointers(U* d_data) const
+    {
+        std::vector<U*> pointers;
+        for(const size_t offset : offsets)
+        {
+            pointers.push_back(d_data + offset);
+        }
+        return pointers;
+    }
+};
+
+template<class T>
+T* copy_to_device(const std::vector<T>& h_data)
+{
+    T* d_data;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_data,
+                                                 std::max<size_t>(h_data.size(), 1) * sizeof(T)));
+    HIP_CHECK(
+        hipMemcpy(d_data, h_data.data(), h_data.size() * sizeof(T), hipMemcpyHostToDevice));
+    return d_data;
+}
+
+template<class T>
+std::vector<T> copy_to_host(const T* d_data, const size_t size)
+{
+    std::vector<T> h_data(size);
+    HIP_CHECK(hipMemcpy(h_data.data(), d_data, size * sizeof(T), hipMemcpyDeviceToHost));
+    return h_data;
+}
+
+} // namespace
+
+template<class T>
+class RocprimDeviceBatchedTests : public ::testing::Test
+{
+public:
+    using type = T;
+};
+
+using RocprimDeviceBatchedTestsTypes = ::testing::Types<int, unsigned long long>;
+
+TYPED_TEST_SUITE(RocprimDeviceBatchedTests, RocprimDeviceBatchedTestsTypes);
+
+TYPED_TEST(RocprimDeviceBatchedTests, Reduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = typename TestFixture::type;
+    const hipStream_t stream     = 0; // default
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(unsigned int num_problems : {0u, 1u, 53u, 1000u})
+        {
+            SCOPED_TRACE(testing::Message() << "with num_problems = " << num_problems);
+
+            batch<T>       problems(num_problems, 10000, seed_value);
+            std::vector<T> expected;
+            for(unsigned int i = 0; i < num_problems; i++)
+            {
+                expected.push_back(std::accumulate(problems.begin(i), problems.end(i), T(10)));
+            }
+
+            T*            d_data   = copy_to_device(problems.data);
+            T**           d_inputs = copy_to_device(problems.device_pointers(d_data));
+            unsigned int* d_sizes  = copy_to_device(problems.sizes);
+            T*            d_output = copy_to_device(std::vector<T>(num_problems));
+
+            size_t storage_size;
+            HIP_CHECK(rocprim::batched_reduce(nullptr,
+                                              storage_size,
+                                              d_inputs,
+                                              d_output,
+                                              d_sizes,
+                                              num_problems,
+                                              rocprim::plus<T>(),
+                                              T(10),
+                                              stream,
+                                              debug_synchronous));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+            HIP_CHECK(rocprim::batched_reduce(d_temp_storage,
+                                              storage_size,
+                                              d_inputs,
+                                              d_output,
+                                              d_sizes,
+                                              num_problems,
+                                              rocprim::plus<T>(),
+                                              T(10),
+                                              stream,
+                                              debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(copy_to_host(d_output, num_problems), expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_data));
+            HIP_CHECK(hipFree(d_inputs));
+            HIP_CHECK(hipFree(d_sizes));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceBatchedTests, Scan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = typename TestFixture::type;
+    const hipStream_t stream     = 0; // default
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(bool exclusive : {false, true})
+        {
+            SCOPED_TRACE(testing::Message() << "with exclusive = " << exclusive);
+
+            const unsigned int num_problems = 300;
+
+            batch<T>       problems(num_problems, 10000, seed_value);
+            std::vector<T> expected = problems.data;
+            for(unsigned int i = 0; i < num_problems; i++)
+            {
+                const auto output = expected.begin() + problems.offsets[i];
+                if(exclusive)
+                {
+                    T prefix = T(5);
+                    std::transform(problems.begin(i),
+                                   problems.end(i),
+                                   output,
+                                   [&prefix](const T value)
+                                   {
+                                       const T result = prefix;
+                                       prefix += value;
+                                       return result;
+                                   });
+                }
+                else
+                {
+                    std::partial_sum(problems.begin(i), problems.end(i), output);
+                }
+            }
+
+            T*  d_data    = copy_to_device(problems.data);
+            T*  d_output  = copy_to_device(problems.data);
+            T** d_inputs  = copy_to_device(problems.device_pointers(d_data));
+            T** d_outputs = copy_to_device(problems.device_pointers(d_output));
+            unsigned int* d_sizes = copy_to_device(problems.sizes);
+
+            const auto run = [&](void* d_temp_storage, size_t& storage_size)
+            {
+                return exclusive ? rocprim::batched_exclusive_scan(d_temp_storage,
+                                                                   storage_size,
+                                                                   d_inputs,
+                                                                   d_outputs,
+                                                                   d_sizes,
+                                                                   num_problems,
+                                                                   T(5),
+                                                                   rocprim::plus<T>(),
+                                                                   stream,
+                                                                   debug_synchronous)
+                                 : rocprim::batched_inclusive_scan(d_temp_storage,
+                                                                   storage_size,
+                                                                   d_inputs,
+                                                                   d_outputs,
+                                                                   d_sizes,
+                                                                   num_problems,
+                                                                   rocprim::plus<T>(),
+                                                                   stream,
+                                                                   debug_synchronous);
+            };
+
+            size_t storage_size;
+            HIP_CHECK(run(nullptr, storage_size));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+            HIP_CHECK(run(d_temp_storage, storage_size));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // The gaps between the problems are not written
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(copy_to_host(d_output, expected.size()), expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_data));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_inputs));
+            HIP_CHECK(hipFree(d_outputs));
+            HIP_CHECK(hipFree(d_sizes));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceBatchedTests, RadixSort)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = typename TestFixture::type;
+    using value_type             = unsigned int;
+    const hipStream_t stream     = 0; // default
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(bool descending : {false, true})
+        {
+            SCOPED_TRACE(testing::Message() << "with descending = " << descending);
+
+            const unsigned int num_problems = 300;
+
+            // 4096 is the tile size of the default config
+            batch<T> problems(num_problems, 4096, seed_value);
+
+            // Values are the indices of the keys in their problem, so the sort must be stable
+            std::vector<value_type> values(problems.data.size());
+            for(unsigned int i = 0; i < num_problems; i++)
+            {
+                std::iota(values.begin() + problems.offsets[i],
+                          values.begin() + problems.offsets[i] + problems.sizes[i],
+                          0u);
+            }
+
+            std::vector<T>          expected_keys   = problems.data;
+            std::vector<value_type> expected_values = values;
+            for(unsigned int i = 0; i < num_problems; i++)
+            {
+                std::vector<std::pair<T, value_type>> pairs;
+                for(unsigned int j = 0; j < problems.sizes[i]; j++)
+                {
+                    const size_t index = problems.offsets[i] + j;
+                    pairs.emplace_back(problems.data[index], values[index]);
+                }
+                std::stable_sort(pairs.begin(),
+                                 pairs.end(),
+                                 [descending](const std::pair<T, value_type>& a,
+                                              const std::pair<T, value_type>& b)
+                                 { return descending ? b.first < a.first : a.first < b.first; });
+                for(unsigned int j = 0; j < problems.sizes[i]; j++)
+                {
+                    const size_t index     = problems.offsets[i] + j;
+                    expected_keys[index]   = pairs[j].first;
+                    expected_values[index] = pairs[j].second;
+                }
+            }
+
+            T*          d_keys_input    = copy_to_device(problems.data);
+            T*          d_keys_output   = copy_to_device(problems.data);
+            value_type* d_values_input  = copy_to_device(values);
+            value_type* d_values_output = copy_to_device(values);
+
+            T** d_keys_inputs  = copy_to_device(problems.device_pointers(d_keys_input));
+            T** d_keys_outputs = copy_to_device(problems.device_pointers(d_keys_output));
+            value_type** d_values_inputs
+                = copy_to_device(problems.device_pointers(d_values_input));
+            value_type** d_values_outputs
+                = copy_to_device(problems.device_pointers(d_values_output));
+            unsigned int* d_sizes = copy_to_device(problems.sizes);
+
+            const auto run = [&](void* d_temp_storage, size_t& storage_size)
+            {
+                return descending ? rocprim::batched_radix_sort_pairs_desc(d_temp_storage,
+                                                                           storage_size,
+                                                                           d_keys_inputs,
+                                                                           d_keys_outputs,
+                                                                           d_values_inputs,
+                                                                           d_values_outputs,
+                                                                           d_sizes,
+                                                                           num_problems,
+                                                                           0,
+                                                                           8 * sizeof(T),
+                                                                           stream,
+                                                                           debug_synchronous)
+                                  : rocprim::batched_radix_sort_pairs(d_temp_storage,
+                                                                      storage_size,
+                                                                      d_keys_inputs,
+                                                                      d_keys_outputs,
+                                                                      d_values_inputs,
+                                                                      d_values_outputs,
+                                                                      d_sizes,
+                                                                      num_problems,
+                                                                      0,
+                                                                      8 * sizeof(T),
+                                                                      stream,
+                                                                      debug_synchronous);
+            };
+
+            size_t storage_size;
+            HIP_CHECK(run(nullptr, storage_size));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+            HIP_CHECK(run(d_temp_storage, storage_size));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(copy_to_host(d_keys_output, expected_keys.size()),
+                                      expected_keys));
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(copy_to_host(d_values_output, expected_values.size()),
+                                      expected_values));
+
+            // Keys only, in place
+            HIP_CHECK(descending ? rocprim::batched_radix_sort_keys_desc(d_temp_storage,
+                                                                         storage_size,
+                                                                         d_keys_inputs,
+                                                                         d_keys_inputs,
+                                                                         d_sizes,
+                                                                         num_problems,
+                                                                         0,
+                                                                         8 * sizeof(T),
+                                                                         stream,
+                                                                         debug_synchronous)
+                                 : rocprim::batched_radix_sort_keys(d_temp_storage,
+                                                                    storage_size,
+                                                                    d_keys_inputs,
+                                                                    d_keys_inputs,
+                                                                    d_sizes,
+                                                                    num_problems,
+                                                                    0,
+                                                                    8 * sizeof(T),
+                                                                    stream,
+                                                                    debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(copy_to_host(d_keys_input, expected_keys.size()),
+                                      expected_keys));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_keys_inputs));
+            HIP_CHECK(hipFree(d_keys_outputs));
+            HIP_CHECK(hipFree(d_values_inputs));
+            HIP_CHECK(hipFree(d_values_outputs));
+            HIP_CHECK(hipFree(d_sizes));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceBatchedTests, RadixSortStrided)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = typename TestFixture::type;
+    using value_type             = unsigned int;
+    const hipStream_t stream     = 0; // default
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Sorted by warps, by blocks, and in several passes by blocks
+        for(unsigned int problem_size : {1u, 10u, 200u, 1000u, 4096u, 10000u})
+        {
+            SCOPED_TRACE(testing::Message() << "with problem_size = " << problem_size);
+
+            const unsigned int num_problems = 50;
+
+            // Rows with gaps between them, and the columns of a row-major matrix
+            for(bool columns : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with columns = " << columns);
+
+                const size_t problem_stride = columns ? 1 : problem_size + 3;
+                const size_t item_stride    = columns ? num_problems : 1;
+                const size_t size
+                    = (num_problems - 1) * problem_stride + (problem_size - 1) * item_stride + 1;
+
+                for(bool descending : {false, true})
+                {
+                    SCOPED_TRACE(testing::Message() << "with descending = " << descending);
+
+                    const std::vector<T> keys
+                        = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+                    // Values are the indices of the keys in their problem to check stability
+                    std::vector<value_type> values(size);
+                    for(unsigned int i = 0; i < num_problems; i++)
+                    {
+                        for(unsigned int j = 0; j < problem_size; j++)
+                        {
+                            values[i * problem_stride + j * item_stride] = j;
+                        }
+                    }
+
+                    std::vector<T>          expected_keys   = keys;
+                    std::vector<value_type> expected_values = values;
+                    for(unsigned int i = 0; i < num_problems; i++)
+                    {
+                        std::vector<std::pair<T, value_type>> pairs;
+                        for(unsigned int j = 0; j < problem_size; j++)
+                        {
+                            const size_t index = i * problem_stride + j * item_stride;
+                            pairs.emplace_back(keys[index], values[index]);
+                        }
+                        std::stable_sort(
+                            pairs.begin(),
+                            pairs.end(),
+                            [descending](const std::pair<T, value_type>& a,
+                                         const std::pair<T, value_type>& b)
+                            { return descending ? b.first < a.first : a.first < b.first; });
+                        for(unsigned int j = 0; j < problem_size; j++)
+                        {
+                            const size_t index     = i * problem_stride + j * item_stride;
+                            expected_keys[index]   = pairs[j].first;
+                            expected_values[index] = pairs[j].second;
+                        }
+                    }
+
+                    T*          d_keys_input    = copy_to_device(keys);
+                    T*          d_keys_output   = copy_to_device(keys);
+                    value_type* d_values_input  = copy_to_device(values);
+                    value_type* d_values_output = copy_to_device(values);
+
+                    const auto run = [&](void* d_temp_storage, size_t& storage_size)
+                    {
+                        return descending ? rocprim::batched_radix_sort_pairs_desc_strided(
+                                   d_temp_storage,
+                                   storage_size,
+                                   d_keys_input,
+                                   d_keys_output,
+                                   d_values_input,
+                                   d_values_output,
+                                   num_problems,
+                                   problem_size,
+                                   problem_stride,
+                                   item_stride,
+                                   0,
+                                   8 * sizeof(T),
+                                   stream,
+                                   debug_synchronous)
+                                          : rocprim::batched_radix_sort_pairs_strided(
+                                              d_temp_storage,
+                                              storage_size,
+                                              d_keys_input,
+                                              d_keys_output,
+                                              d_values_input,
+                                              d_values_output,
+                                              num_problems,
+                                              problem_size,
+                                              problem_stride,
+                                              item_stride,
+                                              0,
+                                              8 * sizeof(T),
+                                              stream,
+                                              debug_synchronous);
+                    };
+
+                    size_t storage_size;
+                    HIP_CHECK(run(nullptr, storage_size));
+                    void* d_temp_storage;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+                    HIP_CHECK(run(d_temp_storage, storage_size));
+                    HIP_CHECK(hipGetLastError());
+                    HIP_CHECK(hipDeviceSynchronize());
+
+                    // The keys between the problems are not written
+                    ASSERT_NO_FATAL_FAILURE(
+                        test_utils::assert_eq(copy_to_host(d_keys_output, size), expected_keys));
+                    ASSERT_NO_FATAL_FAILURE(
+                        test_utils::assert_eq(copy_to_host(d_values_output, size),
+                                              expected_values));
+
+                    // Keys only
+                    HIP_CHECK(hipMemcpy(d_keys_output,
+                                        keys.data(),
+                                        size * sizeof(T),
+                                        hipMemcpyHostToDevice));
+                    HIP_CHECK(descending
+                                  ? rocprim::batched_radix_sort_keys_desc_strided(d_temp_storage,
+                                                                                  storage_size,
+                                                                                  d_keys_input,
+                                                                                  d_keys_output,
+                                                                                  num_problems,
+                                                                                  problem_size,
+                                                                                  problem_stride,
+                                                                                  item_stride,
+                                                                                  0,
+                                                                                  8 * sizeof(T),
+                                                                                  stream,
+                                                                                  debug_synchronous)
+                                  : rocprim::batched_radix_sort_keys_strided(d_temp_storage,
+                                                                             storage_size,
+                                                                             d_keys_input,
+                                                                             d_keys_output,
+                                                                             num_problems,
+                                                                             problem_size,
+                                                                             problem_stride,
+                                                                             item_stride,
+                                                                             0,
+                                                                             8 * sizeof(T),
+                                                                             stream,
+                                                                             debug_synchronous));
+                    HIP_CHECK(hipGetLastError());
+                    HIP_CHECK(hipDeviceSynchronize());
+
+                    ASSERT_NO_FATAL_FAILURE(
+                        test_utils::assert_eq(copy_to_host(d_keys_output, size), expected_keys));
+
+                    HIP_CHECK(hipFree(d_temp_storage));
+                    HIP_CHECK(hipFree(d_keys_input));
+                    HIP_CHECK(hipFree(d_keys_output));
+                    HIP_CHECK(hipFree(d_values_input));
+                    HIP_CHECK(hipFree(d_values_output));
+                }
+            }
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceBatchedTests, Histogram)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = typename TestFixture::type;
+    using counter_type           = unsigned int;
+    const hipStream_t stream     = 0; // default
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(bool even : {true, false})
+        {
+            SCOPED_TRACE(testing::Message() << "with even = " << even);
+
+            const unsigned int num_problems = 500;
+            batch<T>           problems(num_problems, 5000, seed_value);
+
+            // Every 7th problem has more bins than fit in shared memory
+            std::vector<unsigned int> levels;
+            std::vector<T>            lower_levels;
+            std::vector<T>            upper_levels;
+            std::vector<T>            level_values;
+            std::vector<size_t>       level_offsets;
+            std::vector<size_t>       histogram_offsets;
+            size_t                    total_bins = 0;
+            for(unsigned int i = 0; i < num_problems; i++)
+            {
+                const unsigned int bins  = i % 7 == 3 ? 3000 : 1 + i % 20;
+                const T            scale = i % 7 == 3 ? T(1) : T(1 + i % 3);
+                levels.push_back(bins + 1);
+                lower_levels.push_back(T(i % 5));
+                upper_levels.push_back(T(i % 5) + T(bins) * scale);
+                level_offsets.push_back(level_values.size());
+                for(unsigned int j = 0; j <= bins; j++)
+                {
+                    level_values.push_back(T(i % 3) + T(j) * T(3 + i % 5));
+                }
+                histogram_offsets.push_back(total_bins);
+                total_bins += bins;
+            }
+
+            std::vector<counter_type> expected(total_bins, 0);
+            for(unsigned int i = 0; i < num_problems; i++)
+            {
+                const unsigned int bins   = levels[i] - 1;
+                const auto         bounds = level_values.begin() + level_offsets[i];
+                for(auto it = problems.begin(i); it != problems.end(i); ++it)
+                {
+                    const T      sample = *it;
+                    unsigned int bin    = bins;
+                    if(even && sample >= lower_levels[i] && sample < upper_levels[i])
+                    {
+                        bin = static_cast<unsigned int>((sample - lower_levels[i])
+                                                        / ((upper_levels[i] - lower_levels[i])
+                                                           / T(bins)));
+                    }
+                    else if(!even)
+                    {
+                        bin = static_cast<unsigned int>(
+                                  std::upper_bound(bounds, bounds + bins + 1, sample) - bounds)
+                              - 1;
+                    }
+                    if(bin < bins)
+                    {
+                        expected[histogram_offsets[i] + bin]++;
+                    }
+                }
+            }
+
+            T*            d_data         = copy_to_device(problems.data);
+            T**           d_samples      = copy_to_device(problems.device_pointers(d_data));
+            unsigned int* d_sizes        = copy_to_device(problems.sizes);
+            unsigned int* d_levels       = copy_to_device(levels);
+            T*            d_lower_levels = copy_to_device(lower_levels);
+            T*            d_upper_levels = copy_to_device(upper_levels);
+            T*            d_level_values = copy_to_device(level_values);
+            // The histograms are not cleared before the call
+            counter_type* d_histogram = copy_to_device(std::vector<counter_type>(total_bins, 77));
+
+            std::vector<T*>            level_pointers;
+            std::vector<counter_type*> histogram_pointers;
+            for(unsigned int i = 0; i < num_problems; i++)
+            {
+                level_pointers.push_back(d_level_values + level_offsets[i]);
+                histogram_pointers.push_back(d_histogram + histogram_offsets[i]);
+            }
+            T**            d_level_pointers     = copy_to_device(level_pointers);
+            counter_type** d_histogram_pointers = copy_to_device(histogram_pointers);
+
+            const auto run = [&](void* d_temp_storage, size_t& storage_size)
+            {
+                return even ? rocprim::batched_histogram_even(d_temp_storage,
+                                                              storage_size,
+                                                              d_samples,
+                                                              d_sizes,
+                                                              d_histogram_pointers,
+                                                              d_levels,
+                                                              d_lower_levels,
+                                                              d_upper_levels,
+                                                              num_problems,
+                                                              stream,
+                                                              debug_synchronous)
+                            : rocprim::batched_histogram_range(d_temp_storage,
+                                                               storage_size,
+                                                               d_samples,
+                                                               d_sizes,
+                                                               d_histogram_pointers,
+                                                               d_levels,
+                                                               d_level_pointers,
+                                                               num_problems,
+                                                               stream,
+                                                               debug_synchronous);
+            };
+
+            size_t storage_size;
+            HIP_CHECK(run(nullptr, storage_size));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+            HIP_CHECK(run(d_temp_storage, storage_size));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(copy_to_host(d_histogram, total_bins), expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_data));
+            HIP_CHECK(hipFree(d_samples));
+            HIP_CHECK(hipFree(d_sizes));
+            HIP_CHECK(hipFree(d_levels));
+            HIP_CHECK(hipFree(d_lower_levels));
+            HIP_CHECK(hipFree(d_upper_levels));
+            HIP_CHECK(hipFree(d_level_values));
+            HIP_CHECK(hipFree(d_histogram));
+            HIP_CHECK(hipFree(d_level_pointers));
+            HIP_CHECK(hipFree(d_histogram_pointers));
+        }
+    }
+}
+
+// Narrow arrays split the columns into chunks of rows, wide ones have a block per row
+const std::vector<std::pair<unsigned int, unsigned int>> pitched_shapes
+    = {{0, 10}, {10, 0}, {1, 1}, {5000, 3}, {300, 300}, {7, 5000}};
+
+TYPED_TEST(RocprimDeviceBatchedTests, PitchedReduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = typename TestFixture::type;
+    const hipStream_t stream     = 0; // default
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const auto& shape : pitched_shapes)
+        {
+            const unsigned int rows    = shape.first;
+            const unsigned int columns = shape.second;
+            const size_t       pitch   = columns + 5;
+            SCOPED_TRACE(testing::Message() << "with rows = " << rows << ", columns = " << columns);
+
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(rows * pitch, 0, 100, seed_value);
+            std::vector<T> expected_rows(rows, T(5));
+            std::vector<T> expected_columns(columns, T(5));
+            for(unsigned int i = 0; i < rows; i++)
+            {
+                for(unsigned int j = 0; j < columns; j++)
+                {
+                    expected_rows[i] += input[i * pitch + j];
+                    expected_columns[j] += input[i * pitch + j];
+                }
+            }
+
+            T* d_input   = copy_to_device(input);
+            T* d_rows    = copy_to_device(std::vector<T>(rows));
+            T* d_columns = copy_to_device(std::vector<T>(columns));
+
+            const auto run = [&](void* d_temp_storage, size_t& storage_size, const bool by_rows)
+            {
+                return by_rows ? rocprim::row_reduce(d_temp_storage,
+                                                     storage_size,
+                                                     d_input,
+                                                     d_rows,
+                                                     rows,
+                                                     columns,
+                                                     pitch,
+                                                     rocprim::plus<T>(),
+                                                     T(5),
+                                                     stream,
+                                                     debug_synchronous)
+                               : rocprim::column_reduce(d_temp_storage,
+                                                        storage_size,
+                                                        d_input,
+                                                        d_columns,
+                                                        rows,
+                                                        columns,
+                                                        pitch,
+                                                        rocprim::plus<T>(),
+                                                        T(5),
+                                                        stream,
+                                                        debug_synchronous);
+            };
+
+            for(bool by_rows : {true, false})
+            {
+                size_t storage_size;
+                HIP_CHECK(run(nullptr, storage_size, by_rows));
+                void* d_temp_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+                HIP_CHECK(run(d_temp_storage, storage_size, by_rows));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(copy_to_host(d_rows, rows), expected_rows));
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(copy_to_host(d_columns, columns), expected_columns));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_rows));
+            HIP_CHECK(hipFree(d_columns));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceBatchedTests, PitchedScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = typename TestFixture::type;
+    const hipStream_t stream     = 0; // default
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const auto& shape : pitched_shapes)
+        {
+            const unsigned int rows         = shape.first;
+            const unsigned int columns      = shape.second;
+            const size_t       input_pitch  = columns + 5;
+            const size_t       output_pitch = columns + 2;
+            SCOPED_TRACE(testing::Message() << "with rows = " << rows << ", columns = " << columns);
+
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(rows * input_pitch, 0, 100, seed_value);
+
+            for(bool by_rows : {true, false})
+            {
+                for(bool exclusive : {false, true})
+                {
+                    SCOPED_TRACE(testing::Message() << "with by_rows = " << by_rows
+                                                    << ", exclusive = " << exclusive);
+
+                    // The padding of the output rows is not written
+                    std::vector<T> expected(rows * output_pitch, T(0));
+                    const unsigned int lines  = by_rows ? rows : columns;
+                    const unsigned int length = by_rows ? columns : rows;
+                    for(unsigned int line = 0; line < lines; line++)
+                    {
+                        T prefix = exclusive ? T(5) : T(0);
+                        for(unsigned int k = 0; k < length; k++)
+                        {
+                            const unsigned int i     = by_rows ? line : k;
+                            const unsigned int j     = by_rows ? k : line;
+                            const T            value = input[i * input_pitch + j];
+                            expected[i * output_pitch + j] = exclusive ? prefix : prefix + value;
+                            prefix += value;
+                        }
+                    }
+
+                    T* d_input  = copy_to_device(input);
+                    T* d_output = copy_to_device(std::vector<T>(rows * output_pitch, T(0)));
+
+                    const auto run = [&](void* d_temp_storage, size_t& storage_size)
+                    {
+                        if(by_rows)
+                        {
+                            return exclusive ? rocprim::row_exclusive_scan(d_temp_storage,
+                                                                           storage_size,
+                                                                           d_input,
+                                                                           d_output,
+                                                                           rows,
+                                                                           columns,
+                                                                           input_pitch,
+                                                                           output_pitch,
+                                                                           T(5),
+                                                                           rocprim::plus<T>(),
+                                                                           stream,
+                                                                           debug_synchronous)
+                                             : rocprim::row_inclusive_scan(d_temp_storage,
+                                                                           storage_size,
+                                                                           d_input,
+                                                                           d_output,
+                                                                           rows,
+                                                                           columns,
+                                                                           input_pitch,
+                                                                           output_pitch,
+                                                                           rocprim::plus<T>(),
+                                                                           stream,
+                                                                           debug_synchronous);
+                        }
+                        return exclusive ? rocprim::column_exclusive_scan(d_temp_storage,
+                                                                          storage_size,
+                                                                          d_input,
+                                                                          d_output,
+                                                                          rows,
+                                                                          columns,
+                                                                          input_pitch,
+                                                                          output_pitch,
+                                                                          T(5),
+                                                                          rocprim::plus<T>(),
+                                                                          stream,
+                                                                          debug_synchronous)
+                                         : rocprim::column_inclusive_scan(d_temp_storage,
+                                                                          storage_size,
+                                                                          d_input,
+                                                                          d_output,
+                                                                          rows,
+                                                                          columns,
+                                                                          input_pitch,
+                                                                          output_pitch,
+                                                                          rocprim::plus<T>(),
+                                                                          stream,
+                                                                          debug_synchronous);
+                    };
+
+                    size_t storage_size;
+                    HIP_CHECK(run(nullptr, storage_size));
+                    void* d_temp_storage;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+                    HIP_CHECK(run(d_temp_storage, storage_size));
+                    HIP_CHECK(hipGetLastError());
+                    HIP_CHECK(hipDeviceSynchronize());
+
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(
+                        copy_to_host(d_output, expected.size()),
+                        expected));
+
+                    HIP_CHECK(hipFree(d_temp_storage));
+                    HIP_CHECK(hipFree(d_input));
+                    HIP_CHECK(hipFree(d_output));
+                }
+            }
+        }
+    }
+}
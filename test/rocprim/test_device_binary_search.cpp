@@ -515,3 +515,318 @@ TYPED_TEST(RocprimDeviceBinarySearch, BinarySearch)
         HIP_CHECK(hipStreamDestroy(stream));
     }
 }
+
+TYPED_TEST(RocprimDeviceBinarySearch, SearchIndex)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using haystack_type   = typename TestFixture::params::haystack_type;
+    using needle_type     = typename TestFixture::params::needle_type;
+    using output_type     = typename TestFixture::params::output_type;
+    using compare_op_type = typename TestFixture::params::compare_op_type;
+
+    const hipStream_t stream            = 0;
+    const bool        debug_synchronous = false;
+
+    compare_op_type compare_op;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const size_t haystack_size = size;
+            const size_t needles_size  = (size_t)std::sqrt(size);
+            const size_t d             = haystack_size / 100;
+
+            // Generate data
+            std::vector<haystack_type> haystack
+                = test_utils::get_random_data<haystack_type>(haystack_size,
+                                                             0,
+                                                             haystack_size + 2 * d,
+                                                             seed_value);
+            std::sort(haystack.begin(), haystack.end(), compare_op);
+
+            // Use a narrower range for needles for checking out-of-haystack cases
+            std::vector<needle_type> needles
+                = test_utils::get_random_data<needle_type>(needles_size,
+                                                           d,
+                                                           haystack_size + d,
+                                                           seed_value);
+
+            haystack_type* d_haystack;
+            needle_type*   d_needles;
+            output_type*   d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_haystack,
+                                                         haystack_size * sizeof(haystack_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_needles, needles_size * sizeof(needle_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_output, needles_size * sizeof(output_type)));
+            HIP_CHECK(hipMemcpy(d_haystack,
+                                haystack.data(),
+                                haystack_size * sizeof(haystack_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_needles,
+                                needles.data(),
+                                needles_size * sizeof(needle_type),
+                                hipMemcpyHostToDevice));
+
+            // Calculate expected results on host
+            std::vector<output_type> expected_lower(needles_size);
+            std::vector<output_type> expected_upper(needles_size);
+            std::vector<output_type> expected_found(needles_size);
+            for(size_t i = 0; i < needles_size; i++)
+            {
+                expected_lower[i]
+                    = std::lower_bound(haystack.begin(), haystack.end(), needles[i], compare_op)
+                      - haystack.begin();
+                expected_upper[i]
+                    = std::upper_bound(haystack.begin(), haystack.end(), needles[i], compare_op)
+                      - haystack.begin();
+                expected_found[i]
+                    = std::binary_search(haystack.begin(), haystack.end(), needles[i], compare_op);
+            }
+
+            void*  d_index_storage = nullptr;
+            size_t index_storage_bytes;
+            HIP_CHECK(rocprim::search_index_build(d_index_storage,
+                                                  index_storage_bytes,
+                                                  d_haystack,
+                                                  haystack_size,
+                                                  stream,
+                                                  debug_synchronous));
+
+            ASSERT_GT(index_storage_bytes, 0);
+
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_index_storage, index_storage_bytes));
+
+            HIP_CHECK(rocprim::search_index_build(d_index_storage,
+                                                  index_storage_bytes,
+                                                  d_haystack,
+                                                  haystack_size,
+                                                  stream,
+                                                  debug_synchronous));
+
+            std::vector<output_type> output(needles_size);
+
+            // The same index is used by all searches
+            HIP_CHECK(rocprim::search_index_lower_bound(d_index_storage,
+                                                        index_storage_bytes,
+                                                        d_haystack,
+                                                        d_needles,
+                                                        d_output,
+                                                        haystack_size,
+                                                        needles_size,
+                                                        compare_op,
+                                                        stream,
+                                                        debug_synchronous));
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                needles_size * sizeof(output_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_lower));
+
+            HIP_CHECK(rocprim::search_index_upper_bound(d_index_storage,
+                                                        index_storage_bytes,
+                                                        d_haystack,
+                                                        d_needles,
+                                                        d_output,
+                                                        haystack_size,
+                                                        needles_size,
+                                                        compare_op,
+                                                        stream,
+                                                        debug_synchronous));
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                needles_size * sizeof(output_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_upper));
+
+            HIP_CHECK(rocprim::search_index_binary_search(d_index_storage,
+                                                          index_storage_bytes,
+                                                          d_haystack,
+                                                          d_needles,
+                                                          d_output,
+                                                          haystack_size,
+                                                          needles_size,
+                                                          compare_op,
+                                                          stream,
+                                                          debug_synchronous));
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                needles_size * sizeof(output_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_found));
+
+            HIP_CHECK(hipFree(d_index_storage));
+            HIP_CHECK(hipFree(d_haystack));
+            HIP_CHECK(hipFree(d_needles));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceBinarySearch, SortedNeedles)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using haystack_type   = typename TestFixture::params::haystack_type;
+    using needle_type     = typename TestFixture::params::needle_type;
+    using output_type     = typename TestFixture::params::output_type;
+    using compare_op_type = typename TestFixture::params::compare_op_type;
+
+    const hipStream_t stream            = 0;
+    const bool        debug_synchronous = false;
+
+    compare_op_type compare_op;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Many needles, which is the use case of the merge
+            const size_t haystack_size = size;
+            const size_t needles_size  = size / 2;
+            const size_t d             = haystack_size / 100;
+
+            // Generate data
+            std::vector<haystack_type> haystack
+                = test_utils::get_random_data<haystack_type>(haystack_size,
+                                                             0,
+                                                             haystack_size + 2 * d,
+                                                             seed_value);
+            std::sort(haystack.begin(), haystack.end(), compare_op);
+
+            // Use a narrower range for needles for checking out-of-haystack cases
+            std::vector<needle_type> needles
+                = test_utils::get_random_data<needle_type>(needles_size,
+                                                           d,
+                                                           haystack_size + d,
+                                                           seed_value);
+            std::sort(needles.begin(), needles.end(), compare_op);
+
+            haystack_type* d_haystack;
+            needle_type*   d_needles;
+            output_type*   d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_haystack,
+                                                         haystack_size * sizeof(haystack_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_needles, needles_size * sizeof(needle_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_output, needles_size * sizeof(output_type)));
+            HIP_CHECK(hipMemcpy(d_haystack,
+                                haystack.data(),
+                                haystack_size * sizeof(haystack_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_needles,
+                                needles.data(),
+                                needles_size * sizeof(needle_type),
+                                hipMemcpyHostToDevice));
+
+            // Calculate expected results on host
+            std::vector<output_type> expected_lower(needles_size);
+            std::vector<output_type> expected_upper(needles_size);
+            std::vector<output_type> expected_found(needles_size);
+            for(size_t i = 0; i < needles_size; i++)
+            {
+                expected_lower[i]
+                    = std::lower_bound(haystack.begin(), haystack.end(), needles[i], compare_op)
+                      - haystack.begin();
+                expected_upper[i]
+                    = std::upper_bound(haystack.begin(), haystack.end(), needles[i], compare_op)
+                      - haystack.begin();
+                expected_found[i]
+                    = std::binary_search(haystack.begin(), haystack.end(), needles[i], compare_op);
+            }
+
+            void*  d_temporary_storage = nullptr;
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::lower_bound_sorted_needles(d_temporary_storage,
+                                                          temporary_storage_bytes,
+                                                          d_haystack,
+                                                          d_needles,
+                                                          d_output,
+                                                          haystack_size,
+                                                          needles_size,
+                                                          compare_op,
+                                                          stream,
+                                                          debug_synchronous));
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            std::vector<output_type> output(needles_size);
+
+            HIP_CHECK(rocprim::lower_bound_sorted_needles(d_temporary_storage,
+                                                          temporary_storage_bytes,
+                                                          d_haystack,
+                                                          d_needles,
+                                                          d_output,
+                                                          haystack_size,
+                                                          needles_size,
+                                                          compare_op,
+                                                          stream,
+                                                          debug_synchronous));
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                needles_size * sizeof(output_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_lower));
+
+            HIP_CHECK(rocprim::upper_bound_sorted_needles(d_temporary_storage,
+                                                          temporary_storage_bytes,
+                                                          d_haystack,
+                                                          d_needles,
+                                                          d_output,
+                                                          haystack_size,
+                                                          needles_size,
+                                                          compare_op,
+                                                          stream,
+                                                          debug_synchronous));
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                needles_size * sizeof(output_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_upper));
+
+            HIP_CHECK(rocprim::binary_search_sorted_needles(d_temporary_storage,
+                                                            temporary_storage_bytes,
+                                                            d_haystack,
+                                                            d_needles,
+                                                            d_output,
+                                                            haystack_size,
+                                                            needles_size,
+                                                            compare_op,
+                                                            stream,
+                                                            debug_synchronous));
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                needles_size * sizeof(output_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_found));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_haystack));
+            HIP_CHECK(hipFree(d_needles));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
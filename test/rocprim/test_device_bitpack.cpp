@@ -0,0 +1,291 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_bitpack.hpp>
+#include <rocprim/device/device_reduce.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+template<class Params>
+class RocprimDeviceBitpackTests : public ::testing::Test
+{
+public:
+    using value_type = Params;
+};
+
+using RocprimDeviceBitpackTestsParams
+    = ::testing::Types<int, unsigned int, unsigned char, short, long long, unsigned long long>;
+
+TYPED_TEST_SUITE(RocprimDeviceBitpackTests, RocprimDeviceBitpackTestsParams);
+
+// The tiles cycle through constant items, and offsets of 4, 10 and all bits from a random base
+template<class T>
+std::vector<T> get_bitpack_data(const size_t size, const unsigned int seed_value)
+{
+    using unsigned_type = typename std::make_unsigned<T>::type;
+
+    std::mt19937_64    engine(seed_value);
+    const unsigned int masks_bits[] = {0, 4, 10, static_cast<unsigned int>(sizeof(T) * 8)};
+
+    std::vector<T> data(size);
+    for(size_t tile = 0; tile * rocprim::bitpack_tile_size < size; tile++)
+    {
+        const unsigned int       bits = masks_bits[tile % 4];
+        const unsigned long long mask = bits >= 64 ? ~0ull : (1ull << bits) - 1;
+        const unsigned_type      base = static_cast<unsigned_type>(engine());
+
+        const size_t end = std::min(size, (tile + 1) * rocprim::bitpack_tile_size);
+        for(size_t i = tile * rocprim::bitpack_tile_size; i < end; i++)
+        {
+            data[i] = static_cast<T>(
+                static_cast<unsigned_type>(base + static_cast<unsigned_type>(engine() & mask)));
+        }
+    }
+    return data;
+}
+
+TYPED_TEST(RocprimDeviceBitpackTests, EncodeDecode)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T             = typename TestFixture::value_type;
+    using unsigned_type = typename std::make_unsigned<T>::type;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const size_t tiles
+                = rocprim::detail::ceiling_div(size, size_t(rocprim::bitpack_tile_size));
+            const size_t max_words = rocprim::detail::ceiling_div(size * sizeof(T) * 8, 32);
+
+            std::vector<T> input = get_bitpack_data<T>(size, seed_value);
+
+            T*            d_input;
+            unsigned int* d_packed;
+            size_t*       d_tile_offsets;
+            T*            d_tile_minimums;
+            unsigned int* d_tile_bit_widths;
+            T*            d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_packed, max_words * sizeof(unsigned int)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_tile_offsets, (tiles + 1) * sizeof(size_t)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_tile_minimums, tiles * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_tile_bit_widths,
+                                                         tiles * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t storage_size;
+            HIP_CHECK(rocprim::bitpack_encode(nullptr,
+                                              storage_size,
+                                              d_input,
+                                              size,
+                                              d_packed,
+                                              d_tile_offsets,
+                                              d_tile_minimums,
+                                              d_tile_bit_widths));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+            HIP_CHECK(rocprim::bitpack_encode(d_temp_storage,
+                                              storage_size,
+                                              d_input,
+                                              size,
+                                              d_packed,
+                                              d_tile_offsets,
+                                              d_tile_minimums,
+                                              d_tile_bit_widths));
+            HIP_CHECK(rocprim::bitpack_decode(d_packed,
+                                              d_tile_offsets,
+                                              d_tile_minimums,
+                                              d_tile_bit_widths,
+                                              d_output,
+                                              size));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T>            output(size);
+            std::vector<size_t>       tile_offsets(tiles + 1);
+            std::vector<unsigned int> tile_bit_widths(tiles);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(tile_offsets.data(),
+                                d_tile_offsets,
+                                (tiles + 1) * sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(tile_bit_widths.data(),
+                                d_tile_bit_widths,
+                                tiles * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, input));
+
+            // The bit widths of the tiles fit the largest offsets of the tiles exactly
+            std::vector<unsigned int> expected_bit_widths(tiles);
+            std::vector<size_t>       expected_tile_offsets(tiles + 1, 0);
+            for(size_t tile = 0; tile < tiles; tile++)
+            {
+                const auto begin = input.begin() + tile * rocprim::bitpack_tile_size;
+                const auto end
+                    = input.begin()
+                      + std::min(size, (tile + 1) * size_t(rocprim::bitpack_tile_size));
+                const auto minmax = std::minmax_element(begin, end);
+                unsigned long long range
+                    = static_cast<unsigned_type>(static_cast<unsigned_type>(*minmax.second)
+                                                 - static_cast<unsigned_type>(*minmax.first));
+                unsigned int bits = 0;
+                for(; range != 0; range >>= 1)
+                {
+                    bits++;
+                }
+                expected_bit_widths[tile] = bits;
+                expected_tile_offsets[tile + 1]
+                    = expected_tile_offsets[tile]
+                      + rocprim::detail::ceiling_div(size_t(end - begin) * bits, size_t(32));
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(tile_bit_widths, expected_bit_widths));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(tile_offsets, expected_tile_offsets));
+            ASSERT_LE(tile_offsets[tiles], max_words);
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_packed));
+            HIP_CHECK(hipFree(d_tile_offsets));
+            HIP_CHECK(hipFree(d_tile_minimums));
+            HIP_CHECK(hipFree(d_tile_bit_widths));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+TEST(RocprimDeviceBitpackTests, DecodeIteratorInput)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = unsigned int;
+
+    const unsigned int seed_value = seeds[0];
+    const size_t       size       = 100000;
+    const size_t       tiles
+        = rocprim::detail::ceiling_div(size, size_t(rocprim::bitpack_tile_size));
+
+    std::vector<T> input = get_bitpack_data<T>(size, seed_value);
+
+    T*                  d_input;
+    unsigned int*       d_packed;
+    size_t*             d_tile_offsets;
+    T*                  d_tile_minimums;
+    unsigned int*       d_tile_bit_widths;
+    unsigned long long* d_sum;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_packed, size * sizeof(unsigned int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_tile_offsets, (tiles + 1) * sizeof(size_t)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_tile_minimums, tiles * sizeof(T)));
+    HIP_CHECK(
+        test_common_utils::hipMallocHelper(&d_tile_bit_widths, tiles * sizeof(unsigned int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_sum, sizeof(unsigned long long)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    size_t storage_size;
+    HIP_CHECK(rocprim::bitpack_encode(nullptr,
+                                      storage_size,
+                                      d_input,
+                                      size,
+                                      d_packed,
+                                      d_tile_offsets,
+                                      d_tile_minimums,
+                                      d_tile_bit_widths));
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+    HIP_CHECK(rocprim::bitpack_encode(d_temp_storage,
+                                      storage_size,
+                                      d_input,
+                                      size,
+                                      d_packed,
+                                      d_tile_offsets,
+                                      d_tile_minimums,
+                                      d_tile_bit_widths));
+    HIP_CHECK(hipFree(d_temp_storage));
+
+    // The packed tiles are the input of a reduction without decoding them into memory
+    const auto decoded = rocprim::make_bitpack_decode_iterator(d_packed,
+                                                               d_tile_offsets,
+                                                               d_tile_minimums,
+                                                               d_tile_bit_widths);
+    HIP_CHECK(rocprim::reduce(nullptr,
+                              storage_size,
+                              decoded,
+                              d_sum,
+                              0ull,
+                              size,
+                              rocprim::plus<unsigned long long>()));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+    HIP_CHECK(rocprim::reduce(d_temp_storage,
+                              storage_size,
+                              decoded,
+                              d_sum,
+                              0ull,
+                              size,
+                              rocprim::plus<unsigned long long>()));
+    HIP_CHECK(hipGetLastError());
+
+    unsigned long long sum;
+    HIP_CHECK(hipMemcpy(&sum, d_sum, sizeof(unsigned long long), hipMemcpyDeviceToHost));
+
+    unsigned long long expected = 0;
+    for(const T value : input)
+    {
+        expected += value;
+    }
+    ASSERT_EQ(sum, expected);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_packed));
+    HIP_CHECK(hipFree(d_tile_offsets));
+    HIP_CHECK(hipFree(d_tile_minimums));
+    HIP_CHECK(hipFree(d_tile_bit_widths));
+    HIP_CHECK(hipFree(d_sum));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
@@ -0,0 +1,344 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_counting_sort.hpp>
+#include <rocprim/device/device_radix_sort.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_sort_comparator.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+template<class KeyType, bool Descending, unsigned int StartBit, unsigned int EndBit>
+struct DeviceCountingSortParams
+{
+    using key_type                          = KeyType;
+    static constexpr bool         descending = Descending;
+    static constexpr unsigned int start_bit  = StartBit;
+    static constexpr unsigned int end_bit    = EndBit;
+};
+
+template<class Params>
+class RocprimDeviceCountingSortTests : public ::testing::Test
+{
+public:
+    using key_type                           = typename Params::key_type;
+    static constexpr bool         descending = Params::descending;
+    static constexpr unsigned int start_bit  = Params::start_bit;
+    static constexpr unsigned int end_bit    = Params::end_bit;
+    const bool                    debug_synchronous = false;
+};
+
+using RocprimDeviceCountingSortTestsParams
+    = ::testing::Types<DeviceCountingSortParams<unsigned int, false, 0, 12>,
+                       DeviceCountingSortParams<unsigned int, true, 0, 12>,
+                       DeviceCountingSortParams<int, false, 4, 14>,
+                       DeviceCountingSortParams<int, true, 20, 32>,
+                       DeviceCountingSortParams<uint8_t, false, 0, 8>,
+                       DeviceCountingSortParams<int8_t, true, 0, 8>,
+                       DeviceCountingSortParams<short, false, 3, 9>,
+                       DeviceCountingSortParams<unsigned long long, true, 30, 31>>;
+
+TYPED_TEST_SUITE(RocprimDeviceCountingSortTests, RocprimDeviceCountingSortTestsParams);
+
+template<bool Descending, class... Args>
+hipError_t invoke_counting_sort_keys(Args&&... args)
+{
+    return Descending ? rocprim::counting_sort_keys_desc(std::forward<Args>(args)...)
+                      : rocprim::counting_sort_keys(std::forward<Args>(args)...);
+}
+
+template<bool Descending, class... Args>
+hipError_t invoke_counting_sort_pairs(Args&&... args)
+{
+    return Descending ? rocprim::counting_sort_pairs_desc(std::forward<Args>(args)...)
+                      : rocprim::counting_sort_pairs(std::forward<Args>(args)...);
+}
+
+template<bool Descending, class... Args>
+hipError_t invoke_radix_sort_pairs(Args&&... args)
+{
+    return Descending ? rocprim::radix_sort_pairs_desc(std::forward<Args>(args)...)
+                      : rocprim::radix_sort_pairs(std::forward<Args>(args)...);
+}
+
+TYPED_TEST(RocprimDeviceCountingSortTests, SortKeys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                           = typename TestFixture::key_type;
+    constexpr bool         descending        = TestFixture::descending;
+    constexpr unsigned int start_bit         = TestFixture::start_bit;
+    constexpr unsigned int end_bit           = TestFixture::end_bit;
+    const bool             debug_synchronous = TestFixture::debug_synchronous;
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<key_type> keys_input = test_utils::get_random_data<key_type>(
+                size,
+                test_utils::generate_limits<key_type>::min(),
+                test_utils::generate_limits<key_type>::max(),
+                seed_value);
+
+            std::vector<key_type> expected(keys_input);
+            using comparator = test_utils::key_comparator<key_type, descending, start_bit, end_bit>;
+            std::stable_sort(expected.begin(), expected.end(), comparator());
+
+            key_type* d_keys_input;
+            key_type* d_keys_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(key_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(invoke_counting_sort_keys<descending>(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            d_keys_input,
+                                                            d_keys_output,
+                                                            size,
+                                                            start_bit,
+                                                            end_bit,
+                                                            stream,
+                                                            debug_synchronous));
+
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(invoke_counting_sort_keys<descending>(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            d_keys_input,
+                                                            d_keys_output,
+                                                            size,
+                                                            start_bit,
+                                                            end_bit,
+                                                            stream,
+                                                            debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<key_type> keys_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+// Sorts with the counting sort and with the radix sort, which uses the counting sort for the
+// large sizes
+TYPED_TEST(RocprimDeviceCountingSortTests, SortPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                           = typename TestFixture::key_type;
+    using value_type                         = unsigned int;
+    constexpr bool         descending        = TestFixture::descending;
+    constexpr unsigned int start_bit         = TestFixture::start_bit;
+    constexpr unsigned int end_bit           = TestFixture::end_bit;
+    const bool             debug_synchronous = TestFixture::debug_synchronous;
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<key_type> keys_input = test_utils::get_random_data<key_type>(
+                size,
+                test_utils::generate_limits<key_type>::min(),
+                test_utils::generate_limits<key_type>::max(),
+                seed_value);
+            std::vector<value_type> values_input(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                values_input[i] = static_cast<value_type>(i);
+            }
+
+            using key_value = std::pair<key_type, value_type>;
+            std::vector<key_value> expected(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                expected[i] = key_value(keys_input[i], values_input[i]);
+            }
+            std::stable_sort(expected.begin(),
+                             expected.end(),
+                             test_utils::key_value_comparator<key_type,
+                                                              value_type,
+                                                              descending,
+                                                              start_bit,
+                                                              end_bit>());
+            std::vector<key_type>   expected_keys(size);
+            std::vector<value_type> expected_values(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                expected_keys[i]   = expected[i].first;
+                expected_values[i] = expected[i].second;
+            }
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            value_type* d_values_input;
+            value_type* d_values_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            for(const bool use_radix_sort : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with use_radix_sort = " << use_radix_sort);
+
+                const auto invoke = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+                {
+                    return use_radix_sort
+                               ? invoke_radix_sort_pairs<descending>(d_temp_storage,
+                                                                     temp_storage_size_bytes,
+                                                                     d_keys_input,
+                                                                     d_keys_output,
+                                                                     d_values_input,
+                                                                     d_values_output,
+                                                                     size,
+                                                                     start_bit,
+                                                                     end_bit,
+                                                                     stream,
+                                                                     debug_synchronous)
+                               : invoke_counting_sort_pairs<descending>(d_temp_storage,
+                                                                        temp_storage_size_bytes,
+                                                                        d_keys_input,
+                                                                        d_keys_output,
+                                                                        d_values_input,
+                                                                        d_values_output,
+                                                                        size,
+                                                                        start_bit,
+                                                                        end_bit,
+                                                                        stream,
+                                                                        debug_synchronous);
+                };
+
+                size_t temp_storage_size_bytes;
+                void*  d_temp_storage = nullptr;
+                HIP_CHECK(invoke(d_temp_storage, temp_storage_size_bytes));
+
+                ASSERT_GT(temp_storage_size_bytes, 0);
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                HIP_CHECK(invoke(d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<key_type>   keys_output(size);
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, expected_values));
+
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceCountingSortTests, InvalidBitRange)
+{
+    size_t        storage_size;
+    unsigned int* keys = nullptr;
+    // More than 12 bits
+    ASSERT_EQ(rocprim::counting_sort_keys(nullptr, storage_size, keys, keys, 1000, 0, 13),
+              hipErrorInvalidValue);
+    // An empty bit range
+    ASSERT_EQ(rocprim::counting_sort_keys(nullptr, storage_size, keys, keys, 1000, 4, 4),
+              hipErrorInvalidValue);
+}
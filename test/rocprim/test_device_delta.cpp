@@ -0,0 +1,305 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_adjacent_difference_config.hpp>
+#include <rocprim/device/device_delta.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+template<class ValueType, class Config = rocprim::default_config>
+struct DeviceDeltaParams
+{
+    using value_type = ValueType;
+    using config     = Config;
+};
+
+template<class Params>
+class RocprimDeviceDeltaTests : public ::testing::Test
+{
+public:
+    using value_type             = typename Params::value_type;
+    using config                 = typename Params::config;
+    const bool debug_synchronous = false;
+};
+
+using RocprimDeviceDeltaTestsParams
+    = ::testing::Types<DeviceDeltaParams<int>,
+                       DeviceDeltaParams<unsigned int>,
+                       DeviceDeltaParams<long long>,
+                       DeviceDeltaParams<unsigned char>,
+                       DeviceDeltaParams<int, rocprim::adjacent_difference_config<64, 2>>,
+                       DeviceDeltaParams<short, rocprim::adjacent_difference_config<256, 7>>>;
+
+TYPED_TEST_SUITE(RocprimDeviceDeltaTests, RocprimDeviceDeltaTestsParams);
+
+template<class T>
+std::vector<T> host_delta(const std::vector<T>& input)
+{
+    std::vector<T> output(input.size());
+    for(size_t i = 0; i < input.size(); i++)
+    {
+        output[i] = i == 0 ? input[0] : static_cast<T>(input[i] - input[i - 1]);
+    }
+    return output;
+}
+
+// Encodes, checks the result against the host and decodes it back to the input
+template<unsigned int Order, class Config, class T, class Encode, class Decode>
+void test_delta_round_trip(const std::vector<T>& input,
+                           Encode                encode,
+                           Decode                decode,
+                           const bool            debug_synchronous)
+{
+    const size_t size = input.size();
+
+    std::vector<T> expected = host_delta(input);
+    if(Order == 2)
+    {
+        expected = host_delta(expected);
+    }
+
+    T* d_input;
+    T* d_encoded;
+    T* d_decoded;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_encoded, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_decoded, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    size_t storage_size = 0;
+    HIP_CHECK(encode(nullptr, storage_size, d_input, d_encoded, size, debug_synchronous));
+    void* d_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_size));
+    HIP_CHECK(encode(d_storage, storage_size, d_input, d_encoded, size, debug_synchronous));
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipFree(d_storage));
+
+    std::vector<T> encoded(size);
+    HIP_CHECK(hipMemcpy(encoded.data(), d_encoded, size * sizeof(T), hipMemcpyDeviceToHost));
+    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(encoded, expected));
+
+    storage_size = 0;
+    HIP_CHECK(decode(nullptr, storage_size, d_encoded, d_decoded, size, debug_synchronous));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_size));
+    HIP_CHECK(decode(d_storage, storage_size, d_encoded, d_decoded, size, debug_synchronous));
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipFree(d_storage));
+
+    std::vector<T> decoded(size);
+    HIP_CHECK(hipMemcpy(decoded.data(), d_decoded, size * sizeof(T), hipMemcpyDeviceToHost));
+    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(decoded, input));
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_encoded));
+    HIP_CHECK(hipFree(d_decoded));
+}
+
+TYPED_TEST(RocprimDeviceDeltaTests, DeltaEncodeDecode)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::value_type;
+    using config = typename TestFixture::config;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            test_delta_round_trip<1, config>(
+                input,
+                [](void* storage, size_t& bytes, T* in, T* out, size_t n, bool debug)
+                { return rocprim::delta_encode<config>(storage, bytes, in, out, n, {}, 0, debug); },
+                [](void* storage, size_t& bytes, T* in, T* out, size_t n, bool debug)
+                { return rocprim::delta_decode(storage, bytes, in, out, n, {}, 0, debug); },
+                TestFixture::debug_synchronous);
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceDeltaTests, DeltaOfDeltaEncodeDecode)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::value_type;
+    using config = typename TestFixture::config;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            test_delta_round_trip<2, config>(
+                input,
+                [](void* storage, size_t& bytes, T* in, T* out, size_t n, bool debug)
+                {
+                    return rocprim::delta_of_delta_encode<config>(storage,
+                                                                  bytes,
+                                                                  in,
+                                                                  out,
+                                                                  n,
+                                                                  {},
+                                                                  0,
+                                                                  debug);
+                },
+                [](void* storage, size_t& bytes, T* in, T* out, size_t n, bool debug)
+                {
+                    return rocprim::
+                        delta_of_delta_decode(storage, bytes, in, out, n, {}, 0, debug);
+                },
+                TestFixture::debug_synchronous);
+        }
+    }
+}
+
+struct zigzag_encode
+{
+    __device__ __host__
+    unsigned int operator()(const int delta) const
+    {
+        return (static_cast<unsigned int>(delta) << 1) ^ static_cast<unsigned int>(delta >> 31);
+    }
+};
+
+struct zigzag_decode
+{
+    __device__ __host__
+    int operator()(const unsigned int encoded) const
+    {
+        return static_cast<int>((encoded >> 1) ^ (0u - (encoded & 1u)));
+    }
+};
+
+TEST(RocprimDeviceDeltaTests, ZigZagEpilogue)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<int> input
+                = test_utils::get_random_data<int>(size, -1000, 1000, seed_value);
+
+            std::vector<unsigned int> expected(size);
+            const std::vector<int>    deltas = host_delta(host_delta(input));
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = zigzag_encode{}(deltas[i]);
+            }
+
+            int*          d_input;
+            unsigned int* d_encoded;
+            int*          d_decoded;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_encoded, size * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_decoded, size * sizeof(int)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+            size_t storage_size = 0;
+            HIP_CHECK(rocprim::delta_of_delta_encode(nullptr,
+                                                     storage_size,
+                                                     d_input,
+                                                     d_encoded,
+                                                     size,
+                                                     zigzag_encode{}));
+            void* d_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_size));
+            HIP_CHECK(rocprim::delta_of_delta_encode(d_storage,
+                                                     storage_size,
+                                                     d_input,
+                                                     d_encoded,
+                                                     size,
+                                                     zigzag_encode{}));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipFree(d_storage));
+
+            std::vector<unsigned int> encoded(size);
+            HIP_CHECK(hipMemcpy(encoded.data(),
+                                d_encoded,
+                                size * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(encoded, expected));
+
+            storage_size = 0;
+            HIP_CHECK(rocprim::delta_of_delta_decode(nullptr,
+                                                     storage_size,
+                                                     d_encoded,
+                                                     d_decoded,
+                                                     size,
+                                                     zigzag_decode{}));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_size));
+            HIP_CHECK(rocprim::delta_of_delta_decode(d_storage,
+                                                     storage_size,
+                                                     d_encoded,
+                                                     d_decoded,
+                                                     size,
+                                                     zigzag_decode{}));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipFree(d_storage));
+
+            std::vector<int> decoded(size);
+            HIP_CHECK(
+                hipMemcpy(decoded.data(), d_decoded, size * sizeof(int), hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(decoded, input));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_encoded));
+            HIP_CHECK(hipFree(d_decoded));
+        }
+    }
+}
@@ -0,0 +1,360 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_distinct.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <vector>
+
+#include <cstddef>
+
+template<class KeyType, class Config = rocprim::default_config>
+struct DeviceDistinctParams
+{
+    using key_type = KeyType;
+    using config   = Config;
+};
+
+template<class Params>
+class RocprimDeviceDistinctTests : public ::testing::Test
+{
+public:
+    using key_type               = typename Params::key_type;
+    using config                 = typename Params::config;
+    const bool debug_synchronous = false;
+};
+
+using RocprimDeviceDistinctTestsParams = ::testing::Types<
+    DeviceDistinctParams<int>,
+    DeviceDistinctParams<unsigned long long>,
+    DeviceDistinctParams<
+        unsigned int,
+        rocprim::hash_table_config<256, 2, rocprim::hash_probe_scheme::quadratic, 0>>,
+    DeviceDistinctParams<
+        long long,
+        rocprim::hash_table_config<128, 8, rocprim::hash_probe_scheme::double_hashing, 64>>>;
+
+TYPED_TEST_SUITE(RocprimDeviceDistinctTests, RocprimDeviceDistinctTestsParams);
+
+TYPED_TEST(RocprimDeviceDistinctTests, Distinct)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type               = typename TestFixture::key_type;
+    using config                 = typename TestFixture::config;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    const hipStream_t stream    = 0; // default
+    const key_type    empty_key = static_cast<key_type>(-1);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            // Few distinct keys are filtered mostly in shared memory, many distinct keys mostly in
+            // the global table.
+            for(size_t max_key : {size_t(10), size_t(1000), size + 1})
+            {
+                for(bool stable : {false, true})
+                {
+                    SCOPED_TRACE(testing::Message() << "with size = " << size);
+                    SCOPED_TRACE(testing::Message() << "with max_key = " << max_key);
+                    SCOPED_TRACE(testing::Message() << "with stable = " << stable);
+
+                    const std::vector<key_type> input
+                        = test_utils::get_random_data<key_type>(size, 0, max_key, seed_value);
+
+                    // The first occurrences in order
+                    std::vector<key_type> expected;
+                    std::set<key_type>    seen;
+                    for(const key_type key : input)
+                    {
+                        if(seen.insert(key).second)
+                        {
+                            expected.push_back(key);
+                        }
+                    }
+                    const size_t max_unique_keys = std::min(size, max_key + 1);
+
+                    key_type* d_input;
+                    key_type* d_output;
+                    size_t*   d_unique_count;
+                    HIP_CHECK(
+                        test_common_utils::hipMallocHelper(&d_input, size * sizeof(*d_input)));
+                    HIP_CHECK(
+                        test_common_utils::hipMallocHelper(&d_output, size * sizeof(*d_output)));
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_count, sizeof(size_t)));
+                    HIP_CHECK(hipMemcpy(d_input,
+                                        input.data(),
+                                        size * sizeof(*d_input),
+                                        hipMemcpyHostToDevice));
+
+                    size_t temp_storage_size_bytes;
+                    void*  d_temp_storage = nullptr;
+                    HIP_CHECK(rocprim::distinct<config>(d_temp_storage,
+                                                        temp_storage_size_bytes,
+                                                        d_input,
+                                                        size,
+                                                        d_output,
+                                                        d_unique_count,
+                                                        max_unique_keys,
+                                                        empty_key,
+                                                        stable,
+                                                        stream,
+                                                        debug_synchronous));
+
+                    ASSERT_GT(temp_storage_size_bytes, 0);
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage,
+                                                                 temp_storage_size_bytes));
+
+                    HIP_CHECK(rocprim::distinct<config>(d_temp_storage,
+                                                        temp_storage_size_bytes,
+                                                        d_input,
+                                                        size,
+                                                        d_output,
+                                                        d_unique_count,
+                                                        max_unique_keys,
+                                                        empty_key,
+                                                        stable,
+                                                        stream,
+                                                        debug_synchronous));
+                    HIP_CHECK(hipGetLastError());
+                    HIP_CHECK(hipDeviceSynchronize());
+
+                    size_t unique_count;
+                    HIP_CHECK(hipMemcpy(&unique_count,
+                                        d_unique_count,
+                                        sizeof(unique_count),
+                                        hipMemcpyDeviceToHost));
+                    ASSERT_EQ(unique_count, expected.size());
+
+                    std::vector<key_type> output(unique_count);
+                    HIP_CHECK(hipMemcpy(output.data(),
+                                        d_output,
+                                        unique_count * sizeof(*d_output),
+                                        hipMemcpyDeviceToHost));
+
+                    // Without the stable mode the distinct keys are unordered
+                    if(!stable)
+                    {
+                        std::sort(output.begin(), output.end());
+                        std::sort(expected.begin(), expected.end());
+                    }
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+                    HIP_CHECK(hipFree(d_input));
+                    HIP_CHECK(hipFree(d_output));
+                    HIP_CHECK(hipFree(d_unique_count));
+                    HIP_CHECK(hipFree(d_temp_storage));
+                }
+            }
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceDistinctTests, DistinctCount)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type               = typename TestFixture::key_type;
+    using config                 = typename TestFixture::config;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    const hipStream_t stream    = 0; // default
+    const key_type    empty_key = static_cast<key_type>(-1);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const size_t                max_key = size / 2 + 1;
+            const std::vector<key_type> input
+                = test_utils::get_random_data<key_type>(size, 0, max_key, seed_value);
+            const size_t expected = std::set<key_type>(input.begin(), input.end()).size();
+
+            key_type* d_input;
+            size_t*   d_unique_count;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(*d_input)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_count, sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * sizeof(*d_input),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::distinct_count<config>(d_temp_storage,
+                                                      temp_storage_size_bytes,
+                                                      d_input,
+                                                      size,
+                                                      d_unique_count,
+                                                      std::min(size, max_key + 1),
+                                                      empty_key,
+                                                      stream,
+                                                      debug_synchronous));
+
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(rocprim::distinct_count<config>(d_temp_storage,
+                                                      temp_storage_size_bytes,
+                                                      d_input,
+                                                      size,
+                                                      d_unique_count,
+                                                      std::min(size, max_key + 1),
+                                                      empty_key,
+                                                      stream,
+                                                      debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            size_t unique_count;
+            HIP_CHECK(hipMemcpy(&unique_count,
+                                d_unique_count,
+                                sizeof(unique_count),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(unique_count, expected);
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_unique_count));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceDistinctTests, HyperLogLog)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type               = typename TestFixture::key_type;
+    using config                 = typename TestFixture::config;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Sketches in shared memory and in global memory
+        for(unsigned int precision : {10u, 14u})
+        {
+            for(size_t max_key : {size_t(100), size_t(10000), size_t(1000000)})
+            {
+                SCOPED_TRACE(testing::Message() << "with precision = " << precision);
+                SCOPED_TRACE(testing::Message() << "with max_key = " << max_key);
+
+                const size_t                size = 1 << 20;
+                const std::vector<key_type> input
+                    = test_utils::get_random_data<key_type>(size, 0, max_key, seed_value);
+                const double expected
+                    = static_cast<double>(std::set<key_type>(input.begin(), input.end()).size());
+
+                const size_t  register_count = size_t(1) << precision;
+                key_type*     d_input;
+                unsigned int* d_registers;
+                double*       d_estimate;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(*d_input)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_registers,
+                                                             register_count
+                                                                 * sizeof(*d_registers)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_estimate, sizeof(*d_estimate)));
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    size * sizeof(*d_input),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemset(d_registers, 0, register_count * sizeof(*d_registers)));
+
+                // Two halves added to the same sketch
+                HIP_CHECK(rocprim::hyperloglog_sketch<config>(d_input,
+                                                              size / 2,
+                                                              d_registers,
+                                                              precision,
+                                                              stream,
+                                                              debug_synchronous));
+                HIP_CHECK(rocprim::hyperloglog_sketch<config>(d_input + size / 2,
+                                                              size - size / 2,
+                                                              d_registers,
+                                                              precision,
+                                                              stream,
+                                                              debug_synchronous));
+                HIP_CHECK(rocprim::hyperloglog_estimate(d_registers,
+                                                        precision,
+                                                        d_estimate,
+                                                        stream,
+                                                        debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+
+                double estimate;
+                HIP_CHECK(
+                    hipMemcpy(&estimate, d_estimate, sizeof(estimate), hipMemcpyDeviceToHost));
+
+                // Within 6 standard errors
+                const double error = 6.0 * 1.04 / std::sqrt(static_cast<double>(register_count));
+                ASSERT_NEAR(estimate, expected, error * expected);
+
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_registers));
+                HIP_CHECK(hipFree(d_estimate));
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceDistinctTests, HyperLogLogInvalidPrecision)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    int*          d_input     = nullptr;
+    unsigned int* d_registers = nullptr;
+    ASSERT_EQ(rocprim::hyperloglog_sketch(d_input, 16, d_registers, 3), hipErrorInvalidValue);
+    ASSERT_EQ(rocprim::hyperloglog_sketch(d_input, 16, d_registers, 19), hipErrorInvalidValue);
+}
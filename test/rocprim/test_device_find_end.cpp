@@ -443,3 +443,80 @@ TYPED_TEST(RocprimDeviceFindEndTests, FindEndRepetition)
         }
     }
 }
+
+// Long keys are searched by the rolling hashes of the reversed input. The input repeats the
+// keys with their first item changed, with two copies of the keys, so the last one is found.
+TEST(RocprimDeviceFindEndTests, FindEndLongKeys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = unsigned int;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const size_t key_size : {size_t(1024), size_t(3000)})
+        {
+            SCOPED_TRACE(testing::Message() << "with key_size = " << key_size);
+
+            const size_t size = 100000;
+
+            std::vector<T> keys = test_utils::get_random_data<T>(key_size, 0, 1000, seed_value);
+            std::vector<T> input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                input[i] = keys[i % key_size] + (i % key_size == 0 ? 1 : 0);
+            }
+            std::copy(keys.begin(), keys.end(), input.begin() + size / 4);
+            std::copy(keys.begin(), keys.end(), input.begin() + size / 2 + seed_value % 1000);
+
+            T*      d_input;
+            T*      d_keys;
+            size_t* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, key_size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(
+                hipMemcpy(d_keys, keys.data(), key_size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::find_end(nullptr,
+                                        temp_storage_size_bytes,
+                                        d_input,
+                                        d_keys,
+                                        d_output,
+                                        size,
+                                        key_size));
+            void* d_temp_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::find_end(d_temp_storage,
+                                        temp_storage_size_bytes,
+                                        d_input,
+                                        d_keys,
+                                        d_output,
+                                        size,
+                                        key_size));
+            HIP_CHECK(hipGetLastError());
+
+            size_t output;
+            HIP_CHECK(hipMemcpy(&output, d_output, sizeof(size_t), hipMemcpyDeviceToHost));
+
+            const size_t expected
+                = std::find_end(input.begin(), input.end(), keys.begin(), keys.end())
+                  - input.begin();
+            ASSERT_EQ(output, expected);
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
@@ -101,6 +101,11 @@ public:
 
 using RocprimDeviceFindFirstOfTestsParams
     = ::testing::Types<DeviceFindFirstOfParams<int>,
+                       DeviceFindFirstOfParams<short>,
+                       DeviceFindFirstOfParams<uint64_t,
+                                               uint64_t,
+                                               size_t,
+                                               rocprim::equal_to<void>>,
                        DeviceFindFirstOfParams<int64_t,
                                                int,
                                                unsigned int,
@@ -391,3 +396,100 @@ TEST(RocprimDeviceFindFirstOfTests, LargeIndices)
         }
     }
 }
+
+// Thousands of keys, including the key whose bits are all ones, are searched for in a set of the
+// keys.
+TEST(RocprimDeviceFindFirstOfTests, ManyKeys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using type = int;
+
+    constexpr bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // The keys are the odd values and -1, the input is even until the match
+        const size_t      keys_size = 5000;
+        std::vector<type> keys(keys_size);
+        for(size_t i = 0; i < keys_size; i++)
+        {
+            keys[i] = i == 0 ? -1 : static_cast<type>(2 * i + 1);
+        }
+        std::vector<type> matches = {-1, 2 * static_cast<type>(keys_size) - 1};
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<type> input
+                = test_utils::get_random_data<type>(size, 0, 1 << 20, seed_value);
+            for(type& value : input)
+            {
+                value &= ~1;
+            }
+            size_t expected = size;
+            if(size > 0)
+            {
+                expected        = test_utils::get_random_value<size_t>(0, size - 1, seed_value);
+                input[expected] = matches[seed_value % matches.size()];
+            }
+
+            hipStream_t stream = 0; // default
+
+            type*   d_input;
+            type*   d_keys;
+            size_t* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(*d_input)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, keys_size * sizeof(*d_keys)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(*d_output)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(*d_input), hipMemcpyHostToDevice));
+            HIP_CHECK(
+                hipMemcpy(d_keys, keys.data(), keys_size * sizeof(*d_keys), hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::find_first_of(d_temp_storage,
+                                             temp_storage_size_bytes,
+                                             d_input,
+                                             d_keys,
+                                             d_output,
+                                             size,
+                                             keys_size,
+                                             rocprim::equal_to<type>(),
+                                             stream,
+                                             debug_synchronous));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::find_first_of(d_temp_storage,
+                                             temp_storage_size_bytes,
+                                             d_input,
+                                             d_keys,
+                                             d_output,
+                                             size,
+                                             keys_size,
+                                             rocprim::equal_to<type>(),
+                                             stream,
+                                             debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            size_t output;
+            HIP_CHECK(hipMemcpy(&output, d_output, sizeof(*d_output), hipMemcpyDeviceToHost));
+            ASSERT_EQ(output, expected);
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
@@ -0,0 +1,261 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_for_each.hpp>
+#include <rocprim/iterator/counting_iterator.hpp>
+#include <rocprim/iterator/transform_iterator.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <numeric>
+#include <vector>
+
+#include <cstddef>
+
+template<class T>
+struct scale_op
+{
+    __device__
+    void operator()(T& value) const
+    {
+        value = value * T(3);
+    }
+};
+
+struct write_square_index
+{
+    size_t* output;
+
+    __device__
+    void operator()(const size_t index) const
+    {
+        output[index] = index * index;
+    }
+};
+
+// Adds the items of a thread and stores the sum at the index of its first item, so that every
+// item is counted once and the offsets are checked.
+template<class T>
+struct tile_sum
+{
+    T*            sums;
+    unsigned int* valid_counts;
+
+    template<unsigned int ItemsPerThread>
+    __device__
+    void operator()(T (&items)[ItemsPerThread], const size_t offset, const unsigned int valid)
+    {
+        T sum = 0;
+        for(unsigned int i = 0; i < valid; i++)
+        {
+            sum += items[i];
+        }
+        sums[offset]         = sum;
+        valid_counts[offset] = valid;
+    }
+};
+
+struct plus_one
+{
+    __device__ __host__
+    int operator()(const int value) const
+    {
+        return value + 1;
+    }
+};
+
+TEST(RocprimDeviceForEachTests, ForEachN)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> values = test_utils::get_random_data<T>(size, -100, 100, seed_value);
+
+            T* d_values;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(d_values, values.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            // The first half with for_each_n and the second half with for_each
+            const size_t half = size / 2;
+            HIP_CHECK(rocprim::for_each_n(d_values, half, scale_op<T>{}));
+            HIP_CHECK(rocprim::for_each(d_values + half, d_values + size, scale_op<T>{}));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_values, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            for(T& value : values)
+            {
+                value *= 3;
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, values));
+
+            HIP_CHECK(hipFree(d_values));
+        }
+    }
+}
+
+TEST(RocprimDeviceForEachTests, ForEachIndex)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // Small grid size limit, so that the indices span several launches
+    using Config = rocprim::transform_config<128, 4, 128 * 4 * 3>;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            size_t* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(size_t)));
+
+            HIP_CHECK(rocprim::for_each_index<Config>(size, write_square_index{d_output}));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<size_t> output(size);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                size * sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+
+            std::vector<size_t> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = i * i;
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+template<class Config, bool TransformInput>
+void test_for_each_tile()
+{
+    using T = int;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, -100, 100, seed_value);
+
+            T*            d_input;
+            T*            d_sums;
+            unsigned int* d_valid_counts;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_sums, size * sizeof(T)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_valid_counts, size * sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemset(d_sums, 0, size * sizeof(T)));
+            HIP_CHECK(hipMemset(d_valid_counts, 0, size * sizeof(unsigned int)));
+
+            const tile_sum<T> function{d_sums, d_valid_counts};
+            if(TransformInput)
+            {
+                HIP_CHECK(rocprim::for_each_tile<Config>(
+                    rocprim::make_transform_iterator(d_input, plus_one{}),
+                    size,
+                    function));
+            }
+            else
+            {
+                HIP_CHECK(rocprim::for_each_tile<Config>(d_input, size, function));
+            }
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T>            sums(size);
+            std::vector<unsigned int> valid_counts(size);
+            HIP_CHECK(hipMemcpy(sums.data(), d_sums, size * sizeof(T), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(valid_counts.data(),
+                                d_valid_counts,
+                                size * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+
+            // Every thread owns items_per_thread consecutive items
+            constexpr unsigned int items_per_thread = Config::items_per_thread;
+            std::vector<T>            expected_sums(size, 0);
+            std::vector<unsigned int> expected_valid_counts(size, 0);
+            for(size_t offset = 0; offset < size; offset += items_per_thread)
+            {
+                const size_t end = std::min(size, offset + items_per_thread);
+                for(size_t i = offset; i < end; i++)
+                {
+                    expected_sums[offset] += TransformInput ? plus_one{}(input[i]) : input[i];
+                }
+                expected_valid_counts[offset] = static_cast<unsigned int>(end - offset);
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(sums, expected_sums));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(valid_counts, expected_valid_counts));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_sums));
+            HIP_CHECK(hipFree(d_valid_counts));
+        }
+    }
+}
+
+TEST(RocprimDeviceForEachTests, ForEachTile)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    test_for_each_tile<rocprim::transform_config<256, 4>, false>();
+    test_for_each_tile<rocprim::transform_config<128, 7>, false>();
+    test_for_each_tile<rocprim::transform_config<256, 8>, true>();
+}
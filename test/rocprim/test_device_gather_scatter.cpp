@@ -0,0 +1,329 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_gather_scatter.hpp>
+#include <rocprim/functional.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <cstddef>
+
+TEST(RocprimDeviceGatherScatterTests, Gather)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            if(size == 0)
+            {
+                continue;
+            }
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, -100, 100, seed_value);
+            // Random indices in the first half, sorted runs in the second half
+            std::vector<unsigned int> indices
+                = test_utils::get_random_data<unsigned int>(size, 0, size - 1, seed_value);
+            std::sort(indices.begin() + size / 2, indices.end());
+
+            T*            d_input;
+            unsigned int* d_indices;
+            T*            d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, size * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_indices,
+                                indices.data(),
+                                size * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+
+            HIP_CHECK(rocprim::gather(d_input, d_indices, d_output, size));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            std::vector<T> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = input[indices[i]];
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_indices));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceGatherScatterTests, Scatter)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = double;
+
+    // Small grid size limit, so that the items span several launches
+    using Config = rocprim::transform_config<128, 4, 128 * 4 * 3>;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, -100, 100, seed_value);
+            // A permutation of shuffled blocks of consecutive indices
+            std::vector<size_t> indices(size);
+            std::iota(indices.begin(), indices.end(), size_t(0));
+            std::vector<size_t> block_order((size + 99) / 100);
+            std::iota(block_order.begin(), block_order.end(), size_t(0));
+            std::shuffle(block_order.begin(), block_order.end(), std::mt19937(seed_value));
+            size_t position = 0;
+            for(const size_t block : block_order)
+            {
+                for(size_t i = block * 100; i < std::min(size, block * 100 + 100); i++)
+                {
+                    indices[position++] = i;
+                }
+            }
+
+            T*      d_input;
+            size_t* d_indices;
+            T*      d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, size * sizeof(size_t)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_indices,
+                                indices.data(),
+                                size * sizeof(size_t),
+                                hipMemcpyHostToDevice));
+
+            HIP_CHECK(rocprim::scatter<Config>(d_input, d_indices, d_output, size));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            std::vector<T> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[indices[i]] = input[i];
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_indices));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+template<class T, class BinaryFunction>
+void test_scatter_reduce(const T initial_value, BinaryFunction reduce_op)
+{
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const size_t output_size = size / 10 + 1;
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+            // Sorted indices with long runs in the first half, random in the second half
+            std::vector<unsigned int> indices = test_utils::get_random_data<unsigned int>(
+                size,
+                0,
+                static_cast<unsigned int>(output_size - 1),
+                seed_value);
+            std::sort(indices.begin(), indices.begin() + size / 2);
+
+            std::vector<T> output_init(output_size, initial_value);
+
+            T*            d_input;
+            unsigned int* d_indices;
+            T*            d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, size * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, output_size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_indices,
+                                indices.data(),
+                                size * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_output,
+                                output_init.data(),
+                                output_size * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            HIP_CHECK(rocprim::scatter_reduce(d_input, d_indices, d_output, size, reduce_op));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(output_size);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output_size * sizeof(T),
+                                hipMemcpyDeviceToHost));
+
+            std::vector<T> expected = output_init;
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[indices[i]] = reduce_op(expected[indices[i]], input[i]);
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_indices));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceGatherScatterTests, ScatterReduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // Hardware atomic adds
+    test_scatter_reduce<int>(0, rocprim::plus<int>());
+    test_scatter_reduce<unsigned long long>(0, rocprim::plus<>());
+    // Compare-and-swap loops, the extrema of floats are exact
+    test_scatter_reduce<float>(-1000.0f, rocprim::maximum<float>());
+    test_scatter_reduce<long long>(1000, rocprim::minimum<long long>());
+}
+
+TEST(RocprimDeviceGatherScatterTests, GatherRows)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = short;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const size_t row_size : {size_t(1), size_t(37), size_t(4096)})
+        {
+            SCOPED_TRACE(testing::Message() << "with row_size = " << row_size);
+
+            const unsigned int input_rows = 100;
+            const unsigned int rows       = 300;
+
+            std::vector<T> input
+                = test_utils::get_random_data<T>(input_rows * row_size, -100, 100, seed_value);
+            std::vector<int> indices
+                = test_utils::get_random_data<int>(rows, 0, input_rows - 1, seed_value);
+
+            T*   d_input;
+            int* d_indices;
+            T*   d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, rows * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, rows * row_size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(T),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(
+                hipMemcpy(d_indices, indices.data(), rows * sizeof(int), hipMemcpyHostToDevice));
+
+            size_t storage_size;
+            HIP_CHECK(rocprim::gather_rows(nullptr,
+                                           storage_size,
+                                           d_input,
+                                           d_indices,
+                                           d_output,
+                                           rows,
+                                           row_size));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+            HIP_CHECK(rocprim::gather_rows(d_temp_storage,
+                                           storage_size,
+                                           d_input,
+                                           d_indices,
+                                           d_output,
+                                           rows,
+                                           row_size));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(rows * row_size);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(T),
+                                hipMemcpyDeviceToHost));
+
+            std::vector<T> expected(rows * row_size);
+            for(size_t row = 0; row < rows; row++)
+            {
+                std::copy_n(input.begin() + indices[row] * row_size,
+                            row_size,
+                            expected.begin() + row * row_size);
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_indices));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
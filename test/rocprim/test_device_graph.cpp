@@ -0,0 +1,296 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_graph.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_run_length_encode.hpp>
+#include <rocprim/device/device_scan.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_hipgraphs.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <cstddef>
+
+static_assert(rocprim::is_graph_safe<rocprim::device_algorithm::scan>::value,
+              "scan must be graph-safe");
+static_assert(rocprim::is_graph_safe<rocprim::device_algorithm::run_length_encode>::value,
+              "run_length_encode must be graph-safe");
+static_assert(rocprim::is_graph_safe<rocprim::device_algorithm::nth_element>::value,
+              "nth_element must be graph-safe");
+static_assert(!rocprim::is_graph_safe<rocprim::device_algorithm::radix_sort_out_of_core>::value,
+              "radix_sort_out_of_core must not be graph-safe");
+static_assert(!rocprim::is_graph_safe<rocprim::device_algorithm::segmented_radix_sort>::value,
+              "segmented_radix_sort must not be graph-safe");
+
+// A scan node followed by a reduce node of the scan output, launched several times
+TEST(RocprimDeviceGraphTests, AlgorithmNodes)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = unsigned int;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 10, seed_value);
+
+            std::vector<T> expected_scan(size);
+            std::partial_sum(input.begin(), input.end(), expected_scan.begin());
+            const T expected_reduce
+                = std::accumulate(expected_scan.begin(), expected_scan.end(), T(0));
+
+            T* d_input;
+            T* d_scan;
+            T* d_reduce;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_scan,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_reduce, sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t scan_bytes;
+            size_t reduce_bytes;
+            HIP_CHECK(rocprim::inclusive_scan(nullptr,
+                                              scan_bytes,
+                                              d_input,
+                                              d_scan,
+                                              size,
+                                              rocprim::plus<T>(),
+                                              stream));
+            HIP_CHECK(rocprim::reduce(nullptr,
+                                      reduce_bytes,
+                                      d_scan,
+                                      d_reduce,
+                                      T(0),
+                                      size,
+                                      rocprim::plus<T>(),
+                                      stream));
+
+            void* d_scan_storage;
+            void* d_reduce_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_scan_storage, scan_bytes));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_reduce_storage, reduce_bytes));
+
+            hipGraph_t graph;
+            HIP_CHECK(hipGraphCreate(&graph, 0));
+
+            hipGraphNode_t scan_node;
+            HIP_CHECK(rocprim::add_algorithm_node(&scan_node,
+                                                  graph,
+                                                  nullptr,
+                                                  0,
+                                                  [&](hipStream_t node_stream)
+                                                  {
+                                                      return rocprim::inclusive_scan(
+                                                          d_scan_storage,
+                                                          scan_bytes,
+                                                          d_input,
+                                                          d_scan,
+                                                          size,
+                                                          rocprim::plus<T>(),
+                                                          node_stream);
+                                                  }));
+            hipGraphNode_t reduce_node;
+            HIP_CHECK(rocprim::add_algorithm_node(&reduce_node,
+                                                  graph,
+                                                  &scan_node,
+                                                  1,
+                                                  [&](hipStream_t node_stream)
+                                                  {
+                                                      return rocprim::reduce(d_reduce_storage,
+                                                                             reduce_bytes,
+                                                                             d_scan,
+                                                                             d_reduce,
+                                                                             T(0),
+                                                                             size,
+                                                                             rocprim::plus<T>(),
+                                                                             node_stream);
+                                                  }));
+
+            hipGraphExec_t graph_instance;
+            HIP_CHECK(hipGraphInstantiate(&graph_instance, graph, nullptr, nullptr, 0));
+
+            for(int launch = 0; launch < 2; launch++)
+            {
+                HIP_CHECK(hipMemsetAsync(d_scan, 0, size * sizeof(T), stream));
+                HIP_CHECK(hipMemsetAsync(d_reduce, 0, sizeof(T), stream));
+                HIP_CHECK(hipGraphLaunch(graph_instance, stream));
+                HIP_CHECK(hipStreamSynchronize(stream));
+
+                std::vector<T> scan(size);
+                T              reduce;
+                HIP_CHECK(hipMemcpy(scan.data(), d_scan, size * sizeof(T), hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(&reduce, d_reduce, sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(scan, expected_scan));
+                ASSERT_EQ(reduce, expected_reduce);
+            }
+
+            HIP_CHECK(hipGraphExecDestroy(graph_instance));
+            HIP_CHECK(hipGraphDestroy(graph));
+            HIP_CHECK(hipFree(d_scan_storage));
+            HIP_CHECK(hipFree(d_reduce_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_scan));
+            HIP_CHECK(hipFree(d_reduce));
+        }
+    }
+
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+// The non-trivial runs encoding keeps the count of runs on the device, so it can be captured
+TEST(RocprimDeviceGraphTests, RunLengthEncodeNonTrivialRuns)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+    using U = unsigned int;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Few distinct keys give both trivial and non-trivial runs
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 2, seed_value);
+
+            std::vector<U> offsets_expected;
+            std::vector<U> counts_expected;
+            for(size_t i = 0; i < size;)
+            {
+                size_t end = i + 1;
+                while(end < size && input[end] == input[i])
+                {
+                    end++;
+                }
+                if(end - i > 1)
+                {
+                    offsets_expected.push_back(static_cast<U>(i));
+                    counts_expected.push_back(static_cast<U>(end - i));
+                }
+                i = end;
+            }
+            const size_t runs_count_expected = offsets_expected.size();
+
+            T* d_input;
+            U* d_offsets;
+            U* d_counts;
+            U* d_runs_count;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(
+                &d_offsets,
+                std::max<size_t>(runs_count_expected, 1) * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(
+                &d_counts,
+                std::max<size_t>(runs_count_expected, 1) * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_runs_count, sizeof(U)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::run_length_encode_non_trivial_runs(nullptr,
+                                                                  temporary_storage_bytes,
+                                                                  d_input,
+                                                                  size,
+                                                                  d_offsets,
+                                                                  d_counts,
+                                                                  d_runs_count,
+                                                                  stream));
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            test_utils::GraphHelper gHelper;
+            gHelper.startStreamCapture(stream);
+            HIP_CHECK(rocprim::run_length_encode_non_trivial_runs(d_temporary_storage,
+                                                                  temporary_storage_bytes,
+                                                                  d_input,
+                                                                  size,
+                                                                  d_offsets,
+                                                                  d_counts,
+                                                                  d_runs_count,
+                                                                  stream));
+            gHelper.createAndLaunchGraph(stream);
+
+            std::vector<U> offsets(runs_count_expected);
+            std::vector<U> counts(runs_count_expected);
+            U              runs_count;
+            HIP_CHECK(hipMemcpy(offsets.data(),
+                                d_offsets,
+                                runs_count_expected * sizeof(U),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(counts.data(),
+                                d_counts,
+                                runs_count_expected * sizeof(U),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(&runs_count, d_runs_count, sizeof(U), hipMemcpyDeviceToHost));
+
+            ASSERT_EQ(runs_count, static_cast<U>(runs_count_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(offsets, offsets_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(counts, counts_expected));
+
+            gHelper.cleanupGraphHelper();
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_counts));
+            HIP_CHECK(hipFree(d_runs_count));
+        }
+    }
+
+    HIP_CHECK(hipStreamDestroy(stream));
+}
@@ -0,0 +1,446 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_hash_table.hpp>
+#include <rocprim/functional.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+template<class KeyType,
+         class ValueType,
+         class ReduceOp = rocprim::plus<ValueType>,
+         class Config   = rocprim::default_config>
+struct DeviceHashReduceByKeyParams
+{
+    using key_type   = KeyType;
+    using value_type = ValueType;
+    using reduce_op  = ReduceOp;
+    using config     = Config;
+};
+
+template<class Params>
+class RocprimDeviceHashReduceByKeyTests : public ::testing::Test
+{
+public:
+    using key_type               = typename Params::key_type;
+    using value_type             = typename Params::value_type;
+    using reduce_op              = typename Params::reduce_op;
+    using config                 = typename Params::config;
+    const bool debug_synchronous = false;
+};
+
+using RocprimDeviceHashReduceByKeyTestsParams = ::testing::Types<
+    DeviceHashReduceByKeyParams<int, int>,
+    DeviceHashReduceByKeyParams<unsigned int, float>,
+    DeviceHashReduceByKeyParams<long long, double>,
+    DeviceHashReduceByKeyParams<unsigned long long, unsigned long long>,
+    DeviceHashReduceByKeyParams<int, int, rocprim::maximum<int>>,
+    DeviceHashReduceByKeyParams<long long, long long, rocprim::minimum<long long>>,
+    DeviceHashReduceByKeyParams<
+        int,
+        unsigned int,
+        rocprim::plus<unsigned int>,
+        rocprim::hash_table_config<256, 2, rocprim::hash_probe_scheme::quadratic, 0>>,
+    DeviceHashReduceByKeyParams<
+        unsigned int,
+        int,
+        rocprim::maximum<int>,
+        rocprim::hash_table_config<128, 8, rocprim::hash_probe_scheme::double_hashing, 64>>,
+    DeviceHashReduceByKeyParams<
+        long long,
+        float,
+        rocprim::plus<float>,
+        rocprim::hash_table_config<512, 1, rocprim::hash_probe_scheme::linear, 16>>>;
+
+TYPED_TEST_SUITE(RocprimDeviceHashReduceByKeyTests, RocprimDeviceHashReduceByKeyTestsParams);
+
+template<class T>
+T reduce_identity(rocprim::plus<T>)
+{
+    return T(0);
+}
+
+template<class T>
+T reduce_identity(rocprim::maximum<T>)
+{
+    return std::numeric_limits<T>::lowest();
+}
+
+template<class T>
+T reduce_identity(rocprim::minimum<T>)
+{
+    return std::numeric_limits<T>::max();
+}
+
+TYPED_TEST(RocprimDeviceHashReduceByKeyTests, HashReduceByKey)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                   = typename TestFixture::key_type;
+    using value_type                 = typename TestFixture::value_type;
+    using reduce_op_type             = typename TestFixture::reduce_op;
+    using config                     = typename TestFixture::config;
+    const bool     debug_synchronous = TestFixture::debug_synchronous;
+    reduce_op_type reduce_op;
+
+    const hipStream_t stream        = 0; // default
+    const key_type    empty_key     = static_cast<key_type>(-1);
+    const value_type  initial_value = reduce_identity(reduce_op);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            // Few unique keys are aggregated mostly in shared memory, many unique keys mostly in
+            // the global table.
+            for(size_t max_key : {size_t(10), size_t(1000), size + 1})
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+                SCOPED_TRACE(testing::Message() << "with max_key = " << max_key);
+
+                const std::vector<key_type> keys
+                    = test_utils::get_random_data<key_type>(size, 0, max_key, seed_value);
+                // Small integral values, so that sums of floating point values are exact
+                const std::vector<int> int_values
+                    = test_utils::get_random_data<int>(size, 0, 10, seed_value + 1);
+                const std::vector<value_type> values(int_values.begin(), int_values.end());
+
+                std::map<key_type, value_type> expected;
+                for(size_t i = 0; i < size; ++i)
+                {
+                    auto it = expected.emplace(keys[i], initial_value).first;
+                    it->second = reduce_op(it->second, values[i]);
+                }
+                const size_t max_unique_keys = std::min(size, max_key + 1);
+
+                key_type*   d_keys;
+                value_type* d_values;
+                key_type*   d_unique;
+                value_type* d_aggregates;
+                size_t*     d_unique_count;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(*d_keys)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(*d_values)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique, size * sizeof(*d_unique)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_aggregates,
+                                                             size * sizeof(*d_aggregates)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_count, sizeof(size_t)));
+                HIP_CHECK(hipMemcpy(d_keys,
+                                    keys.data(),
+                                    size * sizeof(*d_keys),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values,
+                                    values.data(),
+                                    size * sizeof(*d_values),
+                                    hipMemcpyHostToDevice));
+
+                size_t temp_storage_size_bytes;
+                void*  d_temp_storage = nullptr;
+                HIP_CHECK(rocprim::hash_reduce_by_key<config>(d_temp_storage,
+                                                              temp_storage_size_bytes,
+                                                              d_keys,
+                                                              d_values,
+                                                              size,
+                                                              d_unique,
+                                                              d_aggregates,
+                                                              d_unique_count,
+                                                              max_unique_keys,
+                                                              empty_key,
+                                                              initial_value,
+                                                              reduce_op,
+                                                              stream,
+                                                              debug_synchronous));
+
+                ASSERT_GT(temp_storage_size_bytes, 0);
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                HIP_CHECK(rocprim::hash_reduce_by_key<config>(d_temp_storage,
+                                                              temp_storage_size_bytes,
+                                                              d_keys,
+                                                              d_values,
+                                                              size,
+                                                              d_unique,
+                                                              d_aggregates,
+                                                              d_unique_count,
+                                                              max_unique_keys,
+                                                              empty_key,
+                                                              initial_value,
+                                                              reduce_op,
+                                                              stream,
+                                                              debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                size_t unique_count;
+                HIP_CHECK(hipMemcpy(&unique_count,
+                                    d_unique_count,
+                                    sizeof(unique_count),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_EQ(unique_count, expected.size());
+
+                std::vector<key_type>   unique(unique_count);
+                std::vector<value_type> aggregates(unique_count);
+                HIP_CHECK(hipMemcpy(unique.data(),
+                                    d_unique,
+                                    unique_count * sizeof(*d_unique),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(aggregates.data(),
+                                    d_aggregates,
+                                    unique_count * sizeof(*d_aggregates),
+                                    hipMemcpyDeviceToHost));
+
+                // The unique keys are unordered
+                std::vector<size_t> order(unique_count);
+                std::iota(order.begin(), order.end(), 0);
+                std::sort(order.begin(),
+                          order.end(),
+                          [&](size_t a, size_t b) { return unique[a] < unique[b]; });
+
+                std::vector<key_type>   sorted_unique;
+                std::vector<value_type> sorted_aggregates;
+                for(const size_t i : order)
+                {
+                    sorted_unique.push_back(unique[i]);
+                    sorted_aggregates.push_back(aggregates[i]);
+                }
+                std::vector<key_type>   expected_unique;
+                std::vector<value_type> expected_aggregates;
+                for(const auto& pair : expected)
+                {
+                    expected_unique.push_back(pair.first);
+                    expected_aggregates.push_back(pair.second);
+                }
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(sorted_unique, expected_unique));
+                ASSERT_NO_FATAL_FAILURE(
+                    test_utils::assert_eq(sorted_aggregates, expected_aggregates));
+
+                HIP_CHECK(hipFree(d_keys));
+                HIP_CHECK(hipFree(d_values));
+                HIP_CHECK(hipFree(d_unique));
+                HIP_CHECK(hipFree(d_aggregates));
+                HIP_CHECK(hipFree(d_unique_count));
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+        }
+    }
+}
+
+template<class KeyType,
+         class ValueType,
+         class Config = rocprim::default_config>
+struct DeviceHashJoinParams
+{
+    using key_type   = KeyType;
+    using value_type = ValueType;
+    using config     = Config;
+};
+
+template<class Params>
+class RocprimDeviceHashJoinTests : public ::testing::Test
+{
+public:
+    using key_type               = typename Params::key_type;
+    using value_type             = typename Params::value_type;
+    using config                 = typename Params::config;
+    const bool debug_synchronous = false;
+};
+
+using RocprimDeviceHashJoinTestsParams = ::testing::Types<
+    DeviceHashJoinParams<int, int>,
+    DeviceHashJoinParams<unsigned long long, unsigned int>,
+    DeviceHashJoinParams<long long, double>,
+    DeviceHashJoinParams<
+        unsigned int,
+        long long,
+        rocprim::hash_table_config<256, 4, rocprim::hash_probe_scheme::quadratic>>,
+    DeviceHashJoinParams<
+        int,
+        unsigned short,
+        rocprim::hash_table_config<128, 2, rocprim::hash_probe_scheme::double_hashing>>>;
+
+TYPED_TEST_SUITE(RocprimDeviceHashJoinTests, RocprimDeviceHashJoinTestsParams);
+
+TYPED_TEST(RocprimDeviceHashJoinTests, BuildProbe)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type               = typename TestFixture::key_type;
+    using value_type             = typename TestFixture::value_type;
+    using config                 = typename TestFixture::config;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    const hipStream_t stream          = 0; // default
+    const key_type    empty_key       = static_cast<key_type>(-1);
+    const value_type  not_found_value = static_cast<value_type>(-1);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Unique build keys are every second key, so about half of the probes match.
+            const size_t build_size = size / 2;
+            std::vector<key_type> build_keys(build_size);
+            std::vector<value_type> build_values(build_size);
+            for(size_t i = 0; i < build_size; ++i)
+            {
+                build_keys[i]   = static_cast<key_type>(2 * i);
+                build_values[i] = static_cast<value_type>(i % 1000);
+            }
+            std::shuffle(build_keys.begin(), build_keys.end(), std::mt19937{seed_value});
+
+            const std::vector<key_type> probe_keys
+                = test_utils::get_random_data<key_type>(size,
+                                                        0,
+                                                        static_cast<key_type>(2 * build_size),
+                                                        seed_value);
+
+            std::map<key_type, value_type> table;
+            for(size_t i = 0; i < build_size; ++i)
+            {
+                table[build_keys[i]] = build_values[i];
+            }
+            std::vector<value_type> expected(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                const auto it = table.find(probe_keys[i]);
+                expected[i]   = it != table.end() ? it->second : not_found_value;
+            }
+
+            key_type*   d_build_keys;
+            value_type* d_build_values;
+            key_type*   d_probe_keys;
+            value_type* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(
+                &d_build_keys,
+                std::max<size_t>(build_size, 1) * sizeof(*d_build_keys)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(
+                &d_build_values,
+                std::max<size_t>(build_size, 1) * sizeof(*d_build_values)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_probe_keys, size * sizeof(*d_probe_keys)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(*d_output)));
+            HIP_CHECK(hipMemcpy(d_build_keys,
+                                build_keys.data(),
+                                build_size * sizeof(*d_build_keys),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_build_values,
+                                build_values.data(),
+                                build_size * sizeof(*d_build_values),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_probe_keys,
+                                probe_keys.data(),
+                                size * sizeof(*d_probe_keys),
+                                hipMemcpyHostToDevice));
+
+            size_t table_storage_size;
+            void*  d_table_storage = nullptr;
+            HIP_CHECK(rocprim::hash_join_build<config>(d_table_storage,
+                                                       table_storage_size,
+                                                       d_build_keys,
+                                                       d_build_values,
+                                                       build_size,
+                                                       empty_key,
+                                                       stream,
+                                                       debug_synchronous));
+
+            ASSERT_GT(table_storage_size, 0);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_table_storage, table_storage_size));
+
+            HIP_CHECK(rocprim::hash_join_build<config>(d_table_storage,
+                                                       table_storage_size,
+                                                       d_build_keys,
+                                                       d_build_values,
+                                                       build_size,
+                                                       empty_key,
+                                                       stream,
+                                                       debug_synchronous));
+            HIP_CHECK(rocprim::hash_join_probe<config>(d_table_storage,
+                                                       table_storage_size,
+                                                       build_size,
+                                                       d_probe_keys,
+                                                       d_output,
+                                                       size,
+                                                       empty_key,
+                                                       not_found_value,
+                                                       stream,
+                                                       debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<value_type> output(size);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                size * sizeof(*d_output),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            // A table built for more keys needs more storage than it has
+            ASSERT_EQ(rocprim::hash_join_probe<config>(d_table_storage,
+                                                       table_storage_size,
+                                                       4 * build_size + 4,
+                                                       d_probe_keys,
+                                                       d_output,
+                                                       size,
+                                                       empty_key,
+                                                       not_found_value,
+                                                       stream,
+                                                       debug_synchronous),
+                      hipErrorInvalidValue);
+
+            HIP_CHECK(hipFree(d_build_keys));
+            HIP_CHECK(hipFree(d_build_values));
+            HIP_CHECK(hipFree(d_probe_keys));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_table_storage));
+        }
+    }
+}
@@ -129,6 +129,12 @@ public:
 };
 
 using custom_config1 = rocprim::histogram_config<rocprim::kernel_config<128, 5>>;
+// Tiles of 1024 bins which do not divide the number of bins
+using custom_tiled_config1
+    = rocprim::histogram_config<rocprim::kernel_config<256, 3>, 1024, 2048, 3, 1024>;
+// Bins in global memory only
+using custom_global_config1
+    = rocprim::histogram_config<rocprim::kernel_config<256, 4>, 1024, 2048, 3, 0>;
 
 typedef ::testing::Types<params1<int, 10, 0, 10>,
                          params1<float, 10, 0, 10>,
@@ -139,6 +145,8 @@ typedef ::testing::Types<params1<int, 10, 0, 10>,
                          params1<int, 128, 0, 256, int, int, custom_config1>,
                          params1<unsigned int, 12345, 10, 12355, short>,
                          params1<unsigned short, 65536, 0, 65536, int>,
+                         params1<unsigned int, 12345, 10, 12355, short, int, custom_tiled_config1>,
+                         params1<unsigned short, 65536, 0, 65536, int, int, custom_global_config1>,
                          params1<unsigned char, 10, 20, 240, unsigned char, unsigned int>,
                          params1<unsigned char, 256, 0, 256, short>,
                          params1<double, 10, 0, 1000, double, int>,
@@ -377,6 +385,103 @@ TYPED_TEST(RocprimDeviceHistogramEven, Even)
     }
 }
 
+// Long runs of equal samples, like the constant regions of images, make most lanes of a block hit
+// the same bin, which is counted by sorting the bins of the tiles
+TEST(RocprimDeviceHistogramEven, ConstantRegions)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type  = unsigned int;
+    using counter_type = unsigned int;
+
+    const hipStream_t  stream            = 0; // default
+    const bool         debug_synchronous = false;
+    const unsigned int bins              = 256;
+    const unsigned int region_size       = 3000;
+    // Samples from bins to bins + 15 are outside of the histogram
+    const sample_type max_sample = bins + 15;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const size_t regions = rocprim::detail::ceiling_div(size, size_t(region_size));
+            const std::vector<sample_type> region_values
+                = test_utils::get_random_data<sample_type>(regions, 0, max_sample, seed_value);
+
+            std::vector<sample_type>  input(size);
+            std::vector<counter_type> histogram_expected(bins, 0);
+            for(size_t i = 0; i < size; i++)
+            {
+                input[i] = region_values[i / region_size];
+                if(input[i] < bins)
+                {
+                    histogram_expected[input[i]]++;
+                }
+            }
+
+            sample_type*  d_input;
+            counter_type* d_histogram;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(sample_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_histogram, bins * sizeof(counter_type)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * sizeof(sample_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(rocprim::histogram_even(nullptr,
+                                              temporary_storage_bytes,
+                                              d_input,
+                                              static_cast<unsigned int>(size),
+                                              d_histogram,
+                                              bins + 1,
+                                              0u,
+                                              bins,
+                                              stream,
+                                              debug_synchronous));
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::histogram_even(d_temporary_storage,
+                                              temporary_storage_bytes,
+                                              d_input,
+                                              static_cast<unsigned int>(size),
+                                              d_histogram,
+                                              bins + 1,
+                                              0u,
+                                              bins,
+                                              stream,
+                                              debug_synchronous));
+
+            std::vector<counter_type> histogram(bins);
+            HIP_CHECK(hipMemcpy(histogram.data(),
+                                d_histogram,
+                                bins * sizeof(counter_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_histogram));
+
+            test_utils::assert_eq(histogram, histogram_expected);
+        }
+    }
+}
+
 template<class SampleType,
          unsigned int Bins,
          int          StartLevel  = 0,
@@ -415,6 +520,7 @@ typedef ::testing::Types<
     params2<unsigned char, 256, 0, 1, 1, unsigned short, int, custom_config2>,
 
     params2<float, 456, -100, 1, 123>,
+    params2<float, 3000, -5000, 1, 250>,
     params2<double, 3, 10000, 1000, 1000, double, unsigned int>,
     params2<int, 10, 0, 1, 10, int, int, rocprim::default_config, true>>
     Params2;
@@ -694,6 +800,7 @@ typedef ::testing::Types<
     params3<int, 3, 3, 128, 0, 256>,
     params3<unsigned int, 1, 1, 12345, 10, 12355, short>,
     params3<unsigned short, 4, 4, 65536, 0, 65536, int>,
+    params3<unsigned short, 4, 3, 5000, 0, 65536, int, unsigned int, custom_tiled_config1>,
     params3<unsigned char, 3, 1, 10, 20, 240, unsigned char, unsigned int>,
     params3<unsigned char, 2, 2, 256, 0, 256, short>,
 
@@ -1265,3 +1372,1075 @@ TYPED_TEST(RocprimDeviceHistogramMultiRange, MultiRange)
         HIP_CHECK(hipStreamDestroy(stream));
     }
 }
+
+template<class SampleType,
+         class WeightType,
+         class OutputType,
+         unsigned int Bins,
+         int          LowerLevel,
+         int          UpperLevel,
+         bool         Deterministic = false,
+         class Config               = rocprim::default_config>
+struct params5
+{
+    using sample_type                           = SampleType;
+    using weight_type                           = WeightType;
+    using output_type                           = OutputType;
+    static constexpr unsigned int bins          = Bins;
+    static constexpr int          lower_level   = LowerLevel;
+    static constexpr int          upper_level   = UpperLevel;
+    static constexpr bool         deterministic = Deterministic;
+    using config                                = Config;
+};
+
+template<class Params>
+class RocprimDeviceHistogramWeighted : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params5<int, float, float, 10, 0, 10>,
+                         params5<int, double, double, 100, -100, 100>,
+                         params5<int, short, int, 1000, 0, 2000>,
+                         params5<int, int, long long, 65536, 0, 65536>,
+                         params5<int, float, double, 100, 0, 1000, true>,
+                         params5<unsigned short, double, float, 256, 0, 256, true, custom_config1>,
+                         params5<unsigned short, float, double, 12345, 10, 12355, true>>
+    Params5;
+
+TYPED_TEST_SUITE(RocprimDeviceHistogramWeighted, Params5);
+
+TYPED_TEST(RocprimDeviceHistogramWeighted, EvenWeighted)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type                    = typename TestFixture::params::sample_type;
+    using weight_type                    = typename TestFixture::params::weight_type;
+    using output_type                    = typename TestFixture::params::output_type;
+    using config                         = typename TestFixture::params::config;
+    constexpr unsigned int bins          = TestFixture::params::bins;
+    constexpr int          lower_level   = TestFixture::params::lower_level;
+    constexpr int          upper_level   = TestFixture::params::upper_level;
+    constexpr bool         deterministic = TestFixture::params::deterministic;
+
+    const hipStream_t stream            = 0; // default
+    const bool        debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Small integral weights, so the totals are exact in all weight and output types
+            const std::vector<sample_type> input
+                = get_random_samples<sample_type>(size, lower_level, upper_level, seed_value);
+            const std::vector<int> int_weights
+                = test_utils::get_random_data<int>(size, -4, 4, seed_value + 1);
+            std::vector<weight_type> weights(int_weights.begin(), int_weights.end());
+
+            std::vector<output_type> histogram_expected(bins, 0);
+            const int                scale = (upper_level - lower_level) / bins;
+            for(size_t i = 0; i < size; i++)
+            {
+                const long long sample = static_cast<long long>(input[i]);
+                if(sample >= lower_level && sample < upper_level)
+                {
+                    histogram_expected[(sample - lower_level) / scale] += int_weights[i];
+                }
+            }
+
+            sample_type* d_input;
+            weight_type* d_weights;
+            output_type* d_histogram;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(sample_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_weights,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(weight_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_histogram, bins * sizeof(output_type)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * sizeof(sample_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_weights,
+                                weights.data(),
+                                size * sizeof(weight_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(rocprim::histogram_even_weighted<config>(nullptr,
+                                                               temporary_storage_bytes,
+                                                               d_input,
+                                                               d_weights,
+                                                               static_cast<unsigned int>(size),
+                                                               d_histogram,
+                                                               bins + 1,
+                                                               sample_type(lower_level),
+                                                               sample_type(upper_level),
+                                                               deterministic,
+                                                               stream,
+                                                               debug_synchronous));
+
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::histogram_even_weighted<config>(d_temporary_storage,
+                                                               temporary_storage_bytes,
+                                                               d_input,
+                                                               d_weights,
+                                                               static_cast<unsigned int>(size),
+                                                               d_histogram,
+                                                               bins + 1,
+                                                               sample_type(lower_level),
+                                                               sample_type(upper_level),
+                                                               deterministic,
+                                                               stream,
+                                                               debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<output_type> histogram(bins);
+            HIP_CHECK(hipMemcpy(histogram.data(),
+                                d_histogram,
+                                bins * sizeof(output_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_weights));
+            HIP_CHECK(hipFree(d_histogram));
+
+            for(size_t i = 0; i < bins; i++)
+            {
+                ASSERT_EQ(histogram[i], histogram_expected[i]) << "where index = " << i;
+            }
+        }
+    }
+}
+
+// Deterministic histograms of fractional weights are reproducible and close to the exact totals
+TEST(RocprimDeviceHistogramWeighted, MultiRangeDeterministic)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type                      = int;
+    using weight_type                      = float;
+    using output_type                      = double;
+    constexpr unsigned int channels        = 3;
+    constexpr unsigned int active_channels = 2;
+
+    const hipStream_t stream            = 0; // default
+    const bool        debug_synchronous = false;
+
+    unsigned int levels[active_channels] = {11, 501};
+    std::vector<sample_type> level_values[active_channels];
+    for(unsigned int channel = 0; channel < active_channels; channel++)
+    {
+        for(unsigned int level = 0; level < levels[channel]; level++)
+        {
+            level_values[channel].push_back(static_cast<sample_type>(level * (channel + 1)));
+        }
+    }
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<sample_type> input
+                = test_utils::get_random_data<sample_type>(size * channels, -10, 1100, seed_value);
+            const std::vector<weight_type> weights
+                = test_utils::get_random_data<weight_type>(size, -1.0f, 1.0f, seed_value + 1);
+
+            std::vector<double> histogram_expected[active_channels];
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                histogram_expected[channel].assign(levels[channel] - 1, 0.0);
+            }
+            for(size_t i = 0; i < size; i++)
+            {
+                for(unsigned int channel = 0; channel < active_channels; channel++)
+                {
+                    const std::vector<sample_type>& values = level_values[channel];
+                    const sample_type               sample = input[i * channels + channel];
+                    if(sample >= values.front() && sample < values.back())
+                    {
+                        const size_t bin
+                            = std::upper_bound(values.begin(), values.end(), sample)
+                              - values.begin() - 1;
+                        histogram_expected[channel][bin] += weights[i];
+                    }
+                }
+            }
+
+            sample_type* d_input;
+            weight_type* d_weights;
+            sample_type* d_level_values[active_channels];
+            output_type* d_histogram[active_channels];
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * channels
+                                                             * sizeof(sample_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_weights,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(weight_type)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * channels * sizeof(sample_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_weights,
+                                weights.data(),
+                                size * sizeof(weight_type),
+                                hipMemcpyHostToDevice));
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_level_values[channel],
+                                                             levels[channel]
+                                                                 * sizeof(sample_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_histogram[channel],
+                                                             (levels[channel] - 1)
+                                                                 * sizeof(output_type)));
+                HIP_CHECK(hipMemcpy(d_level_values[channel],
+                                    level_values[channel].data(),
+                                    levels[channel] * sizeof(sample_type),
+                                    hipMemcpyHostToDevice));
+            }
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK((rocprim::multi_histogram_range_weighted<channels, active_channels>(
+                nullptr,
+                temporary_storage_bytes,
+                d_input,
+                d_weights,
+                static_cast<unsigned int>(size),
+                d_histogram,
+                levels,
+                d_level_values,
+                true,
+                stream,
+                debug_synchronous)));
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            std::vector<output_type> histogram[2][active_channels];
+            for(auto& run_histogram : histogram)
+            {
+                HIP_CHECK((rocprim::multi_histogram_range_weighted<channels, active_channels>(
+                    d_temporary_storage,
+                    temporary_storage_bytes,
+                    d_input,
+                    d_weights,
+                    static_cast<unsigned int>(size),
+                    d_histogram,
+                    levels,
+                    d_level_values,
+                    true,
+                    stream,
+                    debug_synchronous)));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                for(unsigned int channel = 0; channel < active_channels; channel++)
+                {
+                    run_histogram[channel].resize(levels[channel] - 1);
+                    HIP_CHECK(hipMemcpy(run_histogram[channel].data(),
+                                        d_histogram[channel],
+                                        (levels[channel] - 1) * sizeof(output_type),
+                                        hipMemcpyDeviceToHost));
+                }
+            }
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_weights));
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                HIP_CHECK(hipFree(d_level_values[channel]));
+                HIP_CHECK(hipFree(d_histogram[channel]));
+            }
+
+            for(unsigned int channel = 0; channel < active_channels; channel++)
+            {
+                SCOPED_TRACE(testing::Message() << "with channel = " << channel);
+
+                for(size_t i = 0; i < levels[channel] - 1; i++)
+                {
+                    ASSERT_EQ(histogram[0][channel][i], histogram[1][channel][i]);
+                    ASSERT_NEAR(histogram[0][channel][i], histogram_expected[channel][i], 1e-6);
+                }
+            }
+        }
+    }
+}
+
+// Several ticks of new samples are added to the same histogram, which is scaled first
+TEST(RocprimDeviceHistogramEven, EvenAccumulate)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type                  = int;
+    using counter_type                 = unsigned int;
+    constexpr unsigned int bins        = 100;
+    constexpr int          lower_level = 0;
+    constexpr int          upper_level = 1000;
+
+    const hipStream_t stream            = 0; // default
+    const bool        debug_synchronous = false;
+
+    const std::vector<double> decays = {0.0, 1.0, 0.5, 0.75, 1.0};
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            sample_type*  d_input;
+            counter_type* d_histogram;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(sample_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_histogram, bins * sizeof(counter_type)));
+            // The first tick clears the bins
+            HIP_CHECK(hipMemset(d_histogram, 0xFF, bins * sizeof(counter_type)));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(rocprim::histogram_even_accumulate(nullptr,
+                                                         temporary_storage_bytes,
+                                                         d_input,
+                                                         static_cast<unsigned int>(size),
+                                                         d_histogram,
+                                                         bins + 1,
+                                                         lower_level,
+                                                         upper_level,
+                                                         0.0,
+                                                         stream,
+                                                         debug_synchronous));
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            std::vector<counter_type> histogram_expected(bins, 0);
+            for(size_t tick = 0; tick < decays.size(); tick++)
+            {
+                SCOPED_TRACE(testing::Message() << "with tick = " << tick);
+
+                const std::vector<sample_type> input
+                    = get_random_samples<sample_type>(size,
+                                                      lower_level,
+                                                      upper_level,
+                                                      seed_value + tick);
+                for(auto& bin : histogram_expected)
+                {
+                    bin = static_cast<counter_type>(static_cast<double>(bin) * decays[tick]);
+                }
+                for(size_t i = 0; i < size; i++)
+                {
+                    if(input[i] >= lower_level && input[i] < upper_level)
+                    {
+                        histogram_expected[(input[i] - lower_level) / (upper_level / bins)]++;
+                    }
+                }
+
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    size * sizeof(sample_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(rocprim::histogram_even_accumulate(d_temporary_storage,
+                                                             temporary_storage_bytes,
+                                                             d_input,
+                                                             static_cast<unsigned int>(size),
+                                                             d_histogram,
+                                                             bins + 1,
+                                                             lower_level,
+                                                             upper_level,
+                                                             decays[tick],
+                                                             stream,
+                                                             debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<counter_type> histogram(bins);
+                HIP_CHECK(hipMemcpy(histogram.data(),
+                                    d_histogram,
+                                    bins * sizeof(counter_type),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(histogram, histogram_expected));
+            }
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_histogram));
+        }
+    }
+}
+
+TEST(RocprimDeviceHistogramWeighted, EvenWeightedAccumulate)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type                  = int;
+    using weight_type                  = float;
+    using output_type                  = double;
+    constexpr unsigned int bins        = 1000;
+    constexpr int          lower_level = -1000;
+    constexpr int          upper_level = 1000;
+
+    const hipStream_t stream            = 0; // default
+    const bool        debug_synchronous = false;
+
+    // Halving keeps the totals of small integral weights exact
+    const std::vector<double> decays = {0.0, 0.5, 1.0, 0.5};
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            sample_type* d_input;
+            weight_type* d_weights;
+            output_type* d_histogram;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(sample_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_weights,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(weight_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_histogram, bins * sizeof(output_type)));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(rocprim::histogram_even_weighted_accumulate(nullptr,
+                                                                  temporary_storage_bytes,
+                                                                  d_input,
+                                                                  d_weights,
+                                                                  static_cast<unsigned int>(size),
+                                                                  d_histogram,
+                                                                  bins + 1,
+                                                                  lower_level,
+                                                                  upper_level,
+                                                                  0.0,
+                                                                  false,
+                                                                  stream,
+                                                                  debug_synchronous));
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            std::vector<output_type> histogram_expected(bins, 0.0);
+            for(size_t tick = 0; tick < decays.size(); tick++)
+            {
+                SCOPED_TRACE(testing::Message() << "with tick = " << tick);
+
+                const std::vector<sample_type> input
+                    = get_random_samples<sample_type>(size,
+                                                      lower_level,
+                                                      upper_level,
+                                                      seed_value + tick);
+                const std::vector<int> int_weights
+                    = test_utils::get_random_data<int>(size, -4, 4, seed_value + tick + 1);
+                std::vector<weight_type> weights(int_weights.begin(), int_weights.end());
+
+                for(auto& bin : histogram_expected)
+                {
+                    bin *= decays[tick];
+                }
+                for(size_t i = 0; i < size; i++)
+                {
+                    if(input[i] >= lower_level && input[i] < upper_level)
+                    {
+                        histogram_expected[(input[i] - lower_level)
+                                           / ((upper_level - lower_level) / bins)]
+                            += int_weights[i];
+                    }
+                }
+
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    size * sizeof(sample_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_weights,
+                                    weights.data(),
+                                    size * sizeof(weight_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(
+                    rocprim::histogram_even_weighted_accumulate(d_temporary_storage,
+                                                                temporary_storage_bytes,
+                                                                d_input,
+                                                                d_weights,
+                                                                static_cast<unsigned int>(size),
+                                                                d_histogram,
+                                                                bins + 1,
+                                                                lower_level,
+                                                                upper_level,
+                                                                decays[tick],
+                                                                false,
+                                                                stream,
+                                                                debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<output_type> histogram(bins);
+                HIP_CHECK(hipMemcpy(histogram.data(),
+                                    d_histogram,
+                                    bins * sizeof(output_type),
+                                    hipMemcpyDeviceToHost));
+                for(size_t i = 0; i < bins; i++)
+                {
+                    ASSERT_EQ(histogram[i], histogram_expected[i]) << "where index = " << i;
+                }
+            }
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_weights));
+            HIP_CHECK(hipFree(d_histogram));
+        }
+    }
+}
+
+TEST(RocprimDeviceHistogramJoint, Even2d)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type  = int;
+    using counter_type = unsigned int;
+
+    const hipStream_t stream            = 0; // default
+    const bool        debug_synchronous = false;
+
+    // Small bin products fit in shared memory, 256x256 bins take the tiled path
+    const std::vector<std::pair<unsigned int, unsigned int>> bin_counts
+        = {{1, 1}, {4, 5}, {64, 64}, {256, 256}};
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const auto& bins : bin_counts)
+        {
+            SCOPED_TRACE(testing::Message()
+                         << "with bins = " << bins.first << "x" << bins.second);
+
+            unsigned int levels[2]      = {bins.first + 1, bins.second + 1};
+            sample_type  lower_level[2] = {-100, 0};
+            sample_type  upper_level[2]
+                = {lower_level[0] + static_cast<sample_type>(bins.first) * 3,
+                   lower_level[1] + static_cast<sample_type>(bins.second) * 2};
+            const size_t total_bins = size_t(bins.first) * bins.second;
+
+            for(size_t size : test_utils::get_sizes(seed_value))
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+                const std::vector<sample_type> x_input
+                    = get_random_samples<sample_type>(size,
+                                                      lower_level[0],
+                                                      upper_level[0],
+                                                      seed_value);
+                const std::vector<sample_type> y_input
+                    = get_random_samples<sample_type>(size,
+                                                      lower_level[1],
+                                                      upper_level[1],
+                                                      seed_value + 1);
+
+                std::vector<counter_type> histogram_expected(total_bins, 0);
+                for(size_t i = 0; i < size; i++)
+                {
+                    if(x_input[i] >= lower_level[0] && x_input[i] < upper_level[0]
+                       && y_input[i] >= lower_level[1] && y_input[i] < upper_level[1])
+                    {
+                        const size_t bx = (x_input[i] - lower_level[0]) / 3;
+                        const size_t by = (y_input[i] - lower_level[1]) / 2;
+                        histogram_expected[bx * bins.second + by]++;
+                    }
+                }
+
+                sample_type*  d_x_input;
+                sample_type*  d_y_input;
+                counter_type* d_histogram;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_x_input,
+                                                             std::max<size_t>(size, 1)
+                                                                 * sizeof(sample_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_y_input,
+                                                             std::max<size_t>(size, 1)
+                                                                 * sizeof(sample_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_histogram,
+                                                             total_bins * sizeof(counter_type)));
+                HIP_CHECK(hipMemcpy(d_x_input,
+                                    x_input.data(),
+                                    size * sizeof(sample_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_y_input,
+                                    y_input.data(),
+                                    size * sizeof(sample_type),
+                                    hipMemcpyHostToDevice));
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(rocprim::histogram2d_even(nullptr,
+                                                    temporary_storage_bytes,
+                                                    d_x_input,
+                                                    d_y_input,
+                                                    static_cast<unsigned int>(size),
+                                                    d_histogram,
+                                                    levels,
+                                                    lower_level,
+                                                    upper_level,
+                                                    stream,
+                                                    debug_synchronous));
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+
+                HIP_CHECK(rocprim::histogram2d_even(d_temporary_storage,
+                                                    temporary_storage_bytes,
+                                                    d_x_input,
+                                                    d_y_input,
+                                                    static_cast<unsigned int>(size),
+                                                    d_histogram,
+                                                    levels,
+                                                    lower_level,
+                                                    upper_level,
+                                                    stream,
+                                                    debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<counter_type> histogram(total_bins);
+                HIP_CHECK(hipMemcpy(histogram.data(),
+                                    d_histogram,
+                                    total_bins * sizeof(counter_type),
+                                    hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+                HIP_CHECK(hipFree(d_x_input));
+                HIP_CHECK(hipFree(d_y_input));
+                HIP_CHECK(hipFree(d_histogram));
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(histogram, histogram_expected));
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceHistogramJoint, RangeNd)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type                 = float;
+    using level_type                  = float;
+    using counter_type                = unsigned int;
+    constexpr unsigned int dimensions = 3;
+
+    const hipStream_t stream            = 0; // default
+    const bool        debug_synchronous = false;
+
+    // Irregular levels, 5x7x3 bins
+    const std::vector<std::vector<level_type>> level_values
+        = {{0.0f, 1.0f, 3.0f, 7.0f, 8.0f, 20.0f},
+           {-5.0f, -2.0f, 0.0f, 0.5f, 1.0f, 4.0f, 9.0f, 10.0f},
+           {0.0f, 10.0f, 100.0f, 1000.0f}};
+
+    unsigned int levels[dimensions];
+    size_t       total_bins = 1;
+    for(unsigned int d = 0; d < dimensions; d++)
+    {
+        levels[d] = static_cast<unsigned int>(level_values[d].size());
+        total_bins *= levels[d] - 1;
+    }
+
+    level_type* d_level_values[dimensions];
+    for(unsigned int d = 0; d < dimensions; d++)
+    {
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_level_values[d],
+                                                     levels[d] * sizeof(level_type)));
+        HIP_CHECK(hipMemcpy(d_level_values[d],
+                            level_values[d].data(),
+                            levels[d] * sizeof(level_type),
+                            hipMemcpyHostToDevice));
+    }
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<sample_type> input(size * dimensions);
+            for(unsigned int d = 0; d < dimensions; d++)
+            {
+                const std::vector<sample_type> values
+                    = get_random_samples<sample_type>(size,
+                                                      level_values[d].front(),
+                                                      level_values[d].back(),
+                                                      seed_value + d);
+                for(size_t i = 0; i < size; i++)
+                {
+                    input[i * dimensions + d] = values[i];
+                }
+            }
+
+            std::vector<counter_type> histogram_expected(total_bins, 0);
+            for(size_t i = 0; i < size; i++)
+            {
+                size_t index = 0;
+                bool   valid = true;
+                for(unsigned int d = 0; d < dimensions && valid; d++)
+                {
+                    const auto& values = level_values[d];
+                    const auto  bin
+                        = std::upper_bound(values.begin(), values.end(), input[i * dimensions + d])
+                          - values.begin() - 1;
+                    valid = bin >= 0 && bin < static_cast<long>(values.size() - 1);
+                    index = index * (values.size() - 1) + bin;
+                }
+                if(valid)
+                {
+                    histogram_expected[index]++;
+                }
+            }
+
+            sample_type*  d_input;
+            counter_type* d_histogram;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(input.size(), 1)
+                                                             * sizeof(sample_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_histogram,
+                                                         total_bins * sizeof(counter_type)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(sample_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(rocprim::histogram_nd_range<dimensions>(nullptr,
+                                                              temporary_storage_bytes,
+                                                              d_input,
+                                                              static_cast<unsigned int>(size),
+                                                              d_histogram,
+                                                              levels,
+                                                              d_level_values,
+                                                              stream,
+                                                              debug_synchronous));
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::histogram_nd_range<dimensions>(d_temporary_storage,
+                                                              temporary_storage_bytes,
+                                                              d_input,
+                                                              static_cast<unsigned int>(size),
+                                                              d_histogram,
+                                                              levels,
+                                                              d_level_values,
+                                                              stream,
+                                                              debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<counter_type> histogram(total_bins);
+            HIP_CHECK(hipMemcpy(histogram.data(),
+                                d_histogram,
+                                total_bins * sizeof(counter_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_histogram));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(histogram, histogram_expected));
+        }
+    }
+
+    for(unsigned int d = 0; d < dimensions; d++)
+    {
+        HIP_CHECK(hipFree(d_level_values[d]));
+    }
+}
+
+TEST(RocprimDeviceHistogramJoint, IncorrectInput)
+{
+    size_t       temporary_storage_bytes = 0;
+    int*         samples                 = nullptr;
+    unsigned int levels[2]               = {65537, 65537};
+    int          lower_level[2]          = {0, 0};
+    int          upper_level[2]          = {65536, 65536};
+    ASSERT_EQ(rocprim::histogram2d_even(nullptr,
+                                        temporary_storage_bytes,
+                                        samples,
+                                        samples,
+                                        123,
+                                        static_cast<int*>(nullptr),
+                                        levels,
+                                        lower_level,
+                                        upper_level),
+              hipErrorInvalidValue);
+}
+
+TEST(RocprimDeviceHistogramSorted, EvenSorted)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type  = float;
+    using counter_type = unsigned int;
+
+    const hipStream_t stream            = 0; // default
+    const bool        debug_synchronous = false;
+    const sample_type lower_level       = -10.0f;
+    const sample_type upper_level       = 1000.0f;
+    // Many bins walk the runs of samples of small inputs
+    const std::vector<unsigned int> bin_counts = {1, 7, 256, 100000};
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(unsigned int bins : bin_counts)
+        {
+            SCOPED_TRACE(testing::Message() << "with bins = " << bins);
+
+            for(size_t size : test_utils::get_sizes(seed_value))
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+                std::vector<sample_type> input
+                    = get_random_samples<sample_type>(size, lower_level, upper_level, seed_value);
+                std::sort(input.begin(), input.end());
+
+                // The reference uses the same bin computation as histogram_even
+                std::vector<counter_type> histogram_expected(bins, 0);
+                const rocprim::detail::sample_to_bin_even<sample_type> op(bins,
+                                                                          lower_level,
+                                                                          upper_level);
+                for(size_t i = 0; i < size; i++)
+                {
+                    unsigned int bin;
+                    if(op(input[i], bin))
+                    {
+                        histogram_expected[std::min(bin, bins - 1)]++;
+                    }
+                }
+
+                sample_type*  d_input;
+                counter_type* d_histogram;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                             std::max<size_t>(size, 1)
+                                                                 * sizeof(sample_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_histogram, bins * sizeof(counter_type)));
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    size * sizeof(sample_type),
+                                    hipMemcpyHostToDevice));
+                // The result must not depend on the previous contents of the histogram
+                HIP_CHECK(hipMemset(d_histogram, 0xFF, bins * sizeof(counter_type)));
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(rocprim::histogram_even_sorted(nullptr,
+                                                         temporary_storage_bytes,
+                                                         d_input,
+                                                         static_cast<unsigned int>(size),
+                                                         d_histogram,
+                                                         bins + 1,
+                                                         lower_level,
+                                                         upper_level,
+                                                         stream,
+                                                         debug_synchronous));
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+
+                HIP_CHECK(rocprim::histogram_even_sorted(d_temporary_storage,
+                                                         temporary_storage_bytes,
+                                                         d_input,
+                                                         static_cast<unsigned int>(size),
+                                                         d_histogram,
+                                                         bins + 1,
+                                                         lower_level,
+                                                         upper_level,
+                                                         stream,
+                                                         debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<counter_type> histogram(bins);
+                HIP_CHECK(hipMemcpy(histogram.data(),
+                                    d_histogram,
+                                    bins * sizeof(counter_type),
+                                    hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_histogram));
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(histogram, histogram_expected));
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceHistogramSorted, RangeSorted)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type  = int;
+    using level_type   = int;
+    using counter_type = unsigned int;
+
+    const hipStream_t stream            = 0; // default
+    const bool        debug_synchronous = false;
+    const std::vector<unsigned int> bin_counts = {1, 10, 1000, 50000};
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(unsigned int bins : bin_counts)
+        {
+            SCOPED_TRACE(testing::Message() << "with bins = " << bins);
+
+            // Irregular levels
+            std::vector<level_type> level_values(bins + 1);
+            for(unsigned int i = 0; i <= bins; i++)
+            {
+                level_values[i] = static_cast<level_type>(i + i * i / 64);
+            }
+
+            level_type* d_level_values;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_level_values,
+                                                         (bins + 1) * sizeof(level_type)));
+            HIP_CHECK(hipMemcpy(d_level_values,
+                                level_values.data(),
+                                (bins + 1) * sizeof(level_type),
+                                hipMemcpyHostToDevice));
+
+            for(size_t size : test_utils::get_sizes(seed_value))
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+                std::vector<sample_type> input
+                    = get_random_samples<sample_type>(size,
+                                                      level_values.front(),
+                                                      level_values.back(),
+                                                      seed_value);
+                std::sort(input.begin(), input.end());
+
+                std::vector<counter_type> histogram_expected(bins, 0);
+                for(size_t i = 0; i < size; i++)
+                {
+                    const auto bin
+                        = std::upper_bound(level_values.begin(), level_values.end(), input[i])
+                          - level_values.begin() - 1;
+                    if(bin >= 0 && bin < static_cast<long>(bins))
+                    {
+                        histogram_expected[bin]++;
+                    }
+                }
+
+                sample_type*  d_input;
+                counter_type* d_histogram;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                             std::max<size_t>(size, 1)
+                                                                 * sizeof(sample_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_histogram, bins * sizeof(counter_type)));
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    size * sizeof(sample_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemset(d_histogram, 0xFF, bins * sizeof(counter_type)));
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(rocprim::histogram_range_sorted(nullptr,
+                                                          temporary_storage_bytes,
+                                                          d_input,
+                                                          static_cast<unsigned int>(size),
+                                                          d_histogram,
+                                                          bins + 1,
+                                                          d_level_values,
+                                                          stream,
+                                                          debug_synchronous));
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+
+                HIP_CHECK(rocprim::histogram_range_sorted(d_temporary_storage,
+                                                          temporary_storage_bytes,
+                                                          d_input,
+                                                          static_cast<unsigned int>(size),
+                                                          d_histogram,
+                                                          bins + 1,
+                                                          d_level_values,
+                                                          stream,
+                                                          debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<counter_type> histogram(bins);
+                HIP_CHECK(hipMemcpy(histogram.data(),
+                                    d_histogram,
+                                    bins * sizeof(counter_type),
+                                    hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_histogram));
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(histogram, histogram_expected));
+            }
+
+            HIP_CHECK(hipFree(d_level_values));
+        }
+    }
+}
@@ -0,0 +1,196 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_jit.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+
+// Defined the same way in the source of the kernels
+struct min_max
+{
+    int min;
+    int max;
+};
+
+const char* min_max_definition = "struct min_max { int min; int max; };";
+
+const char* min_max_op_definition = R"(
+struct min_max_op
+{
+    __device__ min_max operator()(const min_max& a, const min_max& b) const
+    {
+        return {a.min < b.min ? a.min : b.min, a.max > b.max ? a.max : b.max};
+    }
+};
+)";
+
+const char* to_min_max_op_definition = R"(
+struct to_min_max_op
+{
+    __device__ min_max operator()(int x) const
+    {
+        return {x, x};
+    }
+};
+)";
+
+const rocprim::jit_type int_type{"int", sizeof(int)};
+const rocprim::jit_type min_max_type{"min_max", sizeof(min_max), min_max_definition};
+
+} // namespace
+
+class RocprimDeviceJitTests : public ::testing::TestWithParam<size_t>
+{};
+
+INSTANTIATE_TEST_SUITE_P(RocprimDeviceJitTests,
+                         RocprimDeviceJitTests,
+                         ::testing::Values(0, 1, 100, 12345, 1 << 20, (1 << 22) + 17));
+
+TEST_P(RocprimDeviceJitTests, TransformAndReduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const size_t size = GetParam();
+    SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+    hipStream_t stream = 0;
+
+    rocprim::jit_options options;
+    std::string          compile_log;
+    options.compile_log = &compile_log;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const std::vector<int> input
+            = test_utils::get_random_data<int>(size, -1000000, 1000000, seed_value);
+
+        int*     d_input;
+        min_max* d_pairs;
+        min_max* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_pairs, size * sizeof(min_max)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(min_max)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+        const rocprim::jit_operator to_min_max{"to_min_max_op", to_min_max_op_definition};
+        ASSERT_EQ(rocprim::jit_transform(d_input,
+                                         d_pairs,
+                                         size,
+                                         int_type,
+                                         min_max_type,
+                                         to_min_max,
+                                         options,
+                                         stream),
+                  hipSuccess)
+            << compile_log;
+
+        const rocprim::jit_operator reduce_op{"min_max_op", min_max_op_definition};
+        const min_max               initial{1 << 30, -(1 << 30)};
+        size_t                      storage_size = 0;
+        HIP_CHECK(rocprim::jit_reduce(nullptr,
+                                      storage_size,
+                                      d_pairs,
+                                      d_output,
+                                      &initial,
+                                      size,
+                                      min_max_type,
+                                      reduce_op,
+                                      options,
+                                      stream));
+        void* d_storage;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_size));
+        ASSERT_EQ(rocprim::jit_reduce(d_storage,
+                                      storage_size,
+                                      d_pairs,
+                                      d_output,
+                                      &initial,
+                                      size,
+                                      min_max_type,
+                                      reduce_op,
+                                      options,
+                                      stream),
+                  hipSuccess)
+            << compile_log;
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        min_max output;
+        HIP_CHECK(hipMemcpy(&output, d_output, sizeof(min_max), hipMemcpyDeviceToHost));
+
+        min_max expected = initial;
+        for(const int x : input)
+        {
+            expected.min = std::min(expected.min, x);
+            expected.max = std::max(expected.max, x);
+        }
+        ASSERT_EQ(output.min, expected.min);
+        ASSERT_EQ(output.max, expected.max);
+
+        HIP_CHECK(hipFree(d_storage));
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_pairs));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
+TEST(RocprimDeviceJitTests, CompileError)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const size_t size = 1024;
+    int*         d_data;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_data, size * sizeof(int)));
+
+    rocprim::jit_options options;
+    std::string          compile_log;
+    options.compile_log = &compile_log;
+
+    const rocprim::jit_operator broken_op{"broken_op", "struct broken_op { not valid C++ };"};
+    ASSERT_EQ(
+        rocprim::jit_transform(d_data, d_data, size, int_type, int_type, broken_op, options),
+        hipErrorInvalidImage);
+    ASSERT_FALSE(compile_log.empty());
+
+    HIP_CHECK(hipFree(d_data));
+}
@@ -0,0 +1,226 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_lexicographic_sort.hpp>
+#include <rocprim/types/tuple.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_sort_comparator.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+template<bool Descending, class... Args>
+hipError_t invoke_lexicographic_sort(Args&&... args)
+{
+    return Descending ? rocprim::lexicographic_sort_desc(std::forward<Args>(args)...)
+                      : rocprim::lexicographic_sort(std::forward<Args>(args)...);
+}
+
+// Rows of a column with few distinct keys, a constant column and a column of floating-point keys.
+// With `unique_first`, the first column has no duplicates and decides the order on its own.
+template<bool Descending>
+void run_lexicographic_sort_test(const bool unique_first, const bool stop_when_unique)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using first_type  = int;
+    using second_type = unsigned char;
+    using third_type  = float;
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<first_type> first
+                = test_utils::get_random_data<first_type>(size, -4, 4, seed_value);
+            if(unique_first)
+            {
+                std::iota(first.begin(), first.end(), 0);
+                std::reverse(first.begin(), first.end());
+            }
+            const std::vector<second_type> second(size, second_type(3));
+            const std::vector<third_type>  third
+                = test_utils::get_random_data<third_type>(size, -100, 100, seed_value + 1);
+
+            // Calculate expected results on host
+            std::vector<size_t> permutation(size);
+            std::iota(permutation.begin(), permutation.end(), 0);
+            const auto first_less
+                = test_utils::key_comparator<first_type, Descending, 0, 8 * sizeof(first_type)>();
+            const auto second_less
+                = test_utils::key_comparator<second_type, Descending, 0, 8 * sizeof(second_type)>();
+            const auto third_less
+                = test_utils::key_comparator<third_type, Descending, 0, 8 * sizeof(third_type)>();
+            std::stable_sort(permutation.begin(),
+                             permutation.end(),
+                             [&](const size_t lhs, const size_t rhs)
+                             {
+                                 if(first_less(first[lhs], first[rhs])
+                                    || first_less(first[rhs], first[lhs]))
+                                 {
+                                     return first_less(first[lhs], first[rhs]);
+                                 }
+                                 if(second_less(second[lhs], second[rhs])
+                                    || second_less(second[rhs], second[lhs]))
+                                 {
+                                     return second_less(second[lhs], second[rhs]);
+                                 }
+                                 return third_less(third[lhs], third[rhs]);
+                             });
+
+            std::vector<first_type>  expected_first(size);
+            std::vector<second_type> expected_second(size);
+            std::vector<third_type>  expected_third(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                expected_first[i]  = first[permutation[i]];
+                expected_second[i] = second[permutation[i]];
+                expected_third[i]  = third[permutation[i]];
+            }
+
+            first_type*  d_first;
+            second_type* d_second;
+            third_type*  d_third;
+            first_type*  d_first_output;
+            second_type* d_second_output;
+            third_type*  d_third_output;
+            const size_t allocated = std::max<size_t>(size, 1);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_first, allocated * sizeof(first_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_second, allocated * sizeof(second_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_third, allocated * sizeof(third_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_first_output,
+                                                         allocated * sizeof(first_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_second_output,
+                                                         allocated * sizeof(second_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_third_output,
+                                                         allocated * sizeof(third_type)));
+            HIP_CHECK(hipMemcpy(d_first,
+                                first.data(),
+                                size * sizeof(first_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_second,
+                                second.data(),
+                                size * sizeof(second_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_third,
+                                third.data(),
+                                size * sizeof(third_type),
+                                hipMemcpyHostToDevice));
+
+            const auto keys_inputs  = rocprim::make_tuple(d_first, d_second, d_third);
+            const auto keys_outputs
+                = rocprim::make_tuple(d_first_output, d_second_output, d_third_output);
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(invoke_lexicographic_sort<Descending>(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            keys_inputs,
+                                                            keys_outputs,
+                                                            size,
+                                                            stop_when_unique,
+                                                            stream,
+                                                            debug_synchronous));
+
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(invoke_lexicographic_sort<Descending>(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            keys_inputs,
+                                                            keys_outputs,
+                                                            size,
+                                                            stop_when_unique,
+                                                            stream,
+                                                            debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<first_type>  first_output(size);
+            std::vector<second_type> second_output(size);
+            std::vector<third_type>  third_output(size);
+            HIP_CHECK(hipMemcpy(first_output.data(),
+                                d_first_output,
+                                size * sizeof(first_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(second_output.data(),
+                                d_second_output,
+                                size * sizeof(second_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(third_output.data(),
+                                d_third_output,
+                                size * sizeof(third_type),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(first_output, expected_first));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(second_output, expected_second));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(third_output, expected_third));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_first));
+            HIP_CHECK(hipFree(d_second));
+            HIP_CHECK(hipFree(d_third));
+            HIP_CHECK(hipFree(d_first_output));
+            HIP_CHECK(hipFree(d_second_output));
+            HIP_CHECK(hipFree(d_third_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceLexicographicSortTests, SortColumns)
+{
+    run_lexicographic_sort_test<false>(false, false);
+}
+
+TEST(RocprimDeviceLexicographicSortTests, SortColumnsDescending)
+{
+    run_lexicographic_sort_test<true>(false, false);
+}
+
+TEST(RocprimDeviceLexicographicSortTests, StopWhenUnique)
+{
+    // Duplicates in the first column fall back to sorting every column
+    run_lexicographic_sort_test<false>(false, true);
+    run_lexicographic_sort_test<false>(true, true);
+    run_lexicographic_sort_test<true>(true, true);
+}
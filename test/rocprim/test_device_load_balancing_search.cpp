@@ -0,0 +1,168 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_load_balancing_search.hpp>
+#include <rocprim/device/device_transform_config.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+template<class Offset, class Config, bool ManyEmpty>
+struct LoadBalancingSearchParams
+{
+    using offset_type                = Offset;
+    using config                     = Config;
+    static constexpr bool many_empty = ManyEmpty;
+};
+
+template<class Params>
+class RocprimDeviceLoadBalancingSearchTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using RocprimDeviceLoadBalancingSearchTestsParams = ::testing::Types<
+    LoadBalancingSearchParams<unsigned int, rocprim::default_config, false>,
+    LoadBalancingSearchParams<unsigned int, rocprim::default_config, true>,
+    LoadBalancingSearchParams<int, rocprim::transform_config<64, 3>, false>,
+    LoadBalancingSearchParams<size_t, rocprim::transform_config<128, 1>, true>>;
+
+TYPED_TEST_SUITE(RocprimDeviceLoadBalancingSearchTests,
+                 RocprimDeviceLoadBalancingSearchTestsParams);
+
+TYPED_TEST(RocprimDeviceLoadBalancingSearchTests, SegmentIdsAndRanks)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using offset_type = typename TestFixture::params::offset_type;
+    using config      = typename TestFixture::params::config;
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const size_t num_segments : test_utils::get_sizes(seed_value))
+        {
+            if(num_segments == 0 || num_segments > (1 << 20))
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with num_segments = " << num_segments);
+
+            // With many empty segments, most tiles hold only segment begins
+            const std::vector<unsigned int> lengths = test_utils::get_random_data<unsigned int>(
+                num_segments,
+                0,
+                TestFixture::params::many_empty ? 1 : 20,
+                seed_value);
+            std::vector<offset_type> offsets(num_segments);
+            size_t                   total_work = 0;
+            for(size_t s = 0; s < num_segments; ++s)
+            {
+                offsets[s] = static_cast<offset_type>(total_work);
+                total_work += TestFixture::params::many_empty && s % 64 != 0 ? 0 : lengths[s];
+            }
+            SCOPED_TRACE(testing::Message() << "with total_work = " << total_work);
+
+            std::vector<size_t> expected_segment_ids(total_work);
+            std::vector<size_t> expected_ranks(total_work);
+            for(size_t s = 0; s < num_segments; ++s)
+            {
+                const size_t end = s + 1 < num_segments ? offsets[s + 1] : total_work;
+                for(size_t w = offsets[s]; w < end; ++w)
+                {
+                    expected_segment_ids[w] = s;
+                    expected_ranks[w]       = w - offsets[s];
+                }
+            }
+
+            offset_type* d_offsets;
+            size_t*      d_segment_ids;
+            size_t*      d_ranks;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         num_segments * sizeof(offset_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_segment_ids,
+                                                         (total_work + 1) * sizeof(size_t)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_ranks, (total_work + 1) * sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                num_segments * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            HIP_CHECK(rocprim::load_balancing_search_with_ranks<config>(d_offsets,
+                                                                        num_segments,
+                                                                        total_work,
+                                                                        d_segment_ids,
+                                                                        d_ranks,
+                                                                        stream));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<size_t> segment_ids(total_work);
+            std::vector<size_t> ranks(total_work);
+            HIP_CHECK(hipMemcpy(segment_ids.data(),
+                                d_segment_ids,
+                                total_work * sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(ranks.data(),
+                                d_ranks,
+                                total_work * sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(segment_ids, expected_segment_ids));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(ranks, expected_ranks));
+
+            // Without ranks
+            HIP_CHECK(hipMemset(d_segment_ids, 0, (total_work + 1) * sizeof(size_t)));
+            HIP_CHECK(rocprim::load_balancing_search<config>(d_offsets,
+                                                             num_segments,
+                                                             total_work,
+                                                             d_segment_ids,
+                                                             stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipMemcpy(segment_ids.data(),
+                                d_segment_ids,
+                                total_work * sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(segment_ids, expected_segment_ids));
+
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_segment_ids));
+            HIP_CHECK(hipFree(d_ranks));
+        }
+    }
+}
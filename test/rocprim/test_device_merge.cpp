@@ -103,6 +103,9 @@ std::vector<std::tuple<size_t, size_t>> get_sizes()
         std::make_tuple(17867, 34567),
         std::make_tuple(34567, (1 << 17) - 1220),
         std::make_tuple(924353, 1723454),
+        std::make_tuple(0, 100000),
+        std::make_tuple(7, 123456),
+        std::make_tuple(654321, 1000),
     };
     return sizes;
 }
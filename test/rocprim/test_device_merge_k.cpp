@@ -0,0 +1,267 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_merge_k.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/types.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <cstddef>
+
+template<class KeyType,
+         class ValueType = unsigned int,
+         class CompareOp = rocprim::less<KeyType>,
+         class Config    = rocprim::default_config>
+struct DeviceMergeKParams
+{
+    using key_type        = KeyType;
+    using value_type      = ValueType;
+    using compare_op_type = CompareOp;
+    using config          = Config;
+};
+
+template<class Params>
+class RocprimDeviceMergeKTests : public ::testing::Test
+{
+public:
+    using key_type               = typename Params::key_type;
+    using value_type             = typename Params::value_type;
+    using compare_op_type        = typename Params::compare_op_type;
+    using config                 = typename Params::config;
+    const bool debug_synchronous = false;
+};
+
+using RocprimDeviceMergeKTestsParams = ::testing::Types<
+    DeviceMergeKParams<int>,
+    DeviceMergeKParams<unsigned char, unsigned int>,
+    DeviceMergeKParams<long long, unsigned int, rocprim::greater<long long>>,
+    DeviceMergeKParams<float, size_t>,
+    DeviceMergeKParams<double, unsigned int, rocprim::greater<double>>,
+    DeviceMergeKParams<rocprim::half, unsigned int>,
+    DeviceMergeKParams<int, unsigned int, rocprim::less<int>, rocprim::merge_config<64, 1>>,
+    DeviceMergeKParams<short, unsigned int, rocprim::less<short>, rocprim::merge_config<256, 7>>>;
+
+TYPED_TEST_SUITE(RocprimDeviceMergeKTests, RocprimDeviceMergeKTestsParams);
+
+const unsigned int run_counts[] = {1, 2, 7, 8, 64, 256};
+
+template<class Params>
+void test_merge_k(const bool with_values, const bool debug_synchronous)
+{
+    using key_type        = typename Params::key_type;
+    using value_type      = typename Params::value_type;
+    using compare_op_type = typename Params::compare_op_type;
+    using config          = typename Params::config;
+    const compare_op_type compare_op;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            for(const unsigned int runs : run_counts)
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+                SCOPED_TRACE(testing::Message() << "with runs = " << runs);
+
+                // Random run lengths, so that many short runs are empty. Run r is followed by
+                // one unused key, so the runs are not contiguous.
+                std::vector<size_t> cuts
+                    = test_utils::get_random_data<size_t>(runs - 1, 0, size, seed_value);
+                cuts.push_back(0);
+                cuts.push_back(size);
+                std::sort(cuts.begin(), cuts.end());
+
+                std::vector<unsigned int> begin_offsets(runs);
+                std::vector<unsigned int> end_offsets(runs);
+                for(unsigned int r = 0; r < runs; r++)
+                {
+                    begin_offsets[r] = static_cast<unsigned int>(cuts[r] + r);
+                    end_offsets[r]   = static_cast<unsigned int>(cuts[r + 1] + r);
+                }
+
+                // Few distinct keys, so that the stability is checked
+                const size_t          input_size = size + runs;
+                std::vector<key_type> keys_input
+                    = test_utils::get_random_data<key_type>(input_size, 0, 50, seed_value);
+                std::vector<value_type> values_input(input_size);
+                std::iota(values_input.begin(), values_input.end(), value_type(0));
+
+                std::vector<value_type> expected_values;
+                for(unsigned int r = 0; r < runs; r++)
+                {
+                    std::sort(keys_input.begin() + begin_offsets[r],
+                              keys_input.begin() + end_offsets[r],
+                              compare_op);
+                    for(unsigned int i = begin_offsets[r]; i < end_offsets[r]; i++)
+                    {
+                        expected_values.push_back(values_input[i]);
+                    }
+                }
+                std::stable_sort(expected_values.begin(),
+                                 expected_values.end(),
+                                 [&](const value_type a, const value_type b)
+                                 { return compare_op(keys_input[a], keys_input[b]); });
+                std::vector<key_type> expected_keys(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected_keys[i] = keys_input[expected_values[i]];
+                }
+
+                key_type*     d_keys_input;
+                value_type*   d_values_input;
+                key_type*     d_keys_output;
+                value_type*   d_values_output;
+                unsigned int* d_begin_offsets;
+                unsigned int* d_end_offsets;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                             input_size * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                             input_size * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                             (size + 1) * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                             (size + 1) * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_begin_offsets,
+                                                             runs * sizeof(unsigned int)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_end_offsets,
+                                                             runs * sizeof(unsigned int)));
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    keys_input.data(),
+                                    input_size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    input_size * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_begin_offsets,
+                                    begin_offsets.data(),
+                                    runs * sizeof(unsigned int),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_end_offsets,
+                                    end_offsets.data(),
+                                    runs * sizeof(unsigned int),
+                                    hipMemcpyHostToDevice));
+
+                const auto invoke = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+                {
+                    if(with_values)
+                    {
+                        return rocprim::merge_k<config>(d_temp_storage,
+                                                        temp_storage_size_bytes,
+                                                        d_keys_input,
+                                                        d_keys_output,
+                                                        d_values_input,
+                                                        d_values_output,
+                                                        size,
+                                                        runs,
+                                                        d_begin_offsets,
+                                                        d_end_offsets,
+                                                        compare_op,
+                                                        hipStreamDefault,
+                                                        debug_synchronous);
+                    }
+                    return rocprim::merge_k<config>(d_temp_storage,
+                                                    temp_storage_size_bytes,
+                                                    d_keys_input,
+                                                    d_keys_output,
+                                                    size,
+                                                    runs,
+                                                    d_begin_offsets,
+                                                    d_end_offsets,
+                                                    compare_op,
+                                                    hipStreamDefault,
+                                                    debug_synchronous);
+                };
+
+                size_t temp_storage_size_bytes;
+                void*  d_temp_storage = nullptr;
+                HIP_CHECK(invoke(d_temp_storage, temp_storage_size_bytes));
+
+                ASSERT_GT(temp_storage_size_bytes, 0);
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                HIP_CHECK(invoke(d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                std::vector<key_type> keys_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+
+                if(with_values)
+                {
+                    std::vector<value_type> values_output(size);
+                    HIP_CHECK(hipMemcpy(values_output.data(),
+                                        d_values_output,
+                                        size * sizeof(value_type),
+                                        hipMemcpyDeviceToHost));
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, expected_values));
+                }
+
+                HIP_CHECK(hipFree(d_temp_storage));
+                HIP_CHECK(hipFree(d_keys_input));
+                HIP_CHECK(hipFree(d_values_input));
+                HIP_CHECK(hipFree(d_keys_output));
+                HIP_CHECK(hipFree(d_values_output));
+                HIP_CHECK(hipFree(d_begin_offsets));
+                HIP_CHECK(hipFree(d_end_offsets));
+            }
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceMergeKTests, MergeK)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    test_merge_k<TypeParam>(false, TestFixture::debug_synchronous);
+}
+
+TYPED_TEST(RocprimDeviceMergeKTests, MergeKByKey)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    test_merge_k<TypeParam>(true, TestFixture::debug_synchronous);
+}
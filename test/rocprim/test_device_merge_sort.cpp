@@ -63,6 +63,10 @@ public:
 };
 
 using RocprimDeviceSortTestsParams = ::testing::Types<
+#if ROCPRIM_HAS_INT128_SUPPORT
+    DeviceSortParams<rocprim::int128_t>,
+    DeviceSortParams<rocprim::uint128_t, int>,
+#endif
     DeviceSortParams<unsigned short, int>,
     DeviceSortParams<signed char, test_utils::custom_test_type<float>>,
     DeviceSortParams<int>,
@@ -408,6 +412,356 @@ TYPED_TEST(RocprimDeviceSortTests, SortKeyValue)
     }
 }
 
+// Rearranges the keys into the patterns that merge_sort_adaptive detects: not sorted, sorted,
+// sorted with a few swapped neighbours, sorted runs of random lengths and sorted in reverse.
+template<class Key, class CompareFunction>
+void make_presorted(std::vector<Key>&     keys,
+                    const unsigned int    pattern,
+                    const CompareFunction compare_op,
+                    const unsigned int    seed_value)
+{
+    std::default_random_engine gen(seed_value);
+    switch(pattern)
+    {
+        case 0: break;
+        case 1: std::stable_sort(keys.begin(), keys.end(), compare_op); break;
+        case 2:
+            std::stable_sort(keys.begin(), keys.end(), compare_op);
+            for(size_t i = 1; i < keys.size(); i += 1 + gen() % 5000)
+            {
+                std::swap(keys[i - 1], keys[i]);
+            }
+            break;
+        case 3:
+            for(size_t begin = 0; begin < keys.size();)
+            {
+                const size_t end = std::min(keys.size(), begin + 1 + gen() % 20000);
+                std::stable_sort(keys.begin() + begin, keys.begin() + end, compare_op);
+                begin = end;
+            }
+            break;
+        default:
+            std::stable_sort(keys.begin(), keys.end(), compare_op);
+            std::reverse(keys.begin(), keys.end());
+            break;
+    }
+}
+
+// This test also ensures that merge_sort_adaptive is stable
+TYPED_TEST(RocprimDeviceSortTests, SortKeyValueAdaptive)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = typename TestFixture::key_type;
+    using value_type = typename TestFixture::value_type;
+    using compare_function = typename TestFixture::compare_function;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    if(TestFixture::use_graphs)
+    {
+        GTEST_SKIP() << "merge_sort_adaptive synchronizes the stream, it can not be captured";
+    }
+
+    hipStream_t stream = 0; // default
+
+    bool in_place = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(unsigned int pattern = 0; pattern < 5; pattern++)
+            {
+                SCOPED_TRACE(testing::Message() << "with pattern = " << pattern);
+
+                in_place = !in_place;
+
+                // compare function
+                compare_function compare_op;
+
+                // Generate data
+                std::vector<key_type> keys_input
+                    = test_utils::get_random_data<key_type>(size, -100, 100, seed_value);
+                make_presorted(keys_input, pattern, compare_op, seed_value);
+
+                std::vector<value_type> values_input(size);
+                test_utils::iota(values_input.begin(), values_input.end(), 0);
+
+                key_type*   d_keys_input;
+                key_type*   d_keys_output;
+                value_type* d_values_input;
+                value_type* d_values_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                             size * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                             size * sizeof(value_type)));
+                if(in_place)
+                {
+                    d_keys_output   = d_keys_input;
+                    d_values_output = d_values_input;
+                }
+                else
+                {
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                                 size * sizeof(key_type)));
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                                 size * sizeof(value_type)));
+                }
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    keys_input.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    size * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+
+                // Calculate expected results on host
+                using key_value = std::pair<key_type, value_type>;
+                std::vector<key_value> expected(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected[i] = key_value(keys_input[i], values_input[i]);
+                }
+                std::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 [compare_op](const key_value& a, const key_value& b)
+                                 { return compare_op(a.first, b.first); });
+
+                // temp storage
+                size_t temp_storage_size_bytes;
+                void*  d_temp_storage = nullptr;
+                // Get size of d_temp_storage
+                HIP_CHECK(rocprim::merge_sort_adaptive(d_temp_storage,
+                                                       temp_storage_size_bytes,
+                                                       d_keys_input,
+                                                       d_keys_output,
+                                                       d_values_input,
+                                                       d_values_output,
+                                                       size,
+                                                       compare_op,
+                                                       stream,
+                                                       debug_synchronous));
+
+                // temp_storage_size_bytes must be >0
+                ASSERT_GT(temp_storage_size_bytes, 0);
+
+                // allocate temporary storage
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                // Run
+                HIP_CHECK(rocprim::merge_sort_adaptive(d_temp_storage,
+                                                       temp_storage_size_bytes,
+                                                       d_keys_input,
+                                                       d_keys_output,
+                                                       d_values_input,
+                                                       d_values_output,
+                                                       size,
+                                                       compare_op,
+                                                       stream,
+                                                       debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                // Copy output to host
+                std::vector<key_type>   keys_output(size);
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                std::vector<key_type>   keys_expected(size);
+                std::vector<value_type> values_expected(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    keys_expected[i]   = expected[i].first;
+                    values_expected[i] = expected[i].second;
+                }
+
+                // Check if output values are as expected
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, keys_expected));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+
+                HIP_CHECK(hipFree(d_keys_input));
+                HIP_CHECK(hipFree(d_values_input));
+                if(!in_place)
+                {
+                    HIP_CHECK(hipFree(d_keys_output));
+                    HIP_CHECK(hipFree(d_values_output));
+                }
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+        }
+    }
+}
+
+// This test also ensures that merge_sort_in_place is stable
+TYPED_TEST(RocprimDeviceSortTests, SortKeyValueInPlace)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = typename TestFixture::key_type;
+    using value_type = typename TestFixture::value_type;
+    using compare_function = typename TestFixture::compare_function;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size, -100, 100, seed_value);
+
+            std::vector<value_type> values_input(size);
+            test_utils::iota(values_input.begin(), values_input.end(), 0);
+
+            key_type*   d_keys;
+            key_type*   d_keys_only;
+            value_type* d_values;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_only, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_keys,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_keys_only,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            // compare function
+            compare_function compare_op;
+
+            // Calculate expected results on host
+            using key_value = std::pair<key_type, value_type>;
+            std::vector<key_value> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = key_value(keys_input[i], values_input[i]);
+            }
+            std::stable_sort(expected.begin(),
+                             expected.end(),
+                             [compare_op](const key_value& a, const key_value& b)
+                             { return compare_op(a.first, b.first); });
+
+            // temp storage
+            size_t temp_storage_size_bytes;
+            size_t keys_temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            // Get size of d_temp_storage
+            HIP_CHECK(rocprim::merge_sort_in_place(d_temp_storage,
+                                                   temp_storage_size_bytes,
+                                                   d_keys,
+                                                   d_values,
+                                                   size,
+                                                   compare_op,
+                                                   stream,
+                                                   debug_synchronous));
+            HIP_CHECK(rocprim::merge_sort_in_place(d_temp_storage,
+                                                   keys_temp_storage_size_bytes,
+                                                   d_keys_only,
+                                                   size,
+                                                   compare_op,
+                                                   stream,
+                                                   debug_synchronous));
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            // The temporary storage must not hold a copy of the keys
+            ASSERT_LT(temp_storage_size_bytes, std::max(size * sizeof(key_type), size_t(4096)));
+            temp_storage_size_bytes
+                = std::max(temp_storage_size_bytes, keys_temp_storage_size_bytes);
+
+            // allocate temporary storage
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            // Run
+            HIP_CHECK(rocprim::merge_sort_in_place(d_temp_storage,
+                                                   temp_storage_size_bytes,
+                                                   d_keys,
+                                                   d_values,
+                                                   size,
+                                                   compare_op,
+                                                   stream,
+                                                   debug_synchronous));
+            HIP_CHECK(rocprim::merge_sort_in_place(d_temp_storage,
+                                                   temp_storage_size_bytes,
+                                                   d_keys_only,
+                                                   size,
+                                                   compare_op,
+                                                   stream,
+                                                   debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Copy output to host
+            std::vector<key_type>   keys_output(size);
+            std::vector<key_type>   keys_only_output(size);
+            std::vector<value_type> values_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(keys_only_output.data(),
+                                d_keys_only,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            std::vector<key_type>   keys_expected(size);
+            std::vector<value_type> values_expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                keys_expected[i]   = expected[i].first;
+                values_expected[i] = expected[i].second;
+            }
+
+            // Check if output values are as expected
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, keys_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_only_output, keys_expected));
+
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_keys_only));
+            HIP_CHECK(hipFree(d_values));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
 void testLargeIndices()
 {
     using key_type = uint8_t;
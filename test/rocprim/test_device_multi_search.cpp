@@ -0,0 +1,300 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_multi_search.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+template<unsigned int Alphabet,
+         unsigned int MaxLength,
+         class Config   = rocprim::default_config,
+         bool UseGraphs = false>
+struct DeviceMultiSearchParams
+{
+    using config                             = Config;
+    static constexpr unsigned int alphabet   = Alphabet;
+    static constexpr unsigned int max_length = MaxLength;
+    static constexpr bool         use_graphs = UseGraphs;
+};
+
+template<class Params>
+class RocprimDeviceMultiSearchTests : public ::testing::Test
+{
+public:
+    using config                                    = typename Params::config;
+    static constexpr unsigned int alphabet          = Params::alphabet;
+    static constexpr unsigned int max_length        = Params::max_length;
+    static constexpr bool         use_graphs        = Params::use_graphs;
+    const bool                    debug_synchronous = false;
+};
+
+using RocprimDeviceMultiSearchTestsParams
+    = ::testing::Types<DeviceMultiSearchParams<4, 4>,
+                       DeviceMultiSearchParams<2, 8>,
+                       DeviceMultiSearchParams<256, 2>,
+                       DeviceMultiSearchParams<3, 40>,
+                       DeviceMultiSearchParams<4, 6, rocprim::multi_search_config<64, 3>>,
+                       DeviceMultiSearchParams<5, 3, rocprim::multi_search_config<256, 16>>,
+                       DeviceMultiSearchParams<4, 4, rocprim::default_config, true>>;
+
+TYPED_TEST_SUITE(RocprimDeviceMultiSearchTests, RocprimDeviceMultiSearchTestsParams);
+
+TYPED_TEST(RocprimDeviceMultiSearchTests, MultiSearch)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using config                 = typename TestFixture::config;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::default_random_engine                  gen(seed_value);
+        std::uniform_int_distribution<unsigned int> byte_dis(0, TestFixture::alphabet - 1);
+        std::uniform_int_distribution<unsigned int> length_dis(1, TestFixture::max_length);
+
+        // A few random patterns, which may share prefixes and suffixes or be duplicates
+        const size_t        patterns_count = 1 + seed_value % 8;
+        std::vector<char>   patterns;
+        std::vector<size_t> pattern_offsets{0};
+        for(size_t pattern = 0; pattern < patterns_count; pattern++)
+        {
+            const unsigned int length = length_dis(gen);
+            for(unsigned int i = 0; i < length; i++)
+            {
+                patterns.push_back(static_cast<char>(byte_dis(gen)));
+            }
+            pattern_offsets.push_back(patterns.size());
+        }
+
+        hipStream_t stream = 0; // default
+        if(TestFixture::use_graphs)
+        {
+            // Default stream does not support hipGraph stream capture, so create one
+            HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+        }
+
+        // The build synchronizes the stream, so it is not captured
+        rocprim::multi_search_automaton automaton;
+        size_t                          automaton_storage_size;
+        void*                           d_automaton_storage = nullptr;
+        HIP_CHECK(rocprim::multi_search_build(d_automaton_storage,
+                                              automaton_storage_size,
+                                              automaton,
+                                              patterns.data(),
+                                              pattern_offsets.data(),
+                                              patterns_count,
+                                              stream,
+                                              debug_synchronous));
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_automaton_storage, automaton_storage_size));
+        HIP_CHECK(rocprim::multi_search_build(d_automaton_storage,
+                                              automaton_storage_size,
+                                              automaton,
+                                              patterns.data(),
+                                              pattern_offsets.data(),
+                                              patterns_count,
+                                              stream,
+                                              debug_synchronous));
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<char> input(size);
+            for(char& byte : input)
+            {
+                byte = static_cast<char>(byte_dis(gen));
+            }
+
+            // Matches ordered by their end, and by decreasing length of the patterns
+            std::vector<size_t>       expected_positions;
+            std::vector<unsigned int> expected_patterns;
+            for(size_t end = 1; end <= size; end++)
+            {
+                std::vector<std::pair<size_t, unsigned int>> matches;
+                for(size_t pattern = 0; pattern < patterns_count; pattern++)
+                {
+                    const size_t length = pattern_offsets[pattern + 1] - pattern_offsets[pattern];
+                    if(length <= end
+                       && std::equal(patterns.begin() + pattern_offsets[pattern],
+                                     patterns.begin() + pattern_offsets[pattern + 1],
+                                     input.begin() + (end - length)))
+                    {
+                        matches.emplace_back(length, static_cast<unsigned int>(pattern));
+                    }
+                }
+                std::stable_sort(matches.begin(),
+                                 matches.end(),
+                                 [](const std::pair<size_t, unsigned int>& a,
+                                    const std::pair<size_t, unsigned int>& b)
+                                 { return a.first > b.first; });
+                for(const std::pair<size_t, unsigned int>& match : matches)
+                {
+                    expected_positions.push_back(end - match.first);
+                    expected_patterns.push_back(match.second);
+                }
+            }
+            const size_t expected_count = expected_positions.size();
+
+            // Only a part of the matches fits in the output of some sizes
+            const size_t max_matches = size % 3 == 0 ? expected_count / 2 : expected_count;
+            expected_positions.resize(max_matches);
+            expected_patterns.resize(max_matches);
+
+            char*         d_input;
+            size_t*       d_positions;
+            unsigned int* d_patterns;
+            size_t*       d_matches_count;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(*d_input)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_positions,
+                                                         std::max<size_t>(max_matches, 1)
+                                                             * sizeof(*d_positions)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_patterns,
+                                                         std::max<size_t>(max_matches, 1)
+                                                             * sizeof(*d_patterns)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_matches_count,
+                                                         sizeof(*d_matches_count)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(*d_input), hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::multi_search<config>(d_temp_storage,
+                                                    temp_storage_size_bytes,
+                                                    automaton,
+                                                    d_input,
+                                                    size,
+                                                    d_positions,
+                                                    d_patterns,
+                                                    d_matches_count,
+                                                    max_matches,
+                                                    stream,
+                                                    debug_synchronous));
+
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            test_utils::GraphHelper gHelper;
+            if(TestFixture::use_graphs)
+            {
+                gHelper.startStreamCapture(stream);
+            }
+
+            HIP_CHECK(rocprim::multi_search<config>(d_temp_storage,
+                                                    temp_storage_size_bytes,
+                                                    automaton,
+                                                    d_input,
+                                                    size,
+                                                    d_positions,
+                                                    d_patterns,
+                                                    d_matches_count,
+                                                    max_matches,
+                                                    stream,
+                                                    debug_synchronous));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.createAndLaunchGraph(stream);
+            }
+
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<size_t>       positions(max_matches);
+            std::vector<unsigned int> pattern_indices(max_matches);
+            size_t                    matches_count;
+            HIP_CHECK(hipMemcpy(positions.data(),
+                                d_positions,
+                                max_matches * sizeof(*d_positions),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(pattern_indices.data(),
+                                d_patterns,
+                                max_matches * sizeof(*d_patterns),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(&matches_count,
+                                d_matches_count,
+                                sizeof(matches_count),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_EQ(matches_count, expected_count);
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(positions, expected_positions));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(pattern_indices, expected_patterns));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_positions));
+            HIP_CHECK(hipFree(d_patterns));
+            HIP_CHECK(hipFree(d_matches_count));
+            HIP_CHECK(hipFree(d_temp_storage));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.cleanupGraphHelper();
+            }
+        }
+
+        HIP_CHECK(hipFree(d_automaton_storage));
+        if(TestFixture::use_graphs)
+        {
+            HIP_CHECK(hipStreamDestroy(stream));
+        }
+    }
+}
+
+TEST(RocprimDeviceMultiSearchTests, EmptyPattern)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const char   patterns[]        = "ab";
+    const size_t pattern_offsets[] = {0, 2, 2};
+
+    rocprim::multi_search_automaton automaton;
+    size_t                          automaton_storage_size;
+    ASSERT_EQ(rocprim::multi_search_build(nullptr,
+                                          automaton_storage_size,
+                                          automaton,
+                                          patterns,
+                                          pattern_offsets,
+                                          2),
+              hipErrorInvalidValue);
+}
@@ -37,8 +37,10 @@
 #include <rocprim/functional.hpp>
 
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <iterator>
+#include <numeric>
 #include <vector>
 
 #include <cassert>
@@ -166,7 +168,7 @@ using RocprimDeviceNthelementTestsParams = ::testing::Types<
     DeviceNthelementParams<test_utils::custom_test_type<float>>,
     DeviceNthelementParams<test_utils::custom_float_type>,
     DeviceNthelementParams<test_utils::custom_test_array_type<int, 4>>,
-    // DeviceNthelementParams<int, rocprim::less<int>, rocprim::default_config, true>, // Graphs currently do not work
+    DeviceNthelementParams<int, rocprim::less<int>, rocprim::default_config, true>,
     DeviceNthelementParams<int, rocprim::less<int>, rocprim::default_config, false, true>,
     DeviceNthelementParams<int, rocprim::greater<int>>,
     DeviceNthelementParams<
@@ -434,3 +436,277 @@ TEST(RocprimNthelementKeySameTests, NthelementKeySame)
         HIP_CHECK(hipFree(d_temp_storage));
     }
 }
+
+// Inputs with few distinct keys, or one key that makes up nearly all of the input, keep a large
+// subrange around the nth element for more passes than random keys do.
+TEST(RocprimNthelementKeySameTests, NthelementKeyFewDistinct)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                      = int;
+    using compare_function              = rocprim::less<int>;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::vector<size_t> sizes = test_utils::get_sizes(seed_value);
+        sizes.push_back(1 << 22);
+        for(size_t size : sizes)
+        {
+            if(size == 0)
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // The number of distinct keys, 0 stands for one repeated key and random other keys
+            for(int distinct_keys : {1, 2, 3, 5, 0})
+            {
+                SCOPED_TRACE(testing::Message() << "with distinct_keys = " << distinct_keys);
+
+                std::vector<key_type> input;
+                if(distinct_keys > 0)
+                {
+                    input = test_utils::get_random_data<key_type>(size,
+                                                                  0,
+                                                                  distinct_keys - 1,
+                                                                  seed_value);
+                }
+                else
+                {
+                    input = test_utils::get_random_data<key_type>(size, 0, 1 << 20, seed_value);
+                    const std::vector<key_type> pick
+                        = test_utils::get_random_data<key_type>(size, 0, 99, seed_value + 1);
+                    for(size_t i = 0; i < size; ++i)
+                    {
+                        input[i] = pick[i] == 0 ? input[i] : 1 << 19;
+                    }
+                }
+
+                const size_t nth_element
+                    = test_utils::get_random_value<size_t>(0, size - 1, seed_value);
+                SCOPED_TRACE(testing::Message() << "with nth_element = " << nth_element);
+
+                key_type* d_keys;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_keys, input.size() * sizeof(*d_keys)));
+                HIP_CHECK(hipMemcpy(d_keys,
+                                    input.data(),
+                                    input.size() * sizeof(*d_keys),
+                                    hipMemcpyHostToDevice));
+
+                compare_function compare_op;
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::nth_element(nullptr,
+                                               temp_storage_size_bytes,
+                                               d_keys,
+                                               nth_element,
+                                               input.size(),
+                                               compare_op,
+                                               stream,
+                                               debug_synchronous));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                HIP_CHECK(rocprim::nth_element(d_temp_storage,
+                                               temp_storage_size_bytes,
+                                               d_keys,
+                                               nth_element,
+                                               input.size(),
+                                               compare_op,
+                                               stream,
+                                               debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<key_type> output(size);
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_keys,
+                                    output.size() * sizeof(*d_keys),
+                                    hipMemcpyDeviceToHost));
+
+                compare(input, output, nth_element, compare_op);
+
+                HIP_CHECK(hipFree(d_keys));
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+        }
+    }
+}
+
+template<class Key>
+class RocprimDeviceSegmentedNthelementTests : public ::testing::Test
+{
+public:
+    using key_type = Key;
+};
+
+using RocprimDeviceSegmentedNthelementTestsParams
+    = ::testing::Types<int, unsigned short, float, double, long long>;
+
+TYPED_TEST_SUITE(RocprimDeviceSegmentedNthelementTests,
+                 RocprimDeviceSegmentedNthelementTestsParams);
+
+TYPED_TEST(RocprimDeviceSegmentedNthelementTests, SegmentedNthelementPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = typename TestFixture::key_type;
+    using value_type = unsigned int;
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(unsigned int nth : {0u, 7u, 300u})
+        {
+            SCOPED_TRACE(testing::Message() << "with nth = " << nth);
+
+            // Segments that are selected by warps, by blocks and by several blocks, some of them
+            // not larger than nth
+            std::vector<size_t> segment_lengths
+                = test_utils::get_random_data<size_t>(100, 0, 3000, seed_value);
+            segment_lengths[20] = 100000;
+
+            const unsigned int        segments = static_cast<unsigned int>(segment_lengths.size());
+            std::vector<unsigned int> offsets(segments + 1, 0);
+            for(unsigned int i = 0; i < segments; ++i)
+            {
+                offsets[i + 1] = offsets[i] + static_cast<unsigned int>(segment_lengths[i]);
+            }
+            const size_t size = offsets.back();
+
+            // Few distinct keys, so that the nth key has ties
+            std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size, 0, 100, seed_value);
+            std::vector<value_type> values_input(size);
+            std::iota(values_input.begin(), values_input.end(), 0u);
+
+            key_type*     d_keys_input;
+            value_type*   d_values_input;
+            key_type*     d_keys_output;
+            value_type*   d_values_output;
+            unsigned int* d_offsets;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                         size * sizeof(*d_keys_input)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         size * sizeof(*d_values_input)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                         size * sizeof(*d_keys_output)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                         size * sizeof(*d_values_output)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(*d_offsets)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(*d_keys_input),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(*d_values_input),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(*d_offsets),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::segmented_nth_element_pairs(d_temp_storage,
+                                                           temp_storage_size_bytes,
+                                                           d_keys_input,
+                                                           d_values_input,
+                                                           d_keys_output,
+                                                           d_values_output,
+                                                           segments,
+                                                           d_offsets,
+                                                           d_offsets + 1,
+                                                           nth,
+                                                           stream,
+                                                           debug_synchronous));
+
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(rocprim::segmented_nth_element_pairs(d_temp_storage,
+                                                           temp_storage_size_bytes,
+                                                           d_keys_input,
+                                                           d_values_input,
+                                                           d_keys_output,
+                                                           d_values_output,
+                                                           segments,
+                                                           d_offsets,
+                                                           d_offsets + 1,
+                                                           nth,
+                                                           stream,
+                                                           debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<key_type>   keys_output(size);
+            std::vector<value_type> values_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(*d_keys_output),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                size * sizeof(*d_values_output),
+                                hipMemcpyDeviceToHost));
+
+            for(unsigned int segment = 0; segment < segments; ++segment)
+            {
+                SCOPED_TRACE(testing::Message() << "with segment = " << segment);
+
+                const auto begin = offsets[segment];
+                const auto end   = offsets[segment + 1];
+                for(size_t i = begin; i < end; ++i)
+                {
+                    // Every value must be written once, together with its key
+                    const value_type value = values_output[i];
+                    ASSERT_GE(value, begin);
+                    ASSERT_LT(value, end);
+                    ASSERT_NO_FATAL_FAILURE(
+                        test_utils::assert_eq(keys_output[i], keys_input[value]));
+                }
+                std::vector<value_type> segment_values(values_output.begin() + begin,
+                                                       values_output.begin() + end);
+                std::sort(segment_values.begin(), segment_values.end());
+                ASSERT_TRUE(std::adjacent_find(segment_values.begin(), segment_values.end())
+                            == segment_values.end());
+
+                if(nth < end - begin)
+                {
+                    ASSERT_NO_FATAL_FAILURE(compare_cpp_14(
+                        std::vector<key_type>(keys_input.begin() + begin, keys_input.begin() + end),
+                        std::vector<key_type>(keys_output.begin() + begin,
+                                              keys_output.begin() + end),
+                        nth,
+                        std::less<key_type>()));
+                }
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
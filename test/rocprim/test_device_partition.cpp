@@ -68,11 +68,24 @@ using config = rocprim::select_config<512,
                                       ::rocprim::block_load_method::block_load_transpose,
                                       ::rocprim::block_scan_algorithm::using_warp_scan>;
 
+// Counts the selected items of the tiles before scattering them, with partitions of a few tiles.
+using two_pass_config = rocprim::select_config<64,
+                                               2,
+                                               ::rocprim::block_load_method::block_load_transpose,
+                                               ::rocprim::block_load_method::block_load_transpose,
+                                               ::rocprim::block_load_method::block_load_transpose,
+                                               ::rocprim::block_scan_algorithm::using_warp_scan,
+                                               ROCPRIM_GRID_SIZE_LIMIT,
+                                               rocprim::lookback_backoff_config<>,
+                                               true>;
+
 typedef ::testing::Types<
     DevicePartitionParams<int, int, unsigned char, rocprim::default_config, true>,
     DevicePartitionParams<unsigned int, unsigned long>,
     DevicePartitionParams<unsigned char, float>,
     DevicePartitionParams<float, float, unsigned int, config>,
+    DevicePartitionParams<int, int, unsigned int, two_pass_config>,
+    DevicePartitionParams<double, double, unsigned char, two_pass_config, true>,
     DevicePartitionParams<double, double>,
     DevicePartitionParams<int8_t, int8_t>,
     DevicePartitionParams<uint8_t, uint8_t>,
@@ -498,6 +511,297 @@ TYPED_TEST(RocprimDevicePartitionTests, Predicate)
     }
 }
 
+TYPED_TEST(RocprimDevicePartitionTests, PredicateWithIndex)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = typename TestFixture::input_type;
+    using U                      = typename TestFixture::output_type;
+    using config                 = typename TestFixture::config;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default stream
+    if(TestFixture::use_graphs)
+    {
+        // Default stream does not support hipGraph stream capture, so create one
+        HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    }
+
+    auto select_op = select_op_t<T>{};
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+
+            T*            d_input;
+            U*            d_output;
+            unsigned int* d_indices;
+            unsigned int* d_selected_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, input.size() * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices,
+                                                         input.size() * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count_output,
+                                                         sizeof(unsigned int)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+
+            // The selected items are in order, followed by the rejected items in reverse order
+            std::vector<U>            expected_selected;
+            std::vector<U>            expected_rejected;
+            std::vector<unsigned int> expected_indices;
+            std::vector<unsigned int> expected_rejected_indices;
+            for(size_t i = 0; i < input.size(); i++)
+            {
+                if(select_op(input[i]))
+                {
+                    expected_selected.push_back(input[i]);
+                    expected_indices.push_back(static_cast<unsigned int>(i));
+                }
+                else
+                {
+                    expected_rejected.push_back(input[i]);
+                    expected_rejected_indices.push_back(static_cast<unsigned int>(i));
+                }
+            }
+            std::vector<U> expected(expected_selected);
+            expected.insert(expected.end(), expected_rejected.rbegin(), expected_rejected.rend());
+            expected_indices.insert(expected_indices.end(),
+                                    expected_rejected_indices.rbegin(),
+                                    expected_rejected_indices.rend());
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::partition_with_index<config>(nullptr,
+                                                            temp_storage_size_bytes,
+                                                            d_input,
+                                                            d_output,
+                                                            d_indices,
+                                                            d_selected_count_output,
+                                                            input.size(),
+                                                            select_op,
+                                                            stream,
+                                                            debug_synchronous));
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            void* d_temp_storage = nullptr;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            test_utils::GraphHelper gHelper;
+            if(TestFixture::use_graphs)
+            {
+                gHelper.startStreamCapture(stream);
+            }
+
+            HIP_CHECK(rocprim::partition_with_index<config>(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            d_input,
+                                                            d_output,
+                                                            d_indices,
+                                                            d_selected_count_output,
+                                                            input.size(),
+                                                            select_op,
+                                                            stream,
+                                                            debug_synchronous));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.createAndLaunchGraph(stream, true, false);
+            }
+
+            HIP_CHECK(hipDeviceSynchronize());
+
+            unsigned int selected_count_output = 0;
+            HIP_CHECK(hipMemcpy(&selected_count_output,
+                                d_selected_count_output,
+                                sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(selected_count_output, expected_selected.size());
+
+            std::vector<U>            output(input.size());
+            std::vector<unsigned int> indices(input.size());
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(U),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(indices.data(),
+                                d_indices,
+                                indices.size() * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(indices, expected_indices));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_indices));
+            HIP_CHECK(hipFree(d_selected_count_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.cleanupGraphHelper();
+            }
+        }
+    }
+
+    if(TestFixture::use_graphs)
+    {
+        HIP_CHECK(hipStreamDestroy(stream));
+    }
+}
+
+TYPED_TEST(RocprimDevicePartitionTests, PredicateUnordered)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = typename TestFixture::input_type;
+    using U                      = typename TestFixture::output_type;
+    using config                 = typename TestFixture::config;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default stream
+    if(TestFixture::use_graphs)
+    {
+        // Default stream does not support hipGraph stream capture, so create one
+        HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    }
+
+    auto select_op = select_op_t<T>{};
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+
+            T*            d_input;
+            U*            d_output;
+            unsigned int* d_selected_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, input.size() * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count_output,
+                                                         sizeof(unsigned int)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+
+            std::vector<U> expected_selected;
+            std::vector<U> expected_rejected;
+            for(size_t i = 0; i < input.size(); i++)
+            {
+                if(select_op(input[i]))
+                {
+                    expected_selected.push_back(input[i]);
+                }
+                else
+                {
+                    expected_rejected.push_back(input[i]);
+                }
+            }
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::partition_unordered<config>(nullptr,
+                                                           temp_storage_size_bytes,
+                                                           d_input,
+                                                           d_output,
+                                                           d_selected_count_output,
+                                                           input.size(),
+                                                           select_op,
+                                                           stream,
+                                                           debug_synchronous));
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            void* d_temp_storage = nullptr;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            test_utils::GraphHelper gHelper;
+            if(TestFixture::use_graphs)
+            {
+                gHelper.startStreamCapture(stream);
+            }
+
+            HIP_CHECK(rocprim::partition_unordered<config>(d_temp_storage,
+                                                           temp_storage_size_bytes,
+                                                           d_input,
+                                                           d_output,
+                                                           d_selected_count_output,
+                                                           input.size(),
+                                                           select_op,
+                                                           stream,
+                                                           debug_synchronous));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.createAndLaunchGraph(stream, true, false);
+            }
+
+            HIP_CHECK(hipDeviceSynchronize());
+
+            unsigned int selected_count_output = 0;
+            HIP_CHECK(hipMemcpy(&selected_count_output,
+                                d_selected_count_output,
+                                sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(selected_count_output, expected_selected.size());
+
+            std::vector<U> output(input.size());
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(U),
+                                hipMemcpyDeviceToHost));
+
+            // The order of the items within each part is unspecified
+            std::vector<U> output_selected(output.begin(), output.begin() + selected_count_output);
+            std::vector<U> output_rejected(output.begin() + selected_count_output, output.end());
+            std::sort(output_selected.begin(), output_selected.end(), rocprim::less<U>());
+            std::sort(output_rejected.begin(), output_rejected.end(), rocprim::less<U>());
+            std::sort(expected_selected.begin(), expected_selected.end(), rocprim::less<U>());
+            std::sort(expected_rejected.begin(), expected_rejected.end(), rocprim::less<U>());
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output_selected, expected_selected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output_rejected, expected_rejected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_selected_count_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.cleanupGraphHelper();
+            }
+        }
+    }
+
+    if(TestFixture::use_graphs)
+    {
+        HIP_CHECK(hipStreamDestroy(stream));
+    }
+}
+
 TYPED_TEST(RocprimDevicePartitionTests, PredicateTwoWay)
 {
     int device_id = test_common_utils::obtain_device_from_ctest();
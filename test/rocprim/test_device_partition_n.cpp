@@ -0,0 +1,480 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_partition_n.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <cstddef>
+
+template<class InputType,
+         unsigned int Buckets,
+         class Config   = rocprim::default_config,
+         bool UseGraphs = false>
+struct DevicePartitionNParams
+{
+    using input_type                         = InputType;
+    using config                             = Config;
+    static constexpr unsigned int buckets    = Buckets;
+    static constexpr bool         use_graphs = UseGraphs;
+};
+
+template<class Params>
+class RocprimDevicePartitionNTests : public ::testing::Test
+{
+public:
+    using input_type                                = typename Params::input_type;
+    using config                                    = typename Params::config;
+    static constexpr unsigned int buckets           = Params::buckets;
+    static constexpr bool         use_graphs        = Params::use_graphs;
+    const bool                    debug_synchronous = false;
+};
+
+using RocprimDevicePartitionNTestsParams
+    = ::testing::Types<DevicePartitionNParams<int, 1>,
+                       DevicePartitionNParams<int, 2>,
+                       DevicePartitionNParams<unsigned short, 3>,
+                       DevicePartitionNParams<long long, 17>,
+                       DevicePartitionNParams<double, 64>,
+                       DevicePartitionNParams<unsigned int, 256>,
+                       DevicePartitionNParams<int, 5, rocprim::partition_n_config<128, 3>>,
+                       DevicePartitionNParams<int, 256, rocprim::partition_n_config<64, 8>>,
+                       DevicePartitionNParams<int, 3, rocprim::default_config, true>>;
+
+TYPED_TEST_SUITE(RocprimDevicePartitionNTests, RocprimDevicePartitionNTestsParams);
+
+template<unsigned int Buckets>
+struct modulo_bucket_op
+{
+    template<class T>
+    ROCPRIM_HOST_DEVICE
+    unsigned int operator()(const T& value) const
+    {
+        return static_cast<unsigned int>(value) % Buckets;
+    }
+};
+
+TYPED_TEST(RocprimDevicePartitionNTests, PartitionN)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using input_type                         = typename TestFixture::input_type;
+    using config                             = typename TestFixture::config;
+    constexpr unsigned int buckets           = TestFixture::buckets;
+    const bool             debug_synchronous = TestFixture::debug_synchronous;
+
+    const modulo_bucket_op<buckets> bucket_op;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            hipStream_t stream = 0; // default
+            if(TestFixture::use_graphs)
+            {
+                // Default stream does not support hipGraph stream capture, so create one
+                HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+            }
+
+            std::vector<input_type> input
+                = test_utils::get_random_data<input_type>(size, 0, 1000, seed_value);
+
+            // The expected output is stable, so the items of every bucket are in input order
+            std::vector<size_t>     expected_counts(buckets, 0);
+            std::vector<input_type> expected;
+            expected.reserve(size);
+            for(unsigned int bucket = 0; bucket < buckets; ++bucket)
+            {
+                for(const input_type& value : input)
+                {
+                    if(bucket_op(value) == bucket)
+                    {
+                        expected.push_back(value);
+                        ++expected_counts[bucket];
+                    }
+                }
+            }
+
+            input_type* d_input;
+            input_type* d_output;
+            size_t*     d_bucket_counts;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(*d_input)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(*d_output)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_bucket_counts,
+                                                         buckets * sizeof(*d_bucket_counts)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(*d_input),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::partition_n<buckets, config>(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            d_input,
+                                                            d_output,
+                                                            d_bucket_counts,
+                                                            input.size(),
+                                                            bucket_op,
+                                                            stream,
+                                                            debug_synchronous));
+
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            test_utils::GraphHelper gHelper;
+            if(TestFixture::use_graphs)
+            {
+                gHelper.startStreamCapture(stream);
+            }
+
+            HIP_CHECK(rocprim::partition_n<buckets, config>(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            d_input,
+                                                            d_output,
+                                                            d_bucket_counts,
+                                                            input.size(),
+                                                            bucket_op,
+                                                            stream,
+                                                            debug_synchronous));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.createAndLaunchGraph(stream);
+            }
+
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<input_type> output(size);
+            std::vector<size_t>     bucket_counts(buckets);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(*d_output),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(bucket_counts.data(),
+                                d_bucket_counts,
+                                bucket_counts.size() * sizeof(*d_bucket_counts),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(bucket_counts, expected_counts));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_bucket_counts));
+            HIP_CHECK(hipFree(d_temp_storage));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.cleanupGraphHelper();
+                HIP_CHECK(hipStreamDestroy(stream));
+            }
+        }
+    }
+}
+
+TYPED_TEST(RocprimDevicePartitionNTests, SegmentedPartitionN)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using input_type                         = typename TestFixture::input_type;
+    using config                             = typename TestFixture::config;
+    constexpr unsigned int buckets           = TestFixture::buckets;
+    const bool             debug_synchronous = TestFixture::debug_synchronous;
+
+    const modulo_bucket_op<buckets> bucket_op;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            hipStream_t stream = 0; // default
+            if(TestFixture::use_graphs)
+            {
+                // Default stream does not support hipGraph stream capture, so create one
+                HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+            }
+
+            std::vector<input_type> input
+                = test_utils::get_random_data<input_type>(size, 0, 1000, seed_value);
+
+            // The segments have random lengths, some of them are empty
+            std::default_random_engine            gen(seed_value);
+            std::uniform_int_distribution<size_t> segment_length_dis(0, size / 4 + 1);
+            std::vector<size_t>                   segment_offsets{0};
+            while(segment_offsets.back() < size)
+            {
+                segment_offsets.push_back(
+                    std::min(size, segment_offsets.back() + segment_length_dis(gen)));
+            }
+            const size_t segments = segment_offsets.size() - 1;
+            SCOPED_TRACE(testing::Message() << "with segments = " << segments);
+
+            // The items of every bucket are in input order, so they are ordered by segment
+            std::vector<size_t>     expected_segment_counts(buckets * segments, 0);
+            std::vector<size_t>     expected_counts(buckets, 0);
+            std::vector<size_t>     expected_offsets(buckets, 0);
+            std::vector<input_type> expected;
+            expected.reserve(size);
+            for(unsigned int bucket = 0; bucket < buckets; ++bucket)
+            {
+                expected_offsets[bucket] = expected.size();
+                for(size_t segment = 0; segment < segments; ++segment)
+                {
+                    for(size_t i = segment_offsets[segment]; i < segment_offsets[segment + 1]; ++i)
+                    {
+                        if(bucket_op(input[i]) == bucket)
+                        {
+                            expected.push_back(input[i]);
+                            ++expected_segment_counts[bucket * segments + segment];
+                            ++expected_counts[bucket];
+                        }
+                    }
+                }
+            }
+
+            input_type* d_input;
+            input_type* d_output;
+            size_t*     d_segment_offsets;
+            size_t*     d_segment_bucket_counts;
+            size_t*     d_bucket_counts;
+            size_t*     d_bucket_offsets;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(*d_input)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(*d_output)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_segment_offsets,
+                                                         segment_offsets.size()
+                                                             * sizeof(*d_segment_offsets)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_segment_bucket_counts,
+                                                         std::max<size_t>(buckets * segments, 1)
+                                                             * sizeof(*d_segment_bucket_counts)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_bucket_counts,
+                                                         buckets * sizeof(*d_bucket_counts)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_bucket_offsets,
+                                                         buckets * sizeof(*d_bucket_offsets)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(*d_input),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_segment_offsets,
+                                segment_offsets.data(),
+                                segment_offsets.size() * sizeof(*d_segment_offsets),
+                                hipMemcpyHostToDevice));
+
+            // Every bucket also gets its own output, like the buffers of the peers of a shuffle
+            input_type* d_bucket_outputs[buckets];
+            for(unsigned int bucket = 0; bucket < buckets; ++bucket)
+            {
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_bucket_outputs[bucket],
+                                                             std::max<size_t>(
+                                                                 expected_counts[bucket], 1)
+                                                                 * sizeof(input_type)));
+            }
+
+            size_t temp_storage_size_bytes;
+            size_t bucket_outputs_temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::segmented_partition_n<buckets, config>(d_temp_storage,
+                                                                      temp_storage_size_bytes,
+                                                                      d_input,
+                                                                      d_output,
+                                                                      d_segment_offsets,
+                                                                      d_segment_bucket_counts,
+                                                                      d_bucket_counts,
+                                                                      d_bucket_offsets,
+                                                                      input.size(),
+                                                                      segments,
+                                                                      bucket_op,
+                                                                      stream,
+                                                                      debug_synchronous));
+            HIP_CHECK(rocprim::segmented_partition_n_to_buckets<buckets, config>(
+                d_temp_storage,
+                bucket_outputs_temp_storage_size_bytes,
+                d_input,
+                d_bucket_outputs,
+                d_segment_offsets,
+                d_segment_bucket_counts,
+                d_bucket_counts,
+                input.size(),
+                segments,
+                bucket_op,
+                stream,
+                debug_synchronous));
+
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            ASSERT_EQ(temp_storage_size_bytes, bucket_outputs_temp_storage_size_bytes);
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            test_utils::GraphHelper gHelper;
+            if(TestFixture::use_graphs)
+            {
+                gHelper.startStreamCapture(stream);
+            }
+
+            HIP_CHECK(rocprim::segmented_partition_n<buckets, config>(d_temp_storage,
+                                                                      temp_storage_size_bytes,
+                                                                      d_input,
+                                                                      d_output,
+                                                                      d_segment_offsets,
+                                                                      d_segment_bucket_counts,
+                                                                      d_bucket_counts,
+                                                                      d_bucket_offsets,
+                                                                      input.size(),
+                                                                      segments,
+                                                                      bucket_op,
+                                                                      stream,
+                                                                      debug_synchronous));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.createAndLaunchGraph(stream);
+            }
+
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<input_type> output(size);
+            std::vector<size_t>     segment_bucket_counts(buckets * segments);
+            std::vector<size_t>     bucket_counts(buckets);
+            std::vector<size_t>     bucket_offsets(buckets);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(*d_output),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(segment_bucket_counts.data(),
+                                d_segment_bucket_counts,
+                                segment_bucket_counts.size() * sizeof(*d_segment_bucket_counts),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(bucket_counts.data(),
+                                d_bucket_counts,
+                                bucket_counts.size() * sizeof(*d_bucket_counts),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(bucket_offsets.data(),
+                                d_bucket_offsets,
+                                bucket_offsets.size() * sizeof(*d_bucket_offsets),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(segment_bucket_counts, expected_segment_counts));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(bucket_counts, expected_counts));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(bucket_offsets, expected_offsets));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            // The separate outputs of the buckets get the same items without the offsets
+            HIP_CHECK(hipMemset(d_segment_bucket_counts,
+                                0,
+                                std::max<size_t>(buckets * segments, 1)
+                                    * sizeof(*d_segment_bucket_counts)));
+            HIP_CHECK(rocprim::segmented_partition_n_to_buckets<buckets, config>(
+                d_temp_storage,
+                temp_storage_size_bytes,
+                d_input,
+                d_bucket_outputs,
+                d_segment_offsets,
+                d_segment_bucket_counts,
+                d_bucket_counts,
+                input.size(),
+                segments,
+                bucket_op,
+                stream,
+                debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            HIP_CHECK(hipMemcpy(segment_bucket_counts.data(),
+                                d_segment_bucket_counts,
+                                segment_bucket_counts.size() * sizeof(*d_segment_bucket_counts),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(segment_bucket_counts, expected_segment_counts));
+
+            for(unsigned int bucket = 0; bucket < buckets; ++bucket)
+            {
+                SCOPED_TRACE(testing::Message() << "with bucket = " << bucket);
+
+                std::vector<input_type> bucket_output(expected_counts[bucket]);
+                HIP_CHECK(hipMemcpy(bucket_output.data(),
+                                    d_bucket_outputs[bucket],
+                                    bucket_output.size() * sizeof(input_type),
+                                    hipMemcpyDeviceToHost));
+                const std::vector<input_type> expected_bucket(
+                    expected.begin() + expected_offsets[bucket],
+                    expected.begin() + expected_offsets[bucket] + expected_counts[bucket]);
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(bucket_output, expected_bucket));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_segment_offsets));
+            HIP_CHECK(hipFree(d_segment_bucket_counts));
+            HIP_CHECK(hipFree(d_bucket_counts));
+            HIP_CHECK(hipFree(d_bucket_offsets));
+            HIP_CHECK(hipFree(d_temp_storage));
+            for(unsigned int bucket = 0; bucket < buckets; ++bucket)
+            {
+                HIP_CHECK(hipFree(d_bucket_outputs[bucket]));
+            }
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.cleanupGraphHelper();
+                HIP_CHECK(hipStreamDestroy(stream));
+            }
+        }
+    }
+}
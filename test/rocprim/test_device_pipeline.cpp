@@ -0,0 +1,192 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_pipeline.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+struct pipeline_test_affine
+{
+    ROCPRIM_HOST_DEVICE long long operator()(int x) const
+    {
+        return 3 * static_cast<long long>(x) + 1;
+    }
+};
+
+struct pipeline_test_is_even
+{
+    ROCPRIM_HOST_DEVICE bool operator()(long long x) const
+    {
+        return x % 2 == 0;
+    }
+};
+
+struct pipeline_test_half
+{
+    ROCPRIM_HOST_DEVICE long long operator()(long long x) const
+    {
+        return x / 2;
+    }
+};
+
+struct pipeline_test_less_than
+{
+    long long limit;
+
+    ROCPRIM_HOST_DEVICE bool operator()(long long x) const
+    {
+        return x < limit;
+    }
+};
+
+TEST(RocprimDevicePipelineTests, MapFilterReduceAndCopy)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+    const long long   initial_value     = 5;
+    const long long   limit             = 1000;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<int> input
+                = test_utils::get_random_data<int>(size, -1000, 1000, seed_value);
+
+            std::vector<long long> copy_expected;
+            long long              reduce_expected = initial_value;
+            for(size_t i = 0; i < size; i++)
+            {
+                const long long mapped = pipeline_test_affine{}(input[i]);
+                if(!pipeline_test_is_even{}(mapped))
+                {
+                    continue;
+                }
+                const long long halved = pipeline_test_half{}(mapped);
+                if(!pipeline_test_less_than{limit}(halved))
+                {
+                    continue;
+                }
+                copy_expected.push_back(halved);
+                reduce_expected += halved;
+            }
+
+            int*       d_input;
+            long long* d_output;
+            size_t*    d_selected_count;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(long long)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count, sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+
+            const auto expression = rocprim::pipeline(d_input, size)
+                                        .map(pipeline_test_affine{})
+                                        .filter(pipeline_test_is_even{})
+                                        .map(pipeline_test_half{})
+                                        .filter(pipeline_test_less_than{limit});
+
+            size_t reduce_bytes;
+            size_t copy_bytes;
+            HIP_CHECK(expression.reduce(nullptr,
+                                        reduce_bytes,
+                                        d_output,
+                                        initial_value,
+                                        rocprim::plus<long long>(),
+                                        stream,
+                                        debug_synchronous));
+            HIP_CHECK(expression.copy(nullptr,
+                                      copy_bytes,
+                                      d_output,
+                                      d_selected_count,
+                                      stream,
+                                      debug_synchronous));
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage,
+                                                         std::max(reduce_bytes, copy_bytes)));
+
+            HIP_CHECK(expression.reduce(d_temp_storage,
+                                        reduce_bytes,
+                                        d_output,
+                                        initial_value,
+                                        rocprim::plus<long long>(),
+                                        stream,
+                                        debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            long long reduce_output;
+            HIP_CHECK(
+                hipMemcpy(&reduce_output, d_output, sizeof(long long), hipMemcpyDeviceToHost));
+            ASSERT_EQ(reduce_output, reduce_expected);
+
+            HIP_CHECK(expression.copy(d_temp_storage,
+                                      copy_bytes,
+                                      d_output,
+                                      d_selected_count,
+                                      stream,
+                                      debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            size_t selected_count;
+            HIP_CHECK(hipMemcpy(&selected_count,
+                                d_selected_count,
+                                sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(selected_count, copy_expected.size());
+
+            std::vector<long long> copy_output(selected_count);
+            HIP_CHECK(hipMemcpy(copy_output.data(),
+                                d_output,
+                                selected_count * sizeof(long long),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(copy_output, copy_expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_selected_count));
+        }
+    }
+}
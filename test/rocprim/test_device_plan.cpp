@@ -0,0 +1,246 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_plan.hpp>
+#include <rocprim/device/device_radix_sort.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <cstddef>
+
+// A radix sort plan prepared once for the largest size and executed for every size
+TEST(RocprimDevicePlanTests, RadixSortPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = unsigned int;
+    using value_type = int;
+
+    const hipStream_t stream = 0; // default
+
+    auto plan = rocprim::make_device_plan(
+        [](void*             temporary_storage,
+           size_t&           storage_size,
+           const hipStream_t plan_stream,
+           key_type*         keys_input,
+           key_type*         keys_output,
+           value_type*       values_input,
+           value_type*       values_output,
+           const size_t      size)
+        {
+            return rocprim::radix_sort_pairs(temporary_storage,
+                                             storage_size,
+                                             keys_input,
+                                             keys_output,
+                                             values_input,
+                                             values_output,
+                                             size,
+                                             0,
+                                             8 * sizeof(key_type),
+                                             plan_stream);
+        });
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const std::vector<size_t> sizes    = test_utils::get_sizes(seed_value);
+        const size_t              max_size = *std::max_element(sizes.begin(), sizes.end());
+
+        key_type*   d_keys_input;
+        key_type*   d_keys_output;
+        value_type* d_values_input;
+        value_type* d_values_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                     std::max<size_t>(max_size, 1)
+                                                         * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                     std::max<size_t>(max_size, 1)
+                                                         * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                     std::max<size_t>(max_size, 1)
+                                                         * sizeof(value_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                     std::max<size_t>(max_size, 1)
+                                                         * sizeof(value_type)));
+
+        HIP_CHECK(plan.prepare(stream,
+                               d_keys_input,
+                               d_keys_output,
+                               d_values_input,
+                               d_values_output,
+                               max_size));
+        ASSERT_NE(plan.storage(), nullptr);
+
+        for(size_t size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<key_type> keys
+                = test_utils::get_random_data<key_type>(size, 0, 1000, seed_value);
+            std::vector<value_type> values(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                values[i] = static_cast<value_type>(i);
+            }
+
+            std::vector<size_t> order(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                order[i] = i;
+            }
+            std::stable_sort(order.begin(),
+                             order.end(),
+                             [&](const size_t a, const size_t b) { return keys[a] < keys[b]; });
+
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            HIP_CHECK(plan.execute(stream,
+                                   d_keys_input,
+                                   d_keys_output,
+                                   d_values_input,
+                                   d_values_output,
+                                   size));
+
+            std::vector<key_type>   keys_output(size);
+            std::vector<value_type> values_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            std::vector<key_type>   expected_keys(size);
+            std::vector<value_type> expected_values(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                expected_keys[i]   = keys[order[i]];
+                expected_values[i] = values[order[i]];
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, expected_values));
+        }
+
+        HIP_CHECK(plan.reset());
+        ASSERT_EQ(plan.storage(), nullptr);
+
+        HIP_CHECK(hipFree(d_keys_input));
+        HIP_CHECK(hipFree(d_keys_output));
+        HIP_CHECK(hipFree(d_values_input));
+        HIP_CHECK(hipFree(d_values_output));
+    }
+}
+
+// Borrowed storage that is too small is rejected, and a plan without storage does not execute
+TEST(RocprimDevicePlanTests, BorrowedStorage)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = unsigned int;
+
+    const hipStream_t stream = 0; // default
+    const size_t      size   = 1 << 20;
+
+    auto plan = rocprim::make_device_plan(
+        [](void*             temporary_storage,
+           size_t&           storage_size,
+           const hipStream_t plan_stream,
+           key_type*         keys_input,
+           key_type*         keys_output,
+           const size_t      key_count)
+        {
+            return rocprim::radix_sort_keys(temporary_storage,
+                                            storage_size,
+                                            keys_input,
+                                            keys_output,
+                                            key_count,
+                                            0,
+                                            8 * sizeof(key_type),
+                                            plan_stream);
+        });
+
+    key_type* d_keys_input;
+    key_type* d_keys_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+
+    ASSERT_EQ(plan.execute(stream, d_keys_input, d_keys_output, size), hipErrorInvalidValue);
+
+    size_t storage_size;
+    HIP_CHECK(rocprim::radix_sort_keys(nullptr,
+                                       storage_size,
+                                       d_keys_input,
+                                       d_keys_output,
+                                       size,
+                                       0,
+                                       8 * sizeof(key_type),
+                                       stream));
+    void* d_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_size));
+
+    ASSERT_EQ(plan.prepare_with_storage(d_storage,
+                                        storage_size - 1,
+                                        stream,
+                                        d_keys_input,
+                                        d_keys_output,
+                                        size),
+              hipErrorInvalidValue);
+    HIP_CHECK(plan.prepare_with_storage(d_storage,
+                                        storage_size,
+                                        stream,
+                                        d_keys_input,
+                                        d_keys_output,
+                                        size));
+    ASSERT_EQ(plan.storage(), d_storage);
+    HIP_CHECK(plan.execute(stream, d_keys_input, d_keys_output, size));
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    // Borrowed storage is not freed by the plan
+    HIP_CHECK(plan.reset());
+    HIP_CHECK(hipFree(d_storage));
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_keys_output));
+}
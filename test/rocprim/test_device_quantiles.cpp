@@ -0,0 +1,295 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_quantiles.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <cstddef>
+
+template<class Key>
+class RocprimDeviceQuantilesTests : public ::testing::Test
+{
+public:
+    using key_type               = Key;
+    const bool debug_synchronous = false;
+};
+
+using RocprimDeviceQuantilesTestsParams
+    = ::testing::Types<int, unsigned char, short, float, double, unsigned long long>;
+
+TYPED_TEST_SUITE(RocprimDeviceQuantilesTests, RocprimDeviceQuantilesTestsParams);
+
+TYPED_TEST(RocprimDeviceQuantilesTests, RadixSelect)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type               = typename TestFixture::key_type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+            {
+                continue;
+            }
+            // Few ranks are counted in shared memory, many ranks in global memory
+            for(size_t num_ranks : {size_t(1), size_t(5), size_t(100)})
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+                SCOPED_TRACE(testing::Message() << "with num_ranks = " << num_ranks);
+
+                const std::vector<key_type> input
+                    = test_utils::get_random_data<key_type>(size, 0, 100, seed_value);
+                std::vector<size_t> ranks
+                    = test_utils::get_random_data<size_t>(num_ranks, 0, size - 1, seed_value + 1);
+                ranks.front() = 0;
+                ranks.back()  = size - 1;
+                std::sort(ranks.begin(), ranks.end());
+
+                // Calculate expected results on host
+                std::vector<key_type> sorted(input);
+                std::sort(sorted.begin(), sorted.end());
+                std::vector<key_type> expected(num_ranks);
+                for(size_t i = 0; i < num_ranks; ++i)
+                {
+                    expected[i] = sorted[ranks[i]];
+                }
+
+                key_type* d_input;
+                size_t*   d_ranks;
+                key_type* d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(*d_input)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_ranks, num_ranks * sizeof(*d_ranks)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_output, num_ranks * sizeof(*d_output)));
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    size * sizeof(*d_input),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_ranks,
+                                    ranks.data(),
+                                    num_ranks * sizeof(*d_ranks),
+                                    hipMemcpyHostToDevice));
+
+                size_t temp_storage_size_bytes;
+                void*  d_temp_storage = nullptr;
+                HIP_CHECK(rocprim::radix_select(d_temp_storage,
+                                                temp_storage_size_bytes,
+                                                d_input,
+                                                size,
+                                                d_ranks,
+                                                num_ranks,
+                                                d_output,
+                                                stream,
+                                                debug_synchronous));
+
+                ASSERT_GT(temp_storage_size_bytes, 0);
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                HIP_CHECK(rocprim::radix_select(d_temp_storage,
+                                                temp_storage_size_bytes,
+                                                d_input,
+                                                size,
+                                                d_ranks,
+                                                num_ranks,
+                                                d_output,
+                                                stream,
+                                                debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<key_type> output(num_ranks);
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    num_ranks * sizeof(*d_output),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_ranks));
+                HIP_CHECK(hipFree(d_output));
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceQuantilesTests, ApproximateQuantiles)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type               = typename TestFixture::key_type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    const hipStream_t         stream    = 0; // default
+    const std::vector<double> quantiles = {0.0, 0.01, 0.25, 0.5, 0.9, 0.99, 0.999, 1.0};
+    const unsigned int        num_quantiles = static_cast<unsigned int>(quantiles.size());
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+            {
+                continue;
+            }
+            // A compaction of 1 keeps all keys, so the quantiles are exact.
+            for(unsigned int compaction : {1u, 16u, 256u})
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+                SCOPED_TRACE(testing::Message() << "with compaction = " << compaction);
+
+                const std::vector<key_type> input
+                    = test_utils::get_random_data<key_type>(size, 0, 100, seed_value);
+                std::vector<key_type> sorted(input);
+                std::sort(sorted.begin(), sorted.end());
+
+                key_type* d_input;
+                double*   d_quantiles;
+                key_type* d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(*d_input)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_quantiles,
+                                                             num_quantiles * sizeof(double)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                             num_quantiles * sizeof(*d_output)));
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    size * sizeof(*d_input),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_quantiles,
+                                    quantiles.data(),
+                                    num_quantiles * sizeof(double),
+                                    hipMemcpyHostToDevice));
+
+                size_t temp_storage_size_bytes;
+                void*  d_temp_storage = nullptr;
+                HIP_CHECK(rocprim::approximate_quantiles(d_temp_storage,
+                                                         temp_storage_size_bytes,
+                                                         d_input,
+                                                         size,
+                                                         d_quantiles,
+                                                         num_quantiles,
+                                                         d_output,
+                                                         compaction,
+                                                         stream,
+                                                         debug_synchronous));
+
+                ASSERT_GT(temp_storage_size_bytes, 0);
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                HIP_CHECK(rocprim::approximate_quantiles(d_temp_storage,
+                                                         temp_storage_size_bytes,
+                                                         d_input,
+                                                         size,
+                                                         d_quantiles,
+                                                         num_quantiles,
+                                                         d_output,
+                                                         compaction,
+                                                         stream,
+                                                         debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<key_type> output(num_quantiles);
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    num_quantiles * sizeof(*d_output),
+                                    hipMemcpyDeviceToHost));
+
+                // Every block is off by less than `compaction` ranks, and the errors of the
+                // blocks mostly cancel out.
+                const double blocks    = std::ceil(static_cast<double>(size) / 2048.0);
+                const double tolerance = compaction == 1 ? 0.0 : compaction * std::sqrt(blocks);
+                for(unsigned int i = 0; i < num_quantiles; ++i)
+                {
+                    SCOPED_TRACE(testing::Message() << "with quantile = " << quantiles[i]);
+
+                    const double rank
+                        = std::floor(quantiles[i] * static_cast<double>(size - 1) + 0.5);
+                    const auto   range = std::equal_range(sorted.begin(), sorted.end(), output[i]);
+                    ASSERT_NE(range.first, range.second);
+                    const double first = static_cast<double>(range.first - sorted.begin());
+                    const double last  = static_cast<double>(range.second - sorted.begin()) - 1;
+                    ASSERT_LE(first - tolerance, rank);
+                    ASSERT_GE(last + tolerance, rank);
+                }
+
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_quantiles));
+                HIP_CHECK(hipFree(d_output));
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceQuantilesTests, ApproximateQuantilesInvalidCompaction)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    int*    d_input     = nullptr;
+    double* d_quantiles = nullptr;
+    int*    d_output    = nullptr;
+    size_t  temp_storage_size_bytes;
+    for(unsigned int compaction : {0u, 3u, 4096u})
+    {
+        ASSERT_EQ(rocprim::approximate_quantiles(nullptr,
+                                                 temp_storage_size_bytes,
+                                                 d_input,
+                                                 1000,
+                                                 d_quantiles,
+                                                 1,
+                                                 d_output,
+                                                 compaction),
+                  hipErrorInvalidValue);
+    }
+}
@@ -36,6 +36,7 @@
 #include "test_utils_types.hpp"
 
 #include <iterator>
+#include <limits>
 #include <type_traits>
 
 template<class Key,
@@ -624,14 +625,20 @@ void sort_pairs()
                 values_expected[i] = expected[i].second;
             }
 
-            // Use arbitrary custom config to increase test coverage without making more test cases
-            using config = rocprim::radix_sort_config<
-                rocprim::kernel_config<256, 1>,
-                rocprim::merge_sort_config<128, 64, 2, 128, 64, 2>,
-                rocprim::radix_sort_onesweep_config<rocprim::kernel_config<128, 1>,
-                                                    rocprim::kernel_config<128, 1>,
-                                                    4>,
-                1024 * 512>;
+            // Use arbitrary custom config to increase test coverage without making more test cases,
+            // the onesweep iterations sort 5 or 4 bits
+            using onesweep_config = rocprim::radix_sort_onesweep_config<
+                rocprim::kernel_config<128, 1>,
+                rocprim::kernel_config<128, 1>,
+                5,
+                rocprim::block_radix_rank_algorithm::default_algorithm,
+                rocprim::lookback_backoff_config<>,
+                4>;
+            using config
+                = rocprim::radix_sort_config<rocprim::kernel_config<256, 1>,
+                                             rocprim::merge_sort_config<128, 64, 2, 128, 64, 2>,
+                                             onesweep_config,
+                                             1024 * 512>;
 
             test_utils::GraphHelper gHelper;;
             
@@ -1475,4 +1482,417 @@ inline void sort_keys_large_sizes()
     }
 }
 
+// Keys with constant high bits, such as timestamps, have digit places in which all keys fall
+// into the same bucket. Onesweep skips those places, or copies them instead of scattering them.
+inline void sort_pairs_constant_digits()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type               = uint64_t;
+    using value_type             = unsigned int;
+    const hipStream_t stream     = 0;
+    const bool debug_synchronous = false;
+
+    // Large enough to be sorted by onesweep with several blocks
+    const size_t size = (1 << 22) + 123;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Only the low 20 bits vary, some places in the middle, one place or no bits at all
+        for(key_type varying_mask : {key_type(0xFFFFF),
+                                     key_type(0x00FF0000FF00FF00),
+                                     key_type(0xFF00),
+                                     key_type(0)})
+        {
+            SCOPED_TRACE(testing::Message() << "with varying_mask = " << varying_mask);
+
+            for(bool descending : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with descending = " << descending);
+
+                std::vector<key_type> keys_input
+                    = test_utils::get_random_data<key_type>(size, 0, varying_mask, seed_value);
+                for(key_type& key : keys_input)
+                {
+                    key = (key & varying_mask) | (key_type(0x0123456789A00000) & ~varying_mask);
+                }
+                std::vector<value_type> values_input(size);
+                std::iota(values_input.begin(), values_input.end(), 0u);
+
+                std::vector<size_t> indices(size);
+                std::iota(indices.begin(), indices.end(), 0);
+                std::stable_sort(indices.begin(),
+                                 indices.end(),
+                                 [&](const size_t a, const size_t b)
+                                 {
+                                     return descending ? keys_input[b] < keys_input[a]
+                                                       : keys_input[a] < keys_input[b];
+                                 });
+                std::vector<key_type>   expected_keys(size);
+                std::vector<value_type> expected_values(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected_keys[i]   = keys_input[indices[i]];
+                    expected_values[i] = values_input[indices[i]];
+                }
+
+                key_type*   d_keys_input;
+                key_type*   d_keys_output;
+                value_type* d_values_input;
+                value_type* d_values_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                             size * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                             size * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                             size * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                             size * sizeof(value_type)));
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    keys_input.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    size * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+
+                const auto sort = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+                {
+                    return descending ? rocprim::radix_sort_pairs_desc(d_temporary_storage,
+                                                                       temporary_storage_bytes,
+                                                                       d_keys_input,
+                                                                       d_keys_output,
+                                                                       d_values_input,
+                                                                       d_values_output,
+                                                                       size,
+                                                                       0,
+                                                                       64,
+                                                                       stream,
+                                                                       debug_synchronous)
+                                      : rocprim::radix_sort_pairs(d_temporary_storage,
+                                                                  temporary_storage_bytes,
+                                                                  d_keys_input,
+                                                                  d_keys_output,
+                                                                  d_values_input,
+                                                                  d_values_output,
+                                                                  size,
+                                                                  0,
+                                                                  64,
+                                                                  stream,
+                                                                  debug_synchronous);
+                };
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(sort(nullptr, temporary_storage_bytes));
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+                HIP_CHECK(sort(d_temporary_storage, temporary_storage_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                std::vector<key_type>   keys_output(size);
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, expected_values));
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+                HIP_CHECK(hipFree(d_keys_input));
+                HIP_CHECK(hipFree(d_keys_output));
+                HIP_CHECK(hipFree(d_values_input));
+                HIP_CHECK(hipFree(d_values_output));
+            }
+        }
+    }
+}
+
+// The number of pairs is only known on the device, the sort runs over an upper bound
+inline void sort_pairs_future_size()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type               = unsigned int;
+    using value_type             = unsigned int;
+    const hipStream_t stream     = 0;
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            const size_t max_size = size + size / 2 + 7;
+
+            std::vector<key_type> keys_input = test_utils::get_random_data<key_type>(
+                size,
+                0,
+                std::numeric_limits<key_type>::max(),
+                seed_value);
+            // The largest key must still be ordered before the keys past the size
+            for(size_t i = 0; i < size; i += 97)
+            {
+                keys_input[i] = std::numeric_limits<key_type>::max();
+            }
+            std::vector<value_type> values_input(size);
+            std::iota(values_input.begin(), values_input.end(), 0u);
+
+            std::vector<size_t> indices(size);
+            std::iota(indices.begin(), indices.end(), 0);
+            std::stable_sort(indices.begin(),
+                             indices.end(),
+                             [&](const size_t a, const size_t b)
+                             { return keys_input[a] < keys_input[b]; });
+            std::vector<key_type>   expected_keys(size);
+            std::vector<value_type> expected_values(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected_keys[i]   = keys_input[indices[i]];
+                expected_values[i] = values_input[indices[i]];
+            }
+
+            key_type*     d_keys_input;
+            key_type*     d_keys_output;
+            value_type*   d_values_input;
+            value_type*   d_values_output;
+            unsigned int* d_size;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                         max_size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                         max_size * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_size, sizeof(*d_size)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+            const unsigned int device_size = static_cast<unsigned int>(size);
+            HIP_CHECK(hipMemcpy(d_size, &device_size, sizeof(*d_size), hipMemcpyHostToDevice));
+
+            const auto sort = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+            {
+                return rocprim::radix_sort_pairs(d_temporary_storage,
+                                                 temporary_storage_bytes,
+                                                 d_keys_input,
+                                                 d_keys_output,
+                                                 d_values_input,
+                                                 d_values_output,
+                                                 rocprim::future_value<unsigned int>{d_size},
+                                                 max_size,
+                                                 0,
+                                                 8 * sizeof(key_type),
+                                                 stream,
+                                                 debug_synchronous);
+            };
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(sort(nullptr, temporary_storage_bytes));
+            void* d_temporary_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                         temporary_storage_bytes));
+            HIP_CHECK(sort(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<key_type>   keys_output(size);
+            std::vector<value_type> values_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, expected_values));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_size));
+        }
+    }
+}
+
+// Values larger than radix_sort_indirect_value_bytes are gathered after the keys are sorted with
+// their indices, check stability with many equal keys, with separate, aliased (in-place) and
+// double buffers.
+inline void sort_pairs_large_values()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type               = unsigned int;
+    using value_type             = test_utils::custom_test_array_type<int, 16>;
+    const hipStream_t stream     = 0;
+    const bool debug_synchronous = false;
+
+    static_assert(sizeof(value_type) > rocprim::detail::radix_sort_indirect_value_bytes,
+                  "the values must be sorted through their indices");
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size, 0, 255, seed_value);
+            std::vector<value_type> values_input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                values_input[i] = value_type(static_cast<int>(i));
+            }
+
+            std::vector<size_t> indices(size);
+            std::iota(indices.begin(), indices.end(), 0);
+            std::stable_sort(indices.begin(),
+                             indices.end(),
+                             [&](const size_t a, const size_t b)
+                             { return keys_input[a] < keys_input[b]; });
+            std::vector<key_type>   expected_keys(size);
+            std::vector<value_type> expected_values(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected_keys[i]   = keys_input[indices[i]];
+                expected_values[i] = values_input[indices[i]];
+            }
+
+            // 0: separate input and output, 1: in place, 2: double buffer
+            for(int mode : {0, 1, 2})
+            {
+                SCOPED_TRACE(testing::Message() << "with mode = " << mode);
+
+                key_type*   d_keys_input;
+                key_type*   d_keys_output;
+                value_type* d_values_input;
+                value_type* d_values_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                             std::max<size_t>(size, 1)
+                                                                 * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                             std::max<size_t>(size, 1)
+                                                                 * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                             std::max<size_t>(size, 1)
+                                                                 * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                             std::max<size_t>(size, 1)
+                                                                 * sizeof(value_type)));
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    keys_input.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    size * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+
+                rocprim::double_buffer<key_type>   keys(d_keys_input, d_keys_output);
+                rocprim::double_buffer<value_type> values(d_values_input, d_values_output);
+
+                const auto sort = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+                {
+                    if(mode == 2)
+                    {
+                        return rocprim::radix_sort_pairs(d_temporary_storage,
+                                                         temporary_storage_bytes,
+                                                         keys,
+                                                         values,
+                                                         size,
+                                                         0,
+                                                         8 * sizeof(key_type),
+                                                         stream,
+                                                         debug_synchronous);
+                    }
+                    return rocprim::radix_sort_pairs(d_temporary_storage,
+                                                     temporary_storage_bytes,
+                                                     d_keys_input,
+                                                     mode == 1 ? d_keys_input : d_keys_output,
+                                                     d_values_input,
+                                                     mode == 1 ? d_values_input : d_values_output,
+                                                     size,
+                                                     0,
+                                                     8 * sizeof(key_type),
+                                                     stream,
+                                                     debug_synchronous);
+                };
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(sort(nullptr, temporary_storage_bytes));
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+                HIP_CHECK(sort(d_temporary_storage, temporary_storage_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                const key_type* d_keys_result
+                    = mode == 0 ? d_keys_output : mode == 1 ? d_keys_input : keys.current();
+                const value_type* d_values_result
+                    = mode == 0 ? d_values_output : mode == 1 ? d_values_input : values.current();
+
+                std::vector<key_type>   keys_output(size);
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_result,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_result,
+                                    size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, expected_values));
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+                HIP_CHECK(hipFree(d_keys_input));
+                HIP_CHECK(hipFree(d_keys_output));
+                HIP_CHECK(hipFree(d_values_input));
+                HIP_CHECK(hipFree(d_values_output));
+            }
+        }
+    }
+}
+
 #endif // TEST_DEVICE_RADIX_SORT_HPP_
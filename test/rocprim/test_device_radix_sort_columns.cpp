@@ -0,0 +1,260 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_radix_sort_columns.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_sort_comparator.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+template<class KeyType,
+         bool         Descending = false,
+         unsigned int StartBit   = 0,
+         unsigned int EndBit     = sizeof(KeyType) * 8>
+struct DeviceRadixSortColumnsParams
+{
+    using key_type                          = KeyType;
+    static constexpr bool         descending = Descending;
+    static constexpr unsigned int start_bit  = StartBit;
+    static constexpr unsigned int end_bit    = EndBit;
+};
+
+template<class Params>
+class RocprimDeviceRadixSortColumnsTests : public ::testing::Test
+{
+public:
+    using key_type                           = typename Params::key_type;
+    static constexpr bool         descending = Params::descending;
+    static constexpr unsigned int start_bit  = Params::start_bit;
+    static constexpr unsigned int end_bit    = Params::end_bit;
+    const bool                    debug_synchronous = false;
+};
+
+using RocprimDeviceRadixSortColumnsTestsParams
+    = ::testing::Types<DeviceRadixSortColumnsParams<unsigned int>,
+                       DeviceRadixSortColumnsParams<int, true>,
+                       DeviceRadixSortColumnsParams<unsigned short>,
+                       DeviceRadixSortColumnsParams<float, true>,
+                       DeviceRadixSortColumnsParams<unsigned long long, false, 4, 12>>;
+
+TYPED_TEST_SUITE(RocprimDeviceRadixSortColumnsTests, RocprimDeviceRadixSortColumnsTestsParams);
+
+template<bool Descending, class... Args>
+hipError_t invoke_radix_sort_columns(Args&&... args)
+{
+    return Descending ? rocprim::radix_sort_columns_desc(std::forward<Args>(args)...)
+                      : rocprim::radix_sort_columns(std::forward<Args>(args)...);
+}
+
+TYPED_TEST(RocprimDeviceRadixSortColumnsTests, SortColumns)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                           = typename TestFixture::key_type;
+    constexpr bool         descending        = TestFixture::descending;
+    constexpr unsigned int start_bit         = TestFixture::start_bit;
+    constexpr unsigned int end_bit           = TestFixture::end_bit;
+    const bool             debug_synchronous = TestFixture::debug_synchronous;
+
+    const hipStream_t stream = 0; // default
+
+    // Every vectorised width, widths without a matching type, and a column that is not aligned
+    // to its width
+    const std::vector<size_t> widths     = {1, 2, 4, 8, 16, 3, 12, 4};
+    const std::vector<size_t> misaligned = {0, 0, 0, 0, 0, 0, 0, 1};
+    const unsigned int        num_columns = static_cast<unsigned int>(widths.size());
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Few distinct keys, so the stability of the sort is checked
+            const std::vector<key_type> keys = test_utils::get_random_data<key_type>(
+                size,
+                static_cast<key_type>(0),
+                static_cast<key_type>(1000),
+                seed_value);
+
+            // The columns are stored one after another, each starting at a multiple of 16 bytes
+            std::vector<size_t> offsets(num_columns);
+            size_t              column_bytes = 0;
+            for(unsigned int column = 0; column < num_columns; ++column)
+            {
+                offsets[column] = column_bytes + misaligned[column];
+                column_bytes    = (offsets[column] + widths[column] * size + 15) / 16 * 16;
+            }
+            const std::vector<unsigned char> values
+                = test_utils::get_random_data<unsigned char>(std::max<size_t>(column_bytes, 1),
+                                                             0,
+                                                             255,
+                                                             seed_value + 1);
+
+            // Calculate expected results on host
+            std::vector<size_t> permutation(size);
+            std::iota(permutation.begin(), permutation.end(), 0);
+            const auto comparator
+                = test_utils::key_comparator<key_type, descending, start_bit, end_bit>();
+            std::stable_sort(permutation.begin(),
+                             permutation.end(),
+                             [&](const size_t lhs, const size_t rhs)
+                             { return comparator(keys[lhs], keys[rhs]); });
+
+            std::vector<key_type>      expected_keys(size);
+            std::vector<unsigned char> expected_values(values.size(), 0);
+            for(size_t i = 0; i < size; ++i)
+            {
+                expected_keys[i] = keys[permutation[i]];
+                for(unsigned int column = 0; column < num_columns; ++column)
+                {
+                    const size_t width = widths[column];
+                    std::copy_n(values.begin() + offsets[column] + permutation[i] * width,
+                                width,
+                                expected_values.begin() + offsets[column] + i * width);
+                }
+            }
+
+            key_type*      d_keys_input;
+            key_type*      d_keys_output;
+            unsigned char* d_values_input;
+            unsigned char* d_values_output;
+            const void**   d_values_inputs;
+            void**         d_values_outputs;
+            size_t*        d_widths;
+            const size_t   allocated = std::max<size_t>(size, 1);
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_keys_input, allocated * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_keys_output, allocated * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input, values.size()));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output, values.size()));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_inputs,
+                                                         num_columns * sizeof(const void*)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_outputs, num_columns * sizeof(void*)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_widths, num_columns * sizeof(size_t)));
+
+            std::vector<const void*> values_inputs(num_columns);
+            std::vector<void*>       values_outputs(num_columns);
+            for(unsigned int column = 0; column < num_columns; ++column)
+            {
+                values_inputs[column]  = d_values_input + offsets[column];
+                values_outputs[column] = d_values_output + offsets[column];
+            }
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(
+                hipMemcpy(d_values_input, values.data(), values.size(), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemset(d_values_output, 0, values.size()));
+            HIP_CHECK(hipMemcpy(d_values_inputs,
+                                values_inputs.data(),
+                                num_columns * sizeof(const void*),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_outputs,
+                                values_outputs.data(),
+                                num_columns * sizeof(void*),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_widths,
+                                widths.data(),
+                                num_columns * sizeof(size_t),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(invoke_radix_sort_columns<descending>(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            d_keys_input,
+                                                            d_keys_output,
+                                                            d_values_inputs,
+                                                            d_values_outputs,
+                                                            d_widths,
+                                                            num_columns,
+                                                            size,
+                                                            start_bit,
+                                                            end_bit,
+                                                            stream,
+                                                            debug_synchronous));
+
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(invoke_radix_sort_columns<descending>(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            d_keys_input,
+                                                            d_keys_output,
+                                                            d_values_inputs,
+                                                            d_values_outputs,
+                                                            d_widths,
+                                                            num_columns,
+                                                            size,
+                                                            start_bit,
+                                                            end_bit,
+                                                            stream,
+                                                            debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<key_type>      keys_output(size);
+            std::vector<unsigned char> values_output(values.size());
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                values.size(),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, expected_values));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_values_inputs));
+            HIP_CHECK(hipFree(d_values_outputs));
+            HIP_CHECK(hipFree(d_widths));
+        }
+    }
+}
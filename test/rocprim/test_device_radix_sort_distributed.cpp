@@ -0,0 +1,273 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_radix_sort_distributed.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+template<class KeyType, bool Descending = false>
+struct DeviceRadixSortDistributedParams
+{
+    using key_type                   = KeyType;
+    static constexpr bool descending = Descending;
+};
+
+template<class Params>
+class RocprimDeviceRadixSortDistributedTests : public ::testing::Test
+{
+public:
+    using key_type                          = typename Params::key_type;
+    static constexpr bool descending        = Params::descending;
+    const bool            debug_synchronous = false;
+};
+
+using RocprimDeviceRadixSortDistributedTestsParams
+    = ::testing::Types<DeviceRadixSortDistributedParams<unsigned int>,
+                       DeviceRadixSortDistributedParams<int, true>,
+                       DeviceRadixSortDistributedParams<unsigned short>,
+                       DeviceRadixSortDistributedParams<unsigned long long>,
+                       DeviceRadixSortDistributedParams<long long, true>,
+                       DeviceRadixSortDistributedParams<float>,
+                       DeviceRadixSortDistributedParams<double, true>>;
+
+TYPED_TEST_SUITE(RocprimDeviceRadixSortDistributedTests,
+                 RocprimDeviceRadixSortDistributedTestsParams);
+
+template<bool Descending, class Key, class... Args>
+hipError_t invoke_radix_sort_distributed(rocprim::radix_sort_distributed_shard<Key>* shards,
+                                         Args&&... args)
+{
+    return Descending
+               ? rocprim::radix_sort_keys_desc_distributed(shards, std::forward<Args>(args)...)
+               : rocprim::radix_sort_keys_distributed(shards, std::forward<Args>(args)...);
+}
+
+template<bool Descending, class Key, class Value, class... Args>
+hipError_t invoke_radix_sort_distributed(rocprim::radix_sort_distributed_shard<Key, Value>* shards,
+                                         Args&&... args)
+{
+    return Descending
+               ? rocprim::radix_sort_pairs_desc_distributed(shards, std::forward<Args>(args)...)
+               : rocprim::radix_sort_pairs_distributed(shards, std::forward<Args>(args)...);
+}
+
+// All shards live on the same device, each with its own stream, so the test runs on a single GPU.
+// The peer-to-peer transport then performs ordinary device-to-device copies.
+template<bool WithValues, bool Descending, class Key>
+void test_radix_sort_distributed(const int device_id, const bool debug_synchronous)
+{
+    using value_type =
+        typename std::conditional<WithValues, unsigned int, rocprim::empty_type>::type;
+    using shard_type = rocprim::radix_sort_distributed_shard<Key, value_type>;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(unsigned int num_shards : {1u, 2u, 3u, 4u})
+            {
+                SCOPED_TRACE(testing::Message() << "with num_shards = " << num_shards);
+
+                const std::vector<Key> keys
+                    = test_utils::get_random_data<Key>(size,
+                                                       test_utils::generate_limits<Key>::min(),
+                                                       test_utils::generate_limits<Key>::max(),
+                                                       seed_value);
+                std::vector<unsigned int> values(size);
+                std::iota(values.begin(), values.end(), 0u);
+
+                // Calculate expected results on host
+                std::vector<std::pair<Key, unsigned int>> expected(size);
+                for(size_t i = 0; i < size; ++i)
+                {
+                    expected[i] = std::make_pair(keys[i], values[i]);
+                }
+                std::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 [](const std::pair<Key, unsigned int>& a,
+                                    const std::pair<Key, unsigned int>& b)
+                                 { return Descending ? b.first < a.first : a.first < b.first; });
+
+                std::vector<shard_type> shards(num_shards);
+                for(unsigned int s = 0; s < num_shards; ++s)
+                {
+                    const size_t begin = size * s / num_shards;
+                    const size_t end   = size * (s + 1) / num_shards;
+
+                    shard_type& shard = shards[s];
+                    shard             = {};
+                    shard.device      = device_id;
+                    shard.size        = end - begin;
+                    // Any shard may receive all keys
+                    shard.capacity = std::max<size_t>(size, 1);
+                    HIP_CHECK(hipStreamCreateWithFlags(&shard.stream, hipStreamNonBlocking));
+
+                    Key* d_keys_input;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(
+                        &d_keys_input,
+                        std::max<size_t>(shard.size, 1) * sizeof(Key)));
+                    HIP_CHECK(hipMemcpy(d_keys_input,
+                                        keys.data() + begin,
+                                        shard.size * sizeof(Key),
+                                        hipMemcpyHostToDevice));
+                    shard.keys_input = d_keys_input;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&shard.keys_output,
+                                                                 shard.capacity * sizeof(Key)));
+
+                    if(WithValues)
+                    {
+                        value_type* d_values_input;
+                        HIP_CHECK(test_common_utils::hipMallocHelper(
+                            &d_values_input,
+                            std::max<size_t>(shard.size, 1) * sizeof(value_type)));
+                        HIP_CHECK(hipMemcpy(d_values_input,
+                                            values.data() + begin,
+                                            shard.size * sizeof(value_type),
+                                            hipMemcpyHostToDevice));
+                        shard.values_input = d_values_input;
+                        HIP_CHECK(test_common_utils::hipMallocHelper(
+                            &shard.values_output,
+                            shard.capacity * sizeof(value_type)));
+                    }
+                }
+
+                rocprim::radix_sort_peer_transport transport;
+
+                // Get the size of the temporary storage of every shard
+                HIP_CHECK(invoke_radix_sort_distributed<Descending>(shards.data(),
+                                                                    num_shards,
+                                                                    transport,
+                                                                    0,
+                                                                    8 * sizeof(Key),
+                                                                    debug_synchronous));
+
+                for(shard_type& shard : shards)
+                {
+                    ASSERT_GT(shard.storage_size, 0);
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&shard.temporary_storage,
+                                                                 shard.storage_size));
+                }
+
+                HIP_CHECK(invoke_radix_sort_distributed<Descending>(shards.data(),
+                                                                    num_shards,
+                                                                    transport,
+                                                                    0,
+                                                                    8 * sizeof(Key),
+                                                                    debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                // The shards hold consecutive slices of the sorted sequence
+                std::vector<Key>          keys_output;
+                std::vector<unsigned int> values_output;
+                for(const shard_type& shard : shards)
+                {
+                    ASSERT_LE(shard.output_size, shard.capacity);
+                    const size_t offset = keys_output.size();
+                    keys_output.resize(offset + shard.output_size);
+                    HIP_CHECK(hipMemcpy(keys_output.data() + offset,
+                                        shard.keys_output,
+                                        shard.output_size * sizeof(Key),
+                                        hipMemcpyDeviceToHost));
+                    if(WithValues)
+                    {
+                        values_output.resize(offset + shard.output_size);
+                        HIP_CHECK(hipMemcpy(values_output.data() + offset,
+                                            shard.values_output,
+                                            shard.output_size * sizeof(value_type),
+                                            hipMemcpyDeviceToHost));
+                    }
+                }
+                ASSERT_EQ(keys_output.size(), size);
+
+                std::vector<Key>          keys_expected(size);
+                std::vector<unsigned int> values_expected(size);
+                for(size_t i = 0; i < size; ++i)
+                {
+                    keys_expected[i]   = expected[i].first;
+                    values_expected[i] = expected[i].second;
+                }
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, keys_expected));
+                if(WithValues)
+                {
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+                }
+
+                for(shard_type& shard : shards)
+                {
+                    HIP_CHECK(hipFree(const_cast<Key*>(shard.keys_input)));
+                    HIP_CHECK(hipFree(shard.keys_output));
+                    if(WithValues)
+                    {
+                        HIP_CHECK(hipFree(const_cast<value_type*>(shard.values_input)));
+                        HIP_CHECK(hipFree(shard.values_output));
+                    }
+                    HIP_CHECK(hipFree(shard.temporary_storage));
+                    HIP_CHECK(hipStreamDestroy(shard.stream));
+                }
+            }
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceRadixSortDistributedTests, SortKeys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = typename TestFixture::key_type;
+    test_radix_sort_distributed<false, TestFixture::descending, key_type>(
+        device_id,
+        TestFixture::debug_synchronous);
+}
+
+TYPED_TEST(RocprimDeviceRadixSortDistributedTests, SortPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = typename TestFixture::key_type;
+    test_radix_sort_distributed<true, TestFixture::descending, key_type>(
+        device_id,
+        TestFixture::debug_synchronous);
+}
@@ -0,0 +1,187 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_radix_sort_out_of_core.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_sort_comparator.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+template<class KeyType,
+         bool         Descending = false,
+         unsigned int StartBit   = 0,
+         unsigned int EndBit     = sizeof(KeyType) * 8>
+struct DeviceRadixSortOutOfCoreParams
+{
+    using key_type                          = KeyType;
+    static constexpr bool         descending = Descending;
+    static constexpr unsigned int start_bit  = StartBit;
+    static constexpr unsigned int end_bit    = EndBit;
+};
+
+template<class Params>
+class RocprimDeviceRadixSortOutOfCoreTests : public ::testing::Test
+{
+public:
+    using key_type                           = typename Params::key_type;
+    static constexpr bool         descending = Params::descending;
+    static constexpr unsigned int start_bit  = Params::start_bit;
+    static constexpr unsigned int end_bit    = Params::end_bit;
+    const bool                    debug_synchronous = false;
+};
+
+using RocprimDeviceRadixSortOutOfCoreTestsParams
+    = ::testing::Types<DeviceRadixSortOutOfCoreParams<unsigned int>,
+                       DeviceRadixSortOutOfCoreParams<int, true>,
+                       DeviceRadixSortOutOfCoreParams<unsigned char>,
+                       DeviceRadixSortOutOfCoreParams<unsigned long long, true>,
+                       DeviceRadixSortOutOfCoreParams<float>,
+                       DeviceRadixSortOutOfCoreParams<double, true>,
+                       DeviceRadixSortOutOfCoreParams<unsigned int, false, 4, 20>,
+                       DeviceRadixSortOutOfCoreParams<long long, true, 8, 40>>;
+
+TYPED_TEST_SUITE(RocprimDeviceRadixSortOutOfCoreTests, RocprimDeviceRadixSortOutOfCoreTestsParams);
+
+template<bool Descending, class... Args>
+hipError_t invoke_radix_sort_keys_out_of_core(Args&&... args)
+{
+    return Descending ? rocprim::radix_sort_keys_desc_out_of_core(std::forward<Args>(args)...)
+                      : rocprim::radix_sort_keys_out_of_core(std::forward<Args>(args)...);
+}
+
+template<class T>
+void free_host(T* ptr)
+{
+    HIP_CHECK(hipHostFree(ptr));
+}
+
+TYPED_TEST(RocprimDeviceRadixSortOutOfCoreTests, SortKeys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                           = typename TestFixture::key_type;
+    constexpr bool         descending        = TestFixture::descending;
+    constexpr unsigned int start_bit         = TestFixture::start_bit;
+    constexpr unsigned int end_bit           = TestFixture::end_bit;
+    const bool             debug_synchronous = TestFixture::debug_synchronous;
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // A single run, a single merge pass, and two merge passes
+            for(size_t chunks : {size_t(1), size_t(5), size_t(40)})
+            {
+                const size_t chunk_size = std::max<size_t>(size / chunks, 1);
+                SCOPED_TRACE(testing::Message() << "with chunk_size = " << chunk_size);
+
+                const std::vector<key_type> input
+                    = test_utils::get_random_data<key_type>(
+                        size,
+                        test_utils::generate_limits<key_type>::min(),
+                        test_utils::generate_limits<key_type>::max(),
+                        seed_value);
+
+                // Calculate expected results on host
+                std::vector<key_type> expected(input);
+                std::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 test_utils::key_comparator<key_type,
+                                                            descending,
+                                                            start_bit,
+                                                            end_bit>());
+
+                key_type* h_input;
+                key_type* h_output;
+                key_type* h_buffer;
+                const size_t bytes = std::max<size_t>(size, 1) * sizeof(key_type);
+                HIP_CHECK(hipHostMalloc(&h_input, bytes, hipHostMallocDefault));
+                HIP_CHECK(hipHostMalloc(&h_output, bytes, hipHostMallocDefault));
+                HIP_CHECK(hipHostMalloc(&h_buffer, bytes, hipHostMallocDefault));
+                std::copy(input.begin(), input.end(), h_input);
+
+                size_t temp_storage_size_bytes;
+                void*  d_temp_storage = nullptr;
+                HIP_CHECK(invoke_radix_sort_keys_out_of_core<descending>(d_temp_storage,
+                                                                         temp_storage_size_bytes,
+                                                                         h_input,
+                                                                         h_output,
+                                                                         h_buffer,
+                                                                         size,
+                                                                         chunk_size,
+                                                                         start_bit,
+                                                                         end_bit,
+                                                                         stream,
+                                                                         debug_synchronous));
+
+                ASSERT_GT(temp_storage_size_bytes, 0);
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                HIP_CHECK(invoke_radix_sort_keys_out_of_core<descending>(d_temp_storage,
+                                                                         temp_storage_size_bytes,
+                                                                         h_input,
+                                                                         h_output,
+                                                                         h_buffer,
+                                                                         size,
+                                                                         chunk_size,
+                                                                         start_bit,
+                                                                         end_bit,
+                                                                         stream,
+                                                                         debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+
+                const std::vector<key_type> output(h_output, h_output + size);
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+                // The input is not altered
+                ASSERT_TRUE(std::equal(input.begin(), input.end(), h_input));
+
+                HIP_CHECK(hipFree(d_temp_storage));
+                free_host(h_input);
+                free_host(h_output);
+                free_host(h_buffer);
+            }
+        }
+    }
+}
@@ -0,0 +1,223 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_radix_sort.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_sort_comparator.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+// The pairs of these tests are sorted as packed 64-bit keys, the sizes are above the limit of the
+// merge sort, see radix_sort_packed_impl
+template<class KeyType,
+         class ValueType,
+         bool         Descending = false,
+         unsigned int StartBit   = 0,
+         unsigned int EndBit     = sizeof(KeyType) * 8>
+struct DeviceRadixSortPackedPairsParams
+{
+    using key_type                          = KeyType;
+    using value_type                        = ValueType;
+    static constexpr bool         descending = Descending;
+    static constexpr unsigned int start_bit  = StartBit;
+    static constexpr unsigned int end_bit    = EndBit;
+};
+
+template<class Params>
+class RocprimDeviceRadixSortPackedPairsTests : public ::testing::Test
+{
+public:
+    using key_type                           = typename Params::key_type;
+    using value_type                         = typename Params::value_type;
+    static constexpr bool         descending = Params::descending;
+    static constexpr unsigned int start_bit  = Params::start_bit;
+    static constexpr unsigned int end_bit    = Params::end_bit;
+    const bool                    debug_synchronous = false;
+};
+
+using RocprimDeviceRadixSortPackedPairsTestsParams
+    = ::testing::Types<DeviceRadixSortPackedPairsParams<int, unsigned int>,
+                       DeviceRadixSortPackedPairsParams<int, unsigned int, true>,
+                       DeviceRadixSortPackedPairsParams<unsigned int, float>,
+                       DeviceRadixSortPackedPairsParams<short, unsigned short, true>,
+                       DeviceRadixSortPackedPairsParams<int8_t, uint8_t>,
+                       DeviceRadixSortPackedPairsParams<unsigned int, int, false, 4, 10>,
+                       DeviceRadixSortPackedPairsParams<int, unsigned int, true, 3, 32>>;
+
+TYPED_TEST_SUITE(RocprimDeviceRadixSortPackedPairsTests,
+                 RocprimDeviceRadixSortPackedPairsTestsParams);
+
+template<bool Descending, class... Args>
+hipError_t invoke_radix_sort_pairs(Args&&... args)
+{
+    return Descending ? rocprim::radix_sort_pairs_desc(std::forward<Args>(args)...)
+                      : rocprim::radix_sort_pairs(std::forward<Args>(args)...);
+}
+
+TYPED_TEST(RocprimDeviceRadixSortPackedPairsTests, SortPairsStable)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                           = typename TestFixture::key_type;
+    using value_type                         = typename TestFixture::value_type;
+    constexpr bool         descending        = TestFixture::descending;
+    constexpr unsigned int start_bit         = TestFixture::start_bit;
+    constexpr unsigned int end_bit           = TestFixture::end_bit;
+    const bool             debug_synchronous = TestFixture::debug_synchronous;
+
+    const hipStream_t stream = 0; // default
+
+    // Few distinct keys, so that the order of the values of equal keys is checked
+    const key_type min_key = std::is_signed<key_type>::value
+                                 ? static_cast<key_type>(std::max<long long>(
+                                     std::numeric_limits<key_type>::min(), -1000))
+                                 : key_type(0);
+    const key_type max_key = static_cast<key_type>(
+        std::min<long long>(std::numeric_limits<key_type>::max(), 1000));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : {size_t(1 << 20) + 1, size_t(3 << 20) + 77})
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size, min_key, max_key, seed_value);
+            std::vector<value_type> values_input(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                values_input[i] = static_cast<value_type>(i);
+            }
+
+            using key_value = std::pair<key_type, value_type>;
+            std::vector<key_value> expected(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                expected[i] = key_value(keys_input[i], values_input[i]);
+            }
+            std::stable_sort(expected.begin(),
+                             expected.end(),
+                             test_utils::key_value_comparator<key_type,
+                                                              value_type,
+                                                              descending,
+                                                              start_bit,
+                                                              end_bit>());
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            value_type* d_values_input;
+            value_type* d_values_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(invoke_radix_sort_pairs<descending>(d_temp_storage,
+                                                          temp_storage_size_bytes,
+                                                          d_keys_input,
+                                                          d_keys_output,
+                                                          d_values_input,
+                                                          d_values_output,
+                                                          size,
+                                                          start_bit,
+                                                          end_bit,
+                                                          stream,
+                                                          debug_synchronous));
+
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(invoke_radix_sort_pairs<descending>(d_temp_storage,
+                                                          temp_storage_size_bytes,
+                                                          d_keys_input,
+                                                          d_keys_output,
+                                                          d_values_input,
+                                                          d_values_output,
+                                                          size,
+                                                          start_bit,
+                                                          end_bit,
+                                                          stream,
+                                                          debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<key_type>   keys_output(size);
+            std::vector<value_type> values_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            std::vector<key_type>   expected_keys(size);
+            std::vector<value_type> expected_values(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                expected_keys[i]   = expected[i].first;
+                expected_values[i] = expected[i].second;
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, expected_values));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
@@ -23,14 +23,19 @@
 #include "../common_test_header.hpp"
 
 // required rocprim headers
+#include <rocprim/device/device_arg_reduce.hpp>
+#include <rocprim/device/device_multi_reduce.hpp>
 #include <rocprim/device/device_reduce.hpp>
 #include <rocprim/functional.hpp>
 #include <rocprim/iterator/constant_iterator.hpp>
 #include <rocprim/iterator/counting_iterator.hpp>
+#include <rocprim/thread/thread_operators.hpp>
 
 // required test headers
 #include "test_utils_types.hpp"
 
+#include <cstring>
+
 using bra = ::rocprim::block_reduce_algorithm;
 
 // Params for tests
@@ -886,3 +891,552 @@ TYPED_TEST(RocprimDeviceReduceTests, ReduceMinimum)
         }
     }
 }
+
+TEST(RocprimDeviceReduceTests, ReduceDeterministic)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                             = float;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Sizes reduced by a single launch and by several launches
+        for(size_t size : {size_t(100000), size_t(1) << 20, size_t(5000000), size_t(1) << 25})
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Mixed signs and magnitudes, so the total depends on the order of the additions
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(size, T(-1000), T(1000), seed_value);
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                      temp_storage_size_bytes,
+                                      d_input,
+                                      d_output,
+                                      size,
+                                      rocprim::plus<T>(),
+                                      stream,
+                                      debug_synchronous));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            T first_output;
+            for(unsigned int run = 0; run < 8; ++run)
+            {
+                SCOPED_TRACE(testing::Message() << "with run = " << run);
+
+                HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                          temp_storage_size_bytes,
+                                          d_input,
+                                          d_output,
+                                          size,
+                                          rocprim::plus<T>(),
+                                          stream,
+                                          debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+
+                T output;
+                HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+                if(run == 0)
+                {
+                    first_output = output;
+                }
+                // Results are bitwise identical across runs
+                ASSERT_EQ(std::memcmp(&output, &first_output, sizeof(T)), 0);
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+struct square_op
+{
+    ROCPRIM_HOST_DEVICE
+    unsigned int operator()(const unsigned char x) const
+    {
+        return static_cast<unsigned int>(x) * x;
+    }
+};
+
+TEST(RocprimDeviceReduceTests, TransformReduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                             = unsigned char;
+    using U                             = unsigned int;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(size + 1, 0, 255, seed_value);
+
+            T* d_input;
+            U* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(U)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), (size + 1) * sizeof(T), hipMemcpyHostToDevice));
+
+            // An offset input is not aligned for vector loads
+            for(size_t input_offset : {size_t(0), size_t(1)})
+            {
+                SCOPED_TRACE(testing::Message() << "with input_offset = " << input_offset);
+
+                U expected = 5;
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected += square_op()(input[input_offset + i]);
+                }
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::transform_reduce(nullptr,
+                                                    temp_storage_size_bytes,
+                                                    d_input + input_offset,
+                                                    d_output,
+                                                    U(5),
+                                                    size,
+                                                    rocprim::plus<U>(),
+                                                    square_op(),
+                                                    stream,
+                                                    debug_synchronous));
+
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                HIP_CHECK(rocprim::transform_reduce(d_temp_storage,
+                                                    temp_storage_size_bytes,
+                                                    d_input + input_offset,
+                                                    d_output,
+                                                    U(5),
+                                                    size,
+                                                    rocprim::plus<U>(),
+                                                    square_op(),
+                                                    stream,
+                                                    debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+
+                U output;
+                HIP_CHECK(hipMemcpy(&output, d_output, sizeof(U), hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, expected);
+
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceReduceTests, ReduceFutureSize)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                             = unsigned int;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t max_size : test_utils::get_sizes(seed_value))
+        {
+            // Only a part of the input is reduced, the size is known on the device only
+            const unsigned int size = static_cast<unsigned int>(max_size - max_size / 3);
+            SCOPED_TRACE(testing::Message() << "with max_size = " << max_size);
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(max_size, 0, 100, seed_value);
+            const T expected = std::accumulate(input.begin(), input.begin() + size, T(5));
+
+            T*            d_input;
+            T*            d_output;
+            unsigned int* d_size;
+            HIP_CHECK(test_common_utils::hipMallocHelper(
+                &d_input,
+                std::max<size_t>(max_size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_size, sizeof(*d_size)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), max_size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_size, &size, sizeof(size), hipMemcpyHostToDevice));
+
+            const auto reduce = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+            {
+                return rocprim::reduce(d_temp_storage,
+                                       temp_storage_size_bytes,
+                                       d_input,
+                                       d_output,
+                                       T(5),
+                                       rocprim::future_value<unsigned int>{d_size},
+                                       max_size,
+                                       rocprim::plus<T>(),
+                                       stream,
+                                       debug_synchronous);
+            };
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(reduce(nullptr, temp_storage_size_bytes));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(reduce(d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipGetLastError());
+
+            T output;
+            HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+            ASSERT_EQ(output, expected);
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_size));
+        }
+    }
+}
+
+TEST(RocprimDeviceReduceTests, ReduceAccumulatorType)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // rocprim::plus<> returns its argument type, the sums only fit in the wider accumulator
+    using T                             = unsigned char;
+    using U                             = unsigned int;
+    using op_type                       = rocprim::plus<>;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 255, seed_value);
+            const U expected = std::accumulate(input.begin(), input.end(), U(5));
+
+            T* d_input;
+            U* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(U)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            const auto reduce = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+            {
+                return rocprim::reduce<rocprim::default_config, T*, U*, U, op_type, U>(
+                    d_temp_storage,
+                    temp_storage_size_bytes,
+                    d_input,
+                    d_output,
+                    U(5),
+                    size,
+                    op_type(),
+                    stream,
+                    debug_synchronous);
+            };
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(reduce(nullptr, temp_storage_size_bytes));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(reduce(d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipGetLastError());
+
+            U output;
+            HIP_CHECK(hipMemcpy(&output, d_output, sizeof(U), hipMemcpyDeviceToHost));
+            ASSERT_EQ(output, expected);
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceReduceTests, ReduceCompensatedSum)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                             = float;
+    using op_type                       = rocprim::compensated_plus<T>;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 1, seed_value);
+            const double expected = std::accumulate(input.begin(), input.end(), double(0));
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            // The accumulator type is derived from the operator
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::reduce(nullptr,
+                                      temp_storage_size_bytes,
+                                      d_input,
+                                      d_output,
+                                      T(0),
+                                      size,
+                                      op_type(),
+                                      stream,
+                                      debug_synchronous));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                      temp_storage_size_bytes,
+                                      d_input,
+                                      d_output,
+                                      T(0),
+                                      size,
+                                      op_type(),
+                                      stream,
+                                      debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            T output;
+            HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+            // The compensated sum is within a few roundings of the exact sum, independent of size
+            ASSERT_NEAR(output, expected, 2 * std::numeric_limits<T>::epsilon() * expected);
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+template<class T>
+void run_arg_reduce_test()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using pair_type                     = rocprim::key_value_pair<std::ptrdiff_t, T>;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            if(size == 0)
+            {
+                continue;
+            }
+
+            // A narrow range of values has many ties, of which the first one is reported
+            const std::vector<T> input = test_utils::get_random_data<T>(size, -50, 50, seed_value);
+            const auto           min_it = std::min_element(input.begin(), input.end());
+            const auto           max_it = std::max_element(input.begin(), input.end());
+
+            T*         d_input;
+            pair_type* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, 2 * sizeof(pair_type)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t min_storage_size_bytes;
+            size_t max_storage_size_bytes;
+            HIP_CHECK(rocprim::argmin(nullptr,
+                                      min_storage_size_bytes,
+                                      d_input,
+                                      d_output,
+                                      size,
+                                      stream,
+                                      debug_synchronous));
+            HIP_CHECK(rocprim::argmax(nullptr,
+                                      max_storage_size_bytes,
+                                      d_input,
+                                      d_output + 1,
+                                      size,
+                                      stream,
+                                      debug_synchronous));
+            size_t temp_storage_size_bytes
+                = std::max(min_storage_size_bytes, max_storage_size_bytes);
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::argmin(d_temp_storage,
+                                      temp_storage_size_bytes,
+                                      d_input,
+                                      d_output,
+                                      size,
+                                      stream,
+                                      debug_synchronous));
+            HIP_CHECK(rocprim::argmax(d_temp_storage,
+                                      temp_storage_size_bytes,
+                                      d_input,
+                                      d_output + 1,
+                                      size,
+                                      stream,
+                                      debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            pair_type output[2];
+            HIP_CHECK(hipMemcpy(output, d_output, 2 * sizeof(pair_type), hipMemcpyDeviceToHost));
+            ASSERT_EQ(output[0].key, min_it - input.begin());
+            ASSERT_EQ(output[0].value, *min_it);
+            ASSERT_EQ(output[1].key, max_it - input.begin());
+            ASSERT_EQ(output[1].value, *max_it);
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+// Reduced as packed 64-bit words
+TEST(RocprimDeviceReduceTests, ArgMinMaxPacked)
+{
+    run_arg_reduce_test<short>();
+}
+
+// Reduced as pairs
+TEST(RocprimDeviceReduceTests, ArgMinMaxPairs)
+{
+    run_arg_reduce_test<double>();
+}
+
+TEST(RocprimDeviceReduceTests, MultiReduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                             = float;
+    using statistics_type               = rocprim::reduce_statistics<double>;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Small integers, so the sums are exact in double
+            std::vector<T> input = test_utils::get_random_data<T>(size, -100, 100, seed_value);
+            for(T& value : input)
+            {
+                value = std::round(value);
+            }
+
+            statistics_type expected;
+            for(T value : input)
+            {
+                expected = rocprim::reduce_statistics_plus<double>()(expected,
+                                                                     statistics_type(value));
+            }
+
+            T*               d_input;
+            statistics_type* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(statistics_type)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::multi_reduce(nullptr,
+                                            temp_storage_size_bytes,
+                                            d_input,
+                                            d_output,
+                                            size,
+                                            stream,
+                                            debug_synchronous));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::multi_reduce(d_temp_storage,
+                                            temp_storage_size_bytes,
+                                            d_input,
+                                            d_output,
+                                            size,
+                                            stream,
+                                            debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            statistics_type output;
+            HIP_CHECK(
+                hipMemcpy(&output, d_output, sizeof(statistics_type), hipMemcpyDeviceToHost));
+            ASSERT_EQ(output.count, size);
+            if(size > 0)
+            {
+                ASSERT_EQ(output.minimum, expected.minimum);
+                ASSERT_EQ(output.maximum, expected.maximum);
+                ASSERT_EQ(output.sum, expected.sum);
+                ASSERT_EQ(output.sum_of_squares, expected.sum_of_squares);
+            }
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
@@ -90,6 +90,16 @@ struct custom_key_compare_op1
 using custom_int2 = test_utils::custom_test_type<int>;
 using custom_double2 = test_utils::custom_test_type<double>;
 
+using long_runs_config
+    = rocprim::reduce_by_key_config<256,
+                                    8,
+                                    rocprim::block_load_method::block_load_transpose,
+                                    rocprim::block_load_method::block_load_transpose,
+                                    rocprim::block_scan_algorithm::using_warp_scan,
+                                    1,
+                                    ROCPRIM_GRID_SIZE_LIMIT,
+                                    true>;
+
 // clang-format off
 typedef ::testing::Types<
     params<int, int, rocprim::plus<int>, 1, 1, int, rocprim::equal_to<int>, true>,
@@ -118,7 +128,11 @@ typedef ::testing::Types<
     params<unsigned int, double, rocprim::minimum<double>, 1000, 50000>,
     params<unsigned long long, unsigned long long, rocprim::plus<unsigned long long>, 100000, 100000>,
     params<test_utils::custom_test_array_type<double, 8>, unsigned long, rocprim::plus<>, 69, 420>,
-    params<int, int, rocprim::plus<int>, 1, 10, int, ::rocprim::equal_to<int>, false, true>
+    params<int, int, rocprim::plus<int>, 1, 10, int, ::rocprim::equal_to<int>, false, true>,
+    // long-runs mode, with more segments per chunk than are staged and with long segments
+    params<int, int, rocprim::plus<int>, 1, 30, int, rocprim::equal_to<int>, false, false, false, long_runs_config>,
+    params<float, custom_double2, rocprim::minimum<custom_double2>, 1000, 50000, custom_double2, rocprim::equal_to<float>, false, false, true, long_runs_config>,
+    params<unsigned long long, unsigned long long, rocprim::plus<unsigned long long>, 100000, 100000, unsigned long long, rocprim::equal_to<unsigned long long>, false, false, false, long_runs_config>
 > Params;
 // clang-format on
 
@@ -368,7 +382,10 @@ TYPED_TEST(RocprimDeviceReduceByKey, ReduceByKey)
     }
 }
 
-template<typename value_type, bool use_graphs = false, bool Deterministic = false>
+template<typename value_type,
+         bool use_graphs    = false,
+         bool Deterministic = false,
+         typename Config    = rocprim::default_config>
 void large_indices_reduce_by_key()
 {
     int device_id = test_common_utils::obtain_device_from_ctest();
@@ -424,18 +441,18 @@ void large_indices_reduce_by_key()
 
         size_t temporary_storage_bytes;
 
-        HIP_CHECK(invoke_reduce_by_key<Deterministic>(nullptr,
-                                                      temporary_storage_bytes,
-                                                      d_keys_input,
-                                                      d_values_input,
-                                                      size,
-                                                      d_unique_output,
-                                                      d_aggregates_output,
-                                                      d_unique_count_output,
-                                                      reduce_op,
-                                                      key_compare_op,
-                                                      stream,
-                                                      debug_synchronous));
+        HIP_CHECK((invoke_reduce_by_key<Deterministic, Config>(nullptr,
+                                                               temporary_storage_bytes,
+                                                               d_keys_input,
+                                                               d_values_input,
+                                                               size,
+                                                               d_unique_output,
+                                                               d_aggregates_output,
+                                                               d_unique_count_output,
+                                                               reduce_op,
+                                                               key_compare_op,
+                                                               stream,
+                                                               debug_synchronous)));
 
         ASSERT_GT(temporary_storage_bytes, 0);
 
@@ -449,18 +466,18 @@ void large_indices_reduce_by_key()
            gHelper.startStreamCapture(stream);
         }
 
-        HIP_CHECK(invoke_reduce_by_key<Deterministic>(d_temporary_storage,
-                                                      temporary_storage_bytes,
-                                                      d_keys_input,
-                                                      d_values_input,
-                                                      size,
-                                                      d_unique_output,
-                                                      d_aggregates_output,
-                                                      d_unique_count_output,
-                                                      reduce_op,
-                                                      key_compare_op,
-                                                      stream,
-                                                      debug_synchronous));
+        HIP_CHECK((invoke_reduce_by_key<Deterministic, Config>(d_temporary_storage,
+                                                               temporary_storage_bytes,
+                                                               d_keys_input,
+                                                               d_values_input,
+                                                               size,
+                                                               d_unique_output,
+                                                               d_aggregates_output,
+                                                               d_unique_count_output,
+                                                               reduce_op,
+                                                               key_compare_op,
+                                                               stream,
+                                                               debug_synchronous)));
 
         
         if(use_graphs)
@@ -539,7 +556,15 @@ TEST(RocprimDeviceReduceByKey, LargeIndicesReduceByKeyDeterministic)
     large_indices_reduce_by_key<double, false, true>();
 }
 
-template<typename value_type, bool use_graphs = false, bool Deterministic = false>
+TEST(RocprimDeviceReduceByKey, LargeIndicesReduceByKeyLongRuns)
+{
+    large_indices_reduce_by_key<unsigned int, false, false, long_runs_config>();
+}
+
+template<typename value_type,
+         bool use_graphs    = false,
+         bool Deterministic = false,
+         typename Config    = rocprim::default_config>
 void large_segment_count_reduce_by_key()
 {
     int device_id = test_common_utils::obtain_device_from_ctest();
@@ -579,18 +604,18 @@ void large_segment_count_reduce_by_key()
                                                      sizeof(*d_unique_count_output)));
 
         size_t temporary_storage_bytes;
-        HIP_CHECK(invoke_reduce_by_key<Deterministic>(nullptr,
-                                                      temporary_storage_bytes,
-                                                      d_keys_input,
-                                                      d_values_input,
-                                                      size,
-                                                      d_unique_output,
-                                                      d_aggregates_output,
-                                                      d_unique_count_output,
-                                                      reduce_op,
-                                                      key_compare_op,
-                                                      stream,
-                                                      debug_synchronous));
+        HIP_CHECK((invoke_reduce_by_key<Deterministic, Config>(nullptr,
+                                                               temporary_storage_bytes,
+                                                               d_keys_input,
+                                                               d_values_input,
+                                                               size,
+                                                               d_unique_output,
+                                                               d_aggregates_output,
+                                                               d_unique_count_output,
+                                                               reduce_op,
+                                                               key_compare_op,
+                                                               stream,
+                                                               debug_synchronous)));
 
         ASSERT_GT(temporary_storage_bytes, 0);
 
@@ -604,18 +629,18 @@ void large_segment_count_reduce_by_key()
            gHelper.startStreamCapture(stream);
         }
 
-        HIP_CHECK(invoke_reduce_by_key<Deterministic>(d_temporary_storage,
-                                                      temporary_storage_bytes,
-                                                      d_keys_input,
-                                                      d_values_input,
-                                                      size,
-                                                      d_unique_output,
-                                                      d_aggregates_output,
-                                                      d_unique_count_output,
-                                                      reduce_op,
-                                                      key_compare_op,
-                                                      stream,
-                                                      debug_synchronous));
+        HIP_CHECK((invoke_reduce_by_key<Deterministic, Config>(d_temporary_storage,
+                                                               temporary_storage_bytes,
+                                                               d_keys_input,
+                                                               d_values_input,
+                                                               size,
+                                                               d_unique_output,
+                                                               d_aggregates_output,
+                                                               d_unique_count_output,
+                                                               reduce_op,
+                                                               key_compare_op,
+                                                               stream,
+                                                               debug_synchronous)));
 
         
         if(use_graphs)
@@ -664,6 +689,12 @@ TEST(RocprimDeviceReduceByKey, LargeSegmentCountReduceByKeyDeterministic)
     large_segment_count_reduce_by_key<float, false, true>();
 }
 
+TEST(RocprimDeviceReduceByKey, LargeSegmentCountReduceByKeyLongRuns)
+{
+    // many more segments per chunk than are staged
+    large_segment_count_reduce_by_key<unsigned int, false, false, long_runs_config>();
+}
+
 TEST(RocprimDeviceReduceByKey, ReduceByNonEqualKeys)
 {
     int device_id = test_common_utils::obtain_device_from_ctest();
@@ -756,3 +787,439 @@ TEST(RocprimDeviceReduceByKey, ReduceByNonEqualKeys)
         }
     }
 }
+
+struct key_of_index
+{
+    unsigned int segment_length;
+
+    ROCPRIM_HOST_DEVICE
+    unsigned int operator()(const unsigned int index) const
+    {
+        return index / segment_length;
+    }
+};
+
+TEST(RocprimDeviceReduceByKey, ReduceByKeyAccumulatorType)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // rocprim::plus<> returns its argument type, the sums only fit in the wider accumulator
+    using key_type         = unsigned int;
+    using value_type       = unsigned char;
+    using accumulator_type = unsigned int;
+    using op_type          = rocprim::plus<>;
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+    const value_type  value             = 200;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const unsigned int segment_length
+                = test_utils::get_random_value<unsigned int>(1, 5000, seed_value);
+            SCOPED_TRACE(testing::Message() << "with segment_length = " << segment_length);
+
+            const auto d_keys_input
+                = rocprim::make_transform_iterator(rocprim::make_counting_iterator(key_type(0)),
+                                                   key_of_index{segment_length});
+            const auto d_values_input = rocprim::constant_iterator<value_type>(value);
+
+            const size_t unique_count_expected = (size + segment_length - 1) / segment_length;
+            std::vector<key_type>         unique_expected(unique_count_expected);
+            std::vector<accumulator_type> aggregates_expected(unique_count_expected);
+            for(size_t i = 0; i < unique_count_expected; i++)
+            {
+                unique_expected[i]     = static_cast<key_type>(i);
+                aggregates_expected[i] = static_cast<accumulator_type>(
+                    std::min<size_t>(segment_length, size - i * segment_length) * value);
+            }
+
+            key_type*         d_unique_output;
+            accumulator_type* d_aggregates_output;
+            size_t*           d_unique_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(
+                &d_unique_output,
+                std::max<size_t>(unique_count_expected, 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(
+                &d_aggregates_output,
+                std::max<size_t>(unique_count_expected, 1) * sizeof(accumulator_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_count_output, sizeof(size_t)));
+
+            const auto reduce_by_key = [&](void* d_temporary_storage, size_t& temporary_bytes)
+            {
+                return rocprim::reduce_by_key<rocprim::default_config,
+                                              decltype(d_keys_input),
+                                              decltype(d_values_input),
+                                              key_type*,
+                                              accumulator_type*,
+                                              size_t*,
+                                              op_type,
+                                              rocprim::equal_to<key_type>,
+                                              accumulator_type>(d_temporary_storage,
+                                                                temporary_bytes,
+                                                                d_keys_input,
+                                                                d_values_input,
+                                                                size,
+                                                                d_unique_output,
+                                                                d_aggregates_output,
+                                                                d_unique_count_output,
+                                                                op_type(),
+                                                                rocprim::equal_to<key_type>(),
+                                                                stream,
+                                                                debug_synchronous);
+            };
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(reduce_by_key(nullptr, temporary_storage_bytes));
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(reduce_by_key(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            size_t unique_count_output;
+            HIP_CHECK(hipMemcpy(&unique_count_output,
+                                d_unique_count_output,
+                                sizeof(unique_count_output),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(unique_count_output, unique_count_expected);
+
+            std::vector<key_type>         unique_output(unique_count_expected);
+            std::vector<accumulator_type> aggregates_output(unique_count_expected);
+            HIP_CHECK(hipMemcpy(unique_output.data(),
+                                d_unique_output,
+                                unique_count_expected * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(aggregates_output.data(),
+                                d_aggregates_output,
+                                unique_count_expected * sizeof(accumulator_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(unique_output, unique_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(aggregates_output, aggregates_expected));
+
+            HIP_CHECK(hipFree(d_unique_output));
+            HIP_CHECK(hipFree(d_aggregates_output));
+            HIP_CHECK(hipFree(d_unique_count_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceReduceByKey, StreamingReduceByKey)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = int;
+    using value_type = int;
+    using state_type = rocprim::reduce_by_key_stream_state<key_type, value_type>;
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            // Short runs end in every chunk, long runs continue across chunks
+            for(unsigned int max_run_length : {1u, 10u, 100000u})
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+                SCOPED_TRACE(testing::Message() << "with max_run_length = " << max_run_length);
+
+                std::default_random_engine gen(seed_value);
+                std::uniform_int_distribution<unsigned int> run_length_dis(1, max_run_length);
+                std::vector<key_type> keys_input(size);
+                key_type              key = 0;
+                for(size_t i = 0; i < size;)
+                {
+                    const size_t run_end = std::min<size_t>(size, i + run_length_dis(gen));
+                    std::fill(keys_input.begin() + i, keys_input.begin() + run_end, key);
+                    key += 1 + static_cast<key_type>(run_length_dis(gen) % 3);
+                    i = run_end;
+                }
+                const std::vector<value_type> values_input
+                    = test_utils::get_random_data<value_type>(size, 0, 3, seed_value);
+
+                // Calculate expected results on host
+                std::vector<key_type>   unique_expected;
+                std::vector<value_type> aggregates_expected;
+                for(size_t i = 0; i < size; i++)
+                {
+                    if(i == 0 || keys_input[i] != keys_input[i - 1])
+                    {
+                        unique_expected.push_back(keys_input[i]);
+                        aggregates_expected.push_back(0);
+                    }
+                    aggregates_expected.back() += values_input[i];
+                }
+
+                // Uneven chunks, one of them empty
+                const std::vector<size_t> chunk_ends
+                    = {size / 3, size / 3, std::min(size, size / 3 + size / 2 + 1), size};
+                const size_t chunks = chunk_ends.size();
+
+                // Every chunk has room for one group more than its size
+                key_type*   d_keys_input;
+                value_type* d_values_input;
+                key_type*   d_unique_output;
+                value_type* d_aggregates_output;
+                size_t*     d_unique_count_output;
+                state_type* d_state;
+                HIP_CHECK(test_common_utils::hipMallocHelper(
+                    &d_keys_input,
+                    std::max<size_t>(size, 1) * sizeof(*d_keys_input)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(
+                    &d_values_input,
+                    std::max<size_t>(size, 1) * sizeof(*d_values_input)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(
+                    &d_unique_output,
+                    (size + chunks) * sizeof(*d_unique_output)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(
+                    &d_aggregates_output,
+                    (size + chunks) * sizeof(*d_aggregates_output)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(
+                    &d_unique_count_output,
+                    chunks * sizeof(*d_unique_count_output)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_state, sizeof(*d_state)));
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    keys_input.data(),
+                                    size * sizeof(*d_keys_input),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    size * sizeof(*d_values_input),
+                                    hipMemcpyHostToDevice));
+
+                const auto reduce_by_key = [&](void*   d_temporary_storage,
+                                               size_t& temporary_bytes,
+                                               size_t  chunk,
+                                               size_t  begin,
+                                               size_t  end)
+                {
+                    return rocprim::streaming_reduce_by_key(d_temporary_storage,
+                                                            temporary_bytes,
+                                                            d_keys_input + begin,
+                                                            d_values_input + begin,
+                                                            end - begin,
+                                                            d_unique_output + begin + chunk,
+                                                            d_aggregates_output + begin + chunk,
+                                                            d_unique_count_output + chunk,
+                                                            d_state,
+                                                            rocprim::plus<value_type>(),
+                                                            rocprim::equal_to<key_type>(),
+                                                            stream,
+                                                            debug_synchronous);
+                };
+
+                // The largest chunk needs the most temporary storage
+                size_t temporary_storage_bytes;
+                HIP_CHECK(reduce_by_key(nullptr, temporary_storage_bytes, 0, 0, size));
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+
+                HIP_CHECK(hipMemsetAsync(d_state, 0, sizeof(*d_state), stream));
+                size_t begin = 0;
+                for(size_t chunk = 0; chunk < chunks; chunk++)
+                {
+                    HIP_CHECK(reduce_by_key(d_temporary_storage,
+                                            temporary_storage_bytes,
+                                            chunk,
+                                            begin,
+                                            chunk_ends[chunk]));
+                    begin = chunk_ends[chunk];
+                }
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                // The groups of all chunks and the open run of the last one
+                std::vector<key_type>   unique_output_all(size + chunks);
+                std::vector<value_type> aggregates_output_all(size + chunks);
+                std::vector<size_t>     unique_count_output(chunks);
+                state_type              state;
+                HIP_CHECK(hipMemcpy(unique_output_all.data(),
+                                    d_unique_output,
+                                    unique_output_all.size() * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(aggregates_output_all.data(),
+                                    d_aggregates_output,
+                                    aggregates_output_all.size() * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(unique_count_output.data(),
+                                    d_unique_count_output,
+                                    chunks * sizeof(size_t),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(&state, d_state, sizeof(state), hipMemcpyDeviceToHost));
+
+                std::vector<key_type>   unique_output;
+                std::vector<value_type> aggregates_output;
+                begin = 0;
+                for(size_t chunk = 0; chunk < chunks; chunk++)
+                {
+                    const size_t offset = begin + chunk;
+                    unique_output.insert(unique_output.end(),
+                                         unique_output_all.begin() + offset,
+                                         unique_output_all.begin() + offset
+                                             + unique_count_output[chunk]);
+                    aggregates_output.insert(aggregates_output.end(),
+                                             aggregates_output_all.begin() + offset,
+                                             aggregates_output_all.begin() + offset
+                                                 + unique_count_output[chunk]);
+                    begin = chunk_ends[chunk];
+                }
+                if(size > 0)
+                {
+                    ASSERT_NE(state.has_open_run, 0u);
+                    unique_output.push_back(state.key);
+                    aggregates_output.push_back(state.aggregate);
+                }
+                else
+                {
+                    ASSERT_EQ(state.has_open_run, 0u);
+                }
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(unique_output, unique_expected));
+                ASSERT_NO_FATAL_FAILURE(
+                    test_utils::assert_eq(aggregates_output, aggregates_expected));
+
+                HIP_CHECK(hipFree(d_keys_input));
+                HIP_CHECK(hipFree(d_values_input));
+                HIP_CHECK(hipFree(d_unique_output));
+                HIP_CHECK(hipFree(d_aggregates_output));
+                HIP_CHECK(hipFree(d_unique_count_output));
+                HIP_CHECK(hipFree(d_state));
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceReduceByKey, ReduceByHeadFlags)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using flag_type  = unsigned char;
+    using value_type = int;
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // About one head in 30 items
+            const std::vector<unsigned int> random
+                = test_utils::get_random_data<unsigned int>(size, 0, 29, seed_value);
+            const std::vector<value_type> values_input
+                = test_utils::get_random_data<value_type>(size, -100, 100, seed_value + 1);
+            std::vector<flag_type> flags(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                flags[i] = random[i] == 0 ? 1 : 0;
+            }
+
+            std::vector<value_type> aggregates_expected;
+            for(size_t i = 0; i < size; i++)
+            {
+                if(i == 0 || flags[i])
+                {
+                    aggregates_expected.push_back(values_input[i]);
+                }
+                else
+                {
+                    aggregates_expected.back() += values_input[i];
+                }
+            }
+
+            flag_type*   d_flags;
+            value_type*  d_values_input;
+            value_type*  d_aggregates_output;
+            size_t*      d_unique_count_output;
+            const size_t allocated = std::max<size_t>(size, 1);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_flags, allocated * sizeof(flag_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         allocated * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_aggregates_output,
+                                                         allocated * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_count_output, sizeof(size_t)));
+            HIP_CHECK(
+                hipMemcpy(d_flags, flags.data(), size * sizeof(flag_type), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::reduce_by_head_flags(nullptr,
+                                                    temporary_storage_bytes,
+                                                    d_flags,
+                                                    d_values_input,
+                                                    size,
+                                                    d_aggregates_output,
+                                                    d_unique_count_output,
+                                                    rocprim::plus<value_type>(),
+                                                    stream,
+                                                    debug_synchronous));
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::reduce_by_head_flags(d_temporary_storage,
+                                                    temporary_storage_bytes,
+                                                    d_flags,
+                                                    d_values_input,
+                                                    size,
+                                                    d_aggregates_output,
+                                                    d_unique_count_output,
+                                                    rocprim::plus<value_type>(),
+                                                    stream,
+                                                    debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            size_t unique_count_output;
+            HIP_CHECK(hipMemcpy(&unique_count_output,
+                                d_unique_count_output,
+                                sizeof(unique_count_output),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(unique_count_output, aggregates_expected.size());
+
+            std::vector<value_type> aggregates_output(unique_count_output);
+            HIP_CHECK(hipMemcpy(aggregates_output.data(),
+                                d_aggregates_output,
+                                unique_count_output * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(aggregates_output, aggregates_expected));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_flags));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_aggregates_output));
+            HIP_CHECK(hipFree(d_unique_count_output));
+        }
+    }
+}
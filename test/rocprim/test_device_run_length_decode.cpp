@@ -0,0 +1,240 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_run_length_decode.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <random>
+#include <vector>
+
+#include <cstddef>
+
+template<class ValueType,
+         class LengthType,
+         unsigned int MaxLength,
+         class Config   = rocprim::default_config,
+         bool UseGraphs = false>
+struct DeviceRunLengthDecodeParams
+{
+    using value_type                         = ValueType;
+    using length_type                        = LengthType;
+    using config                             = Config;
+    static constexpr unsigned int max_length = MaxLength;
+    static constexpr bool         use_graphs = UseGraphs;
+};
+
+template<class Params>
+class RocprimDeviceRunLengthDecodeTests : public ::testing::Test
+{
+public:
+    using value_type                                = typename Params::value_type;
+    using length_type                               = typename Params::length_type;
+    using config                                    = typename Params::config;
+    static constexpr unsigned int max_length        = Params::max_length;
+    static constexpr bool         use_graphs        = Params::use_graphs;
+    const bool                    debug_synchronous = false;
+};
+
+using RocprimDeviceRunLengthDecodeTestsParams = ::testing::Types<
+    DeviceRunLengthDecodeParams<int, int, 4>,
+    DeviceRunLengthDecodeParams<int, unsigned char, 1>,
+    DeviceRunLengthDecodeParams<double, unsigned int, 16>,
+    DeviceRunLengthDecodeParams<unsigned char, size_t, 3>,
+    DeviceRunLengthDecodeParams<test_utils::custom_test_type<int>, int, 8>,
+    DeviceRunLengthDecodeParams<int, int, 2, rocprim::run_length_decode_config<64, 3>>,
+    DeviceRunLengthDecodeParams<long long, int, 5, rocprim::run_length_decode_config<256, 8>>,
+    DeviceRunLengthDecodeParams<int, int, 4, rocprim::default_config, true>>;
+
+TYPED_TEST_SUITE(RocprimDeviceRunLengthDecodeTests, RocprimDeviceRunLengthDecodeTestsParams);
+
+TYPED_TEST(RocprimDeviceRunLengthDecodeTests, Decode)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using value_type                         = typename TestFixture::value_type;
+    using length_type                        = typename TestFixture::length_type;
+    using config                             = typename TestFixture::config;
+    const bool debug_synchronous             = TestFixture::debug_synchronous;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t num_runs : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with num_runs = " << num_runs);
+
+            hipStream_t stream = 0; // default
+            if(TestFixture::use_graphs)
+            {
+                // Default stream does not support hipGraph stream capture, so create one
+                HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+            }
+
+            const std::vector<value_type> values
+                = test_utils::get_random_data<value_type>(num_runs, 0, 100, seed_value);
+
+            // Short runs, including empty ones, with a few long runs in between
+            std::default_random_engine                  gen(seed_value);
+            std::uniform_int_distribution<unsigned int> length_dis(0, TestFixture::max_length);
+            std::bernoulli_distribution                 is_long_dis(0.001);
+            std::vector<length_type>                    lengths(num_runs);
+            for(length_type& length : lengths)
+            {
+                length = static_cast<length_type>(is_long_dis(gen) ? 200 : length_dis(gen));
+            }
+
+            std::vector<value_type> expected;
+            std::vector<size_t>     expected_relative_offsets;
+            for(size_t run = 0; run < num_runs; run++)
+            {
+                for(size_t i = 0; i < static_cast<size_t>(lengths[run]); i++)
+                {
+                    expected.push_back(values[run]);
+                    expected_relative_offsets.push_back(i);
+                }
+            }
+            const size_t output_size = expected.size();
+
+            value_type*  d_values;
+            length_type* d_lengths;
+            value_type*  d_output;
+            size_t*      d_relative_offsets;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values,
+                                                         std::max<size_t>(num_runs, 1)
+                                                             * sizeof(*d_values)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_lengths,
+                                                         std::max<size_t>(num_runs, 1)
+                                                             * sizeof(*d_lengths)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(output_size, 1)
+                                                             * sizeof(*d_output)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_relative_offsets,
+                                                         std::max<size_t>(output_size, 1)
+                                                             * sizeof(*d_relative_offsets)));
+            HIP_CHECK(hipMemcpy(d_values,
+                                values.data(),
+                                num_runs * sizeof(*d_values),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_lengths,
+                                lengths.data(),
+                                num_runs * sizeof(*d_lengths),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::run_length_decode_with_relative_offsets<config>(
+                d_temp_storage,
+                temp_storage_size_bytes,
+                d_values,
+                d_lengths,
+                num_runs,
+                d_output,
+                d_relative_offsets,
+                stream,
+                debug_synchronous));
+
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            test_utils::GraphHelper gHelper;
+            if(TestFixture::use_graphs)
+            {
+                gHelper.startStreamCapture(stream);
+            }
+
+            HIP_CHECK(rocprim::run_length_decode_with_relative_offsets<config>(
+                d_temp_storage,
+                temp_storage_size_bytes,
+                d_values,
+                d_lengths,
+                num_runs,
+                d_output,
+                d_relative_offsets,
+                stream,
+                debug_synchronous));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.createAndLaunchGraph(stream);
+            }
+
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<value_type> output(output_size);
+            std::vector<size_t>     relative_offsets(output_size);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output_size * sizeof(*d_output),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(relative_offsets.data(),
+                                d_relative_offsets,
+                                output_size * sizeof(*d_relative_offsets),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(relative_offsets, expected_relative_offsets));
+
+            // The decoding without relative offsets writes the same output
+            HIP_CHECK(hipMemset(d_output, 0, std::max<size_t>(output_size, 1) * sizeof(*d_output)));
+            HIP_CHECK(rocprim::run_length_decode<config>(d_temp_storage,
+                                                         temp_storage_size_bytes,
+                                                         d_values,
+                                                         d_lengths,
+                                                         num_runs,
+                                                         d_output,
+                                                         stream,
+                                                         debug_synchronous));
+            HIP_CHECK(hipStreamSynchronize(stream));
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output_size * sizeof(*d_output),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_values));
+            HIP_CHECK(hipFree(d_lengths));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_relative_offsets));
+            HIP_CHECK(hipFree(d_temp_storage));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.cleanupGraphHelper();
+                HIP_CHECK(hipStreamDestroy(stream));
+            }
+        }
+    }
+}
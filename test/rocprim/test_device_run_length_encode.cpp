@@ -426,3 +426,206 @@ TYPED_TEST(RocprimDeviceRunLengthEncode, NonTrivialRuns)
     }
 
 }
+
+TYPED_TEST(RocprimDeviceRunLengthEncode, EncodeWithOffsets)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type    = typename TestFixture::params::key_type;
+    using count_type  = typename TestFixture::params::count_type;
+    using offset_type = typename TestFixture::params::count_type;
+    using config      = typename TestFixture::params::config;
+
+    constexpr bool use_identity_iterator = TestFixture::params::use_identity_iterator;
+    const bool     debug_synchronous     = false;
+
+    const unsigned int         seed = 123;
+    std::default_random_engine gen(seed);
+    std::vector<key_type> random_keys = test_utils::get_random_data<key_type>(64, -100, 100, seed);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            hipStream_t stream = 0; // default
+
+            // Generate data and calculate expected results, both of all runs and of the
+            // non-trivial runs only
+            std::vector<key_type>    unique_expected[2];
+            std::vector<offset_type> offsets_expected[2];
+            std::vector<count_type>  counts_expected[2];
+
+            std::vector<key_type>                 input(size);
+            std::uniform_int_distribution<size_t> key_count_dis(
+                TestFixture::params::min_segment_length,
+                TestFixture::params::max_segment_length);
+            std::bernoulli_distribution is_trivial_dis(0.1);
+
+            size_t   offset      = 0;
+            key_type current_key = get_random_value_no_duplicate(key_type(0), random_keys, size);
+            while(offset < size)
+            {
+                size_t key_count = TestFixture::params::min_segment_length == 1
+                                           && is_trivial_dis(gen)
+                                       ? 1
+                                       : key_count_dis(gen);
+                const size_t end = std::min(size, offset + key_count);
+
+                current_key = get_random_value_no_duplicate(current_key, random_keys, end);
+
+                key_count = end - offset;
+                for(size_t i = offset; i < end; i++)
+                {
+                    input[i] = current_key;
+                }
+
+                for(size_t non_trivial = 0; non_trivial < 2; non_trivial++)
+                {
+                    if(non_trivial == 0 || key_count > 1)
+                    {
+                        unique_expected[non_trivial].push_back(current_key);
+                        offsets_expected[non_trivial].push_back(static_cast<offset_type>(offset));
+                        counts_expected[non_trivial].push_back(static_cast<count_type>(key_count));
+                    }
+                }
+
+                offset += key_count;
+            }
+
+            key_type* d_input;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(key_type)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+
+            for(size_t non_trivial = 0; non_trivial < 2; non_trivial++)
+            {
+                SCOPED_TRACE(testing::Message() << "with non_trivial = " << non_trivial);
+
+                const size_t runs_count_expected = unique_expected[non_trivial].size();
+                const size_t output_size         = std::max<size_t>(1, runs_count_expected);
+
+                key_type*    d_unique_output;
+                offset_type* d_offsets_output;
+                count_type*  d_counts_output;
+                count_type*  d_runs_count_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_output,
+                                                             output_size * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets_output,
+                                                             output_size * sizeof(offset_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_counts_output,
+                                                             output_size * sizeof(count_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_runs_count_output, sizeof(count_type)));
+
+                auto encode = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+                {
+                    const auto unique_output
+                        = test_utils::wrap_in_identity_iterator<use_identity_iterator>(
+                            d_unique_output);
+                    const auto offsets_output
+                        = test_utils::wrap_in_identity_iterator<use_identity_iterator>(
+                            d_offsets_output);
+                    const auto counts_output
+                        = test_utils::wrap_in_identity_iterator<use_identity_iterator>(
+                            d_counts_output);
+                    const auto runs_count_output
+                        = test_utils::wrap_in_identity_iterator<use_identity_iterator>(
+                            d_runs_count_output);
+                    if(non_trivial == 0)
+                    {
+                        return rocprim::run_length_encode_with_offsets<config>(
+                            d_temporary_storage,
+                            temporary_storage_bytes,
+                            d_input,
+                            size,
+                            unique_output,
+                            offsets_output,
+                            counts_output,
+                            runs_count_output,
+                            stream,
+                            debug_synchronous);
+                    }
+                    return rocprim::run_length_encode_non_trivial_runs_with_values<config>(
+                        d_temporary_storage,
+                        temporary_storage_bytes,
+                        d_input,
+                        size,
+                        unique_output,
+                        offsets_output,
+                        counts_output,
+                        runs_count_output,
+                        stream,
+                        debug_synchronous);
+                };
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(encode(nullptr, temporary_storage_bytes));
+
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+
+                HIP_CHECK(encode(d_temporary_storage, temporary_storage_bytes));
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                std::vector<key_type>    unique_output(runs_count_expected);
+                std::vector<offset_type> offsets_output(runs_count_expected);
+                std::vector<count_type>  counts_output(runs_count_expected);
+                std::vector<count_type>  runs_count_output(1);
+                if(runs_count_expected > 0)
+                {
+                    HIP_CHECK(hipMemcpy(unique_output.data(),
+                                        d_unique_output,
+                                        runs_count_expected * sizeof(key_type),
+                                        hipMemcpyDeviceToHost));
+                    HIP_CHECK(hipMemcpy(offsets_output.data(),
+                                        d_offsets_output,
+                                        runs_count_expected * sizeof(offset_type),
+                                        hipMemcpyDeviceToHost));
+                    HIP_CHECK(hipMemcpy(counts_output.data(),
+                                        d_counts_output,
+                                        runs_count_expected * sizeof(count_type),
+                                        hipMemcpyDeviceToHost));
+                }
+                HIP_CHECK(hipMemcpy(runs_count_output.data(),
+                                    d_runs_count_output,
+                                    sizeof(count_type),
+                                    hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_unique_output));
+                HIP_CHECK(hipFree(d_offsets_output));
+                HIP_CHECK(hipFree(d_counts_output));
+                HIP_CHECK(hipFree(d_runs_count_output));
+
+                // Validating results
+                test_utils::assert_eq(
+                    runs_count_output,
+                    std::vector<count_type>{static_cast<count_type>(runs_count_expected)},
+                    1);
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(unique_output,
+                                                              unique_expected[non_trivial],
+                                                              runs_count_expected));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(offsets_output,
+                                                              offsets_expected[non_trivial],
+                                                              runs_count_expected));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(counts_output,
+                                                              counts_expected[non_trivial],
+                                                              runs_count_expected));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+        }
+    }
+}
@@ -0,0 +1,214 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_sample_sort.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <cstddef>
+
+// A key without a radix representation, operator== or conversion from 0, ordered by `rank` only.
+struct sample_sort_key
+{
+    int          rank;
+    unsigned int tag;
+};
+
+struct sample_sort_key_less
+{
+    ROCPRIM_HOST_DEVICE bool operator()(const sample_sort_key& lhs,
+                                        const sample_sort_key& rhs) const
+    {
+        return lhs.rank < rhs.rank;
+    }
+};
+
+std::vector<size_t> get_sample_sort_sizes(const unsigned int seed_value)
+{
+    std::vector<size_t> sizes = test_utils::get_sizes(seed_value);
+    // Larger than one segment, so the input is bucketed
+    sizes.push_back((1 << 16) + 1);
+    sizes.push_back(1 << 20);
+    return sizes;
+}
+
+// Ranks from a wide range, or from a few distinct values that fill the equality buckets.
+void run_sample_sort_test(const bool with_values, const int max_rank)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = sample_sort_key;
+    using value_type = unsigned int;
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : get_sample_sort_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<int> ranks
+                = test_utils::get_random_data<int>(size, -max_rank, max_rank, seed_value);
+            std::vector<key_type> keys(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                keys[i] = key_type{ranks[i], static_cast<unsigned int>(i)};
+            }
+            std::vector<value_type> values(size);
+            std::iota(values.begin(), values.end(), 0);
+
+            // Calculate expected results on host
+            std::vector<int> expected(ranks);
+            std::sort(expected.begin(), expected.end());
+
+            key_type*    d_keys_input;
+            key_type*    d_keys_output;
+            value_type*  d_values_input;
+            value_type*  d_values_output;
+            const size_t allocated = std::max<size_t>(size, 1);
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_keys_input, allocated * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_keys_output, allocated * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         allocated * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                         allocated * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            const auto invoke = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+            {
+                if(with_values)
+                {
+                    return rocprim::sample_sort(d_temp_storage,
+                                                temp_storage_size_bytes,
+                                                d_keys_input,
+                                                d_keys_output,
+                                                d_values_input,
+                                                d_values_output,
+                                                size,
+                                                sample_sort_key_less(),
+                                                stream,
+                                                debug_synchronous);
+                }
+                return rocprim::sample_sort(d_temp_storage,
+                                            temp_storage_size_bytes,
+                                            d_keys_input,
+                                            d_keys_output,
+                                            size,
+                                            sample_sort_key_less(),
+                                            stream,
+                                            debug_synchronous);
+            };
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(invoke(d_temp_storage, temp_storage_size_bytes));
+
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(invoke(d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<key_type>   keys_output(size);
+            std::vector<value_type> values_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            // The sort is not stable: the ranks must be sorted, and the keys (and values) must be
+            // a permutation of the input that keeps every pair together.
+            std::vector<int>          output_ranks(size);
+            std::vector<unsigned int> output_tags(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                output_ranks[i] = keys_output[i].rank;
+                output_tags[i]  = keys_output[i].tag;
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output_ranks, expected));
+            for(size_t i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(output_ranks[i], ranks[output_tags[i]]) << "where index = " << i;
+            }
+            if(with_values)
+            {
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, output_tags));
+            }
+            std::sort(output_tags.begin(), output_tags.end());
+            std::vector<unsigned int> expected_tags(size);
+            std::iota(expected_tags.begin(), expected_tags.end(), 0);
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output_tags, expected_tags));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceSampleSortTests, SortKeys)
+{
+    run_sample_sort_test(false, 1 << 30);
+}
+
+TEST(RocprimDeviceSampleSortTests, SortPairs)
+{
+    run_sample_sort_test(true, 1 << 30);
+}
+
+TEST(RocprimDeviceSampleSortTests, SortPairsFewDistinct)
+{
+    run_sample_sort_test(true, 4);
+}
@@ -28,7 +28,9 @@
 #include <rocprim/device/device_scan_by_key.hpp>
 #include <rocprim/iterator/constant_iterator.hpp>
 #include <rocprim/iterator/counting_iterator.hpp>
+#include <rocprim/iterator/packed_bits_iterator.hpp>
 #include <rocprim/iterator/transform_iterator.hpp>
+#include <rocprim/thread/thread_operators.hpp>
 
 // required test headers
 #include "test_utils_types.hpp"
@@ -43,7 +45,7 @@ struct default_config_helper
     using type = ::rocprim::default_config;
 };
 
-template<unsigned int SizeLimit>
+template<unsigned int SizeLimit, bool Persistent = false>
 struct size_limit_config_helper
 {
     template<bool ByKey>
@@ -54,13 +56,40 @@ struct size_limit_config_helper
                                     rocprim::block_load_method::block_load_transpose,
                                     rocprim::block_store_method::block_store_transpose,
                                     rocprim::block_scan_algorithm::using_warp_scan,
-                                    SizeLimit>,
+                                    SizeLimit,
+                                    Persistent>,
         rocprim::scan_config<256,
                              16,
                              rocprim::block_load_method::block_load_transpose,
                              rocprim::block_store_method::block_store_transpose,
                              rocprim::block_scan_algorithm::using_warp_scan,
-                             SizeLimit>>;
+                             SizeLimit,
+                             Persistent>>;
+};
+
+struct two_pass_config_helper
+{
+    template<bool ByKey>
+    using type = std::conditional_t<
+        ByKey,
+        rocprim::scan_by_key_config<256,
+                                    16,
+                                    rocprim::block_load_method::block_load_transpose,
+                                    rocprim::block_store_method::block_store_transpose,
+                                    rocprim::block_scan_algorithm::using_warp_scan,
+                                    ROCPRIM_GRID_SIZE_LIMIT,
+                                    false,
+                                    rocprim::lookback_backoff_config<>,
+                                    true>,
+        rocprim::scan_config<256,
+                             16,
+                             rocprim::block_load_method::block_load_transpose,
+                             rocprim::block_store_method::block_store_transpose,
+                             rocprim::block_scan_algorithm::using_warp_scan,
+                             ROCPRIM_GRID_SIZE_LIMIT,
+                             false,
+                             rocprim::lookback_backoff_config<>,
+                             true>>;
 };
 
 // Params for tests
@@ -172,6 +201,31 @@ typedef ::testing::Types<
                      true>,
     DeviceScanParams<int, int, rocprim::plus<int>, false, size_limit_config_helper<524288>>,
     DeviceScanParams<int, int, rocprim::plus<int>, false, size_limit_config_helper<1048576>>,
+    DeviceScanParams<int,
+                     int,
+                     rocprim::plus<int>,
+                     false,
+                     size_limit_config_helper<ROCPRIM_GRID_SIZE_LIMIT, true>>,
+    DeviceScanParams<float,
+                     float,
+                     rocprim::plus<float>,
+                     false,
+                     size_limit_config_helper<ROCPRIM_GRID_SIZE_LIMIT, true>,
+                     false,
+                     true>,
+    DeviceScanParams<int, int, rocprim::plus<int>, false, two_pass_config_helper>,
+    DeviceScanParams<float,
+                     float,
+                     rocprim::plus<float>,
+                     false,
+                     two_pass_config_helper,
+                     false,
+                     true>,
+    DeviceScanParams<test_utils::custom_test_type<double>,
+                     test_utils::custom_test_type<double>,
+                     rocprim::plus<test_utils::custom_test_type<double>>,
+                     true,
+                     two_pass_config_helper>,
     DeviceScanParams<int8_t, int8_t, rocprim::maximum<int8_t>>,
     DeviceScanParams<uint8_t, uint8_t, rocprim::maximum<uint8_t>, false>,
     DeviceScanParams<rocprim::half, rocprim::half, rocprim::maximum<rocprim::half>>,
@@ -220,6 +274,9 @@ typedef ::testing::Types<
     DeviceScanParams<test_utils::custom_test_type<int>>,
     DeviceScanParams<test_utils::custom_test_array_type<long long, 5>>,
     DeviceScanParams<test_utils::custom_test_array_type<int, 10>>,
+    // 64-byte accumulators, scanned without look-back. InclusiveScanMatrixProduct scans 4x4
+    // matrices of this size with their non-commutative product.
+    DeviceScanParams<test_utils::custom_test_array_type<int, 16>>,
     // With graphs
     DeviceScanParams<int, int, rocprim::plus<int>, false, default_config_helper, true>>
     RocprimDeviceScanTestsParams;
@@ -1837,3 +1894,693 @@ TYPED_TEST(RocprimDeviceScanFutureTests, ExclusiveScan)
         }
     }
 }
+
+struct non_zero_op
+{
+    ROCPRIM_HOST_DEVICE
+    unsigned int operator()(const unsigned char x) const
+    {
+        return x != 0 ? 1u : 0u;
+    }
+};
+
+TEST(RocprimDeviceScanTests, TransformScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                             = unsigned char;
+    using U                             = unsigned int;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(size + 1, 0, 3, seed_value);
+
+            T* d_input;
+            U* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(U)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), (size + 1) * sizeof(T), hipMemcpyHostToDevice));
+
+            // An offset input is not aligned for vector loads
+            for(size_t input_offset : {size_t(0), size_t(1)})
+            {
+                for(bool exclusive : {false, true})
+                {
+                    SCOPED_TRACE(testing::Message() << "with input_offset = " << input_offset
+                                                    << ", exclusive = " << exclusive);
+
+                    std::vector<U> expected(size);
+                    U              sum = exclusive ? 7 : 0;
+                    for(size_t i = 0; i < size; i++)
+                    {
+                        if(exclusive)
+                        {
+                            expected[i] = sum;
+                        }
+                        sum += non_zero_op()(input[input_offset + i]);
+                        if(!exclusive)
+                        {
+                            expected[i] = sum;
+                        }
+                    }
+
+                    const auto run = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+                    {
+                        if(exclusive)
+                        {
+                            return rocprim::transform_exclusive_scan(d_temp_storage,
+                                                                     temp_storage_size_bytes,
+                                                                     d_input + input_offset,
+                                                                     d_output,
+                                                                     U(7),
+                                                                     size,
+                                                                     rocprim::plus<U>(),
+                                                                     non_zero_op(),
+                                                                     stream,
+                                                                     debug_synchronous);
+                        }
+                        return rocprim::transform_inclusive_scan(d_temp_storage,
+                                                                 temp_storage_size_bytes,
+                                                                 d_input + input_offset,
+                                                                 d_output,
+                                                                 size,
+                                                                 rocprim::plus<U>(),
+                                                                 non_zero_op(),
+                                                                 stream,
+                                                                 debug_synchronous);
+                    };
+
+                    size_t temp_storage_size_bytes;
+                    HIP_CHECK(run(nullptr, temp_storage_size_bytes));
+
+                    void* d_temp_storage;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage,
+                                                                 temp_storage_size_bytes));
+
+                    HIP_CHECK(run(d_temp_storage, temp_storage_size_bytes));
+                    HIP_CHECK(hipGetLastError());
+
+                    std::vector<U> output(size);
+                    HIP_CHECK(hipMemcpy(output.data(),
+                                        d_output,
+                                        size * sizeof(U),
+                                        hipMemcpyDeviceToHost));
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+                    HIP_CHECK(hipFree(d_temp_storage));
+                }
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceScanTests, InclusiveScanCompensatedSum)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                             = float;
+    using acc_type                      = rocprim::compensated_sum<T>;
+    using op_type                       = rocprim::compensated_plus<T>;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 1, seed_value);
+            std::vector<double>  expected(size);
+            std::partial_sum(input.begin(), input.end(), expected.begin(), std::plus<double>());
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            // The compensated sums are the accumulator of the scan, also in its look-back state
+            const auto scan = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+            {
+                return rocprim::inclusive_scan<rocprim::default_config, T*, T*, op_type, acc_type>(
+                    d_temp_storage,
+                    temp_storage_size_bytes,
+                    d_input,
+                    d_output,
+                    size,
+                    op_type(),
+                    stream,
+                    debug_synchronous);
+            };
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(scan(nullptr, temp_storage_size_bytes));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(scan(d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_NEAR(output[i],
+                            expected[i],
+                            2 * std::numeric_limits<T>::epsilon() * expected[i])
+                    << "where index = " << i;
+            }
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+// Row-major product of 4x4 matrices. It is associative but not commutative, so it checks that
+// the scans combine the items in order. unsigned int wraps around, so the products are exact.
+struct matrix_product_op
+{
+    using matrix_type = test_utils::custom_test_array_type<unsigned int, 16>;
+
+    ROCPRIM_HOST_DEVICE
+    matrix_type operator()(const matrix_type& a, const matrix_type& b) const
+    {
+        matrix_type result;
+        for(unsigned int row = 0; row < 4; row++)
+        {
+            for(unsigned int column = 0; column < 4; column++)
+            {
+                unsigned int sum = 0;
+                for(unsigned int i = 0; i < 4; i++)
+                {
+                    sum += a.values[row * 4 + i] * b.values[i * 4 + column];
+                }
+                result.values[row * 4 + column] = sum;
+            }
+        }
+        return result;
+    }
+};
+
+TEST(RocprimDeviceScanTests, InclusiveScanMatrixProduct)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                             = matrix_product_op::matrix_type;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 3, seed_value);
+            std::vector<T>       expected(size);
+            std::partial_sum(input.begin(), input.end(), expected.begin(), matrix_product_op());
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            // The matrices are larger than 32 bytes, so both scans use the two-pass scan
+            for(bool deterministic : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with deterministic = " << deterministic);
+
+                const auto scan = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+                {
+                    if(deterministic)
+                    {
+                        return rocprim::deterministic_inclusive_scan(d_temp_storage,
+                                                                     temp_storage_size_bytes,
+                                                                     d_input,
+                                                                     d_output,
+                                                                     size,
+                                                                     matrix_product_op(),
+                                                                     stream,
+                                                                     debug_synchronous);
+                    }
+                    return rocprim::inclusive_scan(d_temp_storage,
+                                                   temp_storage_size_bytes,
+                                                   d_input,
+                                                   d_output,
+                                                   size,
+                                                   matrix_product_op(),
+                                                   stream,
+                                                   debug_synchronous);
+                };
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(scan(nullptr, temp_storage_size_bytes));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(scan(d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<T> output(size);
+                HIP_CHECK(
+                    hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceScanTests, StreamingScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                             = int;
+    using state_type                    = rocprim::scan_stream_state<T>;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+    const T           initial_value     = 7;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 3, seed_value);
+            std::vector<T>       expected_inclusive(size);
+            std::partial_sum(input.begin(), input.end(), expected_inclusive.begin());
+            std::vector<T> expected_exclusive(size);
+            test_utils::host_exclusive_scan(input.begin(),
+                                            input.end(),
+                                            initial_value,
+                                            expected_exclusive.begin(),
+                                            rocprim::plus<T>());
+
+            // Uneven chunks, one of them empty
+            const std::vector<size_t> chunk_ends
+                = {size / 3, size / 3, std::min(size, size / 3 + size / 2 + 1), size};
+
+            T*          d_input;
+            T*          d_output;
+            state_type* d_state;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_state, sizeof(*d_state)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            for(bool exclusive : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with exclusive = " << exclusive);
+
+                const auto scan = [&](void*   d_temp_storage,
+                                      size_t& temp_storage_size_bytes,
+                                      size_t  begin,
+                                      size_t  end)
+                {
+                    return exclusive
+                               ? rocprim::streaming_exclusive_scan(d_temp_storage,
+                                                                   temp_storage_size_bytes,
+                                                                   d_input + begin,
+                                                                   d_output + begin,
+                                                                   initial_value,
+                                                                   end - begin,
+                                                                   d_state,
+                                                                   rocprim::plus<T>(),
+                                                                   stream,
+                                                                   debug_synchronous)
+                               : rocprim::streaming_inclusive_scan(d_temp_storage,
+                                                                   temp_storage_size_bytes,
+                                                                   d_input + begin,
+                                                                   d_output + begin,
+                                                                   end - begin,
+                                                                   d_state,
+                                                                   rocprim::plus<T>(),
+                                                                   stream,
+                                                                   debug_synchronous);
+                };
+
+                // The largest chunk needs the most temporary storage
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(scan(nullptr, temp_storage_size_bytes, 0, size));
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                HIP_CHECK(hipMemsetAsync(d_state, 0, sizeof(*d_state), stream));
+                size_t begin = 0;
+                for(size_t end : chunk_ends)
+                {
+                    HIP_CHECK(scan(d_temp_storage, temp_storage_size_bytes, begin, end));
+                    begin = end;
+                }
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<T> output(size);
+                HIP_CHECK(
+                    hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+                state_type state;
+                HIP_CHECK(hipMemcpy(&state, d_state, sizeof(state), hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(
+                    test_utils::assert_eq(output,
+                                          exclusive ? expected_exclusive : expected_inclusive));
+                if(size > 0)
+                {
+                    ASSERT_NE(state.has_carry, 0u);
+                    ASSERT_EQ(state.carry,
+                              expected_inclusive.back() + (exclusive ? initial_value : 0));
+                }
+
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_state));
+        }
+    }
+}
+
+// Head flags as bytes for the exclusive scan and packed into bits for the inclusive scan
+TEST(RocprimDeviceScanTests, ScanByHeadFlags)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using flag_type  = unsigned char;
+    using value_type = int;
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+    const value_type  initial_value     = 10;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // About one head in 30 items
+            const std::vector<unsigned int> random
+                = test_utils::get_random_data<unsigned int>(size, 0, 29, seed_value);
+            const std::vector<value_type> input
+                = test_utils::get_random_data<value_type>(size, -100, 100, seed_value + 1);
+            std::vector<flag_type>    flags(size);
+            std::vector<unsigned int> packed_flags(size / 32 + 1, 0);
+            for(size_t i = 0; i < size; i++)
+            {
+                flags[i] = random[i] == 0 ? 1 : 0;
+                packed_flags[i / 32] |= static_cast<unsigned int>(flags[i]) << (i % 32);
+            }
+
+            std::vector<value_type> inclusive_expected(size);
+            std::vector<value_type> exclusive_expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                const bool head       = i == 0 || flags[i];
+                inclusive_expected[i] = head ? input[i] : inclusive_expected[i - 1] + input[i];
+                exclusive_expected[i]
+                    = head ? initial_value : exclusive_expected[i - 1] + input[i - 1];
+            }
+
+            flag_type*    d_flags;
+            unsigned int* d_packed_flags;
+            value_type*   d_input;
+            value_type*   d_output;
+            const size_t  allocated = std::max<size_t>(size, 1);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_flags, allocated * sizeof(flag_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_packed_flags,
+                                                         packed_flags.size()
+                                                             * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, allocated * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_output, allocated * sizeof(value_type)));
+            HIP_CHECK(
+                hipMemcpy(d_flags, flags.data(), size * sizeof(flag_type), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_packed_flags,
+                                packed_flags.data(),
+                                packed_flags.size() * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(value_type), hipMemcpyHostToDevice));
+
+            const auto d_bit_flags = rocprim::make_packed_bits_iterator<1>(d_packed_flags);
+
+            size_t inclusive_bytes;
+            size_t exclusive_bytes;
+            HIP_CHECK(rocprim::inclusive_scan_by_head_flags(nullptr,
+                                                            inclusive_bytes,
+                                                            d_bit_flags,
+                                                            d_input,
+                                                            d_output,
+                                                            size,
+                                                            rocprim::plus<value_type>(),
+                                                            stream,
+                                                            debug_synchronous));
+            HIP_CHECK(rocprim::exclusive_scan_by_head_flags(nullptr,
+                                                            exclusive_bytes,
+                                                            d_flags,
+                                                            d_input,
+                                                            d_output,
+                                                            initial_value,
+                                                            size,
+                                                            rocprim::plus<value_type>(),
+                                                            stream,
+                                                            debug_synchronous));
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage,
+                                                         std::max(inclusive_bytes,
+                                                                  exclusive_bytes)));
+
+            std::vector<value_type> output(size);
+
+            HIP_CHECK(rocprim::inclusive_scan_by_head_flags(d_temp_storage,
+                                                            inclusive_bytes,
+                                                            d_bit_flags,
+                                                            d_input,
+                                                            d_output,
+                                                            size,
+                                                            rocprim::plus<value_type>(),
+                                                            stream,
+                                                            debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, inclusive_expected));
+
+            HIP_CHECK(rocprim::exclusive_scan_by_head_flags(d_temp_storage,
+                                                            exclusive_bytes,
+                                                            d_flags,
+                                                            d_input,
+                                                            d_output,
+                                                            initial_value,
+                                                            size,
+                                                            rocprim::plus<value_type>(),
+                                                            stream,
+                                                            debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, exclusive_expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_flags));
+            HIP_CHECK(hipFree(d_packed_flags));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+// The second scan starts with the total of the first one, read through a future_value
+TEST(RocprimDeviceScanTests, InclusiveExclusiveScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using value_type = unsigned int;
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+    const value_type  initial_value     = 7;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<value_type> input
+                = test_utils::get_random_data<value_type>(size, 0, 100, seed_value);
+
+            // Both scans of the same input, the second one continues the first one
+            std::vector<value_type> exclusive_expected(2 * size);
+            std::vector<value_type> inclusive_expected(2 * size);
+            value_type              running = initial_value;
+            for(size_t i = 0; i < 2 * size; i++)
+            {
+                exclusive_expected[i] = running;
+                running += input[i % size];
+                inclusive_expected[i] = running;
+            }
+
+            value_type*  d_input;
+            value_type*  d_exclusive_output;
+            value_type*  d_inclusive_output;
+            value_type*  d_totals;
+            const size_t allocated = std::max<size_t>(2 * size, 1);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, allocated * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_exclusive_output,
+                                                         allocated * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_inclusive_output,
+                                                         allocated * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_totals, 2 * sizeof(value_type)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(value_type), hipMemcpyHostToDevice));
+
+            const auto future_total = rocprim::future_value<value_type>{d_totals};
+
+            size_t first_bytes;
+            size_t second_bytes;
+            HIP_CHECK(rocprim::inclusive_exclusive_scan(nullptr,
+                                                        first_bytes,
+                                                        d_input,
+                                                        d_exclusive_output,
+                                                        d_inclusive_output,
+                                                        d_totals,
+                                                        initial_value,
+                                                        size,
+                                                        rocprim::plus<value_type>(),
+                                                        stream,
+                                                        debug_synchronous));
+            HIP_CHECK(rocprim::inclusive_exclusive_scan(nullptr,
+                                                        second_bytes,
+                                                        d_input,
+                                                        d_exclusive_output + size,
+                                                        d_inclusive_output + size,
+                                                        d_totals + 1,
+                                                        future_total,
+                                                        size,
+                                                        rocprim::plus<value_type>(),
+                                                        stream,
+                                                        debug_synchronous));
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage,
+                                                         std::max(first_bytes, second_bytes)));
+
+            HIP_CHECK(rocprim::inclusive_exclusive_scan(d_temp_storage,
+                                                        first_bytes,
+                                                        d_input,
+                                                        d_exclusive_output,
+                                                        d_inclusive_output,
+                                                        d_totals,
+                                                        initial_value,
+                                                        size,
+                                                        rocprim::plus<value_type>(),
+                                                        stream,
+                                                        debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(rocprim::inclusive_exclusive_scan(d_temp_storage,
+                                                        second_bytes,
+                                                        d_input,
+                                                        d_exclusive_output + size,
+                                                        d_inclusive_output + size,
+                                                        d_totals + 1,
+                                                        future_total,
+                                                        size,
+                                                        rocprim::plus<value_type>(),
+                                                        stream,
+                                                        debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<value_type> exclusive_output(2 * size);
+            std::vector<value_type> inclusive_output(2 * size);
+            value_type              totals[2];
+            HIP_CHECK(hipMemcpy(exclusive_output.data(),
+                                d_exclusive_output,
+                                2 * size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(inclusive_output.data(),
+                                d_inclusive_output,
+                                2 * size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(totals, d_totals, sizeof(totals), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(exclusive_output, exclusive_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(inclusive_output, inclusive_expected));
+            ASSERT_EQ(totals[0], size == 0 ? initial_value : inclusive_expected[size - 1]);
+            ASSERT_EQ(totals[1], running);
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_exclusive_output));
+            HIP_CHECK(hipFree(d_inclusive_output));
+            HIP_CHECK(hipFree(d_totals));
+        }
+    }
+}
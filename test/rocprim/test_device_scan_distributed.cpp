@@ -0,0 +1,254 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_scan_distributed.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <numeric>
+#include <vector>
+
+#include <cstddef>
+
+// Boundaries of the shards of an input of `size` elements. Shard 1 is empty when there are
+// at least 3 shards.
+std::vector<size_t> get_shard_boundaries(const size_t size, const unsigned int num_shards)
+{
+    std::vector<size_t> boundaries(num_shards + 1);
+    for(unsigned int s = 0; s <= num_shards; ++s)
+    {
+        boundaries[s] = size * s / num_shards;
+    }
+    if(num_shards >= 3)
+    {
+        boundaries[2] = boundaries[1];
+    }
+    return boundaries;
+}
+
+// All shards live on the same device, each with its own stream, so the tests run on a single
+// GPU. The peer-to-peer transport then performs ordinary device-to-device copies.
+TEST(RocprimDeviceScanDistributedTests, InclusiveScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T          = int;
+    using shard_type = rocprim::scan_distributed_shard<const T*, T*>;
+
+    const bool debug_synchronous = false;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(unsigned int num_shards : {1u, 2u, 3u, 5u})
+            {
+                SCOPED_TRACE(testing::Message() << "with num_shards = " << num_shards);
+
+                const std::vector<T> input
+                    = test_utils::get_random_data<T>(size, -8, 8, seed_value);
+
+                // Calculate expected results on host
+                std::vector<T> expected(size);
+                std::partial_sum(input.begin(), input.end(), expected.begin());
+
+                const std::vector<size_t> boundaries = get_shard_boundaries(size, num_shards);
+                std::vector<shard_type>   shards(num_shards);
+                for(unsigned int s = 0; s < num_shards; ++s)
+                {
+                    shard_type& shard = shards[s];
+                    shard             = {};
+                    shard.device      = device_id;
+                    shard.size        = boundaries[s + 1] - boundaries[s];
+                    HIP_CHECK(hipStreamCreateWithFlags(&shard.stream, hipStreamNonBlocking));
+
+                    T* d_input;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(
+                        &d_input,
+                        std::max<size_t>(shard.size, 1) * sizeof(T)));
+                    HIP_CHECK(hipMemcpy(d_input,
+                                        input.data() + boundaries[s],
+                                        shard.size * sizeof(T),
+                                        hipMemcpyHostToDevice));
+                    shard.input = d_input;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(
+                        &shard.output,
+                        std::max<size_t>(shard.size, 1) * sizeof(T)));
+                }
+
+                // Get the size of the temporary storage of every shard
+                HIP_CHECK(rocprim::inclusive_scan_distributed(shards.data(),
+                                                              num_shards,
+                                                              rocprim::plus<T>(),
+                                                              rocprim::radix_sort_peer_transport(),
+                                                              debug_synchronous));
+
+                for(shard_type& shard : shards)
+                {
+                    ASSERT_GT(shard.storage_size, 0);
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&shard.temporary_storage,
+                                                                 shard.storage_size));
+                }
+
+                // Scan twice to check that the storage can be reused
+                for(unsigned int run = 0; run < 2; ++run)
+                {
+                    HIP_CHECK(
+                        rocprim::inclusive_scan_distributed(shards.data(),
+                                                            num_shards,
+                                                            rocprim::plus<T>(),
+                                                            rocprim::radix_sort_peer_transport(),
+                                                            debug_synchronous));
+                }
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                // The shards hold consecutive slices of the scanned sequence
+                std::vector<T> output(size);
+                for(unsigned int s = 0; s < num_shards; ++s)
+                {
+                    HIP_CHECK(hipMemcpy(output.data() + boundaries[s],
+                                        shards[s].output,
+                                        shards[s].size * sizeof(T),
+                                        hipMemcpyDeviceToHost));
+                }
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+                for(shard_type& shard : shards)
+                {
+                    HIP_CHECK(hipFree(const_cast<T*>(shard.input)));
+                    HIP_CHECK(hipFree(shard.output));
+                    HIP_CHECK(hipFree(shard.temporary_storage));
+                    HIP_CHECK(hipStreamDestroy(shard.stream));
+                }
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceScanDistributedTests, Reduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T          = int;
+    using shard_type = rocprim::reduce_distributed_shard<const T*>;
+
+    const bool debug_synchronous = false;
+    const T    initial_value     = 5;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            for(unsigned int num_shards : {1u, 2u, 3u, 5u})
+            {
+                SCOPED_TRACE(testing::Message() << "with num_shards = " << num_shards);
+
+                const std::vector<T> input
+                    = test_utils::get_random_data<T>(size, -8, 8, seed_value);
+                const T expected = std::accumulate(input.begin(), input.end(), initial_value);
+
+                const std::vector<size_t> boundaries = get_shard_boundaries(size, num_shards);
+                std::vector<shard_type>   shards(num_shards);
+                for(unsigned int s = 0; s < num_shards; ++s)
+                {
+                    shard_type& shard = shards[s];
+                    shard             = {};
+                    shard.device      = device_id;
+                    shard.size        = boundaries[s + 1] - boundaries[s];
+                    HIP_CHECK(hipStreamCreateWithFlags(&shard.stream, hipStreamNonBlocking));
+
+                    T* d_input;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(
+                        &d_input,
+                        std::max<size_t>(shard.size, 1) * sizeof(T)));
+                    HIP_CHECK(hipMemcpy(d_input,
+                                        input.data() + boundaries[s],
+                                        shard.size * sizeof(T),
+                                        hipMemcpyHostToDevice));
+                    shard.input = d_input;
+                }
+                T* d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+
+                // Get the size of the temporary storage of every shard
+                HIP_CHECK(rocprim::reduce_distributed(shards.data(),
+                                                      num_shards,
+                                                      d_output,
+                                                      initial_value,
+                                                      rocprim::plus<T>(),
+                                                      rocprim::radix_sort_peer_transport(),
+                                                      debug_synchronous));
+
+                for(shard_type& shard : shards)
+                {
+                    ASSERT_GT(shard.storage_size, 0);
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&shard.temporary_storage,
+                                                                 shard.storage_size));
+                }
+
+                HIP_CHECK(rocprim::reduce_distributed(shards.data(),
+                                                      num_shards,
+                                                      d_output,
+                                                      initial_value,
+                                                      rocprim::plus<T>(),
+                                                      rocprim::radix_sort_peer_transport(),
+                                                      debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                T output;
+                HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, expected);
+
+                for(shard_type& shard : shards)
+                {
+                    HIP_CHECK(hipFree(const_cast<T*>(shard.input)));
+                    HIP_CHECK(hipFree(shard.temporary_storage));
+                    HIP_CHECK(hipStreamDestroy(shard.stream));
+                }
+                HIP_CHECK(hipFree(d_output));
+            }
+        }
+    }
+}
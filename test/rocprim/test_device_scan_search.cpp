@@ -0,0 +1,162 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_scan_search.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <cstddef>
+
+template<class Params>
+class RocprimDeviceScanSearchTests : public ::testing::Test
+{
+public:
+    using weight_type = Params;
+};
+
+// Integer weights, so that the prefix sums of doubles are exact
+using RocprimDeviceScanSearchTestsParams = ::testing::Types<unsigned int, long long, double>;
+
+TYPED_TEST_SUITE(RocprimDeviceScanSearchTests, RocprimDeviceScanSearchTestsParams);
+
+TYPED_TEST(RocprimDeviceScanSearchTests, ScanLowerBound)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using weight_type = typename TestFixture::weight_type;
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Zero weights give runs of equal prefix sums
+            const std::vector<int> random
+                = test_utils::get_random_data<int>(size, 0, 9, seed_value);
+            std::vector<weight_type> weights(size);
+            std::vector<weight_type> prefix_sums(size);
+            weight_type              total{};
+            for(size_t i = 0; i < size; i++)
+            {
+                weights[i]     = static_cast<weight_type>(std::max(random[i] - 3, 0));
+                total          = total + weights[i];
+                prefix_sums[i] = total;
+            }
+
+            // The thresholds cover the range of the prefix sums and a bit more
+            const size_t thresholds_size = 1000;
+            const std::vector<long long> random_thresholds
+                = test_utils::get_random_data<long long>(thresholds_size,
+                                                         0,
+                                                         static_cast<long long>(total) + 2,
+                                                         seed_value + 1);
+            std::vector<weight_type> thresholds(thresholds_size);
+            std::vector<size_t>      expected(thresholds_size);
+            for(size_t i = 0; i < thresholds_size; i++)
+            {
+                thresholds[i] = static_cast<weight_type>(random_thresholds[i]);
+                expected[i]   = std::lower_bound(prefix_sums.begin(),
+                                               prefix_sums.end(),
+                                               thresholds[i])
+                              - prefix_sums.begin();
+            }
+
+            weight_type* d_weights;
+            weight_type* d_thresholds;
+            size_t*      d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_weights,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(weight_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_thresholds,
+                                                         thresholds_size * sizeof(weight_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         thresholds_size * sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_weights,
+                                weights.data(),
+                                size * sizeof(weight_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_thresholds,
+                                thresholds.data(),
+                                thresholds_size * sizeof(weight_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::scan_lower_bound(nullptr,
+                                                temporary_storage_bytes,
+                                                d_weights,
+                                                d_thresholds,
+                                                d_output,
+                                                size,
+                                                thresholds_size,
+                                                rocprim::less<>(),
+                                                stream,
+                                                debug_synchronous));
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::scan_lower_bound(d_temporary_storage,
+                                                temporary_storage_bytes,
+                                                d_weights,
+                                                d_thresholds,
+                                                d_output,
+                                                size,
+                                                thresholds_size,
+                                                rocprim::less<>(),
+                                                stream,
+                                                debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<size_t> output(thresholds_size);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                thresholds_size * sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_weights));
+            HIP_CHECK(hipFree(d_thresholds));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
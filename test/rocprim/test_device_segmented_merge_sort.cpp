@@ -0,0 +1,413 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_segmented_merge_sort.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+template<class Key,
+         class Value,
+         class CompareFunction,
+         unsigned int MinSegmentLength,
+         unsigned int MaxSegmentLength,
+         class Config = rocprim::default_config>
+struct SegmentedMergeSortParams
+{
+    using key_type                                   = Key;
+    using value_type                                 = Value;
+    using compare_function                           = CompareFunction;
+    static constexpr unsigned int min_segment_length = MinSegmentLength;
+    static constexpr unsigned int max_segment_length = MaxSegmentLength;
+    using config                                     = Config;
+};
+
+// Orders by x ascending, then by y descending
+struct custom_lexicographic_compare
+{
+    using key_type = test_utils::custom_test_type<int>;
+
+    ROCPRIM_HOST_DEVICE
+    bool operator()(const key_type& a, const key_type& b) const
+    {
+        return a.x != b.x ? a.x < b.x : a.y > b.y;
+    }
+};
+
+template<class Params>
+class RocprimDeviceSegmentedMergeSort : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using custom_int2 = test_utils::custom_test_type<int>;
+
+typedef ::testing::Types<
+    // Only small and medium segments, sorted by warps
+    SegmentedMergeSortParams<int, int, rocprim::less<int>, 0, 300>,
+    SegmentedMergeSortParams<float, int, rocprim::greater<float>, 1, 40>,
+    // Segments of several tiles, sorted and merged by blocks
+    SegmentedMergeSortParams<int, unsigned char, rocprim::less<int>, 1000, 30000>,
+    SegmentedMergeSortParams<custom_int2, int, custom_lexicographic_compare, 0, 5000>,
+    SegmentedMergeSortParams<unsigned short,
+                             rocprim::empty_type,
+                             rocprim::less<unsigned short>,
+                             0,
+                             10000,
+                             rocprim::segmented_merge_sort_config<128, 4>>>
+    Params;
+
+TYPED_TEST_SUITE(RocprimDeviceSegmentedMergeSort, Params);
+
+template<class Key>
+std::vector<Key> generate_segmented_merge_sort_keys(size_t size, unsigned int seed_value)
+{
+    // Few distinct keys, so that the stability is tested
+    return test_utils::get_random_data<Key>(size, 0, 16, seed_value);
+}
+
+template<>
+std::vector<custom_int2> generate_segmented_merge_sort_keys(size_t size, unsigned int seed_value)
+{
+    const std::vector<int> x = test_utils::get_random_data<int>(size, 0, 4, seed_value);
+    const std::vector<int> y = test_utils::get_random_data<int>(size, 0, 4, seed_value + 1);
+
+    std::vector<custom_int2> keys(size);
+    for(size_t i = 0; i < size; ++i)
+    {
+        keys[i] = custom_int2(x[i], y[i]);
+    }
+    return keys;
+}
+
+template<class Value>
+std::vector<Value> generate_segmented_merge_sort_values(size_t size)
+{
+    // The values record the input position of the keys
+    std::vector<Value> values(size);
+    for(size_t i = 0; i < size; ++i)
+    {
+        values[i] = static_cast<Value>(i);
+    }
+    return values;
+}
+
+TYPED_TEST(RocprimDeviceSegmentedMergeSort, SortKeys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type         = typename TestFixture::params::key_type;
+    using compare_function = typename TestFixture::params::compare_function;
+    using config           = typename TestFixture::params::config;
+    using offset_type      = unsigned int;
+
+    const bool  debug_synchronous = false;
+    hipStream_t stream            = 0;
+
+    std::random_device                          rd;
+    std::default_random_engine                  gen(rd());
+    std::uniform_int_distribution<unsigned int> segment_length_dis(
+        TestFixture::params::min_segment_length,
+        TestFixture::params::max_segment_length);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<key_type> keys_input
+                = generate_segmented_merge_sort_keys<key_type>(size, seed_value);
+
+            std::vector<offset_type> offsets;
+            unsigned int             segments_count = 0;
+            size_t                   offset         = 0;
+            while(offset < size)
+            {
+                offsets.push_back(offset);
+                segments_count++;
+                offset += segment_length_dis(gen);
+            }
+            offsets.push_back(size);
+
+            std::vector<key_type> expected(keys_input);
+            for(unsigned int i = 0; i < segments_count; ++i)
+            {
+                std::stable_sort(expected.begin() + offsets[i],
+                                 expected.begin() + offsets[i + 1],
+                                 compare_function());
+            }
+
+            key_type*    d_keys_input;
+            key_type*    d_keys_output;
+            offset_type* d_offsets;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(offset_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(rocprim::segmented_merge_sort_keys<config>(nullptr,
+                                                                 temporary_storage_bytes,
+                                                                 d_keys_input,
+                                                                 d_keys_output,
+                                                                 size,
+                                                                 segments_count,
+                                                                 d_offsets,
+                                                                 d_offsets + 1,
+                                                                 compare_function(),
+                                                                 stream,
+                                                                 debug_synchronous));
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::segmented_merge_sort_keys<config>(d_temporary_storage,
+                                                                 temporary_storage_bytes,
+                                                                 d_keys_input,
+                                                                 d_keys_output,
+                                                                 size,
+                                                                 segments_count,
+                                                                 d_offsets,
+                                                                 d_offsets + 1,
+                                                                 compare_function(),
+                                                                 stream,
+                                                                 debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<key_type> keys_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_offsets));
+
+            // The keys are equal to the ones of a stable sort, even if their order is not
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected));
+        }
+    }
+}
+
+template<class Params, class Value = typename Params::value_type>
+struct segmented_stable_merge_sort_pairs_test
+{
+    static void run()
+    {
+        using key_type         = typename Params::key_type;
+        using value_type       = Value;
+        using compare_function = typename Params::compare_function;
+        using config           = typename Params::config;
+        using offset_type      = unsigned int;
+
+        const bool  debug_synchronous = false;
+        hipStream_t stream            = 0;
+
+        std::random_device                          rd;
+        std::default_random_engine                  gen(rd());
+        std::uniform_int_distribution<unsigned int> segment_length_dis(
+            Params::min_segment_length,
+            Params::max_segment_length);
+
+        for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+        {
+            unsigned int seed_value
+                = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+            SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+            for(size_t size : test_utils::get_sizes(seed_value))
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+                std::vector<key_type> keys_input
+                    = generate_segmented_merge_sort_keys<key_type>(size, seed_value);
+                std::vector<value_type> values_input
+                    = generate_segmented_merge_sort_values<value_type>(size);
+
+                std::vector<offset_type> offsets;
+                unsigned int             segments_count = 0;
+                size_t                   offset         = 0;
+                while(offset < size)
+                {
+                    offsets.push_back(offset);
+                    segments_count++;
+                    offset += segment_length_dis(gen);
+                }
+                offsets.push_back(size);
+
+                // Sort the input positions to build the expected keys and values
+                std::vector<size_t> positions(size);
+                std::iota(positions.begin(), positions.end(), 0);
+                for(unsigned int i = 0; i < segments_count; ++i)
+                {
+                    std::stable_sort(positions.begin() + offsets[i],
+                                     positions.begin() + offsets[i + 1],
+                                     [&](size_t a, size_t b)
+                                     { return compare_function()(keys_input[a], keys_input[b]); });
+                }
+                std::vector<key_type>   keys_expected(size);
+                std::vector<value_type> values_expected(size);
+                for(size_t i = 0; i < size; ++i)
+                {
+                    keys_expected[i]   = keys_input[positions[i]];
+                    values_expected[i] = values_input[positions[i]];
+                }
+
+                key_type*    d_keys_input;
+                key_type*    d_keys_output;
+                value_type*  d_values_input;
+                value_type*  d_values_output;
+                offset_type* d_offsets;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                             size * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                             offsets.size() * sizeof(offset_type)));
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    keys_input.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    size * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_offsets,
+                                    offsets.data(),
+                                    offsets.size() * sizeof(offset_type),
+                                    hipMemcpyHostToDevice));
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(rocprim::segmented_stable_merge_sort_pairs<config>(
+                    nullptr,
+                    temporary_storage_bytes,
+                    d_keys_input,
+                    d_keys_output,
+                    d_values_input,
+                    d_values_output,
+                    size,
+                    segments_count,
+                    d_offsets,
+                    d_offsets + 1,
+                    compare_function(),
+                    stream,
+                    debug_synchronous));
+
+                ASSERT_GT(temporary_storage_bytes, 0);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+
+                HIP_CHECK(rocprim::segmented_stable_merge_sort_pairs<config>(
+                    d_temporary_storage,
+                    temporary_storage_bytes,
+                    d_keys_input,
+                    d_keys_output,
+                    d_values_input,
+                    d_values_output,
+                    size,
+                    segments_count,
+                    d_offsets,
+                    d_offsets + 1,
+                    compare_function(),
+                    stream,
+                    debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                std::vector<key_type>   keys_output(size);
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+                HIP_CHECK(hipFree(d_keys_input));
+                HIP_CHECK(hipFree(d_keys_output));
+                HIP_CHECK(hipFree(d_values_input));
+                HIP_CHECK(hipFree(d_values_output));
+                HIP_CHECK(hipFree(d_offsets));
+
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, keys_expected));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+            }
+        }
+    }
+};
+
+template<class Params>
+struct segmented_stable_merge_sort_pairs_test<Params, rocprim::empty_type>
+{
+    static void run()
+    {
+        // Keys only, covered by SortKeys
+    }
+};
+
+TYPED_TEST(RocprimDeviceSegmentedMergeSort, StableSortPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    segmented_stable_merge_sort_pairs_test<typename TestFixture::params>::run();
+}
@@ -93,6 +93,18 @@ using config_custom
                                                                    256>, //< block size medium
                                            true>; //< enable unpartitioned sort
 
+using config_onesweep_segments
+    = rocprim::segmented_radix_sort_config<4, //< long radix bits
+                                           3, //< short radix bits
+                                           rocprim::kernel_config<256, //< sort block size
+                                                                  4>, //< items per thread
+                                           rocprim::WarpSortConfig<16, //< logical warp size small
+                                                                   4, //< items per thread small
+                                                                   256, //< block size small
+                                                                   0>, //< partitioning threshold
+                                           true, //< enable unpartitioned sort
+                                           4096>; //< onesweep segment threshold
+
 template<class Params>
 class RocprimDeviceSegmentedRadixSort : public ::testing::Test
 {
@@ -102,6 +114,231 @@ public:
 
 TYPED_TEST_SUITE_P(RocprimDeviceSegmentedRadixSort);
 
+// Working around custom_float_test_type, which is both a float and a custom_test_type
+template<class T>
+constexpr bool is_custom_not_float_test_type
+    = test_utils::is_custom_test_type<T>::value
+      && !std::is_same<test_utils::custom_float_type, T>::value;
+
+template<class Config, bool Descending, class Key, class OffsetIterator>
+auto invoke_sort_keys(void*          d_temporary_storage,
+                      size_t&        temporary_storage_bytes,
+                      Key*           d_keys_input,
+                      Key*           d_keys_output,
+                      unsigned int   size,
+                      unsigned int   segments,
+                      OffsetIterator begin_offsets,
+                      OffsetIterator end_offsets,
+                      unsigned int   start_bit,
+                      unsigned int   end_bit,
+                      hipStream_t    stream            = 0,
+                      bool           debug_synchronous = false)
+    -> std::enable_if_t<!is_custom_not_float_test_type<Key>, hipError_t>
+{
+    if(Descending)
+    {
+        return rocprim::segmented_radix_sort_keys_desc<Config>(d_temporary_storage,
+                                                               temporary_storage_bytes,
+                                                               d_keys_input,
+                                                               d_keys_output,
+                                                               size,
+                                                               segments,
+                                                               begin_offsets,
+                                                               end_offsets,
+                                                               start_bit,
+                                                               end_bit,
+                                                               stream,
+                                                               debug_synchronous);
+    }
+    return rocprim::segmented_radix_sort_keys<Config>(d_temporary_storage,
+                                                      temporary_storage_bytes,
+                                                      d_keys_input,
+                                                      d_keys_output,
+                                                      size,
+                                                      segments,
+                                                      begin_offsets,
+                                                      end_offsets,
+                                                      start_bit,
+                                                      end_bit,
+                                                      stream,
+                                                      debug_synchronous);
+}
+
+template<class Config, bool Descending, class Key, class OffsetIterator>
+auto invoke_sort_keys(void*          d_temporary_storage,
+                      size_t&        temporary_storage_bytes,
+                      Key*           d_keys_input,
+                      Key*           d_keys_output,
+                      unsigned int   size,
+                      unsigned int   segments,
+                      OffsetIterator begin_offsets,
+                      OffsetIterator end_offsets,
+                      unsigned int   start_bit,
+                      unsigned int   end_bit,
+                      hipStream_t    stream            = 0,
+                      bool           debug_synchronous = false)
+    -> std::enable_if_t<is_custom_not_float_test_type<Key>, hipError_t>
+{
+    using decomposer_t = test_utils::custom_test_type_decomposer<Key>;
+    // The full bit range is also tested through the default bit arguments
+    if(start_bit == 0 && end_bit == rocprim::detail::decomposer_max_bits<decomposer_t, Key>::value)
+    {
+        if(Descending)
+        {
+            return rocprim::segmented_radix_sort_keys_desc<Config>(d_temporary_storage,
+                                                                   temporary_storage_bytes,
+                                                                   d_keys_input,
+                                                                   d_keys_output,
+                                                                   size,
+                                                                   segments,
+                                                                   begin_offsets,
+                                                                   end_offsets,
+                                                                   decomposer_t{});
+        }
+        return rocprim::segmented_radix_sort_keys<Config>(d_temporary_storage,
+                                                          temporary_storage_bytes,
+                                                          d_keys_input,
+                                                          d_keys_output,
+                                                          size,
+                                                          segments,
+                                                          begin_offsets,
+                                                          end_offsets,
+                                                          decomposer_t{});
+    }
+    if(Descending)
+    {
+        return rocprim::segmented_radix_sort_keys_desc<Config>(d_temporary_storage,
+                                                               temporary_storage_bytes,
+                                                               d_keys_input,
+                                                               d_keys_output,
+                                                               size,
+                                                               segments,
+                                                               begin_offsets,
+                                                               end_offsets,
+                                                               decomposer_t{},
+                                                               start_bit,
+                                                               end_bit,
+                                                               stream,
+                                                               debug_synchronous);
+    }
+    return rocprim::segmented_radix_sort_keys<Config>(d_temporary_storage,
+                                                      temporary_storage_bytes,
+                                                      d_keys_input,
+                                                      d_keys_output,
+                                                      size,
+                                                      segments,
+                                                      begin_offsets,
+                                                      end_offsets,
+                                                      decomposer_t{},
+                                                      start_bit,
+                                                      end_bit,
+                                                      stream,
+                                                      debug_synchronous);
+}
+
+template<class Config, bool Descending, class Key, class Value, class OffsetIterator>
+auto invoke_sort_pairs(void*          d_temporary_storage,
+                       size_t&        temporary_storage_bytes,
+                       Key*           d_keys_input,
+                       Key*           d_keys_output,
+                       Value*         d_values_input,
+                       Value*         d_values_output,
+                       unsigned int   size,
+                       unsigned int   segments,
+                       OffsetIterator begin_offsets,
+                       OffsetIterator end_offsets,
+                       unsigned int   start_bit,
+                       unsigned int   end_bit,
+                       hipStream_t    stream            = 0,
+                       bool           debug_synchronous = false)
+    -> std::enable_if_t<!is_custom_not_float_test_type<Key>, hipError_t>
+{
+    if(Descending)
+    {
+        return rocprim::segmented_radix_sort_pairs_desc<Config>(d_temporary_storage,
+                                                                temporary_storage_bytes,
+                                                                d_keys_input,
+                                                                d_keys_output,
+                                                                d_values_input,
+                                                                d_values_output,
+                                                                size,
+                                                                segments,
+                                                                begin_offsets,
+                                                                end_offsets,
+                                                                start_bit,
+                                                                end_bit,
+                                                                stream,
+                                                                debug_synchronous);
+    }
+    return rocprim::segmented_radix_sort_pairs<Config>(d_temporary_storage,
+                                                       temporary_storage_bytes,
+                                                       d_keys_input,
+                                                       d_keys_output,
+                                                       d_values_input,
+                                                       d_values_output,
+                                                       size,
+                                                       segments,
+                                                       begin_offsets,
+                                                       end_offsets,
+                                                       start_bit,
+                                                       end_bit,
+                                                       stream,
+                                                       debug_synchronous);
+}
+
+template<class Config, bool Descending, class Key, class Value, class OffsetIterator>
+auto invoke_sort_pairs(void*          d_temporary_storage,
+                       size_t&        temporary_storage_bytes,
+                       Key*           d_keys_input,
+                       Key*           d_keys_output,
+                       Value*         d_values_input,
+                       Value*         d_values_output,
+                       unsigned int   size,
+                       unsigned int   segments,
+                       OffsetIterator begin_offsets,
+                       OffsetIterator end_offsets,
+                       unsigned int   start_bit,
+                       unsigned int   end_bit,
+                       hipStream_t    stream            = 0,
+                       bool           debug_synchronous = false)
+    -> std::enable_if_t<is_custom_not_float_test_type<Key>, hipError_t>
+{
+    using decomposer_t = test_utils::custom_test_type_decomposer<Key>;
+    if(Descending)
+    {
+        return rocprim::segmented_radix_sort_pairs_desc<Config>(d_temporary_storage,
+                                                                temporary_storage_bytes,
+                                                                d_keys_input,
+                                                                d_keys_output,
+                                                                d_values_input,
+                                                                d_values_output,
+                                                                size,
+                                                                segments,
+                                                                begin_offsets,
+                                                                end_offsets,
+                                                                decomposer_t{},
+                                                                start_bit,
+                                                                end_bit,
+                                                                stream,
+                                                                debug_synchronous);
+    }
+    return rocprim::segmented_radix_sort_pairs<Config>(d_temporary_storage,
+                                                       temporary_storage_bytes,
+                                                       d_keys_input,
+                                                       d_keys_output,
+                                                       d_values_input,
+                                                       d_values_output,
+                                                       size,
+                                                       segments,
+                                                       begin_offsets,
+                                                       end_offsets,
+                                                       decomposer_t{},
+                                                       start_bit,
+                                                       end_bit,
+                                                       stream,
+                                                       debug_synchronous);
+}
+
 template<typename TestFixture>
 inline void sort_keys()
 {
@@ -186,16 +423,16 @@ inline void sort_keys()
             }
 
             size_t temporary_storage_bytes = 0;
-            HIP_CHECK(rocprim::segmented_radix_sort_keys<config>(nullptr,
-                                                                 temporary_storage_bytes,
-                                                                 d_keys_input,
-                                                                 d_keys_output,
-                                                                 size,
-                                                                 segments_count,
-                                                                 d_offsets,
-                                                                 d_offsets + 1,
-                                                                 start_bit,
-                                                                 end_bit));
+            HIP_CHECK((invoke_sort_keys<config, descending>(nullptr,
+                                                            temporary_storage_bytes,
+                                                            d_keys_input,
+                                                            d_keys_output,
+                                                            size,
+                                                            segments_count,
+                                                            d_offsets,
+                                                            d_offsets + 1,
+                                                            start_bit,
+                                                            end_bit)));
 
             ASSERT_GT(temporary_storage_bytes, 0U);
 
@@ -203,36 +440,18 @@ inline void sort_keys()
             HIP_CHECK(
                 test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
 
-            if(descending)
-            {
-                HIP_CHECK(rocprim::segmented_radix_sort_keys_desc<config>(d_temporary_storage,
-                                                                          temporary_storage_bytes,
-                                                                          d_keys_input,
-                                                                          d_keys_output,
-                                                                          size,
-                                                                          segments_count,
-                                                                          d_offsets,
-                                                                          d_offsets + 1,
-                                                                          start_bit,
-                                                                          end_bit,
-                                                                          stream,
-                                                                          debug_synchronous));
-            }
-            else
-            {
-                HIP_CHECK(rocprim::segmented_radix_sort_keys<config>(d_temporary_storage,
-                                                                     temporary_storage_bytes,
-                                                                     d_keys_input,
-                                                                     d_keys_output,
-                                                                     size,
-                                                                     segments_count,
-                                                                     d_offsets,
-                                                                     d_offsets + 1,
-                                                                     start_bit,
-                                                                     end_bit,
-                                                                     stream,
-                                                                     debug_synchronous));
-            }
+            HIP_CHECK((invoke_sort_keys<config, descending>(d_temporary_storage,
+                                                            temporary_storage_bytes,
+                                                            d_keys_input,
+                                                            d_keys_output,
+                                                            size,
+                                                            segments_count,
+                                                            d_offsets,
+                                                            d_offsets + 1,
+                                                            start_bit,
+                                                            end_bit,
+                                                            stream,
+                                                            debug_synchronous)));
 
             std::vector<key_type> keys_output(size);
             HIP_CHECK(hipMemcpy(keys_output.data(),
@@ -782,58 +1001,38 @@ inline void sort_pairs()
 
             void*  d_temporary_storage     = nullptr;
             size_t temporary_storage_bytes = 0;
-            HIP_CHECK(rocprim::segmented_radix_sort_pairs<config>(d_temporary_storage,
-                                                                  temporary_storage_bytes,
-                                                                  d_keys_input,
-                                                                  d_keys_output,
-                                                                  d_values_input,
-                                                                  d_values_output,
-                                                                  size,
-                                                                  segments_count,
-                                                                  d_offsets,
-                                                                  d_offsets + 1,
-                                                                  start_bit,
-                                                                  end_bit));
+            HIP_CHECK((invoke_sort_pairs<config, descending>(d_temporary_storage,
+                                                             temporary_storage_bytes,
+                                                             d_keys_input,
+                                                             d_keys_output,
+                                                             d_values_input,
+                                                             d_values_output,
+                                                             size,
+                                                             segments_count,
+                                                             d_offsets,
+                                                             d_offsets + 1,
+                                                             start_bit,
+                                                             end_bit)));
 
             ASSERT_GT(temporary_storage_bytes, 0U);
 
             HIP_CHECK(
                 test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
 
-            if(descending)
-            {
-                HIP_CHECK(rocprim::segmented_radix_sort_pairs_desc<config>(d_temporary_storage,
-                                                                           temporary_storage_bytes,
-                                                                           d_keys_input,
-                                                                           d_keys_output,
-                                                                           d_values_input,
-                                                                           d_values_output,
-                                                                           size,
-                                                                           segments_count,
-                                                                           d_offsets,
-                                                                           d_offsets + 1,
-                                                                           start_bit,
-                                                                           end_bit,
-                                                                           stream,
-                                                                           debug_synchronous));
-            }
-            else
-            {
-                HIP_CHECK(rocprim::segmented_radix_sort_pairs<config>(d_temporary_storage,
-                                                                      temporary_storage_bytes,
-                                                                      d_keys_input,
-                                                                      d_keys_output,
-                                                                      d_values_input,
-                                                                      d_values_output,
-                                                                      size,
-                                                                      segments_count,
-                                                                      d_offsets,
-                                                                      d_offsets + 1,
-                                                                      start_bit,
-                                                                      end_bit,
-                                                                      stream,
-                                                                      debug_synchronous));
-            }
+            HIP_CHECK((invoke_sort_pairs<config, descending>(d_temporary_storage,
+                                                             temporary_storage_bytes,
+                                                             d_keys_input,
+                                                             d_keys_output,
+                                                             d_values_input,
+                                                             d_values_output,
+                                                             size,
+                                                             segments_count,
+                                                             d_offsets,
+                                                             d_offsets + 1,
+                                                             start_bit,
+                                                             end_bit,
+                                                             stream,
+                                                             debug_synchronous)));
 
             std::vector<key_type> keys_output(size);
             HIP_CHECK(hipMemcpy(keys_output.data(),
@@ -0,0 +1,259 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_segmented_radix_sort.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_sort_comparator.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+template<class KeyType,
+         unsigned int MaxSegmentLength,
+         unsigned int StartBit = 0,
+         unsigned int EndBit   = sizeof(KeyType) * 8>
+struct DeviceSegmentedRadixSortDirectionsParams
+{
+    using key_type                                  = KeyType;
+    static constexpr unsigned int max_segment_length = MaxSegmentLength;
+    static constexpr unsigned int start_bit          = StartBit;
+    static constexpr unsigned int end_bit            = EndBit;
+};
+
+template<class Params>
+class RocprimDeviceSegmentedRadixSortDirectionsTests : public ::testing::Test
+{
+public:
+    using key_type                                   = typename Params::key_type;
+    static constexpr unsigned int max_segment_length = Params::max_segment_length;
+    static constexpr unsigned int start_bit          = Params::start_bit;
+    static constexpr unsigned int end_bit            = Params::end_bit;
+    const bool                    debug_synchronous  = false;
+};
+
+using RocprimDeviceSegmentedRadixSortDirectionsTestsParams
+    = ::testing::Types<DeviceSegmentedRadixSortDirectionsParams<int, 100>,
+                       DeviceSegmentedRadixSortDirectionsParams<unsigned int, 5000>,
+                       DeviceSegmentedRadixSortDirectionsParams<float, 3000>,
+                       DeviceSegmentedRadixSortDirectionsParams<unsigned short, 1000, 4, 12>,
+                       DeviceSegmentedRadixSortDirectionsParams<long long, 200000, 8, 40>,
+                       DeviceSegmentedRadixSortDirectionsParams<int8_t, 300>>;
+
+TYPED_TEST_SUITE(RocprimDeviceSegmentedRadixSortDirectionsTests,
+                 RocprimDeviceSegmentedRadixSortDirectionsTestsParams);
+
+TYPED_TEST(RocprimDeviceSegmentedRadixSortDirectionsTests, SortPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                           = typename TestFixture::key_type;
+    using value_type                         = unsigned int;
+    using offset_type                        = unsigned int;
+    constexpr unsigned int start_bit         = TestFixture::start_bit;
+    constexpr unsigned int end_bit           = TestFixture::end_bit;
+    const bool             debug_synchronous = TestFixture::debug_synchronous;
+
+    const hipStream_t stream = 0; // default
+
+    using ascending_comparator
+        = test_utils::key_value_comparator<key_type, value_type, false, start_bit, end_bit>;
+    using descending_comparator
+        = test_utils::key_value_comparator<key_type, value_type, true, start_bit, end_bit>;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::default_random_engine            gen(seed_value);
+        std::uniform_int_distribution<size_t> segment_length_dis(0,
+                                                                 TestFixture::max_segment_length);
+        std::bernoulli_distribution           direction_dis(0.5);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<key_type> keys_input = test_utils::get_random_data<key_type>(
+                size,
+                test_utils::generate_limits<key_type>::min(),
+                test_utils::generate_limits<key_type>::max(),
+                seed_value);
+            std::vector<value_type> values_input(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                values_input[i] = static_cast<value_type>(i);
+            }
+
+            std::vector<offset_type>   offsets;
+            std::vector<unsigned char> descending;
+            size_t                     offset = 0;
+            while(offset < size)
+            {
+                offsets.push_back(offset);
+                descending.push_back(direction_dis(gen));
+                offset += segment_length_dis(gen);
+            }
+            offsets.push_back(size);
+            const unsigned int segments = static_cast<unsigned int>(descending.size());
+
+            using key_value = std::pair<key_type, value_type>;
+            std::vector<key_value> expected(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                expected[i] = key_value(keys_input[i], values_input[i]);
+            }
+            for(unsigned int i = 0; i < segments; ++i)
+            {
+                const auto first = expected.begin() + offsets[i];
+                const auto last  = expected.begin() + offsets[i + 1];
+                if(descending[i])
+                {
+                    std::stable_sort(first, last, descending_comparator());
+                }
+                else
+                {
+                    std::stable_sort(first, last, ascending_comparator());
+                }
+            }
+
+            key_type*      d_keys_input;
+            key_type*      d_keys_output;
+            value_type*    d_values_input;
+            value_type*    d_values_output;
+            offset_type*   d_offsets;
+            unsigned char* d_descending;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(offset_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_descending,
+                                                         std::max<size_t>(segments, 1)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_descending, descending.data(), segments, hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(rocprim::segmented_radix_sort_pairs_with_directions(d_temp_storage,
+                                                                          temp_storage_size_bytes,
+                                                                          d_keys_input,
+                                                                          d_keys_output,
+                                                                          d_values_input,
+                                                                          d_values_output,
+                                                                          size,
+                                                                          segments,
+                                                                          d_offsets,
+                                                                          d_offsets + 1,
+                                                                          d_descending,
+                                                                          start_bit,
+                                                                          end_bit,
+                                                                          stream,
+                                                                          debug_synchronous));
+
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(rocprim::segmented_radix_sort_pairs_with_directions(d_temp_storage,
+                                                                          temp_storage_size_bytes,
+                                                                          d_keys_input,
+                                                                          d_keys_output,
+                                                                          d_values_input,
+                                                                          d_values_output,
+                                                                          size,
+                                                                          segments,
+                                                                          d_offsets,
+                                                                          d_offsets + 1,
+                                                                          d_descending,
+                                                                          start_bit,
+                                                                          end_bit,
+                                                                          stream,
+                                                                          debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<key_type>   keys_output(size);
+            std::vector<value_type> values_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            std::vector<key_type>   expected_keys(size);
+            std::vector<value_type> expected_values(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                expected_keys[i]   = expected[i].first;
+                expected_values[i] = expected[i].second;
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, expected_values));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_descending));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
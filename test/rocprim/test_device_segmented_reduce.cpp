@@ -23,6 +23,8 @@
 #include "../common_test_header.hpp"
 
 // required rocprim headers
+#include <rocprim/device/device_arg_reduce.hpp>
+#include <rocprim/device/device_multi_reduce.hpp>
 #include <rocprim/device/device_segmented_reduce.hpp>
 #include <rocprim/iterator/counting_iterator.hpp>
 
@@ -30,6 +32,7 @@
 #include "test_utils_types.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <random>
 #include <vector>
@@ -477,3 +480,361 @@ TEST(RocprimDeviceSegmentedReduce, LargeIndicesWithGraphs)
 {
     testLargeIndices<true>();
 }
+
+// Composition of affine maps x -> a * x + b, which is associative but not commutative
+struct affine_map
+{
+    unsigned int a;
+    unsigned int b;
+};
+
+struct compose_affine_maps
+{
+    ROCPRIM_HOST_DEVICE
+    affine_map operator()(const affine_map& f, const affine_map& g) const
+    {
+        return affine_map{f.a * g.a, f.b * g.a + g.b};
+    }
+};
+
+TEST(RocprimDeviceSegmentedReduce, ReduceBalanced)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // Small tiles, so that many segments span several tiles
+    using Config      = rocprim::reduce_config<64, 4>;
+    using T           = affine_map;
+    using offset_type = unsigned int;
+
+    const compose_affine_maps reduce_op;
+    const T                   init{1, 0};
+    const bool                debug_synchronous = false;
+    const hipStream_t         stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::default_random_engine gen(seed_value);
+        // Mostly empty and short segments, and a few long ones
+        std::uniform_int_distribution<size_t> short_length_dis(0, 3);
+        std::uniform_int_distribution<size_t> long_length_dis(0, 20000);
+        std::bernoulli_distribution           long_segment_dis(0.05);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<unsigned int> a
+                = test_utils::get_random_data<unsigned int>(size, 0, 1000, seed_value);
+            const std::vector<unsigned int> b
+                = test_utils::get_random_data<unsigned int>(size, 0, 1000, seed_value + 1);
+            std::vector<T> input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                input[i] = T{a[i], b[i]};
+            }
+
+            // Values before the first segment and after the last one are not reduced
+            const size_t first_offset = std::min<size_t>(size, 5);
+            const size_t last_offset  = size - std::min<size_t>(size - first_offset, 7);
+
+            std::vector<offset_type> offsets;
+            std::vector<T>           expected;
+            size_t                   offset = first_offset;
+            do
+            {
+                offsets.push_back(offset);
+                const size_t length
+                    = long_segment_dis(gen) ? long_length_dis(gen) : short_length_dis(gen);
+                const size_t end = std::min(last_offset, offset + length);
+
+                T aggregate = init;
+                for(size_t i = offset; i < end; i++)
+                {
+                    aggregate = reduce_op(aggregate, input[i]);
+                }
+                expected.push_back(aggregate);
+                offset = end;
+            }
+            while(offset < last_offset);
+            offsets.push_back(offset);
+            const unsigned int segments = static_cast<unsigned int>(expected.size());
+
+            T*           d_input;
+            offset_type* d_offsets;
+            T*           d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(offset_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, segments * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(rocprim::segmented_reduce_balanced<Config>(nullptr,
+                                                                 temporary_storage_bytes,
+                                                                 d_input,
+                                                                 d_output,
+                                                                 size,
+                                                                 segments,
+                                                                 d_offsets,
+                                                                 reduce_op,
+                                                                 init,
+                                                                 stream,
+                                                                 debug_synchronous));
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::segmented_reduce_balanced<Config>(d_temporary_storage,
+                                                                 temporary_storage_bytes,
+                                                                 d_input,
+                                                                 d_output,
+                                                                 size,
+                                                                 segments,
+                                                                 d_offsets,
+                                                                 reduce_op,
+                                                                 init,
+                                                                 stream,
+                                                                 debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(segments);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, segments * sizeof(T), hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_output));
+
+            for(unsigned int i = 0; i < segments; i++)
+            {
+                SCOPED_TRACE(testing::Message() << "with segment = " << i);
+                ASSERT_EQ(output[i].a, expected[i].a);
+                ASSERT_EQ(output[i].b, expected[i].b);
+            }
+        }
+    }
+}
+
+template<class T>
+void run_segmented_statistics_test()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using Config          = rocprim::reduce_config<64, 4>;
+    using offset_type     = unsigned int;
+    using pair_type       = rocprim::key_value_pair<std::ptrdiff_t, T>;
+    using statistics_type = rocprim::reduce_statistics<double>;
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::default_random_engine gen(seed_value);
+        // Mostly empty and short segments, and a few long ones
+        std::uniform_int_distribution<size_t> short_length_dis(0, 3);
+        std::uniform_int_distribution<size_t> long_length_dis(0, 20000);
+        std::bernoulli_distribution           long_segment_dis(0.05);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Small integers have many ties and exact sums
+            std::vector<T> input = test_utils::get_random_data<T>(size, -50, 50, seed_value);
+            for(T& value : input)
+            {
+                value = static_cast<T>(std::round(static_cast<double>(value)));
+            }
+
+            std::vector<offset_type>     offsets;
+            std::vector<pair_type>       expected_min;
+            std::vector<pair_type>       expected_max;
+            std::vector<statistics_type> expected_statistics;
+            size_t                       offset = 0;
+            do
+            {
+                offsets.push_back(offset);
+                const size_t length
+                    = long_segment_dis(gen) ? long_length_dis(gen) : short_length_dis(gen);
+                const size_t end = std::min(size, offset + length);
+
+                pair_type       min_pair(-1, T());
+                pair_type       max_pair(-1, T());
+                statistics_type statistics;
+                if(offset < end)
+                {
+                    const auto first  = input.begin() + offset;
+                    const auto last   = input.begin() + end;
+                    const auto min_it = std::min_element(first, last);
+                    const auto max_it = std::max_element(first, last);
+                    min_pair          = pair_type(min_it - input.begin(), *min_it);
+                    max_pair          = pair_type(max_it - input.begin(), *max_it);
+                }
+                for(size_t i = offset; i < end; i++)
+                {
+                    statistics = rocprim::reduce_statistics_plus<double>()(
+                        statistics,
+                        statistics_type(static_cast<double>(input[i])));
+                }
+                expected_min.push_back(min_pair);
+                expected_max.push_back(max_pair);
+                expected_statistics.push_back(statistics);
+                offset = end;
+            }
+            while(offset < size);
+            offsets.push_back(offset);
+            const unsigned int segments = static_cast<unsigned int>(expected_min.size());
+
+            T*               d_input;
+            offset_type*     d_offsets;
+            pair_type*       d_pairs;
+            statistics_type* d_statistics;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(offset_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_pairs, 2 * segments * sizeof(pair_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_statistics,
+                                                         segments * sizeof(statistics_type)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            size_t min_storage_bytes;
+            size_t max_storage_bytes;
+            size_t statistics_storage_bytes;
+            HIP_CHECK(rocprim::segmented_argmin<Config>(nullptr,
+                                                        min_storage_bytes,
+                                                        d_input,
+                                                        d_pairs,
+                                                        size,
+                                                        segments,
+                                                        d_offsets,
+                                                        stream,
+                                                        debug_synchronous));
+            HIP_CHECK(rocprim::segmented_argmax<Config>(nullptr,
+                                                        max_storage_bytes,
+                                                        d_input,
+                                                        d_pairs + segments,
+                                                        size,
+                                                        segments,
+                                                        d_offsets,
+                                                        stream,
+                                                        debug_synchronous));
+            HIP_CHECK(rocprim::segmented_multi_reduce<Config>(nullptr,
+                                                              statistics_storage_bytes,
+                                                              d_input,
+                                                              d_statistics,
+                                                              size,
+                                                              segments,
+                                                              d_offsets,
+                                                              stream,
+                                                              debug_synchronous));
+
+            size_t temporary_storage_bytes
+                = std::max({min_storage_bytes, max_storage_bytes, statistics_storage_bytes});
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::segmented_argmin<Config>(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_input,
+                                                        d_pairs,
+                                                        size,
+                                                        segments,
+                                                        d_offsets,
+                                                        stream,
+                                                        debug_synchronous));
+            HIP_CHECK(rocprim::segmented_argmax<Config>(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_input,
+                                                        d_pairs + segments,
+                                                        size,
+                                                        segments,
+                                                        d_offsets,
+                                                        stream,
+                                                        debug_synchronous));
+            HIP_CHECK(rocprim::segmented_multi_reduce<Config>(d_temporary_storage,
+                                                              temporary_storage_bytes,
+                                                              d_input,
+                                                              d_statistics,
+                                                              size,
+                                                              segments,
+                                                              d_offsets,
+                                                              stream,
+                                                              debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<pair_type>       pairs(2 * segments);
+            std::vector<statistics_type> statistics(segments);
+            HIP_CHECK(hipMemcpy(pairs.data(),
+                                d_pairs,
+                                pairs.size() * sizeof(pair_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(statistics.data(),
+                                d_statistics,
+                                statistics.size() * sizeof(statistics_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_pairs));
+            HIP_CHECK(hipFree(d_statistics));
+
+            for(unsigned int i = 0; i < segments; i++)
+            {
+                SCOPED_TRACE(testing::Message() << "with segment = " << i);
+                ASSERT_EQ(pairs[i].key, expected_min[i].key);
+                ASSERT_EQ(pairs[segments + i].key, expected_max[i].key);
+                ASSERT_EQ(statistics[i].count, expected_statistics[i].count);
+                if(expected_statistics[i].count > 0)
+                {
+                    ASSERT_EQ(pairs[i].value, expected_min[i].value);
+                    ASSERT_EQ(pairs[segments + i].value, expected_max[i].value);
+                    ASSERT_EQ(statistics[i].minimum, expected_statistics[i].minimum);
+                    ASSERT_EQ(statistics[i].maximum, expected_statistics[i].maximum);
+                    ASSERT_EQ(statistics[i].sum, expected_statistics[i].sum);
+                    ASSERT_EQ(statistics[i].sum_of_squares, expected_statistics[i].sum_of_squares);
+                }
+            }
+        }
+    }
+}
+
+// The values are reduced as packed 64-bit words
+TEST(RocprimDeviceSegmentedReduce, StatisticsBalancedPacked)
+{
+    run_segmented_statistics_test<short>();
+}
+
+// The values are reduced as pairs
+TEST(RocprimDeviceSegmentedReduce, StatisticsBalancedPairs)
+{
+    run_segmented_statistics_test<double>();
+}
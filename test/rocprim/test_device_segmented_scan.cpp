@@ -830,3 +830,177 @@ TYPED_TEST(RocprimDeviceSegmentedScan, ExclusiveScanUsingHeadFlags)
         HIP_CHECK(hipStreamDestroy(stream));
     }
 }
+
+template<bool Exclusive, class Params>
+void testSegmentedScanBalanced()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using input_type   = typename Params::input_type;
+    using output_type  = typename Params::output_type;
+    using scan_op_type = typename Params::scan_op_type;
+    using is_plus_op   = test_utils::is_plus_operator<scan_op_type>;
+    using offset_type  = unsigned int;
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default stream
+
+    const input_type init = input_type{Params::init};
+
+    scan_op_type scan_op;
+
+    std::random_device         rd;
+    std::default_random_engine gen(rd());
+
+    std::uniform_int_distribution<size_t> segment_length_dis(Params::min_segment_length,
+                                                             Params::max_segment_length);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data and calculate expected results
+            std::vector<output_type> values_expected(size);
+            std::vector<input_type>  values_input
+                = test_utils::get_random_data<input_type>(size, 0, 100, seed_value);
+
+            // The segments cover the whole input, and may be empty
+            std::vector<offset_type> offsets;
+            unsigned int             segments_count     = 0;
+            size_t                   offset             = 0;
+            size_t                   max_segment_length = 0;
+            while(offset < size)
+            {
+                const size_t segment_length = segment_length_dis(gen);
+                offsets.push_back(offset);
+
+                const size_t end   = std::min(size, offset + segment_length);
+                max_segment_length = std::max(max_segment_length, end - offset);
+
+                input_type aggregate = init;
+                for(size_t i = offset; i < end; i++)
+                {
+                    if(Exclusive)
+                    {
+                        values_expected[i] = aggregate;
+                        aggregate          = scan_op(aggregate, values_input[i]);
+                    }
+                    else
+                    {
+                        aggregate = i == offset ? values_input[i]
+                                                : scan_op(aggregate, values_input[i]);
+                        values_expected[i] = aggregate;
+                    }
+                }
+
+                segments_count++;
+                offset = end;
+            }
+            offsets.push_back(size);
+
+            const float precision
+                = is_plus_op::value
+                      ? std::max(test_utils::precision<typename is_plus_op::value_type>,
+                                 test_utils::precision<input_type>)
+                            * max_segment_length
+                      : 0;
+            if(precision > 0.5)
+            {
+                std::cout << "Test is skipped from size " << size
+                          << " on, potential error of summation is more than 0.5 of the result "
+                             "with current or larger size"
+                          << std::endl;
+                continue;
+            }
+
+            input_type*  d_values_input;
+            offset_type* d_offsets;
+            output_type* d_values_output;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(input_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(offset_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(output_type)));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(input_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            const auto run = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+            {
+                if(Exclusive)
+                {
+                    return rocprim::segmented_exclusive_scan_balanced(d_temporary_storage,
+                                                                      temporary_storage_bytes,
+                                                                      d_values_input,
+                                                                      d_values_output,
+                                                                      size,
+                                                                      segments_count,
+                                                                      d_offsets,
+                                                                      init,
+                                                                      scan_op,
+                                                                      stream,
+                                                                      debug_synchronous);
+                }
+                return rocprim::segmented_inclusive_scan_balanced(d_temporary_storage,
+                                                                  temporary_storage_bytes,
+                                                                  d_values_input,
+                                                                  d_values_output,
+                                                                  size,
+                                                                  segments_count,
+                                                                  d_offsets,
+                                                                  scan_op,
+                                                                  stream,
+                                                                  debug_synchronous);
+            };
+
+            size_t temporary_storage_bytes;
+            HIP_CHECK(run(nullptr, temporary_storage_bytes));
+
+            ASSERT_GT(temporary_storage_bytes, 0);
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<output_type> values_output(size);
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                values_output.size() * sizeof(output_type),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_near(values_output, values_expected, precision));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_values_output));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceSegmentedScan, InclusiveScanBalanced)
+{
+    testSegmentedScanBalanced<false, typename TestFixture::params>();
+}
+
+TYPED_TEST(RocprimDeviceSegmentedScan, ExclusiveScanBalanced)
+{
+    testSegmentedScanBalanced<true, typename TestFixture::params>();
+}
@@ -0,0 +1,269 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_segmented_select.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <cstddef>
+
+struct segmented_select_test_is_odd
+{
+    ROCPRIM_HOST_DEVICE bool operator()(int x) const
+    {
+        return x % 2 != 0;
+    }
+};
+
+TEST(RocprimDeviceSegmentedSelectTests, SelectPartitionAndPacked)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+    const int         untouched         = -1;
+
+    const segmented_select_test_is_odd predicate;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<int> input
+                = test_utils::get_random_data<int>(size, 0, 1000, seed_value);
+
+            // Segments of up to a few tiles, including empty ones
+            std::default_random_engine                  gen(seed_value);
+            std::uniform_int_distribution<unsigned int> segment_length_dis(0, 3000);
+            std::vector<unsigned int>                   offsets = {0};
+            while(offsets.back() < size)
+            {
+                offsets.push_back(static_cast<unsigned int>(
+                    std::min<size_t>(size, offsets.back() + segment_length_dis(gen))));
+            }
+            const unsigned int segments = static_cast<unsigned int>(offsets.size() - 1);
+
+            std::vector<int>          select_expected(size, untouched);
+            std::vector<int>          partition_expected(size);
+            std::vector<int>          packed_expected;
+            std::vector<unsigned int> counts_expected(segments);
+            std::vector<size_t>       packed_offsets_expected(segments + 1);
+            for(unsigned int segment = 0; segment < segments; segment++)
+            {
+                const unsigned int begin    = offsets[segment];
+                const unsigned int end      = offsets[segment + 1];
+                unsigned int       selected = 0;
+                unsigned int       rejected = 0;
+                packed_offsets_expected[segment] = packed_expected.size();
+                for(unsigned int i = begin; i < end; i++)
+                {
+                    if(predicate(input[i]))
+                    {
+                        select_expected[begin + selected]    = input[i];
+                        partition_expected[begin + selected] = input[i];
+                        packed_expected.push_back(input[i]);
+                        selected++;
+                    }
+                    else
+                    {
+                        partition_expected[end - 1 - rejected] = input[i];
+                        rejected++;
+                    }
+                }
+                counts_expected[segment] = selected;
+            }
+            packed_offsets_expected[segments] = packed_expected.size();
+
+            int*          d_input;
+            int*          d_output;
+            unsigned int* d_offsets;
+            unsigned int* d_counts;
+            size_t*       d_packed_offsets;
+            const size_t  allocated = std::max<size_t>(size, 1);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, allocated * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, allocated * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_counts,
+                                                         std::max(segments, 1u)
+                                                             * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_packed_offsets,
+                                                         (segments + 1) * sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+
+            size_t select_bytes;
+            size_t partition_bytes;
+            size_t packed_bytes;
+            HIP_CHECK(rocprim::segmented_select(nullptr,
+                                                select_bytes,
+                                                d_input,
+                                                d_output,
+                                                d_counts,
+                                                segments,
+                                                d_offsets,
+                                                d_offsets + 1,
+                                                predicate,
+                                                stream,
+                                                debug_synchronous));
+            HIP_CHECK(rocprim::segmented_partition(nullptr,
+                                                   partition_bytes,
+                                                   d_input,
+                                                   d_output,
+                                                   d_counts,
+                                                   segments,
+                                                   d_offsets,
+                                                   d_offsets + 1,
+                                                   predicate,
+                                                   stream,
+                                                   debug_synchronous));
+            HIP_CHECK(rocprim::segmented_select_packed(nullptr,
+                                                       packed_bytes,
+                                                       d_input,
+                                                       d_output,
+                                                       d_counts,
+                                                       d_packed_offsets,
+                                                       segments,
+                                                       d_offsets,
+                                                       d_offsets + 1,
+                                                       predicate,
+                                                       stream,
+                                                       debug_synchronous));
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(
+                &d_temp_storage,
+                std::max(select_bytes, std::max(partition_bytes, packed_bytes))));
+
+            std::vector<int>          output(size);
+            std::vector<unsigned int> counts(segments);
+
+            // segmented_select leaves the items after the selected ones unchanged
+            const std::vector<int> untouched_output(size, untouched);
+            HIP_CHECK(hipMemcpy(d_output,
+                                untouched_output.data(),
+                                size * sizeof(int),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(rocprim::segmented_select(d_temp_storage,
+                                                select_bytes,
+                                                d_input,
+                                                d_output,
+                                                d_counts,
+                                                segments,
+                                                d_offsets,
+                                                d_offsets + 1,
+                                                predicate,
+                                                stream,
+                                                debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(int), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(counts.data(),
+                                d_counts,
+                                segments * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, select_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(counts, counts_expected));
+
+            HIP_CHECK(rocprim::segmented_partition(d_temp_storage,
+                                                   partition_bytes,
+                                                   d_input,
+                                                   d_output,
+                                                   d_counts,
+                                                   segments,
+                                                   d_offsets,
+                                                   d_offsets + 1,
+                                                   predicate,
+                                                   stream,
+                                                   debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(int), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(counts.data(),
+                                d_counts,
+                                segments * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, partition_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(counts, counts_expected));
+
+            HIP_CHECK(rocprim::segmented_select_packed(d_temp_storage,
+                                                       packed_bytes,
+                                                       d_input,
+                                                       d_output,
+                                                       d_counts,
+                                                       d_packed_offsets,
+                                                       segments,
+                                                       d_offsets,
+                                                       d_offsets + 1,
+                                                       predicate,
+                                                       stream,
+                                                       debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            std::vector<size_t> packed_offsets(segments + 1);
+            HIP_CHECK(hipMemcpy(packed_offsets.data(),
+                                d_packed_offsets,
+                                (segments + 1) * sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(packed_offsets, packed_offsets_expected));
+
+            output.resize(packed_expected.size());
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(int),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(counts.data(),
+                                d_counts,
+                                segments * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, packed_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(counts, counts_expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_counts));
+            HIP_CHECK(hipFree(d_packed_offsets));
+        }
+    }
+}
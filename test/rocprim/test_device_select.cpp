@@ -24,12 +24,15 @@
 
 // required rocprim headers
 #include <rocprim/device/device_select.hpp>
+#include <rocprim/device/device_transform.hpp>
 #include <rocprim/iterator/constant_iterator.hpp>
 #include <rocprim/iterator/discard_iterator.hpp>
 #include <rocprim/iterator/counting_iterator.hpp>
+#include <rocprim/iterator/launch_descriptor_iterator.hpp>
 
 // required test headers
 #include "test_utils_types.hpp"
+#include <algorithm>
 #include <numeric>
 
 // Params for tests
@@ -38,7 +41,8 @@ template<
     class OutputType = InputType,
     class FlagType = unsigned int,
     bool UseIdentityIterator = false,
-    bool UseGraphs = false
+    bool UseGraphs = false,
+    class Config = rocprim::default_config
 >
 struct DeviceSelectParams
 {
@@ -47,6 +51,7 @@ struct DeviceSelectParams
     using flag_type = FlagType;
     static constexpr bool use_identity_iterator = UseIdentityIterator;
     static constexpr bool use_graphs = UseGraphs;
+    using config = Config;
 };
 
 template<class Params>
@@ -59,8 +64,21 @@ public:
     const bool debug_synchronous = false;
     static constexpr bool use_identity_iterator = Params::use_identity_iterator;
     static constexpr bool use_graphs = Params::use_graphs;
+    using config = typename Params::config;
 };
 
+// Counts the selected items of the tiles before scattering them, with partitions of a few tiles.
+using two_pass_select_config
+    = rocprim::select_config<64,
+                             2,
+                             ::rocprim::block_load_method::block_load_transpose,
+                             ::rocprim::block_load_method::block_load_transpose,
+                             ::rocprim::block_load_method::block_load_transpose,
+                             ::rocprim::block_scan_algorithm::using_warp_scan,
+                             ROCPRIM_GRID_SIZE_LIMIT,
+                             rocprim::lookback_backoff_config<>,
+                             true>;
+
 typedef ::testing::Types<DeviceSelectParams<int, long>,
                          DeviceSelectParams<int8_t, int8_t>,
                          DeviceSelectParams<uint8_t, uint8_t>,
@@ -73,7 +91,19 @@ typedef ::testing::Types<DeviceSelectParams<int, long>,
                                             test_utils::custom_test_type<double>,
                                             int,
                                             true>,
-                         DeviceSelectParams<int, int, unsigned int, false, true>>
+                         DeviceSelectParams<int, int, unsigned int, false, true>,
+                         DeviceSelectParams<int,
+                                            int,
+                                            unsigned int,
+                                            false,
+                                            false,
+                                            two_pass_select_config>,
+                         DeviceSelectParams<float,
+                                            double,
+                                            unsigned char,
+                                            true,
+                                            false,
+                                            two_pass_select_config>>
     RocprimDeviceSelectTestsParams;
 
 TYPED_TEST_SUITE(RocprimDeviceSelectTests, RocprimDeviceSelectTestsParams);
@@ -88,6 +118,7 @@ TYPED_TEST(RocprimDeviceSelectTests, Flagged)
     using U = typename TestFixture::output_type;
     using F = typename TestFixture::flag_type;
     static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
+    using config = typename TestFixture::config;
 
     hipStream_t stream = 0; // default stream
     if (TestFixture::use_graphs)
@@ -147,7 +178,7 @@ TYPED_TEST(RocprimDeviceSelectTests, Flagged)
             // temp storage
             size_t temp_storage_size_bytes;
             // Get size of d_temp_storage
-            HIP_CHECK(rocprim::select(
+            HIP_CHECK(rocprim::select<config>(
                 nullptr,
                 temp_storage_size_bytes,
                 d_input,
@@ -176,7 +207,7 @@ TYPED_TEST(RocprimDeviceSelectTests, Flagged)
 
             // Run
             HIP_CHECK(
-                rocprim::select(
+                rocprim::select<config>(
                     d_temp_storage,
                     temp_storage_size_bytes,
                     d_input,
@@ -260,6 +291,7 @@ TYPED_TEST(RocprimDeviceSelectTests, SelectOp)
     using T = typename TestFixture::input_type;
     using U = typename TestFixture::output_type;
     static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
+    using config = typename TestFixture::config;
     const bool debug_synchronous = TestFixture::debug_synchronous;
 
     hipStream_t stream = 0; // default stream
@@ -310,7 +342,7 @@ TYPED_TEST(RocprimDeviceSelectTests, SelectOp)
             // temp storage
             size_t temp_storage_size_bytes;
             // Get size of d_temp_storage
-            HIP_CHECK(rocprim::select(
+            HIP_CHECK(rocprim::select<config>(
                 nullptr,
                 temp_storage_size_bytes,
                 d_input,
@@ -339,7 +371,7 @@ TYPED_TEST(RocprimDeviceSelectTests, SelectOp)
 
             // Run
             HIP_CHECK(
-                rocprim::select(
+                rocprim::select<config>(
                     d_temp_storage,
                     temp_storage_size_bytes,
                     d_input,
@@ -402,6 +434,405 @@ TYPED_TEST(RocprimDeviceSelectTests, SelectOp)
     }
 }
 
+TYPED_TEST(RocprimDeviceSelectTests, SelectOpWithIndex)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default stream
+    if(TestFixture::use_graphs)
+    {
+        // Default stream does not support hipGraph stream capture, so create one
+        HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    }
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            T*            d_input;
+            U*            d_output;
+            size_t*       d_indices;
+            unsigned int* d_selected_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, input.size() * sizeof(U)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_indices, input.size() * sizeof(size_t)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count_output,
+                                                         sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            // Calculate expected results on host
+            std::vector<U>      expected;
+            std::vector<size_t> expected_indices;
+            for(size_t i = 0; i < input.size(); i++)
+            {
+                if(select_op<T>()(input[i]))
+                {
+                    expected.push_back(input[i]);
+                    expected_indices.push_back(i);
+                }
+            }
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::select_with_index(nullptr,
+                                                 temp_storage_size_bytes,
+                                                 d_input,
+                                                 d_output,
+                                                 d_indices,
+                                                 d_selected_count_output,
+                                                 input.size(),
+                                                 select_op<T>(),
+                                                 stream,
+                                                 debug_synchronous));
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            void* d_temp_storage = nullptr;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            test_utils::GraphHelper gHelper;
+            if(TestFixture::use_graphs)
+            {
+                gHelper.startStreamCapture(stream);
+            }
+
+            HIP_CHECK(rocprim::select_with_index(d_temp_storage,
+                                                 temp_storage_size_bytes,
+                                                 d_input,
+                                                 d_output,
+                                                 d_indices,
+                                                 d_selected_count_output,
+                                                 input.size(),
+                                                 select_op<T>(),
+                                                 stream,
+                                                 debug_synchronous));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.createAndLaunchGraph(stream, true, false);
+            }
+
+            HIP_CHECK(hipDeviceSynchronize());
+
+            unsigned int selected_count_output = 0;
+            HIP_CHECK(hipMemcpy(&selected_count_output,
+                                d_selected_count_output,
+                                sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(selected_count_output, expected.size());
+
+            std::vector<U>      output(input.size());
+            std::vector<size_t> indices(input.size());
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(U),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(indices.data(),
+                                d_indices,
+                                indices.size() * sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected, expected.size()));
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(indices, expected_indices, expected_indices.size()));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_indices));
+            HIP_CHECK(hipFree(d_selected_count_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.cleanupGraphHelper();
+            }
+        }
+    }
+
+    if(TestFixture::use_graphs)
+    {
+        HIP_CHECK(hipStreamDestroy(stream));
+    }
+}
+
+TYPED_TEST(RocprimDeviceSelectTests, SelectOpUnordered)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default stream
+    if(TestFixture::use_graphs)
+    {
+        // Default stream does not support hipGraph stream capture, so create one
+        HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    }
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            T*            d_input;
+            U*            d_output;
+            unsigned int* d_selected_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, input.size() * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count_output,
+                                                         sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            // Calculate expected results on host
+            std::vector<U> expected;
+            for(size_t i = 0; i < input.size(); i++)
+            {
+                if(select_op<T>()(input[i]))
+                {
+                    expected.push_back(input[i]);
+                }
+            }
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::select_unordered(nullptr,
+                                                temp_storage_size_bytes,
+                                                d_input,
+                                                d_output,
+                                                d_selected_count_output,
+                                                input.size(),
+                                                select_op<T>(),
+                                                stream,
+                                                debug_synchronous));
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            void* d_temp_storage = nullptr;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            test_utils::GraphHelper gHelper;
+            if(TestFixture::use_graphs)
+            {
+                gHelper.startStreamCapture(stream);
+            }
+
+            HIP_CHECK(rocprim::select_unordered(d_temp_storage,
+                                                temp_storage_size_bytes,
+                                                d_input,
+                                                d_output,
+                                                d_selected_count_output,
+                                                input.size(),
+                                                select_op<T>(),
+                                                stream,
+                                                debug_synchronous));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.createAndLaunchGraph(stream, true, false);
+            }
+
+            HIP_CHECK(hipDeviceSynchronize());
+
+            unsigned int selected_count_output = 0;
+            HIP_CHECK(hipMemcpy(&selected_count_output,
+                                d_selected_count_output,
+                                sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(selected_count_output, expected.size());
+
+            std::vector<U> output(selected_count_output);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(U),
+                                hipMemcpyDeviceToHost));
+
+            // The order of the selected values is unspecified
+            std::sort(output.begin(), output.end(), rocprim::less<U>());
+            std::sort(expected.begin(), expected.end(), rocprim::less<U>());
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_selected_count_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.cleanupGraphHelper();
+            }
+        }
+    }
+
+    if(TestFixture::use_graphs)
+    {
+        HIP_CHECK(hipStreamDestroy(stream));
+    }
+}
+
+TYPED_TEST(RocprimDeviceSelectTests, UniqueUnordered)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    hipStream_t stream = 0; // default stream
+    if(TestFixture::use_graphs)
+    {
+        // Default stream does not support hipGraph stream capture, so create one
+        HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    }
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            // Small value range so that runs of equal values are frequent
+            std::vector<T> input = test_utils::get_random_data<T>(size, 0, 3, seed_value);
+
+            T*            d_input;
+            U*            d_output;
+            unsigned int* d_selected_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, input.size() * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count_output,
+                                                         sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                input.size() * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            // Calculate expected results on host, the first values of the runs of equal values
+            std::vector<U> expected;
+            for(size_t i = 0; i < input.size(); i++)
+            {
+                if(i == 0 || !rocprim::equal_to<T>()(input[i - 1], input[i]))
+                {
+                    expected.push_back(input[i]);
+                }
+            }
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::unique_unordered(nullptr,
+                                                temp_storage_size_bytes,
+                                                d_input,
+                                                d_output,
+                                                d_selected_count_output,
+                                                input.size(),
+                                                rocprim::equal_to<T>(),
+                                                stream,
+                                                debug_synchronous));
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0);
+
+            void* d_temp_storage = nullptr;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            test_utils::GraphHelper gHelper;
+            if(TestFixture::use_graphs)
+            {
+                gHelper.startStreamCapture(stream);
+            }
+
+            HIP_CHECK(rocprim::unique_unordered(d_temp_storage,
+                                                temp_storage_size_bytes,
+                                                d_input,
+                                                d_output,
+                                                d_selected_count_output,
+                                                input.size(),
+                                                rocprim::equal_to<T>(),
+                                                stream,
+                                                debug_synchronous));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.createAndLaunchGraph(stream, true, false);
+            }
+
+            HIP_CHECK(hipDeviceSynchronize());
+
+            unsigned int selected_count_output = 0;
+            HIP_CHECK(hipMemcpy(&selected_count_output,
+                                d_selected_count_output,
+                                sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(selected_count_output, expected.size());
+
+            std::vector<U> output(selected_count_output);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(U),
+                                hipMemcpyDeviceToHost));
+
+            // The order of the selected values is unspecified
+            std::sort(output.begin(), output.end(), rocprim::less<U>());
+            std::sort(expected.begin(), expected.end(), rocprim::less<U>());
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_selected_count_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.cleanupGraphHelper();
+            }
+        }
+    }
+
+    if(TestFixture::use_graphs)
+    {
+        HIP_CHECK(hipStreamDestroy(stream));
+    }
+}
+
 TYPED_TEST(RocprimDeviceSelectTests, SelectFlagged)
 {
     int device_id = test_common_utils::obtain_device_from_ctest();
@@ -412,6 +843,7 @@ TYPED_TEST(RocprimDeviceSelectTests, SelectFlagged)
     using U                                     = typename TestFixture::output_type;
     using F                                     = typename TestFixture::flag_type;
     static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
+    using config = typename TestFixture::config;
 
     hipStream_t stream = 0; // default stream
     if(TestFixture::use_graphs)
@@ -462,7 +894,7 @@ TYPED_TEST(RocprimDeviceSelectTests, SelectFlagged)
             // temp storage
             size_t temp_storage_size_bytes;
             // Get size of d_temp_storage
-            HIP_CHECK(rocprim::select(
+            HIP_CHECK(rocprim::select<config>(
                 nullptr,
                 temp_storage_size_bytes,
                 d_input,
@@ -490,7 +922,7 @@ TYPED_TEST(RocprimDeviceSelectTests, SelectFlagged)
             }
 
             // Run
-            HIP_CHECK(rocprim::select(
+            HIP_CHECK(rocprim::select<config>(
                 d_temp_storage,
                 temp_storage_size_bytes,
                 d_input,
@@ -565,6 +997,7 @@ TYPED_TEST(RocprimDeviceSelectTests, Unique)
     using scan_op_type = rocprim::plus<T>;
 
     static constexpr bool use_identity_iterator = TestFixture::use_identity_iterator;
+    using config = typename TestFixture::config;
     const bool debug_synchronous = TestFixture::debug_synchronous;
 
     hipStream_t stream = 0; // default stream
@@ -630,7 +1063,7 @@ TYPED_TEST(RocprimDeviceSelectTests, Unique)
                 // temp storage
                 size_t temp_storage_size_bytes;
                 // Get size of d_temp_storage
-                HIP_CHECK(rocprim::unique(
+                HIP_CHECK(rocprim::unique<config>(
                     nullptr,
                     temp_storage_size_bytes,
                     d_input,
@@ -659,7 +1092,7 @@ TYPED_TEST(RocprimDeviceSelectTests, Unique)
 
                 // Run
                 HIP_CHECK(
-                    rocprim::unique(
+                    rocprim::unique<config>(
                         d_temp_storage,
                         temp_storage_size_bytes,
                         d_input,
@@ -942,6 +1375,112 @@ TEST(RocprimDeviceSelectTests, UniqueGuardedOperatorWithGraphs)
     testUniqueGuardedOperator<true>();
 }
 
+// The selected count is written as a launch descriptor, and its size is read by a later
+// transform, with no host synchronization in between
+TEST(RocprimDeviceSelectTests, LaunchDescriptor)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+    constexpr unsigned int items_per_block = 256;
+
+    const hipStream_t stream = 0; // default
+    const auto is_even = [] __host__ __device__(const T value) { return value % 2 == 0; };
+    const auto square  = [] __device__(const T value) { return value * value; };
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            std::vector<T> expected;
+            for(const T value : input)
+            {
+                if(is_even(value))
+                {
+                    expected.push_back(value * value);
+                }
+            }
+
+            T*                           d_input;
+            T*                           d_selected;
+            T*                           d_output;
+            rocprim::launch_descriptor* d_descriptor;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_descriptor, sizeof(*d_descriptor)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            const auto descriptor_output
+                = rocprim::make_launch_descriptor_iterator(d_descriptor, items_per_block);
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::select(nullptr,
+                                      temp_storage_size_bytes,
+                                      d_input,
+                                      d_selected,
+                                      descriptor_output,
+                                      size,
+                                      is_even,
+                                      stream));
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(rocprim::select(d_temp_storage,
+                                      temp_storage_size_bytes,
+                                      d_input,
+                                      d_selected,
+                                      descriptor_output,
+                                      size,
+                                      is_even,
+                                      stream));
+            HIP_CHECK(rocprim::transform(d_selected,
+                                         d_output,
+                                         rocprim::future_value<size_t>{&d_descriptor->size},
+                                         size,
+                                         square,
+                                         stream));
+            HIP_CHECK(hipGetLastError());
+
+            rocprim::launch_descriptor descriptor;
+            std::vector<T>             output(expected.size());
+            HIP_CHECK(
+                hipMemcpy(&descriptor, d_descriptor, sizeof(descriptor), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(T),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_EQ(descriptor.size, expected.size());
+            ASSERT_EQ(descriptor.items_per_block, items_per_block);
+            ASSERT_EQ(size_t(descriptor.grid_size.x),
+                      (expected.size() + items_per_block - 1) / items_per_block);
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_selected));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_descriptor));
+        }
+    }
+}
+
 // Params for tests
 template<
     typename KeyType,
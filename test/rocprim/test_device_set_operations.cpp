@@ -0,0 +1,514 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_set_operations.hpp>
+#include <rocprim/functional.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+template<class KeyType,
+         class ValueType = unsigned int,
+         class CompareOp = rocprim::less<KeyType>,
+         class Config    = rocprim::default_config>
+struct DeviceSetOperationsParams
+{
+    using key_type        = KeyType;
+    using value_type      = ValueType;
+    using compare_op_type = CompareOp;
+    using config          = Config;
+};
+
+template<class Params>
+class RocprimDeviceSetOperationsTests : public ::testing::Test
+{
+public:
+    using key_type               = typename Params::key_type;
+    using value_type             = typename Params::value_type;
+    using compare_op_type        = typename Params::compare_op_type;
+    using config                 = typename Params::config;
+    const bool debug_synchronous = false;
+};
+
+using RocprimDeviceSetOperationsTestsParams = ::testing::Types<
+    DeviceSetOperationsParams<int>,
+    DeviceSetOperationsParams<unsigned char, short>,
+    DeviceSetOperationsParams<long long, int, rocprim::greater<long long>>,
+    DeviceSetOperationsParams<float, double>,
+    DeviceSetOperationsParams<double, unsigned int, rocprim::greater<double>>,
+    DeviceSetOperationsParams<rocprim::half, int>,
+    DeviceSetOperationsParams<int, unsigned int, rocprim::less<int>, rocprim::merge_config<64, 1>>,
+    DeviceSetOperationsParams<short, int, rocprim::less<short>, rocprim::merge_config<256, 7>>>;
+
+TYPED_TEST_SUITE(RocprimDeviceSetOperationsTests, RocprimDeviceSetOperationsTestsParams);
+
+enum class set_operation
+{
+    set_union,
+    set_intersection,
+    set_difference,
+    set_symmetric_difference
+};
+
+const set_operation set_operations[] = {set_operation::set_union,
+                                        set_operation::set_intersection,
+                                        set_operation::set_difference,
+                                        set_operation::set_symmetric_difference};
+
+// The standard set operations take the same copies of equal keys as the device ones
+template<class InputIterator, class OutputIterator, class Compare>
+OutputIterator expected_set_operation(const set_operation operation,
+                                      InputIterator       first1,
+                                      InputIterator       last1,
+                                      InputIterator       first2,
+                                      InputIterator       last2,
+                                      OutputIterator      output,
+                                      Compare             compare)
+{
+    switch(operation)
+    {
+        case set_operation::set_union:
+            return std::set_union(first1, last1, first2, last2, output, compare);
+        case set_operation::set_intersection:
+            return std::set_intersection(first1, last1, first2, last2, output, compare);
+        case set_operation::set_difference:
+            return std::set_difference(first1, last1, first2, last2, output, compare);
+        default:
+            return std::set_symmetric_difference(first1, last1, first2, last2, output, compare);
+    }
+}
+
+template<class Config, class... Args>
+hipError_t invoke_set_operation(const set_operation operation, Args&&... args)
+{
+    switch(operation)
+    {
+        case set_operation::set_union:
+            return rocprim::set_union<Config>(std::forward<Args>(args)...);
+        case set_operation::set_intersection:
+            return rocprim::set_intersection<Config>(std::forward<Args>(args)...);
+        case set_operation::set_difference:
+            return rocprim::set_difference<Config>(std::forward<Args>(args)...);
+        default:
+            return rocprim::set_symmetric_difference<Config>(std::forward<Args>(args)...);
+    }
+}
+
+template<class Config,
+         class KeysInputIterator,
+         class ValuesInputIterator,
+         class KeysOutputIterator,
+         class ValuesOutputIterator,
+         class CompareOp>
+hipError_t invoke_set_operation_by_key(const set_operation  operation,
+                                       void*                temporary_storage,
+                                       size_t&              storage_size,
+                                       KeysInputIterator    keys_input1,
+                                       KeysInputIterator    keys_input2,
+                                       ValuesInputIterator  values_input1,
+                                       ValuesInputIterator  values_input2,
+                                       KeysOutputIterator   keys_output,
+                                       ValuesOutputIterator values_output,
+                                       size_t*              count_output,
+                                       const size_t         input1_size,
+                                       const size_t         input2_size,
+                                       CompareOp            compare_op,
+                                       const bool           debug_synchronous)
+{
+    switch(operation)
+    {
+        case set_operation::set_union:
+            return rocprim::set_union_by_key<Config>(temporary_storage,
+                                                     storage_size,
+                                                     keys_input1,
+                                                     keys_input2,
+                                                     values_input1,
+                                                     values_input2,
+                                                     keys_output,
+                                                     values_output,
+                                                     count_output,
+                                                     input1_size,
+                                                     input2_size,
+                                                     compare_op,
+                                                     hipStreamDefault,
+                                                     debug_synchronous);
+        case set_operation::set_intersection:
+            return rocprim::set_intersection_by_key<Config>(temporary_storage,
+                                                            storage_size,
+                                                            keys_input1,
+                                                            keys_input2,
+                                                            values_input1,
+                                                            keys_output,
+                                                            values_output,
+                                                            count_output,
+                                                            input1_size,
+                                                            input2_size,
+                                                            compare_op,
+                                                            hipStreamDefault,
+                                                            debug_synchronous);
+        case set_operation::set_difference:
+            return rocprim::set_difference_by_key<Config>(temporary_storage,
+                                                          storage_size,
+                                                          keys_input1,
+                                                          keys_input2,
+                                                          values_input1,
+                                                          values_input2,
+                                                          keys_output,
+                                                          values_output,
+                                                          count_output,
+                                                          input1_size,
+                                                          input2_size,
+                                                          compare_op,
+                                                          hipStreamDefault,
+                                                          debug_synchronous);
+        default:
+            return rocprim::set_symmetric_difference_by_key<Config>(temporary_storage,
+                                                                    storage_size,
+                                                                    keys_input1,
+                                                                    keys_input2,
+                                                                    values_input1,
+                                                                    values_input2,
+                                                                    keys_output,
+                                                                    values_output,
+                                                                    count_output,
+                                                                    input1_size,
+                                                                    input2_size,
+                                                                    compare_op,
+                                                                    hipStreamDefault,
+                                                                    debug_synchronous);
+    }
+}
+
+template<class Key, class CompareOp>
+std::vector<Key> get_sorted_keys(const size_t size, const unsigned int seed_value)
+{
+    // Few distinct keys, so that the sequences have many equal keys in common
+    std::vector<Key> keys = test_utils::get_random_data<Key>(size, 0, 100, seed_value);
+    std::sort(keys.begin(), keys.end(), CompareOp());
+    return keys;
+}
+
+TYPED_TEST(RocprimDeviceSetOperationsTests, SetOperations)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type               = typename TestFixture::key_type;
+    using compare_op_type        = typename TestFixture::compare_op_type;
+    using config                 = typename TestFixture::config;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+    const compare_op_type compare_op;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size1 : test_utils::get_sizes(seed_value))
+        {
+            const size_t size2 = test_utils::get_random_value<size_t>(0, 2 * size1, seed_value);
+            SCOPED_TRACE(testing::Message() << "with sizes = " << size1 << ", " << size2);
+
+            const std::vector<key_type> input1
+                = get_sorted_keys<key_type, compare_op_type>(size1, seed_value);
+            const std::vector<key_type> input2
+                = get_sorted_keys<key_type, compare_op_type>(size2, seed_value + 1);
+
+            key_type* d_input1;
+            key_type* d_input2;
+            key_type* d_output;
+            size_t*   d_count;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input1,
+                                                         (size1 + 1) * sizeof(*d_input1)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input2,
+                                                         (size2 + 1) * sizeof(*d_input2)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         (size1 + size2 + 1) * sizeof(*d_output)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_count, sizeof(*d_count)));
+            HIP_CHECK(hipMemcpy(d_input1,
+                                input1.data(),
+                                size1 * sizeof(*d_input1),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_input2,
+                                input2.data(),
+                                size2 * sizeof(*d_input2),
+                                hipMemcpyHostToDevice));
+
+            for(const set_operation operation : set_operations)
+            {
+                SCOPED_TRACE(testing::Message()
+                             << "with operation = " << static_cast<int>(operation));
+
+                std::vector<key_type> expected;
+                expected_set_operation(operation,
+                                       input1.begin(),
+                                       input1.end(),
+                                       input2.begin(),
+                                       input2.end(),
+                                       std::back_inserter(expected),
+                                       compare_op);
+
+                size_t temp_storage_size_bytes;
+                void*  d_temp_storage = nullptr;
+                HIP_CHECK(invoke_set_operation<config>(operation,
+                                                       d_temp_storage,
+                                                       temp_storage_size_bytes,
+                                                       d_input1,
+                                                       d_input2,
+                                                       d_output,
+                                                       d_count,
+                                                       size1,
+                                                       size2,
+                                                       compare_op,
+                                                       hipStreamDefault,
+                                                       debug_synchronous));
+
+                ASSERT_GT(temp_storage_size_bytes, 0);
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                HIP_CHECK(invoke_set_operation<config>(operation,
+                                                       d_temp_storage,
+                                                       temp_storage_size_bytes,
+                                                       d_input1,
+                                                       d_input2,
+                                                       d_output,
+                                                       d_count,
+                                                       size1,
+                                                       size2,
+                                                       compare_op,
+                                                       hipStreamDefault,
+                                                       debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                size_t count;
+                HIP_CHECK(hipMemcpy(&count, d_count, sizeof(count), hipMemcpyDeviceToHost));
+                ASSERT_EQ(count, expected.size());
+
+                std::vector<key_type> output(count);
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    count * sizeof(*d_output),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            HIP_CHECK(hipFree(d_input1));
+            HIP_CHECK(hipFree(d_input2));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_count));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceSetOperationsTests, SetOperationsByKey)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type               = typename TestFixture::key_type;
+    using value_type             = typename TestFixture::value_type;
+    using compare_op_type        = typename TestFixture::compare_op_type;
+    using config                 = typename TestFixture::config;
+    using pair_type              = std::pair<key_type, value_type>;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+    const compare_op_type compare_op;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size1 : test_utils::get_sizes(seed_value))
+        {
+            const size_t size2 = test_utils::get_random_value<size_t>(0, 2 * size1, seed_value);
+            SCOPED_TRACE(testing::Message() << "with sizes = " << size1 << ", " << size2);
+
+            const std::vector<key_type> keys_input1
+                = get_sorted_keys<key_type, compare_op_type>(size1, seed_value);
+            const std::vector<key_type> keys_input2
+                = get_sorted_keys<key_type, compare_op_type>(size2, seed_value + 1);
+
+            // The values tell which of the equal keys are written
+            std::vector<value_type> values_input1(size1);
+            std::vector<value_type> values_input2(size2);
+            std::vector<pair_type>  input1(size1);
+            std::vector<pair_type>  input2(size2);
+            for(size_t i = 0; i < size1; i++)
+            {
+                values_input1[i] = static_cast<value_type>(i % 1000);
+                input1[i]        = pair_type(keys_input1[i], values_input1[i]);
+            }
+            for(size_t i = 0; i < size2; i++)
+            {
+                values_input2[i] = static_cast<value_type>(1000 + i % 1000);
+                input2[i]        = pair_type(keys_input2[i], values_input2[i]);
+            }
+
+            key_type*   d_keys_input1;
+            key_type*   d_keys_input2;
+            value_type* d_values_input1;
+            value_type* d_values_input2;
+            key_type*   d_keys_output;
+            value_type* d_values_output;
+            size_t*     d_count;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input1,
+                                                         (size1 + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input2,
+                                                         (size2 + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input1,
+                                                         (size1 + 1) * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input2,
+                                                         (size2 + 1) * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                         (size1 + size2 + 1) * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_output,
+                                                   (size1 + size2 + 1) * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_count, sizeof(*d_count)));
+            HIP_CHECK(hipMemcpy(d_keys_input1,
+                                keys_input1.data(),
+                                size1 * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_keys_input2,
+                                keys_input2.data(),
+                                size2 * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input1,
+                                values_input1.data(),
+                                size1 * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input2,
+                                values_input2.data(),
+                                size2 * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            for(const set_operation operation : set_operations)
+            {
+                SCOPED_TRACE(testing::Message()
+                             << "with operation = " << static_cast<int>(operation));
+
+                std::vector<pair_type> expected;
+                expected_set_operation(operation,
+                                       input1.begin(),
+                                       input1.end(),
+                                       input2.begin(),
+                                       input2.end(),
+                                       std::back_inserter(expected),
+                                       [compare_op](const pair_type& a, const pair_type& b)
+                                       { return compare_op(a.first, b.first); });
+
+                size_t temp_storage_size_bytes;
+                void*  d_temp_storage = nullptr;
+                HIP_CHECK(invoke_set_operation_by_key<config>(operation,
+                                                              d_temp_storage,
+                                                              temp_storage_size_bytes,
+                                                              d_keys_input1,
+                                                              d_keys_input2,
+                                                              d_values_input1,
+                                                              d_values_input2,
+                                                              d_keys_output,
+                                                              d_values_output,
+                                                              d_count,
+                                                              size1,
+                                                              size2,
+                                                              compare_op,
+                                                              debug_synchronous));
+
+                ASSERT_GT(temp_storage_size_bytes, 0);
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                HIP_CHECK(invoke_set_operation_by_key<config>(operation,
+                                                              d_temp_storage,
+                                                              temp_storage_size_bytes,
+                                                              d_keys_input1,
+                                                              d_keys_input2,
+                                                              d_values_input1,
+                                                              d_values_input2,
+                                                              d_keys_output,
+                                                              d_values_output,
+                                                              d_count,
+                                                              size1,
+                                                              size2,
+                                                              compare_op,
+                                                              debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                size_t count;
+                HIP_CHECK(hipMemcpy(&count, d_count, sizeof(count), hipMemcpyDeviceToHost));
+                ASSERT_EQ(count, expected.size());
+
+                std::vector<key_type>   keys_output(count);
+                std::vector<value_type> values_output(count);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    count * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    count * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                std::vector<key_type>   expected_keys(count);
+                std::vector<value_type> expected_values(count);
+                for(size_t i = 0; i < count; i++)
+                {
+                    expected_keys[i]   = expected[i].first;
+                    expected_values[i] = expected[i].second;
+                }
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected_keys));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, expected_values));
+
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            HIP_CHECK(hipFree(d_keys_input1));
+            HIP_CHECK(hipFree(d_keys_input2));
+            HIP_CHECK(hipFree(d_values_input1));
+            HIP_CHECK(hipFree(d_values_input2));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_count));
+        }
+    }
+}
@@ -0,0 +1,159 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_sorted_insert.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <cstddef>
+
+template<class Key>
+class RocprimDeviceSortedInsertTests : public ::testing::Test
+{
+public:
+    using key_type               = Key;
+    const bool debug_synchronous = false;
+};
+
+using RocprimDeviceSortedInsertTestsParams
+    = ::testing::Types<int, unsigned short, float, double, unsigned long long>;
+
+TYPED_TEST_SUITE(RocprimDeviceSortedInsertTests, RocprimDeviceSortedInsertTestsParams);
+
+TYPED_TEST(RocprimDeviceSortedInsertTests, SortedInsert)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type               = typename TestFixture::key_type;
+    const bool debug_synchronous = TestFixture::debug_synchronous;
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            for(size_t batch_size : {size_t(1), size_t(100), size_t(5000)})
+            {
+                // Batch keys below all keys move the whole range, keys above it move nothing
+                for(int batch_min : {0, 50, 200})
+                {
+                    SCOPED_TRACE(testing::Message() << "with size = " << size);
+                    SCOPED_TRACE(testing::Message() << "with batch_size = " << batch_size);
+                    SCOPED_TRACE(testing::Message() << "with batch_min = " << batch_min);
+
+                    std::vector<key_type> keys
+                        = test_utils::get_random_data<key_type>(size, 100, 199, seed_value);
+                    std::sort(keys.begin(), keys.end());
+                    const std::vector<key_type> batch
+                        = test_utils::get_random_data<key_type>(batch_size,
+                                                                batch_min,
+                                                                batch_min + 99,
+                                                                seed_value + 1);
+
+                    // Calculate expected results on host
+                    std::vector<key_type> sorted_batch(batch);
+                    std::sort(sorted_batch.begin(), sorted_batch.end());
+                    std::vector<key_type> expected;
+                    std::merge(keys.begin(),
+                               keys.end(),
+                               sorted_batch.begin(),
+                               sorted_batch.end(),
+                               std::back_inserter(expected));
+
+                    const size_t total_size = size + batch_size;
+                    key_type*    d_keys;
+                    key_type*    d_batch;
+                    HIP_CHECK(
+                        test_common_utils::hipMallocHelper(&d_keys, total_size * sizeof(*d_keys)));
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_batch,
+                                                                 batch_size * sizeof(*d_batch)));
+                    if(size > 0)
+                    {
+                        HIP_CHECK(hipMemcpy(d_keys,
+                                            keys.data(),
+                                            size * sizeof(*d_keys),
+                                            hipMemcpyHostToDevice));
+                    }
+                    HIP_CHECK(hipMemcpy(d_batch,
+                                        batch.data(),
+                                        batch_size * sizeof(*d_batch),
+                                        hipMemcpyHostToDevice));
+
+                    size_t temp_storage_size_bytes;
+                    void*  d_temp_storage = nullptr;
+                    HIP_CHECK(rocprim::sorted_insert(d_temp_storage,
+                                                     temp_storage_size_bytes,
+                                                     d_keys,
+                                                     size,
+                                                     d_batch,
+                                                     batch_size,
+                                                     rocprim::less<key_type>(),
+                                                     stream,
+                                                     debug_synchronous));
+
+                    ASSERT_GT(temp_storage_size_bytes, 0);
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage,
+                                                                 temp_storage_size_bytes));
+
+                    HIP_CHECK(rocprim::sorted_insert(d_temp_storage,
+                                                     temp_storage_size_bytes,
+                                                     d_keys,
+                                                     size,
+                                                     d_batch,
+                                                     batch_size,
+                                                     rocprim::less<key_type>(),
+                                                     stream,
+                                                     debug_synchronous));
+                    HIP_CHECK(hipGetLastError());
+
+                    std::vector<key_type> output(total_size);
+                    HIP_CHECK(hipMemcpy(output.data(),
+                                        d_keys,
+                                        total_size * sizeof(*d_keys),
+                                        hipMemcpyDeviceToHost));
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+                    HIP_CHECK(hipFree(d_keys));
+                    HIP_CHECK(hipFree(d_batch));
+                    HIP_CHECK(hipFree(d_temp_storage));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,206 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_string_sort.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+// Strings of a few characters, shared prefixes of up to 20 characters and zero bytes, so that
+// many of them tie for several rounds
+std::vector<std::string> get_random_strings(const size_t size, const unsigned int seed_value)
+{
+    std::default_random_engine                  gen(seed_value);
+    std::uniform_int_distribution<unsigned int> prefix_dis(0, 7);
+    std::uniform_int_distribution<size_t>       length_dis(0, 12);
+    std::uniform_int_distribution<unsigned int> char_dis(0, 3);
+
+    const char               alphabet[] = {'\0', 'a', 'b', '\xff'};
+    std::vector<std::string> prefixes;
+    for(size_t length = 0; length <= 20; length += 4)
+    {
+        prefixes.push_back(std::string(length, 'p'));
+    }
+    prefixes.push_back("pppppppppppppppppppq");
+    prefixes.push_back(std::string(1, '\0'));
+
+    std::vector<std::string> strings(size);
+    for(std::string& string : strings)
+    {
+        string = prefixes[prefix_dis(gen)];
+        for(size_t length = length_dis(gen); length > 0; --length)
+        {
+            string += alphabet[char_dis(gen)];
+        }
+    }
+    return strings;
+}
+
+// Sorts every segment, or all strings when `segmented` is false
+void run_string_sort_test(const bool segmented)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            // The strings are generated on the host one by one
+            size = std::min<size_t>(size, 1 << 20);
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<std::string> strings = get_random_strings(size, seed_value);
+            std::vector<char>              chars;
+            std::vector<size_t>            string_offsets(1, 0);
+            for(const std::string& string : strings)
+            {
+                chars.insert(chars.end(), string.begin(), string.end());
+                string_offsets.push_back(chars.size());
+            }
+
+            std::default_random_engine            gen(seed_value);
+            std::uniform_int_distribution<size_t> segment_dis(0, 1000);
+            std::vector<unsigned int>             segment_offsets(1, 0);
+            while(segment_offsets.back() < size)
+            {
+                const size_t length = segmented ? segment_dis(gen) : size;
+                segment_offsets.push_back(
+                    static_cast<unsigned int>(std::min(size, segment_offsets.back() + length)));
+            }
+            const unsigned int segments = static_cast<unsigned int>(segment_offsets.size() - 1);
+
+            // Calculate expected results on host
+            std::vector<unsigned int> expected(size);
+            std::iota(expected.begin(), expected.end(), 0u);
+            for(unsigned int segment = 0; segment < segments; ++segment)
+            {
+                std::stable_sort(expected.begin() + segment_offsets[segment],
+                                 expected.begin() + segment_offsets[segment + 1],
+                                 [&](const unsigned int lhs, const unsigned int rhs)
+                                 { return strings[lhs] < strings[rhs]; });
+            }
+
+            char*         d_chars;
+            size_t*       d_string_offsets;
+            unsigned int* d_segment_offsets;
+            unsigned int* d_permutation;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_chars, std::max<size_t>(chars.size(), 1)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_string_offsets,
+                                                         string_offsets.size() * sizeof(size_t)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_segment_offsets,
+                                                         segment_offsets.size()
+                                                             * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_permutation,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_chars, chars.data(), chars.size(), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_string_offsets,
+                                string_offsets.data(),
+                                string_offsets.size() * sizeof(size_t),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_segment_offsets,
+                                segment_offsets.data(),
+                                segment_offsets.size() * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+
+            const auto invoke_sort = [&](void* d_temp_storage, size_t& temp_storage_size_bytes)
+            {
+                if(segmented)
+                {
+                    return rocprim::segmented_string_sort(d_temp_storage,
+                                                          temp_storage_size_bytes,
+                                                          d_chars,
+                                                          d_string_offsets,
+                                                          d_permutation,
+                                                          size,
+                                                          segments,
+                                                          d_segment_offsets,
+                                                          stream,
+                                                          debug_synchronous);
+                }
+                return rocprim::string_sort(d_temp_storage,
+                                            temp_storage_size_bytes,
+                                            d_chars,
+                                            d_string_offsets,
+                                            d_permutation,
+                                            size,
+                                            stream,
+                                            debug_synchronous);
+            };
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(invoke_sort(d_temp_storage, temp_storage_size_bytes));
+
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(invoke_sort(d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<unsigned int> permutation(size);
+            HIP_CHECK(hipMemcpy(permutation.data(),
+                                d_permutation,
+                                size * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(permutation, expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_chars));
+            HIP_CHECK(hipFree(d_string_offsets));
+            HIP_CHECK(hipFree(d_segment_offsets));
+            HIP_CHECK(hipFree(d_permutation));
+        }
+    }
+}
+
+TEST(RocprimDeviceStringSortTests, SortStrings)
+{
+    run_string_sort_test(false);
+}
+
+TEST(RocprimDeviceStringSortTests, SortSegmentedStrings)
+{
+    run_string_sort_test(true);
+}
@@ -0,0 +1,533 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_topk.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+
+template<class KeyType,
+         bool Largest   = true,
+         class Config   = rocprim::default_config,
+         bool UseGraphs = false>
+struct DeviceTopkParams
+{
+    using key_type                   = KeyType;
+    using config                     = Config;
+    static constexpr bool largest    = Largest;
+    static constexpr bool use_graphs = UseGraphs;
+};
+
+template<class Params>
+class RocprimDeviceTopkTests : public ::testing::Test
+{
+public:
+    using key_type                   = typename Params::key_type;
+    using config                     = typename Params::config;
+    static constexpr bool largest    = Params::largest;
+    static constexpr bool use_graphs = Params::use_graphs;
+    const bool            debug_synchronous = false;
+};
+
+using RocprimDeviceTopkTestsParams
+    = ::testing::Types<DeviceTopkParams<int>,
+                       DeviceTopkParams<int, false>,
+                       DeviceTopkParams<unsigned char>,
+                       DeviceTopkParams<short, false>,
+                       DeviceTopkParams<unsigned long long>,
+                       DeviceTopkParams<long long, false>,
+                       DeviceTopkParams<float>,
+                       DeviceTopkParams<double, false>,
+                       DeviceTopkParams<rocprim::half>,
+                       DeviceTopkParams<rocprim::bfloat16, false>,
+                       DeviceTopkParams<int, true, rocprim::topk_config<256, 2, 4>>,
+                       DeviceTopkParams<float, false, rocprim::topk_config<512, 4, 8>>,
+                       DeviceTopkParams<int, true, rocprim::default_config, true>>;
+
+TYPED_TEST_SUITE(RocprimDeviceTopkTests, RocprimDeviceTopkTestsParams);
+
+// Returns the expected selection of the k best keys, sorted from best to worst.
+template<bool Largest, class Key>
+std::vector<Key> expected_topk(std::vector<Key> keys, const size_t k)
+{
+    const auto compare = [](const Key& a, const Key& b) { return Largest ? b < a : a < b; };
+    std::sort(keys.begin(), keys.end(), compare);
+    keys.resize(std::min(k, keys.size()));
+    return keys;
+}
+
+template<bool Largest, class Key>
+void sort_selection(std::vector<Key>& keys)
+{
+    const auto compare = [](const Key& a, const Key& b) { return Largest ? b < a : a < b; };
+    std::sort(keys.begin(), keys.end(), compare);
+}
+
+template<bool Largest, class Config, class... Args>
+hipError_t invoke_topk_keys(Args&&... args)
+{
+    return Largest ? rocprim::topk_keys<Config>(std::forward<Args>(args)...)
+                   : rocprim::topk_keys_min<Config>(std::forward<Args>(args)...);
+}
+
+template<bool Largest, class Config, class... Args>
+hipError_t invoke_topk_pairs(Args&&... args)
+{
+    return Largest ? rocprim::topk_pairs<Config>(std::forward<Args>(args)...)
+                   : rocprim::topk_pairs_min<Config>(std::forward<Args>(args)...);
+}
+
+template<bool Largest, bool Sorted, class Config, class... Args>
+hipError_t invoke_segmented_topk_pairs(Args&&... args)
+{
+    if(Sorted)
+    {
+        return Largest
+                   ? rocprim::segmented_sorted_topk_pairs<Config>(std::forward<Args>(args)...)
+                   : rocprim::segmented_sorted_topk_pairs_min<Config>(std::forward<Args>(args)...);
+    }
+    return Largest ? rocprim::segmented_topk_pairs<Config>(std::forward<Args>(args)...)
+                   : rocprim::segmented_topk_pairs_min<Config>(std::forward<Args>(args)...);
+}
+
+TYPED_TEST(RocprimDeviceTopkTests, TopkKeys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                   = typename TestFixture::key_type;
+    using config                     = typename TestFixture::config;
+    constexpr bool largest           = TestFixture::largest;
+    const bool     debug_synchronous = TestFixture::debug_synchronous;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            hipStream_t stream = 0; // default
+            if(TestFixture::use_graphs)
+            {
+                // Default stream does not support hipGraph stream capture, so create one
+                HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+            }
+
+            for(size_t k : {size_t(1), size_t(7), size_t(100), size_t(1024), size + 1})
+            {
+                SCOPED_TRACE(testing::Message() << "with k = " << k);
+
+                // Small value range so that many keys are equal to the k-th key
+                std::vector<key_type> input
+                    = test_utils::get_random_data<key_type>(size, 0, 100, seed_value);
+                const std::vector<key_type> expected = expected_topk<largest>(input, k);
+
+                key_type* d_input;
+                key_type* d_output;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(*d_input)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                             expected.size() * sizeof(*d_output)));
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    input.size() * sizeof(*d_input),
+                                    hipMemcpyHostToDevice));
+
+                size_t temp_storage_size_bytes;
+                void*  d_temp_storage = nullptr;
+                HIP_CHECK(invoke_topk_keys<largest, config>(d_temp_storage,
+                                                             temp_storage_size_bytes,
+                                                             d_input,
+                                                             d_output,
+                                                             input.size(),
+                                                             k,
+                                                             stream,
+                                                             debug_synchronous));
+
+                ASSERT_GT(temp_storage_size_bytes, 0);
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+                test_utils::GraphHelper gHelper;
+                if(TestFixture::use_graphs)
+                {
+                    gHelper.startStreamCapture(stream);
+                }
+
+                HIP_CHECK(invoke_topk_keys<largest, config>(d_temp_storage,
+                                                             temp_storage_size_bytes,
+                                                             d_input,
+                                                             d_output,
+                                                             input.size(),
+                                                             k,
+                                                             stream,
+                                                             debug_synchronous));
+
+                if(TestFixture::use_graphs)
+                {
+                    gHelper.createAndLaunchGraph(stream);
+                }
+
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                std::vector<key_type> output(expected.size());
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    output.size() * sizeof(*d_output),
+                                    hipMemcpyDeviceToHost));
+
+                // The selection is unordered
+                sort_selection<largest>(output);
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_output));
+                HIP_CHECK(hipFree(d_temp_storage));
+
+                if(TestFixture::use_graphs)
+                {
+                    gHelper.cleanupGraphHelper();
+                }
+            }
+
+            if(TestFixture::use_graphs)
+            {
+                HIP_CHECK(hipStreamDestroy(stream));
+            }
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceTopkTests, TopkPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                   = typename TestFixture::key_type;
+    using value_type                 = unsigned int;
+    using config                     = typename TestFixture::config;
+    constexpr bool largest           = TestFixture::largest;
+    const bool     debug_synchronous = TestFixture::debug_synchronous;
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const size_t k = test_utils::get_random_value<size_t>(1, 1024, seed_value);
+            SCOPED_TRACE(testing::Message() << "with k = " << k);
+
+            std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size,
+                                                        test_utils::generate_limits<key_type>::min(),
+                                                        test_utils::generate_limits<key_type>::max(),
+                                                        seed_value);
+            // Values are the indices of the keys so that the pairs can be validated
+            std::vector<value_type> values_input(size);
+            std::iota(values_input.begin(), values_input.end(), 0u);
+
+            const std::vector<key_type> expected = expected_topk<largest>(keys_input, k);
+
+            key_type*   d_keys_input;
+            value_type* d_values_input;
+            key_type*   d_keys_output;
+            value_type* d_values_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                         size * sizeof(*d_keys_input)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         size * sizeof(*d_values_input)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                         expected.size() * sizeof(*d_keys_output)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_output,
+                                                   expected.size() * sizeof(*d_values_output)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(*d_keys_input),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(*d_values_input),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(invoke_topk_pairs<largest, config>(d_temp_storage,
+                                                          temp_storage_size_bytes,
+                                                          d_keys_input,
+                                                          d_values_input,
+                                                          d_keys_output,
+                                                          d_values_output,
+                                                          size,
+                                                          k,
+                                                          stream,
+                                                          debug_synchronous));
+
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(invoke_topk_pairs<largest, config>(d_temp_storage,
+                                                          temp_storage_size_bytes,
+                                                          d_keys_input,
+                                                          d_values_input,
+                                                          d_keys_output,
+                                                          d_values_output,
+                                                          size,
+                                                          k,
+                                                          stream,
+                                                          debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<key_type>   keys_output(expected.size());
+            std::vector<value_type> values_output(expected.size());
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                keys_output.size() * sizeof(*d_keys_output),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                values_output.size() * sizeof(*d_values_output),
+                                hipMemcpyDeviceToHost));
+
+            // Every selected value must belong to its key and be selected only once
+            for(size_t i = 0; i < keys_output.size(); ++i)
+            {
+                ASSERT_LT(values_output[i], size);
+                ASSERT_NO_FATAL_FAILURE(
+                    test_utils::assert_eq(keys_output[i], keys_input[values_output[i]]));
+            }
+            std::vector<value_type> sorted_values(values_output);
+            std::sort(sorted_values.begin(), sorted_values.end());
+            ASSERT_TRUE(std::adjacent_find(sorted_values.begin(), sorted_values.end())
+                        == sorted_values.end());
+
+            sort_selection<largest>(keys_output);
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys_output, expected));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+// The selected pairs of every segment are compared in the expected order if Sorted is set.
+template<class TestFixture, bool Sorted>
+void run_segmented_topk_pairs_test(const bool debug_synchronous)
+{
+    using key_type                   = typename TestFixture::key_type;
+    using value_type                 = unsigned int;
+    using config                     = typename TestFixture::config;
+    constexpr bool largest           = TestFixture::largest;
+
+    const hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(unsigned int k : {1u, 10u, 256u})
+        {
+            SCOPED_TRACE(testing::Message() << "with k = " << k);
+
+            // Segment lengths span segments that are smaller and larger than k, and segments
+            // that are selected by warps, by blocks and by several blocks
+            std::vector<size_t> segment_lengths
+                = test_utils::get_random_data<size_t>(100, 0, 3000, seed_value);
+            segment_lengths[10] = 50000;
+            segment_lengths[50] = 150000;
+            const unsigned int segments = static_cast<unsigned int>(segment_lengths.size());
+
+            std::vector<unsigned int> offsets(segments + 1, 0);
+            for(unsigned int i = 0; i < segments; ++i)
+            {
+                offsets[i + 1] = offsets[i] + static_cast<unsigned int>(segment_lengths[i]);
+            }
+            const size_t size = offsets.back();
+
+            std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size,
+                                                        test_utils::generate_limits<key_type>::min(),
+                                                        test_utils::generate_limits<key_type>::max(),
+                                                        seed_value);
+            std::vector<value_type> values_input(size);
+            std::iota(values_input.begin(), values_input.end(), 0u);
+
+            key_type*     d_keys_input;
+            value_type*   d_values_input;
+            key_type*     d_keys_output;
+            value_type*   d_values_output;
+            unsigned int* d_offsets;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                         size * sizeof(*d_keys_input)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         size * sizeof(*d_values_input)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                         segments * k * sizeof(*d_keys_output)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                         segments * k * sizeof(*d_values_output)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(*d_offsets)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(*d_keys_input),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(*d_values_input),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(*d_offsets),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(invoke_segmented_topk_pairs<largest, Sorted, config>(d_temp_storage,
+                                                                    temp_storage_size_bytes,
+                                                                    d_keys_input,
+                                                                    d_values_input,
+                                                                    d_keys_output,
+                                                                    d_values_output,
+                                                                    segments,
+                                                                    d_offsets,
+                                                                    d_offsets + 1,
+                                                                    k,
+                                                                    stream,
+                                                                    debug_synchronous));
+
+            ASSERT_GT(temp_storage_size_bytes, 0);
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(invoke_segmented_topk_pairs<largest, Sorted, config>(d_temp_storage,
+                                                                    temp_storage_size_bytes,
+                                                                    d_keys_input,
+                                                                    d_values_input,
+                                                                    d_keys_output,
+                                                                    d_values_output,
+                                                                    segments,
+                                                                    d_offsets,
+                                                                    d_offsets + 1,
+                                                                    k,
+                                                                    stream,
+                                                                    debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<key_type>   keys_output(segments * k);
+            std::vector<value_type> values_output(segments * k);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                keys_output.size() * sizeof(*d_keys_output),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                values_output.size() * sizeof(*d_values_output),
+                                hipMemcpyDeviceToHost));
+
+            for(unsigned int segment = 0; segment < segments; ++segment)
+            {
+                SCOPED_TRACE(testing::Message() << "with segment = " << segment);
+
+                const std::vector<key_type> expected = expected_topk<largest>(
+                    std::vector<key_type>(keys_input.begin() + offsets[segment],
+                                          keys_input.begin() + offsets[segment + 1]),
+                    k);
+
+                const size_t output_offset = static_cast<size_t>(segment) * k;
+                std::vector<key_type> segment_output(keys_output.begin() + output_offset,
+                                                     keys_output.begin() + output_offset
+                                                         + expected.size());
+                for(size_t i = 0; i < expected.size(); ++i)
+                {
+                    const value_type value = values_output[output_offset + i];
+                    ASSERT_GE(value, offsets[segment]);
+                    ASSERT_LT(value, offsets[segment + 1]);
+                    ASSERT_NO_FATAL_FAILURE(
+                        test_utils::assert_eq(segment_output[i], keys_input[value]));
+                }
+
+                if(!Sorted)
+                {
+                    sort_selection<largest>(segment_output);
+                }
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(segment_output, expected));
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+TYPED_TEST(RocprimDeviceTopkTests, SegmentedTopkPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    run_segmented_topk_pairs_test<TestFixture, false>(this->debug_synchronous);
+}
+
+TYPED_TEST(RocprimDeviceTopkTests, SegmentedSortedTopkPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    run_segmented_topk_pairs_test<TestFixture, true>(this->debug_synchronous);
+}
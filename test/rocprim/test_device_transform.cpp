@@ -208,6 +208,111 @@ TYPED_TEST(RocprimDeviceTransformTests, Transform)
     }
 }
 
+TYPED_TEST(RocprimDeviceTransformTests, FutureSize)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+    using Config = size_limit_config_t<TestFixture::size_limit>;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto max_size : test_utils::get_sizes(seed_value))
+        {
+            hipStream_t stream = 0; // default
+            if (TestFixture::use_graphs)
+            {
+                // Default stream does not support hipGraph stream capture, so create one
+                HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+            }
+
+            // Only a part of the launch is valid, the size is known on the device only
+            const unsigned int size = static_cast<unsigned int>(max_size - max_size / 3);
+            SCOPED_TRACE(testing::Message() << "with max_size = " << max_size);
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Generate data
+            std::vector<T> input = test_utils::get_random_data<T>(max_size, 1, 100, seed_value);
+            std::vector<U> output(input.size(), (U)0);
+
+            T * d_input;
+            U * d_output;
+            unsigned int * d_size;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, input.size() * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, output.size() * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_size, sizeof(*d_size)));
+            HIP_CHECK(
+                hipMemcpy(
+                    d_input, input.data(),
+                    input.size() * sizeof(T),
+                    hipMemcpyHostToDevice
+                )
+            );
+            HIP_CHECK(hipMemcpy(d_output, output.data(), output.size() * sizeof(U), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_size, &size, sizeof(size), hipMemcpyHostToDevice));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Calculate expected results on host, the items past size are not written
+            std::vector<U> expected(input.size(), (U)0);
+            std::transform(input.begin(), input.begin() + size, expected.begin(), transform<U>());
+
+            test_utils::GraphHelper gHelper;
+            if(TestFixture::use_graphs)
+            {
+                gHelper.startStreamCapture(stream);
+            }
+
+            // Run
+            HIP_CHECK(
+                rocprim::transform<Config>(
+                    d_input,
+                    d_output,
+                    rocprim::future_value<unsigned int>{d_size},
+                    max_size, transform<U>(), stream, TestFixture::debug_synchronous
+                )
+            );
+
+            if(TestFixture::use_graphs)
+            {
+                gHelper.createAndLaunchGraph(stream, true, false);
+            }
+
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Copy output to host
+            HIP_CHECK(
+                hipMemcpy(
+                    output.data(), d_output,
+                    output.size() * sizeof(U),
+                    hipMemcpyDeviceToHost
+                )
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+
+            // Check if output values are as expected
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_near(output, expected, test_utils::precision<U>));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_size));
+
+            if (TestFixture::use_graphs)
+            {
+                gHelper.cleanupGraphHelper();
+                HIP_CHECK(hipStreamDestroy(stream));
+            }
+        }
+    }
+}
+
 template<class T1, class T2, class U>
 struct binary_transform
 {
@@ -451,3 +556,203 @@ TEST(RocprimDeviceTransformTests, LargeIndicesWithGraphs)
 {
     testLargeIndices<true>();
 }
+
+template<class T, unsigned int BlockSize, unsigned int ItemsPerThread, unsigned int PrefetchTiles>
+void test_transform_prefetch()
+{
+    using Config = rocprim::
+        transform_config<BlockSize, ItemsPerThread, ROCPRIM_GRID_SIZE_LIMIT, PrefetchTiles>;
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::vector<size_t> sizes = test_utils::get_sizes(seed_value);
+        // Inputs of whole tiles, and with fewer tiles than buffers of a block
+        sizes.push_back(items_per_block * 3);
+        sizes.push_back(items_per_block * 1000);
+        sizes.push_back(items_per_block * 2 + 1);
+        for(auto size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            std::vector<T> expected(size);
+            std::transform(input.begin(), input.end(), expected.begin(), transform<T>());
+
+            HIP_CHECK(
+                rocprim::transform<Config>(d_input, d_output, size, transform<T>(), stream, false));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TEST(RocprimDeviceTransformTests, PrefetchTiles)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    test_transform_prefetch<int, 256, 8, 1>();
+    test_transform_prefetch<int, 128, 16, 2>();
+    test_transform_prefetch<uint8_t, 256, 16, 1>();
+    test_transform_prefetch<double, 64, 4, 3>();
+}
+
+struct axpy_transform
+{
+    __device__ __host__ inline
+    rocprim::tuple<float, int> operator()(const float x, const float y, const int a) const
+    {
+        return rocprim::make_tuple(a * x + y, a * 2);
+    }
+};
+
+struct positive_x
+{
+    __device__ __host__ inline
+    bool operator()(const float x, const float /*y*/, const int /*a*/) const
+    {
+        return x > 0.0f;
+    }
+};
+
+// The inputs are all pointers (vectorized blocked arrangement), or the last input is
+// a counting_iterator (striped arrangement)
+template<bool CountingInput, bool Masked>
+void test_multi_transform()
+{
+    using Config = rocprim::transform_config<256, 8>;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<float> x
+                = test_utils::get_random_data<float>(size, -50, 50, seed_value);
+            const std::vector<float> y
+                = test_utils::get_random_data<float>(size, -50, 50, seed_value + 1);
+            std::vector<int> a = test_utils::get_random_data<int>(size, -10, 10, seed_value + 2);
+            if(CountingInput)
+            {
+                std::iota(a.begin(), a.end(), -3);
+            }
+
+            float* d_x;
+            float* d_y;
+            int*   d_a;
+            float* d_z;
+            int*   d_a2;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_x, size * sizeof(float)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_y, size * sizeof(float)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_a, size * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_z, size * sizeof(float)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_a2, size * sizeof(int)));
+            HIP_CHECK(hipMemcpy(d_x, x.data(), size * sizeof(float), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_y, y.data(), size * sizeof(float), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_a, a.data(), size * sizeof(int), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemset(d_z, 0, size * sizeof(float)));
+            HIP_CHECK(hipMemset(d_a2, 0, size * sizeof(int)));
+
+            std::vector<float> expected_z(size, 0.0f);
+            std::vector<int>   expected_a2(size, 0);
+            for(size_t i = 0; i < size; i++)
+            {
+                if(!Masked || positive_x{}(x[i], y[i], a[i]))
+                {
+                    const auto result = axpy_transform{}(x[i], y[i], a[i]);
+                    expected_z[i]     = rocprim::get<0>(result);
+                    expected_a2[i]    = rocprim::get<1>(result);
+                }
+            }
+
+            const auto run = [&](auto a_input)
+            {
+                const auto inputs  = rocprim::make_tuple(d_x, d_y, a_input);
+                const auto outputs = rocprim::make_tuple(d_z, d_a2);
+                if(Masked)
+                {
+                    return rocprim::transform_if<Config>(inputs,
+                                                         outputs,
+                                                         size,
+                                                         axpy_transform{},
+                                                         positive_x{},
+                                                         stream);
+                }
+                return rocprim::transform<Config>(inputs, outputs, size, axpy_transform{}, stream);
+            };
+            if(CountingInput)
+            {
+                HIP_CHECK(run(rocprim::counting_iterator<int>(-3)));
+            }
+            else
+            {
+                HIP_CHECK(run(d_a));
+            }
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<float> z(size);
+            std::vector<int>   a2(size);
+            HIP_CHECK(hipMemcpy(z.data(), d_z, size * sizeof(float), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(a2.data(), d_a2, size * sizeof(int), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_near(z, expected_z, test_utils::precision<float>));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(a2, expected_a2));
+
+            HIP_CHECK(hipFree(d_x));
+            HIP_CHECK(hipFree(d_y));
+            HIP_CHECK(hipFree(d_a));
+            HIP_CHECK(hipFree(d_z));
+            HIP_CHECK(hipFree(d_a2));
+        }
+    }
+}
+
+TEST(RocprimDeviceTransformTests, MultiInputOutput)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    test_multi_transform<false, false>();
+    test_multi_transform<true, false>();
+}
+
+TEST(RocprimDeviceTransformTests, MultiInputOutputIf)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    test_multi_transform<false, true>();
+    test_multi_transform<true, true>();
+}
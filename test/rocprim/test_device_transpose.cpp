@@ -0,0 +1,199 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_transpose.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+template<class T, class Config>
+struct DeviceTransposeParams
+{
+    using type   = T;
+    using config = Config;
+};
+
+template<class Params>
+class RocprimDeviceTransposeTests : public ::testing::Test
+{
+public:
+    using type   = typename Params::type;
+    using config = typename Params::config;
+};
+
+using RocprimDeviceTransposeTestsParams
+    = ::testing::Types<DeviceTransposeParams<int, rocprim::default_config>,
+                       DeviceTransposeParams<uint8_t, rocprim::default_config>,
+                       DeviceTransposeParams<short, rocprim::transpose_config<16, 4>>,
+                       DeviceTransposeParams<double, rocprim::default_config>,
+                       DeviceTransposeParams<test_utils::custom_test_type<double>,
+                                             rocprim::default_config>>;
+
+TYPED_TEST_SUITE(RocprimDeviceTransposeTests, RocprimDeviceTransposeTestsParams);
+
+TYPED_TEST(RocprimDeviceTransposeTests, BatchedTranspose)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = typename TestFixture::type;
+    using Config = typename TestFixture::config;
+
+    const std::vector<std::pair<size_t, size_t>> shapes
+        = {{1, 1}, {1, 1000}, {1000, 1}, {3, 5}, {64, 64}, {100, 37}, {517, 1029}};
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const auto& shape : shapes)
+        {
+            for(const size_t batches : {size_t(1), size_t(7)})
+            {
+                const size_t rows    = shape.first;
+                const size_t columns = shape.second;
+                const size_t size    = rows * columns * batches;
+                SCOPED_TRACE(testing::Message() << "with rows = " << rows);
+                SCOPED_TRACE(testing::Message() << "with columns = " << columns);
+                SCOPED_TRACE(testing::Message() << "with batches = " << batches);
+
+                std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+                T* d_input;
+                T* d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+                HIP_CHECK(
+                    hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+                if(batches == 1)
+                {
+                    HIP_CHECK(rocprim::transpose<Config>(d_input, d_output, rows, columns));
+                }
+                else
+                {
+                    HIP_CHECK(rocprim::batched_transpose<Config>(d_input,
+                                                                 d_output,
+                                                                 rows,
+                                                                 columns,
+                                                                 batches));
+                }
+                HIP_CHECK(hipGetLastError());
+
+                std::vector<T> output(size);
+                HIP_CHECK(
+                    hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+                std::vector<T> expected(size);
+                for(size_t b = 0; b < batches; b++)
+                {
+                    const size_t offset = b * rows * columns;
+                    for(size_t r = 0; r < rows; r++)
+                    {
+                        for(size_t c = 0; c < columns; c++)
+                        {
+                            expected[offset + c * rows + r] = input[offset + r * columns + c];
+                        }
+                    }
+                }
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_output));
+            }
+        }
+    }
+}
+
+TEST(RocprimDeviceTransposeTests, AosToSoaRoundTrip)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = float;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            const size_t fields = 3;
+
+            std::vector<T> input
+                = test_utils::get_random_data<T>(size * fields, -100, 100, seed_value);
+
+            T* d_input;
+            T* d_soa;
+            T* d_aos;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * fields * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_soa, size * fields * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_aos, size * fields * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * fields * sizeof(T),
+                                hipMemcpyHostToDevice));
+
+            HIP_CHECK(rocprim::aos_to_soa(d_input, d_soa, size, fields));
+            HIP_CHECK(rocprim::soa_to_aos(d_soa, d_aos, size, fields));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> soa(size * fields);
+            std::vector<T> aos(size * fields);
+            HIP_CHECK(
+                hipMemcpy(soa.data(), d_soa, size * fields * sizeof(T), hipMemcpyDeviceToHost));
+            HIP_CHECK(
+                hipMemcpy(aos.data(), d_aos, size * fields * sizeof(T), hipMemcpyDeviceToHost));
+
+            std::vector<T> expected_soa(size * fields);
+            for(size_t i = 0; i < size; i++)
+            {
+                for(size_t f = 0; f < fields; f++)
+                {
+                    expected_soa[f * size + i] = input[i * fields + f];
+                }
+            }
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(soa, expected_soa));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(aos, input));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_soa));
+            HIP_CHECK(hipFree(d_aos));
+        }
+    }
+}
@@ -0,0 +1,148 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/diagnostics.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+
+void count_records(const rocprim::diagnostic_record& /*record*/, void* user_data)
+{
+    ++*static_cast<size_t*>(user_data);
+}
+
+} // namespace
+
+TEST(RocprimDiagnosticsTests, HostDiagnostics)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    rocprim::diagnostics_buffer diagnostics;
+    HIP_CHECK(diagnostics.create(64));
+    rocprim::set_diagnostics_buffer(&diagnostics);
+
+    const size_t size = 1 << 16;
+    int*         d_input;
+    int*         d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+
+    size_t storage_size;
+    HIP_CHECK(rocprim::reduce(nullptr, storage_size, d_input, d_output, size));
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+
+    size_t too_small = storage_size - 1;
+    ASSERT_EQ(rocprim::reduce(d_temp_storage, too_small, d_input, d_output, size),
+              hipErrorInvalidValue);
+
+    std::vector<rocprim::diagnostic_record> records;
+    ASSERT_EQ(diagnostics.poll(records), 1u);
+    ASSERT_EQ(records[0].code, rocprim::diagnostic_code::temporary_storage_too_small);
+    ASSERT_EQ(records[0].source, rocprim::diagnostic_source::host);
+    ASSERT_EQ(records[0].values[0], storage_size);
+    ASSERT_EQ(records[0].values[1], storage_size - 1);
+    // The records are only returned once
+    ASSERT_EQ(diagnostics.poll(records), 0u);
+
+    float* d_keys;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, 2 * size * sizeof(float)));
+    size_t sort_storage_size = 0;
+    ASSERT_EQ(
+        rocprim::radix_sort_keys(nullptr, sort_storage_size, d_keys, d_keys + size, size, 1, 32),
+        hipErrorInvalidValue);
+    records.clear();
+    ASSERT_EQ(diagnostics.poll(records), 1u);
+    ASSERT_EQ(records[0].code, rocprim::diagnostic_code::invalid_bit_range);
+    ASSERT_EQ(records[0].values[0], 1u);
+    ASSERT_EQ(records[0].values[1], 32u);
+
+    // Without a buffer nothing is recorded
+    rocprim::set_diagnostics_buffer(nullptr);
+    ASSERT_EQ(rocprim::reduce(d_temp_storage, too_small, d_input, d_output, size),
+              hipErrorInvalidValue);
+    ASSERT_EQ(diagnostics.poll(records), 0u);
+    ASSERT_EQ(diagnostics.dropped(), 0u);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_keys));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
+
+// The callback receives the new records after the next kernel launch
+TEST(RocprimDiagnosticsTests, Callback)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    rocprim::diagnostics_buffer diagnostics;
+    HIP_CHECK(diagnostics.create(64));
+    size_t callback_records = 0;
+    rocprim::set_diagnostics_buffer(&diagnostics, count_records, &callback_records);
+
+    const size_t size = 1 << 16;
+    int*         d_input;
+    int*         d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+
+    size_t storage_size;
+    HIP_CHECK(rocprim::inclusive_scan(nullptr, storage_size, d_input, d_output, size));
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+
+    size_t too_small = storage_size - 1;
+    ASSERT_EQ(rocprim::inclusive_scan(d_temp_storage, too_small, d_input, d_output, size),
+              hipErrorInvalidValue);
+    ASSERT_EQ(callback_records, 0u);
+
+    HIP_CHECK(rocprim::inclusive_scan(d_temp_storage, storage_size, d_input, d_output, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    ASSERT_EQ(callback_records, 1u);
+
+    // A correct scan does not wait long enough for a look-back timeout
+    std::vector<rocprim::diagnostic_record> records;
+    ASSERT_EQ(diagnostics.poll(records), 0u);
+
+    rocprim::set_diagnostics_buffer(nullptr);
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
@@ -0,0 +1,449 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_binary_search.hpp>
+#include <rocprim/device/device_find_first_of.hpp>
+#include <rocprim/device/device_histogram.hpp>
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/execution_budget.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <cstddef>
+
+TEST(RocprimExecutionBudgetTests, SetAndGet)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+
+    ASSERT_EQ(rocprim::get_stream_block_budget(stream), 0u);
+    HIP_CHECK(rocprim::set_stream_block_budget(stream, 8));
+    ASSERT_EQ(rocprim::get_stream_block_budget(stream), 8u);
+    // Other streams are not limited
+    ASSERT_EQ(rocprim::get_stream_block_budget(hipStreamDefault), 0u);
+    HIP_CHECK(rocprim::set_stream_block_budget(stream, 0));
+    ASSERT_EQ(rocprim::get_stream_block_budget(stream), 0u);
+
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+// Algorithms split into several launches, or launched with smaller grids, by a small budget give
+// the same results
+TEST(RocprimExecutionBudgetTests, Algorithms)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = unsigned int;
+
+    for(const unsigned int max_blocks : {1u, 3u, 64u})
+    {
+        SCOPED_TRACE(testing::Message() << "with max_blocks = " << max_blocks);
+
+        hipStream_t stream;
+        HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+        HIP_CHECK(rocprim::set_stream_block_budget(stream, max_blocks));
+
+        for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+        {
+            unsigned int seed_value
+                = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+            SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+            for(size_t size : test_utils::get_sizes(seed_value))
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+                const std::vector<T> input
+                    = test_utils::get_random_data<T>(size, 0, 1 << 20, seed_value);
+
+                std::vector<T> expected_sorted(input);
+                std::stable_sort(expected_sorted.begin(), expected_sorted.end());
+                std::vector<T> expected_scan(size);
+                std::partial_sum(input.begin(), input.end(), expected_scan.begin());
+                const T expected_sum = std::accumulate(input.begin(), input.end(), T(0));
+
+                constexpr unsigned int    bins = 256;
+                std::vector<unsigned int> expected_histogram(bins, 0);
+                for(const T value : input)
+                {
+                    ++expected_histogram[value / ((1 << 20) / bins)];
+                }
+
+                const size_t bytes = std::max<size_t>(size, 1) * sizeof(T);
+
+                T*            d_input;
+                T*            d_output;
+                T*            d_sum;
+                unsigned int* d_histogram;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, bytes));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, bytes));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_sum, sizeof(T)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_histogram,
+                                                             bins * sizeof(unsigned int)));
+                HIP_CHECK(
+                    hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+                const auto sort = [&](void* storage, size_t& storage_size)
+                {
+                    return rocprim::radix_sort_keys(storage,
+                                                    storage_size,
+                                                    d_input,
+                                                    d_output,
+                                                    size,
+                                                    0,
+                                                    8 * sizeof(T),
+                                                    stream);
+                };
+                const auto scan = [&](void* storage, size_t& storage_size)
+                {
+                    return rocprim::inclusive_scan(storage,
+                                                   storage_size,
+                                                   d_input,
+                                                   d_output,
+                                                   size,
+                                                   rocprim::plus<T>(),
+                                                   stream);
+                };
+                const auto reduce = [&](void* storage, size_t& storage_size)
+                {
+                    return rocprim::reduce(storage,
+                                           storage_size,
+                                           d_input,
+                                           d_sum,
+                                           T(0),
+                                           size,
+                                           rocprim::plus<T>(),
+                                           stream);
+                };
+                const auto histogram = [&](void* storage, size_t& storage_size)
+                {
+                    return rocprim::histogram_even(storage,
+                                                   storage_size,
+                                                   d_input,
+                                                   static_cast<unsigned int>(size),
+                                                   d_histogram,
+                                                   bins + 1,
+                                                   T(0),
+                                                   T(1 << 20),
+                                                   stream);
+                };
+
+                size_t sort_bytes;
+                size_t scan_bytes;
+                size_t reduce_bytes;
+                size_t histogram_bytes;
+                HIP_CHECK(sort(nullptr, sort_bytes));
+                HIP_CHECK(scan(nullptr, scan_bytes));
+                HIP_CHECK(reduce(nullptr, reduce_bytes));
+                HIP_CHECK(histogram(nullptr, histogram_bytes));
+                const size_t storage_bytes = std::max(
+                    {sort_bytes, scan_bytes, reduce_bytes, histogram_bytes, size_t(1)});
+
+                void* d_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_bytes));
+
+                std::vector<T> output(size);
+                T              sum;
+
+                HIP_CHECK(sort(d_storage, sort_bytes));
+                HIP_CHECK(hipStreamSynchronize(stream));
+                HIP_CHECK(
+                    hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_sorted));
+
+                HIP_CHECK(scan(d_storage, scan_bytes));
+                HIP_CHECK(hipStreamSynchronize(stream));
+                HIP_CHECK(
+                    hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_scan));
+
+                HIP_CHECK(reduce(d_storage, reduce_bytes));
+                HIP_CHECK(hipStreamSynchronize(stream));
+                HIP_CHECK(hipMemcpy(&sum, d_sum, sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_EQ(sum, expected_sum);
+
+                std::vector<unsigned int> output_histogram(bins);
+                HIP_CHECK(histogram(d_storage, histogram_bytes));
+                HIP_CHECK(hipStreamSynchronize(stream));
+                HIP_CHECK(hipMemcpy(output_histogram.data(),
+                                    d_histogram,
+                                    bins * sizeof(unsigned int),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(
+                    test_utils::assert_eq(output_histogram, expected_histogram));
+
+                HIP_CHECK(hipFree(d_storage));
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_output));
+                HIP_CHECK(hipFree(d_sum));
+                HIP_CHECK(hipFree(d_histogram));
+            }
+        }
+
+        HIP_CHECK(rocprim::set_stream_block_budget(stream, 0));
+        HIP_CHECK(hipStreamDestroy(stream));
+    }
+}
+
+// A stream that minimizes memory needs less temporary storage for large inputs, and gives the
+// same results
+TEST(RocprimExecutionBudgetTests, MinimizeMemory)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = unsigned int;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    ASSERT_EQ(rocprim::get_stream_execution_hint(stream), rocprim::execution_hint::none);
+
+    const size_t size = 3 * rocprim::minimize_memory_size_limit + 123;
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+
+    const auto sort = [&](void* storage, size_t& storage_size)
+    {
+        return rocprim::radix_sort_keys(storage,
+                                        storage_size,
+                                        d_input,
+                                        d_output,
+                                        size,
+                                        0,
+                                        8 * sizeof(T),
+                                        stream);
+    };
+    const auto scan = [&](void* storage, size_t& storage_size)
+    {
+        return rocprim::inclusive_scan(storage,
+                                       storage_size,
+                                       d_input,
+                                       d_output,
+                                       size,
+                                       rocprim::plus<T>(),
+                                       stream);
+    };
+
+    size_t sort_bytes;
+    size_t scan_bytes;
+    HIP_CHECK(sort(nullptr, sort_bytes));
+    HIP_CHECK(scan(nullptr, scan_bytes));
+
+    HIP_CHECK(rocprim::set_stream_execution_hint(stream, rocprim::execution_hint::minimize_memory));
+    ASSERT_EQ(rocprim::get_stream_execution_hint(stream),
+              rocprim::execution_hint::minimize_memory);
+    // Other streams are not affected
+    ASSERT_EQ(rocprim::get_stream_execution_hint(hipStreamDefault), rocprim::execution_hint::none);
+
+    size_t minimized_sort_bytes;
+    size_t minimized_scan_bytes;
+    HIP_CHECK(sort(nullptr, minimized_sort_bytes));
+    HIP_CHECK(scan(nullptr, minimized_scan_bytes));
+    ASSERT_LT(minimized_sort_bytes, sort_bytes);
+    ASSERT_LE(minimized_scan_bytes, scan_bytes);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 1 << 10, seed_value);
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        std::vector<T> expected_sorted(input);
+        std::sort(expected_sorted.begin(), expected_sorted.end());
+        std::vector<T> expected_scan(size);
+        std::partial_sum(input.begin(), input.end(), expected_scan.begin());
+
+        void* d_storage;
+        HIP_CHECK(test_common_utils::hipMallocHelper(
+            &d_storage,
+            std::max(minimized_sort_bytes, minimized_scan_bytes)));
+
+        std::vector<T> output(size);
+
+        HIP_CHECK(sort(d_storage, minimized_sort_bytes));
+        HIP_CHECK(hipStreamSynchronize(stream));
+        HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_sorted));
+
+        HIP_CHECK(scan(d_storage, minimized_scan_bytes));
+        HIP_CHECK(hipStreamSynchronize(stream));
+        HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_scan));
+
+        HIP_CHECK(hipFree(d_storage));
+    }
+
+    HIP_CHECK(rocprim::set_stream_execution_hint(stream, rocprim::execution_hint::none));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+TEST(RocprimExecutionBudgetTests, StreamInputs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = unsigned int;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    const rocprim::execution_hint hints
+        = rocprim::execution_hint::minimize_memory | rocprim::execution_hint::stream_inputs;
+    HIP_CHECK(rocprim::set_stream_execution_hint(stream, hints));
+    ASSERT_EQ(rocprim::get_stream_execution_hint(stream), hints);
+    ASSERT_EQ(hints & rocprim::execution_hint::stream_inputs,
+              rocprim::execution_hint::stream_inputs);
+
+    const size_t haystack_size = 1 << 12;
+    const size_t size          = (1 << 20) + 123;
+    const size_t keys_size     = 64;
+
+    T*      d_haystack;
+    T*      d_input;
+    T*      d_keys;
+    size_t* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_haystack, haystack_size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, keys_size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(size_t)));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::vector<T> haystack
+            = test_utils::get_random_data<T>(haystack_size, 0, 1 << 20, seed_value);
+        std::sort(haystack.begin(), haystack.end());
+        const std::vector<T> input
+            = test_utils::get_random_data<T>(size, 0, 1 << 20, seed_value + 1);
+        // The keys are not in the first half of the input
+        const std::vector<T> keys
+            = test_utils::get_random_data<T>(keys_size, 1 << 21, 1 << 22, seed_value + 2);
+        const size_t expected_position = size / 2 + 7;
+        const T      key               = keys[keys_size / 3];
+        HIP_CHECK(hipMemcpy(d_haystack,
+                            haystack.data(),
+                            haystack_size * sizeof(T),
+                            hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_keys, keys.data(), keys_size * sizeof(T), hipMemcpyHostToDevice));
+
+        std::vector<size_t> expected_bounds(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            expected_bounds[i]
+                = std::lower_bound(haystack.begin(), haystack.end(), input[i]) - haystack.begin();
+        }
+
+        size_t storage_size;
+        HIP_CHECK(rocprim::lower_bound(nullptr,
+                                       storage_size,
+                                       d_haystack,
+                                       d_input,
+                                       d_output,
+                                       haystack_size,
+                                       size,
+                                       rocprim::less<T>(),
+                                       stream));
+        void* d_storage;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_size));
+        HIP_CHECK(rocprim::lower_bound(d_storage,
+                                       storage_size,
+                                       d_haystack,
+                                       d_input,
+                                       d_output,
+                                       haystack_size,
+                                       size,
+                                       rocprim::less<T>(),
+                                       stream));
+        HIP_CHECK(hipStreamSynchronize(stream));
+        HIP_CHECK(hipFree(d_storage));
+
+        std::vector<size_t> bounds(size);
+        HIP_CHECK(
+            hipMemcpy(bounds.data(), d_output, size * sizeof(size_t), hipMemcpyDeviceToHost));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(bounds, expected_bounds));
+
+        HIP_CHECK(hipMemcpy(d_input + expected_position, &key, sizeof(T), hipMemcpyHostToDevice));
+        HIP_CHECK(rocprim::find_first_of(nullptr,
+                                         storage_size,
+                                         d_input,
+                                         d_keys,
+                                         d_output,
+                                         size,
+                                         keys_size,
+                                         rocprim::equal_to<T>(),
+                                         stream));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_size));
+        HIP_CHECK(rocprim::find_first_of(d_storage,
+                                         storage_size,
+                                         d_input,
+                                         d_keys,
+                                         d_output,
+                                         size,
+                                         keys_size,
+                                         rocprim::equal_to<T>(),
+                                         stream));
+        HIP_CHECK(hipStreamSynchronize(stream));
+        HIP_CHECK(hipFree(d_storage));
+
+        size_t position;
+        HIP_CHECK(hipMemcpy(&position, d_output, sizeof(size_t), hipMemcpyDeviceToHost));
+        ASSERT_EQ(position, expected_position);
+    }
+
+    HIP_CHECK(rocprim::set_stream_execution_hint(stream, rocprim::execution_hint::none));
+    HIP_CHECK(hipFree(d_haystack));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_keys));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipStreamDestroy(stream));
+}
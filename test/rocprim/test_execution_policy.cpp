@@ -0,0 +1,250 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/execution_policy.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <cstddef>
+
+TEST(RocprimExecutionPolicyTests, IsHostAccessible)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    int* d_ptr;
+    int* h_pinned;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_ptr, sizeof(int)));
+    HIP_CHECK(hipHostMalloc(&h_pinned, sizeof(int)));
+    std::vector<int> pageable(1);
+
+    bool accessible;
+    HIP_CHECK(rocprim::is_host_accessible(d_ptr, device_id, accessible));
+    ASSERT_FALSE(accessible);
+    HIP_CHECK(rocprim::is_host_accessible(h_pinned, device_id, accessible));
+    ASSERT_TRUE(accessible);
+    HIP_CHECK(rocprim::is_host_accessible(pageable.data(), device_id, accessible));
+    ASSERT_TRUE(accessible);
+
+    HIP_CHECK(hipFree(d_ptr));
+    HIP_CHECK(hipHostFree(h_pinned));
+}
+
+// All policies give the same results, on the host for small inputs in host memory.
+TEST(RocprimExecutionPolicyTests, ReduceAndScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    for(const rocprim::execution_policy policy : {rocprim::execution_policy::device,
+                                                  rocprim::execution_policy::host,
+                                                  rocprim::execution_policy::automatic})
+    {
+        SCOPED_TRACE(testing::Message() << "with policy = " << static_cast<int>(policy));
+
+        for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+        {
+            unsigned int seed_value
+                = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+            SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+            for(const size_t size : {size_t(0),
+                                     size_t(1),
+                                     size_t(1000),
+                                     rocprim::host_execution_size_limit,
+                                     rocprim::host_execution_size_limit + 1,
+                                     size_t(100000)})
+            {
+                SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+                const std::vector<T> input
+                    = test_utils::get_random_data<T>(size, -100, 100, seed_value);
+                const T initial_value = 5;
+
+                std::vector<T> expected_inclusive(size);
+                std::partial_sum(input.begin(), input.end(), expected_inclusive.begin());
+                std::vector<T> expected_exclusive(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected_exclusive[i]
+                        = initial_value + (i == 0 ? 0 : expected_inclusive[i - 1]);
+                }
+                const T expected_reduction
+                    = initial_value + (size == 0 ? 0 : expected_inclusive.back());
+
+                // Pinned host memory, so that the device can also read it
+                T* h_input;
+                T* h_output;
+                T* h_reduction;
+                HIP_CHECK(hipHostMalloc(&h_input, std::max<size_t>(size, 1) * sizeof(T)));
+                HIP_CHECK(hipHostMalloc(&h_output, std::max<size_t>(size, 1) * sizeof(T)));
+                HIP_CHECK(hipHostMalloc(&h_reduction, sizeof(T)));
+                std::copy(input.begin(), input.end(), h_input);
+
+                size_t reduce_storage_size;
+                size_t inclusive_storage_size;
+                size_t exclusive_storage_size;
+                HIP_CHECK(rocprim::reduce(policy,
+                                          nullptr,
+                                          reduce_storage_size,
+                                          h_input,
+                                          h_reduction,
+                                          initial_value,
+                                          size,
+                                          rocprim::plus<T>(),
+                                          stream));
+                HIP_CHECK(rocprim::inclusive_scan(policy,
+                                                  nullptr,
+                                                  inclusive_storage_size,
+                                                  h_input,
+                                                  h_output,
+                                                  size,
+                                                  rocprim::plus<T>(),
+                                                  stream));
+                HIP_CHECK(rocprim::exclusive_scan(policy,
+                                                  nullptr,
+                                                  exclusive_storage_size,
+                                                  h_input,
+                                                  h_output,
+                                                  initial_value,
+                                                  size,
+                                                  rocprim::plus<T>(),
+                                                  stream));
+                ASSERT_GT(reduce_storage_size, 0);
+                ASSERT_GT(inclusive_storage_size, 0);
+                ASSERT_GT(exclusive_storage_size, 0);
+                const size_t storage_size = std::max(
+                    {reduce_storage_size, inclusive_storage_size, exclusive_storage_size});
+
+                void* d_temp_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+
+                HIP_CHECK(rocprim::reduce(policy,
+                                          d_temp_storage,
+                                          reduce_storage_size,
+                                          h_input,
+                                          h_reduction,
+                                          initial_value,
+                                          size,
+                                          rocprim::plus<T>(),
+                                          stream));
+                HIP_CHECK(hipStreamSynchronize(stream));
+                ASSERT_EQ(*h_reduction, expected_reduction);
+
+                HIP_CHECK(rocprim::inclusive_scan(policy,
+                                                  d_temp_storage,
+                                                  inclusive_storage_size,
+                                                  h_input,
+                                                  h_output,
+                                                  size,
+                                                  rocprim::plus<T>(),
+                                                  stream));
+                HIP_CHECK(hipStreamSynchronize(stream));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(
+                    std::vector<T>(h_output, h_output + size), expected_inclusive));
+
+                HIP_CHECK(rocprim::exclusive_scan(policy,
+                                                  d_temp_storage,
+                                                  exclusive_storage_size,
+                                                  h_input,
+                                                  h_output,
+                                                  initial_value,
+                                                  size,
+                                                  rocprim::plus<T>(),
+                                                  stream));
+                HIP_CHECK(hipStreamSynchronize(stream));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(
+                    std::vector<T>(h_output, h_output + size), expected_exclusive));
+
+                HIP_CHECK(hipFree(d_temp_storage));
+                HIP_CHECK(hipHostFree(h_input));
+                HIP_CHECK(hipHostFree(h_output));
+                HIP_CHECK(hipHostFree(h_reduction));
+            }
+        }
+    }
+
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+// The automatic policy runs on the device for device memory.
+TEST(RocprimExecutionPolicyTests, AutomaticDeviceMemory)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    const size_t   size = 1000;
+    std::vector<T> input(size);
+    std::iota(input.begin(), input.end(), 0);
+    std::vector<T> expected(size);
+    std::partial_sum(input.begin(), input.end(), expected.begin());
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    size_t storage_size;
+    HIP_CHECK(rocprim::inclusive_scan(rocprim::execution_policy::automatic,
+                                      nullptr,
+                                      storage_size,
+                                      d_input,
+                                      d_output,
+                                      size));
+    void* d_temp_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, storage_size));
+    HIP_CHECK(rocprim::inclusive_scan(rocprim::execution_policy::automatic,
+                                      d_temp_storage,
+                                      storage_size,
+                                      d_input,
+                                      d_output,
+                                      size));
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<T> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_temp_storage));
+}
@@ -0,0 +1,276 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/type_traits.hpp>
+#include <rocprim/types.hpp>
+
+// required test headers
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <cstddef>
+
+template<class T>
+class RocprimFp8Tests : public ::testing::Test
+{
+public:
+    using type = T;
+};
+
+using RocprimFp8TestsTypes = ::testing::Types<rocprim::fp8_e4m3, rocprim::fp8_e5m2>;
+
+TYPED_TEST_SUITE(RocprimFp8Tests, RocprimFp8TestsTypes);
+
+template<class T>
+std::vector<unsigned char> to_bits(const std::vector<T>& values)
+{
+    std::vector<unsigned char> bits(values.size());
+    std::transform(values.begin(),
+                   values.end(),
+                   bits.begin(),
+                   [](const T value) { return value.bits(); });
+    return bits;
+}
+
+// Random finite values from the encodings, so that every value of the format is covered
+template<class T>
+std::vector<T> get_random_finite_data(const size_t size, const unsigned int seed_value)
+{
+    const std::vector<unsigned char> bits
+        = test_utils::get_random_data<unsigned char>(size, 0, 255, seed_value);
+    std::vector<T> values(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        values[i] = T::from_bits(bits[i]);
+        if(!std::isfinite(static_cast<float>(values[i])))
+        {
+            values[i] = T::from_bits(bits[i] & 0xF0);
+        }
+    }
+    return values;
+}
+
+TYPED_TEST(RocprimFp8Tests, Conversions)
+{
+    using T      = typename TestFixture::type;
+    using limits = rocprim::numeric_limits<T>;
+
+    for(unsigned int bits = 0; bits < 256; bits++)
+    {
+        SCOPED_TRACE(testing::Message() << "with bits = " << bits);
+        const float value = T::from_bits(static_cast<unsigned char>(bits));
+        if(std::isnan(value))
+        {
+            ASSERT_TRUE(std::isnan(static_cast<float>(T(value))));
+        }
+        else
+        {
+            ASSERT_EQ(T(value).bits(), bits);
+        }
+    }
+
+    // Ties round to the even encoding
+    const float one   = 1.0f;
+    const float next  = T::from_bits(T(one).bits() + 1);
+    const float after = T::from_bits(T(one).bits() + 2);
+    ASSERT_EQ(static_cast<float>(T((one + next) / 2)), one);
+    ASSERT_EQ(static_cast<float>(T((next + after) / 2)), after);
+
+    // Out of range values saturate
+    ASSERT_EQ(static_cast<float>(T(1e10f)), static_cast<float>(limits::max()));
+    ASSERT_EQ(static_cast<float>(T(-1e10f)), static_cast<float>(limits::lowest()));
+    ASSERT_EQ(static_cast<float>(T(0.25f * static_cast<float>(limits::denorm_min()))), 0.0f);
+    ASSERT_TRUE(std::isnan(static_cast<float>(T(std::numeric_limits<float>::quiet_NaN()))));
+    if(limits::has_infinity)
+    {
+        ASSERT_TRUE(std::isinf(static_cast<float>(T(std::numeric_limits<float>::infinity()))));
+    }
+    else
+    {
+        ASSERT_EQ(static_cast<float>(T(std::numeric_limits<float>::infinity())),
+                  static_cast<float>(limits::max()));
+    }
+
+    ASSERT_EQ(static_cast<float>(limits::epsilon()), next - one);
+    ASSERT_EQ(static_cast<float>(limits::max()),
+              std::is_same<T, rocprim::fp8_e4m3>::value ? 448.0f : 57344.0f);
+}
+
+TYPED_TEST(RocprimFp8Tests, RadixSortKeys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::type;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = get_random_finite_data<T>(size, seed_value);
+
+            // -0.0 and +0.0 are equal, the sort is stable
+            std::vector<T> expected = input;
+            std::stable_sort(expected.begin(),
+                             expected.end(),
+                             [](const T a, const T b)
+                             { return static_cast<float>(a) < static_cast<float>(b); });
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t storage_size = 0;
+            HIP_CHECK(rocprim::radix_sort_keys(nullptr, storage_size, d_input, d_output, size));
+            void* d_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_size));
+            HIP_CHECK(rocprim::radix_sort_keys(d_storage, storage_size, d_input, d_output, size));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(to_bits(output), to_bits(expected)));
+
+            HIP_CHECK(hipFree(d_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+// FP8 in, FP32 accumulate. The inputs are small integers, so the sums are exact in float
+TYPED_TEST(RocprimFp8Tests, WidenedReduceAndScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::type;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(auto size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<int> integers
+                = test_utils::get_random_data<int>(size, -8, 8, seed_value);
+            std::vector<T>     input(size);
+            std::vector<float> expected_scan(size);
+            float              sum = 0.0f;
+            for(size_t i = 0; i < size; i++)
+            {
+                input[i] = T(static_cast<float>(integers[i]));
+                sum += static_cast<float>(input[i]);
+                expected_scan[i] = sum;
+            }
+
+            T*     d_input;
+            float* d_output;
+            // The reduction writes the initial value when the input is empty
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, (size + 1) * sizeof(float)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t storage_size = 0;
+            HIP_CHECK(rocprim::reduce(nullptr,
+                                      storage_size,
+                                      d_input,
+                                      d_output,
+                                      0.0f,
+                                      size,
+                                      rocprim::plus<float>{}));
+            void* d_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_size));
+            HIP_CHECK(rocprim::reduce(d_storage,
+                                      storage_size,
+                                      d_input,
+                                      d_output,
+                                      0.0f,
+                                      size,
+                                      rocprim::plus<float>{}));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipFree(d_storage));
+
+            float reduced;
+            HIP_CHECK(hipMemcpy(&reduced, d_output, sizeof(float), hipMemcpyDeviceToHost));
+            ASSERT_EQ(reduced, sum);
+
+            storage_size = 0;
+            HIP_CHECK((rocprim::inclusive_scan<rocprim::default_config,
+                                               T*,
+                                               float*,
+                                               rocprim::plus<float>,
+                                               float>(nullptr,
+                                                      storage_size,
+                                                      d_input,
+                                                      d_output,
+                                                      size,
+                                                      rocprim::plus<float>{})));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_size));
+            HIP_CHECK((rocprim::inclusive_scan<rocprim::default_config,
+                                               T*,
+                                               float*,
+                                               rocprim::plus<float>,
+                                               float>(d_storage,
+                                                      storage_size,
+                                                      d_input,
+                                                      d_output,
+                                                      size,
+                                                      rocprim::plus<float>{})));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipFree(d_storage));
+
+            std::vector<float> output(size);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(float), hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected_scan));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
@@ -0,0 +1,468 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/decoupled_lookback.hpp>
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/instrumentation.hpp>
+#include <rocprim/device/work_queue.hpp>
+
+// required test headers
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+
+struct launch_record
+{
+    std::vector<rocprim::kernel_launch_info> launches;
+};
+
+void record_launch(const rocprim::kernel_launch_info& info, void* user_data)
+{
+    static_cast<launch_record*>(user_data)->launches.push_back(info);
+}
+
+struct concurrent_launch_record
+{
+    std::atomic<size_t> calls{0};
+    std::atomic<size_t> calls_after_removal{0};
+    std::atomic<bool>   removed{false};
+};
+
+void record_concurrent_launch(const rocprim::kernel_launch_info&, void* user_data)
+{
+    auto& record = *static_cast<concurrent_launch_record*>(user_data);
+    // Keep the call running for a while, so a removal that doesn't wait for it is noticed
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+    if(record.removed.load())
+    {
+        ++record.calls_after_removal;
+    }
+    ++record.calls;
+}
+
+} // namespace
+
+TEST(RocprimInstrumentationTests, KernelLaunchCallback)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = unsigned int;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    const size_t         size  = 1 << 20;
+    const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 1 << 30, 0);
+
+    T* d_input;
+    T* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    size_t storage_bytes;
+    HIP_CHECK(rocprim::radix_sort_keys(nullptr,
+                                       storage_bytes,
+                                       d_input,
+                                       d_output,
+                                       size,
+                                       0,
+                                       8 * sizeof(T),
+                                       stream));
+    void* d_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_bytes));
+
+    launch_record record;
+    rocprim::set_kernel_launch_callback(&record_launch, &record);
+    HIP_CHECK(rocprim::radix_sort_keys(d_storage,
+                                       storage_bytes,
+                                       d_input,
+                                       d_output,
+                                       size,
+                                       0,
+                                       8 * sizeof(T),
+                                       stream));
+    rocprim::set_kernel_launch_callback(nullptr);
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    ASSERT_FALSE(record.launches.empty());
+    for(const rocprim::kernel_launch_info& info : record.launches)
+    {
+        ASSERT_NE(info.name, nullptr);
+        ASSERT_EQ(info.stream, stream);
+    }
+
+    // No calls after the callback is removed
+    const size_t launch_count = record.launches.size();
+    HIP_CHECK(rocprim::radix_sort_keys(d_storage,
+                                       storage_bytes,
+                                       d_input,
+                                       d_output,
+                                       size,
+                                       0,
+                                       8 * sizeof(T),
+                                       stream));
+    HIP_CHECK(hipStreamSynchronize(stream));
+    ASSERT_EQ(record.launches.size(), launch_count);
+
+    HIP_CHECK(hipFree(d_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+TEST(RocprimInstrumentationTests, KernelLaunchCallbackPublicBuildingBlocks)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = unsigned int;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    using lookback_type      = rocprim::decoupled_lookback<T, rocprim::plus<T>>;
+    const unsigned int tiles = 100;
+
+    size_t lookback_storage_size;
+    HIP_CHECK(lookback_type::get_temp_storage_size(tiles, stream, lookback_storage_size));
+    void* d_lookback_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_lookback_storage, lookback_storage_size));
+    lookback_type lookback;
+    HIP_CHECK(
+        lookback_type::create(lookback, d_lookback_storage, lookback_storage_size, tiles, stream));
+
+    using queue_type            = rocprim::work_queue<T>;
+    const unsigned int capacity = 1000;
+    const unsigned int roots    = 10;
+
+    size_t queue_storage_size;
+    HIP_CHECK(queue_type::get_temp_storage_size(capacity, queue_storage_size));
+    void* d_queue_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_queue_storage, queue_storage_size));
+    T* d_roots;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_roots, roots * sizeof(T)));
+    HIP_CHECK(hipMemset(d_roots, 0, roots * sizeof(T)));
+    queue_type queue;
+    HIP_CHECK(queue_type::create(queue, d_queue_storage, queue_storage_size, capacity));
+
+    // The kernels launched by the building blocks are reported like those of the algorithms
+    launch_record record;
+    rocprim::set_kernel_launch_callback(&record_launch, &record);
+    HIP_CHECK(lookback.initialize(stream));
+    HIP_CHECK(queue.initialize(d_roots, roots, stream));
+    rocprim::set_kernel_launch_callback(nullptr);
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    ASSERT_EQ(record.launches.size(), 2u);
+    ASSERT_EQ(std::string(record.launches[0].name), "init_lookback_scan_state_kernel");
+    ASSERT_EQ(record.launches[0].size, tiles);
+    ASSERT_EQ(std::string(record.launches[1].name), "init_work_queue_kernel");
+    ASSERT_EQ(record.launches[1].size, roots);
+    for(const rocprim::kernel_launch_info& info : record.launches)
+    {
+        ASSERT_EQ(info.stream, stream);
+    }
+
+    HIP_CHECK(hipFree(d_roots));
+    HIP_CHECK(hipFree(d_queue_storage));
+    HIP_CHECK(hipFree(d_lookback_storage));
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+TEST(RocprimInstrumentationTests, KernelTimer)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = unsigned int;
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t storage_bytes;
+            HIP_CHECK(rocprim::reduce(nullptr,
+                                      storage_bytes,
+                                      d_input,
+                                      d_output,
+                                      T(0),
+                                      size,
+                                      rocprim::plus<T>(),
+                                      stream));
+            void* d_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_bytes));
+
+            rocprim::kernel_timer timer;
+            HIP_CHECK(timer.start(stream));
+            HIP_CHECK(rocprim::reduce(d_storage,
+                                      storage_bytes,
+                                      d_input,
+                                      d_output,
+                                      T(0),
+                                      size,
+                                      rocprim::plus<T>(),
+                                      stream));
+            std::vector<rocprim::kernel_timer::entry> entries;
+            HIP_CHECK(timer.stop(entries));
+
+            ASSERT_FALSE(entries.empty());
+            for(const rocprim::kernel_timer::entry& entry : entries)
+            {
+                ASSERT_FALSE(entry.name.empty());
+                ASSERT_GE(entry.milliseconds, 0.0f);
+            }
+            // The first kernel of a reduction reads the input
+            ASSERT_LE(entries.front().size, size);
+
+            // Stopping twice is an error
+            ASSERT_EQ(timer.stop(entries), hipErrorInvalidValue);
+
+            HIP_CHECK(hipFree(d_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+TEST(RocprimInstrumentationTests, KernelLaunchCallbackConcurrentLaunches)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = unsigned int;
+
+    const size_t       size         = 1 << 16;
+    const unsigned int thread_count = 4;
+    const unsigned int round_count  = 20;
+
+    const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, 0);
+
+    std::atomic<bool>        stop_launching{false};
+    std::vector<std::thread> threads;
+    for(unsigned int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                HIP_CHECK(hipSetDevice(device_id));
+                hipStream_t stream;
+                HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+                T* d_input;
+                T* d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+                HIP_CHECK(
+                    hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+                size_t storage_bytes;
+                HIP_CHECK(rocprim::reduce(nullptr,
+                                          storage_bytes,
+                                          d_input,
+                                          d_output,
+                                          T(0),
+                                          size,
+                                          rocprim::plus<T>(),
+                                          stream));
+                void* d_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_bytes));
+
+                while(!stop_launching.load())
+                {
+                    HIP_CHECK(rocprim::reduce(d_storage,
+                                              storage_bytes,
+                                              d_input,
+                                              d_output,
+                                              T(0),
+                                              size,
+                                              rocprim::plus<T>(),
+                                              stream));
+                    HIP_CHECK(hipStreamSynchronize(stream));
+                }
+
+                HIP_CHECK(hipFree(d_storage));
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_output));
+                HIP_CHECK(hipStreamDestroy(stream));
+            });
+    }
+
+    // Each round sets a callback with new user data and removes it while the other threads keep
+    // launching, the removal must wait for the running calls
+    size_t calls = 0;
+    for(unsigned int round = 0; round < round_count; ++round)
+    {
+        concurrent_launch_record record;
+        rocprim::set_kernel_launch_callback(&record_concurrent_launch, &record);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        rocprim::set_kernel_launch_callback(nullptr);
+        record.removed.store(true);
+
+        // Calls that were running during the removal would record themselves after it
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ASSERT_EQ(record.calls_after_removal.load(), 0u);
+        calls += record.calls.load();
+    }
+
+    stop_launching.store(true);
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_GT(calls, 0u);
+}
+
+TEST(RocprimInstrumentationTests, KernelTimerConcurrentLaunches)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = unsigned int;
+
+    const size_t       size         = 1 << 16;
+    const unsigned int thread_count = 4;
+    const unsigned int round_count  = 20;
+
+    const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, 0);
+
+    // Every thread launches on its own stream, the timer of each round measures a stream of the
+    // main thread and is destroyed while the other threads keep launching
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    std::atomic<bool>        stop_launching{false};
+    std::vector<std::thread> threads;
+    for(unsigned int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                HIP_CHECK(hipSetDevice(device_id));
+                hipStream_t thread_stream;
+                HIP_CHECK(hipStreamCreateWithFlags(&thread_stream, hipStreamNonBlocking));
+
+                T* d_input;
+                T* d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+                HIP_CHECK(
+                    hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+                size_t storage_bytes;
+                HIP_CHECK(rocprim::reduce(nullptr,
+                                          storage_bytes,
+                                          d_input,
+                                          d_output,
+                                          T(0),
+                                          size,
+                                          rocprim::plus<T>(),
+                                          thread_stream));
+                void* d_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_bytes));
+
+                while(!stop_launching.load())
+                {
+                    HIP_CHECK(rocprim::reduce(d_storage,
+                                              storage_bytes,
+                                              d_input,
+                                              d_output,
+                                              T(0),
+                                              size,
+                                              rocprim::plus<T>(),
+                                              thread_stream));
+                    HIP_CHECK(hipStreamSynchronize(thread_stream));
+                }
+
+                HIP_CHECK(hipFree(d_storage));
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_output));
+                HIP_CHECK(hipStreamDestroy(thread_stream));
+            });
+    }
+
+    for(unsigned int round = 0; round < round_count; ++round)
+    {
+        rocprim::kernel_timer timer;
+        HIP_CHECK(timer.start(stream));
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if(round % 2 == 0)
+        {
+            std::vector<rocprim::kernel_timer::entry> entries;
+            HIP_CHECK(timer.stop(entries));
+            // Only launches on the stream of the timer are measured
+            ASSERT_TRUE(entries.empty());
+        }
+        // Otherwise the destructor stops the timer
+    }
+
+    stop_launching.store(true);
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    HIP_CHECK(hipStreamDestroy(stream));
+}
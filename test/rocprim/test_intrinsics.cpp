@@ -23,12 +23,14 @@
 #include "../common_test_header.hpp"
 
 // required rocprim headers
+#include <rocprim/intrinsics/atomic.hpp>
 #include <rocprim/intrinsics/thread.hpp>
 #include <rocprim/intrinsics/warp_shuffle.hpp>
 
 // required test headers
 #include "test_utils_types.hpp"
 
+#include <algorithm>
 #include <bitset>
 #include <random>
 
@@ -1297,3 +1299,132 @@ TEST(RocprimIntrinsicsTests, GroupElect)
     HIP_CHECK(hipFree(d_input));
     HIP_CHECK(hipFree(d_output));
 }
+
+constexpr unsigned int warp_aggregated_atomic_label_bits = 4;
+
+__global__ void warp_aggregated_atomic_add_kernel(unsigned int*       counters,
+                                                  const unsigned int* labels,
+                                                  unsigned int*       output,
+                                                  bool                by_address)
+{
+    const unsigned int index = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int label = labels[index];
+    const bool         valid = label < (1u << warp_aggregated_atomic_label_bits);
+
+    unsigned int offset = 0;
+    if(by_address)
+    {
+        // Only the valid lanes are active
+        if(valid)
+        {
+            offset = rocprim::warp_aggregated_atomic_add(&counters[label], 1u);
+        }
+    }
+    else
+    {
+        offset = rocprim::warp_aggregated_atomic_add<warp_aggregated_atomic_label_bits>(counters,
+                                                                                        label,
+                                                                                        1u,
+                                                                                        valid);
+    }
+    output[index] = offset;
+}
+
+TEST(RocprimIntrinsicsTests, WarpAggregatedAtomicAdd)
+{
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int labels_count = 1u << warp_aggregated_atomic_label_bits;
+    const size_t           block_size   = 256;
+    const size_t           blocks       = 37;
+    const size_t           size         = blocks * block_size;
+
+    unsigned int* d_counters;
+    unsigned int* d_labels;
+    unsigned int* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_counters, labels_count * sizeof(unsigned int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_labels, size * sizeof(unsigned int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(unsigned int)));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Labels past the last counter mark invalid lanes
+        const std::vector<unsigned int> labels
+            = test_utils::get_random_data<unsigned int>(size, 0, labels_count + 2, seed_value);
+        HIP_CHECK(hipMemcpy(d_labels,
+                            labels.data(),
+                            size * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        std::vector<unsigned int> expected_counters(labels_count, 0);
+        for(const unsigned int label : labels)
+        {
+            if(label < labels_count)
+            {
+                expected_counters[label]++;
+            }
+        }
+
+        for(const bool by_address : {false, true})
+        {
+            SCOPED_TRACE(testing::Message() << "with by_address = " << by_address);
+
+            HIP_CHECK(hipMemset(d_counters, 0, labels_count * sizeof(unsigned int)));
+            hipLaunchKernelGGL(warp_aggregated_atomic_add_kernel,
+                               dim3(blocks),
+                               dim3(block_size),
+                               0,
+                               hipStreamDefault,
+                               d_counters,
+                               d_labels,
+                               d_output,
+                               by_address);
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<unsigned int> counters(labels_count);
+            std::vector<unsigned int> output(size);
+            HIP_CHECK(hipMemcpy(counters.data(),
+                                d_counters,
+                                labels_count * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                size * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(counters, expected_counters));
+
+            // The lanes adding to a counter receive distinct offsets 0, 1, ..., count - 1
+            std::vector<std::vector<unsigned int>> offsets(labels_count);
+            for(size_t i = 0; i < size; i++)
+            {
+                if(labels[i] < labels_count)
+                {
+                    offsets[labels[i]].push_back(output[i]);
+                }
+                else
+                {
+                    ASSERT_EQ(output[i], 0u) << "with index = " << i;
+                }
+            }
+            for(unsigned int label = 0; label < labels_count; label++)
+            {
+                std::sort(offsets[label].begin(), offsets[label].end());
+                for(size_t i = 0; i < offsets[label].size(); i++)
+                {
+                    ASSERT_EQ(offsets[label][i], i) << "with label = " << label;
+                }
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(d_counters));
+    HIP_CHECK(hipFree(d_labels));
+    HIP_CHECK(hipFree(d_output));
+}
@@ -0,0 +1,134 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_scan.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <numeric>
+#include <vector>
+
+#include <cstddef>
+
+template<class Backoff, bool Persistent = false>
+struct RocprimLookbackBackoffParams
+{
+    using backoff                    = Backoff;
+    static constexpr bool persistent = Persistent;
+};
+
+template<class Params>
+class RocprimLookbackBackoffTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using RocprimLookbackBackoffTestsParams = ::testing::Types<
+    RocprimLookbackBackoffParams<rocprim::lookback_backoff_config<>>,
+    RocprimLookbackBackoffParams<rocprim::lookback_backoff_none>,
+    RocprimLookbackBackoffParams<rocprim::lookback_backoff_fixed<4>>,
+    RocprimLookbackBackoffParams<rocprim::lookback_backoff_exponential<1, 64>>,
+    RocprimLookbackBackoffParams<rocprim::lookback_backoff_yield_after<8, 2>>,
+    RocprimLookbackBackoffParams<rocprim::lookback_backoff_exponential<>, true>>;
+
+TYPED_TEST_SUITE(RocprimLookbackBackoffTests, RocprimLookbackBackoffTestsParams);
+
+TYPED_TEST(RocprimLookbackBackoffTests, InclusiveScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = unsigned int;
+    using config = rocprim::scan_config<256,
+                                        8,
+                                        rocprim::block_load_method::block_load_transpose,
+                                        rocprim::block_store_method::block_store_transpose,
+                                        rocprim::block_scan_algorithm::using_warp_scan,
+                                        ROCPRIM_GRID_SIZE_LIMIT,
+                                        TestFixture::params::persistent,
+                                        typename TestFixture::params::backoff>;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size == 0)
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+            std::vector<T>       expected(size);
+            std::partial_sum(input.begin(), input.end(), expected.begin());
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t storage_bytes;
+            HIP_CHECK(rocprim::inclusive_scan<config>(nullptr,
+                                                      storage_bytes,
+                                                      d_input,
+                                                      d_output,
+                                                      size,
+                                                      rocprim::plus<T>(),
+                                                      stream));
+            void* d_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_bytes));
+
+            HIP_CHECK(rocprim::inclusive_scan<config>(d_storage,
+                                                      storage_bytes,
+                                                      d_input,
+                                                      d_output,
+                                                      size,
+                                                      rocprim::plus<T>(),
+                                                      stream));
+            HIP_CHECK(hipStreamSynchronize(stream));
+
+            std::vector<T> output(size);
+            HIP_CHECK(
+                hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
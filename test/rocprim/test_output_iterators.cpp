@@ -0,0 +1,376 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/block/block_store.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/scatter_output_iterator.hpp>
+#include <rocprim/iterator/tee_iterator.hpp>
+#include <rocprim/iterator/transform_output_iterator.hpp>
+
+// required test headers
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+template<class Input, class Output>
+struct RocprimOutputIteratorParams
+{
+    using input_type  = Input;
+    using output_type = Output;
+};
+
+template<class Params>
+class RocprimOutputIteratorTests : public ::testing::Test
+{
+public:
+    using input_type  = typename Params::input_type;
+    using output_type = typename Params::output_type;
+};
+
+using RocprimOutputIteratorTestsParams
+    = ::testing::Types<RocprimOutputIteratorParams<int, int>,
+                       RocprimOutputIteratorParams<int, double>,
+                       RocprimOutputIteratorParams<float, int>,
+                       RocprimOutputIteratorParams<unsigned char, unsigned int>,
+                       RocprimOutputIteratorParams<double, float>,
+                       RocprimOutputIteratorParams<test_utils::custom_test_type<int>,
+                                                   test_utils::custom_test_type<int>>>;
+
+TYPED_TEST_SUITE(RocprimOutputIteratorTests, RocprimOutputIteratorTestsParams);
+
+// Scales and casts the values, as done after an algorithm
+template<class Input, class Output>
+struct scale_cast
+{
+    __device__ __host__
+    Output operator()(const Input& value) const
+    {
+        return static_cast<Output>(value + value + value);
+    }
+};
+
+template<class T>
+struct plus_one
+{
+    __device__ __host__
+    T operator()(const T& value) const
+    {
+        return value + T(1);
+    }
+};
+
+TYPED_TEST(RocprimOutputIteratorTests, HostIterator)
+{
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+    static constexpr size_t size = 5;
+
+    std::vector<T> first(size, T(0));
+    std::vector<U> second(size, U(0));
+    std::vector<U> scattered(size, U(0));
+
+    auto transform_output
+        = rocprim::make_transform_output_iterator(second.data(), scale_cast<T, U>());
+    *transform_output       = T(1);
+    transform_output[2]     = T(2);
+    *(4 + transform_output) = T(4);
+    ASSERT_EQ(U(3), second[0]);
+    ASSERT_EQ(U(6), second[2]);
+    ASSERT_EQ(U(12), second[4]);
+    ASSERT_EQ(second.data() + size, (transform_output + size).base());
+
+    auto tee = rocprim::make_tee_iterator(first.data(), transform_output);
+    tee[1]     = T(5);
+    *(tee + 3) = T(7);
+    ASSERT_EQ(T(5), first[1]);
+    ASSERT_EQ(T(7), first[3]);
+    ASSERT_EQ(U(15), second[1]);
+    ASSERT_EQ(U(21), second[3]);
+    ASSERT_EQ(static_cast<std::ptrdiff_t>(size), (tee + size) - tee);
+
+    const std::vector<int> map = {3, 0, 4, 1, 2};
+    auto scatter = rocprim::make_scatter_output_iterator(scattered.data(), map.data());
+    for(size_t i = 0; i < size; i++)
+    {
+        scatter[i] = U(i);
+    }
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(U(i), scattered[map[i]]);
+    }
+    ASSERT_EQ(map.data() + 2, (++scatter + 1).base());
+}
+
+// Writes the result of a transform to two buffers, the second one post-processed, and scatters
+// it by a permutation to a third one
+TYPED_TEST(RocprimOutputIteratorTests, TransformFusedEpilogue)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 50, seed_value);
+            std::vector<unsigned int> map(size);
+            std::iota(map.begin(), map.end(), 0u);
+            std::shuffle(map.begin(), map.end(), std::mt19937(seed_value));
+
+            std::vector<T> expected_first(size);
+            std::vector<U> expected_second(size);
+            std::vector<T> expected_scattered(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected_first[i]          = plus_one<T>()(input[i]);
+                expected_second[i]         = scale_cast<T, U>()(expected_first[i]);
+                expected_scattered[map[i]] = expected_first[i];
+            }
+
+            T*            d_input;
+            T*            d_first;
+            U*            d_second;
+            T*            d_scattered;
+            unsigned int* d_map;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_first, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_second, size * sizeof(U)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_scattered, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_map, size * sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(
+                hipMemcpy(d_map, map.data(), size * sizeof(unsigned int), hipMemcpyHostToDevice));
+
+            HIP_CHECK(rocprim::transform(
+                d_input,
+                rocprim::make_tee_iterator(
+                    d_first,
+                    rocprim::make_transform_output_iterator(d_second, scale_cast<T, U>())),
+                size,
+                plus_one<T>(),
+                stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(rocprim::transform(d_input,
+                                         rocprim::make_scatter_output_iterator(
+                                             d_scattered,
+                                             static_cast<const unsigned int*>(d_map)),
+                                         size,
+                                         plus_one<T>(),
+                                         stream));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> first(size);
+            std::vector<U> second(size);
+            std::vector<T> scattered(size);
+            HIP_CHECK(hipMemcpy(first.data(), d_first, size * sizeof(T), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(second.data(), d_second, size * sizeof(U), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(scattered.data(),
+                                d_scattered,
+                                size * sizeof(T),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(first, expected_first));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(second, expected_second));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(scattered, expected_scattered));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_first));
+            HIP_CHECK(hipFree(d_second));
+            HIP_CHECK(hipFree(d_scattered));
+            HIP_CHECK(hipFree(d_map));
+        }
+    }
+}
+
+TYPED_TEST(RocprimOutputIteratorTests, InclusiveScanTransformOutput)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+    using U = typename TestFixture::output_type;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            // Small integral values, so that the sums of floating-point types are exact
+            const std::vector<int> values
+                = test_utils::get_random_data<int>(size, 0, 1, seed_value);
+            const std::vector<T> input(values.begin(), values.end());
+
+            std::vector<T> sums(size);
+            std::partial_sum(input.begin(), input.end(), sums.begin(), rocprim::plus<T>());
+            std::vector<U> expected(size);
+            std::transform(sums.begin(), sums.end(), expected.begin(), scale_cast<T, U>());
+
+            T* d_input;
+            U* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(U)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            const auto output_it
+                = rocprim::make_transform_output_iterator(d_output, scale_cast<T, U>());
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::inclusive_scan(nullptr,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              output_it,
+                                              size,
+                                              rocprim::plus<T>(),
+                                              stream));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::inclusive_scan(d_temp_storage,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              output_it,
+                                              size,
+                                              rocprim::plus<T>(),
+                                              stream));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<U> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(U), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class T, class U>
+__global__ __launch_bounds__(BlockSize) void block_store_vectorize_kernel(const T* input,
+                                                                          T*       first,
+                                                                          T*       copy,
+                                                                          U*       second)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     block_offset    = blockIdx.x * items_per_block;
+
+    T items[ItemsPerThread];
+    rocprim::block_load<T, BlockSize, ItemsPerThread, rocprim::block_load_vectorize>().load(
+        input + block_offset,
+        items);
+    using block_store_type
+        = rocprim::block_store<T, BlockSize, ItemsPerThread, rocprim::block_store_vectorize>;
+    block_store_type().store(
+        rocprim::make_tee_iterator(first + block_offset, copy + block_offset),
+        items);
+    block_store_type().store(
+        rocprim::make_transform_output_iterator(second + block_offset, scale_cast<T, U>()),
+        items);
+}
+
+TYPED_TEST(RocprimOutputIteratorTests, BlockStoreVectorize)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                                 = typename TestFixture::input_type;
+    using U                                 = typename TestFixture::output_type;
+    constexpr unsigned int block_size       = 256;
+    constexpr unsigned int items_per_thread = 4;
+    constexpr unsigned int grid_size        = 13;
+    constexpr size_t       size             = block_size * items_per_thread * grid_size;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 50, seed_value);
+        std::vector<U>       expected(size);
+        std::transform(input.begin(), input.end(), expected.begin(), scale_cast<T, U>());
+
+        T* d_input;
+        T* d_first;
+        T* d_copy;
+        U* d_second;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_first, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_copy, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_second, size * sizeof(U)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        block_store_vectorize_kernel<block_size, items_per_thread>
+            <<<dim3(grid_size), dim3(block_size), 0, 0>>>(d_input,
+                                                          d_first,
+                                                          d_copy,
+                                                          d_second);
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<T> first(size);
+        std::vector<T> copy(size);
+        std::vector<U> second(size);
+        HIP_CHECK(hipMemcpy(first.data(), d_first, size * sizeof(T), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(copy.data(), d_copy, size * sizeof(T), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(second.data(), d_second, size * sizeof(U), hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(first, input));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(copy, input));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(second, expected));
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_first));
+        HIP_CHECK(hipFree(d_copy));
+        HIP_CHECK(hipFree(d_second));
+    }
+}
@@ -0,0 +1,382 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/block/block_store.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_select.hpp>
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/iterator/bitmask_output_iterator.hpp>
+#include <rocprim/iterator/packed_bits_iterator.hpp>
+
+// required test headers
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <numeric>
+#include <vector>
+
+template<unsigned int Bits>
+struct RocprimPackedBitsIteratorParams
+{
+    static constexpr unsigned int bits = Bits;
+};
+
+template<class Params>
+class RocprimPackedBitsIteratorTests : public ::testing::Test
+{
+public:
+    static constexpr unsigned int bits = Params::bits;
+};
+
+using RocprimPackedBitsIteratorTestsParams
+    = ::testing::Types<RocprimPackedBitsIteratorParams<1>,
+                       RocprimPackedBitsIteratorParams<4>,
+                       RocprimPackedBitsIteratorParams<7>,
+                       RocprimPackedBitsIteratorParams<12>,
+                       RocprimPackedBitsIteratorParams<32>>;
+
+TYPED_TEST_SUITE(RocprimPackedBitsIteratorTests, RocprimPackedBitsIteratorTestsParams);
+
+// Packs the values into the bits of 32-bit words as expected by packed_bits_iterator
+template<unsigned int Bits>
+std::vector<unsigned int> pack_bits(const std::vector<unsigned int>& values)
+{
+    std::vector<unsigned int> words((values.size() * Bits + 31) / 32 + 1, 0u);
+    for(size_t i = 0; i < values.size(); i++)
+    {
+        for(unsigned int b = 0; b < Bits; b++)
+        {
+            const size_t bit = i * Bits + b;
+            words[bit / 32] |= ((values[i] >> b) & 1u) << (bit % 32);
+        }
+    }
+    return words;
+}
+
+template<unsigned int Bits>
+std::vector<unsigned int> get_random_packable_data(const size_t size, const unsigned int seed_value)
+{
+    return test_utils::get_random_data<unsigned int>(size,
+                                                     0,
+                                                     rocprim::detail::packed_bits_mask<Bits>(),
+                                                     seed_value);
+}
+
+TYPED_TEST(RocprimPackedBitsIteratorTests, HostIterator)
+{
+    constexpr unsigned int bits = TestFixture::bits;
+    constexpr size_t       size = 100;
+
+    const std::vector<unsigned int> values = get_random_packable_data<bits>(size, 123);
+    const std::vector<unsigned int> words  = pack_bits<bits>(values);
+
+    auto it = rocprim::make_packed_bits_iterator<bits>(words.data());
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(values[i], it[i]) << "with index = " << i;
+    }
+    ASSERT_EQ(values[3], *(it + 3));
+    ASSERT_EQ(values[3], *(3 + it));
+    ASSERT_EQ(static_cast<std::ptrdiff_t>(size), (it + size) - it);
+    ASSERT_LT(it, it + 1);
+    ASSERT_EQ(it + 1, ++it);
+    ASSERT_EQ(values[1], *it);
+    ASSERT_EQ(size_t(1), it.index());
+}
+
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class InputIterator>
+__global__ __launch_bounds__(BlockSize) void packed_bits_load_kernel(InputIterator input,
+                                                                     unsigned int* output,
+                                                                     const size_t  size)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     lid             = threadIdx.x;
+    const size_t           block_offset    = blockIdx.x * items_per_block;
+    const unsigned int     valid           = static_cast<unsigned int>(
+        rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    unsigned int items[ItemsPerThread];
+    if(valid == items_per_block)
+    {
+        rocprim::block_load_direct_blocked(lid, input + block_offset, items);
+    }
+    else
+    {
+        rocprim::block_load_direct_blocked(lid, input + block_offset, items, valid);
+    }
+    rocprim::block_store_direct_blocked(lid, output + block_offset, items, valid);
+}
+
+TYPED_TEST(RocprimPackedBitsIteratorTests, BlockLoad)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int bits             = TestFixture::bits;
+    constexpr unsigned int block_size       = 256;
+    constexpr unsigned int items_per_thread = 7;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            if(size == 0)
+            {
+                continue;
+            }
+
+            // The first item is not at the start of a word
+            const size_t                    first  = 3;
+            const std::vector<unsigned int> values = get_random_packable_data<bits>(size + first,
+                                                                                    seed_value);
+            const std::vector<unsigned int> words  = pack_bits<bits>(values);
+            const std::vector<unsigned int> expected(values.begin() + first, values.end());
+
+            unsigned int* d_words;
+            unsigned int* d_output;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_words, words.size() * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_words,
+                                words.data(),
+                                words.size() * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+
+            const unsigned int grid_size = (size + items_per_block - 1) / items_per_block;
+            packed_bits_load_kernel<block_size, items_per_thread>
+                <<<dim3(grid_size), dim3(block_size), 0, 0>>>(
+                    rocprim::make_packed_bits_iterator<bits>(d_words, first),
+                    d_output,
+                    size);
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<unsigned int> output(size);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                size * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_words));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+TYPED_TEST(RocprimPackedBitsIteratorTests, Reduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    constexpr unsigned int bits   = TestFixture::bits;
+    hipStream_t            stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<unsigned int> values = get_random_packable_data<bits>(size,
+                                                                                    seed_value);
+            const std::vector<unsigned int> words  = pack_bits<bits>(values);
+            // The sum wraps around for 32-bit items, the same as on the device
+            const unsigned int expected = std::accumulate(values.begin(), values.end(), 0u);
+
+            unsigned int* d_words;
+            unsigned int* d_output;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_words, words.size() * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_words,
+                                words.data(),
+                                words.size() * sizeof(unsigned int),
+                                hipMemcpyHostToDevice));
+
+            const auto input = rocprim::make_packed_bits_iterator<bits>(d_words);
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::reduce(nullptr,
+                                      temp_storage_size_bytes,
+                                      input,
+                                      d_output,
+                                      0u,
+                                      size,
+                                      rocprim::plus<unsigned int>(),
+                                      stream));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::reduce(d_temp_storage,
+                                      temp_storage_size_bytes,
+                                      input,
+                                      d_output,
+                                      0u,
+                                      size,
+                                      rocprim::plus<unsigned int>(),
+                                      stream));
+            HIP_CHECK(hipGetLastError());
+
+            unsigned int output;
+            HIP_CHECK(hipMemcpy(&output, d_output, sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+            ASSERT_EQ(output, expected);
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_words));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+struct is_odd
+{
+    __device__ __host__
+    bool operator()(const int value) const
+    {
+        return value % 2 != 0;
+    }
+};
+
+// The flags of select are written to a bitmask by transform and read back from it by select
+TEST(RocprimBitmaskIteratorTests, SelectFlags)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<int> input
+                = test_utils::get_random_data<int>(size, 0, 100, seed_value);
+            std::vector<int> expected;
+            for(const int value : input)
+            {
+                if(is_odd()(value))
+                {
+                    expected.push_back(value);
+                }
+            }
+
+            const size_t  words_size = (size + 31) / 32 + 1;
+            int*          d_input;
+            unsigned int* d_words;
+            int*          d_output;
+            unsigned int* d_selected_count;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(int)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_words, words_size * sizeof(unsigned int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(int)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count, sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(int), hipMemcpyHostToDevice));
+            // Every bit is written, the words are set to check that the bits are also cleared
+            HIP_CHECK(hipMemset(d_words, 0xAA, words_size * sizeof(unsigned int)));
+
+            HIP_CHECK(rocprim::transform(d_input,
+                                         rocprim::make_bitmask_output_iterator(d_words),
+                                         size,
+                                         is_odd(),
+                                         stream));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<unsigned int> words(words_size);
+            HIP_CHECK(hipMemcpy(words.data(),
+                                d_words,
+                                words_size * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            const auto flags = rocprim::make_bitmask_iterator(words.data());
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(is_odd()(input[i]), flags[i]) << "with index = " << i;
+            }
+
+            const auto d_flags = rocprim::make_bitmask_iterator(d_words);
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::select(nullptr,
+                                      temp_storage_size_bytes,
+                                      d_input,
+                                      d_flags,
+                                      d_output,
+                                      d_selected_count,
+                                      size,
+                                      stream));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::select(d_temp_storage,
+                                      temp_storage_size_bytes,
+                                      d_input,
+                                      d_flags,
+                                      d_output,
+                                      d_selected_count,
+                                      size,
+                                      stream));
+            HIP_CHECK(hipGetLastError());
+
+            unsigned int selected_count;
+            HIP_CHECK(hipMemcpy(&selected_count,
+                                d_selected_count,
+                                sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(selected_count, expected.size());
+
+            std::vector<int> output(selected_count);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                selected_count * sizeof(int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_words));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_selected_count));
+        }
+    }
+}
@@ -0,0 +1,325 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/block/block_store.hpp>
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_transform.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/iterator/counting_iterator.hpp>
+#include <rocprim/iterator/permutation_iterator.hpp>
+
+// required test headers
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+template<class Value,
+         class Index,
+         rocprim::block_load_method  LoadMethod,
+         rocprim::block_store_method StoreMethod>
+struct RocprimPermutationIteratorParams
+{
+    using value_type                                        = Value;
+    using index_type                                        = Index;
+    static constexpr rocprim::block_load_method  load_method  = LoadMethod;
+    static constexpr rocprim::block_store_method store_method = StoreMethod;
+};
+
+template<class Params>
+class RocprimPermutationIteratorTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using RocprimPermutationIteratorTestsParams = ::testing::Types<
+    RocprimPermutationIteratorParams<int,
+                                     unsigned int,
+                                     rocprim::block_load_method::block_load_direct,
+                                     rocprim::block_store_method::block_store_direct>,
+    RocprimPermutationIteratorParams<double,
+                                     int,
+                                     rocprim::block_load_method::block_load_striped,
+                                     rocprim::block_store_method::block_store_striped>,
+    RocprimPermutationIteratorParams<unsigned char,
+                                     size_t,
+                                     rocprim::block_load_method::block_load_vectorize,
+                                     rocprim::block_store_method::block_store_direct>,
+    RocprimPermutationIteratorParams<float,
+                                     unsigned int,
+                                     rocprim::block_load_method::block_load_transpose,
+                                     rocprim::block_store_method::block_store_transpose>,
+    RocprimPermutationIteratorParams<test_utils::custom_test_type<int>,
+                                     unsigned int,
+                                     rocprim::block_load_method::block_load_warp_transpose,
+                                     rocprim::block_store_method::block_store_warp_transpose>>;
+
+TYPED_TEST_SUITE(RocprimPermutationIteratorTests, RocprimPermutationIteratorTestsParams);
+
+// A random permutation of [0, size)
+template<class Index>
+std::vector<Index> get_random_permutation(const size_t size, const unsigned int seed_value)
+{
+    std::vector<Index> indices(size);
+    std::iota(indices.begin(), indices.end(), Index(0));
+    std::shuffle(indices.begin(), indices.end(), std::mt19937(seed_value));
+    return indices;
+}
+
+TYPED_TEST(RocprimPermutationIteratorTests, HostIterator)
+{
+    using T     = typename TestFixture::params::value_type;
+    using Index = typename TestFixture::params::index_type;
+
+    const std::vector<T>     values  = {T(10), T(11), T(12), T(13), T(14)};
+    const std::vector<Index> indices = {Index(4), Index(0), Index(3), Index(1), Index(2)};
+
+    auto it = rocprim::make_permutation_iterator(values.data(), indices.data());
+    ASSERT_EQ(T(14), *it);
+    ASSERT_EQ(T(13), it[3]);
+    ASSERT_EQ(T(13), *(it + 2));
+    ASSERT_EQ(T(13), *(2 + it));
+    ASSERT_EQ(static_cast<std::ptrdiff_t>(indices.size()), (it + indices.size()) - it);
+    ASSERT_LT(it, it + 1);
+    const auto next = it + 1;
+    ASSERT_EQ(next, ++it);
+    ASSERT_EQ(T(10), *it);
+    ASSERT_EQ(values.data(), it.values());
+    ASSERT_EQ(indices.data() + 1, it.base());
+}
+
+template<rocprim::block_load_method  LoadMethod,
+         rocprim::block_store_method StoreMethod,
+         unsigned int                BlockSize,
+         unsigned int                ItemsPerThread,
+         class InputIterator,
+         class T>
+__global__ __launch_bounds__(BlockSize) void gather_kernel(InputIterator input,
+                                                           T*            output,
+                                                           const size_t  size)
+{
+    constexpr unsigned int items_per_block = BlockSize * ItemsPerThread;
+    const unsigned int     block_offset    = blockIdx.x * items_per_block;
+    const unsigned int     valid = static_cast<unsigned int>(
+        rocprim::min<size_t>(size - block_offset, items_per_block));
+
+    using block_load_type  = rocprim::block_load<T, BlockSize, ItemsPerThread, LoadMethod>;
+    using block_store_type = rocprim::block_store<T, BlockSize, ItemsPerThread, StoreMethod>;
+    ROCPRIM_SHARED_MEMORY union
+    {
+        typename block_load_type::storage_type  load;
+        typename block_store_type::storage_type store;
+    } storage;
+
+    T items[ItemsPerThread];
+    if(valid == items_per_block)
+    {
+        block_load_type().load(input + block_offset, items, storage.load);
+    }
+    else
+    {
+        block_load_type().load(input + block_offset, items, valid, storage.load);
+    }
+    rocprim::syncthreads();
+    block_store_type().store(output + block_offset, items, valid, storage.store);
+}
+
+TYPED_TEST(RocprimPermutationIteratorTests, BlockLoadGather)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                                 = typename TestFixture::params::value_type;
+    using Index                             = typename TestFixture::params::index_type;
+    constexpr auto         load_method      = TestFixture::params::load_method;
+    constexpr auto         store_method     = TestFixture::params::store_method;
+    constexpr unsigned int block_size       = 256;
+    constexpr unsigned int items_per_thread = 4;
+    constexpr unsigned int items_per_block  = block_size * items_per_thread;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+            if(size == 0)
+            {
+                continue;
+            }
+
+            const std::vector<T> values = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+            const std::vector<Index> indices = get_random_permutation<Index>(size, seed_value);
+
+            std::vector<T> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = values[indices[i]];
+            }
+
+            T*     d_values;
+            Index* d_indices;
+            T*     d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, size * sizeof(Index)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_values, values.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_indices,
+                                indices.data(),
+                                size * sizeof(Index),
+                                hipMemcpyHostToDevice));
+
+            const unsigned int grid_size = (size + items_per_block - 1) / items_per_block;
+            gather_kernel<load_method, store_method, block_size, items_per_thread>
+                <<<dim3(grid_size), dim3(block_size), 0, 0>>>(
+                    rocprim::make_permutation_iterator(static_cast<const T*>(d_values),
+                                                       static_cast<const Index*>(d_indices)),
+                    d_output,
+                    size);
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_values));
+            HIP_CHECK(hipFree(d_indices));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
+
+// Sorts the keys with their indices and gathers the values of the sorted order
+TYPED_TEST(RocprimPermutationIteratorTests, GatherSortedByKey)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T          = typename TestFixture::params::value_type;
+    using key_type   = unsigned int;
+    using index_type = unsigned int;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<key_type> keys
+                = test_utils::get_random_data<key_type>(size, 0, 1000, seed_value);
+            const std::vector<T> values = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            // radix sort is stable, so the sorted indices are unique
+            std::vector<index_type> sorted_indices(size);
+            std::iota(sorted_indices.begin(), sorted_indices.end(), index_type(0));
+            std::stable_sort(sorted_indices.begin(),
+                             sorted_indices.end(),
+                             [&](const index_type a, const index_type b)
+                             { return keys[a] < keys[b]; });
+            std::vector<T> expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                expected[i] = values[sorted_indices[i]];
+            }
+
+            key_type*   d_keys;
+            key_type*   d_keys_output;
+            index_type* d_indices;
+            T*          d_values;
+            T*          d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, size * sizeof(index_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(d_keys, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values, values.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::radix_sort_pairs(nullptr,
+                                                temp_storage_size_bytes,
+                                                d_keys,
+                                                d_keys_output,
+                                                rocprim::counting_iterator<index_type>(0),
+                                                d_indices,
+                                                size,
+                                                0,
+                                                sizeof(key_type) * 8,
+                                                stream));
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::radix_sort_pairs(d_temp_storage,
+                                                temp_storage_size_bytes,
+                                                d_keys,
+                                                d_keys_output,
+                                                rocprim::counting_iterator<index_type>(0),
+                                                d_indices,
+                                                size,
+                                                0,
+                                                sizeof(key_type) * 8,
+                                                stream));
+            HIP_CHECK(hipGetLastError());
+
+            HIP_CHECK(rocprim::transform(
+                rocprim::make_permutation_iterator(static_cast<const T*>(d_values),
+                                                   static_cast<const index_type*>(d_indices)),
+                d_output,
+                size,
+                rocprim::identity<T>(),
+                stream));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_indices));
+            HIP_CHECK(hipFree(d_values));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
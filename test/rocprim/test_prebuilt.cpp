@@ -0,0 +1,219 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Calls that match the instantiations of rocprim_prebuilt, which are linked from the library
+// instead of being compiled here (ROCPRIM_USE_PREBUILT is set by linking rocprim_prebuilt)
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/functional.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#ifndef ROCPRIM_USE_PREBUILT
+    #error "test_prebuilt must link rocprim_prebuilt"
+#endif
+
+TEST(RocprimPrebuiltTests, RadixSortPairs)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = float;
+    using value_type = std::int64_t;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<key_type> keys
+                = test_utils::get_random_data<key_type>(size, -1000.0f, 1000.0f, seed_value);
+            std::vector<value_type> values(size);
+            std::iota(values.begin(), values.end(), value_type(0));
+
+            // Radix sort is stable
+            std::vector<value_type> expected(values);
+            std::stable_sort(expected.begin(),
+                             expected.end(),
+                             [&](const value_type a, const value_type b)
+                             { return keys[a] < keys[b]; });
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            value_type* d_values_input;
+            value_type* d_values_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(rocprim::radix_sort_pairs(nullptr,
+                                                temporary_storage_bytes,
+                                                d_keys_input,
+                                                d_keys_output,
+                                                d_values_input,
+                                                d_values_output,
+                                                size));
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(rocprim::radix_sort_pairs(d_temporary_storage,
+                                                temporary_storage_bytes,
+                                                d_keys_input,
+                                                d_keys_output,
+                                                d_values_input,
+                                                d_values_output,
+                                                size));
+
+            std::vector<value_type> output(size);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_values_output,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+
+            test_utils::assert_eq(output, expected);
+        }
+    }
+}
+
+TEST(RocprimPrebuiltTests, ReduceAndScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(size, -100, 100, seed_value);
+
+            const T        init = 1000;
+            T              expected_maximum = init;
+            std::vector<T> expected_scan(size);
+            T              sum = init;
+            for(size_t i = 0; i < size; i++)
+            {
+                expected_maximum = std::max(expected_maximum, input[i]);
+                expected_scan[i] = sum;
+                sum += input[i];
+            }
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t reduce_bytes = 0;
+            size_t scan_bytes   = 0;
+            HIP_CHECK(rocprim::reduce(nullptr,
+                                      reduce_bytes,
+                                      d_input,
+                                      d_output,
+                                      init,
+                                      size,
+                                      rocprim::maximum<T>()));
+            HIP_CHECK(rocprim::exclusive_scan(nullptr,
+                                              scan_bytes,
+                                              d_input,
+                                              d_output,
+                                              init,
+                                              size,
+                                              rocprim::plus<T>()));
+
+            size_t temporary_storage_bytes = std::max(reduce_bytes, scan_bytes);
+            void*  d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(rocprim::reduce(d_temporary_storage,
+                                      reduce_bytes,
+                                      d_input,
+                                      d_output,
+                                      init,
+                                      size,
+                                      rocprim::maximum<T>()));
+            T maximum;
+            HIP_CHECK(hipMemcpy(&maximum, d_output, sizeof(T), hipMemcpyDeviceToHost));
+            ASSERT_EQ(maximum, expected_maximum);
+
+            HIP_CHECK(rocprim::exclusive_scan(d_temporary_storage,
+                                              scan_bytes,
+                                              d_input,
+                                              d_output,
+                                              init,
+                                              size,
+                                              rocprim::plus<T>()));
+            std::vector<T> scan(size);
+            HIP_CHECK(hipMemcpy(scan.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+
+            test_utils::assert_eq(scan, expected_scan);
+        }
+    }
+}
@@ -0,0 +1,153 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/intrinsics/thread.hpp>
+#include <rocprim/iterator/scalar_broadcast_iterator.hpp>
+
+// required test headers
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <vector>
+
+template<class Params>
+class RocprimScalarBroadcastIteratorTests : public ::testing::Test
+{
+public:
+    using type = Params;
+};
+
+// The types cover the scalar loads of dwords and the fallback for smaller types
+using RocprimScalarBroadcastIteratorTestsParams
+    = ::testing::Types<int,
+                       unsigned char,
+                       short,
+                       float,
+                       double,
+                       unsigned long long,
+                       test_utils::custom_test_type<int>,
+                       test_utils::custom_test_type<double>>;
+
+TYPED_TEST_SUITE(RocprimScalarBroadcastIteratorTests, RocprimScalarBroadcastIteratorTestsParams);
+
+TYPED_TEST(RocprimScalarBroadcastIteratorTests, HostIterator)
+{
+    using T = typename TestFixture::type;
+    static constexpr size_t size = 5;
+
+    std::vector<T> data(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        data[i] = T(i);
+    }
+
+    auto input = rocprim::make_scalar_broadcast_iterator(static_cast<const T*>(data.data()));
+    ASSERT_EQ(data[0], *input);
+    ASSERT_EQ(data[3], input[3]);
+    ASSERT_EQ(data[2], *(input + 2));
+    ASSERT_EQ(data[2], *(2 + input));
+    ASSERT_EQ(static_cast<std::ptrdiff_t>(size), (input + size) - input);
+    ASSERT_LT(input, input + 1);
+    const auto next = input + 1;
+    ASSERT_EQ(next, ++input);
+    ASSERT_EQ(data[1], *input);
+    ASSERT_EQ(data.data() + size, (input + size - 1).base());
+}
+
+template<class T>
+__global__ void warp_uniform_load_kernel(rocprim::scalar_broadcast_iterator<T> table,
+                                         const unsigned int                    table_size,
+                                         T*                                    output,
+                                         const bool                            lane_index)
+{
+    const unsigned int id   = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int warp = id / rocprim::device_warp_size();
+    // With a lane dependent index all lanes obtain the value of the first lane
+    const unsigned int index = lane_index ? warp + rocprim::lane_id() : warp;
+    output[id]               = table[index % table_size];
+}
+
+template<class T>
+void test_warp_uniform_load(const bool lane_index)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    unsigned int warp_size;
+    HIP_CHECK(::rocprim::host_warp_size(device_id, warp_size));
+
+    constexpr unsigned int block_size = 256;
+    constexpr unsigned int grid_size  = 23;
+    constexpr unsigned int table_size = 37;
+    constexpr size_t       size       = block_size * grid_size;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        const std::vector<T> table = test_utils::get_random_data<T>(table_size, 0, 100, seed_value);
+
+        std::vector<T> expected(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            expected[i] = table[(i / warp_size) % table_size];
+        }
+
+        T* d_table;
+        T* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_table, table_size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(T)));
+        HIP_CHECK(
+            hipMemcpy(d_table, table.data(), table_size * sizeof(T), hipMemcpyHostToDevice));
+
+        warp_uniform_load_kernel<<<dim3(grid_size), dim3(block_size), 0, 0>>>(
+            rocprim::make_scalar_broadcast_iterator(static_cast<const T*>(d_table)),
+            table_size,
+            d_output,
+            lane_index);
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<T> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+        HIP_CHECK(hipFree(d_table));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
+
+TYPED_TEST(RocprimScalarBroadcastIteratorTests, WarpUniformLoad)
+{
+    test_warp_uniform_load<typename TestFixture::type>(false);
+}
+
+TYPED_TEST(RocprimScalarBroadcastIteratorTests, FirstLaneLoad)
+{
+    test_warp_uniform_load<typename TestFixture::type>(true);
+}
@@ -0,0 +1,219 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/temp_storage_arena.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+TEST(RocprimTempStorageArenaTests, ReuseSizeClass)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const hipStream_t stream = 0; // default
+
+    rocprim::temp_storage_arena arena;
+
+    void* first;
+    HIP_CHECK(arena.allocate(&first, {1000}, stream));
+    ASSERT_NE(first, nullptr);
+    HIP_CHECK(hipMemsetAsync(first, 0, 1000, stream));
+    HIP_CHECK(arena.deallocate(first, stream));
+    ASSERT_EQ(arena.cached_bytes(), size_t(1024));
+
+    // The same size class is served from the cache
+    void* second;
+    HIP_CHECK(arena.allocate(&second, {600}, stream));
+    ASSERT_EQ(second, first);
+    ASSERT_EQ(arena.cached_bytes(), size_t(0));
+
+    // Another size class needs a new block
+    void* third;
+    HIP_CHECK(arena.allocate(&third, {5000}, stream));
+    ASSERT_NE(third, second);
+
+    HIP_CHECK(arena.deallocate(second, stream));
+    HIP_CHECK(arena.deallocate(third, stream));
+    ASSERT_EQ(arena.cached_bytes(), size_t(1024 + 8192));
+
+    // Unknown pointers are rejected
+    ASSERT_EQ(arena.deallocate(third, stream), hipErrorInvalidValue);
+
+    HIP_CHECK(arena.release());
+    ASSERT_EQ(arena.cached_bytes(), size_t(0));
+    HIP_CHECK(hipStreamSynchronize(stream));
+}
+
+TEST(RocprimTempStorageArenaTests, Alignment)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const hipStream_t stream = 0; // default
+
+    rocprim::temp_storage_arena arena;
+    for(size_t alignment : {size_t(1), size_t(256), size_t(1024), size_t(4096)})
+    {
+        SCOPED_TRACE(testing::Message() << "with alignment = " << alignment);
+
+        void* storage;
+        HIP_CHECK(arena.allocate(&storage, {100, alignment}, stream));
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(storage) % alignment, size_t(0));
+        HIP_CHECK(hipMemsetAsync(storage, 0, 100, stream));
+        HIP_CHECK(arena.deallocate(storage, stream));
+    }
+    HIP_CHECK(hipStreamSynchronize(stream));
+}
+
+TEST(RocprimTempStorageArenaTests, MaxCachedBytes)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const hipStream_t stream = 0; // default
+
+    rocprim::temp_storage_arena arena(4096);
+
+    void* small;
+    void* large;
+    HIP_CHECK(arena.allocate(&small, {4096}, stream));
+    HIP_CHECK(arena.allocate(&large, {8192}, stream));
+    HIP_CHECK(arena.deallocate(small, stream));
+    // The bound is reached, so this block is freed
+    HIP_CHECK(arena.deallocate(large, stream));
+    ASSERT_EQ(arena.cached_bytes(), size_t(4096));
+    HIP_CHECK(hipStreamSynchronize(stream));
+}
+
+// A pipeline of algorithms on two streams sharing one arena
+TEST(RocprimTempStorageArenaTests, Pipeline)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                      = unsigned int;
+    const bool debug_synchronous = false;
+
+    hipStream_t streams[2];
+    HIP_CHECK(hipStreamCreateWithFlags(&streams[0], hipStreamNonBlocking));
+    HIP_CHECK(hipStreamCreateWithFlags(&streams[1], hipStreamNonBlocking));
+
+    rocprim::temp_storage_arena arena;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+
+            std::vector<T> expected_scan(size);
+            std::partial_sum(input.begin(), input.end(), expected_scan.begin());
+            const T expected_reduce = std::accumulate(input.begin(), input.end(), T(0));
+
+            T* d_input;
+            T* d_scan;
+            T* d_reduce;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_scan,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_reduce, sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            // Alternate the streams, so cached blocks move between them
+            for(hipStream_t stream : {streams[0], streams[1], streams[1], streams[0]})
+            {
+                HIP_CHECK(rocprim::invoke_with_temp_storage_arena(
+                    arena,
+                    stream,
+                    [&](void* temporary_storage, size_t& storage_size)
+                    {
+                        return rocprim::inclusive_scan(temporary_storage,
+                                                       storage_size,
+                                                       d_input,
+                                                       d_scan,
+                                                       size,
+                                                       rocprim::plus<T>(),
+                                                       stream,
+                                                       debug_synchronous);
+                    }));
+                HIP_CHECK(rocprim::invoke_with_temp_storage_arena(
+                    arena,
+                    stream,
+                    [&](void* temporary_storage, size_t& storage_size)
+                    {
+                        return rocprim::reduce(temporary_storage,
+                                               storage_size,
+                                               d_input,
+                                               d_reduce,
+                                               T(0),
+                                               size,
+                                               rocprim::plus<T>(),
+                                               stream,
+                                               debug_synchronous);
+                    }));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipStreamSynchronize(stream));
+
+                std::vector<T> scan(size);
+                T              reduce;
+                HIP_CHECK(hipMemcpy(scan.data(), d_scan, size * sizeof(T), hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(&reduce, d_reduce, sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(scan, expected_scan));
+                ASSERT_EQ(reduce, expected_reduce);
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_scan));
+            HIP_CHECK(hipFree(d_reduce));
+        }
+    }
+
+    HIP_CHECK(arena.release());
+    HIP_CHECK(hipStreamDestroy(streams[0]));
+    HIP_CHECK(hipStreamDestroy(streams[1]));
+}
@@ -32,11 +32,13 @@
 #include "rocprim/thread/thread_reduce.hpp"
 #include "rocprim/thread/thread_scan.hpp"
 #include "rocprim/thread/thread_search.hpp"
+#include "rocprim/thread/thread_sort.hpp"
 
 #include "../common_test_header.hpp"
 #include "test_utils.hpp"
 
 #include <algorithm>
+#include <numeric>
 #include <vector>
 
 template<class T>
@@ -524,3 +526,130 @@ TYPED_TEST(RocprimThreadOperationTests, Search)
     merge_path_search_test<T, OffsetT, rocprim::less<T>>();
     merge_path_search_test<T, OffsetT, rocprim::greater<T>>();
 }
+
+template<class Type, unsigned int Length, bool Stable, class BinaryFunction>
+__global__ void thread_sort_kernel(Type*              device_keys,
+                                   unsigned int*      device_values,
+                                   const unsigned int valid,
+                                   BinaryFunction     compare_function)
+{
+    const unsigned int offset = (blockIdx.x * blockDim.x + threadIdx.x) * Length;
+    Type               keys[Length];
+    unsigned int       values[Length];
+    for(unsigned int i = 0; i < Length; i++)
+    {
+        keys[i]   = device_keys[offset + i];
+        values[i] = i;
+    }
+    if(Stable)
+    {
+        rocprim::thread_sort_stable(keys, values, compare_function, valid);
+    }
+    else
+    {
+        rocprim::thread_sort(keys, values, compare_function);
+    }
+    for(unsigned int i = 0; i < Length; i++)
+    {
+        device_keys[offset + i]   = keys[i];
+        device_values[offset + i] = values[i];
+    }
+}
+
+// Unstable sorts are checked for sorted keys which still belong to their values, stable sorts
+// also for the order of equal keys and for the invalid items being left in place.
+template<class T, unsigned int Length, bool Stable, class BinaryFunction>
+void thread_sort_test(const unsigned int valid)
+{
+    static constexpr unsigned int block_size = 64;
+    static constexpr unsigned int grid_size  = 32;
+    static constexpr unsigned int size       = block_size * grid_size * Length;
+    SCOPED_TRACE(testing::Message() << "with length = " << Length << ", valid = " << valid);
+
+    BinaryFunction compare_function;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Few distinct keys, so that there are many ties
+        const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 8, seed_value);
+
+        std::vector<T>            expected_keys(size);
+        std::vector<unsigned int> expected_values(size);
+        for(unsigned int offset = 0; offset < size; offset += Length)
+        {
+            std::vector<unsigned int> order(Length);
+            std::iota(order.begin(), order.end(), 0u);
+            std::stable_sort(order.begin(),
+                             order.begin() + valid,
+                             [&](const unsigned int a, const unsigned int b)
+                             { return compare_function(input[offset + a], input[offset + b]); });
+            for(unsigned int i = 0; i < Length; i++)
+            {
+                expected_keys[offset + i]   = input[offset + order[i]];
+                expected_values[offset + i] = order[i];
+            }
+        }
+
+        T*            device_keys;
+        unsigned int* device_values;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_keys, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_values, size * sizeof(unsigned int)));
+        HIP_CHECK(hipMemcpy(device_keys, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        thread_sort_kernel<T, Length, Stable>
+            <<<grid_size, block_size>>>(device_keys, device_values, valid, compare_function);
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<T>            output_keys(size);
+        std::vector<unsigned int> output_values(size);
+        HIP_CHECK(
+            hipMemcpy(output_keys.data(), device_keys, size * sizeof(T), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(output_values.data(),
+                            device_values,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output_keys, expected_keys));
+        if(Stable)
+        {
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output_values, expected_values));
+        }
+        else
+        {
+            for(unsigned int i = 0; i < size; i++)
+            {
+                const unsigned int offset = i / Length * Length;
+                ASSERT_NO_FATAL_FAILURE(
+                    test_utils::assert_eq(input[offset + output_values[i]], output_keys[i]));
+            }
+        }
+
+        HIP_CHECK(hipFree(device_keys));
+        HIP_CHECK(hipFree(device_values));
+    }
+}
+
+TYPED_TEST(RocprimThreadOperationTests, Sort)
+{
+    using T = typename TestFixture::type;
+    thread_sort_test<T, 1, false, rocprim::less<T>>(1);
+    thread_sort_test<T, 7, false, rocprim::less<T>>(7);
+    thread_sort_test<T, 16, false, rocprim::greater<T>>(16);
+    thread_sort_test<T, 32, false, rocprim::less<T>>(32);
+}
+
+TYPED_TEST(RocprimThreadOperationTests, SortStable)
+{
+    using T = typename TestFixture::type;
+    thread_sort_test<T, 3, true, rocprim::less<T>>(3);
+    thread_sort_test<T, 4, true, rocprim::less<T>>(2);
+    thread_sort_test<T, 11, true, rocprim::greater<T>>(11);
+    thread_sort_test<T, 16, true, rocprim::less<T>>(16);
+    thread_sort_test<T, 16, true, rocprim::less<T>>(9);
+    thread_sort_test<T, 32, true, rocprim::less<T>>(0);
+    thread_sort_test<T, 32, true, rocprim::less<T>>(32);
+}
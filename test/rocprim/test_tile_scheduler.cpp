@@ -0,0 +1,285 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/tile_scheduler.hpp>
+#include <rocprim/intrinsics/atomic.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+constexpr unsigned int scheduler_block_size = 256;
+
+template<class Scheduler>
+struct TileSchedulerParams
+{
+    using type = Scheduler;
+};
+
+template<class Params>
+class RocprimTileSchedulerTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using RocprimTileSchedulerTestsParams
+    = ::testing::Types<TileSchedulerParams<rocprim::ordered_tile_scheduler>,
+                       TileSchedulerParams<rocprim::chunked_tile_scheduler<1>>,
+                       TileSchedulerParams<rocprim::chunked_tile_scheduler<5>>,
+                       TileSchedulerParams<rocprim::work_stealing_tile_scheduler>>;
+
+TYPED_TEST_SUITE(RocprimTileSchedulerTests, RocprimTileSchedulerTestsParams);
+
+// Counts the visits of every tile, and whether the tiles of every block were increasing
+template<class Scheduler>
+__global__ __launch_bounds__(scheduler_block_size) void persistent_kernel(unsigned int* visits,
+                                                                           unsigned int* unordered,
+                                                                           Scheduler scheduler)
+{
+    __shared__ typename Scheduler::storage_type storage;
+
+    bool         first    = true;
+    unsigned int previous = 0;
+    unsigned int tile;
+    while(scheduler.next(tile, storage))
+    {
+        if(threadIdx.x == 0)
+        {
+            rocprim::detail::atomic_add(&visits[tile], 1);
+            if(!first && tile <= previous)
+            {
+                rocprim::detail::atomic_add(unordered, 1);
+            }
+        }
+        first    = false;
+        previous = tile;
+    }
+}
+
+template<class Scheduler>
+size_t get_scheduler_storage_size(const unsigned int grid_size)
+{
+    (void)grid_size;
+    return Scheduler::get_temp_storage_size();
+}
+
+template<>
+size_t get_scheduler_storage_size<rocprim::work_stealing_tile_scheduler>(
+    const unsigned int grid_size)
+{
+    return rocprim::work_stealing_tile_scheduler::get_temp_storage_size(grid_size);
+}
+
+template<class Scheduler>
+hipError_t create_scheduler(Scheduler&         scheduler,
+                            void*              storage,
+                            const size_t       storage_size,
+                            const unsigned int tiles,
+                            const unsigned int grid_size)
+{
+    (void)grid_size;
+    return Scheduler::create(scheduler, storage, storage_size, tiles);
+}
+
+template<>
+hipError_t create_scheduler(rocprim::work_stealing_tile_scheduler& scheduler,
+                            void*                                  storage,
+                            const size_t                           storage_size,
+                            const unsigned int                     tiles,
+                            const unsigned int                     grid_size)
+{
+    return rocprim::work_stealing_tile_scheduler::create(scheduler,
+                                                         storage,
+                                                         storage_size,
+                                                         tiles,
+                                                         grid_size);
+}
+
+TYPED_TEST(RocprimTileSchedulerTests, EveryTileOnce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using scheduler_type = typename TestFixture::params::type;
+    // Only the work-stealing scheduler hands out the tiles of a block out of order
+    constexpr bool ordered
+        = !std::is_same<scheduler_type, rocprim::work_stealing_tile_scheduler>::value;
+
+    const hipStream_t stream = 0; // default
+
+    unsigned int grid_size;
+    HIP_CHECK(rocprim::get_persistent_grid_size(persistent_kernel<scheduler_type>,
+                                                scheduler_block_size,
+                                                stream,
+                                                grid_size));
+    ASSERT_GT(grid_size, 0u);
+
+    const std::vector<unsigned int> tile_counts
+        = {0u, 1u, 7u, grid_size - 1, grid_size, 3 * grid_size + 5, 10000u};
+    for(const unsigned int tiles : tile_counts)
+    {
+        SCOPED_TRACE(testing::Message() << "with tiles = " << tiles);
+
+        const size_t  storage_size = get_scheduler_storage_size<scheduler_type>(grid_size);
+        void*         d_storage;
+        unsigned int* d_visits;
+        unsigned int* d_unordered;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_size));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_visits,
+                                                     (tiles + 1) * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_unordered, sizeof(unsigned int)));
+
+        scheduler_type scheduler;
+        ASSERT_EQ(create_scheduler(scheduler, d_storage, storage_size - 1, tiles, grid_size),
+                  hipErrorInvalidValue);
+        HIP_CHECK(create_scheduler(scheduler, d_storage, storage_size, tiles, grid_size));
+        ASSERT_EQ(scheduler.number_of_tiles(), tiles);
+
+        // The scheduler is initialized before every launch
+        for(int run = 0; run < 2; ++run)
+        {
+            HIP_CHECK(hipMemset(d_visits, 0, (tiles + 1) * sizeof(unsigned int)));
+            HIP_CHECK(hipMemset(d_unordered, 0, sizeof(unsigned int)));
+            HIP_CHECK(scheduler.initialize(stream));
+            persistent_kernel<<<grid_size, scheduler_block_size, 0, stream>>>(d_visits,
+                                                                              d_unordered,
+                                                                              scheduler);
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<unsigned int> visits(tiles);
+            unsigned int              unordered;
+            HIP_CHECK(hipMemcpy(visits.data(),
+                                d_visits,
+                                tiles * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(
+                hipMemcpy(&unordered, d_unordered, sizeof(unsigned int), hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(visits, std::vector<unsigned int>(tiles, 1)));
+            if(ordered)
+            {
+                ASSERT_EQ(unordered, 0u);
+            }
+        }
+
+        HIP_CHECK(hipFree(d_storage));
+        HIP_CHECK(hipFree(d_visits));
+        HIP_CHECK(hipFree(d_unordered));
+    }
+}
+
+// Every block writes its id, and after the barrier reads the id of the next block
+__global__ __launch_bounds__(scheduler_block_size) void grid_barrier_kernel(
+    unsigned int* values, unsigned int* output, rocprim::grid_barrier barrier)
+{
+    const unsigned int block     = blockIdx.x;
+    const unsigned int grid_size = gridDim.x;
+    for(unsigned int round = 0; round < 3; ++round)
+    {
+        if(threadIdx.x == 0)
+        {
+            values[block] = block + round;
+        }
+        barrier.sync();
+        if(threadIdx.x == 0)
+        {
+            output[round * grid_size + block] = values[(block + 1) % grid_size];
+        }
+        barrier.sync();
+    }
+}
+
+TEST(RocprimGridBarrierTests, Cooperative)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const hipStream_t stream = 0; // default
+
+    bool supported;
+    HIP_CHECK(rocprim::is_cooperative_launch_supported(stream, supported));
+    if(!supported)
+    {
+        GTEST_SKIP() << "Cooperative launches are not supported by the device";
+    }
+
+    unsigned int grid_size;
+    HIP_CHECK(rocprim::get_persistent_grid_size(grid_barrier_kernel,
+                                                scheduler_block_size,
+                                                stream,
+                                                grid_size));
+
+    void*         d_storage;
+    unsigned int* d_values;
+    unsigned int* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, rocprim::grid_barrier::storage_size));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, grid_size * sizeof(unsigned int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, 3 * grid_size * sizeof(unsigned int)));
+
+    rocprim::grid_barrier barrier;
+    ASSERT_EQ(rocprim::grid_barrier::create(barrier, nullptr), hipErrorInvalidValue);
+    HIP_CHECK(rocprim::grid_barrier::create(barrier, d_storage));
+
+    std::vector<unsigned int> expected(3 * grid_size);
+    for(unsigned int round = 0; round < 3; ++round)
+    {
+        for(unsigned int block = 0; block < grid_size; ++block)
+        {
+            expected[round * grid_size + block] = (block + 1) % grid_size + round;
+        }
+    }
+
+    // The barrier is initialized before every launch
+    for(int run = 0; run < 2; ++run)
+    {
+        HIP_CHECK(barrier.initialize(stream));
+        void* kernel_args[] = {&d_values, &d_output, &barrier};
+        HIP_CHECK(hipLaunchCooperativeKernel(reinterpret_cast<void*>(grid_barrier_kernel),
+                                             dim3(grid_size),
+                                             dim3(scheduler_block_size),
+                                             kernel_args,
+                                             0,
+                                             stream));
+
+        std::vector<unsigned int> output(3 * grid_size);
+        HIP_CHECK(hipMemcpy(output.data(),
+                            d_output,
+                            output.size() * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+    }
+
+    HIP_CHECK(hipFree(d_storage));
+    HIP_CHECK(hipFree(d_values));
+    HIP_CHECK(hipFree(d_output));
+}
@@ -0,0 +1,214 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load.hpp>
+#include <rocprim/block/block_scan.hpp>
+#include <rocprim/block/block_store.hpp>
+#include <rocprim/device/tuned_params.hpp>
+#include <rocprim/functional.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+
+using rocprim::detail::target_arch;
+
+template<class Params, class Config, target_arch Arch>
+constexpr bool same_tile_shape()
+{
+    return Params::block_size == Config::template architecture_config<Arch>::params.block_size
+           && Params::items_per_thread
+                  == Config::template architecture_config<Arch>::params.items_per_thread;
+}
+
+// The tuned parameters are the ones of the default configs
+static_assert(rocprim::tuned_params<rocprim::tuned::scan, int, 942>::block_size
+                  == rocprim::detail::wrapped_scan_config<rocprim::default_config, int>::
+                      architecture_config<target_arch::gfx942>::params.kernel_config.block_size,
+              "tuned_params must be the parameters of the default config");
+static_assert(rocprim::tuned_params<rocprim::tuned::scan, int, 942>::block_scan_method
+                  == rocprim::detail::wrapped_scan_config<rocprim::default_config, int>::
+                      architecture_config<target_arch::gfx942>::params.block_scan_method,
+              "tuned_params must be the methods of the default config");
+static_assert(same_tile_shape<rocprim::tuned_params<rocprim::tuned::radix_sort_block_sort<int>,
+                                                    unsigned int,
+                                                    1100>,
+                              rocprim::detail::wrapped_radix_sort_block_sort_config<
+                                  rocprim::default_config,
+                                  unsigned int,
+                                  int>,
+                              target_arch::gfx1100>(),
+              "tuned_params must be the parameters of the default config");
+
+// Architectures without tuned configs take the ones of target_arch::unknown
+static_assert(same_tile_shape<rocprim::tuned_params<rocprim::tuned::radix_sort_block_sort<>,
+                                                    short,
+                                                    0>,
+                              rocprim::detail::wrapped_radix_sort_block_sort_config<
+                                  rocprim::default_config,
+                                  short,
+                                  rocprim::empty_type>,
+                              target_arch::unknown>(),
+              "unknown architecture must use the generic parameters");
+static_assert(rocprim::detail::tuned_target_arch(1201) == target_arch::unknown,
+              "unknown architecture must use the generic parameters");
+static_assert(rocprim::tuned_params<rocprim::tuned::transform, double, 910>::items_per_block
+                  == rocprim::tuned_params<rocprim::tuned::transform, double, 910>::block_size
+                         * rocprim::tuned_params<rocprim::tuned::transform, double, 910>::
+                             items_per_thread,
+              "items_per_block must be the size of a tile");
+
+using scan_params = rocprim::tuned_params<rocprim::tuned::scan, int>;
+
+__global__ void tuned_params_kernel(unsigned int* output)
+{
+    output[0] = scan_params::block_size;
+    output[1] = scan_params::items_per_thread;
+}
+
+// Inclusive scan of every tile with the tuned tile shape of the device
+__global__ __launch_bounds__(scan_params::block_size) void tuned_scan_kernel(const int* input,
+                                                                            int*       output)
+{
+    using block_load  = rocprim::block_load<int,
+                                           scan_params::block_size,
+                                           scan_params::items_per_thread,
+                                           scan_params::block_load_method>;
+    using block_scan  = rocprim::block_scan<int,
+                                           scan_params::block_size,
+                                           scan_params::block_scan_method>;
+    using block_store = rocprim::block_store<int,
+                                             scan_params::block_size,
+                                             scan_params::items_per_thread,
+                                             scan_params::block_store_method>;
+
+    __shared__ union
+    {
+        typename block_load::storage_type  load;
+        typename block_scan::storage_type  scan;
+        typename block_store::storage_type store;
+    } storage;
+
+    const unsigned int offset = blockIdx.x * scan_params::items_per_block;
+
+    int values[scan_params::items_per_thread];
+    block_load().load(input + offset, values, storage.load);
+    rocprim::syncthreads();
+    block_scan().inclusive_scan(values, values, storage.scan, rocprim::plus<int>());
+    rocprim::syncthreads();
+    block_store().store(output + offset, values, storage.store);
+}
+
+} // namespace
+
+TEST(RocprimTunedParamsTests, LaunchParams)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const hipStream_t stream = 0; // default
+
+    rocprim::tuned_launch_params params;
+    HIP_CHECK(rocprim::get_tuned_launch_params<rocprim::tuned::scan, int>(params, stream));
+
+    unsigned int* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, 2 * sizeof(*d_output)));
+    tuned_params_kernel<<<1, 1, 0, stream>>>(d_output);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output(2);
+    HIP_CHECK(hipMemcpy(output.data(),
+                        d_output,
+                        output.size() * sizeof(output[0]),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(d_output));
+
+    // The host query gives the parameters of the device compilation
+    ASSERT_EQ(params.block_size, output[0]);
+    ASSERT_EQ(params.items_per_thread, output[1]);
+}
+
+TEST(RocprimTunedParamsTests, BlockScan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    const hipStream_t stream = 0; // default
+
+    rocprim::tuned_launch_params params;
+    HIP_CHECK(rocprim::get_tuned_launch_params<rocprim::tuned::scan, int>(params, stream));
+    const size_t items_per_block = params.block_size * params.items_per_thread;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const unsigned int grid_size : {1u, 7u, 100u})
+        {
+            SCOPED_TRACE(testing::Message() << "with grid_size = " << grid_size);
+
+            const size_t           size = grid_size * items_per_block;
+            const std::vector<int> input
+                = test_utils::get_random_data<int>(size, -100, 100, seed_value);
+
+            std::vector<int> expected(size);
+            for(size_t i = 0; i < size; ++i)
+            {
+                expected[i] = (i % items_per_block == 0 ? 0 : expected[i - 1]) + input[i];
+            }
+
+            int* d_input;
+            int* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(*d_input)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, size * sizeof(*d_output)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(*d_input), hipMemcpyHostToDevice));
+
+            tuned_scan_kernel<<<grid_size, params.block_size, 0, stream>>>(d_input, d_output);
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<int> output(size);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                size * sizeof(*d_output),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+        }
+    }
+}
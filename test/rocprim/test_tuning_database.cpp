@@ -0,0 +1,679 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/device_select.hpp>
+#include <rocprim/device/execution_budget.hpp>
+#include <rocprim/device/tuning_database.hpp>
+
+// required test headers
+#include "test_utils_assertions.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+
+hipError_t parse_database(const std::string& text)
+{
+    std::istringstream stream(text);
+    return rocprim::detail::tuning_database::instance().parse(stream);
+}
+
+size_t select_candidate(const char*                        algorithm,
+                        const rocprim::detail::target_arch arch,
+                        const char*                        key_type,
+                        const char*                        value_type,
+                        const size_t                       size,
+                        const size_t                       max_shared_memory = 0)
+{
+    return rocprim::detail::tuning_database::instance()
+        .select(algorithm, arch, key_type, value_type, size, 4, max_shared_memory);
+}
+
+struct multiple_of_three
+{
+    __host__ __device__
+    bool operator()(const int value) const
+    {
+        return value % 3 == 0;
+    }
+};
+
+} // namespace
+
+TEST(RocprimTuningDatabaseTests, Select)
+{
+    using rocprim::detail::target_arch;
+
+    HIP_CHECK(parse_database("# algorithm arch key_type value_type min_size candidate\n"
+                             "reduce gfx942 float - 0 1\n"
+                             "reduce gfx942 float - 1000 2\n"
+                             "\n"
+                             "reduce * int - 0 3 # any architecture\n"
+                             "radix_sort gfx90a * int 0 1\n"
+                             "radix_sort gfx90a * int 100 2\n"
+                             "radix_sort gfx90a * int 100 3\n"
+                             "radix_sort gfx1201 * * 0 1\n"
+                             "reduce gfx942 double - 0 7\n"));
+
+    // Size buckets
+    ASSERT_EQ(select_candidate("reduce", target_arch::gfx942, "float", "-", 0), size_t(1));
+    ASSERT_EQ(select_candidate("reduce", target_arch::gfx942, "float", "-", 999), size_t(1));
+    ASSERT_EQ(select_candidate("reduce", target_arch::gfx942, "float", "-", 1000), size_t(2));
+
+    // Wildcards
+    ASSERT_EQ(select_candidate("reduce", target_arch::gfx1030, "int", "-", 5), size_t(3));
+    ASSERT_EQ(select_candidate("radix_sort", target_arch::gfx90a, "short", "int", 5), size_t(1));
+    ASSERT_EQ(select_candidate("radix_sort", target_arch::gfx90a, nullptr, "int", 5), size_t(1));
+
+    // Later entries take precedence
+    ASSERT_EQ(select_candidate("radix_sort", target_arch::gfx90a, "short", "int", 100), size_t(3));
+
+    // No match, unknown architecture in the database and out-of-range candidate
+    ASSERT_EQ(select_candidate("reduce", target_arch::gfx908, "float", "-", 5), size_t(0));
+    ASSERT_EQ(select_candidate("radix_sort", target_arch::gfx90a, "int", "-", 5), size_t(0));
+    ASSERT_EQ(select_candidate("radix_sort", target_arch::unknown, "int", "int", 5), size_t(0));
+    ASSERT_EQ(select_candidate("reduce", target_arch::gfx942, "double", "-", 5), size_t(0));
+
+    rocprim::clear_tuning_database();
+    ASSERT_EQ(select_candidate("reduce", target_arch::gfx942, "float", "-", 5), size_t(0));
+}
+
+TEST(RocprimTuningDatabaseTests, Load)
+{
+    using rocprim::detail::target_arch;
+
+    const std::string filename = "rocprim_test_tuning_database.txt";
+    {
+        std::ofstream file(filename);
+        file << "reduce * * - 0 2\n";
+    }
+    HIP_CHECK(rocprim::load_tuning_database(filename.c_str()));
+    ASSERT_EQ(select_candidate("reduce", target_arch::gfx942, "int", "-", 5), size_t(2));
+
+    // Errors keep the previous database
+    ASSERT_EQ(rocprim::load_tuning_database("rocprim_test_missing_tuning_database.txt"),
+              hipErrorFileNotFound);
+    ASSERT_EQ(parse_database("reduce * * - 0\n"), hipErrorInvalidValue);
+    ASSERT_EQ(parse_database("reduce * * - 0 1 2\n"), hipErrorInvalidValue);
+    ASSERT_EQ(parse_database("reduce * * - zero 1\n"), hipErrorInvalidValue);
+    ASSERT_EQ(select_candidate("reduce", target_arch::gfx942, "int", "-", 5), size_t(2));
+
+    std::remove(filename.c_str());
+    rocprim::clear_tuning_database();
+}
+
+TEST(RocprimTuningDatabaseTests, SharedMemoryBudget)
+{
+    using rocprim::detail::target_arch;
+
+    HIP_CHECK(parse_database("radix_sort gfx942 int - 0 1 shared_memory=16384\n"
+                             "radix_sort gfx942 int - 0 3 shared_memory=61440\n"
+                             "radix_sort gfx942 int - 0 2 shared_memory=32768\n"
+                             "radix_sort gfx942 int - 1000 2 shared_memory=32768\n"
+                             "reduce * * - 0 2\n"));
+
+    // Without a budget the candidate with the largest shared memory is used
+    ASSERT_EQ(select_candidate("radix_sort", target_arch::gfx942, "int", "-", 5), size_t(3));
+    // With a budget the entries that exceed it are skipped
+    ASSERT_EQ(select_candidate("radix_sort", target_arch::gfx942, "int", "-", 5, 61440),
+              size_t(3));
+    ASSERT_EQ(select_candidate("radix_sort", target_arch::gfx942, "int", "-", 5, 40000),
+              size_t(2));
+    ASSERT_EQ(select_candidate("radix_sort", target_arch::gfx942, "int", "-", 5, 16384),
+              size_t(1));
+    // Size buckets still take precedence over the shared memory
+    ASSERT_EQ(select_candidate("radix_sort", target_arch::gfx942, "int", "-", 1000, 40000),
+              size_t(2));
+    ASSERT_EQ(select_candidate("radix_sort", target_arch::gfx942, "int", "-", 1000, 16384),
+              size_t(1));
+    // No entry fits, or entries without shared memory fit any budget
+    ASSERT_EQ(select_candidate("radix_sort", target_arch::gfx942, "int", "-", 5, 8192), size_t(0));
+    ASSERT_EQ(select_candidate("reduce", target_arch::gfx942, "int", "-", 5, 8192), size_t(2));
+
+    ASSERT_EQ(parse_database("reduce * * - 0 1 shared_memory\n"), hipErrorInvalidValue);
+    ASSERT_EQ(parse_database("reduce * * - 0 1 shared_memory=\n"), hipErrorInvalidValue);
+    ASSERT_EQ(parse_database("reduce * * - 0 1 shared_memory=1k\n"), hipErrorInvalidValue);
+    ASSERT_EQ(parse_database("reduce * * - 0 1 shared_memory=1 2\n"), hipErrorInvalidValue);
+
+    rocprim::clear_tuning_database();
+}
+
+// The budget of a stream selects the candidate of the algorithms launched on it
+TEST(RocprimTuningDatabaseTests, StreamSharedMemoryBudget)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+
+    ASSERT_EQ(rocprim::get_stream_shared_memory_budget(stream), size_t(0));
+    HIP_CHECK(rocprim::set_stream_shared_memory_budget(stream, 32768));
+    ASSERT_EQ(rocprim::get_stream_shared_memory_budget(stream), size_t(32768));
+    ASSERT_EQ(rocprim::get_stream_shared_memory_budget(hipStreamDefault), size_t(0));
+
+    HIP_CHECK(parse_database("reduce * int - 0 1 shared_memory=16384\n"
+                             "reduce * int - 0 2 shared_memory=65536\n"));
+
+    using config = rocprim::tuned_config<rocprim::reduce_config<64, 1>,
+                                         rocprim::reduce_config<128, 1>,
+                                         rocprim::reduce_config<256, 1>>;
+
+    const auto selected_block_size = [](const hipStream_t selected_stream)
+    {
+        unsigned int block_size = 0;
+        HIP_CHECK(
+            (rocprim::detail::dispatch_tuned_config<config, int, rocprim::empty_type>(
+                "reduce",
+                100,
+                selected_stream,
+                [&](auto tag)
+                {
+                    using selected_config = typename decltype(tag)::type;
+                    block_size            = selected_config{}.reduce_config.block_size;
+                    return hipSuccess;
+                })));
+        return block_size;
+    };
+    ASSERT_EQ(selected_block_size(stream), 128u);
+    ASSERT_EQ(selected_block_size(hipStreamDefault), 256u);
+
+    HIP_CHECK(rocprim::set_stream_shared_memory_budget(stream, 0));
+    ASSERT_EQ(rocprim::get_stream_shared_memory_budget(stream), size_t(0));
+    ASSERT_EQ(selected_block_size(stream), 256u);
+
+    rocprim::clear_tuning_database();
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+// Every candidate of a tuned config gives the same results
+TEST(RocprimTuningDatabaseTests, Reduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = int;
+    using config = rocprim::tuned_config<rocprim::default_config,
+                                         rocprim::reduce_config<64, 2>,
+                                         rocprim::reduce_config<256, 8>>;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(size, -100, 100, seed_value);
+            const T expected = std::accumulate(input.begin(), input.end(), T(0));
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            for(size_t candidate = 0; candidate < 3; ++candidate)
+            {
+                SCOPED_TRACE(testing::Message() << "with candidate = " << candidate);
+                HIP_CHECK(parse_database("reduce * int - 0 " + std::to_string(candidate) + "\n"));
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(rocprim::reduce<config>(nullptr,
+                                                  temp_storage_size_bytes,
+                                                  d_input,
+                                                  d_output,
+                                                  T(0),
+                                                  size,
+                                                  rocprim::plus<T>(),
+                                                  stream,
+                                                  debug_synchronous));
+
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(rocprim::reduce<config>(d_temp_storage,
+                                                  temp_storage_size_bytes,
+                                                  d_input,
+                                                  d_output,
+                                                  T(0),
+                                                  size,
+                                                  rocprim::plus<T>(),
+                                                  stream,
+                                                  debug_synchronous));
+                HIP_CHECK(hipGetLastError());
+
+                T output;
+                HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, expected);
+
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+
+    rocprim::clear_tuning_database();
+}
+
+TEST(RocprimTuningDatabaseTests, RadixSortKeys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type        = unsigned int;
+    using onesweep_config = rocprim::radix_sort_onesweep_config<rocprim::kernel_config<128, 1>,
+                                                                rocprim::kernel_config<128, 1>,
+                                                                4>;
+    using config          = rocprim::tuned_config<
+        rocprim::default_config,
+        rocprim::radix_sort_config<rocprim::kernel_config<256, 1>,
+                                   rocprim::merge_sort_config<128, 64, 2, 128, 64, 2>,
+                                   onesweep_config,
+                                   1024 * 512>>;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // The second candidate is only used for the larger sizes
+        HIP_CHECK(parse_database("radix_sort * uint32_t - 0 0\n"
+                                 "radix_sort * * - 1000 1\n"));
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<key_type> input
+                = test_utils::get_random_data<key_type>(size, 0, 1 << 30, seed_value);
+            std::vector<key_type> expected(input);
+            std::sort(expected.begin(), expected.end());
+
+            key_type* d_input;
+            key_type* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1)
+                                                             * sizeof(key_type)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::radix_sort_keys<config>(nullptr,
+                                                       temp_storage_size_bytes,
+                                                       d_input,
+                                                       d_output,
+                                                       size,
+                                                       0,
+                                                       sizeof(key_type) * 8,
+                                                       stream,
+                                                       debug_synchronous));
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::radix_sort_keys<config>(d_temp_storage,
+                                                       temp_storage_size_bytes,
+                                                       d_input,
+                                                       d_output,
+                                                       size,
+                                                       0,
+                                                       sizeof(key_type) * 8,
+                                                       stream,
+                                                       debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<key_type> output(size);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+
+    rocprim::clear_tuning_database();
+}
+
+// A small config for the inputs that fit into a few blocks, and a large one for the rest
+TEST(RocprimTuningDatabaseTests, ScanSizeBuckets)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = unsigned int;
+    using config = rocprim::tuned_config<
+        rocprim::scan_config<64,
+                             2,
+                             rocprim::block_load_method::block_load_transpose,
+                             rocprim::block_store_method::block_store_transpose,
+                             rocprim::block_scan_algorithm::using_warp_scan>,
+        rocprim::scan_config<256,
+                             16,
+                             rocprim::block_load_method::block_load_transpose,
+                             rocprim::block_store_method::block_store_transpose,
+                             rocprim::block_scan_algorithm::reduce_then_scan>>;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    HIP_CHECK(parse_database("scan * uint32_t - 0 0\n"
+                             "scan * uint32_t - 4096 1\n"));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+            std::vector<T>       expected(size);
+            std::partial_sum(input.begin(), input.end(), expected.begin());
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::inclusive_scan<config>(nullptr,
+                                                      temp_storage_size_bytes,
+                                                      d_input,
+                                                      d_output,
+                                                      size,
+                                                      rocprim::plus<T>(),
+                                                      stream,
+                                                      debug_synchronous));
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::inclusive_scan<config>(d_temp_storage,
+                                                      temp_storage_size_bytes,
+                                                      d_input,
+                                                      d_output,
+                                                      size,
+                                                      rocprim::plus<T>(),
+                                                      stream,
+                                                      debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+
+    rocprim::clear_tuning_database();
+}
+
+TEST(RocprimTuningDatabaseTests, SelectSizeBuckets)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = int;
+    using config = rocprim::tuned_config<rocprim::select_config<64, 2>,
+                                         rocprim::select_config<256, 8>>;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    HIP_CHECK(parse_database("select * int - 0 0\n"
+                             "select * int - 2048 1\n"));
+
+    const multiple_of_three predicate{};
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+            std::vector<T>       expected;
+            std::copy_if(input.begin(), input.end(), std::back_inserter(expected), predicate);
+
+            T*      d_input;
+            T*      d_output;
+            size_t* d_selected_count;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count, sizeof(size_t)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::select<config>(nullptr,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              d_output,
+                                              d_selected_count,
+                                              size,
+                                              predicate,
+                                              stream,
+                                              debug_synchronous));
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::select<config>(d_temp_storage,
+                                              temp_storage_size_bytes,
+                                              d_input,
+                                              d_output,
+                                              d_selected_count,
+                                              size,
+                                              predicate,
+                                              stream,
+                                              debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            size_t selected_count;
+            HIP_CHECK(hipMemcpy(&selected_count,
+                                d_selected_count,
+                                sizeof(size_t),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(selected_count, expected.size());
+
+            std::vector<T> output(selected_count);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                selected_count * sizeof(T),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_selected_count));
+        }
+    }
+
+    rocprim::clear_tuning_database();
+}
+
+TEST(RocprimTuningDatabaseTests, SizeBucketedConfigDispatch)
+{
+    struct small_config
+    {};
+    struct medium_config
+    {};
+    struct large_config
+    {};
+    using config = rocprim::size_bucketed_config<
+        100,
+        small_config,
+        rocprim::size_bucketed_config<10000, medium_config, large_config>>;
+
+    const auto selected = [](const size_t size)
+    {
+        int bucket = -1;
+        HIP_CHECK((rocprim::detail::dispatch_tuned_config<config, int, rocprim::empty_type>(
+            "scan",
+            size,
+            hipStream_t(0),
+            [&](auto selected_config)
+            {
+                using type = typename decltype(selected_config)::type;
+                bucket     = std::is_same<type, small_config>::value    ? 0
+                             : std::is_same<type, medium_config>::value ? 1
+                             : std::is_same<type, large_config>::value  ? 2
+                                                                        : -1;
+                return hipSuccess;
+            })));
+        return bucket;
+    };
+
+    ASSERT_EQ(selected(0), 0);
+    ASSERT_EQ(selected(100), 0);
+    ASSERT_EQ(selected(101), 1);
+    ASSERT_EQ(selected(10000), 1);
+    ASSERT_EQ(selected(10001), 2);
+}
+
+TEST(RocprimTuningDatabaseTests, ScanSizeBucketedConfig)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T      = unsigned int;
+    using config = rocprim::size_bucketed_config<
+        4096,
+        rocprim::scan_config<64,
+                             2,
+                             rocprim::block_load_method::block_load_transpose,
+                             rocprim::block_store_method::block_store_transpose,
+                             rocprim::block_scan_algorithm::using_warp_scan>,
+        rocprim::default_config>;
+    const bool        debug_synchronous = false;
+    const hipStream_t stream            = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(size, 0, 100, seed_value);
+            std::vector<T>       expected(size);
+            std::partial_sum(input.begin(), input.end(), expected.begin());
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         std::max<size_t>(size, 1) * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(rocprim::inclusive_scan<config>(nullptr,
+                                                      temp_storage_size_bytes,
+                                                      d_input,
+                                                      d_output,
+                                                      size,
+                                                      rocprim::plus<T>(),
+                                                      stream,
+                                                      debug_synchronous));
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(rocprim::inclusive_scan<config>(d_temp_storage,
+                                                      temp_storage_size_bytes,
+                                                      d_input,
+                                                      d_output,
+                                                      size,
+                                                      rocprim::plus<T>(),
+                                                      stream,
+                                                      debug_synchronous));
+            HIP_CHECK(hipGetLastError());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
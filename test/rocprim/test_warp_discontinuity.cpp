@@ -0,0 +1,254 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/block/block_store_func.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/warp/warp_discontinuity.hpp>
+
+// required test headers
+#include "test_utils.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <vector>
+
+template<class T, unsigned int WarpSize, unsigned int ItemsPerThread>
+struct Params
+{
+    using type                                     = T;
+    static constexpr unsigned int warp_size        = WarpSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimWarpDiscontinuityTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using RocprimWarpDiscontinuityTestsParams = ::testing::Types<Params<int, 64, 1>,
+                                                             Params<int, 64, 4>,
+                                                             Params<unsigned char, 32, 7>,
+                                                             Params<long long, 32, 2>,
+                                                             Params<float, 16, 3>,
+                                                             Params<short, 8, 16>,
+                                                             Params<int, 1, 5>>;
+
+TYPED_TEST_SUITE(RocprimWarpDiscontinuityTests, RocprimWarpDiscontinuityTestsParams);
+
+constexpr unsigned int warp_discontinuity_block_size = 256;
+
+enum class discontinuity_mode
+{
+    heads,
+    heads_tile,
+    tails,
+    tails_tile,
+    heads_and_tails
+};
+
+template<unsigned int       ItemsPerThread,
+         unsigned int       LogicalWarpSize,
+         discontinuity_mode Mode,
+         class T>
+__device__ auto warp_discontinuity_test(const T* input, int* heads, int* tails)
+    -> std::enable_if_t<test_utils::device_test_enabled_for_warp_size_v<LogicalWarpSize>>
+{
+    constexpr unsigned int num_warps = warp_discontinuity_block_size / LogicalWarpSize;
+    constexpr unsigned int items_per_warp = LogicalWarpSize * ItemsPerThread;
+
+    const unsigned int global_warp = blockIdx.x * num_warps + threadIdx.x / LogicalWarpSize;
+    const unsigned int lane        = threadIdx.x % LogicalWarpSize;
+    const unsigned int offset      = global_warp * items_per_warp;
+
+    T items[ItemsPerThread];
+    rocprim::block_load_direct_blocked(lane, input + offset, items);
+
+    // The neighbouring items of the other warps are used as tile predecessor and successor.
+    const unsigned int total_items = gridDim.x * warp_discontinuity_block_size * ItemsPerThread;
+    const T tile_predecessor       = input[offset == 0 ? total_items - 1 : offset - 1];
+    const unsigned int next_offset = offset + items_per_warp;
+    const T tile_successor         = input[next_offset == total_items ? 0 : next_offset];
+
+    int head_flags[ItemsPerThread];
+    int tail_flags[ItemsPerThread];
+    ROCPRIM_UNROLL
+    for(unsigned int i = 0; i < ItemsPerThread; ++i)
+    {
+        head_flags[i] = 0;
+        tail_flags[i] = 0;
+    }
+
+    rocprim::warp_discontinuity<T, LogicalWarpSize> warp_discontinuity;
+    rocprim::not_equal_to<T>                        flag_op;
+    switch(Mode)
+    {
+        case discontinuity_mode::heads:
+            warp_discontinuity.flag_heads(head_flags, items, flag_op);
+            break;
+        case discontinuity_mode::heads_tile:
+            warp_discontinuity.flag_heads(head_flags, tile_predecessor, items, flag_op);
+            break;
+        case discontinuity_mode::tails:
+            warp_discontinuity.flag_tails(tail_flags, items, flag_op);
+            break;
+        case discontinuity_mode::tails_tile:
+            warp_discontinuity.flag_tails(tail_flags, tile_successor, items, flag_op);
+            break;
+        case discontinuity_mode::heads_and_tails:
+            warp_discontinuity.flag_heads_and_tails(head_flags, tail_flags, items, flag_op);
+            break;
+    }
+
+    rocprim::block_store_direct_blocked(lane, heads + offset, head_flags);
+    rocprim::block_store_direct_blocked(lane, tails + offset, tail_flags);
+}
+
+template<unsigned int       ItemsPerThread,
+         unsigned int       LogicalWarpSize,
+         discontinuity_mode Mode,
+         class T>
+__device__ auto warp_discontinuity_test(const T* /*input*/, int* /*heads*/, int* /*tails*/)
+    -> std::enable_if_t<!test_utils::device_test_enabled_for_warp_size_v<LogicalWarpSize>>
+{}
+
+template<unsigned int       ItemsPerThread,
+         unsigned int       LogicalWarpSize,
+         discontinuity_mode Mode,
+         class T>
+__global__ __launch_bounds__(warp_discontinuity_block_size) void warp_discontinuity_kernel(
+    const T* input, int* heads, int* tails)
+{
+    warp_discontinuity_test<ItemsPerThread, LogicalWarpSize, Mode>(input, heads, tails);
+}
+
+template<class Params, discontinuity_mode Mode>
+void test_warp_discontinuity()
+{
+    using T                                 = typename Params::type;
+    constexpr unsigned int warp_size        = Params::warp_size;
+    constexpr unsigned int items_per_thread = Params::items_per_thread;
+    constexpr unsigned int items_per_warp   = warp_size * items_per_thread;
+    constexpr unsigned int grid_size        = 13;
+    constexpr size_t       size = size_t{grid_size} * warp_discontinuity_block_size
+                                * items_per_thread;
+
+    constexpr bool with_heads = Mode == discontinuity_mode::heads
+                                || Mode == discontinuity_mode::heads_tile
+                                || Mode == discontinuity_mode::heads_and_tails;
+    constexpr bool with_tails = Mode == discontinuity_mode::tails
+                                || Mode == discontinuity_mode::tails_tile
+                                || Mode == discontinuity_mode::heads_and_tails;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+    SKIP_IF_UNSUPPORTED_WARP_SIZE(warp_size, device_id);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Few distinct values, so that there are runs of equal items.
+        std::vector<T> input = test_utils::get_random_data<T>(size, 0, 2, seed_value);
+
+        std::vector<int> expected_heads(size, 0);
+        std::vector<int> expected_tails(size, 0);
+        for(size_t i = 0; i < size; i++)
+        {
+            const size_t first = i - i % items_per_warp;
+            const size_t last  = first + items_per_warp - 1;
+            if(with_heads)
+            {
+                const size_t prev = i == 0 ? size - 1 : i - 1;
+                expected_heads[i] = i == first && Mode != discontinuity_mode::heads_tile
+                                        ? 1
+                                        : int(input[prev] != input[i]);
+            }
+            if(with_tails)
+            {
+                const size_t next = i == size - 1 ? 0 : i + 1;
+                expected_tails[i] = i == last && Mode != discontinuity_mode::tails_tile
+                                        ? 1
+                                        : int(input[i] != input[next]);
+            }
+        }
+
+        T*   d_input;
+        int* d_heads;
+        int* d_tails;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_heads, size * sizeof(int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_tails, size * sizeof(int)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        warp_discontinuity_kernel<items_per_thread, warp_size, Mode>
+            <<<dim3(grid_size), dim3(warp_discontinuity_block_size), 0, 0>>>(d_input,
+                                                                             d_heads,
+                                                                             d_tails);
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<int> heads(size);
+        std::vector<int> tails(size);
+        HIP_CHECK(hipMemcpy(heads.data(), d_heads, size * sizeof(int), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(tails.data(), d_tails, size * sizeof(int), hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(heads, expected_heads));
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(tails, expected_tails));
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_heads));
+        HIP_CHECK(hipFree(d_tails));
+    }
+}
+
+TYPED_TEST(RocprimWarpDiscontinuityTests, FlagHeads)
+{
+    test_warp_discontinuity<typename TestFixture::params, discontinuity_mode::heads>();
+}
+
+TYPED_TEST(RocprimWarpDiscontinuityTests, FlagHeadsTilePredecessor)
+{
+    test_warp_discontinuity<typename TestFixture::params, discontinuity_mode::heads_tile>();
+}
+
+TYPED_TEST(RocprimWarpDiscontinuityTests, FlagTails)
+{
+    test_warp_discontinuity<typename TestFixture::params, discontinuity_mode::tails>();
+}
+
+TYPED_TEST(RocprimWarpDiscontinuityTests, FlagTailsTileSuccessor)
+{
+    test_warp_discontinuity<typename TestFixture::params, discontinuity_mode::tails_tile>();
+}
+
+TYPED_TEST(RocprimWarpDiscontinuityTests, FlagHeadsAndTails)
+{
+    test_warp_discontinuity<typename TestFixture::params, discontinuity_mode::heads_and_tails>();
+}
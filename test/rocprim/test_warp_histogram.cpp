@@ -0,0 +1,154 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/warp/warp_histogram.hpp>
+
+// required test headers
+#include "test_utils.hpp"
+#include "test_utils_data_generation.hpp"
+
+#include <vector>
+
+template<class T, unsigned int WarpSize, unsigned int ItemsPerThread, unsigned int Bins>
+struct Params
+{
+    using type                                     = T;
+    static constexpr unsigned int warp_size        = WarpSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+    static constexpr unsigned int bins             = Bins;
+};
+
+template<class Params>
+class RocprimWarpHistogramTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using RocprimWarpHistogramTestsParams = ::testing::Types<Params<unsigned int, 64, 1, 64>,
+                                                         Params<unsigned int, 64, 4, 256>,
+                                                         Params<unsigned char, 32, 8, 16>,
+                                                         Params<unsigned short, 32, 3, 100>,
+                                                         Params<int, 16, 5, 7>,
+                                                         Params<unsigned int, 8, 16, 1>,
+                                                         Params<unsigned int, 4, 2, 1000>>;
+
+TYPED_TEST_SUITE(RocprimWarpHistogramTests, RocprimWarpHistogramTestsParams);
+
+constexpr unsigned int warp_histogram_block_size = 256;
+
+template<unsigned int ItemsPerThread, unsigned int LogicalWarpSize, unsigned int Bins, class T>
+__device__ auto warp_histogram_test(T* input, unsigned int* output)
+    -> std::enable_if_t<test_utils::device_test_enabled_for_warp_size_v<LogicalWarpSize>>
+{
+    constexpr unsigned int num_warps = warp_histogram_block_size / LogicalWarpSize;
+    using warp_histogram_type = rocprim::warp_histogram<T, ItemsPerThread, Bins, LogicalWarpSize>;
+    ROCPRIM_SHARED_MEMORY unsigned int hist[num_warps][Bins];
+
+    const unsigned int warp_id     = threadIdx.x / LogicalWarpSize;
+    const unsigned int global_warp = blockIdx.x * num_warps + warp_id;
+    const unsigned int lane        = threadIdx.x % LogicalWarpSize;
+
+    T items[ItemsPerThread];
+    rocprim::block_load_direct_blocked(lane,
+                                       input + global_warp * LogicalWarpSize * ItemsPerThread,
+                                       items);
+
+    warp_histogram_type warp_histogram;
+    warp_histogram.histogram(items, hist[warp_id]);
+
+    for(unsigned int bin = lane; bin < Bins; bin += LogicalWarpSize)
+    {
+        output[global_warp * Bins + bin] = hist[warp_id][bin];
+    }
+}
+
+template<unsigned int ItemsPerThread, unsigned int LogicalWarpSize, unsigned int Bins, class T>
+__device__ auto warp_histogram_test(T* /*input*/, unsigned int* /*output*/)
+    -> std::enable_if_t<!test_utils::device_test_enabled_for_warp_size_v<LogicalWarpSize>>
+{}
+
+template<unsigned int ItemsPerThread, unsigned int LogicalWarpSize, unsigned int Bins, class T>
+__global__ __launch_bounds__(warp_histogram_block_size) void warp_histogram_kernel(
+    T* input, unsigned int* output)
+{
+    warp_histogram_test<ItemsPerThread, LogicalWarpSize, Bins>(input, output);
+}
+
+TYPED_TEST(RocprimWarpHistogramTests, Histogram)
+{
+    using T                                     = typename TestFixture::params::type;
+    constexpr unsigned int warp_size            = TestFixture::params::warp_size;
+    constexpr unsigned int items_per_thread     = TestFixture::params::items_per_thread;
+    constexpr unsigned int bins                 = TestFixture::params::bins;
+    constexpr unsigned int items_per_warp       = warp_size * items_per_thread;
+    constexpr unsigned int grid_size            = 13;
+    constexpr unsigned int warps = grid_size * warp_histogram_block_size / warp_size;
+    constexpr size_t       size  = items_per_warp * warps;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+    SKIP_IF_UNSUPPORTED_WARP_SIZE(warp_size, device_id);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::vector<T> input = test_utils::get_random_data<T>(size, 0, bins - 1, seed_value);
+
+        std::vector<unsigned int> expected(warps * bins, 0);
+        for(size_t i = 0; i < size; i++)
+        {
+            expected[(i / items_per_warp) * bins + static_cast<unsigned int>(input[i])]++;
+        }
+
+        T*            d_input;
+        unsigned int* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                     expected.size() * sizeof(unsigned int)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        warp_histogram_kernel<items_per_thread, warp_size, bins>
+            <<<dim3(grid_size), dim3(warp_histogram_block_size), 0, 0>>>(d_input, d_output);
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<unsigned int> output(expected.size());
+        HIP_CHECK(hipMemcpy(output.data(),
+                            d_output,
+                            output.size() * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+    }
+}
@@ -0,0 +1,260 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/block/block_store_func.hpp>
+#include <rocprim/warp/warp_merge_sort.hpp>
+
+// required test headers
+#include "test_utils.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+template<class Key, class Value, unsigned int WarpSize, unsigned int ItemsPerThread>
+struct Params
+{
+    using key_type                                 = Key;
+    using value_type                               = Value;
+    static constexpr unsigned int warp_size        = WarpSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimWarpMergeSortTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using RocprimWarpMergeSortTestsParams = ::testing::Types<Params<int, int, 64, 1>,
+                                                         Params<int, int, 64, 4>,
+                                                         Params<int, int, 32, 16>,
+                                                         Params<uint8_t, int, 16, 7>,
+                                                         Params<long long, short, 32, 3>,
+                                                         Params<float, int, 64, 16>,
+                                                         Params<double, int, 8, 5>,
+                                                         Params<int, int, 1, 6>>;
+
+TYPED_TEST_SUITE(RocprimWarpMergeSortTests, RocprimWarpMergeSortTestsParams);
+
+constexpr unsigned int warp_merge_sort_block_size = 64;
+
+template<unsigned int ItemsPerThread,
+         unsigned int LogicalWarpSize,
+         bool         WithValues,
+         class Key,
+         class Value,
+         class BinaryFunction>
+__device__ auto warp_merge_sort_test(Key*                keys,
+                                     Value*              values,
+                                     const unsigned int* valid_items,
+                                     BinaryFunction      compare_function)
+    -> std::enable_if_t<test_utils::device_test_enabled_for_warp_size_v<LogicalWarpSize>>
+{
+    constexpr unsigned int num_warps = warp_merge_sort_block_size / LogicalWarpSize;
+    using warp_sort_type = rocprim::warp_merge_sort<Key, ItemsPerThread, LogicalWarpSize, Value>;
+    ROCPRIM_SHARED_MEMORY typename warp_sort_type::storage_type storage[num_warps];
+
+    const unsigned int warp_id     = threadIdx.x / LogicalWarpSize;
+    const unsigned int global_warp = blockIdx.x * num_warps + warp_id;
+    const unsigned int lane        = threadIdx.x % LogicalWarpSize;
+    const unsigned int offset      = global_warp * LogicalWarpSize * ItemsPerThread;
+    const unsigned int valid       = valid_items[global_warp];
+
+    Key   thread_keys[ItemsPerThread];
+    Value thread_values[ItemsPerThread];
+    rocprim::block_load_direct_blocked(lane, keys + offset, thread_keys, valid);
+    rocprim::block_load_direct_blocked(lane, values + offset, thread_values, valid);
+
+    if(WithValues)
+    {
+        warp_sort_type().sort(thread_keys,
+                              thread_values,
+                              storage[warp_id],
+                              valid,
+                              compare_function);
+    }
+    else
+    {
+        warp_sort_type().sort(thread_keys, storage[warp_id], valid, compare_function);
+    }
+
+    rocprim::block_store_direct_blocked(lane, keys + offset, thread_keys, valid);
+    rocprim::block_store_direct_blocked(lane, values + offset, thread_values, valid);
+}
+
+template<unsigned int ItemsPerThread,
+         unsigned int LogicalWarpSize,
+         bool         WithValues,
+         class Key,
+         class Value,
+         class BinaryFunction>
+__device__ auto warp_merge_sort_test(Key* /*keys*/,
+                                     Value* /*values*/,
+                                     const unsigned int* /*valid_items*/,
+                                     BinaryFunction /*compare_function*/)
+    -> std::enable_if_t<!test_utils::device_test_enabled_for_warp_size_v<LogicalWarpSize>>
+{}
+
+template<unsigned int ItemsPerThread,
+         unsigned int LogicalWarpSize,
+         bool         WithValues,
+         class Key,
+         class Value,
+         class BinaryFunction>
+__global__ __launch_bounds__(warp_merge_sort_block_size) void warp_merge_sort_kernel(
+    Key* keys, Value* values, const unsigned int* valid_items, BinaryFunction compare_function)
+{
+    warp_merge_sort_test<ItemsPerThread, LogicalWarpSize, WithValues>(keys,
+                                                                      values,
+                                                                      valid_items,
+                                                                      compare_function);
+}
+
+template<class Params, bool WithValues, class BinaryFunction>
+void test_warp_merge_sort(BinaryFunction compare_function)
+{
+    using key_type                          = typename Params::key_type;
+    using value_type                        = typename Params::value_type;
+    constexpr unsigned int warp_size        = Params::warp_size;
+    constexpr unsigned int items_per_thread = Params::items_per_thread;
+    constexpr unsigned int items_per_warp   = warp_size * items_per_thread;
+    constexpr unsigned int grid_size        = 13;
+    constexpr unsigned int warps            = grid_size * warp_merge_sort_block_size / warp_size;
+    constexpr size_t       size             = items_per_warp * warps;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+    SKIP_IF_UNSUPPORTED_WARP_SIZE(warp_size, device_id);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // Few distinct keys, so that the stability is checked
+        std::vector<key_type> keys
+            = test_utils::get_random_data<key_type>(size, 0, 50, seed_value);
+        std::vector<value_type> values(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            values[i] = static_cast<value_type>(i % items_per_warp);
+        }
+
+        // The first warps cover the empty, single item and full edge cases
+        std::vector<unsigned int> valid_items
+            = test_utils::get_random_data<unsigned int>(warps, 0, items_per_warp, seed_value);
+        valid_items[0] = 0;
+        valid_items[1] = 1;
+        valid_items[2] = items_per_warp;
+
+        std::vector<key_type>   expected_keys(keys);
+        std::vector<value_type> expected_values(values);
+        for(unsigned int warp = 0; warp < warps; warp++)
+        {
+            const size_t offset = warp * items_per_warp;
+            const size_t end    = offset + valid_items[warp];
+
+            std::vector<std::pair<key_type, value_type>> pairs;
+            for(size_t i = offset; i < end; i++)
+            {
+                pairs.emplace_back(keys[i], values[i]);
+            }
+            std::stable_sort(pairs.begin(),
+                             pairs.end(),
+                             [&](const std::pair<key_type, value_type>& a,
+                                 const std::pair<key_type, value_type>& b)
+                             { return compare_function(a.first, b.first); });
+            for(size_t i = 0; i < pairs.size(); i++)
+            {
+                expected_keys[offset + i]   = pairs[i].first;
+                expected_values[offset + i] = pairs[i].second;
+            }
+        }
+
+        key_type*     d_keys;
+        value_type*   d_values;
+        unsigned int* d_valid_items;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(value_type)));
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_valid_items, warps * sizeof(unsigned int)));
+        HIP_CHECK(
+            hipMemcpy(d_keys, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+        HIP_CHECK(
+            hipMemcpy(d_values, values.data(), size * sizeof(value_type), hipMemcpyHostToDevice));
+        HIP_CHECK(hipMemcpy(d_valid_items,
+                            valid_items.data(),
+                            warps * sizeof(unsigned int),
+                            hipMemcpyHostToDevice));
+
+        warp_merge_sort_kernel<items_per_thread, warp_size, WithValues>
+            <<<dim3(grid_size), dim3(warp_merge_sort_block_size), 0, 0>>>(d_keys,
+                                                                         d_values,
+                                                                         d_valid_items,
+                                                                         compare_function);
+        HIP_CHECK(hipGetLastError());
+
+        HIP_CHECK(
+            hipMemcpy(keys.data(), d_keys, size * sizeof(key_type), hipMemcpyDeviceToHost));
+        HIP_CHECK(
+            hipMemcpy(values.data(), d_values, size * sizeof(value_type), hipMemcpyDeviceToHost));
+
+        // Items after the valid ones are not written
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys, expected_keys));
+        if(WithValues)
+        {
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values, expected_values));
+        }
+
+        HIP_CHECK(hipFree(d_keys));
+        HIP_CHECK(hipFree(d_values));
+        HIP_CHECK(hipFree(d_valid_items));
+    }
+}
+
+TYPED_TEST(RocprimWarpMergeSortTests, SortKeys)
+{
+    using key_type = typename TestFixture::params::key_type;
+    test_warp_merge_sort<typename TestFixture::params, false>(rocprim::less<key_type>());
+}
+
+TYPED_TEST(RocprimWarpMergeSortTests, SortPairs)
+{
+    using key_type = typename TestFixture::params::key_type;
+    test_warp_merge_sort<typename TestFixture::params, true>(rocprim::less<key_type>());
+}
+
+TYPED_TEST(RocprimWarpMergeSortTests, SortPairsDescending)
+{
+    using key_type = typename TestFixture::params::key_type;
+    test_warp_merge_sort<typename TestFixture::params, true>(rocprim::greater<key_type>());
+}
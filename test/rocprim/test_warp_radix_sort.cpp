@@ -0,0 +1,278 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/block/block_store_func.hpp>
+#include <rocprim/warp/warp_radix_sort.hpp>
+
+// required test headers
+#include "test_utils.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <algorithm>
+#include <vector>
+
+template<class Key,
+         class Value,
+         unsigned int WarpSize,
+         unsigned int ItemsPerThread,
+         unsigned int RadixBitsPerPass = 4>
+struct Params
+{
+    using key_type                                    = Key;
+    using value_type                                  = Value;
+    static constexpr unsigned int warp_size           = WarpSize;
+    static constexpr unsigned int items_per_thread    = ItemsPerThread;
+    static constexpr unsigned int radix_bits_per_pass = RadixBitsPerPass;
+};
+
+template<class Params>
+class RocprimWarpRadixSortTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using RocprimWarpRadixSortTestsParams = ::testing::Types<Params<int, int, 64, 1>,
+                                                         Params<int, int, 64, 4>,
+                                                         Params<unsigned int, int, 32, 8, 5>,
+                                                         Params<uint8_t, int, 16, 7>,
+                                                         Params<long long, short, 32, 3, 8>,
+                                                         Params<float, int, 64, 16>,
+                                                         Params<double, int, 8, 5, 3>,
+                                                         Params<short, int, 4, 2, 1>>;
+
+TYPED_TEST_SUITE(RocprimWarpRadixSortTests, RocprimWarpRadixSortTestsParams);
+
+constexpr unsigned int warp_radix_sort_block_size = 256;
+
+template<unsigned int ItemsPerThread,
+         unsigned int LogicalWarpSize,
+         unsigned int RadixBitsPerPass,
+         bool         WithValues,
+         bool         Descending,
+         class Key,
+         class Value>
+__device__ auto warp_radix_sort_test(Key* keys, Value* values, unsigned int end_bit)
+    -> std::enable_if_t<test_utils::device_test_enabled_for_warp_size_v<LogicalWarpSize>>
+{
+    constexpr unsigned int num_warps = warp_radix_sort_block_size / LogicalWarpSize;
+    using warp_sort_type             = rocprim::
+        warp_radix_sort<Key, ItemsPerThread, LogicalWarpSize, Value, RadixBitsPerPass>;
+    ROCPRIM_SHARED_MEMORY typename warp_sort_type::storage_type storage[num_warps];
+
+    const unsigned int warp_id     = threadIdx.x / LogicalWarpSize;
+    const unsigned int global_warp = blockIdx.x * num_warps + warp_id;
+    const unsigned int lane        = threadIdx.x % LogicalWarpSize;
+    const unsigned int offset      = global_warp * LogicalWarpSize * ItemsPerThread;
+
+    Key   thread_keys[ItemsPerThread];
+    Value thread_values[ItemsPerThread];
+    rocprim::block_load_direct_blocked(lane, keys + offset, thread_keys);
+    rocprim::block_load_direct_blocked(lane, values + offset, thread_values);
+
+    warp_sort_type warp_sort;
+    if(WithValues && Descending)
+    {
+        warp_sort.sort_desc(thread_keys, thread_values, storage[warp_id], 0, end_bit);
+    }
+    else if(WithValues)
+    {
+        warp_sort.sort(thread_keys, thread_values, storage[warp_id], 0, end_bit);
+    }
+    else if(Descending)
+    {
+        warp_sort.sort_desc(thread_keys, storage[warp_id], 0, end_bit);
+    }
+    else
+    {
+        warp_sort.sort(thread_keys, storage[warp_id], 0, end_bit);
+    }
+
+    rocprim::block_store_direct_blocked(lane, keys + offset, thread_keys);
+    rocprim::block_store_direct_blocked(lane, values + offset, thread_values);
+}
+
+template<unsigned int ItemsPerThread,
+         unsigned int LogicalWarpSize,
+         unsigned int RadixBitsPerPass,
+         bool         WithValues,
+         bool         Descending,
+         class Key,
+         class Value>
+__device__ auto warp_radix_sort_test(Key* /*keys*/, Value* /*values*/, unsigned int /*end_bit*/)
+    -> std::enable_if_t<!test_utils::device_test_enabled_for_warp_size_v<LogicalWarpSize>>
+{}
+
+template<unsigned int ItemsPerThread,
+         unsigned int LogicalWarpSize,
+         unsigned int RadixBitsPerPass,
+         bool         WithValues,
+         bool         Descending,
+         class Key,
+         class Value>
+__global__ __launch_bounds__(warp_radix_sort_block_size) void warp_radix_sort_kernel(
+    Key* keys, Value* values, unsigned int end_bit)
+{
+    warp_radix_sort_test<ItemsPerThread, LogicalWarpSize, RadixBitsPerPass, WithValues, Descending>(
+        keys,
+        values,
+        end_bit);
+}
+
+// The values are the positions of the keys in their warp, so the order of equal keys is
+// checked too.
+template<class Params, bool WithValues, bool Descending>
+void test_warp_radix_sort(const bool all_bits)
+{
+    using key_type                             = typename Params::key_type;
+    using value_type                           = typename Params::value_type;
+    constexpr unsigned int warp_size           = Params::warp_size;
+    constexpr unsigned int items_per_thread    = Params::items_per_thread;
+    constexpr unsigned int radix_bits_per_pass = Params::radix_bits_per_pass;
+    constexpr unsigned int items_per_warp      = warp_size * items_per_thread;
+    constexpr unsigned int grid_size           = 13;
+    constexpr unsigned int warps = grid_size * warp_radix_sort_block_size / warp_size;
+    constexpr size_t       size  = items_per_warp * warps;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+    SKIP_IF_UNSUPPORTED_WARP_SIZE(warp_size, device_id);
+
+    // Sorting only the low bits of integers is the same as sorting the keys modulo 2^end_bit.
+    const bool         partial_bits = !all_bits && rocprim::is_integral<key_type>::value;
+    const unsigned int end_bit      = partial_bits ? 5 : 8 * sizeof(key_type);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        std::vector<key_type> keys
+            = rocprim::is_floating_point<key_type>::value
+                  ? test_utils::get_random_data<key_type>(size, -1000, 1000, seed_value)
+                  : test_utils::get_random_data<key_type>(size, 0, 100, seed_value);
+        std::vector<value_type> values(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            values[i] = static_cast<value_type>(i % items_per_warp);
+        }
+
+        auto sort_key = [&](const key_type& key)
+        {
+            return partial_bits ? static_cast<key_type>(static_cast<unsigned long long>(key)
+                                                        & ((1ull << end_bit) - 1))
+                                : key;
+        };
+
+        std::vector<key_type>   expected_keys(keys);
+        std::vector<value_type> expected_values(values);
+        for(unsigned int warp = 0; warp < warps; warp++)
+        {
+            const size_t offset = warp * items_per_warp;
+
+            std::vector<std::pair<key_type, value_type>> pairs;
+            for(size_t i = offset; i < offset + items_per_warp; i++)
+            {
+                pairs.emplace_back(keys[i], values[i]);
+            }
+            std::stable_sort(pairs.begin(),
+                             pairs.end(),
+                             [&](const std::pair<key_type, value_type>& a,
+                                 const std::pair<key_type, value_type>& b)
+                             {
+                                 return Descending ? sort_key(b.first) < sort_key(a.first)
+                                                   : sort_key(a.first) < sort_key(b.first);
+                             });
+            for(size_t i = 0; i < pairs.size(); i++)
+            {
+                expected_keys[offset + i]   = pairs[i].first;
+                expected_values[offset + i] = pairs[i].second;
+            }
+        }
+
+        key_type*   d_keys;
+        value_type* d_values;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(value_type)));
+        HIP_CHECK(
+            hipMemcpy(d_keys, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+        HIP_CHECK(
+            hipMemcpy(d_values, values.data(), size * sizeof(value_type), hipMemcpyHostToDevice));
+
+        warp_radix_sort_kernel<items_per_thread,
+                               warp_size,
+                               radix_bits_per_pass,
+                               WithValues,
+                               Descending>
+            <<<dim3(grid_size), dim3(warp_radix_sort_block_size), 0, 0>>>(d_keys,
+                                                                         d_values,
+                                                                         end_bit);
+        HIP_CHECK(hipGetLastError());
+
+        HIP_CHECK(
+            hipMemcpy(keys.data(), d_keys, size * sizeof(key_type), hipMemcpyDeviceToHost));
+        HIP_CHECK(
+            hipMemcpy(values.data(), d_values, size * sizeof(value_type), hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(keys, expected_keys));
+        if(WithValues)
+        {
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values, expected_values));
+        }
+
+        HIP_CHECK(hipFree(d_keys));
+        HIP_CHECK(hipFree(d_values));
+    }
+}
+
+TYPED_TEST(RocprimWarpRadixSortTests, SortKeys)
+{
+    test_warp_radix_sort<typename TestFixture::params, false, false>(true);
+}
+
+TYPED_TEST(RocprimWarpRadixSortTests, SortKeysDescending)
+{
+    test_warp_radix_sort<typename TestFixture::params, false, true>(true);
+}
+
+TYPED_TEST(RocprimWarpRadixSortTests, SortPairs)
+{
+    test_warp_radix_sort<typename TestFixture::params, true, false>(true);
+}
+
+TYPED_TEST(RocprimWarpRadixSortTests, SortPairsDescending)
+{
+    test_warp_radix_sort<typename TestFixture::params, true, true>(true);
+}
+
+TYPED_TEST(RocprimWarpRadixSortTests, SortPairsLowBits)
+{
+    test_warp_radix_sort<typename TestFixture::params, true, false>(false);
+}
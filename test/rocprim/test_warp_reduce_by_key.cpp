@@ -0,0 +1,354 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/block/block_load_func.hpp>
+#include <rocprim/warp/warp_reduce_by_key.hpp>
+
+// required test headers
+#include "test_utils.hpp"
+#include "test_utils_data_generation.hpp"
+#include "test_utils_types.hpp"
+
+#include <vector>
+
+template<class Key, class Value, unsigned int WarpSize, unsigned int ItemsPerThread>
+struct Params
+{
+    using key_type                                 = Key;
+    using value_type                               = Value;
+    static constexpr unsigned int warp_size        = WarpSize;
+    static constexpr unsigned int items_per_thread = ItemsPerThread;
+};
+
+template<class Params>
+class RocprimWarpReduceByKeyTests : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+using RocprimWarpReduceByKeyTestsParams = ::testing::Types<Params<int, int, 64, 1>,
+                                                           Params<int, int, 64, 4>,
+                                                           Params<uint8_t, int, 32, 7>,
+                                                           Params<long long, short, 32, 2>,
+                                                           Params<float, float, 16, 3>,
+                                                           Params<int, double, 8, 8>,
+                                                           Params<short, int, 4, 5>>;
+
+TYPED_TEST_SUITE(RocprimWarpReduceByKeyTests, RocprimWarpReduceByKeyTestsParams);
+
+constexpr unsigned int warp_reduce_by_key_block_size = 256;
+// Every warp reduces its items in this many tiles.
+constexpr unsigned int warp_reduce_by_key_tiles = 3;
+
+template<unsigned int ItemsPerThread,
+         unsigned int LogicalWarpSize,
+         bool         WithCarry,
+         class Key,
+         class Value>
+__device__ auto warp_reduce_by_key_test(const Key*          keys,
+                                        const Value*        values,
+                                        const unsigned int* sizes,
+                                        Key*                unique,
+                                        Value*              aggregates,
+                                        unsigned int*       run_counts)
+    -> std::enable_if_t<test_utils::device_test_enabled_for_warp_size_v<LogicalWarpSize>>
+{
+    constexpr unsigned int num_warps      = warp_reduce_by_key_block_size / LogicalWarpSize;
+    constexpr unsigned int items_per_warp = LogicalWarpSize * ItemsPerThread;
+    using warp_reduce_by_key_type = rocprim::warp_reduce_by_key<Key, Value, LogicalWarpSize>;
+    ROCPRIM_SHARED_MEMORY typename warp_reduce_by_key_type::storage_type storage[num_warps];
+
+    const unsigned int warp_id     = threadIdx.x / LogicalWarpSize;
+    const unsigned int global_warp = blockIdx.x * num_warps + warp_id;
+    const unsigned int lane        = threadIdx.x % LogicalWarpSize;
+    const unsigned int warp_offset = global_warp * items_per_warp * warp_reduce_by_key_tiles;
+    const unsigned int size        = sizes[global_warp];
+
+    typename warp_reduce_by_key_type::carry_type carry{};
+    unsigned int                                 runs  = 0;
+    const unsigned int                           tiles = WithCarry ? warp_reduce_by_key_tiles : 1;
+    for(unsigned int tile = 0; tile < tiles; tile++)
+    {
+        const unsigned int tile_offset = tile * items_per_warp;
+        const unsigned int valid_items
+            = size > tile_offset ? rocprim::min(size - tile_offset, items_per_warp) : 0;
+
+        Key   thread_keys[ItemsPerThread];
+        Value thread_values[ItemsPerThread];
+        rocprim::block_load_direct_blocked(lane,
+                                           keys + warp_offset + tile_offset,
+                                           thread_keys,
+                                           valid_items);
+        rocprim::block_load_direct_blocked(lane,
+                                           values + warp_offset + tile_offset,
+                                           thread_values,
+                                           valid_items);
+
+        Key*         tile_unique     = unique + warp_offset + runs;
+        Value*       tile_aggregates = aggregates + warp_offset + runs;
+        unsigned int run_count;
+        if(WithCarry && valid_items == items_per_warp)
+        {
+            warp_reduce_by_key_type().reduce(thread_keys,
+                                             thread_values,
+                                             tile_unique,
+                                             tile_aggregates,
+                                             run_count,
+                                             carry,
+                                             storage[warp_id]);
+        }
+        else if(WithCarry)
+        {
+            warp_reduce_by_key_type().reduce(thread_keys,
+                                             thread_values,
+                                             valid_items,
+                                             tile_unique,
+                                             tile_aggregates,
+                                             run_count,
+                                             carry,
+                                             storage[warp_id]);
+        }
+        else if(valid_items == items_per_warp)
+        {
+            warp_reduce_by_key_type().reduce(thread_keys,
+                                             thread_values,
+                                             tile_unique,
+                                             tile_aggregates,
+                                             run_count,
+                                             storage[warp_id]);
+        }
+        else
+        {
+            warp_reduce_by_key_type().reduce(thread_keys,
+                                             thread_values,
+                                             valid_items,
+                                             tile_unique,
+                                             tile_aggregates,
+                                             run_count,
+                                             storage[warp_id]);
+        }
+        runs += run_count;
+        rocprim::wave_barrier();
+    }
+
+    if(lane == 0)
+    {
+        if(carry.is_open)
+        {
+            unique[warp_offset + runs]     = carry.key;
+            aggregates[warp_offset + runs] = carry.aggregate;
+            runs++;
+        }
+        run_counts[global_warp] = runs;
+    }
+}
+
+template<unsigned int ItemsPerThread,
+         unsigned int LogicalWarpSize,
+         bool         WithCarry,
+         class Key,
+         class Value>
+__device__ auto warp_reduce_by_key_test(const Key* /*keys*/,
+                                        const Value* /*values*/,
+                                        const unsigned int* /*sizes*/,
+                                        Key* /*unique*/,
+                                        Value* /*aggregates*/,
+                                        unsigned int* /*run_counts*/)
+    -> std::enable_if_t<!test_utils::device_test_enabled_for_warp_size_v<LogicalWarpSize>>
+{}
+
+template<unsigned int ItemsPerThread,
+         unsigned int LogicalWarpSize,
+         bool         WithCarry,
+         class Key,
+         class Value>
+__global__ __launch_bounds__(warp_reduce_by_key_block_size) void warp_reduce_by_key_kernel(
+    const Key*          keys,
+    const Value*        values,
+    const unsigned int* sizes,
+    Key*                unique,
+    Value*              aggregates,
+    unsigned int*       run_counts)
+{
+    warp_reduce_by_key_test<ItemsPerThread, LogicalWarpSize, WithCarry>(keys,
+                                                                        values,
+                                                                        sizes,
+                                                                        unique,
+                                                                        aggregates,
+                                                                        run_counts);
+}
+
+template<class Params, bool WithCarry>
+void test_warp_reduce_by_key()
+{
+    using key_type                          = typename Params::key_type;
+    using value_type                        = typename Params::value_type;
+    constexpr unsigned int warp_size        = Params::warp_size;
+    constexpr unsigned int items_per_thread = Params::items_per_thread;
+    constexpr unsigned int items_per_warp   = warp_size * items_per_thread;
+    constexpr unsigned int items_per_slice  = items_per_warp * warp_reduce_by_key_tiles;
+    constexpr unsigned int max_warp_size    = WithCarry ? items_per_slice : items_per_warp;
+    constexpr unsigned int grid_size        = 13;
+    constexpr unsigned int warps = grid_size * warp_reduce_by_key_block_size / warp_size;
+    constexpr size_t       size  = size_t{items_per_slice} * warps;
+
+    const int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+    SKIP_IF_UNSUPPORTED_WARP_SIZE(warp_size, device_id);
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        // The first warps cover the empty and full edge cases, and runs that span all tiles.
+        std::vector<unsigned int> sizes
+            = test_utils::get_random_data<unsigned int>(warps, 0, max_warp_size, seed_value);
+        sizes[0] = 0;
+        sizes[1] = max_warp_size;
+        sizes[2] = max_warp_size;
+        sizes[3] = items_per_warp;
+
+        // Small integral values, so that the aggregates do not depend on the order of the
+        // reduction.
+        const std::vector<int>  small_values
+            = test_utils::get_random_data<int>(size, 0, 10, seed_value);
+        std::vector<key_type>   keys(size);
+        std::vector<value_type> values(small_values.begin(), small_values.end());
+        engine_type                                 rng_engine(seed_value);
+        std::uniform_int_distribution<unsigned int> distribution(0, 99);
+        for(unsigned int warp = 0; warp < warps; warp++)
+        {
+            // The probability of a new run differs between the warps.
+            const unsigned int new_run_percent = warp == 2 ? 0 : warp % 5 * 10 + 1;
+            key_type           key             = key_type(0);
+            for(unsigned int i = 0; i < items_per_slice; i++)
+            {
+                if(distribution(rng_engine) < new_run_percent)
+                {
+                    key = static_cast<key_type>(key + 1);
+                }
+                keys[warp * items_per_slice + i] = key;
+            }
+        }
+
+        std::vector<key_type>     expected_unique(size);
+        std::vector<value_type>   expected_aggregates(size);
+        std::vector<unsigned int> expected_run_counts(warps, 0);
+        for(unsigned int warp = 0; warp < warps; warp++)
+        {
+            const size_t offset = warp * items_per_slice;
+            unsigned int runs   = 0;
+            for(size_t i = offset; i < offset + sizes[warp]; i++)
+            {
+                if(i == offset || keys[i] != keys[i - 1])
+                {
+                    expected_unique[offset + runs]     = keys[i];
+                    expected_aggregates[offset + runs] = values[i];
+                    runs++;
+                }
+                else
+                {
+                    expected_aggregates[offset + runs - 1] += values[i];
+                }
+            }
+            expected_run_counts[warp] = runs;
+        }
+
+        key_type*     d_keys;
+        value_type*   d_values;
+        unsigned int* d_sizes;
+        key_type*     d_unique;
+        value_type*   d_aggregates;
+        unsigned int* d_run_counts;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, size * sizeof(value_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_sizes, warps * sizeof(unsigned int)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique, size * sizeof(key_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_aggregates, size * sizeof(value_type)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_run_counts, warps * sizeof(unsigned int)));
+        HIP_CHECK(
+            hipMemcpy(d_keys, keys.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+        HIP_CHECK(
+            hipMemcpy(d_values, values.data(), size * sizeof(value_type), hipMemcpyHostToDevice));
+        HIP_CHECK(
+            hipMemcpy(d_sizes, sizes.data(), warps * sizeof(unsigned int), hipMemcpyHostToDevice));
+
+        warp_reduce_by_key_kernel<items_per_thread, warp_size, WithCarry>
+            <<<dim3(grid_size), dim3(warp_reduce_by_key_block_size), 0, 0>>>(d_keys,
+                                                                             d_values,
+                                                                             d_sizes,
+                                                                             d_unique,
+                                                                             d_aggregates,
+                                                                             d_run_counts);
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<key_type>     unique(size);
+        std::vector<value_type>   aggregates(size);
+        std::vector<unsigned int> run_counts(warps);
+        HIP_CHECK(
+            hipMemcpy(unique.data(), d_unique, size * sizeof(key_type), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(aggregates.data(),
+                            d_aggregates,
+                            size * sizeof(value_type),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(run_counts.data(),
+                            d_run_counts,
+                            warps * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(run_counts, expected_run_counts));
+        for(unsigned int warp = 0; warp < warps; warp++)
+        {
+            const size_t offset = warp * items_per_slice;
+            for(size_t i = offset; i < offset + run_counts[warp]; i++)
+            {
+                ASSERT_EQ(unique[i], expected_unique[i]) << "with index = " << i;
+                ASSERT_EQ(aggregates[i], expected_aggregates[i]) << "with index = " << i;
+            }
+        }
+
+        HIP_CHECK(hipFree(d_keys));
+        HIP_CHECK(hipFree(d_values));
+        HIP_CHECK(hipFree(d_sizes));
+        HIP_CHECK(hipFree(d_unique));
+        HIP_CHECK(hipFree(d_aggregates));
+        HIP_CHECK(hipFree(d_run_counts));
+    }
+}
+
+TYPED_TEST(RocprimWarpReduceByKeyTests, ReduceByKey)
+{
+    test_warp_reduce_by_key<typename TestFixture::params, false>();
+}
+
+TYPED_TEST(RocprimWarpReduceByKeyTests, ReduceByKeyCarry)
+{
+    test_warp_reduce_by_key<typename TestFixture::params, true>();
+}
@@ -0,0 +1,173 @@
+// MIT License
+//
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../common_test_header.hpp"
+
+// required rocprim headers
+#include <rocprim/device/tile_scheduler.hpp>
+#include <rocprim/device/work_queue.hpp>
+#include <rocprim/intrinsics/atomic.hpp>
+
+// required test headers
+#include "test_utils_data_generation.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+constexpr unsigned int queue_block_size = 256;
+
+// Every item is the depth of a binary tree, whose root pushes the two subtrees of a depth less
+template<class T>
+__global__ __launch_bounds__(queue_block_size) void expand_trees_kernel(
+    rocprim::work_queue<T> queue, unsigned long long* processed, unsigned long long* depth_sum)
+{
+    T                          depth;
+    rocprim::work_queue_status status;
+    while((status = queue.pop(depth)) != rocprim::work_queue_status::drained)
+    {
+        if(status == rocprim::work_queue_status::success)
+        {
+            rocprim::detail::atomic_add(processed, 1ull);
+            rocprim::detail::atomic_add(depth_sum, static_cast<unsigned long long>(depth));
+            const bool split = depth > 0;
+            queue.push(depth - 1, split);
+            queue.push(depth - 1, split);
+            queue.complete();
+        }
+    }
+}
+
+template<class T>
+class RocprimWorkQueueTests : public ::testing::Test
+{
+public:
+    using type = T;
+};
+
+using RocprimWorkQueueTestsTypes = ::testing::Types<unsigned int, int, unsigned long long>;
+
+TYPED_TEST_SUITE(RocprimWorkQueueTests, RocprimWorkQueueTestsTypes);
+
+TYPED_TEST(RocprimWorkQueueTests, ExpandTrees)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id = " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T          = typename TestFixture::type;
+    using queue_type = rocprim::work_queue<T>;
+
+    const hipStream_t stream = 0; // default
+
+    unsigned int grid_size;
+    HIP_CHECK(rocprim::get_persistent_grid_size(expand_trees_kernel<T>,
+                                                queue_block_size,
+                                                stream,
+                                                grid_size));
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed_value);
+
+        for(const unsigned int roots : {0u, 1u, 100u, 5000u})
+        {
+            SCOPED_TRACE(testing::Message() << "with roots = " << roots);
+
+            const std::vector<T> input = test_utils::get_random_data<T>(roots, 0, 10, seed_value);
+
+            // A tree of depth d has 2^(d+1) - 1 nodes, of which 2^(d-k) have the depth k
+            unsigned long long expected_processed = 0;
+            unsigned long long expected_depth_sum = 0;
+            for(const T root : input)
+            {
+                for(unsigned long long depth = 0; depth <= root; ++depth)
+                {
+                    const unsigned long long nodes = 1ull << (root - depth);
+                    expected_processed += nodes;
+                    expected_depth_sum += nodes * depth;
+                }
+            }
+            const unsigned int capacity = static_cast<unsigned int>(expected_processed);
+
+            T*                  d_input;
+            unsigned long long* d_counters;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (roots + 1) * sizeof(T)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_counters, 2 * sizeof(unsigned long long)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), roots * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t storage_size;
+            HIP_CHECK(queue_type::get_temp_storage_size(capacity, storage_size));
+            void* d_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_storage, storage_size));
+
+            queue_type queue;
+            ASSERT_EQ(queue_type::create(queue, d_storage, storage_size - 1, capacity),
+                      hipErrorInvalidValue);
+            HIP_CHECK(queue_type::create(queue, d_storage, storage_size, capacity));
+            ASSERT_EQ(queue.capacity(), capacity);
+            ASSERT_EQ(queue.initialize(d_input, capacity + 1, stream), hipErrorInvalidValue);
+
+            auto run = [&](const unsigned long long expected_items)
+            {
+                HIP_CHECK(hipMemset(d_counters, 0, 2 * sizeof(unsigned long long)));
+                HIP_CHECK(queue.initialize(d_input, roots, stream));
+                expand_trees_kernel<<<grid_size, queue_block_size, 0, stream>>>(queue,
+                                                                                d_counters,
+                                                                                d_counters + 1);
+                HIP_CHECK(hipGetLastError());
+
+                bool overflow;
+                HIP_CHECK(queue.get_overflow(stream, overflow));
+                unsigned long long counters[2];
+                HIP_CHECK(
+                    hipMemcpy(counters, d_counters, sizeof(counters), hipMemcpyDeviceToHost));
+                // Every item that fits is processed, and the others are reported
+                ASSERT_EQ(overflow, expected_items < expected_processed);
+                ASSERT_EQ(counters[0], expected_items);
+                if(!overflow)
+                {
+                    ASSERT_EQ(counters[1], expected_depth_sum);
+                }
+            };
+
+            // The queue is initialized before every launch
+            ASSERT_NO_FATAL_FAILURE(run(expected_processed));
+            ASSERT_NO_FATAL_FAILURE(run(expected_processed));
+
+            // With a capacity for half of the items, the queue overflows
+            if(capacity / 2 >= roots)
+            {
+                HIP_CHECK(queue_type::create(queue, d_storage, storage_size, capacity / 2));
+                ASSERT_NO_FATAL_FAILURE(run(capacity / 2));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_counters));
+            HIP_CHECK(hipFree(d_storage));
+        }
+    }
+}